@@ -256,8 +256,16 @@ ClipResults evaluateClipAtLocalTime(AnimationClip *clip, float localTime)
     const QVector<Channel> &channels = clip->channels();
     int i = 0;
     for (const Channel &channel : channels) {
-        for (const auto &channelComponent : qAsConst(channel.channelComponents))
-            channelResults[i++] = channelComponent.fcurve.evaluateAtTime(localTime);
+        if (channel.componentsShareLocalTimes && !channel.channelComponents.isEmpty()
+                && channel.channelComponents.first().fcurve.keyframeCount() > 0) {
+            // Look up the keyframes once for all components of the channel
+            const int lowerBound = channel.channelComponents.first().fcurve.lowerKeyframeBound(localTime);
+            for (const auto &channelComponent : qAsConst(channel.channelComponents))
+                channelResults[i++] = channelComponent.fcurve.evaluateAtTime(localTime, lowerBound);
+        } else {
+            for (const auto &channelComponent : qAsConst(channel.channelComponents))
+                channelResults[i++] = channelComponent.fcurve.evaluateAtTime(localTime);
+        }
     }
     return channelResults;
 }
@@ -343,31 +351,38 @@ QVector<Qt3DCore::QSceneChangePtr> preparePropertyChanges(Qt3DCore::QNodeId anim
         if (!mappingData.propertyName)
             continue;
 
-        // Build the new value from the channel/fcurve evaluation results
-        const QVariant v = buildPropertyValue(mappingData, channelResults);
-        if (!v.isValid())
-            continue;
-
-        // TODO: Avoid wrapping joint transform components up in a variant, just
-        // to immediately unwrap them again. Refactor buildPropertyValue() to call
-        // helper functions that we can call directly here for joints.
+        // Joint transform components are written straight into the skeleton's
+        // local poses without wrapping them up in a variant
         if (mappingData.skeleton && mappingData.jointIndex != -1) {
             // Remember that this skeleton is dirty. We will ask each dirty skeleton
             // to send its set of local poses to observers below.
             if (!dirtySkeletons.contains(mappingData.skeleton))
                 dirtySkeletons.push_back(mappingData.skeleton);
 
+            const int *indices = mappingData.channelIndices.constData();
             switch (mappingData.jointTransformComponent) {
             case Scale:
-                mappingData.skeleton->setJointScale(mappingData.jointIndex, v.value<QVector3D>());
+                mappingData.skeleton->setJointScale(mappingData.jointIndex,
+                                                    QVector3D(channelResults[indices[0]],
+                                                              channelResults[indices[1]],
+                                                              channelResults[indices[2]]));
                 break;
 
-            case Rotation:
-                mappingData.skeleton->setJointRotation(mappingData.jointIndex, v.value<QQuaternion>());
+            case Rotation: {
+                QQuaternion q(channelResults[indices[0]],
+                              channelResults[indices[1]],
+                              channelResults[indices[2]],
+                              channelResults[indices[3]]);
+                q.normalize();
+                mappingData.skeleton->setJointRotation(mappingData.jointIndex, q);
                 break;
+            }
 
             case Translation:
-                mappingData.skeleton->setJointTranslation(mappingData.jointIndex, v.value<QVector3D>());
+                mappingData.skeleton->setJointTranslation(mappingData.jointIndex,
+                                                          QVector3D(channelResults[indices[0]],
+                                                                    channelResults[indices[1]],
+                                                                    channelResults[indices[2]]));
                 break;
 
             default:
@@ -375,6 +390,11 @@ QVector<Qt3DCore::QSceneChangePtr> preparePropertyChanges(Qt3DCore::QNodeId anim
                 break;
             }
         } else {
+            // Build the new value from the channel/fcurve evaluation results
+            const QVariant v = buildPropertyValue(mappingData, channelResults);
+            if (!v.isValid())
+                continue;
+
             // Construct a property update change, set target, property and delivery options
             auto e = Qt3DCore::QPropertyUpdatedChangePtr::create(mappingData.targetId);
             e->setDeliveryFlags(Qt3DCore::QSceneChange::DeliverToAll);
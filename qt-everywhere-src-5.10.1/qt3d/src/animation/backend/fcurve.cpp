@@ -52,6 +52,32 @@ FCurve::FCurve()
 }
 
 float FCurve::evaluateAtTime(float localTime) const
+{
+    return evaluateAtTime(localTime, lowerKeyframeBound(localTime));
+}
+
+/*!
+    \internal
+
+    Returns the index of the keyframe starting the range that contains
+    \a localTime, or -1 if \a localTime is outside of the keyframes or
+    there is only one keyframe.
+ */
+int FCurve::lowerKeyframeBound(float localTime) const
+{
+    if (localTime < m_localTimes.first() || localTime > m_localTimes.last())
+        return -1;
+    return m_rangeFinder.findLowerBound(localTime);
+}
+
+/*!
+    \internal
+
+    Evaluates the curve at \a localTime using \a lowerBound, as returned by
+    lowerKeyframeBound() for this curve or for a curve with the same local
+    times, instead of searching for the keyframes again.
+ */
+float FCurve::evaluateAtTime(float localTime, int lowerBound) const
 {
     // TODO: Implement extrapolation beyond first/last keyframes
     if (localTime < m_localTimes.first()) {
@@ -59,8 +85,8 @@ float FCurve::evaluateAtTime(float localTime) const
     } else if (localTime > m_localTimes.last()) {
         return m_keyframes.last().value;
     } else {
-        // Find keyframes that sandwich the requested localTime
-        const int idx = m_rangeFinder.findLowerBound(localTime);
+        // Keyframes that sandwich the requested localTime
+        const int idx = lowerBound;
         if (idx < 0) // only one keyframe
             return m_keyframes.first().value;
 
@@ -197,6 +223,7 @@ void Channel::read(const QJsonObject &json)
         const QJsonObject channel = channelComponentsArray.at(i).toObject();
         channelComponents[i].read(channel);
     }
+    updateComponentsShareLocalTimes();
 }
 
 void Channel::setFromQChannel(const QChannel &qch)
@@ -207,6 +234,18 @@ void Channel::setFromQChannel(const QChannel &qch)
     int i = 0;
     for (const auto &frontendChannelComponent : qch)
         channelComponents[i++].setFromQChannelComponent(frontendChannelComponent);
+    updateComponentsShareLocalTimes();
+}
+
+void Channel::updateComponentsShareLocalTimes()
+{
+    componentsShareLocalTimes = true;
+    for (int i = 1, m = channelComponents.size(); i < m; ++i) {
+        if (!channelComponents[i].fcurve.hasSameLocalTimes(channelComponents[0].fcurve)) {
+            componentsShareLocalTimes = false;
+            break;
+        }
+    }
 }
 
 } // namespace Animation
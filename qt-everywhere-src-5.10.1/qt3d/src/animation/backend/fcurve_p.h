@@ -83,6 +83,9 @@ public:
     float endTime() const;
 
     float evaluateAtTime(float localTime) const;
+    float evaluateAtTime(float localTime, int lowerBound) const;
+    int lowerKeyframeBound(float localTime) const;
+    bool hasSameLocalTimes(const FCurve &other) const { return m_localTimes == other.m_localTimes; }
 
     void read(const QJsonObject &json);
     void setFromQChannelComponent(const QChannelComponent &qcc);
@@ -148,9 +151,13 @@ struct Channel
     QString name;
     int jointIndex = -1;
     QVector<ChannelComponent> channelComponents;
+    // True when all components have keyframes at the same local times, which
+    // lets them share the keyframe lookup during evaluation
+    bool componentsShareLocalTimes = false;
 
     void read(const QJsonObject &json);
     void setFromQChannel(const QChannel &qch);
+    void updateComponentsShareLocalTimes();
 };
 
 #ifndef QT_NO_DEBUG_STREAM
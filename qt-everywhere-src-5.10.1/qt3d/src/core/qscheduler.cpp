@@ -45,10 +45,33 @@
 #include <Qt3DCore/private/qaspectmanager_p.h>
 #include <Qt3DCore/private/qabstractaspectjobmanager_p.h>
 
+#include <QtCore/QHash>
+
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 namespace Qt3DCore {
 
+namespace {
+
+// Length of the longest chain of jobs waiting on job \a index, including itself
+int criticalPathLength(int index, const QVector<QVector<int> > &dependents, QVector<int> &lengths)
+{
+    if (lengths[index] > 0)
+        return lengths[index];
+
+    // Guard against dependency cycles, which the job manager would reject anyway
+    lengths[index] = 1;
+    int length = 1;
+    for (int dependent : dependents[index])
+        length = qMax(length, criticalPathLength(dependent, dependents, lengths) + 1);
+    lengths[index] = length;
+    return length;
+}
+
+} // anonymous
+
 QScheduler::QScheduler(QObject *parent)
     : QObject(parent)
     , m_aspectManager(nullptr)
@@ -85,6 +108,7 @@ void QScheduler::scheduleAndWaitForFrameAspectJobs(qint64 time)
         jobQueue << aspectJobs;
     }
 
+    prioritizeJobs(jobQueue);
     m_aspectManager->jobManager()->enqueueJobs(jobQueue);
 
     // Do any other work here that the aspect thread can usefully be doing
@@ -93,6 +117,72 @@ void QScheduler::scheduleAndWaitForFrameAspectJobs(qint64 time)
     m_aspectManager->jobManager()->waitForAllJobs();
 }
 
+/*!
+    \internal
+
+    Reorders \a jobs so that the jobs heading the longest chains of dependent
+    jobs are handed to the thread pool first, which keeps the critical path
+    of the frame as short as possible.
+
+    Aspects mostly hand out the same jobs with the same dependencies frame
+    after frame, so the resulting order is cached and only recomputed when
+    the job graph changes.
+ */
+void QScheduler::prioritizeJobs(QVector<QAspectJobPtr> &jobs)
+{
+    const int jobCount = jobs.size();
+    if (jobCount < 2)
+        return;
+
+    QVector<quintptr> jobGraph;
+    jobGraph.reserve(jobCount * 3);
+    for (const QAspectJobPtr &job : qAsConst(jobs)) {
+        const QVector<QWeakPointer<QAspectJob> > dependencies = job->dependencies();
+        jobGraph.append(quintptr(job.data()));
+        jobGraph.append(quintptr(dependencies.size()));
+        for (const QWeakPointer<QAspectJob> &dependency : dependencies)
+            jobGraph.append(quintptr(dependency.toStrongRef().data()));
+    }
+
+    if (jobGraph != m_jobGraph) {
+        m_jobGraph = jobGraph;
+
+        QHash<quintptr, int> indexes;
+        indexes.reserve(jobCount);
+        for (int i = 0; i < jobCount; ++i)
+            indexes.insert(quintptr(jobs.at(i).data()), i);
+
+        QVector<QVector<int> > dependents(jobCount);
+        int pos = 0;
+        for (int i = 0; i < jobCount; ++i) {
+            const int dependencyCount = int(jobGraph.at(pos + 1));
+            pos += 2;
+            for (int j = 0; j < dependencyCount; ++j, ++pos) {
+                const auto it = indexes.constFind(jobGraph.at(pos));
+                if (it != indexes.constEnd())
+                    dependents[it.value()].append(i);
+            }
+        }
+
+        QVector<int> lengths(jobCount, 0);
+        for (int i = 0; i < jobCount; ++i)
+            criticalPathLength(i, dependents, lengths);
+
+        m_executionOrder.resize(jobCount);
+        for (int i = 0; i < jobCount; ++i)
+            m_executionOrder[i] = i;
+        std::stable_sort(m_executionOrder.begin(), m_executionOrder.end(), [&lengths] (int a, int b) {
+            return lengths.at(a) > lengths.at(b);
+        });
+    }
+
+    QVector<QAspectJobPtr> orderedJobs;
+    orderedJobs.reserve(jobCount);
+    for (int index : qAsConst(m_executionOrder))
+        orderedJobs.append(jobs.at(index));
+    jobs.swap(orderedJobs);
+}
+
 } // namespace Qt3DCore
 
 QT_END_NAMESPACE
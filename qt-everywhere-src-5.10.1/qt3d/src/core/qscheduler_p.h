@@ -41,7 +41,9 @@
 #define QT3DCORE_QSCHEDULER_P_H
 
 #include <Qt3DCore/qt3dcore_global.h>
+#include <Qt3DCore/qaspectjob.h>
 #include <QtCore/QObject>
+#include <QtCore/QVector>
 
 //
 //  W A R N I N G
@@ -73,7 +75,14 @@ public:
     virtual void scheduleAndWaitForFrameAspectJobs(qint64 time);
 
 private:
+    void prioritizeJobs(QVector<QAspectJobPtr> &jobs);
+
     QAspectManager *m_aspectManager;
+
+    // Job graph of the previous frame, used to skip recomputing the
+    // execution order when the topology did not change
+    QVector<quintptr> m_jobGraph;
+    QVector<int> m_executionOrder;
 };
 
 } // namespace Qt3DCore
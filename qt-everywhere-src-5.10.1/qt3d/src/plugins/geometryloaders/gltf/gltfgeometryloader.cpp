@@ -40,6 +40,7 @@
 #include "gltfgeometryloader.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QFile>
 #include <QtCore/QJsonArray>
 #include <QtCore/QJsonObject>
 #include <QtCore/QVersionNumber>
@@ -49,6 +50,8 @@
 #include <Qt3DRender/QGeometry>
 #include <Qt3DRender/private/renderlogging_p.h>
 
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 #ifndef qUtf16PrintableImpl // -Impl is a Qt 5.8 feature
@@ -83,6 +86,20 @@ Q_LOGGING_CATEGORY(GLTFGeometryLoaderLog, "Qt3D.GLTFGeometryLoader", QtWarningMs
 #define KEY_BUFFER_VIEWS        QLatin1String("bufferViews")
 #define KEY_COMPONENT_TYPE      QLatin1String("componentType")
 
+namespace {
+
+// Always returns a deep copy, the buffer data may be a mapped file that goes
+// away once parsing is done
+QByteArray bufferViewData(const QByteArray &data, quint64 offset, quint64 length)
+{
+    if (offset >= quint64(data.size()))
+        return QByteArray();
+    length = qMin(length, quint64(data.size()) - offset);
+    return QByteArray(data.constData() + offset, int(length));
+}
+
+} // anonymous
+
 GLTFGeometryLoader::GLTFGeometryLoader()
     : m_geometry(nullptr)
 {
@@ -128,6 +145,7 @@ bool GLTFGeometryLoader::load(QIODevice *ioDev, const QString &subMesh)
 GLTFGeometryLoader::BufferData::BufferData()
     : length(0)
     , data(nullptr)
+    , file(nullptr)
 {
 }
 
@@ -135,6 +153,7 @@ GLTFGeometryLoader::BufferData::BufferData(const QJsonObject &json)
     : length(json.value(KEY_BYTE_LENGTH).toInt())
     , path(json.value(KEY_URI).toString())
     , data(nullptr)
+    , file(nullptr)
 {
 }
 
@@ -323,7 +342,7 @@ void GLTFGeometryLoader::processJSONBufferView(const QString &id, const QJsonObj
 
     const quint64 len = json.value(KEY_BYTE_LENGTH).toInt();
 
-    QByteArray bytes = bufferData.data->mid(offset, len);
+    QByteArray bytes = bufferViewData(*bufferData.data, offset, len);
     if (Q_UNLIKELY(bytes.count() != int(len))) {
         qCWarning(GLTFGeometryLoaderLog, "failed to read sufficient bytes from: %ls for view %ls",
                   qUtf16PrintableImpl(bufferData.path), qUtf16PrintableImpl(id));
@@ -361,7 +380,7 @@ void GLTFGeometryLoader::processJSONBufferViewV2(const QJsonObject &json)
     }
 
     const quint64 len = json.value(KEY_BYTE_LENGTH).toInt();
-    QByteArray bytes = bufferData.data->mid(offset, len);
+    QByteArray bytes = bufferViewData(*bufferData.data, offset, len);
     if (Q_UNLIKELY(bytes.count() != int(len))) {
         qCWarning(GLTFGeometryLoaderLog, "failed to read sufficient bytes from: %ls for view",
                   qUtf16PrintableImpl(bufferData.path));
@@ -544,7 +563,7 @@ void GLTFGeometryLoader::loadBufferData()
 {
     for (auto &bufferData : m_gltf1.m_bufferDatas) {
         if (!bufferData.data) {
-            bufferData.data = new QByteArray(resolveLocalData(bufferData.path));
+            bufferData.data = new QByteArray(resolveLocalData(bufferData.path, &bufferData.file));
         }
     }
 }
@@ -554,6 +573,7 @@ void GLTFGeometryLoader::unloadBufferData()
     for (const auto &bufferData : qAsConst(m_gltf1.m_bufferDatas)) {
         QByteArray *data = bufferData.data;
         delete data;
+        delete bufferData.file;
     }
 }
 
@@ -561,7 +581,7 @@ void GLTFGeometryLoader::loadBufferDataV2()
 {
     for (auto &bufferData : m_gltf2.m_bufferDatas) {
         if (!bufferData.data)
-            bufferData.data = new QByteArray(resolveLocalData(bufferData.path));
+            bufferData.data = new QByteArray(resolveLocalData(bufferData.path, &bufferData.file));
     }
 }
 
@@ -570,18 +590,30 @@ void GLTFGeometryLoader::unloadBufferDataV2()
     for (const auto &bufferData : qAsConst(m_gltf2.m_bufferDatas)) {
         QByteArray *data = bufferData.data;
         delete data;
+        delete bufferData.file;
     }
 }
 
-QByteArray GLTFGeometryLoader::resolveLocalData(const QString &path) const
+QByteArray GLTFGeometryLoader::resolveLocalData(const QString &path, QFile **mappedFile) const
 {
     QDir d(m_basePath);
     Q_ASSERT(d.exists());
 
     QString absPath = d.absoluteFilePath(path);
-    QFile f(absPath);
-    f.open(QIODevice::ReadOnly);
-    return f.readAll();
+    QScopedPointer<QFile> f(new QFile(absPath));
+    if (!f->open(QIODevice::ReadOnly))
+        return QByteArray();
+
+    // Map binary buffers rather than reading them: the buffer views only copy
+    // the ranges they use, so the file is never held in memory twice
+    const qint64 size = f->size();
+    if (size > 0 && size <= std::numeric_limits<int>::max()) {
+        if (uchar *mapped = f->map(0, size)) {
+            *mappedFile = f.take();
+            return QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), int(size));
+        }
+    }
+    return f->readAll();
 }
 
 QAttribute::VertexBaseType GLTFGeometryLoader::accessorTypeFromJSON(int componentType)
@@ -61,6 +61,8 @@
 
 QT_BEGIN_NAMESPACE
 
+class QFile;
+
 namespace Qt3DRender {
 
 #define GLTFGEOMETRYLOADER_EXT QLatin1String("gltf")
@@ -90,6 +92,8 @@ class GLTFGeometryLoader : public QGeometryLoaderInterface
         quint64 length;
         QString path;
         QByteArray *data;
+        // Keeps the mapping alive while data refers to it
+        QFile *file;
         // type if ever useful
     };
 
@@ -168,7 +172,7 @@ protected:
     void loadBufferDataV2();
     void unloadBufferDataV2();
 
-    QByteArray resolveLocalData(const QString &path) const;
+    QByteArray resolveLocalData(const QString &path, QFile **mappedFile) const;
 
     static QAttribute::VertexBaseType accessorTypeFromJSON(int componentType);
     static uint accessorDataSizeFromJson(const QString &type);
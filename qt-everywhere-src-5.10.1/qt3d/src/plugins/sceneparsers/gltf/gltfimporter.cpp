@@ -41,6 +41,7 @@
 #include "gltfimporter.h"
 
 #include <QtCore/qdir.h>
+#include <QtCore/qfile.h>
 #include <QtCore/qfileinfo.h>
 #include <QtCore/qjsonarray.h>
 #include <QtCore/qjsonobject.h>
@@ -106,6 +107,8 @@
 
 #include <private/qurlhelper_p.h>
 
+#include <limits>
+
 #ifndef qUtf16PrintableImpl // -Impl is a Qt 5.8 feature
 #  define qUtf16PrintableImpl(string) \
     static_cast<const wchar_t*>(static_cast<const void*>(string.utf16()))
@@ -251,6 +254,16 @@ Qt3DRender::QFilterKey *buildFilterKey(const QString &key, const QJsonValue &val
     return fk;
 }
 
+// Always returns a deep copy, the buffer data may be a mapped file that goes
+// away once parsing is done
+QByteArray bufferViewData(const QByteArray &data, quint64 offset, quint64 length)
+{
+    if (offset >= quint64(data.size()))
+        return QByteArray();
+    length = qMin(length, quint64(data.size()) - offset);
+    return QByteArray(data.constData() + offset, int(length));
+}
+
 } // namespace
 
 namespace Qt3DRender {
@@ -559,13 +572,15 @@ Qt3DCore::QEntity* GLTFImporter::scene(const QString &id)
 GLTFImporter::BufferData::BufferData()
     : length(0)
     , data(nullptr)
+    , file(nullptr)
 {
 }
 
 GLTFImporter::BufferData::BufferData(const QJsonObject &json)
     : length(json.value(KEY_BYTE_LENGTH).toInt()),
       path(json.value(KEY_URI).toString()),
-      data(nullptr)
+      data(nullptr),
+      file(nullptr)
 {
 }
 
@@ -1161,7 +1176,7 @@ void GLTFImporter::processJSONBufferView(const QString &id, const QJsonObject& j
 
     quint64 len = json.value(KEY_BYTE_LENGTH).toInt();
 
-    QByteArray bytes = bufferData.data->mid(offset, len);
+    QByteArray bytes = bufferViewData(*bufferData.data, offset, len);
     if (Q_UNLIKELY(bytes.count() != int(len))) {
         qCWarning(GLTFImporterLog, "failed to read sufficient bytes from: %ls for view %ls",
                   qUtf16PrintableImpl(bufferData.path), qUtf16PrintableImpl(id));
@@ -1684,7 +1699,7 @@ void GLTFImporter::loadBufferData()
 {
     for (auto &bufferData : m_bufferDatas) {
         if (!bufferData.data) {
-            bufferData.data = new QByteArray(resolveLocalData(bufferData.path));
+            bufferData.data = new QByteArray(resolveLocalData(bufferData.path, &bufferData.file));
         }
     }
 }
@@ -1697,18 +1712,30 @@ void GLTFImporter::unloadBufferData()
     for (const auto &bufferData : qAsConst(m_bufferDatas)) {
         QByteArray *data = bufferData.data;
         delete data;
+        delete bufferData.file;
     }
 }
 
-QByteArray GLTFImporter::resolveLocalData(const QString &path) const
+QByteArray GLTFImporter::resolveLocalData(const QString &path, QFile **mappedFile) const
 {
     QDir d(m_basePath);
     Q_ASSERT(d.exists());
 
     QString absPath = d.absoluteFilePath(path);
-    QFile f(absPath);
-    f.open(QIODevice::ReadOnly);
-    return f.readAll();
+    QScopedPointer<QFile> f(new QFile(absPath));
+    if (!f->open(QIODevice::ReadOnly))
+        return QByteArray();
+
+    // Map binary buffers rather than reading them: the buffer views only copy
+    // the ranges they use, so the file is never held in memory twice
+    const qint64 size = f->size();
+    if (size > 0 && size <= std::numeric_limits<int>::max()) {
+        if (uchar *mapped = f->map(0, size)) {
+            *mappedFile = f.take();
+            return QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), int(size));
+        }
+    }
+    return f->readAll();
 }
 
 QVariant GLTFImporter::parameterValueFromJSON(int type, const QJsonValue &value) const
@@ -63,6 +63,7 @@
 QT_BEGIN_NAMESPACE
 
 class QByteArray;
+class QFile;
 
 namespace Qt3DCore {
 class QEntity;
@@ -113,6 +114,8 @@ private:
         quint64 length;
         QString path;
         QByteArray *data;
+        // Keeps the mapping alive while data refers to it
+        QFile *file;
         // type if ever useful
     };
 
@@ -169,7 +172,7 @@ private:
     void loadBufferData();
     void unloadBufferData();
 
-    QByteArray resolveLocalData(const QString &path) const;
+    QByteArray resolveLocalData(const QString &path, QFile **mappedFile) const;
 
     QVariant parameterValueFromJSON(int type, const QJsonValue &value) const;
     static QAttribute::VertexBaseType accessorTypeFromJSON(int componentType);
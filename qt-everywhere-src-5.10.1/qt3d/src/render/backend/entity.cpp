@@ -81,6 +81,7 @@ Entity::Entity()
     : BackendNode()
     , m_nodeManagers(nullptr)
     , m_boundingDirty(false)
+    , m_worldTransformDirty(true)
     , m_treeEnabled(true)
 {
 }
@@ -127,6 +128,7 @@ void Entity::cleanup()
     m_worldBoundingVolume.reset();
     m_worldBoundingVolumeWithChildren.reset();
     m_boundingDirty = false;
+    m_worldTransformDirty = true;
     QBackendNode::setEnabled(false);
 }
 
@@ -138,6 +140,7 @@ void Entity::setParentHandle(HEntity parentHandle)
     if (parent != nullptr && parent->m_childrenHandles.contains(m_handle))
         parent->m_childrenHandles.removeAll(m_handle);
     m_parentHandle = parentHandle;
+    m_worldTransformDirty = true;
     parent = m_nodeManagers->renderNodesManager()->data(parentHandle);
     if (parent != nullptr && !parent->m_childrenHandles.contains(m_handle))
         parent->m_childrenHandles.append(m_handle);
@@ -270,8 +273,10 @@ void Entity::appendChildHandle(HEntity childHandle)
     if (!m_childrenHandles.contains(childHandle)) {
         m_childrenHandles.append(childHandle);
         Entity *child = m_nodeManagers->renderNodesManager()->data(childHandle);
-        if (child != nullptr)
+        if (child != nullptr) {
             child->m_parentHandle = m_handle;
+            child->m_worldTransformDirty = true;
+        }
     }
 }
 
@@ -306,6 +311,7 @@ void Entity::addComponent(Qt3DCore::QNodeIdTypePair idAndType)
     qCDebug(Render::RenderNodes) << Q_FUNC_INFO << "id =" << id << type->className();
     if (type->inherits(&Qt3DCore::QTransform::staticMetaObject)) {
         m_transformComponent = id;
+        m_worldTransformDirty = true;
     } else if (type->inherits(&QCameraLens::staticMetaObject)) {
         m_cameraComponent = id;
     } else if (type->inherits(&QLayer::staticMetaObject)) {
@@ -338,6 +344,7 @@ void Entity::removeComponent(Qt3DCore::QNodeId nodeId)
 {
     if (m_transformComponent == nodeId) {
         m_transformComponent = QNodeId();
+        m_worldTransformDirty = true;
     } else if (m_cameraComponent == nodeId) {
         m_cameraComponent = QNodeId();
     } else if (m_layerComponents.contains(nodeId)) {
@@ -116,6 +116,10 @@ public:
     bool isBoundingVolumeDirty() const;
     void unsetBoundingVolumeDirty();
 
+    bool isWorldTransformDirty() const { return m_worldTransformDirty; }
+    void setWorldTransformDirty() { m_worldTransformDirty = true; }
+    void unsetWorldTransformDirty() { m_worldTransformDirty = false; }
+
     void setTreeEnabled(bool enabled) { m_treeEnabled = enabled; }
     bool isTreeEnabled() const { return m_treeEnabled; }
 
@@ -206,6 +210,8 @@ private:
 
     QString m_objectName;
     bool m_boundingDirty;
+    // true when the world transform needs to be recomputed from the parent
+    bool m_worldTransformDirty;
     // true only if this and all parent nodes are enabled
     bool m_treeEnabled;
 };
@@ -1263,6 +1263,7 @@ Renderer::ViewSubmissionResultData Renderer::submitRenderViews(const QVector<Ren
     m_lastFrameCorrect.store(1);    // everything fine until now.....
 
     qCDebug(Memory) << Q_FUNC_INFO << "rendering frame ";
+    m_graphicsContext->resetStateChangeCounts();
 
     // We might not want to render on the default FBO
     uint lastBoundFBOId = m_graphicsContext->boundFrameBufferObject();
@@ -1440,6 +1441,8 @@ Renderer::ViewSubmissionResultData Renderer::submitRenderViews(const QVector<Ren
     queueElapsed = timer.elapsed() - queueElapsed;
     qCDebug(Rendering) << Q_FUNC_INFO << "Submission of Queue in " << queueElapsed << "ms <=> " << queueElapsed / renderViewsCount << "ms per RenderView <=> Avg " << 1000.0f / (queueElapsed * 1.0f/ renderViewsCount * 1.0f) << " RenderView/s";
     qCDebug(Rendering) << Q_FUNC_INFO << "Submission Completed in " << timer.elapsed() << "ms";
+    qCDebug(Rendering) << Q_FUNC_INFO << "Render state set changes:" << m_graphicsContext->stateSetChangeCount()
+                       << "render states changed:" << m_graphicsContext->stateChangeCount();
 
     // Stores the necessary information to safely perform
     // the last swap buffer call
@@ -1778,6 +1781,7 @@ bool Renderer::executeCommandsSubmission(const RenderView *rv)
     // Save the RenderView base stateset
     RenderStateSet *globalState = m_graphicsContext->currentStateSet();
     OpenGLVertexArrayObject *vao = nullptr;
+    OpenGLVertexArrayObject *boundVao = nullptr;
 
     for (RenderCommand *command : qAsConst(commands)) {
 
@@ -1807,10 +1811,11 @@ bool Renderer::executeCommandsSubmission(const RenderView *rv)
                 }
             }
 
-            {
+            if (vao != boundVao) {
                 Profiling::GLTimeRecorder recorder(Profiling::VAOUpdate);
                 // Bind VAO
                 vao->bind();
+                boundVao = vao;
             }
 
             {
@@ -1848,8 +1853,8 @@ bool Renderer::executeCommandsSubmission(const RenderView *rv)
 
     // We cache the VAO and release it only at the end of the exectute frame
     // We try to minimize VAO binding between RenderCommands
-    if (vao)
-        vao->release();
+    if (boundVao)
+        boundVao->release();
 
     // Reset to the state we were in before executing the render commands
     m_graphicsContext->setCurrentStateSet(globalState);
@@ -265,14 +265,24 @@ RenderView::RenderView()
 RenderView::~RenderView()
 {
     delete m_stateSet;
+    const bool commandsFromAllocators = !m_commandAllocators.isEmpty();
     for (RenderCommand *command : qAsConst(m_commands)) {
         delete command->m_stateSet;
-        delete command;
+        // The allocators release the memory of their commands all at once
+        if (commandsFromAllocators)
+            command->~RenderCommand();
+        else
+            delete command;
     }
 }
 
 namespace {
 
+inline RenderCommand *createRenderCommand(Qt3DCore::QFrameAllocator *allocator)
+{
+    return allocator ? allocator->allocate<RenderCommand>() : new RenderCommand();
+}
+
 template<int SortType>
 struct AdjacentSubRangeFinder
 {
@@ -543,7 +553,8 @@ void RenderView::addClearBuffers(const ClearBuffers *cb) {
 }
 
 // If we are there, we know that entity had a GeometryRenderer + Material
-QVector<RenderCommand *> RenderView::buildDrawRenderCommands(const QVector<Entity *> &entities) const
+QVector<RenderCommand *> RenderView::buildDrawRenderCommands(const QVector<Entity *> &entities,
+                                                             Qt3DCore::QFrameAllocator *allocator) const
 {
     // Note: since many threads can be building render commands
     // we need to ensure that the UniformBlockValueBuilder they are using
@@ -574,7 +585,7 @@ QVector<RenderCommand *> RenderView::buildDrawRenderCommands(const QVector<Entit
             // 1 RenderCommand per RenderPass pass on an Entity with a Mesh
             for (const RenderPassParameterData &passData : renderPassData) {
                 // Add the RenderPass Parameters
-                RenderCommand *command = new RenderCommand();
+                RenderCommand *command = createRenderCommand(allocator);
 
                 // Project the camera-to-object-center vector onto the camera
                 // view vector. This gives a depth value suitable as the key
@@ -675,7 +686,8 @@ QVector<RenderCommand *> RenderView::buildDrawRenderCommands(const QVector<Entit
     return commands;
 }
 
-QVector<RenderCommand *> RenderView::buildComputeRenderCommands(const QVector<Entity *> &entities) const
+QVector<RenderCommand *> RenderView::buildComputeRenderCommands(const QVector<Entity *> &entities,
+                                                                Qt3DCore::QFrameAllocator *allocator) const
 {
     // Note: since many threads can be building render commands
     // we need to ensure that the UniformBlockValueBuilder they are using
@@ -707,7 +719,7 @@ QVector<RenderCommand *> RenderView::buildComputeRenderCommands(const QVector<En
                 RenderPass *pass = passData.pass;
                 parametersFromParametersProvider(&globalParameters, m_manager->parameterManager(), pass);
 
-                RenderCommand *command = new RenderCommand();
+                RenderCommand *command = createRenderCommand(allocator);
                 command->m_type = RenderCommand::Compute;
                 command->m_workGroups[0] = std::max(m_workGroups[0], computeJob->x());
                 command->m_workGroups[1] = std::max(m_workGroups[1], computeJob->y());
@@ -216,9 +216,13 @@ public:
 
     RenderPassList passesAndParameters(ParameterInfoList *parameter, Entity *node, bool useDefaultMaterials = true);
 
-    QVector<RenderCommand *> buildDrawRenderCommands(const QVector<Entity *> &entities) const;
-    QVector<RenderCommand *> buildComputeRenderCommands(const QVector<Entity *> &entities) const;
+    QVector<RenderCommand *> buildDrawRenderCommands(const QVector<Entity *> &entities,
+                                                     Qt3DCore::QFrameAllocator *allocator = nullptr) const;
+    QVector<RenderCommand *> buildComputeRenderCommands(const QVector<Entity *> &entities,
+                                                        Qt3DCore::QFrameAllocator *allocator = nullptr) const;
     void setCommands(QVector<RenderCommand *> &commands) Q_DECL_NOTHROW { m_commands = commands; }
+    // Once set, the commands are owned by the allocators rather than allocated on the heap
+    void setCommandAllocators(const QVector<QSharedPointer<Qt3DCore::QFrameAllocator> > &allocators) { m_commandAllocators = allocators; }
     QVector<RenderCommand *> commands() const Q_DECL_NOTHROW { return m_commands; }
 
     void setAttachmentPack(const AttachmentPack &pack) { m_attachmentPack = pack; }
@@ -323,6 +327,7 @@ private:
     // render aspect is free to change the drawables on the next frame whilst
     // the render thread is submitting these commands.
     QVector<RenderCommand *> m_commands;
+    QVector<QSharedPointer<Qt3DCore::QFrameAllocator> > m_commandAllocators;
     mutable QVector<LightSource> m_lightSources;
     EnvironmentLight *m_environmentLight;
 
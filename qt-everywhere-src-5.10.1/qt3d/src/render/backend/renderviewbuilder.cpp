@@ -73,11 +73,18 @@ public:
 
         QVector<RenderCommand *> commands;
         commands.reserve(totalCommandCount);
+        QVector<QSharedPointer<Qt3DCore::QFrameAllocator> > commandAllocators;
+        commandAllocators.reserve(m_renderViewBuilderJobs.size());
 
         // Reduction
-        for (const auto &renderViewCommandBuilder : qAsConst(m_renderViewBuilderJobs))
+        for (const auto &renderViewCommandBuilder : qAsConst(m_renderViewBuilderJobs)) {
             commands += std::move(renderViewCommandBuilder->commands());
+            if (!renderViewCommandBuilder->commandAllocator().isNull())
+                commandAllocators.push_back(renderViewCommandBuilder->commandAllocator());
+        }
         rv->setCommands(commands);
+        // The RenderView keeps the command allocators alive until it is destroyed
+        rv->setCommandAllocators(commandAllocators);
 
         // Sort the commands
         rv->sort();
@@ -56,6 +56,7 @@ Transform::Transform()
     , m_rotation()
     , m_scale(1.0f, 1.0f, 1.0f)
     , m_translation()
+    , m_matrixDirty(true)
 {
 }
 
@@ -65,6 +66,7 @@ void Transform::cleanup()
     m_scale = QVector3D();
     m_translation = QVector3D();
     m_transformMatrix = QMatrix4x4();
+    m_matrixDirty = true;
     QBackendNode::setEnabled(false);
 }
 
@@ -114,6 +116,8 @@ void Transform::sceneChangeEvent(const Qt3DCore::QSceneChangePtr &e)
             updateMatrix();
         }
     }
+    // Enabling or disabling the transform changes the world transforms as well
+    m_matrixDirty = true;
     markDirty(AbstractRenderer::TransformDirty);
 
     BackendNode::sceneChangeEvent(e);
@@ -126,6 +130,7 @@ void Transform::updateMatrix()
     m.rotate(m_rotation);
     m.scale(m_scale);
     m_transformMatrix = m;
+    m_matrixDirty = true;
 }
 
 } // namespace Render
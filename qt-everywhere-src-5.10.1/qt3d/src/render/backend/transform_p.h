@@ -80,6 +80,9 @@ public:
 
     void updateMatrix();
 
+    bool isMatrixDirty() const { return m_matrixDirty; }
+    void unsetMatrixDirty() { m_matrixDirty = false; }
+
 private:
     void initializeFromPeer(const Qt3DCore::QNodeCreatedChangeBasePtr &change) Q_DECL_FINAL;
 
@@ -87,6 +90,8 @@ private:
     QQuaternion m_rotation;
     QVector3D m_scale;
     QVector3D m_translation;
+    // true until the world transforms of the entities using this transform were updated
+    bool m_matrixDirty;
 };
 
 } // namespace Render
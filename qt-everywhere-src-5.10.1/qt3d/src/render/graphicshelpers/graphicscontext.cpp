@@ -165,6 +165,8 @@ GraphicsContext::GraphicsContext()
     , m_defaultFBO(0)
     , m_boundArrayBuffer(nullptr)
     , m_stateSet(nullptr)
+    , m_stateSetChangeCount(0)
+    , m_stateChangeCount(0)
     , m_renderer(nullptr)
     , m_uboTempArray(QByteArray(1024, 0))
     , m_supportsVAO(true)
@@ -394,6 +396,7 @@ void GraphicsContext::setViewport(const QRectF &viewport, const QSize &surfaceSi
 void GraphicsContext::releaseOpenGL()
 {
     m_shaderCache.clear();
+    m_uniformValueCache.clear();
     m_renderBufferHash.clear();
 
     // Stop and destroy the OpenGL logger
@@ -492,6 +495,9 @@ QOpenGLShaderProgram *GraphicsContext::createShaderProgram(Shader *shaderNode)
     if (!linkSucceeded)
         return nullptr;
 
+    // The program id may belong to a previously destroyed program
+    m_uniformValueCache.remove(shaderProgram->programId());
+
     // take from scoped-pointer so it doesn't get deleted
     return shaderProgram.take();
 }
@@ -860,8 +866,10 @@ void GraphicsContext::setCurrentStateSet(RenderStateSet *ss)
     if (ss == m_stateSet)
         return;
 
-    if (ss)
+    if (ss) {
         ss->apply(this);
+        ++m_stateSetChangeCount;
+    }
     m_stateSet = ss;
 }
 
@@ -1271,6 +1279,11 @@ bool GraphicsContext::setParameters(ShaderParameterPack &parameterPack)
     const PackUniformHash values = parameterPack.uniforms();
     const QVector<ShaderUniform> activeUniforms = parameterPack.submissionUniforms();
 
+    // Uniform values are program state: when consecutive commands share a
+    // material only the values that differ (typically the model matrices)
+    // need to be uploaded again
+    QHash<int, UniformValue> &uploadedValues = m_uniformValueCache[shader->programId()];
+
     for (const ShaderUniform &uniform : activeUniforms) {
         // We can use [] as we are sure the the uniform wouldn't
         // be un activeUniforms if there wasn't a matching value
@@ -1281,6 +1294,14 @@ bool GraphicsContext::setParameters(ShaderParameterPack &parameterPack)
                 v.constData<UniformValue::Texture>()->textureId == -1)
             continue;
 
+        const auto uploadedIt = uploadedValues.find(uniform.m_location);
+        if (uploadedIt == uploadedValues.end())
+            uploadedValues.insert(uniform.m_location, v);
+        else if (uploadedIt.value() != v)
+            uploadedIt.value() = v;
+        else
+            continue;
+
         applyUniform(uniform, v);
     }
     // if not all data is valid, the next frame will be rendered immediately
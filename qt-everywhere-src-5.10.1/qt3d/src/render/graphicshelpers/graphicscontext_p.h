@@ -202,6 +202,12 @@ public:
 
     void setCurrentStateSet(RenderStateSet* ss);
     RenderStateSet *currentStateSet() const;
+
+    // Statistics about render state changes since the last reset
+    int stateSetChangeCount() const { return m_stateSetChangeCount; }
+    int stateChangeCount() const { return m_stateChangeCount; }
+    void addStateChanges(int count) { m_stateChangeCount += count; }
+    void resetStateChangeCounts() { m_stateSetChangeCount = 0; m_stateChangeCount = 0; }
     const GraphicsApiFilterData *contextInfo() const;
 
     // Wrapper methods
@@ -288,6 +294,8 @@ private:
     ShaderCache m_shaderCache;
     QOpenGLShaderProgram *m_activeShader;
     ProgramDNA m_activeShaderDNA;
+    // Values last uploaded to the default uniform block of each program, by location
+    QHash<GLuint, QHash<int, UniformValue> > m_uniformValueCache;
 
     QHash<Qt3DCore::QNodeId, HGLBuffer> m_renderBufferHash;
     QHash<Qt3DCore::QNodeId, GLuint> m_renderTargets;
@@ -319,6 +327,8 @@ private:
     GLBuffer *m_boundArrayBuffer;
 
     RenderStateSet* m_stateSet;
+    int m_stateSetChangeCount;
+    int m_stateChangeCount;
 
     Renderer *m_renderer;
     GraphicsApiFilterData m_contextInfo;
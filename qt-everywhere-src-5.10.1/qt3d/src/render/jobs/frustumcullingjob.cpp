@@ -75,35 +75,48 @@ void FrustumCullingJob::run()
         Plane(m_viewProjection.row(3) - m_viewProjection.row(2)), // Back
     };
 
-    cullScene(m_root, planes);
+    cullScene(m_root, planes, AllPlanes);
 
     // sort needed for set_intersection in RenderViewBuilder
     std::sort(m_visibleEntities.begin(), m_visibleEntities.end());
 }
 
-void FrustumCullingJob::cullScene(Entity *e, const Plane *planes)
+void FrustumCullingJob::cullScene(Entity *e, const Plane *planes, int planeMask)
 {
     const Sphere *s = e->worldBoundingVolumeWithChildren();
 
-    // Unrolled loop
-    if (QVector3D::dotProduct(s->center(), planes[0].normal) + planes[0].d < -s->radius())
-        return;
-    if (QVector3D::dotProduct(s->center(), planes[1].normal) + planes[1].d < -s->radius())
-        return;
-    if (QVector3D::dotProduct(s->center(), planes[2].normal) + planes[2].d < -s->radius())
-        return;
-    if (QVector3D::dotProduct(s->center(), planes[3].normal) + planes[3].d < -s->radius())
-        return;
-    if (QVector3D::dotProduct(s->center(), planes[4].normal) + planes[4].d < -s->radius())
-        return;
-    if (QVector3D::dotProduct(s->center(), planes[5].normal) + planes[5].d < -s->radius())
+    // Only test against the planes the parent volume was not entirely inside of:
+    // the volume of an entity encloses the volumes of all its children
+    for (int i = 0; i < 6; ++i) {
+        const int planeBit = 1 << i;
+        if (!(planeMask & planeBit))
+            continue;
+        const float distance = QVector3D::dotProduct(s->center(), planes[i].normal) + planes[i].d;
+        if (distance < -s->radius())
+            return;
+        if (distance >= s->radius())
+            planeMask &= ~planeBit;
+    }
+
+    if (planeMask == 0) {
+        addSubtree(e);
         return;
+    }
+
+    m_visibleEntities.push_back(e);
+
+    const QVector<Entity *> children = e->children();
+    for (Entity *c : children)
+        cullScene(c, planes, planeMask);
+}
 
+void FrustumCullingJob::addSubtree(Entity *e)
+{
     m_visibleEntities.push_back(e);
 
     const QVector<Entity *> children = e->children();
     for (Entity *c : children)
-        cullScene(c, planes);
+        addSubtree(c);
 }
 
 } // Render
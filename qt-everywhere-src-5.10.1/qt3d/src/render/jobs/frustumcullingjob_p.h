@@ -80,7 +80,10 @@ public:
     void run() Q_DECL_FINAL;
 
 private:
-    void cullScene(Entity *e, const Plane *planes);
+    enum { AllPlanes = 0x3f };
+
+    void cullScene(Entity *e, const Plane *planes, int planeMask);
+    void addSubtree(Entity *e);
     QMatrix4x4 m_viewProjection;
     Entity *m_root;
     QVector<Entity *> m_visibleEntities;
@@ -52,6 +52,7 @@
 #include <Qt3DRender/private/segmentsvisitor_p.h>
 #include <Qt3DRender/private/pointsvisitor_p.h>
 
+#include <algorithm>
 #include <vector>
 
 QT_BEGIN_NAMESPACE
@@ -162,17 +163,40 @@ public:
 
     TriangleCollisionVisitor(NodeManagers* manager, const Entity *root, const RayCasting::QRay3D& ray,
                      bool frontFaceRequested, bool backFaceRequested)
-        : TrianglesVisitor(manager), m_root(root), m_ray(ray), m_triangleIndex(0)
+        : TrianglesVisitor(manager), m_root(root), m_ray(ray), m_testRay(ray), m_triangleIndex(0)
         , m_frontFaceRequested(frontFaceRequested), m_backFaceRequested(backFaceRequested)
+        , m_modelSpace(false)
     {
+        // Rather than transforming the three vertices of every triangle to world
+        // space, bring the ray into model space once. The segment parameter and
+        // the barycentric coordinates of a hit are invariant under affine maps.
+        const QMatrix4x4 &mat = *m_root->worldTransform();
+        if (!mat.isAffine())
+            return;
+        bool invertible = false;
+        const QMatrix4x4 inverse = mat.inverted(&invertible);
+        if (!invertible)
+            return;
+
+        const QVector3D origin = inverse * m_ray.origin();
+        const QVector3D end = inverse * m_ray.point(m_ray.distance());
+        m_testRay = RayCasting::QRay3D(origin, end - origin, 1.0f);
+        m_modelSpace = true;
+
+        // A mirroring transform flips the winding of the triangles
+        if (mat.determinant() < 0.0)
+            std::swap(m_frontFaceRequested, m_backFaceRequested);
     }
 
 private:
     const Entity *m_root;
     RayCasting::QRay3D m_ray;
+    // The ray the triangles are tested against, in model space when possible
+    RayCasting::QRay3D m_testRay;
     uint m_triangleIndex;
     bool m_frontFaceRequested;
     bool m_backFaceRequested;
+    bool m_modelSpace;
 
     void visit(uint andx, const QVector3D &a,
                uint bndx, const QVector3D &b,
@@ -184,6 +208,15 @@ private:
 
 void TriangleCollisionVisitor::visit(uint andx, const QVector3D &a, uint bndx, const QVector3D &b, uint cndx, const QVector3D &c)
 {
+    if (m_modelSpace) {
+        bool intersected = m_frontFaceRequested &&
+                intersectsSegmentTriangle(cndx, c, bndx, b, andx, a);    // front facing
+        if (!intersected && m_backFaceRequested)
+            intersectsSegmentTriangle(andx, a, bndx, b, cndx, c);    // back facing
+        m_triangleIndex++;
+        return;
+    }
+
     const QMatrix4x4 &mat = *m_root->worldTransform();
     const QVector3D tA = mat * a;
     const QVector3D tB = mat * b;
@@ -202,7 +235,7 @@ bool TriangleCollisionVisitor::intersectsSegmentTriangle(uint andx, const QVecto
 {
     float t = 0.0f;
     QVector3D uvw;
-    bool intersected = Render::intersectsSegmentTriangle(m_ray, a, b, c, uvw, t);
+    bool intersected = Render::intersectsSegmentTriangle(m_testRay, a, b, c, uvw, t);
     if (intersected) {
         QCollisionQueryResult::Hit queryResult;
         queryResult.m_type = QCollisionQueryResult::Hit::Triangle;
@@ -41,6 +41,7 @@
 #include <Qt3DRender/private/job_common_p.h>
 #include <Qt3DRender/private/renderer_p.h>
 #include <Qt3DRender/private/renderview_p.h>
+#include <Qt3DRender/private/rendercommand_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -68,10 +69,13 @@ void RenderViewBuilderJob::run()
         gatherLightsTime = timer.nsecsElapsed();
         timer.restart();
 #endif
+    // Commands live as long as the RenderView of this frame, allocate them in
+    // pages rather than one by one from the heap
+    m_commandAllocator.reset(new Qt3DCore::QFrameAllocator(sizeof(RenderCommand), 16, 128));
     if (!m_renderView->isCompute())
-        m_commands = m_renderView->buildDrawRenderCommands(m_renderables);
+        m_commands = m_renderView->buildDrawRenderCommands(m_renderables, m_commandAllocator.data());
     else
-        m_commands = m_renderView->buildComputeRenderCommands(m_renderables);
+        m_commands = m_renderView->buildComputeRenderCommands(m_renderables, m_commandAllocator.data());
 #if defined(QT3D_RENDER_VIEW_JOB_TIMINGS)
         buildCommandsTime = timer.nsecsElapsed();
         timer.restart();
@@ -52,6 +52,7 @@
 //
 
 #include <Qt3DCore/qaspectjob.h>
+#include <Qt3DCore/private/qframeallocator_p.h>
 #include <Qt3DRender/private/handle_types_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -74,6 +75,7 @@ public:
     inline void setIndex(int index) Q_DECL_NOTHROW { m_index = index; }
     inline void setRenderables(const QVector<Entity *> &renderables) Q_DECL_NOTHROW { m_renderables = renderables; }
     QVector<RenderCommand *> &commands() Q_DECL_NOTHROW { return m_commands; }
+    QSharedPointer<Qt3DCore::QFrameAllocator> commandAllocator() const Q_DECL_NOTHROW { return m_commandAllocator; }
 
     void run() Q_DECL_FINAL;
 
@@ -83,6 +85,7 @@ private:
     int m_index;
     QVector<Entity *> m_renderables;
     QVector<RenderCommand *> m_commands;
+    QSharedPointer<Qt3DCore::QFrameAllocator> m_commandAllocator;
 };
 
 typedef QSharedPointer<RenderViewBuilderJob> RenderViewBuilderJobPtr;
@@ -54,19 +54,33 @@ namespace Render {
 
 namespace {
 
-void updateWorldTransformAndBounds(Qt3DRender::Render::Entity *node, const QMatrix4x4 &parentTransform)
+void updateWorldTransformAndBounds(Qt3DRender::Render::Entity *node, const QMatrix4x4 &parentTransform,
+                                   bool parentChanged, QVector<Transform *> &updatedTransforms)
 {
-    QMatrix4x4 worldTransform(parentTransform);
     Transform *nodeTransform = node->renderComponent<Transform>();
 
-    if (nodeTransform != nullptr && nodeTransform->isEnabled())
-        worldTransform = worldTransform * nodeTransform->transformMatrix();
-
-    *(node->worldTransform()) = worldTransform;
+    // Subtrees whose parent, own transform and hierarchy are all unchanged
+    // keep the world transforms computed in a previous frame
+    bool changed = parentChanged || node->isWorldTransformDirty();
+    if (nodeTransform != nullptr && nodeTransform->isMatrixDirty()) {
+        updatedTransforms.push_back(nodeTransform);
+        changed = true;
+    }
+
+    QMatrix4x4 *worldTransform = node->worldTransform();
+    if (changed) {
+        *worldTransform = parentTransform;
+        if (nodeTransform != nullptr && nodeTransform->isEnabled())
+            *worldTransform = *worldTransform * nodeTransform->transformMatrix();
+        node->unsetWorldTransformDirty();
+    }
 
     const auto children = node->children();
+    if (children.isEmpty())
+        return;
+    const QMatrix4x4 childParentTransform = *worldTransform;
     for (Qt3DRender::Render::Entity *child : children)
-        updateWorldTransformAndBounds(child, worldTransform);
+        updateWorldTransformAndBounds(child, childParentTransform, changed, updatedTransforms);
 }
 
 }
@@ -80,6 +94,8 @@ UpdateWorldTransformJob::UpdateWorldTransformJob()
 
 void UpdateWorldTransformJob::setRoot(Entity *root)
 {
+    if (root != m_node && root != nullptr)
+        root->setWorldTransformDirty();
     m_node = root;
 }
 
@@ -98,7 +114,14 @@ void UpdateWorldTransformJob::run()
     Entity *parent = m_node->parent();
     if (parent != nullptr)
         parentTransform = *(parent->worldTransform());
-    updateWorldTransformAndBounds(m_node, parentTransform);
+
+    QVector<Transform *> updatedTransforms;
+    updateWorldTransformAndBounds(m_node, parentTransform, false, updatedTransforms);
+
+    // Transforms can be shared between entities, only mark them as
+    // processed once every entity has picked up the new matrix
+    for (Transform *transform : qAsConst(updatedTransforms))
+        transform->unsetMatrixDirty();
 
     qCDebug(Jobs) << "Exiting" << Q_FUNC_INFO << QThread::currentThread();
 }
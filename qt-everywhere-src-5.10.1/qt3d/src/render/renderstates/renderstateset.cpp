@@ -156,6 +156,7 @@ void RenderStateSet::apply(GraphicsContext *gc)
 
     // Reset states that aren't active in the current state set
     resetMasked(stateToReset, gc);
+    int changeCount = int(std::bitset<64>(stateToReset).count());
 
     // Apply states that weren't in the previous state or that have
     // different values
@@ -163,7 +164,9 @@ void RenderStateSet::apply(GraphicsContext *gc)
         if (previousStates && previousStates->contains(ds))
             continue;
         ds.apply(gc);
+        ++changeCount;
     }
+    gc->addStateChanges(changeCount);
 }
 
 StateMaskSet RenderStateSet::stateMask() const
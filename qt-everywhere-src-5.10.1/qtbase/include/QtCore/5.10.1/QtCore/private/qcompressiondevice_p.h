@@ -0,0 +1 @@
+#include "../../../../../src/corelib/io/qcompressiondevice_p.h"
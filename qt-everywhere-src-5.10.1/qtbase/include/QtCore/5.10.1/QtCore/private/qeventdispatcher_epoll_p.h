@@ -0,0 +1 @@
+#include "../../../../../src/corelib/kernel/qeventdispatcher_epoll_p.h"
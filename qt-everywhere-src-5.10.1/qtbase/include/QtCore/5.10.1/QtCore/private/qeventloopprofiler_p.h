@@ -0,0 +1 @@
+#include "../../../../../src/corelib/kernel/qeventloopprofiler_p.h"
@@ -0,0 +1 @@
+#include "../../../../../src/corelib/thread/qlockprofiler_p.h"
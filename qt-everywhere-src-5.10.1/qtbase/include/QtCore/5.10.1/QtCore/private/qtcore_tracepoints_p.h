@@ -0,0 +1 @@
+#include "../../../../../src/corelib/global/qtcore_tracepoints_p.h"
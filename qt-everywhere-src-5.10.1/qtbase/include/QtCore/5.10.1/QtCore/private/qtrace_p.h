@@ -0,0 +1 @@
+#include "../../../../../src/corelib/global/qtrace_p.h"
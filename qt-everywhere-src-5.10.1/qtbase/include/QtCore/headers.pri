@@ -1,8 +1,8 @@
-SYNCQT.HEADER_FILES = animation/qabstractanimation.h animation/qanimationgroup.h animation/qparallelanimationgroup.h animation/qpauseanimation.h animation/qpropertyanimation.h animation/qsequentialanimationgroup.h animation/qvariantanimation.h arch/qatomic_bootstrap.h arch/qatomic_cxx11.h arch/qatomic_msvc.h codecs/qtextcodec.h global/qcompilerdetection.h global/qconfig-bootstrapped.h global/qendian.h global/qflags.h global/qfloat16.h global/qglobal.h global/qglobalstatic.h global/qisenum.h global/qlibraryinfo.h global/qlogging.h global/qnamespace.h global/qnumeric.h global/qoperatingsystemversion.h global/qprocessordetection.h global/qrandom.h global/qsysinfo.h global/qsystemdetection.h global/qt_windows.h global/qtypeinfo.h global/qtypetraits.h global/qversiontagging.h io/qbuffer.h io/qdatastream.h io/qdebug.h io/qdir.h io/qdiriterator.h io/qfile.h io/qfiledevice.h io/qfileinfo.h io/qfileselector.h io/qfilesystemwatcher.h io/qiodevice.h io/qlockfile.h io/qloggingcategory.h io/qprocess.h io/qresource.h io/qsavefile.h io/qsettings.h io/qstandardpaths.h io/qstorageinfo.h io/qtemporarydir.h io/qtemporaryfile.h io/qtextstream.h io/qurl.h io/qurlquery.h itemmodels/qabstractitemmodel.h itemmodels/qabstractproxymodel.h itemmodels/qidentityproxymodel.h itemmodels/qitemselectionmodel.h itemmodels/qsortfilterproxymodel.h itemmodels/qstringlistmodel.h json/qjsonarray.h json/qjsondocument.h json/qjsonobject.h json/qjsonvalue.h kernel/qabstracteventdispatcher.h kernel/qabstractnativeeventfilter.h kernel/qbasictimer.h kernel/qcoreapplication.h kernel/qcoreevent.h kernel/qdeadlinetimer.h kernel/qelapsedtimer.h kernel/qeventloop.h kernel/qfunctions_nacl.h kernel/qfunctions_vxworks.h kernel/qfunctions_winrt.h kernel/qmath.h kernel/qmetaobject.h kernel/qmetatype.h kernel/qmimedata.h kernel/qobject.h kernel/qobject_impl.h kernel/qobjectcleanuphandler.h kernel/qobjectdefs.h kernel/qobjectdefs_impl.h kernel/qpointer.h kernel/qsharedmemory.h kernel/qsignalmapper.h kernel/qsocketnotifier.h kernel/qsystemsemaphore.h kernel/qtimer.h kernel/qtranslator.h kernel/qvariant.h kernel/qwineventnotifier.h mimetypes/qmimedatabase.h mimetypes/qmimetype.h plugin/qfactoryinterface.h plugin/qlibrary.h plugin/qplugin.h plugin/qpluginloader.h plugin/quuid.h statemachine/qabstractstate.h statemachine/qabstracttransition.h statemachine/qeventtransition.h statemachine/qfinalstate.h statemachine/qhistorystate.h statemachine/qsignaltransition.h statemachine/qstate.h statemachine/qstatemachine.h thread/qatomic.h thread/qbasicatomic.h thread/qexception.h thread/qfuture.h thread/qfutureinterface.h thread/qfuturesynchronizer.h thread/qfuturewatcher.h thread/qgenericatomic.h thread/qmutex.h thread/qreadwritelock.h thread/qresultstore.h thread/qrunnable.h thread/qsemaphore.h thread/qthread.h thread/qthreadpool.h thread/qthreadstorage.h thread/qwaitcondition.h tools/qalgorithms.h tools/qarraydata.h tools/qarraydataops.h tools/qarraydatapointer.h tools/qbitarray.h tools/qbytearray.h tools/qbytearraylist.h tools/qbytearraymatcher.h tools/qcache.h tools/qchar.h tools/qcollator.h tools/qcommandlineoption.h tools/qcommandlineparser.h tools/qcontainerfwd.h tools/qcontiguouscache.h tools/qcryptographichash.h tools/qdatetime.h tools/qeasingcurve.h tools/qhash.h tools/qhashfunctions.h tools/qiterator.h tools/qline.h tools/qlinkedlist.h tools/qlist.h tools/qlocale.h tools/qmap.h tools/qmargins.h tools/qmessageauthenticationcode.h tools/qpair.h tools/qpoint.h tools/qqueue.h tools/qrect.h tools/qrefcount.h tools/qregexp.h tools/qregularexpression.h tools/qscopedpointer.h tools/qscopedvaluerollback.h tools/qset.h tools/qshareddata.h tools/qsharedpointer.h tools/qsharedpointer_impl.h tools/qsize.h tools/qstack.h tools/qstring.h tools/qstringalgorithms.h tools/qstringbuilder.h tools/qstringlist.h tools/qstringliteral.h tools/qstringmatcher.h tools/qstringview.h tools/qtextboundaryfinder.h tools/qtimeline.h tools/qtimezone.h tools/qvarlengtharray.h tools/qvector.h tools/qversionnumber.h xml/qxmlstream.h ../../include/QtCore/qtcoreversion.h ../../include/QtCore/QtCore 
+SYNCQT.HEADER_FILES = animation/qabstractanimation.h animation/qanimationgroup.h animation/qparallelanimationgroup.h animation/qpauseanimation.h animation/qpropertyanimation.h animation/qsequentialanimationgroup.h animation/qvariantanimation.h arch/qatomic_bootstrap.h arch/qatomic_cxx11.h arch/qatomic_msvc.h codecs/qtextcodec.h global/qcompilerdetection.h global/qconfig-bootstrapped.h global/qendian.h global/qflags.h global/qfloat16.h global/qglobal.h global/qglobalstatic.h global/qisenum.h global/qlibraryinfo.h global/qlogging.h global/qnamespace.h global/qnumeric.h global/qoperatingsystemversion.h global/qprocessordetection.h global/qrandom.h global/qsysinfo.h global/qsystemdetection.h global/qt_windows.h global/qtypeinfo.h global/qtypetraits.h global/qversiontagging.h io/qasyncfile.h io/qbuffer.h io/qcompressiondevice.h io/qdatastream.h io/qdebug.h io/qdir.h io/qdiriterator.h io/qfile.h io/qfiledevice.h io/qfileinfo.h io/qfileselector.h io/qfilesystemwatcher.h io/qiodevice.h io/qlockfile.h io/qloggingcategory.h io/qprocess.h io/qresource.h io/qsavefile.h io/qsettings.h io/qstandardpaths.h io/qstorageinfo.h io/qtemporarydir.h io/qtemporaryfile.h io/qtextstream.h io/qurl.h io/qurlquery.h itemmodels/qabstractitemmodel.h itemmodels/qabstractproxymodel.h itemmodels/qidentityproxymodel.h itemmodels/qitemselectionmodel.h itemmodels/qsortfilterproxymodel.h itemmodels/qstringlistmodel.h json/qjsonarray.h json/qjsondocument.h json/qjsonobject.h json/qjsonstreamreader.h json/qjsonstreamwriter.h json/qjsonvalue.h kernel/qabstracteventdispatcher.h kernel/qabstractnativeeventfilter.h kernel/qbasictimer.h kernel/qcoreapplication.h kernel/qcoreevent.h kernel/qcoroutine.h kernel/qdeadlinetimer.h kernel/qelapsedtimer.h kernel/qeventloop.h kernel/qfunctions_nacl.h kernel/qfunctions_vxworks.h kernel/qfunctions_winrt.h kernel/qmath.h kernel/qmetaobject.h kernel/qmetatype.h kernel/qmimedata.h kernel/qobject.h kernel/qobject_impl.h kernel/qobjectcleanuphandler.h kernel/qobjectdefs.h kernel/qobjectdefs_impl.h kernel/qpointer.h kernel/qsharedmemory.h kernel/qsignalmapper.h kernel/qsocketnotifier.h kernel/qsystemsemaphore.h kernel/qtimer.h kernel/qtranslator.h kernel/qvariant.h kernel/qwineventnotifier.h mimetypes/qmimedatabase.h mimetypes/qmimetype.h plugin/qfactoryinterface.h plugin/qlibrary.h plugin/qplugin.h plugin/qpluginloader.h plugin/quuid.h statemachine/qabstractstate.h statemachine/qabstracttransition.h statemachine/qeventtransition.h statemachine/qfinalstate.h statemachine/qhistorystate.h statemachine/qsignaltransition.h statemachine/qstate.h statemachine/qstatemachine.h thread/qatomic.h thread/qbasicatomic.h thread/qexception.h thread/qfuture.h thread/qfutureinterface.h thread/qfuturesynchronizer.h thread/qfuturewatcher.h thread/qgenericatomic.h thread/qmutex.h thread/qreadwritelock.h thread/qresultstore.h thread/qrunnable.h thread/qsemaphore.h thread/qthread.h thread/qthreadpool.h thread/qthreadstorage.h thread/qwaitcondition.h tools/qalgorithms.h tools/qarena.h tools/qarraydata.h tools/qarraydataops.h tools/qarraydatapointer.h tools/qbitarray.h tools/qbytearray.h tools/qbytearraylist.h tools/qbytearraymatcher.h tools/qcache.h tools/qchar.h tools/qcollator.h tools/qcommandlineoption.h tools/qcommandlineparser.h tools/qcompactstring.h tools/qcontainerfwd.h tools/qcontiguouscache.h tools/qcryptographichash.h tools/qdatetime.h tools/qeasingcurve.h tools/qflathash.h tools/qhash.h tools/qhashfunctions.h tools/qiterator.h tools/qline.h tools/qlinkedlist.h tools/qlist.h tools/qlocale.h tools/qmap.h tools/qmargins.h tools/qmessageauthenticationcode.h tools/qpair.h tools/qpoint.h tools/qqueue.h tools/qrect.h tools/qrefcount.h tools/qregexp.h tools/qregularexpression.h tools/qscopedpointer.h tools/qscopedvaluerollback.h tools/qset.h tools/qshareddata.h tools/qsharedpointer.h tools/qsharedpointer_impl.h tools/qsize.h tools/qstack.h tools/qstring.h tools/qstringalgorithms.h tools/qstringbuilder.h tools/qstringlist.h tools/qstringliteral.h tools/qstringmatcher.h tools/qstringview.h tools/qtextboundaryfinder.h tools/qtimeline.h tools/qtimezone.h tools/qvarlengtharray.h tools/qvector.h tools/qversionnumber.h xml/qxmlstream.h ../../include/QtCore/qtcoreversion.h ../../include/QtCore/QtCore 
 SYNCQT.INJECTED_HEADER_FILES = global/qconfig.h 
-SYNCQT.HEADER_CLASSES = ../../include/QtCore/QAbstractAnimation ../../include/QtCore/QAnimationDriver ../../include/QtCore/QAnimationGroup ../../include/QtCore/QParallelAnimationGroup ../../include/QtCore/QPauseAnimation ../../include/QtCore/QPropertyAnimation ../../include/QtCore/QSequentialAnimationGroup ../../include/QtCore/QVariantAnimation ../../include/QtCore/QTextCodec ../../include/QtCore/QTextEncoder ../../include/QtCore/QTextDecoder ../../include/QtCore/QSpecialInteger ../../include/QtCore/QLittleEndianStorageType ../../include/QtCore/QBigEndianStorageType ../../include/QtCore/QLEInteger ../../include/QtCore/QBEInteger ../../include/QtCore/QtEndian ../../include/QtCore/QFlag ../../include/QtCore/QIncompatibleFlag ../../include/QtCore/QFlags ../../include/QtCore/QFloat16 ../../include/QtCore/QIntegerForSize ../../include/QtCore/QStaticAssertFailure ../../include/QtCore/QFunctionPointer ../../include/QtCore/QNonConstOverload ../../include/QtCore/QConstOverload ../../include/QtCore/QtGlobal ../../include/QtCore/QGlobalStatic ../../include/QtCore/QLibraryInfo ../../include/QtCore/QMessageLogContext ../../include/QtCore/QMessageLogger ../../include/QtCore/QtMsgHandler ../../include/QtCore/QtMessageHandler ../../include/QtCore/QInternal ../../include/QtCore/Qt ../../include/QtCore/QtNumeric ../../include/QtCore/QOperatingSystemVersion ../../include/QtCore/QRandomGenerator ../../include/QtCore/QRandomGenerator64 ../../include/QtCore/QSysInfo ../../include/QtCore/QTypeInfo ../../include/QtCore/QTypeInfoQuery ../../include/QtCore/QTypeInfoMerger ../../include/QtCore/QtConfig ../../include/QtCore/QBuffer ../../include/QtCore/QDataStream ../../include/QtCore/QDebug ../../include/QtCore/QDebugStateSaver ../../include/QtCore/QNoDebug ../../include/QtCore/QtDebug ../../include/QtCore/QDir ../../include/QtCore/QDirIterator ../../include/QtCore/QFile ../../include/QtCore/QFileDevice ../../include/QtCore/QFileInfo ../../include/QtCore/QFileInfoList ../../include/QtCore/QFileSelector ../../include/QtCore/QFileSystemWatcher ../../include/QtCore/QIODevice ../../include/QtCore/QLockFile ../../include/QtCore/QLoggingCategory ../../include/QtCore/Q_PID ../../include/QtCore/Q_SECURITY_ATTRIBUTES ../../include/QtCore/Q_STARTUPINFO ../../include/QtCore/QProcessEnvironment ../../include/QtCore/QProcess ../../include/QtCore/QResource ../../include/QtCore/QSaveFile ../../include/QtCore/QSettings ../../include/QtCore/QStandardPaths ../../include/QtCore/QStorageInfo ../../include/QtCore/QTemporaryDir ../../include/QtCore/QTemporaryFile ../../include/QtCore/QTextStream ../../include/QtCore/QTextStreamFunction ../../include/QtCore/QTextStreamManipulator ../../include/QtCore/QUrlTwoFlags ../../include/QtCore/QUrl ../../include/QtCore/QUrlQuery ../../include/QtCore/QModelIndex ../../include/QtCore/QPersistentModelIndex ../../include/QtCore/QModelIndexList ../../include/QtCore/QAbstractItemModel ../../include/QtCore/QAbstractTableModel ../../include/QtCore/QAbstractListModel ../../include/QtCore/QAbstractProxyModel ../../include/QtCore/QIdentityProxyModel ../../include/QtCore/QItemSelectionRange ../../include/QtCore/QItemSelectionModel ../../include/QtCore/QItemSelection ../../include/QtCore/QSortFilterProxyModel ../../include/QtCore/QStringListModel ../../include/QtCore/QJsonArray ../../include/QtCore/QJsonParseError ../../include/QtCore/QJsonDocument ../../include/QtCore/QJsonObject ../../include/QtCore/QJsonValue ../../include/QtCore/QJsonValueRef ../../include/QtCore/QJsonValuePtr ../../include/QtCore/QJsonValueRefPtr ../../include/QtCore/QAbstractEventDispatcher ../../include/QtCore/QAbstractNativeEventFilter ../../include/QtCore/QBasicTimer ../../include/QtCore/QCoreApplication ../../include/QtCore/QtCleanUpFunction ../../include/QtCore/QEvent ../../include/QtCore/QTimerEvent ../../include/QtCore/QChildEvent ../../include/QtCore/QDynamicPropertyChangeEvent ../../include/QtCore/QDeferredDeleteEvent ../../include/QtCore/QDeadlineTimer ../../include/QtCore/QElapsedTimer ../../include/QtCore/QEventLoop ../../include/QtCore/QEventLoopLocker ../../include/QtCore/QtMath ../../include/QtCore/QMetaMethod ../../include/QtCore/QMetaEnum ../../include/QtCore/QMetaProperty ../../include/QtCore/QMetaClassInfo ../../include/QtCore/QMetaType ../../include/QtCore/QMimeData ../../include/QtCore/QObjectList ../../include/QtCore/QObjectData ../../include/QtCore/QObject ../../include/QtCore/QObjectUserData ../../include/QtCore/QSignalBlocker ../../include/QtCore/QObjectCleanupHandler ../../include/QtCore/QByteArrayData ../../include/QtCore/QGenericArgument ../../include/QtCore/QGenericReturnArgument ../../include/QtCore/QArgument ../../include/QtCore/QReturnArgument ../../include/QtCore/QMetaObject ../../include/QtCore/QPointer ../../include/QtCore/QSharedMemory ../../include/QtCore/QSignalMapper ../../include/QtCore/QSocketNotifier ../../include/QtCore/QSystemSemaphore ../../include/QtCore/QTimer ../../include/QtCore/QTranslator ../../include/QtCore/QVariant ../../include/QtCore/QVariantComparisonHelper ../../include/QtCore/QSequentialIterable ../../include/QtCore/QAssociativeIterable ../../include/QtCore/QVariantHash ../../include/QtCore/QVariantList ../../include/QtCore/QVariantMap ../../include/QtCore/QWinEventNotifier ../../include/QtCore/QMimeDatabase ../../include/QtCore/QMimeType ../../include/QtCore/QFactoryInterface ../../include/QtCore/QLibrary ../../include/QtCore/QtPluginInstanceFunction ../../include/QtCore/QtPluginMetaDataFunction ../../include/QtCore/QStaticPlugin ../../include/QtCore/QtPlugin ../../include/QtCore/QPluginLoader ../../include/QtCore/QUuid ../../include/QtCore/QAbstractState ../../include/QtCore/QAbstractTransition ../../include/QtCore/QEventTransition ../../include/QtCore/QFinalState ../../include/QtCore/QHistoryState ../../include/QtCore/QSignalTransition ../../include/QtCore/QState ../../include/QtCore/QStateMachine ../../include/QtCore/QAtomicInteger ../../include/QtCore/QAtomicInt ../../include/QtCore/QAtomicPointer ../../include/QtCore/QException ../../include/QtCore/QUnhandledException ../../include/QtCore/QFuture ../../include/QtCore/QFutureIterator ../../include/QtCore/QMutableFutureIterator ../../include/QtCore/QFutureInterfaceBase ../../include/QtCore/QFutureInterface ../../include/QtCore/QFutureSynchronizer ../../include/QtCore/QFutureWatcherBase ../../include/QtCore/QFutureWatcher ../../include/QtCore/QBasicMutex ../../include/QtCore/QMutex ../../include/QtCore/QMutexLocker ../../include/QtCore/QReadWriteLock ../../include/QtCore/QReadLocker ../../include/QtCore/QWriteLocker ../../include/QtCore/QRunnable ../../include/QtCore/QSemaphore ../../include/QtCore/QSemaphoreReleaser ../../include/QtCore/QThread ../../include/QtCore/QThreadPool ../../include/QtCore/QThreadStorageData ../../include/QtCore/QThreadStorage ../../include/QtCore/QWaitCondition ../../include/QtCore/QtAlgorithms ../../include/QtCore/QArrayData ../../include/QtCore/QStaticArrayData ../../include/QtCore/QArrayDataPointerRef ../../include/QtCore/QArrayDataPointer ../../include/QtCore/QBitArray ../../include/QtCore/QBitRef ../../include/QtCore/QStaticByteArrayData ../../include/QtCore/QByteArrayDataPtr ../../include/QtCore/QByteArray ../../include/QtCore/QByteRef ../../include/QtCore/QByteArrayListIterator ../../include/QtCore/QMutableByteArrayListIterator ../../include/QtCore/QByteArrayList ../../include/QtCore/QByteArrayMatcher ../../include/QtCore/QStaticByteArrayMatcherBase ../../include/QtCore/QCache ../../include/QtCore/QLatin1Char ../../include/QtCore/QChar ../../include/QtCore/QCollatorSortKey ../../include/QtCore/QCollator ../../include/QtCore/QCommandLineOption ../../include/QtCore/QCommandLineParser ../../include/QtCore/QtContainerFwd ../../include/QtCore/QContiguousCacheData ../../include/QtCore/QContiguousCacheTypedData ../../include/QtCore/QContiguousCache ../../include/QtCore/QCryptographicHash ../../include/QtCore/QDate ../../include/QtCore/QTime ../../include/QtCore/QDateTime ../../include/QtCore/QEasingCurve ../../include/QtCore/QHashData ../../include/QtCore/QHashDummyValue ../../include/QtCore/QHashNode ../../include/QtCore/QHash ../../include/QtCore/QMultiHash ../../include/QtCore/QHashIterator ../../include/QtCore/QMutableHashIterator ../../include/QtCore/QHashFunctions ../../include/QtCore/QKeyValueIterator ../../include/QtCore/QLine ../../include/QtCore/QLineF ../../include/QtCore/QLinkedListData ../../include/QtCore/QLinkedListNode ../../include/QtCore/QLinkedList ../../include/QtCore/QLinkedListIterator ../../include/QtCore/QMutableLinkedListIterator ../../include/QtCore/QListSpecialMethods ../../include/QtCore/QListData ../../include/QtCore/QList ../../include/QtCore/QListIterator ../../include/QtCore/QMutableListIterator ../../include/QtCore/QLocale ../../include/QtCore/QMapNodeBase ../../include/QtCore/QMapNode ../../include/QtCore/QMapDataBase ../../include/QtCore/QMapData ../../include/QtCore/QMap ../../include/QtCore/QMultiMap ../../include/QtCore/QMapIterator ../../include/QtCore/QMutableMapIterator ../../include/QtCore/QMargins ../../include/QtCore/QMarginsF ../../include/QtCore/QMessageAuthenticationCode ../../include/QtCore/QPair ../../include/QtCore/QPoint ../../include/QtCore/QPointF ../../include/QtCore/QQueue ../../include/QtCore/QRect ../../include/QtCore/QRectF ../../include/QtCore/QRegExp ../../include/QtCore/QRegularExpression ../../include/QtCore/QRegularExpressionMatch ../../include/QtCore/QRegularExpressionMatchIterator ../../include/QtCore/QScopedPointerDeleter ../../include/QtCore/QScopedPointerArrayDeleter ../../include/QtCore/QScopedPointerPodDeleter ../../include/QtCore/QScopedPointerObjectDeleteLater ../../include/QtCore/QScopedPointerDeleteLater ../../include/QtCore/QScopedPointer ../../include/QtCore/QScopedArrayPointer ../../include/QtCore/QScopedValueRollback ../../include/QtCore/QSet ../../include/QtCore/QSetIterator ../../include/QtCore/QMutableSetIterator ../../include/QtCore/QSharedData ../../include/QtCore/QSharedDataPointer ../../include/QtCore/QExplicitlySharedDataPointer ../../include/QtCore/QSharedPointer ../../include/QtCore/QWeakPointer ../../include/QtCore/QEnableSharedFromThis ../../include/QtCore/QSize ../../include/QtCore/QSizeF ../../include/QtCore/QStack ../../include/QtCore/QLatin1String ../../include/QtCore/QLatin1Literal ../../include/QtCore/QString ../../include/QtCore/QCharRef ../../include/QtCore/QStringRef ../../include/QtCore/QStringAlgorithms ../../include/QtCore/QStringBuilder ../../include/QtCore/QStringListIterator ../../include/QtCore/QMutableStringListIterator ../../include/QtCore/QStringList ../../include/QtCore/QStringLiteral ../../include/QtCore/QStringData ../../include/QtCore/QStaticStringData ../../include/QtCore/QStringDataPtr ../../include/QtCore/QStringMatcher ../../include/QtCore/QStringView ../../include/QtCore/QTextBoundaryFinder ../../include/QtCore/QTimeLine ../../include/QtCore/QTimeZone ../../include/QtCore/QVarLengthArray ../../include/QtCore/QVector ../../include/QtCore/QVectorIterator ../../include/QtCore/QMutableVectorIterator ../../include/QtCore/QVersionNumber ../../include/QtCore/QXmlStreamStringRef ../../include/QtCore/QXmlStreamAttribute ../../include/QtCore/QXmlStreamAttributes ../../include/QtCore/QXmlStreamNamespaceDeclaration ../../include/QtCore/QXmlStreamNamespaceDeclarations ../../include/QtCore/QXmlStreamNotationDeclaration ../../include/QtCore/QXmlStreamNotationDeclarations ../../include/QtCore/QXmlStreamEntityDeclaration ../../include/QtCore/QXmlStreamEntityDeclarations ../../include/QtCore/QXmlStreamEntityResolver ../../include/QtCore/QXmlStreamReader ../../include/QtCore/QXmlStreamWriter ../../include/QtCore/QtCoreVersion 
-SYNCQT.PRIVATE_HEADER_FILES = animation/qabstractanimation_p.h animation/qanimationgroup_p.h animation/qparallelanimationgroup_p.h animation/qpropertyanimation_p.h animation/qsequentialanimationgroup_p.h animation/qvariantanimation_p.h codecs/cp949codetbl_p.h codecs/qbig5codec_p.h codecs/qeucjpcodec_p.h codecs/qeuckrcodec_p.h codecs/qgb18030codec_p.h codecs/qiconvcodec_p.h codecs/qicucodec_p.h codecs/qisciicodec_p.h codecs/qjiscodec_p.h codecs/qjpunicode_p.h codecs/qlatincodec_p.h codecs/qsimplecodec_p.h codecs/qsjiscodec_p.h codecs/qtextcodec_p.h codecs/qtsciicodec_p.h codecs/qutfcodec_p.h codecs/qwindowscodec_p.h global/minimum-linux_p.h global/qendian_p.h global/qfloat16_p.h global/qglobal_p.h global/qhooks_p.h global/qnumeric_p.h global/qoperatingsystemversion_p.h global/qoperatingsystemversion_win_p.h global/qrandom_p.h global/qt_pch.h io/qabstractfileengine_p.h io/qdatastream_p.h io/qdataurl_p.h io/qdebug_p.h io/qdir_p.h io/qfile_p.h io/qfiledevice_p.h io/qfileinfo_p.h io/qfileselector_p.h io/qfilesystemengine_p.h io/qfilesystementry_p.h io/qfilesystemiterator_p.h io/qfilesystemmetadata_p.h io/qfilesystemwatcher_fsevents_p.h io/qfilesystemwatcher_inotify_p.h io/qfilesystemwatcher_kqueue_p.h io/qfilesystemwatcher_p.h io/qfilesystemwatcher_polling_p.h io/qfilesystemwatcher_win_p.h io/qfsfileengine_iterator_p.h io/qfsfileengine_p.h io/qiodevice_p.h io/qipaddress_p.h io/qlockfile_p.h io/qloggingregistry_p.h io/qnoncontiguousbytedevice_p.h io/qprocess_p.h io/qresource_iterator_p.h io/qresource_p.h io/qsavefile_p.h io/qsettings_p.h io/qstorageinfo_p.h io/qtemporaryfile_p.h io/qtextstream_p.h io/qtldurl_p.h io/qurl_p.h io/qurltlds_p.h io/qwindowspipereader_p.h io/qwindowspipewriter_p.h itemmodels/qabstractitemmodel_p.h itemmodels/qabstractproxymodel_p.h itemmodels/qitemselectionmodel_p.h json/qjson_p.h json/qjsonparser_p.h json/qjsonwriter_p.h kernel/qabstracteventdispatcher_p.h kernel/qcfsocketnotifier_p.h kernel/qcore_mac_p.h kernel/qcore_unix_p.h kernel/qcoreapplication_p.h kernel/qcorecmdlineargs_p.h kernel/qcoreglobaldata_p.h kernel/qdeadlinetimer_p.h kernel/qeventdispatcher_cf_p.h kernel/qeventdispatcher_glib_p.h kernel/qeventdispatcher_unix_p.h kernel/qeventdispatcher_win_p.h kernel/qeventdispatcher_winrt_p.h kernel/qeventloop_p.h kernel/qfunctions_fake_env_p.h kernel/qfunctions_p.h kernel/qjni_p.h kernel/qjnihelpers_p.h kernel/qmetaobject_moc_p.h kernel/qmetaobject_p.h kernel/qmetaobjectbuilder_p.h kernel/qmetatype_p.h kernel/qmetatypeswitcher_p.h kernel/qobject_p.h kernel/qpoll_p.h kernel/qppsattribute_p.h kernel/qppsattributeprivate_p.h kernel/qppsobject_p.h kernel/qppsobjectprivate_p.h kernel/qsharedmemory_p.h kernel/qsystemerror_p.h kernel/qsystemsemaphore_p.h kernel/qtimerinfo_unix_p.h kernel/qtranslator_p.h kernel/qvariant_p.h kernel/qwineventnotifier_p.h mimetypes/qmimedatabase_p.h mimetypes/qmimeglobpattern_p.h mimetypes/qmimemagicrule_p.h mimetypes/qmimemagicrulematcher_p.h mimetypes/qmimeprovider_p.h mimetypes/qmimetype_p.h mimetypes/qmimetypeparser_p.h plugin/qelfparser_p.h plugin/qfactoryloader_p.h plugin/qlibrary_p.h plugin/qmachparser_p.h plugin/qsystemlibrary_p.h statemachine/qabstractstate_p.h statemachine/qabstracttransition_p.h statemachine/qeventtransition_p.h statemachine/qfinalstate_p.h statemachine/qhistorystate_p.h statemachine/qsignaleventgenerator_p.h statemachine/qsignaltransition_p.h statemachine/qstate_p.h statemachine/qstatemachine_p.h thread/qfutureinterface_p.h thread/qfuturewatcher_p.h thread/qmutex_p.h thread/qmutexpool_p.h thread/qorderedmutexlocker_p.h thread/qreadwritelock_p.h thread/qthread_p.h thread/qthreadpool_p.h tools/qbytearray_p.h tools/qbytedata_p.h tools/qcollator_p.h tools/qdatetime_p.h tools/qdatetimeparser_p.h tools/qdoublescanprint_p.h tools/qfreelist_p.h tools/qharfbuzz_p.h tools/qlocale_data_p.h tools/qlocale_p.h tools/qlocale_tools_p.h tools/qringbuffer_p.h tools/qscopedpointer_p.h tools/qsimd_p.h tools/qstringalgorithms_p.h tools/qstringiterator_p.h tools/qtimezoneprivate_data_p.h tools/qtimezoneprivate_p.h tools/qtools_p.h tools/qunicodetables_p.h tools/qunicodetools_p.h xml/qxmlstream_p.h xml/qxmlutils_p.h 
+SYNCQT.HEADER_CLASSES = ../../include/QtCore/QAbstractAnimation ../../include/QtCore/QAnimationDriver ../../include/QtCore/QAnimationGroup ../../include/QtCore/QArena ../../include/QtCore/QArenaScope ../../include/QtCore/QAsyncFile ../../include/QtCore/QCompactString ../../include/QtCore/QFlatHash ../../include/QtCore/QFlatSet ../../include/QtCore/QJsonStreamReader ../../include/QtCore/QJsonStreamWriter ../../include/QtCore/QModelRoleData ../../include/QtCore/QModelRoleDataSpan ../../include/QtCore/QParallelAnimationGroup ../../include/QtCore/QPauseAnimation ../../include/QtCore/QPropertyAnimation ../../include/QtCore/QSequentialAnimationGroup ../../include/QtCore/QVariantAnimation ../../include/QtCore/QTextCodec ../../include/QtCore/QTextEncoder ../../include/QtCore/QTextDecoder ../../include/QtCore/QSpecialInteger ../../include/QtCore/QLittleEndianStorageType ../../include/QtCore/QBigEndianStorageType ../../include/QtCore/QLEInteger ../../include/QtCore/QBEInteger ../../include/QtCore/QtEndian ../../include/QtCore/QFlag ../../include/QtCore/QIncompatibleFlag ../../include/QtCore/QFlags ../../include/QtCore/QFloat16 ../../include/QtCore/QIntegerForSize ../../include/QtCore/QStaticAssertFailure ../../include/QtCore/QFunctionPointer ../../include/QtCore/QNonConstOverload ../../include/QtCore/QConstOverload ../../include/QtCore/QtGlobal ../../include/QtCore/QGlobalStatic ../../include/QtCore/QLibraryInfo ../../include/QtCore/QMessageLogContext ../../include/QtCore/QMessageLogger ../../include/QtCore/QtMsgHandler ../../include/QtCore/QtMessageHandler ../../include/QtCore/QInternal ../../include/QtCore/Qt ../../include/QtCore/QtNumeric ../../include/QtCore/QOperatingSystemVersion ../../include/QtCore/QRandomGenerator ../../include/QtCore/QRandomGenerator64 ../../include/QtCore/QSysInfo ../../include/QtCore/QTypeInfo ../../include/QtCore/QTypeInfoQuery ../../include/QtCore/QTypeInfoMerger ../../include/QtCore/QtConfig ../../include/QtCore/QBuffer ../../include/QtCore/QCompressionDevice ../../include/QtCore/QDataStream ../../include/QtCore/QDebug ../../include/QtCore/QDebugStateSaver ../../include/QtCore/QNoDebug ../../include/QtCore/QtDebug ../../include/QtCore/QDir ../../include/QtCore/QDirIterator ../../include/QtCore/QFile ../../include/QtCore/QFileDevice ../../include/QtCore/QFileInfo ../../include/QtCore/QFileInfoList ../../include/QtCore/QFileSelector ../../include/QtCore/QFileSystemWatcher ../../include/QtCore/QIODevice ../../include/QtCore/QLockFile ../../include/QtCore/QLoggingCategory ../../include/QtCore/Q_PID ../../include/QtCore/Q_SECURITY_ATTRIBUTES ../../include/QtCore/Q_STARTUPINFO ../../include/QtCore/QProcessEnvironment ../../include/QtCore/QProcess ../../include/QtCore/QResource ../../include/QtCore/QSaveFile ../../include/QtCore/QSettings ../../include/QtCore/QStandardPaths ../../include/QtCore/QStorageInfo ../../include/QtCore/QTemporaryDir ../../include/QtCore/QTemporaryFile ../../include/QtCore/QTextStream ../../include/QtCore/QTextStreamFunction ../../include/QtCore/QTextStreamManipulator ../../include/QtCore/QUrlTwoFlags ../../include/QtCore/QUrl ../../include/QtCore/QUrlQuery ../../include/QtCore/QModelIndex ../../include/QtCore/QPersistentModelIndex ../../include/QtCore/QModelIndexList ../../include/QtCore/QAbstractItemModel ../../include/QtCore/QAbstractTableModel ../../include/QtCore/QAbstractListModel ../../include/QtCore/QAbstractProxyModel ../../include/QtCore/QIdentityProxyModel ../../include/QtCore/QItemSelectionRange ../../include/QtCore/QItemSelectionModel ../../include/QtCore/QItemSelection ../../include/QtCore/QSortFilterProxyModel ../../include/QtCore/QStringListModel ../../include/QtCore/QJsonArray ../../include/QtCore/QJsonParseError ../../include/QtCore/QJsonDocument ../../include/QtCore/QJsonObject ../../include/QtCore/QJsonValue ../../include/QtCore/QJsonValueRef ../../include/QtCore/QJsonValuePtr ../../include/QtCore/QJsonValueRefPtr ../../include/QtCore/QAbstractEventDispatcher ../../include/QtCore/QAbstractNativeEventFilter ../../include/QtCore/QBasicTimer ../../include/QtCore/QCoreApplication ../../include/QtCore/QtCleanUpFunction ../../include/QtCore/QEvent ../../include/QtCore/QTimerEvent ../../include/QtCore/QChildEvent ../../include/QtCore/QDynamicPropertyChangeEvent ../../include/QtCore/QDeferredDeleteEvent ../../include/QtCore/QDeadlineTimer ../../include/QtCore/QElapsedTimer ../../include/QtCore/QEventLoop ../../include/QtCore/QEventLoopLocker ../../include/QtCore/QtMath ../../include/QtCore/QMetaMethod ../../include/QtCore/QMetaEnum ../../include/QtCore/QMetaProperty ../../include/QtCore/QMetaClassInfo ../../include/QtCore/QMetaType ../../include/QtCore/QMimeData ../../include/QtCore/QObjectList ../../include/QtCore/QObjectData ../../include/QtCore/QObject ../../include/QtCore/QObjectUserData ../../include/QtCore/QSignalBlocker ../../include/QtCore/QObjectCleanupHandler ../../include/QtCore/QByteArrayData ../../include/QtCore/QGenericArgument ../../include/QtCore/QGenericReturnArgument ../../include/QtCore/QArgument ../../include/QtCore/QReturnArgument ../../include/QtCore/QMetaObject ../../include/QtCore/QPointer ../../include/QtCore/QSharedMemory ../../include/QtCore/QSignalMapper ../../include/QtCore/QSocketNotifier ../../include/QtCore/QSystemSemaphore ../../include/QtCore/QTimer ../../include/QtCore/QTranslator ../../include/QtCore/QVariant ../../include/QtCore/QVariantComparisonHelper ../../include/QtCore/QSequentialIterable ../../include/QtCore/QAssociativeIterable ../../include/QtCore/QVariantHash ../../include/QtCore/QVariantList ../../include/QtCore/QVariantMap ../../include/QtCore/QWinEventNotifier ../../include/QtCore/QMimeDatabase ../../include/QtCore/QMimeType ../../include/QtCore/QFactoryInterface ../../include/QtCore/QLibrary ../../include/QtCore/QtPluginInstanceFunction ../../include/QtCore/QtPluginMetaDataFunction ../../include/QtCore/QStaticPlugin ../../include/QtCore/QtPlugin ../../include/QtCore/QPluginLoader ../../include/QtCore/QUuid ../../include/QtCore/QAbstractState ../../include/QtCore/QAbstractTransition ../../include/QtCore/QEventTransition ../../include/QtCore/QFinalState ../../include/QtCore/QHistoryState ../../include/QtCore/QSignalTransition ../../include/QtCore/QState ../../include/QtCore/QStateMachine ../../include/QtCore/QAtomicInteger ../../include/QtCore/QAtomicInt ../../include/QtCore/QAtomicPointer ../../include/QtCore/QException ../../include/QtCore/QUnhandledException ../../include/QtCore/QFuture ../../include/QtCore/QFutureIterator ../../include/QtCore/QMutableFutureIterator ../../include/QtCore/QFutureInterfaceBase ../../include/QtCore/QFutureInterface ../../include/QtCore/QFutureSynchronizer ../../include/QtCore/QFutureWatcherBase ../../include/QtCore/QFutureWatcher ../../include/QtCore/QBasicMutex ../../include/QtCore/QMutex ../../include/QtCore/QMutexLocker ../../include/QtCore/QReadWriteLock ../../include/QtCore/QReadLocker ../../include/QtCore/QWriteLocker ../../include/QtCore/QRunnable ../../include/QtCore/QSemaphore ../../include/QtCore/QSemaphoreReleaser ../../include/QtCore/QThread ../../include/QtCore/QThreadPool ../../include/QtCore/QThreadStorageData ../../include/QtCore/QThreadStorage ../../include/QtCore/QWaitCondition ../../include/QtCore/QtAlgorithms ../../include/QtCore/QArrayData ../../include/QtCore/QStaticArrayData ../../include/QtCore/QArrayDataPointerRef ../../include/QtCore/QArrayDataPointer ../../include/QtCore/QBitArray ../../include/QtCore/QBitRef ../../include/QtCore/QStaticByteArrayData ../../include/QtCore/QByteArrayDataPtr ../../include/QtCore/QByteArray ../../include/QtCore/QByteRef ../../include/QtCore/QByteArrayListIterator ../../include/QtCore/QMutableByteArrayListIterator ../../include/QtCore/QByteArrayList ../../include/QtCore/QByteArrayMatcher ../../include/QtCore/QStaticByteArrayMatcherBase ../../include/QtCore/QCache ../../include/QtCore/QLatin1Char ../../include/QtCore/QChar ../../include/QtCore/QCollatorSortKey ../../include/QtCore/QCollator ../../include/QtCore/QCommandLineOption ../../include/QtCore/QCommandLineParser ../../include/QtCore/QtContainerFwd ../../include/QtCore/QContiguousCacheData ../../include/QtCore/QContiguousCacheTypedData ../../include/QtCore/QContiguousCache ../../include/QtCore/QCryptographicHash ../../include/QtCore/QDate ../../include/QtCore/QTime ../../include/QtCore/QDateTime ../../include/QtCore/QEasingCurve ../../include/QtCore/QHashData ../../include/QtCore/QHashDummyValue ../../include/QtCore/QHashNode ../../include/QtCore/QHash ../../include/QtCore/QMultiHash ../../include/QtCore/QHashIterator ../../include/QtCore/QMutableHashIterator ../../include/QtCore/QHashFunctions ../../include/QtCore/QKeyValueIterator ../../include/QtCore/QLine ../../include/QtCore/QLineF ../../include/QtCore/QLinkedListData ../../include/QtCore/QLinkedListNode ../../include/QtCore/QLinkedList ../../include/QtCore/QLinkedListIterator ../../include/QtCore/QMutableLinkedListIterator ../../include/QtCore/QListSpecialMethods ../../include/QtCore/QListData ../../include/QtCore/QList ../../include/QtCore/QListIterator ../../include/QtCore/QMutableListIterator ../../include/QtCore/QLocale ../../include/QtCore/QMapNodeBase ../../include/QtCore/QMapNode ../../include/QtCore/QMapDataBase ../../include/QtCore/QMapData ../../include/QtCore/QMap ../../include/QtCore/QMultiMap ../../include/QtCore/QMapIterator ../../include/QtCore/QMutableMapIterator ../../include/QtCore/QMargins ../../include/QtCore/QMarginsF ../../include/QtCore/QMessageAuthenticationCode ../../include/QtCore/QPair ../../include/QtCore/QPoint ../../include/QtCore/QPointF ../../include/QtCore/QQueue ../../include/QtCore/QRect ../../include/QtCore/QRectF ../../include/QtCore/QRegExp ../../include/QtCore/QRegularExpression ../../include/QtCore/QRegularExpressionMatch ../../include/QtCore/QRegularExpressionMatchIterator ../../include/QtCore/QScopedPointerDeleter ../../include/QtCore/QScopedPointerArrayDeleter ../../include/QtCore/QScopedPointerPodDeleter ../../include/QtCore/QScopedPointerObjectDeleteLater ../../include/QtCore/QScopedPointerDeleteLater ../../include/QtCore/QScopedPointer ../../include/QtCore/QScopedArrayPointer ../../include/QtCore/QScopedValueRollback ../../include/QtCore/QSet ../../include/QtCore/QSetIterator ../../include/QtCore/QMutableSetIterator ../../include/QtCore/QSharedData ../../include/QtCore/QSharedDataPointer ../../include/QtCore/QExplicitlySharedDataPointer ../../include/QtCore/QSharedPointer ../../include/QtCore/QWeakPointer ../../include/QtCore/QEnableSharedFromThis ../../include/QtCore/QSize ../../include/QtCore/QSizeF ../../include/QtCore/QStack ../../include/QtCore/QLatin1String ../../include/QtCore/QLatin1Literal ../../include/QtCore/QString ../../include/QtCore/QCharRef ../../include/QtCore/QStringRef ../../include/QtCore/QStringAlgorithms ../../include/QtCore/QStringBuilder ../../include/QtCore/QStringListIterator ../../include/QtCore/QMutableStringListIterator ../../include/QtCore/QStringList ../../include/QtCore/QStringLiteral ../../include/QtCore/QStringData ../../include/QtCore/QStaticStringData ../../include/QtCore/QStringDataPtr ../../include/QtCore/QStringMatcher ../../include/QtCore/QStringView ../../include/QtCore/QTextBoundaryFinder ../../include/QtCore/QTimeLine ../../include/QtCore/QTimeZone ../../include/QtCore/QVarLengthArray ../../include/QtCore/QVector ../../include/QtCore/QVectorIterator ../../include/QtCore/QMutableVectorIterator ../../include/QtCore/QVersionNumber ../../include/QtCore/QXmlStreamStringRef ../../include/QtCore/QXmlStreamAttribute ../../include/QtCore/QXmlStreamAttributes ../../include/QtCore/QXmlStreamNamespaceDeclaration ../../include/QtCore/QXmlStreamNamespaceDeclarations ../../include/QtCore/QXmlStreamNotationDeclaration ../../include/QtCore/QXmlStreamNotationDeclarations ../../include/QtCore/QXmlStreamEntityDeclaration ../../include/QtCore/QXmlStreamEntityDeclarations ../../include/QtCore/QXmlStreamEntityResolver ../../include/QtCore/QXmlStreamReader ../../include/QtCore/QXmlStreamWriter ../../include/QtCore/QtCoreVersion 
+SYNCQT.PRIVATE_HEADER_FILES = animation/qabstractanimation_p.h animation/qanimationgroup_p.h animation/qparallelanimationgroup_p.h animation/qpropertyanimation_p.h animation/qsequentialanimationgroup_p.h animation/qvariantanimation_p.h codecs/cp949codetbl_p.h codecs/qbig5codec_p.h codecs/qeucjpcodec_p.h codecs/qeuckrcodec_p.h codecs/qgb18030codec_p.h codecs/qiconvcodec_p.h codecs/qicucodec_p.h codecs/qisciicodec_p.h codecs/qjiscodec_p.h codecs/qjpunicode_p.h codecs/qlatincodec_p.h codecs/qsimplecodec_p.h codecs/qsjiscodec_p.h codecs/qtextcodec_p.h codecs/qtsciicodec_p.h codecs/qutfcodec_p.h codecs/qwindowscodec_p.h global/minimum-linux_p.h global/qendian_p.h global/qfloat16_p.h global/qglobal_p.h global/qhooks_p.h global/qnumeric_p.h global/qoperatingsystemversion_p.h global/qoperatingsystemversion_win_p.h global/qrandom_p.h global/qt_pch.h global/qtcore_tracepoints_p.h global/qtrace_p.h io/qabstractfileengine_p.h io/qcompressiondevice_p.h io/qdatastream_p.h io/qdataurl_p.h io/qdebug_p.h io/qdir_p.h io/qfile_p.h io/qfiledevice_p.h io/qfileinfo_p.h io/qfileselector_p.h io/qfilesystemengine_p.h io/qfilesystementry_p.h io/qfilesystemiterator_p.h io/qfilesystemmetadata_p.h io/qfilesystemwatcher_fsevents_p.h io/qfilesystemwatcher_inotify_p.h io/qfilesystemwatcher_kqueue_p.h io/qfilesystemwatcher_p.h io/qfilesystemwatcher_polling_p.h io/qfilesystemwatcher_win_p.h io/qfsfileengine_iterator_p.h io/qfsfileengine_p.h io/qiodevice_p.h io/qipaddress_p.h io/qlockfile_p.h io/qloggingregistry_p.h io/qnoncontiguousbytedevice_p.h io/qprocess_p.h io/qresource_iterator_p.h io/qresource_p.h io/qsavefile_p.h io/qsettings_p.h io/qstorageinfo_p.h io/qtemporaryfile_p.h io/qtextstream_p.h io/qtldurl_p.h io/qurl_p.h io/qurltlds_p.h io/qwindowspipereader_p.h io/qwindowspipewriter_p.h itemmodels/qabstractitemmodel_p.h itemmodels/qabstractproxymodel_p.h itemmodels/qitemselectionmodel_p.h json/qjson_p.h json/qjsonparser_p.h json/qjsonwriter_p.h kernel/qabstracteventdispatcher_p.h kernel/qcfsocketnotifier_p.h kernel/qcore_mac_p.h kernel/qcore_unix_p.h kernel/qcoreapplication_p.h kernel/qcorecmdlineargs_p.h kernel/qcoreglobaldata_p.h kernel/qdeadlinetimer_p.h kernel/qeventdispatcher_cf_p.h kernel/qeventdispatcher_epoll_p.h kernel/qeventdispatcher_glib_p.h kernel/qeventdispatcher_unix_p.h kernel/qeventdispatcher_win_p.h kernel/qeventdispatcher_winrt_p.h kernel/qeventloop_p.h kernel/qeventloopprofiler_p.h kernel/qfunctions_fake_env_p.h kernel/qfunctions_p.h kernel/qjni_p.h kernel/qjnihelpers_p.h kernel/qmetaobject_moc_p.h kernel/qmetaobject_p.h kernel/qmetaobjectbuilder_p.h kernel/qmetatype_p.h kernel/qmetatypeswitcher_p.h kernel/qobject_p.h kernel/qpoll_p.h kernel/qppsattribute_p.h kernel/qppsattributeprivate_p.h kernel/qppsobject_p.h kernel/qppsobjectprivate_p.h kernel/qsharedmemory_p.h kernel/qsystemerror_p.h kernel/qsystemsemaphore_p.h kernel/qtimerinfo_unix_p.h kernel/qtranslator_p.h kernel/qvariant_p.h kernel/qwineventnotifier_p.h mimetypes/qmimedatabase_p.h mimetypes/qmimeglobpattern_p.h mimetypes/qmimemagicrule_p.h mimetypes/qmimemagicrulematcher_p.h mimetypes/qmimeprovider_p.h mimetypes/qmimetype_p.h mimetypes/qmimetypeparser_p.h plugin/qelfparser_p.h plugin/qfactoryloader_p.h plugin/qlibrary_p.h plugin/qmachparser_p.h plugin/qsystemlibrary_p.h statemachine/qabstractstate_p.h statemachine/qabstracttransition_p.h statemachine/qeventtransition_p.h statemachine/qfinalstate_p.h statemachine/qhistorystate_p.h statemachine/qsignaleventgenerator_p.h statemachine/qsignaltransition_p.h statemachine/qstate_p.h statemachine/qstatemachine_p.h thread/qfutureinterface_p.h thread/qfuturewatcher_p.h thread/qlockprofiler_p.h thread/qmutex_p.h thread/qmutexpool_p.h thread/qorderedmutexlocker_p.h thread/qreadwritelock_p.h thread/qthread_p.h thread/qthreadpool_p.h tools/qarena_p.h tools/qbytearray_p.h tools/qbytedata_p.h tools/qcollator_p.h tools/qdatetime_p.h tools/qdatetimeparser_p.h tools/qdoublescanprint_p.h tools/qfreelist_p.h tools/qharfbuzz_p.h tools/qlocale_data_p.h tools/qlocale_p.h tools/qlocale_tools_p.h tools/qringbuffer_p.h tools/qscopedpointer_p.h tools/qsimd_p.h tools/qstringalgorithms_p.h tools/qstringiterator_p.h tools/qtimezoneprivate_data_p.h tools/qtimezoneprivate_p.h tools/qtools_p.h tools/qunicodetables_p.h tools/qunicodetools_p.h xml/qxmlstream_p.h xml/qxmlutils_p.h 
 SYNCQT.INJECTED_PRIVATE_HEADER_FILES = global/qconfig_p.h 
 SYNCQT.QPA_HEADER_FILES = 
-SYNCQT.CLEAN_HEADER_FILES = animation/qabstractanimation.h animation/qanimationgroup.h animation/qparallelanimationgroup.h animation/qpauseanimation.h animation/qpropertyanimation.h animation/qsequentialanimationgroup.h animation/qvariantanimation.h codecs/qtextcodec.h global/qcompilerdetection.h global/qendian.h global/qflags.h global/qfloat16.h global/qglobal.h global/qglobalstatic.h global/qisenum.h global/qlibraryinfo.h global/qlogging.h global/qnamespace.h global/qnumeric.h global/qoperatingsystemversion.h global/qprocessordetection.h global/qrandom.h global/qsysinfo.h global/qsystemdetection.h global/qtypeinfo.h global/qtypetraits.h global/qversiontagging.h io/qbuffer.h io/qdatastream.h io/qdebug.h io/qdir.h io/qdiriterator.h io/qfile.h io/qfiledevice.h io/qfileinfo.h io/qfileselector.h io/qfilesystemwatcher.h io/qiodevice.h io/qlockfile.h io/qloggingcategory.h io/qprocess.h:processenvironment io/qresource.h io/qsavefile.h io/qsettings.h io/qstandardpaths.h io/qstorageinfo.h io/qtemporarydir.h io/qtemporaryfile.h io/qtextstream.h io/qurl.h io/qurlquery.h itemmodels/qabstractitemmodel.h itemmodels/qabstractproxymodel.h itemmodels/qidentityproxymodel.h itemmodels/qitemselectionmodel.h itemmodels/qsortfilterproxymodel.h itemmodels/qstringlistmodel.h json/qjsonarray.h json/qjsondocument.h json/qjsonobject.h json/qjsonvalue.h kernel/qabstracteventdispatcher.h kernel/qabstractnativeeventfilter.h kernel/qbasictimer.h kernel/qcoreapplication.h kernel/qcoreevent.h kernel/qdeadlinetimer.h kernel/qelapsedtimer.h kernel/qeventloop.h kernel/qfunctions_nacl.h kernel/qfunctions_vxworks.h kernel/qfunctions_winrt.h kernel/qmath.h kernel/qmetaobject.h kernel/qmetatype.h kernel/qmimedata.h kernel/qobject.h kernel/qobjectcleanuphandler.h kernel/qobjectdefs.h kernel/qpointer.h kernel/qsharedmemory.h kernel/qsignalmapper.h kernel/qsocketnotifier.h kernel/qsystemsemaphore.h kernel/qtimer.h kernel/qtranslator.h kernel/qvariant.h kernel/qwineventnotifier.h mimetypes/qmimedatabase.h mimetypes/qmimetype.h plugin/qfactoryinterface.h plugin/qlibrary.h:library plugin/qplugin.h plugin/qpluginloader.h plugin/quuid.h statemachine/qabstractstate.h:statemachine statemachine/qabstracttransition.h:statemachine statemachine/qeventtransition.h:qeventtransition statemachine/qfinalstate.h:statemachine statemachine/qhistorystate.h:statemachine statemachine/qsignaltransition.h:statemachine statemachine/qstate.h:statemachine statemachine/qstatemachine.h:statemachine thread/qatomic.h thread/qbasicatomic.h thread/qexception.h thread/qfuture.h thread/qfutureinterface.h thread/qfuturesynchronizer.h thread/qfuturewatcher.h thread/qmutex.h thread/qreadwritelock.h thread/qresultstore.h thread/qrunnable.h thread/qsemaphore.h thread/qthread.h thread/qthreadpool.h thread/qthreadstorage.h thread/qwaitcondition.h tools/qalgorithms.h tools/qarraydata.h tools/qarraydataops.h tools/qarraydatapointer.h tools/qbitarray.h tools/qbytearray.h tools/qbytearraylist.h tools/qbytearraymatcher.h tools/qcache.h tools/qchar.h tools/qcollator.h tools/qcommandlineoption.h:commandlineparser tools/qcommandlineparser.h:commandlineparser tools/qcontainerfwd.h tools/qcontiguouscache.h tools/qcryptographichash.h tools/qdatetime.h tools/qeasingcurve.h tools/qhash.h tools/qhashfunctions.h tools/qiterator.h tools/qline.h tools/qlinkedlist.h tools/qlist.h tools/qlocale.h tools/qmap.h tools/qmargins.h tools/qmessageauthenticationcode.h tools/qpair.h tools/qpoint.h tools/qqueue.h tools/qrect.h tools/qrefcount.h tools/qregexp.h tools/qregularexpression.h tools/qscopedpointer.h tools/qscopedvaluerollback.h tools/qset.h tools/qshareddata.h tools/qsharedpointer.h tools/qsize.h tools/qstack.h tools/qstring.h tools/qstringalgorithms.h tools/qstringbuilder.h tools/qstringlist.h tools/qstringliteral.h tools/qstringmatcher.h tools/qstringview.h tools/qtextboundaryfinder.h tools/qtimeline.h tools/qtimezone.h:timezone tools/qvarlengtharray.h tools/qvector.h tools/qversionnumber.h xml/qxmlstream.h 
+SYNCQT.CLEAN_HEADER_FILES = animation/qabstractanimation.h animation/qanimationgroup.h animation/qparallelanimationgroup.h animation/qpauseanimation.h animation/qpropertyanimation.h animation/qsequentialanimationgroup.h animation/qvariantanimation.h codecs/qtextcodec.h global/qcompilerdetection.h global/qendian.h global/qflags.h global/qfloat16.h global/qglobal.h global/qglobalstatic.h global/qisenum.h global/qlibraryinfo.h global/qlogging.h global/qnamespace.h global/qnumeric.h global/qoperatingsystemversion.h global/qprocessordetection.h global/qrandom.h global/qsysinfo.h global/qsystemdetection.h global/qtypeinfo.h global/qtypetraits.h global/qversiontagging.h io/qasyncfile.h io/qbuffer.h io/qcompressiondevice.h io/qdatastream.h io/qdebug.h io/qdir.h io/qdiriterator.h io/qfile.h io/qfiledevice.h io/qfileinfo.h io/qfileselector.h io/qfilesystemwatcher.h io/qiodevice.h io/qlockfile.h io/qloggingcategory.h io/qprocess.h:processenvironment io/qresource.h io/qsavefile.h io/qsettings.h io/qstandardpaths.h io/qstorageinfo.h io/qtemporarydir.h io/qtemporaryfile.h io/qtextstream.h io/qurl.h io/qurlquery.h itemmodels/qabstractitemmodel.h itemmodels/qabstractproxymodel.h itemmodels/qidentityproxymodel.h itemmodels/qitemselectionmodel.h itemmodels/qsortfilterproxymodel.h itemmodels/qstringlistmodel.h json/qjsonarray.h json/qjsondocument.h json/qjsonobject.h json/qjsonstreamreader.h json/qjsonstreamwriter.h json/qjsonvalue.h kernel/qabstracteventdispatcher.h kernel/qabstractnativeeventfilter.h kernel/qbasictimer.h kernel/qcoreapplication.h kernel/qcoreevent.h kernel/qcoroutine.h kernel/qdeadlinetimer.h kernel/qelapsedtimer.h kernel/qeventloop.h kernel/qfunctions_nacl.h kernel/qfunctions_vxworks.h kernel/qfunctions_winrt.h kernel/qmath.h kernel/qmetaobject.h kernel/qmetatype.h kernel/qmimedata.h kernel/qobject.h kernel/qobjectcleanuphandler.h kernel/qobjectdefs.h kernel/qpointer.h kernel/qsharedmemory.h kernel/qsignalmapper.h kernel/qsocketnotifier.h kernel/qsystemsemaphore.h kernel/qtimer.h kernel/qtranslator.h kernel/qvariant.h kernel/qwineventnotifier.h mimetypes/qmimedatabase.h mimetypes/qmimetype.h plugin/qfactoryinterface.h plugin/qlibrary.h:library plugin/qplugin.h plugin/qpluginloader.h plugin/quuid.h statemachine/qabstractstate.h:statemachine statemachine/qabstracttransition.h:statemachine statemachine/qeventtransition.h:qeventtransition statemachine/qfinalstate.h:statemachine statemachine/qhistorystate.h:statemachine statemachine/qsignaltransition.h:statemachine statemachine/qstate.h:statemachine statemachine/qstatemachine.h:statemachine thread/qatomic.h thread/qbasicatomic.h thread/qexception.h thread/qfuture.h thread/qfutureinterface.h thread/qfuturesynchronizer.h thread/qfuturewatcher.h thread/qmutex.h thread/qreadwritelock.h thread/qresultstore.h thread/qrunnable.h thread/qsemaphore.h thread/qthread.h thread/qthreadpool.h thread/qthreadstorage.h thread/qwaitcondition.h tools/qalgorithms.h tools/qarena.h tools/qarraydata.h tools/qarraydataops.h tools/qarraydatapointer.h tools/qbitarray.h tools/qbytearray.h tools/qbytearraylist.h tools/qbytearraymatcher.h tools/qcache.h tools/qchar.h tools/qcollator.h tools/qcommandlineoption.h:commandlineparser tools/qcommandlineparser.h:commandlineparser tools/qcompactstring.h tools/qcontainerfwd.h tools/qcontiguouscache.h tools/qcryptographichash.h tools/qdatetime.h tools/qeasingcurve.h tools/qflathash.h tools/qhash.h tools/qhashfunctions.h tools/qiterator.h tools/qline.h tools/qlinkedlist.h tools/qlist.h tools/qlocale.h tools/qmap.h tools/qmargins.h tools/qmessageauthenticationcode.h tools/qpair.h tools/qpoint.h tools/qqueue.h tools/qrect.h tools/qrefcount.h tools/qregexp.h tools/qregularexpression.h tools/qscopedpointer.h tools/qscopedvaluerollback.h tools/qset.h tools/qshareddata.h tools/qsharedpointer.h tools/qsize.h tools/qstack.h tools/qstring.h tools/qstringalgorithms.h tools/qstringbuilder.h tools/qstringlist.h tools/qstringliteral.h tools/qstringmatcher.h tools/qstringview.h tools/qtextboundaryfinder.h tools/qtimeline.h tools/qtimezone.h:timezone tools/qvarlengtharray.h tools/qvector.h tools/qversionnumber.h xml/qxmlstream.h 
 SYNCQT.INJECTIONS = ../../src/corelib/global/qconfig.h:qconfig.h:QtConfig ../../src/corelib/global/qconfig_p.h:5.10.1/QtCore/private/qconfig_p.h 
@@ -0,0 +1 @@
+#include "../../src/corelib/tools/qarena.h"
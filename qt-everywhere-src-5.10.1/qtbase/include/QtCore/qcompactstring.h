@@ -0,0 +1 @@
+#include "../../src/corelib/tools/qcompactstring.h"
@@ -0,0 +1 @@
+#include "../../src/corelib/io/qcompressiondevice.h"
@@ -0,0 +1 @@
+#include "../../src/corelib/kernel/qcoroutine.h"
@@ -0,0 +1 @@
+#include "../../src/corelib/json/qjsonstreamreader.h"
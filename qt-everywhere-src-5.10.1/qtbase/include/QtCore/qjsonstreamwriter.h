@@ -0,0 +1 @@
+#include "../../src/corelib/json/qjsonstreamwriter.h"
@@ -0,0 +1 @@
+#include "../../../../../src/platformsupport/graphics/qsharedmemorygraphicscache_p.h"
@@ -0,0 +1 @@
+#include "../../../../../src/gui/opengl/qopengldamagehistory_p.h"
@@ -0,0 +1 @@
+#include "../../../../../src/gui/image/qsharedimagecache_p.h"
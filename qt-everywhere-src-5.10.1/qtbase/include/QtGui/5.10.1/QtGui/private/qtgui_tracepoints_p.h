@@ -0,0 +1 @@
+#include "../../../../../src/gui/kernel/qtgui_tracepoints_p.h"
@@ -0,0 +1 @@
+#include "../../../../../src/network/kernel/qtnetwork_tracepoints_p.h"
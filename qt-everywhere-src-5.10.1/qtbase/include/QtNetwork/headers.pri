@@ -1,8 +1,8 @@
-SYNCQT.HEADER_FILES = access/qabstractnetworkcache.h access/qhstspolicy.h access/qhttpmultipart.h access/qnetworkaccessmanager.h access/qnetworkcookie.h access/qnetworkcookiejar.h access/qnetworkdiskcache.h access/qnetworkreply.h access/qnetworkrequest.h bearer/qnetworkconfigmanager.h bearer/qnetworkconfiguration.h bearer/qnetworksession.h kernel/qauthenticator.h kernel/qdnslookup.h kernel/qhostaddress.h kernel/qhostinfo.h kernel/qnetworkdatagram.h kernel/qnetworkinterface.h kernel/qnetworkproxy.h kernel/qtnetworkglobal.h socket/qabstractsocket.h socket/qlocalserver.h socket/qlocalsocket.h socket/qsctpserver.h socket/qsctpsocket.h socket/qtcpserver.h socket/qtcpsocket.h socket/qudpsocket.h ssl/qssl.h ssl/qsslcertificate.h ssl/qsslcertificateextension.h ssl/qsslcipher.h ssl/qsslconfiguration.h ssl/qssldiffiehellmanparameters.h ssl/qsslellipticcurve.h ssl/qsslerror.h ssl/qsslkey.h ssl/qsslpresharedkeyauthenticator.h ssl/qsslsocket.h ../../include/QtNetwork/qtnetworkversion.h ../../include/QtNetwork/QtNetwork 
+SYNCQT.HEADER_FILES = access/qabstractnetworkcache.h access/qhstspolicy.h access/qhttp2configuration.h access/qhttpconnectionpoolconfiguration.h access/qhttpmultipart.h access/qnetworkaccessmanager.h access/qnetworkcookie.h access/qnetworkcookiejar.h access/qnetworkdiskcache.h access/qnetworkreply.h access/qnetworkrequest.h bearer/qnetworkconfigmanager.h bearer/qnetworkconfiguration.h bearer/qnetworksession.h kernel/qauthenticator.h kernel/qdnslookup.h kernel/qhostaddress.h kernel/qhostinfo.h kernel/qnetworkdatagram.h kernel/qnetworkinterface.h kernel/qnetworkproxy.h kernel/qtnetworkglobal.h socket/qabstractsocket.h socket/qlocalserver.h socket/qlocalsocket.h socket/qsctpserver.h socket/qsctpsocket.h socket/qtcpserver.h socket/qtcpsocket.h socket/qudpsocket.h ssl/qssl.h ssl/qsslcertificate.h ssl/qsslcertificateextension.h ssl/qsslcipher.h ssl/qsslconfiguration.h ssl/qssldiffiehellmanparameters.h ssl/qsslellipticcurve.h ssl/qsslerror.h ssl/qsslkey.h ssl/qsslpresharedkeyauthenticator.h ssl/qsslsocket.h ../../include/QtNetwork/qtnetworkversion.h ../../include/QtNetwork/QtNetwork 
 SYNCQT.INJECTED_HEADER_FILES = 
-SYNCQT.HEADER_CLASSES = ../../include/QtNetwork/QNetworkCacheMetaData ../../include/QtNetwork/QAbstractNetworkCache ../../include/QtNetwork/QHstsPolicy ../../include/QtNetwork/QHttpPart ../../include/QtNetwork/QHttpMultiPart ../../include/QtNetwork/QNetworkAccessManager ../../include/QtNetwork/QNetworkCookie ../../include/QtNetwork/QNetworkCookieJar ../../include/QtNetwork/QNetworkDiskCache ../../include/QtNetwork/QNetworkReply ../../include/QtNetwork/QNetworkRequest ../../include/QtNetwork/QNetworkConfigurationManager ../../include/QtNetwork/QNetworkConfiguration ../../include/QtNetwork/QNetworkSession ../../include/QtNetwork/QAuthenticator ../../include/QtNetwork/QDnsDomainNameRecord ../../include/QtNetwork/QDnsHostAddressRecord ../../include/QtNetwork/QDnsMailExchangeRecord ../../include/QtNetwork/QDnsServiceRecord ../../include/QtNetwork/QDnsTextRecord ../../include/QtNetwork/QDnsLookup ../../include/QtNetwork/QIPv6Address ../../include/QtNetwork/Q_IPV6ADDR ../../include/QtNetwork/QHostAddress ../../include/QtNetwork/QHostInfo ../../include/QtNetwork/QNetworkDatagram ../../include/QtNetwork/QNetworkAddressEntry ../../include/QtNetwork/QNetworkInterface ../../include/QtNetwork/QNetworkProxyQuery ../../include/QtNetwork/QNetworkProxy ../../include/QtNetwork/QNetworkProxyFactory ../../include/QtNetwork/QAbstractSocket ../../include/QtNetwork/QLocalServer ../../include/QtNetwork/QLocalSocket ../../include/QtNetwork/QSctpServer ../../include/QtNetwork/QSctpSocket ../../include/QtNetwork/QTcpServer ../../include/QtNetwork/QTcpSocket ../../include/QtNetwork/QUdpSocket ../../include/QtNetwork/QSsl ../../include/QtNetwork/QSslCertificate ../../include/QtNetwork/QSslCertificateExtension ../../include/QtNetwork/QSslCipher ../../include/QtNetwork/QSslConfiguration ../../include/QtNetwork/QSslDiffieHellmanParameters ../../include/QtNetwork/QSslEllipticCurve ../../include/QtNetwork/QSslError ../../include/QtNetwork/QSslKey ../../include/QtNetwork/QSslPreSharedKeyAuthenticator ../../include/QtNetwork/QSslSocket ../../include/QtNetwork/QtNetworkVersion 
-SYNCQT.PRIVATE_HEADER_FILES = access/qabstractnetworkcache_p.h access/qabstractprotocolhandler_p.h access/qftp_p.h access/qhsts_p.h access/qhstsstore_p.h access/qhttp2protocolhandler_p.h access/qhttpmultipart_p.h access/qhttpnetworkconnection_p.h access/qhttpnetworkconnectionchannel_p.h access/qhttpnetworkheader_p.h access/qhttpnetworkreply_p.h access/qhttpnetworkrequest_p.h access/qhttpprotocolhandler_p.h access/qhttpthreaddelegate_p.h access/qnetworkaccessauthenticationmanager_p.h access/qnetworkaccessbackend_p.h access/qnetworkaccesscache_p.h access/qnetworkaccesscachebackend_p.h access/qnetworkaccessdebugpipebackend_p.h access/qnetworkaccessfilebackend_p.h access/qnetworkaccessftpbackend_p.h access/qnetworkaccessmanager_p.h access/qnetworkcookie_p.h access/qnetworkcookiejar_p.h access/qnetworkdiskcache_p.h access/qnetworkfile_p.h access/qnetworkreply_p.h access/qnetworkreplydataimpl_p.h access/qnetworkreplyfileimpl_p.h access/qnetworkreplyhttpimpl_p.h access/qnetworkreplyimpl_p.h access/qnetworkrequest_p.h access/qspdyprotocolhandler_p.h bearer/qbearerengine_p.h bearer/qbearerplugin_p.h bearer/qnetworkconfigmanager_p.h bearer/qnetworkconfiguration_p.h bearer/qnetworksession_p.h bearer/qsharednetworksession_p.h kernel/qauthenticator_p.h kernel/qdnslookup_p.h kernel/qhostaddress_p.h kernel/qhostinfo_p.h kernel/qnetworkdatagram_p.h kernel/qnetworkinterface_p.h kernel/qtnetworkglobal_p.h kernel/qurlinfo_p.h socket/qabstractsocket_p.h socket/qabstractsocketengine_p.h socket/qhttpsocketengine_p.h socket/qlocalserver_p.h socket/qlocalsocket_p.h socket/qnativesocketengine_p.h socket/qnativesocketengine_winrt_p.h socket/qnet_unix_p.h socket/qsctpserver_p.h socket/qsctpsocket_p.h socket/qsocks5socketengine_p.h socket/qtcpserver_p.h socket/qtcpsocket_p.h ssl/qasn1element_p.h ssl/qssl_p.h ssl/qsslcertificate_p.h ssl/qsslcertificateextension_p.h ssl/qsslcipher_p.h ssl/qsslconfiguration_p.h ssl/qsslcontext_openssl_p.h ssl/qssldiffiehellmanparameters_p.h ssl/qsslkey_p.h ssl/qsslpresharedkeyauthenticator_p.h ssl/qsslsocket_mac_p.h ssl/qsslsocket_openssl11_symbols_p.h ssl/qsslsocket_openssl_p.h ssl/qsslsocket_openssl_symbols_p.h ssl/qsslsocket_opensslpre11_symbols_p.h ssl/qsslsocket_p.h ssl/qsslsocket_winrt_p.h access/http2/bitstreams_p.h access/http2/hpack_p.h access/http2/hpacktable_p.h access/http2/http2frames_p.h access/http2/http2protocol_p.h access/http2/http2streams_p.h access/http2/huffman_p.h 
+SYNCQT.HEADER_CLASSES = ../../include/QtNetwork/QNetworkCacheMetaData ../../include/QtNetwork/QAbstractNetworkCache ../../include/QtNetwork/QHstsPolicy ../../include/QtNetwork/QHttp2Configuration ../../include/QtNetwork/QHttpConnectionPoolConfiguration ../../include/QtNetwork/QHttpPart ../../include/QtNetwork/QHttpMultiPart ../../include/QtNetwork/QNetworkAccessManager ../../include/QtNetwork/QNetworkCookie ../../include/QtNetwork/QNetworkCookieJar ../../include/QtNetwork/QNetworkDiskCache ../../include/QtNetwork/QNetworkReply ../../include/QtNetwork/QNetworkRequest ../../include/QtNetwork/QNetworkConfigurationManager ../../include/QtNetwork/QNetworkConfiguration ../../include/QtNetwork/QNetworkSession ../../include/QtNetwork/QAuthenticator ../../include/QtNetwork/QDnsDomainNameRecord ../../include/QtNetwork/QDnsHostAddressRecord ../../include/QtNetwork/QDnsMailExchangeRecord ../../include/QtNetwork/QDnsServiceRecord ../../include/QtNetwork/QDnsTextRecord ../../include/QtNetwork/QDnsLookup ../../include/QtNetwork/QIPv6Address ../../include/QtNetwork/Q_IPV6ADDR ../../include/QtNetwork/QHostAddress ../../include/QtNetwork/QHostInfo ../../include/QtNetwork/QNetworkDatagram ../../include/QtNetwork/QNetworkAddressEntry ../../include/QtNetwork/QNetworkInterface ../../include/QtNetwork/QNetworkProxyQuery ../../include/QtNetwork/QNetworkProxy ../../include/QtNetwork/QNetworkProxyFactory ../../include/QtNetwork/QAbstractSocket ../../include/QtNetwork/QLocalServer ../../include/QtNetwork/QLocalSocket ../../include/QtNetwork/QSctpServer ../../include/QtNetwork/QSctpSocket ../../include/QtNetwork/QTcpServer ../../include/QtNetwork/QTcpSocket ../../include/QtNetwork/QUdpSocket ../../include/QtNetwork/QSsl ../../include/QtNetwork/QSslCertificate ../../include/QtNetwork/QSslCertificateExtension ../../include/QtNetwork/QSslCipher ../../include/QtNetwork/QSslConfiguration ../../include/QtNetwork/QSslDiffieHellmanParameters ../../include/QtNetwork/QSslEllipticCurve ../../include/QtNetwork/QSslError ../../include/QtNetwork/QSslKey ../../include/QtNetwork/QSslPreSharedKeyAuthenticator ../../include/QtNetwork/QSslSocket ../../include/QtNetwork/QtNetworkVersion 
+SYNCQT.PRIVATE_HEADER_FILES = access/qabstractnetworkcache_p.h access/qabstractprotocolhandler_p.h access/qftp_p.h access/qhsts_p.h access/qhstsstore_p.h access/qhttp2protocolhandler_p.h access/qhttpmultipart_p.h access/qhttpnetworkconnection_p.h access/qhttpnetworkconnectionchannel_p.h access/qhttpnetworkheader_p.h access/qhttpnetworkreply_p.h access/qhttpnetworkrequest_p.h access/qhttpprotocolhandler_p.h access/qhttpthreaddelegate_p.h access/qnetworkaccessauthenticationmanager_p.h access/qnetworkaccessbackend_p.h access/qnetworkaccesscache_p.h access/qnetworkaccesscachebackend_p.h access/qnetworkaccessdebugpipebackend_p.h access/qnetworkaccessfilebackend_p.h access/qnetworkaccessftpbackend_p.h access/qnetworkaccessmanager_p.h access/qnetworkcookie_p.h access/qnetworkcookiejar_p.h access/qnetworkdiskcache_p.h access/qnetworkfile_p.h access/qnetworkreply_p.h access/qnetworkreplydataimpl_p.h access/qnetworkreplyfileimpl_p.h access/qnetworkreplyhttpimpl_p.h access/qnetworkreplyimpl_p.h access/qnetworkrequest_p.h access/qspdyprotocolhandler_p.h bearer/qbearerengine_p.h bearer/qbearerplugin_p.h bearer/qnetworkconfigmanager_p.h bearer/qnetworkconfiguration_p.h bearer/qnetworksession_p.h bearer/qsharednetworksession_p.h kernel/qauthenticator_p.h kernel/qdnslookup_p.h kernel/qhostaddress_p.h kernel/qhostinfo_p.h kernel/qnetworkdatagram_p.h kernel/qnetworkinterface_p.h kernel/qtnetwork_tracepoints_p.h kernel/qtnetworkglobal_p.h kernel/qurlinfo_p.h socket/qabstractsocket_p.h socket/qabstractsocketengine_p.h socket/qhttpsocketengine_p.h socket/qlocalserver_p.h socket/qlocalsocket_p.h socket/qnativesocketengine_p.h socket/qnativesocketengine_winrt_p.h socket/qnet_unix_p.h socket/qsctpserver_p.h socket/qsctpsocket_p.h socket/qsocks5socketengine_p.h socket/qtcpserver_p.h socket/qtcpsocket_p.h ssl/qasn1element_p.h ssl/qssl_p.h ssl/qsslcertificate_p.h ssl/qsslcertificateextension_p.h ssl/qsslcipher_p.h ssl/qsslconfiguration_p.h ssl/qsslcontext_openssl_p.h ssl/qssldiffiehellmanparameters_p.h ssl/qsslkey_p.h ssl/qsslpresharedkeyauthenticator_p.h ssl/qsslsocket_mac_p.h ssl/qsslsocket_openssl11_symbols_p.h ssl/qsslsocket_openssl_p.h ssl/qsslsocket_openssl_symbols_p.h ssl/qsslsocket_opensslpre11_symbols_p.h ssl/qsslsocket_p.h ssl/qsslsocket_winrt_p.h access/http2/bitstreams_p.h access/http2/hpack_p.h access/http2/hpacktable_p.h access/http2/http2frames_p.h access/http2/http2protocol_p.h access/http2/http2streams_p.h access/http2/huffman_p.h 
 SYNCQT.INJECTED_PRIVATE_HEADER_FILES = 
 SYNCQT.QPA_HEADER_FILES = 
-SYNCQT.CLEAN_HEADER_FILES = access/qabstractnetworkcache.h access/qhstspolicy.h access/qhttpmultipart.h access/qnetworkaccessmanager.h access/qnetworkcookie.h access/qnetworkcookiejar.h access/qnetworkdiskcache.h:networkdiskcache access/qnetworkreply.h access/qnetworkrequest.h bearer/qnetworkconfigmanager.h bearer/qnetworkconfiguration.h bearer/qnetworksession.h kernel/qauthenticator.h kernel/qdnslookup.h kernel/qhostaddress.h kernel/qhostinfo.h kernel/qnetworkdatagram.h kernel/qnetworkinterface.h kernel/qnetworkproxy.h kernel/qtnetworkglobal.h socket/qabstractsocket.h socket/qlocalserver.h:localserver socket/qlocalsocket.h:localserver socket/qsctpserver.h socket/qsctpsocket.h socket/qtcpserver.h socket/qtcpsocket.h socket/qudpsocket.h ssl/qssl.h ssl/qsslcertificate.h ssl/qsslcertificateextension.h ssl/qsslcipher.h ssl/qsslconfiguration.h ssl/qssldiffiehellmanparameters.h ssl/qsslellipticcurve.h ssl/qsslerror.h ssl/qsslkey.h ssl/qsslpresharedkeyauthenticator.h ssl/qsslsocket.h 
+SYNCQT.CLEAN_HEADER_FILES = access/qabstractnetworkcache.h access/qhstspolicy.h access/qhttp2configuration.h access/qhttpconnectionpoolconfiguration.h access/qhttpmultipart.h access/qnetworkaccessmanager.h access/qnetworkcookie.h access/qnetworkcookiejar.h access/qnetworkdiskcache.h:networkdiskcache access/qnetworkreply.h access/qnetworkrequest.h bearer/qnetworkconfigmanager.h bearer/qnetworkconfiguration.h bearer/qnetworksession.h kernel/qauthenticator.h kernel/qdnslookup.h kernel/qhostaddress.h kernel/qhostinfo.h kernel/qnetworkdatagram.h kernel/qnetworkinterface.h kernel/qnetworkproxy.h kernel/qtnetworkglobal.h socket/qabstractsocket.h socket/qlocalserver.h:localserver socket/qlocalsocket.h:localserver socket/qsctpserver.h socket/qsctpsocket.h socket/qtcpserver.h socket/qtcpsocket.h socket/qudpsocket.h ssl/qssl.h ssl/qsslcertificate.h ssl/qsslcertificateextension.h ssl/qsslcipher.h ssl/qsslconfiguration.h ssl/qssldiffiehellmanparameters.h ssl/qsslellipticcurve.h ssl/qsslerror.h ssl/qsslkey.h ssl/qsslpresharedkeyauthenticator.h ssl/qsslsocket.h 
 SYNCQT.INJECTIONS = 
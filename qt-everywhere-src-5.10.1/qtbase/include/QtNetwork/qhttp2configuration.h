@@ -0,0 +1 @@
+#include "../../src/network/access/qhttp2configuration.h"
@@ -0,0 +1 @@
+#include "../../src/network/access/qhttpconnectionpoolconfiguration.h"
@@ -1,8 +1,8 @@
-SYNCQT.HEADER_FILES = kernel/qsqldatabase.h kernel/qsqldriver.h kernel/qsqldriverplugin.h kernel/qsqlerror.h kernel/qsqlfield.h kernel/qsqlindex.h kernel/qsqlquery.h kernel/qsqlrecord.h kernel/qsqlresult.h kernel/qtsqlglobal.h models/qsqlquerymodel.h models/qsqlrelationaldelegate.h models/qsqlrelationaltablemodel.h models/qsqltablemodel.h ../../include/QtSql/qsql.h ../../include/QtSql/qtsqlversion.h ../../include/QtSql/QtSql 
+SYNCQT.HEADER_FILES = kernel/qsqlasyncquery.h kernel/qsqlconnectionpool.h kernel/qsqldatabase.h kernel/qsqldriver.h kernel/qsqldriverplugin.h kernel/qsqlerror.h kernel/qsqlfield.h kernel/qsqlindex.h kernel/qsqlquery.h kernel/qsqlrecord.h kernel/qsqlresult.h kernel/qtsqlglobal.h models/qsqlquerymodel.h models/qsqlrelationaldelegate.h models/qsqlrelationaltablemodel.h models/qsqltablemodel.h ../../include/QtSql/qsql.h ../../include/QtSql/qtsqlversion.h ../../include/QtSql/QtSql 
 SYNCQT.INJECTED_HEADER_FILES = 
-SYNCQT.HEADER_CLASSES = ../../include/QtSql/QSqlDriverCreatorBase ../../include/QtSql/QSqlDriverCreator ../../include/QtSql/QSqlDatabase ../../include/QtSql/QSqlDriver ../../include/QtSql/QSqlDriverPlugin ../../include/QtSql/QSqlError ../../include/QtSql/QSqlField ../../include/QtSql/QSqlIndex ../../include/QtSql/QSqlQuery ../../include/QtSql/QSqlRecord ../../include/QtSql/QSqlResult ../../include/QtSql/QSql ../../include/QtSql/QSqlQueryModel ../../include/QtSql/QSqlRelationalDelegate ../../include/QtSql/QSqlRelation ../../include/QtSql/QSqlRelationalTableModel ../../include/QtSql/QSqlTableModel ../../include/QtSql/QtSqlVersion 
+SYNCQT.HEADER_CLASSES = ../../include/QtSql/QSqlAsyncQuery ../../include/QtSql/QSqlConnectionPool ../../include/QtSql/QSqlDriverCreatorBase ../../include/QtSql/QSqlDriverCreator ../../include/QtSql/QSqlDatabase ../../include/QtSql/QSqlDriver ../../include/QtSql/QSqlDriverPlugin ../../include/QtSql/QSqlError ../../include/QtSql/QSqlField ../../include/QtSql/QSqlIndex ../../include/QtSql/QSqlQuery ../../include/QtSql/QSqlRecord ../../include/QtSql/QSqlResult ../../include/QtSql/QSql ../../include/QtSql/QSqlQueryModel ../../include/QtSql/QSqlRelationalDelegate ../../include/QtSql/QSqlRelation ../../include/QtSql/QSqlRelationalTableModel ../../include/QtSql/QSqlTableModel ../../include/QtSql/QtSqlVersion 
 SYNCQT.PRIVATE_HEADER_FILES = kernel/qsqlcachedresult_p.h kernel/qsqldriver_p.h kernel/qsqlnulldriver_p.h kernel/qsqlresult_p.h kernel/qtsqlglobal_p.h models/qsqlquerymodel_p.h models/qsqltablemodel_p.h 
 SYNCQT.INJECTED_PRIVATE_HEADER_FILES = 
 SYNCQT.QPA_HEADER_FILES = 
-SYNCQT.CLEAN_HEADER_FILES = kernel/qsqldatabase.h kernel/qsqldriver.h kernel/qsqldriverplugin.h kernel/qsqlerror.h kernel/qsqlfield.h kernel/qsqlindex.h kernel/qsqlquery.h kernel/qsqlrecord.h kernel/qsqlresult.h kernel/qtsqlglobal.h models/qsqlquerymodel.h models/qsqlrelationaldelegate.h models/qsqlrelationaltablemodel.h models/qsqltablemodel.h 
+SYNCQT.CLEAN_HEADER_FILES = kernel/qsqlasyncquery.h kernel/qsqlconnectionpool.h kernel/qsqldatabase.h kernel/qsqldriver.h kernel/qsqldriverplugin.h kernel/qsqlerror.h kernel/qsqlfield.h kernel/qsqlindex.h kernel/qsqlquery.h kernel/qsqlrecord.h kernel/qsqlresult.h kernel/qtsqlglobal.h models/qsqlquerymodel.h models/qsqlrelationaldelegate.h models/qsqlrelationaltablemodel.h models/qsqltablemodel.h 
 SYNCQT.INJECTIONS = 
@@ -0,0 +1 @@
+#include "../../src/sql/kernel/qsqlasyncquery.h"
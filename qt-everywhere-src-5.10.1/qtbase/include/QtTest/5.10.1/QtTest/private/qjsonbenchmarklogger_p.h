@@ -0,0 +1 @@
+#include "../../../../../src/testlib/qjsonbenchmarklogger_p.h"
@@ -1,7 +1,7 @@
 SYNCQT.HEADER_FILES = qbenchmark.h qbenchmarkmetric.h qsignalspy.h qtest.h qtest_global.h qtest_gui.h qtest_network.h qtest_widgets.h qtestaccessible.h qtestassert.h qtestcase.h qtestdata.h qtestevent.h qtesteventloop.h qtestkeyboard.h qtestmouse.h qtestspontaneevent.h qtestsystem.h qtesttouch.h ../../include/QtTest/qttestversion.h ../../include/QtTest/QtTest 
 SYNCQT.INJECTED_HEADER_FILES = 
 SYNCQT.HEADER_CLASSES = ../../include/QtTest/QSignalSpy ../../include/QtTest/QTest ../../include/QtTest/QtTestGui ../../include/QtTest/QtTestNetwork ../../include/QtTest/QtTestWidgets ../../include/QtTest/QTestAccessibility ../../include/QtTest/QTestData ../../include/QtTest/QTestEvent ../../include/QtTest/QTestKeyEvent ../../include/QtTest/QTestKeyClicksEvent ../../include/QtTest/QTestMouseEvent ../../include/QtTest/QTestDelayEvent ../../include/QtTest/QTestEventList ../../include/QtTest/QTestEventLoop ../../include/QtTest/QEventSizeOfChecker ../../include/QtTest/QSpontaneKeyEvent ../../include/QtTest/QtTestVersion 
-SYNCQT.PRIVATE_HEADER_FILES = qabstracttestlogger_p.h qbenchmark_p.h qbenchmarkevent_p.h qbenchmarkmeasurement_p.h qbenchmarkmetric_p.h qbenchmarkperfevents_p.h qbenchmarktimemeasurers_p.h qbenchmarkvalgrind_p.h qcsvbenchmarklogger_p.h qplaintestlogger_p.h qsignaldumper_p.h qteamcitylogger_p.h qtestblacklist_p.h qtestcoreelement_p.h qtestcorelist_p.h qtestelement_p.h qtestelementattribute_p.h qtesthelpers_p.h qtestlog_p.h qtestresult_p.h qtesttable_p.h qtestutil_macos_p.h qtestxunitstreamer_p.h qxctestlogger_p.h qxmltestlogger_p.h qxunittestlogger_p.h 3rdparty/callgrind_p.h 3rdparty/cycle_p.h 3rdparty/linux_perf_event_p.h 3rdparty/valgrind_p.h 
+SYNCQT.PRIVATE_HEADER_FILES = qabstracttestlogger_p.h qbenchmark_p.h qbenchmarkevent_p.h qbenchmarkmeasurement_p.h qbenchmarkmetric_p.h qbenchmarkperfevents_p.h qbenchmarktimemeasurers_p.h qbenchmarkvalgrind_p.h qcsvbenchmarklogger_p.h qjsonbenchmarklogger_p.h qplaintestlogger_p.h qsignaldumper_p.h qteamcitylogger_p.h qtestblacklist_p.h qtestcoreelement_p.h qtestcorelist_p.h qtestelement_p.h qtestelementattribute_p.h qtesthelpers_p.h qtestlog_p.h qtestresult_p.h qtesttable_p.h qtestutil_macos_p.h qtestxunitstreamer_p.h qxctestlogger_p.h qxmltestlogger_p.h qxunittestlogger_p.h 3rdparty/callgrind_p.h 3rdparty/cycle_p.h 3rdparty/linux_perf_event_p.h 3rdparty/valgrind_p.h 
 SYNCQT.INJECTED_PRIVATE_HEADER_FILES = 
 SYNCQT.QPA_HEADER_FILES = 
 SYNCQT.CLEAN_HEADER_FILES = qbenchmark.h qbenchmarkmetric.h qsignalspy.h qtest.h qtest_global.h qtest_gui.h qtest_network.h qtest_widgets.h qtestaccessible.h qtestassert.h qtestcase.h qtestdata.h qtestevent.h qtesteventloop.h qtestkeyboard.h qtestmouse.h qtestspontaneevent.h qtestsystem.h qtesttouch.h 
@@ -0,0 +1 @@
+#include "../../../../../src/widgets/graphicsview/qgraphicsscene_quadtree_p.h"
@@ -0,0 +1 @@
+#include "../../../../../src/widgets/graphicsview/qgraphicsscenequadtreeindex_p.h"
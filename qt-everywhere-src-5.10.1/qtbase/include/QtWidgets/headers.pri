@@ -1,7 +1,7 @@
 SYNCQT.HEADER_FILES = accessible/qaccessiblewidget.h dialogs/qcolordialog.h dialogs/qdialog.h dialogs/qerrormessage.h dialogs/qfiledialog.h dialogs/qfilesystemmodel.h dialogs/qfontdialog.h dialogs/qinputdialog.h dialogs/qmessagebox.h dialogs/qprogressdialog.h dialogs/qwizard.h effects/qgraphicseffect.h graphicsview/qgraphicsanchorlayout.h graphicsview/qgraphicsgridlayout.h graphicsview/qgraphicsitem.h graphicsview/qgraphicsitemanimation.h graphicsview/qgraphicslayout.h graphicsview/qgraphicslayoutitem.h graphicsview/qgraphicslinearlayout.h graphicsview/qgraphicsproxywidget.h graphicsview/qgraphicsscene.h graphicsview/qgraphicssceneevent.h graphicsview/qgraphicstransform.h graphicsview/qgraphicsview.h graphicsview/qgraphicswidget.h itemviews/qabstractitemdelegate.h itemviews/qabstractitemview.h itemviews/qcolumnview.h itemviews/qdatawidgetmapper.h itemviews/qdirmodel.h itemviews/qfileiconprovider.h itemviews/qheaderview.h itemviews/qitemdelegate.h itemviews/qitemeditorfactory.h itemviews/qlistview.h itemviews/qlistwidget.h itemviews/qstyleditemdelegate.h itemviews/qtableview.h itemviews/qtablewidget.h itemviews/qtreeview.h itemviews/qtreewidget.h itemviews/qtreewidgetitemiterator.h kernel/qaction.h kernel/qactiongroup.h kernel/qapplication.h kernel/qboxlayout.h kernel/qdesktopwidget.h kernel/qformlayout.h kernel/qgesture.h kernel/qgesturerecognizer.h kernel/qgridlayout.h kernel/qlayout.h kernel/qlayoutitem.h kernel/qopenglwidget.h kernel/qshortcut.h kernel/qsizepolicy.h kernel/qstackedlayout.h kernel/qtooltip.h kernel/qtwidgetsglobal.h kernel/qwhatsthis.h kernel/qwidget.h kernel/qwidgetaction.h statemachine/qkeyeventtransition.h statemachine/qmouseeventtransition.h styles/qcommonstyle.h styles/qdrawutil.h styles/qproxystyle.h styles/qstyle.h styles/qstylefactory.h styles/qstyleoption.h styles/qstylepainter.h styles/qstyleplugin.h util/qcolormap.h util/qcompleter.h util/qscroller.h util/qscrollerproperties.h util/qsystemtrayicon.h util/qundogroup.h util/qundostack.h util/qundoview.h widgets/qabstractbutton.h widgets/qabstractscrollarea.h widgets/qabstractslider.h widgets/qabstractspinbox.h widgets/qbuttongroup.h widgets/qcalendarwidget.h widgets/qcheckbox.h widgets/qcombobox.h widgets/qcommandlinkbutton.h widgets/qdatetimeedit.h widgets/qdial.h widgets/qdialogbuttonbox.h widgets/qdockwidget.h widgets/qfocusframe.h widgets/qfontcombobox.h widgets/qframe.h widgets/qgroupbox.h widgets/qkeysequenceedit.h widgets/qlabel.h widgets/qlcdnumber.h widgets/qlineedit.h widgets/qmaccocoaviewcontainer_mac.h widgets/qmacnativewidget_mac.h widgets/qmainwindow.h widgets/qmdiarea.h widgets/qmdisubwindow.h widgets/qmenu.h widgets/qmenubar.h widgets/qplaintextedit.h widgets/qprogressbar.h widgets/qpushbutton.h widgets/qradiobutton.h widgets/qrubberband.h widgets/qscrollarea.h widgets/qscrollbar.h widgets/qsizegrip.h widgets/qslider.h widgets/qspinbox.h widgets/qsplashscreen.h widgets/qsplitter.h widgets/qstackedwidget.h widgets/qstatusbar.h widgets/qtabbar.h widgets/qtabwidget.h widgets/qtextbrowser.h widgets/qtextedit.h widgets/qtoolbar.h widgets/qtoolbox.h widgets/qtoolbutton.h ../../include/QtWidgets/qtwidgetsversion.h ../../include/QtWidgets/QtWidgets 
 SYNCQT.INJECTED_HEADER_FILES = 
 SYNCQT.HEADER_CLASSES = ../../include/QtWidgets/QAccessibleWidget ../../include/QtWidgets/QColorDialog ../../include/QtWidgets/QDialog ../../include/QtWidgets/QErrorMessage ../../include/QtWidgets/QFileDialog ../../include/QtWidgets/QFileSystemModel ../../include/QtWidgets/QFontDialog ../../include/QtWidgets/QInputDialog ../../include/QtWidgets/QMessageBox ../../include/QtWidgets/QProgressDialog ../../include/QtWidgets/QWizard ../../include/QtWidgets/QWizardPage ../../include/QtWidgets/QGraphicsEffect ../../include/QtWidgets/QGraphicsColorizeEffect ../../include/QtWidgets/QGraphicsBlurEffect ../../include/QtWidgets/QGraphicsDropShadowEffect ../../include/QtWidgets/QGraphicsOpacityEffect ../../include/QtWidgets/QGraphicsAnchor ../../include/QtWidgets/QGraphicsAnchorLayout ../../include/QtWidgets/QGraphicsGridLayout ../../include/QtWidgets/QGraphicsItem ../../include/QtWidgets/QGraphicsObject ../../include/QtWidgets/QAbstractGraphicsShapeItem ../../include/QtWidgets/QGraphicsPathItem ../../include/QtWidgets/QGraphicsRectItem ../../include/QtWidgets/QGraphicsEllipseItem ../../include/QtWidgets/QGraphicsPolygonItem ../../include/QtWidgets/QGraphicsLineItem ../../include/QtWidgets/QGraphicsPixmapItem ../../include/QtWidgets/QGraphicsTextItem ../../include/QtWidgets/QGraphicsSimpleTextItem ../../include/QtWidgets/QGraphicsItemGroup ../../include/QtWidgets/QGraphicsItemAnimation ../../include/QtWidgets/QGraphicsLayout ../../include/QtWidgets/QGraphicsLayoutItem ../../include/QtWidgets/QGraphicsLinearLayout ../../include/QtWidgets/QGraphicsProxyWidget ../../include/QtWidgets/QGraphicsScene ../../include/QtWidgets/QGraphicsSceneEvent ../../include/QtWidgets/QGraphicsSceneMouseEvent ../../include/QtWidgets/QGraphicsSceneWheelEvent ../../include/QtWidgets/QGraphicsSceneContextMenuEvent ../../include/QtWidgets/QGraphicsSceneHoverEvent ../../include/QtWidgets/QGraphicsSceneHelpEvent ../../include/QtWidgets/QGraphicsSceneDragDropEvent ../../include/QtWidgets/QGraphicsSceneResizeEvent ../../include/QtWidgets/QGraphicsSceneMoveEvent ../../include/QtWidgets/QGraphicsTransform ../../include/QtWidgets/QGraphicsScale ../../include/QtWidgets/QGraphicsRotation ../../include/QtWidgets/QGraphicsView ../../include/QtWidgets/QGraphicsWidget ../../include/QtWidgets/QAbstractItemDelegate ../../include/QtWidgets/QAbstractItemView ../../include/QtWidgets/QColumnView ../../include/QtWidgets/QDataWidgetMapper ../../include/QtWidgets/QDirModel ../../include/QtWidgets/QFileIconProvider ../../include/QtWidgets/QHeaderView ../../include/QtWidgets/QItemDelegate ../../include/QtWidgets/QItemEditorCreatorBase ../../include/QtWidgets/QItemEditorCreator ../../include/QtWidgets/QStandardItemEditorCreator ../../include/QtWidgets/QItemEditorFactory ../../include/QtWidgets/QListView ../../include/QtWidgets/QListWidgetItem ../../include/QtWidgets/QListWidget ../../include/QtWidgets/QStyledItemDelegate ../../include/QtWidgets/QTableView ../../include/QtWidgets/QTableWidgetSelectionRange ../../include/QtWidgets/QTableWidgetItem ../../include/QtWidgets/QTableWidget ../../include/QtWidgets/QTreeView ../../include/QtWidgets/QTreeWidgetItem ../../include/QtWidgets/QTreeWidget ../../include/QtWidgets/QTreeWidgetItemIterator ../../include/QtWidgets/QAction ../../include/QtWidgets/QActionGroup ../../include/QtWidgets/QApplication ../../include/QtWidgets/QBoxLayout ../../include/QtWidgets/QHBoxLayout ../../include/QtWidgets/QVBoxLayout ../../include/QtWidgets/QDesktopWidget ../../include/QtWidgets/QFormLayout ../../include/QtWidgets/QGesture ../../include/QtWidgets/QPanGesture ../../include/QtWidgets/QPinchGesture ../../include/QtWidgets/QSwipeGesture ../../include/QtWidgets/QTapGesture ../../include/QtWidgets/QTapAndHoldGesture ../../include/QtWidgets/QGestureEvent ../../include/QtWidgets/QGestureRecognizer ../../include/QtWidgets/QGridLayout ../../include/QtWidgets/QLayout ../../include/QtWidgets/QLayoutItem ../../include/QtWidgets/QSpacerItem ../../include/QtWidgets/QWidgetItem ../../include/QtWidgets/QWidgetItemV2 ../../include/QtWidgets/QOpenGLWidget ../../include/QtWidgets/QShortcut ../../include/QtWidgets/QSizePolicy ../../include/QtWidgets/QStackedLayout ../../include/QtWidgets/QToolTip ../../include/QtWidgets/QWhatsThis ../../include/QtWidgets/QWidgetData ../../include/QtWidgets/QWidget ../../include/QtWidgets/QWidgetAction ../../include/QtWidgets/QKeyEventTransition ../../include/QtWidgets/QMouseEventTransition ../../include/QtWidgets/QCommonStyle ../../include/QtWidgets/QTileRules ../../include/QtWidgets/QProxyStyle ../../include/QtWidgets/QStyle ../../include/QtWidgets/QStyleFactory ../../include/QtWidgets/QStyleOption ../../include/QtWidgets/QStyleOptionFocusRect ../../include/QtWidgets/QStyleOptionFrame ../../include/QtWidgets/QStyleOptionFrameV2 ../../include/QtWidgets/QStyleOptionFrameV3 ../../include/QtWidgets/QStyleOptionTabWidgetFrame ../../include/QtWidgets/QStyleOptionTabWidgetFrameV2 ../../include/QtWidgets/QStyleOptionTabBarBase ../../include/QtWidgets/QStyleOptionTabBarBaseV2 ../../include/QtWidgets/QStyleOptionHeader ../../include/QtWidgets/QStyleOptionButton ../../include/QtWidgets/QStyleOptionTab ../../include/QtWidgets/QStyleOptionTabV2 ../../include/QtWidgets/QStyleOptionTabV3 ../../include/QtWidgets/QStyleOptionToolBar ../../include/QtWidgets/QStyleOptionProgressBar ../../include/QtWidgets/QStyleOptionProgressBarV2 ../../include/QtWidgets/QStyleOptionMenuItem ../../include/QtWidgets/QStyleOptionDockWidget ../../include/QtWidgets/QStyleOptionDockWidgetV2 ../../include/QtWidgets/QStyleOptionViewItem ../../include/QtWidgets/QStyleOptionViewItemV2 ../../include/QtWidgets/QStyleOptionViewItemV3 ../../include/QtWidgets/QStyleOptionViewItemV4 ../../include/QtWidgets/QStyleOptionToolBox ../../include/QtWidgets/QStyleOptionToolBoxV2 ../../include/QtWidgets/QStyleOptionRubberBand ../../include/QtWidgets/QStyleOptionComplex ../../include/QtWidgets/QStyleOptionSlider ../../include/QtWidgets/QStyleOptionSpinBox ../../include/QtWidgets/QStyleOptionToolButton ../../include/QtWidgets/QStyleOptionComboBox ../../include/QtWidgets/QStyleOptionTitleBar ../../include/QtWidgets/QStyleOptionGroupBox ../../include/QtWidgets/QStyleOptionSizeGrip ../../include/QtWidgets/QStyleOptionGraphicsItem ../../include/QtWidgets/QStyleHintReturn ../../include/QtWidgets/QStyleHintReturnMask ../../include/QtWidgets/QStyleHintReturnVariant ../../include/QtWidgets/QStylePainter ../../include/QtWidgets/QStylePlugin ../../include/QtWidgets/QColormap ../../include/QtWidgets/QCompleter ../../include/QtWidgets/QScroller ../../include/QtWidgets/QScrollerProperties ../../include/QtWidgets/QSystemTrayIcon ../../include/QtWidgets/QUndoGroup ../../include/QtWidgets/QUndoCommand ../../include/QtWidgets/QUndoStack ../../include/QtWidgets/QUndoView ../../include/QtWidgets/QAbstractButton ../../include/QtWidgets/QAbstractScrollArea ../../include/QtWidgets/QAbstractSlider ../../include/QtWidgets/QAbstractSpinBox ../../include/QtWidgets/QButtonGroup ../../include/QtWidgets/QCalendarWidget ../../include/QtWidgets/QCheckBox ../../include/QtWidgets/QComboBox ../../include/QtWidgets/QCommandLinkButton ../../include/QtWidgets/QDateTimeEdit ../../include/QtWidgets/QTimeEdit ../../include/QtWidgets/QDateEdit ../../include/QtWidgets/QDial ../../include/QtWidgets/QDialogButtonBox ../../include/QtWidgets/QDockWidget ../../include/QtWidgets/QFocusFrame ../../include/QtWidgets/QFontComboBox ../../include/QtWidgets/QFrame ../../include/QtWidgets/QGroupBox ../../include/QtWidgets/QKeySequenceEdit ../../include/QtWidgets/QLabel ../../include/QtWidgets/QLCDNumber ../../include/QtWidgets/QLineEdit ../../include/QtWidgets/QMacCocoaViewContainer ../../include/QtWidgets/QMacNativeWidget ../../include/QtWidgets/QMainWindow ../../include/QtWidgets/QMdiArea ../../include/QtWidgets/QMdiSubWindow ../../include/QtWidgets/QMenu ../../include/QtWidgets/QMenuBar ../../include/QtWidgets/QPlainTextEdit ../../include/QtWidgets/QPlainTextDocumentLayout ../../include/QtWidgets/QProgressBar ../../include/QtWidgets/QPushButton ../../include/QtWidgets/QRadioButton ../../include/QtWidgets/QRubberBand ../../include/QtWidgets/QScrollArea ../../include/QtWidgets/QScrollBar ../../include/QtWidgets/QSizeGrip ../../include/QtWidgets/QSlider ../../include/QtWidgets/QSpinBox ../../include/QtWidgets/QDoubleSpinBox ../../include/QtWidgets/QSplashScreen ../../include/QtWidgets/QSplitter ../../include/QtWidgets/QSplitterHandle ../../include/QtWidgets/QStackedWidget ../../include/QtWidgets/QStatusBar ../../include/QtWidgets/QTabBar ../../include/QtWidgets/QTabWidget ../../include/QtWidgets/QTextBrowser ../../include/QtWidgets/QTextEdit ../../include/QtWidgets/QToolBar ../../include/QtWidgets/QToolBox ../../include/QtWidgets/QToolButton ../../include/QtWidgets/QtWidgetsVersion 
-SYNCQT.PRIVATE_HEADER_FILES = accessible/complexwidgets_p.h accessible/itemviews_p.h accessible/qaccessiblemenu_p.h accessible/qaccessiblewidgetfactory_p.h accessible/qaccessiblewidgets_p.h accessible/rangecontrols_p.h accessible/simplewidgets_p.h dialogs/qdialog_p.h dialogs/qfiledialog_p.h dialogs/qfileinfogatherer_p.h dialogs/qfilesystemmodel_p.h dialogs/qfontdialog_p.h dialogs/qfscompleter_p.h dialogs/qsidebar_p.h dialogs/qwizard_win_p.h effects/qgraphicseffect_p.h effects/qpixmapfilter_p.h graphicsview/qgraph_p.h graphicsview/qgraphicsanchorlayout_p.h graphicsview/qgraphicsgridlayoutengine_p.h graphicsview/qgraphicsitem_p.h graphicsview/qgraphicslayout_p.h graphicsview/qgraphicslayoutitem_p.h graphicsview/qgraphicslayoutstyleinfo_p.h graphicsview/qgraphicsproxywidget_p.h graphicsview/qgraphicsscene_bsp_p.h graphicsview/qgraphicsscene_p.h graphicsview/qgraphicsscenebsptreeindex_p.h graphicsview/qgraphicssceneindex_p.h graphicsview/qgraphicsscenelinearindex_p.h graphicsview/qgraphicstransform_p.h graphicsview/qgraphicsview_p.h graphicsview/qgraphicswidget_p.h graphicsview/qsimplex_p.h itemviews/qabstractitemdelegate_p.h itemviews/qabstractitemview_p.h itemviews/qbsptree_p.h itemviews/qcolumnview_p.h itemviews/qcolumnviewgrip_p.h itemviews/qfileiconprovider_p.h itemviews/qheaderview_p.h itemviews/qitemeditorfactory_p.h itemviews/qlistview_p.h itemviews/qlistwidget_p.h itemviews/qtableview_p.h itemviews/qtablewidget_p.h itemviews/qtreeview_p.h itemviews/qtreewidget_p.h itemviews/qtreewidgetitemiterator_p.h itemviews/qwidgetitemdata_p.h kernel/qaction_p.h kernel/qapplication_p.h kernel/qdesktopwidget_p.h kernel/qgesture_p.h kernel/qgesturemanager_p.h kernel/qlayout_p.h kernel/qlayoutengine_p.h kernel/qmacgesturerecognizer_p.h kernel/qstandardgestures_p.h kernel/qt_widgets_pch.h kernel/qtwidgetsglobal_p.h kernel/qwidget_p.h kernel/qwidgetaction_p.h kernel/qwidgetbackingstore_p.h kernel/qwidgetwindow_p.h kernel/qwindowcontainer_p.h statemachine/qbasickeyeventtransition_p.h statemachine/qbasicmouseeventtransition_p.h styles/qcommonstyle_p.h styles/qcommonstylepixmaps_p.h styles/qfusionstyle_p.h styles/qfusionstyle_p_p.h styles/qpixmapstyle_p.h styles/qpixmapstyle_p_p.h styles/qproxystyle_p.h styles/qstyle_p.h styles/qstyleanimation_p.h styles/qstylehelper_p.h styles/qstylesheetstyle_p.h styles/qwindowsstyle_p.h styles/qwindowsstyle_p_p.h util/qcompleter_p.h util/qflickgesture_p.h util/qscroller_p.h util/qscrollerproperties_p.h util/qsystemtrayicon_p.h util/qundostack_p.h widgets/qabstractbutton_p.h widgets/qabstractscrollarea_p.h widgets/qabstractslider_p.h widgets/qabstractspinbox_p.h widgets/qbuttongroup_p.h widgets/qcombobox_p.h widgets/qdatetimeedit_p.h widgets/qdockarealayout_p.h widgets/qdockwidget_p.h widgets/qeffects_p.h widgets/qframe_p.h widgets/qkeysequenceedit_p.h widgets/qlabel_p.h widgets/qlineedit_p.h widgets/qmainwindowlayout_p.h widgets/qmdiarea_p.h widgets/qmdisubwindow_p.h widgets/qmenu_p.h widgets/qmenubar_p.h widgets/qplaintextedit_p.h widgets/qpushbutton_p.h widgets/qscrollarea_p.h widgets/qscrollbar_p.h widgets/qsplitter_p.h widgets/qtabbar_p.h widgets/qtextedit_p.h widgets/qtoolbar_p.h widgets/qtoolbararealayout_p.h widgets/qtoolbarextension_p.h widgets/qtoolbarlayout_p.h widgets/qtoolbarseparator_p.h widgets/qwidgetanimator_p.h widgets/qwidgetlinecontrol_p.h widgets/qwidgetresizehandler_p.h widgets/qwidgettextcontrol_p.h widgets/qwidgettextcontrol_p_p.h 
+SYNCQT.PRIVATE_HEADER_FILES = accessible/complexwidgets_p.h accessible/itemviews_p.h accessible/qaccessiblemenu_p.h accessible/qaccessiblewidgetfactory_p.h accessible/qaccessiblewidgets_p.h accessible/rangecontrols_p.h accessible/simplewidgets_p.h dialogs/qdialog_p.h dialogs/qfiledialog_p.h dialogs/qfileinfogatherer_p.h dialogs/qfilesystemmodel_p.h dialogs/qfontdialog_p.h dialogs/qfscompleter_p.h dialogs/qsidebar_p.h dialogs/qwizard_win_p.h effects/qgraphicseffect_p.h effects/qpixmapfilter_p.h graphicsview/qgraph_p.h graphicsview/qgraphicsanchorlayout_p.h graphicsview/qgraphicsgridlayoutengine_p.h graphicsview/qgraphicsitem_p.h graphicsview/qgraphicslayout_p.h graphicsview/qgraphicslayoutitem_p.h graphicsview/qgraphicslayoutstyleinfo_p.h graphicsview/qgraphicsproxywidget_p.h graphicsview/qgraphicsscene_bsp_p.h graphicsview/qgraphicsscene_p.h graphicsview/qgraphicsscene_quadtree_p.h graphicsview/qgraphicsscenebsptreeindex_p.h graphicsview/qgraphicssceneindex_p.h graphicsview/qgraphicsscenelinearindex_p.h graphicsview/qgraphicsscenequadtreeindex_p.h graphicsview/qgraphicstransform_p.h graphicsview/qgraphicsview_p.h graphicsview/qgraphicswidget_p.h graphicsview/qsimplex_p.h itemviews/qabstractitemdelegate_p.h itemviews/qabstractitemview_p.h itemviews/qbsptree_p.h itemviews/qcolumnview_p.h itemviews/qcolumnviewgrip_p.h itemviews/qfileiconprovider_p.h itemviews/qheaderview_p.h itemviews/qitemeditorfactory_p.h itemviews/qlistview_p.h itemviews/qlistwidget_p.h itemviews/qtableview_p.h itemviews/qtablewidget_p.h itemviews/qtreeview_p.h itemviews/qtreewidget_p.h itemviews/qtreewidgetitemiterator_p.h itemviews/qwidgetitemdata_p.h kernel/qaction_p.h kernel/qapplication_p.h kernel/qdesktopwidget_p.h kernel/qgesture_p.h kernel/qgesturemanager_p.h kernel/qlayout_p.h kernel/qlayoutengine_p.h kernel/qmacgesturerecognizer_p.h kernel/qstandardgestures_p.h kernel/qt_widgets_pch.h kernel/qtwidgetsglobal_p.h kernel/qwidget_p.h kernel/qwidgetaction_p.h kernel/qwidgetbackingstore_p.h kernel/qwidgetwindow_p.h kernel/qwindowcontainer_p.h statemachine/qbasickeyeventtransition_p.h statemachine/qbasicmouseeventtransition_p.h styles/qcommonstyle_p.h styles/qcommonstylepixmaps_p.h styles/qfusionstyle_p.h styles/qfusionstyle_p_p.h styles/qpixmapstyle_p.h styles/qpixmapstyle_p_p.h styles/qproxystyle_p.h styles/qstyle_p.h styles/qstyleanimation_p.h styles/qstylehelper_p.h styles/qstylesheetstyle_p.h styles/qwindowsstyle_p.h styles/qwindowsstyle_p_p.h util/qcompleter_p.h util/qflickgesture_p.h util/qscroller_p.h util/qscrollerproperties_p.h util/qsystemtrayicon_p.h util/qundostack_p.h widgets/qabstractbutton_p.h widgets/qabstractscrollarea_p.h widgets/qabstractslider_p.h widgets/qabstractspinbox_p.h widgets/qbuttongroup_p.h widgets/qcombobox_p.h widgets/qdatetimeedit_p.h widgets/qdockarealayout_p.h widgets/qdockwidget_p.h widgets/qeffects_p.h widgets/qframe_p.h widgets/qkeysequenceedit_p.h widgets/qlabel_p.h widgets/qlineedit_p.h widgets/qmainwindowlayout_p.h widgets/qmdiarea_p.h widgets/qmdisubwindow_p.h widgets/qmenu_p.h widgets/qmenubar_p.h widgets/qplaintextedit_p.h widgets/qpushbutton_p.h widgets/qscrollarea_p.h widgets/qscrollbar_p.h widgets/qsplitter_p.h widgets/qtabbar_p.h widgets/qtextedit_p.h widgets/qtoolbar_p.h widgets/qtoolbararealayout_p.h widgets/qtoolbarextension_p.h widgets/qtoolbarlayout_p.h widgets/qtoolbarseparator_p.h widgets/qwidgetanimator_p.h widgets/qwidgetlinecontrol_p.h widgets/qwidgetresizehandler_p.h widgets/qwidgettextcontrol_p.h widgets/qwidgettextcontrol_p_p.h 
 SYNCQT.INJECTED_PRIVATE_HEADER_FILES = 
 SYNCQT.QPA_HEADER_FILES = 
 SYNCQT.CLEAN_HEADER_FILES = accessible/qaccessiblewidget.h dialogs/qcolordialog.h:colordialog dialogs/qdialog.h:dialog dialogs/qerrormessage.h:errormessage dialogs/qfiledialog.h:filedialog dialogs/qfilesystemmodel.h:filesystemmodel dialogs/qfontdialog.h:fontdialog dialogs/qinputdialog.h:inputdialog dialogs/qmessagebox.h:messagebox dialogs/qprogressdialog.h:progressdialog dialogs/qwizard.h:wizard effects/qgraphicseffect.h:graphicseffect graphicsview/qgraphicsanchorlayout.h:graphicsview graphicsview/qgraphicsgridlayout.h:graphicsview graphicsview/qgraphicsitem.h:graphicsview graphicsview/qgraphicsitemanimation.h:graphicsview graphicsview/qgraphicslayout.h:graphicsview graphicsview/qgraphicslayoutitem.h:graphicsview graphicsview/qgraphicslinearlayout.h:graphicsview graphicsview/qgraphicsproxywidget.h:graphicsview graphicsview/qgraphicsscene.h:graphicsview graphicsview/qgraphicssceneevent.h:graphicsview graphicsview/qgraphicstransform.h:graphicsview graphicsview/qgraphicsview.h:graphicsview graphicsview/qgraphicswidget.h:graphicsview itemviews/qabstractitemdelegate.h:itemviews itemviews/qabstractitemview.h:itemviews itemviews/qcolumnview.h:columnview itemviews/qdatawidgetmapper.h:datawidgetmapper itemviews/qdirmodel.h:dirmodel itemviews/qfileiconprovider.h itemviews/qheaderview.h:itemviews itemviews/qitemdelegate.h:itemviews itemviews/qitemeditorfactory.h:itemviews itemviews/qlistview.h:listview itemviews/qlistwidget.h:listwidget itemviews/qstyleditemdelegate.h:itemviews itemviews/qtableview.h:tableview itemviews/qtablewidget.h:tablewidget itemviews/qtreeview.h:treeview itemviews/qtreewidget.h:treewidget itemviews/qtreewidgetitemiterator.h:treewidget kernel/qaction.h kernel/qactiongroup.h kernel/qapplication.h kernel/qboxlayout.h kernel/qdesktopwidget.h kernel/qformlayout.h:formlayout kernel/qgesture.h kernel/qgesturerecognizer.h kernel/qgridlayout.h kernel/qlayout.h kernel/qlayoutitem.h kernel/qopenglwidget.h kernel/qshortcut.h kernel/qsizepolicy.h kernel/qstackedlayout.h kernel/qtooltip.h kernel/qtwidgetsglobal.h kernel/qwhatsthis.h:whatsthis kernel/qwidget.h kernel/qwidgetaction.h statemachine/qkeyeventtransition.h:qeventtransition statemachine/qmouseeventtransition.h:qeventtransition styles/qcommonstyle.h styles/qdrawutil.h styles/qproxystyle.h styles/qstyle.h styles/qstylefactory.h styles/qstyleoption.h styles/qstylepainter.h styles/qstyleplugin.h util/qcolormap.h util/qcompleter.h:completer util/qscroller.h:scroller util/qscrollerproperties.h:scroller util/qsystemtrayicon.h util/qundogroup.h:undogroup util/qundostack.h:undocommand util/qundoview.h:undoview widgets/qabstractbutton.h:abstractbutton widgets/qabstractscrollarea.h widgets/qabstractslider.h:abstractslider widgets/qabstractspinbox.h:spinbox widgets/qbuttongroup.h:buttongroup widgets/qcalendarwidget.h:calendarwidget widgets/qcheckbox.h:checkbox widgets/qcombobox.h:combobox widgets/qcommandlinkbutton.h:commandlinkbutton widgets/qdatetimeedit.h:datetimeedit widgets/qdial.h:dial widgets/qdialogbuttonbox.h:dialogbuttonbox widgets/qdockwidget.h:dockwidget widgets/qfocusframe.h widgets/qfontcombobox.h:fontcombobox widgets/qframe.h widgets/qgroupbox.h:groupbox widgets/qkeysequenceedit.h:keysequenceedit widgets/qlabel.h:label widgets/qlcdnumber.h:lcdnumber widgets/qlineedit.h:lineedit widgets/qmaccocoaviewcontainer_mac.h widgets/qmacnativewidget_mac.h widgets/qmainwindow.h:mainwindow widgets/qmdiarea.h:mdiarea widgets/qmdisubwindow.h:mdiarea widgets/qmenu.h:menu widgets/qmenubar.h:menubar widgets/qplaintextedit.h:textedit widgets/qprogressbar.h:progressbar widgets/qpushbutton.h:pushbutton widgets/qradiobutton.h:radiobutton widgets/qrubberband.h:rubberband widgets/qscrollarea.h:scrollarea widgets/qscrollbar.h:scrollbar widgets/qsizegrip.h:sizegrip widgets/qslider.h:slider widgets/qspinbox.h:spinbox widgets/qsplashscreen.h:splashscreen widgets/qsplitter.h:splitter widgets/qstackedwidget.h:stackedwidget widgets/qstatusbar.h:statusbar widgets/qtabbar.h:tabbar widgets/qtabwidget.h:tabwidget widgets/qtextbrowser.h:textbrowser widgets/qtextedit.h:textedit widgets/qtoolbar.h widgets/qtoolbox.h:toolbox widgets/qtoolbutton.h:toolbutton 
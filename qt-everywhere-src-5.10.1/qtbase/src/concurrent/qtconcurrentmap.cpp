@@ -88,6 +88,23 @@
     Note that the result types above are not QFuture objects, but real result
     types (in this case, QList<QImage> and QImage).
 
+    \section2 Map-Reduce over Large Sequences
+
+    blockingMappedReduced() reports every intermediate result to a result
+    store and serializes the calls to the reduce function. When the map and
+    reduce functions are cheap and the sequence is large, that bookkeeping
+    can cost more than the computation itself. blockingMapReduce() splits
+    the sequence into one contiguous block per thread instead, reduces each
+    block into an accumulator of its own, and finally combines the
+    accumulators pairwise:
+
+    \code
+    int square(int x) { return x * x; }
+    void add(int &sum, int value) { sum += value; }
+
+    int sumOfSquares = QtConcurrent::blockingMapReduce<int>(values, square, add);
+    \endcode
+
     \section1 Concurrent Map
 
     QtConcurrent::mapped() takes an input sequence and a map function. This map
@@ -176,6 +193,23 @@
     Note that the result types above are not QFuture objects, but real result
     types (in this case, QList<QImage> and QImage).
 
+    \section2 Map-Reduce over Large Sequences
+
+    blockingMappedReduced() reports every intermediate result to a result
+    store and serializes the calls to the reduce function. When the map and
+    reduce functions are cheap and the sequence is large, that bookkeeping
+    can cost more than the computation itself. blockingMapReduce() splits
+    the sequence into one contiguous block per thread instead, reduces each
+    block into an accumulator of its own, and finally combines the
+    accumulators pairwise:
+
+    \code
+    int square(int x) { return x * x; }
+    void add(int &sum, int value) { sum += value; }
+
+    int sumOfSquares = QtConcurrent::blockingMapReduce<int>(values, square, add);
+    \endcode
+
     \section2 Using Member Functions
 
     QtConcurrent::map(), QtConcurrent::mapped(), and
@@ -372,3 +406,53 @@
 
   \sa blockingMappedReduced(), {Concurrent Map and Map-Reduce}
 */
+
+/*!
+  \fn T QtConcurrent::blockingMapReduce(const Sequence &sequence, MapFunction mapFunction, ReduceFunction reduceFunction)
+  \since 5.11
+
+  Calls \a mapFunction once for each item in \a sequence and passes the
+  return value to \a reduceFunction, which adds it to an accumulator of
+  type \c T. Every thread works on a contiguous block of \a sequence with an
+  accumulator of its own, and \a reduceFunction is also used to combine
+  the accumulators of two neighboring blocks, so it must accept a \c T as
+  its second argument.
+
+  The accumulators start out as default constructed values of \c T. They
+  are combined in the order of the blocks, so an order sensitive
+  \a reduceFunction sees the items in sequence order.
+
+  Unlike blockingMappedReduced(), no intermediate results are stored and
+  the threads never wait for each other to call \a reduceFunction.
+
+  \note This function will block until all items in the sequence have been processed.
+
+  \sa blockingMappedReduced(), {Concurrent Map and Map-Reduce}
+*/
+
+/*!
+  \fn T QtConcurrent::blockingMapReduce(const Sequence &sequence, MapFunction mapFunction, ReduceFunction reduceFunction, CombineFunction combineFunction)
+  \since 5.11
+  \overload
+
+  Uses \a combineFunction instead of \a reduceFunction to merge the
+  accumulator of a block into the one of the block before it. It is called
+  as \c{combineFunction(T &result, const T &other)}.
+*/
+
+/*!
+  \fn T QtConcurrent::blockingMapReduce(ConstIterator begin, ConstIterator end, MapFunction mapFunction, ReduceFunction reduceFunction)
+  \since 5.11
+  \overload
+
+  Calls \a mapFunction once for each item from \a begin to \a end.
+*/
+
+/*!
+  \fn T QtConcurrent::blockingMapReduce(ConstIterator begin, ConstIterator end, MapFunction mapFunction, ReduceFunction reduceFunction, CombineFunction combineFunction)
+  \since 5.11
+  \overload
+
+  Calls \a mapFunction once for each item from \a begin to \a end, and
+  uses \a combineFunction to merge the accumulators of the blocks.
+*/
@@ -96,6 +96,27 @@ namespace QtConcurrent {
                             ReduceFunction function,
                             QtConcurrent::ReduceOptions options = UnorderedReduce | SequentialReduce);
 
+    template <typename T>
+    T blockingMapReduce(const Sequence &sequence,
+                        MapFunction function,
+                        ReduceFunction function);
+    template <typename T>
+    T blockingMapReduce(const Sequence &sequence,
+                        MapFunction function,
+                        ReduceFunction function,
+                        CombineFunction function);
+    template <typename T>
+    T blockingMapReduce(ConstIterator begin,
+                        ConstIterator end,
+                        MapFunction function,
+                        ReduceFunction function);
+    template <typename T>
+    T blockingMapReduce(ConstIterator begin,
+                        ConstIterator end,
+                        MapFunction function,
+                        ReduceFunction function,
+                        CombineFunction function);
+
 } // namespace QtConcurrent
 
 #else
@@ -260,6 +281,54 @@ typename QtPrivate::ReduceResultType<ReduceFunctor>::ResultType blockingMappedRe
         .startBlocking();
 }
 
+// blockingMapReduce() for sequences
+template <typename ResultType, typename Sequence, typename MapFunctor, typename ReduceFunctor, typename CombineFunctor>
+ResultType blockingMapReduce(const Sequence &sequence,
+                             MapFunctor map,
+                             ReduceFunctor reduce,
+                             CombineFunctor combine)
+{
+    return QtConcurrent::startBlockMapReduce<ResultType>
+        (sequence.constBegin(), sequence.constEnd(),
+         QtPrivate::createFunctionWrapper(map),
+         QtPrivate::createFunctionWrapper(reduce),
+         QtPrivate::createFunctionWrapper(combine))
+        .startBlocking();
+}
+
+template <typename ResultType, typename Sequence, typename MapFunctor, typename ReduceFunctor>
+ResultType blockingMapReduce(const Sequence &sequence,
+                             MapFunctor map,
+                             ReduceFunctor reduce)
+{
+    return QtConcurrent::blockingMapReduce<ResultType>(sequence, map, reduce, reduce);
+}
+
+// blockingMapReduce() for iterator ranges
+template <typename ResultType, typename Iterator, typename MapFunctor, typename ReduceFunctor, typename CombineFunctor>
+ResultType blockingMapReduce(Iterator begin,
+                             Iterator end,
+                             MapFunctor map,
+                             ReduceFunctor reduce,
+                             CombineFunctor combine)
+{
+    return QtConcurrent::startBlockMapReduce<ResultType>
+        (begin, end,
+         QtPrivate::createFunctionWrapper(map),
+         QtPrivate::createFunctionWrapper(reduce),
+         QtPrivate::createFunctionWrapper(combine))
+        .startBlocking();
+}
+
+template <typename ResultType, typename Iterator, typename MapFunctor, typename ReduceFunctor>
+ResultType blockingMapReduce(Iterator begin,
+                             Iterator end,
+                             MapFunctor map,
+                             ReduceFunctor reduce)
+{
+    return QtConcurrent::blockingMapReduce<ResultType>(begin, end, map, reduce, reduce);
+}
+
 // mapped() for sequences with a different putput sequence type.
 template <typename OutputSequence, typename InputSequence, typename MapFunctor>
 OutputSequence blockingMapped(const InputSequence &sequence, MapFunctor map)
@@ -191,6 +191,74 @@ public:
     }
 };
 
+// map-reduce kernel used by blockingMapReduce(). The range is split up
+// into one contiguous block per thread up front, each block is reduced
+// into an accumulator of its own, and the accumulators are combined
+// pairwise once all blocks are done. Nothing is stored per item.
+template <typename ResultType, typename Iterator, typename MapFunctor, typename ReduceFunctor, typename CombineFunctor>
+class BlockMapReduceKernel : public ThreadEngine<ResultType>
+{
+    Iterator begin;
+    MapFunctor map;
+    ReduceFunctor reduce;
+    CombineFunctor combine;
+    const int count;
+    int blockCount;
+    QAtomicInt nextBlock;
+    QAtomicInt threadsToStart;
+    QVector<ResultType> accumulators;
+public:
+    typedef ResultType ReturnType;
+    BlockMapReduceKernel(Iterator _begin, Iterator _end, MapFunctor _map, ReduceFunctor _reduce, CombineFunctor _combine)
+        : begin(_begin), map(_map), reduce(_reduce), combine(_combine),
+          count(static_cast<int>(std::distance(_begin, _end))), blockCount(1)
+    { }
+
+    void start() override
+    {
+        blockCount = qBound(1, this->threadPool->maxThreadCount(), qMax(count, 1));
+        accumulators.resize(blockCount);
+        threadsToStart.store(blockCount - 1);
+    }
+
+    bool shouldStartThread() override
+    {
+        // the calling thread works on a block as well
+        return threadsToStart.fetchAndAddRelaxed(-1) > 0;
+    }
+
+    ThreadFunctionResult threadFunction() override
+    {
+        int block;
+        while ((block = nextBlock.fetchAndAddRelaxed(1)) < blockCount) {
+            const int first = int(qint64(count) * block / blockCount);
+            const int last = int(qint64(count) * (block + 1) / blockCount);
+
+            Iterator it = begin;
+            std::advance(it, first);
+            // reduce into a local to keep the threads off each other's cache lines
+            ResultType accumulator = ResultType();
+            for (int i = first; i < last; ++i, ++it)
+                reduce(accumulator, map(*it));
+            accumulators[block] = std::move(accumulator);
+        }
+        return ThreadFinished;
+    }
+
+    void finish() override
+    {
+        for (int step = 1; step < blockCount; step *= 2) {
+            for (int i = 0; i + step < blockCount; i += 2 * step)
+                combine(accumulators[i], accumulators.at(i + step));
+        }
+    }
+
+    ResultType *result() override
+    {
+        return &accumulators.first();
+    }
+};
+
 template <typename Iterator, typename Functor>
 inline ThreadEngineStarter<void> startMap(Iterator begin, Iterator end, Functor functor)
 {
@@ -257,6 +325,15 @@ inline ThreadEngineStarter<ResultType> startMappedReduced(Iterator begin, Iterat
     return startThreadEngine(new MappedReduceType(begin, end, mapFunctor, reduceFunctor, options));
 }
 
+template <typename ResultType, typename Iterator, typename MapFunctor, typename ReduceFunctor, typename CombineFunctor>
+inline ThreadEngineStarter<ResultType> startBlockMapReduce(Iterator begin, Iterator end,
+                                                           MapFunctor mapFunctor, ReduceFunctor reduceFunctor,
+                                                           CombineFunctor combineFunctor)
+{
+    typedef BlockMapReduceKernel<ResultType, Iterator, MapFunctor, ReduceFunctor, CombineFunctor> KernelType;
+    return startThreadEngine(new KernelType(begin, end, mapFunctor, reduceFunctor, combineFunctor));
+}
+
 } // namespace QtConcurrent
 
 #endif //Q_QDOC
@@ -232,6 +232,226 @@ static inline bool simdDecodeAscii(ushort *, const uchar *, const uchar *, const
 }
 #endif
 
+#if QT_COMPILER_SUPPORTS_HERE(AVX2) || (defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64))
+// Takes bit masks describing a window of WindowSize bytes (the two bits above the window in
+// cont describe the two bytes following it) and returns how many bytes at the start of the
+// window are made of complete, valid sequences of one to three bytes. The positions of the
+// first byte of each of those sequences are returned in starts.
+template <uint WindowSize>
+static Q_ALWAYS_INLINE uint simdUtf8ValidLength(quint64 lead2, quint64 lead3, quint64 cont, quint64 invalid,
+                                                quint64 &starts)
+{
+    const quint64 window = (Q_UINT64_C(1) << WindowSize) - 1;
+
+    // positions that must hold continuation bytes; the two bytes after the window only
+    // matter if a sequence starting in the window extends into them
+    const quint64 expected = (lead2 << 1) | (lead3 << 1) | (lead3 << 2);
+    const quint64 mismatch = ((cont ^ expected) & (window | expected)) | invalid;
+    const uint limit = mismatch ? qCountTrailingZeroBits(mismatch) : WindowSize + 2;
+
+    // everything before the first mismatch that is not a continuation starts a sequence
+    starts = ~expected & window & ((Q_UINT64_C(1) << limit) - 1);
+    if (!starts)
+        return 0;
+
+    // the last sequence may be cut short by the mismatch or the end of the window
+    const uint last = 63 - qCountLeadingZeroBits(starts);
+    const uint lastEnd = last + 1 + uint((lead2 >> last) & 1) + 2 * uint((lead3 >> last) & 1);
+    const uint length = lastEnd <= limit ? lastEnd : last;
+    starts &= (Q_UINT64_C(1) << length) - 1;
+    return length;
+}
+
+// Byte shuffles that move the 16-bit lanes selected by an 8-bit mask to the front
+struct QUtf8CompactTable
+{
+    uchar shuffle[256][16];
+
+    QUtf8CompactTable()
+    {
+        for (uint mask = 0; mask < 256; ++mask) {
+            uint out = 0;
+            for (uint lane = 0; lane < 8; ++lane) {
+                if (mask & (1u << lane)) {
+                    shuffle[mask][out++] = uchar(2 * lane);
+                    shuffle[mask][out++] = uchar(2 * lane + 1);
+                }
+            }
+            while (out < 16)
+                shuffle[mask][out++] = 0x80;
+        }
+    }
+};
+
+static const QUtf8CompactTable &utf8CompactTable()
+{
+    static const QUtf8CompactTable table;
+    return table;
+}
+#endif
+
+#if QT_COMPILER_SUPPORTS_HERE(AVX2)
+QT_FUNCTION_TARGET(AVX2)
+static Q_ALWAYS_INLINE __m256i simdDecodeMultibyteLanes(__m128i data0, __m128i data1, __m128i data2)
+{
+    // decode sixteen bytes as if every one of them started a sequence
+    const __m256i byte0 = _mm256_cvtepu8_epi16(data0);
+    const __m256i low6_1 = _mm256_and_si256(_mm256_cvtepu8_epi16(data1), _mm256_set1_epi16(0x3f));
+    const __m256i low6_2 = _mm256_and_si256(_mm256_cvtepu8_epi16(data2), _mm256_set1_epi16(0x3f));
+    const __m256i twoBytes = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(byte0, _mm256_set1_epi16(0x1f)), 6),
+                                             low6_1);
+    const __m256i threeBytes = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(byte0, 12),
+                                                               _mm256_slli_epi16(low6_1, 6)),
+                                               low6_2);
+    const __m256i isLead2 = _mm256_cmpeq_epi16(_mm256_and_si256(byte0, _mm256_set1_epi16(0xe0)),
+                                               _mm256_set1_epi16(0xc0));
+    const __m256i isLead3 = _mm256_cmpeq_epi16(_mm256_and_si256(byte0, _mm256_set1_epi16(0xf0)),
+                                               _mm256_set1_epi16(0xe0));
+    const __m256i decoded = _mm256_blendv_epi8(byte0, twoBytes, isLead2);
+    return _mm256_blendv_epi8(decoded, threeBytes, isLead3);
+}
+
+QT_FUNCTION_TARGET(AVX2)
+static Q_ALWAYS_INLINE void simdStoreCompacted(ushort *&dst, __m128i lanes, uint mask, const QUtf8CompactTable &table)
+{
+    _mm_storeu_si128((__m128i *)dst,
+                     _mm_shuffle_epi8(lanes, _mm_loadu_si128((const __m128i *)table.shuffle[mask])));
+    dst += qPopulationCount(mask);
+}
+
+QT_FUNCTION_TARGET(AVX2)
+static void simdDecodeMultibyteAvx2(ushort *&dst, const uchar *&src, const uchar *end)
+{
+    const QUtf8CompactTable &table = utf8CompactTable();
+
+    // 32 bytes at a time, but we need to look at the two bytes after those too
+    while (end - src >= 34) {
+        const __m256i data0 = _mm256_loadu_si256((const __m256i *)src);
+        const __m256i data1 = _mm256_loadu_si256((const __m256i *)(src + 1));
+        const __m256i data2 = _mm256_loadu_si256((const __m256i *)(src + 2));
+
+        // classify the bytes
+        const __m256i contBits = _mm256_set1_epi8(char(0xc0));
+        const __m256i contValue = _mm256_set1_epi8(char(0x80));
+        const quint64 cont = uint(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(data0, contBits), contValue)))
+                | (quint64(uint(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(data2, contBits), contValue)))) << 2);
+        const __m256i high4 = _mm256_and_si256(data0, _mm256_set1_epi8(char(0xf0)));
+        const __m256i isLead2 = _mm256_cmpeq_epi8(_mm256_and_si256(data0, _mm256_set1_epi8(char(0xe0))), contBits);
+        const __m256i isLead3 = _mm256_cmpeq_epi8(high4, _mm256_set1_epi8(char(0xe0)));
+
+        // C0 and C1 are overlong, F0 and up start four-byte sequences (left to the caller),
+        // E0 must be followed by A0 or more (overlong) and ED by less (surrogates)
+        const __m256i secondHigh = _mm256_cmpeq_epi8(_mm256_max_epu8(data1, _mm256_set1_epi8(char(0xa0))), data1);
+        __m256i invalid = _mm256_cmpeq_epi8(_mm256_and_si256(data0, _mm256_set1_epi8(char(0xfe))), contBits);
+        invalid = _mm256_or_si256(invalid, _mm256_cmpeq_epi8(high4, _mm256_set1_epi8(char(0xf0))));
+        invalid = _mm256_or_si256(invalid, _mm256_andnot_si256(secondHigh, _mm256_cmpeq_epi8(data0, _mm256_set1_epi8(char(0xe0)))));
+        invalid = _mm256_or_si256(invalid, _mm256_and_si256(secondHigh, _mm256_cmpeq_epi8(data0, _mm256_set1_epi8(char(0xed)))));
+
+        quint64 starts;
+        const uint length = simdUtf8ValidLength<32>(uint(_mm256_movemask_epi8(isLead2)),
+                                                    uint(_mm256_movemask_epi8(isLead3)),
+                                                    cont, uint(_mm256_movemask_epi8(invalid)), starts);
+        if (!length)
+            return;
+
+        // decode and keep the lanes that really start a sequence; we never write past the
+        // characters that the input consumed so far and the 34 bytes remaining could produce
+        const __m256i low = simdDecodeMultibyteLanes(_mm256_castsi256_si128(data0), _mm256_castsi256_si128(data1),
+                                                     _mm256_castsi256_si128(data2));
+        simdStoreCompacted(dst, _mm256_castsi256_si128(low), uint(starts) & 0xff, table);
+        simdStoreCompacted(dst, _mm256_extracti128_si256(low, 1), uint(starts >> 8) & 0xff, table);
+        if (length > 16) {
+            const __m256i high = simdDecodeMultibyteLanes(_mm256_extracti128_si256(data0, 1),
+                                                          _mm256_extracti128_si256(data1, 1),
+                                                          _mm256_extracti128_si256(data2, 1));
+            simdStoreCompacted(dst, _mm256_castsi256_si128(high), uint(starts >> 16) & 0xff, table);
+            simdStoreCompacted(dst, _mm256_extracti128_si256(high, 1), uint(starts >> 24), table);
+        }
+        src += length;
+    }
+}
+
+static inline void simdDecodeMultibyte(ushort *&dst, const uchar *&src, const uchar *end)
+{
+    if (qCpuHasFeature(AVX2))
+        simdDecodeMultibyteAvx2(dst, src, end);
+}
+#elif defined(__ARM_NEON__) && defined(Q_PROCESSOR_ARM_64)
+static inline uint neonMovemask(uint8x16_t v)
+{
+    const uint8x16_t bits = { 1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7,
+                              1, 1 << 1, 1 << 2, 1 << 3, 1 << 4, 1 << 5, 1 << 6, 1 << 7 };
+    const uint8x16_t masked = vandq_u8(v, bits);
+    return vaddv_u8(vget_low_u8(masked)) | (uint(vaddv_u8(vget_high_u8(masked))) << 8);
+}
+
+// NEON is always available on AArch64, so there is nothing to dispatch on at runtime
+static inline void simdDecodeMultibyte(ushort *&dst, const uchar *&src, const uchar *end)
+{
+    const QUtf8CompactTable &table = utf8CompactTable();
+
+    // sixteen bytes at a time, but we need to look at the two bytes after those too
+    while (end - src >= 18) {
+        const uint8x16_t data0 = vld1q_u8(src);
+        const uint8x16_t data1 = vld1q_u8(src + 1);
+        const uint8x16_t data2 = vld1q_u8(src + 2);
+
+        // classify the bytes
+        const uint8x16_t contBits = vdupq_n_u8(0xc0);
+        const uint8x16_t contValue = vdupq_n_u8(0x80);
+        const quint64 cont = neonMovemask(vceqq_u8(vandq_u8(data0, contBits), contValue))
+                | (quint64(neonMovemask(vceqq_u8(vandq_u8(data2, contBits), contValue))) << 2);
+        const uint8x16_t high4 = vandq_u8(data0, vdupq_n_u8(0xf0));
+        const uint8x16_t isLead2 = vceqq_u8(vandq_u8(data0, vdupq_n_u8(0xe0)), contBits);
+        const uint8x16_t isLead3 = vceqq_u8(high4, vdupq_n_u8(0xe0));
+
+        // C0 and C1 are overlong, F0 and up start four-byte sequences (left to the caller),
+        // E0 must be followed by A0 or more (overlong) and ED by less (surrogates)
+        const uint8x16_t secondHigh = vcgeq_u8(data1, vdupq_n_u8(0xa0));
+        uint8x16_t invalid = vceqq_u8(vandq_u8(data0, vdupq_n_u8(0xfe)), contBits);
+        invalid = vorrq_u8(invalid, vceqq_u8(high4, vdupq_n_u8(0xf0)));
+        invalid = vorrq_u8(invalid, vbicq_u8(vceqq_u8(data0, vdupq_n_u8(0xe0)), secondHigh));
+        invalid = vorrq_u8(invalid, vandq_u8(vceqq_u8(data0, vdupq_n_u8(0xed)), secondHigh));
+
+        quint64 starts;
+        const uint length = simdUtf8ValidLength<16>(neonMovemask(isLead2), neonMovemask(isLead3),
+                                                    cont, neonMovemask(invalid), starts);
+        if (!length)
+            return;
+
+        // decode as if every byte started a sequence, then keep the ones that really did;
+        // we never write past the 16 characters that the input consumed so far and the
+        // 18 bytes remaining could produce
+        for (int half = 0; half < 2; ++half) {
+            const uint8x8_t b0 = half ? vget_high_u8(data0) : vget_low_u8(data0);
+            const uint8x8_t b1 = half ? vget_high_u8(data1) : vget_low_u8(data1);
+            const uint8x8_t b2 = half ? vget_high_u8(data2) : vget_low_u8(data2);
+            const uint8x8_t l2 = half ? vget_high_u8(isLead2) : vget_low_u8(isLead2);
+            const uint8x8_t l3 = half ? vget_high_u8(isLead3) : vget_low_u8(isLead3);
+
+            const uint16x8_t byte0 = vmovl_u8(b0);
+            const uint16x8_t low6_1 = vmovl_u8(vand_u8(b1, vdup_n_u8(0x3f)));
+            const uint16x8_t low6_2 = vmovl_u8(vand_u8(b2, vdup_n_u8(0x3f)));
+            const uint16x8_t twoBytes = vorrq_u16(vshlq_n_u16(vandq_u16(byte0, vdupq_n_u16(0x1f)), 6), low6_1);
+            const uint16x8_t threeBytes = vorrq_u16(vorrq_u16(vshlq_n_u16(byte0, 12), vshlq_n_u16(low6_1, 6)),
+                                                    low6_2);
+            uint16x8_t decoded = vbslq_u16(vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(l2))), twoBytes, byte0);
+            decoded = vbslq_u16(vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(l3))), threeBytes, decoded);
+
+            const uint halfStarts = uint(starts >> (8 * half)) & 0xff;
+            const uint8x16_t compacted = vqtbl1q_u8(vreinterpretq_u8_u16(decoded), vld1q_u8(table.shuffle[halfStarts]));
+            vst1q_u16(dst, vreinterpretq_u16_u8(compacted));
+            dst += qPopulationCount(halfStarts);
+        }
+        src += length;
+    }
+}
+#else
+static inline void simdDecodeMultibyte(ushort *&, const uchar *&, const uchar *)
+{
+}
+#endif
+
 QByteArray QUtf8::convertFromUnicode(const QChar *uc, int len)
 {
     // create a QByteArray with the worst case scenario size
@@ -389,6 +609,11 @@ QChar *QUtf8::convertToUnicode(QChar *buffer, const char *chars, int len) Q_DECL
                 break;
 
             do {
+                // decode runs of valid multibyte sequences in SIMD, the rest one by one
+                simdDecodeMultibyte(dst, src, end);
+                if (src == end)
+                    break;
+
                 uchar b = *src++;
                 int res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(b, dst, src, end);
                 if (res < 0) {
@@ -478,6 +703,13 @@ QString QUtf8::convertToUnicode(const char *chars, int len, QTextCodec::Converte
         if (src >= nextAscii && simdDecodeAscii(dst, nextAscii, src, end))
             break;
 
+        // the BOM must go through the scalar code so that it gets eaten
+        if (headerdone) {
+            simdDecodeMultibyte(dst, src, end);
+            if (src == end)
+                break;
+        }
+
         ch = *src++;
         res = QUtf8Functions::fromUtf8<QUtf8BaseTraits>(ch, dst, src, end);
         if (!headerdone && res >= 0) {
@@ -25,6 +25,8 @@ HEADERS +=  \
         global/qrandom.h \
         global/qrandom_p.h \
         global/qhooks_p.h \
+        global/qtrace_p.h \
+        global/qtcore_tracepoints_p.h \
         global/qversiontagging.h
 
 SOURCES += \
@@ -37,7 +39,8 @@ SOURCES += \
         global/qoperatingsystemversion.cpp \
         global/qlogging.cpp \
         global/qrandom.cpp \
-        global/qhooks.cpp
+        global/qhooks.cpp \
+        global/qtcore_tracepoints.cpp
 
 VERSIONTAGGING_SOURCES = global/qversiontagging.cpp
 
@@ -113,3 +116,12 @@ qfloat16_tables.depends = $$QMAKE_QFLOAT16_TABLES
 qfloat16_tables.input = QMAKE_QFLOAT16_TABLES_GENERATE
 qfloat16_tables.variable_out = SOURCES
 QMAKE_EXTRA_COMPILERS += qfloat16_tables
+
+# Tracepoints are compiled out unless qmake is run with QT_TRACE_BACKEND=lttng
+# or QT_TRACE_BACKEND=etw, see qtrace_p.h
+equals(QT_TRACE_BACKEND, lttng) {
+    DEFINES += Q_TRACEPOINT QT_TRACE_BACKEND_LTTNG
+    LIBS_PRIVATE += -llttng-ust -ldl
+} else: equals(QT_TRACE_BACKEND, etw) {
+    DEFINES += Q_TRACEPOINT QT_TRACE_BACKEND_ETW
+}
@@ -53,6 +53,7 @@
 #include "qdatetime.h"
 #include "qcoreapplication.h"
 #include "qthread.h"
+#include "qwaitcondition.h"
 #include "private/qloggingregistry_p.h"
 #include "private/qcoreapplication_p.h"
 #include "private/qsimd_p.h"
@@ -1594,17 +1595,12 @@ static void android_default_message_handler(QtMsgType type,
 
 /*!
     \internal
+
+    Writes the formatted \a logMessage to the console or the system log.
 */
-static void qDefaultMessageHandler(QtMsgType type, const QMessageLogContext &context,
-                                   const QString &buf)
+static void qt_message_write(QtMsgType type, const QMessageLogContext &context,
+                             QString &logMessage)
 {
-    QString logMessage = qFormatLogMessage(type, context, buf);
-
-    // print nothing if message pattern didn't apply / was empty.
-    // (still print empty lines, e.g. because message itself was empty)
-    if (logMessage.isNull())
-        return;
-
     if (!qt_logging_to_console()) {
 #if defined(Q_OS_WIN)
         logMessage.append(QLatin1Char('\n'));
@@ -1629,6 +1625,165 @@ static void qDefaultMessageHandler(QtMsgType type, const QMessageLogContext &con
     fflush(stderr);
 }
 
+#if !defined(QT_BOOTSTRAPPED) && !defined(QT_NO_THREAD)
+namespace {
+struct QueuedLogMessage
+{
+    QueuedLogMessage *next;
+    QtMsgType type;
+    int line;
+    QByteArray file;
+    QByteArray function;
+    QByteArray category;
+    QString message;
+};
+
+/*
+    Writes the messages of the default message handler from a thread of its
+    own, if QT_LOGGING_ASYNC is set. Messages are still formatted in the
+    thread that logs them, so that the message pattern sees its context.
+    Logging threads push them onto a lock-free stack and only wake the writer
+    when the stack was empty. The writer takes the whole stack at once and
+    writes it in the original order.
+*/
+class QAsyncLogWriter : public QThread
+{
+public:
+    QAsyncLogWriter() : quit(false) { start(); }
+    ~QAsyncLogWriter();
+
+    void post(QtMsgType type, const QMessageLogContext &context, const QString &message);
+    void flush();
+
+protected:
+    void run() Q_DECL_OVERRIDE;
+
+private:
+    // beyond this, logging threads write the queue themselves
+    enum { MaxPending = 16384 };
+
+    QAtomicPointer<QueuedLogMessage> head;
+    QAtomicInt pending;
+    QMutex mutex;           // protects quit, used to wait for messages
+    QWaitCondition wake;
+    QMutex writeMutex;      // keeps the messages in order while written
+    bool quit;
+};
+
+QAsyncLogWriter::~QAsyncLogWriter()
+{
+    {
+        QMutexLocker locker(&mutex);
+        quit = true;
+        wake.wakeOne();
+    }
+    wait();
+    flush();
+}
+
+void QAsyncLogWriter::post(QtMsgType type, const QMessageLogContext &context,
+                           const QString &message)
+{
+    QueuedLogMessage *m = new QueuedLogMessage;
+    m->type = type;
+    m->line = context.line;
+    m->file = context.file;
+    m->function = context.function;
+    m->category = context.category;
+    m->message = message;
+
+    QueuedLogMessage *old = head.loadAcquire();
+    do {
+        m->next = old;
+    } while (!head.testAndSetOrdered(old, m, old));
+
+    if (pending.fetchAndAddRelaxed(1) >= MaxPending) {
+        flush();
+    } else if (!old) {
+        QMutexLocker locker(&mutex);
+        wake.wakeOne();
+    }
+}
+
+void QAsyncLogWriter::flush()
+{
+    QMutexLocker locker(&writeMutex);
+    QueuedLogMessage *list = head.fetchAndStoreAcquire(0);
+
+    // the stack holds the newest message first
+    QueuedLogMessage *ordered = 0;
+    while (list) {
+        QueuedLogMessage *next = list->next;
+        list->next = ordered;
+        ordered = list;
+        list = next;
+    }
+
+    while (ordered) {
+        QueuedLogMessage *m = ordered;
+        ordered = m->next;
+        QMessageLogContext context(m->file.constData(), m->line, m->function.constData(),
+                                   m->category.constData());
+        qt_message_write(m->type, context, m->message);
+        pending.fetchAndAddRelaxed(-1);
+        delete m;
+    }
+}
+
+void QAsyncLogWriter::run()
+{
+    for (;;) {
+        {
+            QMutexLocker locker(&mutex);
+            while (!head.loadAcquire() && !quit)
+                wake.wait(&mutex);
+            if (quit)
+                return;
+        }
+        flush();
+    }
+}
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(QAsyncLogWriter, asyncLogWriter)
+
+static bool qt_logging_async()
+{
+    static const bool async = checked_var_value("QT_LOGGING_ASYNC");
+    return async;
+}
+#endif
+
+/*!
+    \internal
+*/
+static void qDefaultMessageHandler(QtMsgType type, const QMessageLogContext &context,
+                                   const QString &buf)
+{
+    QString logMessage = qFormatLogMessage(type, context, buf);
+
+    // print nothing if message pattern didn't apply / was empty.
+    // (still print empty lines, e.g. because message itself was empty)
+    if (logMessage.isNull())
+        return;
+
+#if !defined(QT_BOOTSTRAPPED) && !defined(QT_NO_THREAD)
+    if (qt_logging_async()) {
+        // a fatal message is the last one, write it after the others at once
+        if (type != QtFatalMsg) {
+            if (QAsyncLogWriter *writer = asyncLogWriter()) {
+                writer->post(type, context, logMessage);
+                return;
+            }
+        } else if (asyncLogWriter.exists() && !asyncLogWriter.isDestroyed()) {
+            asyncLogWriter()->flush();
+        }
+    }
+#endif
+
+    qt_message_write(type, context, logMessage);
+}
+
 /*!
     \internal
 */
@@ -1713,6 +1868,12 @@ static void qt_message_fatal(QtMsgType, const QMessageLogContext &context, const
     Q_UNUSED(message);
 #endif
 
+#if !defined(QT_BOOTSTRAPPED) && !defined(QT_NO_THREAD)
+    // QT_FATAL_WARNINGS and QT_FATAL_CRITICALS make queued messages fatal
+    if (asyncLogWriter.exists() && !asyncLogWriter.isDestroyed())
+        asyncLogWriter()->flush();
+#endif
+
     std::abort();
 }
 
@@ -1803,6 +1964,12 @@ void qErrnoWarning(int code, const char *msg, ...)
     output under X11 or to the debugger under Windows. If it is a
     fatal message, the application aborts immediately.
 
+    If the \c QT_LOGGING_ASYNC environment variable is set to a non-zero
+    value, the default message handler formats the messages in the thread
+    that logs them, but writes them out from a thread of its own, in the
+    same order. Messages still queued when a fatal message is logged are
+    written before it; messages queued by a thread that crashes may be lost.
+
     Only one message handler can be defined, since this is usually
     done on an application-wide basis to control debug output.
 
@@ -479,6 +479,8 @@ public:
 
         WA_ContentsMarginsRespectsSafeArea = 130,
 
+        WA_CachedLayer = 131,
+
         // Add new attributes before this line
         WA_AttributeCount
     };
@@ -1261,7 +1263,8 @@ public:
         DirectConnection,
         QueuedConnection,
         BlockingQueuedConnection,
-        UniqueConnection =  0x80
+        UniqueConnection =  0x80,
+        CoalescedConnection = 0x100
     };
 
     enum ShortcutContext {
@@ -0,0 +1,525 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+// Tracepoints of the QtCore module, see qtrace_p.h. With the LTTng backend this
+// header is read several times by <lttng/tracepoint-event.h>, which is why
+// the event definitions are not covered by the include guard.
+
+#include <QtCore/private/qtrace_p.h>
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED) && defined(QT_TRACE_BACKEND_LTTNG)
+
+#undef TRACEPOINT_PROVIDER
+#define TRACEPOINT_PROVIDER qtcore
+
+#undef TRACEPOINT_INCLUDE
+#define TRACEPOINT_INCLUDE <QtCore/private/qtcore_tracepoints_p.h>
+
+#if !defined(QTCORE_TRACEPOINTS_P_H_LTTNG) || defined(TRACEPOINT_HEADER_MULTI_READ)
+#define QTCORE_TRACEPOINTS_P_H_LTTNG
+
+#include <lttng/tracepoint.h>
+
+TRACEPOINT_EVENT(qtcore, QCoreApplication_notify_entry,
+    TP_ARGS(const void *, receiver, const void *, event, int, type),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, receiver, reinterpret_cast<quintptr>(receiver))
+        ctf_integer_hex(quintptr, event, reinterpret_cast<quintptr>(event))
+        ctf_integer(int, type, type)
+    )
+)
+
+TRACEPOINT_EVENT(qtcore, QCoreApplication_notify_exit,
+    TP_ARGS(int, consumed),
+    TP_FIELDS(
+        ctf_integer(int, consumed, consumed)
+    )
+)
+
+TRACEPOINT_EVENT(qtcore, QCoreApplication_postEvent_entry,
+    TP_ARGS(const void *, receiver, const void *, event, int, type),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, receiver, reinterpret_cast<quintptr>(receiver))
+        ctf_integer_hex(quintptr, event, reinterpret_cast<quintptr>(event))
+        ctf_integer(int, type, type)
+    )
+)
+
+TRACEPOINT_EVENT(qtcore, QCoreApplication_postEvent_event_compressed,
+    TP_ARGS(const void *, receiver, const void *, event),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, receiver, reinterpret_cast<quintptr>(receiver))
+        ctf_integer_hex(quintptr, event, reinterpret_cast<quintptr>(event))
+    )
+)
+
+TRACEPOINT_EVENT(qtcore, QCoreApplication_postEvent_event_posted,
+    TP_ARGS(const void *, receiver, const void *, event, int, type, int, queueDepth),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, receiver, reinterpret_cast<quintptr>(receiver))
+        ctf_integer_hex(quintptr, event, reinterpret_cast<quintptr>(event))
+        ctf_integer(int, type, type)
+        ctf_integer(int, queueDepth, queueDepth)
+    )
+)
+
+TRACEPOINT_EVENT(qtcore, QCoreApplication_sendPostedEvents_entry,
+    TP_ARGS(const void *, receiver, int, eventType, int, queueDepth),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, receiver, reinterpret_cast<quintptr>(receiver))
+        ctf_integer(int, eventType, eventType)
+        ctf_integer(int, queueDepth, queueDepth)
+    )
+)
+
+TRACEPOINT_EVENT(qtcore, QCoreApplication_sendPostedEvents_exit,
+    TP_ARGS(const void *, receiver, int, eventType),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, receiver, reinterpret_cast<quintptr>(receiver))
+        ctf_integer(int, eventType, eventType)
+    )
+)
+
+TRACEPOINT_EVENT(qtcore, QThreadPoolPrivate_enqueueTask,
+    TP_ARGS(const void *, runnable, int, priority),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, runnable, reinterpret_cast<quintptr>(runnable))
+        ctf_integer(int, priority, priority)
+    )
+)
+
+TRACEPOINT_EVENT(qtcore, QRunnable_run_entry,
+    TP_ARGS(const void *, runnable),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, runnable, reinterpret_cast<quintptr>(runnable))
+    )
+)
+
+TRACEPOINT_EVENT(qtcore, QRunnable_run_exit,
+    TP_ARGS(const void *, runnable),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, runnable, reinterpret_cast<quintptr>(runnable))
+    )
+)
+
+#endif // !QTCORE_TRACEPOINTS_P_H_LTTNG || TRACEPOINT_HEADER_MULTI_READ
+
+#include <lttng/tracepoint-event.h>
+
+#endif // Q_TRACEPOINT && QT_TRACE_BACKEND_LTTNG
+
+#if !defined(QTCORE_TRACEPOINTS_P_H) && !defined(TRACEPOINT_HEADER_MULTI_READ)
+#define QTCORE_TRACEPOINTS_P_H
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED)
+
+#if defined(QT_TRACE_BACKEND_ETW)
+#include <QtCore/qt_windows.h>
+#include <TraceLoggingProvider.h>
+
+TRACELOGGING_DECLARE_PROVIDER(qtcore_provider);
+#endif
+
+QT_BEGIN_NAMESPACE
+
+class QEvent;
+class QObject;
+class QRunnable;
+
+namespace QtPrivate {
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QCoreApplication_notify_entry(QObject *receiver, QEvent *event, int type)
+{
+    tracepoint(qtcore, QCoreApplication_notify_entry, receiver, event, type);
+}
+
+inline void do_trace_QCoreApplication_notify_entry(QObject *receiver, QEvent *event, int type)
+{
+    do_tracepoint(qtcore, QCoreApplication_notify_entry, receiver, event, type);
+}
+
+inline bool trace_QCoreApplication_notify_entry_enabled()
+{
+    return tracepoint_enabled(qtcore, QCoreApplication_notify_entry);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QCoreApplication_notify_entry(QObject *receiver, QEvent *event, int type)
+{
+    TraceLoggingWrite(qtcore_provider, "QCoreApplication_notify_entry",
+                      TraceLoggingPointer(receiver, "receiver"),
+                      TraceLoggingPointer(event, "event"),
+                      TraceLoggingInt32(type, "type"));
+}
+
+inline void do_trace_QCoreApplication_notify_entry(QObject *receiver, QEvent *event, int type)
+{
+    trace_QCoreApplication_notify_entry(receiver, event, type);
+}
+
+inline bool trace_QCoreApplication_notify_entry_enabled()
+{
+    return TraceLoggingProviderEnabled(qtcore_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QCoreApplication_notify_exit(bool consumed)
+{
+    tracepoint(qtcore, QCoreApplication_notify_exit, consumed);
+}
+
+inline void do_trace_QCoreApplication_notify_exit(bool consumed)
+{
+    do_tracepoint(qtcore, QCoreApplication_notify_exit, consumed);
+}
+
+inline bool trace_QCoreApplication_notify_exit_enabled()
+{
+    return tracepoint_enabled(qtcore, QCoreApplication_notify_exit);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QCoreApplication_notify_exit(bool consumed)
+{
+    TraceLoggingWrite(qtcore_provider, "QCoreApplication_notify_exit",
+                      TraceLoggingBool(consumed, "consumed"));
+}
+
+inline void do_trace_QCoreApplication_notify_exit(bool consumed)
+{
+    trace_QCoreApplication_notify_exit(consumed);
+}
+
+inline bool trace_QCoreApplication_notify_exit_enabled()
+{
+    return TraceLoggingProviderEnabled(qtcore_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QCoreApplication_postEvent_entry(QObject *receiver, QEvent *event, int type)
+{
+    tracepoint(qtcore, QCoreApplication_postEvent_entry, receiver, event, type);
+}
+
+inline void do_trace_QCoreApplication_postEvent_entry(QObject *receiver, QEvent *event, int type)
+{
+    do_tracepoint(qtcore, QCoreApplication_postEvent_entry, receiver, event, type);
+}
+
+inline bool trace_QCoreApplication_postEvent_entry_enabled()
+{
+    return tracepoint_enabled(qtcore, QCoreApplication_postEvent_entry);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QCoreApplication_postEvent_entry(QObject *receiver, QEvent *event, int type)
+{
+    TraceLoggingWrite(qtcore_provider, "QCoreApplication_postEvent_entry",
+                      TraceLoggingPointer(receiver, "receiver"),
+                      TraceLoggingPointer(event, "event"),
+                      TraceLoggingInt32(type, "type"));
+}
+
+inline void do_trace_QCoreApplication_postEvent_entry(QObject *receiver, QEvent *event, int type)
+{
+    trace_QCoreApplication_postEvent_entry(receiver, event, type);
+}
+
+inline bool trace_QCoreApplication_postEvent_entry_enabled()
+{
+    return TraceLoggingProviderEnabled(qtcore_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QCoreApplication_postEvent_event_compressed(QObject *receiver, QEvent *event)
+{
+    tracepoint(qtcore, QCoreApplication_postEvent_event_compressed, receiver, event);
+}
+
+inline void do_trace_QCoreApplication_postEvent_event_compressed(QObject *receiver, QEvent *event)
+{
+    do_tracepoint(qtcore, QCoreApplication_postEvent_event_compressed, receiver, event);
+}
+
+inline bool trace_QCoreApplication_postEvent_event_compressed_enabled()
+{
+    return tracepoint_enabled(qtcore, QCoreApplication_postEvent_event_compressed);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QCoreApplication_postEvent_event_compressed(QObject *receiver, QEvent *event)
+{
+    TraceLoggingWrite(qtcore_provider, "QCoreApplication_postEvent_event_compressed",
+                      TraceLoggingPointer(receiver, "receiver"),
+                      TraceLoggingPointer(event, "event"));
+}
+
+inline void do_trace_QCoreApplication_postEvent_event_compressed(QObject *receiver, QEvent *event)
+{
+    trace_QCoreApplication_postEvent_event_compressed(receiver, event);
+}
+
+inline bool trace_QCoreApplication_postEvent_event_compressed_enabled()
+{
+    return TraceLoggingProviderEnabled(qtcore_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QCoreApplication_postEvent_event_posted(QObject *receiver, QEvent *event, int type, int queueDepth)
+{
+    tracepoint(qtcore, QCoreApplication_postEvent_event_posted, receiver, event, type, queueDepth);
+}
+
+inline void do_trace_QCoreApplication_postEvent_event_posted(QObject *receiver, QEvent *event, int type, int queueDepth)
+{
+    do_tracepoint(qtcore, QCoreApplication_postEvent_event_posted, receiver, event, type, queueDepth);
+}
+
+inline bool trace_QCoreApplication_postEvent_event_posted_enabled()
+{
+    return tracepoint_enabled(qtcore, QCoreApplication_postEvent_event_posted);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QCoreApplication_postEvent_event_posted(QObject *receiver, QEvent *event, int type, int queueDepth)
+{
+    TraceLoggingWrite(qtcore_provider, "QCoreApplication_postEvent_event_posted",
+                      TraceLoggingPointer(receiver, "receiver"),
+                      TraceLoggingPointer(event, "event"),
+                      TraceLoggingInt32(type, "type"),
+                      TraceLoggingInt32(queueDepth, "queueDepth"));
+}
+
+inline void do_trace_QCoreApplication_postEvent_event_posted(QObject *receiver, QEvent *event, int type, int queueDepth)
+{
+    trace_QCoreApplication_postEvent_event_posted(receiver, event, type, queueDepth);
+}
+
+inline bool trace_QCoreApplication_postEvent_event_posted_enabled()
+{
+    return TraceLoggingProviderEnabled(qtcore_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QCoreApplication_sendPostedEvents_entry(QObject *receiver, int eventType, int queueDepth)
+{
+    tracepoint(qtcore, QCoreApplication_sendPostedEvents_entry, receiver, eventType, queueDepth);
+}
+
+inline void do_trace_QCoreApplication_sendPostedEvents_entry(QObject *receiver, int eventType, int queueDepth)
+{
+    do_tracepoint(qtcore, QCoreApplication_sendPostedEvents_entry, receiver, eventType, queueDepth);
+}
+
+inline bool trace_QCoreApplication_sendPostedEvents_entry_enabled()
+{
+    return tracepoint_enabled(qtcore, QCoreApplication_sendPostedEvents_entry);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QCoreApplication_sendPostedEvents_entry(QObject *receiver, int eventType, int queueDepth)
+{
+    TraceLoggingWrite(qtcore_provider, "QCoreApplication_sendPostedEvents_entry",
+                      TraceLoggingPointer(receiver, "receiver"),
+                      TraceLoggingInt32(eventType, "eventType"),
+                      TraceLoggingInt32(queueDepth, "queueDepth"));
+}
+
+inline void do_trace_QCoreApplication_sendPostedEvents_entry(QObject *receiver, int eventType, int queueDepth)
+{
+    trace_QCoreApplication_sendPostedEvents_entry(receiver, eventType, queueDepth);
+}
+
+inline bool trace_QCoreApplication_sendPostedEvents_entry_enabled()
+{
+    return TraceLoggingProviderEnabled(qtcore_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QCoreApplication_sendPostedEvents_exit(QObject *receiver, int eventType)
+{
+    tracepoint(qtcore, QCoreApplication_sendPostedEvents_exit, receiver, eventType);
+}
+
+inline void do_trace_QCoreApplication_sendPostedEvents_exit(QObject *receiver, int eventType)
+{
+    do_tracepoint(qtcore, QCoreApplication_sendPostedEvents_exit, receiver, eventType);
+}
+
+inline bool trace_QCoreApplication_sendPostedEvents_exit_enabled()
+{
+    return tracepoint_enabled(qtcore, QCoreApplication_sendPostedEvents_exit);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QCoreApplication_sendPostedEvents_exit(QObject *receiver, int eventType)
+{
+    TraceLoggingWrite(qtcore_provider, "QCoreApplication_sendPostedEvents_exit",
+                      TraceLoggingPointer(receiver, "receiver"),
+                      TraceLoggingInt32(eventType, "eventType"));
+}
+
+inline void do_trace_QCoreApplication_sendPostedEvents_exit(QObject *receiver, int eventType)
+{
+    trace_QCoreApplication_sendPostedEvents_exit(receiver, eventType);
+}
+
+inline bool trace_QCoreApplication_sendPostedEvents_exit_enabled()
+{
+    return TraceLoggingProviderEnabled(qtcore_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QThreadPoolPrivate_enqueueTask(QRunnable *runnable, int priority)
+{
+    tracepoint(qtcore, QThreadPoolPrivate_enqueueTask, runnable, priority);
+}
+
+inline void do_trace_QThreadPoolPrivate_enqueueTask(QRunnable *runnable, int priority)
+{
+    do_tracepoint(qtcore, QThreadPoolPrivate_enqueueTask, runnable, priority);
+}
+
+inline bool trace_QThreadPoolPrivate_enqueueTask_enabled()
+{
+    return tracepoint_enabled(qtcore, QThreadPoolPrivate_enqueueTask);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QThreadPoolPrivate_enqueueTask(QRunnable *runnable, int priority)
+{
+    TraceLoggingWrite(qtcore_provider, "QThreadPoolPrivate_enqueueTask",
+                      TraceLoggingPointer(runnable, "runnable"),
+                      TraceLoggingInt32(priority, "priority"));
+}
+
+inline void do_trace_QThreadPoolPrivate_enqueueTask(QRunnable *runnable, int priority)
+{
+    trace_QThreadPoolPrivate_enqueueTask(runnable, priority);
+}
+
+inline bool trace_QThreadPoolPrivate_enqueueTask_enabled()
+{
+    return TraceLoggingProviderEnabled(qtcore_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QRunnable_run_entry(QRunnable *runnable)
+{
+    tracepoint(qtcore, QRunnable_run_entry, runnable);
+}
+
+inline void do_trace_QRunnable_run_entry(QRunnable *runnable)
+{
+    do_tracepoint(qtcore, QRunnable_run_entry, runnable);
+}
+
+inline bool trace_QRunnable_run_entry_enabled()
+{
+    return tracepoint_enabled(qtcore, QRunnable_run_entry);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QRunnable_run_entry(QRunnable *runnable)
+{
+    TraceLoggingWrite(qtcore_provider, "QRunnable_run_entry",
+                      TraceLoggingPointer(runnable, "runnable"));
+}
+
+inline void do_trace_QRunnable_run_entry(QRunnable *runnable)
+{
+    trace_QRunnable_run_entry(runnable);
+}
+
+inline bool trace_QRunnable_run_entry_enabled()
+{
+    return TraceLoggingProviderEnabled(qtcore_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QRunnable_run_exit(QRunnable *runnable)
+{
+    tracepoint(qtcore, QRunnable_run_exit, runnable);
+}
+
+inline void do_trace_QRunnable_run_exit(QRunnable *runnable)
+{
+    do_tracepoint(qtcore, QRunnable_run_exit, runnable);
+}
+
+inline bool trace_QRunnable_run_exit_enabled()
+{
+    return tracepoint_enabled(qtcore, QRunnable_run_exit);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QRunnable_run_exit(QRunnable *runnable)
+{
+    TraceLoggingWrite(qtcore_provider, "QRunnable_run_exit",
+                      TraceLoggingPointer(runnable, "runnable"));
+}
+
+inline void do_trace_QRunnable_run_exit(QRunnable *runnable)
+{
+    trace_QRunnable_run_exit(runnable);
+}
+
+inline bool trace_QRunnable_run_exit_enabled()
+{
+    return TraceLoggingProviderEnabled(qtcore_provider, 0, 0);
+}
+#endif
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
+
+#endif // Q_TRACEPOINT && !QT_BOOTSTRAPPED
+#endif // QTCORE_TRACEPOINTS_P_H
@@ -0,0 +1,111 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QTRACE_P_H
+#define QTRACE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+/*
+ * The Qt tracepoints API consists of only three macros:
+ *
+ *     - Q_TRACE(tracepoint, args...)
+ *       Fires 'tracepoint' if it is enabled.
+ *
+ *     - Q_UNCONDITIONAL_TRACE(tracepoint, args...)
+ *       Fires 'tracepoint' unconditionally: no check is performed.
+ *       This is useful for recording additional, costly data that is
+ *       only computed after checking Q_TRACE_ENABLED(tracepoint).
+ *
+ *     - Q_TRACE_ENABLED(tracepoint)
+ *       Returns 'true' if 'tracepoint' is enabled; false otherwise.
+ *
+ * The tracepoints themselves are declared per module in a hand-written
+ * provider header (for instance qtcore_tracepoints_p.h), which defines
+ * QtPrivate::trace_<tracepoint>(), QtPrivate::do_trace_<tracepoint>() and
+ * QtPrivate::trace_<tracepoint>_enabled() for the selected backend. One
+ * translation unit per module instantiates the probes.
+ *
+ * Tracing is compiled out unless Q_TRACEPOINT is defined: the macros then
+ * expand to nothing and their arguments are not evaluated. The backend is
+ * LTTng-UST (QT_TRACE_BACKEND_LTTNG, link against -llttng-ust -ldl) on Unix
+ * and Event Tracing for Windows through TraceLogging
+ * (QT_TRACE_BACKEND_ETW) on Windows, unless one of them is chosen
+ * explicitly.
+ *
+ * Tracepoint names follow the <Class>_<function>[_<what>] pattern, with
+ * _entry and _exit pairs bracketing the interesting region. Arguments
+ * should be cheap to compute, as they are evaluated whenever tracing is
+ * compiled in, even if nobody is listening.
+ */
+
+#include <QtCore/qglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED)
+#  if !defined(QT_TRACE_BACKEND_LTTNG) && !defined(QT_TRACE_BACKEND_ETW)
+#    if defined(Q_OS_WIN)
+#      define QT_TRACE_BACKEND_ETW
+#    else
+#      define QT_TRACE_BACKEND_LTTNG
+#    endif
+#  endif
+#  define Q_TRACE(x, ...) QtPrivate::trace_ ## x(__VA_ARGS__)
+#  define Q_UNCONDITIONAL_TRACE(x, ...) QtPrivate::do_trace_ ## x(__VA_ARGS__)
+#  define Q_TRACE_ENABLED(x) QtPrivate::trace_ ## x ## _enabled()
+#else
+#  define Q_TRACE(x, ...)
+#  define Q_UNCONDITIONAL_TRACE(x, ...)
+#  define Q_TRACE_ENABLED(x) false
+#endif // defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED)
+
+QT_END_NAMESPACE
+
+#endif // QTRACE_P_H
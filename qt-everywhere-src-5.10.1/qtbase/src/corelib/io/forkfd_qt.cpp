@@ -39,8 +39,12 @@
 
 // these might be defined via precompiled headers
 #include <QtCore/qatomic.h>
+#include <unistd.h>
 
-#define FORKFD_NO_SPAWNFD
+// spawnfd() cannot be used where forkfd() is backed by a system call
+#if !(_POSIX_SPAWN > 0) || (defined(__FreeBSD__) && __FreeBSD__ >= 9)
+#  define FORKFD_NO_SPAWNFD
+#endif
 
 #if defined(QT_NO_DEBUG) && !defined(NDEBUG)
 #  define NDEBUG
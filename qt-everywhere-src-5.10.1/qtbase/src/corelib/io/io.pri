@@ -2,7 +2,10 @@
 
 HEADERS +=  \
         io/qabstractfileengine_p.h \
+        io/qasyncfile.h \
         io/qbuffer.h \
+        io/qcompressiondevice.h \
+        io/qcompressiondevice_p.h \
         io/qdatastream.h \
         io/qdatastream_p.h \
         io/qdataurl_p.h \
@@ -56,7 +59,9 @@ HEADERS +=  \
 
 SOURCES += \
         io/qabstractfileengine.cpp \
+        io/qasyncfile.cpp \
         io/qbuffer.cpp \
+        io/qcompressiondevice.cpp \
         io/qdatastream.cpp \
         io/qdataurl.cpp \
         io/qtldurl.cpp \
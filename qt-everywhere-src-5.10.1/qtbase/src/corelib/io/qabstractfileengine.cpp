@@ -861,6 +861,25 @@ bool QAbstractFileEngine::unmap(uchar *address)
     return extension(UnMapExtension, &options);
 }
 
+/*!
+    \since 5.11
+
+    Tells the file system how the file will be accessed, see \a hints.
+    Returns \c true if the hints were passed on.
+
+    This function bases its behavior on calling extension() with
+    AccessPatternHintExtensionOption. If the engine does not support this
+    extension, false is returned.
+
+    \sa QFileDevice::setAccessPatternHints(), supportsExtension()
+ */
+bool QAbstractFileEngine::setAccessPatternHints(QFile::AccessPatternHints hints)
+{
+    AccessPatternHintExtensionOption option;
+    option.hints = hints;
+    return extension(AccessPatternHintExtension, &option);
+}
+
 /*!
     \since 5.10
 
@@ -1206,6 +1225,10 @@ qint64 QAbstractFileEngine::readLine(char *data, qint64 maxlen)
 
    \value UnMapExtension Whether the file engine provides the ability to
    unmap memory that was previously mapped.
+
+   \value AccessPatternHintExtension Whether the file engine can pass
+   QFileDevice::AccessPatternHints on to the operating system. This value
+   was introduced in Qt 5.11.
 */
 
 /*!
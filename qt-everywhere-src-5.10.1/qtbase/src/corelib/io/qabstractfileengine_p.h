@@ -154,6 +154,7 @@ public:
     bool atEnd() const;
     uchar *map(qint64 offset, qint64 size, QFile::MemoryMapFlags flags);
     bool unmap(uchar *ptr);
+    bool setAccessPatternHints(QFile::AccessPatternHints hints);
 
     typedef QAbstractFileEngineIterator Iterator;
     virtual Iterator *beginEntryList(QDir::Filters filters, const QStringList &filterNames);
@@ -170,7 +171,8 @@ public:
         AtEndExtension,
         FastReadLineExtension,
         MapExtension,
-        UnMapExtension
+        UnMapExtension,
+        AccessPatternHintExtension
     };
     class ExtensionOption
     {};
@@ -193,6 +195,11 @@ public:
         uchar *address;
     };
 
+    class AccessPatternHintExtensionOption : public ExtensionOption {
+    public:
+        QFile::AccessPatternHints hints;
+    };
+
     virtual bool extension(Extension extension, const ExtensionOption *option = 0, ExtensionReturn *output = 0);
     virtual bool supportsExtension(Extension extension) const;
 
@@ -0,0 +1,494 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qplatformdefs.h"
+#include "qasyncfile.h"
+
+#ifndef QT_NO_QFUTURE
+
+#include <QtCore/qfile.h>
+#include <QtCore/qfutureinterface.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qwaitcondition.h>
+#include <private/qbytearray_p.h>
+
+#ifdef Q_OS_UNIX
+#  include <private/qcore_unix_p.h>
+#  if defined(QT_USE_XOPEN_LFS_EXTENSIONS) && defined(QT_LARGEFILE_SUPPORT)
+#    define QT_PREAD ::pread64
+#    define QT_PWRITE ::pwrite64
+#  else
+#    define QT_PREAD ::pread
+#    define QT_PWRITE ::pwrite
+#  endif
+#endif
+
+QT_BEGIN_NAMESPACE
+
+class QAsyncFilePrivate
+{
+public:
+    QAsyncFilePrivate()
+        : threadPool(0), pending(0)
+#ifdef Q_OS_UNIX
+        , fd(-1)
+#endif
+    {}
+
+    QThreadPool *pool() const
+    { return threadPool ? threadPool : QThreadPool::globalInstance(); }
+
+    void operationStarted();
+    void operationFinished();
+
+    QByteArray readAt(qint64 offset, qint64 maxSize);
+    qint64 writeAt(qint64 offset, const QByteArray &data);
+
+    QFile file;
+    QThreadPool *threadPool;
+
+    mutable QMutex mutex;
+    QWaitCondition allDone;
+    int pending;
+#ifdef Q_OS_UNIX
+    int fd;
+#else
+    // the QFile is shared between the worker threads, which have to take
+    // turns with seeking and reading
+    QMutex ioMutex;
+#endif
+};
+
+void QAsyncFilePrivate::operationStarted()
+{
+    QMutexLocker locker(&mutex);
+    ++pending;
+}
+
+void QAsyncFilePrivate::operationFinished()
+{
+    QMutexLocker locker(&mutex);
+    if (--pending == 0)
+        allDone.wakeAll();
+}
+
+QByteArray QAsyncFilePrivate::readAt(qint64 offset, qint64 maxSize)
+{
+    QByteArray result;
+#ifdef Q_OS_UNIX
+    QT_STATBUF st;
+    if (QT_FSTAT(fd, &st) != 0 || offset >= st.st_size)
+        return result;
+    maxSize = qMin(maxSize, qint64(st.st_size) - offset);
+    maxSize = qMin(maxSize, qint64(MaxByteArraySize) - 1);
+    result.resize(int(maxSize));
+
+    qint64 done = 0;
+    while (done < maxSize) {
+        qint64 r;
+        EINTR_LOOP(r, QT_PREAD(fd, result.data() + done, size_t(maxSize - done),
+                               QT_OFF_T(offset + done)));
+        if (r <= 0)
+            break;
+        done += r;
+    }
+    result.resize(int(done));
+#else
+    QMutexLocker locker(&ioMutex);
+    if (file.seek(offset))
+        result = file.read(qMin(maxSize, qint64(MaxByteArraySize) - 1));
+#endif
+    return result;
+}
+
+qint64 QAsyncFilePrivate::writeAt(qint64 offset, const QByteArray &data)
+{
+#ifdef Q_OS_UNIX
+    const qint64 size = data.size();
+    qint64 done = 0;
+    while (done < size) {
+        qint64 r;
+        EINTR_LOOP(r, QT_PWRITE(fd, data.constData() + done, size_t(size - done),
+                                QT_OFF_T(offset + done)));
+        if (r < 0)
+            return done ? done : -1;
+        done += r;
+    }
+    return done;
+#else
+    QMutexLocker locker(&ioMutex);
+    if (!file.seek(offset))
+        return -1;
+    return file.write(data);
+#endif
+}
+
+namespace {
+class QAsyncFileReadTask : public QRunnable
+{
+public:
+    QAsyncFileReadTask(QAsyncFilePrivate *d, qint64 offset, qint64 maxSize)
+        : d(d), offset(offset), maxSize(maxSize)
+    { promise.reportStarted(); }
+
+    void run() Q_DECL_OVERRIDE
+    {
+        if (!promise.isCanceled()) {
+            const QByteArray result = d->readAt(offset, maxSize);
+            promise.reportFinished(&result);
+        } else {
+            promise.reportFinished();
+        }
+        d->operationFinished();
+    }
+
+    QFutureInterface<QByteArray> promise;
+
+private:
+    QAsyncFilePrivate *d;
+    qint64 offset;
+    qint64 maxSize;
+};
+
+class QAsyncFileWriteTask : public QRunnable
+{
+public:
+    QAsyncFileWriteTask(QAsyncFilePrivate *d, qint64 offset, const QByteArray &data)
+        : d(d), offset(offset), data(data)
+    { promise.reportStarted(); }
+
+    void run() Q_DECL_OVERRIDE
+    {
+        if (!promise.isCanceled()) {
+            const qint64 result = d->writeAt(offset, data);
+            promise.reportFinished(&result);
+        } else {
+            promise.reportFinished();
+        }
+        d->operationFinished();
+    }
+
+    QFutureInterface<qint64> promise;
+
+private:
+    QAsyncFilePrivate *d;
+    qint64 offset;
+    QByteArray data;
+};
+
+template <typename T>
+QFuture<T> finishedFuture(const T &result)
+{
+    QFutureInterface<T> promise(QFutureInterfaceBase::Started);
+    promise.reportFinished(&result);
+    return promise.future();
+}
+} // unnamed namespace
+
+/*!
+    \class QAsyncFile
+    \inmodule QtCore
+    \since 5.11
+    \reentrant
+    \ingroup io
+
+    \brief The QAsyncFile class reads and writes files without blocking
+    the calling thread.
+
+    QAsyncFile opens a file like QFile does, but read() and write() only
+    queue the operation and return a QFuture right away. The operations
+    are carried out by the threads of a QThreadPool, the global one unless
+    setThreadPool() was called, and the futures receive their results once
+    they are done. Use QFutureWatcher to be notified in the thread that
+    started the operation:
+
+    \snippet code/src_corelib_io_qasyncfile.cpp 0
+
+    Every operation names the position in the file it applies to, so
+    QAsyncFile has no current position. Operations that have been started
+    are not ordered with respect to each other: a read that overlaps a
+    write that has not finished yet may see either the old or the new
+    contents. On Unix, the operations use pread() and pwrite() and run
+    concurrently; on other platforms they take turns.
+
+    Cancelling a future returned by read() or write() prevents the
+    operation from being carried out if it has not started yet.
+
+    \sa QFile, QFutureWatcher, QThreadPool
+*/
+
+/*!
+    Constructs a QAsyncFile without a file name.
+*/
+QAsyncFile::QAsyncFile()
+    : d_ptr(new QAsyncFilePrivate)
+{
+}
+
+/*!
+    Constructs a QAsyncFile for the file \a name.
+*/
+QAsyncFile::QAsyncFile(const QString &name)
+    : d_ptr(new QAsyncFilePrivate)
+{
+    d_ptr->file.setFileName(name);
+}
+
+/*!
+    Destroys the QAsyncFile, waiting for the pending operations to finish
+    and closing the file.
+
+    \sa close()
+*/
+QAsyncFile::~QAsyncFile()
+{
+    close();
+}
+
+/*!
+    Returns the name of the file.
+
+    \sa setFileName()
+*/
+QString QAsyncFile::fileName() const
+{
+    Q_D(const QAsyncFile);
+    return d->file.fileName();
+}
+
+/*!
+    Sets the name of the file to \a name. Do not call this function while
+    the file is open.
+
+    \sa fileName(), QFile::setFileName()
+*/
+void QAsyncFile::setFileName(const QString &name)
+{
+    Q_D(QAsyncFile);
+    d->file.setFileName(name);
+}
+
+/*!
+    Makes the operations run in the threads of \a pool, which must outlive
+    the operations. Passing \nullptr selects QThreadPool::globalInstance(),
+    which is the default.
+
+    \sa threadPool()
+*/
+void QAsyncFile::setThreadPool(QThreadPool *pool)
+{
+    Q_D(QAsyncFile);
+    d->threadPool = pool;
+}
+
+/*!
+    Returns the thread pool the operations run in.
+
+    \sa setThreadPool()
+*/
+QThreadPool *QAsyncFile::threadPool() const
+{
+    Q_D(const QAsyncFile);
+    return d->pool();
+}
+
+/*!
+    Opens the file with the given \a mode, returning \c true on success.
+
+    The file is always opened unbuffered. QIODevice::Append and
+    QIODevice::Text are not supported, since every operation specifies its
+    own position and transfers the bytes unchanged.
+
+    \sa close(), error()
+*/
+bool QAsyncFile::open(QIODevice::OpenMode mode)
+{
+    Q_D(QAsyncFile);
+    if (d->file.isOpen()) {
+        qWarning("QAsyncFile::open: File (%s) already open", qPrintable(d->file.fileName()));
+        return false;
+    }
+    if (mode & (QIODevice::Append | QIODevice::Text)) {
+        qWarning("QAsyncFile::open: Append and Text modes are not supported");
+        return false;
+    }
+    if (!d->file.open(mode | QIODevice::Unbuffered))
+        return false;
+#ifdef Q_OS_UNIX
+    d->fd = d->file.handle();
+#endif
+    return true;
+}
+
+/*!
+    Returns \c true if the file is open.
+*/
+bool QAsyncFile::isOpen() const
+{
+    Q_D(const QAsyncFile);
+    return d->file.isOpen();
+}
+
+/*!
+    Returns the mode the file was opened with.
+*/
+QIODevice::OpenMode QAsyncFile::openMode() const
+{
+    Q_D(const QAsyncFile);
+    return d->file.openMode() & ~QIODevice::Unbuffered;
+}
+
+/*!
+    Waits for the pending operations to finish and closes the file.
+
+    \sa waitForPendingOperations()
+*/
+void QAsyncFile::close()
+{
+    Q_D(QAsyncFile);
+    if (!d->file.isOpen())
+        return;
+    waitForPendingOperations();
+    d->file.close();
+#ifdef Q_OS_UNIX
+    d->fd = -1;
+#endif
+}
+
+/*!
+    Returns the current size of the file.
+*/
+qint64 QAsyncFile::size() const
+{
+    Q_D(const QAsyncFile);
+#ifndef Q_OS_UNIX
+    QMutexLocker locker(&const_cast<QAsyncFilePrivate *>(d)->ioMutex);
+#endif
+    return d->file.size();
+}
+
+/*!
+    Returns the error of the last call to open().
+
+    Errors hit by the operations themselves are reported through their
+    results.
+*/
+QFileDevice::FileError QAsyncFile::error() const
+{
+    Q_D(const QAsyncFile);
+    return d->file.error();
+}
+
+/*!
+    Returns a human-readable description of the last error of open().
+*/
+QString QAsyncFile::errorString() const
+{
+    Q_D(const QAsyncFile);
+    return d->file.errorString();
+}
+
+/*!
+    Starts reading up to \a maxSize bytes at position \a offset, and returns
+    a future that receives the bytes read. Fewer bytes are returned when the
+    end of the file is reached, and an empty array is returned on error or
+    when the file is not open for reading.
+
+    \sa write()
+*/
+QFuture<QByteArray> QAsyncFile::read(qint64 offset, qint64 maxSize)
+{
+    Q_D(QAsyncFile);
+    if (!(d->file.openMode() & QIODevice::ReadOnly) || offset < 0 || maxSize <= 0)
+        return finishedFuture(QByteArray());
+
+    QAsyncFileReadTask *task = new QAsyncFileReadTask(d, offset, maxSize);
+    const QFuture<QByteArray> future = task->promise.future();
+    d->operationStarted();
+    d->pool()->start(task);
+    return future;
+}
+
+/*!
+    Starts writing \a data at position \a offset, and returns a future that
+    receives the number of bytes written, or -1 on error or when the file is
+    not open for writing.
+
+    \sa read()
+*/
+QFuture<qint64> QAsyncFile::write(qint64 offset, const QByteArray &data)
+{
+    Q_D(QAsyncFile);
+    if (!(d->file.openMode() & QIODevice::WriteOnly) || offset < 0)
+        return finishedFuture(qint64(-1));
+
+    QAsyncFileWriteTask *task = new QAsyncFileWriteTask(d, offset, data);
+    const QFuture<qint64> future = task->promise.future();
+    d->operationStarted();
+    d->pool()->start(task);
+    return future;
+}
+
+/*!
+    Returns the number of operations that have been started and have not
+    finished yet.
+*/
+int QAsyncFile::pendingOperations() const
+{
+    Q_D(const QAsyncFile);
+    QMutexLocker locker(&d->mutex);
+    return d->pending;
+}
+
+/*!
+    Blocks until all operations that have been started have finished.
+*/
+void QAsyncFile::waitForPendingOperations()
+{
+    Q_D(QAsyncFile);
+    QMutexLocker locker(&d->mutex);
+    while (d->pending)
+        d->allDone.wait(&d->mutex);
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_QFUTURE
@@ -0,0 +1,654 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qcompressiondevice.h"
+#include "qcompressiondevice_p.h"
+
+#ifndef QT_NO_COMPRESS
+
+#include <zlib.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    QZlibStream wraps a z_stream for callers that see their data in
+    chunks. process() consumes all of its input and appends whatever zlib
+    produced to the output array, so no data is held back between calls.
+*/
+
+QZlibStream::QZlibStream()
+    : strm(nullptr),
+      direction(Decompress),
+      format(QCompressionDevice::Zlib),
+      level(-1),
+      strategy(QCompressionDevice::DefaultStrategy),
+      finished(false),
+      triedRawDeflate(false)
+{
+}
+
+QZlibStream::~QZlibStream()
+{
+    end();
+}
+
+static int zlibWindowBits(QZlibStream::Direction direction, QCompressionDevice::Format format)
+{
+    switch (format) {
+    case QCompressionDevice::Gzip:
+        return MAX_WBITS + 16;
+    case QCompressionDevice::RawDeflate:
+        return -MAX_WBITS;
+    case QCompressionDevice::AutoDetect:
+        // "Add 32 to windowBits to enable zlib and gzip decoding with
+        // automatic header detection"; compression writes zlib.
+        if (direction == QZlibStream::Decompress)
+            return MAX_WBITS + 32;
+        break;
+    case QCompressionDevice::Zlib:
+        break;
+    }
+    return MAX_WBITS;
+}
+
+static int zlibStrategy(QCompressionDevice::Strategy strategy)
+{
+    switch (strategy) {
+    case QCompressionDevice::FilteredStrategy:
+        return Z_FILTERED;
+    case QCompressionDevice::HuffmanOnlyStrategy:
+        return Z_HUFFMAN_ONLY;
+    case QCompressionDevice::RunLengthStrategy:
+        return Z_RLE;
+    case QCompressionDevice::FixedStrategy:
+        return Z_FIXED;
+    case QCompressionDevice::DefaultStrategy:
+        break;
+    }
+    return Z_DEFAULT_STRATEGY;
+}
+
+/*
+    Starts a new stream, ending the current one if there is any. A \a level
+    outside 0 to 9 selects zlib's default compression level.
+*/
+bool QZlibStream::init(Direction direction, QCompressionDevice::Format format,
+                       int level, QCompressionDevice::Strategy strategy)
+{
+    end();
+    this->direction = direction;
+    this->format = format;
+    this->level = (level < 0 || level > 9) ? Z_DEFAULT_COMPRESSION : level;
+    this->strategy = strategy;
+    finished = false;
+    triedRawDeflate = false;
+    error.clear();
+    return initStream(zlibWindowBits(direction, format));
+}
+
+bool QZlibStream::initStream(int windowBits)
+{
+    strm = new z_stream;
+    strm->zalloc = Z_NULL;
+    strm->zfree = Z_NULL;
+    strm->opaque = Z_NULL;
+    strm->avail_in = 0;
+    strm->next_in = Z_NULL;
+    strm->msg = nullptr;
+
+    const int ret = direction == Compress
+            ? deflateInit2(strm, level, Z_DEFLATED, windowBits, 8, zlibStrategy(strategy))
+            : inflateInit2(strm, windowBits);
+    if (ret != Z_OK) {
+        setError(ret);
+        delete strm;
+        strm = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void QZlibStream::end()
+{
+    if (!strm)
+        return;
+    if (direction == Compress)
+        deflateEnd(strm);
+    else
+        inflateEnd(strm);
+    delete strm;
+    strm = nullptr;
+}
+
+bool QZlibStream::setError(int ret)
+{
+    if (strm && strm->msg)
+        error = QString::fromLatin1(strm->msg);
+    else if (ret == Z_NEED_DICT)
+        error = QStringLiteral("preset dictionary needed");
+    else
+        error = QString::fromLatin1(zError(ret));
+    return false;
+}
+
+/*
+    Feeds \a size bytes from \a data to the stream and appends the produced
+    bytes to \a out. When compressing, SyncFlush writes out all pending
+    output and Finish completes the stream; when decompressing, \a flush
+    has no effect and isFinished() tells whether the end of the stream was
+    seen. Once a decompressed stream has ended, further input is ignored.
+
+    For AutoDetect, data that has neither a zlib nor a gzip header is
+    decoded as raw deflate, as long as nothing was consumed before. Some
+    HTTP servers send "Content-Encoding: deflate" that way.
+*/
+bool QZlibStream::process(const char *data, int size, QByteArray *out, FlushMode flush)
+{
+    if (!strm) {
+        if (error.isEmpty())
+            error = QStringLiteral("stream not initialized");
+        return false;
+    }
+    if (finished)
+        return true;
+
+    // inflate() with Z_FINISH fails if the output does not fit in one go
+    int zflush = Z_NO_FLUSH;
+    if (flush == SyncFlush)
+        zflush = Z_SYNC_FLUSH;
+    else if (flush == Finish && direction == Compress)
+        zflush = Z_FINISH;
+
+    const bool atStart = strm->total_in == 0;
+    strm->next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+    strm->avail_in = uInt(size);
+
+    enum { MinimumOutputChunk = 4096, MaximumOutputChunk = 1024 * 1024 };
+    do {
+        // make a guess about the size of the output; inflating grows the data
+        const qint64 guess = direction == Decompress ? qint64(strm->avail_in) * 3 : qint64(strm->avail_in);
+        const int room = int(qBound<qint64>(MinimumOutputChunk, guess + 512, MaximumOutputChunk));
+        const int offset = out->size();
+        out->resize(offset + room);
+        strm->next_out = reinterpret_cast<Bytef *>(out->data() + offset);
+        strm->avail_out = uInt(room);
+
+        const int ret = direction == Compress ? deflate(strm, zflush) : inflate(strm, zflush);
+        out->resize(offset + room - int(strm->avail_out));
+
+        if (ret == Z_STREAM_END) {
+            finished = true;
+            return true;
+        }
+        if (ret == Z_DATA_ERROR && direction == Decompress && format == QCompressionDevice::AutoDetect
+                && atStart && !triedRawDeflate && strm->total_out == 0) {
+            triedRawDeflate = true;
+            inflateEnd(strm);
+            delete strm;
+            strm = nullptr;
+            if (!initStream(-MAX_WBITS))
+                return false;
+            strm->next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+            strm->avail_in = uInt(size);
+            continue;
+        }
+        if (ret == Z_BUF_ERROR) // no progress possible, wait for more input
+            break;
+        if (ret != Z_OK)
+            return setError(ret);
+    } while (strm->avail_in > 0 || strm->avail_out == 0);
+
+    return true;
+}
+
+/*!
+    \class QCompressionDevice
+    \inmodule QtCore
+    \since 5.11
+    \reentrant
+    \ingroup io
+
+    \brief The QCompressionDevice class compresses or decompresses data
+    written to or read from another QIODevice.
+
+    QCompressionDevice sits on top of an underlying device, set with
+    setDevice() or passed to the constructor. Opened with
+    QIODevice::WriteOnly, it compresses everything written to it and writes
+    the result to the underlying device. Opened with QIODevice::ReadOnly, it
+    reads compressed data from the underlying device and returns the
+    decompressed bytes. Both directions work in chunks of chunkSize()
+    bytes, so neither side has to be held in memory at once.
+
+    The stream format is selected with setFormat(): zlib, gzip or raw
+    deflate. When reading, AutoDetect accepts zlib and gzip streams, and
+    falls back to raw deflate if neither header is present. Compression
+    can be tuned with setCompressionLevel() and setStrategy().
+
+    \snippet code/src_corelib_io_qcompressiondevice.cpp 0
+
+    The underlying device must already be open in a matching mode, and
+    is neither opened nor closed by QCompressionDevice. close() writes the
+    end of the compressed stream; call flush() to write out pending data
+    without ending it, for example before waiting for a reply from a peer.
+
+    When reading from a sequential device such as a socket,
+    QCompressionDevice emits readyRead() whenever the underlying device
+    does. If the underlying device is random-access and runs out of data
+    before the end of the compressed stream, reading fails with an error.
+
+    Only one direction is supported at a time; QIODevice::ReadWrite is
+    rejected.
+
+    \sa qCompress(), qUncompress()
+*/
+
+/*!
+    \enum QCompressionDevice::Format
+
+    This enum describes the framing of the compressed stream.
+
+    \value Zlib The zlib format (RFC 1950), as used by qCompress() without
+           its length prefix and by HTTP "deflate" content encoding.
+    \value Gzip The gzip format (RFC 1952), as used by \c{.gz} files and
+           HTTP "gzip" content encoding.
+    \value RawDeflate Deflate data without header or checksum (RFC 1951),
+           as stored in ZIP archives.
+    \value AutoDetect When reading, accept zlib and gzip streams and fall
+           back to raw deflate. When writing, this is the same as Zlib.
+*/
+
+/*!
+    \enum QCompressionDevice::Strategy
+
+    This enum selects the zlib compression strategy.
+
+    \value DefaultStrategy Suitable for most data.
+    \value FilteredStrategy Favors Huffman coding over string matching; for
+           data produced by a filter, consisting of small values with a
+           somewhat random distribution.
+    \value HuffmanOnlyStrategy Huffman coding only, no string matching.
+    \value RunLengthStrategy Limits matches to runs of the same byte; almost
+           as fast as HuffmanOnlyStrategy, but compresses image data better.
+    \value FixedStrategy Uses fixed Huffman codes only, which keeps the
+           decoder simple.
+*/
+
+/*!
+    Constructs a QCompressionDevice with the given \a parent. Call
+    setDevice() before opening it.
+*/
+QCompressionDevice::QCompressionDevice(QObject *parent)
+    : QIODevice(*new QCompressionDevicePrivate, parent)
+{
+}
+
+/*!
+    Constructs a QCompressionDevice that operates on \a device in the given
+    \a format, with the given \a parent.
+*/
+QCompressionDevice::QCompressionDevice(QIODevice *device, Format format, QObject *parent)
+    : QIODevice(*new QCompressionDevicePrivate, parent)
+{
+    Q_D(QCompressionDevice);
+    d->device = device;
+    d->format = format;
+}
+
+/*!
+    Destroys the QCompressionDevice, closing it first. If it was open for
+    writing, this completes the compressed stream on the underlying device.
+*/
+QCompressionDevice::~QCompressionDevice()
+{
+    close();
+}
+
+/*!
+    Sets the underlying device to \a device. The device must not be changed
+    while the QCompressionDevice is open.
+
+    \sa device()
+*/
+void QCompressionDevice::setDevice(QIODevice *device)
+{
+    Q_D(QCompressionDevice);
+    if (isOpen()) {
+        qWarning("QCompressionDevice::setDevice: Cannot change the device while open");
+        return;
+    }
+    d->device = device;
+}
+
+/*!
+    Returns the underlying device, or \nullptr if none is set.
+
+    \sa setDevice()
+*/
+QIODevice *QCompressionDevice::device() const
+{
+    Q_D(const QCompressionDevice);
+    return d->device;
+}
+
+/*!
+    Sets the stream format to \a format. It takes effect the next time the
+    device is opened. The default is Zlib.
+
+    \sa format()
+*/
+void QCompressionDevice::setFormat(Format format)
+{
+    Q_D(QCompressionDevice);
+    d->format = format;
+}
+
+/*!
+    Returns the stream format.
+
+    \sa setFormat()
+*/
+QCompressionDevice::Format QCompressionDevice::format() const
+{
+    Q_D(const QCompressionDevice);
+    return d->format;
+}
+
+/*!
+    Sets the compression level to \a level, from 0 (store only) to 9 (best
+    compression). -1, the default, selects zlib's default level, currently 6.
+    It takes effect the next time the device is opened for writing.
+
+    \sa compressionLevel()
+*/
+void QCompressionDevice::setCompressionLevel(int level)
+{
+    Q_D(QCompressionDevice);
+    d->level = qBound(-1, level, 9);
+}
+
+/*!
+    Returns the compression level.
+
+    \sa setCompressionLevel()
+*/
+int QCompressionDevice::compressionLevel() const
+{
+    Q_D(const QCompressionDevice);
+    return d->level;
+}
+
+/*!
+    Sets the compression strategy to \a strategy. It takes effect the next
+    time the device is opened for writing.
+
+    \sa strategy()
+*/
+void QCompressionDevice::setStrategy(Strategy strategy)
+{
+    Q_D(QCompressionDevice);
+    d->strategy = strategy;
+}
+
+/*!
+    Returns the compression strategy.
+
+    \sa setStrategy()
+*/
+QCompressionDevice::Strategy QCompressionDevice::strategy() const
+{
+    Q_D(const QCompressionDevice);
+    return d->strategy;
+}
+
+/*!
+    Sets the number of bytes read from the underlying device, or handed to
+    zlib, in one go to \a size. The default is 64 KB.
+
+    \sa chunkSize()
+*/
+void QCompressionDevice::setChunkSize(int size)
+{
+    Q_D(QCompressionDevice);
+    d->chunkSize = qMax(1, size);
+}
+
+/*!
+    Returns the chunk size.
+
+    \sa setChunkSize()
+*/
+int QCompressionDevice::chunkSize() const
+{
+    Q_D(const QCompressionDevice);
+    return d->chunkSize;
+}
+
+/*!
+    \reimp
+
+    Opens the device for decompressing if \a mode is QIODevice::ReadOnly,
+    or for compressing if it is QIODevice::WriteOnly. The underlying device
+    must be open in the same direction.
+*/
+bool QCompressionDevice::open(OpenMode mode)
+{
+    Q_D(QCompressionDevice);
+    if (isOpen()) {
+        qWarning("QCompressionDevice::open: Device already open");
+        return false;
+    }
+    const OpenMode direction = mode & ReadWrite;
+    if (direction == ReadWrite || direction == NotOpen) {
+        qWarning("QCompressionDevice::open: Open mode must be either ReadOnly or WriteOnly");
+        return false;
+    }
+    if (!d->device || !(d->device->openMode() & direction)) {
+        setErrorString(direction == ReadOnly ? tr("Underlying device is not open for reading")
+                                             : tr("Underlying device is not open for writing"));
+        return false;
+    }
+
+    const bool compress = (direction == WriteOnly);
+    if (!d->stream.init(compress ? QZlibStream::Compress : QZlibStream::Decompress,
+                        d->format, d->level, d->strategy)) {
+        setErrorString(d->stream.errorString());
+        return false;
+    }
+    d->output.clear();
+    d->outputPos = 0;
+
+    if (!compress && d->device->isSequential())
+        connect(d->device.data(), &QIODevice::readyRead, this, &QIODevice::readyRead);
+
+    return QIODevice::open(mode & ~(Append | Truncate));
+}
+
+/*!
+    \reimp
+
+    If the device was open for writing, this completes the compressed stream
+    on the underlying device. The underlying device stays open.
+*/
+void QCompressionDevice::close()
+{
+    Q_D(QCompressionDevice);
+    if (!isOpen())
+        return;
+
+    if ((openMode() & WriteOnly) && d->stream.isActive() && !d->stream.isFinished()) {
+        if (!d->stream.process(nullptr, 0, &d->output, QZlibStream::Finish))
+            setErrorString(d->stream.errorString());
+        else
+            d->writeOutput();
+    }
+    if (d->device)
+        disconnect(d->device.data(), &QIODevice::readyRead, this, &QIODevice::readyRead);
+    d->stream.end();
+    d->output.clear();
+    d->outputPos = 0;
+    QIODevice::close();
+}
+
+/*!
+    \reimp
+
+    Always returns \c true; compressed streams can not be seeked.
+*/
+bool QCompressionDevice::isSequential() const
+{
+    return true;
+}
+
+/*!
+    \reimp
+
+    When reading, returns \c true once the end of the compressed stream has
+    been reached and all of its data was read.
+*/
+bool QCompressionDevice::atEnd() const
+{
+    Q_D(const QCompressionDevice);
+    if (!isOpen())
+        return true;
+    if (!QIODevice::atEnd() || d->outputPos < d->output.size())
+        return false;
+    return !(openMode() & ReadOnly) || d->stream.isFinished();
+}
+
+/*!
+    \reimp
+*/
+qint64 QCompressionDevice::bytesAvailable() const
+{
+    Q_D(const QCompressionDevice);
+    return QIODevice::bytesAvailable() + (d->output.size() - d->outputPos);
+}
+
+/*!
+    Compresses all data written so far and writes it to the underlying
+    device, without ending the stream. The reading side can then decompress
+    everything up to this point. Flushing often makes the compression worse.
+
+    Returns \c true on success. Does nothing and returns \c false if the
+    device is not open for writing.
+*/
+bool QCompressionDevice::flush()
+{
+    Q_D(QCompressionDevice);
+    if (!(openMode() & WriteOnly))
+        return false;
+    if (!d->stream.process(nullptr, 0, &d->output, QZlibStream::SyncFlush)) {
+        setErrorString(d->stream.errorString());
+        return false;
+    }
+    return d->writeOutput();
+}
+
+/*!
+    \reimp
+*/
+qint64 QCompressionDevice::readData(char *data, qint64 maxSize)
+{
+    Q_D(QCompressionDevice);
+    while (d->outputPos == d->output.size()) {
+        if (d->stream.isFinished() || !d->device)
+            return -1;
+
+        const QByteArray chunk = d->device->read(d->chunkSize);
+        if (chunk.isEmpty()) {
+            // a sequential device may just not have received more data yet
+            if (d->device->isSequential() && d->device->isOpen())
+                return 0;
+            setErrorString(tr("Unexpected end of compressed data"));
+            return -1;
+        }
+
+        d->output.clear();
+        d->outputPos = 0;
+        if (!d->stream.process(chunk.constData(), chunk.size(), &d->output)) {
+            setErrorString(d->stream.errorString());
+            return -1;
+        }
+    }
+
+    const int size = int(qMin<qint64>(maxSize, d->output.size() - d->outputPos));
+    memcpy(data, d->output.constData() + d->outputPos, size);
+    d->outputPos += size;
+    return size;
+}
+
+/*!
+    \reimp
+*/
+qint64 QCompressionDevice::writeData(const char *data, qint64 maxSize)
+{
+    Q_D(QCompressionDevice);
+    qint64 written = 0;
+    while (written < maxSize) {
+        const int size = int(qMin<qint64>(maxSize - written, d->chunkSize));
+        if (!d->stream.process(data + written, size, &d->output)) {
+            setErrorString(d->stream.errorString());
+            return -1;
+        }
+        if (!d->writeOutput())
+            return written ? written : -1;
+        written += size;
+    }
+    return written;
+}
+
+bool QCompressionDevicePrivate::writeOutput()
+{
+    if (output.isEmpty())
+        return true;
+    if (!device || device->write(output) != output.size()) {
+        errorString = QCompressionDevice::tr("Could not write to the underlying device: %1")
+                .arg(device ? device->errorString() : QString());
+        output.clear();
+        return false;
+    }
+    output.clear();
+    return true;
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_COMPRESS
+
+#include "moc_qcompressiondevice.cpp"
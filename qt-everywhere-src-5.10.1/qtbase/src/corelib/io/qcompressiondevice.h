@@ -0,0 +1,113 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QCOMPRESSIONDEVICE_H
+#define QCOMPRESSIONDEVICE_H
+
+#include <QtCore/qiodevice.h>
+
+#ifndef QT_NO_COMPRESS
+
+QT_BEGIN_NAMESPACE
+
+class QCompressionDevicePrivate;
+
+class Q_CORE_EXPORT QCompressionDevice : public QIODevice
+{
+    Q_OBJECT
+
+public:
+    enum Format {
+        Zlib,
+        Gzip,
+        RawDeflate,
+        AutoDetect
+    };
+    Q_ENUM(Format)
+
+    enum Strategy {
+        DefaultStrategy,
+        FilteredStrategy,
+        HuffmanOnlyStrategy,
+        RunLengthStrategy,
+        FixedStrategy
+    };
+    Q_ENUM(Strategy)
+
+    explicit QCompressionDevice(QObject *parent = Q_NULLPTR);
+    explicit QCompressionDevice(QIODevice *device, Format format = Zlib, QObject *parent = Q_NULLPTR);
+    ~QCompressionDevice();
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+
+    void setFormat(Format format);
+    Format format() const;
+
+    void setCompressionLevel(int level);
+    int compressionLevel() const;
+
+    void setStrategy(Strategy strategy);
+    Strategy strategy() const;
+
+    void setChunkSize(int size);
+    int chunkSize() const;
+
+    bool open(OpenMode mode) Q_DECL_OVERRIDE;
+    void close() Q_DECL_OVERRIDE;
+    bool isSequential() const Q_DECL_OVERRIDE;
+    bool atEnd() const Q_DECL_OVERRIDE;
+    qint64 bytesAvailable() const Q_DECL_OVERRIDE;
+
+    bool flush();
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) Q_DECL_OVERRIDE;
+    qint64 writeData(const char *data, qint64 maxSize) Q_DECL_OVERRIDE;
+
+private:
+    Q_DECLARE_PRIVATE(QCompressionDevice)
+    Q_DISABLE_COPY(QCompressionDevice)
+};
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_COMPRESS
+
+#endif // QCOMPRESSIONDEVICE_H
@@ -0,0 +1,141 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QCOMPRESSIONDEVICE_P_H
+#define QCOMPRESSIONDEVICE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include "qcompressiondevice.h"
+#include "private/qiodevice_p.h"
+#include <QtCore/qpointer.h>
+
+#ifndef QT_NO_COMPRESS
+
+struct z_stream_s;
+
+QT_BEGIN_NAMESPACE
+
+// Incremental zlib (de)compression, shared by QCompressionDevice and the
+// modules that decode or encode deflate data chunk by chunk.
+class Q_CORE_EXPORT QZlibStream
+{
+public:
+    enum Direction {
+        Compress,
+        Decompress
+    };
+
+    enum FlushMode {
+        NoFlush,
+        SyncFlush,
+        Finish
+    };
+
+    QZlibStream();
+    ~QZlibStream();
+
+    bool init(Direction direction, QCompressionDevice::Format format,
+              int level = -1, QCompressionDevice::Strategy strategy = QCompressionDevice::DefaultStrategy);
+    void end();
+
+    bool isActive() const { return strm != nullptr; }
+    bool isFinished() const { return finished; }
+    QString errorString() const { return error; }
+
+    bool process(const char *data, int size, QByteArray *out, FlushMode flush = NoFlush);
+
+private:
+    bool initStream(int windowBits);
+    bool setError(int ret);
+
+    z_stream_s *strm;
+    Direction direction;
+    QCompressionDevice::Format format;
+    int level;
+    QCompressionDevice::Strategy strategy;
+    bool finished;
+    bool triedRawDeflate;
+    QString error;
+
+    Q_DISABLE_COPY(QZlibStream)
+};
+
+class QCompressionDevicePrivate : public QIODevicePrivate
+{
+    Q_DECLARE_PUBLIC(QCompressionDevice)
+
+public:
+    QCompressionDevicePrivate()
+        : format(QCompressionDevice::Zlib),
+          level(-1),
+          strategy(QCompressionDevice::DefaultStrategy),
+          chunkSize(DefaultChunkSize),
+          outputPos(0)
+    {}
+
+    enum { DefaultChunkSize = 64 * 1024 };
+
+    bool writeOutput();
+
+    QPointer<QIODevice> device;
+    QCompressionDevice::Format format;
+    int level;
+    QCompressionDevice::Strategy strategy;
+    int chunkSize;
+
+    QZlibStream stream;
+    QByteArray output;
+    int outputPos;
+};
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_COMPRESS
+
+#endif // QCOMPRESSIONDEVICE_P_H
@@ -48,6 +48,7 @@
 #include <ctype.h>
 #include <stdlib.h>
 #include "qendian.h"
+#include <private/qsimd_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -771,6 +772,110 @@ int QDataStream::readBlock(char *data, int len)
     return readResult;
 }
 
+template <typename T>
+static void bswapElements(uchar *data, qsizetype count)
+{
+    for (qsizetype i = 0; i < count; ++i, data += sizeof(T))
+        qbswap<T>(qFromUnaligned<T>(data), data);
+}
+
+#if QT_COMPILER_SUPPORTS_HERE(SSSE3)
+// swaps the bytes of all elements in whole 16-byte blocks, returns the
+// number of bytes done
+QT_FUNCTION_TARGET(SSSE3)
+static qsizetype bswapBlocks_ssse3(uchar *data, qsizetype len, int elementSize)
+{
+    const __m128i mask = elementSize == 2
+            ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+            : elementSize == 4
+              ? _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+              : _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+    qsizetype i = 0;
+    for ( ; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(data + i), _mm_shuffle_epi8(v, mask));
+    }
+    return i;
+}
+#endif
+
+/*
+    Swaps the byte order of \a count elements of \a elementSize bytes each,
+    stored at \a data.
+*/
+static void bswapArray(void *data, qsizetype count, int elementSize)
+{
+    uchar *p = static_cast<uchar *>(data);
+    qsizetype len = count * elementSize;
+#if QT_COMPILER_SUPPORTS_HERE(SSSE3)
+    if (qCpuHasFeature(SSSE3)) {
+        const qsizetype done = bswapBlocks_ssse3(p, len, elementSize);
+        p += done;
+        len -= done;
+    }
+#endif
+    switch (elementSize) {
+    case 2:
+        bswapElements<quint16>(p, len / 2);
+        break;
+    case 4:
+        bswapElements<quint32>(p, len / 4);
+        break;
+    case 8:
+        bswapElements<quint64>(p, len / 8);
+        break;
+    }
+}
+
+/*!
+    \internal
+
+    Reads \a count elements of \a elementSize bytes each into \a data in one
+    go, swapping their byte order if needed. Returns \c true on success.
+*/
+bool QDataStream::readArray(void *data, int count, int elementSize)
+{
+    CHECK_STREAM_PRECOND(false)
+    const int len = count * elementSize;
+    if (readBlock(static_cast<char *>(data), len) != len)
+        return false;
+    if (!noswap && elementSize > 1)
+        bswapArray(data, count, elementSize);
+    return true;
+}
+
+/*!
+    \internal
+
+    Writes \a count elements of \a elementSize bytes each from \a data,
+    swapping their byte order if needed.
+*/
+void QDataStream::writeArray(const void *data, int count, int elementSize)
+{
+    CHECK_STREAM_WRITE_PRECOND(Q_VOID)
+    const char *p = static_cast<const char *>(data);
+    qint64 len = qint64(count) * elementSize;
+    if (noswap || elementSize == 1) {
+        if (dev->write(p, len) != len)
+            q_status = WriteFailed;
+        return;
+    }
+
+    // swap a copy of the data, a block at a time
+    char buffer[4096];
+    while (len > 0) {
+        const int chunk = int(qMin(len, qint64(sizeof buffer)));
+        memcpy(buffer, p, chunk);
+        bswapArray(buffer, chunk / elementSize, elementSize);
+        if (dev->write(buffer, chunk) != chunk) {
+            q_status = WriteFailed;
+            return;
+        }
+        p += chunk;
+        len -= chunk;
+    }
+}
+
 /*!
     \fn QDataStream &QDataStream::operator>>(std::nullptr &ptr)
     \since 5.9
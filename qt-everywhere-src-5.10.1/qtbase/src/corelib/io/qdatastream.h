@@ -65,6 +65,7 @@ template <class Key, class T> class QMap;
 class QDataStreamPrivate;
 namespace QtPrivate {
 class StreamStateSaver;
+struct ArrayStreamer;
 }
 class Q_CORE_EXPORT QDataStream
 {
@@ -202,7 +203,10 @@ private:
     Status q_status;
 
     int readBlock(char *data, int len);
+    bool readArray(void *data, int count, int elementSize);
+    void writeArray(const void *data, int count, int elementSize);
     friend class QtPrivate::StreamStateSaver;
+    friend struct QtPrivate::ArrayStreamer;
 };
 
 namespace QtPrivate {
@@ -303,6 +307,93 @@ QDataStream &writeSequentialContainer(QDataStream &s, const Container &c)
     return s;
 }
 
+// Types whose vectors are streamed as one block of memory, byte swapped
+// in place as a whole when needed
+template <typename T> struct IsArrayStreamable
+{
+    enum { Value = false };
+    static bool canStream(const QDataStream &) { return false; }
+};
+
+#define QT_DECLARE_ARRAY_STREAMABLE(T, CONDITION) \
+    template <> struct IsArrayStreamable<T> \
+    { \
+        enum { Value = true }; \
+        static bool canStream(const QDataStream &s) { Q_UNUSED(s); return CONDITION; } \
+    };
+QT_DECLARE_ARRAY_STREAMABLE(qint8, true)
+QT_DECLARE_ARRAY_STREAMABLE(quint8, true)
+QT_DECLARE_ARRAY_STREAMABLE(qint16, true)
+QT_DECLARE_ARRAY_STREAMABLE(quint16, true)
+QT_DECLARE_ARRAY_STREAMABLE(qint32, true)
+QT_DECLARE_ARRAY_STREAMABLE(quint32, true)
+// before Qt 3.3, 64-bit integers were streamed one half at a time
+QT_DECLARE_ARRAY_STREAMABLE(qint64, s.version() >= QDataStream::Qt_3_3)
+QT_DECLARE_ARRAY_STREAMABLE(quint64, s.version() >= QDataStream::Qt_3_3)
+QT_DECLARE_ARRAY_STREAMABLE(float, s.version() < QDataStream::Qt_4_6
+                                   || s.floatingPointPrecision() == QDataStream::SinglePrecision)
+QT_DECLARE_ARRAY_STREAMABLE(double, s.version() < QDataStream::Qt_4_6
+                                    || s.floatingPointPrecision() == QDataStream::DoublePrecision)
+#undef QT_DECLARE_ARRAY_STREAMABLE
+
+struct ArrayStreamer
+{
+    template <typename T>
+    static QDataStream &read(QDataStream &s, QVector<T> &v)
+    {
+        if (!IsArrayStreamable<T>::canStream(s))
+            return readArrayBasedContainer(s, v);
+
+        StreamStateSaver stateSaver(&s);
+
+        v.clear();
+        quint32 n;
+        s >> n;
+        // grow the vector as the data arrives, so that a corrupt
+        // count does not cause a huge allocation up front
+        const quint32 step = (1024 * 1024) / sizeof(T);
+        quint32 done = 0;
+        while (done < n) {
+            const int chunk = int(qMin(step, n - done));
+            v.resize(int(done) + chunk);
+            if (!s.readArray(v.data() + done, chunk, int(sizeof(T)))) {
+                v.clear();
+                break;
+            }
+            done += chunk;
+        }
+
+        return s;
+    }
+
+    template <typename T>
+    static QDataStream &write(QDataStream &s, const QVector<T> &v)
+    {
+        if (!IsArrayStreamable<T>::canStream(s))
+            return writeSequentialContainer(s, v);
+
+        s << quint32(v.size());
+        s.writeArray(v.constData(), v.size(), int(sizeof(T)));
+        return s;
+    }
+};
+
+template <typename T>
+QDataStream &readVector(QDataStream &s, QVector<T> &v, std::true_type)
+{ return ArrayStreamer::read(s, v); }
+
+template <typename T>
+QDataStream &readVector(QDataStream &s, QVector<T> &v, std::false_type)
+{ return readArrayBasedContainer(s, v); }
+
+template <typename T>
+QDataStream &writeVector(QDataStream &s, const QVector<T> &v, std::true_type)
+{ return ArrayStreamer::write(s, v); }
+
+template <typename T>
+QDataStream &writeVector(QDataStream &s, const QVector<T> &v, std::false_type)
+{ return writeSequentialContainer(s, v); }
+
 template <typename Container>
 QDataStream &writeAssociativeContainer(QDataStream &s, const Container &c)
 {
@@ -397,13 +488,13 @@ inline QDataStream &operator<<(QDataStream &s, const QLinkedList<T> &l)
 template<typename T>
 inline QDataStream &operator>>(QDataStream &s, QVector<T> &v)
 {
-    return QtPrivate::readArrayBasedContainer(s, v);
+    return QtPrivate::readVector(s, v, std::integral_constant<bool, QtPrivate::IsArrayStreamable<T>::Value>());
 }
 
 template<typename T>
 inline QDataStream &operator<<(QDataStream &s, const QVector<T> &v)
 {
-    return QtPrivate::writeSequentialContainer(s, v);
+    return QtPrivate::writeVector(s, v, std::integral_constant<bool, QtPrivate::IsArrayStreamable<T>::Value>());
 }
 
 template <typename T>
@@ -87,6 +87,13 @@
     enables iterating through all subdirectories of the assigned path,
     following all symbolic links. Symbolic link loops (e.g., "link" => "." or
     "link" => "..") are automatically detected and ignored.
+
+    \value FastScan Filter entries by the type the directory listing reports
+    for them, without querying the file system for each entry. Symbolic links
+    are then neither files nor directories, unless FollowSymlinks is also
+    given, and links to files that do not exist are not told apart from
+    other links. Filtering by permissions still queries the file system.
+    This value was introduced in Qt 5.11.
 */
 
 #include "qdiriterator.h"
@@ -96,6 +103,12 @@
 #include <QtCore/qset.h>
 #include <QtCore/qstack.h>
 #include <QtCore/qvariant.h>
+#ifndef QT_NO_THREAD
+#include <QtCore/qmutex.h>
+#include <QtCore/qrunnable.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qwaitcondition.h>
+#endif
 
 #include <QtCore/private/qfilesystemiterator_p.h>
 #include <QtCore/private/qfilesystementry_p.h>
@@ -118,9 +131,13 @@ public:
 class QDirIteratorPrivate
 {
 public:
+    typedef std::function<void(const QFileInfo &)> DirectoryHandler;
+
     QDirIteratorPrivate(const QFileSystemEntry &entry, const QStringList &nameFilters,
-                        QDir::Filters filters, QDirIterator::IteratorFlags flags, bool resolveEngine = true);
+                        QDir::Filters filters, QDirIterator::IteratorFlags flags, bool resolveEngine = true,
+                        const DirectoryHandler *directoryHandler = Q_NULLPTR);
 
+    bool hasNext() const;
     void advance();
 
     bool entryMatches(const QString & fileName, const QFileInfo &fileInfo);
@@ -128,6 +145,11 @@ public:
     void checkAndPushDirectory(const QFileInfo &);
     bool matchesFilters(const QString &fileName, const QFileInfo &fi) const;
 
+    bool hasType(const QFileInfo &fi, QFileSystemMetaData::MetaDataFlag type) const;
+    bool isDirectory(const QFileInfo &fi) const { return hasType(fi, QFileSystemMetaData::DirectoryType); }
+    bool isFile(const QFileInfo &fi) const { return hasType(fi, QFileSystemMetaData::FileType); }
+    bool exists(const QFileInfo &fi) const;
+
     QScopedPointer<QAbstractFileEngine> engine;
 
     QFileSystemEntry dirEntry;
@@ -149,17 +171,22 @@ public:
 
     // Loop protection
     QSet<QString> visitedLinks;
+
+    // If set, subdirectories are handed to it instead of being iterated
+    const DirectoryHandler *directoryHandler;
 };
 
 /*!
     \internal
 */
 QDirIteratorPrivate::QDirIteratorPrivate(const QFileSystemEntry &entry, const QStringList &nameFilters,
-                                         QDir::Filters filters, QDirIterator::IteratorFlags flags, bool resolveEngine)
+                                         QDir::Filters filters, QDirIterator::IteratorFlags flags, bool resolveEngine,
+                                         const DirectoryHandler *directoryHandler)
     : dirEntry(entry)
       , nameFilters(nameFilters.contains(QLatin1String("*")) ? QStringList() : nameFilters)
       , filters(QDir::NoFilter == filters ? QDir::AllEntries : filters)
       , iteratorFlags(flags)
+      , directoryHandler(directoryHandler)
 {
 #ifndef QT_NO_REGEXP
     nameRegExps.reserve(nameFilters.size());
@@ -229,6 +256,21 @@ inline bool QDirIteratorPrivate::entryMatches(const QString & fileName, const QF
     return false;
 }
 
+/*!
+    \internal
+*/
+bool QDirIteratorPrivate::hasNext() const
+{
+    if (engine)
+        return !fileEngineIterators.isEmpty();
+    else
+#ifndef QT_NO_FILESYSTEMITERATOR
+        return !nativeIterators.isEmpty();
+#else
+        return false;
+#endif
+}
+
 /*!
     \internal
 */
@@ -283,7 +325,7 @@ void QDirIteratorPrivate::checkAndPushDirectory(const QFileInfo &fileInfo)
         return;
 
     // Never follow non-directory entries
-    if (!fileInfo.isDir())
+    if (!isDirectory(fileInfo))
         return;
 
     // Follow symlinks only when asked
@@ -304,7 +346,44 @@ void QDirIteratorPrivate::checkAndPushDirectory(const QFileInfo &fileInfo)
         visitedLinks.contains(fileInfo.canonicalFilePath()))
         return;
 
-    pushDirectory(fileInfo);
+    if (directoryHandler)
+        (*directoryHandler)(fileInfo);
+    else
+        pushDirectory(fileInfo);
+}
+
+/*!
+    \internal
+
+    Returns whether \a fi is of the given \a type. With FastScan, a type the
+    directory listing did not report, like the type of the target of a
+    symbolic link, is taken to be false instead of being looked up.
+*/
+bool QDirIteratorPrivate::hasType(const QFileInfo &fi, QFileSystemMetaData::MetaDataFlag type) const
+{
+    const QFileInfoPrivate *info = fi.d_ptr.constData();
+    if ((iteratorFlags & QDirIterator::FastScan) && !info->fileEngine
+        && !info->metaData.hasFlags(type) && info->metaData.hasFlags(QFileSystemMetaData::LinkType)
+        && !(type == QFileSystemMetaData::DirectoryType && (iteratorFlags & QDirIterator::FollowSymlinks))) {
+        return false;
+    }
+    return type == QFileSystemMetaData::DirectoryType ? fi.isDir() : fi.isFile();
+}
+
+/*!
+    \internal
+
+    Returns whether \a fi exists. With FastScan, every entry the directory
+    listing reported a type for is taken to exist.
+*/
+bool QDirIteratorPrivate::exists(const QFileInfo &fi) const
+{
+    const QFileInfoPrivate *info = fi.d_ptr.constData();
+    if ((iteratorFlags & QDirIterator::FastScan) && !info->fileEngine
+        && info->metaData.hasFlags(QFileSystemMetaData::LinkType)) {
+        return true;
+    }
+    return fi.exists();
 }
 
 /*!
@@ -335,7 +414,7 @@ bool QDirIteratorPrivate::matchesFilters(const QString &fileName, const QFileInf
     // name filter
 #ifndef QT_NO_REGEXP
     // Pass all entries through name filters, except dirs if the AllDirs
-    if (!nameFilters.isEmpty() && !((filters & QDir::AllDirs) && fi.isDir())) {
+    if (!nameFilters.isEmpty() && !((filters & QDir::AllDirs) && isDirectory(fi))) {
         bool matched = false;
         for (QVector<QRegExp>::const_iterator iter = nameRegExps.constBegin(),
                                               end = nameRegExps.constEnd();
@@ -356,7 +435,7 @@ bool QDirIteratorPrivate::matchesFilters(const QString &fileName, const QFileInf
     const bool includeSystem = (filters & QDir::System);
     if(skipSymlinks && fi.isSymLink()) {
         // The only reason to save this file is if it is a broken link and we are requesting system files.
-        if(!includeSystem || fi.exists())
+        if(!includeSystem || exists(fi))
             return false;
     }
 
@@ -366,18 +445,18 @@ bool QDirIteratorPrivate::matchesFilters(const QString &fileName, const QFileInf
         return false;
 
     // filter system files
-    if (!includeSystem && (!(fi.isFile() || fi.isDir() || fi.isSymLink())
-                    || (!fi.exists() && fi.isSymLink())))
+    if (!includeSystem && (!(fi.isSymLink() || isFile(fi) || isDirectory(fi))
+                    || (fi.isSymLink() && !exists(fi))))
         return false;
 
     // skip directories
     const bool skipDirs = !(filters & (QDir::Dirs | QDir::AllDirs));
-    if (skipDirs && fi.isDir())
+    if (skipDirs && isDirectory(fi))
         return false;
 
     // skip files
     const bool skipFiles    = !(filters & QDir::Files);
-    if (skipFiles && fi.isFile())
+    if (skipFiles && isFile(fi))
         // Basically we need a reason not to exclude this file otherwise we just eliminate it.
         return false;
 
@@ -503,14 +582,7 @@ QString QDirIterator::next()
 */
 bool QDirIterator::hasNext() const
 {
-    if (d->engine)
-        return !d->fileEngineIterators.isEmpty();
-    else
-#ifndef QT_NO_FILESYSTEMITERATOR
-        return !d->nativeIterators.isEmpty();
-#else
-        return false;
-#endif
+    return d->hasNext();
 }
 
 /*!
@@ -556,4 +628,130 @@ QString QDirIterator::path() const
     return d->dirEntry.filePath();
 }
 
+#ifndef QT_NO_THREAD
+namespace {
+struct QDirWalk
+{
+    QDirWalk(const QStringList &nameFilters, QDir::Filters filters, QDirIterator::IteratorFlags flags,
+             const QDirIterator::EntryHandler &handler, QThreadPool *pool)
+        : nameFilters(nameFilters), filters(filters), flags(flags | QDirIterator::Subdirectories),
+          handler(handler), pool(pool), pending(0)
+    {
+        directoryHandler = [this](const QFileInfo &fileInfo) { schedule(fileInfo); };
+    }
+
+    void scan(const QFileSystemEntry &entry)
+    {
+        QDirIteratorPrivate d(entry, nameFilters, filters, flags, true, &directoryHandler);
+        while (d.hasNext()) {
+            d.advance();
+            handler(d.currentFileInfo);
+        }
+    }
+
+    void schedule(const QFileInfo &fileInfo);
+    void finished()
+    {
+        QMutexLocker locker(&mutex);
+        if (--pending == 0)
+            done.wakeAll();
+    }
+
+    void wait()
+    {
+        QMutexLocker locker(&mutex);
+        while (pending > 0)
+            done.wait(&mutex);
+    }
+
+    const QStringList nameFilters;
+    const QDir::Filters filters;
+    const QDirIterator::IteratorFlags flags;
+    const QDirIterator::EntryHandler &handler;
+    QThreadPool *pool;
+    QDirIteratorPrivate::DirectoryHandler directoryHandler;
+
+    QMutex mutex;
+    QWaitCondition done;
+    int pending;
+    QSet<QString> visitedLinks; // loop protection across all directories
+};
+
+class QDirWalkTask : public QRunnable
+{
+public:
+    QDirWalkTask(QDirWalk *walk, const QString &path)
+        : walk(walk), path(path)
+    {
+    }
+
+    void run() Q_DECL_OVERRIDE
+    {
+        walk->scan(QFileSystemEntry(path));
+        walk->finished();
+    }
+
+private:
+    QDirWalk *walk;
+    QString path;
+};
+
+void QDirWalk::schedule(const QFileInfo &fileInfo)
+{
+    QString path = fileInfo.filePath();
+#ifdef Q_OS_WIN
+    if (fileInfo.isSymLink())
+        path = fileInfo.canonicalFilePath();
+#endif
+
+    QMutexLocker locker(&mutex);
+    if (flags & QDirIterator::FollowSymlinks) {
+        const QString canonicalPath = fileInfo.canonicalFilePath();
+        if (visitedLinks.contains(canonicalPath))
+            return;
+        visitedLinks.insert(canonicalPath);
+    }
+    ++pending;
+    locker.unlock();
+    pool->start(new QDirWalkTask(this, path));
+}
+} // unnamed namespace
+
+/*!
+    \typedef QDirIterator::EntryHandler
+    \since 5.11
+
+    Synonym for \c{std::function<void(const QFileInfo &)>}, the type of the
+    function walk() reports entries to.
+*/
+
+/*!
+    \since 5.11
+
+    Lists all entries of \a path and of its subdirectories that match
+    \a nameFilters and \a filters, and calls \a handler for each of them.
+    The subdirectories are listed in parallel by the threads of \a pool, or
+    of QThreadPool::globalInstance() if \a pool is \c nullptr, so
+    \a handler can be called from several threads at the same time and the
+    entries arrive in no particular order. The function returns once all
+    entries have been handled.
+
+    The \a flags are interpreted as by QDirIterator, with Subdirectories
+    always set. Combined with FastScan, this is the quickest way to find all
+    files below a directory.
+
+    \sa QDirIterator::IteratorFlags
+*/
+void QDirIterator::walk(const QString &path, const QStringList &nameFilters, QDir::Filters filters,
+                        IteratorFlags flags, const EntryHandler &handler, QThreadPool *pool)
+{
+    QDirWalk walk(nameFilters, filters, flags, handler, pool ? pool : QThreadPool::globalInstance());
+    if (flags & FollowSymlinks)
+        walk.visitedLinks.insert(QFileInfo(path).canonicalFilePath());
+    // the calling thread lists the top directory while the pool takes the rest
+    walk.scan(QFileSystemEntry(path));
+    walk.wait();
+}
+#endif // QT_NO_THREAD
+
 QT_END_NAMESPACE
@@ -42,8 +42,11 @@
 
 #include <QtCore/qdir.h>
 
+#include <functional>
+
 QT_BEGIN_NAMESPACE
 
+class QThreadPool;
 
 class QDirIteratorPrivate;
 class Q_CORE_EXPORT QDirIterator {
@@ -51,7 +54,8 @@ public:
     enum IteratorFlag {
         NoIteratorFlags = 0x0,
         FollowSymlinks = 0x1,
-        Subdirectories = 0x2
+        Subdirectories = 0x2,
+        FastScan = 0x4
     };
     Q_DECLARE_FLAGS(IteratorFlags, IteratorFlag)
 
@@ -76,6 +80,12 @@ public:
     QFileInfo fileInfo() const;
     QString path() const;
 
+#ifndef QT_NO_THREAD
+    typedef std::function<void(const QFileInfo &)> EntryHandler;
+    static void walk(const QString &path, const QStringList &nameFilters, QDir::Filters filters,
+                     IteratorFlags flags, const EntryHandler &handler, QThreadPool *pool = Q_NULLPTR);
+#endif
+
 private:
     Q_DISABLE_COPY(QDirIterator)
 
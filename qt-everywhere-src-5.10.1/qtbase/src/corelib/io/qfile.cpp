@@ -905,6 +905,8 @@ bool QFile::open(OpenMode mode)
     // QIODevice provides the buffering, so there's no need to request it from the file engine.
     if (d->engine()->open(mode | QIODevice::Unbuffered)) {
         QIODevice::open(mode);
+        if (d->accessPatternHints)
+            d->applyAccessPatternHints();
         if (mode & Append)
             seek(size());
         return true;
@@ -976,6 +978,8 @@ bool QFile::open(FILE *fh, OpenMode mode, FileHandleFlags handleFlags)
     // QIODevice provides the buffering, so request unbuffered file engines
     if (d->openExternalFile(mode | Unbuffered, fh, handleFlags)) {
         QIODevice::open(mode);
+        if (d->accessPatternHints)
+            d->applyAccessPatternHints();
         if (!(mode & Append) && !isSequential()) {
             qint64 pos = (qint64)QT_FTELL(fh);
             if (pos != -1) {
@@ -1034,6 +1038,8 @@ bool QFile::open(int fd, OpenMode mode, FileHandleFlags handleFlags)
     // QIODevice provides the buffering, so request unbuffered file engines
     if (d->openExternalFile(mode | Unbuffered, fd, handleFlags)) {
         QIODevice::open(mode);
+        if (d->accessPatternHints)
+            d->applyAccessPatternHints();
         if (!(mode & Append) && !isSequential()) {
             qint64 pos = (qint64)QT_LSEEK(fd, QT_OFF_T(0), SEEK_CUR);
             if (pos != -1) {
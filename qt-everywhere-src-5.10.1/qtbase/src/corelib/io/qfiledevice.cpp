@@ -55,7 +55,8 @@ QT_BEGIN_NAMESPACE
 QFileDevicePrivate::QFileDevicePrivate()
     : fileEngine(0),
       cachedSize(0),
-      error(QFile::NoError), lastWasWrite(false)
+      error(QFile::NoError), accessPatternHints(QFileDevice::NoAccessPatternHint),
+      lastWasWrite(false)
 {
     writeBufferChunkSize = QFILE_WRITEBUFFER_SIZE;
 }
@@ -687,6 +688,67 @@ bool QFileDevice::setPermissions(Permissions permissions)
     the mapped memory. This enum value was introduced in Qt 5.4.
 */
 
+/*!
+    \enum QFileDevice::AccessPatternHint
+    \since 5.11
+
+    This enum describes how a file is going to be accessed, so that the
+    operating system can adapt its caching and read-ahead.
+
+    \value NoAccessPatternHint No particular access pattern; the default.
+    \value SequentialAccessHint The file will be read from start to end.
+    The operating system reads further ahead. On Unix, large reads of a
+    large file opened with ReadOnly are then served from a memory mapping
+    of the file instead of being copied by read(), see
+    setAccessPatternHints().
+    \value RandomAccessHint The file will be accessed in no particular
+    order, so reading ahead is pointless.
+    \value WillNeedHint The whole file will be needed soon, so the
+    operating system may start reading it into its cache.
+    \value NoReuseHint The data will be accessed only once; the operating
+    system does not need to keep it in its cache afterwards.
+*/
+
+/*!
+    \since 5.11
+
+    Tells the operating system that the file will be accessed as described
+    by \a hints. The hints are passed on when the file is opened, or
+    immediately if it is already open. They do not change the behavior of
+    the file, only how fast it is. Platforms and file engines that have no
+    use for them ignore them.
+
+    \note With SequentialAccessHint, if the file is truncated by another
+    process while it is read through a memory mapping, reading can crash
+    with a bus error; use it only for files that do not shrink while open.
+
+    \sa accessPatternHints()
+*/
+void QFileDevice::setAccessPatternHints(AccessPatternHints hints)
+{
+    Q_D(QFileDevice);
+    d->accessPatternHints = hints;
+    if (isOpen())
+        d->applyAccessPatternHints();
+}
+
+void QFileDevicePrivate::applyAccessPatternHints()
+{
+    if (engine() && fileEngine->supportsExtension(QAbstractFileEngine::AccessPatternHintExtension))
+        fileEngine->setAccessPatternHints(accessPatternHints);
+}
+
+/*!
+    \since 5.11
+
+    Returns the access pattern hints set with setAccessPatternHints().
+*/
+QFileDevice::AccessPatternHints QFileDevice::accessPatternHints() const
+{
+    Q_D(const QFileDevice);
+    return d->accessPatternHints;
+}
+
 /*!
     Maps \a size bytes of the file into memory starting at \a offset.  A file
     should be open for a map to succeed but the file does not need to stay
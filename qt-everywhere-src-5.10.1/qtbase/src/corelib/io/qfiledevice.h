@@ -127,6 +127,18 @@ public:
     uchar *map(qint64 offset, qint64 size, MemoryMapFlags flags = NoOptions);
     bool unmap(uchar *address);
 
+    enum AccessPatternHint {
+        NoAccessPatternHint = 0x0,
+        SequentialAccessHint = 0x1,
+        RandomAccessHint = 0x2,
+        WillNeedHint = 0x4,
+        NoReuseHint = 0x8
+    };
+    Q_DECLARE_FLAGS(AccessPatternHints, AccessPatternHint)
+
+    void setAccessPatternHints(AccessPatternHints hints);
+    AccessPatternHints accessPatternHints() const;
+
     QDateTime fileTime(QFileDevice::FileTime time) const;
     bool setFileTime(const QDateTime &newDate, QFileDevice::FileTime fileTime);
 
@@ -148,6 +160,7 @@ private:
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(QFileDevice::Permissions)
+Q_DECLARE_OPERATORS_FOR_FLAGS(QFileDevice::AccessPatternHints)
 
 QT_END_NAMESPACE
 
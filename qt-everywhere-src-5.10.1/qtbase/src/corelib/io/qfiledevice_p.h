@@ -75,11 +75,14 @@ protected:
     void setError(QFileDevice::FileError err, const QString &errorString);
     void setError(QFileDevice::FileError err, int errNum);
 
+    void applyAccessPatternHints();
+
     mutable QAbstractFileEngine *fileEngine;
     mutable qint64 cachedSize;
 
     QFileDevice::FileHandleFlags handleFlags;
     QFileDevice::FileError error;
+    QFileDevice::AccessPatternHints accessPatternHints;
 
     bool lastWasWrite;
 };
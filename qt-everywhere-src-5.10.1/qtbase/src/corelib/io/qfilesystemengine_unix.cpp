@@ -570,9 +570,19 @@ void QFileSystemMetaData::fillFromDirEnt(const QT_DIRENT &entry)
     }
 #elif defined(_DIRENT_HAVE_D_TYPE) || defined(Q_OS_BSD4)
     // BSD4 includes OS X and iOS
+    fillFromDirEntType(entry.d_type);
+#else
+    Q_UNUSED(entry)
+#endif
+}
 
+// Fills in what the d_type of a directory entry tells about the entry, without
+// any further system calls. An unknown type clears all flags.
+void QFileSystemMetaData::fillFromDirEntType(unsigned char type)
+{
+#if defined(_DIRENT_HAVE_D_TYPE) || defined(Q_OS_BSD4)
     // ### This will clear all entry flags and knownFlagsMask
-    switch (entry.d_type)
+    switch (type)
     {
     case DT_DIR:
         knownFlagsMask = QFileSystemMetaData::LinkType
@@ -639,7 +649,8 @@ void QFileSystemMetaData::fillFromDirEnt(const QT_DIRENT &entry)
         clear();
     }
 #else
-    Q_UNUSED(entry)
+    Q_UNUSED(type)
+    clear();
 #endif
 }
 
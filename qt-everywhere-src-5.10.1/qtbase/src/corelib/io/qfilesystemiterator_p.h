@@ -67,6 +67,13 @@
 #include <QtCore/qscopedpointer.h>
 #endif
 
+#if defined(Q_OS_LINUX)
+#  include <sys/syscall.h>
+#  if defined(SYS_getdents64)
+#    define QT_FILESYSTEMITERATOR_GETDENTS64
+#  endif
+#endif
+
 QT_BEGIN_NAMESPACE
 
 class QFileSystemIterator
@@ -90,6 +97,13 @@ private:
     bool uncFallback;
     int uncShareIndex;
     bool onlyDirs;
+#elif defined(QT_FILESYSTEMITERATOR_GETDENTS64)
+    // read many entries per system call instead of going through readdir()
+    int dirFd;
+    QScopedArrayPointer<char> buffer;
+    int bufferOffset;
+    int bufferEnd;
+    int lastError;
 #else
     QT_DIR *dir;
     QT_DIRENT *dirEntry;
@@ -45,8 +45,86 @@
 #include <stdlib.h>
 #include <errno.h>
 
+#ifdef QT_FILESYSTEMITERATOR_GETDENTS64
+#  include <QtCore/private/qcore_unix_p.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
 QT_BEGIN_NAMESPACE
 
+#ifdef QT_FILESYSTEMITERATOR_GETDENTS64
+namespace {
+// the record layout getdents64(2) fills the buffer with
+struct LinuxDirent64
+{
+    quint64 d_ino;
+    qint64 d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1];
+};
+
+// large enough for a few hundred entries of typical length
+enum { DirentBufferSize = 32 * 1024 };
+}
+
+QFileSystemIterator::QFileSystemIterator(const QFileSystemEntry &entry, QDir::Filters filters,
+                                         const QStringList &nameFilters, QDirIterator::IteratorFlags flags)
+    : nativePath(entry.nativeFilePath())
+    , dirFd(-1)
+    , bufferOffset(0)
+    , bufferEnd(0)
+    , lastError(0)
+{
+    Q_UNUSED(filters)
+    Q_UNUSED(nameFilters)
+    Q_UNUSED(flags)
+
+    if ((dirFd = qt_safe_open(nativePath.constData(), O_RDONLY | O_DIRECTORY)) == -1) {
+        lastError = errno;
+    } else {
+        buffer.reset(new char[DirentBufferSize]);
+        if (!nativePath.endsWith('/'))
+            nativePath.append('/');
+    }
+}
+
+QFileSystemIterator::~QFileSystemIterator()
+{
+    if (dirFd != -1)
+        qt_safe_close(dirFd);
+}
+
+bool QFileSystemIterator::advance(QFileSystemEntry &fileEntry, QFileSystemMetaData &metaData)
+{
+    if (dirFd == -1)
+        return false;
+
+    if (bufferOffset >= bufferEnd) {
+        long read;
+        EINTR_LOOP(read, syscall(SYS_getdents64, dirFd, buffer.data(), DirentBufferSize));
+        if (read <= 0) {
+            lastError = read < 0 ? errno : 0;
+            return false;
+        }
+        bufferOffset = 0;
+        bufferEnd = int(read);
+    }
+
+    const LinuxDirent64 *dirEntry = reinterpret_cast<const LinuxDirent64 *>(buffer.data() + bufferOffset);
+    bufferOffset += dirEntry->d_reclen;
+
+    QFileSystemEntry::NativePath path;
+    path.reserve(nativePath.size() + int(qstrlen(dirEntry->d_name)));
+    path.append(nativePath).append(dirEntry->d_name);
+    fileEntry = QFileSystemEntry(path, QFileSystemEntry::FromNativePath());
+    metaData.fillFromDirEntType(dirEntry->d_type);
+    return true;
+}
+
+#else
+
 QFileSystemIterator::QFileSystemIterator(const QFileSystemEntry &entry, QDir::Filters filters,
                                          const QStringList &nameFilters, QDirIterator::IteratorFlags flags)
     : nativePath(entry.nativeFilePath())
@@ -89,6 +167,8 @@ bool QFileSystemIterator::advance(QFileSystemEntry &fileEntry, QFileSystemMetaDa
     return false;
 }
 
+#endif // QT_FILESYSTEMITERATOR_GETDENTS64
+
 QT_END_NAMESPACE
 
 #endif // QT_NO_FILESYSTEMITERATOR
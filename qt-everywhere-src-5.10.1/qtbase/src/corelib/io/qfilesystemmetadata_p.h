@@ -227,6 +227,7 @@ public:
     void fillFromStatxBuf(const struct statx &statBuffer);
     void fillFromStatBuf(const QT_STATBUF &statBuffer);
     void fillFromDirEnt(const QT_DIRENT &statBuffer);
+    void fillFromDirEntType(unsigned char type);
 #endif
 
 #if defined(Q_OS_WIN)
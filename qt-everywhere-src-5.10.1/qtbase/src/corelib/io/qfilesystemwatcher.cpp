@@ -45,6 +45,7 @@
 #include <qdatetime.h>
 #include <qdebug.h>
 #include <qdir.h>
+#include <qdiriterator.h>
 #include <qfileinfo.h>
 #include <qset.h>
 #include <qtimer.h>
@@ -88,7 +89,7 @@ QFileSystemWatcherEngine *QFileSystemWatcherPrivate::createNativeEngine(QObject
 }
 
 QFileSystemWatcherPrivate::QFileSystemWatcherPrivate()
-    : native(0), poller(0)
+    : native(0), poller(0), notificationInterval(0), notificationTimer(0)
 {
 }
 
@@ -136,6 +137,67 @@ void QFileSystemWatcherPrivate::initPollerEngine()
                      SLOT(_q_directoryChanged(QString,bool)));
 }
 
+bool QFileSystemWatcherPrivate::isWatchedRecursively(const QString &directory) const
+{
+    for (const QString &root : recursiveRoots) {
+        if (directory.startsWith(root)
+                && (directory.size() == root.size() || directory.at(root.size()) == QLatin1Char('/')
+                    || root.endsWith(QLatin1Char('/')))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void QFileSystemWatcherPrivate::addSubdirectories(const QString &directory)
+{
+    // watch the subdirectories that aren't watched yet; only those need to be
+    // scanned further, the others report their own changes
+    Q_Q(QFileSystemWatcher);
+    const QSet<QString> watched = directories.toSet();
+    QStringList newDirectories;
+    QStringList toScan(directory);
+    while (!toScan.isEmpty()) {
+        QDirIterator it(toScan.takeLast(),
+                        QDir::Dirs | QDir::NoDotAndDotDot | QDir::NoSymLinks | QDir::Hidden);
+        while (it.hasNext()) {
+            const QString path = it.next();
+            if (!watched.contains(path)) {
+                newDirectories.append(path);
+                toScan.append(path);
+            }
+        }
+    }
+    if (!newDirectories.isEmpty())
+        q->addPaths(newDirectories);
+}
+
+void QFileSystemWatcherPrivate::postChange(const QString &path)
+{
+    Q_Q(QFileSystemWatcher);
+    if (!pendingChangesSet.contains(path)) {
+        pendingChangesSet.insert(path);
+        pendingChanges.append(path);
+    }
+    if (!notificationTimer) {
+        notificationTimer = new QTimer(q);
+        notificationTimer->setSingleShot(true);
+        QObject::connect(notificationTimer, &QTimer::timeout, q, [this] { emitPendingChanges(); });
+    }
+    notificationTimer->start(notificationInterval);
+}
+
+void QFileSystemWatcherPrivate::emitPendingChanges()
+{
+    Q_Q(QFileSystemWatcher);
+    if (pendingChanges.isEmpty())
+        return;
+    const QStringList changes = pendingChanges;
+    pendingChanges.clear();
+    pendingChangesSet.clear();
+    emit q->pathsChanged(changes, QFileSystemWatcher::QPrivateSignal());
+}
+
 void QFileSystemWatcherPrivate::_q_fileChanged(const QString &path, bool removed)
 {
     Q_Q(QFileSystemWatcher);
@@ -145,7 +207,10 @@ void QFileSystemWatcherPrivate::_q_fileChanged(const QString &path, bool removed
     }
     if (removed)
         files.removeAll(path);
-    emit q->fileChanged(path, QFileSystemWatcher::QPrivateSignal());
+    if (notificationInterval > 0)
+        postChange(path);
+    else
+        emit q->fileChanged(path, QFileSystemWatcher::QPrivateSignal());
 }
 
 void QFileSystemWatcherPrivate::_q_directoryChanged(const QString &path, bool removed)
@@ -157,7 +222,12 @@ void QFileSystemWatcherPrivate::_q_directoryChanged(const QString &path, bool re
     }
     if (removed)
         directories.removeAll(path);
-    emit q->directoryChanged(path, QFileSystemWatcher::QPrivateSignal());
+    else if (!recursiveRoots.isEmpty() && isWatchedRecursively(path))
+        addSubdirectories(path);
+    if (notificationInterval > 0)
+        postChange(path);
+    else
+        emit q->directoryChanged(path, QFileSystemWatcher::QPrivateSignal());
 }
 
 #if defined(Q_OS_WIN) && !defined(Q_OS_WINRT)
@@ -249,6 +319,15 @@ void  QFileSystemWatcherPrivate::_q_winDriveRemoved(const QString &path)
     \endlist
     \endlist
 
+    To watch a whole directory tree, call addRecursivePath(). Its
+    subdirectories are watched as well, including the ones created later.
+
+    Operations such as checking out a branch in a large source tree change
+    many paths in a short time. To receive them as a single notification,
+    set a notificationInterval(): the changed paths are then collected and
+    reported together in pathsChanged(), once no further change has been
+    detected for that interval.
+
     \sa QFile, QDir
 */
 
@@ -386,6 +465,41 @@ QStringList QFileSystemWatcher::addPaths(const QStringList &paths)
     return p;
 }
 
+/*!
+    \since 5.11
+
+    Adds \a directory and all its subdirectories to the file system watcher.
+    Subdirectories that are created later are added as soon as the change
+    in their parent directory is detected. Symbolic links to directories
+    are not followed.
+
+    Returns \c true if \a directory itself is being watched. Removing
+    \a directory with removePath() also removes its subdirectories.
+
+    \note Each subdirectory counts against the system dependent limit of
+    watched paths.
+
+    \sa addPath(), directories()
+*/
+bool QFileSystemWatcher::addRecursivePath(const QString &directory)
+{
+    Q_D(QFileSystemWatcher);
+    if (directory.isEmpty()) {
+        qWarning("QFileSystemWatcher::addRecursivePath: path is empty");
+        return true;
+    }
+    if (!QFileInfo(directory).isDir())
+        return false;
+
+    const QString root = QDir::cleanPath(directory);
+    if (!d->directories.contains(root) && !addPath(root))
+        return false;
+    if (!d->recursiveRoots.contains(root))
+        d->recursiveRoots.append(root);
+    d->addSubdirectories(root);
+    return true;
+}
+
 /*!
     Removes the specified \a path from the file system watcher.
 
@@ -436,6 +550,18 @@ QStringList QFileSystemWatcher::removePaths(const QStringList &paths)
         return QStringList();
     }
 
+    // removing the root of a recursive watch removes its subdirectories
+    for (const QString &path : paths) {
+        const QString root = QDir::cleanPath(path);
+        if (d->recursiveRoots.removeAll(root) == 0)
+            continue;
+        const QString prefix = root.endsWith(QLatin1Char('/')) ? root : root + QLatin1Char('/');
+        for (const QString &directory : qAsConst(d->directories)) {
+            if (directory.startsWith(prefix) && !d->isWatchedRecursively(directory))
+                p.append(directory);
+        }
+    }
+
     if (d->native)
         p = d->native->removePaths(p, &d->files, &d->directories);
     if (d->poller)
@@ -466,6 +592,56 @@ QStringList QFileSystemWatcher::removePaths(const QStringList &paths)
     \sa fileChanged()
 */
 
+/*!
+    \fn void QFileSystemWatcher::pathsChanged(const QStringList &paths)
+    \since 5.11
+
+    This signal is emitted instead of fileChanged() and directoryChanged()
+    if a notificationInterval() is set. It carries the \a paths of the
+    watched files and directories that changed, each reported once, after no
+    further change has been detected for that interval.
+
+    \sa setNotificationInterval()
+*/
+
+/*!
+    \since 5.11
+
+    Sets the notification interval to \a msecs milliseconds.
+
+    If \a msecs is greater than zero, changes are not reported one by one
+    with fileChanged() and directoryChanged(). They are collected until no
+    further change has been detected for \a msecs milliseconds, and then
+    reported together with pathsChanged(). This keeps a burst of changes,
+    for instance from a version control checkout, from flooding the event
+    loop.
+
+    The default is 0, which reports each change as it is detected.
+
+    \sa notificationInterval()
+*/
+void QFileSystemWatcher::setNotificationInterval(int msecs)
+{
+    Q_D(QFileSystemWatcher);
+    d->notificationInterval = qMax(0, msecs);
+    // don't hold back the changes collected so far
+    if (d->notificationInterval == 0)
+        d->emitPendingChanges();
+}
+
+/*!
+    \since 5.11
+
+    Returns the notification interval in milliseconds.
+
+    \sa setNotificationInterval(), pathsChanged()
+*/
+int QFileSystemWatcher::notificationInterval() const
+{
+    Q_D(const QFileSystemWatcher);
+    return d->notificationInterval;
+}
+
 /*!
     \fn QStringList QFileSystemWatcher::directories() const
 
@@ -61,15 +61,20 @@ public:
 
     bool addPath(const QString &file);
     QStringList addPaths(const QStringList &files);
+    bool addRecursivePath(const QString &directory);
     bool removePath(const QString &file);
     QStringList removePaths(const QStringList &files);
 
     QStringList files() const;
     QStringList directories() const;
 
+    void setNotificationInterval(int msecs);
+    int notificationInterval() const;
+
 Q_SIGNALS:
     void fileChanged(const QString &path, QPrivateSignal);
     void directoryChanged(const QString &path, QPrivateSignal);
+    void pathsChanged(const QStringList &paths, QPrivateSignal);
 
 private:
     Q_PRIVATE_SLOT(d_func(), void _q_fileChanged(const QString &path, bool removed))
@@ -362,10 +362,13 @@ void QInotifyFileSystemWatcherEngine::readFromInotify()
     char * const end = at + buffSize;
 
     QHash<int, inotify_event *> eventForId;
+    bool overflowed = false;
     while (at < end) {
         inotify_event *event = reinterpret_cast<inotify_event *>(at);
 
-        if (eventForId.contains(event->wd))
+        if (event->mask & IN_Q_OVERFLOW)
+            overflowed = true;
+        else if (eventForId.contains(event->wd))
             eventForId[event->wd]->mask |= event->mask;
         else
             eventForId.insert(event->wd, event);
@@ -409,6 +412,24 @@ void QInotifyFileSystemWatcherEngine::readFromInotify()
                 emit fileChanged(path, false);
         }
     }
+
+    if (overflowed) {
+        // the kernel dropped events; we can't tell which paths they were
+        // for, so report every watched path as changed
+        const QStringList paths = pathToID.keys();
+        for (const QString &path : paths) {
+            const QHash<QString, int>::const_iterator found = pathToID.constFind(path);
+            if (found == pathToID.constEnd())
+                continue; // removed by a receiver of the signals above
+            const int id = found.value();
+            if (eventForId.contains(id < 0 ? -id : id))
+                continue; // already reported
+            if (id < 0)
+                emit directoryChanged(path, false);
+            else
+                emit fileChanged(path, false);
+        }
+    }
 }
 
 QString QInotifyFileSystemWatcherEngine::getPathFromID(int id) const
@@ -59,9 +59,12 @@
 
 #include <QtCore/qstringlist.h>
 #include <QtCore/qhash.h>
+#include <QtCore/qset.h>
 
 QT_BEGIN_NAMESPACE
 
+class QTimer;
+
 class QFileSystemWatcherEngine : public QObject
 {
     Q_OBJECT
@@ -104,6 +107,19 @@ public:
     QFileSystemWatcherEngine *native, *poller;
     QStringList files, directories;
 
+    // directories whose subdirectories are watched as well
+    QStringList recursiveRoots;
+    bool isWatchedRecursively(const QString &directory) const;
+    void addSubdirectories(const QString &directory);
+
+    // changes collected until the notification interval passed without new ones
+    int notificationInterval;
+    QTimer *notificationTimer;
+    QStringList pendingChanges;
+    QSet<QString> pendingChangesSet;
+    void postChange(const QString &path);
+    void emitPendingChanges();
+
     // private slots
     void _q_fileChanged(const QString &path, bool removed);
     void _q_directoryChanged(const QString &path, bool removed);
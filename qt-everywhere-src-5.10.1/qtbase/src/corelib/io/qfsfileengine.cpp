@@ -136,6 +136,12 @@ void QFSFileEnginePrivate::init()
     fileHandle = INVALID_HANDLE_VALUE;
     mapHandle = NULL;
     cachedFd = -1;
+#else
+    accessPatternHints = QFile::NoAccessPatternHint;
+    readWindow = 0;
+    readWindowOffset = 0;
+    readWindowSize = 0;
+    mappedReads = false;
 #endif
 }
 
@@ -477,6 +483,9 @@ void QFSFileEnginePrivate::unmapAll()
         for (int i = 0; i < keys.count(); ++i)
             unmap(keys.at(i));
     }
+#ifndef Q_OS_WIN
+    releaseReadWindow();
+#endif
 }
 
 #ifndef Q_OS_WIN
@@ -862,6 +871,13 @@ bool QFSFileEngine::extension(Extension extension, const ExtensionOption *option
         const UnMapExtensionOption *options = (const UnMapExtensionOption*)option;
         return d->unmap(options->address);
     }
+#ifndef Q_OS_WIN
+    if (extension == AccessPatternHintExtension) {
+        const AccessPatternHintExtensionOption *options
+                = static_cast<const AccessPatternHintExtensionOption *>(option);
+        return d->setAccessPatternHints(options->hints);
+    }
+#endif
 
     return false;
 }
@@ -880,6 +896,10 @@ bool QFSFileEngine::supportsExtension(Extension extension) const
         return true;
     if (extension == UnMapExtension || extension == MapExtension)
         return true;
+#ifndef Q_OS_WIN
+    if (extension == AccessPatternHintExtension)
+        return true;
+#endif
     return false;
 }
 
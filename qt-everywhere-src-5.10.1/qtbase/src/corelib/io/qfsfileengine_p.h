@@ -177,6 +177,19 @@ public:
     bool unmap(uchar *ptr);
     void unmapAll();
 
+#ifndef Q_OS_WIN
+    bool setAccessPatternHints(QFile::AccessPatternHints hints);
+    qint64 readMapped(char *data, qint64 len);
+    void releaseReadWindow();
+
+    QFile::AccessPatternHints accessPatternHints;
+    // large sequential reads are copied from this mapping of the file
+    uchar *readWindow;
+    qint64 readWindowOffset;
+    qint64 readWindowSize;
+    bool mappedReads;
+#endif
+
     mutable QFileSystemMetaData metaData;
 
     FILE *fh;
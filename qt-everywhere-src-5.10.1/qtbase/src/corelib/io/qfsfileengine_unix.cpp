@@ -90,6 +90,12 @@ static inline int openModeToOpenFlags(QIODevice::OpenMode mode)
     return oflags;
 }
 
+// Files at least this large are read through a mapping when opened with
+// QFile::SequentialAccessHint; smaller files gain nothing over read().
+static const qint64 MappedReadThreshold = Q_INT64_C(64) * 1024 * 1024;
+static const qint64 MappedReadWindowSize = Q_INT64_C(16) * 1024 * 1024;
+static const qint64 MappedReadMinimumSize = Q_INT64_C(1024) * 1024;
+
 static inline QString msgOpenDirectory()
 {
     const char message[] = QT_TRANSLATE_NOOP("QIODevice", "file to open is a directory");
@@ -161,6 +167,8 @@ bool QFSFileEnginePrivate::nativeOpen(QIODevice::OpenMode openMode)
 */
 bool QFSFileEnginePrivate::nativeClose()
 {
+    releaseReadWindow();
+    mappedReads = false;
     return closeFdFh();
 }
 
@@ -248,6 +256,12 @@ qint64 QFSFileEnginePrivate::nativeRead(char *data, qint64 len)
         return readBytes;
     }
 
+    if (mappedReads && len >= MappedReadMinimumSize) {
+        const qint64 readBytes = readMapped(data, len);
+        if (readBytes >= 0)
+            return readBytes;
+    }
+
     return readFdFh(data, len);
 }
 
@@ -732,6 +746,118 @@ bool QFSFileEnginePrivate::unmap(uchar *ptr)
 #endif
 }
 
+/*!
+    \internal
+
+    Passes \a hints on to the kernel. Sequential reading of a large file
+    opened for reading only additionally switches to readMapped().
+*/
+bool QFSFileEnginePrivate::setAccessPatternHints(QFile::AccessPatternHints hints)
+{
+    accessPatternHints = hints;
+    releaseReadWindow();
+    mappedReads = false;
+
+    const int handle = nativeHandle();
+    if (handle == -1)
+        return false;
+
+    bool ok = true;
+#if defined(POSIX_FADV_NORMAL) && !defined(Q_OS_ANDROID)
+    int advice = POSIX_FADV_NORMAL;
+    if (hints & QFile::SequentialAccessHint)
+        advice = POSIX_FADV_SEQUENTIAL;
+    else if (hints & QFile::RandomAccessHint)
+        advice = POSIX_FADV_RANDOM;
+    ok = posix_fadvise(handle, 0, 0, advice) == 0;
+    if (hints & QFile::WillNeedHint)
+        ok = posix_fadvise(handle, 0, 0, POSIX_FADV_WILLNEED) == 0 && ok;
+    if (hints & QFile::NoReuseHint)
+        ok = posix_fadvise(handle, 0, 0, POSIX_FADV_NOREUSE) == 0 && ok;
+#elif defined(F_RDAHEAD)
+    // Apple platforms have no posix_fadvise(), but read-ahead can be toggled
+    ok = fcntl(handle, F_RDAHEAD, (hints & QFile::RandomAccessHint) ? 0 : 1) != -1;
+#endif
+
+    if ((hints & QFile::SequentialAccessHint) && !fh && fd != -1
+            && !(openMode & QIODevice::WriteOnly) && !nativeIsSequential()
+            && doStat(QFileSystemMetaData::SizeAttribute)
+            && metaData.size() >= MappedReadThreshold) {
+        mappedReads = true;
+    }
+    return ok;
+}
+
+/*!
+    \internal
+
+    Copies up to \a len bytes at the current position from a memory mapping
+    of the file into \a data, sparing the kernel the copy done by read().
+    The file is mapped one window at a time. Returns -1 if the regular read
+    path has to be used instead, for example at the end of the file.
+*/
+qint64 QFSFileEnginePrivate::readMapped(char *data, qint64 len)
+{
+    const QT_OFF_T pos = QT_LSEEK(fd, 0, SEEK_CUR);
+    QT_STATBUF st;
+    if (pos < 0 || QT_FSTAT(fd, &st) != 0)
+        return -1;
+    // the size is checked on every read, so that we never touch pages
+    // past the end of a file that was truncated in the meantime
+    const qint64 fileSize = st.st_size;
+
+    qint64 copied = 0;
+    while (copied < len && pos + copied < fileSize) {
+        const qint64 offset = pos + copied;
+        if (!readWindow || offset < readWindowOffset || offset >= readWindowOffset + readWindowSize) {
+            releaseReadWindow();
+            const qint64 windowOffset = offset & ~(MappedReadWindowSize - 1);
+            const qint64 windowSize = qMin(MappedReadWindowSize, fileSize - windowOffset);
+            void *address = QT_MMAP(0, size_t(windowSize), PROT_READ, MAP_SHARED, fd, QT_OFF_T(windowOffset));
+            if (address == MAP_FAILED) {
+                // e.g. a file system that cannot be mapped; don't try again
+                mappedReads = false;
+                break;
+            }
+#if defined(MADV_SEQUENTIAL) && !defined(Q_OS_INTEGRITY)
+            madvise(address, size_t(windowSize), MADV_SEQUENTIAL);
+#endif
+            readWindow = static_cast<uchar *>(address);
+            readWindowOffset = windowOffset;
+            readWindowSize = windowSize;
+        }
+
+        const qint64 chunk = qMin(len - copied,
+                                  qMin(readWindowOffset + readWindowSize, fileSize) - offset);
+        memcpy(data + copied, readWindow + (offset - readWindowOffset), size_t(chunk));
+        copied += chunk;
+    }
+
+    if (copied == 0)
+        return -1;
+    QT_LSEEK(fd, QT_OFF_T(pos + copied), SEEK_SET);
+    return copied;
+}
+
+/*!
+    \internal
+*/
+void QFSFileEnginePrivate::releaseReadWindow()
+{
+    if (!readWindow)
+        return;
+#if !defined(Q_OS_INTEGRITY)
+    munmap(readWindow, size_t(readWindowSize));
+#endif
+#if defined(POSIX_FADV_DONTNEED) && !defined(Q_OS_ANDROID)
+    if (accessPatternHints & QFile::NoReuseHint)
+        posix_fadvise(fd, readWindowOffset, readWindowSize, POSIX_FADV_DONTNEED);
+#endif
+    readWindow = 0;
+    readWindowOffset = 0;
+    readWindowSize = 0;
+}
+
 /*!
     \reimp
 */
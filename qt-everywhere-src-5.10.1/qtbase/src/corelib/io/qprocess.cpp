@@ -1949,6 +1949,11 @@ void QProcess::setProcessState(ProcessState state)
 
     \warning This function is called by QProcess on Unix and \macos
     only. On Windows and QNX, it is not called.
+
+    \note If neither this function is reimplemented nor a working directory
+    is set, QProcess may start the program with \c posix_spawn() instead of
+    \c fork(), which doesn't need to copy the address space of a large
+    parent process.
 */
 void QProcess::setupChildProcess()
 {
@@ -351,6 +351,7 @@ public:
     void startProcess();
 #if defined(Q_OS_UNIX)
     void execChild(const char *workingDirectory, char **argv, char **envp);
+    int spawnChild(char **argv, char **envp, pid_t *ppid);
 #endif
     bool processStarted(QString *errorMessage = Q_NULLPTR);
     void terminateProcess();
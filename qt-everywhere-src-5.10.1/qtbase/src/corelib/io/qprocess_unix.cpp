@@ -118,6 +118,19 @@ QT_END_NAMESPACE
 #include <forkfd.h>
 #endif
 
+// posix_spawn needs no copy of the parent's address space, but it can only be
+// used if spawnfd() is available and we can tell when setupChildProcess() is
+// overridden
+#if QT_CONFIG(process) && _POSIX_SPAWN > 0 && !(defined(__FreeBSD__) && __FreeBSD__ >= 9) \
+    && (defined(__GXX_RTTI) || defined(__cpp_rtti))
+#  define QPROCESS_USE_SPAWNFD
+#  include <signal.h>
+#  include <typeinfo>
+#  ifdef Q_OS_DARWIN
+#    include <crt_externs.h>
+#  endif
+#endif
+
 QT_BEGIN_NAMESPACE
 
 #if !defined(Q_OS_DARWIN)
@@ -360,6 +373,12 @@ static char **_q_dupEnvironment(const QProcessEnvironmentPrivate::Map &environme
     return envp;
 }
 
+struct ChildError
+{
+    int code;
+    char function[8];
+};
+
 void QProcessPrivate::startProcess()
 {
     Q_Q(QProcess);
@@ -452,9 +471,17 @@ void QProcessPrivate::startProcess()
         workingDirPtr = encodedWorkingDirectory.constData();
     }
 
-    // Start the process manager, and fork off the child process.
-    pid_t childPid;
-    forkfd = ::forkfd(FFD_CLOEXEC, &childPid);
+    // Start the process manager, and fork off the child process. Unless
+    // something has to run in the child before exec, spawn it instead, which
+    // doesn't need to copy the page tables of the parent.
+    pid_t childPid = 0;
+#ifdef QPROCESS_USE_SPAWNFD
+    const bool spawn = workingDirPtr == 0 && typeid(*q) == typeid(QProcess);
+    if (spawn)
+        forkfd = spawnChild(argv, envp, &childPid);
+    else
+#endif
+        forkfd = ::forkfd(FFD_CLOEXEC, &childPid);
     int lastForkErrno = errno;
     if (forkfd != FFD_CHILD_PROCESS) {
         // Parent process.
@@ -471,6 +498,16 @@ void QProcessPrivate::startProcess()
     // This is intentional because we only want to handle failure to fork()
     // here, which is a rare occurrence. Handling of the failure to start is
     // done elsewhere.
+#ifdef QPROCESS_USE_SPAWNFD
+    if (spawn && forkfd == -1) {
+        // posix_spawn reports a failure to exec directly; pass it on the
+        // way the child would have, so that it's handled the same
+        ChildError error = { lastForkErrno, {} };
+        strcpy(error.function, environment.d.constData() ? "execve" : "execvp");
+        qt_safe_write(childStartedPipe[1], &error, sizeof(error));
+        childPid = 0;
+    } else
+#endif
     if (forkfd == -1) {
         // Cleanup, report error and return
 #if defined (QPROCESS_DEBUG)
@@ -519,18 +556,59 @@ void QProcessPrivate::startProcess()
     if (stderrChannel.pipe[0] != -1)
         ::fcntl(stderrChannel.pipe[0], F_SETFL, ::fcntl(stderrChannel.pipe[0], F_GETFL) | O_NONBLOCK);
 
-    if (threadData->eventDispatcher) {
+    if (threadData->eventDispatcher && forkfd != -1) {
         deathNotifier = new QSocketNotifier(forkfd, QSocketNotifier::Read, q);
         QObject::connect(deathNotifier, SIGNAL(activated(int)),
                          q, SLOT(_q_processDied()));
     }
 }
 
-struct ChildError
+#ifdef QPROCESS_USE_SPAWNFD
+int QProcessPrivate::spawnChild(char **argv, char **envp, pid_t *ppid)
 {
-    int code;
-    char function[8];
-};
+    posix_spawn_file_actions_t fileActions;
+    posix_spawnattr_t attributes;
+    posix_spawn_file_actions_init(&fileActions);
+    posix_spawnattr_init(&attributes);
+
+    // the same redirections as in execChild()
+    if (inputChannelMode != QProcess::ForwardedInputChannel)
+        posix_spawn_file_actions_adddup2(&fileActions, stdinChannel.pipe[0], STDIN_FILENO);
+
+    if (processChannelMode != QProcess::ForwardedChannels) {
+        if (processChannelMode != QProcess::ForwardedOutputChannel)
+            posix_spawn_file_actions_adddup2(&fileActions, stdoutChannel.pipe[1], STDOUT_FILENO);
+
+        if (processChannelMode == QProcess::MergedChannels) {
+            posix_spawn_file_actions_adddup2(&fileActions, STDOUT_FILENO, STDERR_FILENO);
+        } else if (processChannelMode != QProcess::ForwardedErrorChannel) {
+            posix_spawn_file_actions_adddup2(&fileActions, stderrChannel.pipe[1], STDERR_FILENO);
+        }
+    }
+
+    // reset the signal that we ignored
+    sigset_t defaultSignals;
+    sigemptyset(&defaultSignals);
+    sigaddset(&defaultSignals, SIGPIPE);
+    posix_spawnattr_setsigdefault(&attributes, &defaultSignals);
+    posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETSIGDEF);
+
+    if (!envp) {
+#ifdef Q_OS_DARWIN
+        envp = *_NSGetEnviron();
+#else
+        envp = environ;
+#endif
+    }
+
+    int ffd = ::spawnfd(FFD_CLOEXEC, ppid, argv[0], &fileActions, &attributes, argv, envp);
+    int savedErrno = errno;
+    posix_spawnattr_destroy(&attributes);
+    posix_spawn_file_actions_destroy(&fileActions);
+    errno = savedErrno;
+    return ffd;
+}
+#endif
 
 void QProcessPrivate::execChild(const char *workingDir, char **argv, char **envp)
 {
@@ -98,7 +98,8 @@ class QResourceRoot
     enum Flags
     {
         Compressed = 0x01,
-        Directory = 0x02
+        Directory = 0x02,
+        CompressedChunks = 0x04
     };
     const uchar *tree, *names, *payloads;
     int version;
@@ -115,6 +116,7 @@ public:
     int findNode(const QString &path, const QLocale &locale=QLocale()) const;
     inline bool isContainer(int node) const { return flags(node) & Directory; }
     inline bool isCompressed(int node) const { return flags(node) & Compressed; }
+    inline bool isCompressedInChunks(int node) const { return flags(node) & CompressedChunks; }
     const uchar *data(int node, qint64 *size) const;
     QDateTime lastModified(int node) const;
     QStringList children(int node) const;
@@ -136,6 +138,109 @@ protected:
     }
 };
 
+// Random access to a resource compressed in chunks by rcc -chunk-size,
+// see compressChunks() in rcc.cpp for the layout
+class QResourceChunks
+{
+public:
+    QResourceChunks()
+        : table(0), chunks(0), chunksSize(0), total(0), chunkSize(0), chunkCount(0),
+          cachedChunk(-1)
+    {}
+
+    bool setData(const uchar *data, qint64 size);
+    qint64 size() const { return total; }
+    qint64 read(qint64 pos, char *out, qint64 len);
+    QByteArray readAll();
+
+private:
+    bool loadChunk(int index);
+
+    const uchar *table;
+    const uchar *chunks;
+    qint64 chunksSize;
+    quint32 total;
+    quint32 chunkSize;
+    quint32 chunkCount;
+    int cachedChunk;
+    QByteArray cache;
+};
+
+bool QResourceChunks::setData(const uchar *data, qint64 size)
+{
+    table = 0;
+    cachedChunk = -1;
+    cache.clear();
+    if (!data || size < 12)
+        return false;
+    total = qFromBigEndian<quint32>(data);
+    chunkSize = qFromBigEndian<quint32>(data + 4);
+    chunkCount = qFromBigEndian<quint32>(data + 8);
+    const qint64 tableSize = 12 + 4 * (qint64(chunkCount) + 1);
+    if (chunkSize == 0 || size < tableSize
+            || qint64(chunkCount) != (qint64(total) + chunkSize - 1) / chunkSize) {
+        return false;
+    }
+    table = data + 12;
+    chunks = data + tableSize;
+    chunksSize = size - tableSize;
+    if (qFromBigEndian<quint32>(table + 4 * chunkCount) > chunksSize) {
+        table = 0;
+        return false;
+    }
+    return true;
+}
+
+bool QResourceChunks::loadChunk(int index)
+{
+    if (index == cachedChunk)
+        return true;
+#ifndef QT_NO_COMPRESS
+    const quint32 begin = qFromBigEndian<quint32>(table + 4 * index);
+    const quint32 end = qFromBigEndian<quint32>(table + 4 * (index + 1));
+    if (begin > end || end > chunksSize)
+        return false;
+    cache = qUncompress(chunks + begin, int(end - begin));
+    if (quint32(cache.size()) != qMin(chunkSize, total - quint32(index) * chunkSize)) {
+        cache.clear();
+        cachedChunk = -1;
+        return false;
+    }
+    cachedChunk = index;
+    return true;
+#else
+    Q_UNUSED(index);
+    return false;
+#endif
+}
+
+qint64 QResourceChunks::read(qint64 pos, char *out, qint64 len)
+{
+    if (!table || pos < 0)
+        return -1;
+    qint64 done = 0;
+    while (done < len && pos + done < total) {
+        const int index = int((pos + done) / chunkSize);
+        if (!loadChunk(index))
+            return done ? done : -1;
+        const qint64 inChunk = pos + done - qint64(index) * chunkSize;
+        const qint64 n = qMin(len - done, cache.size() - inChunk);
+        memcpy(out + done, cache.constData() + inChunk, size_t(n));
+        done += n;
+    }
+    return done;
+}
+
+QByteArray QResourceChunks::readAll()
+{
+    QByteArray result(int(total), Qt::Uninitialized);
+    if (read(0, result.data(), total) != total)
+        result.clear();
+    cache.clear();
+    cachedChunk = -1;
+    return result;
+}
+
 static QString cleanPath(const QString &_path)
 {
     QString path = QDir::cleanPath(_path);
@@ -242,8 +347,14 @@ public:
     QList<QResourceRoot*> related;
     uint container : 1;
     mutable uint compressed : 1;
+    mutable uint chunked : 1;
     mutable qint64 size;
     mutable const uchar *data;
+    // the payload of a resource compressed in chunks, and its contents once
+    // data() has been called
+    const uchar *chunkedData;
+    qint64 chunkedSize;
+    mutable QByteArray uncompressedChunks;
     mutable QStringList children;
     mutable QDateTime lastModified;
 
@@ -256,8 +367,12 @@ QResourcePrivate::clear()
 {
     absoluteFilePath.clear();
     compressed = 0;
+    chunked = 0;
     data = 0;
     size = 0;
+    chunkedData = 0;
+    chunkedSize = 0;
+    uncompressedChunks.clear();
     children.clear();
     lastModified = QDateTime();
     container = 0;
@@ -285,6 +400,15 @@ QResourcePrivate::load(const QString &file)
                 if(!container) {
                     data = res->data(node, &size);
                     compressed = res->isCompressed(node);
+                    chunked = res->isCompressedInChunks(node);
+                    if (chunked) {
+                        // the contents are uncompressed when data() is called
+                        QResourceChunks chunks;
+                        chunkedData = data;
+                        chunkedSize = size;
+                        size = chunks.setData(data, size) ? chunks.size() : 0;
+                        data = 0;
+                    }
                 } else {
                     data = 0;
                     size = 0;
@@ -521,6 +645,11 @@ qint64 QResource::size() const
     compressed and qUncompress() must be used to access the data. If the
     resource is a directory 0 is returned.
 
+    Resources that rcc compressed in blocks, with its \c{-chunk-size}
+    option, are not reported as compressed: the first call to this function
+    uncompresses them in memory. Reading them through QFile only
+    uncompresses the blocks that are read.
+
     \sa size(), isCompressed(), isFile()
 */
 
@@ -528,6 +657,12 @@ const uchar *QResource::data() const
 {
     Q_D(const QResource);
     d->ensureInitialized();
+    if (d->chunked && !d->data) {
+        QResourceChunks chunks;
+        if (chunks.setData(d->chunkedData, d->chunkedSize))
+            d->uncompressedChunks = chunks.readAll();
+        d->data = reinterpret_cast<const uchar *>(d->uncompressedChunks.constData());
+    }
     return d->data;
 }
 
@@ -1226,6 +1361,8 @@ private:
     qint64 offset;
     QResource resource;
     mutable QByteArray uncompressed;
+    // only the chunks that are read of resources compressed in chunks
+    QResourceChunks chunks;
 protected:
     QResourceFileEnginePrivate() : offset(0) { }
 };
@@ -1282,6 +1419,11 @@ bool QResourceFileEngine::open(QIODevice::OpenMode flags)
     if(flags & QIODevice::WriteOnly)
         return false;
     d->uncompress();
+    const QResourcePrivate *resource = d->resource.d_func();
+    if (resource->chunked && !d->chunks.setData(resource->chunkedData, resource->chunkedSize)) {
+        d->errorString = QSystemError::stdString(EIO);
+        return false;
+    }
     if (!d->resource.isValid()) {
         d->errorString = QSystemError::stdString(ENOENT);
         return false;
@@ -1294,6 +1436,7 @@ bool QResourceFileEngine::close()
     Q_D(QResourceFileEngine);
     d->offset = 0;
     d->uncompressed.clear();
+    d->chunks = QResourceChunks();
     return true;
 }
 
@@ -1309,7 +1452,13 @@ qint64 QResourceFileEngine::read(char *data, qint64 len)
         len = size()-d->offset;
     if(len <= 0)
         return 0;
-    if(d->resource.isCompressed())
+    if (d->resource.d_func()->chunked) {
+        len = d->chunks.read(d->offset, data, len);
+        if (len < 0) {
+            setError(QFile::ReadError, QSystemError::stdString(EIO));
+            return -1;
+        }
+    } else if(d->resource.isCompressed())
         memcpy(data, d->uncompressed.constData()+d->offset, len);
     else
         memcpy(data, d->resource.data()+d->offset, len);
@@ -71,6 +71,10 @@
 #ifndef QT_BOOTSTRAPPED
 #include "qsavefile.h"
 #include "qlockfile.h"
+#ifndef QT_NO_THREAD
+#include "qrunnable.h"
+#include "qthreadpool.h"
+#endif
 #endif
 
 #ifdef Q_OS_VXWORKS
@@ -344,7 +348,10 @@ void QSettingsPrivate::setStatus(QSettings::Status status) const
 
 void QSettingsPrivate::update()
 {
-    flush();
+    if (backgroundSync)
+        backgroundFlush();
+    else
+        flush();
     pendingChanges = false;
 }
 
@@ -1128,7 +1135,8 @@ QConfFileSettingsPrivate::QConfFileSettingsPrivate(QSettings::Format format,
                                                    const QString &organization,
                                                    const QString &application)
     : QSettingsPrivate(format, scope, organization, application),
-      nextPosition(0x40000000) // big positive number
+      nextPosition(0x40000000), // big positive number
+      backgroundSyncRunning(false), backgroundSyncRequested(false)
 {
     initFormat();
 
@@ -1187,7 +1195,8 @@ QConfFileSettingsPrivate::QConfFileSettingsPrivate(QSettings::Format format,
 QConfFileSettingsPrivate::QConfFileSettingsPrivate(const QString &fileName,
                                                    QSettings::Format format)
     : QSettingsPrivate(format),
-      nextPosition(0x40000000) // big positive number
+      nextPosition(0x40000000), // big positive number
+      backgroundSyncRunning(false), backgroundSyncRequested(false)
 {
     initFormat();
 
@@ -1198,6 +1207,8 @@ QConfFileSettingsPrivate::QConfFileSettingsPrivate(const QString &fileName,
 
 QConfFileSettingsPrivate::~QConfFileSettingsPrivate()
 {
+    waitForBackgroundSync();
+
     QMutexLocker locker(&settingsGlobalMutex);
     ConfFileHash *usedHash = usedHashFunc();
     ConfFileCache *unusedCache = unusedCacheFunc();
@@ -1356,6 +1367,13 @@ void QConfFileSettingsPrivate::clear()
 }
 
 void QConfFileSettingsPrivate::sync()
+{
+    // don't let a background sync finish after us with older contents
+    waitForBackgroundSync();
+    syncConfFiles();
+}
+
+void QConfFileSettingsPrivate::syncConfFiles()
 {
     // people probably won't be checking the status a whole lot, so in case of
     // error we just try to go on and make the best of it
@@ -1371,6 +1389,68 @@ void QConfFileSettingsPrivate::flush()
     sync();
 }
 
+#ifndef QT_NO_THREAD
+namespace {
+class QSettingsSyncTask : public QRunnable
+{
+public:
+    explicit QSettingsSyncTask(QConfFileSettingsPrivate *d) : d(d) {}
+
+    void run() Q_DECL_OVERRIDE
+    {
+        d->syncConfFiles();
+        d->finishBackgroundSync();
+    }
+
+private:
+    QConfFileSettingsPrivate *d;
+};
+} // unnamed namespace
+#endif
+
+/*
+    Writes the changes from a thread of the global thread pool. Changes made
+    while a sync is running are written by one more sync once it is done, so
+    that at most one sync per QSettings object runs or waits at any time.
+*/
+void QConfFileSettingsPrivate::backgroundFlush()
+{
+#ifndef QT_NO_THREAD
+    QMutexLocker locker(&backgroundSyncMutex);
+    if (backgroundSyncRunning) {
+        backgroundSyncRequested = true;
+        return;
+    }
+    backgroundSyncRunning = true;
+    locker.unlock();
+    QThreadPool::globalInstance()->start(new QSettingsSyncTask(this));
+#else
+    sync();
+#endif
+}
+
+void QConfFileSettingsPrivate::finishBackgroundSync()
+{
+    for (;;) {
+        QMutexLocker locker(&backgroundSyncMutex);
+        if (!backgroundSyncRequested) {
+            backgroundSyncRunning = false;
+            backgroundSyncDone.wakeAll();
+            return;
+        }
+        backgroundSyncRequested = false;
+        locker.unlock();
+        syncConfFiles();
+    }
+}
+
+void QConfFileSettingsPrivate::waitForBackgroundSync()
+{
+    QMutexLocker locker(&backgroundSyncMutex);
+    while (backgroundSyncRunning)
+        backgroundSyncDone.wait(&backgroundSyncMutex);
+}
+
 QString QConfFileSettingsPrivate::fileName() const
 {
     if (confFiles.isEmpty())
@@ -2939,6 +3019,47 @@ void QSettings::setAtomicSyncRequired(bool enable)
     d->atomicSyncOnly = enable;
 }
 
+/*!
+    \since 5.11
+
+    Returns \c true if changes are written to permanent storage from a
+    background thread.
+
+    The default is \c false.
+
+    \sa setBackgroundSyncEnabled()
+*/
+bool QSettings::isBackgroundSyncEnabled() const
+{
+    Q_D(const QSettings);
+    return d->backgroundSync;
+}
+
+/*!
+    \since 5.11
+
+    If \a enable is \c true, the changes that QSettings writes automatically
+    are written by a thread of QThreadPool::globalInstance(), so that
+    locking, reading back and rewriting the configuration file does not
+    block the thread of this QSettings object. All the changes made before
+    control returns to the event loop are written at once, and changes made
+    while a write is in progress are collected into the next one.
+
+    Explicit calls to sync(), and the destructor, wait for a write in
+    progress and then synchronize in the calling thread, as before.
+
+    The status() of a background write is only available once it is done,
+    for example after calling sync(). This setting has no effect on the
+    native formats of Windows and \macos, which do not write files.
+
+    \sa isBackgroundSyncEnabled(), sync()
+*/
+void QSettings::setBackgroundSyncEnabled(bool enable)
+{
+    Q_D(QSettings);
+    d->backgroundSync = enable;
+}
+
 /*!
     Appends \a prefix to the current group.
 
@@ -57,6 +57,7 @@
 #include "QtCore/qiodevice.h"
 #include "QtCore/qstack.h"
 #include "QtCore/qstringlist.h"
+#include "QtCore/qwaitcondition.h"
 #ifndef QT_NO_QOBJECT
 #include "private/qobject_p.h"
 #endif
@@ -206,6 +207,7 @@ public:
     virtual void clear() = 0;
     virtual void sync() = 0;
     virtual void flush() = 0;
+    virtual void backgroundFlush() { flush(); }
     virtual bool isWritable() const = 0;
     virtual QString fileName() const = 0;
 
@@ -250,6 +252,7 @@ protected:
     bool fallbacks;
     bool pendingChanges;
     bool atomicSyncOnly = true;
+    bool backgroundSync = false;
     mutable QSettings::Status status;
 };
 
@@ -270,9 +273,14 @@ public:
     void clear() Q_DECL_OVERRIDE;
     void sync() Q_DECL_OVERRIDE;
     void flush() Q_DECL_OVERRIDE;
+    void backgroundFlush() Q_DECL_OVERRIDE;
     bool isWritable() const Q_DECL_OVERRIDE;
     QString fileName() const Q_DECL_OVERRIDE;
 
+    void syncConfFiles();
+    void finishBackgroundSync();
+    void waitForBackgroundSync();
+
     bool readIniFile(const QByteArray &data, UnparsedSettingsMap *unparsedIniSections);
     static bool readIniSection(const QSettingsKey &section, const QByteArray &data,
                                ParsedSettingsMap *settingsMap, QTextCodec *codec);
@@ -297,6 +305,12 @@ private:
     QString extension;
     Qt::CaseSensitivity caseSensitivity;
     int nextPosition;
+
+    // a sync running in a thread of the global thread pool
+    QMutex backgroundSyncMutex;
+    QWaitCondition backgroundSyncDone;
+    bool backgroundSyncRunning;
+    bool backgroundSyncRequested;
 };
 
 QT_END_NAMESPACE
@@ -2350,6 +2350,19 @@ void QTextStreamPrivate::putNumber(qulonglong number, bool negative)
 
     const QLocaleData *dd = locale.d->m_data;
     int base = params.integerBase ? params.integerBase : 10;
+    if (base == 10) {
+        // the common case: format into a buffer, without QString temporaries
+        QChar buffer[QLocaleData::IntegerBufferSize];
+        const unsigned decimalFlags = flags & ~(QLocaleData::ShowBase | QLocaleData::UppercaseBase);
+        const int length = negative
+                ? dd->longLongToBuffer(buffer, -static_cast<qlonglong>(number), decimalFlags)
+                : dd->unsLongLongToBuffer(buffer, number, decimalFlags);
+        if (length >= 0) {
+            putString(buffer, length, true);
+            return;
+        }
+    }
+
     if (negative && base == 10) {
         result = dd->longLongToString(-static_cast<qlonglong>(number), -1,
                                       base, -1, flags);
@@ -2569,6 +2582,12 @@ QTextStream &QTextStream::operator<<(double f)
         flags |= QLocaleData::AddTrailingZeroes;
 
     const QLocaleData *dd = d->locale.d->m_data;
+    QChar buffer[QLocaleData::DoubleBufferSize];
+    const int length = dd->doubleToBuffer(buffer, f, d->params.realNumberPrecision, form, flags);
+    if (length >= 0) {
+        d->putString(buffer, length, true);
+        return *this;
+    }
     QString num = dd->doubleToString(f, d->params.realNumberPrecision, form, -1, flags);
     d->putString(num, true);
     return *this;
@@ -45,6 +45,7 @@
 #include <qmimedata.h>
 #include <qdebug.h>
 #include <qvector.h>
+#include <qvarlengtharray.h>
 #include <qstack.h>
 #include <qbitarray.h>
 #include <qdatetime.h>
@@ -809,31 +810,80 @@ void QAbstractItemModelPrivate::itemsMoved(const QModelIndex &sourceParent, int
     movePersistentIndexes(moved_in_destination, destination_change, destinationParent, orientation);
 }
 
-void QAbstractItemModelPrivate::rowsAboutToBeRemoved(const QModelIndex &parent,
-                                                     int first, int last)
-{
-    QVector<QPersistentModelIndexData *>  persistent_moved;
-    QVector<QPersistentModelIndexData *>  persistent_invalidated;
-    // find the persistent indexes that are affected by the change, either by being in the removed subtree
-    // or by being on the same level and below the removed rows
+/*!
+    \internal
+
+    Collects the persistent indexes affected by the removal of the rows (or
+    columns, depending on \a orientation) \a first to \a last under \a parent.
+    Indexes on the same level as the change and after the removed section are
+    appended to \a moved, indexes in the removed subtrees to \a invalidated.
+
+    Persistent indexes in a tree usually share most of their ancestors, so the
+    outcome of the walk up to the changed level is remembered for every
+    ancestor visited. This keeps the scan linear in the number of persistent
+    indexes and distinct ancestors, instead of calling parent() up to the root
+    for every single persistent index.
+*/
+void QAbstractItemModelPrivate::findPersistentIndexesToRemove(const QModelIndex &parent,
+                                                              int first, int last,
+                                                              Qt::Orientation orientation,
+                                                              QVector<QPersistentModelIndexData *> *moved,
+                                                              QVector<QPersistentModelIndexData *> *invalidated)
+{
+    const bool vertical = (orientation == Qt::Vertical);
+    QHash<QModelIndex, bool> removedAncestors;
+    QVarLengthArray<QModelIndex, 16> path;
     for (QHash<QModelIndex, QPersistentModelIndexData *>::const_iterator it = persistent.indexes.constBegin();
          it != persistent.indexes.constEnd(); ++it) {
         QPersistentModelIndexData *data = *it;
-        bool level_changed = false;
-        QModelIndex current = data->index;
+        const QModelIndex &index = data->index;
+        if (!index.isValid())
+            continue;
+        QModelIndex current_parent = index.parent();
+        if (current_parent == parent) { // on the same level as the change
+            const int position = vertical ? index.row() : index.column();
+            if (position > last) // below (or right of) the removed section
+                moved->append(data);
+            else if (position >= first) // in the removed section
+                invalidated->append(data);
+            continue;
+        }
+
+        // walk up to the level of the change, stopping at the first ancestor we already know about
+        bool removed = false;
+        path.clear();
+        QModelIndex current = current_parent;
         while (current.isValid()) {
-            QModelIndex current_parent = current.parent();
-            if (current_parent == parent) { // on the same level as the change
-                if (!level_changed && current.row() > last) // below the removed rows
-                    persistent_moved.append(data);
-                else if (current.row() <= last && current.row() >= first) // in the removed subtree
-                    persistent_invalidated.append(data);
+            const QHash<QModelIndex, bool>::const_iterator known = removedAncestors.constFind(current);
+            if (known != removedAncestors.constEnd()) {
+                removed = known.value();
+                break;
+            }
+            path.append(current);
+            current_parent = current.parent();
+            if (current_parent == parent) { // the ancestor is on the same level as the change
+                const int position = vertical ? current.row() : current.column();
+                removed = (position >= first && position <= last);
                 break;
             }
             current = current_parent;
-            level_changed = true;
         }
+        for (const QModelIndex &ancestor : qAsConst(path))
+            removedAncestors.insert(ancestor, removed);
+        if (removed) // in the removed subtree
+            invalidated->append(data);
     }
+}
+
+void QAbstractItemModelPrivate::rowsAboutToBeRemoved(const QModelIndex &parent,
+                                                     int first, int last)
+{
+    QVector<QPersistentModelIndexData *>  persistent_moved;
+    QVector<QPersistentModelIndexData *>  persistent_invalidated;
+    // find the persistent indexes that are affected by the change, either by being in the removed subtree
+    // or by being on the same level and below the removed rows
+    findPersistentIndexesToRemove(parent, first, last, Qt::Vertical,
+                                  &persistent_moved, &persistent_invalidated);
 
     persistent.moved.push(persistent_moved);
     persistent.invalidated.push(persistent_invalidated);
@@ -910,24 +960,8 @@ void QAbstractItemModelPrivate::columnsAboutToBeRemoved(const QModelIndex &paren
     QVector<QPersistentModelIndexData *> persistent_invalidated;
     // find the persistent indexes that are affected by the change, either by being in the removed subtree
     // or by being on the same level and to the right of the removed columns
-    for (QHash<QModelIndex, QPersistentModelIndexData *>::const_iterator it = persistent.indexes.constBegin();
-         it != persistent.indexes.constEnd(); ++it) {
-        QPersistentModelIndexData *data = *it;
-        bool level_changed = false;
-        QModelIndex current = data->index;
-        while (current.isValid()) {
-            QModelIndex current_parent = current.parent();
-            if (current_parent == parent) { // on the same level as the change
-                if (!level_changed && current.column() > last) // right of the removed columns
-                    persistent_moved.append(data);
-                else if (current.column() <= last && current.column() >= first) // in the removed subtree
-                    persistent_invalidated.append(data);
-                break;
-            }
-            current = current_parent;
-            level_changed = true;
-        }
-    }
+    findPersistentIndexesToRemove(parent, first, last, Qt::Horizontal,
+                                  &persistent_moved, &persistent_invalidated);
 
     persistent.moved.push(persistent_moved);
     persistent.invalidated.push(persistent_invalidated);
@@ -982,6 +1016,182 @@ void QAbstractItemModel::resetInternalData()
 
 }
 
+/*!
+    \class QModelRoleData
+    \inmodule QtCore
+    \since 5.11
+    \ingroup model-view
+
+    \brief The QModelRoleData class holds a role and the data associated to that role.
+
+    A QModelRoleData object names a role and stores a QVariant for its data.
+    It is used with QAbstractItemModel::multiData() to retrieve the data of
+    several roles of an item in one call.
+
+    \sa QModelRoleDataSpan, QAbstractItemModel::multiData()
+*/
+
+/*!
+    \fn QModelRoleData::QModelRoleData()
+
+    Constructs a QModelRoleData object for the invalid role -1. This
+    constructor exists so that QModelRoleData can be stored in a QVector.
+*/
+
+/*!
+    \fn QModelRoleData::QModelRoleData(int role)
+
+    Constructs a QModelRoleData object for the given \a role, with an
+    invalid QVariant as its data.
+*/
+
+/*!
+    \fn int QModelRoleData::role() const
+
+    Returns the role held by this object.
+*/
+
+/*!
+    \fn const QVariant &QModelRoleData::data() const
+
+    Returns the data held by this object.
+*/
+
+/*!
+    \fn QVariant &QModelRoleData::data()
+
+    Returns the data held by this object, as a modifiable reference.
+*/
+
+/*!
+    \fn void QModelRoleData::setData(const QVariant &value)
+
+    Sets the data held by this object to \a value.
+*/
+
+/*!
+    \fn void QModelRoleData::setData(QVariant &&value)
+    \overload
+*/
+
+/*!
+    \fn template <typename T> void QModelRoleData::setData(const T &value)
+    \overload
+
+    Sets the data held by this object to a QVariant holding \a value.
+*/
+
+/*!
+    \fn void QModelRoleData::clearData()
+
+    Clears the data held by this object. Afterwards, data() returns an
+    invalid QVariant.
+*/
+
+/*!
+    \class QModelRoleDataSpan
+    \inmodule QtCore
+    \since 5.11
+    \ingroup model-view
+
+    \brief The QModelRoleDataSpan class provides a span over QModelRoleData objects.
+
+    A QModelRoleDataSpan refers to a contiguous array of QModelRoleData
+    objects, such as a C array, a QVector or a std::vector, without owning
+    it. It is passed by value to QAbstractItemModel::multiData(), which fills
+    in the data of every element:
+
+    \code
+    QModelRoleData roleData[] = {
+        QModelRoleData(Qt::DisplayRole),
+        QModelRoleData(Qt::DecorationRole),
+        QModelRoleData(Qt::ToolTipRole)
+    };
+    index.multiData(roleData);
+    const QString text = roleData[0].data().toString();
+    \endcode
+
+    The array must outlive the span.
+
+    \sa QModelRoleData, QAbstractItemModel::multiData()
+*/
+
+/*!
+    \fn QModelRoleDataSpan::QModelRoleDataSpan()
+
+    Constructs an empty span.
+*/
+
+/*!
+    \fn QModelRoleDataSpan::QModelRoleDataSpan(QModelRoleData &modelRoleData)
+
+    Constructs a span of size 1 over \a modelRoleData.
+*/
+
+/*!
+    \fn QModelRoleDataSpan::QModelRoleDataSpan(QModelRoleData *modelRoleData, qsizetype len)
+
+    Constructs a span over the \a len objects starting at \a modelRoleData.
+*/
+
+/*!
+    \fn template <size_t N> QModelRoleDataSpan::QModelRoleDataSpan(QModelRoleData (&modelRoleData)[N])
+
+    Constructs a span over the array \a modelRoleData.
+*/
+
+/*!
+    \fn template <typename Container> QModelRoleDataSpan::QModelRoleDataSpan(Container &c)
+
+    Constructs a span over the container \a c, which must store its
+    QModelRoleData objects contiguously and provide \c{data()} and
+    \c{size()}, like QVector and std::vector do.
+*/
+
+/*!
+    \fn qsizetype QModelRoleDataSpan::size() const
+
+    Returns the number of objects in the span.
+*/
+
+/*!
+    \fn qsizetype QModelRoleDataSpan::length() const
+
+    Same as size().
+*/
+
+/*!
+    \fn QModelRoleData *QModelRoleDataSpan::data() const
+
+    Returns a pointer to the first object in the span.
+*/
+
+/*!
+    \fn QModelRoleData *QModelRoleDataSpan::begin() const
+
+    Returns a pointer to the first object in the span.
+*/
+
+/*!
+    \fn QModelRoleData *QModelRoleDataSpan::end() const
+
+    Returns a pointer one past the last object in the span.
+*/
+
+/*!
+    \fn QModelRoleData &QModelRoleDataSpan::operator[](qsizetype index) const
+
+    Returns the object at position \a index, which must be smaller than
+    size().
+*/
+
+/*!
+    \fn QVariant *QModelRoleDataSpan::dataForRole(int role) const
+
+    Returns a pointer to the data of the first object in the span whose role
+    is \a role. The span must contain such an object.
+*/
+
 /*!
     \class QModelIndex
     \inmodule QtCore
@@ -1131,6 +1341,16 @@ void QAbstractItemModel::resetInternalData()
     index.
 */
 
+/*!
+    \fn void QModelIndex::multiData(QModelRoleDataSpan roleDataSpan) const
+    \since 5.11
+
+    Populates the given \a roleDataSpan for the item referred to by the
+    index.
+
+    \sa QAbstractItemModel::multiData()
+*/
+
 /*!
     \fn Qt::ItemFlags QModelIndex::flags() const
     \since 4.2
@@ -2453,6 +2673,35 @@ QHash<int,QByteArray> QAbstractItemModel::roleNames() const
     return d->roleNames;
 }
 
+/*!
+    \since 5.11
+
+    Fills the \a roleDataSpan with the data of the item at \a index, for the
+    roles requested by its elements.
+
+    Views and delegates that need several roles of an item, for instance to
+    paint it, call this function once instead of calling data() for every
+    role. A model that can look up many roles of an item at once, because
+    they are stored together or because finding the item is expensive,
+    should reimplement it: one call then replaces as many virtual data()
+    calls as there are roles.
+
+    The default implementation calls data() for every element of the span.
+    A reimplementation must produce the same values as data(); elements
+    for roles that the item has no data for must be left as (or set to) an
+    invalid QVariant.
+
+    The \a index must be valid and belong to this model.
+
+    \sa data(), QModelRoleData, QModelRoleDataSpan
+*/
+void QAbstractItemModel::multiData(const QModelIndex &index, QModelRoleDataSpan roleDataSpan) const
+{
+    Q_ASSERT(index.isValid() && index.model() == this);
+    for (QModelRoleData &roleData : roleDataSpan)
+        roleData.setData(data(index, roleData.role()));
+}
+
 /*!
     Lets the model know that it should submit cached information to permanent
     storage. This function is typically used for row editing.
@@ -48,6 +48,86 @@
 QT_BEGIN_NAMESPACE
 
 
+class QModelRoleData
+{
+    int m_role;
+    QVariant m_data;
+
+public:
+    QModelRoleData() Q_DECL_NOTHROW // for QVector
+        : m_role(-1)
+    {}
+
+    explicit QModelRoleData(int role) Q_DECL_NOTHROW
+        : m_role(role)
+    {}
+
+    int role() const Q_DECL_NOTHROW { return m_role; }
+    const QVariant &data() const Q_DECL_NOTHROW { return m_data; }
+    QVariant &data() Q_DECL_NOTHROW { return m_data; }
+
+    void setData(const QVariant &value) { m_data = value; }
+#ifdef Q_COMPILER_RVALUE_REFS
+    void setData(QVariant &&value) Q_DECL_NOTHROW { m_data = std::move(value); }
+#endif
+    template <typename T>
+    void setData(const T &value) { m_data.setValue(value); }
+
+    void clearData() Q_DECL_NOTHROW { m_data.clear(); }
+};
+
+Q_DECLARE_TYPEINFO(QModelRoleData, Q_MOVABLE_TYPE);
+
+class QModelRoleDataSpan
+{
+    QModelRoleData *m_modelRoleData;
+    qsizetype m_len;
+
+public:
+    Q_DECL_CONSTEXPR QModelRoleDataSpan() Q_DECL_NOTHROW
+        : m_modelRoleData(Q_NULLPTR), m_len(0)
+    {}
+
+    Q_DECL_CONSTEXPR QModelRoleDataSpan(QModelRoleData &modelRoleData) Q_DECL_NOTHROW
+        : m_modelRoleData(&modelRoleData), m_len(1)
+    {}
+
+    Q_DECL_CONSTEXPR QModelRoleDataSpan(QModelRoleData *modelRoleData, qsizetype len)
+        : m_modelRoleData(modelRoleData), m_len(len)
+    {}
+
+    template <size_t N>
+    Q_DECL_CONSTEXPR QModelRoleDataSpan(QModelRoleData (&modelRoleData)[N]) Q_DECL_NOTHROW
+        : m_modelRoleData(modelRoleData), m_len(qsizetype(N))
+    {}
+
+    // QVector<QModelRoleData>, std::vector<QModelRoleData>, ...
+    template <typename Container,
+              typename = typename std::enable_if<std::is_convertible<
+                  decltype(std::declval<Container &>().data()), QModelRoleData *>::value>::type>
+    QModelRoleDataSpan(Container &c)
+        : m_modelRoleData(c.data()), m_len(qsizetype(c.size()))
+    {}
+
+    Q_DECL_CONSTEXPR qsizetype size() const Q_DECL_NOTHROW { return m_len; }
+    Q_DECL_CONSTEXPR qsizetype length() const Q_DECL_NOTHROW { return m_len; }
+    Q_DECL_CONSTEXPR QModelRoleData *data() const Q_DECL_NOTHROW { return m_modelRoleData; }
+    Q_DECL_CONSTEXPR QModelRoleData *begin() const Q_DECL_NOTHROW { return m_modelRoleData; }
+    Q_DECL_CONSTEXPR QModelRoleData *end() const Q_DECL_NOTHROW { return m_modelRoleData + m_len; }
+    Q_DECL_CONSTEXPR QModelRoleData &operator[](qsizetype index) const { return m_modelRoleData[index]; }
+
+    QVariant *dataForRole(int role) const
+    {
+        QModelRoleData *it = begin();
+        while (it != end() && it->role() != role)
+            ++it;
+        Q_ASSERT(it != end());
+        return &it->data();
+    }
+};
+
+Q_DECLARE_TYPEINFO(QModelRoleDataSpan, Q_MOVABLE_TYPE);
+
 class QAbstractItemModel;
 class QPersistentModelIndex;
 
@@ -67,6 +147,7 @@ public:
     QT_DEPRECATED_X("Use QAbstractItemModel::index") inline QModelIndex child(int row, int column) const;
 #endif
     inline QVariant data(int role = Qt::DisplayRole) const;
+    inline void multiData(QModelRoleDataSpan roleDataSpan) const;
     inline Qt::ItemFlags flags() const;
     Q_DECL_CONSTEXPR inline const QAbstractItemModel *model() const Q_DECL_NOTHROW { return m; }
     Q_DECL_CONSTEXPR inline bool isValid() const Q_DECL_NOTHROW { return (r >= 0) && (c >= 0) && (m != Q_NULLPTR); }
@@ -240,6 +321,8 @@ public:
 
     virtual QHash<int,QByteArray> roleNames() const;
 
+    virtual void multiData(const QModelIndex &index, QModelRoleDataSpan roleDataSpan) const;
+
     using QObject::parent;
 
     enum LayoutChangeHint
@@ -431,6 +514,9 @@ inline QModelIndex QModelIndex::child(int arow, int acolumn) const
 inline QVariant QModelIndex::data(int arole) const
 { return m ? m->data(*this, arole) : QVariant(); }
 
+inline void QModelIndex::multiData(QModelRoleDataSpan roleDataSpan) const
+{ if (m) m->multiData(*this, roleDataSpan); }
+
 inline Qt::ItemFlags QModelIndex::flags() const
 { return m ? m->flags(*this) : Qt::ItemFlags(); }
 
@@ -90,6 +90,9 @@ public:
     void columnsInserted(const QModelIndex &parent, int first, int last);
     void columnsAboutToBeRemoved(const QModelIndex &parent, int first, int last);
     void columnsRemoved(const QModelIndex &parent, int first, int last);
+    void findPersistentIndexesToRemove(const QModelIndex &parent, int first, int last, Qt::Orientation orientation,
+                                       QVector<QPersistentModelIndexData *> *moved,
+                                       QVector<QPersistentModelIndexData *> *invalidated);
     static QAbstractItemModel *staticEmptyModel();
     static bool variantLessThan(const QVariant &v1, const QVariant &v2);
 
@@ -49,8 +49,20 @@
 #include <qstringlist.h>
 #include <private/qabstractitemmodel_p.h>
 #include <private/qabstractproxymodel_p.h>
+#ifndef QT_NO_THREAD
+#include <qrunnable.h>
+#include <qsemaphore.h>
+#include <qthread.h>
+#include <qthreadpool.h>
+#endif
+#if QT_CONFIG(icu) && !defined(Q_OS_WIN) && !defined(Q_OS_MAC)
+#include <qcollator.h>
+#endif
 
 #include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
@@ -119,6 +131,163 @@ private:
     const QSortFilterProxyModel *proxy_model;
 };
 
+// the data of a source row in the sort column, fetched once for a key cached sort
+struct QSortFilterProxyModelSortKey
+{
+    QVariant key;
+    int row;
+};
+Q_DECLARE_TYPEINFO(QSortFilterProxyModelSortKey, Q_MOVABLE_TYPE);
+
+#ifndef QT_NO_THREAD
+class QSortFilterProxyModelSortJob : public QRunnable
+{
+public:
+    QSortFilterProxyModelSortJob(const std::function<void()> &job, QSemaphore *done)
+        : job(job), done(done)
+    {
+        setAutoDelete(false);
+    }
+
+    void run() Q_DECL_OVERRIDE
+    {
+        job();
+        done->release();
+    }
+
+private:
+    std::function<void()> job;
+    QSemaphore *done;
+};
+
+/*
+    Runs all \a jobs and returns when they are finished. Jobs are handed to
+    idle threads of the global thread pool; the ones for which no thread is
+    available, and the first one, are run by the calling thread. This never
+    waits for a thread to become available, so it cannot deadlock when it is
+    called from a thread of the pool itself.
+*/
+static void qsfpmRunJobs(const std::vector<std::function<void()> > &jobs)
+{
+    QSemaphore done;
+    std::vector<std::unique_ptr<QSortFilterProxyModelSortJob> > started;
+    for (size_t i = 1; i < jobs.size(); ++i) {
+        std::unique_ptr<QSortFilterProxyModelSortJob> job(new QSortFilterProxyModelSortJob(jobs[i], &done));
+        if (QThreadPool::globalInstance()->tryStart(job.get()))
+            started.push_back(std::move(job));
+        else
+            jobs[i]();
+    }
+    if (!jobs.empty())
+        jobs[0]();
+    done.acquire(int(started.size()));
+}
+
+/*
+    Sorts \a keys like std::stable_sort() would, splitting the work over
+    QThread::idealThreadCount() threads: every thread sorts one contiguous
+    chunk, then neighbouring chunks are merged pairwise until one is left.
+    Small vectors are sorted by the calling thread alone.
+*/
+template <typename Container, typename LessThan>
+static void qsfpmParallelStableSort(Container &keys, LessThan lessThan)
+{
+    enum { MinimumChunkSize = 8192 };
+    const int size = int(keys.size());
+    const int chunkCount = qMin(QThread::idealThreadCount(), size / MinimumChunkSize);
+    if (chunkCount < 2) {
+        std::stable_sort(keys.begin(), keys.end(), lessThan);
+        return;
+    }
+
+    auto *data = keys.data(); // detach before handing out pointers
+    QVector<int> bounds;
+    bounds.reserve(chunkCount + 1);
+    for (int i = 0; i <= chunkCount; ++i)
+        bounds.append(int(qint64(size) * i / chunkCount));
+
+    std::vector<std::function<void()> > jobs;
+    for (int i = 0; i < chunkCount; ++i) {
+        auto *first = data + bounds.at(i);
+        auto *last = data + bounds.at(i + 1);
+        jobs.push_back([first, last, lessThan]() { std::stable_sort(first, last, lessThan); });
+    }
+    qsfpmRunJobs(jobs);
+
+    while (bounds.size() > 2) {
+        QVector<int> merged;
+        jobs.clear();
+        int i = 0;
+        for ( ; i + 2 < bounds.size(); i += 2) {
+            auto *first = data + bounds.at(i);
+            auto *middle = data + bounds.at(i + 1);
+            auto *last = data + bounds.at(i + 2);
+            jobs.push_back([first, middle, last, lessThan]() { std::inplace_merge(first, middle, last, lessThan); });
+            merged.append(bounds.at(i));
+        }
+        if (i + 1 < bounds.size()) // odd chunk out, merged in the next round
+            merged.append(bounds.at(i));
+        merged.append(bounds.last());
+        qsfpmRunJobs(jobs);
+        bounds = merged;
+    }
+}
+#endif // QT_NO_THREAD
+
+#if QT_CONFIG(icu) && !defined(Q_OS_WIN) && !defined(Q_OS_MAC)
+struct QSortFilterProxyModelCollationKey
+{
+    QCollatorSortKey key;
+    int row;
+    bool isEmpty;
+};
+
+/*
+    With ICU, QString::localeAwareCompare() compares non-empty strings with a
+    default constructed QCollator. Comparing collation sort keys gives the same
+    order, but runs the collation algorithm once per row instead of twice per
+    comparison. Writes the sorted rows to \a source_rows and returns \c true,
+    or returns \c false if not all \a keys are strings.
+*/
+static bool qsfpmSortByCollationKeys(const QVector<QSortFilterProxyModelSortKey> &keys,
+                                     bool ascending, bool parallel, QVector<int> &source_rows)
+{
+    for (const QSortFilterProxyModelSortKey &key : keys) {
+        if (key.key.userType() != QMetaType::QString)
+            return false;
+    }
+
+    const QCollator collator;
+    std::vector<QSortFilterProxyModelCollationKey> collationKeys;
+    collationKeys.reserve(keys.size());
+    for (const QSortFilterProxyModelSortKey &key : keys) {
+        const QString string = key.key.toString();
+        collationKeys.push_back({ collator.sortKey(string), key.row, string.isEmpty() });
+    }
+
+    // like QString::localeAwareCompare(), sort empty strings before all others
+    auto lessThan = [ascending](const QSortFilterProxyModelCollationKey &k1,
+                                const QSortFilterProxyModelCollationKey &k2) {
+        const QSortFilterProxyModelCollationKey &left = ascending ? k1 : k2;
+        const QSortFilterProxyModelCollationKey &right = ascending ? k2 : k1;
+        if (left.isEmpty || right.isEmpty)
+            return left.isEmpty && !right.isEmpty;
+        return left.key.compare(right.key) < 0;
+    };
+#ifndef QT_NO_THREAD
+    if (parallel)
+        qsfpmParallelStableSort(collationKeys, lessThan);
+    else
+#else
+    Q_UNUSED(parallel);
+#endif
+        std::stable_sort(collationKeys.begin(), collationKeys.end(), lessThan);
+
+    for (int i = 0; i < int(collationKeys.size()); ++i)
+        source_rows[i] = collationKeys[i].row;
+    return true;
+}
+#endif
 
 //this struct is used to store what are the rows that are removed
 //between a call to rowsAboutToBeRemoved and rowsRemoved
@@ -180,6 +349,8 @@ public:
     bool filter_recursive;
     bool complete_insert;
     bool dynamic_sortfilter;
+    bool sort_keys_cached;
+    bool sort_parallel;
     QRowsRemoval itemsBeingRemoved;
 
     QModelIndexPairList saved_persistent_indexes;
@@ -257,6 +428,7 @@ public:
 
     void sort();
     bool update_source_sort_column();
+    bool source_less_than(const QModelIndex &source_left, const QModelIndex &source_right) const;
     void sort_source_rows(QVector<int> &source_rows,
                           const QModelIndex &source_parent) const;
     QVector<QPair<int, QVector<int > > > proxy_intervals_for_source_items_to_add(
@@ -521,6 +693,25 @@ bool QSortFilterProxyModelPrivate::update_source_sort_column()
 }
 
 
+/*!
+  \internal
+
+  Returns \c true if \a source_left sorts before \a source_right. This is
+  QSortFilterProxyModel::lessThan(), unless sort keys are cached, in which
+  case the sortRole data is compared directly, exactly as sort_source_rows()
+  does.
+*/
+bool QSortFilterProxyModelPrivate::source_less_than(const QModelIndex &source_left,
+                                                    const QModelIndex &source_right) const
+{
+    Q_Q(const QSortFilterProxyModel);
+    if (!sort_keys_cached)
+        return q->lessThan(source_left, source_right);
+    const QVariant l = model->data(source_left, sort_role);
+    const QVariant r = model->data(source_right, sort_role);
+    return QAbstractItemModelPrivate::isVariantLessThan(l, r, sort_casesensitivity, sort_localeaware);
+}
+
 /*!
   \internal
 
@@ -530,7 +721,42 @@ void QSortFilterProxyModelPrivate::sort_source_rows(
     QVector<int> &source_rows, const QModelIndex &source_parent) const
 {
     Q_Q(const QSortFilterProxyModel);
-    if (source_sort_column >= 0) {
+    if (source_sort_column >= 0 && sort_keys_cached) {
+        // fetch the data of every row once and sort on the copies
+        QVector<QSortFilterProxyModelSortKey> keys;
+        keys.reserve(source_rows.size());
+        for (int row : qAsConst(source_rows)) {
+            const QModelIndex index = model->index(row, source_sort_column, source_parent);
+            keys.append({ model->data(index, sort_role), row });
+        }
+
+        const Qt::CaseSensitivity cs = sort_casesensitivity;
+        const bool localeAware = sort_localeaware;
+        const bool ascending = (sort_order == Qt::AscendingOrder);
+#if QT_CONFIG(icu) && !defined(Q_OS_WIN) && !defined(Q_OS_MAC)
+#ifndef QT_NO_THREAD
+        const bool parallel = sort_parallel;
+#else
+        const bool parallel = false;
+#endif
+        if (localeAware && qsfpmSortByCollationKeys(keys, ascending, parallel, source_rows))
+            return;
+#endif
+        auto lessThan = [cs, localeAware, ascending](const QSortFilterProxyModelSortKey &k1,
+                                                     const QSortFilterProxyModelSortKey &k2) {
+            return ascending ? QAbstractItemModelPrivate::isVariantLessThan(k1.key, k2.key, cs, localeAware)
+                             : QAbstractItemModelPrivate::isVariantLessThan(k2.key, k1.key, cs, localeAware);
+        };
+#ifndef QT_NO_THREAD
+        if (sort_parallel)
+            qsfpmParallelStableSort(keys, lessThan);
+        else
+#endif
+            std::stable_sort(keys.begin(), keys.end(), lessThan);
+
+        for (int i = 0; i < keys.size(); ++i)
+            source_rows[i] = keys.at(i).row;
+    } else if (source_sort_column >= 0) {
         if (sort_order == Qt::AscendingOrder) {
             QSortFilterProxyModelLessThan lt(source_sort_column, source_parent, model, q);
             std::stable_sort(source_rows.begin(), source_rows.end(), lt);
@@ -681,7 +907,7 @@ QVector<QPair<int, QVector<int > > > QSortFilterProxyModelPrivate::proxy_interva
             proxy_item = (proxy_low + proxy_high) / 2;
             if (compare) {
                 QModelIndex i2 = model->index(proxy_to_source.at(proxy_item), source_sort_column, source_parent);
-                if ((sort_order == Qt::AscendingOrder) ? q->lessThan(i1, i2) : q->lessThan(i2, i1))
+                if ((sort_order == Qt::AscendingOrder) ? source_less_than(i1, i2) : source_less_than(i2, i1))
                     proxy_high = proxy_item - 1;
                 else
                     proxy_low = proxy_item + 1;
@@ -704,7 +930,7 @@ QVector<QPair<int, QVector<int > > > QSortFilterProxyModelPrivate::proxy_interva
                 int new_source_item = source_items.at(source_items_index);
                 if (compare) {
                     QModelIndex i2 = model->index(new_source_item, source_sort_column, source_parent);
-                    if ((sort_order == Qt::AscendingOrder) ? q->lessThan(i1, i2) : q->lessThan(i2, i1))
+                    if ((sort_order == Qt::AscendingOrder) ? source_less_than(i1, i2) : source_less_than(i2, i1))
                         break;
                 } else {
                     if (proxy_to_source.at(proxy_item) < new_source_item)
@@ -755,10 +981,12 @@ void QSortFilterProxyModelPrivate::insert_source_items(
                 q->beginInsertColumns(proxy_parent, proxy_start, proxy_end);
         }
 
-        for (int i = 0; i < source_items.size(); ++i)
-            proxy_to_source.insert(proxy_start + i, source_items.at(i));
+        proxy_to_source.insert(proxy_start, source_items.size(), -1);
+        std::copy(source_items.cbegin(), source_items.cend(), proxy_to_source.begin() + proxy_start);
 
-        build_source_to_proxy_mapping(proxy_to_source, source_to_proxy);
+        // Only the items from proxy_start onwards have moved; the others keep their mapping
+        for (int proxy_item = proxy_start; proxy_item < proxy_to_source.size(); ++proxy_item)
+            source_to_proxy[proxy_to_source.at(proxy_item)] = proxy_item;
 
         if (emit_signal) {
             if (orient == Qt::Vertical)
@@ -1208,13 +1436,13 @@ bool QSortFilterProxyModelPrivate::needsReorder(const QVector<int> &source_rows,
         if (proxyIndex.row() > 0) {
             const QModelIndex prevProxyIndex = q->sibling(proxyIndex.row() - 1, proxy_sort_column, proxyIndex);
             const QModelIndex prevSourceIndex = proxy_to_source(prevProxyIndex);
-            if (sort_order == Qt::AscendingOrder ? q->lessThan(sourceIndex, prevSourceIndex) : q->lessThan(prevSourceIndex, sourceIndex))
+            if (sort_order == Qt::AscendingOrder ? source_less_than(sourceIndex, prevSourceIndex) : source_less_than(prevSourceIndex, sourceIndex))
                 return true;
         }
         if (proxyIndex.row() < proxyRowCount - 1) {
             const QModelIndex nextProxyIndex = q->sibling(proxyIndex.row() + 1, proxy_sort_column, proxyIndex);
             const QModelIndex nextSourceIndex = proxy_to_source(nextProxyIndex);
-            if (sort_order == Qt::AscendingOrder ? q->lessThan(nextSourceIndex, sourceIndex) : q->lessThan(sourceIndex, nextSourceIndex))
+            if (sort_order == Qt::AscendingOrder ? source_less_than(nextSourceIndex, sourceIndex) : source_less_than(sourceIndex, nextSourceIndex))
                 return true;
         }
         return false;
@@ -1837,6 +2065,8 @@ QSortFilterProxyModel::QSortFilterProxyModel(QObject *parent)
     d->filter_recursive = false;
     d->dynamic_sortfilter = true;
     d->complete_insert = false;
+    d->sort_keys_cached = false;
+    d->sort_parallel = false;
     connect(this, SIGNAL(modelReset()), this, SLOT(_q_clearMapping()));
 }
 
@@ -2682,6 +2912,72 @@ void QSortFilterProxyModel::setRecursiveFilteringEnabled(bool recursive)
     d->filter_changed();
 }
 
+/*!
+    \since 5.11
+    \property QSortFilterProxyModel::sortKeyCachingEnabled
+    \brief whether the sort role data of each row is fetched only once per sort
+
+    By default, every comparison made while sorting calls lessThan(), which
+    in turn fetches the data of both items from the source model. For a
+    large model, sorting then spends most of its time in data().
+
+    When this property is true, the proxy model fetches the sortRole data of
+    every row once, and sorts on those copies. The values are compared with
+    the rules of the default lessThan() implementation, honoring
+    sortCaseSensitivity and isSortLocaleAware; a reimplementation of
+    lessThan() is not called.
+
+    The default value is false.
+
+    \sa parallelSortingEnabled, sortRole
+*/
+bool QSortFilterProxyModel::isSortKeyCachingEnabled() const
+{
+    Q_D(const QSortFilterProxyModel);
+    return d->sort_keys_cached;
+}
+
+void QSortFilterProxyModel::setSortKeyCachingEnabled(bool enable)
+{
+    Q_D(QSortFilterProxyModel);
+    if (d->sort_keys_cached == enable)
+        return;
+    d->sort_keys_cached = enable;
+    d->sort();
+}
+
+/*!
+    \since 5.11
+    \property QSortFilterProxyModel::parallelSortingEnabled
+    \brief whether sorting large models may use worker threads
+
+    When this property and \l sortKeyCachingEnabled are both true, the
+    comparisons of a large sort are spread over idle threads of
+    QThreadPool::globalInstance(). Fetching the sort keys, filtering and
+    the emission of the layout change signals remain on the thread the
+    proxy model lives in, because the source model must only be accessed
+    from that thread. The resulting order is the same as that of a
+    sequential sort.
+
+    This property has no effect if sortKeyCachingEnabled is false, or if
+    Qt was built without thread support.
+
+    The default value is false.
+
+    \sa sortKeyCachingEnabled
+*/
+bool QSortFilterProxyModel::isParallelSortingEnabled() const
+{
+    Q_D(const QSortFilterProxyModel);
+    return d->sort_parallel;
+}
+
+void QSortFilterProxyModel::setParallelSortingEnabled(bool enable)
+{
+    Q_D(QSortFilterProxyModel);
+    d->sort_parallel = enable;
+}
+
 /*!
     \obsolete
 
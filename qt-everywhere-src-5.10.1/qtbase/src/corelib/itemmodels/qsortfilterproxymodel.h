@@ -68,6 +68,8 @@ class Q_CORE_EXPORT QSortFilterProxyModel : public QAbstractProxyModel
     Q_PROPERTY(int sortRole READ sortRole WRITE setSortRole)
     Q_PROPERTY(int filterRole READ filterRole WRITE setFilterRole)
     Q_PROPERTY(bool recursiveFilteringEnabled READ isRecursiveFilteringEnabled WRITE setRecursiveFilteringEnabled)
+    Q_PROPERTY(bool sortKeyCachingEnabled READ isSortKeyCachingEnabled WRITE setSortKeyCachingEnabled)
+    Q_PROPERTY(bool parallelSortingEnabled READ isParallelSortingEnabled WRITE setParallelSortingEnabled)
 
 public:
     explicit QSortFilterProxyModel(QObject *parent = Q_NULLPTR);
@@ -111,6 +113,12 @@ public:
     bool isRecursiveFilteringEnabled() const;
     void setRecursiveFilteringEnabled(bool recursive);
 
+    bool isSortKeyCachingEnabled() const;
+    void setSortKeyCachingEnabled(bool enable);
+
+    bool isParallelSortingEnabled() const;
+    void setParallelSortingEnabled(bool enable);
+
 public Q_SLOTS:
     void setFilterRegExp(const QString &pattern);
     void setFilterWildcard(const QString &pattern);
@@ -4,6 +4,8 @@ HEADERS += \
     json/qjsonobject.h \
     json/qjsonvalue.h \
     json/qjsonarray.h \
+    json/qjsonstreamreader.h \
+    json/qjsonstreamwriter.h \
     json/qjsonwriter_p.h \
     json/qjsonparser_p.h
 
@@ -12,6 +14,8 @@ SOURCES += \
     json/qjsondocument.cpp \
     json/qjsonobject.cpp \
     json/qjsonarray.cpp \
+    json/qjsonstreamreader.cpp \
+    json/qjsonstreamwriter.cpp \
     json/qjsonvalue.cpp \
     json/qjsonwriter.cpp \
     json/qjsonparser.cpp
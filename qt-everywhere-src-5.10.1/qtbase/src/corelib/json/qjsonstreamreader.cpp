@@ -0,0 +1,1113 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qjsonstreamreader.h"
+#include <qjsonarray.h>
+#include <qjsonobject.h>
+#include <qiodevice.h>
+#include <qfiledevice.h>
+#include <qvarlengtharray.h>
+#include "qjsonparser_p.h"
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QJsonStreamReader
+    \inmodule QtCore
+    \ingroup json
+    \reentrant
+    \since 5.11
+
+    \brief The QJsonStreamReader class provides a fast parser for reading
+    JSON text incrementally.
+
+    QJsonStreamReader is the streaming counterpart of QJsonDocument::fromJson().
+    Instead of building the whole document in memory it reports the document
+    as a sequence of tokens, which makes it suitable for documents that are
+    too large to be held as a QJsonDocument, or for data that arrives in
+    chunks over a network connection.
+
+    The basic concept is the same as for QXmlStreamReader: readNext() moves
+    the reader to the next token and returns its type, and the accessors
+    return the data of the current token. A loop over a document looks like
+    this:
+
+    \code
+        QJsonStreamReader reader(&file);
+        while (!reader.atEnd()) {
+            switch (reader.readNext()) {
+            case QJsonStreamReader::String:
+                qDebug() << reader.name() << reader.text();
+                break;
+            ...
+            }
+        }
+        if (reader.hasError()) {
+            ...
+        }
+    \endcode
+
+    Values inside an object carry the key of their member, which is
+    returned by name(). The value of String, Double, Bool and Null tokens
+    is returned by text(), doubleValue(), boolValue() or value(). An array
+    or object the application is not interested in can be skipped with
+    skipCurrentContainer(), while readValue() converts it to a QJsonValue.
+    This allows to build up only the parts of a large document that are
+    actually needed.
+
+    The reader accepts the same input as QJsonDocument::fromJson(): the top
+    level value must be an object or an array, and the document may start
+    with a UTF-8 byte order mark.
+
+    \section1 Avoiding copies
+
+    When reading from a QByteArray, or from a file that can be memory
+    mapped, the reader scans the data in place. utf8Name() and utf8Text()
+    then return strings without escape sequences as \l{QByteArray::fromRawData()}
+    {raw data} pointing into the input, so no memory is allocated for them.
+    The returned byte arrays are only valid until the next call to
+    readNext(), addData(), setDevice() or clear(). Other devices are read
+    in chunks into an internal buffer.
+
+    \section1 Incremental parsing
+
+    If the reader runs out of data in the middle of the document, readNext()
+    reports a PrematureEndOfDocumentError. This error is recoverable: once
+    more data has been passed to addData() or has become available on the
+    device, the next call to readNext() continues at the token which could
+    not be completed.
+
+    \sa QJsonDocument, QXmlStreamReader
+*/
+
+/*!
+    \enum QJsonStreamReader::TokenType
+
+    This enum specifies the type of token the reader just read.
+
+    \value NoToken The reader has not yet read anything.
+    \value Invalid An error has occurred, reported in error() and errorString().
+    \value StartArray The reader reports the start of an array.
+    \value EndArray The reader reports the end of an array.
+    \value StartObject The reader reports the start of an object.
+    \value EndObject The reader reports the end of an object.
+    \value String The reader reports a string in text().
+    \value Double The reader reports a number in doubleValue().
+    \value Bool The reader reports a boolean in boolValue().
+    \value Null The reader reports a null value.
+    \value EndDocument The reader reports the end of the document.
+*/
+
+/*!
+    \enum QJsonStreamReader::Error
+
+    This enum specifies the different error cases.
+
+    \value NoError No error has occurred.
+    \value NotWellFormedError The parser internally raised an error because
+           the data is not valid JSON. parseError() returns the reason.
+    \value PrematureEndOfDocumentError The input ended before the document
+           was complete. If more data arrives, the reader will recover and
+           continue parsing.
+*/
+
+static const int nestingLimit = 1024;
+static const int readChunkSize = 64 * 1024;
+
+class QJsonStreamReaderPrivate
+{
+public:
+    enum ScanResult {
+        TokenRead,
+        NeedMoreData,
+        EndOfInput,
+        ScanError
+    };
+
+    // what the current container expects next
+    enum ContainerState {
+        ExpectFirst,
+        ExpectSeparator
+    };
+
+    QJsonStreamReaderPrivate()
+        : device(nullptr), mappedFile(nullptr), mappedData(nullptr)
+    {
+        resetBuffer();
+        resetState();
+    }
+
+    ~QJsonStreamReaderPrivate() { unmap(); }
+
+    void resetBuffer();
+    void resetState();
+    void unmap();
+    void syncPointers(qint64 consumed);
+    void compact();
+    bool mapDevice();
+    bool fetchMore();
+
+    inline qint64 offsetOf(const char *p) const { return bufferOffset + (p - begin); }
+
+    ScanResult scanToken();
+    ScanResult scanValue(const char *&p);
+    ScanResult scanString(const char *&p, const char **strBegin, const char **strEnd, bool *escaped);
+    ScanResult scanNumber(const char *&p);
+    ScanResult scanLiteral(const char *&p, const char *literal, int length);
+    ScanResult raiseError(QJsonParseError::ParseError e, const char *at);
+    ScanResult needMoreData(QJsonParseError::ParseError e);
+    ScanResult unterminatedContainer();
+
+    static QString decode(const char *b, const char *e, bool escaped);
+
+    QIODevice *device;
+    QFileDevice *mappedFile;
+    uchar *mappedData;
+    QByteArray buffer;
+
+    // the data being scanned: either buffer or the mapped file
+    const char *begin;
+    const char *end;
+    const char *pos;
+    qint64 bufferOffset;
+
+    QVarLengthArray<char, 32> containers;
+    ContainerState containerState;
+    bool rootDone;
+
+    QJsonStreamReader::TokenType type;
+    qint64 tokenOffset;
+    const char *nameBegin;
+    const char *nameEnd;
+    const char *textBegin;
+    const char *textEnd;
+    bool nameEscaped;
+    bool textEscaped;
+    bool boolean;
+    double number;
+
+    QJsonStreamReader::Error error;
+    QJsonParseError::ParseError parseError;
+    QJsonParseError::ParseError pendingError;
+    qint64 errorOffset;
+};
+
+void QJsonStreamReaderPrivate::resetBuffer()
+{
+    buffer.clear();
+    begin = end = pos = nullptr;
+    bufferOffset = 0;
+}
+
+void QJsonStreamReaderPrivate::resetState()
+{
+    containers.clear();
+    containerState = ExpectFirst;
+    rootDone = false;
+    type = QJsonStreamReader::NoToken;
+    tokenOffset = 0;
+    nameBegin = nameEnd = textBegin = textEnd = nullptr;
+    nameEscaped = textEscaped = false;
+    boolean = false;
+    number = 0;
+    error = QJsonStreamReader::NoError;
+    parseError = pendingError = QJsonParseError::NoError;
+    errorOffset = 0;
+}
+
+void QJsonStreamReaderPrivate::unmap()
+{
+    if (mappedData)
+        mappedFile->unmap(mappedData);
+    mappedFile = nullptr;
+    mappedData = nullptr;
+}
+
+/*
+    Points begin and end at the buffer after its contents changed, with
+    \a consumed bytes of the previous data already scanned.
+*/
+void QJsonStreamReaderPrivate::syncPointers(qint64 consumed)
+{
+    begin = buffer.constData();
+    end = begin + buffer.size();
+    pos = begin + consumed;
+}
+
+void QJsonStreamReaderPrivate::compact()
+{
+    const int consumed = int(pos - begin);
+    if (consumed > 0) {
+        buffer.remove(0, consumed);
+        bufferOffset += consumed;
+    }
+    syncPointers(0);
+}
+
+/*
+    Maps the remaining contents of a file device, so that it can be scanned
+    in place instead of being copied into the buffer.
+*/
+bool QJsonStreamReaderPrivate::mapDevice()
+{
+    QFileDevice *file = qobject_cast<QFileDevice *>(device);
+    if (!file || file->isSequential() || !file->isOpen())
+        return false;
+    const qint64 offset = file->pos();
+    const qint64 size = file->size() - offset;
+    if (size <= 0)
+        return false;
+    uchar *data = file->map(offset, size);
+    if (!data)
+        return false;
+    mappedFile = file;
+    mappedData = data;
+    begin = pos = reinterpret_cast<const char *>(data);
+    end = begin + size;
+    return true;
+}
+
+bool QJsonStreamReaderPrivate::fetchMore()
+{
+    if (!device || mappedData)
+        return false;
+
+    compact();
+    // make sure a token larger than the chunk size does not get read
+    // in ever smaller steps
+    const int chunkSize = qMax(readChunkSize, buffer.size());
+    const int oldSize = buffer.size();
+    buffer.resize(oldSize + chunkSize);
+    const qint64 bytesRead = device->read(buffer.data() + oldSize, chunkSize);
+    buffer.resize(oldSize + int(qMax(bytesRead, qint64(0))));
+    syncPointers(0);
+    return bytesRead > 0;
+}
+
+QJsonStreamReaderPrivate::ScanResult
+QJsonStreamReaderPrivate::raiseError(QJsonParseError::ParseError e, const char *at)
+{
+    type = QJsonStreamReader::Invalid;
+    error = QJsonStreamReader::NotWellFormedError;
+    parseError = e;
+    errorOffset = offsetOf(at);
+    return ScanError;
+}
+
+QJsonStreamReaderPrivate::ScanResult
+QJsonStreamReaderPrivate::needMoreData(QJsonParseError::ParseError e)
+{
+    pendingError = e;
+    return NeedMoreData;
+}
+
+QJsonStreamReaderPrivate::ScanResult QJsonStreamReaderPrivate::unterminatedContainer()
+{
+    if (containers.isEmpty())
+        return needMoreData(QJsonParseError::IllegalValue);
+    return needMoreData(containers.last() == '[' ? QJsonParseError::UnterminatedArray
+                                                 : QJsonParseError::UnterminatedObject);
+}
+
+static inline const char *skipSpace(const char *p, const char *end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+        ++p;
+    return p;
+}
+
+/*
+    Scans the next token starting at pos. Whitespace is consumed even if
+    the token turns out to be incomplete, everything else is only consumed
+    together with a complete token, so that scanning can simply be restarted
+    once more data is available.
+*/
+QJsonStreamReaderPrivate::ScanResult QJsonStreamReaderPrivate::scanToken()
+{
+    static const char utf8bom[] = "\xef\xbb\xbf";
+
+    const char *p = pos;
+    if (bufferOffset == 0 && p == begin) {
+        const qint64 available = end - p;
+        if (available < 3) {
+            if (available > 0 && memcmp(p, utf8bom, size_t(available)) == 0)
+                return needMoreData(QJsonParseError::IllegalValue);
+        } else if (memcmp(p, utf8bom, 3) == 0) {
+            p += 3;
+        }
+    }
+
+    p = skipSpace(p, end);
+    pos = p;
+    if (p == end)
+        return rootDone ? EndOfInput : unterminatedContainer();
+    if (rootDone)
+        return raiseError(QJsonParseError::GarbageAtEnd, p);
+
+    nameBegin = nameEnd = nullptr;
+    nameEscaped = false;
+
+    const char *tokenStart = p;
+    ScanResult result;
+    if (containers.isEmpty()) {
+        // JSON-text = object / array
+        if (*p != '[' && *p != '{')
+            return raiseError(QJsonParseError::IllegalValue, p);
+        result = scanValue(p);
+    } else if (containers.last() == '[') {
+        if (*p == ']') {
+            ++p;
+            containers.removeLast();
+            containerState = ExpectSeparator;
+            rootDone = containers.isEmpty();
+            type = QJsonStreamReader::EndArray;
+            result = TokenRead;
+        } else {
+            if (containerState == ExpectSeparator) {
+                if (*p != ',')
+                    return raiseError(QJsonParseError::MissingValueSeparator, p);
+                p = skipSpace(p + 1, end);
+                if (p == end)
+                    return unterminatedContainer();
+                tokenStart = p;
+            }
+            result = scanValue(p);
+        }
+    } else {
+        if (*p == '}') {
+            ++p;
+            containers.removeLast();
+            containerState = ExpectSeparator;
+            rootDone = containers.isEmpty();
+            type = QJsonStreamReader::EndObject;
+            result = TokenRead;
+        } else {
+            if (containerState == ExpectSeparator) {
+                if (*p != ',')
+                    return raiseError(QJsonParseError::UnterminatedObject, p);
+                p = skipSpace(p + 1, end);
+                if (p == end)
+                    return unterminatedContainer();
+                if (*p != '"')
+                    return raiseError(QJsonParseError::MissingObject, p);
+                tokenStart = p;
+            } else if (*p != '"') {
+                return raiseError(QJsonParseError::UnterminatedObject, p);
+            }
+
+            // member = string name-separator value
+            const char *b;
+            const char *e;
+            bool escaped;
+            result = scanString(p, &b, &e, &escaped);
+            if (result != TokenRead)
+                return result;
+            p = skipSpace(p, end);
+            if (p == end)
+                return unterminatedContainer();
+            if (*p != ':')
+                return raiseError(QJsonParseError::MissingNameSeparator, p);
+            p = skipSpace(p + 1, end);
+            if (p == end)
+                return unterminatedContainer();
+            result = scanValue(p);
+            nameBegin = b;
+            nameEnd = e;
+            nameEscaped = escaped;
+        }
+    }
+
+    if (result == TokenRead) {
+        pos = p;
+        tokenOffset = offsetOf(tokenStart);
+    }
+    return result;
+}
+
+/*
+    value = false / null / true / object / array / number / string
+*/
+QJsonStreamReaderPrivate::ScanResult QJsonStreamReaderPrivate::scanValue(const char *&p)
+{
+    ScanResult result;
+    switch (*p) {
+    case '[':
+    case '{':
+        if (containers.size() >= nestingLimit)
+            return raiseError(QJsonParseError::DeepNesting, p);
+        containers.append(*p);
+        containerState = ExpectFirst;
+        type = *p == '[' ? QJsonStreamReader::StartArray : QJsonStreamReader::StartObject;
+        ++p;
+        return TokenRead;
+    case '"':
+        result = scanString(p, &textBegin, &textEnd, &textEscaped);
+        type = QJsonStreamReader::String;
+        break;
+    case 't':
+        result = scanLiteral(p, "true", 4);
+        type = QJsonStreamReader::Bool;
+        boolean = true;
+        break;
+    case 'f':
+        result = scanLiteral(p, "false", 5);
+        type = QJsonStreamReader::Bool;
+        boolean = false;
+        break;
+    case 'n':
+        result = scanLiteral(p, "null", 4);
+        type = QJsonStreamReader::Null;
+        break;
+    case '-':
+    case '0': case '1': case '2': case '3': case '4':
+    case '5': case '6': case '7': case '8': case '9':
+        result = scanNumber(p);
+        type = QJsonStreamReader::Double;
+        break;
+    case ']':
+    case '}':
+        return raiseError(QJsonParseError::MissingObject, p);
+    default:
+        return raiseError(QJsonParseError::IllegalValue, p);
+    }
+    if (result == TokenRead)
+        containerState = ExpectSeparator;
+    else if (result == ScanError)
+        type = QJsonStreamReader::Invalid;
+    return result;
+}
+
+QJsonStreamReaderPrivate::ScanResult
+QJsonStreamReaderPrivate::scanLiteral(const char *&p, const char *literal, int length)
+{
+    const qint64 available = end - p;
+    if (available < length) {
+        if (memcmp(p, literal, size_t(available)) == 0)
+            return unterminatedContainer();
+    } else if (memcmp(p, literal, size_t(length)) == 0) {
+        p += length;
+        return TokenRead;
+    }
+    return raiseError(QJsonParseError::IllegalValue, p);
+}
+
+/*
+    Follows the grammar accepted by Parser::parseNumber(): a number is only
+    complete once a character following it has been seen.
+*/
+QJsonStreamReaderPrivate::ScanResult QJsonStreamReaderPrivate::scanNumber(const char *&p)
+{
+    const char *json = p;
+    bool isInt = true;
+
+    if (json < end && *json == '-')
+        ++json;
+    const char *digits = json;
+    if (json < end && *json == '0') {
+        ++json;
+    } else {
+        while (json < end && *json >= '0' && *json <= '9')
+            ++json;
+    }
+    if (json < end && *json == '.') {
+        isInt = false;
+        ++json;
+        while (json < end && *json >= '0' && *json <= '9')
+            ++json;
+    }
+    if (json < end && (*json == 'e' || *json == 'E')) {
+        isInt = false;
+        ++json;
+        if (json < end && (*json == '-' || *json == '+'))
+            ++json;
+        while (json < end && *json >= '0' && *json <= '9')
+            ++json;
+    }
+
+    if (json >= end)
+        return needMoreData(QJsonParseError::TerminationByNumber);
+
+    // integers that a double holds exactly do not need the generic conversion
+    if (isInt && json > digits && json - digits <= 15) {
+        qint64 n = 0;
+        for (const char *d = digits; d < json; ++d)
+            n = n * 10 + (*d - '0');
+        number = digits == p ? double(n) : -double(n);
+        p = json;
+        return TokenRead;
+    }
+
+    bool ok;
+    number = QByteArray(p, int(json - p)).toDouble(&ok);
+    if (!ok)
+        return raiseError(QJsonParseError::IllegalNumber, p);
+    p = json;
+    return TokenRead;
+}
+
+/*
+    Finds the end of the string starting at \a p, which points to the
+    opening quote. Strings that contain escape sequences or non-ASCII
+    characters are validated with the same rules as Parser::parseString().
+*/
+QJsonStreamReaderPrivate::ScanResult
+QJsonStreamReaderPrivate::scanString(const char *&p, const char **strBegin, const char **strEnd,
+                                     bool *escaped)
+{
+    const char *start = p + 1;
+    const char *json = start;
+    bool hasEscapes = false;
+    bool isAscii = true;
+    while (json < end) {
+        const uchar c = uchar(*json);
+        if (c == '"')
+            break;
+        if (c == '\\') {
+            hasEscapes = true;
+            json += 2;
+            continue;
+        }
+        if (c >= 0x80)
+            isAscii = false;
+        ++json;
+    }
+    if (json >= end)
+        return needMoreData(QJsonParseError::UnterminatedString);
+
+    if (hasEscapes || !isAscii) {
+        const char *s = start;
+        while (s < json) {
+            uint ch = 0;
+            if (*s == '\\') {
+                if (!QJsonPrivate::scanEscapeSequence(s, json, &ch))
+                    return raiseError(QJsonParseError::IllegalEscapeSequence, s);
+            } else if (uchar(*s) < 0x80) {
+                ++s;
+            } else if (!QJsonPrivate::scanUtf8Char(s, json, &ch)) {
+                return raiseError(QJsonParseError::IllegalUTF8String, s);
+            }
+        }
+    }
+
+    *strBegin = start;
+    *strEnd = json;
+    *escaped = hasEscapes;
+    p = json + 1;
+    return TokenRead;
+}
+
+QString QJsonStreamReaderPrivate::decode(const char *b, const char *e, bool escaped)
+{
+    if (!escaped)
+        return QString::fromUtf8(b, int(e - b));
+
+    QString result;
+    result.reserve(int(e - b));
+    while (b < e) {
+        uint ch = 0;
+        if (*b == '\\') {
+            if (!QJsonPrivate::scanEscapeSequence(b, e, &ch))
+                break;
+        } else if (uchar(*b) < 0x80) {
+            ch = uchar(*b++);
+        } else if (!QJsonPrivate::scanUtf8Char(b, e, &ch)) {
+            break;
+        }
+        if (QChar::requiresSurrogates(ch)) {
+            result += QChar(QChar::highSurrogate(ch));
+            result += QChar(QChar::lowSurrogate(ch));
+        } else {
+            result += QChar(ushort(ch));
+        }
+    }
+    return result;
+}
+
+/*!
+    Constructs a stream reader.
+
+    \sa setDevice(), addData()
+*/
+QJsonStreamReader::QJsonStreamReader()
+    : d_ptr(new QJsonStreamReaderPrivate)
+{
+}
+
+/*!
+    Creates a new stream reader that reads from \a device.
+
+    \sa setDevice(), clear()
+*/
+QJsonStreamReader::QJsonStreamReader(QIODevice *device)
+    : d_ptr(new QJsonStreamReaderPrivate)
+{
+    setDevice(device);
+}
+
+/*!
+    Creates a new stream reader that reads from \a data. The contents of
+    \a data are not copied.
+
+    \sa addData(), clear(), setDevice()
+*/
+QJsonStreamReader::QJsonStreamReader(const QByteArray &data)
+    : d_ptr(new QJsonStreamReaderPrivate)
+{
+    Q_D(QJsonStreamReader);
+    d->buffer = data;
+    d->syncPointers(0);
+}
+
+/*!
+    Destructs the reader.
+*/
+QJsonStreamReader::~QJsonStreamReader()
+{
+}
+
+/*!
+    Sets the current device to \a device and resets the reader to its
+    initial state. Setting the device to \nullptr makes the reader operate
+    on the data passed to addData().
+
+    If \a device is a QFile, or another QFileDevice that is not sequential,
+    the reader tries to memory map the file's contents from its current
+    position on and scans them in place. The position of the device is not
+    changed in that case. Otherwise the device is read in chunks while
+    parsing.
+
+    \sa device(), clear()
+*/
+void QJsonStreamReader::setDevice(QIODevice *device)
+{
+    Q_D(QJsonStreamReader);
+    d->unmap();
+    d->resetBuffer();
+    d->resetState();
+    d->device = device;
+    if (device)
+        d->mapDevice();
+}
+
+/*!
+    Returns the current device associated with the QJsonStreamReader, or
+    \nullptr if no device has been assigned.
+
+    \sa setDevice()
+*/
+QIODevice *QJsonStreamReader::device() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->device;
+}
+
+/*!
+    Adds more \a data for the reader to read. This function does nothing if
+    the reader has a device().
+
+    \sa readNext(), clear()
+*/
+void QJsonStreamReader::addData(const QByteArray &data)
+{
+    Q_D(QJsonStreamReader);
+    if (d->device) {
+        qWarning("QJsonStreamReader: addData() with device()");
+        return;
+    }
+    d->compact();
+    d->buffer += data;
+    d->syncPointers(0);
+}
+
+/*!
+    Removes any device() or data from the reader and resets its internal
+    state to the initial state.
+
+    \sa addData()
+*/
+void QJsonStreamReader::clear()
+{
+    setDevice(nullptr);
+}
+
+/*!
+    Returns \c true if the reader has read until the end of the JSON
+    document, or if an error() has occurred and reading has been aborted.
+    Otherwise, it returns \c false.
+
+    When atEnd() and hasError() return true and error() returns
+    PrematureEndOfDocumentError, it means the data has been well-formed so
+    far but a complete JSON document has not been parsed. The next chunk of
+    data can be added with addData(), if the JSON is being read from a
+    QByteArray, or by waiting for more data to arrive if it is being read
+    from a QIODevice. Either way, atEnd() will return false once more data
+    is available.
+
+    \sa hasError(), error(), device(), QIODevice::atEnd()
+*/
+bool QJsonStreamReader::atEnd() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->error == PrematureEndOfDocumentError) {
+        // more data may have arrived in the meantime
+        return d->device ? d->device->bytesAvailable() == 0
+                         : d->offsetOf(d->end) == d->errorOffset;
+    }
+    return d->error != NoError || d->type == EndDocument;
+}
+
+/*!
+    Reads the next token and returns its type.
+
+    With one exception, once an error() is reported by readNext(), further
+    reading of the JSON stream is not possible. Then atEnd() returns \c true,
+    hasError() returns \c true, and this function returns
+    QJsonStreamReader::Invalid.
+
+    The exception is when error() returns PrematureEndOfDocumentError. This
+    error is reported when the end of the data is reached in the middle of
+    the document. To recover from that error, add more data with addData()
+    or wait for it to arrive on the device() and call readNext() again.
+
+    \sa tokenType(), tokenString()
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::readNext()
+{
+    Q_D(QJsonStreamReader);
+    if (d->type == EndDocument || d->error == NotWellFormedError)
+        return d->type;
+
+    d->error = NoError;
+    d->parseError = QJsonParseError::NoError;
+    for (;;) {
+        const QJsonStreamReaderPrivate::ScanResult result = d->scanToken();
+        if (result == QJsonStreamReaderPrivate::TokenRead
+                || result == QJsonStreamReaderPrivate::ScanError)
+            break;
+        if (d->fetchMore())
+            continue;
+        if (result == QJsonStreamReaderPrivate::EndOfInput) {
+            d->type = EndDocument;
+            d->tokenOffset = d->offsetOf(d->end);
+        } else {
+            d->type = Invalid;
+            d->error = PrematureEndOfDocumentError;
+            d->parseError = d->pendingError;
+            d->errorOffset = d->offsetOf(d->end);
+        }
+        break;
+    }
+    return d->type;
+}
+
+/*!
+    Reads until the end of the current array or object, if the current
+    token is StartArray or StartObject. The reader is then positioned on
+    the matching EndArray or EndObject token. Returns \c false if an error
+    occurred on the way, otherwise \c true.
+
+    This function does nothing for other tokens.
+*/
+bool QJsonStreamReader::skipCurrentContainer()
+{
+    if (!isStartArray() && !isStartObject())
+        return !hasError();
+    const int level = depth();
+    while (readNext() != Invalid) {
+        if ((isEndArray() || isEndObject()) && depth() == level)
+            return true;
+    }
+    return false;
+}
+
+/*!
+    Returns the type of the current token.
+
+    \sa tokenString()
+*/
+QJsonStreamReader::TokenType QJsonStreamReader::tokenType() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->type;
+}
+
+/*!
+    Returns the reader's current token as string.
+
+    \sa tokenType()
+*/
+QString QJsonStreamReader::tokenString() const
+{
+    static const char * const names[] = {
+        "NoToken",
+        "Invalid",
+        "StartArray",
+        "EndArray",
+        "StartObject",
+        "EndObject",
+        "String",
+        "Double",
+        "Bool",
+        "Null",
+        "EndDocument"
+    };
+    return QLatin1String(names[tokenType()]);
+}
+
+/*!
+    Returns the number of arrays and objects enclosing the current token.
+    The StartArray, EndArray, StartObject and EndObject tokens report the
+    depth of the container they belong to, so it is 0 for the top level
+    array or object.
+*/
+int QJsonStreamReader::depth() const
+{
+    Q_D(const QJsonStreamReader);
+    const int size = d->containers.size();
+    return (d->type == StartArray || d->type == StartObject) ? size - 1 : size;
+}
+
+/*!
+    Returns the offset of the current token in bytes, relative to the start
+    of the data. If the reader has an error(), returns the offset at which
+    the error occurred.
+*/
+qint64 QJsonStreamReader::tokenOffset() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->error != NoError ? d->errorOffset : d->tokenOffset;
+}
+
+/*!
+    Returns the key of the current value if it is a member of an object,
+    otherwise an empty string.
+
+    \sa utf8Name(), text()
+*/
+QString QJsonStreamReader::name() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->type == Invalid || !d->nameBegin)
+        return QString();
+    return QJsonStreamReaderPrivate::decode(d->nameBegin, d->nameEnd, d->nameEscaped);
+}
+
+/*!
+    Returns the key of the current value as UTF-8.
+
+    If the key does not contain escape sequences, the returned byte array
+    refers to the data being parsed, and stays valid until the next call to
+    readNext(), addData(), setDevice() or clear().
+
+    \sa name()
+*/
+QByteArray QJsonStreamReader::utf8Name() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->type == Invalid || !d->nameBegin)
+        return QByteArray();
+    if (d->nameEscaped)
+        return name().toUtf8();
+    return QByteArray::fromRawData(d->nameBegin, int(d->nameEnd - d->nameBegin));
+}
+
+/*!
+    Returns the value of the current String token, otherwise an empty
+    string.
+
+    \sa utf8Text(), value()
+*/
+QString QJsonStreamReader::text() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->type != String)
+        return QString();
+    return QJsonStreamReaderPrivate::decode(d->textBegin, d->textEnd, d->textEscaped);
+}
+
+/*!
+    Returns the value of the current String token as UTF-8.
+
+    If the string does not contain escape sequences, the returned byte
+    array refers to the data being parsed, and stays valid until the next
+    call to readNext(), addData(), setDevice() or clear().
+
+    \sa text()
+*/
+QByteArray QJsonStreamReader::utf8Text() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->type != String)
+        return QByteArray();
+    if (d->textEscaped)
+        return text().toUtf8();
+    return QByteArray::fromRawData(d->textBegin, int(d->textEnd - d->textBegin));
+}
+
+/*!
+    Returns the value of the current Double token, otherwise 0.
+*/
+double QJsonStreamReader::doubleValue() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->type == Double ? d->number : 0;
+}
+
+/*!
+    Returns the value of the current Bool token, otherwise \c false.
+*/
+bool QJsonStreamReader::boolValue() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->type == Bool && d->boolean;
+}
+
+/*!
+    Returns the current String, Double, Bool or Null token as QJsonValue.
+    For any other token, an undefined QJsonValue is returned.
+
+    \sa readValue()
+*/
+QJsonValue QJsonStreamReader::value() const
+{
+    switch (tokenType()) {
+    case String:
+        return QJsonValue(text());
+    case Double:
+        return QJsonValue(doubleValue());
+    case Bool:
+        return QJsonValue(boolValue());
+    case Null:
+        return QJsonValue(QJsonValue::Null);
+    default:
+        break;
+    }
+    return QJsonValue(QJsonValue::Undefined);
+}
+
+/*!
+    Returns the current token as QJsonValue. If the current token is
+    StartArray or StartObject, the whole array or object is read and
+    returned, and the reader is positioned on the matching EndArray or
+    EndObject token.
+
+    If an error occurs, an undefined QJsonValue is returned.
+
+    \sa value(), skipCurrentContainer()
+*/
+QJsonValue QJsonStreamReader::readValue()
+{
+    if (isStartArray()) {
+        QJsonArray array;
+        while (readNext() != EndArray) {
+            if (hasError())
+                return QJsonValue(QJsonValue::Undefined);
+            array.append(readValue());
+        }
+        return array;
+    }
+    if (isStartObject()) {
+        QJsonObject object;
+        while (readNext() != EndObject) {
+            if (hasError())
+                return QJsonValue(QJsonValue::Undefined);
+            const QString key = name();
+            object.insert(key, readValue());
+        }
+        return object;
+    }
+    return value();
+}
+
+/*!
+    Returns the type of the current error, or NoError if no error occurred.
+
+    \sa errorString(), parseError()
+*/
+QJsonStreamReader::Error QJsonStreamReader::error() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->error;
+}
+
+/*!
+    Returns the reason for the current error in terms of
+    QJsonParseError::ParseError, or QJsonParseError::NoError if no error
+    occurred. For PrematureEndOfDocumentError, this is the error
+    QJsonDocument::fromJson() would report for the truncated document.
+
+    \sa error(), errorString()
+*/
+QJsonParseError::ParseError QJsonStreamReader::parseError() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->parseError;
+}
+
+/*!
+    Returns the error message that was set with the current error, or an
+    empty string if no error occurred.
+
+    \sa error(), tokenOffset()
+*/
+QString QJsonStreamReader::errorString() const
+{
+    Q_D(const QJsonStreamReader);
+    if (d->error == NoError)
+        return QString();
+    QJsonParseError e;
+    e.offset = int(d->errorOffset);
+    e.error = d->parseError;
+    return e.errorString();
+}
+
+/*!
+    Returns \c true if an error has occurred, otherwise \c false.
+
+    \sa errorString(), error()
+*/
+bool QJsonStreamReader::hasError() const
+{
+    Q_D(const QJsonStreamReader);
+    return d->error != NoError;
+}
+
+QT_END_NAMESPACE
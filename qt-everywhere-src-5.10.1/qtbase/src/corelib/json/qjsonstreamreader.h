@@ -0,0 +1,126 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QJSONSTREAMREADER_H
+#define QJSONSTREAMREADER_H
+
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qscopedpointer.h>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+class QJsonStreamReaderPrivate;
+
+class Q_CORE_EXPORT QJsonStreamReader
+{
+public:
+    enum TokenType {
+        NoToken = 0,
+        Invalid,
+        StartArray,
+        EndArray,
+        StartObject,
+        EndObject,
+        String,
+        Double,
+        Bool,
+        Null,
+        EndDocument
+    };
+
+    enum Error {
+        NoError,
+        NotWellFormedError,
+        PrematureEndOfDocumentError
+    };
+
+    QJsonStreamReader();
+    explicit QJsonStreamReader(QIODevice *device);
+    explicit QJsonStreamReader(const QByteArray &data);
+    ~QJsonStreamReader();
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+    void addData(const QByteArray &data);
+    void clear();
+
+    bool atEnd() const;
+    TokenType readNext();
+    bool skipCurrentContainer();
+
+    TokenType tokenType() const;
+    QString tokenString() const;
+
+    inline bool isStartArray() const { return tokenType() == StartArray; }
+    inline bool isEndArray() const { return tokenType() == EndArray; }
+    inline bool isStartObject() const { return tokenType() == StartObject; }
+    inline bool isEndObject() const { return tokenType() == EndObject; }
+    inline bool isString() const { return tokenType() == String; }
+    inline bool isDouble() const { return tokenType() == Double; }
+    inline bool isBool() const { return tokenType() == Bool; }
+    inline bool isNull() const { return tokenType() == Null; }
+
+    int depth() const;
+    qint64 tokenOffset() const;
+
+    QString name() const;
+    QByteArray utf8Name() const;
+    QString text() const;
+    QByteArray utf8Text() const;
+    double doubleValue() const;
+    bool boolValue() const;
+
+    QJsonValue value() const;
+    QJsonValue readValue();
+
+    Error error() const;
+    QJsonParseError::ParseError parseError() const;
+    QString errorString() const;
+    bool hasError() const;
+
+private:
+    Q_DISABLE_COPY(QJsonStreamReader)
+    Q_DECLARE_PRIVATE(QJsonStreamReader)
+    QScopedPointer<QJsonStreamReaderPrivate> d_ptr;
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONSTREAMREADER_H
@@ -0,0 +1,677 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qjsonstreamwriter.h"
+#include <qjsonarray.h>
+#include <qjsonobject.h>
+#include <qiodevice.h>
+#include <qlocale.h>
+#include <qnumeric.h>
+#include <qvarlengtharray.h>
+#include "qjsonwriter_p.h"
+
+#include <cmath>
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QJsonStreamWriter
+    \inmodule QtCore
+    \ingroup json
+    \reentrant
+    \since 5.11
+
+    \brief The QJsonStreamWriter class provides a JSON writer with a simple
+    streaming API.
+
+    QJsonStreamWriter is the counterpart to QJsonStreamReader for writing
+    JSON. Instead of building a QJsonDocument and converting it with
+    QJsonDocument::toJson(), the document is written value by value, and
+    the output is passed on to the device() in chunks while it is being
+    produced. This keeps the memory used for large documents constant and
+    lets the first bytes leave the process as early as possible, for
+    instance when writing a response to a QTcpSocket.
+
+    \code
+        QJsonStreamWriter writer(&socket);
+        writer.writeStartArray();
+        for (const Record &record : records) {
+            writer.writeStartObject();
+            writer.writeDouble(QStringLiteral("id"), record.id);
+            writer.writeString(QStringLiteral("name"), record.name);
+            writer.writeEndObject();
+        }
+        writer.writeEndArray();
+    \endcode
+
+    Values inside an object are written with the overloads taking a \c name,
+    values inside an array with the overloads without one. Strings are
+    escaped and converted to UTF-8 directly into the output buffer, and
+    integral numbers are formatted without allocating memory.
+
+    With autoFormatting() enabled, the output matches
+    QJsonDocument::toJson(QJsonDocument::Indented), otherwise it matches
+    QJsonDocument::Compact.
+
+    Output is buffered internally. It is passed to the device when the
+    buffer is full, when the top level array or object is closed, and when
+    flush() is called or the writer is destroyed. When writing to a
+    QByteArray, the data is appended to the array immediately.
+
+    \sa QJsonStreamReader, QJsonDocument::toJson(), QXmlStreamWriter
+*/
+
+static const int writeChunkSize = 16 * 1024;
+
+class QJsonStreamWriterPrivate
+{
+public:
+    struct Level {
+        char type;
+        bool hasElements;
+    };
+
+    QJsonStreamWriterPrivate()
+        : device(nullptr), array(nullptr), cursor(nullptr), limit(nullptr),
+          autoFormatting(false), hasError(false)
+    {
+    }
+
+    void setTarget(QIODevice *dev, QByteArray *ba);
+    void reserve(int size)
+    {
+        if (limit - cursor < size)
+            grow(size);
+    }
+    void grow(int size);
+    void commit();
+    void flush();
+
+    void write(const char *data, int len)
+    {
+        reserve(len);
+        memcpy(cursor, data, size_t(len));
+        cursor += len;
+    }
+    void write(char c)
+    {
+        reserve(1);
+        *cursor++ = uchar(c);
+    }
+    void writeIndent(int level);
+    void writeEscaped(const QString &s);
+    void writeNumber(double d);
+
+    void beginValue(const QString *name);
+    void startContainer(char type, const QString *name);
+    void endContainer(char type, const char *function);
+    void writeValue(const QString *name, const QJsonValue &value);
+
+    QIODevice *device;
+    QByteArray *array;
+    QByteArray chunk;
+    uchar *cursor;
+    uchar *limit;
+    QVarLengthArray<Level, 32> levels;
+    bool autoFormatting;
+    bool hasError;
+};
+
+void QJsonStreamWriterPrivate::setTarget(QIODevice *dev, QByteArray *ba)
+{
+    flush();
+    device = dev;
+    array = ba;
+    if (array) {
+        cursor = limit = reinterpret_cast<uchar *>(array->data()) + array->size();
+    } else {
+        chunk.resize(writeChunkSize);
+        cursor = reinterpret_cast<uchar *>(chunk.data());
+        limit = cursor + chunk.size();
+    }
+}
+
+/*
+    Makes room for at least \a size bytes at the cursor: when writing to a
+    device the pending data is passed on, a QByteArray target is enlarged.
+*/
+void QJsonStreamWriterPrivate::grow(int size)
+{
+    if (array) {
+        const int used = int(cursor - reinterpret_cast<const uchar *>(array->constData()));
+        array->resize(used + size);
+        cursor = reinterpret_cast<uchar *>(array->data()) + used;
+        limit = cursor + size;
+        return;
+    }
+
+    flush();
+    if (chunk.size() < size) {
+        chunk.resize(size);
+        cursor = reinterpret_cast<uchar *>(chunk.data());
+        limit = cursor + chunk.size();
+    }
+}
+
+/*
+    Trims a QByteArray target to the data written so far, so that it can be
+    inspected between calls. This does not release its capacity.
+*/
+void QJsonStreamWriterPrivate::commit()
+{
+    if (array) {
+        const int used = int(cursor - reinterpret_cast<const uchar *>(array->constData()));
+        array->resize(used);
+        cursor = limit = reinterpret_cast<uchar *>(array->data()) + used;
+    }
+}
+
+void QJsonStreamWriterPrivate::flush()
+{
+    if (array) {
+        commit();
+        return;
+    }
+    uchar *begin = reinterpret_cast<uchar *>(chunk.data());
+    const qint64 len = cursor - begin;
+    if (len && device && device->write(reinterpret_cast<const char *>(begin), len) != len)
+        hasError = true;
+    cursor = begin;
+}
+
+void QJsonStreamWriterPrivate::writeIndent(int level)
+{
+    if (!autoFormatting)
+        return;
+    const int len = 4 * level;
+    reserve(len);
+    memset(cursor, ' ', size_t(len));
+    cursor += len;
+}
+
+void QJsonStreamWriterPrivate::writeEscaped(const QString &s)
+{
+    write('"');
+    const ushort *src = s.utf16();
+    const ushort *const end = src + s.size();
+    while (src != end) {
+        // escaping stops short of the limit if the text expands, the rest
+        // goes into the next block
+        reserve(int(qMin<qptrdiff>(end - src, 4096)) * 3 + 7);
+        cursor = QJsonPrivate::Writer::escapeString(cursor, limit, src, end);
+    }
+    write('"');
+}
+
+void QJsonStreamWriterPrivate::writeNumber(double d)
+{
+    if (!qIsFinite(d)) {
+        write("null", 4); // +INF || -INF || NaN (see RFC4627#section2.4)
+        return;
+    }
+
+    const double abs = std::abs(d);
+    if (abs < double(Q_UINT64_C(1) << 53) && abs == static_cast<quint64>(abs)
+            && !(d == 0 && std::signbit(d))) {
+        char buf[20];
+        char *p = buf + sizeof buf;
+        quint64 n = static_cast<quint64>(abs);
+        do {
+            *--p = char('0' + n % 10);
+            n /= 10;
+        } while (n);
+        if (d < 0)
+            *--p = '-';
+        write(p, int(buf + sizeof buf - p));
+        return;
+    }
+
+    // same format as QJsonDocument::toJson()
+    const QByteArray number = QByteArray::number(d, abs == static_cast<quint64>(abs) ? 'f' : 'g',
+                                                 QLocale::FloatingPointShortest);
+    write(number.constData(), number.size());
+}
+
+/*
+    Writes the separator, indentation and, inside objects, the member name
+    preceding a value.
+*/
+void QJsonStreamWriterPrivate::beginValue(const QString *name)
+{
+    if (levels.isEmpty()) {
+        if (name)
+            qWarning("QJsonStreamWriter: Name ignored for a value outside of an object");
+        return;
+    }
+
+    Level &level = levels.last();
+    if (level.hasElements) {
+        if (autoFormatting)
+            write(",\n", 2);
+        else
+            write(',');
+    }
+    level.hasElements = true;
+    writeIndent(levels.size());
+
+    if (level.type == '{') {
+        if (!name)
+            qWarning("QJsonStreamWriter: Value in an object written without a name");
+        writeEscaped(name ? *name : QString());
+        if (autoFormatting)
+            write(": ", 2);
+        else
+            write(':');
+    } else if (name) {
+        qWarning("QJsonStreamWriter: Name ignored for a value in an array");
+    }
+}
+
+void QJsonStreamWriterPrivate::startContainer(char type, const QString *name)
+{
+    beginValue(name);
+    write(type);
+    if (autoFormatting)
+        write('\n');
+    const Level level = { type, false };
+    levels.append(level);
+}
+
+void QJsonStreamWriterPrivate::endContainer(char type, const char *function)
+{
+    if (levels.isEmpty() || levels.last().type != type) {
+        qWarning("QJsonStreamWriter::%s: No matching start of the container", function);
+        return;
+    }
+
+    const bool hasElements = levels.last().hasElements;
+    levels.removeLast();
+    if (autoFormatting && hasElements)
+        write('\n');
+    writeIndent(levels.size());
+    write(type == '[' ? ']' : '}');
+
+    if (levels.isEmpty()) {
+        if (autoFormatting)
+            write('\n');
+        flush();
+    }
+}
+
+void QJsonStreamWriterPrivate::writeValue(const QString *name, const QJsonValue &value)
+{
+    switch (value.type()) {
+    case QJsonValue::Array: {
+        startContainer('[', name);
+        const QJsonArray a = value.toArray();
+        for (const QJsonValue &v : a)
+            writeValue(nullptr, v);
+        endContainer('[', "writeValue");
+        return;
+    }
+    case QJsonValue::Object: {
+        startContainer('{', name);
+        const QJsonObject o = value.toObject();
+        for (QJsonObject::const_iterator it = o.constBegin(), end = o.constEnd(); it != end; ++it) {
+            const QString key = it.key();
+            writeValue(&key, it.value());
+        }
+        endContainer('{', "writeValue");
+        return;
+    }
+    default:
+        break;
+    }
+
+    beginValue(name);
+    switch (value.type()) {
+    case QJsonValue::Bool:
+        if (value.toBool())
+            write("true", 4);
+        else
+            write("false", 5);
+        break;
+    case QJsonValue::Double:
+        writeNumber(value.toDouble());
+        break;
+    case QJsonValue::String:
+        writeEscaped(value.toString());
+        break;
+    default:
+        write("null", 4);
+        break;
+    }
+}
+
+/*!
+    Constructs a stream writer.
+
+    \sa setDevice()
+*/
+QJsonStreamWriter::QJsonStreamWriter()
+    : d_ptr(new QJsonStreamWriterPrivate)
+{
+    Q_D(QJsonStreamWriter);
+    d->setTarget(nullptr, nullptr);
+}
+
+/*!
+    Constructs a stream writer that writes into \a device.
+*/
+QJsonStreamWriter::QJsonStreamWriter(QIODevice *device)
+    : d_ptr(new QJsonStreamWriterPrivate)
+{
+    Q_D(QJsonStreamWriter);
+    d->setTarget(device, nullptr);
+}
+
+/*!
+    Constructs a stream writer that appends to \a array.
+*/
+QJsonStreamWriter::QJsonStreamWriter(QByteArray *array)
+    : d_ptr(new QJsonStreamWriterPrivate)
+{
+    Q_D(QJsonStreamWriter);
+    d->setTarget(nullptr, array);
+}
+
+/*!
+    Destructor. Passes any buffered output on to the device().
+*/
+QJsonStreamWriter::~QJsonStreamWriter()
+{
+    Q_D(QJsonStreamWriter);
+    d->flush();
+}
+
+/*!
+    Sets the current device to \a device. Output buffered for the previous
+    device is written to it first. If you want the stream to write into a
+    QByteArray, use the QJsonStreamWriter(QByteArray *) constructor.
+
+    \sa device()
+*/
+void QJsonStreamWriter::setDevice(QIODevice *device)
+{
+    Q_D(QJsonStreamWriter);
+    if (device == d->device && !d->array)
+        return;
+    d->setTarget(device, nullptr);
+}
+
+/*!
+    Returns the current device associated with the QJsonStreamWriter, or
+    \nullptr if no device has been assigned.
+
+    \sa setDevice()
+*/
+QIODevice *QJsonStreamWriter::device() const
+{
+    Q_D(const QJsonStreamWriter);
+    return d->device;
+}
+
+/*!
+    Enables auto formatting if \a enable is \c true, otherwise disables it.
+
+    The default value is \c false. With auto formatting, the output is
+    indented like the output of
+    QJsonDocument::toJson(QJsonDocument::Indented).
+
+    \sa autoFormatting()
+*/
+void QJsonStreamWriter::setAutoFormatting(bool enable)
+{
+    Q_D(QJsonStreamWriter);
+    d->autoFormatting = enable;
+}
+
+/*!
+    Returns \c true if auto formatting is enabled, otherwise \c false.
+
+    \sa setAutoFormatting()
+*/
+bool QJsonStreamWriter::autoFormatting() const
+{
+    Q_D(const QJsonStreamWriter);
+    return d->autoFormatting;
+}
+
+/*!
+    Writes the start of an array. This function is used for arrays at the
+    top level and for arrays inside of other arrays.
+
+    \sa writeEndArray()
+*/
+void QJsonStreamWriter::writeStartArray()
+{
+    Q_D(QJsonStreamWriter);
+    d->startContainer('[', nullptr);
+    d->commit();
+}
+
+/*!
+    \overload
+
+    Writes the start of an array that is the member \a name of the current
+    object.
+*/
+void QJsonStreamWriter::writeStartArray(const QString &name)
+{
+    Q_D(QJsonStreamWriter);
+    d->startContainer('[', &name);
+    d->commit();
+}
+
+/*!
+    Closes the array opened by the matching writeStartArray().
+*/
+void QJsonStreamWriter::writeEndArray()
+{
+    Q_D(QJsonStreamWriter);
+    d->endContainer('[', "writeEndArray");
+    d->commit();
+}
+
+/*!
+    Writes the start of an object. This function is used for objects at the
+    top level and for objects inside of arrays.
+
+    \sa writeEndObject()
+*/
+void QJsonStreamWriter::writeStartObject()
+{
+    Q_D(QJsonStreamWriter);
+    d->startContainer('{', nullptr);
+    d->commit();
+}
+
+/*!
+    \overload
+
+    Writes the start of an object that is the member \a name of the current
+    object.
+*/
+void QJsonStreamWriter::writeStartObject(const QString &name)
+{
+    Q_D(QJsonStreamWriter);
+    d->startContainer('{', &name);
+    d->commit();
+}
+
+/*!
+    Closes the object opened by the matching writeStartObject().
+*/
+void QJsonStreamWriter::writeEndObject()
+{
+    Q_D(QJsonStreamWriter);
+    d->endContainer('{', "writeEndObject");
+    d->commit();
+}
+
+/*!
+    Writes the string \a value as an element of the current array.
+*/
+void QJsonStreamWriter::writeString(const QString &value)
+{
+    Q_D(QJsonStreamWriter);
+    d->beginValue(nullptr);
+    d->writeEscaped(value);
+    d->commit();
+}
+
+/*!
+    \overload
+
+    Writes the string \a value as the member \a name of the current object.
+*/
+void QJsonStreamWriter::writeString(const QString &name, const QString &value)
+{
+    Q_D(QJsonStreamWriter);
+    d->beginValue(&name);
+    d->writeEscaped(value);
+    d->commit();
+}
+
+/*!
+    Writes the number \a value as an element of the current array. Numbers
+    that are not finite are written as \c null.
+*/
+void QJsonStreamWriter::writeDouble(double value)
+{
+    Q_D(QJsonStreamWriter);
+    d->beginValue(nullptr);
+    d->writeNumber(value);
+    d->commit();
+}
+
+/*!
+    \overload
+
+    Writes the number \a value as the member \a name of the current object.
+*/
+void QJsonStreamWriter::writeDouble(const QString &name, double value)
+{
+    Q_D(QJsonStreamWriter);
+    d->beginValue(&name);
+    d->writeNumber(value);
+    d->commit();
+}
+
+/*!
+    Writes the boolean \a value as an element of the current array.
+*/
+void QJsonStreamWriter::writeBool(bool value)
+{
+    writeValue(QJsonValue(value));
+}
+
+/*!
+    \overload
+
+    Writes the boolean \a value as the member \a name of the current object.
+*/
+void QJsonStreamWriter::writeBool(const QString &name, bool value)
+{
+    writeValue(name, QJsonValue(value));
+}
+
+/*!
+    Writes \c null as an element of the current array.
+*/
+void QJsonStreamWriter::writeNull()
+{
+    writeValue(QJsonValue());
+}
+
+/*!
+    \overload
+
+    Writes \c null as the member \a name of the current object.
+*/
+void QJsonStreamWriter::writeNull(const QString &name)
+{
+    writeValue(name, QJsonValue());
+}
+
+/*!
+    Writes \a value as an element of the current array. Arrays and objects
+    are written including their contents. An undefined value is written as
+    \c null.
+*/
+void QJsonStreamWriter::writeValue(const QJsonValue &value)
+{
+    Q_D(QJsonStreamWriter);
+    d->writeValue(nullptr, value);
+    d->commit();
+}
+
+/*!
+    \overload
+
+    Writes \a value as the member \a name of the current object.
+*/
+void QJsonStreamWriter::writeValue(const QString &name, const QJsonValue &value)
+{
+    Q_D(QJsonStreamWriter);
+    d->writeValue(&name, value);
+    d->commit();
+}
+
+/*!
+    Writes all buffered output to the device(). This does not flush the
+    device itself.
+*/
+void QJsonStreamWriter::flush()
+{
+    Q_D(QJsonStreamWriter);
+    d->flush();
+}
+
+/*!
+    Returns \c true if writing to the device() failed, otherwise \c false.
+*/
+bool QJsonStreamWriter::hasError() const
+{
+    Q_D(const QJsonStreamWriter);
+    return d->hasError;
+}
+
+QT_END_NAMESPACE
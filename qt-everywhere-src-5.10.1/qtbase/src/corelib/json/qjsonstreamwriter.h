@@ -0,0 +1,94 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QJSONSTREAMWRITER_H
+#define QJSONSTREAMWRITER_H
+
+#include <QtCore/qjsonvalue.h>
+#include <QtCore/qscopedpointer.h>
+
+QT_BEGIN_NAMESPACE
+
+class QIODevice;
+class QJsonStreamWriterPrivate;
+
+class Q_CORE_EXPORT QJsonStreamWriter
+{
+public:
+    QJsonStreamWriter();
+    explicit QJsonStreamWriter(QIODevice *device);
+    explicit QJsonStreamWriter(QByteArray *array);
+    ~QJsonStreamWriter();
+
+    void setDevice(QIODevice *device);
+    QIODevice *device() const;
+
+    void setAutoFormatting(bool enable);
+    bool autoFormatting() const;
+
+    void writeStartArray();
+    void writeStartArray(const QString &name);
+    void writeEndArray();
+    void writeStartObject();
+    void writeStartObject(const QString &name);
+    void writeEndObject();
+
+    void writeString(const QString &value);
+    void writeString(const QString &name, const QString &value);
+    void writeDouble(double value);
+    void writeDouble(const QString &name, double value);
+    void writeBool(bool value);
+    void writeBool(const QString &name, bool value);
+    void writeNull();
+    void writeNull(const QString &name);
+    void writeValue(const QJsonValue &value);
+    void writeValue(const QString &name, const QJsonValue &value);
+
+    void flush();
+    bool hasError() const;
+
+private:
+    Q_DISABLE_COPY(QJsonStreamWriter)
+    Q_DECLARE_PRIVATE(QJsonStreamWriter)
+    QScopedPointer<QJsonStreamWriterPrivate> d_ptr;
+};
+
+QT_END_NAMESPACE
+
+#endif // QJSONSTREAMWRITER_H
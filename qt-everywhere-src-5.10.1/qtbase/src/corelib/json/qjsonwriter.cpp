@@ -56,25 +56,11 @@ static inline uchar hexdig(uint u)
     return (u < 0xa ? '0' + u : 'a' + u - 0xa);
 }
 
-static QByteArray escapedString(const QString &s)
+uchar *Writer::escapeString(uchar *cursor, const uchar *limit, const ushort *&src, const ushort *end)
 {
     const uchar replacement = '?';
-    QByteArray ba(s.length(), Qt::Uninitialized);
-
-    uchar *cursor = reinterpret_cast<uchar *>(const_cast<char *>(ba.constData()));
-    const uchar *ba_end = cursor + ba.length();
-    const ushort *src = reinterpret_cast<const ushort *>(s.constBegin());
-    const ushort *const end = reinterpret_cast<const ushort *>(s.constEnd());
-
-    while (src != end) {
-        if (cursor >= ba_end - 6) {
-            // ensure we have enough space
-            int pos = cursor - (const uchar *)ba.constData();
-            ba.resize(ba.size()*2);
-            cursor = (uchar *)ba.data() + pos;
-            ba_end = (const uchar *)ba.constData() + ba.length();
-        }
 
+    while (src != end && cursor < limit - 6) {
         uint u = *src++;
         if (u < 0x80) {
             if (u < 0x20 || u == 0x22 || u == 0x5c) {
@@ -116,6 +102,29 @@ static QByteArray escapedString(const QString &s)
                 *cursor++ = replacement;
         }
     }
+    return cursor;
+}
+
+static QByteArray escapedString(const QString &s)
+{
+    QByteArray ba(s.length(), Qt::Uninitialized);
+
+    uchar *cursor = reinterpret_cast<uchar *>(const_cast<char *>(ba.constData()));
+    const uchar *ba_end = cursor + ba.length();
+    const ushort *src = reinterpret_cast<const ushort *>(s.constBegin());
+    const ushort *const end = reinterpret_cast<const ushort *>(s.constEnd());
+
+    for (;;) {
+        cursor = Writer::escapeString(cursor, ba_end, src, end);
+        if (src == end)
+            break;
+
+        // ensure we have enough space
+        int pos = cursor - (const uchar *)ba.constData();
+        ba.resize(ba.size()*2);
+        cursor = (uchar *)ba.data() + pos;
+        ba_end = (const uchar *)ba.constData() + ba.length();
+    }
 
     ba.resize(cursor - (const uchar *)ba.constData());
     return ba;
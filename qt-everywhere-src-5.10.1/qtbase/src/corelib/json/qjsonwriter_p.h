@@ -64,6 +64,9 @@ class Writer
 public:
     static void objectToJson(const QJsonPrivate::Object *o, QByteArray &json, int indent, bool compact = false);
     static void arrayToJson(const QJsonPrivate::Array *a, QByteArray &json, int indent, bool compact = false);
+
+    // escapes from src until it reaches end or fewer than 7 bytes are left before limit
+    static uchar *escapeString(uchar *cursor, const uchar *limit, const ushort *&src, const ushort *end);
 };
 
 }
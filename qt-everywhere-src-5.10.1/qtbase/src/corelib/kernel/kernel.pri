@@ -8,10 +8,12 @@ HEADERS += \
         kernel/qdeadlinetimer_p.h \
         kernel/qelapsedtimer.h \
         kernel/qeventloop.h\
+        kernel/qeventloopprofiler_p.h \
         kernel/qpointer.h \
         kernel/qcorecmdlineargs_p.h \
         kernel/qcoreapplication.h \
         kernel/qcoreevent.h \
+        kernel/qcoroutine.h \
         kernel/qmetaobject.h \
         kernel/qmetatype.h \
         kernel/qmimedata.h \
@@ -51,6 +53,7 @@ SOURCES += \
         kernel/qdeadlinetimer.cpp \
         kernel/qelapsedtimer.cpp \
         kernel/qeventloop.cpp \
+        kernel/qeventloopprofiler.cpp \
         kernel/qcoreapplication.cpp \
         kernel/qcoreevent.cpp \
         kernel/qmetaobject.cpp \
@@ -155,6 +158,11 @@ unix|integrity {
 
     qtConfig(poll_select): SOURCES += kernel/qpoll.cpp
 
+    linux {
+        SOURCES += kernel/qeventdispatcher_epoll.cpp
+        HEADERS += kernel/qeventdispatcher_epoll_p.h
+    }
+
     qtConfig(glib) {
         SOURCES += \
             kernel/qeventdispatcher_glib.cpp
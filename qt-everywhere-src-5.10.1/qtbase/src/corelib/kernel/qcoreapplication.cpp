@@ -45,6 +45,7 @@
 #include "qabstracteventdispatcher.h"
 #include "qcoreevent.h"
 #include "qeventloop.h"
+#include "qeventloopprofiler_p.h"
 #endif
 #include "qcorecmdlineargs_p.h"
 #include <qdatastream.h>
@@ -69,6 +70,7 @@
 #include <private/qfunctions_p.h>
 #include <private/qlocale_p.h>
 #include <private/qhooks_p.h>
+#include <private/qtcore_tracepoints_p.h>
 
 #ifndef QT_NO_QOBJECT
 #if defined(Q_OS_UNIX)
@@ -79,6 +81,9 @@
 #   include "qeventdispatcher_glib_p.h"
 #  endif
 # endif
+# if defined(Q_OS_LINUX)
+#  include "qeventdispatcher_epoll_p.h"
+# endif
 # include "qeventdispatcher_unix_p.h"
 #endif
 #ifdef Q_OS_WIN
@@ -514,6 +519,7 @@ void QCoreApplicationPrivate::cleanupThreadData()
 
         // need to clear the state of the mainData, just in case a new QCoreApplication comes along.
         QMutexLocker locker(&threadData->postEventList.mutex);
+        flushIncomingPostedEvents(threadData);
         for (int i = 0; i < threadData->postEventList.size(); ++i) {
             const QPostEvent &pe = threadData->postEventList.at(i);
             if (pe.event) {
@@ -540,12 +546,17 @@ void QCoreApplicationPrivate::createEventDispatcher()
         eventDispatcher = new QEventDispatcherCoreFoundation(q);
     else
         eventDispatcher = new QEventDispatcherUNIX(q);
-#  elif !defined(QT_NO_GLIB)
+#  else
+#    if defined(Q_OS_LINUX)
+    if (QEventDispatcherEpoll::isRequested())
+        eventDispatcher = new QEventDispatcherEpoll(q);
+    else
+#    endif
+#    if !defined(QT_NO_GLIB)
     if (qEnvironmentVariableIsEmpty("QT_NO_GLIB") && QEventDispatcherGlib::versionSupported())
         eventDispatcher = new QEventDispatcherGlib(q);
     else
-        eventDispatcher = new QEventDispatcherUNIX(q);
-#  else
+#    endif
         eventDispatcher = new QEventDispatcherUNIX(q);
 #  endif
 #elif defined(Q_OS_WINRT)
@@ -907,6 +918,8 @@ QCoreApplication::~QCoreApplication()
     if (QCoreApplicationPrivate::eventDispatcher)
         QCoreApplicationPrivate::eventDispatcher->closingDown();
     QCoreApplicationPrivate::eventDispatcher = 0;
+
+    QEventLoopProfiler::applicationDestroyed();
 #endif
 
 #if QT_CONFIG(library)
@@ -1045,9 +1058,11 @@ bool QCoreApplication::notifyInternal2(QObject *receiver, QEvent *event)
     QObjectPrivate *d = receiver->d_func();
     QThreadData *threadData = d->threadData;
     QScopedScopeLevelCounter scopeLevelCounter(threadData);
-    if (!selfRequired)
-        return doNotify(receiver, event);
-    return self->notify(receiver, event);
+    QEventLoopProfiler::EventScope profilerScope(receiver, event, threadData);
+    Q_TRACE(QCoreApplication_notify_entry, receiver, event, event->type());
+    const bool consumed = selfRequired ? self->notify(receiver, event) : doNotify(receiver, event);
+    Q_TRACE(QCoreApplication_notify_exit, consumed);
+    return consumed;
 }
 
 /*!
@@ -1442,6 +1457,8 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         return;
     }
 
+    Q_TRACE(QCoreApplication_postEvent_entry, receiver, event, event->type());
+
     QThreadData * volatile * pdata = &receiver->d_func()->threadData;
     QThreadData *data = *pdata;
     if (!data) {
@@ -1450,6 +1467,32 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         return;
     }
 
+    if (event->type() != QEvent::DeferredDelete && data != QThreadData::current(false)) {
+        // events posted from other threads are pushed without taking the
+        // mutex; the receiving thread compresses and sorts them when it
+        // flushes them into its list
+        QScopedPointer<QEvent> eventDeleter(event);
+        QPostEventNode *node = new QPostEventNode;
+        node->event = QPostEvent(receiver, event, priority);
+        eventDeleter.take();
+
+        QPostEventList &list = data->postEventList;
+        list.pushers.ref();
+        if (data == *pdata) {
+            const bool needsWakeUp = list.pushIncoming(node);
+            list.pushers.deref();
+            if (needsWakeUp) {
+                QAbstractEventDispatcher *dispatcher = data->eventDispatcher.loadAcquire();
+                if (dispatcher)
+                    dispatcher->wakeUp();
+            }
+            return;
+        }
+        // the receiver is moving to another thread, follow it the slow way
+        list.pushers.deref();
+        delete node;
+    }
+
     // lock the post event mutex
     data->postEventList.mutex.lock();
 
@@ -1469,9 +1512,13 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
 
     QMutexUnlocker locker(&data->postEventList.mutex);
 
+    // keep the posting order with events pushed by other threads
+    QCoreApplicationPrivate::flushIncomingPostedEvents(data);
+
     // if this is one of the compressible events, do compression
     if (receiver->d_func()->postedEvents
         && self && self->compressEvent(event, receiver, &data->postEventList)) {
+        Q_TRACE(QCoreApplication_postEvent_event_compressed, receiver, event);
         return;
     }
 
@@ -1505,6 +1552,8 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
     QScopedPointer<QEvent> eventDeleter(event);
     data->postEventList.addEvent(QPostEvent(receiver, event, priority));
     eventDeleter.take();
+    Q_TRACE(QCoreApplication_postEvent_event_posted, receiver, event, event->type(),
+            data->postEventList.size() - data->postEventList.startOffset);
     event->posted = true;
     ++receiver->d_func()->postedEvents;
     data->canWait = false;
@@ -1515,6 +1564,63 @@ void QCoreApplication::postEvent(QObject *receiver, QEvent *event, int priority)
         dispatcher->wakeUp();
 }
 
+/*!
+  \internal
+  Moves the events that other threads pushed for \a data into its list of
+  posted events, in posting order, compressing them as postEvent() does.
+  Events whose receiver has since moved to another thread are forwarded
+  to that thread. The list's mutex must be locked.
+*/
+void QCoreApplicationPrivate::flushIncomingPostedEvents(QThreadData *data)
+{
+    QPostEventList &list = data->postEventList;
+    if (!list.wakeUpPending.loadAcquire() && !list.hasIncoming())
+        return;
+
+    // posters pushing after this point wake the thread up again
+    list.wakeUpPending.fetchAndStoreOrdered(0);
+
+    for (int lane = 0; lane < QPostEventList::LaneCount; ++lane) {
+        // the stack holds the most recent event first
+        QPostEventNode *node = list.takeIncoming(lane);
+        QPostEventNode *pending = 0;
+        while (node) {
+            QPostEventNode *next = node->next;
+            node->next = pending;
+            pending = node;
+            node = next;
+        }
+
+        while (pending) {
+            node = pending;
+            pending = pending->next;
+            const QPostEvent &pe = node->event;
+
+            QThreadData *target = pe.receiver->d_func()->threadData;
+            if (Q_UNLIKELY(target != data)) {
+                if (!target) {
+                    delete pe.event;
+                    delete node;
+                } else if (target->postEventList.pushIncoming(node)) {
+                    QAbstractEventDispatcher *dispatcher = target->eventDispatcher.loadAcquire();
+                    if (dispatcher)
+                        dispatcher->wakeUp();
+                }
+                continue;
+            }
+
+            if (!(pe.receiver->d_func()->postedEvents && QCoreApplication::self
+                  && QCoreApplication::self->compressEvent(pe.event, pe.receiver, &list))) {
+                list.addEvent(pe);
+                pe.event->posted = true;
+                ++pe.receiver->d_func()->postedEvents;
+                data->canWait = false;
+            }
+            delete node;
+        }
+    }
+}
+
 /*!
   \internal
   Returns \c true if \a event was compressed away (possibly deleted) and should not be added to the list.
@@ -1611,6 +1717,7 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
     ++data->postEventList.recursion;
 
     QMutexLocker locker(&data->postEventList.mutex);
+    flushIncomingPostedEvents(data);
 
     // by default, we assume that the event dispatcher can go to sleep after
     // processing all events. if any new events are posted while we send
@@ -1622,6 +1729,9 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
         return;
     }
 
+    Q_TRACE(QCoreApplication_sendPostedEvents_entry, receiver, event_type,
+            data->postEventList.size() - data->postEventList.startOffset);
+
     data->canWait = true;
 
     // okay. here is the tricky loop. be careful about optimizing
@@ -1660,6 +1770,8 @@ void QCoreApplicationPrivate::sendPostedEvents(QObject *receiver, int event_type
                 Q_ASSERT(data->postEventList.insertionOffset >= 0);
                 data->postEventList.startOffset = 0;
             }
+
+            Q_TRACE(QCoreApplication_sendPostedEvents_exit, receiver, event_type);
         }
     };
     CleanUp cleanup(receiver, event_type, data);
@@ -1771,6 +1883,7 @@ void QCoreApplication::removePostedEvents(QObject *receiver, int eventType)
 {
     QThreadData *data = receiver ? receiver->d_func()->threadData : QThreadData::current();
     QMutexLocker locker(&data->postEventList.mutex);
+    QCoreApplicationPrivate::flushIncomingPostedEvents(data);
 
     // the QObject destructor calls this function directly.  this can
     // happen while the event loop is in the middle of posting events,
@@ -1836,6 +1949,7 @@ void QCoreApplicationPrivate::removePostedEvent(QEvent * event)
     QThreadData *data = QThreadData::current();
 
     QMutexLocker locker(&data->postEventList.mutex);
+    flushIncomingPostedEvents(data);
 
     if (data->postEventList.size() == 0) {
 #if defined(QT_DEBUG)
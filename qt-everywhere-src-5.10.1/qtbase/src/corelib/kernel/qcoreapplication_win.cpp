@@ -1034,6 +1034,7 @@ void QCoreApplicationPrivate::removePostedTimerEvent(QObject *object, int timerI
     QThreadData *data = object->d_func()->threadData;
 
     QMutexLocker locker(&data->postEventList.mutex);
+    flushIncomingPostedEvents(data);
     if (data->postEventList.size() == 0)
         return;
     for (int i = 0; i < data->postEventList.size(); ++i) {
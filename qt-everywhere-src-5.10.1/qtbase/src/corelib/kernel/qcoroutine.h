@@ -0,0 +1,312 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QCOROUTINE_H
+#define QCOROUTINE_H
+
+#include <QtCore/qglobal.h>
+
+#if defined(__cpp_impl_coroutine) && QT_HAS_INCLUDE(<coroutine>)
+#  define QT_HAS_COROUTINES
+#endif
+
+#ifdef QT_HAS_COROUTINES
+
+#include <QtCore/qobject.h>
+#include <QtCore/qiodevice.h>
+#include <QtCore/qtimer.h>
+#ifndef QT_NO_QFUTURE
+#include <QtCore/qfuture.h>
+#endif
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+namespace QtCoroutine {
+
+template <typename T = void>
+class Task;
+
+// Resumes the awaiting coroutine the first time \a signal is emitted. The
+// connection is made to a context object owned by the awaiter, so the
+// coroutine is resumed in the thread it was suspended in.
+template <typename Sender, typename Signal>
+class SignalAwaiter
+{
+public:
+    SignalAwaiter(const Sender *sender, Signal signal, bool ready = false)
+        : m_sender(sender), m_signal(signal), m_ready(ready) {}
+
+    bool await_ready() const noexcept { return m_ready; }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_connection = QObject::connect(m_sender, m_signal, &m_context, [this, handle] {
+            QObject::disconnect(m_connection);
+            handle.resume();
+        });
+    }
+    void await_resume() const noexcept {}
+
+private:
+    Q_DISABLE_COPY(SignalAwaiter)
+
+    const Sender *m_sender;
+    Signal m_signal;
+    bool m_ready;
+    QObject m_context;
+    QMetaObject::Connection m_connection;
+};
+
+class DelayAwaiter
+{
+public:
+    explicit DelayAwaiter(int msec, Qt::TimerType timerType = Qt::CoarseTimer)
+        : m_msec(msec), m_timerType(timerType) {}
+
+    bool await_ready() const noexcept { return m_msec < 0; }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        QTimer::singleShot(m_msec, m_timerType, &m_context, [handle] { handle.resume(); });
+    }
+    void await_resume() const noexcept {}
+
+private:
+    Q_DISABLE_COPY(DelayAwaiter)
+
+    int m_msec;
+    Qt::TimerType m_timerType;
+    QObject m_context;
+};
+
+template <typename Sender, typename Signal>
+inline SignalAwaiter<Sender, Signal> signal(const Sender *sender, Signal signal)
+{
+    return SignalAwaiter<Sender, Signal>(sender, signal);
+}
+
+inline SignalAwaiter<QIODevice, void (QIODevice::*)()> readyRead(const QIODevice *device)
+{
+    return SignalAwaiter<QIODevice, void (QIODevice::*)()>(device, &QIODevice::readyRead,
+                                                           device->bytesAvailable() > 0);
+}
+
+// Templated so that QtCore does not need to know about QNetworkReply; works
+// with any class that has a finished() signal and an isFinished() getter.
+template <typename Reply>
+inline SignalAwaiter<Reply, void (Reply::*)()> finished(const Reply *reply)
+{
+    return SignalAwaiter<Reply, void (Reply::*)()>(reply, &Reply::finished, reply->isFinished());
+}
+
+inline DelayAwaiter delay(int msec, Qt::TimerType timerType = Qt::CoarseTimer)
+{
+    return DelayAwaiter(msec, timerType);
+}
+
+#ifndef QT_NO_QFUTURE
+template <typename T>
+class FutureAwaiter
+{
+public:
+    explicit FutureAwaiter(const QFuture<T> &future) : m_future(future) {}
+
+    bool await_ready() const { return m_future.isFinished(); }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        // The continuation runs in whichever thread finishes the future;
+        // bounce back to the thread of the context object before resuming.
+        QtPrivate::ContextExecutor executor = { QPointer<QObject>(&m_context) };
+        QtPrivate::FutureAccess::get(m_future).addContinuation([executor, handle](QFutureInterfaceBase &) {
+            executor.execute([handle] { handle.resume(); });
+        });
+    }
+    T await_resume()
+    {
+        m_future.waitForFinished();
+        return m_future.resultCount() > 0 ? m_future.result() : T();
+    }
+
+private:
+    Q_DISABLE_COPY(FutureAwaiter)
+
+    QFuture<T> m_future;
+    QObject m_context;
+};
+
+template <>
+inline void FutureAwaiter<void>::await_resume()
+{
+    m_future.waitForFinished();
+}
+#endif // QT_NO_QFUTURE
+
+} // namespace QtCoroutine
+
+namespace QtPrivate {
+
+class TaskPromiseBase
+{
+public:
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept { return false; }
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            TaskPromiseBase &promise = handle.promise();
+            if (promise.continuation)
+                return promise.continuation;
+            if (promise.detached)
+                handle.destroy();
+            return std::noop_coroutine();
+        }
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() { exception = std::current_exception(); }
+
+    void rethrowIfFailed() const
+    {
+        if (exception)
+            std::rethrow_exception(exception);
+    }
+
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+    bool detached = false;
+};
+
+template <typename T>
+class TaskPromise : public TaskPromiseBase
+{
+public:
+    QtCoroutine::Task<T> get_return_object();
+
+    template <typename U>
+    void return_value(U &&v) { value.emplace(std::forward<U>(v)); }
+
+    T result()
+    {
+        rethrowIfFailed();
+        return std::move(*value);
+    }
+
+    std::optional<T> value;
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    QtCoroutine::Task<void> get_return_object();
+
+    void return_void() {}
+    void result() { rethrowIfFailed(); }
+};
+
+} // namespace QtPrivate
+
+namespace QtCoroutine {
+
+template <typename T>
+class Task
+{
+public:
+    typedef QtPrivate::TaskPromise<T> promise_type;
+
+    Task(Task &&other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    Task &operator=(Task &&other) noexcept { std::swap(m_handle, other.m_handle); return *this; }
+    ~Task()
+    {
+        if (!m_handle)
+            return;
+        if (m_handle.done())
+            m_handle.destroy();
+        else
+            m_handle.promise().detached = true;
+    }
+
+    bool isFinished() const noexcept { return !m_handle || m_handle.done(); }
+
+    bool await_ready() const noexcept { return m_handle.done(); }
+    void await_suspend(std::coroutine_handle<> handle) noexcept { m_handle.promise().continuation = handle; }
+    T await_resume() { return m_handle.promise().result(); }
+
+private:
+    Q_DISABLE_COPY(Task)
+    friend class QtPrivate::TaskPromise<T>;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+} // namespace QtCoroutine
+
+template <typename T>
+inline QtCoroutine::Task<T> QtPrivate::TaskPromise<T>::get_return_object()
+{
+    return QtCoroutine::Task<T>(std::coroutine_handle<TaskPromise<T> >::from_promise(*this));
+}
+
+inline QtCoroutine::Task<void> QtPrivate::TaskPromise<void>::get_return_object()
+{
+    return QtCoroutine::Task<void>(std::coroutine_handle<TaskPromise<void> >::from_promise(*this));
+}
+
+#ifndef QT_NO_QFUTURE
+template <typename T>
+inline QtCoroutine::FutureAwaiter<T> operator co_await(const QFuture<T> &future)
+{
+    return QtCoroutine::FutureAwaiter<T>(future);
+}
+#endif
+
+QT_END_NAMESPACE
+
+#endif // QT_HAS_COROUTINES
+
+#endif // QCOROUTINE_H
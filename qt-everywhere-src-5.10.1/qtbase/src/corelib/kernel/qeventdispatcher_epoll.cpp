@@ -0,0 +1,529 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qplatformdefs.h"
+
+#include "qcoreapplication.h"
+#include "qsocketnotifier.h"
+#include "qthread.h"
+
+#include "qeventdispatcher_epoll_p.h"
+#include <private/qthread_p.h>
+#include <private/qcoreapplication_p.h>
+#include <private/qcore_unix_p.h>
+
+#include <errno.h>
+#include <stdio.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QEventDispatcherEpoll
+
+    An event dispatcher for Linux that keeps the socket notifiers registered
+    with an epoll(7) instance instead of rebuilding a pollfd array on every
+    iteration of the event loop. Registering, enabling and disabling a
+    notifier costs one epoll_ctl() call, and a wakeup only touches the file
+    descriptors that are actually ready, so the cost of an iteration no
+    longer grows with the number of idle sockets.
+
+    Timers and the thread pipe are handled exactly like in
+    QEventDispatcherUNIX. The dispatcher is used when the
+    QT_EVENT_DISPATCHER_EPOLL environment variable is set to a positive
+    value.
+*/
+
+enum { InitialReadyEvents = 64 };
+
+static const char *socketType(QSocketNotifier::Type type)
+{
+    switch (type) {
+    case QSocketNotifier::Read:
+        return "Read";
+    case QSocketNotifier::Write:
+        return "Write";
+    case QSocketNotifier::Exception:
+        return "Exception";
+    }
+
+    Q_UNREACHABLE();
+}
+
+static inline uint epollEventsFromPollEvents(short events)
+{
+    uint result = 0;
+    if (events & POLLIN)
+        result |= EPOLLIN;
+    if (events & POLLOUT)
+        result |= EPOLLOUT;
+    if (events & POLLPRI)
+        result |= EPOLLPRI;
+    return result;
+}
+
+QEventDispatcherEpollPrivate::QEventDispatcherEpollPrivate()
+    : epollFd(-1), readyEvents(InitialReadyEvents)
+{
+    if (Q_UNLIKELY(threadPipe.init() == false))
+        qFatal("QEventDispatcherEpollPrivate(): Can not continue without a thread pipe");
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (Q_UNLIKELY(epollFd == -1))
+        qFatal("QEventDispatcherEpollPrivate(): Unable to create epoll instance: %s",
+               qPrintable(qt_error_string(errno)));
+
+    epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.fd = threadPipe.fds[0];
+    if (Q_UNLIKELY(epoll_ctl(epollFd, EPOLL_CTL_ADD, threadPipe.fds[0], &ev) == -1))
+        qFatal("QEventDispatcherEpollPrivate(): Unable to watch the thread pipe: %s",
+               qPrintable(qt_error_string(errno)));
+}
+
+QEventDispatcherEpollPrivate::~QEventDispatcherEpollPrivate()
+{
+    if (epollFd >= 0)
+        qt_safe_close(epollFd);
+}
+
+void QEventDispatcherEpollPrivate::setSocketNotifierPending(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+
+    if (pendingNotifiers.contains(notifier))
+        return;
+
+    pendingNotifiers << notifier;
+}
+
+int QEventDispatcherEpollPrivate::activateTimers()
+{
+    return timerList.activateTimers();
+}
+
+/*!
+    \internal
+
+    Brings the epoll registration of \a fd in line with \a events, the
+    poll(2) style events of its notifier set. An empty \a events removes the
+    descriptor from the epoll set.
+*/
+void QEventDispatcherEpollPrivate::updateEpollRegistration(int fd, short events)
+{
+    if (!events) {
+        if (!alwaysReadyFds.removeOne(fd)) {
+            // the descriptor may have been closed already, in which case the
+            // kernel dropped it from the epoll set by itself
+            epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+        }
+        return;
+    }
+
+    if (alwaysReadyFds.contains(fd))
+        return;
+
+    epoll_event ev;
+    ev.events = epollEventsFromPollEvents(events);
+    ev.data.fd = fd;
+
+    // try MOD first: after the first notifier for a descriptor this is the common case
+    if (epoll_ctl(epollFd, EPOLL_CTL_MOD, fd, &ev) == 0)
+        return;
+    if (errno == ENOENT && epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) == 0)
+        return;
+
+    if (errno == EPERM) {
+        // regular files and directories can't be watched, poll(2) reports them as ready
+        alwaysReadyFds.append(fd);
+        return;
+    }
+
+    qWarning("QSocketNotifier: Unable to watch socket %d: %s", fd, qPrintable(qt_error_string(errno)));
+}
+
+void QEventDispatcherEpollPrivate::markPendingSocketNotifiers(int nready)
+{
+    static const struct {
+        QSocketNotifier::Type type;
+        uint flags;
+    } notifiers[] = {
+        { QSocketNotifier::Read,      EPOLLIN  | EPOLLHUP | EPOLLERR },
+        { QSocketNotifier::Write,     EPOLLOUT | EPOLLHUP | EPOLLERR },
+        { QSocketNotifier::Exception, EPOLLPRI | EPOLLHUP | EPOLLERR }
+    };
+
+    for (int i = 0; i < nready; ++i) {
+        const epoll_event &ev = readyEvents.at(i);
+        if (ev.data.fd == threadPipe.fds[0])
+            continue;
+
+        auto it = socketNotifiers.constFind(ev.data.fd);
+        if (it == socketNotifiers.constEnd())
+            continue;
+
+        const QSocketNotifierSetUNIX &sn_set = it.value();
+        for (const auto &n : notifiers) {
+            QSocketNotifier *notifier = sn_set.notifiers[n.type];
+            if (notifier && (ev.events & n.flags))
+                setSocketNotifierPending(notifier);
+        }
+    }
+}
+
+void QEventDispatcherEpollPrivate::markAlwaysReadyNotifiers()
+{
+    for (int fd : qAsConst(alwaysReadyFds)) {
+        auto it = socketNotifiers.constFind(fd);
+        if (it == socketNotifiers.constEnd())
+            continue;
+
+        // matches what poll(2) reports for regular files
+        const QSocketNotifierSetUNIX &sn_set = it.value();
+        if (QSocketNotifier *notifier = sn_set.notifiers[QSocketNotifier::Read])
+            setSocketNotifierPending(notifier);
+        if (QSocketNotifier *notifier = sn_set.notifiers[QSocketNotifier::Write])
+            setSocketNotifierPending(notifier);
+    }
+}
+
+int QEventDispatcherEpollPrivate::activateSocketNotifiers()
+{
+    if (pendingNotifiers.isEmpty())
+        return 0;
+
+    int n_activated = 0;
+    QEvent event(QEvent::SockAct);
+
+    while (!pendingNotifiers.isEmpty()) {
+        QSocketNotifier *notifier = pendingNotifiers.takeFirst();
+        QCoreApplication::sendEvent(notifier, &event);
+        ++n_activated;
+    }
+
+    return n_activated;
+}
+
+QEventDispatcherEpoll::QEventDispatcherEpoll(QObject *parent)
+    : QAbstractEventDispatcher(*new QEventDispatcherEpollPrivate, parent)
+{ }
+
+QEventDispatcherEpoll::QEventDispatcherEpoll(QEventDispatcherEpollPrivate &dd, QObject *parent)
+    : QAbstractEventDispatcher(dd, parent)
+{ }
+
+QEventDispatcherEpoll::~QEventDispatcherEpoll()
+{ }
+
+/*!
+    \internal
+
+    Returns \c true if the QT_EVENT_DISPATCHER_EPOLL environment variable
+    asks for this dispatcher to be used instead of the default one.
+*/
+bool QEventDispatcherEpoll::isRequested()
+{
+    bool ok = false;
+    int value = qEnvironmentVariableIntValue("QT_EVENT_DISPATCHER_EPOLL", &ok);
+    return ok && value > 0;
+}
+
+/*!
+    \internal
+*/
+void QEventDispatcherEpoll::registerTimer(int timerId, int interval, Qt::TimerType timerType, QObject *obj)
+{
+#ifndef QT_NO_DEBUG
+    if (timerId < 1 || interval < 0 || !obj) {
+        qWarning("QEventDispatcherEpoll::registerTimer: invalid arguments");
+        return;
+    } else if (obj->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherEpoll::registerTimer: timers cannot be started from another thread");
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    d->timerList.registerTimer(timerId, interval, timerType, obj);
+}
+
+/*!
+    \internal
+*/
+bool QEventDispatcherEpoll::unregisterTimer(int timerId)
+{
+#ifndef QT_NO_DEBUG
+    if (timerId < 1) {
+        qWarning("QEventDispatcherEpoll::unregisterTimer: invalid argument");
+        return false;
+    } else if (thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherEpoll::unregisterTimer: timers cannot be stopped from another thread");
+        return false;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    return d->timerList.unregisterTimer(timerId);
+}
+
+/*!
+    \internal
+*/
+bool QEventDispatcherEpoll::unregisterTimers(QObject *object)
+{
+#ifndef QT_NO_DEBUG
+    if (!object) {
+        qWarning("QEventDispatcherEpoll::unregisterTimers: invalid argument");
+        return false;
+    } else if (object->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QEventDispatcherEpoll::unregisterTimers: timers cannot be stopped from another thread");
+        return false;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    return d->timerList.unregisterTimers(object);
+}
+
+QList<QEventDispatcherEpoll::TimerInfo>
+QEventDispatcherEpoll::registeredTimers(QObject *object) const
+{
+    if (!object) {
+        qWarning("QEventDispatcherEpoll:registeredTimers: invalid argument");
+        return QList<TimerInfo>();
+    }
+
+    Q_D(const QEventDispatcherEpoll);
+    return d->timerList.registeredTimers(object);
+}
+
+void QEventDispatcherEpoll::registerSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    int sockfd = notifier->socket();
+    QSocketNotifier::Type type = notifier->type();
+#ifndef QT_NO_DEBUG
+    if (notifier->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QSocketNotifier: socket notifiers cannot be enabled from another thread");
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    QSocketNotifierSetUNIX &sn_set = d->socketNotifiers[sockfd];
+
+    if (sn_set.notifiers[type] && sn_set.notifiers[type] != notifier)
+        qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
+                 Q_FUNC_INFO, sockfd, socketType(type));
+
+    sn_set.notifiers[type] = notifier;
+    d->updateEpollRegistration(sockfd, sn_set.events());
+}
+
+void QEventDispatcherEpoll::unregisterSocketNotifier(QSocketNotifier *notifier)
+{
+    Q_ASSERT(notifier);
+    int sockfd = notifier->socket();
+    QSocketNotifier::Type type = notifier->type();
+#ifndef QT_NO_DEBUG
+    if (notifier->thread() != thread() || thread() != QThread::currentThread()) {
+        qWarning("QSocketNotifier: socket notifier (fd %d) cannot be disabled from another thread.\n"
+                "(Notifier's thread is %s(%p), event dispatcher's thread is %s(%p), current thread is %s(%p))",
+                sockfd,
+                notifier->thread() ? notifier->thread()->metaObject()->className() : "QThread", notifier->thread(),
+                thread() ? thread()->metaObject()->className() : "QThread", thread(),
+                QThread::currentThread() ? QThread::currentThread()->metaObject()->className() : "QThread", QThread::currentThread());
+        return;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+
+    d->pendingNotifiers.removeOne(notifier);
+
+    auto i = d->socketNotifiers.find(sockfd);
+    if (i == d->socketNotifiers.end())
+        return;
+
+    QSocketNotifierSetUNIX &sn_set = i.value();
+
+    if (sn_set.notifiers[type] == nullptr)
+        return;
+
+    if (sn_set.notifiers[type] != notifier) {
+        qWarning("%s: Multiple socket notifiers for same socket %d and type %s",
+                 Q_FUNC_INFO, sockfd, socketType(type));
+        return;
+    }
+
+    sn_set.notifiers[type] = nullptr;
+    d->updateEpollRegistration(sockfd, sn_set.events());
+
+    if (sn_set.isEmpty())
+        d->socketNotifiers.erase(i);
+}
+
+bool QEventDispatcherEpoll::processEvents(QEventLoop::ProcessEventsFlags flags)
+{
+    Q_D(QEventDispatcherEpoll);
+    d->interrupt.store(0);
+
+    // we are awake, broadcast it
+    emit awake();
+    QCoreApplicationPrivate::sendPostedEvents(0, 0, d->threadData);
+
+    const bool include_timers = (flags & QEventLoop::X11ExcludeTimers) == 0;
+    const bool include_notifiers = (flags & QEventLoop::ExcludeSocketNotifiers) == 0;
+    const bool wait_for_events = flags & QEventLoop::WaitForMoreEvents;
+
+    const bool canWait = (d->threadData->canWaitLocked()
+                          && !d->interrupt.load()
+                          && wait_for_events);
+
+    if (canWait)
+        emit aboutToBlock();
+
+    if (d->interrupt.load())
+        return false;
+
+    timespec *tm = nullptr;
+    timespec wait_tm = { 0, 0 };
+
+    if (!canWait || (include_timers && d->timerList.timerWait(wait_tm)))
+        tm = &wait_tm;
+
+    if (include_notifiers && !d->alwaysReadyFds.isEmpty()) {
+        wait_tm.tv_sec = 0;
+        wait_tm.tv_nsec = 0;
+        tm = &wait_tm;
+    }
+
+    int nevents = 0;
+
+    if (!include_notifiers) {
+        // level-triggered socket events would wake epoll_wait up over and
+        // over again, so only wait for the thread pipe
+        pollfd pfd = d->threadPipe.prepare();
+        switch (qt_safe_poll(&pfd, 1, tm)) {
+        case -1:
+            perror("qt_safe_poll");
+            break;
+        case 0:
+            break;
+        default:
+            nevents += d->threadPipe.check(pfd);
+            break;
+        }
+    } else {
+        int timeout = -1;
+        if (tm) {
+            // round up, so that we never wake up before the next timer is due
+            timeout = int(qMin<qint64>(qint64(tm->tv_sec) * 1000 + (tm->tv_nsec + 999999) / 1000000,
+                                       std::numeric_limits<int>::max()));
+        }
+
+        const int nready = epoll_wait(d->epollFd, d->readyEvents.data(), d->readyEvents.size(), timeout);
+        if (nready == -1 && errno != EINTR)
+            perror("epoll_wait");
+
+        for (int i = 0; i < nready; ++i) {
+            const epoll_event &ev = d->readyEvents.at(i);
+            if (ev.data.fd == d->threadPipe.fds[0]) {
+                pollfd pfd = d->threadPipe.prepare();
+                pfd.revents = POLLIN;
+                nevents += d->threadPipe.check(pfd);
+                break;
+            }
+        }
+
+        if (nready > 0)
+            d->markPendingSocketNotifiers(nready);
+        d->markAlwaysReadyNotifiers();
+        nevents += d->activateSocketNotifiers();
+
+        // everything fit this time, but there may be more ready descriptors next time
+        if (nready == d->readyEvents.size())
+            d->readyEvents.resize(d->readyEvents.size() * 2);
+    }
+
+    if (include_timers)
+        nevents += d->activateTimers();
+
+    // return true if we handled events, false otherwise
+    return (nevents > 0);
+}
+
+bool QEventDispatcherEpoll::hasPendingEvents()
+{
+    extern uint qGlobalPostedEventsCount(); // from qapplication.cpp
+    return qGlobalPostedEventsCount();
+}
+
+int QEventDispatcherEpoll::remainingTime(int timerId)
+{
+#ifndef QT_NO_DEBUG
+    if (timerId < 1) {
+        qWarning("QEventDispatcherEpoll::remainingTime: invalid argument");
+        return -1;
+    }
+#endif
+
+    Q_D(QEventDispatcherEpoll);
+    return d->timerList.timerRemainingTime(timerId);
+}
+
+void QEventDispatcherEpoll::wakeUp()
+{
+    Q_D(QEventDispatcherEpoll);
+    d->threadPipe.wakeUp();
+}
+
+void QEventDispatcherEpoll::interrupt()
+{
+    Q_D(QEventDispatcherEpoll);
+    d->interrupt.store(1);
+    wakeUp();
+}
+
+void QEventDispatcherEpoll::flush()
+{ }
+
+QT_END_NAMESPACE
+
+#include "moc_qeventdispatcher_epoll_p.cpp"
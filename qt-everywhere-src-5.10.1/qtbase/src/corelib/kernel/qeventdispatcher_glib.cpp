@@ -143,10 +143,12 @@ static gboolean timerSourceCheckHelper(GTimerSource *src)
         || (src->processEventsFlags & QEventLoop::X11ExcludeTimers))
         return false;
 
-    if (src->timerList.updateCurrentTime() < src->timerList.constFirst()->timeout)
+    // timerWait() returns a zero wait time if a timer is due
+    timespec tv = { 0l, 0l };
+    if (!src->timerList.timerWait(tv))
         return false;
 
-    return true;
+    return tv.tv_sec == 0 && tv.tv_nsec == 0;
 }
 
 static gboolean timerSourcePrepare(GSource *source, gint *timeout)
@@ -368,7 +370,6 @@ QEventDispatcherGlib::~QEventDispatcherGlib()
     Q_D(QEventDispatcherGlib);
 
     // destroy all timer sources
-    qDeleteAll(d->timerSource->timerList);
     d->timerSource->timerList.~QTimerInfoList();
     g_source_destroy(&d->timerSource->source);
     g_source_unref(&d->timerSource->source);
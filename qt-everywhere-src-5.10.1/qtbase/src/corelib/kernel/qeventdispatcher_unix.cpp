@@ -230,8 +230,7 @@ QEventDispatcherUNIXPrivate::QEventDispatcherUNIXPrivate()
 
 QEventDispatcherUNIXPrivate::~QEventDispatcherUNIXPrivate()
 {
-    // cleanup timers
-    qDeleteAll(timerList);
+    // the timers are deleted by the QTimerInfoList destructor
 }
 
 void QEventDispatcherUNIXPrivate::setSocketNotifierPending(QSocketNotifier *notifier)
@@ -0,0 +1,690 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qeventloopprofiler_p.h"
+
+#include "qabstracteventdispatcher.h"
+#include "qcoreevent.h"
+#include "qelapsedtimer.h"
+#include "qhash.h"
+#include "qloggingcategory.h"
+#include "qmetaobject.h"
+#include "qmutex.h"
+#include "qthread.h"
+#include "qwaitcondition.h"
+#include "qcoreapplication_p.h"
+#include <private/qthread_p.h>
+
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(QT_NO_THREAD) && defined(Q_OS_LINUX) && defined(__GLIBC__)
+#  define QEVENTLOOPPROFILER_HAVE_BACKTRACE
+#  include <execinfo.h>
+#  include <pthread.h>
+#  include <signal.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+Q_LOGGING_CATEGORY(lcEventLoopProfiler, "qt.core.eventloopprofiler")
+Q_LOGGING_CATEGORY(lcEventLoopStall, "qt.core.eventloopprofiler.stall")
+
+/*!
+    \class QEventLoopProfiler
+    \inmodule QtCore
+    \internal
+
+    \brief The QEventLoopProfiler class measures how long the main thread's
+    event loop is busy, and reports stalls.
+
+    Profiling is off by default, and the event delivery path pays a single
+    relaxed load while it is. It has two independent parts:
+
+    \list
+    \li Statistics, switched on by setting the \c QT_EVENTLOOP_PROFILING
+        environment variable to \c 1 or by calling setStatisticsEnabled().
+        Every event delivered in the main thread is timed, and the durations
+        are collected in a histogram per event type and receiver class. The
+        time the event dispatcher is busy between two waits is collected in
+        a separate histogram, based on the QAbstractEventDispatcher::awake()
+        and QAbstractEventDispatcher::aboutToBlock() signals.
+    \li A watchdog, switched on by setting the
+        \c QT_EVENTLOOP_STALL_THRESHOLD environment variable to a number of
+        milliseconds, or by calling setStallThreshold(). A separate thread
+        reports every event whose delivery takes longer than the threshold
+        to the \c qt.core.eventloopprofiler.stall logging category, while
+        the event is still being handled. On Linux with glibc, the report
+        includes a backtrace of the main thread, captured by briefly
+        interrupting it with a real-time signal.
+    \endlist
+
+    Nested event deliveries, for instance from a local event loop or a
+    QCoreApplication::sendEvent() call inside an event handler, are
+    accounted to the outermost event.
+
+    When enabled through \c QT_EVENTLOOP_PROFILING, the statistics are
+    written to the \c qt.core.eventloopprofiler logging category when the
+    QCoreApplication is destroyed. Otherwise statistics() and dump() return
+    them on demand.
+*/
+
+QBasicAtomicInt QEventLoopProfiler::s_state = Q_BASIC_ATOMIC_INITIALIZER(-1);
+
+/*!
+    \internal
+
+    Adds a duration of \a nsecs nanoseconds.
+*/
+void QEventLoopProfiler::Histogram::add(qint64 nsecs) Q_DECL_NOTHROW
+{
+    const quint64 usecs = quint64(qMax(nsecs, qint64(0))) / 1000;
+    const int bucket = usecs ? qMin(int(BucketCount) - 1, 64 - int(qCountLeadingZeroBits(usecs))) : 0;
+    ++buckets[bucket];
+    ++count;
+    totalNSecs += nsecs;
+    maxNSecs = qMax(maxNSecs, nsecs);
+}
+
+/*!
+    \internal
+
+    Returns the exclusive upper limit in microseconds of the durations counted
+    in \a bucket, or -1 for the last, open-ended bucket.
+*/
+qint64 QEventLoopProfiler::Histogram::bucketLimit(int bucket) Q_DECL_NOTHROW
+{
+    return bucket < BucketCount - 1 ? qint64(1) << bucket : -1;
+}
+
+/*!
+    \internal
+
+    Returns an upper limit in microseconds for the given \a fraction (between
+    0 and 1) of the durations, i.e. the limit of the bucket in which the
+    percentile falls. Returns the maximum duration if that is the last
+    bucket, and 0 if the histogram is empty.
+*/
+qint64 QEventLoopProfiler::Histogram::percentile(double fraction) const Q_DECL_NOTHROW
+{
+    if (!count)
+        return 0;
+    const quint64 wanted = qMax(quint64(1), quint64(qBound(0.0, fraction, 1.0) * count + 0.5));
+    quint64 seen = 0;
+    for (int i = 0; i < BucketCount - 1; ++i) {
+        seen += buckets[i];
+        if (seen >= wanted)
+            return bucketLimit(i);
+    }
+    return maxNSecs / 1000;
+}
+
+namespace {
+struct EventKey
+{
+    int eventType;
+    const char *className;
+};
+
+inline bool operator==(const EventKey &lhs, const EventKey &rhs)
+{
+    return lhs.eventType == rhs.eventType && lhs.className == rhs.className;
+}
+
+inline uint qHash(const EventKey &key, uint seed = 0) Q_DECL_NOTHROW
+{
+    return QT_PREPEND_NAMESPACE(qHash)(quintptr(key.className), seed) ^ uint(key.eventType);
+}
+
+const QEventLoopProfiler::Histogram emptyHistogram = { { 0 }, 0, 0, 0 };
+
+#ifndef QT_NO_THREAD
+class Watchdog : public QThread
+{
+public:
+    Watchdog() { setObjectName(QStringLiteral("Qt event loop watchdog")); }
+    void stop();
+
+protected:
+    void run() override;
+
+private:
+    bool stopping = false; // protected by ProfilerData::mutex
+};
+#endif
+
+struct ProfilerData
+{
+    ProfilerData()
+        : iterationBusyTime(emptyHistogram)
+    {
+        clock.start();
+    }
+
+    QMutex mutex;
+    QElapsedTimer clock;
+    // keyed by the class name pointer, to avoid string operations while
+    // recording; the name itself is copied into the statistics
+    QHash<EventKey, QEventLoopProfiler::EventStatistics> events;
+    QEventLoopProfiler::Histogram iterationBusyTime;
+    int stalls = 0;
+    int stallThreshold = 0;
+    bool dumpOnExit = false;
+
+    // the event currently being delivered in the main thread, -1 if none
+    qint64 eventStart = -1;
+    int eventType = 0;
+    const char *eventClassName = nullptr;
+
+    // only touched by the main thread
+    int depth = 0;
+    qint64 awakeSince = -1;
+    QAbstractEventDispatcher *dispatcher = nullptr;
+    QMetaObject::Connection awakeConnection;
+    QMetaObject::Connection aboutToBlockConnection;
+
+#ifndef QT_NO_THREAD
+    Watchdog *watchdog = nullptr;
+    QWaitCondition watchdogCondition;
+#endif
+#ifdef QEVENTLOOPPROFILER_HAVE_BACKTRACE
+    pthread_t mainThread;
+    bool mainThreadKnown = false;
+#endif
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(ProfilerData, profilerData)
+
+#ifdef QEVENTLOOPPROFILER_HAVE_BACKTRACE
+namespace {
+enum { MaxBacktraceFrames = 64 };
+void *backtraceFrames[MaxBacktraceFrames];
+QBasicAtomicInt backtraceFrameCount = Q_BASIC_ATOMIC_INITIALIZER(-1);
+struct sigaction previousAction;
+
+inline int backtraceSignal()
+{
+    return SIGRTMIN + 4;
+}
+
+extern "C" void qt_eventloopprofiler_backtrace(int)
+{
+    backtraceFrameCount.storeRelease(backtrace(backtraceFrames, MaxBacktraceFrames));
+}
+
+void installBacktraceHandler()
+{
+    // backtrace() may allocate the first time it is called, which must not
+    // happen inside the signal handler
+    void *frame;
+    backtrace(&frame, 1);
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = qt_eventloopprofiler_backtrace;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    sigaction(backtraceSignal(), &action, &previousAction);
+}
+
+void removeBacktraceHandler()
+{
+    sigaction(backtraceSignal(), &previousAction, nullptr);
+}
+
+QVector<QByteArray> captureBacktrace(pthread_t thread)
+{
+    QVector<QByteArray> result;
+    backtraceFrameCount.storeRelease(-1);
+    if (pthread_kill(thread, backtraceSignal()) != 0)
+        return result;
+    int frames = -1;
+    for (int i = 0; i < 1000 && (frames = backtraceFrameCount.loadAcquire()) < 0; ++i)
+        QThread::usleep(100);
+    if (frames <= 0)
+        return result;
+    if (char **symbols = backtrace_symbols(backtraceFrames, frames)) {
+        // skip the signal handler and the signal trampoline
+        for (int i = qMin(2, frames - 1); i < frames; ++i)
+            result.append(QByteArray(symbols[i]));
+        free(symbols);
+    }
+    return result;
+}
+} // unnamed namespace
+#endif // QEVENTLOOPPROFILER_HAVE_BACKTRACE
+
+#ifndef QT_NO_THREAD
+void Watchdog::stop()
+{
+    ProfilerData *d = profilerData();
+    {
+        QMutexLocker locker(&d->mutex);
+        stopping = true;
+        d->watchdogCondition.wakeAll();
+    }
+    wait();
+}
+
+void Watchdog::run()
+{
+    ProfilerData *d = profilerData();
+#ifdef QEVENTLOOPPROFILER_HAVE_BACKTRACE
+    installBacktraceHandler();
+#endif
+    qint64 reportedStart = -1;
+    QMutexLocker locker(&d->mutex);
+    while (!stopping) {
+        const int interval = d->stallThreshold > 0 ? qBound(1, d->stallThreshold / 4, 100) : 100;
+        d->watchdogCondition.wait(&d->mutex, interval);
+        if (stopping || d->stallThreshold <= 0)
+            continue;
+        if (d->eventStart < 0 || d->eventStart == reportedStart)
+            continue;
+        const qint64 elapsed = d->clock.nsecsElapsed() - d->eventStart;
+        if (elapsed < d->stallThreshold * Q_INT64_C(1000000))
+            continue;
+
+        reportedStart = d->eventStart;
+        ++d->stalls;
+        const int eventType = d->eventType;
+        // the class name stays valid while the event is being delivered,
+        // which it is as long as we hold the mutex
+        const QByteArray className(d->eventClassName);
+#ifdef QEVENTLOOPPROFILER_HAVE_BACKTRACE
+        const bool mainThreadKnown = d->mainThreadKnown;
+        const pthread_t mainThread = d->mainThread;
+#endif
+        locker.unlock();
+
+        const char *typeName = QMetaEnum::fromType<QEvent::Type>().valueToKey(eventType);
+        qCWarning(lcEventLoopStall, "Event loop stalled for %lld ms delivering %s (%d) to %s",
+                  elapsed / 1000000, typeName ? typeName : "user event", eventType,
+                  className.constData());
+#ifdef QEVENTLOOPPROFILER_HAVE_BACKTRACE
+        if (mainThreadKnown) {
+            const QVector<QByteArray> frames = captureBacktrace(mainThread);
+            for (int i = 0; i < frames.size(); ++i)
+                qCWarning(lcEventLoopStall, "#%-2d %s", i, frames.at(i).constData());
+        }
+#endif
+        locker.relock();
+    }
+    locker.unlock();
+#ifdef QEVENTLOOPPROFILER_HAVE_BACKTRACE
+    removeBacktraceHandler();
+#endif
+}
+#endif // QT_NO_THREAD
+
+/*!
+    \internal
+
+    Reads \c QT_EVENTLOOP_PROFILING and \c QT_EVENTLOOP_STALL_THRESHOLD the
+    first time profiling is queried.
+*/
+bool QEventLoopProfiler::initialize() Q_DECL_NOTHROW
+{
+    int state = 0;
+    if (const char *env = ::getenv("QT_EVENTLOOP_PROFILING")) {
+        if (atoi(env) > 0)
+            state |= StatisticsEnabled;
+    }
+    int threshold = 0;
+    if (const char *env = ::getenv("QT_EVENTLOOP_STALL_THRESHOLD"))
+        threshold = qMax(0, atoi(env));
+    if (threshold > 0)
+        state |= WatchdogEnabled;
+
+    if (state) {
+        ProfilerData *d = profilerData();
+        if (!d)
+            return false;
+        QMutexLocker locker(&d->mutex);
+        if (s_state.testAndSetRelaxed(-1, state)) {
+            d->stallThreshold = threshold;
+            d->dumpOnExit = state & StatisticsEnabled;
+        }
+    } else {
+        s_state.testAndSetRelaxed(-1, 0);
+    }
+    return s_state.load() > 0;
+}
+
+/*!
+    \internal
+
+    Enables collecting statistics if \a enable is true, and disables it
+    otherwise. The statistics collected so far are kept.
+*/
+void QEventLoopProfiler::setStatisticsEnabled(bool enable)
+{
+    isEnabled();
+    ProfilerData *d = profilerData();
+    if (!d)
+        return;
+    QMutexLocker locker(&d->mutex);
+    int state = s_state.load() & WatchdogEnabled;
+    if (enable)
+        state |= StatisticsEnabled;
+    s_state.store(state);
+}
+
+/*!
+    \internal
+
+    Returns true if statistics are being collected.
+*/
+bool QEventLoopProfiler::isStatisticsEnabled()
+{
+    return isEnabled() && (s_state.load() & StatisticsEnabled);
+}
+
+/*!
+    \internal
+
+    Reports every event whose delivery in the main thread takes longer than
+    \a msecs milliseconds. A value of 0 disables the watchdog.
+*/
+void QEventLoopProfiler::setStallThreshold(int msecs)
+{
+    isEnabled();
+    ProfilerData *d = profilerData();
+    if (!d)
+        return;
+#ifndef QT_NO_THREAD
+    Watchdog *stopped = nullptr;
+#endif
+    {
+        QMutexLocker locker(&d->mutex);
+        d->stallThreshold = qMax(0, msecs);
+        int state = s_state.load() & StatisticsEnabled;
+        if (d->stallThreshold > 0)
+            state |= WatchdogEnabled;
+        s_state.store(state);
+#ifndef QT_NO_THREAD
+        if (d->stallThreshold > 0) {
+            // pick up the new polling interval
+            d->watchdogCondition.wakeAll();
+        } else {
+            stopped = d->watchdog;
+            d->watchdog = nullptr;
+        }
+#endif
+    }
+#ifndef QT_NO_THREAD
+    if (stopped) {
+        stopped->stop();
+        delete stopped;
+    }
+#endif
+}
+
+/*!
+    \internal
+
+    Returns the stall threshold in milliseconds, or 0 if the watchdog is
+    disabled.
+*/
+int QEventLoopProfiler::stallThreshold()
+{
+    if (!isEnabled())
+        return 0;
+    ProfilerData *d = profilerData();
+    if (!d)
+        return 0;
+    QMutexLocker locker(&d->mutex);
+    return d->stallThreshold;
+}
+
+bool QEventLoopProfiler::begin(QObject *receiver, QEvent *event, QThreadData *threadData) Q_DECL_NOTHROW
+{
+    if (threadData->thread.load() != QCoreApplicationPrivate::theMainThread.load())
+        return false;
+    ProfilerData *d = profilerData();
+    if (!d)
+        return false;
+    if (d->depth++ > 0)
+        return true;
+
+    const int state = s_state.load();
+    if (state & StatisticsEnabled) {
+        QAbstractEventDispatcher *dispatcher = threadData->eventDispatcher.load();
+        if (dispatcher != d->dispatcher) {
+            QObject::disconnect(d->awakeConnection);
+            QObject::disconnect(d->aboutToBlockConnection);
+            d->dispatcher = dispatcher;
+            d->awakeSince = -1;
+            if (dispatcher) {
+                d->awakeConnection = QObject::connect(dispatcher, &QAbstractEventDispatcher::awake,
+                                                      &QEventLoopProfiler::dispatcherAwake);
+                d->aboutToBlockConnection = QObject::connect(dispatcher, &QAbstractEventDispatcher::aboutToBlock,
+                                                             &QEventLoopProfiler::dispatcherAboutToBlock);
+            }
+        }
+    }
+#ifndef QT_NO_THREAD
+    if ((state & WatchdogEnabled) && !d->watchdog) {
+        // only the main thread starts the watchdog, so this does not race
+        // with itself; it may race with setStallThreshold(0), though
+        Watchdog *watchdog = new Watchdog;
+        watchdog->start();
+        QMutexLocker locker(&d->mutex);
+        if (d->stallThreshold > 0) {
+            d->watchdog = watchdog;
+            watchdog = nullptr;
+        }
+        locker.unlock();
+        if (watchdog) {
+            watchdog->stop();
+            delete watchdog;
+        }
+    }
+#endif
+
+    const char *className = receiver->metaObject()->className();
+    QMutexLocker locker(&d->mutex);
+#ifdef QEVENTLOOPPROFILER_HAVE_BACKTRACE
+    if (!d->mainThreadKnown) {
+        d->mainThread = pthread_self();
+        d->mainThreadKnown = true;
+    }
+#endif
+    d->eventType = event->type();
+    d->eventClassName = className;
+    d->eventStart = d->clock.nsecsElapsed();
+    return true;
+}
+
+void QEventLoopProfiler::end() Q_DECL_NOTHROW
+{
+    ProfilerData *d = profilerData();
+    if (!d || --d->depth > 0)
+        return;
+
+    QMutexLocker locker(&d->mutex);
+    if (d->eventStart < 0)
+        return;
+    const qint64 elapsed = d->clock.nsecsElapsed() - d->eventStart;
+    if (s_state.load() & StatisticsEnabled) {
+        const EventKey key = { d->eventType, d->eventClassName };
+        QHash<EventKey, EventStatistics>::iterator it = d->events.find(key);
+        if (it == d->events.end()) {
+            const EventStatistics statistics = { key.eventType, QByteArray(key.className), emptyHistogram };
+            it = d->events.insert(key, statistics);
+        }
+        it.value().latency.add(elapsed);
+    }
+    d->eventStart = -1;
+    d->eventClassName = nullptr;
+}
+
+void QEventLoopProfiler::dispatcherAwake()
+{
+    ProfilerData *d = profilerData();
+    if (d && d->awakeSince < 0)
+        d->awakeSince = d->clock.nsecsElapsed();
+}
+
+void QEventLoopProfiler::dispatcherAboutToBlock()
+{
+    ProfilerData *d = profilerData();
+    if (!d || d->awakeSince < 0)
+        return;
+    const qint64 busy = d->clock.nsecsElapsed() - d->awakeSince;
+    d->awakeSince = -1;
+    if (!(s_state.load() & StatisticsEnabled))
+        return;
+    QMutexLocker locker(&d->mutex);
+    d->iterationBusyTime.add(busy);
+}
+
+/*!
+    \internal
+
+    Returns the statistics collected so far, with the events sorted by their
+    total delivery time.
+*/
+QEventLoopProfiler::Statistics QEventLoopProfiler::statistics()
+{
+    Statistics result = { emptyHistogram, QVector<EventStatistics>(), 0 };
+    if (ProfilerData *d = profilerData()) {
+        QMutexLocker locker(&d->mutex);
+        result.iterationBusyTime = d->iterationBusyTime;
+        result.events.reserve(d->events.size());
+        for (const EventStatistics &statistics : qAsConst(d->events))
+            result.events.append(statistics);
+        result.stalls = d->stalls;
+    }
+    std::sort(result.events.begin(), result.events.end(),
+              [](const EventStatistics &lhs, const EventStatistics &rhs) {
+        return lhs.latency.totalNSecs > rhs.latency.totalNSecs;
+    });
+    return result;
+}
+
+/*!
+    \internal
+
+    Discards the statistics collected so far.
+*/
+void QEventLoopProfiler::reset()
+{
+    if (ProfilerData *d = profilerData()) {
+        QMutexLocker locker(&d->mutex);
+        d->events.clear();
+        d->iterationBusyTime = emptyHistogram;
+        d->stalls = 0;
+    }
+}
+
+/*!
+    \internal
+
+    Logs the busy time of the event loop iterations and the \a maxEvents
+    event types and receiver classes with the highest total delivery time to
+    the \c qt.core.eventloopprofiler logging category.
+*/
+void QEventLoopProfiler::dump(int maxEvents)
+{
+    Statistics all = statistics();
+    if (maxEvents >= 0 && all.events.size() > maxEvents)
+        all.events.resize(maxEvents);
+
+    const Histogram &busy = all.iterationBusyTime;
+    qCInfo(lcEventLoopProfiler,
+           "%llu event loop iterations: busy avg %.1f us, p50 <= %lld us, p99 <= %lld us,"
+           " max %.1f us; %d stalls",
+           busy.count, busy.count ? busy.totalNSecs / 1000.0 / busy.count : 0.0,
+           busy.percentile(0.5), busy.percentile(0.99), busy.maxNSecs / 1000.0, all.stalls);
+    const QMetaEnum types = QMetaEnum::fromType<QEvent::Type>();
+    for (const EventStatistics &statistics : qAsConst(all.events)) {
+        const Histogram &latency = statistics.latency;
+        const char *typeName = types.valueToKey(statistics.eventType);
+        qCInfo(lcEventLoopProfiler,
+               "%s (%d) to %s: %llu events, total %.1f ms, avg %.1f us, p99 <= %lld us, max %.1f us",
+               typeName ? typeName : "user event", statistics.eventType,
+               statistics.receiverClassName.constData(), latency.count,
+               latency.totalNSecs / 1000000.0, latency.totalNSecs / 1000.0 / latency.count,
+               latency.percentile(0.99), latency.maxNSecs / 1000.0);
+    }
+}
+
+/*!
+    \internal
+
+    Called when the QCoreApplication is destroyed. Stops the watchdog and
+    logs the statistics if they were enabled through the environment.
+*/
+void QEventLoopProfiler::applicationDestroyed()
+{
+    if (s_state.load() < 0)
+        return;
+    ProfilerData *d = profilerData();
+    if (!d)
+        return;
+#ifndef QT_NO_THREAD
+    Watchdog *watchdog;
+    {
+        QMutexLocker locker(&d->mutex);
+        watchdog = d->watchdog;
+        d->watchdog = nullptr;
+    }
+    if (watchdog) {
+        watchdog->stop();
+        delete watchdog;
+    }
+#endif
+    QObject::disconnect(d->awakeConnection);
+    QObject::disconnect(d->aboutToBlockConnection);
+    d->dispatcher = nullptr;
+    d->awakeSince = -1;
+
+    bool dumpOnExit;
+    {
+        QMutexLocker locker(&d->mutex);
+        dumpOnExit = d->dumpOnExit && (s_state.load() & StatisticsEnabled);
+    }
+    if (dumpOnExit)
+        dump();
+}
+
+QT_END_NAMESPACE
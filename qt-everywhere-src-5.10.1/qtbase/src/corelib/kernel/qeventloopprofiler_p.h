@@ -0,0 +1,157 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QEVENTLOOPPROFILER_P_H
+#define QEVENTLOOPPROFILER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of the implementation.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qatomic.h>
+#include <QtCore/qbytearray.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class QEvent;
+class QObject;
+class QThreadData;
+
+class Q_CORE_EXPORT QEventLoopProfiler
+{
+public:
+    // Bucket 0 counts durations below 1 us, bucket i durations in
+    // [2^(i-1), 2^i) us; the last bucket is open-ended.
+    struct Histogram
+    {
+        enum { BucketCount = 24 };
+
+        void add(qint64 nsecs) Q_DECL_NOTHROW;
+        qint64 percentile(double fraction) const Q_DECL_NOTHROW;
+        static qint64 bucketLimit(int bucket) Q_DECL_NOTHROW;
+
+        quint64 buckets[BucketCount];
+        quint64 count;
+        qint64 totalNSecs;
+        qint64 maxNSecs;
+    };
+
+    struct EventStatistics
+    {
+        int eventType;
+        QByteArray receiverClassName;
+        Histogram latency;
+    };
+
+    struct Statistics
+    {
+        Histogram iterationBusyTime;
+        QVector<EventStatistics> events;
+        int stalls;
+    };
+
+    // Placed around the delivery of an event in
+    // QCoreApplication::notifyInternal2(). Only events delivered in the main
+    // thread are recorded, and nested deliveries count towards the outermost
+    // one.
+    class EventScope
+    {
+    public:
+        EventScope(QObject *receiver, QEvent *event, QThreadData *threadData) Q_DECL_NOTHROW
+            : m_active(Q_UNLIKELY(isEnabled()) && begin(receiver, event, threadData))
+        {}
+
+        ~EventScope()
+        {
+            if (Q_UNLIKELY(m_active))
+                end();
+        }
+
+    private:
+        Q_DISABLE_COPY(EventScope)
+        bool m_active;
+    };
+
+    static bool isEnabled() Q_DECL_NOTHROW
+    {
+        const int state = s_state.load();
+        return state > 0 || (Q_UNLIKELY(state < 0) && initialize());
+    }
+
+    static void setStatisticsEnabled(bool enable);
+    static bool isStatisticsEnabled();
+    static void setStallThreshold(int msecs);
+    static int stallThreshold();
+
+    static Statistics statistics();
+    static void reset();
+    static void dump(int maxEvents = 20);
+
+    static void applicationDestroyed();
+
+private:
+    enum State {
+        StatisticsEnabled = 0x1,
+        WatchdogEnabled = 0x2
+    };
+
+    static bool initialize() Q_DECL_NOTHROW;
+    static bool begin(QObject *receiver, QEvent *event, QThreadData *threadData) Q_DECL_NOTHROW;
+    static void end() Q_DECL_NOTHROW;
+    static void dispatcherAwake();
+    static void dispatcherAboutToBlock();
+
+    static QBasicAtomicInt s_state;
+};
+
+Q_DECLARE_TYPEINFO(QEventLoopProfiler::Histogram, Q_PRIMITIVE_TYPE);
+Q_DECLARE_TYPEINFO(QEventLoopProfiler::EventStatistics, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+#endif // QEVENTLOOPPROFILER_P_H
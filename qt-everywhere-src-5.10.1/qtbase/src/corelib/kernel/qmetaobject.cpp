@@ -580,6 +580,37 @@ static bool methodMatch(const QMetaObject *m, int handle,
     return true;
 }
 
+enum NameLookupTable { MethodNameTable, PropertyNameTable };
+
+/*
+    Returns the hash table moc generated for the method or property names of
+    \a m, or null if there is none; see qMetaObjectNameHash(). The table's size
+    is stored in \a size.
+*/
+static inline const uint *nameLookupTable(const QMetaObject *m, NameLookupTable which, uint *size)
+{
+    if (!(priv(m->d.data)->flags & HasNameLookupTables))
+        return nullptr;
+    const uint *table = m->d.data + MetaObjectPrivateFieldCount;
+    if (which == PropertyNameTable)
+        table += table[0] + 1;
+    *size = table[0];
+    return *size ? table + 1 : nullptr;
+}
+
+/*
+    Calls \a candidate for each local index in the slots of the name lookup
+    \a table that \a hash probes, up to the first empty slot. The caller still
+    has to compare the names.
+*/
+template <typename Candidate>
+static inline void probeNameLookupTable(const uint *table, uint size, uint hash, Candidate candidate)
+{
+    const uint mask = size - 1;
+    for (uint n = 0, slot = hash & mask; n < size && table[slot]; ++n, slot = (slot + 1) & mask)
+        candidate(int(table[slot]) - 1);
+}
+
 /**
 * \internal
 * helper function for indexOf{Method,Slot,Signal}, returns the relative index of the method within
@@ -591,6 +622,7 @@ static inline int indexOfMethodRelative(const QMetaObject **baseObject,
                                         const QByteArray &name, int argc,
                                         const QArgumentType *types)
 {
+    const uint hash = qMetaObjectNameHash(name.constData(), name.size());
     for (const QMetaObject *m = *baseObject; m; m = m->d.superdata) {
         Q_ASSERT(priv(m->d.data)->revision >= 7);
         int i = (MethodType == MethodSignal)
@@ -598,6 +630,23 @@ static inline int indexOfMethodRelative(const QMetaObject **baseObject,
         const int end = (MethodType == MethodSlot)
                         ? (priv(m->d.data)->signalCount) : 0;
 
+        uint tableSize;
+        if (const uint *table = nameLookupTable(m, MethodNameTable, &tableSize)) {
+            // the linear search below finds the last match, so do the same
+            int found = -1;
+            probeNameLookupTable(table, tableSize, hash, [&](int index) {
+                if (index > found && index >= end && index <= i
+                        && methodMatch(m, priv(m->d.data)->methodData + 5*index, name, argc, types)) {
+                    found = index;
+                }
+            });
+            if (found >= 0) {
+                *baseObject = m;
+                return found;
+            }
+            continue;
+        }
+
         for (; i >= end; --i) {
             int handle = priv(m->d.data)->methodData + 5*i;
             if (methodMatch(m, handle, name, argc, types)) {
@@ -990,9 +1039,24 @@ int QMetaObject::indexOfEnumerator(const char *name) const
 */
 int QMetaObject::indexOfProperty(const char *name) const
 {
+    const uint hash = qMetaObjectNameHash(name, int(qstrlen(name)));
     const QMetaObject *m = this;
     while (m) {
         const QMetaObjectPrivate *d = priv(m->d.data);
+        uint tableSize;
+        if (const uint *table = nameLookupTable(m, PropertyNameTable, &tableSize)) {
+            int found = -1;
+            probeNameLookupTable(table, tableSize, hash, [&](int index) {
+                if (index > found
+                        && strcmp(name, rawStringData(m, m->d.data[d->propertyData + 3*index])) == 0) {
+                    found = index;
+                }
+            });
+            if (found >= 0)
+                return found + m->propertyOffset();
+            m = m->d.superdata;
+            continue;
+        }
         for (int i = d->propertyCount-1; i >= 0; --i) {
             const char *prop = rawStringData(m, m->d.data[d->propertyData + 3*i]);
             if (name[0] == prop[0] && strcmp(name + 1, prop + 1) == 0) {
@@ -106,7 +106,8 @@ enum MethodFlags  {
 enum MetaObjectFlags {
     DynamicMetaObject = 0x01,
     RequiresVariantMetaObject = 0x02,
-    PropertyAccessInStaticMetaCall = 0x04 // since Qt 5.5, property code is in the static metacall
+    PropertyAccessInStaticMetaCall = 0x04, // since Qt 5.5, property code is in the static metacall
+    HasNameLookupTables = 0x08 // since Qt 5.11, see qMetaObjectNameHash()
 };
 
 enum MetaDataFlags {
@@ -239,6 +240,32 @@ struct QMetaObjectPrivate
 
 enum { MetaObjectPrivateFieldCount = sizeof(QMetaObjectPrivate) / sizeof(int) };
 
+/*
+    moc generates hash tables for the method and property names of classes
+    with many members, so that they can be looked up by name without
+    comparing against every entry. If the HasNameLookupTables flag is set, the
+    tables directly follow the QMetaObjectPrivate header in the data array:
+
+        methodTableSize, methodTable[methodTableSize],
+        propertyTableSize, propertyTable[propertyTableSize]
+
+    Each size is either zero (no table, fall back to the linear search) or a
+    power of two larger than the number of entries. A slot holds a local
+    method or property index plus one, or zero if it is empty; collisions are
+    resolved by linear probing on qMetaObjectNameHash() of the name, and each
+    overload of a method has a slot of its own.
+*/
+enum { MetaObjectNameTableMinimumCount = 8 };
+
+static inline uint qMetaObjectNameHash(const char *name, int length)
+{
+    // FNV-1a; must not change, the hashes are compiled into moc output
+    uint h = 2166136261u;
+    for (int i = 0; i < length; ++i)
+        h = (h ^ uchar(name[i])) * 16777619u;
+    return h;
+}
+
 #ifndef UTILS_H
 // mirrored in moc's utils.h
 static inline bool is_ident_char(char s)
@@ -42,6 +42,7 @@
 #include "qobjectdefs.h"
 #include "qdatetime.h"
 #include "qbytearray.h"
+#include "qhash.h"
 #include "qreadwritelock.h"
 #include "qstring.h"
 #include "qstringlist.h"
@@ -73,6 +74,8 @@
 # include "qline.h"
 #endif
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 #define NS(x) QT_PREPEND_NAMESPACE(x)
@@ -574,6 +577,20 @@ union CheckThatItIsPod
 Q_DECLARE_TYPEINFO(QCustomTypeInfo, Q_MOVABLE_TYPE);
 Q_GLOBAL_STATIC(QVector<QCustomTypeInfo>, customTypes)
 Q_GLOBAL_STATIC(QReadWriteLock, customTypesLock)
+
+/*
+    Index over the names in customTypes(), protected by customTypesLock().
+    Maps every registered type name and typedef to the id QMetaType::type()
+    returns for it, and remembers the unregistered slots of customTypes() so
+    that neither lookups nor registrations have to walk the vector.
+*/
+struct QCustomTypeNames
+{
+    QHash<QByteArray, int> ids;
+    QVector<int> freeSlots; // sorted positions in customTypes() with an empty name
+    QAtomicInt generation;  // incremented whenever a name is removed
+};
+Q_GLOBAL_STATIC(QCustomTypeNames, customTypeNames)
 Q_GLOBAL_STATIC(QMetaTypeConverterRegistry, customTypesConversionRegistry)
 Q_GLOBAL_STATIC(QMetaTypeComparatorRegistry, customTypesComparatorRegistry)
 Q_GLOBAL_STATIC(QMetaTypeDebugStreamRegistry, customTypesDebugStreamRegistry)
@@ -965,24 +982,28 @@ static inline int qMetaTypeStaticType(const char *typeName, int length)
 */
 static int qMetaTypeCustomType_unlocked(const char *typeName, int length, int *firstInvalidIndex = 0)
 {
-    const QVector<QCustomTypeInfo> * const ct = customTypes();
-    if (!ct)
+    const QCustomTypeNames * const names = customTypeNames();
+    if (!names)
         return QMetaType::UnknownType;
 
     if (firstInvalidIndex)
-        *firstInvalidIndex = -1;
-    for (int v = 0; v < ct->count(); ++v) {
-        const QCustomTypeInfo &customInfo = ct->at(v);
-        if ((length == customInfo.typeName.size())
-            && !memcmp(typeName, customInfo.typeName.constData(), length)) {
-            if (customInfo.alias >= 0)
-                return customInfo.alias;
-            return v + QMetaType::User;
-        }
-        if (firstInvalidIndex && (*firstInvalidIndex < 0) && customInfo.typeName.isEmpty())
-            *firstInvalidIndex = v;
+        *firstInvalidIndex = names->freeSlots.isEmpty() ? -1 : names->freeSlots.first();
+    return names->ids.value(QByteArray::fromRawData(typeName, length), QMetaType::UnknownType);
+}
+
+/*
+    Records that the custom type slot \a posInVector has been filled with a
+    type (or typedef) called \a typeName, which resolves to \a id.
+    customTypesLock() must be locked for writing.
+*/
+static void qMetaTypeAddCustomTypeName_unlocked(const QByteArray &typeName, int id, int posInVector)
+{
+    QCustomTypeNames * const names = customTypeNames();
+    if (posInVector != -1) {
+        Q_ASSERT(!names->freeSlots.isEmpty() && names->freeSlots.first() == posInVector);
+        names->freeSlots.removeFirst();
     }
-    return QMetaType::UnknownType;
+    names->ids.insert(typeName, id);
 }
 
 /*!
@@ -1024,10 +1045,19 @@ bool QMetaType::unregisterType(int type)
         return false;
 
     // invalidate type and all its alias entries
+    QCustomTypeNames * const names = customTypeNames();
     for (int v = 0; v < ct->count(); ++v) {
-        if (((v + User) == type) || (ct->at(v).alias == type))
-            ct->data()[v].typeName.clear();
+        if (((v + User) == type) || (ct->at(v).alias == type)) {
+            NS(QByteArray) &name = ct->data()[v].typeName;
+            if (name.isEmpty())
+                continue;
+            names->ids.remove(name);
+            names->freeSlots.insert(std::lower_bound(names->freeSlots.begin(),
+                                                     names->freeSlots.end(), v), v);
+            name.clear();
+        }
     }
+    names->generation.ref();
     return true;
 }
 
@@ -1128,6 +1158,7 @@ int QMetaType::registerNormalizedType(const NS(QByteArray) &normalizedTypeName,
                 idx = posInVector + User;
                 ct->data()[posInVector] = inf;
             }
+            qMetaTypeAddCustomTypeName_unlocked(normalizedTypeName, idx, posInVector);
             return idx;
         }
 
@@ -1223,6 +1254,7 @@ int QMetaType::registerNormalizedTypedef(const NS(QByteArray) &normalizedTypeNam
                 ct->append(inf);
             else
                 ct->data()[posInVector] = inf;
+            qMetaTypeAddCustomTypeName_unlocked(normalizedTypeName, aliasId, posInVector);
             return aliasId;
         }
     }
@@ -1257,11 +1289,38 @@ bool QMetaType::isRegistered(int type)
     return ((type >= User) && (ct && ct->count() > type - User) && !ct->at(type - User).typeName.isEmpty());
 }
 
+#ifdef Q_COMPILER_THREAD_LOCAL
+namespace {
+/*
+    Per-thread cache of successful QMetaType::type() lookups, so that resolving
+    the same names over and over (as QML and queued connections do) neither
+    takes customTypesLock() nor normalizes the name again. Only names that were
+    found are cached, since registering a type never changes the id of
+    another one; unregisterType() invalidates the caches through the
+    generation counter.
+*/
+struct QMetaTypeNameCache
+{
+    QHash<QByteArray, int> ids;
+    int generation = -1;
+
+    ~QMetaTypeNameCache() { destroyed = true; }
+    static thread_local bool destroyed;
+};
+thread_local bool QMetaTypeNameCache::destroyed = false;
+
 template <bool tryNormalizedType>
-static inline int qMetaTypeTypeImpl(const char *typeName, int length)
+QMetaTypeNameCache *qMetaTypeNameCache()
+{
+    static thread_local QMetaTypeNameCache cache;
+    return QMetaTypeNameCache::destroyed ? nullptr : &cache;
+}
+} // unnamed namespace
+#endif
+
+template <bool tryNormalizedType>
+static int qMetaTypeTypeLookup(const char *typeName, int length)
 {
-    if (!length)
-        return QMetaType::UnknownType;
     int type = qMetaTypeStaticType(typeName, length);
     if (type == QMetaType::UnknownType) {
         QReadLocker locker(customTypesLock());
@@ -1281,6 +1340,34 @@ static inline int qMetaTypeTypeImpl(const char *typeName, int length)
     return type;
 }
 
+template <bool tryNormalizedType>
+static inline int qMetaTypeTypeImpl(const char *typeName, int length)
+{
+    if (!length)
+        return QMetaType::UnknownType;
+#ifdef Q_COMPILER_THREAD_LOCAL
+    const QCustomTypeNames * const names = customTypeNames();
+    QMetaTypeNameCache * const cache = names ? qMetaTypeNameCache<tryNormalizedType>() : nullptr;
+    if (!cache)
+        return qMetaTypeTypeLookup<tryNormalizedType>(typeName, length);
+
+    const int generation = names->generation.loadAcquire();
+    if (cache->generation != generation) {
+        cache->ids.clear();
+        cache->generation = generation;
+    }
+    int type = cache->ids.value(QByteArray::fromRawData(typeName, length), QMetaType::UnknownType);
+    if (type == QMetaType::UnknownType) {
+        type = qMetaTypeTypeLookup<tryNormalizedType>(typeName, length);
+        if (type != QMetaType::UnknownType)
+            cache->ids.insert(QByteArray(typeName, length), type);
+    }
+    return type;
+#else
+    return qMetaTypeTypeLookup<tryNormalizedType>(typeName, length);
+#endif
+}
+
 /*!
     Returns a handle to the type called \a typeName, or QMetaType::UnknownType if there is
     no such type.
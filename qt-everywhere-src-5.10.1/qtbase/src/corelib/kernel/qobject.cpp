@@ -87,26 +87,32 @@ struct QSlotObjectBaseDeleter { // for use with QScopedPointer<QSlotObjectBase,.
         if (slot) slot->destroyIfLastRef();
     }
 };
-static int *queuedConnectionTypes(const QList<QByteArray> &typeNames)
+static int *queuedConnectionTypes(const QMetaMethod &method)
 {
-    int *types = new int [typeNames.count() + 1];
+    const int argc = method.parameterCount();
+    int *types = new int [argc + 1];
     Q_CHECK_PTR(types);
-    for (int i = 0; i < typeNames.count(); ++i) {
-        const QByteArray typeName = typeNames.at(i);
-        if (typeName.endsWith('*'))
-            types[i] = QMetaType::VoidStar;
-        else
-            types[i] = QMetaType::type(typeName);
-
+    for (int i = 0; i < argc; ++i) {
+        // the type id is stored in the meta object for types known to moc,
+        // only look up the name for the others
+        types[i] = method.parameterType(i);
         if (!types[i]) {
-            qWarning("QObject::connect: Cannot queue arguments of type '%s'\n"
-                     "(Make sure '%s' is registered using qRegisterMetaType().)",
-                     typeName.constData(), typeName.constData());
-            delete [] types;
-            return 0;
+            const QByteArray typeName = method.parameterTypes().at(i);
+            if (typeName.endsWith('*'))
+                types[i] = QMetaType::VoidStar;
+            else
+                types[i] = QMetaType::type(typeName);
+
+            if (!types[i]) {
+                qWarning("QObject::connect: Cannot queue arguments of type '%s'\n"
+                         "(Make sure '%s' is registered using qRegisterMetaType().)",
+                         typeName.constData(), typeName.constData());
+                delete [] types;
+                return 0;
+            }
         }
     }
-    types[typeNames.count()] = 0;
+    types[argc] = 0;
 
     return types;
 }
@@ -135,7 +141,14 @@ static int *queuedConnectionTypes(const QArgumentType *argumentTypes, int argc)
     return types.take();
 }
 
-static QBasicMutex _q_ObjectMutexPool[131];
+// Each mutex of the pool lives in its own cache line, so that threads emitting
+// signals of unrelated objects do not bounce the same line between cores even
+// when they do not hash to the same mutex.
+struct Q_DECL_ALIGN(64) QObjectMutexPoolEntry
+{
+    QBasicMutex mutex;
+};
+static QObjectMutexPoolEntry _q_ObjectMutexPool[131];
 
 /**
  * \internal
@@ -144,7 +157,7 @@ static QBasicMutex _q_ObjectMutexPool[131];
 static inline QMutex *signalSlotLock(const QObject *o)
 {
     return static_cast<QMutex *>(&_q_ObjectMutexPool[
-        uint(quintptr(o)) % sizeof(_q_ObjectMutexPool)/sizeof(QBasicMutex)]);
+        uint(quintptr(o)) % sizeof(_q_ObjectMutexPool)/sizeof(QObjectMutexPoolEntry)].mutex);
 }
 
 #if QT_VERSION < 0x60000
@@ -249,7 +262,7 @@ QObjectPrivate::~QObjectPrivate()
         }
     }
 
-    if (postedEvents)
+    if (postedEvents || threadData->postEventList.hasIncoming())
         QCoreApplication::removePostedEvents(q_ptr, 0);
 
     threadData->deref();
@@ -448,13 +461,78 @@ void QObjectPrivate::cleanConnectionLists()
     }
 }
 
+QCoalescedCall::~QCoalescedCall()
+{
+    if (types) {
+        for (int i = 0; i < nargs; ++i) {
+            if (types[i] && args[i])
+                QMetaType::destroy(types[i], args[i]);
+        }
+        free(types);
+        free(args);
+    }
+}
+
+/*!
+    \internal
+    Makes \a args the pending arguments. Returns \c true if arguments were
+    already pending, in which case they are swapped into \a nargs, \a types
+    and \a args for the caller to destroy; otherwise the caller has to post
+    an event to deliver them. Emissions on one connection are serialized by
+    the sender's lock.
+ */
+bool QCoalescedCall::store(int &nargs, int *&types, void **&args)
+{
+    for (;;) {
+        if (state.testAndSetAcquire(Pending, Busy)) {
+            qSwap(this->nargs, nargs);
+            qSwap(this->types, types);
+            qSwap(this->args, args);
+            state.storeRelease(Pending);
+            return true;
+        }
+        if (state.testAndSetAcquire(Idle, Busy)) {
+            this->nargs = nargs;
+            this->types = types;
+            this->args = args;
+            state.storeRelease(Pending);
+            return false;
+        }
+        // the receiver is taking the pending arguments
+    }
+}
+
+/*!
+    \internal
+    Moves the pending arguments into \a nargs, \a types and \a args.
+    Returns \c false if nothing was pending.
+ */
+bool QCoalescedCall::take(int &nargs, int *&types, void **&args)
+{
+    for (;;) {
+        if (state.testAndSetAcquire(Pending, Busy)) {
+            nargs = this->nargs;
+            types = this->types;
+            args = this->args;
+            this->nargs = 0;
+            this->types = 0;
+            this->args = 0;
+            state.storeRelease(Idle);
+            return true;
+        }
+        if (state.loadAcquire() == Idle)
+            return false;
+        // the sender is replacing the pending arguments
+    }
+}
+
 /*!
     \internal
  */
 QMetaCallEvent::QMetaCallEvent(ushort method_offset, ushort method_relative, QObjectPrivate::StaticMetaCallFunction callFunction,
                                const QObject *sender, int signalId,
                                int nargs, int *types, void **args, QSemaphore *semaphore)
-    : QEvent(MetaCall), slotObj_(0), sender_(sender), signalId_(signalId),
+    : QEvent(MetaCall), slotObj_(0), coalescedCall_(0), sender_(sender), signalId_(signalId),
       nargs_(nargs), types_(types), args_(args), semaphore_(semaphore),
       callFunction_(callFunction), method_offset_(method_offset), method_relative_(method_relative)
 { }
@@ -464,7 +542,7 @@ QMetaCallEvent::QMetaCallEvent(ushort method_offset, ushort method_relative, QOb
  */
 QMetaCallEvent::QMetaCallEvent(QtPrivate::QSlotObjectBase *slotO, const QObject *sender, int signalId,
                                int nargs, int *types, void **args, QSemaphore *semaphore)
-    : QEvent(MetaCall), slotObj_(slotO), sender_(sender), signalId_(signalId),
+    : QEvent(MetaCall), slotObj_(slotO), coalescedCall_(0), sender_(sender), signalId_(signalId),
       nargs_(nargs), types_(types), args_(args), semaphore_(semaphore),
       callFunction_(0), method_offset_(0), method_relative_(ushort(-1))
 {
@@ -477,6 +555,12 @@ QMetaCallEvent::QMetaCallEvent(QtPrivate::QSlotObjectBase *slotO, const QObject
  */
 QMetaCallEvent::~QMetaCallEvent()
 {
+    if (coalescedCall_) {
+        // never delivered: drop the pending arguments
+        if (!args_)
+            coalescedCall_->take(nargs_, types_, args_);
+        coalescedCall_->deref();
+    }
     if (types_) {
         for (int i = 0; i < nargs_; ++i) {
             if (types_[i] && args_[i])
@@ -496,8 +580,20 @@ QMetaCallEvent::~QMetaCallEvent()
 /*!
     \internal
  */
+/*!
+    \internal
+ */
+void QMetaCallEvent::setCoalescedCall(QCoalescedCall *call)
+{
+    Q_ASSERT(!coalescedCall_ && !args_);
+    call->ref.ref();
+    coalescedCall_ = call;
+}
+
 void QMetaCallEvent::placeMetaCall(QObject *object)
 {
+    if (coalescedCall_ && !args_ && !coalescedCall_->take(nargs_, types_, args_))
+        return;
     if (slotObj_) {
         slotObj_->call(object, args_);
     } else if (callFunction_ && method_offset_ <= object->metaObject()->methodOffset()) {
@@ -1034,6 +1130,8 @@ QObject::~QObject()
 
 QObjectPrivate::Connection::~Connection()
 {
+    if (coalescedCall)
+        coalescedCall->deref();
     if (ownArgumentTypes) {
         const int *v = argumentTypes.load();
         if (v != &DIRECT_CONNECTION_ONLY)
@@ -1499,9 +1597,18 @@ void QObject::moveToThread(QThread *targetThread)
     // keep currentData alive (since we've got it locked)
     currentData->ref();
 
+    QCoreApplicationPrivate::flushIncomingPostedEvents(currentData);
+    QCoreApplicationPrivate::flushIncomingPostedEvents(targetData);
+
     // move the object
     d_func()->setThreadData_helper(currentData, targetData);
 
+    // posters that saw the old thread data may still be pushing events
+    // to it; wait for them and forward what they pushed to targetData
+    while (currentData->postEventList.pushers.loadAcquire())
+        QThread::yieldCurrentThread();
+    QCoreApplicationPrivate::flushIncomingPostedEvents(currentData);
+
     locker.unlock();
 
     // now currentData can commit suicide if it wants to
@@ -2760,7 +2867,7 @@ QMetaObject::Connection QObject::connect(const QObject *sender, const char *sign
     }
 
     int *types = 0;
-    if ((type == Qt::QueuedConnection)
+    if (((type & ~Qt::CoalescedConnection) == Qt::QueuedConnection)
             && !(types = queuedConnectionTypes(signalTypes.constData(), signalTypes.size()))) {
         return QMetaObject::Connection(0);
     }
@@ -2841,8 +2948,8 @@ QMetaObject::Connection QObject::connect(const QObject *sender, const QMetaMetho
     }
 
     int *types = 0;
-    if ((type == Qt::QueuedConnection)
-            && !(types = queuedConnectionTypes(signal.parameterTypes())))
+    if (((type & ~Qt::CoalescedConnection) == Qt::QueuedConnection)
+            && !(types = queuedConnectionTypes(signal)))
         return QMetaObject::Connection(0);
 
 #ifndef QT_NO_DEBUG
@@ -3297,7 +3404,7 @@ QObjectPrivate::Connection *QMetaObjectPrivate::connect(const QObject *sender,
                 c2 = c2->nextConnectionList;
             }
         }
-        type &= Qt::UniqueConnection - 1;
+        type &= ~Qt::UniqueConnection;
     }
 
     QScopedPointer<QObjectPrivate::Connection> c(new QObjectPrivate::Connection);
@@ -3306,7 +3413,8 @@ QObjectPrivate::Connection *QMetaObjectPrivate::connect(const QObject *sender,
     c->receiver = r;
     c->method_relative = method_index;
     c->method_offset = method_offset;
-    c->connectionType = type;
+    c->connectionType = type & ~Qt::CoalescedConnection;
+    c->isCoalesced = (type & Qt::CoalescedConnection) != 0;
     c->isSlotObject = false;
     c->argumentTypes.store(types);
     c->nextConnectionList = 0;
@@ -3572,7 +3680,7 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
     const int *argumentTypes = c->argumentTypes.load();
     if (!argumentTypes) {
         QMetaMethod m = QMetaObjectPrivate::signal(sender->metaObject(), signal);
-        argumentTypes = queuedConnectionTypes(m.parameterTypes());
+        argumentTypes = queuedConnectionTypes(m);
         if (!argumentTypes) // cannot queue arguments
             argumentTypes = &DIRECT_CONNECTION_ONLY;
         if (!c->argumentTypes.testAndSetOrdered(0, argumentTypes)) {
@@ -3614,6 +3722,28 @@ static void queued_activate(QObject *sender, int signal, QObjectPrivate::Connect
         }
     }
 
+    if (c->isCoalesced) {
+        if (!c->coalescedCall)
+            c->coalescedCall = new QCoalescedCall;
+        if (c->coalescedCall->store(nargs, types, args)) {
+            // an earlier emission is still queued; it will deliver these
+            // arguments, the ones it had are dropped
+            locker.unlock();
+            for (int n = 1; n < nargs; ++n)
+                QMetaType::destroy(types[n], args[n]);
+            free(types);
+            free(args);
+            locker.relock();
+            return;
+        }
+        QMetaCallEvent *ev = c->isSlotObject ?
+            new QMetaCallEvent(c->slotObj, sender, signal) :
+            new QMetaCallEvent(c->method_offset, c->method_relative, c->callFunction, sender, signal);
+        ev->setCoalescedCall(c->coalescedCall);
+        QCoreApplication::postEvent(c->receiver, ev);
+        return;
+    }
+
     QMetaCallEvent *ev = c->isSlotObject ?
         new QMetaCallEvent(c->slotObj, sender, signal, nargs, types, args) :
         new QMetaCallEvent(c->method_offset, c->method_relative, c->callFunction, sender, signal, nargs, types, args);
@@ -3658,6 +3788,9 @@ void QMetaObject::activate(QObject *sender, int signalOffset, int local_signal_i
                                                          argv ? argv : empty_argv);
     }
 
+    // resolved before taking the lock, to keep the critical section short
+    Qt::HANDLE currentThreadId = QThread::currentThreadId();
+
     {
     QMutexLocker locker(signalSlotLock(sender));
     struct ConnectionListsRef {
@@ -3696,8 +3829,6 @@ void QMetaObject::activate(QObject *sender, int signalOffset, int local_signal_i
     else
         list = &connectionLists->allsignals;
 
-    Qt::HANDLE currentThreadId = QThread::currentThreadId();
-
     do {
         QObjectPrivate::Connection *c = list->first;
         if (!c) continue;
@@ -4832,7 +4963,8 @@ QMetaObject::Connection QObjectPrivate::connectImpl(const QObject *sender, int s
     c->signal_index = signal_index;
     c->receiver = r;
     c->slotObj = slotObj;
-    c->connectionType = type;
+    c->connectionType = type & ~Qt::CoalescedConnection;
+    c->isCoalesced = (type & Qt::CoalescedConnection) != 0;
     c->isSlotObject = true;
     if (types) {
         c->argumentTypes.store(types);
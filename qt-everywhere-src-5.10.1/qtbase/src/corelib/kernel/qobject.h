@@ -250,7 +250,7 @@ public:
                           "Return type of the slot is not compatible with the return type of the signal.");
 
         const int *types = Q_NULLPTR;
-        if (type == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
+        if ((type & ~Qt::CoalescedConnection) == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
             types = QtPrivate::ConnectionTypes<typename SignalType::Arguments>::types();
 
         return connectImpl(sender, reinterpret_cast<void **>(&signal),
@@ -290,7 +290,7 @@ public:
                           "Return type of the slot is not compatible with the return type of the signal.");
 
         const int *types = Q_NULLPTR;
-        if (type == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
+        if ((type & ~Qt::CoalescedConnection) == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
             types = QtPrivate::ConnectionTypes<typename SignalType::Arguments>::types();
 
         return connectImpl(sender, reinterpret_cast<void **>(&signal), context, Q_NULLPTR,
@@ -329,7 +329,7 @@ public:
                           "No Q_OBJECT in the class with the signal");
 
         const int *types = Q_NULLPTR;
-        if (type == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
+        if ((type & ~Qt::CoalescedConnection) == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
             types = QtPrivate::ConnectionTypes<typename SignalType::Arguments>::types();
 
         return connectImpl(sender, reinterpret_cast<void **>(&signal), context, Q_NULLPTR,
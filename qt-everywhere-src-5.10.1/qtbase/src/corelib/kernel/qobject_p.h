@@ -105,6 +105,27 @@ struct QAbstractDeclarativeDataImpl : public QAbstractDeclarativeData
     quint32 unused: 31;
 };
 
+// Arguments of the latest emission on a Qt::CoalescedConnection that has
+// not been delivered yet. Shared by the connection and the QMetaCallEvent
+// posted for the first of the coalesced emissions.
+struct QCoalescedCall
+{
+    enum State { Idle, Pending, Busy };
+
+    QAtomicInt ref;
+    QAtomicInt state;
+    int nargs;
+    int *types;
+    void **args;
+
+    QCoalescedCall() : ref(1), state(Idle), nargs(0), types(0), args(0) { }
+    ~QCoalescedCall();
+
+    bool store(int &nargs, int *&types, void **&args);
+    bool take(int &nargs, int *&types, void **&args);
+    void deref() { if (!ref.deref()) delete this; }
+};
+
 class Q_CORE_EXPORT QObjectPrivate : public QObjectData
 {
     Q_DECLARE_PUBLIC(QObject)
@@ -138,14 +159,17 @@ public:
         Connection *next;
         Connection **prev;
         QAtomicPointer<const int> argumentTypes;
+        QCoalescedCall *coalescedCall; // created by the first queued emission if isCoalesced
         QAtomicInt ref_;
         ushort method_offset;
         ushort method_relative;
+        // all the flags share a single 32-bit word, whatever the compiler's bit-field packing rules
         uint signal_index : 27; // In signal range (see QObjectPrivate::signalIndex())
-        ushort connectionType : 3; // 0 == auto, 1 == direct, 2 == queued, 4 == blocking
-        ushort isSlotObject : 1;
-        ushort ownArgumentTypes : 1;
-        Connection() : nextConnectionList(0), ref_(2), ownArgumentTypes(true) {
+        uint connectionType : 2; // 0 == auto, 1 == direct, 2 == queued, 3 == blocking
+        uint isCoalesced : 1;
+        uint isSlotObject : 1;
+        uint ownArgumentTypes : 1;
+        Connection() : nextConnectionList(0), coalescedCall(0), ref_(2), isCoalesced(false), ownArgumentTypes(true) {
             //ref_ is 2 for the use in the internal lists, and for the use in QMetaObject::Connection
         }
         ~Connection();
@@ -390,10 +414,14 @@ public:
     inline int signalId() const { return signalId_; }
     inline void **args() const { return args_; }
 
+    // the arguments are taken from call when the event is delivered
+    void setCoalescedCall(QCoalescedCall *call);
+
     virtual void placeMetaCall(QObject *object);
 
 private:
     QtPrivate::QSlotObjectBase *slotObj_;
+    QCoalescedCall *coalescedCall_;
     const QObject *sender_;
     int signalId_;
     int nargs_;
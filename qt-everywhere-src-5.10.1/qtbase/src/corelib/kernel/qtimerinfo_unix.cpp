@@ -53,6 +53,8 @@
 
 #include <sys/times.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 Q_CORE_EXPORT bool qt_disable_lowpriority_timers=false;
@@ -86,6 +88,11 @@ QTimerInfoList::QTimerInfoList()
     firstTimerInfo = 0;
 }
 
+QTimerInfoList::~QTimerInfoList()
+{
+    qDeleteAll(timersById);
+}
+
 timespec QTimerInfoList::updateCurrentTime()
 {
     return (currentTime = qt_gettime());
@@ -151,9 +158,17 @@ bool QTimerInfoList::timeChanged(timespec *delta)
 void QTimerInfoList::timerRepair(const timespec &diff)
 {
     // repair all timers
-    for (int i = 0; i < size(); ++i) {
-        QTimerInfo *t = at(i);
+    for (int i = 0; i < sortedTimers.size(); ++i) {
+        QTimerInfo *t = sortedTimers.at(i);
+        t->timeout = t->timeout + diff;
+    }
+
+    // the wheel position depends on the timeout, so take them all out and reinsert
+    QVector<QTimerInfo *> wheelTimers;
+    wheel.takeAll(&wheelTimers);
+    for (QTimerInfo *t : qAsConst(wheelTimers)) {
         t->timeout = t->timeout + diff;
+        timerInsert(t);
     }
 }
 
@@ -174,18 +189,234 @@ void QTimerInfoList::repairTimersIfNeeded()
 
 #endif
 
+static inline qint64 tickFloor(const timespec &ts)
+{
+    return qint64(ts.tv_sec) * 1000 + ts.tv_nsec / (1000 * 1000);
+}
+
+static inline qint64 tickCeil(const timespec &ts)
+{
+    return qint64(ts.tv_sec) * 1000 + (ts.tv_nsec + 1000 * 1000 - 1) / (1000 * 1000);
+}
+
+static inline timespec timespecFromTick(qint64 tick)
+{
+    timespec ts;
+    ts.tv_sec = tick / 1000;
+    ts.tv_nsec = (tick % 1000) * 1000 * 1000;
+    return ts;
+}
+
+static inline bool timerInfoTimeoutLessThan(const QTimerInfo *t1, const QTimerInfo *t2)
+{
+    return t1->timeout < t2->timeout;
+}
+
 /*
-  insert timer info into list
+  The wheel has Levels levels of Slots slots each. A timer is filed at the
+  level of the most significant SlotBits-wide digit in which its expiry tick
+  differs from the wheel's time, in the slot given by its expiry digit at that
+  level. So level 0 holds the timers expiring within the current run of Slots
+  milliseconds, one tick per slot, and every level above covers Slots times
+  the range of the one below. Advancing the wheel empties the slots that were
+  passed over and files their timers again relative to the new time (cascading
+  them towards level 0), handing those that expired back to the caller.
 */
-void QTimerInfoList::timerInsert(QTimerInfo *ti)
+QTimerWheel::QTimerWheel()
+    : time(0), count(0), cachedNextExpiry(-1)
+{
+    memset(buckets, 0, sizeof(buckets));
+    memset(occupied, 0, sizeof(occupied));
+}
+
+static inline int wheelDigit(qint64 tick, int level)
+{
+    return int((tick >> (QTimerWheel::SlotBits * level)) & (QTimerWheel::Slots - 1));
+}
+
+static inline qint64 wheelPrefix(qint64 tick, int level)
+{
+    return tick >> (QTimerWheel::SlotBits * (level + 1));
+}
+
+// mask with the bits 0..digit (inclusive) set
+static inline quint64 wheelLowMask(int digit)
+{
+    return (Q_UINT64_C(2) << digit) - 1;
+}
+
+void QTimerWheel::insert(QTimerInfo *t)
+{
+    const qint64 expiry = tickCeil(t->timeout);
+    Q_ASSERT(expiry > time);
+
+    int level = 0;
+    while (level < Levels - 1 && wheelPrefix(expiry, level) != wheelPrefix(time, level))
+        ++level;
+    const int slot = wheelDigit(expiry, level);
+
+    t->wheelLevel = level;
+    t->wheelSlot = slot;
+    t->wheelPrev = nullptr;
+    t->wheelNext = buckets[level][slot];
+    if (t->wheelNext)
+        t->wheelNext->wheelPrev = t;
+    buckets[level][slot] = t;
+    occupied[level] |= Q_UINT64_C(1) << slot;
+    ++count;
+
+    if (cachedNextExpiry != -1 && expiry < cachedNextExpiry)
+        cachedNextExpiry = expiry;
+}
+
+void QTimerWheel::remove(QTimerInfo *t)
+{
+    Q_ASSERT(t->wheelLevel >= 0);
+
+    if (t->wheelPrev)
+        t->wheelPrev->wheelNext = t->wheelNext;
+    else
+        buckets[t->wheelLevel][t->wheelSlot] = t->wheelNext;
+    if (t->wheelNext)
+        t->wheelNext->wheelPrev = t->wheelPrev;
+    if (!buckets[t->wheelLevel][t->wheelSlot])
+        occupied[t->wheelLevel] &= ~(Q_UINT64_C(1) << t->wheelSlot);
+    --count;
+
+    if (cachedNextExpiry == tickCeil(t->timeout))
+        cachedNextExpiry = -1;
+
+    t->wheelLevel = -1;
+    t->wheelPrev = t->wheelNext = nullptr;
+}
+
+void QTimerWheel::takeSlot(int level, int slot, QVector<QTimerInfo *> *timers)
+{
+    QTimerInfo *t = buckets[level][slot];
+    while (t) {
+        QTimerInfo *next = t->wheelNext;
+        t->wheelLevel = -1;
+        t->wheelPrev = t->wheelNext = nullptr;
+        timers->append(t);
+        --count;
+        t = next;
+    }
+    buckets[level][slot] = nullptr;
+    occupied[level] &= ~(Q_UINT64_C(1) << slot);
+}
+
+/*
+  Advances the wheel to the tick \a to, appending the timers that expire at
+  or before it to \a expired. The others stay in (or move to) the wheel.
+*/
+void QTimerWheel::advance(qint64 to, QVector<QTimerInfo *> *expired)
+{
+    if (to <= time)
+        return;
+
+    QVector<QTimerInfo *> passed;
+    for (int level = Levels - 1; level >= 0; --level) {
+        quint64 mask = occupied[level];
+        if (!mask)
+            continue;
+        if (wheelPrefix(to, level) == wheelPrefix(time, level))
+            mask &= wheelLowMask(wheelDigit(to, level)) & ~wheelLowMask(wheelDigit(time, level));
+        while (mask) {
+            const int slot = qCountTrailingZeroBits(mask);
+            mask &= mask - 1;
+            takeSlot(level, slot, &passed);
+        }
+    }
+
+    time = to;
+    cachedNextExpiry = -1;
+    for (QTimerInfo *t : qAsConst(passed)) {
+        if (tickCeil(t->timeout) <= to)
+            expired->append(t);
+        else
+            insert(t);
+    }
+}
+
+void QTimerWheel::takeAll(QVector<QTimerInfo *> *timers)
 {
-    int index = size();
+    for (int level = 0; level < Levels; ++level) {
+        quint64 mask = occupied[level];
+        while (mask) {
+            const int slot = qCountTrailingZeroBits(mask);
+            mask &= mask - 1;
+            takeSlot(level, slot, timers);
+        }
+    }
+    cachedNextExpiry = -1;
+}
+
+/*
+  Returns the tick of the earliest expiry in the wheel, which must not be empty.
+*/
+qint64 QTimerWheel::nextExpiry() const
+{
+    Q_ASSERT(count > 0);
+    if (cachedNextExpiry != -1)
+        return cachedNextExpiry;
+
+    // every timer on a level expires before all timers on the levels above it
+    int level = 0;
+    while (!occupied[level])
+        ++level;
+    const int slot = qCountTrailingZeroBits(occupied[level]);
+
+    if (level == 0) {
+        cachedNextExpiry = (time & ~qint64(Slots - 1)) | slot;
+    } else {
+        qint64 earliest = std::numeric_limits<qint64>::max();
+        for (const QTimerInfo *t = buckets[level][slot]; t; t = t->wheelNext)
+            earliest = qMin(earliest, tickCeil(t->timeout));
+        cachedNextExpiry = earliest;
+    }
+    return cachedNextExpiry;
+}
+
+static void insertSorted(QList<QTimerInfo *> &list, QTimerInfo *ti)
+{
+    int index = list.size();
     while (index--) {
-        const QTimerInfo * const t = at(index);
+        const QTimerInfo * const t = list.at(index);
         if (!(ti->timeout < t->timeout))
             break;
     }
-    insert(index+1, ti);
+    list.insert(index+1, ti);
+}
+
+/*
+  insert timer info into the wheel or the sorted list
+*/
+void QTimerInfoList::timerInsert(QTimerInfo *ti)
+{
+    ti->wheelLevel = -1;
+    if (ti->timerType != Qt::PreciseTimer) {
+        // an empty wheel can be moved to any time
+        if (wheel.isEmpty())
+            wheel.time = tickFloor(currentTime);
+        if (tickCeil(ti->timeout) > wheel.time) {
+            wheel.insert(ti);
+            return;
+        }
+    }
+    insertSorted(sortedTimers, ti);
+}
+
+void QTimerInfoList::removeTimer(QTimerInfo *t)
+{
+    if (t->wheelLevel >= 0)
+        wheel.remove(t);
+    else
+        sortedTimers.removeOne(t);
+
+    if (t == firstTimerInfo)
+        firstTimerInfo = 0;
+    if (t->activateRef)
+        *(t->activateRef) = 0;
 }
 
 inline timespec &operator+=(timespec &t1, int ms)
@@ -390,19 +621,28 @@ bool QTimerInfoList::timerWait(timespec &tm)
 
     // Find first waiting timer not already active
     QTimerInfo *t = 0;
-    for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
+    for (QList<QTimerInfo *>::const_iterator it = sortedTimers.constBegin(); it != sortedTimers.constEnd(); ++it) {
         if (!(*it)->activateRef) {
             t = *it;
             break;
         }
     }
 
-    if (!t)
+    if (!t && wheel.isEmpty())
       return false;
 
-    if (currentTime < t->timeout) {
+    timespec timeout;
+    if (!wheel.isEmpty()) {
+        timeout = timespecFromTick(wheel.nextExpiry());
+        if (t && t->timeout < timeout)
+            timeout = t->timeout;
+    } else {
+        timeout = t->timeout;
+    }
+
+    if (currentTime < timeout) {
         // time to wait
-        tm = roundToMillisecond(t->timeout - currentTime);
+        tm = roundToMillisecond(timeout - currentTime);
     } else {
         // no time to wait
         tm.tv_sec  = 0;
@@ -423,16 +663,13 @@ int QTimerInfoList::timerRemainingTime(int timerId)
     repairTimersIfNeeded();
     timespec tm = {0, 0};
 
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
-        if (t->id == timerId) {
-            if (currentTime < t->timeout) {
-                // time to wait
-                tm = roundToMillisecond(t->timeout - currentTime);
-                return tm.tv_sec*1000 + tm.tv_nsec/1000/1000;
-            } else {
-                return 0;
-            }
+    if (const QTimerInfo *t = timersById.value(timerId)) {
+        if (currentTime < t->timeout) {
+            // time to wait
+            tm = roundToMillisecond(t->timeout - currentTime);
+            return tm.tv_sec*1000 + tm.tv_nsec/1000/1000;
+        } else {
+            return 0;
         }
     }
 
@@ -451,6 +688,9 @@ void QTimerInfoList::registerTimer(int timerId, int interval, Qt::TimerType time
     t->timerType = timerType;
     t->obj = object;
     t->activateRef = 0;
+    t->wheelLevel = -1;
+    t->wheelSlot = 0;
+    t->wheelPrev = t->wheelNext = nullptr;
 
     timespec expected = updateCurrentTime() + interval;
 
@@ -494,6 +734,7 @@ void QTimerInfoList::registerTimer(int timerId, int interval, Qt::TimerType time
     }
 
     timerInsert(t);
+    timersById.insert(timerId, t);
 
 #ifdef QTIMERINFO_DEBUG
     t->expected = expected;
@@ -507,40 +748,28 @@ void QTimerInfoList::registerTimer(int timerId, int interval, Qt::TimerType time
 
 bool QTimerInfoList::unregisterTimer(int timerId)
 {
-    // set timer inactive
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
-        if (t->id == timerId) {
-            // found it
-            removeAt(i);
-            if (t == firstTimerInfo)
-                firstTimerInfo = 0;
-            if (t->activateRef)
-                *(t->activateRef) = 0;
-            delete t;
-            return true;
-        }
-    }
-    // id not found
-    return false;
+    QTimerInfo *t = timersById.take(timerId);
+    if (!t)
+        return false; // id not found
+
+    removeTimer(t);
+    delete t;
+    return true;
 }
 
 bool QTimerInfoList::unregisterTimers(QObject *object)
 {
     if (isEmpty())
         return false;
-    for (int i = 0; i < count(); ++i) {
-        QTimerInfo *t = at(i);
+    for (auto it = timersById.begin(); it != timersById.end(); ) {
+        QTimerInfo *t = it.value();
         if (t->obj == object) {
             // object found
-            removeAt(i);
-            if (t == firstTimerInfo)
-                firstTimerInfo = 0;
-            if (t->activateRef)
-                *(t->activateRef) = 0;
+            it = timersById.erase(it);
+            removeTimer(t);
             delete t;
-            // move back one so that we don't skip the new current item
-            --i;
+        } else {
+            ++it;
         }
     }
     return true;
@@ -549,8 +778,7 @@ bool QTimerInfoList::unregisterTimers(QObject *object)
 QList<QAbstractEventDispatcher::TimerInfo> QTimerInfoList::registeredTimers(QObject *object) const
 {
     QList<QAbstractEventDispatcher::TimerInfo> list;
-    for (int i = 0; i < count(); ++i) {
-        const QTimerInfo * const t = at(i);
+    for (const QTimerInfo *t : timersById) {
         if (t->obj == object) {
             list << QAbstractEventDispatcher::TimerInfo(t->id,
                                                         (t->timerType == Qt::VeryCoarseTimer
@@ -577,9 +805,17 @@ int QTimerInfoList::activateTimers()
     // qDebug() << "Thread" << QThread::currentThreadId() << "woken up at" << currentTime;
     repairTimersIfNeeded();
 
+    // move the expired timers out of the wheel, in timeout order
+    if (!wheel.isEmpty()) {
+        QVector<QTimerInfo *> expired;
+        wheel.advance(tickFloor(currentTime), &expired);
+        std::stable_sort(expired.begin(), expired.end(), timerInfoTimeoutLessThan);
+        for (QTimerInfo *t : qAsConst(expired))
+            insertSorted(sortedTimers, t);
+    }
 
     // Find out how many timer have expired
-    for (QTimerInfoList::const_iterator it = constBegin(); it != constEnd(); ++it) {
+    for (QList<QTimerInfo *>::const_iterator it = sortedTimers.constBegin(); it != sortedTimers.constEnd(); ++it) {
         if (currentTime < (*it)->timeout)
             break;
         maxCount++;
@@ -587,10 +823,10 @@ int QTimerInfoList::activateTimers()
 
     //fire the timers.
     while (maxCount--) {
-        if (isEmpty())
+        if (sortedTimers.isEmpty())
             break;
 
-        QTimerInfo *currentTimerInfo = constFirst();
+        QTimerInfo *currentTimerInfo = sortedTimers.constFirst();
         if (currentTime < currentTimerInfo->timeout)
             break; // no timer has expired
 
@@ -605,7 +841,7 @@ int QTimerInfoList::activateTimers()
         }
 
         // remove from list
-        removeFirst();
+        sortedTimers.removeFirst();
 
 #ifdef QTIMERINFO_DEBUG
         float diff;
@@ -56,6 +56,8 @@
 // #define QTIMERINFO_DEBUG
 
 #include "qabstracteventdispatcher.h"
+#include "qhash.h"
+#include "qvector.h"
 
 #include <sys/time.h> // struct timeval
 
@@ -70,6 +72,12 @@ struct QTimerInfo {
     QObject *obj;     // - object to receive event
     QTimerInfo **activateRef; // - ref from activateTimers
 
+    // position in the timer wheel; wheelLevel is -1 while in the sorted list
+    int wheelLevel;
+    int wheelSlot;
+    QTimerInfo *wheelPrev;
+    QTimerInfo *wheelNext;
+
 #ifdef QTIMERINFO_DEBUG
     timeval expected; // when timer is expected to fire
     float cumulativeError;
@@ -77,7 +85,40 @@ struct QTimerInfo {
 #endif
 };
 
-class Q_CORE_EXPORT QTimerInfoList : public QList<QTimerInfo*>
+/*
+    Coarse and very coarse timers are kept in a hierarchical timer wheel
+    with millisecond ticks, which gives O(1) insertion and removal no matter
+    how many of them are armed. Precise timers, and timers that are about
+    to fire, are kept in a list sorted by timeout as before, which is where
+    they get activated from.
+*/
+class QTimerWheel
+{
+public:
+    enum { SlotBits = 6, Slots = 1 << SlotBits, Levels = 6 };
+
+    QTimerWheel();
+
+    bool isEmpty() const { return count == 0; }
+
+    void insert(QTimerInfo *t);
+    void remove(QTimerInfo *t);
+    void advance(qint64 to, QVector<QTimerInfo *> *expired);
+    void takeAll(QVector<QTimerInfo *> *timers);
+    qint64 nextExpiry() const;
+
+    qint64 time;      // tick up to which the wheel has been advanced
+    int count;
+
+private:
+    void takeSlot(int level, int slot, QVector<QTimerInfo *> *timers);
+
+    QTimerInfo *buckets[Levels][Slots];
+    quint64 occupied[Levels];
+    mutable qint64 cachedNextExpiry; // -1 if unknown
+};
+
+class Q_CORE_EXPORT QTimerInfoList
 {
 #if ((_POSIX_MONOTONIC_CLOCK-0 <= 0) && !defined(Q_OS_MAC)) || defined(QT_BOOTSTRAPPED)
     timespec previousTime;
@@ -92,8 +133,15 @@ class Q_CORE_EXPORT QTimerInfoList : public QList<QTimerInfo*>
     // state variables used by activateTimers()
     QTimerInfo *firstTimerInfo;
 
+    QList<QTimerInfo *> sortedTimers;
+    QTimerWheel wheel;
+    QHash<int, QTimerInfo *> timersById;
+
+    void removeTimer(QTimerInfo *t);
+
 public:
     QTimerInfoList();
+    ~QTimerInfoList();
 
     timespec currentTime;
     timespec updateCurrentTime();
@@ -112,6 +160,9 @@ public:
     QList<QAbstractEventDispatcher::TimerInfo> registeredTimers(QObject *object) const;
 
     int activateTimers();
+
+    bool isEmpty() const { return timersById.isEmpty(); }
+    int size() const { return timersById.size(); }
 };
 
 QT_END_NAMESPACE
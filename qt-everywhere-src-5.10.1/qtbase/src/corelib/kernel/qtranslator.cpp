@@ -56,6 +56,8 @@
 #include "qlocale.h"
 #include "qendian.h"
 #include "qresource.h"
+#include "qhash.h"
+#include "qmutex.h"
 
 #if defined(Q_OS_UNIX) && !defined(Q_OS_INTEGRITY)
 #define QT_USE_MMAP
@@ -130,6 +132,29 @@ static uint elfHash(const char *name)
     return hash;
 }
 
+/*
+   FNV-1a hash of the complete message key. lrelease uses the same hash to
+   build the PerfectHashes block, so it must not be changed.
+*/
+static void keyHash_continue(const char *str, quint64 &h)
+{
+    for (const uchar *k = reinterpret_cast<const uchar *>(str); *k; ++k) {
+        h ^= *k;
+        h *= Q_UINT64_C(0x100000001b3);
+    }
+}
+
+static quint64 keyHash(const char *context, const char *sourceText, const char *comment)
+{
+    quint64 h = Q_UINT64_C(0xcbf29ce484222325);
+    keyHash_continue(context, h);
+    h *= Q_UINT64_C(0x100000001b3); // separator
+    keyHash_continue(sourceText, h);
+    h *= Q_UINT64_C(0x100000001b3);
+    keyHash_continue(comment, h);
+    return h;
+}
+
 /*
    \internal
 
@@ -287,7 +312,15 @@ class QTranslatorPrivate : public QObjectPrivate
 {
     Q_DECLARE_PUBLIC(QTranslator)
 public:
-    enum { Contexts = 0x2f, Hashes = 0x42, Messages = 0x69, NumerusRules = 0x88, Dependencies = 0x96 };
+    enum { Contexts = 0x2f, Hashes = 0x42, Messages = 0x69, NumerusRules = 0x88, Dependencies = 0x96,
+           PerfectHashes = 0xa5 };
+    enum { MaxCachedTranslations = 1024 };
+
+    // A translation looked up before, verified against the complete key
+    struct CachedTranslation {
+        QByteArray key; // context, source text and comment, separated by '\0'
+        QString translation;
+    };
 
     QTranslatorPrivate() :
 #if defined(QT_USE_MMAP)
@@ -295,7 +328,9 @@ public:
 #endif
           unmapPointer(0), unmapLength(0), resource(0),
           messageArray(0), offsetArray(0), contextArray(0), numerusRulesArray(0),
-          messageLength(0), offsetLength(0), contextLength(0), numerusRulesLength(0) {}
+          perfectHashArray(0),
+          messageLength(0), offsetLength(0), contextLength(0), numerusRulesLength(0),
+          perfectHashLength(0) {}
 
 #if defined(QT_USE_MMAP)
     bool used_mmap : 1;
@@ -315,15 +350,24 @@ public:
     const uchar *offsetArray;
     const uchar *contextArray;
     const uchar *numerusRulesArray;
+    const uchar *perfectHashArray;
     uint messageLength;
     uint offsetLength;
     uint contextLength;
     uint numerusRulesLength;
+    uint perfectHashLength;
+
+    // Hot strings are translated repeatedly, e.g. by retranslateUi() and
+    // qsTr() bindings; the cache returns them without decoding them again.
+    mutable QMutex cacheMutex;
+    mutable QHash<quint64, CachedTranslation> cache;
 
     bool do_load(const QString &filename, const QString &directory);
     bool do_load(const uchar *data, int len, const QString &directory);
     QString do_translate(const char *context, const char *sourceText, const char *comment,
                          int n) const;
+    QString lookup(const char *context, const char *sourceText, const char *comment,
+                   quint64 hash, uint numerus, int n) const;
     void clear();
 };
 
@@ -845,6 +889,9 @@ bool QTranslatorPrivate::do_load(const uchar *data, int len, const QString &dire
         } else if (tag == QTranslatorPrivate::NumerusRules) {
             numerusRulesArray = data;
             numerusRulesLength = blockLen;
+        } else if (tag == QTranslatorPrivate::PerfectHashes) {
+            perfectHashArray = data;
+            perfectHashLength = blockLen;
         } else if (tag == QTranslatorPrivate::Dependencies) {
             QDataStream stream(QByteArray::fromRawData((const char*)data, blockLen));
             QString dep;
@@ -859,6 +906,16 @@ bool QTranslatorPrivate::do_load(const uchar *data, int len, const QString &dire
 
     if (dependencies.isEmpty() && (!offsetArray || !messageArray))
         ok = false;
+    if (ok && perfectHashArray) {
+        // Ignore a malformed table, the offset array is still there
+        const quint64 bucketCount = perfectHashLength >= 8 ? read32(perfectHashArray) : 0;
+        const quint64 slotCount = perfectHashLength >= 8 ? read32(perfectHashArray + 4) : 0;
+        if (!bucketCount || !slotCount
+                || 8 + 4 * bucketCount + 8 * slotCount != perfectHashLength) {
+            perfectHashArray = 0;
+            perfectHashLength = 0;
+        }
+    }
     if (ok && !isValidNumerusRules(numerusRulesArray, numerusRulesLength))
         ok = false;
     if (ok) {
@@ -884,10 +941,12 @@ bool QTranslatorPrivate::do_load(const uchar *data, int len, const QString &dire
         contextArray = 0;
         offsetArray = 0;
         numerusRulesArray = 0;
+        perfectHashArray = 0;
         messageLength = 0;
         contextLength = 0;
         offsetLength = 0;
         numerusRulesLength = 0;
+        perfectHashLength = 0;
     }
 
     return ok;
@@ -955,14 +1014,30 @@ static QString getMessage(const uchar *m, const uchar *end, const char *context,
 end:
     if (!tn)
         return QString();
-    QString str = QString((const QChar *)tn, tn_length/2);
-    if (QSysInfo::ByteOrder == QSysInfo::LittleEndian) {
-        for (int i = 0; i < str.length(); ++i)
-            str[i] = QChar((str.at(i).unicode() >> 8) + ((str.at(i).unicode() << 8) & 0xff00));
-    }
+    const int length = int(tn_length / 2);
+    QString str(length, Qt::Uninitialized);
+    QChar *dst = str.data();
+    for (int i = 0; i < length; ++i)
+        dst[i] = QChar(read16(tn + 2 * i));
     return str;
 }
 
+static bool matchesKey(const QByteArray &key, const char *context, const char *sourceText,
+                       const char *comment)
+{
+    const char *k = key.constData();
+    const char *parts[] = { context, sourceText, comment };
+    for (const char *part : parts) {
+        const size_t len = strlen(part);
+        if (size_t(key.constEnd() - k) < len || memcmp(k, part, len) != 0)
+            return false;
+        k += len;
+        if (part != comment && (k == key.constEnd() || *k++ != '\0'))
+            return false;
+    }
+    return k == key.constEnd();
+}
+
 QString QTranslatorPrivate::do_translate(const char *context, const char *sourceText,
                                          const char *comment, int n) const
 {
@@ -974,11 +1049,79 @@ QString QTranslatorPrivate::do_translate(const char *context, const char *source
         comment = "";
 
     uint numerus = 0;
+    if (n >= 0 && offsetLength)
+        numerus = numerusHelper(n, numerusRulesArray, numerusRulesLength);
+
+    const quint64 hash = keyHash(context, sourceText, comment);
+    // Translations from dependencies depend on n, not only on numerus
+    const quint64 cacheKey = hash ^ (quint64(subTranslators.isEmpty() ? numerus : uint(n))
+                                     * Q_UINT64_C(0x9e3779b97f4a7c15));
+    {
+        QMutexLocker locker(&cacheMutex);
+        const auto it = cache.constFind(cacheKey);
+        if (it != cache.constEnd() && matchesKey(it->key, context, sourceText, comment))
+            return it->translation;
+    }
+
+    const QString translation = lookup(context, sourceText, comment, hash, numerus, n);
+
+    CachedTranslation entry;
+    entry.key.reserve(int(strlen(context) + strlen(sourceText) + strlen(comment) + 2));
+    entry.key.append(context).append('\0').append(sourceText).append('\0').append(comment);
+    entry.translation = translation;
+    QMutexLocker locker(&cacheMutex);
+    if (cache.size() >= MaxCachedTranslations)
+        cache.clear();
+    cache.insert(cacheKey, entry);
+    return translation;
+}
+
+QString QTranslatorPrivate::lookup(const char *context, const char *sourceText,
+                                   const char *comment, quint64 hash, uint numerus, int n) const
+{
     size_t numItems = 0;
 
     if (!offsetLength)
         goto searchDependencies;
 
+    if (perfectHashLength) {
+        /*
+            The PerfectHashes block maps every message key to its own slot:
+
+                quint32 bucketCount;
+                quint32 slotCount;
+                quint32 displacement[bucketCount];
+                struct { quint32 check; quint32 offset; } slots[slotCount];
+
+            The upper half of the key hash selects the bucket, the lower
+            half and the displacement of the bucket select the slot. The
+            lower half is stored as check, so that keys which are not in
+            the file are rejected without looking at the message.
+        */
+        const quint32 bucketCount = read32(perfectHashArray);
+        const quint32 slotCount = read32(perfectHashArray + 4);
+        const uchar *slotArray = perfectHashArray + 8 + 4 * bucketCount;
+        for (;;) {
+            const quint32 lo = quint32(hash);
+            const quint32 hi = quint32(hash >> 32);
+            const quint32 d = read32(perfectHashArray + 8 + 4 * (hi % bucketCount));
+            const quint32 slot = quint32((quint64(lo) + quint64(d) * ((hi >> 1) | 1)) % slotCount);
+            const uchar *s = slotArray + 8 * slot;
+            const quint32 ro = read32(s + 4);
+            if (read32(s) == lo && ro < messageLength) {
+                QString tn = getMessage(messageArray + ro, messageArray + messageLength, context,
+                                        sourceText, comment, numerus);
+                if (!tn.isNull())
+                    return tn;
+            }
+            if (!comment[0])
+                break;
+            comment = "";
+            hash = keyHash(context, sourceText, comment);
+        }
+        goto searchDependencies;
+    }
+
     /*
         Check if the context belongs to this QTranslator. If many
         translators are installed, this step is necessary.
@@ -1008,9 +1151,6 @@ QString QTranslatorPrivate::do_translate(const char *context, const char *source
     if (!numItems)
         goto searchDependencies;
 
-    if (n >= 0)
-        numerus = numerusHelper(n, numerusRulesArray, numerusRulesLength);
-
     for (;;) {
         quint32 h = 0;
         elfHash_continue(sourceText, h);
@@ -1092,14 +1232,21 @@ void QTranslatorPrivate::clear()
     contextArray = 0;
     offsetArray = 0;
     numerusRulesArray = 0;
+    perfectHashArray = 0;
     messageLength = 0;
     contextLength = 0;
     offsetLength = 0;
     numerusRulesLength = 0;
+    perfectHashLength = 0;
 
     qDeleteAll(subTranslators);
     subTranslators.clear();
 
+    {
+        QMutexLocker locker(&cacheMutex);
+        cache.clear();
+    }
+
     if (QCoreApplicationPrivate::isTranslatorInstalled(q))
         QCoreApplication::postEvent(QCoreApplication::instance(),
                                     new QEvent(QEvent::LanguageChange));
@@ -2793,6 +2793,9 @@ inline T qNumVariantToHelper(const QVariant::Private &d,
         return val;
 
     T ret = 0;
+    if (QtPrivate::QVariantArithmetic<T>::convert(d, &ret))
+        return ret;
+
     if ((d.type >= QMetaType::User || t >= QMetaType::User)
         && QMetaType::convert(constData(d), d.type, &ret, t))
         return ret;
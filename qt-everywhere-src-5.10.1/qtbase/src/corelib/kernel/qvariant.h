@@ -688,11 +688,91 @@ public:
 
 #ifndef QT_MOC
 namespace QtPrivate {
+    // Conversions between the builtin arithmetic types are done inline,
+    // following the same rules as the out-of-line handler in qvariant.cpp:
+    // floating point values are rounded when converted to an integral type.
+    template<typename T, bool = std::is_floating_point<T>::value>
+    struct QVariantArithmeticCast
+    {
+        template<typename S> static T fromIntegral(S v) { return static_cast<T>(v); }
+        static T fromFloating(float v) { return static_cast<T>(qRound64(v)); }
+        static T fromFloating(double v) { return static_cast<T>(qRound64(v)); }
+    };
+
+    template<typename T>
+    struct QVariantArithmeticCast<T, true>
+    {
+        template<typename S> static T fromIntegral(S v) { return static_cast<T>(v); }
+        template<typename S> static T fromFloating(S v) { return static_cast<T>(v); }
+    };
+
+    template<>
+    struct QVariantArithmeticCast<bool, false>
+    {
+        template<typename S> static bool fromIntegral(S v) { return v != 0; }
+        static bool fromFloating(float v) { return qRound64(v) != 0; }
+        static bool fromFloating(double v) { return qRound64(v) != 0; }
+    };
+
+    template<typename T>
+    struct QVariantArithmeticConverter
+    {
+        enum { IsSupported = true };
+        static bool convert(const QVariant::Private &d, T *result)
+        {
+            typedef QVariantArithmeticCast<T> Cast;
+            switch (d.type) {
+            case QMetaType::Bool:
+                *result = Cast::fromIntegral(d.data.b);
+                return true;
+            case QMetaType::Int:
+                *result = Cast::fromIntegral(d.data.i);
+                return true;
+            case QMetaType::UInt:
+                *result = Cast::fromIntegral(d.data.u);
+                return true;
+            case QMetaType::LongLong:
+                *result = Cast::fromIntegral(d.data.ll);
+                return true;
+            case QMetaType::ULongLong:
+                *result = Cast::fromIntegral(d.data.ull);
+                return true;
+            case QMetaType::Double:
+                *result = Cast::fromFloating(d.data.d);
+                return true;
+            case QMetaType::Float:
+                *result = Cast::fromFloating(d.data.f);
+                return true;
+            default:
+                return false;
+            }
+        }
+    };
+
+    template<typename T>
+    struct QVariantArithmetic
+    {
+        enum { IsSupported = false };
+        static bool convert(const QVariant::Private &, T *) { return false; }
+    };
+    template<> struct QVariantArithmetic<bool> : QVariantArithmeticConverter<bool> {};
+    template<> struct QVariantArithmetic<int> : QVariantArithmeticConverter<int> {};
+    template<> struct QVariantArithmetic<uint> : QVariantArithmeticConverter<uint> {};
+    template<> struct QVariantArithmetic<qlonglong> : QVariantArithmeticConverter<qlonglong> {};
+    template<> struct QVariantArithmetic<qulonglong> : QVariantArithmeticConverter<qulonglong> {};
+    template<> struct QVariantArithmetic<double> : QVariantArithmeticConverter<double> {};
+    template<> struct QVariantArithmetic<float> : QVariantArithmeticConverter<float> {};
+
     template<typename T>
     struct QVariantValueHelper : TreatAsQObjectBeforeMetaType<QVariantValueHelper<T>, T, const QVariant &, T>
     {
         static T metaType(const QVariant &v)
         {
+            if (QVariantArithmetic<T>::IsSupported) {
+                T t;
+                if (QVariantArithmetic<T>::convert(v.d, &t))
+                    return t;
+            }
             const int vid = qMetaTypeId<T>();
             if (vid == v.userType())
                 return *reinterpret_cast<const T *>(v.constData());
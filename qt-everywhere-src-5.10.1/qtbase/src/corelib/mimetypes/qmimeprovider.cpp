@@ -54,6 +54,8 @@
 #include <QDateTime>
 #include <QtEndian>
 
+#include <algorithm>
+
 static void initResources()
 {
     Q_INIT_RESOURCE(mimetypes);
@@ -740,18 +742,18 @@ QMimeType QMimeXMLProvider::findByMagic(const QByteArray &data, int *accuracyPtr
 {
     ensureLoaded();
 
-    QString candidate;
-
+    // The matchers are sorted by descending priority (see ensureLoaded()), so the
+    // first one that matches wins, and none after a lower priority one can.
     for (const QMimeMagicRuleMatcher &matcher : qAsConst(m_magicMatchers)) {
+        const int priority = matcher.priority();
+        if (priority <= *accuracyPtr)
+            break;
         if (matcher.matches(data)) {
-            const int priority = matcher.priority();
-            if (priority > *accuracyPtr) {
-                *accuracyPtr = priority;
-                candidate = matcher.mimetype();
-            }
+            *accuracyPtr = priority;
+            return mimeTypeForName(matcher.mimetype());
         }
     }
-    return mimeTypeForName(candidate);
+    return QMimeType();
 }
 
 void QMimeXMLProvider::ensureLoaded()
@@ -793,6 +795,12 @@ void QMimeXMLProvider::ensureLoaded()
 
         for (const QString &file : qAsConst(allFiles))
             load(file);
+
+        // Stable, so that matchers of equal priority keep the order of the files
+        std::stable_sort(m_magicMatchers.begin(), m_magicMatchers.end(),
+                         [](const QMimeMagicRuleMatcher &lhs, const QMimeMagicRuleMatcher &rhs) {
+            return lhs.priority() > rhs.priority();
+        });
     }
 }
 
@@ -808,7 +816,8 @@ bool QMimeXMLProvider::load(const QString &fileName, QString *errorMessage)
     m_loaded = true;
 
     QFile file(fileName);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    // No QIODevice::Text: QXmlStreamReader normalizes line endings itself
+    if (!file.open(QIODevice::ReadOnly)) {
         if (errorMessage)
             *errorMessage = QLatin1String("Cannot open ") + fileName + QLatin1String(": ") + file.errorString();
         return false;
@@ -53,6 +53,12 @@
 #include "qjsonvalue.h"
 #include "qjsonobject.h"
 #include "qjsonarray.h"
+#include "qcryptographichash.h"
+#include "qdatastream.h"
+#include "qsavefile.h"
+#include "qstandardpaths.h"
+
+#include "qplatformdefs.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -88,6 +94,147 @@ QFactoryLoaderPrivate::~QFactoryLoaderPrivate()
     }
 }
 
+/*
+    Remembers the meta data of the plugins found in one plugin directory across
+    application runs, so that the plugin files do not have to be scanned for their
+    meta data every time. An entry is only used while the size, modification time
+    and (on Unix) the inode of the plugin file are unchanged. Setting the
+    QT_DISABLE_PLUGIN_METADATA_CACHE environment variable disables the cache.
+*/
+class QPluginMetaDataCache
+{
+public:
+    explicit QPluginMetaDataCache(const QString &path);
+
+    QJsonObject lookup(const QString &fileName, const QFileInfo &info);
+    void insert(const QString &fileName, const QFileInfo &info, const QJsonObject &metaData);
+    void save();
+
+private:
+    struct Entry
+    {
+        qint64 size;
+        qint64 lastModified;
+        quint64 inode;
+        QByteArray metaData;
+    };
+    static Entry stamp(const QFileInfo &info);
+
+    QString cacheFile;
+    QHash<QString, Entry> entries;      // as read from the cache file
+    QHash<QString, Entry> seenEntries;  // plugins currently in the directory
+    bool dirty;
+};
+
+enum { PluginMetaDataCacheMagic = 0x51504d43 }; // "QPMC"
+
+QPluginMetaDataCache::QPluginMetaDataCache(const QString &path)
+    : dirty(false)
+{
+#if !defined(QT_NO_STANDARDPATHS) && QT_CONFIG(temporaryfile)
+    static const bool disabled = qEnvironmentVariableIsSet("QT_DISABLE_PLUGIN_METADATA_CACHE");
+    if (disabled)
+        return;
+
+    const QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+    if (cacheDir.isEmpty())
+        return;
+    const QByteArray pathHash = QCryptographicHash::hash(path.toUtf8(), QCryptographicHash::Sha1).toHex();
+    cacheFile = cacheDir + QLatin1String("/qtplugincache/") + QLatin1String(pathHash)
+            + QLatin1String(".cache");
+
+    QFile file(cacheFile);
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+
+    QDataStream stream(&file);
+    quint32 magic, qtVersion, count;
+    stream >> magic >> qtVersion;
+    if (magic != PluginMetaDataCacheMagic || qtVersion != QT_VERSION)
+        return;
+    stream.setVersion(QDataStream::Qt_5_10);
+    stream >> count;
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QString fileName;
+        Entry entry;
+        stream >> fileName >> entry.size >> entry.lastModified >> entry.inode >> entry.metaData;
+        entries.insert(fileName, entry);
+    }
+    if (stream.status() != QDataStream::Ok)
+        entries.clear();
+#else
+    Q_UNUSED(path);
+#endif
+}
+
+QPluginMetaDataCache::Entry QPluginMetaDataCache::stamp(const QFileInfo &info)
+{
+    Entry entry;
+    entry.size = info.size();
+    entry.lastModified = info.lastModified().toMSecsSinceEpoch();
+    entry.inode = 0;
+#ifdef Q_OS_UNIX
+    QT_STATBUF st;
+    if (QT_STAT(QFile::encodeName(info.filePath()).constData(), &st) == 0)
+        entry.inode = st.st_ino;
+#endif
+    return entry;
+}
+
+QJsonObject QPluginMetaDataCache::lookup(const QString &fileName, const QFileInfo &info)
+{
+    const auto it = entries.constFind(fileName);
+    if (it == entries.constEnd())
+        return QJsonObject();
+
+    const Entry current = stamp(info);
+    if (it->size != current.size || it->lastModified != current.lastModified
+            || it->inode != current.inode) {
+        return QJsonObject();
+    }
+
+    const QJsonObject metaData = QJsonDocument::fromBinaryData(it->metaData).object();
+    if (!metaData.isEmpty())
+        seenEntries.insert(fileName, *it);
+    return metaData;
+}
+
+void QPluginMetaDataCache::insert(const QString &fileName, const QFileInfo &info, const QJsonObject &metaData)
+{
+    if (cacheFile.isEmpty())
+        return;
+
+    Entry entry = stamp(info);
+    entry.metaData = QJsonDocument(metaData).toBinaryData();
+    seenEntries.insert(fileName, entry);
+    dirty = true;
+}
+
+void QPluginMetaDataCache::save()
+{
+#if !defined(QT_NO_STANDARDPATHS) && QT_CONFIG(temporaryfile)
+    // also rewrite the cache when plugins were removed from the directory
+    if (cacheFile.isEmpty() || (!dirty && seenEntries.size() == entries.size()))
+        return;
+
+    if (!QDir().mkpath(QFileInfo(cacheFile).path()))
+        return;
+
+    QSaveFile file(cacheFile);
+    if (!file.open(QIODevice::WriteOnly))
+        return;
+
+    QDataStream stream(&file);
+    stream << quint32(PluginMetaDataCacheMagic) << quint32(QT_VERSION);
+    stream.setVersion(QDataStream::Qt_5_10);
+    stream << quint32(seenEntries.size());
+    for (auto it = seenEntries.cbegin(), end = seenEntries.cend(); it != end; ++it)
+        stream << it.key() << it->size << it->lastModified << it->inode << it->metaData;
+    if (!file.commit() && qt_debug_component())
+        qDebug() << "QFactoryLoader: could not write plugin meta data cache" << cacheFile;
+#endif
+}
+
 void QFactoryLoader::update()
 {
 #ifdef QT_SHARED
@@ -114,6 +261,7 @@ void QFactoryLoader::update()
 #endif
                     QDir::Files);
         QLibraryPrivate *library = 0;
+        QPluginMetaDataCache metaDataCache(path);
 
 #ifdef Q_OS_MAC
         // Loading both the debug and release version of the cocoa plugins causes the objective-c runtime
@@ -142,7 +290,14 @@ void QFactoryLoader::update()
             if (qt_debug_component()) {
                 qDebug() << "QFactoryLoader::QFactoryLoader() looking at" << fileName;
             }
-            library = QLibraryPrivate::findOrCreate(QFileInfo(fileName).canonicalFilePath());
+            const QFileInfo fileInfo(fileName);
+            library = QLibraryPrivate::findOrCreate(fileInfo.canonicalFilePath());
+            const QJsonObject cachedMetaData = metaDataCache.lookup(plugins.at(j), fileInfo);
+            if (!cachedMetaData.isEmpty()) {
+                if (qt_debug_component())
+                    qDebug() << "QFactoryLoader::QFactoryLoader() using cached meta data";
+                library->setPluginMetaData(cachedMetaData);
+            }
             if (!library->isPlugin()) {
                 if (qt_debug_component()) {
                     qDebug() << library->errorString << endl
@@ -151,6 +306,8 @@ void QFactoryLoader::update()
                 library->release();
                 continue;
             }
+            if (cachedMetaData.isEmpty())
+                metaDataCache.insert(plugins.at(j), fileInfo, library->metaData);
 
             QStringList keys;
             bool metaDataOk = false;
@@ -198,6 +355,7 @@ void QFactoryLoader::update()
                 library->release();
             }
         }
+        metaDataCache.save();
     }
 #else
     Q_D(QFactoryLoader);
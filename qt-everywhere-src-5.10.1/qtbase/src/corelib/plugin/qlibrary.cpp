@@ -750,6 +750,25 @@ void QLibraryPrivate::updatePluginState()
         return;
     }
 
+    verifyPluginMetaData();
+}
+
+/*
+    Uses \a cachedMetaData, previously extracted from the same file, as the
+    plugin meta data instead of scanning the file for it.
+*/
+void QLibraryPrivate::setPluginMetaData(const QJsonObject &cachedMetaData)
+{
+    if (pluginState != MightBeAPlugin || pHnd)
+        return;
+
+    errorString.clear();
+    metaData = cachedMetaData;
+    verifyPluginMetaData();
+}
+
+void QLibraryPrivate::verifyPluginMetaData()
+{
     pluginState = IsNotAPlugin; // be pessimistic
 
     uint qt_version = (uint)metaData.value(QLatin1String("version")).toDouble();
@@ -107,12 +107,14 @@ public:
     QString errorString;
 
     void updatePluginState();
+    void setPluginMetaData(const QJsonObject &cachedMetaData);
     bool isPlugin();
 
 private:
     explicit QLibraryPrivate(const QString &canonicalFileName, const QString &version, QLibrary::LoadHints loadHints);
     ~QLibraryPrivate();
     void mergeLoadHints(QLibrary::LoadHints loadHints);
+    void verifyPluginMetaData();
 
     bool load_sys();
     bool unload_sys();
@@ -46,6 +46,10 @@
 
 #include <QtCore/qfutureinterface.h>
 #include <QtCore/qstring.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qsharedpointer.h>
+#include <QtCore/qthreadpool.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -55,6 +59,177 @@ class QFutureWatcher;
 template <>
 class QFutureWatcher<void>;
 
+namespace QtPrivate {
+
+struct FutureAccess
+{
+    template <typename T>
+    static QFutureInterfaceBase &get(const QFuture<T> &future) { return future.d; }
+};
+
+template <typename T, typename Function>
+struct ContinuationResult
+{
+    typedef decltype(std::declval<Function &>()(std::declval<const T &>())) Type;
+};
+
+template <typename Function>
+struct ContinuationResult<void, Function>
+{
+    typedef decltype(std::declval<Function &>()()) Type;
+};
+
+// What a continuation reads its input from. For a typed future it keeps
+// the results alive until the continuation has run.
+template <typename T>
+struct ContinuationInput
+{
+    typedef QFutureInterface<T> Type;
+    static bool hasResult(const Type &input) { return input.isResultReadyAt(0); }
+};
+
+template <>
+struct ContinuationInput<void>
+{
+    typedef QFutureInterfaceBase Type;
+    static bool hasResult(const Type &) { return true; }
+};
+
+template <typename T, typename R>
+struct ContinuationInvoker
+{
+    template <typename Function>
+    static void invoke(QFutureInterface<T> &input, QFutureInterface<R> &output, Function &function)
+    { output.reportResult(function(input.resultReference(0))); }
+};
+
+template <typename T>
+struct ContinuationInvoker<T, void>
+{
+    template <typename Function>
+    static void invoke(QFutureInterface<T> &input, QFutureInterface<void> &, Function &function)
+    { function(input.resultReference(0)); }
+};
+
+template <typename R>
+struct ContinuationInvoker<void, R>
+{
+    template <typename Function>
+    static void invoke(QFutureInterfaceBase &, QFutureInterface<R> &output, Function &function)
+    { output.reportResult(function()); }
+};
+
+template <>
+struct ContinuationInvoker<void, void>
+{
+    template <typename Function>
+    static void invoke(QFutureInterfaceBase &, QFutureInterface<void> &, Function &function)
+    { function(); }
+};
+
+// Holds the interface of a future returned by then() or by a combinator.
+// If the continuation is dropped without running, because its context
+// object was destroyed, the future ends up canceled instead of pending.
+template <typename R>
+class ContinuationPromise
+{
+    Q_DISABLE_COPY(ContinuationPromise)
+public:
+    ContinuationPromise() { output.reportStarted(); }
+    ~ContinuationPromise()
+    {
+        if (!output.isFinished()) {
+            output.reportCanceled();
+            output.reportFinished();
+        }
+    }
+
+    QFutureInterface<R> output;
+};
+
+template <typename T, typename R, typename Function>
+void runContinuation(typename ContinuationInput<T>::Type &input, QFutureInterface<R> &output,
+                     Function &function)
+{
+    if (input.isCanceled() || !ContinuationInput<T>::hasResult(input)) {
+#ifndef QT_NO_EXCEPTIONS
+        if (input.exceptionStore().hasException())
+            output.reportException(*input.exceptionStore().exception().exception());
+        else
+#endif
+            output.reportCanceled();
+        output.reportFinished();
+        return;
+    }
+#ifndef QT_NO_EXCEPTIONS
+    try {
+#endif
+        ContinuationInvoker<T, R>::invoke(input, output, function);
+#ifndef QT_NO_EXCEPTIONS
+    } catch (QException &e) {
+        output.reportException(e);
+    } catch (...) {
+        output.reportException(QUnhandledException());
+    }
+#endif
+    output.reportFinished();
+}
+
+// Executors decide where a continuation runs once its input has finished.
+struct InlineExecutor
+{
+    template <typename Job>
+    void execute(Job job) const { job(); }
+};
+
+template <typename Job>
+class ContinuationRunnable : public QRunnable
+{
+public:
+    explicit ContinuationRunnable(const Job &job) : job(job) { }
+    void run() Q_DECL_OVERRIDE { job(); }
+
+private:
+    Job job;
+};
+
+struct ThreadPoolExecutor
+{
+    QThreadPool *pool;
+
+    template <typename Job>
+    void execute(const Job &job) const { pool->start(new ContinuationRunnable<Job>(job)); }
+};
+
+struct ContextExecutor
+{
+    QPointer<QObject> context;
+
+    template <typename Job>
+    void execute(const Job &job) const
+    {
+        if (context)
+            QMetaObject::invokeMethod(context.data(), job, Qt::QueuedConnection);
+    }
+};
+
+template <typename T, typename Function, typename Executor>
+QFuture<typename ContinuationResult<T, Function>::Type>
+continueWith(QFutureInterfaceBase &input, const Executor &executor, const Function &function)
+{
+    typedef typename ContinuationResult<T, Function>::Type R;
+    QSharedPointer<ContinuationPromise<R> > promise(new ContinuationPromise<R>);
+    input.addContinuation([promise, executor, function](QFutureInterfaceBase &finished) {
+        typename ContinuationInput<T>::Type finishedInput(finished);
+        executor.execute([promise, finishedInput, function]() mutable {
+            runContinuation<T>(finishedInput, promise->output, function);
+        });
+    });
+    return promise->output.future();
+}
+
+} // namespace QtPrivate
+
 template <typename T>
 class QFuture
 {
@@ -96,6 +271,26 @@ public:
     operator T() const { return result(); }
     QList<T> results() const { return d.results(); }
 
+    template <typename Function>
+    QFuture<typename QtPrivate::ContinuationResult<T, Function>::Type> then(Function function)
+    {
+        return QtPrivate::continueWith<T>(d, QtPrivate::InlineExecutor(), function);
+    }
+
+    template <typename Function>
+    QFuture<typename QtPrivate::ContinuationResult<T, Function>::Type> then(QThreadPool *pool, Function function)
+    {
+        const QtPrivate::ThreadPoolExecutor executor = { pool ? pool : QThreadPool::globalInstance() };
+        return QtPrivate::continueWith<T>(d, executor, function);
+    }
+
+    template <typename Function>
+    QFuture<typename QtPrivate::ContinuationResult<T, Function>::Type> then(QObject *context, Function function)
+    {
+        const QtPrivate::ContextExecutor executor = { context };
+        return QtPrivate::continueWith<T>(d, executor, function);
+    }
+
     class const_iterator
     {
     public:
@@ -220,8 +415,29 @@ public:
     QString progressText() const { return d.progressText(); }
     void waitForFinished() { d.waitForFinished(); }
 
+    template <typename Function>
+    QFuture<typename QtPrivate::ContinuationResult<void, Function>::Type> then(Function function)
+    {
+        return QtPrivate::continueWith<void>(d, QtPrivate::InlineExecutor(), function);
+    }
+
+    template <typename Function>
+    QFuture<typename QtPrivate::ContinuationResult<void, Function>::Type> then(QThreadPool *pool, Function function)
+    {
+        const QtPrivate::ThreadPoolExecutor executor = { pool ? pool : QThreadPool::globalInstance() };
+        return QtPrivate::continueWith<void>(d, executor, function);
+    }
+
+    template <typename Function>
+    QFuture<typename QtPrivate::ContinuationResult<void, Function>::Type> then(QObject *context, Function function)
+    {
+        const QtPrivate::ContextExecutor executor = { context };
+        return QtPrivate::continueWith<void>(d, executor, function);
+    }
+
 private:
     friend class QFutureWatcher<void>;
+    friend struct QtPrivate::FutureAccess;
 
 #ifdef QFUTURE_TEST
 public:
@@ -240,6 +456,93 @@ QFuture<void> qToVoidFuture(const QFuture<T> &future)
     return QFuture<void>(future.d);
 }
 
+namespace QtFuture {
+
+template <typename T>
+struct WhenAnyResult
+{
+    int index;
+    QFuture<T> future;
+};
+
+} // namespace QtFuture
+
+namespace QtPrivate {
+
+template <typename T>
+struct WhenAllState : ContinuationPromise<QList<QFuture<T> > >
+{
+    QList<QFuture<T> > futures;
+    QAtomicInt remaining;
+
+    void arrive()
+    {
+        if (!remaining.deref()) {
+            this->output.reportResult(futures);
+            this->output.reportFinished();
+            futures.clear();
+        }
+    }
+};
+
+template <typename T>
+struct WhenAnyState : ContinuationPromise<QtFuture::WhenAnyResult<T> >
+{
+    QList<QFuture<T> > futures;
+    QAtomicInt done;
+
+    void arrive(int index)
+    {
+        if (done.testAndSetOrdered(0, 1)) {
+            const QtFuture::WhenAnyResult<T> result = { index, futures.at(index) };
+            this->output.reportResult(result);
+            this->output.reportFinished();
+            futures.clear();
+        }
+    }
+};
+
+} // namespace QtPrivate
+
+namespace QtFuture {
+
+template <typename T>
+QFuture<QList<QFuture<T> > > whenAll(const QList<QFuture<T> > &futures)
+{
+    QSharedPointer<QtPrivate::WhenAllState<T> > state(new QtPrivate::WhenAllState<T>);
+    state->futures = futures;
+    // one extra count so that the result is not reported while registering
+    state->remaining.store(futures.size() + 1);
+    QFuture<QList<QFuture<T> > > result = state->output.future();
+    for (int i = 0; i < futures.size(); ++i)
+        QtPrivate::FutureAccess::get(futures.at(i)).addContinuation([state](QFutureInterfaceBase &) {
+            state->arrive();
+        });
+    state->arrive();
+    return result;
+}
+
+template <typename T>
+QFuture<WhenAnyResult<T> > whenAny(const QList<QFuture<T> > &futures)
+{
+    QSharedPointer<QtPrivate::WhenAnyState<T> > state(new QtPrivate::WhenAnyState<T>);
+    QFuture<WhenAnyResult<T> > result = state->output.future();
+    if (futures.isEmpty()) {
+        const WhenAnyResult<T> none = { -1, QFuture<T>() };
+        state->output.reportResult(none);
+        state->output.reportFinished();
+        return result;
+    }
+    state->futures = futures;
+    for (int i = 0; i < futures.size(); ++i)
+        QtPrivate::FutureAccess::get(futures.at(i)).addContinuation([state, i](QFutureInterfaceBase &) {
+            state->arrive(i);
+        });
+    return result;
+}
+
+} // namespace QtFuture
+
 QT_END_NAMESPACE
 
 #endif // QT_NO_QFUTURE
@@ -293,7 +293,33 @@ void QFutureInterfaceBase::reportFinished()
         switch_from_to(d->state, Running, Finished);
         d->waitCondition.wakeAll();
         d->sendCallOut(QFutureCallOutEvent(QFutureCallOutEvent::Finished));
+
+        if (!d->continuations.isEmpty()) {
+            QVector<std::function<void(QFutureInterfaceBase &)> > continuations;
+            continuations.swap(d->continuations);
+            locker.unlock();
+            for (int i = 0; i < continuations.size(); ++i)
+                continuations[i](*this);
+        }
+    }
+}
+
+/*!
+    \internal
+
+    Calls \a func once the future has finished, from the thread that reports
+    it finished, or right away if it already has. The continuations of
+    QFuture::then() and of the QtFuture combinators are built on this.
+*/
+void QFutureInterfaceBase::addContinuation(std::function<void(QFutureInterfaceBase &)> func)
+{
+    QMutexLocker locker(&d->m_mutex);
+    if (!isFinished()) {
+        d->continuations.append(std::move(func));
+        return;
     }
+    locker.unlock();
+    func(*this);
 }
 
 void QFutureInterfaceBase::setExpectedResultCount(int resultCount)
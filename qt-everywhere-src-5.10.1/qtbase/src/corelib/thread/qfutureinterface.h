@@ -48,6 +48,8 @@
 #include <QtCore/qexception.h>
 #include <QtCore/qresultstore.h>
 
+#include <functional>
+
 QT_BEGIN_NAMESPACE
 
 
@@ -127,6 +129,8 @@ public:
     inline bool operator!=(const QFutureInterfaceBase &other) const { return d != other.d; }
     QFutureInterfaceBase &operator=(const QFutureInterfaceBase &other);
 
+    void addContinuation(std::function<void(QFutureInterfaceBase &)> func); // internal
+
 protected:
     bool refT() const;
     bool derefT() const;
@@ -156,6 +160,11 @@ public:
     {
         refT();
     }
+    explicit QFutureInterface(const QFutureInterfaceBase &other) // internal
+        : QFutureInterfaceBase(other)
+    {
+        refT();
+    }
     ~QFutureInterface()
     {
         if (!derefT())
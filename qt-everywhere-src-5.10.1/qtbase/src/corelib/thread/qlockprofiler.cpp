@@ -0,0 +1,430 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qlockprofiler_p.h"
+
+#ifndef QT_NO_THREAD
+#include "qelapsedtimer.h"
+#include "qhash.h"
+#include "qloggingcategory.h"
+#include "qmutex.h"
+
+#include <algorithm>
+#include <stdlib.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_LOGGING_CATEGORY(lcLockProfiler, "qt.core.lockprofiler")
+
+/*!
+    \class QLockProfiler
+    \inmodule QtCore
+    \internal
+
+    \brief The QLockProfiler class records contention statistics for QMutex,
+    QBasicMutex and QReadWriteLock.
+
+    Profiling is off by default. It is switched on by setting the
+    \c QT_LOCK_PROFILING environment variable to a positive number \e N, or
+    by calling setSampleInterval(). Only the contended paths of the locks are
+    instrumented; the uncontended fast paths are untouched, and the contended
+    paths pay a single relaxed load while profiling is off.
+
+    Every contended acquisition is counted per lock site, i.e. per lock
+    object and calling address. One in \e N contended acquisitions per thread
+    is also timed: the time spent waiting for the lock, and the time the lock
+    is then held until it is released. Hold times are only measured when the
+    lock is released through QMutex::unlock(), QReadWriteLock::unlock(), or
+    the contended unlock path of QBasicMutex.
+
+    A contended acquisition is one that missed the lock-free fast path, which
+    includes a reader joining other readers of a QReadWriteLock. Recursive
+    QReadWriteLocks never take the fast path, so all their acquisitions are
+    counted; recursive QMutexes are accounted to their internal mutex.
+
+    Statistics are collected in per-thread buffers which are merged into a
+    global table every few hundred events, when flush() is called, and when
+    the thread exits. sites() and dump() show the merged table plus the
+    calling thread's own buffer. The caller addresses can be resolved with
+    tools like \c addr2line.
+
+    This class requires compiler support for \c thread_local; without it
+    profiling cannot be enabled.
+*/
+
+QBasicAtomicInt QLockProfiler::s_sampleInterval = Q_BASIC_ATOMIC_INITIALIZER(-1);
+
+#ifdef Q_COMPILER_THREAD_LOCAL
+namespace {
+struct SiteKey
+{
+    const void *lock;
+    const void *caller;
+    QLockProfiler::LockType type;
+};
+
+inline bool operator==(const SiteKey &lhs, const SiteKey &rhs)
+{
+    return lhs.lock == rhs.lock && lhs.caller == rhs.caller && lhs.type == rhs.type;
+}
+
+inline uint qHash(const SiteKey &key, uint seed = 0) Q_DECL_NOTHROW
+{
+    return QT_PREPEND_NAMESPACE(qHash)(quintptr(key.lock), seed)
+            ^ QT_PREPEND_NAMESPACE(qHash)(quintptr(key.caller), seed) ^ uint(key.type);
+}
+
+typedef QHash<SiteKey, QLockProfiler::Site> SiteHash;
+
+void merge(QLockProfiler::Site &into, const QLockProfiler::Site &from)
+{
+    into.contentions += from.contentions;
+    into.waitSamples += from.waitSamples;
+    into.totalWaitNSecs += from.totalWaitNSecs;
+    into.maxWaitNSecs = qMax(into.maxWaitNSecs, from.maxWaitNSecs);
+    into.holdSamples += from.holdSamples;
+    into.totalHoldNSecs += from.totalHoldNSecs;
+}
+
+struct Registry
+{
+    QMutex mutex;
+    SiteHash sites;
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(Registry, registry)
+
+namespace {
+
+struct ThreadState
+{
+    enum { FlushThreshold = 256, MaxPendingHolds = 8 };
+
+    struct PendingHold
+    {
+        SiteKey key;
+        qint64 start;
+    };
+
+    ThreadState() { clock.start(); }
+    ~ThreadState();
+
+    QLockProfiler::Site &site(const SiteKey &key)
+    {
+        SiteHash::iterator it = sites.find(key);
+        if (it == sites.end()) {
+            const QLockProfiler::Site site = { key.lock, key.caller, key.type, 0, 0, 0, 0, 0, 0 };
+            it = sites.insert(key, site);
+        }
+        return it.value();
+    }
+
+    void flush();
+
+    QElapsedTimer clock;
+    SiteHash sites;
+    PendingHold holds[MaxPendingHolds];
+    int holdCount = 0;
+    uint contentionCounter = 0;
+    int eventsSinceFlush = 0;
+    // set while inside a Contention or the profiler itself, so that the
+    // locks taken by the profiler are not recorded
+    bool active = false;
+};
+
+static thread_local ThreadState threadState;
+static thread_local bool threadStateDestroyed = false;
+
+ThreadState::~ThreadState()
+{
+    flush();
+    threadStateDestroyed = true;
+}
+
+void ThreadState::flush()
+{
+    eventsSinceFlush = 0;
+    if (sites.isEmpty())
+        return;
+    Registry *r = registry();
+    if (!r)
+        return;
+
+    const bool wasActive = active;
+    active = true;
+    {
+        QMutexLocker locker(&r->mutex);
+        for (SiteHash::const_iterator it = sites.cbegin(), end = sites.cend(); it != end; ++it) {
+            SiteHash::iterator target = r->sites.find(it.key());
+            if (target == r->sites.end())
+                r->sites.insert(it.key(), it.value());
+            else
+                merge(target.value(), it.value());
+        }
+    }
+    sites.clear();
+    active = wasActive;
+}
+
+inline ThreadState *currentThreadState()
+{
+    return threadStateDestroyed ? nullptr : &threadState;
+}
+} // unnamed namespace
+#endif // Q_COMPILER_THREAD_LOCAL
+
+/*!
+    \internal
+
+    Reads the sample interval from the \c QT_LOCK_PROFILING environment
+    variable the first time profiling is queried. qgetenv() is avoided on
+    purpose, since it takes a lock itself.
+*/
+bool QLockProfiler::initialize() Q_DECL_NOTHROW
+{
+    int interval = 0;
+#ifdef Q_COMPILER_THREAD_LOCAL
+    if (const char *env = ::getenv("QT_LOCK_PROFILING"))
+        interval = qMax(0, atoi(env));
+#endif
+    s_sampleInterval.testAndSetRelaxed(-1, interval);
+    return s_sampleInterval.load() > 0;
+}
+
+/*!
+    \internal
+
+    Enables profiling and times one in \a interval contended acquisitions per
+    thread. An \a interval of 0 disables profiling.
+*/
+void QLockProfiler::setSampleInterval(int interval)
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    s_sampleInterval.store(qMax(0, interval));
+#else
+    Q_UNUSED(interval);
+    s_sampleInterval.store(0);
+#endif
+}
+
+/*!
+    \internal
+
+    Returns the current sample interval, or 0 if profiling is disabled.
+*/
+int QLockProfiler::sampleInterval()
+{
+    return isEnabled() ? s_sampleInterval.load() : 0;
+}
+
+void QLockProfiler::Contention::begin(const void *lock, LockType type, const void *caller) Q_DECL_NOTHROW
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    ThreadState *state = currentThreadState();
+    if (!state || state->active)
+        return;
+    state->active = true;
+    m_lock = lock;
+    m_caller = caller;
+    m_type = type;
+    const int interval = s_sampleInterval.load();
+    if (interval > 0 && ++state->contentionCounter % uint(interval) == 0)
+        m_start = state->clock.nsecsElapsed();
+    else
+        m_start = -1;
+#else
+    Q_UNUSED(lock);
+    Q_UNUSED(type);
+    Q_UNUSED(caller);
+#endif
+}
+
+void QLockProfiler::Contention::end(bool acquired) Q_DECL_NOTHROW
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    ThreadState *state = currentThreadState();
+    const SiteKey key = { m_lock, m_caller, m_type };
+    Site &site = state->site(key);
+    ++site.contentions;
+    if (m_start >= 0) {
+        const qint64 now = state->clock.nsecsElapsed();
+        const qint64 wait = now - m_start;
+        ++site.waitSamples;
+        site.totalWaitNSecs += wait;
+        site.maxWaitNSecs = qMax(site.maxWaitNSecs, wait);
+        if (acquired && state->holdCount < ThreadState::MaxPendingHolds) {
+            const ThreadState::PendingHold hold = { key, now };
+            state->holds[state->holdCount++] = hold;
+        }
+    }
+    m_lock = nullptr;
+
+    if (++state->eventsSinceFlush >= ThreadState::FlushThreshold)
+        state->flush();
+    state->active = false;
+#else
+    Q_UNUSED(acquired);
+#endif
+}
+
+void QLockProfiler::recordRelease(const void *lock) Q_DECL_NOTHROW
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    ThreadState *state = currentThreadState();
+    if (!state || !state->holdCount || state->active)
+        return;
+    for (int i = state->holdCount - 1; i >= 0; --i) {
+        if (state->holds[i].key.lock != lock)
+            continue;
+        Site &site = state->site(state->holds[i].key);
+        ++site.holdSamples;
+        site.totalHoldNSecs += state->clock.nsecsElapsed() - state->holds[i].start;
+        state->holds[i] = state->holds[--state->holdCount];
+        return;
+    }
+#else
+    Q_UNUSED(lock);
+#endif
+}
+
+/*!
+    \internal
+
+    Merges the calling thread's buffer into the global table.
+*/
+void QLockProfiler::flush()
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    if (ThreadState *state = currentThreadState())
+        state->flush();
+#endif
+}
+
+/*!
+    \internal
+
+    Returns the statistics collected so far, including the calling thread's
+    buffer but not the unflushed buffers of other threads.
+*/
+QVector<QLockProfiler::Site> QLockProfiler::sites()
+{
+    QVector<Site> result;
+#ifdef Q_COMPILER_THREAD_LOCAL
+    flush();
+    if (Registry *r = registry()) {
+        ThreadState *state = currentThreadState();
+        const bool wasActive = state && state->active;
+        if (state)
+            state->active = true;
+        {
+            QMutexLocker locker(&r->mutex);
+            result.reserve(r->sites.size());
+            for (const Site &site : qAsConst(r->sites))
+                result.append(site);
+        }
+        if (state)
+            state->active = wasActive;
+    }
+#endif
+    return result;
+}
+
+/*!
+    \internal
+
+    Discards the statistics of the global table and of the calling thread.
+*/
+void QLockProfiler::reset()
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    ThreadState *state = currentThreadState();
+    if (state) {
+        state->sites.clear();
+        state->holdCount = 0;
+    }
+    if (Registry *r = registry()) {
+        const bool wasActive = state && state->active;
+        if (state)
+            state->active = true;
+        {
+            QMutexLocker locker(&r->mutex);
+            r->sites.clear();
+        }
+        if (state)
+            state->active = wasActive;
+    }
+#endif
+}
+
+/*!
+    \internal
+
+    Logs the \a maxSites lock sites with the highest total wait time to the
+    \c qt.core.lockprofiler logging category.
+*/
+void QLockProfiler::dump(int maxSites)
+{
+    QVector<Site> all = sites();
+    std::sort(all.begin(), all.end(), [](const Site &lhs, const Site &rhs) {
+        if (lhs.totalWaitNSecs != rhs.totalWaitNSecs)
+            return lhs.totalWaitNSecs > rhs.totalWaitNSecs;
+        return lhs.contentions > rhs.contentions;
+    });
+    if (maxSites >= 0 && all.size() > maxSites)
+        all.resize(maxSites);
+
+    static const char *const typeNames[] = { "mutex", "read lock", "write lock" };
+    qCInfo(lcLockProfiler, "%d contended lock sites (sample interval %d)",
+           all.size(), sampleInterval());
+    for (const Site &site : qAsConst(all)) {
+        qCInfo(lcLockProfiler,
+               "%s %p from %p: %llu contentions, wait avg %.1f us max %.1f us (%llu samples),"
+               " hold avg %.1f us (%llu samples)",
+               typeNames[site.type], site.lock, site.caller, site.contentions,
+               site.waitSamples ? site.totalWaitNSecs / 1000.0 / site.waitSamples : 0.0,
+               site.maxWaitNSecs / 1000.0, site.waitSamples,
+               site.holdSamples ? site.totalHoldNSecs / 1000.0 / site.holdSamples : 0.0,
+               site.holdSamples);
+    }
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
@@ -0,0 +1,157 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QLOCKPROFILER_P_H
+#define QLOCKPROFILER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of the implementation.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qatomic.h>
+#include <QtCore/qvector.h>
+
+#ifndef QT_NO_THREAD
+
+#if defined(Q_CC_GNU)
+#  define QT_LOCK_PROFILER_CALLER __builtin_return_address(0)
+#elif defined(Q_CC_MSVC)
+#  include <intrin.h>
+#  define QT_LOCK_PROFILER_CALLER _ReturnAddress()
+#else
+#  define QT_LOCK_PROFILER_CALLER nullptr
+#endif
+
+QT_BEGIN_NAMESPACE
+
+class Q_CORE_EXPORT QLockProfiler
+{
+public:
+    enum LockType {
+        Mutex,
+        ReadLock,
+        WriteLock
+    };
+
+    struct Site
+    {
+        const void *lock;
+        const void *caller;
+        LockType type;
+        quint64 contentions;
+        quint64 waitSamples;
+        qint64 totalWaitNSecs;
+        qint64 maxWaitNSecs;
+        quint64 holdSamples;
+        qint64 totalHoldNSecs;
+    };
+
+    // Placed on the contended path of a lock function. Only the outermost
+    // one on a thread records anything, so QMutex::lock() calling into
+    // QBasicMutex::lockInternal() is counted once.
+    class Contention
+    {
+    public:
+        Contention(const void *lock, LockType type, const void *caller) Q_DECL_NOTHROW
+            : m_lock(nullptr)
+        {
+            if (Q_UNLIKELY(isEnabled()))
+                begin(lock, type, caller);
+        }
+
+        bool finish(bool acquired) Q_DECL_NOTHROW
+        {
+            if (Q_UNLIKELY(m_lock))
+                end(acquired);
+            return acquired;
+        }
+
+    private:
+        Q_DISABLE_COPY(Contention)
+        void begin(const void *lock, LockType type, const void *caller) Q_DECL_NOTHROW;
+        void end(bool acquired) Q_DECL_NOTHROW;
+
+        const void *m_lock;
+        const void *m_caller;
+        LockType m_type;
+        qint64 m_start;
+    };
+
+    static bool isEnabled() Q_DECL_NOTHROW
+    {
+        const int interval = s_sampleInterval.load();
+        return interval > 0 || (Q_UNLIKELY(interval < 0) && initialize());
+    }
+
+    static void released(const void *lock) Q_DECL_NOTHROW
+    {
+        if (Q_UNLIKELY(isEnabled()))
+            recordRelease(lock);
+    }
+
+    static void setSampleInterval(int interval);
+    static int sampleInterval();
+
+    static void flush();
+    static QVector<Site> sites();
+    static void reset();
+    static void dump(int maxSites = 20);
+
+private:
+    static bool initialize() Q_DECL_NOTHROW;
+    static void recordRelease(const void *lock) Q_DECL_NOTHROW;
+
+    static QBasicAtomicInt s_sampleInterval;
+};
+
+Q_DECLARE_TYPEINFO(QLockProfiler::Site, Q_PRIMITIVE_TYPE);
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_THREAD
+
+#endif // QLOCKPROFILER_P_H
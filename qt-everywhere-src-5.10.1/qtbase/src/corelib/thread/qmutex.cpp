@@ -48,6 +48,7 @@
 #include "qelapsedtimer.h"
 #include "qthread.h"
 #include "qmutex_p.h"
+#include "qlockprofiler_p.h"
 
 #ifndef QT_LINUX_FUTEX
 #include "private/qfreelist_p.h"
@@ -223,10 +224,13 @@ void QMutex::lock() QT_MUTEX_LOCK_NOEXCEPT
     QMutexData *current;
     if (fastTryLock(current))
         return;
-    if (QT_PREPEND_NAMESPACE(isRecursive)(current))
+    if (QT_PREPEND_NAMESPACE(isRecursive)(current)) {
         static_cast<QRecursiveMutexPrivate *>(current)->lock(-1);
-    else
+    } else {
+        QLockProfiler::Contention contention(this, QLockProfiler::Mutex, QT_LOCK_PROFILER_CALLER);
         lockInternal();
+        contention.finish(true);
+    }
 }
 
 /*! \fn bool QMutex::tryLock(int timeout)
@@ -259,8 +263,9 @@ bool QMutex::tryLock(int timeout) QT_MUTEX_LOCK_NOEXCEPT
         return true;
     if (QT_PREPEND_NAMESPACE(isRecursive)(current))
         return static_cast<QRecursiveMutexPrivate *>(current)->lock(timeout);
-    else
-        return lockInternal(timeout);
+
+    QLockProfiler::Contention contention(this, QLockProfiler::Mutex, QT_LOCK_PROFILER_CALLER);
+    return contention.finish(lockInternal(timeout));
 }
 
 /*! \fn bool QMutex::try_lock()
@@ -333,6 +338,7 @@ bool QMutex::tryLock(int timeout) QT_MUTEX_LOCK_NOEXCEPT
 */
 void QMutex::unlock() Q_DECL_NOTHROW
 {
+    QLockProfiler::released(this);
     QMutexData *current;
     if (fastTryUnlock(current))
         return;
@@ -488,7 +494,9 @@ bool QBasicMutex::isRecursive() const Q_DECL_NOTHROW
  */
 void QBasicMutex::lockInternal() QT_MUTEX_LOCK_NOEXCEPT
 {
+    QLockProfiler::Contention contention(this, QLockProfiler::Mutex, QT_LOCK_PROFILER_CALLER);
     lockInternal(-1);
+    contention.finish(true);
 }
 
 /*!
@@ -604,6 +612,7 @@ bool QBasicMutex::lockInternal(int timeout) QT_MUTEX_LOCK_NOEXCEPT
 */
 void QBasicMutex::unlockInternal() Q_DECL_NOTHROW
 {
+    QLockProfiler::released(this);
     QMutexData *copy = d_ptr.loadAcquire();
     Q_ASSERT(copy); //we must be locked
     Q_ASSERT(copy != dummyLocked()); // testAndSetRelease(dummyLocked(), 0) failed
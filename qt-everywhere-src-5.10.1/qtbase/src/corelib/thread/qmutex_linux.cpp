@@ -45,6 +45,7 @@
 #include "qatomic.h"
 #include "qmutex_p.h"
 #include "qelapsedtimer.h"
+#include "qlockprofiler_p.h"
 
 #include <linux/futex.h>
 #include <sys/syscall.h>
@@ -175,7 +176,9 @@ bool lockInternal_helper(QBasicAtomicPointer<QMutexData> &d_ptr, int timeout = -
 void QBasicMutex::lockInternal() Q_DECL_NOTHROW
 {
     Q_ASSERT(!isRecursive());
+    QLockProfiler::Contention contention(this, QLockProfiler::Mutex, QT_LOCK_PROFILER_CALLER);
     lockInternal_helper<false>(d_ptr);
+    contention.finish(true);
 }
 
 bool QBasicMutex::lockInternal(int timeout) Q_DECL_NOTHROW
@@ -188,6 +191,7 @@ bool QBasicMutex::lockInternal(int timeout) Q_DECL_NOTHROW
 
 void QBasicMutex::unlockInternal() Q_DECL_NOTHROW
 {
+    QLockProfiler::released(this);
     QMutexData *d = d_ptr.load();
     Q_ASSERT(d); //we must be locked
     Q_ASSERT(d != dummyLocked()); // testAndSetRelease(dummyLocked(), 0) failed
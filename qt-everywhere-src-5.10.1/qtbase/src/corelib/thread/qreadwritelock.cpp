@@ -49,6 +49,8 @@
 #include "qreadwritelock_p.h"
 #include "qelapsedtimer.h"
 #include "private/qfreelist_p.h"
+#include "private/qlockprofiler_p.h"
+#include "private/qsimd_p.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -74,6 +76,46 @@ const auto dummyLockedForRead = reinterpret_cast<QReadWriteLockPrivate *>(quintp
 const auto dummyLockedForWrite = reinterpret_cast<QReadWriteLockPrivate *>(quintptr(StateLockedForWrite));
 inline bool isUncontendedLocked(const QReadWriteLockPrivate *d)
 { return quintptr(d) & StateMask; }
+
+/*
+ * Before escalating to a QReadWriteLockPrivate (and thus to a QMutex and a
+ * QWaitCondition), a thread that finds the lock held in one of the dummy
+ * states spins for a short while, in rounds of exponentially growing length,
+ * waiting for the owner to release it. Only plain loads are done while
+ * spinning so the cacheline stays shared between the spinning threads.
+ * Spinning stops as soon as d_ptr points to an actual QReadWriteLockPrivate,
+ * since that means somebody is already sleeping on the lock.
+ */
+enum { SpinRounds = 8 };
+
+inline void cpuRelax()
+{
+#if defined(Q_PROCESSOR_X86) && defined(__SSE2__)
+    _mm_pause();
+#elif defined(Q_PROCESSOR_ARM) && Q_PROCESSOR_ARM >= 7 && defined(Q_CC_GNU)
+    asm volatile("yield");
+#endif
+}
+
+bool spinUntilChanged(QAtomicPointer<QReadWriteLockPrivate> &d_ptr, QReadWriteLockPrivate *&d,
+                      int &round)
+{
+    static const bool multiCore = QThread::idealThreadCount() > 1;
+    if (!multiCore)
+        return false;
+
+    while (round < SpinRounds) {
+        for (int i = 0; i < (16 << round); ++i)
+            cpuRelax();
+        ++round;
+        QReadWriteLockPrivate *current = d_ptr.loadAcquire();
+        if (current != d) {
+            d = current;
+            return true;
+        }
+    }
+    return false;
+}
 }
 
 /*! \class QReadWriteLock
@@ -176,7 +218,8 @@ void QReadWriteLock::lockForRead()
 {
     if (d_ptr.testAndSetAcquire(nullptr, dummyLockedForRead))
         return;
-    tryLockForRead(-1);
+    QLockProfiler::Contention contention(this, QLockProfiler::ReadLock, QT_LOCK_PROFILER_CALLER);
+    contention.finish(tryLockForRead(-1));
 }
 
 /*!
@@ -226,11 +269,14 @@ bool QReadWriteLock::tryLockForRead(int timeout)
     if (d_ptr.testAndSetAcquire(nullptr, dummyLockedForRead, d))
         return true;
 
+    QLockProfiler::Contention contention(this, QLockProfiler::ReadLock, QT_LOCK_PROFILER_CALLER);
+    int spinRound = 0;
+
     while (true) {
         if (d == 0) {
             if (!d_ptr.testAndSetAcquire(nullptr, dummyLockedForRead, d))
                 continue;
-            return true;
+            return contention.finish(true);
         }
 
         if ((quintptr(d) & StateMask) == StateLockedForRead) {
@@ -240,12 +286,16 @@ bool QReadWriteLock::tryLockForRead(int timeout)
                        "Overflow in lock counter");
             if (!d_ptr.testAndSetAcquire(d, val, d))
                 continue;
-            return true;
+            return contention.finish(true);
         }
 
         if (d == dummyLockedForWrite) {
             if (!timeout)
-                return false;
+                return contention.finish(false);
+
+            // the writer is probably about to unlock, give it a chance first
+            if (spinUntilChanged(d_ptr, d, spinRound))
+                continue;
 
             // locked for write, assign a d_ptr and wait.
             auto val = QReadWriteLockPrivate::allocate();
@@ -261,7 +311,7 @@ bool QReadWriteLock::tryLockForRead(int timeout)
         // d is an actual pointer;
 
         if (d->recursive)
-            return d->recursiveLockForRead(timeout);
+            return contention.finish(d->recursiveLockForRead(timeout));
 
         QMutexLocker lock(&d->mutex);
         if (d != d_ptr.load()) {
@@ -274,7 +324,7 @@ bool QReadWriteLock::tryLockForRead(int timeout)
             d = d_ptr.loadAcquire();
             continue;
         }
-        return d->lockForRead(timeout);
+        return contention.finish(d->lockForRead(timeout));
     }
 }
 
@@ -291,7 +341,10 @@ bool QReadWriteLock::tryLockForRead(int timeout)
 */
 void QReadWriteLock::lockForWrite()
 {
-    tryLockForWrite(-1);
+    if (d_ptr.testAndSetAcquire(nullptr, dummyLockedForWrite))
+        return;
+    QLockProfiler::Contention contention(this, QLockProfiler::WriteLock, QT_LOCK_PROFILER_CALLER);
+    contention.finish(tryLockForWrite(-1));
 }
 
 /*!
@@ -340,16 +393,24 @@ bool QReadWriteLock::tryLockForWrite(int timeout)
     if (d_ptr.testAndSetAcquire(nullptr, dummyLockedForWrite, d))
         return true;
 
+    QLockProfiler::Contention contention(this, QLockProfiler::WriteLock, QT_LOCK_PROFILER_CALLER);
+    int spinRound = 0;
+
     while (true) {
         if (d == 0) {
             if (!d_ptr.testAndSetAcquire(d, dummyLockedForWrite, d))
                 continue;
-            return true;
+            return contention.finish(true);
         }
 
         if (isUncontendedLocked(d)) {
             if (!timeout)
-                return false;
+                return contention.finish(false);
+
+            // readers coming and going also change d_ptr, but the number of
+            // spin rounds is bounded for the whole call
+            if (spinUntilChanged(d_ptr, d, spinRound))
+                continue;
 
             // locked for either read or write, assign a d_ptr and wait.
             auto val = QReadWriteLockPrivate::allocate();
@@ -368,7 +429,7 @@ bool QReadWriteLock::tryLockForWrite(int timeout)
         // d is an actual pointer;
 
         if (d->recursive)
-            return d->recursiveLockForWrite(timeout);
+            return contention.finish(d->recursiveLockForWrite(timeout));
 
         QMutexLocker lock(&d->mutex);
         if (d != d_ptr.load()) {
@@ -378,7 +439,7 @@ bool QReadWriteLock::tryLockForWrite(int timeout)
             d = d_ptr.loadAcquire();
             continue;
         }
-        return d->lockForWrite(timeout);
+        return contention.finish(d->lockForWrite(timeout));
     }
 }
 
@@ -392,6 +453,7 @@ bool QReadWriteLock::tryLockForWrite(int timeout)
 */
 void QReadWriteLock::unlock()
 {
+    QLockProfiler::released(this);
     QReadWriteLockPrivate *d = d_ptr.loadAcquire();
     while (true) {
         Q_ASSERT_X(d, "QReadWriteLock::unlock()", "Cannot unlock an unlocked lock");
@@ -98,6 +98,17 @@ QThreadData::~QThreadData()
         }
     }
 
+    // events pushed by other threads were never counted in postedEvents
+    for (int lane = 0; lane < QPostEventList::LaneCount; ++lane) {
+        QPostEventNode *node = postEventList.takeIncoming(lane);
+        while (node) {
+            QPostEventNode *next = node->next;
+            delete node->event.event;
+            delete node;
+            node = next;
+        }
+    }
+
     // fprintf(stderr, "QThreadData %p destroyed\n", this);
 }
 
@@ -154,7 +165,7 @@ QThreadPrivate::QThreadPrivate(QThreadData *d)
     : QObjectPrivate(), running(false), finished(false),
       isInFinish(false), interruptionRequested(false),
       exited(false), returnCode(-1),
-      stackSize(0), priority(QThread::InheritPriority), data(d)
+      stackSize(0), priority(QThread::InheritPriority), numaNode(-1), data(d)
 {
 
 // INTEGRITY doesn't support self-extending stack. The default stack size for
@@ -497,6 +508,126 @@ uint QThread::stackSize() const
     return d->stackSize;
 }
 
+/*!
+    \since 5.11
+
+    Restricts the thread to run on the logical CPUs listed in \a cpus,
+    numbered from 0. An empty list removes the restriction.
+
+    If the thread is running, the new affinity takes effect immediately;
+    otherwise it is applied when the thread is started. Setting the CPU
+    affinity resets numaNode() to -1.
+
+    CPU affinity is currently supported on Linux and Windows. On Windows,
+    only the first 64 CPUs can be selected.
+
+    \sa cpuAffinity(), setNumaNode()
+*/
+void QThread::setCpuAffinity(const QVector<int> &cpus)
+{
+    Q_D(QThread);
+    QMutexLocker locker(&d->mutex);
+    d->cpuAffinity = cpus;
+    d->numaNode = -1;
+    if (d->running && !d->isInFinish)
+        d->applyCpuAffinity();
+}
+
+/*!
+    \since 5.11
+
+    Returns the CPUs the thread is restricted to, or an empty list if it may
+    run on any CPU.
+
+    \sa setCpuAffinity()
+*/
+QVector<int> QThread::cpuAffinity() const
+{
+    Q_D(const QThread);
+    QMutexLocker locker(&d->mutex);
+    return d->cpuAffinity;
+}
+
+/*!
+    \since 5.11
+
+    Restricts the thread to run on the CPUs of NUMA node \a node. Since
+    operating systems by default allocate memory on the node of the CPU that
+    first touches it, memory the thread allocates will then normally be local
+    to that node as well. Passing -1 removes the restriction.
+
+    If the thread is running, the change takes effect immediately; otherwise
+    it is applied when the thread is started.
+
+    \sa numaNode(), numaNodeCount(), numaNodeCpus(), setCpuAffinity()
+*/
+void QThread::setNumaNode(int node)
+{
+    Q_D(QThread);
+    QVector<int> cpus;
+    if (node >= 0) {
+        cpus = numaNodeCpus(node);
+        if (cpus.isEmpty()) {
+            qWarning("QThread::setNumaNode: NUMA node %d does not exist", node);
+            return;
+        }
+    }
+
+    QMutexLocker locker(&d->mutex);
+    d->cpuAffinity = cpus;
+    d->numaNode = node < 0 ? -1 : node;
+    if (d->running && !d->isInFinish)
+        d->applyCpuAffinity();
+}
+
+/*!
+    \since 5.11
+
+    Returns the NUMA node the thread was restricted to with setNumaNode(),
+    or -1 if it was not restricted to a node.
+
+    \sa setNumaNode()
+*/
+int QThread::numaNode() const
+{
+    Q_D(const QThread);
+    QMutexLocker locker(&d->mutex);
+    return d->numaNode;
+}
+
+/*!
+    \fn int QThread::numaNodeCount()
+    \since 5.11
+
+    Returns the number of NUMA nodes in the system, or 1 if the system is not
+    a NUMA system or the topology cannot be determined.
+
+    \sa numaNodeCpus(), setNumaNode()
+*/
+
+/*!
+    \fn QVector<int> QThread::numaNodeCpus(int node)
+    \since 5.11
+
+    Returns the logical CPUs that belong to NUMA node \a node, or an empty
+    list if there is no such node.
+
+    \sa numaNodeCount(), setCpuAffinity()
+*/
+
+/*!
+    \fn int QThread::numaNodeOfAddress(const void *address)
+    \since 5.11
+
+    Returns the NUMA node on which the memory page containing \a address
+    resides, or -1 if it cannot be determined. Use this to route work to a
+    thread on the node where its data lives.
+
+    \note This is currently only implemented on Linux.
+
+    \sa QThreadPool::startOnNumaNode()
+*/
+
 /*!
     Enters the event loop and waits until exit() is called, returning the value
     that was passed to exit(). The value returned is 0 if exit() is called via
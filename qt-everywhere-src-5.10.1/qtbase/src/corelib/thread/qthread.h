@@ -76,6 +76,10 @@ public:
     static int idealThreadCount() Q_DECL_NOTHROW;
     static void yieldCurrentThread();
 
+    static int numaNodeCount();
+    static QVector<int> numaNodeCpus(int node);
+    static int numaNodeOfAddress(const void *address);
+
     explicit QThread(QObject *parent = Q_NULLPTR);
     ~QThread();
 
@@ -105,6 +109,12 @@ public:
     void setStackSize(uint stackSize);
     uint stackSize() const;
 
+    void setCpuAffinity(const QVector<int> &cpus);
+    QVector<int> cpuAffinity() const;
+
+    void setNumaNode(int node);
+    int numaNode() const;
+
     void exit(int retcode = 0);
 
     QAbstractEventDispatcher *eventDispatcher() const;
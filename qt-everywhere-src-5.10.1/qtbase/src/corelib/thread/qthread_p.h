@@ -99,6 +99,13 @@ inline bool operator<(const QPostEvent &first, const QPostEvent &second)
     return first.priority > second.priority;
 }
 
+// A node of the lock-free stacks holding events posted from other threads
+struct QPostEventNode
+{
+    QPostEvent event;
+    QPostEventNode *next;
+};
+
 // This class holds the list of posted events.
 //  The list has to be kept sorted by priority
 class QPostEventList : public QVector<QPostEvent>
@@ -114,10 +121,54 @@ public:
 
     QMutex mutex;
 
+    // Events posted from other threads are pushed onto one of these stacks
+    // without taking the mutex. QCoreApplicationPrivate::flushIncomingPostedEvents()
+    // moves them into the list, with the mutex held, before the list is used.
+    enum { HighPriorityLane, NormalPriorityLane, LowPriorityLane, LaneCount };
+    QAtomicPointer<QPostEventNode> incoming[LaneCount];
+    // set by the first push after a flush, so that only one poster wakes the thread up
+    QAtomicInt wakeUpPending;
+    // number of posters between their check of the receiver's thread and the
+    // end of their push; QObject::moveToThread() waits for it to drop to zero
+    QAtomicInt pushers;
+
     inline QPostEventList()
         : QVector<QPostEvent>(), recursion(0), startOffset(0), insertionOffset(0)
     { }
 
+    static int laneForPriority(int priority)
+    {
+        return priority > Qt::NormalEventPriority ? HighPriorityLane
+             : priority == Qt::NormalEventPriority ? NormalPriorityLane
+             : LowPriorityLane;
+    }
+
+    // returns true if the caller has to wake up the receiving thread
+    bool pushIncoming(QPostEventNode *node)
+    {
+        QAtomicPointer<QPostEventNode> &head = incoming[laneForPriority(node->event.priority)];
+        QPostEventNode *top = head.loadAcquire();
+        do {
+            node->next = top;
+        } while (!head.testAndSetOrdered(top, node, top));
+        return wakeUpPending.testAndSetOrdered(0, 1);
+    }
+
+    // takes the whole stack of a lane; the nodes are in reverse posting order
+    QPostEventNode *takeIncoming(int lane)
+    {
+        return incoming[lane].fetchAndStoreOrdered(0);
+    }
+
+    bool hasIncoming() const
+    {
+        for (int i = 0; i < LaneCount; ++i) {
+            if (incoming[i].loadAcquire())
+                return true;
+        }
+        return false;
+    }
+
     void addEvent(const QPostEvent &ev) {
         int priority = ev.priority;
         if (isEmpty() ||
@@ -173,6 +224,10 @@ public:
     uint stackSize;
     QThread::Priority priority;
 
+    QVector<int> cpuAffinity;
+    int numaNode;
+    void applyCpuAffinity(); // called with the mutex locked
+
     static QThread *threadForId(int id);
 
 #ifdef Q_OS_UNIX
@@ -251,7 +306,7 @@ public:
     bool canWaitLocked()
     {
         QMutexLocker locker(&postEventList.mutex);
-        return canWait;
+        return canWait && !postEventList.hasIncoming();
     }
 
     // This class provides per-thread (by way of being a QThreadData
@@ -51,6 +51,9 @@
 #  if !defined(QT_NO_GLIB)
 #    include "../kernel/qeventdispatcher_glib_p.h"
 #  endif
+#  if defined(Q_OS_LINUX)
+#    include <private/qeventdispatcher_epoll_p.h>
+#  endif
 #endif
 
 #include <private/qeventdispatcher_unix_p.h>
@@ -100,6 +103,11 @@
 #include <sys/prctl.h>
 #endif
 
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #if defined(Q_OS_LINUX) && !defined(SCHED_IDLE)
 // from linux/sched.h
 # define SCHED_IDLE    5
@@ -290,15 +298,20 @@ void QThreadPrivate::createEventDispatcher(QThreadData *data)
         data->eventDispatcher.storeRelease(new QEventDispatcherCoreFoundation);
     else
         data->eventDispatcher.storeRelease(new QEventDispatcherUNIX);
-#elif !defined(QT_NO_GLIB)
+#else
+#  if defined(Q_OS_LINUX)
+    if (QEventDispatcherEpoll::isRequested())
+        data->eventDispatcher.storeRelease(new QEventDispatcherEpoll);
+    else
+#  endif
+#  if !defined(QT_NO_GLIB)
     if (qEnvironmentVariableIsEmpty("QT_NO_GLIB")
         && qEnvironmentVariableIsEmpty("QT_NO_THREADED_GLIB")
         && QEventDispatcherGlib::versionSupported())
         data->eventDispatcher.storeRelease(new QEventDispatcherGlib);
     else
+#  endif
         data->eventDispatcher.storeRelease(new QEventDispatcherUNIX);
-#else
-    data->eventDispatcher.storeRelease(new QEventDispatcherUNIX);
 #endif
 
     data->eventDispatcher.load()->startingUp();
@@ -346,6 +359,9 @@ void *QThreadPrivate::start(void *arg)
             data->threadId.store(to_HANDLE(pthread_self()));
             set_thread_data(data);
 
+            if (!thr->d_func()->cpuAffinity.isEmpty())
+                thr->d_func()->applyCpuAffinity();
+
             data->ref();
             data->quitNow = thr->d_func()->exited;
         }
@@ -531,6 +547,82 @@ void QThread::yieldCurrentThread()
     sched_yield();
 }
 
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+// Parses a sysfs CPU or node list such as "0-3,8-11".
+static QVector<int> readSysfsList(const char *path)
+{
+    QVector<int> result;
+    int fd = qt_safe_open(path, O_RDONLY);
+    if (fd == -1)
+        return result;
+    char buffer[1024];
+    const qint64 size = qt_safe_read(fd, buffer, sizeof(buffer) - 1);
+    qt_safe_close(fd);
+    if (size <= 0)
+        return result;
+    buffer[size] = '\0';
+
+    const char *p = buffer;
+    while (*p >= '0' && *p <= '9') {
+        char *end;
+        const int first = int(strtol(p, &end, 10));
+        int last = first;
+        if (*end == '-')
+            last = int(strtol(end + 1, &end, 10));
+        for (int i = first; i <= last; ++i)
+            result.append(i);
+        p = *end == ',' ? end + 1 : end;
+    }
+    return result;
+}
+#endif
+
+int QThread::numaNodeCount()
+{
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    const QVector<int> nodes = readSysfsList("/sys/devices/system/node/possible");
+    if (!nodes.isEmpty())
+        return nodes.constLast() + 1;
+#endif
+    return 1;
+}
+
+QVector<int> QThread::numaNodeCpus(int node)
+{
+    QVector<int> cpus;
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    if (node >= 0) {
+        char path[64];
+        qsnprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+        cpus = readSysfsList(path);
+        if (!cpus.isEmpty())
+            return cpus;
+    }
+#endif
+    // not a NUMA system (or no sysfs): node 0 spans all CPUs
+    if (node == 0) {
+        const int count = idealThreadCount();
+        cpus.reserve(count);
+        for (int i = 0; i < count; ++i)
+            cpus.append(i);
+    }
+    return cpus;
+}
+
+int QThread::numaNodeOfAddress(const void *address)
+{
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID) && defined(SYS_get_mempolicy)
+    // from numaif.h, which we don't want to depend on
+    enum { MPOL_F_NODE = 1 << 0, MPOL_F_ADDR = 1 << 1 };
+    int node = -1;
+    if (syscall(SYS_get_mempolicy, &node, nullptr, 0, address, MPOL_F_NODE | MPOL_F_ADDR) == 0)
+        return node;
+#else
+    Q_UNUSED(address);
+#endif
+    return -1;
+}
+
 static timespec makeTimespec(time_t secs, long nsecs)
 {
     struct timespec ts;
@@ -761,6 +853,29 @@ void QThread::setTerminationEnabled(bool enabled)
 }
 
 // Caller must lock the mutex
+void QThreadPrivate::applyCpuAffinity()
+{
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (cpuAffinity.isEmpty()) {
+        for (int i = 0; i < CPU_SETSIZE; ++i)
+            CPU_SET(i, &set);
+    } else {
+        for (int cpu : qAsConst(cpuAffinity)) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE)
+                CPU_SET(cpu, &set);
+        }
+    }
+    pthread_t thread = from_HANDLE<pthread_t>(data->threadId.load());
+    if (int code = pthread_setaffinity_np(thread, sizeof(set), &set))
+        qWarning("QThread::setCpuAffinity: Cannot set CPU affinity: %s", qPrintable(qt_error_string(code)));
+#else
+    if (!cpuAffinity.isEmpty())
+        qWarning("QThread::setCpuAffinity: Not supported on this platform");
+#endif
+}
+
 void QThreadPrivate::setPriority(QThread::Priority threadPriority)
 {
     priority = threadPriority;
@@ -358,6 +358,8 @@ unsigned int __stdcall QT_ENSURE_STACK_ALIGNED_FOR_SSE QThreadPrivate::start(voi
     {
         QMutexLocker locker(&thr->d_func()->mutex);
         data->quitNow = thr->d_func()->exited;
+        if (!thr->d_func()->cpuAffinity.isEmpty())
+            thr->d_func()->applyCpuAffinity();
     }
 
     if (data->eventDispatcher.load()) // custom event dispatcher set?
@@ -447,6 +449,43 @@ void QThread::yieldCurrentThread()
 #endif
 }
 
+int QThread::numaNodeCount()
+{
+#ifndef Q_OS_WINRT
+    ULONG highestNode = 0;
+    if (GetNumaHighestNodeNumber(&highestNode))
+        return int(highestNode) + 1;
+#endif
+    return 1;
+}
+
+QVector<int> QThread::numaNodeCpus(int node)
+{
+    QVector<int> cpus;
+#ifndef Q_OS_WINRT
+    ULONGLONG mask = 0;
+    if (node >= 0 && node <= 0xff && GetNumaNodeProcessorMask(UCHAR(node), &mask)) {
+        for (int i = 0; i < 64; ++i) {
+            if (mask & (Q_UINT64_C(1) << i))
+                cpus.append(i);
+        }
+        return cpus;
+    }
+#endif
+    if (node == 0) {
+        const int count = idealThreadCount();
+        for (int i = 0; i < count; ++i)
+            cpus.append(i);
+    }
+    return cpus;
+}
+
+int QThread::numaNodeOfAddress(const void *address)
+{
+    Q_UNUSED(address);
+    return -1;
+}
+
 void QThread::sleep(unsigned long secs)
 {
     ::Sleep(secs * 1000);
@@ -652,6 +691,28 @@ void QThread::setTerminationEnabled(bool enabled)
 }
 
 // Caller must hold the mutex
+void QThreadPrivate::applyCpuAffinity()
+{
+#ifndef Q_OS_WINRT
+    DWORD_PTR mask = 0;
+    if (cpuAffinity.isEmpty()) {
+        DWORD_PTR systemMask;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &mask, &systemMask))
+            return;
+    } else {
+        for (int cpu : qAsConst(cpuAffinity)) {
+            if (cpu >= 0 && cpu < int(sizeof(DWORD_PTR) * 8))
+                mask |= DWORD_PTR(1) << cpu;
+        }
+    }
+    if (!SetThreadAffinityMask(handle, mask))
+        qErrnoWarning("QThread::setCpuAffinity: Failed to set CPU affinity");
+#else
+    if (!cpuAffinity.isEmpty())
+        qWarning("QThread::setCpuAffinity: Not supported on this platform");
+#endif
+}
+
 void QThreadPrivate::setPriority(QThread::Priority threadPriority)
 {
     // copied from start() with a few modifications:
@@ -40,6 +40,7 @@
 #include "qthreadpool.h"
 #include "qthreadpool_p.h"
 #include "qelapsedtimer.h"
+#include <private/qtcore_tracepoints_p.h>
 
 #include <algorithm>
 
@@ -58,12 +59,19 @@ public:
     QThreadPoolThread(QThreadPoolPrivate *manager);
     void run() Q_DECL_OVERRIDE;
     void registerThreadInactive();
+    QRunnable *takeLocalOrStolenTask();
 
     QWaitCondition runnableReady;
     QThreadPoolPrivate *manager;
     QRunnable *runnable;
+    QWorkStealingQueue localQueue;
+    int stealTargetIndex;
 };
 
+#ifdef Q_COMPILER_THREAD_LOCAL
+static thread_local QThreadPoolThread *currentPoolThread = nullptr;
+#endif
+
 /*
     QThreadPool private class.
 */
@@ -73,9 +81,11 @@ public:
     \internal
 */
 QThreadPoolThread::QThreadPoolThread(QThreadPoolPrivate *manager)
-    :manager(manager), runnable(nullptr)
+    :manager(manager), runnable(nullptr), stealTargetIndex(-1)
 {
     setStackSize(manager->stackSize);
+    if (manager->numaNode >= 0)
+        setNumaNode(manager->numaNode);
 }
 
 /*
@@ -83,6 +93,9 @@ QThreadPoolThread::QThreadPoolThread(QThreadPoolPrivate *manager)
 */
 void QThreadPoolThread::run()
 {
+#ifdef Q_COMPILER_THREAD_LOCAL
+    currentPoolThread = this;
+#endif
     QMutexLocker locker(&manager->mutex);
     for(;;) {
         QRunnable *r = runnable;
@@ -98,7 +111,9 @@ void QThreadPoolThread::run()
 #ifndef QT_NO_EXCEPTIONS
                 try {
 #endif
+                    Q_TRACE(QRunnable_run_entry, r);
                     r->run();
+                    Q_TRACE(QRunnable_run_exit, r);
 #ifndef QT_NO_EXCEPTIONS
                 } catch (...) {
                     qWarning("Qt Concurrent has caught an exception thrown from a worker thread.\n"
@@ -108,19 +123,32 @@ void QThreadPoolThread::run()
                     throw;
                 }
 #endif
-                locker.relock();
-
-                if (autoDelete && !--r->ref)
-                    delete r;
+                if (manager->workStealing.load()) {
+                    // keep going without the mutex for as long as there is
+                    // local or stealable work and nothing in the shared queue
+                    if (autoDelete && !--r->ref)
+                        delete r;
+                    r = manager->queueNotEmpty.load() ? nullptr : takeLocalOrStolenTask();
+                    if (r)
+                        continue;
+                    locker.relock();
+                } else {
+                    locker.relock();
+
+                    if (autoDelete && !--r->ref)
+                        delete r;
+                }
             }
 
             // if too many threads are active, expire this thread
-            if (manager->tooManyThreadsActive())
+            if (manager->tooManyThreadsActive() && localQueue.isEmpty())
                 break;
 
             if (manager->queue.isEmpty()) {
-                r = nullptr;
-                break;
+                r = takeLocalOrStolenTask();
+                if (!r)
+                    break;
+                continue;
             }
 
             QueuePage *page = manager->queue.first();
@@ -129,6 +157,7 @@ void QThreadPoolThread::run()
             if (page->isFinished()) {
                 manager->queue.removeFirst();
                 delete page;
+                manager->updateQueueHint();
             }
         } while (true);
 
@@ -142,11 +171,20 @@ void QThreadPoolThread::run()
         if (!expired) {
             manager->waitingThreads.enqueue(this);
             registerThreadInactive();
+            manager->updateSpareThreads();
+            // another thread may have pushed local work since we last looked
+            if ((runnable = manager->stealTask(this))) {
+                manager->waitingThreads.removeOne(this);
+                ++manager->activeThreads;
+                manager->updateSpareThreads();
+                continue;
+            }
             // wait for work, exiting after the expiry timeout is reached
             runnableReady.wait(locker.mutex(), manager->expiryTimeout);
             ++manager->activeThreads;
             if (manager->waitingThreads.removeOne(this))
                 expired = true;
+            manager->updateSpareThreads();
         }
         if (expired) {
             manager->expiredThreads.enqueue(this);
@@ -162,6 +200,18 @@ void QThreadPoolThread::registerThreadInactive()
         manager->noActiveThreads.wakeAll();
 }
 
+/*
+    \internal
+    Takes the most recently pushed runnable from this thread's own deque or,
+    if that is empty, the oldest one from another thread's deque.
+*/
+QRunnable *QThreadPoolThread::takeLocalOrStolenTask()
+{
+    if (QRunnable *r = localQueue.pop())
+        return r;
+    return manager->isExiting ? nullptr : manager->stealTask(this);
+}
+
 
 /*
     \internal
@@ -216,6 +266,7 @@ inline bool comparePriority(int priority, const QueuePage *p)
 void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
 {
     Q_ASSERT(runnable != nullptr);
+    Q_TRACE(QThreadPoolPrivate_enqueueTask, runnable, priority);
     if (runnable->autoDelete())
         ++runnable->ref;
 
@@ -227,6 +278,7 @@ void QThreadPoolPrivate::enqueueTask(QRunnable *runnable, int priority)
     }
     auto it = std::upper_bound(queue.constBegin(), queue.constEnd(), priority, comparePriority);
     queue.insert(std::distance(queue.constBegin(), it), new QueuePage(runnable, priority));
+    updateQueueHint();
 }
 
 int QThreadPoolPrivate::activeThreadCount() const
@@ -250,6 +302,7 @@ void QThreadPoolPrivate::tryToStartMoreThreads()
         if (page->isFinished()) {
             queue.removeFirst();
             delete page;
+            updateQueueHint();
         }
     }
 }
@@ -272,6 +325,13 @@ void QThreadPoolPrivate::startThread(QRunnable *runnable)
     allThreads.append(thread.data());
     ++activeThreads;
 
+    const int targetIndex = stealTargetCount.load();
+    if (targetIndex < MaxStealTargets) {
+        stealTargets[targetIndex].storeRelease(thread.data());
+        stealTargetCount.storeRelease(targetIndex + 1);
+        thread->stealTargetIndex = targetIndex;
+    }
+
     if (runnable->autoDelete())
         ++runnable->ref;
     thread->runnable = runnable;
@@ -291,13 +351,16 @@ void QThreadPoolPrivate::reset()
         // move the contents of the set out so that we can iterate without the lock
         QList<QThreadPoolThread *> allThreadsCopy;
         allThreadsCopy.swap(allThreads);
+        stealTargetCount.storeRelease(0);
         locker.unlock();
 
+        // the threads may still be stealing from each other, so only delete
+        // them once all of them have exited
         for (QThreadPoolThread *thread : qAsConst(allThreadsCopy)) {
             thread->runnableReady.wakeAll();
             thread->wait();
-            delete thread;
         }
+        qDeleteAll(allThreadsCopy);
 
         locker.relock();
         // repeat until all newly arrived threads have also completed
@@ -305,6 +368,7 @@ void QThreadPoolPrivate::reset()
 
     waitingThreads.clear();
     expiredThreads.clear();
+    updateSpareThreads();
 
     isExiting = false;
 }
@@ -338,6 +402,116 @@ void QThreadPoolPrivate::clear()
     }
     qDeleteAll(queue);
     queue.clear();
+    updateQueueHint();
+
+    const int targetCount = stealTargetCount.load();
+    for (int i = 0; i < targetCount; ++i) {
+        QThreadPoolThread *thread = stealTargets[i].load();
+        while (QRunnable *r = thread->localQueue.steal()) {
+            if (r->autoDelete() && !--r->ref)
+                delete r;
+        }
+    }
+}
+
+/*!
+    \internal
+    Pushes \a runnable onto the deque of the calling thread if work stealing
+    is enabled and the calling thread belongs to this pool. This does not
+    lock the mutex unless an idle thread needs to be woken up.
+*/
+bool QThreadPoolPrivate::tryPushLocal(QRunnable *runnable)
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    QThreadPoolThread *thread = currentPoolThread;
+    if (!thread || thread->manager != this || thread->stealTargetIndex < 0
+        || !workStealing.load()) {
+        return false;
+    }
+
+    if (runnable->autoDelete())
+        ++runnable->ref;
+    if (!thread->localQueue.push(runnable)) {
+        if (runnable->autoDelete())
+            --runnable->ref;
+        return false;
+    }
+
+    // A stale hint only costs parallelism, never work: the runnable is in
+    // this thread's deque and will be run by this thread if nobody steals it.
+    if (spareThreads.loadAcquire() > 0) {
+        QMutexLocker locker(&mutex);
+        wakeOrStartThread(thread);
+    }
+    return true;
+#else
+    Q_UNUSED(runnable);
+    return false;
+#endif
+}
+
+/*!
+    \internal
+    Wakes up a waiting thread or, if there is none and the limit allows it,
+    starts another thread with a runnable taken from \a thread's deque.
+*/
+void QThreadPoolPrivate::wakeOrStartThread(QThreadPoolThread *thread)
+{
+    if (!waitingThreads.isEmpty()) {
+        waitingThreads.takeFirst()->runnableReady.wakeOne();
+    } else if (activeThreadCount() < maxThreadCount) {
+        if (QRunnable *r = thread->localQueue.steal()) {
+            if (r->autoDelete())
+                --r->ref; // tryStart() and enqueueTask() take their own reference
+            if (!tryStart(r))
+                enqueueTask(r);
+        }
+    }
+    updateSpareThreads();
+}
+
+/*!
+    \internal
+    Records how many threads could pick up work without the limit being
+    exceeded, for tryPushLocal() to read without locking the mutex.
+*/
+void QThreadPoolPrivate::updateSpareThreads()
+{
+    spareThreads.storeRelease(waitingThreads.count() + qMax(0, maxThreadCount - activeThreadCount()));
+}
+
+void QThreadPoolPrivate::updateQueueHint()
+{
+    queueNotEmpty.storeRelease(queue.isEmpty() ? 0 : 1);
+}
+
+/*!
+    \internal
+    Steals a runnable from one of the other threads' deques, starting with
+    the thread after \a thief to spread the thieves over the victims.
+*/
+QRunnable *QThreadPoolPrivate::stealTask(QThreadPoolThread *thief)
+{
+    const int count = stealTargetCount.loadAcquire();
+    const int first = thief->stealTargetIndex + 1;
+    for (int i = 0; i < count; ++i) {
+        QThreadPoolThread *victim = stealTargets[(first + i) % count].loadAcquire();
+        if (victim == thief || victim->localQueue.isEmpty())
+            continue;
+        if (QRunnable *r = victim->localQueue.steal())
+            return r;
+    }
+    return nullptr;
+}
+
+bool QThreadPoolPrivate::tryTakeLocal(QRunnable *runnable)
+{
+    const int count = stealTargetCount.load();
+    for (int i = 0; i < count; ++i) {
+        if (stealTargets[i].load()->localQueue.tryTake(runnable))
+            return true;
+    }
+    return false;
 }
 
 /*!
@@ -374,9 +548,22 @@ bool QThreadPool::tryTake(QRunnable *runnable)
                 }
                 if (runnable->autoDelete())
                     --runnable->ref; // undo ++ref in start()
+                d->updateQueueHint();
                 return true;
             }
         }
+
+        if (d->tryTakeLocal(runnable)) {
+            if (runnable->autoDelete())
+                --runnable->ref; // undo ++ref in start()
+            return true;
+        }
+    }
+
+    const QVector<QThreadPool *> nodePools = d->lockedNodePools();
+    for (QThreadPool *nodePool : nodePools) {
+        if (nodePool->tryTake(runnable))
+            return true;
     }
 
     return false;
@@ -395,7 +582,9 @@ void QThreadPoolPrivate::stealAndRunRunnable(QRunnable *runnable)
         return;
     const bool del = runnable->autoDelete() && !runnable->ref; // tryTake already deref'ed
 
+    Q_TRACE(QRunnable_run_entry, runnable);
     runnable->run();
+    Q_TRACE(QRunnable_run_exit, runnable);
 
     if (del) {
         delete runnable;
@@ -425,6 +614,13 @@ void QThreadPoolPrivate::stealAndRunRunnable(QRunnable *runnable)
     QThreadPool deletes the QRunnable automatically by default. Use
     QRunnable::setAutoDelete() to change the auto-deletion flag.
 
+    By default all runnables are kept in one queue that is shared by the
+    threads of the pool. When many small runnables are started from within
+    the pool's own threads, for instance by recursively splitting up work,
+    that queue and its lock become a bottleneck. In that case, enable
+    \l workStealingEnabled: runnables started from a pool thread are then
+    kept by that thread, and idle threads take work away from busy ones.
+
     QThreadPool supports executing the same QRunnable more than once
     by calling tryStart(this) from within QRunnable::run().
     If autoDelete is enabled the QRunnable will be deleted when
@@ -500,6 +696,9 @@ void QThreadPool::start(QRunnable *runnable, int priority)
         return;
 
     Q_D(QThreadPool);
+    if (priority == 0 && d->tryPushLocal(runnable))
+        return;
+
     QMutexLocker locker(&d->mutex);
     if (!d->tryStart(runnable)) {
         d->enqueueTask(runnable, priority);
@@ -507,6 +706,38 @@ void QThreadPool::start(QRunnable *runnable, int priority)
         if (!d->waitingThreads.isEmpty())
             d->waitingThreads.takeFirst()->runnableReady.wakeOne();
     }
+    d->updateSpareThreads();
+}
+
+/*!
+    \since 5.11
+
+    Runs \a runnable on a thread bound to NUMA node \a node, with the given
+    \a priority. Use QThread::numaNodeOfAddress() to find the node on which
+    the data the runnable works on resides.
+
+    If the pool is not \l{numaAware}{NUMA-aware}, the system has a single
+    node, or \a node is not a valid node, this is equivalent to calling
+    start().
+
+    \sa numaAware, start()
+*/
+void QThreadPool::startOnNumaNode(int node, QRunnable *runnable, int priority)
+{
+    Q_D(QThreadPool);
+    if (d->numaAware.loadAcquire()) {
+        QThreadPool *nodePool = nullptr;
+        {
+            QMutexLocker locker(&d->mutex);
+            if (node >= 0 && node < d->nodePools.size())
+                nodePool = d->nodePools.at(node);
+        }
+        if (nodePool) {
+            nodePool->start(runnable, priority);
+            return;
+        }
+    }
+    start(runnable, priority);
 }
 
 /*!
@@ -537,7 +768,9 @@ bool QThreadPool::tryStart(QRunnable *runnable)
     if (d->allThreads.isEmpty() == false && d->activeThreadCount() >= d->maxThreadCount)
         return false;
 
-    return d->tryStart(runnable);
+    const bool started = d->tryStart(runnable);
+    d->updateSpareThreads();
+    return started;
 }
 
 /*! \property QThreadPool::expiryTimeout
@@ -566,6 +799,9 @@ void QThreadPool::setExpiryTimeout(int expiryTimeout)
     if (d->expiryTimeout == expiryTimeout)
         return;
     d->expiryTimeout = expiryTimeout;
+    const QVector<QThreadPool *> nodePools = d->lockedNodePools();
+    for (QThreadPool *nodePool : nodePools)
+        nodePool->setExpiryTimeout(expiryTimeout);
 }
 
 /*! \property QThreadPool::maxThreadCount
@@ -595,6 +831,7 @@ void QThreadPool::setMaxThreadCount(int maxThreadCount)
 
     d->maxThreadCount = maxThreadCount;
     d->tryToStartMoreThreads();
+    d->updateSpareThreads();
 }
 
 /*! \property QThreadPool::activeThreadCount
@@ -611,7 +848,10 @@ int QThreadPool::activeThreadCount() const
 {
     Q_D(const QThreadPool);
     QMutexLocker locker(&d->mutex);
-    return d->activeThreadCount();
+    int count = d->activeThreadCount();
+    for (QThreadPool *nodePool : d->nodePools)
+        count += nodePool->activeThreadCount();
+    return count;
 }
 
 /*!
@@ -631,6 +871,7 @@ void QThreadPool::reserveThread()
     Q_D(QThreadPool);
     QMutexLocker locker(&d->mutex);
     ++d->reservedThreads;
+    d->updateSpareThreads();
 }
 
 /*! \property QThreadPool::stackSize
@@ -651,6 +892,9 @@ void QThreadPool::setStackSize(uint stackSize)
 {
     Q_D(QThreadPool);
     d->stackSize = stackSize;
+    const QVector<QThreadPool *> nodePools = d->lockedNodePools();
+    for (QThreadPool *nodePool : nodePools)
+        nodePool->setStackSize(stackSize);
 }
 
 uint QThreadPool::stackSize() const
@@ -677,6 +921,90 @@ void QThreadPool::releaseThread()
     QMutexLocker locker(&d->mutex);
     --d->reservedThreads;
     d->tryToStartMoreThreads();
+    d->updateSpareThreads();
+}
+
+/*! \property QThreadPool::workStealingEnabled
+    \since 5.11
+
+    This property holds whether runnables started from the pool's own
+    threads are scheduled by those threads instead of the shared queue.
+
+    When enabled, calling start() with the default priority from within one
+    of this pool's threads pushes the runnable onto a deque owned by that
+    thread, without locking the pool. The thread runs the most recently
+    pushed runnable from its deque when it finishes the current one, and
+    threads without work steal the oldest runnables from the other threads'
+    deques. Runnables started from outside the pool, or with a non-zero
+    \a priority, still go through the shared queue, which the threads drain
+    before turning to their deques, so priorities keep their meaning there.
+    waitForDone(), tryTake() and clear() take the deques into account.
+
+    Starting the same auto-deleting QRunnable more than once at the same
+    time is not supported in this mode.
+
+    The default value is \c false.
+
+    \sa start()
+*/
+bool QThreadPool::isWorkStealingEnabled() const
+{
+    Q_D(const QThreadPool);
+    return d->workStealing.load() != 0;
+}
+
+void QThreadPool::setWorkStealingEnabled(bool enabled)
+{
+    Q_D(QThreadPool);
+    d->workStealing.storeRelease(enabled ? 1 : 0);
+}
+
+/*! \property QThreadPool::numaAware
+    \since 5.11
+
+    This property holds whether the pool keeps a sub-pool of threads for each
+    NUMA node of the system.
+
+    When enabled on a system with more than one NUMA node, runnables started
+    with startOnNumaNode() run on threads that are bound to the CPUs of that
+    node, so they work on memory that is local to them. Each node's threads
+    are limited to the number of CPUs in that node; maxThreadCount() only
+    applies to runnables started with start(). activeThreadCount(),
+    waitForDone(), clear() and tryTake() cover the sub-pools as well.
+
+    The sub-pools are created the first time the property is enabled and
+    are kept until the pool is destroyed; disabling the property only routes
+    new runnables back to the shared threads.
+
+    The default value is \c false.
+
+    \sa startOnNumaNode(), QThread::setNumaNode()
+*/
+bool QThreadPool::isNumaAware() const
+{
+    Q_D(const QThreadPool);
+    return d->numaAware.load() != 0;
+}
+
+void QThreadPool::setNumaAware(bool enabled)
+{
+    Q_D(QThreadPool);
+    if (enabled) {
+        QMutexLocker locker(&d->mutex);
+        if (d->nodePools.isEmpty()) {
+            const int nodeCount = QThread::numaNodeCount();
+            for (int node = 0; nodeCount > 1 && node < nodeCount; ++node) {
+                QThreadPool *nodePool = new QThreadPool(this);
+                QThreadPoolPrivate *nodeD = nodePool->d_func();
+                nodeD->numaNode = node;
+                nodeD->maxThreadCount = qMax(1, QThread::numaNodeCpus(node).size());
+                nodeD->expiryTimeout = d->expiryTimeout;
+                nodeD->stackSize = d->stackSize;
+                d->nodePools.append(nodePool);
+            }
+        }
+    }
+    d->numaAware.storeRelease(enabled ? 1 : 0);
 }
 
 /*!
@@ -688,7 +1016,16 @@ void QThreadPool::releaseThread()
 bool QThreadPool::waitForDone(int msecs)
 {
     Q_D(QThreadPool);
-    bool rc = d->waitForDone(msecs);
+    QElapsedTimer timer;
+    timer.start();
+    bool rc = true;
+    const QVector<QThreadPool *> nodePools = d->lockedNodePools();
+    for (QThreadPool *nodePool : nodePools)
+        rc = nodePool->waitForDone(msecs < 0 ? -1 : qMax<qint64>(0, msecs - timer.elapsed())) && rc;
+    if (!rc)
+        return false;
+
+    rc = d->waitForDone(msecs < 0 ? -1 : qMax<qint64>(0, msecs - timer.elapsed()));
     if (rc)
       d->reset();
     return rc;
@@ -707,6 +1044,9 @@ void QThreadPool::clear()
 {
     Q_D(QThreadPool);
     d->clear();
+    const QVector<QThreadPool *> nodePools = d->lockedNodePools();
+    for (QThreadPool *nodePool : nodePools)
+        nodePool->clear();
 }
 
 #if QT_DEPRECATED_SINCE(5, 9)
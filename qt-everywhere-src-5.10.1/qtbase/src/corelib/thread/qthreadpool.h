@@ -59,6 +59,8 @@ class Q_CORE_EXPORT QThreadPool : public QObject
     Q_PROPERTY(int maxThreadCount READ maxThreadCount WRITE setMaxThreadCount)
     Q_PROPERTY(int activeThreadCount READ activeThreadCount)
     Q_PROPERTY(uint stackSize READ stackSize WRITE setStackSize)
+    Q_PROPERTY(bool workStealingEnabled READ isWorkStealingEnabled WRITE setWorkStealingEnabled)
+    Q_PROPERTY(bool numaAware READ isNumaAware WRITE setNumaAware)
     friend class QFutureInterfaceBase;
 
 public:
@@ -69,6 +71,7 @@ public:
 
     void start(QRunnable *runnable, int priority = 0);
     bool tryStart(QRunnable *runnable);
+    void startOnNumaNode(int node, QRunnable *runnable, int priority = 0);
 
     int expiryTimeout() const;
     void setExpiryTimeout(int expiryTimeout);
@@ -81,6 +84,12 @@ public:
     void setStackSize(uint stackSize);
     uint stackSize() const;
 
+    bool isWorkStealingEnabled() const;
+    void setWorkStealingEnabled(bool enabled);
+
+    bool isNumaAware() const;
+    void setNumaAware(bool enabled);
+
     void reserveThread();
     void releaseThread();
 
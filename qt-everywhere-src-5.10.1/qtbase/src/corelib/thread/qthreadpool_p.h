@@ -57,6 +57,7 @@
 #include "QtCore/qwaitcondition.h"
 #include "QtCore/qset.h"
 #include "QtCore/qqueue.h"
+#include "QtCore/qatomic.h"
 #include "private/qobject_p.h"
 
 #ifndef QT_NO_THREAD
@@ -144,6 +145,104 @@ private:
     QRunnable *m_entries[MaxPageSize];
 };
 
+/*
+    Fixed size work-stealing deque (Chase-Lev) owned by one pool thread.
+
+    Only the owning thread calls push() and pop(); any thread may call steal()
+    and tryTake(). An entry is consumed by whoever manages to swap it out for a
+    nullptr, which lets tryTake() remove runnables from the middle of the deque
+    and makes the consumers skip over the resulting holes.
+*/
+class QWorkStealingQueue
+{
+public:
+    enum {
+        Capacity = 1024,
+        Mask = Capacity - 1
+    };
+
+    QWorkStealingQueue()
+        : m_top(0), m_bottom(0)
+    { }
+
+    bool isEmpty() const {
+        return qintptr(m_bottom.loadAcquire() - m_top.loadAcquire()) <= 0;
+    }
+
+    // owner only; returns false if the deque is full
+    bool push(QRunnable *runnable) {
+        Q_ASSERT(runnable != nullptr);
+        const quintptr b = m_bottom.load();
+        const quintptr t = m_top.loadAcquire();
+        if (qintptr(b - t) >= Capacity)
+            return false;
+        // the slot's previous entry may not have been claimed by its thief yet
+        if (m_entries[b & Mask].load() != nullptr)
+            return false;
+        m_entries[b & Mask].storeRelease(runnable);
+        m_bottom.storeRelease(b + 1);
+        return true;
+    }
+
+    // owner only; takes the most recently pushed runnable
+    QRunnable *pop() {
+        for (;;) {
+            quintptr b = m_bottom.load();
+            if (qintptr(b - m_top.loadAcquire()) <= 0)
+                return nullptr;
+            --b;
+            m_bottom.fetchAndStoreOrdered(b);
+            const quintptr t = m_top.loadAcquire();
+            const qintptr size = qintptr(b - t);
+            if (size < 0) {
+                m_bottom.storeRelease(t);
+                return nullptr;
+            }
+            if (size == 0) {
+                // last entry, race against the thieves for it
+                const bool won = m_top.testAndSetOrdered(t, t + 1);
+                m_bottom.storeRelease(t + 1);
+                if (!won)
+                    return nullptr;
+            }
+            if (QRunnable *runnable = m_entries[b & Mask].fetchAndStoreAcquire(nullptr))
+                return runnable;
+            // removed by tryTake(), try the next one
+        }
+    }
+
+    // any thread; takes the least recently pushed runnable
+    QRunnable *steal() {
+        for (;;) {
+            const quintptr t = m_top.loadAcquire();
+            // the ordered read pairs with the one in pop()
+            const quintptr b = m_bottom.fetchAndAddOrdered(0);
+            if (qintptr(b - t) <= 0)
+                return nullptr;
+            QRunnable *runnable = m_entries[t & Mask].loadAcquire();
+            if (!m_top.testAndSetOrdered(t, t + 1))
+                continue;
+            if (runnable && m_entries[t & Mask].testAndSetOrdered(runnable, nullptr))
+                return runnable;
+        }
+    }
+
+    // any thread
+    bool tryTake(QRunnable *runnable) {
+        const quintptr b = m_bottom.loadAcquire();
+        for (quintptr i = m_top.loadAcquire(); qintptr(b - i) > 0; ++i) {
+            if (m_entries[i & Mask].testAndSetOrdered(runnable, nullptr))
+                return true;
+        }
+        return false;
+    }
+
+private:
+    QAtomicInteger<quintptr> m_top;
+    QAtomicInteger<quintptr> m_bottom;
+    QAtomicPointer<QRunnable> m_entries[Capacity];
+};
+
 class QThreadPoolThread;
 class Q_CORE_EXPORT QThreadPoolPrivate : public QObjectPrivate
 {
@@ -167,6 +266,13 @@ public:
     void stealAndRunRunnable(QRunnable *runnable);
     void deletePageIfFinished(QueuePage *page);
 
+    bool tryPushLocal(QRunnable *runnable);
+    void updateSpareThreads();
+    void updateQueueHint();
+    void wakeOrStartThread(QThreadPoolThread *thread);
+    QRunnable *stealTask(QThreadPoolThread *thief);
+    bool tryTakeLocal(QRunnable *runnable);
+
     mutable QMutex mutex;
     QList<QThreadPoolThread *> allThreads;
     QQueue<QThreadPoolThread *> waitingThreads;
@@ -180,6 +286,25 @@ public:
     int activeThreads = 0;
     uint stackSize = 0;
     bool isExiting = false;
+
+    // work stealing mode; the atomics are read without holding the mutex
+    enum { MaxStealTargets = 256 };
+    QAtomicPointer<QThreadPoolThread> stealTargets[MaxStealTargets];
+    QAtomicInt stealTargetCount;
+    QAtomicInt spareThreads;
+    QAtomicInt queueNotEmpty;
+    QAtomicInt workStealing;
+
+    // NUMA-aware mode: one sub-pool per node, created on first use and kept
+    // until the pool is destroyed so that pointers to them stay valid
+    QVector<QThreadPool *> nodePools;
+    QVector<QThreadPool *> lockedNodePools() const
+    {
+        QMutexLocker locker(&mutex);
+        return nodePools;
+    }
+    QAtomicInt numaAware;
+    int numaNode = -1; // the node of a sub-pool's threads
 };
 
 QT_END_NAMESPACE
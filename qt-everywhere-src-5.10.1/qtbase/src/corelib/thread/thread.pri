@@ -24,6 +24,7 @@ HEADERS += thread/qmutex_p.h \
            thread/qmutexpool_p.h \
            thread/qfutureinterface_p.h \
            thread/qfuturewatcher_p.h \
+           thread/qlockprofiler_p.h \
            thread/qorderedmutexlocker_p.h \
            thread/qreadwritelock_p.h \
            thread/qthread_p.h \
@@ -34,6 +35,7 @@ SOURCES += thread/qatomic.cpp \
            thread/qresultstore.cpp \
            thread/qfutureinterface.cpp \
            thread/qfuturewatcher.cpp \
+           thread/qlockprofiler.cpp \
            thread/qmutex.cpp \
            thread/qreadwritelock.cpp \
            thread/qrunnable.cpp \
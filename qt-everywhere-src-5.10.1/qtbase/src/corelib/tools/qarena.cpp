@@ -0,0 +1,342 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qarena.h"
+#include "qarena_p.h"
+
+#include <stdlib.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QArena
+    \inmodule QtCore
+    \since 5.11
+    \brief The QArena class provides a monotonic memory arena for
+    short-lived containers.
+
+    \ingroup tools
+    \reentrant
+
+    QArena hands out memory from large blocks by incrementing a pointer, and
+    only gives it back to the system all at once, when the arena is released
+    or destroyed. This makes allocating memory much cheaper than with the
+    system allocator, and avoids contention on the allocator when many
+    threads create and destroy temporary objects at the same time.
+
+    Memory can be allocated from an arena directly, with allocate(). More
+    commonly, a QArenaScope makes an arena the current one for the thread;
+    while it exists, QVector, QString, QByteArray and the nodes of QHash
+    allocate their memory from the arena:
+
+    \code
+    void RequestHandler::handle(const Request &request)
+    {
+        QArena arena;
+        QArenaScope scope(&arena);
+
+        QHash<QString, QVector<int> > index;
+        ...
+    } // all the memory is released here
+    \endcode
+
+    Containers whose memory comes from an arena can be used as usual, but
+    they must not outlive it and must only be destroyed in the thread that
+    created the arena. This includes the implicitly shared copies of strings
+    and containers created while the arena was current; copy data that needs
+    to survive the arena in a scope without one (for instance, with a
+    QArenaScope constructed with a null arena).
+
+    QArena is not thread-safe; each thread should use its own arenas.
+
+    \sa QArenaScope
+*/
+
+/*!
+    \class QArenaScope
+    \inmodule QtCore
+    \since 5.11
+    \brief The QArenaScope class makes a QArena the current arena of a
+    thread.
+
+    \ingroup tools
+
+    While a QArenaScope exists, the containers created or resized in the
+    thread that created it allocate their memory from its arena. Scopes can
+    be nested; when a scope is destroyed, the arena that was current before
+    it becomes current again. A scope constructed with a null arena restores
+    the use of the system allocator.
+
+    \sa QArena
+*/
+
+struct QArenaBlock
+{
+    QArenaBlock *next;
+    size_t size;
+
+    char *data() { return reinterpret_cast<char *>(this + 1); }
+};
+
+// the largest block allocated when the arena grows on its own
+static const size_t MaximumBlockSize = 1024 * 1024;
+
+QBasicAtomicInt QArenaPrivate::liveArenas = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+#ifdef Q_COMPILER_THREAD_LOCAL
+namespace {
+struct QArenaThreadState
+{
+    QArena *current;
+    QArenaPrivate *arenas;
+};
+}
+
+static thread_local QArenaThreadState arenaThreadState = { nullptr, nullptr };
+#endif
+
+QArenaPrivate::QArenaPrivate(size_t initialBlockSize)
+    : q_ptr(0),
+      blocks(0),
+      ptr(0),
+      end(0),
+      nextBlockSize(qMax(initialBlockSize, size_t(256))),
+      allocated(0),
+      nextInThread(0)
+{
+}
+
+bool QArenaPrivate::addBlock(size_t minimumSize)
+{
+    size_t size = nextBlockSize;
+    if (size < minimumSize)
+        size = minimumSize;
+    else if (nextBlockSize < MaximumBlockSize)
+        nextBlockSize *= 2;
+
+    QArenaBlock *block = static_cast<QArenaBlock *>(::malloc(sizeof(QArenaBlock) + size));
+    if (!block)
+        return false;
+    block->next = blocks;
+    block->size = size;
+    blocks = block;
+    ptr = block->data();
+    end = ptr + size;
+    return true;
+}
+
+bool QArenaPrivate::contains(const void *p) const
+{
+    const char *c = static_cast<const char *>(p);
+    for (QArenaBlock *block = blocks; block; block = block->next) {
+        if (c >= block->data() && c < block->data() + block->size)
+            return true;
+    }
+    return false;
+}
+
+QArena *QArenaPrivate::currentArena()
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    return arenaThreadState.current;
+#else
+    return 0;
+#endif
+}
+
+// Returns the arena of this thread that \a ptr was allocated from, if any.
+QArena *QArenaPrivate::owner(const void *ptr)
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    for (QArenaPrivate *d = arenaThreadState.arenas; d; d = d->nextInThread) {
+        if (d->contains(ptr))
+            return d->q_ptr;
+    }
+#else
+    Q_UNUSED(ptr);
+#endif
+    return 0;
+}
+
+/*!
+    Constructs an empty arena. The first block of memory will be \a
+    initialBlockSize bytes large; the next ones grow up to 1 MB.
+
+    The block is allocated when the arena is used for the first time.
+*/
+QArena::QArena(size_t initialBlockSize)
+    : d_ptr(new QArenaPrivate(initialBlockSize))
+{
+    Q_D(QArena);
+    d->q_ptr = this;
+#ifdef Q_COMPILER_THREAD_LOCAL
+    d->nextInThread = arenaThreadState.arenas;
+    arenaThreadState.arenas = d;
+#endif
+    QArenaPrivate::liveArenas.ref();
+}
+
+/*!
+    Destroys the arena, releasing all the memory allocated from it.
+
+    \sa release()
+*/
+QArena::~QArena()
+{
+    Q_D(QArena);
+    release();
+#ifdef Q_COMPILER_THREAD_LOCAL
+    for (QArenaPrivate **p = &arenaThreadState.arenas; *p; p = &(*p)->nextInThread) {
+        if (*p == d) {
+            *p = d->nextInThread;
+            break;
+        }
+    }
+    if (arenaThreadState.current == this)
+        arenaThreadState.current = nullptr;
+#endif
+    QArenaPrivate::liveArenas.deref();
+}
+
+/*!
+    Returns a pointer to \a size bytes of memory, aligned to \a alignment
+    bytes, or a null pointer if the memory could not be allocated. \a
+    alignment must be a power of two.
+
+    The memory stays valid until the arena is released or destroyed.
+*/
+void *QArena::allocate(size_t size, size_t alignment)
+{
+    Q_D(QArena);
+    Q_ASSERT(alignment && !(alignment & (alignment - 1)));
+
+    char *p = reinterpret_cast<char *>((quintptr(d->ptr) + alignment - 1) & ~quintptr(alignment - 1));
+    if (!d->ptr || p > d->end || size > size_t(d->end - p)) {
+        if (!d->addBlock(size + alignment))
+            return 0;
+        p = reinterpret_cast<char *>((quintptr(d->ptr) + alignment - 1) & ~quintptr(alignment - 1));
+    }
+    d->ptr = p + size;
+    d->allocated += size;
+    return p;
+}
+
+/*!
+    Releases all the memory allocated from this arena at once. The arena
+    can be used again afterwards.
+
+    Any object using memory from the arena must have been destroyed before.
+*/
+void QArena::release()
+{
+    Q_D(QArena);
+    QArenaBlock *block = d->blocks;
+    while (block) {
+        QArenaBlock *next = block->next;
+        ::free(block);
+        block = next;
+    }
+    d->blocks = 0;
+    d->ptr = d->end = 0;
+    d->allocated = 0;
+}
+
+/*!
+    Returns \c true if \a ptr points to memory allocated from this arena;
+    otherwise returns \c false.
+*/
+bool QArena::contains(const void *ptr) const
+{
+    Q_D(const QArena);
+    return d->contains(ptr);
+}
+
+/*!
+    Returns the number of bytes allocated from this arena since it was
+    created or last released.
+*/
+size_t QArena::bytesAllocated() const
+{
+    Q_D(const QArena);
+    return d->allocated;
+}
+
+/*!
+    Returns the current arena of the calling thread, or a null pointer if
+    the containers allocate their memory from the system.
+
+    \note On compilers without support for \c thread_local, this function
+    always returns a null pointer, and QArenaScope has no effect.
+
+    \sa QArenaScope
+*/
+QArena *QArena::current()
+{
+    return QArenaPrivate::currentArena();
+}
+
+/*!
+    Makes \a arena the current arena of the calling thread, until this
+    scope is destroyed. \a arena must have been created in the same thread.
+    If \a arena is null, the containers allocate their memory from the
+    system while the scope exists.
+*/
+QArenaScope::QArenaScope(QArena *arena)
+    : previous(QArenaPrivate::currentArena()),
+      reserved(0)
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    arenaThreadState.current = arena;
+#else
+    Q_UNUSED(arena);
+#endif
+}
+
+/*!
+    Destroys the scope, making the arena that was current before it the
+    current arena again.
+*/
+QArenaScope::~QArenaScope()
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    arenaThreadState.current = previous;
+#endif
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,98 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QARENA_P_H
+#define QARENA_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/private/qglobal_p.h>
+#include <QtCore/qarena.h>
+#include <QtCore/qatomic.h>
+
+QT_BEGIN_NAMESPACE
+
+struct QArenaBlock;
+
+class QArenaPrivate
+{
+public:
+    explicit QArenaPrivate(size_t initialBlockSize);
+    Q_DECLARE_PUBLIC(QArena)
+
+    bool addBlock(size_t minimumSize);
+    bool contains(const void *ptr) const;
+
+    QArena *q_ptr;
+    QArenaBlock *blocks;
+    char *ptr;
+    char *end;
+    size_t nextBlockSize;
+    size_t allocated;
+
+    // the arenas alive in the thread that created this one
+    QArenaPrivate *nextInThread;
+
+    // the number of arenas alive in the process, so that the allocators of
+    // the containers only look for the thread's arenas when there are any
+    static QBasicAtomicInt liveArenas;
+
+    static QArena *currentArena();
+    static QArena *owner(const void *ptr);
+
+    // Used by the containers: the arena to allocate from, if any
+    static inline QArena *arenaForAllocation()
+    { return Q_UNLIKELY(liveArenas.load()) ? currentArena() : 0; }
+    // ... and the arena a block was allocated from, if any
+    static inline QArena *arenaOwning(const void *ptr)
+    { return Q_UNLIKELY(liveArenas.load()) ? owner(ptr) : 0; }
+};
+
+QT_END_NAMESPACE
+
+#endif // QARENA_P_H
@@ -39,10 +39,12 @@
 ****************************************************************************/
 
 #include <QtCore/qarraydata.h>
+#include <QtCore/private/qarena_p.h>
 #include <QtCore/private/qnumeric_p.h>
 #include <QtCore/private/qtools_p.h>
 
 #include <stdlib.h>
+#include <string.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -78,9 +80,17 @@ static inline size_t calculateBlockSize(size_t &capacity, size_t objectSize, siz
     }
 }
 
-static QArrayData *reallocateData(QArrayData *header, size_t allocSize, uint options)
+static QArrayData *reallocateData(QArrayData *header, size_t allocSize, size_t oldAllocSize, uint options)
 {
-    header = static_cast<QArrayData *>(::realloc(header, allocSize));
+    if (QArena *arena = QArenaPrivate::arenaOwning(header)) {
+        // arena memory is never freed on its own; move to a new block of the same arena
+        QArrayData *newHeader = static_cast<QArrayData *>(arena->allocate(allocSize, Q_ALIGNOF(QArrayData)));
+        if (newHeader)
+            ::memcpy(newHeader, header, qMin(allocSize, oldAllocSize));
+        header = newHeader;
+    } else {
+        header = static_cast<QArrayData *>(::realloc(header, allocSize));
+    }
     if (header)
         header->capacityReserved = bool(options & QArrayData::CapacityReserved);
     return header;
@@ -115,7 +125,9 @@ QArrayData *QArrayData::allocate(size_t objectSize, size_t alignment,
         return 0;
 
     size_t allocSize = calculateBlockSize(capacity, objectSize, headerSize, options);
-    QArrayData *header = static_cast<QArrayData *>(::malloc(allocSize));
+    QArena *arena = QArenaPrivate::arenaForAllocation();
+    QArrayData *header = static_cast<QArrayData *>(arena ? arena->allocate(allocSize, qMax(alignment, size_t(2 * sizeof(void *))))
+                                                         : ::malloc(allocSize));
     if (header) {
         quintptr data = (quintptr(header) + sizeof(QArrayData) + alignment - 1)
                 & ~(alignment - 1);
@@ -142,8 +154,9 @@ QArrayData *QArrayData::reallocateUnaligned(QArrayData *data, size_t objectSize,
     Q_ASSERT(!data->ref.isShared());
 
     size_t headerSize = sizeof(QArrayData);
+    const size_t oldAllocSize = headerSize + size_t(data->alloc) * objectSize;
     size_t allocSize = calculateBlockSize(capacity, objectSize, headerSize, options);
-    QArrayData *header = static_cast<QArrayData *>(reallocateData(data, allocSize, options));
+    QArrayData *header = static_cast<QArrayData *>(reallocateData(data, allocSize, oldAllocSize, options));
     if (header)
         header->alloc = capacity;
     return header;
@@ -164,6 +177,8 @@ void QArrayData::deallocate(QArrayData *data, size_t objectSize,
 
     Q_ASSERT_X(data == 0 || !data->ref.isStatic(), "QArrayData::deallocate",
                "Static data can not be deleted");
+    if (QArenaPrivate::arenaOwning(data))
+        return;
     ::free(data);
 }
 
@@ -3176,7 +3176,11 @@ QDataStream &operator>>(QDataStream &in, QByteArray &ba)
     if (len == 0xffffffff)
         return in;
 
-    const quint32 Step = 1024 * 1024;
+    // read in one go when the data is known to be there, such as from a
+    // QBuffer or a file; otherwise grow the array as the data arrives
+    const QIODevice *device = in.device();
+    const quint32 Step = device && !device->isSequential() && device->bytesAvailable() >= len
+            ? len : 1024 * 1024;
     quint32 allocated = 0;
 
     do {
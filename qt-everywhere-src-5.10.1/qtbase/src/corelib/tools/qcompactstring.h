@@ -0,0 +1,194 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QCOMPACTSTRING_H
+#define QCOMPACTSTRING_H
+
+#include <QtCore/qstring.h>
+#include <QtCore/qstringview.h>
+#include <QtCore/qhashfunctions.h>
+
+#include <new>
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+class QCompactString
+{
+public:
+    enum { InlineCapacity = 11 };
+
+    QCompactString() Q_DECL_NOTHROW { setInlineSize(0); }
+    QCompactString(const QString &str) { assign(str); }
+    QCompactString(QStringView str) { assign(str); }
+    QCompactString(QLatin1String str);
+    QCompactString(const QCompactString &other);
+#ifdef Q_COMPILER_RVALUE_REFS
+    QCompactString(QString &&str) Q_DECL_NOTHROW;
+    QCompactString(QCompactString &&other) Q_DECL_NOTHROW;
+    QCompactString &operator=(QCompactString &&other) Q_DECL_NOTHROW
+    { QCompactString moved(std::move(other)); swap(moved); return *this; }
+#endif
+    ~QCompactString() { if (isShared()) sharedString()->~QString(); }
+
+    QCompactString &operator=(const QCompactString &other)
+    { QCompactString copy(other); swap(copy); return *this; }
+
+    void swap(QCompactString &other) Q_DECL_NOTHROW
+    { qSwap(m_storage, other.m_storage); }
+
+    bool isInline() const Q_DECL_NOTHROW { return !isShared(); }
+    bool isEmpty() const Q_DECL_NOTHROW { return size() == 0; }
+    int size() const Q_DECL_NOTHROW
+    { return isShared() ? sharedString()->size() : int(m_storage.chars[InlineCapacity]); }
+    int length() const Q_DECL_NOTHROW { return size(); }
+
+    const QChar *constData() const Q_DECL_NOTHROW
+    { return isShared() ? sharedString()->constData() : reinterpret_cast<const QChar *>(m_storage.chars); }
+    const QChar *data() const Q_DECL_NOTHROW { return constData(); }
+    QChar at(int i) const { Q_ASSERT(uint(i) < uint(size())); return constData()[i]; }
+    QChar operator[](int i) const { return at(i); }
+
+    QStringView view() const Q_DECL_NOTHROW { return QStringView(constData(), size()); }
+    operator QStringView() const Q_DECL_NOTHROW { return view(); }
+    QString toString() const
+    { return isShared() ? *sharedString() : QString(constData(), size()); }
+
+    void clear() { QCompactString().swap(*this); }
+
+    friend bool operator==(const QCompactString &lhs, const QCompactString &rhs) Q_DECL_NOTHROW
+    { return lhs.size() == rhs.size() && QtPrivate::compareStrings(lhs.view(), rhs.view()) == 0; }
+    friend bool operator!=(const QCompactString &lhs, const QCompactString &rhs) Q_DECL_NOTHROW
+    { return !(lhs == rhs); }
+    friend bool operator<(const QCompactString &lhs, const QCompactString &rhs) Q_DECL_NOTHROW
+    { return QtPrivate::compareStrings(lhs.view(), rhs.view()) < 0; }
+    friend bool operator>(const QCompactString &lhs, const QCompactString &rhs) Q_DECL_NOTHROW
+    { return rhs < lhs; }
+    friend bool operator<=(const QCompactString &lhs, const QCompactString &rhs) Q_DECL_NOTHROW
+    { return !(rhs < lhs); }
+    friend bool operator>=(const QCompactString &lhs, const QCompactString &rhs) Q_DECL_NOTHROW
+    { return !(lhs < rhs); }
+
+private:
+    // Short strings are stored in the chars, with their size in the last
+    // element. Longer ones share the data of a QString constructed at the
+    // start of the storage, marked by SharedTag in the last element.
+    enum { SharedTag = 0xffff };
+    union Storage {
+        ushort chars[InlineCapacity + 1];
+        void *alignment;
+    } m_storage;
+
+    bool isShared() const Q_DECL_NOTHROW { return m_storage.chars[InlineCapacity] == SharedTag; }
+    QString *sharedString() Q_DECL_NOTHROW { return reinterpret_cast<QString *>(&m_storage); }
+    const QString *sharedString() const Q_DECL_NOTHROW
+    { return reinterpret_cast<const QString *>(&m_storage); }
+
+    void setInlineSize(int size) Q_DECL_NOTHROW { m_storage.chars[InlineCapacity] = ushort(size); }
+    void setShared(const QString &str)
+    { new (&m_storage) QString(str); m_storage.chars[InlineCapacity] = SharedTag; }
+
+    void assign(QStringView str)
+    {
+        if (str.size() <= InlineCapacity) {
+            memcpy(m_storage.chars, str.utf16(), str.size() * sizeof(ushort));
+            setInlineSize(int(str.size()));
+        } else {
+            setShared(str.toString());
+        }
+    }
+    void assign(const QString &str)
+    {
+        if (str.size() <= InlineCapacity)
+            assign(QStringView(str));
+        else
+            setShared(str);
+    }
+};
+
+Q_STATIC_ASSERT(sizeof(QString) <= sizeof(ushort) * QCompactString::InlineCapacity);
+
+Q_DECLARE_SHARED(QCompactString)
+
+inline QCompactString::QCompactString(QLatin1String str)
+{
+    if (str.size() <= InlineCapacity) {
+        const uchar *latin1 = reinterpret_cast<const uchar *>(str.data());
+        for (int i = 0; i < str.size(); ++i)
+            m_storage.chars[i] = latin1[i];
+        setInlineSize(str.size());
+    } else {
+        setShared(QString(str));
+    }
+}
+
+inline QCompactString::QCompactString(const QCompactString &other)
+{
+    if (other.isShared())
+        setShared(*other.sharedString());
+    else
+        m_storage = other.m_storage;
+}
+
+#ifdef Q_COMPILER_RVALUE_REFS
+inline QCompactString::QCompactString(QString &&str) Q_DECL_NOTHROW
+{
+    if (str.size() <= InlineCapacity) {
+        memcpy(m_storage.chars, str.utf16(), str.size() * sizeof(ushort));
+        setInlineSize(str.size());
+    } else {
+        new (&m_storage) QString(std::move(str));
+        m_storage.chars[InlineCapacity] = SharedTag;
+    }
+}
+
+inline QCompactString::QCompactString(QCompactString &&other) Q_DECL_NOTHROW
+    : m_storage(other.m_storage)
+{
+    // the QString, if any, is now owned by this object
+    other.setInlineSize(0);
+}
+#endif
+
+inline uint qHash(const QCompactString &key, uint seed = 0) Q_DECL_NOTHROW
+{ return qHash(key.view(), seed); }
+
+QT_END_NAMESPACE
+
+#endif // QCOMPACTSTRING_H
@@ -40,6 +40,10 @@
 
 #include <qcryptographichash.h>
 #include <qiodevice.h>
+#ifndef QT_BOOTSTRAPPED
+#include <qfiledevice.h>
+#endif
+#include <private/qsimd_p.h>
 
 #include "../../3rdparty/sha1/sha1.cpp"
 
@@ -164,6 +168,298 @@ static inline int SHA384_512AddLength(SHA512Context *context, unsigned int lengt
 
 QT_BEGIN_NAMESPACE
 
+#if defined(Q_PROCESSOR_X86) && QT_COMPILER_SUPPORTS_HERE(SHA) && !defined(QT_BOOTSTRAPPED)
+#  define QT_CRYPTOGRAPHICHASH_SHA_NI
+
+static inline bool hasShaExtensions()
+{
+    // the kernels below also need SSSE3 and SSE4.1, which every CPU with SHA has
+    return qCpuHasFeature(SHA) && qCpuHasFeature(SSE4_1);
+}
+
+/*
+    SHA-1 and SHA-256 compression functions using the Intel SHA extensions.
+    They follow the sample code in Intel's "New Instructions Supporting the
+    Secure Hash Algorithm on Intel Architecture Processors" (2013).
+*/
+#define QT_SHA1_ROUNDS(f, e, eNext, msg) \
+    e = _mm_sha1nexte_epu32(e, msg); \
+    eNext = abcd; \
+    abcd = _mm_sha1rnds4_epu32(abcd, e, f)
+
+QT_FUNCTION_TARGET(SHA)
+static void sha1ProcessBlocksShaNi(Sha1State *state, const unsigned char *data, qint64 blocks)
+{
+    const __m128i byteSwap = _mm_set_epi64x(Q_INT64_C(0x0001020304050607), Q_INT64_C(0x08090a0b0c0d0e0f));
+    __m128i abcd = _mm_set_epi32(state->h0, state->h1, state->h2, state->h3);
+    __m128i e0 = _mm_set_epi32(state->h4, 0, 0, 0);
+    __m128i e1;
+
+    for (; blocks > 0; --blocks, data += 64) {
+        const __m128i abcdSave = abcd;
+        const __m128i e0Save = e0;
+        __m128i m0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)), byteSwap);
+        __m128i m1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16)), byteSwap);
+        __m128i m2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 32)), byteSwap);
+        __m128i m3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 48)), byteSwap);
+
+        // rounds 0-15 use the message itself
+        e0 = _mm_add_epi32(e0, m0);
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+        QT_SHA1_ROUNDS(0, e1, e0, m1);
+        m0 = _mm_sha1msg1_epu32(m0, m1);
+        QT_SHA1_ROUNDS(0, e0, e1, m2);
+        m1 = _mm_sha1msg1_epu32(m1, m2);
+        m0 = _mm_xor_si128(m0, m2);
+        QT_SHA1_ROUNDS(0, e1, e0, m3);
+        m0 = _mm_sha1msg2_epu32(m0, m3);
+        m2 = _mm_sha1msg1_epu32(m2, m3);
+        m1 = _mm_xor_si128(m1, m3);
+
+        // rounds 16-79 interleave the message schedule
+        QT_SHA1_ROUNDS(0, e0, e1, m0);
+        m1 = _mm_sha1msg2_epu32(m1, m0);
+        m3 = _mm_sha1msg1_epu32(m3, m0);
+        m2 = _mm_xor_si128(m2, m0);
+        QT_SHA1_ROUNDS(1, e1, e0, m1);
+        m2 = _mm_sha1msg2_epu32(m2, m1);
+        m0 = _mm_sha1msg1_epu32(m0, m1);
+        m3 = _mm_xor_si128(m3, m1);
+        QT_SHA1_ROUNDS(1, e0, e1, m2);
+        m3 = _mm_sha1msg2_epu32(m3, m2);
+        m1 = _mm_sha1msg1_epu32(m1, m2);
+        m0 = _mm_xor_si128(m0, m2);
+        QT_SHA1_ROUNDS(1, e1, e0, m3);
+        m0 = _mm_sha1msg2_epu32(m0, m3);
+        m2 = _mm_sha1msg1_epu32(m2, m3);
+        m1 = _mm_xor_si128(m1, m3);
+        QT_SHA1_ROUNDS(1, e0, e1, m0);
+        m1 = _mm_sha1msg2_epu32(m1, m0);
+        m3 = _mm_sha1msg1_epu32(m3, m0);
+        m2 = _mm_xor_si128(m2, m0);
+        QT_SHA1_ROUNDS(1, e1, e0, m1);
+        m2 = _mm_sha1msg2_epu32(m2, m1);
+        m0 = _mm_sha1msg1_epu32(m0, m1);
+        m3 = _mm_xor_si128(m3, m1);
+        QT_SHA1_ROUNDS(2, e0, e1, m2);
+        m3 = _mm_sha1msg2_epu32(m3, m2);
+        m1 = _mm_sha1msg1_epu32(m1, m2);
+        m0 = _mm_xor_si128(m0, m2);
+        QT_SHA1_ROUNDS(2, e1, e0, m3);
+        m0 = _mm_sha1msg2_epu32(m0, m3);
+        m2 = _mm_sha1msg1_epu32(m2, m3);
+        m1 = _mm_xor_si128(m1, m3);
+        QT_SHA1_ROUNDS(2, e0, e1, m0);
+        m1 = _mm_sha1msg2_epu32(m1, m0);
+        m3 = _mm_sha1msg1_epu32(m3, m0);
+        m2 = _mm_xor_si128(m2, m0);
+        QT_SHA1_ROUNDS(2, e1, e0, m1);
+        m2 = _mm_sha1msg2_epu32(m2, m1);
+        m0 = _mm_sha1msg1_epu32(m0, m1);
+        m3 = _mm_xor_si128(m3, m1);
+        QT_SHA1_ROUNDS(2, e0, e1, m2);
+        m3 = _mm_sha1msg2_epu32(m3, m2);
+        m1 = _mm_sha1msg1_epu32(m1, m2);
+        m0 = _mm_xor_si128(m0, m2);
+        QT_SHA1_ROUNDS(3, e1, e0, m3);
+        m0 = _mm_sha1msg2_epu32(m0, m3);
+        m2 = _mm_sha1msg1_epu32(m2, m3);
+        m1 = _mm_xor_si128(m1, m3);
+        QT_SHA1_ROUNDS(3, e0, e1, m0);
+        m1 = _mm_sha1msg2_epu32(m1, m0);
+        m3 = _mm_sha1msg1_epu32(m3, m0);
+        m2 = _mm_xor_si128(m2, m0);
+        QT_SHA1_ROUNDS(3, e1, e0, m1);
+        m2 = _mm_sha1msg2_epu32(m2, m1);
+        m3 = _mm_xor_si128(m3, m1);
+        QT_SHA1_ROUNDS(3, e0, e1, m2);
+        m3 = _mm_sha1msg2_epu32(m3, m2);
+        QT_SHA1_ROUNDS(3, e1, e0, m3);
+
+        e0 = _mm_sha1nexte_epu32(e0, e0Save);
+        abcd = _mm_add_epi32(abcd, abcdSave);
+    }
+
+    state->h0 = _mm_extract_epi32(abcd, 3);
+    state->h1 = _mm_extract_epi32(abcd, 2);
+    state->h2 = _mm_extract_epi32(abcd, 1);
+    state->h3 = _mm_extract_epi32(abcd, 0);
+    state->h4 = _mm_extract_epi32(e0, 3);
+}
+
+#undef QT_SHA1_ROUNDS
+
+#ifndef QT_CRYPTOGRAPHICHASH_ONLY_SHA1
+Q_DECL_ALIGN(16) static const quint32 sha256RoundConstants[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#define QT_SHA256_ROUNDS(i, msg) \
+    tmp = _mm_add_epi32(msg, _mm_load_si128(reinterpret_cast<const __m128i *>(sha256RoundConstants + 4 * (i)))); \
+    state1 = _mm_sha256rnds2_epu32(state1, state0, tmp); \
+    state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(tmp, 0x0E))
+
+// completes the next four message words from the previous ones
+#define QT_SHA256_SCHEDULE(next, current, previous) \
+    next = _mm_sha256msg2_epu32(_mm_add_epi32(next, _mm_alignr_epi8(current, previous, 4)), current)
+
+QT_FUNCTION_TARGET(SHA)
+static void sha256ProcessBlocksShaNi(quint32 *hash, const unsigned char *data, qint64 blocks)
+{
+    const __m128i byteSwap = _mm_set_epi64x(Q_INT64_C(0x0c0d0e0f08090a0b), Q_INT64_C(0x0405060700010203));
+
+    // the instructions want the state as ABEF and CDGH
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hash)), 0xB1);
+    __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(hash + 4)), 0x1B);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    for (; blocks > 0; --blocks, data += 64) {
+        const __m128i state0Save = state0;
+        const __m128i state1Save = state1;
+        __m128i m0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)), byteSwap);
+        __m128i m1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16)), byteSwap);
+        __m128i m2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 32)), byteSwap);
+        __m128i m3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 48)), byteSwap);
+
+        QT_SHA256_ROUNDS(0, m0);
+        QT_SHA256_ROUNDS(1, m1);
+        m0 = _mm_sha256msg1_epu32(m0, m1);
+        QT_SHA256_ROUNDS(2, m2);
+        m1 = _mm_sha256msg1_epu32(m1, m2);
+        QT_SHA256_ROUNDS(3, m3);
+        QT_SHA256_SCHEDULE(m0, m3, m2);
+        m2 = _mm_sha256msg1_epu32(m2, m3);
+        for (int i = 4; i < 12; i += 4) {
+            QT_SHA256_ROUNDS(i, m0);
+            QT_SHA256_SCHEDULE(m1, m0, m3);
+            m3 = _mm_sha256msg1_epu32(m3, m0);
+            QT_SHA256_ROUNDS(i + 1, m1);
+            QT_SHA256_SCHEDULE(m2, m1, m0);
+            m0 = _mm_sha256msg1_epu32(m0, m1);
+            QT_SHA256_ROUNDS(i + 2, m2);
+            QT_SHA256_SCHEDULE(m3, m2, m1);
+            m1 = _mm_sha256msg1_epu32(m1, m2);
+            QT_SHA256_ROUNDS(i + 3, m3);
+            QT_SHA256_SCHEDULE(m0, m3, m2);
+            m2 = _mm_sha256msg1_epu32(m2, m3);
+        }
+        QT_SHA256_ROUNDS(12, m0);
+        QT_SHA256_SCHEDULE(m1, m0, m3);
+        m3 = _mm_sha256msg1_epu32(m3, m0);
+        QT_SHA256_ROUNDS(13, m1);
+        QT_SHA256_SCHEDULE(m2, m1, m0);
+        QT_SHA256_ROUNDS(14, m2);
+        QT_SHA256_SCHEDULE(m3, m2, m1);
+        QT_SHA256_ROUNDS(15, m3);
+
+        state0 = _mm_add_epi32(state0, state0Save);
+        state1 = _mm_add_epi32(state1, state1Save);
+    }
+
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(hash), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(hash + 4), state1);
+}
+
+#undef QT_SHA256_SCHEDULE
+#undef QT_SHA256_ROUNDS
+#endif // QT_CRYPTOGRAPHICHASH_ONLY_SHA1
+#endif // QT_CRYPTOGRAPHICHASH_SHA_NI
+
+static void sha1Input(Sha1State *state, const unsigned char *data, qint64 len)
+{
+#ifdef QT_CRYPTOGRAPHICHASH_SHA_NI
+    if (len >= 64 && hasShaExtensions()) {
+        // complete a partially buffered block first
+        const qint64 rest = qint64(state->messageSize & Q_UINT64_C(63));
+        if (rest) {
+            sha1Update(state, data, 64 - rest);
+            data += 64 - rest;
+            len -= 64 - rest;
+        }
+        const qint64 blocks = len / 64;
+        sha1ProcessBlocksShaNi(state, data, blocks);
+        state->messageSize += blocks * 64;
+        data += blocks * 64;
+        len -= blocks * 64;
+    }
+#endif
+    sha1Update(state, data, len);
+}
+
+#ifndef QT_CRYPTOGRAPHICHASH_ONLY_SHA1
+/*
+    SHA256Input() and SHA512Input() copy the message into the block buffer
+    one byte at a time. These hand the complete blocks in the middle of the
+    data to the compression functions directly.
+*/
+static void sha256Input(SHA256Context *context, const unsigned char *data, unsigned int length)
+{
+    if (context->Message_Block_Index) {
+        const unsigned int fill = qMin(length, unsigned(SHA256_Message_Block_Size - context->Message_Block_Index));
+        SHA256Input(context, data, fill);
+        data += fill;
+        length -= fill;
+    }
+
+    const unsigned int blocks = length / SHA256_Message_Block_Size;
+    if (blocks && !context->Computed && !context->Corrupted) {
+#ifdef QT_CRYPTOGRAPHICHASH_SHA_NI
+        if (hasShaExtensions()) {
+            sha256ProcessBlocksShaNi(context->Intermediate_Hash, data, blocks);
+        } else
+#endif
+        {
+            for (unsigned int i = 0; i < blocks; ++i) {
+                memcpy(context->Message_Block, data + i * SHA256_Message_Block_Size, SHA256_Message_Block_Size);
+                SHA224_256ProcessMessageBlock(context);
+            }
+        }
+        for (unsigned int i = 0; i < blocks; ++i)
+            SHA224_256AddLength(context, 8 * SHA256_Message_Block_Size);
+        data += blocks * SHA256_Message_Block_Size;
+        length -= blocks * SHA256_Message_Block_Size;
+    }
+
+    SHA256Input(context, data, length);
+}
+
+static void sha512Input(SHA512Context *context, const unsigned char *data, unsigned int length)
+{
+    if (context->Message_Block_Index) {
+        const unsigned int fill = qMin(length, unsigned(SHA512_Message_Block_Size - context->Message_Block_Index));
+        SHA512Input(context, data, fill);
+        data += fill;
+        length -= fill;
+    }
+
+    const unsigned int blocks = length / SHA512_Message_Block_Size;
+    if (blocks && !context->Computed && !context->Corrupted) {
+        for (unsigned int i = 0; i < blocks; ++i) {
+            memcpy(context->Message_Block, data + i * SHA512_Message_Block_Size, SHA512_Message_Block_Size);
+            SHA384_512ProcessMessageBlock(context);
+            SHA384_512AddLength(context, 8 * SHA512_Message_Block_Size);
+        }
+        data += blocks * SHA512_Message_Block_Size;
+        length -= blocks * SHA512_Message_Block_Size;
+    }
+
+    SHA512Input(context, data, length);
+}
+#endif // QT_CRYPTOGRAPHICHASH_ONLY_SHA1
+
 class QCryptographicHashPrivate
 {
 public:
@@ -359,7 +655,7 @@ void QCryptographicHash::addData(const char *data, int length)
 {
     switch (d->method) {
     case Sha1:
-        sha1Update(&d->sha1Context, (const unsigned char *)data, length);
+        sha1Input(&d->sha1Context, (const unsigned char *)data, length);
         break;
 #ifdef QT_CRYPTOGRAPHICHASH_ONLY_SHA1
     default:
@@ -374,16 +670,16 @@ void QCryptographicHash::addData(const char *data, int length)
         MD5Update(&d->md5Context, (const unsigned char *)data, length);
         break;
     case Sha224:
-        SHA224Input(&d->sha224Context, reinterpret_cast<const unsigned char *>(data), length);
+        sha256Input(&d->sha224Context, reinterpret_cast<const unsigned char *>(data), length);
         break;
     case Sha256:
-        SHA256Input(&d->sha256Context, reinterpret_cast<const unsigned char *>(data), length);
+        sha256Input(&d->sha256Context, reinterpret_cast<const unsigned char *>(data), length);
         break;
     case Sha384:
-        SHA384Input(&d->sha384Context, reinterpret_cast<const unsigned char *>(data), length);
+        sha512Input(&d->sha384Context, reinterpret_cast<const unsigned char *>(data), length);
         break;
     case Sha512:
-        SHA512Input(&d->sha512Context, reinterpret_cast<const unsigned char *>(data), length);
+        sha512Input(&d->sha512Context, reinterpret_cast<const unsigned char *>(data), length);
         break;
     case RealSha3_224:
     case Keccak_224:
@@ -418,6 +714,9 @@ void QCryptographicHash::addData(const QByteArray &data)
   Reads the data from the open QIODevice \a device until it ends
   and hashes it. Returns \c true if reading was successful.
   \since 5.0
+
+  Since Qt 5.11, the rest of a file opened in binary mode is memory
+  mapped and hashed in place, if possible.
  */
 bool QCryptographicHash::addData(QIODevice* device)
 {
@@ -427,7 +726,26 @@ bool QCryptographicHash::addData(QIODevice* device)
     if (!device->isOpen())
         return false;
 
-    char buffer[1024];
+#ifndef QT_BOOTSTRAPPED
+    QFileDevice *file = qobject_cast<QFileDevice *>(device);
+    if (file && !file->isSequential() && !(file->openMode() & QIODevice::Text)) {
+        const qint64 pos = file->pos();
+        const qint64 size = file->size() - pos;
+        if (size > 0) {
+            if (uchar *data = file->map(pos, size)) {
+                for (qint64 offset = 0; offset < size; ) {
+                    const int length = int(qMin<qint64>(size - offset, 1 << 30));
+                    addData(reinterpret_cast<const char *>(data + offset), length);
+                    offset += length;
+                }
+                file->unmap(data);
+                return file->seek(pos + size);
+            }
+        }
+    }
+#endif
+
+    char buffer[16 * 1024];
     int length;
 
     while ((length = device->read(buffer,sizeof(buffer))) > 0)
@@ -0,0 +1,813 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QFLATHASH_H
+#define QFLATHASH_H
+
+#include <QtCore/qhash.h>
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qrefcount.h>
+
+#ifdef Q_COMPILER_INITIALIZER_LISTS
+#include <initializer_list>
+#endif
+
+#include <iterator>
+#include <new>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+namespace QFlatHashPrivate {
+
+// Control bytes: a non-negative value marks a used slot and holds seven
+// bits of the key's hash, the negative values mark free slots.
+enum {
+    Empty = -128,
+    Deleted = -2,
+    GroupSize = 16
+};
+
+// The 16 control bytes of an aligned group of slots, matched as a whole.
+#if defined(__SSE2__)
+struct Group
+{
+    explicit Group(const signed char *ctrl) Q_DECL_NOTHROW
+        : bytes(_mm_load_si128(reinterpret_cast<const __m128i *>(ctrl)))
+    {}
+
+    uint match(signed char h2) const Q_DECL_NOTHROW
+    { return uint(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(h2)))); }
+    uint matchEmpty() const Q_DECL_NOTHROW
+    { return match(static_cast<signed char>(Empty)); }
+    uint matchFree() const Q_DECL_NOTHROW
+    { return uint(_mm_movemask_epi8(bytes)); }
+    uint matchUsed() const Q_DECL_NOTHROW
+    { return ~matchFree() & 0xffff; }
+
+    __m128i bytes;
+};
+#else
+struct Group
+{
+    explicit Group(const signed char *ctrl) Q_DECL_NOTHROW
+        : bytes(ctrl)
+    {}
+
+    uint match(signed char h2) const Q_DECL_NOTHROW
+    {
+        uint mask = 0;
+        for (int i = 0; i < GroupSize; ++i)
+            mask |= uint(bytes[i] == h2) << i;
+        return mask;
+    }
+    uint matchEmpty() const Q_DECL_NOTHROW
+    { return match(static_cast<signed char>(Empty)); }
+    uint matchFree() const Q_DECL_NOTHROW
+    {
+        uint mask = 0;
+        for (int i = 0; i < GroupSize; ++i)
+            mask |= uint(bytes[i] < 0) << i;
+        return mask;
+    }
+    uint matchUsed() const Q_DECL_NOTHROW
+    { return ~matchFree() & 0xffff; }
+
+    const signed char *bytes;
+};
+#endif
+
+struct Data
+{
+    QtPrivate::RefCount ref;
+    int size;
+    int capacity;       // a power of two, at least GroupSize
+    int growthLeft;     // inserts into empty slots left before a rehash
+    uint seed;
+    signed char *ctrl;  // aligned to GroupSize
+    void *nodeData;
+
+    static int maxLoad(int capacity) Q_DECL_NOTHROW { return capacity - capacity / 8; }
+
+    int nextUsed(int i) const Q_DECL_NOTHROW
+    {
+        ++i;
+        while (i < capacity) {
+            const int group = i & ~(GroupSize - 1);
+            const uint used = Group(ctrl + group).matchUsed() >> (i - group);
+            if (used)
+                return i + int(qCountTrailingZeroBits(used));
+            i = group + GroupSize;
+        }
+        return capacity;
+    }
+};
+
+} // namespace QFlatHashPrivate
+
+template <class Key, class T>
+struct QFlatHashNode
+{
+    QFlatHashNode(const Key &k, const T &v) : key(k), value(v) {}
+#ifdef Q_COMPILER_RVALUE_REFS
+    QFlatHashNode(Key &&k, const T &v) : key(std::move(k)), value(v) {}
+#endif
+
+    Key key;
+    T value;
+};
+
+// Specialize for QHashDummyValue in order to save some memory
+template <class Key>
+struct QFlatHashNode<Key, QHashDummyValue>
+{
+    QFlatHashNode(const Key &k, const QHashDummyValue &) : key(k) {}
+#ifdef Q_COMPILER_RVALUE_REFS
+    QFlatHashNode(Key &&k, const QHashDummyValue &) : key(std::move(k)) {}
+#endif
+
+    Key key;
+    static QHashDummyValue value;   // stateless, shared by all nodes
+};
+
+template <class Key>
+QHashDummyValue QFlatHashNode<Key, QHashDummyValue>::value;
+
+template <class Key, class T>
+class QFlatHash
+{
+    typedef QFlatHashPrivate::Data Data;
+    typedef QFlatHashNode<Key, T> Node;
+
+    Data *d;
+
+public:
+    inline QFlatHash() Q_DECL_NOTHROW : d(nullptr) {}
+#ifdef Q_COMPILER_INITIALIZER_LISTS
+    inline QFlatHash(std::initializer_list<std::pair<Key, T> > list)
+        : d(nullptr)
+    {
+        reserve(int(list.size()));
+        for (typename std::initializer_list<std::pair<Key, T> >::const_iterator it = list.begin(); it != list.end(); ++it)
+            insert(it->first, it->second);
+    }
+#endif
+    inline QFlatHash(const QFlatHash &other) : d(other.d) { if (d) d->ref.ref(); }
+    inline ~QFlatHash() { if (d && !d->ref.deref()) freeData(d); }
+
+    QFlatHash &operator=(const QFlatHash &other)
+    {
+        if (d != other.d) {
+            Data *o = other.d;
+            if (o)
+                o->ref.ref();
+            if (d && !d->ref.deref())
+                freeData(d);
+            d = o;
+        }
+        return *this;
+    }
+#ifdef Q_COMPILER_RVALUE_REFS
+    QFlatHash(QFlatHash &&other) Q_DECL_NOTHROW : d(other.d) { other.d = nullptr; }
+    QFlatHash &operator=(QFlatHash &&other) Q_DECL_NOTHROW
+    { QFlatHash moved(std::move(other)); swap(moved); return *this; }
+#endif
+    void swap(QFlatHash &other) Q_DECL_NOTHROW { qSwap(d, other.d); }
+
+    bool operator==(const QFlatHash &other) const;
+    inline bool operator!=(const QFlatHash &other) const { return !(*this == other); }
+
+    inline int size() const Q_DECL_NOTHROW { return d ? d->size : 0; }
+    inline int count() const Q_DECL_NOTHROW { return size(); }
+    inline bool isEmpty() const Q_DECL_NOTHROW { return size() == 0; }
+    inline int capacity() const Q_DECL_NOTHROW { return d ? Data::maxLoad(d->capacity) : 0; }
+    void reserve(int size);
+    void squeeze() { rehash(size()); }
+
+    inline void detach() { if (d && d->ref.isShared()) detach_helper(); }
+    inline bool isDetached() const Q_DECL_NOTHROW { return !d || !d->ref.isShared(); }
+    inline bool isSharedWith(const QFlatHash &other) const Q_DECL_NOTHROW { return d == other.d; }
+
+    void clear() { *this = QFlatHash(); }
+
+    int remove(const Key &key);
+    T take(const Key &key);
+
+    bool contains(const Key &key) const { return findNode(key) >= 0; }
+    const T value(const Key &key) const;
+    const T value(const Key &key, const T &defaultValue) const;
+    T &operator[](const Key &key);
+    const T operator[](const Key &key) const { return value(key); }
+
+    QList<Key> keys() const;
+    QList<T> values() const;
+
+    class const_iterator;
+
+    class iterator
+    {
+        friend class const_iterator;
+        friend class QFlatHash<Key, T>;
+        Data *d;
+        int i;
+        inline iterator(Data *data, int index) : d(data), i(index) {}
+        inline Node *node() const { return static_cast<Node *>(d->nodeData) + i; }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef T *pointer;
+        typedef T &reference;
+
+        inline iterator() : d(nullptr), i(0) {}
+
+        inline const Key &key() const { return node()->key; }
+        inline T &value() const { return node()->value; }
+        inline T &operator*() const { return node()->value; }
+        inline T *operator->() const { return &node()->value; }
+        inline bool operator==(const iterator &o) const { return i == o.i && d == o.d; }
+        inline bool operator!=(const iterator &o) const { return !(*this == o); }
+        inline bool operator==(const const_iterator &o) const { return i == o.i && d == o.d; }
+        inline bool operator!=(const const_iterator &o) const { return !(*this == o); }
+
+        inline iterator &operator++() { i = d->nextUsed(i); return *this; }
+        inline iterator operator++(int) { iterator r = *this; ++*this; return r; }
+    };
+    friend class iterator;
+
+    class const_iterator
+    {
+        friend class iterator;
+        friend class QFlatHash<Key, T>;
+        const Data *d;
+        int i;
+        inline const_iterator(const Data *data, int index) : d(data), i(index) {}
+        inline const Node *node() const { return static_cast<const Node *>(d->nodeData) + i; }
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        Q_DECL_CONSTEXPR inline const_iterator() : d(nullptr), i(0) {}
+        inline const_iterator(const iterator &o) : d(o.d), i(o.i) {}
+
+        inline const Key &key() const { return node()->key; }
+        inline const T &value() const { return node()->value; }
+        inline const T &operator*() const { return node()->value; }
+        inline const T *operator->() const { return &node()->value; }
+        inline bool operator==(const const_iterator &o) const { return i == o.i && d == o.d; }
+        inline bool operator!=(const const_iterator &o) const { return !(*this == o); }
+
+        inline const_iterator &operator++() { i = d->nextUsed(i); return *this; }
+        inline const_iterator operator++(int) { const_iterator r = *this; ++*this; return r; }
+    };
+    friend class const_iterator;
+
+    inline iterator begin() { detach(); return d ? iterator(d, d->nextUsed(-1)) : iterator(); }
+    inline const_iterator begin() const Q_DECL_NOTHROW { return constBegin(); }
+    inline const_iterator cbegin() const Q_DECL_NOTHROW { return constBegin(); }
+    inline const_iterator constBegin() const Q_DECL_NOTHROW
+    { return d ? const_iterator(d, d->nextUsed(-1)) : const_iterator(); }
+    inline iterator end() { detach(); return d ? iterator(d, d->capacity) : iterator(); }
+    inline const_iterator end() const Q_DECL_NOTHROW { return constEnd(); }
+    inline const_iterator cend() const Q_DECL_NOTHROW { return constEnd(); }
+    inline const_iterator constEnd() const Q_DECL_NOTHROW
+    { return d ? const_iterator(d, d->capacity) : const_iterator(); }
+
+    iterator erase(const_iterator it);
+    iterator erase(iterator it) { return erase(const_iterator(it)); }
+
+    iterator find(const Key &key);
+    const_iterator find(const Key &key) const { return constFind(key); }
+    const_iterator constFind(const Key &key) const;
+    iterator insert(const Key &key, const T &value);
+
+    // STL compatibility
+    typedef T mapped_type;
+    typedef Key key_type;
+    typedef qptrdiff difference_type;
+    typedef int size_type;
+
+    inline bool empty() const Q_DECL_NOTHROW { return isEmpty(); }
+
+private:
+    static void hashKey(const Key &key, uint seed, uint *h1, signed char *h2)
+    {
+        // qHash() results are often sequential or have weak low bits,
+        // spread them over the whole word before using them
+        const quint64 h = quint64(qHash(key, seed)) * Q_UINT64_C(0x9e3779b97f4a7c15);
+        *h1 = uint(h >> 32);
+        *h2 = static_cast<signed char>(h & 0x7f);
+    }
+
+    inline Node *nodes() const { return static_cast<Node *>(d->nodeData); }
+
+    static Data *allocate(int capacity, uint seed);
+    static void freeData(Data *x);
+    static int capacityFor(int size);
+    static int findFreeSlot(const Data *x, uint h1);
+    void detach_helper();
+    void rehash(int size);
+    int findNode(const Key &key) const;
+    int insertNode(const Key &key, const T &value, bool *inserted);
+    void eraseAt(int i);
+};
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE typename QFlatHashPrivate::Data *QFlatHash<Key, T>::allocate(int capacity, uint seed)
+{
+    using namespace QFlatHashPrivate;
+    const size_t ctrlOffset = (sizeof(Data) + GroupSize - 1) & ~size_t(GroupSize - 1);
+    const size_t nodeOffset = (ctrlOffset + size_t(capacity) + Q_ALIGNOF(Node) - 1)
+            & ~size_t(Q_ALIGNOF(Node) - 1);
+    char *block = static_cast<char *>(::operator new(nodeOffset + size_t(capacity) * sizeof(Node)));
+    Data *x = new (block) Data;
+    x->ref.initializeOwned();
+    x->size = 0;
+    x->capacity = capacity;
+    x->growthLeft = Data::maxLoad(capacity);
+    x->seed = seed;
+    x->ctrl = reinterpret_cast<signed char *>(block + ctrlOffset);
+    x->nodeData = block + nodeOffset;
+    memset(x->ctrl, Empty, size_t(capacity));
+    return x;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE void QFlatHash<Key, T>::freeData(Data *x)
+{
+    if (QTypeInfo<Node>::isComplex) {
+        Node *n = static_cast<Node *>(x->nodeData);
+        for (int i = x->nextUsed(-1); i < x->capacity; i = x->nextUsed(i))
+            n[i].~Node();
+    }
+    x->~Data();
+    ::operator delete(x);
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE int QFlatHash<Key, T>::capacityFor(int size)
+{
+    int capacity = QFlatHashPrivate::GroupSize;
+    while (Data::maxLoad(capacity) < size)
+        capacity *= 2;
+    return capacity;
+}
+
+/*
+    Returns the first free slot in the probe sequence for h1. The groups
+    are probed quadratically, which visits all of them since their number
+    is a power of two.
+*/
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE int QFlatHash<Key, T>::findFreeSlot(const Data *x, uint h1)
+{
+    using namespace QFlatHashPrivate;
+    const uint groupMask = uint(x->capacity / GroupSize - 1);
+    uint group = h1 & groupMask;
+    for (uint step = 1; ; ++step) {
+        const uint free = Group(x->ctrl + group * GroupSize).matchFree();
+        if (free)
+            return int(group * GroupSize + qCountTrailingZeroBits(free));
+        group = (group + step) & groupMask;
+    }
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE void QFlatHash<Key, T>::detach_helper()
+{
+    Data *x = allocate(d->capacity, d->seed);
+    Node *src = nodes();
+    Node *dst = static_cast<Node *>(x->nodeData);
+    QT_TRY {
+        for (int i = d->nextUsed(-1); i < d->capacity; i = d->nextUsed(i)) {
+            new (dst + i) Node(src[i]);
+            x->ctrl[i] = d->ctrl[i];
+            ++x->size;
+        }
+    } QT_CATCH(...) {
+        freeData(x);
+        QT_RETHROW;
+    }
+    // keep the deleted markers, the probe sequences depend on them
+    memcpy(x->ctrl, d->ctrl, size_t(d->capacity));
+    x->growthLeft = d->growthLeft;
+    if (!d->ref.deref())
+        freeData(d);
+    d = x;
+}
+
+/*
+    Moves the entries into a table large enough for \a size entries. This
+    also drops the deleted markers.
+*/
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE void QFlatHash<Key, T>::rehash(int size)
+{
+    using namespace QFlatHashPrivate;
+    if (size == 0 && isEmpty()) {
+        clear();
+        return;
+    }
+    const uint seed = d ? d->seed : uint(qGlobalQHashSeed());
+    Data *x = allocate(capacityFor(qMax(size, this->size())), seed);
+    if (!d) {
+        d = x;
+        return;
+    }
+
+    const bool shared = d->ref.isShared();
+    Node *src = nodes();
+    Node *dst = static_cast<Node *>(x->nodeData);
+    QT_TRY {
+        for (int i = d->nextUsed(-1); i < d->capacity; i = d->nextUsed(i)) {
+            uint h1;
+            signed char h2;
+            hashKey(src[i].key, seed, &h1, &h2);
+            const int slot = findFreeSlot(x, h1);
+            if (shared) {
+                new (dst + slot) Node(src[i]);
+            } else {
+#ifdef Q_COMPILER_RVALUE_REFS
+                new (dst + slot) Node(std::move(src[i]));
+#else
+                new (dst + slot) Node(src[i]);
+#endif
+                src[i].~Node();
+                d->ctrl[i] = Deleted;
+                --d->size;
+            }
+            x->ctrl[slot] = h2;
+            ++x->size;
+            --x->growthLeft;
+        }
+    } QT_CATCH(...) {
+        freeData(x);
+        QT_RETHROW;
+    }
+    if (!d->ref.deref())
+        freeData(d);
+    d = x;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE void QFlatHash<Key, T>::reserve(int size)
+{
+    if (size > capacity() || (d && d->ref.isShared()))
+        rehash(size);
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE int QFlatHash<Key, T>::findNode(const Key &key) const
+{
+    using namespace QFlatHashPrivate;
+    if (!d || !d->size)
+        return -1;
+    uint h1;
+    signed char h2;
+    hashKey(key, d->seed, &h1, &h2);
+    const uint groupMask = uint(d->capacity / GroupSize - 1);
+    const Node *n = nodes();
+    uint group = h1 & groupMask;
+    for (uint step = 1; ; ++step) {
+        const Group g(d->ctrl + group * GroupSize);
+        for (uint match = g.match(h2); match; match &= match - 1) {
+            const int i = int(group * GroupSize + qCountTrailingZeroBits(match));
+            if (n[i].key == key)
+                return i;
+        }
+        if (g.matchEmpty())
+            return -1;
+        group = (group + step) & groupMask;
+    }
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE int QFlatHash<Key, T>::insertNode(const Key &key, const T &value, bool *inserted)
+{
+    using namespace QFlatHashPrivate;
+    detach();
+    int i = findNode(key);
+    if (i >= 0) {
+        *inserted = false;
+        return i;
+    }
+
+    if (!d)
+        rehash(1);
+    uint h1;
+    signed char h2;
+    hashKey(key, d->seed, &h1, &h2);
+    i = findFreeSlot(d, h1);
+    if (d->ctrl[i] == Empty && d->growthLeft == 0) {
+        // reuse the space taken by deleted markers before growing
+        rehash(d->size < Data::maxLoad(d->capacity) / 2 ? d->size : 2 * d->size + 1);
+        i = findFreeSlot(d, h1);
+    }
+
+    new (nodes() + i) Node(key, value);
+    if (d->ctrl[i] == Empty)
+        --d->growthLeft;
+    d->ctrl[i] = h2;
+    ++d->size;
+    *inserted = true;
+    return i;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE void QFlatHash<Key, T>::eraseAt(int i)
+{
+    using namespace QFlatHashPrivate;
+    nodes()[i].~Node();
+    // a probe sequence only continues past a group without empty slots,
+    // so if there is one in this group, no sequence depends on the slot
+    const int group = i & ~(GroupSize - 1);
+    if (Group(d->ctrl + group).matchEmpty()) {
+        d->ctrl[i] = static_cast<signed char>(Empty);
+        ++d->growthLeft;
+    } else {
+        d->ctrl[i] = static_cast<signed char>(Deleted);
+    }
+    --d->size;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE const T QFlatHash<Key, T>::value(const Key &key) const
+{
+    const int i = findNode(key);
+    return i >= 0 ? nodes()[i].value : T();
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE const T QFlatHash<Key, T>::value(const Key &key, const T &defaultValue) const
+{
+    const int i = findNode(key);
+    return i >= 0 ? nodes()[i].value : defaultValue;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE T &QFlatHash<Key, T>::operator[](const Key &key)
+{
+    bool inserted;
+    const int i = insertNode(key, T(), &inserted);
+    return nodes()[i].value;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE typename QFlatHash<Key, T>::iterator QFlatHash<Key, T>::insert(const Key &key, const T &value)
+{
+    bool inserted;
+    const int i = insertNode(key, value, &inserted);
+    if (!inserted)
+        nodes()[i].value = value;
+    return iterator(d, i);
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE int QFlatHash<Key, T>::remove(const Key &key)
+{
+    if (isEmpty()) // prevents detaching shared null
+        return 0;
+    detach();
+    const int i = findNode(key);
+    if (i < 0)
+        return 0;
+    eraseAt(i);
+    return 1;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE T QFlatHash<Key, T>::take(const Key &key)
+{
+    if (isEmpty()) // prevents detaching shared null
+        return T();
+    detach();
+    const int i = findNode(key);
+    if (i < 0)
+        return T();
+#ifdef Q_COMPILER_RVALUE_REFS
+    T t = std::move(nodes()[i].value);
+#else
+    T t = nodes()[i].value;
+#endif
+    eraseAt(i);
+    return t;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE typename QFlatHash<Key, T>::iterator QFlatHash<Key, T>::erase(const_iterator it)
+{
+    Q_ASSERT_X(it.d == d, "QFlatHash::erase", "The specified iterator argument 'it' is invalid");
+    if (!d || it.i >= d->capacity)
+        return end();
+    int i = it.i;
+    if (d->ref.isShared()) {
+        // the iterator points into the shared copy, find the same slot after detaching
+        detach();
+    }
+    eraseAt(i);
+    return iterator(d, d->nextUsed(i));
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE typename QFlatHash<Key, T>::iterator QFlatHash<Key, T>::find(const Key &key)
+{
+    detach();
+    const int i = findNode(key);
+    return i >= 0 ? iterator(d, i) : end();
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE typename QFlatHash<Key, T>::const_iterator QFlatHash<Key, T>::constFind(const Key &key) const
+{
+    const int i = findNode(key);
+    return i >= 0 ? const_iterator(d, i) : constEnd();
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE QList<Key> QFlatHash<Key, T>::keys() const
+{
+    QList<Key> res;
+    res.reserve(size());
+    for (const_iterator it = constBegin(), e = constEnd(); it != e; ++it)
+        res.append(it.key());
+    return res;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE QList<T> QFlatHash<Key, T>::values() const
+{
+    QList<T> res;
+    res.reserve(size());
+    for (const_iterator it = constBegin(), e = constEnd(); it != e; ++it)
+        res.append(it.value());
+    return res;
+}
+
+template <class Key, class T>
+Q_OUTOFLINE_TEMPLATE bool QFlatHash<Key, T>::operator==(const QFlatHash &other) const
+{
+    if (size() != other.size())
+        return false;
+    if (d == other.d)
+        return true;
+    for (const_iterator it = constBegin(), e = constEnd(); it != e; ++it) {
+        const const_iterator o = other.constFind(it.key());
+        if (o == other.constEnd() || !(o.value() == it.value()))
+            return false;
+    }
+    return true;
+}
+
+template <class T>
+class QFlatSet
+{
+    typedef QFlatHash<T, QHashDummyValue> Hash;
+
+public:
+    inline QFlatSet() Q_DECL_NOTHROW {}
+#ifdef Q_COMPILER_INITIALIZER_LISTS
+    inline QFlatSet(std::initializer_list<T> list)
+    {
+        reserve(int(list.size()));
+        for (typename std::initializer_list<T>::const_iterator it = list.begin(); it != list.end(); ++it)
+            insert(*it);
+    }
+#endif
+    // compiler-generated copy/move ctor/assignment operators are fine!
+    // compiler-generated destructor is fine!
+
+    inline void swap(QFlatSet<T> &other) Q_DECL_NOTHROW { q_hash.swap(other.q_hash); }
+
+    inline bool operator==(const QFlatSet<T> &other) const { return q_hash == other.q_hash; }
+    inline bool operator!=(const QFlatSet<T> &other) const { return q_hash != other.q_hash; }
+
+    inline int size() const Q_DECL_NOTHROW { return q_hash.size(); }
+    inline int count() const Q_DECL_NOTHROW { return q_hash.count(); }
+    inline bool isEmpty() const Q_DECL_NOTHROW { return q_hash.isEmpty(); }
+    inline int capacity() const Q_DECL_NOTHROW { return q_hash.capacity(); }
+    inline void reserve(int size) { q_hash.reserve(size); }
+    inline void squeeze() { q_hash.squeeze(); }
+
+    inline void detach() { q_hash.detach(); }
+    inline bool isDetached() const Q_DECL_NOTHROW { return q_hash.isDetached(); }
+
+    inline void clear() { q_hash.clear(); }
+
+    inline bool remove(const T &value) { return q_hash.remove(value) != 0; }
+    inline bool contains(const T &value) const { return q_hash.contains(value); }
+
+    class const_iterator
+    {
+        typedef typename Hash::const_iterator HashConstIterator;
+        HashConstIterator i;
+        friend class QFlatSet<T>;
+
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef qptrdiff difference_type;
+        typedef T value_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        inline const_iterator() {}
+        inline const_iterator(const HashConstIterator &o) : i(o) {}
+
+        inline const T &operator*() const { return i.key(); }
+        inline const T *operator->() const { return &i.key(); }
+        inline bool operator==(const const_iterator &o) const { return i == o.i; }
+        inline bool operator!=(const const_iterator &o) const { return i != o.i; }
+        inline const_iterator &operator++() { ++i; return *this; }
+        inline const_iterator operator++(int) { const_iterator r = *this; ++i; return r; }
+    };
+    typedef const_iterator iterator;
+
+    inline const_iterator begin() const Q_DECL_NOTHROW { return q_hash.constBegin(); }
+    inline const_iterator cbegin() const Q_DECL_NOTHROW { return q_hash.constBegin(); }
+    inline const_iterator constBegin() const Q_DECL_NOTHROW { return q_hash.constBegin(); }
+    inline const_iterator end() const Q_DECL_NOTHROW { return q_hash.constEnd(); }
+    inline const_iterator cend() const Q_DECL_NOTHROW { return q_hash.constEnd(); }
+    inline const_iterator constEnd() const Q_DECL_NOTHROW { return q_hash.constEnd(); }
+
+    const_iterator erase(const_iterator it)
+    { return typename Hash::const_iterator(q_hash.erase(it.i)); }
+
+    inline const_iterator find(const T &value) const { return q_hash.constFind(value); }
+    inline const_iterator constFind(const T &value) const { return q_hash.constFind(value); }
+    inline const_iterator insert(const T &value)
+    { return typename Hash::const_iterator(q_hash.insert(value, QHashDummyValue())); }
+
+    QList<T> values() const { return q_hash.keys(); }
+
+    // STL compatibility
+    typedef T key_type;
+    typedef T value_type;
+    typedef value_type *pointer;
+    typedef const value_type *const_pointer;
+    typedef value_type &reference;
+    typedef const value_type &const_reference;
+    typedef qptrdiff difference_type;
+    typedef int size_type;
+
+    inline bool empty() const Q_DECL_NOTHROW { return isEmpty(); }
+
+private:
+    Hash q_hash;
+};
+
+template <class Key, class T>
+inline void swap(QFlatHash<Key, T> &value1, QFlatHash<Key, T> &value2) Q_DECL_NOTHROW
+{ value1.swap(value2); }
+
+template <class T>
+inline void swap(QFlatSet<T> &value1, QFlatSet<T> &value2) Q_DECL_NOTHROW
+{ value1.swap(value2); }
+
+QT_END_NAMESPACE
+
+#endif // QFLATHASH_H
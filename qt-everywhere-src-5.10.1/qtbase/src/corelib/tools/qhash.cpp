@@ -60,6 +60,7 @@
 #include <qbasicatomic.h>
 #include <qendian.h>
 #include <private/qsimd_p.h>
+#include <private/qarena_p.h>
 
 #ifndef QT_BOOTSTRAPPED
 #include <qcoreapplication.h>
@@ -197,10 +198,179 @@ static uint crc32(...)
 }
 #endif
 
+/*
+    On processors with AES instructions, seeded hashes use the AES round
+    function to mix the input into the state, like the runtime of the Go
+    language does. Each 16-byte block goes through one round, combined with
+    the state of one of up to four interleaved lanes; the seed and the
+    length make up the round key, and two more rounds after merging the
+    lanes spread every input bit over the result. This is not a
+    cryptographic hash, but it is much faster than CRC32 on long keys and
+    has a much better distribution.
+
+    One step is MixColumns(SubBytes(ShiftRows(state ^ data))) ^ key, which
+    is AESENC on x86 and AESE followed by AESMC on ARMv8.
+*/
+#if defined(Q_PROCESSOR_X86) && QT_COMPILER_SUPPORTS_HERE(AES) && QT_COMPILER_SUPPORTS_HERE(SSE4_2)
+#  define QT_HAVE_AESHASH
+#  define QT_AESHASH_FUNCTION_TARGET QT_FUNCTION_TARGET(AES)
+static inline bool hasFastAesHash()
+{
+    return qCpuHasFeature(AES) && qCpuHasFeature(SSE4_2);
+}
+
+typedef __m128i AesBlock;
+
+QT_AESHASH_FUNCTION_TARGET
+static inline AesBlock aesStep(AesBlock state, AesBlock data, AesBlock key)
+{
+    return _mm_aesenc_si128(_mm_xor_si128(state, data), key);
+}
+
+QT_AESHASH_FUNCTION_TARGET
+static inline AesBlock aesXor(AesBlock a, AesBlock b)
+{
+    return _mm_xor_si128(a, b);
+}
+
+QT_AESHASH_FUNCTION_TARGET
+static inline AesBlock aesLoad(const uchar *p)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+QT_AESHASH_FUNCTION_TARGET
+static inline AesBlock aesBlock(quint64 lo, quint64 hi)
+{
+    return _mm_set_epi64x(qint64(hi), qint64(lo));
+}
+
+QT_AESHASH_FUNCTION_TARGET
+static inline uint aesResult(AesBlock block)
+{
+    return uint(_mm_cvtsi128_si32(block));
+}
+#elif defined(Q_PROCESSOR_ARM_V8) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+// GCC only provides the intrinsics if the whole file is compiled for the crypto extension
+#  define QT_HAVE_AESHASH
+#  define QT_AESHASH_FUNCTION_TARGET
+static inline bool hasFastAesHash()
+{
+    return qCpuHasFeature(AES);
+}
+
+typedef uint8x16_t AesBlock;
+
+static inline AesBlock aesStep(AesBlock state, AesBlock data, AesBlock key)
+{
+    return veorq_u8(vaesmcq_u8(vaeseq_u8(state, data)), key);
+}
+
+static inline AesBlock aesXor(AesBlock a, AesBlock b)
+{
+    return veorq_u8(a, b);
+}
+
+static inline AesBlock aesLoad(const uchar *p)
+{
+    return vld1q_u8(p);
+}
+
+static inline AesBlock aesBlock(quint64 lo, quint64 hi)
+{
+    return vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(lo), vcreate_u64(hi)));
+}
+
+static inline uint aesResult(AesBlock block)
+{
+    return vgetq_lane_u32(vreinterpretq_u32_u8(block), 0);
+}
+#endif
+
+#ifdef QT_HAVE_AESHASH
+// Loads 0 < len < 16 bytes without reading past them. The reads overlap for
+// most lengths, which is fine since the length is part of the key.
+QT_AESHASH_FUNCTION_TARGET
+static inline AesBlock aesLoadPartial(const uchar *p, size_t len)
+{
+    quint64 lo, hi;
+    if (len >= 8) {
+        lo = qFromUnaligned<quint64>(p);
+        hi = qFromUnaligned<quint64>(p + len - 8);
+    } else if (len >= 4) {
+        lo = qFromUnaligned<quint32>(p);
+        hi = qFromUnaligned<quint32>(p + len - 4);
+    } else {
+        lo = quint64(p[0]) | quint64(p[len / 2]) << 8 | quint64(p[len - 1]) << 16;
+        hi = 0;
+    }
+    return aesBlock(lo, hi);
+}
+
+QT_AESHASH_FUNCTION_TARGET
+static uint aeshash(const uchar *p, size_t len, uint seed) Q_DECL_NOTHROW
+{
+    if (!len)
+        return seed;
+
+    const uchar *const e = p + len;
+    const AesBlock key = aesBlock(quint64(seed) | quint64(~seed) << 32, quint64(len));
+    AesBlock state0 = aesXor(key, aesBlock(Q_UINT64_C(0x243f6a8885a308d3), Q_UINT64_C(0x13198a2e03707344)));
+
+    if (len < 16) {
+        state0 = aesStep(state0, aesLoadPartial(p, len), key);
+    } else if (len == 16) {
+        state0 = aesStep(state0, aesLoad(p), key);
+    } else {
+        AesBlock state1 = aesXor(key, aesBlock(Q_UINT64_C(0xa4093822299f31d0), Q_UINT64_C(0x082efa98ec4e6c89)));
+        if (len > 64) {
+            // four lanes, to hide the latency of the AES instructions
+            AesBlock state2 = aesXor(key, aesBlock(Q_UINT64_C(0x452821e638d01377), Q_UINT64_C(0xbe5466cf34e90c6c)));
+            AesBlock state3 = aesXor(key, aesBlock(Q_UINT64_C(0xc0ac29b7c97c50dd), Q_UINT64_C(0x3f84d5b5b5470917)));
+            for ( ; e - p > 64; p += 64) {
+                state0 = aesStep(state0, aesLoad(p), key);
+                state1 = aesStep(state1, aesLoad(p + 16), key);
+                state2 = aesStep(state2, aesLoad(p + 32), key);
+                state3 = aesStep(state3, aesLoad(p + 48), key);
+            }
+            state0 = aesStep(state0, state2, key);
+            state1 = aesStep(state1, state3, key);
+        }
+        if (e - p > 32) {
+            state0 = aesStep(state0, aesLoad(p), key);
+            state1 = aesStep(state1, aesLoad(p + 16), key);
+            p += 32;
+        }
+        // the last 17 to 32 bytes; the two blocks overlap
+        if (e - p > 16)
+            state0 = aesStep(state0, aesLoad(p), key);
+        state1 = aesStep(state1, aesLoad(e - 16), key);
+        state0 = aesStep(state0, state1, key);
+    }
+
+    state0 = aesStep(state0, key, key);
+    state0 = aesStep(state0, key, key);
+    return aesResult(state0);
+}
+#else
+static inline bool hasFastAesHash()
+{
+    return false;
+}
+
+static uint aeshash(...)
+{
+    Q_UNREACHABLE();
+    return 0;
+}
+#endif
+
 static inline uint hash(const uchar *p, size_t len, uint seed) Q_DECL_NOTHROW
 {
     uint h = seed;
 
+    if (seed && hasFastAesHash())
+        return aeshash(p, len, h);
     if (seed && hasFastCrc32())
         return crc32(p, len, h);
 
@@ -219,6 +389,8 @@ static inline uint hash(const QChar *p, size_t len, uint seed) Q_DECL_NOTHROW
 {
     uint h = seed;
 
+    if (seed && hasFastAesHash())
+        return aeshash(reinterpret_cast<const uchar *>(p), len * sizeof(QChar), h);
     if (seed && hasFastCrc32())
         return crc32(p, len, h);
 
@@ -476,13 +648,19 @@ const QHashData QHashData::shared_null = {
 
 void *QHashData::allocateNode(int nodeAlign)
 {
-    void *ptr = strictAlignment ? qMallocAligned(nodeSize, nodeAlign) : malloc(nodeSize);
+    void *ptr;
+    if (QArena *arena = QArenaPrivate::arenaForAllocation())
+        ptr = arena->allocate(nodeSize, strictAlignment ? size_t(nodeAlign) : 2 * sizeof(void *));
+    else
+        ptr = strictAlignment ? qMallocAligned(nodeSize, nodeAlign) : malloc(nodeSize);
     Q_CHECK_PTR(ptr);
     return ptr;
 }
 
 void QHashData::freeNode(void *node)
 {
+    if (QArenaPrivate::arenaOwning(node))
+        return;
     if (strictAlignment)
         qFreeAligned(node);
     else
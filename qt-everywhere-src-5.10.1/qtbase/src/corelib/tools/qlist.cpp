@@ -380,6 +380,11 @@ void **QListData::erase(void **xi)
     \l {Q_DECLARE_TYPEINFO}. Otherwise, QList\<T\> is represented
     as an array of T* and the items are allocated on the heap.
 
+    Larger types declared as movable or primitive can also be stored in
+    the array, each item using as many pointer-sized slots as it needs, by
+    declaring them with Q_DECLARE_LIST_INLINE_STORAGE(), or for all the
+    types at once by building with \c QT_LIST_INLINE_STORAGE defined.
+
     The array representation allows very fast insertions and
     index-based access. The prepend() and append() operations are
     also very fast because QList preallocates memory at both
@@ -2037,4 +2042,33 @@ void **QListData::erase(void **xi)
     \sa fromStdList(), QVector::toStdVector()
 */
 
+/*!
+    \macro Q_DECLARE_LIST_INLINE_STORAGE(Type)
+    \relates QList
+    \since 5.11
+
+    Makes QList store items of \a Type in its internal array, like
+    QVector does, instead of allocating each item on the heap, even though
+    \c{sizeof(Type) > sizeof(void*)}. This saves one memory allocation per
+    item for types like QPointF. It has no effect unless \a Type has been
+    declared to be either a \c{Q_MOVABLE_TYPE} or a \c{Q_PRIMITIVE_TYPE}
+    using \l {Q_DECLARE_TYPEINFO}, and its alignment does not exceed the
+    one of a pointer.
+
+    Like Q_DECLARE_TYPEINFO(), the macro must be used right after the
+    declaration of \a Type, before any QList\<\a Type\> is instantiated, and
+    outside of any namespace. It changes the binary layout of
+    QList\<\a Type\>: all the code passing such lists to each other must
+    be compiled with the same declaration.
+
+    Defining \c QT_LIST_INLINE_STORAGE when building Qt and all the code
+    using it does the same for all the movable and primitive types. This
+    changes the layout of lists returned by the Qt APIs, such as
+    QVariantList, and is therefore binary incompatible with the default
+    build.
+
+    \note As for small types, references to items stored in the array are
+    invalidated when the list is modified.
+*/
+
 QT_END_NAMESPACE
@@ -77,6 +77,37 @@ protected:
 template <> struct QListSpecialMethods<QByteArray>;
 template <> struct QListSpecialMethods<QString>;
 
+template <typename T> struct QListInlineStorage
+{
+#ifdef QT_LIST_INLINE_STORAGE
+    enum { value = !QTypeInfo<T>::isStatic };
+#else
+    enum { value = false };
+#endif
+};
+
+#define Q_DECLARE_LIST_INLINE_STORAGE(TYPE) \
+template <> struct QListInlineStorage<TYPE> { enum { value = true }; };
+
+namespace QtPrivate {
+// the storage of one element of a QList, in units of pointers
+template <int Slots> struct QListNodeStorage { void *v; void *more[Slots - 1]; };
+template <> struct QListNodeStorage<1> { void *v; };
+
+template <typename T> struct QListStorage
+{
+    enum {
+        // large movable types opted in with Q_DECLARE_LIST_INLINE_STORAGE are
+        // stored in the array, using as many pointer-sized slots as needed
+        IsInlineLarge = QListInlineStorage<T>::value && QTypeInfo<T>::isLarge && !QTypeInfo<T>::isStatic
+                        && Q_ALIGNOF(T) <= Q_ALIGNOF(void *),
+        // must stay isStatic until ### Qt 6 for BC reasons (don't use !isRelocatable)!
+        IsIndirect = (QTypeInfo<T>::isStatic || QTypeInfo<T>::isLarge) && !IsInlineLarge,
+        Stride = IsInlineLarge ? int((sizeof(T) + sizeof(void *) - 1) / sizeof(void *)) : 1
+    };
+};
+}
+
 struct Q_CORE_EXPORT QListData {
     // tags for tag-dispatching of QList implementations,
     // based on QList's three different memory layouts:
@@ -123,25 +154,25 @@ class QList
     : public QListSpecialMethods<T>
 #endif
 {
+    typedef QtPrivate::QListStorage<T> Storage;
+
 public:
     struct MemoryLayout
         : std::conditional<
-            // must stay isStatic until ### Qt 6 for BC reasons (don't use !isRelocatable)!
-            QTypeInfo<T>::isStatic || QTypeInfo<T>::isLarge,
+            Storage::IsIndirect,
             QListData::IndirectLayout,
             typename std::conditional<
-                sizeof(T) == sizeof(void*),
+                sizeof(T) == Storage::Stride * sizeof(void*),
                 QListData::ArrayCompatibleLayout,
                 QListData::InlineWithPaddingLayout
              >::type>::type {};
 private:
-    struct Node { void *v;
+    struct Node : QtPrivate::QListNodeStorage<Storage::Stride> {
 #if defined(Q_CC_BOR)
         Q_INLINE_TEMPLATE T &t();
 #else
         Q_INLINE_TEMPLATE T &t()
-        { return *reinterpret_cast<T*>(QTypeInfo<T>::isLarge || QTypeInfo<T>::isStatic
-                                       ? v : this); }
+        { return *reinterpret_cast<T*>(Storage::IsIndirect ? this->v : static_cast<void *>(this)); }
 #endif
     };
 
@@ -167,7 +198,7 @@ public:
     bool operator==(const QList<T> &l) const;
     inline bool operator!=(const QList<T> &l) const { return !(*this == l); }
 
-    inline int size() const Q_DECL_NOTHROW { return p.size(); }
+    inline int size() const Q_DECL_NOTHROW { return p.size() / Storage::Stride; }
 
     inline void detach() { if (d->ref.isShared()) detach_helper(); }
 
@@ -340,8 +371,8 @@ public:
     // more Qt
     typedef iterator Iterator;
     typedef const_iterator ConstIterator;
-    inline int count() const { return p.size(); }
-    inline int length() const { return p.size(); } // Same as count()
+    inline int count() const { return size(); }
+    inline int length() const { return size(); } // Same as count()
     inline T& first() { Q_ASSERT(!isEmpty()); return *begin(); }
     inline const T& constFirst() const { return first(); }
     inline const T& first() const { Q_ASSERT(!isEmpty()); return at(0); }
@@ -399,6 +430,10 @@ public:
     { std::list<T> tmp; std::copy(constBegin(), constEnd(), std::back_inserter(tmp)); return tmp; }
 
 private:
+    inline Node *nodeAt(int i) const Q_DECL_NOTHROW { return reinterpret_cast<Node *>(p.begin()) + i; }
+    inline Node *nodeEnd() const Q_DECL_NOTHROW { return reinterpret_cast<Node *>(p.end()); }
+    Node *insertNode(int i);
+
     Node *detach_helper_grow(int i, int n);
     void detach_helper(int alloc);
     void detach_helper();
@@ -426,13 +461,13 @@ private:
 #if defined(Q_CC_BOR)
 template <typename T>
 Q_INLINE_TEMPLATE T &QList<T>::Node::t()
-{ return QTypeInfo<T>::isLarge || QTypeInfo<T>::isStatic ? *(T*)v:*(T*)this; }
+{ return Storage::IsIndirect ? *(T*)this->v:*(T*)this; }
 #endif
 
 template <typename T>
 Q_INLINE_TEMPLATE void QList<T>::node_construct(Node *n, const T &t)
 {
-    if (QTypeInfo<T>::isLarge || QTypeInfo<T>::isStatic) n->v = new T(t);
+    if (Storage::IsIndirect) n->v = new T(t);
     else if (QTypeInfo<T>::isComplex) new (n) T(t);
 #if (defined(__GNUC__) || defined(__INTEL_COMPILER) || defined(__IBMCPP__)) && !defined(__OPTIMIZE__)
     // This violates pointer aliasing rules, but it is known to be safe (and silent)
@@ -448,7 +483,7 @@ Q_INLINE_TEMPLATE void QList<T>::node_construct(Node *n, const T &t)
 template <typename T>
 Q_INLINE_TEMPLATE void QList<T>::node_destruct(Node *n)
 {
-    if (QTypeInfo<T>::isLarge || QTypeInfo<T>::isStatic) delete reinterpret_cast<T*>(n->v);
+    if (Storage::IsIndirect) delete reinterpret_cast<T*>(n->v);
     else if (QTypeInfo<T>::isComplex) reinterpret_cast<T*>(n)->~T();
 }
 
@@ -456,7 +491,7 @@ template <typename T>
 Q_INLINE_TEMPLATE void QList<T>::node_copy(Node *from, Node *to, Node *src)
 {
     Node *current = from;
-    if (QTypeInfo<T>::isLarge || QTypeInfo<T>::isStatic) {
+    if (Storage::IsIndirect) {
         QT_TRY {
             while(current != to) {
                 current->v = new T(*reinterpret_cast<T*>(src->v));
@@ -490,7 +525,7 @@ Q_INLINE_TEMPLATE void QList<T>::node_copy(Node *from, Node *to, Node *src)
 template <typename T>
 Q_INLINE_TEMPLATE void QList<T>::node_destruct(Node *from, Node *to)
 {
-    if (QTypeInfo<T>::isLarge || QTypeInfo<T>::isStatic)
+    if (Storage::IsIndirect)
         while(from != to) --to, delete reinterpret_cast<T*>(to->v);
     else if (QTypeInfo<T>::isComplex)
         while (from != to) --to, reinterpret_cast<T*>(to)->~T();
@@ -515,11 +550,11 @@ inline typename QList<T>::iterator QList<T>::insert(iterator before, const T &t)
     if (d->ref.isShared())
         n = detach_helper_grow(iBefore, 1);
     else
-        n = reinterpret_cast<Node *>(p.insert(iBefore));
+        n = insertNode(iBefore);
     QT_TRY {
         node_construct(n, t);
     } QT_CATCH(...) {
-        p.remove(iBefore);
+        p.remove(iBefore * Storage::Stride, Storage::Stride);
         QT_RETHROW;
     }
     return n;
@@ -534,29 +569,33 @@ inline typename QList<T>::iterator QList<T>::erase(iterator it)
         it += offset;
     }
     node_destruct(it.i);
-    return reinterpret_cast<Node *>(p.erase(reinterpret_cast<void**>(it.i)));
+    if (Storage::Stride == 1)
+        return reinterpret_cast<Node *>(p.erase(reinterpret_cast<void**>(it.i)));
+    const int i = int(it.i - reinterpret_cast<Node *>(p.begin()));
+    p.remove(i * Storage::Stride, Storage::Stride);
+    return nodeAt(i);
 }
 template <typename T>
 inline const T &QList<T>::at(int i) const
-{ Q_ASSERT_X(i >= 0 && i < p.size(), "QList<T>::at", "index out of range");
- return reinterpret_cast<Node *>(p.at(i))->t(); }
+{ Q_ASSERT_X(i >= 0 && i < size(), "QList<T>::at", "index out of range");
+ return nodeAt(i)->t(); }
 template <typename T>
 inline const T &QList<T>::operator[](int i) const
-{ Q_ASSERT_X(i >= 0 && i < p.size(), "QList<T>::operator[]", "index out of range");
- return reinterpret_cast<Node *>(p.at(i))->t(); }
+{ Q_ASSERT_X(i >= 0 && i < size(), "QList<T>::operator[]", "index out of range");
+ return nodeAt(i)->t(); }
 template <typename T>
 inline T &QList<T>::operator[](int i)
-{ Q_ASSERT_X(i >= 0 && i < p.size(), "QList<T>::operator[]", "index out of range");
-  detach(); return reinterpret_cast<Node *>(p.at(i))->t(); }
+{ Q_ASSERT_X(i >= 0 && i < size(), "QList<T>::operator[]", "index out of range");
+  detach(); return nodeAt(i)->t(); }
 template <typename T>
 inline void QList<T>::removeAt(int i)
-{ if(i >= 0 && i < p.size()) { detach();
- node_destruct(reinterpret_cast<Node *>(p.at(i))); p.remove(i); } }
+{ if(i >= 0 && i < size()) { detach();
+ node_destruct(nodeAt(i)); p.remove(i * Storage::Stride, Storage::Stride); } }
 template <typename T>
 inline T QList<T>::takeAt(int i)
-{ Q_ASSERT_X(i >= 0 && i < p.size(), "QList<T>::take", "index out of range");
- detach(); Node *n = reinterpret_cast<Node *>(p.at(i)); T t = std::move(n->t()); node_destruct(n);
- p.remove(i); return t; }
+{ Q_ASSERT_X(i >= 0 && i < size(), "QList<T>::take", "index out of range");
+ detach(); Node *n = nodeAt(i); T t = std::move(n->t()); node_destruct(n);
+ p.remove(i * Storage::Stride, Storage::Stride); return t; }
 template <typename T>
 inline T QList<T>::takeFirst()
 { T t = std::move(first()); removeFirst(); return t; }
@@ -567,6 +606,7 @@ inline T QList<T>::takeLast()
 template <typename T>
 Q_OUTOFLINE_TEMPLATE void QList<T>::reserve(int alloc)
 {
+    alloc *= Storage::Stride;
     if (d->alloc < alloc) {
         if (d->ref.isShared())
             detach_helper(alloc);
@@ -575,6 +615,28 @@ Q_OUTOFLINE_TEMPLATE void QList<T>::reserve(int alloc)
     }
 }
 
+// makes room for one element at position i of an unshared list
+template <typename T>
+Q_OUTOFLINE_TEMPLATE typename QList<T>::Node *QList<T>::insertNode(int i)
+{
+    if (Storage::Stride == 1)
+        return reinterpret_cast<Node *>(p.insert(i));
+
+    const int n = size();
+    if (i <= 0) {
+        for (int slot = 0; slot < Storage::Stride; ++slot)
+            p.prepend();
+        return nodeAt(0);
+    }
+    if (i > n)
+        i = n;
+    p.append(Storage::Stride);
+    if (i < n)
+        ::memmove(static_cast<void *>(nodeAt(i + 1)), static_cast<const void *>(nodeAt(i)),
+                  (n - i) * sizeof(Node));
+    return nodeAt(i);
+}
+
 template <typename T>
 Q_OUTOFLINE_TEMPLATE void QList<T>::append(const T &t)
 {
@@ -583,11 +645,11 @@ Q_OUTOFLINE_TEMPLATE void QList<T>::append(const T &t)
         QT_TRY {
             node_construct(n, t);
         } QT_CATCH(...) {
-            --d->end;
+            d->end -= Storage::Stride;
             QT_RETHROW;
         }
     } else {
-        if (QTypeInfo<T>::isLarge || QTypeInfo<T>::isStatic) {
+        if (Storage::IsIndirect) {
             Node *n = reinterpret_cast<Node *>(p.append());
             QT_TRY {
                 node_construct(n, t);
@@ -599,7 +661,7 @@ Q_OUTOFLINE_TEMPLATE void QList<T>::append(const T &t)
             Node *n, copy;
             node_construct(&copy, t); // t might be a reference to an object in the array
             QT_TRY {
-                n = reinterpret_cast<Node *>(p.append());;
+                n = reinterpret_cast<Node *>(p.append(Storage::Stride));
             } QT_CATCH(...) {
                 node_destruct(&copy);
                 QT_RETHROW;
@@ -617,11 +679,11 @@ inline void QList<T>::prepend(const T &t)
         QT_TRY {
             node_construct(n, t);
         } QT_CATCH(...) {
-            ++d->begin;
+            d->begin += Storage::Stride;
             QT_RETHROW;
         }
     } else {
-        if (QTypeInfo<T>::isLarge || QTypeInfo<T>::isStatic) {
+        if (Storage::IsIndirect) {
             Node *n = reinterpret_cast<Node *>(p.prepend());
             QT_TRY {
                 node_construct(n, t);
@@ -633,7 +695,7 @@ inline void QList<T>::prepend(const T &t)
             Node *n, copy;
             node_construct(&copy, t); // t might be a reference to an object in the array
             QT_TRY {
-                n = reinterpret_cast<Node *>(p.prepend());;
+                n = insertNode(0);
             } QT_CATCH(...) {
                 node_destruct(&copy);
                 QT_RETHROW;
@@ -651,11 +713,11 @@ inline void QList<T>::insert(int i, const T &t)
         QT_TRY {
             node_construct(n, t);
         } QT_CATCH(...) {
-            p.remove(i);
+            p.remove(int(n - reinterpret_cast<Node *>(p.begin())) * Storage::Stride, Storage::Stride);
             QT_RETHROW;
         }
     } else {
-        if (QTypeInfo<T>::isLarge || QTypeInfo<T>::isStatic) {
+        if (Storage::IsIndirect) {
             Node *n = reinterpret_cast<Node *>(p.insert(i));
             QT_TRY {
                 node_construct(n, t);
@@ -667,7 +729,7 @@ inline void QList<T>::insert(int i, const T &t)
             Node *n, copy;
             node_construct(&copy, t); // t might be a reference to an object in the array
             QT_TRY {
-                n = reinterpret_cast<Node *>(p.insert(i));;
+                n = insertNode(i);
             } QT_CATCH(...) {
                 node_destruct(&copy);
                 QT_RETHROW;
@@ -680,27 +742,38 @@ inline void QList<T>::insert(int i, const T &t)
 template <typename T>
 inline void QList<T>::replace(int i, const T &t)
 {
-    Q_ASSERT_X(i >= 0 && i < p.size(), "QList<T>::replace", "index out of range");
+    Q_ASSERT_X(i >= 0 && i < size(), "QList<T>::replace", "index out of range");
     detach();
-    reinterpret_cast<Node *>(p.at(i))->t() = t;
+    nodeAt(i)->t() = t;
 }
 
 template <typename T>
 inline void QList<T>::swap(int i, int j)
 {
-    Q_ASSERT_X(i >= 0 && i < p.size() && j >= 0 && j < p.size(),
+    Q_ASSERT_X(i >= 0 && i < size() && j >= 0 && j < size(),
                 "QList<T>::swap", "index out of range");
     detach();
-    std::swap(d->array[d->begin + i], d->array[d->begin + j]);
+    std::swap(*nodeAt(i), *nodeAt(j));
 }
 
 template <typename T>
 inline void QList<T>::move(int from, int to)
 {
-    Q_ASSERT_X(from >= 0 && from < p.size() && to >= 0 && to < p.size(),
+    Q_ASSERT_X(from >= 0 && from < size() && to >= 0 && to < size(),
                "QList<T>::move", "index out of range");
     detach();
-    p.move(from, to);
+    if (Storage::Stride == 1) {
+        p.move(from, to);
+    } else if (from != to) {
+        const Node moved = *nodeAt(from);
+        if (from < to)
+            ::memmove(static_cast<void *>(nodeAt(from)), static_cast<const void *>(nodeAt(from + 1)),
+                      (to - from) * sizeof(Node));
+        else
+            ::memmove(static_cast<void *>(nodeAt(to + 1)), static_cast<const void *>(nodeAt(to)),
+                      (from - to) * sizeof(Node));
+        *nodeAt(to) = moved;
+    }
 }
 
 template<typename T>
@@ -721,11 +794,11 @@ Q_OUTOFLINE_TEMPLATE QList<T> QList<T>::mid(int pos, int alength) const
     if (alength <= 0)
         return cpy;
     cpy.reserve(alength);
-    cpy.d->end = alength;
+    cpy.d->end = alength * Storage::Stride;
     QT_TRY {
         cpy.node_copy(reinterpret_cast<Node *>(cpy.p.begin()),
                       reinterpret_cast<Node *>(cpy.p.end()),
-                      reinterpret_cast<Node *>(p.begin() + pos));
+                      nodeAt(pos));
     } QT_CATCH(...) {
         // restore the old end
         cpy.d->end = 0;
@@ -737,37 +810,46 @@ Q_OUTOFLINE_TEMPLATE QList<T> QList<T>::mid(int pos, int alength) const
 template<typename T>
 Q_OUTOFLINE_TEMPLATE T QList<T>::value(int i) const
 {
-    if (i < 0 || i >= p.size()) {
+    if (i < 0 || i >= size()) {
         return T();
     }
-    return reinterpret_cast<Node *>(p.at(i))->t();
+    return nodeAt(i)->t();
 }
 
 template<typename T>
 Q_OUTOFLINE_TEMPLATE T QList<T>::value(int i, const T& defaultValue) const
 {
-    return ((i < 0 || i >= p.size()) ? defaultValue : reinterpret_cast<Node *>(p.at(i))->t());
+    return ((i < 0 || i >= size()) ? defaultValue : nodeAt(i)->t());
 }
 
 template <typename T>
 Q_OUTOFLINE_TEMPLATE typename QList<T>::Node *QList<T>::detach_helper_grow(int i, int c)
 {
     Node *n = reinterpret_cast<Node *>(p.begin());
+    if (Storage::Stride != 1) {
+        // detach_grow() works on slots; it clamps the index to the size
+        i = (i < 0) ? -1 : (i >= size() ? INT_MAX : i * Storage::Stride);
+        c *= Storage::Stride;
+    }
     QListData::Data *x = p.detach_grow(&i, c);
+    if (Storage::Stride != 1) {
+        i /= Storage::Stride;
+        c /= Storage::Stride;
+    }
     QT_TRY {
         node_copy(reinterpret_cast<Node *>(p.begin()),
-                  reinterpret_cast<Node *>(p.begin() + i), n);
+                  nodeAt(i), n);
     } QT_CATCH(...) {
         p.dispose();
         d = x;
         QT_RETHROW;
     }
     QT_TRY {
-        node_copy(reinterpret_cast<Node *>(p.begin() + i + c),
+        node_copy(nodeAt(i + c),
                   reinterpret_cast<Node *>(p.end()), n + i);
     } QT_CATCH(...) {
         node_destruct(reinterpret_cast<Node *>(p.begin()),
-                      reinterpret_cast<Node *>(p.begin() + i));
+                      nodeAt(i));
         p.dispose();
         d = x;
         QT_RETHROW;
@@ -776,7 +858,7 @@ Q_OUTOFLINE_TEMPLATE typename QList<T>::Node *QList<T>::detach_helper_grow(int i
     if (!x->ref.deref())
         dealloc(x);
 
-    return reinterpret_cast<Node *>(p.begin() + i);
+    return nodeAt(i);
 }
 
 template <typename T>
@@ -856,7 +938,7 @@ inline bool QList<T>::op_eq_impl(const QList &l, QListData::ArrayCompatibleLayou
     const T *lb = reinterpret_cast<const T*>(l.p.begin());
     const T *b  = reinterpret_cast<const T*>(p.begin());
     const T *e  = reinterpret_cast<const T*>(p.end());
-    return std::equal(b, e, QT_MAKE_CHECKED_ARRAY_ITERATOR(lb, l.p.size()));
+    return std::equal(b, e, QT_MAKE_CHECKED_ARRAY_ITERATOR(lb, l.size()));
 }
 
 template <typename T>
@@ -884,7 +966,7 @@ Q_OUTOFLINE_TEMPLATE int QList<T>::removeAll(const T &_t)
     const T t = _t;
     detach();
 
-    Node *i = reinterpret_cast<Node *>(p.at(index));
+    Node *i = nodeAt(index);
     Node *e = reinterpret_cast<Node *>(p.end());
     Node *n = i;
     node_destruct(i);
@@ -896,7 +978,7 @@ Q_OUTOFLINE_TEMPLATE int QList<T>::removeAll(const T &_t)
     }
 
     int removedCount = int(e - n);
-    d->end -= removedCount;
+    d->end -= removedCount * Storage::Stride;
     return removedCount;
 }
 
@@ -931,7 +1013,7 @@ Q_OUTOFLINE_TEMPLATE typename QList<T>::iterator QList<T>::erase(typename QList<
     for (Node *n = afirst.i; n < alast.i; ++n)
         node_destruct(n);
     int idx = afirst - begin();
-    p.remove(idx, alast - afirst);
+    p.remove(idx * Storage::Stride, (alast - afirst) * Storage::Stride);
     return begin() + idx;
 }
 
@@ -950,7 +1032,7 @@ Q_OUTOFLINE_TEMPLATE QList<T> &QList<T>::operator+=(const QList<T> &l)
                           reinterpret_cast<Node *>(l.p.begin()));
             } QT_CATCH(...) {
                 // restore the old end
-                d->end -= int(reinterpret_cast<Node *>(p.end()) - n);
+                d->end -= int(reinterpret_cast<Node *>(p.end()) - n) * Storage::Stride;
                 QT_RETHROW;
             }
         }
@@ -968,9 +1050,9 @@ template <typename T>
 Q_OUTOFLINE_TEMPLATE int QList<T>::indexOf(const T &t, int from) const
 {
     if (from < 0)
-        from = qMax(from + p.size(), 0);
-    if (from < p.size()) {
-        Node *n = reinterpret_cast<Node *>(p.at(from -1));
+        from = qMax(from + size(), 0);
+    if (from < size()) {
+        Node *n = nodeAt(from - 1);
         Node *e = reinterpret_cast<Node *>(p.end());
         while (++n != e)
             if (n->t() == t)
@@ -983,12 +1065,12 @@ template <typename T>
 Q_OUTOFLINE_TEMPLATE int QList<T>::lastIndexOf(const T &t, int from) const
 {
     if (from < 0)
-        from += p.size();
-    else if (from >= p.size())
-        from = p.size()-1;
+        from += size();
+    else if (from >= size())
+        from = size()-1;
     if (from >= 0) {
         Node *b = reinterpret_cast<Node *>(p.begin());
-        Node *n = reinterpret_cast<Node *>(p.at(from + 1));
+        Node *n = nodeAt(from + 1);
         while (n-- != b) {
             if (n->t() == t)
                 return n - b;
@@ -3006,6 +3006,12 @@ QString QLocalePrivate::dateTimeToString(QStringView format, const QDateTime &da
 QString QLocaleData::doubleToString(double d, int precision, DoubleForm form,
                                     int width, unsigned flags) const
 {
+    if (!(flags & ZeroPadded)) {
+        QChar buf[DoubleBufferSize];
+        const int length = doubleToBuffer(buf, d, precision, form, flags);
+        if (length >= 0)
+            return QString(buf, length);
+    }
     return doubleToString(m_zero, m_plus, m_minus, m_exponential, m_group, m_decimal,
                           d, precision, form, width, flags);
 }
@@ -3127,6 +3133,12 @@ QString QLocaleData::longLongToString(qlonglong l, int precision,
                                             int base, int width,
                                             unsigned flags) const
 {
+    if (precision == -1 && base == 10) {
+        QChar buf[IntegerBufferSize];
+        const int length = longLongToBuffer(buf, l, flags);
+        if (length >= 0)
+            return QString(buf, length);
+    }
     return longLongToString(m_zero, m_group, m_plus, m_minus,
                                             l, precision, base, width, flags);
 }
@@ -3222,6 +3234,12 @@ QString QLocaleData::unsLongLongToString(qulonglong l, int precision,
                                             int base, int width,
                                             unsigned flags) const
 {
+    if (precision == -1 && base == 10 && flags != NoFlags) {
+        QChar buf[IntegerBufferSize];
+        const int length = unsLongLongToBuffer(buf, l, flags);
+        if (length >= 0)
+            return QString(buf, length);
+    }
     return unsLongLongToString(m_zero, m_group, m_plus,
                                                l, precision, base, width, flags);
 }
@@ -3298,6 +3316,219 @@ QString QLocaleData::unsLongLongToString(const QChar zero, const QChar group,
     return num_str;
 }
 
+// Writes the decimal digits of \a l into \a out, grouped by thousands with
+// \a group unless \a group is null; returns the end of the digits.
+static ushort *writeDecimalDigits(ushort *out, qulonglong l, ushort zero, ushort group)
+{
+    ushort digits[20]; // length of MAX_ULLONG in base 10
+    ushort *p = digits + 20;
+    do {
+        *--p = zero + ushort(l % 10);
+        l /= 10;
+    } while (l != 0);
+
+    const int count = int(digits + 20 - p);
+    for (int i = 0; i < count; ++i) {
+        if (group && i != 0 && (count - i) % 3 == 0)
+            *out++ = group;
+        *out++ = p[i];
+    }
+    return out;
+}
+
+/*!
+    \internal
+
+    Writes \a l into \a buf, which has room for at least IntegerBufferSize
+    characters, and returns the number of characters written. Returns -1,
+    without writing anything, if \a flags need longLongToString().
+*/
+int QLocaleData::longLongToBuffer(QChar *buf, qint64 l, unsigned flags) const
+{
+    if (flags & ~(ThousandsGroup | AlwaysShowSign | BlankBeforePositive))
+        return -1;
+
+    ushort *out = reinterpret_cast<ushort *>(buf);
+    if (l < 0)
+        *out++ = m_minus;
+    else if (flags & AlwaysShowSign)
+        *out++ = m_plus;
+    else if (flags & BlankBeforePositive)
+        *out++ = ' ';
+
+    // negate in unsigned arithmetic, so that the smallest qint64 doesn't overflow
+    const quint64 magnitude = l < 0 ? quint64(0) - quint64(l) : quint64(l);
+    out = writeDecimalDigits(out, magnitude, m_zero, flags & ThousandsGroup ? m_group : 0);
+    return int(out - reinterpret_cast<ushort *>(buf));
+}
+
+/*!
+    \internal
+
+    Writes \a l into \a buf, which has room for at least IntegerBufferSize
+    characters, and returns the number of characters written. Returns -1,
+    without writing anything, if \a flags need unsLongLongToString().
+*/
+int QLocaleData::unsLongLongToBuffer(QChar *buf, quint64 l, unsigned flags) const
+{
+    if (flags & ~(ThousandsGroup | AlwaysShowSign | BlankBeforePositive))
+        return -1;
+
+    ushort *out = reinterpret_cast<ushort *>(buf);
+    if (flags & AlwaysShowSign)
+        *out++ = m_plus;
+    else if (flags & BlankBeforePositive)
+        *out++ = ' ';
+
+    out = writeDecimalDigits(out, l, m_zero, flags & ThousandsGroup ? m_group : 0);
+    return int(out - reinterpret_cast<ushort *>(buf));
+}
+
+namespace {
+// The digits produced by doubleToAscii(), padded as decimalForm() and
+// exponentForm() would pad them
+struct PaddedDigits
+{
+    const char *digits;
+    int leadingZeros;
+    int count;
+    int length;
+
+    ushort at(int i, ushort zero) const
+    {
+        i -= leadingZeros;
+        return (i >= 0 && i < count) ? ushort(zero + (digits[i] - '0')) : zero;
+    }
+};
+}
+
+/*!
+    \internal
+
+    Writes \a d into \a buf, which has room for at least DoubleBufferSize
+    characters, and returns the number of characters written; the result
+    is the same as the one of doubleToString() with no width. Returns -1,
+    without writing anything, if \a flags or \a precision need
+    doubleToString().
+*/
+int QLocaleData::doubleToBuffer(QChar *buf, double d, int precision, DoubleForm form,
+                                unsigned flags) const
+{
+    enum { MaximumPrecision = 64 };
+    if (flags & ~(AddTrailingZeroes | BlankBeforePositive | AlwaysShowSign | ThousandsGroup
+                  | ShowBase | UppercaseBase | ZeroPadExponent | ForcePoint))
+        return -1;
+    if (precision != QLocale::FloatingPointShortest && precision < 0)
+        precision = 6;
+    if (precision > MaximumPrecision)
+        return -1;
+
+    // same as in doubleToString()
+    int bufSize = 1;
+    if (precision == QLocale::FloatingPointShortest)
+        bufSize += DoubleMaxSignificant;
+    else if (form == DFDecimal)
+        bufSize += ((d > (1 << 19) || d < -(1 << 19)) ? DoubleMaxDigitsBeforeDecimal : 6) +
+                precision;
+    else
+        bufSize += qMax(2, precision) + 1;
+
+    char digits[DoubleMaxDigitsBeforeDecimal + MaximumPrecision + 2];
+    Q_ASSERT(bufSize <= int(sizeof digits));
+    bool negative = false;
+    int length;
+    int decpt;
+    doubleToAscii(d, form, precision, digits, bufSize, negative, length, decpt);
+
+    ushort *out = reinterpret_cast<ushort *>(buf);
+    const bool special = qstrncmp(digits, "inf", 3) == 0 || qstrncmp(digits, "nan", 3) == 0;
+    if (!special && isZero(d))
+        negative = false;
+    if (negative)
+        *out++ = m_minus;
+    else if (flags & AlwaysShowSign)
+        *out++ = m_plus;
+    else if (flags & BlankBeforePositive)
+        *out++ = ' ';
+
+    if (special) {
+        for (int i = 0; i < length; ++i)
+            *out++ = uchar(digits[i]);
+        return int(out - reinterpret_cast<ushort *>(buf));
+    }
+
+    const bool alwaysShowPoint = flags & ForcePoint;
+    PrecisionMode mode = PMDecimalDigits;
+    bool exponent = form == DFExponent;
+    if (form == DFSignificantDigits) {
+        mode = (flags & AddTrailingZeroes) ? PMSignificantDigits : PMChopTrailingZeros;
+
+        int cutoff = precision < 0 ? 6 : precision;
+        // Find out which representation is shorter
+        if (precision == QLocale::FloatingPointShortest && decpt > 0) {
+            cutoff = length + 4; // 'e', '+'/'-', one digit exponent
+            if (decpt <= 10) {
+                ++cutoff;
+            } else {
+                cutoff += decpt > 100 ? 2 : 1;
+            }
+            if (!alwaysShowPoint && length > decpt)
+                ++cutoff; // decpt shown in exponent form, but not in decimal form
+        }
+        exponent = decpt != length && (decpt <= -4 || decpt > cutoff);
+    }
+
+    PaddedDigits padded = { digits, 0, length, length };
+    if (exponent) {
+        // see exponentForm()
+        if (mode == PMDecimalDigits)
+            padded.length = qMax(padded.length, precision + 1);
+        else if (mode == PMSignificantDigits)
+            padded.length = qMax(padded.length, precision);
+
+        *out++ = padded.at(0, m_zero);
+        if (alwaysShowPoint || padded.length > 1)
+            *out++ = m_decimal;
+        for (int i = 1; i < padded.length; ++i)
+            *out++ = padded.at(i, m_zero);
+
+        const int exp = decpt - 1;
+        *out++ = m_exponential;
+        *out++ = exp < 0 ? m_minus : m_plus;
+        if ((flags & ZeroPadExponent) && exp > -10 && exp < 10)
+            *out++ = m_zero;
+        out = writeDecimalDigits(out, quint64(exp < 0 ? -exp : exp), m_zero, 0);
+    } else {
+        // see decimalForm()
+        if (decpt < 0) {
+            padded.leadingZeros = -decpt;
+            padded.length += padded.leadingZeros;
+            decpt = 0;
+        } else if (decpt > padded.length) {
+            padded.length = decpt;
+        }
+
+        if (mode == PMDecimalDigits)
+            padded.length = qMax(padded.length, decpt + precision);
+        else if (mode == PMSignificantDigits)
+            padded.length = qMax(padded.length, precision);
+
+        if (decpt == 0)
+            *out++ = m_zero;
+        for (int i = 0; i < decpt; ++i) {
+            if ((flags & ThousandsGroup) && i != 0 && (decpt - i) % 3 == 0)
+                *out++ = m_group;
+            *out++ = padded.at(i, m_zero);
+        }
+        if (alwaysShowPoint || decpt < padded.length)
+            *out++ = m_decimal;
+        for (int i = decpt; i < padded.length; ++i)
+            *out++ = padded.at(i, m_zero);
+    }
+
+    return int(out - reinterpret_cast<ushort *>(buf));
+}
+
 /*
     Converts a number in locale to its representation in the C locale.
     Only has to guarantee that a string that is a correct representation of
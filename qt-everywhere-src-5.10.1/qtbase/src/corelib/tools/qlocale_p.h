@@ -241,6 +241,17 @@ public:
                                 int width = -1,
                                 unsigned flags = NoFlags) const;
 
+    // These write the number straight into a buffer of at least
+    // IntegerBufferSize or DoubleBufferSize characters, in base 10 and
+    // without padding. They return the number of characters written, or -1
+    // if the flags or the precision need the QString-based functions above.
+    enum { IntegerBufferSize = 32, DoubleBufferSize = 512 };
+    int longLongToBuffer(QChar *buf, qint64 l, unsigned flags = NoFlags) const;
+    int unsLongLongToBuffer(QChar *buf, quint64 l, unsigned flags = NoFlags) const;
+    int doubleToBuffer(QChar *buf, double d, int precision = -1,
+                       DoubleForm form = DFSignificantDigits,
+                       unsigned flags = NoFlags) const;
+
     // this function is meant to be called with the result of stringToDouble or bytearrayToDouble
     static float convertDoubleToFloat(double d, bool *ok)
     {
@@ -52,7 +52,9 @@
 #include <QtCore/qthreadstorage.h>
 #include <QtCore/qglobal.h>
 #include <QtCore/qatomic.h>
+#include <QtCore/qcache.h>
 #include <QtCore/qdatastream.h>
+#include <QtCore/qmutex.h>
 
 #define PCRE2_CODE_UNIT_WIDTH 16
 
@@ -840,6 +842,32 @@ static int convertToPcreOptions(QRegularExpression::MatchOptions matchOptions)
     return options;
 }
 
+/*
+    A compiled pattern. It is shared by all the QRegularExpression objects
+    with the same pattern and the same options, and kept in a process-wide
+    cache for a while after they are gone.
+*/
+struct QRegularExpressionCompiledPattern : QSharedData
+{
+    QRegularExpressionCompiledPattern();
+    ~QRegularExpressionCompiledPattern();
+
+    void getPatternInfo(const QString &pattern);
+
+    pcre2_code_16 *code;
+    int errorCode;
+    int errorOffset;
+    int capturingCount;
+    bool usingCrLfNewlines;
+
+    // pcre2_jit_compile_16() modifies the code, so it's called holding the
+    // lock for writing, and matches hold it for reading until the pattern
+    // has been JIT-compiled; the code doesn't change any more after that
+    QReadWriteLock jitLock;
+    QAtomicInt jitCompiled;
+    QAtomicInt usedCount;
+};
+
 struct QRegularExpressionPrivate : QSharedData
 {
     QRegularExpressionPrivate();
@@ -848,7 +876,6 @@ struct QRegularExpressionPrivate : QSharedData
 
     void cleanCompiledPattern();
     void compilePattern();
-    void getPatternInfo();
 
     enum OptimizePatternOption {
         LazyOptimizeOption,
@@ -882,14 +909,14 @@ struct QRegularExpressionPrivate : QSharedData
     // (right after a detach happened).
     mutable QReadWriteLock mutex;
 
-    // The PCRE code pointer is reference-counted by the QRegularExpressionPrivate
-    // objects themselves; when the private is copied (i.e. a detach happened)
-    // they are set to 0
+    // The PCRE code is owned by the compiled pattern, which may be shared with
+    // other QRegularExpressionPrivate objects; when the private is copied (i.e.
+    // a detach happened) these are reset, and filled from the cache again
+    QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern> compiled;
     pcre2_code_16 *compiledPattern;
     int errorCode;
     int errorOffset;
     int capturingCount;
-    unsigned int usedCount;
     bool usingCrLfNewlines;
     bool isDirty;
 };
@@ -958,7 +985,6 @@ QRegularExpressionPrivate::QRegularExpressionPrivate()
       errorCode(0),
       errorOffset(-1),
       capturingCount(0),
-      usedCount(0),
       usingCrLfNewlines(false),
       isDirty(true)
 {
@@ -990,7 +1016,6 @@ QRegularExpressionPrivate::QRegularExpressionPrivate(const QRegularExpressionPri
       errorCode(0),
       errorOffset(-1),
       capturingCount(0),
-      usedCount(0),
       usingCrLfNewlines(false),
       isDirty(true)
 {
@@ -1001,15 +1026,92 @@ QRegularExpressionPrivate::QRegularExpressionPrivate(const QRegularExpressionPri
 */
 void QRegularExpressionPrivate::cleanCompiledPattern()
 {
-    pcre2_code_free_16(compiledPattern);
+    compiled.reset();
     compiledPattern = 0;
     errorCode = 0;
     errorOffset = -1;
     capturingCount = 0;
-    usedCount = 0;
     usingCrLfNewlines = false;
 }
 
+namespace {
+struct QRegularExpressionCacheKey
+{
+    QRegularExpressionCacheKey(const QString &pattern, int options)
+        : pattern(pattern), options(options) {}
+
+    QString pattern;
+    int options;
+
+    bool operator==(const QRegularExpressionCacheKey &other) const
+    { return options == other.options && pattern == other.pattern; }
+};
+
+inline uint qHash(const QRegularExpressionCacheKey &key, uint seed = 0) Q_DECL_NOTHROW
+{
+    return qHash(key.pattern, seed) ^ uint(key.options);
+}
+
+typedef QExplicitlySharedDataPointer<QRegularExpressionCompiledPattern> QRegularExpressionCompiledPatternPointer;
+
+struct QRegularExpressionPatternCache
+{
+    // the number of patterns kept around when no QRegularExpression uses them
+    enum { MaximumSize = 256 };
+
+    QRegularExpressionPatternCache() : patterns(MaximumSize) {}
+
+    QMutex mutex;
+    QCache<QRegularExpressionCacheKey, QRegularExpressionCompiledPatternPointer> patterns;
+};
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(QRegularExpressionPatternCache, patternCache)
+
+/*!
+    \internal
+
+    Returns the compiled \a pattern for the PCRE2 \a options, compiling it
+    unless it's in the cache already.
+*/
+static QRegularExpressionCompiledPatternPointer compiledPatternFor(const QString &pattern, int options)
+{
+    QRegularExpressionPatternCache *cache = patternCache();
+    const QRegularExpressionCacheKey key(pattern, options);
+    if (cache) {
+        const QMutexLocker locker(&cache->mutex);
+        if (QRegularExpressionCompiledPatternPointer *cached = cache->patterns.object(key))
+            return *cached;
+    }
+
+    // compile without holding the lock; if another thread compiles the same
+    // pattern at the same time, the first one to finish is kept
+    QRegularExpressionCompiledPatternPointer compiled(new QRegularExpressionCompiledPattern);
+    PCRE2_SIZE patternErrorOffset;
+    compiled->code = pcre2_compile_16(pattern.utf16(),
+                                      pattern.length(),
+                                      options,
+                                      &compiled->errorCode,
+                                      &patternErrorOffset,
+                                      NULL);
+
+    if (!compiled->code) {
+        compiled->errorOffset = static_cast<int>(patternErrorOffset);
+    } else {
+        // ignore whatever PCRE2 wrote into errorCode -- leave it to 0 to mean "no error"
+        compiled->errorCode = 0;
+        compiled->getPatternInfo(pattern);
+    }
+
+    if (cache) {
+        const QMutexLocker locker(&cache->mutex);
+        if (QRegularExpressionCompiledPatternPointer *cached = cache->patterns.object(key))
+            return *cached;
+        cache->patterns.insert(key, new QRegularExpressionCompiledPatternPointer(compiled));
+    }
+    return compiled;
+}
+
 /*!
     \internal
 */
@@ -1026,37 +1128,46 @@ void QRegularExpressionPrivate::compilePattern()
     int options = convertToPcreOptions(patternOptions);
     options |= PCRE2_UTF;
 
-    PCRE2_SIZE patternErrorOffset;
-    compiledPattern = pcre2_compile_16(pattern.utf16(),
-                                       pattern.length(),
-                                       options,
-                                       &errorCode,
-                                       &patternErrorOffset,
-                                       NULL);
-
-    if (!compiledPattern) {
-        errorOffset = static_cast<int>(patternErrorOffset);
-        return;
-    } else {
-        // ignore whatever PCRE2 wrote into errorCode -- leave it to 0 to mean "no error"
-        errorCode = 0;
-    }
+    compiled = compiledPatternFor(pattern, options);
+    compiledPattern = compiled->code;
+    errorCode = compiled->errorCode;
+    errorOffset = compiled->errorOffset;
+    capturingCount = compiled->capturingCount;
+    usingCrLfNewlines = compiled->usingCrLfNewlines;
+}
+
+/*!
+    \internal
+*/
+QRegularExpressionCompiledPattern::QRegularExpressionCompiledPattern()
+    : code(0),
+      errorCode(0),
+      errorOffset(-1),
+      capturingCount(0),
+      usingCrLfNewlines(false)
+{
+}
 
-    getPatternInfo();
+/*!
+    \internal
+*/
+QRegularExpressionCompiledPattern::~QRegularExpressionCompiledPattern()
+{
+    pcre2_code_free_16(code);
 }
 
 /*!
     \internal
 */
-void QRegularExpressionPrivate::getPatternInfo()
+void QRegularExpressionCompiledPattern::getPatternInfo(const QString &pattern)
 {
-    Q_ASSERT(compiledPattern);
+    Q_ASSERT(code);
 
-    pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_CAPTURECOUNT, &capturingCount);
+    pcre2_pattern_info_16(code, PCRE2_INFO_CAPTURECOUNT, &capturingCount);
 
     // detect the settings for the newline
     unsigned int patternNewlineSetting;
-    if (pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_NEWLINE, &patternNewlineSetting) != 0) {
+    if (pcre2_pattern_info_16(code, PCRE2_INFO_NEWLINE, &patternNewlineSetting) != 0) {
         // no option was specified in the regexp, grab PCRE build defaults
         pcre2_config_16(PCRE2_CONFIG_NEWLINE, &patternNewlineSetting);
     }
@@ -1066,7 +1177,7 @@ void QRegularExpressionPrivate::getPatternInfo()
             (patternNewlineSetting == PCRE2_NEWLINE_ANYCRLF);
 
     unsigned int hasJOptionChanged;
-    pcre2_pattern_info_16(compiledPattern, PCRE2_INFO_JCHANGED, &hasJOptionChanged);
+    pcre2_pattern_info_16(code, PCRE2_INFO_JCHANGED, &hasJOptionChanged);
     if (Q_UNLIKELY(hasJOptionChanged)) {
         qWarning("QRegularExpressionPrivate::getPatternInfo(): the pattern '%s'\n    is using the (?J) option; duplicate capturing group names are not supported by Qt",
                  qPrintable(pattern));
@@ -1074,48 +1185,83 @@ void QRegularExpressionPrivate::getPatternInfo()
 }
 
 
+// The default JIT stack size in PCRE is 32K; if that's not enough, we
+// allocate a stack from 32K up to this size.
+static QBasicAtomicInt qt_regularexpression_max_jit_stack_size = Q_BASIC_ATOMIC_INITIALIZER(512 * 1024);
+
 /*
-    Simple "smartpointer" wrapper around a pcre2_jit_stack_16, to be used with
-    QThreadStorage.
+    The PCRE2 objects that a thread reuses for all its matches, to be used
+    with QThreadStorage: the match context, the match data (grown to the
+    largest number of capturing groups used so far) and the JIT stack, which
+    is only allocated once the default one turned out to be too small.
 */
-class QPcreJitStackPointer
+class QPcreThreadData
 {
-    Q_DISABLE_COPY(QPcreJitStackPointer)
+    Q_DISABLE_COPY(QPcreThreadData)
 
 public:
     /*!
         \internal
     */
-    QPcreJitStackPointer()
+    QPcreThreadData()
+        : matchContext(pcre2_match_context_create_16(NULL)),
+          matchData(0),
+          matchDataPairs(0),
+          jitStack(0),
+          jitStackSize(0)
     {
-        // The default JIT stack size in PCRE is 32K,
-        // we allocate from 32K up to 512K.
-        stack = pcre2_jit_stack_create_16(32 * 1024, 512 * 1024, NULL);
+        pcre2_jit_stack_assign_16(matchContext, &jitStackCallback, this);
     }
     /*!
         \internal
     */
-    ~QPcreJitStackPointer()
+    ~QPcreThreadData()
     {
-        if (stack)
-            pcre2_jit_stack_free_16(stack);
+        if (jitStack)
+            pcre2_jit_stack_free_16(jitStack);
+        pcre2_match_data_free_16(matchData);
+        pcre2_match_context_free_16(matchContext);
     }
 
-    pcre2_jit_stack_16 *stack;
-};
+    pcre2_match_data_16 *matchDataFor(int capturingCount)
+    {
+        const uint pairs = uint(capturingCount) + 1;
+        if (pairs > matchDataPairs) {
+            pcre2_match_data_free_16(matchData);
+            matchData = pcre2_match_data_create_16(pairs, NULL);
+            matchDataPairs = matchData ? pairs : 0;
+        }
+        return matchData;
+    }
 
-Q_GLOBAL_STATIC(QThreadStorage<QPcreJitStackPointer *>, jitStacks)
+    // returns false if the JIT stack is as large as it may be already
+    bool growJitStack()
+    {
+        const int maximumSize = qt_regularexpression_max_jit_stack_size.load();
+        if (jitStack && jitStackSize >= maximumSize)
+            return false;
+        if (jitStack)
+            pcre2_jit_stack_free_16(jitStack);
+        jitStack = pcre2_jit_stack_create_16(qMin(32 * 1024, maximumSize), maximumSize, NULL);
+        jitStackSize = jitStack ? maximumSize : 0;
+        return jitStack != 0;
+    }
 
-/*!
-    \internal
-*/
-static pcre2_jit_stack_16 *qtPcreCallback(void *)
-{
-    if (jitStacks()->hasLocalData())
-        return jitStacks()->localData()->stack;
+    pcre2_match_context_16 *matchContext;
+    pcre2_match_data_16 *matchData;
+    uint matchDataPairs;
 
-    return 0;
-}
+private:
+    static pcre2_jit_stack_16 *jitStackCallback(void *data)
+    {
+        return static_cast<QPcreThreadData *>(data)->jitStack;
+    }
+
+    pcre2_jit_stack_16 *jitStack;
+    int jitStackSize;
+};
+
+Q_GLOBAL_STATIC(QThreadStorage<QPcreThreadData *>, pcreThreadData)
 
 /*!
     \internal
@@ -1159,12 +1305,20 @@ void QRegularExpressionPrivate::optimizePattern(OptimizePatternOption option)
     if (!enableJit)
         return;
 
-    const QWriteLocker lock(&mutex);
+    // the usages are counted for all the objects sharing the compiled pattern
+    QRegularExpressionCompiledPattern *c = compiled.data();
+    if (c->jitCompiled.loadAcquire())
+        return;
+    if ((option == LazyOptimizeOption)
+            && (uint(c->usedCount.fetchAndAddRelaxed(1)) + 1 < qt_qregularexpression_optimize_after_use_count))
+        return;
 
-    if ((option == LazyOptimizeOption) && (++usedCount != qt_qregularexpression_optimize_after_use_count))
+    const QWriteLocker lock(&c->jitLock);
+    if (c->jitCompiled.load())
         return;
 
     pcre2_jit_compile_16(compiledPattern, PCRE2_JIT_COMPLETE | PCRE2_JIT_PARTIAL_SOFT | PCRE2_JIT_PARTIAL_HARD);
+    c->jitCompiled.storeRelease(1);
 }
 
 /*!
@@ -1191,24 +1345,20 @@ int QRegularExpressionPrivate::captureIndexForName(QStringView name) const
     \internal
 
     This is a simple wrapper for pcre2_match_16 for handling the case in which the
-    JIT runs out of memory. In that case, we allocate a thread-local JIT stack
-    and re-run pcre2_match_16.
+    JIT runs out of memory. In that case, we allocate a larger thread-local JIT
+    stack and re-run pcre2_match_16.
 */
 static int safe_pcre2_match_16(const pcre2_code_16 *code,
                                const unsigned short *subject, int length,
                                int startOffset, int options,
-                               pcre2_match_data_16 *matchData,
-                               pcre2_match_context_16 *matchContext)
+                               QPcreThreadData *threadData)
 {
     int result = pcre2_match_16(code, subject, length,
-                                startOffset, options, matchData, matchContext);
-
-    if (result == PCRE2_ERROR_JIT_STACKLIMIT && !jitStacks()->hasLocalData()) {
-        QPcreJitStackPointer *p = new QPcreJitStackPointer;
-        jitStacks()->setLocalData(p);
+                                startOffset, options, threadData->matchData, threadData->matchContext);
 
+    if (result == PCRE2_ERROR_JIT_STACKLIMIT && threadData->growJitStack()) {
         result = pcre2_match_16(code, subject, length,
-                                startOffset, options, matchData, matchContext);
+                                startOffset, options, threadData->matchData, threadData->matchContext);
     }
 
     return result;
@@ -1301,26 +1451,38 @@ QRegularExpressionMatchPrivate *QRegularExpressionPrivate::doMatch(const QString
         previousMatchWasEmpty = true;
     }
 
-    pcre2_match_context_16 *matchContext = pcre2_match_context_create_16(NULL);
-    pcre2_jit_stack_assign_16(matchContext, &qtPcreCallback, NULL);
-    pcre2_match_data_16 *matchData = pcre2_match_data_create_from_pattern_16(compiledPattern, NULL);
+    QThreadStorage<QPcreThreadData *> *threadStorage = pcreThreadData();
+    QPcreThreadData *threadData = threadStorage ? threadStorage->localData() : 0;
+    QScopedPointer<QPcreThreadData> temporaryThreadData;
+    if (!threadData) {
+        // our thread storage has been destroyed already, or this is the first match in this thread
+        threadData = new QPcreThreadData;
+        if (threadStorage)
+            threadStorage->setLocalData(threadData);
+        else
+            temporaryThreadData.reset(threadData);
+    }
+    pcre2_match_data_16 *matchData = threadData->matchDataFor(capturingCount);
+    if (Q_UNLIKELY(!matchData))
+        return priv;
 
     const unsigned short * const subjectUtf16 = subject.utf16() + subjectStart;
 
     int result;
 
     QReadLocker lock(&mutex);
+    QReadLocker jitLock(compiled->jitCompiled.loadAcquire() ? nullptr : &compiled->jitLock);
 
     if (!previousMatchWasEmpty) {
         result = safe_pcre2_match_16(compiledPattern,
                                      subjectUtf16, subjectLength,
                                      offset, pcreOptions,
-                                     matchData, matchContext);
+                                     threadData);
     } else {
         result = safe_pcre2_match_16(compiledPattern,
                                      subjectUtf16, subjectLength,
                                      offset, pcreOptions | PCRE2_NOTEMPTY_ATSTART | PCRE2_ANCHORED,
-                                     matchData, matchContext);
+                                     threadData);
 
         if (result == PCRE2_ERROR_NOMATCH) {
             ++offset;
@@ -1338,10 +1500,11 @@ QRegularExpressionMatchPrivate *QRegularExpressionPrivate::doMatch(const QString
             result = safe_pcre2_match_16(compiledPattern,
                                          subjectUtf16, subjectLength,
                                          offset, pcreOptions,
-                                         matchData, matchContext);
+                                         threadData);
         }
     }
 
+    jitLock.unlock();
     lock.unlock();
 
 #ifdef QREGULAREXPRESSION_DEBUG
@@ -1404,9 +1567,6 @@ QRegularExpressionMatchPrivate *QRegularExpressionPrivate::doMatch(const QString
         }
     }
 
-    pcre2_match_data_free_16(matchData);
-    pcre2_match_context_free_16(matchContext);
-
     return priv;
 }
 
@@ -1927,6 +2087,39 @@ QString QRegularExpression::escape(const QString &str)
     return result;
 }
 
+/*!
+    \since 5.11
+
+    Sets the maximum size, in bytes, of the stack that the JIT-compiled code
+    of a regular expression may use in each thread to \a size. The stack is
+    allocated on demand, the first time a match in a thread runs out of the
+    default 32K stack; a larger stack allows more complex patterns (for
+    instance, patterns with deeply nested groups) to be matched against long
+    subjects. The default is 512K.
+
+    The new size only affects the threads in which the stack has not been
+    allocated yet, or has turned out to be too small.
+
+    \sa maximumJitStackSize()
+*/
+void QRegularExpression::setMaximumJitStackSize(int size)
+{
+    qt_regularexpression_max_jit_stack_size.store(qMax(size, 32 * 1024));
+}
+
+/*!
+    \since 5.11
+
+    Returns the maximum size, in bytes, of the per-thread stack used by the
+    JIT-compiled code of regular expressions.
+
+    \sa setMaximumJitStackSize()
+*/
+int QRegularExpression::maximumJitStackSize()
+{
+    return qt_regularexpression_max_jit_stack_size.load();
+}
+
 /*!
     \since 5.1
 
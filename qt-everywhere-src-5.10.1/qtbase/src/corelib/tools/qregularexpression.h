@@ -142,6 +142,9 @@ public:
 
     static QString escape(const QString &str);
 
+    static void setMaximumJitStackSize(int size);
+    static int maximumJitStackSize();
+
     bool operator==(const QRegularExpression &re) const;
     inline bool operator!=(const QRegularExpression &re) const { return !operator==(re); }
 
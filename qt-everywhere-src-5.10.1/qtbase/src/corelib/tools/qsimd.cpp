@@ -65,9 +65,11 @@
 #define HWCAP_VFPv3D16  16384
 
 // copied from <asm/hwcap.h> (ARM):
+#define HWCAP2_AES   (1 << 0)
 #define HWCAP2_CRC32 (1 << 4)
 
 // copied from <asm/hwcap.h> (Aarch64)
+#define HWCAP_AES               (1 << 3)
 #define HWCAP_CRC32             (1 << 7)
 
 // copied from <linux/auxvec.h>
@@ -112,6 +114,8 @@ static inline quint64 detectProcessorFeatures()
                     // For Aarch64:
                     if (vector[i+1] & HWCAP_CRC32)
                         features |= Q_UINT64_C(1) << CpuFeatureCRC32;
+                    if (vector[i+1] & HWCAP_AES)
+                        features |= Q_UINT64_C(1) << CpuFeatureAES;
 #  endif
                     // Aarch32, or ARMv7 or before:
                     if (vector[i+1] & HWCAP_NEON)
@@ -122,6 +126,8 @@ static inline quint64 detectProcessorFeatures()
                 if (vector[i] == AT_HWCAP2) {
                     if (vector[i+1] & HWCAP2_CRC32)
                         features |= Q_UINT64_C(1) << CpuFeatureCRC32;
+                    if (vector[i+1] & HWCAP2_AES)
+                        features |= Q_UINT64_C(1) << CpuFeatureAES;
                 }
 #  endif
             }
@@ -139,6 +145,9 @@ static inline quint64 detectProcessorFeatures()
 #if defined(__ARM_FEATURE_CRC32)
     features |= Q_UINT64_C(1) << CpuFeatureCRC32;
 #endif
+#if defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES)
+    features |= Q_UINT64_C(1) << CpuFeatureAES;
+#endif
 
     return features;
 }
@@ -505,12 +514,14 @@ static inline uint detectProcessorFeatures()
 /* Data:
  neon
  crc32
+ aes
  */
 static const char features_string[] =
         " neon\0"
         " crc32\0"
+        " aes\0"
         "\0";
-static const int features_indices[] = { 0, 6 };
+static const int features_indices[] = { 0, 6, 13 };
 #elif defined(Q_PROCESSOR_MIPS)
 /* Data:
  dsp
@@ -291,7 +291,7 @@
 #define QT_FUNCTION_TARGET_STRING_BMI           "bmi"
 #define QT_FUNCTION_TARGET_STRING_BMI2          "bmi2"
 #define QT_FUNCTION_TARGET_STRING_RDSEED        "rdseed"
-#define QT_FUNCTION_TARGET_STRING_SHA           "sha"
+#define QT_FUNCTION_TARGET_STRING_SHA           "sha,sse4.1"
 
 // other x86 intrinsics
 #if defined(Q_PROCESSOR_X86) && ((defined(Q_CC_GNU) && (Q_CC_GNU >= 404)) \
@@ -341,6 +341,7 @@ enum CPUFeatures {
     CpuFeatureNEON          = 0,
     CpuFeatureARM_NEON      = CpuFeatureNEON,
     CpuFeatureCRC32         = 1,
+    CpuFeatureAES           = 2,
 #elif defined(Q_PROCESSOR_MIPS)
     CpuFeatureDSP           = 0,
     CpuFeatureDSPR2         = 1,
@@ -471,6 +472,9 @@ static const quint64 qCompilerCpuFeatures = 0
 #if defined __ARM_FEATURE_CRC32
         | (Q_UINT64_C(1) << CpuFeatureCRC32)
 #endif
+#if defined __ARM_FEATURE_CRYPTO || defined __ARM_FEATURE_AES
+        | (Q_UINT64_C(1) << CpuFeatureAES)
+#endif
 #if defined __mips_dsp
         | (Q_UINT64_C(1) << CpuFeatureDSP)
 #endif
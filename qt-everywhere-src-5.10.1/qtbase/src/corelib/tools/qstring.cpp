@@ -418,6 +418,34 @@ static void qt_to_latin1(uchar *dst, const ushort *src, int length)
 #endif
 }
 
+#ifdef __SSE2__
+// Returns true if none of the eight characters in \a chunk is outside of US-ASCII
+static inline bool isAscii_sse2(__m128i chunk)
+{
+    const __m128i nonAscii = _mm_and_si128(chunk, _mm_set1_epi16(short(0xff80)));
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, _mm_setzero_si128())) == 0xffff;
+}
+
+// Folds the case of eight US-ASCII characters; this is what foldCase() does
+// for them, but the result is meaningless for other characters
+static inline __m128i foldCaseAscii_sse2(__m128i chunk)
+{
+    const __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi16(chunk, _mm_set1_epi16('A' - 1)),
+                                          _mm_cmplt_epi16(chunk, _mm_set1_epi16('Z' + 1)));
+    return _mm_add_epi16(chunk, _mm_and_si128(isUpper, _mm_set1_epi16(0x20)));
+}
+
+// Returns true if \a a and \a b are both US-ASCII and equal when their
+// case is ignored
+static inline bool equalsAsciiIgnoringCase_sse2(__m128i a, __m128i b)
+{
+    if (!isAscii_sse2(_mm_or_si128(a, b)))
+        return false;
+    const __m128i equal = _mm_cmpeq_epi16(foldCaseAscii_sse2(a), foldCaseAscii_sse2(b));
+    return _mm_movemask_epi8(equal) == 0xffff;
+}
+#endif
+
 // Unicode case-insensitive comparison
 static int ucstricmp(const QChar *a, const QChar *ae, const QChar *b, const QChar *be)
 {
@@ -431,14 +459,28 @@ static int ucstricmp(const QChar *a, const QChar *ae, const QChar *b, const QCha
     uint alast = 0;
     uint blast = 0;
     while (a < e) {
-//         qDebug() << hex << alast << blast;
-//         qDebug() << hex << "*a=" << *a << "alast=" << alast << "folded=" << foldCase (*a, alast);
-//         qDebug() << hex << "*b=" << *b << "blast=" << blast << "folded=" << foldCase (*b, blast);
-        int diff = foldCase(a->unicode(), alast) - foldCase(b->unicode(), blast);
-        if ((diff))
-            return diff;
-        ++a;
-        ++b;
+        const QChar *blockEnd = e;
+#ifdef __SSE2__
+        // skip eight US-ASCII characters at a time while they are equal,
+        // and compare the block one by one otherwise
+        if (e - a >= 8) {
+            const __m128i chunkA = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a));
+            const __m128i chunkB = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b));
+            if (equalsAsciiIgnoringCase_sse2(chunkA, chunkB)) {
+                alast = a[7].unicode();
+                blast = b[7].unicode();
+                a += 8;
+                b += 8;
+                continue;
+            }
+            blockEnd = a + 8;
+        }
+#endif
+        for ( ; a < blockEnd; ++a, ++b) {
+            int diff = foldCase(a->unicode(), alast) - foldCase(b->unicode(), blast);
+            if ((diff))
+                return diff;
+        }
     }
     if (a == ae) {
         if (b == be)
@@ -456,11 +498,25 @@ static int ucstricmp(const QChar *a, const QChar *ae, const char *b, const char
         e = a + (be - b);
 
     while (a < e) {
-        int diff = foldCase(a->unicode()) - foldCase(uchar(*b));
-        if ((diff))
-            return diff;
-        ++a;
-        ++b;
+        auto blockEnd = e;
+#ifdef __SSE2__
+        if (e - a >= 8) {
+            const __m128i chunkA = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a));
+            const __m128i chunkB = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(b)),
+                                                     _mm_setzero_si128());
+            if (equalsAsciiIgnoringCase_sse2(chunkA, chunkB)) {
+                a += 8;
+                b += 8;
+                continue;
+            }
+            blockEnd = a + 8;
+        }
+#endif
+        for ( ; a < blockEnd; ++a, ++b) {
+            int diff = foldCase(a->unicode()) - foldCase(uchar(*b));
+            if ((diff))
+                return diff;
+        }
     }
     if (a == ae) {
         if (b == be)
@@ -885,6 +941,30 @@ static int findChar(const QChar *str, int len, QChar ch, int from,
                     return  n - s;
         } else {
             c = foldCase(c);
+#ifdef __SSE2__
+            if (c < 0x80) {
+                // US-ASCII blocks can only match the two cases of c; other
+                // characters may fold to it too, so check those one by one
+                const ushort other = (c >= 'a' && c <= 'z') ? c - 0x20 : c;
+                const __m128i mch = _mm_set1_epi16(c);
+                const __m128i mother = _mm_set1_epi16(other);
+                for ( ; n + 8 <= e; n += 8) {
+                    const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n));
+                    if (isAscii_sse2(data)) {
+                        const __m128i result = _mm_or_si128(_mm_cmpeq_epi16(data, mch),
+                                                            _mm_cmpeq_epi16(data, mother));
+                        const uint mask = _mm_movemask_epi8(result);
+                        if (mask)
+                            return n - s + (qCountTrailingZeroBits(mask) >> 1);
+                    } else {
+                        for (int i = 0; i < 8; ++i) {
+                            if (foldCase(n[i]) == c)
+                                return n - s + i;
+                        }
+                    }
+                }
+            }
+#endif
             --n;
             while (++n != e)
                 if (foldCase(*n) == c)
@@ -3268,6 +3348,66 @@ int QString::indexOf(QLatin1String str, int from, Qt::CaseSensitivity cs) const
     return qt_find_latin1_string(unicode(), size(), str, from, cs);
 }
 
+#ifdef __SSE2__
+/*
+    Searches for \a needle by comparing eight positions of \a haystack at a
+    time with the first and the last character of \a needle, and comparing
+    all of it only where both match. For case-insensitive searches, the first
+    and last characters of \a needle must be US-ASCII.
+*/
+static int findStringSse2(const ushort *haystack, int haystackLen, int from,
+                          const ushort *needle, int needleLen, Qt::CaseSensitivity cs)
+{
+    const bool caseSensitive = cs == Qt::CaseSensitive;
+    const int lastOffset = needleLen - 1;
+    const ushort first = caseSensitive ? needle[0] : foldCase(needle[0]);
+    const ushort last = caseSensitive ? needle[lastOffset] : foldCase(needle[lastOffset]);
+    const __m128i mfirst = _mm_set1_epi16(first);
+    const __m128i mlast = _mm_set1_epi16(last);
+
+    const auto matchesAt = [=](const ushort *candidate) {
+        return qt_compare_strings(QStringView(candidate, needleLen), QStringView(needle, needleLen),
+                                  cs) == 0;
+    };
+    const auto mayMatchAt = [=](const ushort *candidate) {
+        return caseSensitive
+                ? candidate[0] == first && candidate[lastOffset] == last
+                : foldCase(candidate[0]) == first && foldCase(candidate[lastOffset]) == last;
+    };
+
+    const ushort *h = haystack + from;
+    const ushort * const end = haystack + haystackLen - lastOffset; // past the last candidate
+    for ( ; h + 8 <= end; h += 8) {
+        __m128i firsts = _mm_loadu_si128(reinterpret_cast<const __m128i *>(h));
+        __m128i lasts = _mm_loadu_si128(reinterpret_cast<const __m128i *>(h + lastOffset));
+        if (!caseSensitive) {
+            if (!isAscii_sse2(_mm_or_si128(firsts, lasts))) {
+                for (int i = 0; i < 8; ++i) {
+                    if (mayMatchAt(h + i) && matchesAt(h + i))
+                        return h + i - haystack;
+                }
+                continue;
+            }
+            firsts = foldCaseAscii_sse2(firsts);
+            lasts = foldCaseAscii_sse2(lasts);
+        }
+        uint mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(firsts, mfirst),
+                                                    _mm_cmpeq_epi16(lasts, mlast)));
+        while (mask) {
+            const int i = qCountTrailingZeroBits(mask) >> 1;
+            if (matchesAt(h + i))
+                return h + i - haystack;
+            mask &= ~(3U << (2 * i));
+        }
+    }
+    for ( ; h < end; ++h) {
+        if (mayMatchAt(h) && matchesAt(h))
+            return h - haystack;
+    }
+    return -1;
+}
+#endif
+
 int qFindString(
     const QChar *haystack0, int haystackLen, int from,
     const QChar *needle0, int needleLen, Qt::CaseSensitivity cs)
@@ -3286,6 +3426,13 @@ int qFindString(
     if (sl == 1)
         return findChar(haystack0, haystackLen, needle0[0], from, cs);
 
+#ifdef __SSE2__
+    if (cs == Qt::CaseSensitive || (needle0[0].unicode() < 0x80 && needle0[sl - 1].unicode() < 0x80)) {
+        return findStringSse2(reinterpret_cast<const ushort *>(haystack0), haystackLen, from,
+                              reinterpret_cast<const ushort *>(needle0), needleLen, cs);
+    }
+#endif
+
     /*
         We use the Boyer-Moore algorithm in cases where the overhead
         for the skip table should pay off, otherwise we use a simple
@@ -7983,6 +8130,24 @@ QString QString::arg(QLatin1String a, int fieldWidth, QChar fillChar) const
   a7, \a a8, and \a a9 are replaced in one pass.
 */
 
+/*!
+  \fn template <typename... Args> QString QString::arg(Args &&...args) const
+  \overload arg()
+  \since 5.11
+
+  Replaces occurrences of \c{%N} in this string with the corresponding
+  argument from \a args. The arguments may be any mix of QString,
+  QStringView and QLatin1String, and there is no limit on their number.
+
+  As with the other multi-argument overloads, the format string is parsed
+  only once and the result is written into a single allocation. Neither
+  QStringView nor QLatin1String arguments are converted to a temporary
+  QString first.
+
+  This overload takes part in overload resolution only if two or more
+  arguments are passed and all of them are string types.
+*/
+
 /*! \fn QString QString::arg(int a, int fieldWidth, int base, QChar fillChar) const
   \overload arg()
 
@@ -8354,18 +8519,23 @@ static int getEscape(const QChar *uc, int *pos, int len, int maxNumber = 999)
 namespace {
 struct Part
 {
-    Part() : stringRef(), number(0) {}
-    Part(const QString &s, int pos, int len, int num = -1) Q_DECL_NOTHROW
-        : stringRef(&s, pos, len), number(num) {}
+    Part() = default; // for QVarLengthArray; do not use
+    Q_DECL_CONSTEXPR Part(QStringView s, int num = -1)
+        : tag{QtPrivate::ArgBase::U16}, number{num}, data{s.utf16()}, size{int(s.size())} {}
+    Q_DECL_CONSTEXPR Part(QLatin1String s, int num = -1)
+        : tag{QtPrivate::ArgBase::L1}, number{num}, data{s.data()}, size{s.size()} {}
 
-    QStringRef stringRef;
+    void reset(QStringView s) Q_DECL_NOTHROW { *this = {s, number}; }
+    void reset(QLatin1String s) Q_DECL_NOTHROW { *this = {s, number}; }
+
+    QtPrivate::ArgBase::Tag tag;
     int number;
+    const void *data;
+    int size;
 };
 } // unnamed namespace
 
-template <>
-class QTypeInfo<Part> : public QTypeInfoMerger<Part, QStringRef, int> {}; // Q_DECLARE_METATYPE
-
+Q_DECLARE_TYPEINFO(Part, Q_PRIMITIVE_TYPE);
 
 namespace {
 
@@ -8374,12 +8544,12 @@ enum { ExpectedParts = 32 };
 typedef QVarLengthArray<Part, ExpectedParts> ParseResult;
 typedef QVarLengthArray<int, ExpectedParts/2> ArgIndexToPlaceholderMap;
 
-static ParseResult parseMultiArgFormatString(const QString &s)
+static ParseResult parseMultiArgFormatString(QStringView s)
 {
     ParseResult result;
 
-    const QChar *uc = s.constData();
-    const int len = s.size();
+    const QChar *uc = s.data();
+    const int len = int(s.size());
     const int end = len - 1;
     int i = 0;
     int last = 0;
@@ -8390,8 +8560,8 @@ static ParseResult parseMultiArgFormatString(const QString &s)
             int number = getEscape(uc, &i, len);
             if (number != -1) {
                 if (last != percent)
-                    result.push_back(Part(s, last, percent - last)); // literal text (incl. failed placeholders)
-                result.push_back(Part(s, percent, i - percent, number));  // parsed placeholder
+                    result.push_back(Part{s.mid(last, percent - last)}); // literal text (incl. failed placeholders)
+                result.push_back(Part{s.mid(percent, i - percent), number});  // parsed placeholder
                 last = i;
                 continue;
             }
@@ -8400,7 +8570,7 @@ static ParseResult parseMultiArgFormatString(const QString &s)
     }
 
     if (last < len)
-        result.push_back(Part(s, last, len - last)); // trailing literal text
+        result.push_back(Part{s.mid(last, len - last)}); // trailing literal text
 
     return result;
 }
@@ -8421,17 +8591,27 @@ static ArgIndexToPlaceholderMap makeArgIndexToPlaceholderMap(const ParseResult &
     return result;
 }
 
-static int resolveStringRefsAndReturnTotalSize(ParseResult &parts, const ArgIndexToPlaceholderMap &argIndexToPlaceholderMap, const QString *args[])
+static int resolveStringRefsAndReturnTotalSize(ParseResult &parts, const ArgIndexToPlaceholderMap &argIndexToPlaceholderMap, const QtPrivate::ArgBase *args[])
 {
+    using namespace QtPrivate;
     int totalSize = 0;
     for (ParseResult::iterator pit = parts.begin(), end = parts.end(); pit != end; ++pit) {
         if (pit->number != -1) {
             const ArgIndexToPlaceholderMap::const_iterator ait
                     = std::find(argIndexToPlaceholderMap.begin(), argIndexToPlaceholderMap.end(), pit->number);
-            if (ait != argIndexToPlaceholderMap.end())
-                pit->stringRef = QStringRef(args[ait - argIndexToPlaceholderMap.begin()]);
+            if (ait != argIndexToPlaceholderMap.end()) {
+                const ArgBase &arg = *args[ait - argIndexToPlaceholderMap.begin()];
+                switch (arg.tag) {
+                case ArgBase::L1:
+                    pit->reset(static_cast<const QLatin1StringArg&>(arg).string);
+                    break;
+                case ArgBase::U16:
+                    pit->reset(static_cast<const QStringViewArg&>(arg).string);
+                    break;
+                }
+            }
         }
-        totalSize += pit->stringRef.size();
+        totalSize += pit->size;
     }
     return totalSize;
 }
@@ -8439,31 +8619,57 @@ static int resolveStringRefsAndReturnTotalSize(ParseResult &parts, const ArgInde
 } // unnamed namespace
 
 QString QString::multiArg(int numArgs, const QString **args) const
+{
+    QVarLengthArray<QtPrivate::QStringViewArg, 9> views(numArgs);
+    QVarLengthArray<const QtPrivate::ArgBase *, 9> argBases(numArgs);
+    for (int i = 0; i < numArgs; ++i) {
+        views[i] = QtPrivate::QStringViewArg{qToStringViewIgnoringNull(*args[i])};
+        argBases[i] = &views[i];
+    }
+    return QtPrivate::argToQString(qToStringViewIgnoringNull(*this), size_t(numArgs), argBases.data());
+}
+
+/*!
+    \internal
+
+    Replaces the lowest-numbered place markers in \a pattern with the \a n
+    strings in \a args, in a single pass and with a single allocation for the
+    result. This is the implementation of the multi-argument QString::arg()
+    overloads.
+*/
+QString QtPrivate::argToQString(QStringView pattern, size_t numArgs, const ArgBase **args)
 {
     // Step 1-2 above
-    ParseResult parts = parseMultiArgFormatString(*this);
+    ParseResult parts = parseMultiArgFormatString(pattern);
 
     // 3-4
     ArgIndexToPlaceholderMap argIndexToPlaceholderMap = makeArgIndexToPlaceholderMap(parts);
 
-    if (argIndexToPlaceholderMap.size() > numArgs) // 3a
-        argIndexToPlaceholderMap.resize(numArgs);
-    else if (argIndexToPlaceholderMap.size() < numArgs) // 3b
+    if (static_cast<size_t>(argIndexToPlaceholderMap.size()) > numArgs) // 3a
+        argIndexToPlaceholderMap.resize(int(numArgs));
+    else if (Q_UNLIKELY(static_cast<size_t>(argIndexToPlaceholderMap.size()) < numArgs)) // 3b
         qWarning("QString::arg: %d argument(s) missing in %s",
-                 numArgs - argIndexToPlaceholderMap.size(), toLocal8Bit().data());
+                 int(numArgs - argIndexToPlaceholderMap.size()), pattern.toString().toLocal8Bit().data());
 
     // 5
     const int totalSize = resolveStringRefsAndReturnTotalSize(parts, argIndexToPlaceholderMap, args);
 
     // 6:
     QString result(totalSize, Qt::Uninitialized);
-    QChar *out = result.data();
+    ushort *out = reinterpret_cast<ushort *>(result.data());
 
     for (ParseResult::const_iterator it = parts.begin(), end = parts.end(); it != end; ++it) {
-        if (const int sz = it->stringRef.size()) {
-            memcpy(out, it->stringRef.constData(), sz * sizeof(QChar));
-            out += sz;
+        switch (it->tag) {
+        case ArgBase::L1:
+            if (it->size)
+                qt_from_latin1(out, static_cast<const char*>(it->data), uint(it->size));
+            break;
+        case ArgBase::U16:
+            if (it->size)
+                memcpy(out, it->data, it->size * sizeof(QChar));
+            break;
         }
+        out += it->size;
     }
 
     return result;
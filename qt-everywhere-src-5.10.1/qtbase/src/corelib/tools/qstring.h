@@ -209,6 +209,38 @@ bool QStringView::startsWith(QLatin1String s, Qt::CaseSensitivity cs) const Q_DE
 bool QStringView::endsWith(QLatin1String s, Qt::CaseSensitivity cs) const Q_DECL_NOTHROW
 { return QtPrivate::endsWith(*this, s, cs); }
 
+class QString;
+
+namespace QtPrivate {
+// arguments accepted by the variadic QString::arg() overload
+template <typename T> struct IsStringArg : std::false_type {};
+template <> struct IsStringArg<QString> : std::true_type {};
+template <> struct IsStringArg<QStringView> : std::true_type {};
+template <> struct IsStringArg<QLatin1String> : std::true_type {};
+
+template <typename... Args> struct AreStringArgs : std::true_type {};
+template <typename T, typename... Args> struct AreStringArgs<T, Args...>
+    : std::integral_constant<bool, IsStringArg<typename std::decay<T>::type>::value
+                                   && AreStringArgs<Args...>::value> {};
+
+struct ArgBase {
+    enum Tag : uchar { L1, U16 } tag;
+};
+
+struct QStringViewArg : ArgBase {
+    QStringView string;
+    Q_DECL_CONSTEXPR QStringViewArg() Q_DECL_NOTHROW : ArgBase{U16}, string{} {}
+    Q_DECL_CONSTEXPR explicit QStringViewArg(QStringView v) Q_DECL_NOTHROW : ArgBase{U16}, string{v} {}
+};
+
+struct QLatin1StringArg : ArgBase {
+    QLatin1String string;
+    Q_DECL_CONSTEXPR explicit QLatin1StringArg(QLatin1String v) Q_DECL_NOTHROW : ArgBase{L1}, string{v} {}
+};
+
+Q_REQUIRED_RESULT Q_CORE_EXPORT QString argToQString(QStringView pattern, size_t n, const ArgBase **args);
+} // namespace QtPrivate
+
 class Q_CORE_EXPORT QString
 {
 public:
@@ -313,6 +345,13 @@ public:
     Q_REQUIRED_RESULT QString arg(const QString &a1, const QString &a2, const QString &a3,
                 const QString &a4, const QString &a5, const QString &a6,
                 const QString &a7, const QString &a8, const QString &a9) const;
+#if defined(Q_COMPILER_VARIADIC_TEMPLATES) || defined(Q_QDOC)
+    template <typename... Args>
+    Q_REQUIRED_RESULT
+    typename std::enable_if<(sizeof...(Args) >= 2) && QtPrivate::AreStringArgs<Args...>::value,
+                            QString>::type
+    arg(Args &&...args) const;
+#endif
 
     QString &vsprintf(const char *format, va_list ap) Q_ATTRIBUTE_FORMAT_PRINTF(2, 0);
     QString &sprintf(const char *format, ...) Q_ATTRIBUTE_FORMAT_PRINTF(2, 3);
@@ -994,6 +1033,30 @@ inline QString QString::arg(const QString &a1, const QString &a2, const QString
                             const QString &a7, const QString &a8, const QString &a9) const
 { const QString *args[9] = { &a1, &a2, &a3, &a4, &a5, &a6,  &a7, &a8, &a9 }; return multiArg(9, args); }
 
+namespace QtPrivate {
+inline QStringViewArg qStringLikeToArg(const QString &s) Q_DECL_NOTHROW
+{ return QStringViewArg{qToStringViewIgnoringNull(s)}; }
+Q_DECL_CONSTEXPR inline QStringViewArg qStringLikeToArg(QStringView s) Q_DECL_NOTHROW
+{ return QStringViewArg{s}; }
+Q_DECL_CONSTEXPR inline QLatin1StringArg qStringLikeToArg(QLatin1String s) Q_DECL_NOTHROW
+{ return QLatin1StringArg{s}; }
+
+template <typename... Args>
+Q_REQUIRED_RESULT Q_ALWAYS_INLINE QString argToQStringDispatch(QStringView pattern, const Args &...args)
+{
+    const ArgBase *argBases[] = { &args... };
+    return QtPrivate::argToQString(pattern, sizeof...(Args), argBases);
+}
+} // namespace QtPrivate
+
+#if defined(Q_COMPILER_VARIADIC_TEMPLATES) || defined(Q_QDOC)
+template <typename... Args>
+inline typename std::enable_if<(sizeof...(Args) >= 2) && QtPrivate::AreStringArgs<Args...>::value,
+                               QString>::type
+QString::arg(Args &&...args) const
+{ return QtPrivate::argToQStringDispatch(qToStringViewIgnoringNull(*this), QtPrivate::qStringLikeToArg(args)...); }
+#endif
+
 inline QString QString::section(QChar asep, int astart, int aend, SectionFlags aflags) const
 { return section(QString(asep), astart, aend, aflags); }
 
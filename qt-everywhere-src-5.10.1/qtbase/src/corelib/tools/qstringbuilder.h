@@ -277,6 +277,20 @@ template <> struct QConcatenable<QStringRef> : private QAbstractConcatenable
     }
 };
 
+template <> struct QConcatenable<QStringView> : private QAbstractConcatenable
+{
+    typedef QStringView type;
+    typedef QString ConvertTo;
+    enum { ExactSize = true };
+    static int size(QStringView a) { return int(a.size()); }
+    static inline void appendTo(QStringView a, QChar *&out)
+    {
+        const int n = int(a.size());
+        memcpy(out, reinterpret_cast<const char*>(a.data()), sizeof(QChar) * n);
+        out += n;
+    }
+};
+
 template <int N> struct QConcatenable<const char[N]> : private QAbstractConcatenable
 {
     typedef const char type[N];
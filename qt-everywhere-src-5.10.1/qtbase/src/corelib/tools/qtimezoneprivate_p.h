@@ -329,6 +329,9 @@ public:
 private:
     void init(const QByteArray &ianaId);
 
+    bool usesPosixRule(qint64 atMSecsSinceEpoch) const;
+    int transitionIndex(qint64 atMSecsSinceEpoch) const;
+    const QTzTransitionRule *transitionRule(qint64 atMSecsSinceEpoch) const;
     Data dataForTzTransition(QTzTransitionTime tran) const;
     QVector<QTzTransitionTime> m_tranTimes;
     QVector<QTzTransitionRule> m_tranRules;
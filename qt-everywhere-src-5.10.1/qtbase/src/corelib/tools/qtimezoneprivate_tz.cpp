@@ -42,6 +42,8 @@
 
 #include <QtCore/QFile>
 #include <QtCore/QHash>
+#include <QtCore/QCache>
+#include <QtCore/QMutex>
 #include <QtCore/QDataStream>
 #include <QtCore/QDateTime>
 
@@ -614,6 +616,32 @@ static QVector<QTimeZonePrivate::Data> calculatePosixTransitions(const QByteArra
     return result;
 }
 
+/*
+    Parsed contents of a tz file. The transitions and rules of a zone are shared by all
+    QTimeZone instances for it, and are kept in a process wide cache, so that creating
+    a time zone does not read and parse its file again.
+*/
+struct QTzTimeZoneCacheEntry
+{
+    QVector<QTzTransitionTime> m_tranTimes;
+    QVector<QTzTransitionRule> m_tranRules;
+    QList<QByteArray> m_abbreviations;
+    QByteArray m_posixRule;
+    bool m_valid = false;
+};
+
+class QTzTimeZoneCache
+{
+public:
+    QTzTimeZoneCacheEntry fetchEntry(const QByteArray &ianaId);
+
+private:
+    QMutex m_mutex;
+    QCache<QByteArray, QTzTimeZoneCacheEntry> m_cache;
+};
+
+Q_GLOBAL_STATIC(QTzTimeZoneCache, tzZoneCache)
+
 // Create the system default time zone
 QTzTimeZonePrivate::QTzTimeZonePrivate()
 {
@@ -635,21 +663,22 @@ QTzTimeZonePrivate *QTzTimeZonePrivate::clone() const
     return new QTzTimeZonePrivate(*this);
 }
 
-void QTzTimeZonePrivate::init(const QByteArray &ianaId)
+static QTzTimeZoneCacheEntry parseTzFile(const QByteArray &ianaId)
 {
+    QTzTimeZoneCacheEntry entry;
     QFile tzif;
     if (ianaId.isEmpty()) {
         // Open system tz
         tzif.setFileName(QStringLiteral("/etc/localtime"));
         if (!tzif.open(QIODevice::ReadOnly))
-            return;
+            return entry;
     } else {
         // Open named tz, try modern path first, if fails try legacy path
         tzif.setFileName(QLatin1String("/usr/share/zoneinfo/") + QString::fromLocal8Bit(ianaId));
         if (!tzif.open(QIODevice::ReadOnly)) {
             tzif.setFileName(QLatin1String("/usr/lib/zoneinfo/") + QString::fromLocal8Bit(ianaId));
             if (!tzif.open(QIODevice::ReadOnly))
-                return;
+                return entry;
         }
     }
 
@@ -659,59 +688,59 @@ void QTzTimeZonePrivate::init(const QByteArray &ianaId)
     bool ok = false;
     QTzHeader hdr = parseTzHeader(ds, &ok);
     if (!ok || ds.status() != QDataStream::Ok)
-        return;
+        return entry;
     QVector<QTzTransition> tranList = parseTzTransitions(ds, hdr.tzh_timecnt, false);
     if (ds.status() != QDataStream::Ok)
-        return;
+        return entry;
     QVector<QTzType> typeList = parseTzTypes(ds, hdr.tzh_typecnt);
     if (ds.status() != QDataStream::Ok)
-        return;
+        return entry;
     QMap<int, QByteArray> abbrevMap = parseTzAbbreviations(ds, hdr.tzh_charcnt, typeList);
     if (ds.status() != QDataStream::Ok)
-        return;
+        return entry;
     parseTzLeapSeconds(ds, hdr.tzh_leapcnt, false);
     if (ds.status() != QDataStream::Ok)
-        return;
+        return entry;
     typeList = parseTzIndicators(ds, typeList, hdr.tzh_ttisstdcnt, hdr.tzh_ttisgmtcnt);
     if (ds.status() != QDataStream::Ok)
-        return;
+        return entry;
 
     // If version 2 then parse the second block of data
     if (hdr.tzh_version == '2' || hdr.tzh_version == '3') {
         ok = false;
         QTzHeader hdr2 = parseTzHeader(ds, &ok);
         if (!ok || ds.status() != QDataStream::Ok)
-            return;
+            return entry;
         tranList = parseTzTransitions(ds, hdr2.tzh_timecnt, true);
         if (ds.status() != QDataStream::Ok)
-            return;
+            return entry;
         typeList = parseTzTypes(ds, hdr2.tzh_typecnt);
         if (ds.status() != QDataStream::Ok)
-            return;
+            return entry;
         abbrevMap = parseTzAbbreviations(ds, hdr2.tzh_charcnt, typeList);
         if (ds.status() != QDataStream::Ok)
-            return;
+            return entry;
         parseTzLeapSeconds(ds, hdr2.tzh_leapcnt, true);
         if (ds.status() != QDataStream::Ok)
-            return;
+            return entry;
         typeList = parseTzIndicators(ds, typeList, hdr2.tzh_ttisstdcnt, hdr2.tzh_ttisgmtcnt);
         if (ds.status() != QDataStream::Ok)
-            return;
-        m_posixRule = parseTzPosixRule(ds);
+            return entry;
+        entry.m_posixRule = parseTzPosixRule(ds);
         if (ds.status() != QDataStream::Ok)
-            return;
+            return entry;
     }
 
     // Translate the TZ file into internal format
 
     // Translate the array index based tz_abbrind into list index
     const int size = abbrevMap.size();
-    m_abbreviations.clear();
-    m_abbreviations.reserve(size);
+    entry.m_abbreviations.clear();
+    entry.m_abbreviations.reserve(size);
     QVector<int> abbrindList;
     abbrindList.reserve(size);
     for (auto it = abbrevMap.cbegin(), end = abbrevMap.cend(); it != end; ++it) {
-        m_abbreviations.append(it.value());
+        entry.m_abbreviations.append(it.value());
         abbrindList.append(it.key());
     }
     for (int i = 0; i < typeList.size(); ++i)
@@ -729,7 +758,7 @@ void QTzTimeZonePrivate::init(const QByteArray &ianaId)
 
     // Now for each transition time calculate and store our rule:
     const int tranCount = tranList.count();;
-    m_tranTimes.reserve(tranCount);
+    entry.m_tranTimes.reserve(tranCount);
     // The DST offset when in effect: usually stable, usually an hour:
     int lastDstOff = 3600;
     for (int i = 0; i < tranCount; i++) {
@@ -783,18 +812,52 @@ void QTzTimeZonePrivate::init(const QByteArray &ianaId)
         rule.abbreviationIndex = tz_type.tz_abbrind;
 
         // If the rule already exist then use that, otherwise add it
-        int ruleIndex = m_tranRules.indexOf(rule);
+        int ruleIndex = entry.m_tranRules.indexOf(rule);
         if (ruleIndex == -1) {
-            m_tranRules.append(rule);
-            tran.ruleIndex = m_tranRules.size() - 1;
+            entry.m_tranRules.append(rule);
+            tran.ruleIndex = entry.m_tranRules.size() - 1;
         } else {
             tran.ruleIndex = ruleIndex;
         }
 
         tran.atMSecsSinceEpoch = tz_tran.tz_time * 1000;
-        m_tranTimes.append(tran);
+        entry.m_tranTimes.append(tran);
     }
 
+    entry.m_valid = true;
+    return entry;
+}
+
+QTzTimeZoneCacheEntry QTzTimeZoneCache::fetchEntry(const QByteArray &ianaId)
+{
+    QMutexLocker locker(&m_mutex);
+    if (const QTzTimeZoneCacheEntry *cached = m_cache.object(ianaId))
+        return *cached;
+
+    // Parse outside of the lock, other threads may want other zones meanwhile
+    locker.unlock();
+    const QTzTimeZoneCacheEntry entry = parseTzFile(ianaId);
+    if (entry.m_valid) {
+        locker.relock();
+        m_cache.insert(ianaId, new QTzTimeZoneCacheEntry(entry));
+    }
+    return entry;
+}
+
+void QTzTimeZonePrivate::init(const QByteArray &ianaId)
+{
+    // The file behind the system time zone can be replaced at any time, so only
+    // the named zones are shared
+    const QTzTimeZoneCacheEntry entry = ianaId.isEmpty() ? parseTzFile(ianaId)
+                                                         : tzZoneCache()->fetchEntry(ianaId);
+    if (!entry.m_valid)
+        return;
+
+    m_tranTimes = entry.m_tranTimes;
+    m_tranRules = entry.m_tranRules;
+    m_abbreviations = entry.m_abbreviations;
+    m_posixRule = entry.m_posixRule;
+
     if (ianaId.isEmpty())
         m_id = systemTimeZoneId();
     else
@@ -899,17 +962,23 @@ QString QTzTimeZonePrivate::abbreviation(qint64 atMSecsSinceEpoch) const
 
 int QTzTimeZonePrivate::offsetFromUtc(qint64 atMSecsSinceEpoch) const
 {
+    if (const QTzTransitionRule *rule = transitionRule(atMSecsSinceEpoch))
+        return rule->stdOffset + rule->dstOffset;
     const QTimeZonePrivate::Data tran = data(atMSecsSinceEpoch);
     return tran.standardTimeOffset + tran.daylightTimeOffset;
 }
 
 int QTzTimeZonePrivate::standardTimeOffset(qint64 atMSecsSinceEpoch) const
 {
+    if (const QTzTransitionRule *rule = transitionRule(atMSecsSinceEpoch))
+        return rule->stdOffset;
     return data(atMSecsSinceEpoch).standardTimeOffset;
 }
 
 int QTzTimeZonePrivate::daylightTimeOffset(qint64 atMSecsSinceEpoch) const
 {
+    if (const QTzTransitionRule *rule = transitionRule(atMSecsSinceEpoch))
+        return rule->dstOffset;
     return data(atMSecsSinceEpoch).daylightTimeOffset;
 }
 
@@ -940,11 +1009,47 @@ QTimeZonePrivate::Data QTzTimeZonePrivate::dataForTzTransition(QTzTransitionTime
     return data;
 }
 
+static bool transitionBefore(const QTzTransitionTime &tran, qint64 atMSecsSinceEpoch)
+{
+    return tran.atMSecsSinceEpoch < atMSecsSinceEpoch;
+}
+
+static bool transitionAfter(qint64 atMSecsSinceEpoch, const QTzTransitionTime &tran)
+{
+    return atMSecsSinceEpoch < tran.atMSecsSinceEpoch;
+}
+
+// True if the time is after the last transition and we have a POSIX rule for it
+bool QTzTimeZonePrivate::usesPosixRule(qint64 atMSecsSinceEpoch) const
+{
+    return m_tranTimes.size() > 0 && m_tranTimes.last().atMSecsSinceEpoch < atMSecsSinceEpoch
+        && !m_posixRule.isEmpty() && atMSecsSinceEpoch >= 0;
+}
+
+// Index of the transition in effect at the given time, or of the earliest one if the
+// time is before all transitions; -1 if there are none.
+int QTzTimeZonePrivate::transitionIndex(qint64 atMSecsSinceEpoch) const
+{
+    if (m_tranTimes.isEmpty())
+        return -1;
+    const auto it = std::upper_bound(m_tranTimes.cbegin(), m_tranTimes.cend(),
+                                     atMSecsSinceEpoch, transitionAfter);
+    return it == m_tranTimes.cbegin() ? 0 : int(it - m_tranTimes.cbegin()) - 1;
+}
+
+// The rule in effect at the given time, unless it has to be calculated from the POSIX rule
+const QTzTransitionRule *QTzTimeZonePrivate::transitionRule(qint64 atMSecsSinceEpoch) const
+{
+    if (usesPosixRule(atMSecsSinceEpoch))
+        return nullptr;
+    const int index = transitionIndex(atMSecsSinceEpoch);
+    return index < 0 ? nullptr : &m_tranRules.at(m_tranTimes.at(index).ruleIndex);
+}
+
 QTimeZonePrivate::Data QTzTimeZonePrivate::data(qint64 forMSecsSinceEpoch) const
 {
     // If the required time is after the last transition and we have a POSIX rule then use it
-    if (m_tranTimes.size() > 0 && m_tranTimes.last().atMSecsSinceEpoch < forMSecsSinceEpoch
-        && !m_posixRule.isEmpty() && forMSecsSinceEpoch >= 0) {
+    if (usesPosixRule(forMSecsSinceEpoch)) {
         const int year = QDateTime::fromMSecsSinceEpoch(forMSecsSinceEpoch, Qt::UTC).date().year();
         QVector<QTimeZonePrivate::Data> posixTrans =
             calculatePosixTransitions(m_posixRule, year - 1, year + 1,
@@ -958,18 +1063,10 @@ QTimeZonePrivate::Data QTzTimeZonePrivate::data(qint64 forMSecsSinceEpoch) const
         }
     }
 
-    // Otherwise if we can find a valid tran then use its rule
-    for (int i = m_tranTimes.size() - 1; i >= 0; --i) {
-        if (m_tranTimes.at(i).atMSecsSinceEpoch <= forMSecsSinceEpoch) {
-            Data data = dataForTzTransition(m_tranTimes.at(i));
-            data.atMSecsSinceEpoch = forMSecsSinceEpoch;
-            return data;
-        }
-    }
-
-    // Otherwise use the earliest transition we have
-    if (m_tranTimes.size() > 0) {
-        Data data = dataForTzTransition(m_tranTimes.at(0));
+    // Otherwise use the rule of the last transition before the time, or the earliest one
+    const int index = transitionIndex(forMSecsSinceEpoch);
+    if (index >= 0) {
+        Data data = dataForTzTransition(m_tranTimes.at(index));
         data.atMSecsSinceEpoch = forMSecsSinceEpoch;
         return data;
     }
@@ -999,11 +1096,10 @@ QTimeZonePrivate::Data QTzTimeZonePrivate::nextTransition(qint64 afterMSecsSince
     }
 
     // Otherwise if we can find a valid tran then use its rule
-    for (int i = 0; i < m_tranTimes.size(); ++i) {
-        if (m_tranTimes.at(i).atMSecsSinceEpoch > afterMSecsSinceEpoch) {
-            return dataForTzTransition(m_tranTimes.at(i));
-        }
-    }
+    const auto next = std::upper_bound(m_tranTimes.cbegin(), m_tranTimes.cend(),
+                                       afterMSecsSinceEpoch, transitionAfter);
+    if (next != m_tranTimes.cend())
+        return dataForTzTransition(*next);
 
     // Otherwise we have no rule, or there is no next transition, so return invalid data
     return invalidData();
@@ -1025,11 +1121,10 @@ QTimeZonePrivate::Data QTzTimeZonePrivate::previousTransition(qint64 beforeMSecs
     }
 
     // Otherwise if we can find a valid tran then use its rule
-    for (int i = m_tranTimes.size() - 1; i >= 0; --i) {
-        if (m_tranTimes.at(i).atMSecsSinceEpoch < beforeMSecsSinceEpoch) {
-            return dataForTzTransition(m_tranTimes.at(i));
-        }
-    }
+    const auto last = std::lower_bound(m_tranTimes.cbegin(), m_tranTimes.cend(),
+                                       beforeMSecsSinceEpoch, transitionBefore);
+    if (last != m_tranTimes.cbegin())
+        return dataForTzTransition(*(last - 1));
 
     // Otherwise we have no rule, so return invalid data
     return invalidData();
@@ -4,6 +4,8 @@ intel_icc: QMAKE_CXXFLAGS += -fp-model strict
 
 HEADERS +=  \
         tools/qalgorithms.h \
+        tools/qarena.h \
+        tools/qarena_p.h \
         tools/qarraydata.h \
         tools/qarraydataops.h \
         tools/qarraydatapointer.h \
@@ -17,12 +19,14 @@ HEADERS +=  \
         tools/qchar.h \
         tools/qcollator.h \
         tools/qcollator_p.h \
+        tools/qcompactstring.h \
         tools/qcontainerfwd.h \
         tools/qcryptographichash.h \
         tools/qdatetime.h \
         tools/qdatetime_p.h \
         tools/qdoublescanprint_p.h \
         tools/qeasingcurve.h \
+        tools/qflathash.h \
         tools/qfreelist_p.h \
         tools/qhash.h \
         tools/qhashfunctions.h \
@@ -75,6 +79,7 @@ HEADERS +=  \
 
 
 SOURCES += \
+        tools/qarena.cpp \
         tools/qarraydata.cpp \
         tools/qbitarray.cpp \
         tools/qbytearray.cpp \
@@ -1136,6 +1136,48 @@ bool QXmlStreamReaderPrivate::scanAttType()
     return false;
 }
 
+/*!
+ \internal
+
+ Returns the end of the run of characters in \a buffer, starting at \a pos,
+ that fastScanLiteralContent() would append to the text buffer unchanged.
+ Tabs end the run, as they may need to be normalized.
+ */
+static inline int literalContentRunEnd(const QString &buffer, int pos)
+{
+    const ushort *data = reinterpret_cast<const ushort *>(buffer.constData());
+    const int size = buffer.size();
+    for (; pos < size; ++pos) {
+        const ushort c = data[pos];
+        if (c < 0x20 || c == '&' || c == '<' || c == '\"' || c == '\'' || c >= 0xfffe)
+            break;
+    }
+    return pos;
+}
+
+/*!
+ \internal
+
+ Returns the end of the run of characters in \a buffer, starting at \a pos,
+ that fastScanContentCharList() would append to the text buffer unchanged.
+ \a whitespace is set to false if the run contains other characters than
+ spaces and tabs.
+ */
+static inline int contentCharRunEnd(const QString &buffer, int pos, bool *whitespace)
+{
+    const ushort *data = reinterpret_cast<const ushort *>(buffer.constData());
+    const int size = buffer.size();
+    for (; pos < size; ++pos) {
+        const ushort c = data[pos];
+        if (c == ' ' || c == '\t')
+            continue;
+        if (c < 0x20 || c == '&' || c == '<' || c == ']' || c >= 0xfffe)
+            break;
+        *whitespace = false;
+    }
+    return pos;
+}
+
 /*!
  \internal
 
@@ -1152,7 +1194,18 @@ inline int QXmlStreamReaderPrivate::fastScanLiteralContent()
 {
     int n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    for (;;) {
+        // Copy plain characters straight from the read buffer
+        if (putStack.isEmpty()) {
+            const int end = literalContentRunEnd(readBuffer, readBufferPos);
+            if (end > readBufferPos) {
+                textBuffer.append(readBuffer.constData() + readBufferPos, end - readBufferPos);
+                n += end - readBufferPos;
+                readBufferPos = end;
+            }
+        }
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (ushort(c)) {
         case 0xfffe:
         case 0xffff:
@@ -1235,7 +1288,21 @@ inline int QXmlStreamReaderPrivate::fastScanContentCharList()
 {
     int n = 0;
     uint c;
-    while ((c = getChar()) != StreamEOF) {
+    for (;;) {
+        // Copy plain characters straight from the read buffer
+        if (putStack.isEmpty()) {
+            bool whitespace = true;
+            const int end = contentCharRunEnd(readBuffer, readBufferPos, &whitespace);
+            if (end > readBufferPos) {
+                textBuffer.append(readBuffer.constData() + readBufferPos, end - readBufferPos);
+                n += end - readBufferPos;
+                readBufferPos = end;
+                if (!whitespace)
+                    isWhitespace = false;
+            }
+        }
+        if ((c = getChar()) == StreamEOF)
+            break;
         switch (ushort(c)) {
         case 0xfffe:
         case 0xffff:
@@ -143,6 +143,7 @@ public:
 
     bool appendVariantInternal(const QVariant &arg);
     bool appendRegisteredType(const QVariant &arg);
+    bool appendFixedArray(const QVariant &arg);
     bool appendCrossMarshalling(QDBusDemarshaller *arg);
 
 public:
@@ -183,6 +184,7 @@ public:
     QDBusVariant toVariant();
     QStringList toStringList();
     QByteArray toByteArray();
+    bool toFixedArray(int id, void *data);
 
     QDBusDemarshaller *beginStructure();
     QDBusDemarshaller *endStructure();
@@ -238,10 +238,14 @@ public:
 
     QDBusMetaObject *findMetaObject(const QString &service, const QString &path,
                                     const QString &interface, QDBusError &error);
+    bool hasCachedMetaObject(const QString &interface);
+    void cacheMetaObjects(const QString &interface, const QDBusMessage &introspectReply);
 
     void postEventToThread(int action, QObject *target, QEvent *event);
 
 private:
+    QDBusMetaObject *createMetaObject(const QString &interface, const QDBusMessage &introspectReply,
+                                      QDBusError &error);
     void checkThread();
     bool handleError(const QDBusErrorInternal &error);
 
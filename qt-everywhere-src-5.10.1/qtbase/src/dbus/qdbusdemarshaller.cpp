@@ -359,6 +359,55 @@ QByteArray QDBusDemarshaller::toByteArray()
     return QByteArray();
 }
 
+template <typename DBusType, typename T>
+static void qIterGetFixedArray(DBusMessageIter *it, QList<T> *list)
+{
+    DBusMessageIter sub;
+    q_dbus_message_iter_recurse(it, &sub);
+    q_dbus_message_iter_next(it);
+    int len;
+    DBusType *data;
+    q_dbus_message_iter_get_fixed_array(&sub, &data, &len);
+
+    list->clear();
+    list->reserve(len);
+    for (int i = 0; i < len; ++i)
+        list->append(T(data[i]));
+}
+
+/*
+    Reads an array of a fixed size type directly into the list of metatype
+    \a id pointed to by \a data, without going through QDBusArgument for
+    each element. Returns false if the current argument is not an array of
+    the matching D-Bus type.
+*/
+bool QDBusDemarshaller::toFixedArray(int id, void *data)
+{
+    if (q_dbus_message_iter_get_arg_type(&iterator) != DBUS_TYPE_ARRAY)
+        return false;
+
+    const int element = q_dbus_message_iter_get_element_type(&iterator);
+    if (id == qMetaTypeId<QList<bool> >() && element == DBUS_TYPE_BOOLEAN)
+        qIterGetFixedArray<dbus_bool_t>(&iterator, static_cast<QList<bool> *>(data));
+    else if (id == qMetaTypeId<QList<short> >() && element == DBUS_TYPE_INT16)
+        qIterGetFixedArray<dbus_int16_t>(&iterator, static_cast<QList<short> *>(data));
+    else if (id == qMetaTypeId<QList<ushort> >() && element == DBUS_TYPE_UINT16)
+        qIterGetFixedArray<dbus_uint16_t>(&iterator, static_cast<QList<ushort> *>(data));
+    else if (id == qMetaTypeId<QList<int> >() && element == DBUS_TYPE_INT32)
+        qIterGetFixedArray<dbus_int32_t>(&iterator, static_cast<QList<int> *>(data));
+    else if (id == qMetaTypeId<QList<uint> >() && element == DBUS_TYPE_UINT32)
+        qIterGetFixedArray<dbus_uint32_t>(&iterator, static_cast<QList<uint> *>(data));
+    else if (id == qMetaTypeId<QList<qlonglong> >() && element == DBUS_TYPE_INT64)
+        qIterGetFixedArray<dbus_int64_t>(&iterator, static_cast<QList<qlonglong> *>(data));
+    else if (id == qMetaTypeId<QList<qulonglong> >() && element == DBUS_TYPE_UINT64)
+        qIterGetFixedArray<dbus_uint64_t>(&iterator, static_cast<QList<qulonglong> *>(data));
+    else if (id == qMetaTypeId<QList<double> >() && element == DBUS_TYPE_DOUBLE)
+        qIterGetFixedArray<double>(&iterator, static_cast<QList<double> *>(data));
+    else
+        return false;
+    return true;
+}
+
 bool QDBusDemarshaller::atEnd()
 {
     // dbus_message_iter_has_next is broken if the list has one single element
@@ -2548,6 +2548,33 @@ QDBusConnectionPrivate::findMetaObject(const QString &service, const QString &pa
 
     // it doesn't exist yet, we have to create it
     QDBusWriteLocker locker(FindMetaObject2Action, this);
+    return createMetaObject(interface, reply, error);
+}
+
+bool QDBusConnectionPrivate::hasCachedMetaObject(const QString &interface)
+{
+    QDBusReadLocker locker(FindMetaObject1Action, this);
+    return cachedMetaObjects.contains(interface);
+}
+
+/*
+    Fills the metaobject cache from the reply to an Introspect call that
+    was made asynchronously.
+*/
+void QDBusConnectionPrivate::cacheMetaObjects(const QString &interface, const QDBusMessage &introspectReply)
+{
+    QDBusWriteLocker locker(FindMetaObject2Action, this);
+    QDBusError error;
+    QDBusMetaObject *mo = createMetaObject(interface, introspectReply, error);
+    if (mo && !mo->cached)
+        delete mo;
+}
+
+// must be called with the write lock held
+QDBusMetaObject *QDBusConnectionPrivate::createMetaObject(const QString &interface,
+                                                          const QDBusMessage &reply,
+                                                          QDBusError &error)
+{
     QDBusMetaObject *mo = 0;
     if (!interface.isEmpty())
         mo = cachedMetaObjects.value(interface, 0);
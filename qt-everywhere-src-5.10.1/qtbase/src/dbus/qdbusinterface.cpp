@@ -46,6 +46,9 @@
 
 #include "qdbusmetatype_p.h"
 #include "qdbusconnection_p.h"
+#include "qdbusmessage_p.h"
+#include "qdbuspendingcall.h"
+#include "qdbusutil_p.h"
 
 #ifndef QT_NO_DBUS
 
@@ -220,6 +223,61 @@ QDBusInterface::QDBusInterface(const QString &service, const QString &path, cons
 {
 }
 
+/*!
+    \since 5.11
+
+    Starts introspecting the object at path \a path on service \a service
+    over \a connection without blocking, and returns the pending call.
+
+    Once the call has finished, the descriptions of \a interface and of all
+    other interfaces found on that object are cached, so that constructing a
+    QDBusInterface for any of them does not need to call the remote object
+    anymore. The cache is shared by all QDBusInterface objects using the same
+    connection. If \a interface is already in the cache, the returned call
+    has finished already.
+
+    Use a QDBusPendingCallWatcher to be notified when the call finishes:
+
+    \code
+    QDBusPendingCall call = QDBusInterface::introspectAsync(service, path, interface);
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(call, this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, [=]() {
+        iface = new QDBusInterface(service, path, interface);
+        watcher->deleteLater();
+    });
+    \endcode
+
+    \sa QDBusPendingCallWatcher
+*/
+QDBusPendingCall QDBusInterface::introspectAsync(const QString &service, const QString &path,
+                                                 const QString &interface,
+                                                 const QDBusConnection &connection)
+{
+    QDBusMessage msg = QDBusMessage::createMethodCall(service, path,
+                                                      QDBusUtil::dbusInterfaceIntrospectable(),
+                                                      QStringLiteral("Introspect"));
+    QDBusConnectionPrivate *connPriv = QDBusConnectionPrivate::d(connection);
+    if (!connPriv || !connection.isConnected())
+        return QDBusPendingCall::fromError(QDBusError(QDBusError::Disconnected,
+                                                      QDBusUtil::disconnectedErrorMessage()));
+    if (!interface.isEmpty() && connPriv->hasCachedMetaObject(interface))
+        return QDBusPendingCall::fromCompletedCall(msg.createReply());
+
+    QDBusMessagePrivate::setParametersValidated(msg, true);
+    QDBusPendingCall call = connection.asyncCall(msg);
+
+    // connected before any watcher of the caller, so the cache is filled
+    // by the time they are notified
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(call);
+    QObject::connect(watcher, &QDBusPendingCallWatcher::finished, watcher,
+                     [connection, interface](QDBusPendingCallWatcher *self) {
+        if (QDBusConnectionPrivate *connPriv = QDBusConnectionPrivate::d(connection))
+            connPriv->cacheMetaObjects(interface, self->reply());
+        self->deleteLater();
+    });
+    return call;
+}
+
 /*!
     Destroy the object interface and frees up any resource used.
 */
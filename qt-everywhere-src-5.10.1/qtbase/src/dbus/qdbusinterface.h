@@ -62,6 +62,10 @@ public:
                    QObject *parent = Q_NULLPTR);
     ~QDBusInterface();
 
+    static QDBusPendingCall introspectAsync(const QString &service, const QString &path,
+                                            const QString &interface = QString(),
+                                            const QDBusConnection &connection = QDBusConnection::sessionBus());
+
     virtual const QMetaObject *metaObject() const Q_DECL_OVERRIDE;
     virtual void *qt_metacast(const char *) Q_DECL_OVERRIDE;
     virtual int qt_metacall(QMetaObject::Call, int, void **) Q_DECL_OVERRIDE;
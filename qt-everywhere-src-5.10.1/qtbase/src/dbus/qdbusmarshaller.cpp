@@ -42,6 +42,10 @@
 #include "qdbusmetatype_p.h"
 #include "qdbusutil_p.h"
 
+#include <qvarlengtharray.h>
+
+#include <algorithm>
+
 #ifndef QT_NO_DBUS
 
 QT_BEGIN_NAMESPACE
@@ -54,6 +58,22 @@ static void qIterAppend(DBusMessageIter *it, QByteArray *ba, int type, const voi
         q_dbus_message_iter_append_basic(it, type, arg);
 }
 
+template <typename DBusType, typename T>
+static void qIterAppendFixedArray(DBusMessageIter *it, int type, const QList<T> &list)
+{
+    // QList does not keep its elements contiguous in general, so gather
+    // them first; libdbus then copies the whole block in one go
+    QVarLengthArray<DBusType, 256> buffer(list.size());
+    std::copy(list.cbegin(), list.cend(), buffer.begin());
+    const DBusType *data = buffer.constData();
+
+    const char signature[2] = { char(type), 0 };
+    DBusMessageIter sub;
+    q_dbus_message_iter_open_container(it, DBUS_TYPE_ARRAY, signature, &sub);
+    q_dbus_message_iter_append_fixed_array(&sub, type, &data, buffer.size());
+    q_dbus_message_iter_close_container(it, &sub);
+}
+
 QDBusMarshaller::~QDBusMarshaller()
 {
     close();
@@ -495,7 +515,8 @@ bool QDBusMarshaller::appendVariantInternal(const QVariant &arg)
             return true;
 
         default:
-            ;
+            if (appendFixedArray(arg))
+                return true;
         }
         Q_FALLTHROUGH();
 
@@ -531,6 +552,72 @@ bool QDBusMarshaller::appendRegisteredType(const QVariant &arg)
     return QDBusMetaType::marshall(self, arg.userType(), arg.constData());
 }
 
+/*
+    Appends lists of fixed size types directly, instead of going through
+    QDBusArgument one element at a time. Returns false if \a arg does not
+    hold such a list.
+*/
+bool QDBusMarshaller::appendFixedArray(const QVariant &arg)
+{
+    const int id = arg.userType();
+    int type;
+    if (id == qMetaTypeId<QList<bool> >())
+        type = DBUS_TYPE_BOOLEAN;
+    else if (id == qMetaTypeId<QList<short> >())
+        type = DBUS_TYPE_INT16;
+    else if (id == qMetaTypeId<QList<ushort> >())
+        type = DBUS_TYPE_UINT16;
+    else if (id == qMetaTypeId<QList<int> >())
+        type = DBUS_TYPE_INT32;
+    else if (id == qMetaTypeId<QList<uint> >())
+        type = DBUS_TYPE_UINT32;
+    else if (id == qMetaTypeId<QList<qlonglong> >())
+        type = DBUS_TYPE_INT64;
+    else if (id == qMetaTypeId<QList<qulonglong> >())
+        type = DBUS_TYPE_UINT64;
+    else if (id == qMetaTypeId<QList<double> >())
+        type = DBUS_TYPE_DOUBLE;
+    else
+        return false;
+
+    if (ba) {
+        if (!skipSignature) {
+            *ba += DBUS_TYPE_ARRAY_AS_STRING;
+            *ba += char(type);
+        }
+        return true;
+    }
+
+    const void *data = arg.constData();
+    switch (type) {
+    case DBUS_TYPE_BOOLEAN:
+        qIterAppendFixedArray<dbus_bool_t>(&iterator, type, *static_cast<const QList<bool> *>(data));
+        break;
+    case DBUS_TYPE_INT16:
+        qIterAppendFixedArray<dbus_int16_t>(&iterator, type, *static_cast<const QList<short> *>(data));
+        break;
+    case DBUS_TYPE_UINT16:
+        qIterAppendFixedArray<dbus_uint16_t>(&iterator, type, *static_cast<const QList<ushort> *>(data));
+        break;
+    case DBUS_TYPE_INT32:
+        qIterAppendFixedArray<dbus_int32_t>(&iterator, type, *static_cast<const QList<int> *>(data));
+        break;
+    case DBUS_TYPE_UINT32:
+        qIterAppendFixedArray<dbus_uint32_t>(&iterator, type, *static_cast<const QList<uint> *>(data));
+        break;
+    case DBUS_TYPE_INT64:
+        qIterAppendFixedArray<dbus_int64_t>(&iterator, type, *static_cast<const QList<qlonglong> *>(data));
+        break;
+    case DBUS_TYPE_UINT64:
+        qIterAppendFixedArray<dbus_uint64_t>(&iterator, type, *static_cast<const QList<qulonglong> *>(data));
+        break;
+    case DBUS_TYPE_DOUBLE:
+        qIterAppendFixedArray<double>(&iterator, type, *static_cast<const QList<double> *>(data));
+        break;
+    }
+    return true;
+}
+
 bool QDBusMarshaller::appendCrossMarshalling(QDBusDemarshaller *demarshaller)
 {
     int code = q_dbus_message_iter_get_arg_type(&demarshaller->iterator);
@@ -283,6 +283,11 @@ bool QDBusMetaType::demarshall(const QDBusArgument &arg, int id, void *data)
     }
 #ifndef QT_BOOTSTRAPPED
     QDBusArgument copy = arg;
+    // lists of fixed size types can be read in one go
+    QDBusArgumentPrivate *d = QDBusArgumentPrivate::d(copy);
+    if (d && d->direction == QDBusArgumentPrivate::Demarshalling
+            && d->demarshaller()->toFixedArray(id, data))
+        return true;
     df(copy, data);
 #else
     Q_UNUSED(arg);
@@ -45,6 +45,7 @@
 #include "qimagereader.h"
 #include "private/qfactoryloader_p.h"
 #include "private/qiconloader_p.h"
+#include "private/qsharedimagecache_p.h"
 #include "qpainter.h"
 #include "qfileinfo.h"
 #include <qmimedatabase.h>
@@ -228,6 +229,21 @@ QPixmapIconEngineEntry *QPixmapIconEngine::tryMatch(const QSize &size, QIcon::Mo
 }
 
 
+// Icon files are decoded through the shared image cache, so that an image
+// already loaded elsewhere, e.g. by QtQuick, is not decoded and kept twice.
+static QPixmap loadIconFile(const QString &fileName)
+{
+    const QString key = QSharedImageCache::fileKey(QFileInfo(fileName));
+    QImage image;
+    if (key.isEmpty() || !QSharedImageCache::find(key, &image)) {
+        QImageReader reader(fileName);
+        if (!reader.read(&image))
+            return QPixmap();
+        QSharedImageCache::insert(key, image, QSharedImageCache::IconCategory);
+    }
+    return QPixmap::fromImage(image);
+}
+
 QPixmapIconEngineEntry *QPixmapIconEngine::bestMatch(const QSize &size, QIcon::Mode mode, QIcon::State state, bool sizeOnly)
 {
     QPixmapIconEngineEntry *pe = tryMatch(size, mode, state);
@@ -272,7 +288,7 @@ QPixmapIconEngineEntry *QPixmapIconEngine::bestMatch(const QSize &size, QIcon::M
     }
 
     if (sizeOnly ? (pe->size.isNull() || !pe->size.isValid()) : pe->pixmap.isNull()) {
-        pe->pixmap = QPixmap(pe->fileName);
+        pe->pixmap = loadIconFile(pe->fileName);
         if (!pe->pixmap.isNull())
             pe->size = pe->pixmap.size();
     }
@@ -66,6 +66,11 @@
 #include <private/qimage_p.h>
 #include <private/qfont_p.h>
 
+#ifndef QT_NO_THREAD
+#include <qsemaphore.h>
+#include <qthreadpool.h>
+#endif
+
 QT_BEGIN_NAMESPACE
 
 static inline bool isLocked(QImageData *data)
@@ -5187,6 +5192,141 @@ QImage::Format QImage::toImageFormat(QPixelFormat format) Q_DECL_NOTHROW
     return Format_Invalid;
 }
 
+#ifndef QT_NO_THREAD
+static QBasicAtomicInt qt_imageParallelProcessingDisabled = Q_BASIC_ATOMIC_INITIALIZER(0);
+static QBasicAtomicPointer<QThreadPool> qt_imageProcessingThreadPool = Q_BASIC_ATOMIC_INITIALIZER(nullptr);
+
+/*!
+    \since 5.11
+
+    Sets whether large images are converted and smoothly scaled by several
+    threads at once to \a enable. This is enabled by default.
+
+    When enabled, convertToFormat() and scaled() with
+    Qt::SmoothTransformation split images of more than a few hundred thousand
+    pixels into bands of scanlines that are processed in parallel on
+    processingThreadPool(). The calling thread always takes part in the work
+    and waits for the other bands to be done, so the result is the same as
+    with serial processing.
+
+    \sa isParallelProcessingEnabled(), setProcessingThreadPool()
+*/
+void QImage::setParallelProcessingEnabled(bool enable)
+{
+    qt_imageParallelProcessingDisabled.storeRelease(enable ? 0 : 1);
+}
+
+/*!
+    \since 5.11
+
+    Returns \c true if large images are converted and scaled by several
+    threads at once; otherwise returns \c false.
+
+    \sa setParallelProcessingEnabled()
+*/
+bool QImage::isParallelProcessingEnabled()
+{
+    return !qt_imageParallelProcessingDisabled.loadAcquire();
+}
+
+/*!
+    \since 5.11
+
+    Sets the thread pool used to process large images in parallel to \a pool.
+    Passing \c nullptr restores the default, QThreadPool::globalInstance().
+
+    QImage does not take ownership of \a pool, which must stay alive until it
+    is replaced.
+
+    \sa processingThreadPool(), setParallelProcessingEnabled()
+*/
+void QImage::setProcessingThreadPool(QThreadPool *pool)
+{
+    qt_imageProcessingThreadPool.storeRelease(pool);
+}
+
+/*!
+    \since 5.11
+
+    Returns the thread pool used to process large images in parallel.
+
+    \sa setProcessingThreadPool()
+*/
+QThreadPool *QImage::processingThreadPool()
+{
+    if (QThreadPool *pool = qt_imageProcessingThreadPool.loadAcquire())
+        return pool;
+    return QThreadPool::globalInstance();
+}
+
+namespace {
+class QImageRowsTask : public QRunnable
+{
+public:
+    QImageRowsTask()
+        : function(nullptr), data(nullptr), begin(0), end(0), done(nullptr)
+    {
+        setAutoDelete(false);
+    }
+
+    void run() override
+    {
+        function(data, begin, end);
+        done->release();
+    }
+
+    QImageRowFunction function;
+    void *data;
+    int begin;
+    int end;
+    QSemaphore *done;
+};
+} // unnamed namespace
+#endif // QT_NO_THREAD
+
+/*
+    Calls \a function for consecutive bands of rows that together cover
+    [0, \a height). Images of more than a few bands worth of \a pixels are
+    split up between the calling thread and QImage::processingThreadPool().
+*/
+void qt_imageProcessRows(qint64 pixels, int height, QImageRowFunction function, void *data)
+{
+#ifndef QT_NO_THREAD
+    enum { MinimumPixelsPerBand = 1 << 16, MaximumBands = 64 };
+    int bands = int(qMin<qint64>(pixels / MinimumPixelsPerBand, qMin(height, int(MaximumBands))));
+    QThreadPool *pool = nullptr;
+    if (bands > 1 && QImage::isParallelProcessingEnabled()) {
+        pool = QImage::processingThreadPool();
+        bands = qMin(bands, pool->maxThreadCount() + 1);
+    }
+    if (pool && bands > 1) {
+        QSemaphore done;
+        QImageRowsTask tasks[MaximumBands - 1];
+        for (int i = 0; i < bands - 1; ++i) {
+            QImageRowsTask &task = tasks[i];
+            task.function = function;
+            task.data = data;
+            task.begin = int(qint64(height) * i / bands);
+            task.end = int(qint64(height) * (i + 1) / bands);
+            task.done = &done;
+            pool->start(&task);
+        }
+        function(data, int(qint64(height) * (bands - 1) / bands), height);
+        // bands no pool thread has picked up yet are run here, which also
+        // keeps us from waiting forever when called from a busy pool thread
+        for (int i = bands - 2; i >= 0; --i) {
+            if (pool->tryTake(&tasks[i]))
+                tasks[i].run();
+        }
+        done.acquire(bands - 1);
+        return;
+    }
+#else
+    Q_UNUSED(pixels);
+#endif
+    function(data, 0, height);
+}
+
 Q_GUI_EXPORT void qt_imageTransform(QImage &src, QImageIOHandler::Transformations orient)
 {
     if (orient == QImageIOHandler::TransformationNone)
@@ -65,6 +65,7 @@ class QIODevice;
 class QStringList;
 class QMatrix;
 class QTransform;
+class QThreadPool;
 class QVariant;
 template <class T> class QList;
 template <class T> class QVector;
@@ -329,6 +330,13 @@ public:
     static QPixelFormat toPixelFormat(QImage::Format format) Q_DECL_NOTHROW;
     static QImage::Format toImageFormat(QPixelFormat format) Q_DECL_NOTHROW;
 
+#ifndef QT_NO_THREAD
+    static void setParallelProcessingEnabled(bool enable);
+    static bool isParallelProcessingEnabled();
+    static void setProcessingThreadPool(QThreadPool *pool);
+    static QThreadPool *processingThreadPool();
+#endif
+
     // Platform spesific conversion functions
 #if defined(Q_OS_DARWIN) || defined(Q_QDOC)
     CGImageRef toCGImage() const Q_DECL_CF_RETURNS_RETAINED;
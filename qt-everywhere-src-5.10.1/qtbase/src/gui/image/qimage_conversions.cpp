@@ -145,13 +145,8 @@ void convert_generic(QImageData *dest, const QImageData *src, Qt::ImageConversio
     // Cannot be used with indexed formats.
     Q_ASSERT(dest->format > QImage::Format_Indexed8);
     Q_ASSERT(src->format > QImage::Format_Indexed8);
-    const int buffer_size = 2048;
-    uint buf[buffer_size];
-    uint *buffer = buf;
     const QPixelLayout *srcLayout = &qPixelLayouts[src->format];
     const QPixelLayout *destLayout = &qPixelLayouts[dest->format];
-    const uchar *srcData = src->data;
-    uchar *destData = dest->data;
 
     const FetchPixelsFunc fetch = qFetchPixels[srcLayout->bpp];
     const StorePixelsFunc store = qStorePixels[destLayout->bpp];
@@ -182,31 +177,38 @@ void convert_generic(QImageData *dest, const QImageData *src, Qt::ImageConversio
         else
             convertFromARGB32PM = destLayout->convertFromRGB32;
     }
-    QDitherInfo dither;
-    QDitherInfo *ditherPtr = 0;
-    if ((flags & Qt::PreferDither) && (flags & Qt::Dither_Mask) != Qt::ThresholdDither)
-        ditherPtr = &dither;
-
-    for (int y = 0; y < src->height; ++y) {
-        dither.y = y;
-        int x = 0;
-        while (x < src->width) {
-            dither.x = x;
-            int l = src->width - x;
-            if (destLayout->bpp == QPixelLayout::BPP32)
-                buffer = reinterpret_cast<uint *>(destData) + x;
-            else
-                l = qMin(l, buffer_size);
-            const uint *ptr = fetch(buffer, srcData, x, l);
-            ptr = convertToARGB32PM(buffer, ptr, l, 0, ditherPtr);
-            ptr = convertFromARGB32PM(buffer, ptr, l, 0, ditherPtr);
-            if (ptr != reinterpret_cast<uint *>(destData))
-                store(destData, ptr, x, l);
-            x += l;
+    const bool dithering = (flags & Qt::PreferDither) && (flags & Qt::Dither_Mask) != Qt::ThresholdDither;
+
+    auto convertRows = [=](int yStart, int yEnd) {
+        const int buffer_size = 2048;
+        uint buf[buffer_size];
+        uint *buffer = buf;
+        const uchar *srcData = src->data + qptrdiff(src->bytes_per_line) * yStart;
+        uchar *destData = dest->data + qptrdiff(dest->bytes_per_line) * yStart;
+        QDitherInfo dither;
+        QDitherInfo *ditherPtr = dithering ? &dither : nullptr;
+        for (int y = yStart; y < yEnd; ++y) {
+            dither.y = y;
+            int x = 0;
+            while (x < src->width) {
+                dither.x = x;
+                int l = src->width - x;
+                if (destLayout->bpp == QPixelLayout::BPP32)
+                    buffer = reinterpret_cast<uint *>(destData) + x;
+                else
+                    l = qMin(l, buffer_size);
+                const uint *ptr = fetch(buffer, srcData, x, l);
+                ptr = convertToARGB32PM(buffer, ptr, l, 0, ditherPtr);
+                ptr = convertFromARGB32PM(buffer, ptr, l, 0, ditherPtr);
+                if (ptr != reinterpret_cast<uint *>(destData))
+                    store(destData, ptr, x, l);
+                x += l;
+            }
+            srcData += src->bytes_per_line;
+            destData += dest->bytes_per_line;
         }
-        srcData += src->bytes_per_line;
-        destData += dest->bytes_per_line;
-    }
+    };
+    qt_imageProcessRows(qint64(src->width) * src->height, src->height, convertRows);
 }
 
 bool convert_generic_inplace(QImageData *data, QImage::Format dst_format, Qt::ImageConversionFlags flags)
@@ -217,11 +219,8 @@ bool convert_generic_inplace(QImageData *data, QImage::Format dst_format, Qt::Im
     if (data->depth != qt_depthForFormat(dst_format))
         return false;
 
-    const int buffer_size = 2048;
-    uint buffer[buffer_size];
     const QPixelLayout *srcLayout = &qPixelLayouts[data->format];
     const QPixelLayout *destLayout = &qPixelLayouts[dst_format];
-    uchar *srcData = data->data;
 
     const FetchPixelsFunc fetch = qFetchPixels[srcLayout->bpp];
     const StorePixelsFunc store = qStorePixels[destLayout->bpp];
@@ -251,27 +250,32 @@ bool convert_generic_inplace(QImageData *data, QImage::Format dst_format, Qt::Im
         else
             convertFromARGB32PM = destLayout->convertFromRGB32;
     }
-    QDitherInfo dither;
-    QDitherInfo *ditherPtr = 0;
-    if ((flags & Qt::PreferDither) && (flags & Qt::Dither_Mask) != Qt::ThresholdDither)
-        ditherPtr = &dither;
-
-    for (int y = 0; y < data->height; ++y) {
-        dither.y = y;
-        int x = 0;
-        while (x < data->width) {
-            dither.x = x;
-            int l = qMin(data->width - x, buffer_size);
-            const uint *ptr = fetch(buffer, srcData, x, l);
-            ptr = convertToARGB32PM(buffer, ptr, l, 0, ditherPtr);
-            ptr = convertFromARGB32PM(buffer, ptr, l, 0, ditherPtr);
-            // The conversions might be passthrough and not use the buffer, in that case we are already done.
-            if (srcData != (const uchar*)ptr)
-                store(srcData, ptr, x, l);
-            x += l;
+    const bool dithering = (flags & Qt::PreferDither) && (flags & Qt::Dither_Mask) != Qt::ThresholdDither;
+
+    auto convertRows = [=](int yStart, int yEnd) {
+        const int buffer_size = 2048;
+        uint buffer[buffer_size];
+        uchar *srcData = data->data + qptrdiff(data->bytes_per_line) * yStart;
+        QDitherInfo dither;
+        QDitherInfo *ditherPtr = dithering ? &dither : nullptr;
+        for (int y = yStart; y < yEnd; ++y) {
+            dither.y = y;
+            int x = 0;
+            while (x < data->width) {
+                dither.x = x;
+                int l = qMin(data->width - x, buffer_size);
+                const uint *ptr = fetch(buffer, srcData, x, l);
+                ptr = convertToARGB32PM(buffer, ptr, l, 0, ditherPtr);
+                ptr = convertFromARGB32PM(buffer, ptr, l, 0, ditherPtr);
+                // The conversions might be passthrough and not use the buffer, in that case we are already done.
+                if (srcData != (const uchar*)ptr)
+                    store(srcData, ptr, x, l);
+                x += l;
+            }
+            srcData += data->bytes_per_line;
         }
-        srcData += data->bytes_per_line;
-    }
+    };
+    qt_imageProcessRows(qint64(data->width) * data->height, data->height, convertRows);
     data->format = dst_format;
     return true;
 }
@@ -117,6 +117,17 @@ bool convert_generic_inplace(QImageData *data, QImage::Format dst_format, Qt::Im
 
 void dither_to_Mono(QImageData *dst, const QImageData *src, Qt::ImageConversionFlags flags, bool fromalpha);
 
+typedef void (*QImageRowFunction)(void *data, int begin, int end);
+Q_GUI_EXPORT void qt_imageProcessRows(qint64 pixels, int height, QImageRowFunction function, void *data);
+
+template <typename Function>
+inline void qt_imageProcessRows(qint64 pixels, int height, const Function &function)
+{
+    qt_imageProcessRows(pixels, height, [](void *data, int begin, int end) {
+        (*static_cast<const Function *>(data))(begin, end);
+    }, const_cast<Function *>(&function));
+}
+
 const uchar *qt_get_bitflip_array();
 Q_GUI_EXPORT void qGamma_correct_back_to_linear_cs(QImage *image);
 
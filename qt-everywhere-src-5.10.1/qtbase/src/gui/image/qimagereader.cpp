@@ -146,6 +146,7 @@
 #include <qsize.h>
 #include <qcolor.h>
 #include <qvariant.h>
+#include <qvector.h>
 
 // factory loader
 #include <qcoreapplication.h>
@@ -155,6 +156,8 @@
 // for qt_getImageText
 #include <private/qimage_p.h>
 
+#include <private/qtgui_tracepoints_p.h>
+
 // image handlers
 #include <private/qbmphandler_p.h>
 #include <private/qppmhandler_p.h>
@@ -1261,6 +1264,45 @@ QImage QImageReader::read()
     return read(&image) ? image : QImage();
 }
 
+/*!
+    \since 5.11
+
+    Reads the images in \a fileNames and returns them in the same order.
+    Files that cannot be read give null images.
+
+    If \a size is valid, every image is read at the size of its full
+    size scaled to \a size according to \a aspectRatioMode, as if that
+    had been passed to setScaledSize(). Handlers that support scaling
+    while decoding, such as the JPEG and PNG ones, then never hold the
+    full size image in memory, which makes this well suited for loading
+    thumbnails.
+
+    The files are decoded in parallel on QImage::processingThreadPool(),
+    unless parallel processing has been turned off with
+    QImage::setParallelProcessingEnabled().
+
+    \sa read(), setScaledSize()
+*/
+QVector<QImage> QImageReader::readImages(const QStringList &fileNames, const QSize &size,
+                                         Qt::AspectRatioMode aspectRatioMode)
+{
+    QVector<QImage> images(fileNames.size());
+    QImage *out = images.data();
+    auto readFiles = [&](int begin, int end) {
+        for (int i = begin; i < end; ++i) {
+            QImageReader reader(fileNames.at(i));
+            if (size.isValid()) {
+                const QSize fullSize = reader.size();
+                reader.setScaledSize(fullSize.isValid() ? fullSize.scaled(size, aspectRatioMode) : size);
+            }
+            out[i] = reader.read();
+        }
+    };
+    // every file is worth a band of its own
+    qt_imageProcessRows(qint64(fileNames.size()) << 16, fileNames.size(), readFiles);
+    return images;
+}
+
 extern void qt_imageTransform(QImage &src, QImageIOHandler::Transformations orient);
 
 /*!
@@ -1310,7 +1352,10 @@ bool QImageReader::read(QImage *image)
         d->handler->setOption(QImageIOHandler::Quality, d->quality);
 
     // read the image
-    if (!d->handler->read(image)) {
+    Q_TRACE(QImageReader_read_entry, this, d->handler->format().constData());
+    const bool result = d->handler->read(image);
+    Q_TRACE(QImageReader_read_exit, this, result);
+    if (!result) {
         d->imageReaderError = InvalidDataError;
         d->errorString = QImageReader::tr("Unable to read image data");
         return false;
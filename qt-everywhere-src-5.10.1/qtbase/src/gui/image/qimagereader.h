@@ -145,6 +145,9 @@ public:
     static QList<QByteArray> supportedImageFormats();
     static QList<QByteArray> supportedMimeTypes();
 
+    static QVector<QImage> readImages(const QStringList &fileNames, const QSize &size = QSize(),
+                                      Qt::AspectRatioMode aspectRatioMode = Qt::IgnoreAspectRatio);
+
 private:
     Q_DISABLE_COPY(QImageReader)
     QImageReaderPrivate *d;
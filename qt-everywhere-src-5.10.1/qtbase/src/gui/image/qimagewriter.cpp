@@ -475,6 +475,11 @@ int QImageWriter::quality() const
     example, the "tiff" format supports two values, 0(no compression) and
     1(LZW-compression).
 
+    Since Qt 5.11, the "png" format supports the presets 0 (the compression
+    level follows quality()), 1 (fastest), 2 (balanced) and 3 (smallest
+    file). Large PNG images are compressed by several threads at once unless
+    QImage::isParallelProcessingEnabled() returns \c false.
+
     \sa compression()
 */
 void QImageWriter::setCompression(int compression)
@@ -528,6 +533,10 @@ float QImageWriter::gamma() const
     For example, saving an image in DDS format with A8R8G8R8 subtype:
 
     \snippet code/src_gui_image_qimagewriter.cpp 3
+
+    Since Qt 5.11, the "png" format uses the subtype to apply the same
+    filter to every row, one of "none", "sub", "up", "average" and "paeth",
+    instead of choosing one per row.
 */
 void QImageWriter::setSubType(const QByteArray &type)
 {
@@ -53,6 +53,7 @@
 
 #include <png.h>
 #include <pngconf.h>
+#include <zlib.h>
 
 #if PNG_LIBPNG_VER >= 10400 && PNG_LIBPNG_VER <= 10502 \
         && defined(PNG_PEDANTIC_WARNINGS_SUPPORTED)
@@ -99,14 +100,17 @@ public:
     };
 
     QPngHandlerPrivate(QPngHandler *qq)
-        : gamma(0.0), fileGamma(0.0), quality(2), png_ptr(0), info_ptr(0), end_info(0), state(Ready), q(qq)
+        : gamma(0.0), fileGamma(0.0), quality(2), compression(0), filter(-1), png_ptr(0), info_ptr(0), end_info(0), state(Ready), q(qq)
     { }
 
     float gamma;
     float fileGamma;
     int quality;
+    int compression;
+    int filter;
     QString description;
     QSize scaledSize;
+    QRect clipRect;
     QStringList readTexts;
 
     png_struct *png_ptr;
@@ -159,6 +163,8 @@ public:
     void setLooping(int loops=0); // 0 == infinity
     void setFrameDelay(int msecs);
     void setGamma(float);
+    void setCompression(int);
+    void setFilter(int);
 
     bool writeImage(const QImage& img, int x, int y);
     bool writeImage(const QImage& img, volatile int quality, const QString &description, int x, int y);
@@ -176,6 +182,8 @@ private:
     int looping;
     int ms_delay;
     float gamma;
+    int compression;
+    int filter;
 };
 
 extern "C" {
@@ -226,7 +234,8 @@ void qpiw_flush_fn(png_structp /* png_ptr */)
 }
 
 static
-void setup_qt(QImage& image, png_structp png_ptr, png_infop info_ptr, QSize scaledSize, bool *doScaledRead, float screen_gamma=0.0, float file_gamma=0.0)
+void setup_qt(QImage& image, png_structp png_ptr, png_infop info_ptr, QSize scaledSize, bool *doScaledRead,
+              float screen_gamma=0.0, float file_gamma=0.0, QSize decodeSize = QSize(), bool passwise = false)
 {
     if (screen_gamma != 0.0 && file_gamma != 0.0)
         png_set_gamma(png_ptr, 1.0f / screen_gamma, file_gamma);
@@ -242,14 +251,18 @@ void setup_qt(QImage& image, png_structp png_ptr, png_infop info_ptr, QSize scal
     int num_palette;
     int interlace_method;
     png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, &interlace_method, 0, 0);
-    png_set_interlace_handling(png_ptr);
+    // when reading pass by pass, the rows of the Adam7 passes are delivered as they are
+    if (!passwise)
+        png_set_interlace_handling(png_ptr);
+    // the size of the part of the image that is decoded
+    const QSize size = decodeSize.isEmpty() ? QSize(width, height) : decodeSize;
 
     if (color_type == PNG_COLOR_TYPE_GRAY) {
         // Black & White or 8-bit grayscale
         if (bit_depth == 1 && png_get_channels(png_ptr, info_ptr) == 1) {
             png_set_invert_mono(png_ptr);
             png_read_update_info(png_ptr, info_ptr);
-            if (image.size() != QSize(width, height) || image.format() != QImage::Format_Mono) {
+            if (image.size() != size || image.format() != QImage::Format_Mono) {
                 image = QImage(width, height, QImage::Format_Mono);
                 if (image.isNull())
                     return;
@@ -270,7 +283,7 @@ void setup_qt(QImage& image, png_structp png_ptr, png_infop info_ptr, QSize scal
             png_set_expand(png_ptr);
             png_set_strip_16(png_ptr);
             png_set_gray_to_rgb(png_ptr);
-            if (image.size() != QSize(width, height) || image.format() != QImage::Format_ARGB32) {
+            if (image.size() != size || image.format() != QImage::Format_ARGB32) {
                 image = QImage(width, height, QImage::Format_ARGB32);
                 if (image.isNull())
                     return;
@@ -281,7 +294,7 @@ void setup_qt(QImage& image, png_structp png_ptr, png_infop info_ptr, QSize scal
             png_read_update_info(png_ptr, info_ptr);
         } else if (bit_depth == 8 && !png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS)) {
             png_set_expand(png_ptr);
-            if (image.size() != QSize(width, height) || image.format() != QImage::Format_Grayscale8) {
+            if (image.size() != size || image.format() != QImage::Format_Grayscale8) {
                 image = QImage(width, height, QImage::Format_Grayscale8);
                 if (image.isNull())
                     return;
@@ -295,7 +308,7 @@ void setup_qt(QImage& image, png_structp png_ptr, png_infop info_ptr, QSize scal
                 png_set_packing(png_ptr);
             int ncols = bit_depth < 8 ? 1 << bit_depth : 256;
             png_read_update_info(png_ptr, info_ptr);
-            if (image.size() != QSize(width, height) || image.format() != QImage::Format_Indexed8) {
+            if (image.size() != size || image.format() != QImage::Format_Indexed8) {
                 image = QImage(width, height, QImage::Format_Indexed8);
                 if (image.isNull())
                     return;
@@ -322,7 +335,7 @@ void setup_qt(QImage& image, png_structp png_ptr, png_infop info_ptr, QSize scal
         png_read_update_info(png_ptr, info_ptr);
         png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, 0, 0, 0);
         QImage::Format format = bit_depth == 1 ? QImage::Format_Mono : QImage::Format_Indexed8;
-        if (image.size() != QSize(width, height) || image.format() != format) {
+        if (image.size() != size || image.format() != format) {
             image = QImage(width, height, format);
             if (image.isNull())
                 return;
@@ -371,9 +384,10 @@ void setup_qt(QImage& image, png_structp png_ptr, png_infop info_ptr, QSize scal
             // We want 4 bytes, but it isn't an alpha channel
             format = QImage::Format_RGB32;
         }
-        QSize outSize(width,height);
+        QSize outSize(size);
         if (!scaledSize.isEmpty() && quint32(scaledSize.width()) <= width &&
-            quint32(scaledSize.height()) <= height && interlace_method == PNG_INTERLACE_NONE) {
+            quint32(scaledSize.height()) <= height && interlace_method == PNG_INTERLACE_NONE
+            && size == QSize(width, height)) {
             // Do inline downscaling
             outSize = scaledSize;
             if (doScaledRead)
@@ -476,6 +490,121 @@ static void read_image_scaled(QImage *outImage, png_structp png_ptr, png_infop i
 
 }
 
+// sanity check palette entries
+static void sanitize_palette_indexes(QImage *outImage, png_structp png_ptr, png_infop info_ptr)
+{
+    if (png_get_color_type(png_ptr, info_ptr) != PNG_COLOR_TYPE_PALETTE
+        || outImage->format() != QImage::Format_Indexed8) {
+        return;
+    }
+    uchar *data = outImage->bits();
+    const int bpl = outImage->bytesPerLine();
+    const int color_table_size = outImage->colorCount();
+    for (int y = 0; y < outImage->height(); ++y) {
+        uchar *p = FAST_SCAN_LINE(data, bpl, y);
+        uchar *end = p + outImage->width();
+        while (p < end) {
+            if (*p >= color_table_size)
+                *p = 0;
+            ++p;
+        }
+    }
+}
+
+// copies pixel sx of the row src to pixel dx of the row dst, both having the given depth
+static inline void copy_pixel(uchar *dst, int dx, const uchar *src, int sx, int depth)
+{
+    if (depth == 1) {
+        const uchar mask = 0x80 >> (dx & 7);
+        if (src[sx >> 3] & (0x80 >> (sx & 7)))
+            dst[dx >> 3] |= mask;
+        else
+            dst[dx >> 3] &= ~mask;
+    } else {
+        const int bpp = depth >> 3;
+        memcpy(dst + dx * bpp, src + sx * bpp, bpp);
+    }
+}
+
+// reads the rows of a non-interlaced image up to the bottom of clipRect, keeping only the clipped part
+static void read_image_clipped(QImage *outImage, png_structp png_ptr, png_infop info_ptr,
+                               QPngHandlerPrivate::AllocatedMemoryPointers &amp, const QRect &clipRect)
+{
+    uchar *data = outImage->bits();
+    const int bpl = outImage->bytesPerLine();
+    const int depth = outImage->depth();
+    amp.inRow = new png_byte[png_get_rowbytes(png_ptr, info_ptr)];
+
+    for (int y = 0; y <= clipRect.bottom(); ++y) {
+        png_read_row(png_ptr, amp.inRow, NULL);
+        if (y < clipRect.top())
+            continue;
+        uchar *dst = FAST_SCAN_LINE(data, bpl, y - clipRect.top());
+        if (depth == 1) {
+            for (int x = 0; x < clipRect.width(); ++x)
+                copy_pixel(dst, x, amp.inRow, clipRect.x() + x, depth);
+        } else {
+            memcpy(dst, amp.inRow + clipRect.x() * (depth >> 3), clipRect.width() * (depth >> 3));
+        }
+    }
+    amp.deallocate();
+}
+
+/*
+    Returns how many times an Adam7 interlaced image of the given size can be
+    subsampled, by decoding only its first passes, while keeping at least
+    twice the resolution of scaledSize for the final smooth scaling.
+*/
+static int adam7_subsampling(png_uint_32 width, png_uint_32 height, const QSize &scaledSize)
+{
+    int subsampling = 8;
+    while (subsampling > 1 && (quint64(scaledSize.width()) * 2 * subsampling > width
+                               || quint64(scaledSize.height()) * 2 * subsampling > height)) {
+        subsampling /= 2;
+    }
+    return subsampling;
+}
+
+/*
+    Reads the first Adam7 passes of an interlaced image, which together contain
+    every subsampling'th pixel of every subsampling'th row. The image must have
+    been set up without interlace handling, so that libpng returns the rows of
+    each pass as they are.
+*/
+static void read_image_subsampled(QImage *outImage, png_structp png_ptr, png_infop info_ptr,
+                                  QPngHandlerPrivate::AllocatedMemoryPointers &amp, int subsampling)
+{
+    const png_uint_32 width = png_get_image_width(png_ptr, info_ptr);
+    const png_uint_32 height = png_get_image_height(png_ptr, info_ptr);
+    uchar *data = outImage->bits();
+    const int bpl = outImage->bytesPerLine();
+    const int depth = outImage->depth();
+    // passes 1, 1-3 and 1-5 fill the 8x8, 4x4 and 2x2 grids
+    const int lastPass = subsampling == 8 ? 0 : (subsampling == 4 ? 2 : 4);
+    amp.inRow = new png_byte[png_get_rowbytes(png_ptr, info_ptr)];
+
+    for (int pass = 0; pass <= lastPass; ++pass) {
+        const png_uint_32 rows = PNG_PASS_ROWS(height, pass);
+        const png_uint_32 cols = PNG_PASS_COLS(width, pass);
+        // libpng skips empty passes
+        if (!rows || !cols)
+            continue;
+        for (png_uint_32 row = 0; row < rows; ++row) {
+            png_read_row(png_ptr, amp.inRow, NULL);
+            const int y = (PNG_PASS_START_ROW(pass) + (row << PNG_PASS_ROW_SHIFT(pass))) / subsampling;
+            uchar *dst = FAST_SCAN_LINE(data, bpl, y);
+            for (png_uint_32 col = 0; col < cols; ++col) {
+                const int x = (PNG_PASS_START_COL(pass) + (col << PNG_PASS_COL_SHIFT(pass))) / subsampling;
+                copy_pixel(dst, x, amp.inRow, col, depth);
+            }
+        }
+    }
+    amp.deallocate();
+
+    outImage->setDotsPerMeterX(png_get_x_pixels_per_meter(png_ptr, info_ptr) / subsampling);
+    outImage->setDotsPerMeterY(png_get_y_pixels_per_meter(png_ptr, info_ptr) / subsampling);
+}
+
 extern "C" {
 static void qt_png_warning(png_structp /*png_ptr*/, png_const_charp message)
 {
@@ -580,8 +709,35 @@ bool QPngHandlerPrivate::readPngImage(QImage *outImage)
         return false;
     }
 
+    const png_uint_32 imageWidth = png_get_image_width(png_ptr, info_ptr);
+    const png_uint_32 imageHeight = png_get_image_height(png_ptr, info_ptr);
+    const bool interlaced = png_get_interlace_type(png_ptr, info_ptr) != PNG_INTERLACE_NONE;
+
+    // Rows below a clip rect are never decoded and rows above it are not
+    // kept. Interlaced images are decoded in full and clipped afterwards.
+    QRect clip;
+    if (clipRect.isValid() && !interlaced) {
+        clip = clipRect.intersected(QRect(0, 0, imageWidth, imageHeight));
+        if (clip.isEmpty()) {
+            png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
+            png_ptr = 0;
+            state = Error;
+            return false;
+        }
+    }
+    // Interlaced images that are scaled down a lot only need their first passes.
+    int subsampling = 1;
+    if (interlaced && !clipRect.isValid() && scaledSize.isValid())
+        subsampling = adam7_subsampling(imageWidth, imageHeight, scaledSize);
+    QSize decodeSize;
+    if (clip.isValid())
+        decodeSize = clip.size();
+    else if (subsampling > 1)
+        decodeSize = QSize((imageWidth + subsampling - 1) / subsampling, (imageHeight + subsampling - 1) / subsampling);
+
     bool doScaledRead = false;
-    setup_qt(*outImage, png_ptr, info_ptr, scaledSize, &doScaledRead, gamma, fileGamma);
+    setup_qt(*outImage, png_ptr, info_ptr, scaledSize, &doScaledRead, gamma, fileGamma,
+             decodeSize, subsampling > 1);
 
     if (outImage->isNull()) {
         png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
@@ -593,6 +749,27 @@ bool QPngHandlerPrivate::readPngImage(QImage *outImage)
 
     if (doScaledRead) {
         read_image_scaled(outImage, png_ptr, info_ptr, amp, scaledSize);
+    } else if (clip.isValid() || subsampling > 1) {
+        if (clip.isValid()) {
+            read_image_clipped(outImage, png_ptr, info_ptr, amp, clip);
+            outImage->setDotsPerMeterX(png_get_x_pixels_per_meter(png_ptr, info_ptr));
+            outImage->setDotsPerMeterY(png_get_y_pixels_per_meter(png_ptr, info_ptr));
+        } else {
+            read_image_subsampled(outImage, png_ptr, info_ptr, amp, subsampling);
+        }
+        sanitize_palette_indexes(outImage, png_ptr, info_ptr);
+
+        // The rest of the image data is not needed, so skip png_read_end()
+        // and with it any text chunks that follow the image data.
+        for (int i = 0; i < readTexts.size()-1; i+=2)
+            outImage->setText(readTexts.at(i), readTexts.at(i+1));
+        png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
+        png_ptr = 0;
+        state = Ready;
+
+        if (scaledSize.isValid() && outImage->size() != scaledSize)
+            *outImage = outImage->scaled(scaledSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+        return true;
     } else {
         png_uint_32 width = 0;
         png_uint_32 height = 0;
@@ -620,19 +797,7 @@ bool QPngHandlerPrivate::readPngImage(QImage *outImage)
         if (unit_type == PNG_OFFSET_PIXEL)
             outImage->setOffset(QPoint(offset_x, offset_y));
 
-        // sanity check palette entries
-        if (color_type == PNG_COLOR_TYPE_PALETTE && outImage->format() == QImage::Format_Indexed8) {
-            int color_table_size = outImage->colorCount();
-            for (int y=0; y<(int)height; ++y) {
-                uchar *p = FAST_SCAN_LINE(data, bpl, y);
-                uchar *end = p + width;
-                while (p < end) {
-                    if (*p >= color_table_size)
-                        *p = 0;
-                    ++p;
-                }
-            }
-        }
+        sanitize_palette_indexes(outImage, png_ptr, info_ptr);
     }
 
     state = ReadingEnd;
@@ -647,6 +812,8 @@ bool QPngHandlerPrivate::readPngImage(QImage *outImage)
     amp.deallocate();
     state = Ready;
 
+    if (clipRect.isValid() && outImage->rect() != clipRect)
+        *outImage = outImage->copy(clipRect);
     if (scaledSize.isValid() && outImage->size() != scaledSize)
         *outImage = outImage->scaled(scaledSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
 
@@ -698,7 +865,9 @@ QPNGImageWriter::QPNGImageWriter(QIODevice* iod) :
     disposal(Unspecified),
     looping(-1),
     ms_delay(-1),
-    gamma(0.0)
+    gamma(0.0),
+    compression(0),
+    filter(-1)
 {
 }
 
@@ -726,6 +895,16 @@ void QPNGImageWriter::setGamma(float g)
     gamma = g;
 }
 
+void QPNGImageWriter::setCompression(int c)
+{
+    compression = c;
+}
+
+void QPNGImageWriter::setFilter(int f)
+{
+    filter = f;
+}
+
 static void set_text(const QImage &image, png_structp png_ptr, png_infop info_ptr,
                      const QString &description)
 {
@@ -784,6 +963,269 @@ static void set_text(const QImage &image, png_structp png_ptr, png_infop info_pt
     delete [] text_ptr;
 }
 
+// the sub types select a fixed row filter, in the order of the filter values
+static const char *const png_filter_names[] = { "none", "sub", "up", "average", "paeth" };
+enum { PngFilterCount = sizeof(png_filter_names) / sizeof(png_filter_names[0]) };
+
+static const int png_filter_masks[PngFilterCount] = {
+    PNG_FILTER_NONE, PNG_FILTER_SUB, PNG_FILTER_UP, PNG_FILTER_AVG, PNG_FILTER_PAETH
+};
+
+static int png_filter_from_sub_type(const QByteArray &subType)
+{
+    for (int i = 0; i < PngFilterCount; ++i) {
+        if (subType == png_filter_names[i])
+            return i;
+    }
+    return -1;
+}
+
+#ifndef QT_NO_THREAD
+// images below this size are written on the calling thread by libpng
+enum { ParallelWriteMinimumPixels = 1 << 18 };
+
+static inline uchar paeth_predictor(int a, int b, int c)
+{
+    const int p = a + b - c;
+    const int pa = qAbs(p - a);
+    const int pb = qAbs(p - b);
+    const int pc = qAbs(p - c);
+    if (pa <= pb && pa <= pc)
+        return a;
+    return pb <= pc ? b : c;
+}
+
+// writes the filter type byte followed by the filtered row; prev is the
+// previous unfiltered row, or all zeroes for the first one
+static void filter_png_row(uchar *out, const uchar *row, const uchar *prev, int rowBytes, int bpp, int filter)
+{
+    *out++ = uchar(filter);
+    switch (filter) {
+    case PNG_FILTER_VALUE_NONE:
+        memcpy(out, row, rowBytes);
+        break;
+    case PNG_FILTER_VALUE_SUB:
+        for (int i = 0; i < rowBytes; ++i)
+            out[i] = row[i] - (i >= bpp ? row[i - bpp] : 0);
+        break;
+    case PNG_FILTER_VALUE_UP:
+        for (int i = 0; i < rowBytes; ++i)
+            out[i] = row[i] - prev[i];
+        break;
+    case PNG_FILTER_VALUE_AVG:
+        for (int i = 0; i < rowBytes; ++i)
+            out[i] = row[i] - ((int(i >= bpp ? row[i - bpp] : 0) + prev[i]) >> 1);
+        break;
+    case PNG_FILTER_VALUE_PAETH:
+        for (int i = 0; i < rowBytes; ++i) {
+            if (i < bpp)
+                out[i] = row[i] - prev[i];
+            else
+                out[i] = row[i] - paeth_predictor(row[i - bpp], prev[i], prev[i - bpp]);
+        }
+        break;
+    }
+}
+
+// the heuristic libpng uses: the filter giving the smallest sum of the
+// filtered bytes, taken as signed values, usually deflates best
+static void filter_png_row_adaptive(uchar *out, uchar *scratch, const uchar *row, const uchar *prev,
+                                    int rowBytes, int bpp)
+{
+    uchar *best = out;
+    uchar *trial = scratch;
+    quint64 bestSum = ~quint64(0);
+    for (int filter = 0; filter < PngFilterCount; ++filter) {
+        filter_png_row(trial, row, prev, rowBytes, bpp, filter);
+        quint64 sum = 0;
+        for (int i = 1; i <= rowBytes; ++i)
+            sum += qAbs(int(qint8(trial[i])));
+        if (sum < bestSum) {
+            bestSum = sum;
+            qSwap(best, trial);
+        }
+    }
+    if (best != out)
+        memcpy(out, best, rowBytes + 1);
+}
+
+// converts a scan line to the byte layout written to the PNG file
+static void pack_png_row(uchar *out, const uchar *in, QImage::Format format, int width)
+{
+    const QRgb *p = reinterpret_cast<const QRgb *>(in);
+    switch (format) {
+    case QImage::Format_ARGB32:
+        for (int x = 0; x < width; ++x, out += 4) {
+            out[0] = qRed(p[x]);
+            out[1] = qGreen(p[x]);
+            out[2] = qBlue(p[x]);
+            out[3] = qAlpha(p[x]);
+        }
+        break;
+    case QImage::Format_RGB32:
+        for (int x = 0; x < width; ++x, out += 3) {
+            out[0] = qRed(p[x]);
+            out[1] = qGreen(p[x]);
+            out[2] = qBlue(p[x]);
+        }
+        break;
+    case QImage::Format_RGB888:
+        memcpy(out, in, width * 3);
+        break;
+    default:
+        memcpy(out, in, width);
+        break;
+    }
+}
+
+/*
+    Writes the image data of an 8 bits per channel image as IDAT chunks,
+    with the filtering and deflating split over several threads.
+
+    The rows are filtered into one buffer first. Each band of rows is then
+    deflated on its own, primed with the last 32 kB of the data before it
+    as dictionary, and ends on a byte boundary through a sync flush except
+    for the last one, so that the raw deflate streams can be concatenated
+    into a single zlib stream.
+
+    Returns \c false without writing anything if that fails, the caller
+    then falls back to writing the rows through libpng.
+*/
+static bool write_png_idat_parallel(png_structp png_ptr, const QImage &image, int color_type,
+                                    int level, int strategy, int filter)
+{
+    QImage converted;
+    const QImage *src = &image;
+    switch (image.format()) {
+    case QImage::Format_Indexed8:
+    case QImage::Format_Grayscale8:
+    case QImage::Format_RGB32:
+    case QImage::Format_ARGB32:
+    case QImage::Format_RGB888:
+        break;
+    default:
+        converted = image.convertToFormat(image.hasAlphaChannel() ? QImage::Format_ARGB32
+                                                                  : QImage::Format_RGB32);
+        if (converted.isNull())
+            return false;
+        src = &converted;
+        break;
+    }
+
+    const QImage::Format format = src->format();
+    const int width = src->width();
+    const int height = src->height();
+    const int bpp = color_type == PNG_COLOR_TYPE_RGB_ALPHA ? 4 : color_type == PNG_COLOR_TYPE_RGB ? 3 : 1;
+    const int rowBytes = width * bpp;
+    const size_t stride = size_t(rowBytes) + 1;
+
+    // libpng leaves palette images unfiltered unless told otherwise
+    if (filter < 0 && color_type == PNG_COLOR_TYPE_PALETTE)
+        filter = PNG_FILTER_VALUE_NONE;
+    if (strategy < 0)
+        strategy = filter == PNG_FILTER_VALUE_NONE ? Z_DEFAULT_STRATEGY : Z_FILTERED;
+
+    uchar *filtered = static_cast<uchar *>(malloc(stride * height));
+    if (!filtered)
+        return false;
+
+    qt_imageProcessRows(qint64(width) * height, height, [&](int yStart, int yEnd) {
+        QByteArray rows(3 * rowBytes + 1, 0);
+        uchar *prev = reinterpret_cast<uchar *>(rows.data());
+        uchar *row = prev + rowBytes;
+        uchar *scratch = row + rowBytes;
+        if (yStart > 0)
+            pack_png_row(prev, src->constScanLine(yStart - 1), format, width);
+        for (int y = yStart; y < yEnd; ++y) {
+            pack_png_row(row, src->constScanLine(y), format, width);
+            uchar *out = filtered + y * stride;
+            if (filter < 0)
+                filter_png_row_adaptive(out, scratch, row, prev, rowBytes, bpp);
+            else
+                filter_png_row(out, row, prev, rowBytes, bpp, filter);
+            qSwap(prev, row);
+        }
+    });
+
+    // the bands are keyed by their first row
+    QVector<QByteArray> deflated(height);
+    QVector<uLong> checksums(height);
+    QVector<int> bandEnds(height);
+    QByteArray *deflatedData = deflated.data();
+    uLong *checksumData = checksums.data();
+    int *bandEndData = bandEnds.data();
+    QAtomicInt failed;
+
+    qt_imageProcessRows(qint64(width) * height, height, [&](int yStart, int yEnd) {
+        const uchar *in = filtered + yStart * stride;
+        const size_t length = (yEnd - yStart) * stride;
+        bandEndData[yStart] = yEnd;
+        checksumData[yStart] = adler32(adler32(0, Z_NULL, 0), in, uInt(length));
+
+        z_stream stream;
+        memset(&stream, 0, sizeof(stream));
+        if (deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8, strategy) != Z_OK) {
+            failed.store(1);
+            return;
+        }
+        if (yStart > 0) {
+            const size_t dictionaryLength = qMin(yStart * stride, size_t(1) << MAX_WBITS);
+            deflateSetDictionary(&stream, in - dictionaryLength, uInt(dictionaryLength));
+        }
+
+        // a sync flush adds an empty stored block to the bound
+        QByteArray &out = deflatedData[yStart];
+        out.resize(int(deflateBound(&stream, uLong(length))) + 16);
+        stream.next_in = const_cast<Bytef *>(in);
+        stream.avail_in = uInt(length);
+        stream.next_out = reinterpret_cast<Bytef *>(out.data());
+        stream.avail_out = uInt(out.size());
+        const int flush = yEnd == height ? Z_FINISH : Z_SYNC_FLUSH;
+        const int result = deflate(&stream, flush);
+        if ((flush == Z_FINISH && result != Z_STREAM_END) || (flush == Z_SYNC_FLUSH && result != Z_OK)
+                || stream.avail_in)
+            failed.store(1);
+        out.resize(int(stream.total_out));
+        deflateEnd(&stream);
+    });
+    free(filtered);
+    if (failed.load())
+        return false;
+
+    // zlib header, see RFC 1950
+    const int compressionLevel = level < 0 ? 2 : level < 2 ? 0 : level < 6 ? 1 : level == 6 ? 2 : 3;
+    const uchar cmf = 0x78;
+    uchar flg = uchar(compressionLevel << 6);
+    flg += 31 - (cmf * 256 + flg) % 31;
+
+    int totalSize = 6;
+    uLong checksum = checksumData[0];
+    for (int y = 0; y < height; y = bandEndData[y]) {
+        totalSize += deflatedData[y].size();
+        if (y > 0)
+            checksum = adler32_combine(checksum, checksumData[y], z_off_t((bandEndData[y] - y) * stride));
+    }
+
+    QByteArray idat;
+    idat.reserve(totalSize);
+    idat.append(char(cmf));
+    idat.append(char(flg));
+    for (int y = 0; y < height; y = bandEndData[y])
+        idat.append(deflatedData[y]);
+    const uchar trailer[4] = { uchar(checksum >> 24), uchar(checksum >> 16),
+                               uchar(checksum >> 8), uchar(checksum) };
+    idat.append(reinterpret_cast<const char *>(trailer), 4);
+
+    enum { MaximumChunkSize = 1 << 20 };
+    for (int offset = 0; offset < idat.size(); offset += MaximumChunkSize) {
+        png_write_chunk(png_ptr, const_cast<png_bytep>((const png_byte *)"IDAT"),
+                        reinterpret_cast<png_bytep>(idat.data()) + offset,
+                        qMin(idat.size() - offset, int(MaximumChunkSize)));
+    }
+    return true;
+}
+#endif // QT_NO_THREAD
+
 bool QPNGImageWriter::writeImage(const QImage& image, int off_x, int off_y)
 {
     return writeImage(image, -1, QString(), off_x, off_y);
@@ -818,6 +1260,27 @@ bool QPNGImageWriter::writeImage(const QImage& image, volatile int quality_in, c
     }
 
     int quality = quality_in;
+    int strategy = -1;
+    int filter_value = filter;
+    switch (compression) {
+    case 0:
+        break;
+    case 1: // fastest
+        quality = 1;
+        strategy = Z_RLE;
+        if (filter_value < 0)
+            filter_value = PNG_FILTER_VALUE_SUB;
+        break;
+    case 2: // balanced
+        quality = 4;
+        break;
+    case 3: // smallest
+        quality = 9;
+        break;
+    default:
+        qWarning("PNG: Compression %d out of range", compression);
+        break;
+    }
     if (quality >= 0) {
         if (quality > 9) {
             qWarning("PNG: Quality %d out of range", quality);
@@ -825,6 +1288,10 @@ bool QPNGImageWriter::writeImage(const QImage& image, volatile int quality_in, c
         }
         png_set_compression_level(png_ptr, quality);
     }
+    if (strategy >= 0)
+        png_set_compression_strategy(png_ptr, strategy);
+    if (filter_value >= 0)
+        png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, png_filter_masks[filter_value]);
 
     png_set_write_fn(png_ptr, (void*)this, qpiw_write_fn, qpiw_flush_fn);
 
@@ -932,6 +1399,22 @@ bool QPNGImageWriter::writeImage(const QImage& image, volatile int quality_in, c
 
     int height = image.height();
     int width = image.width();
+
+    bool written = false;
+#ifndef QT_NO_THREAD
+    if (image.depth() != 1 && qint64(width) * height >= ParallelWriteMinimumPixels
+            && QImage::isParallelProcessingEnabled()) {
+        written = write_png_idat_parallel(png_ptr, image, color_type, quality, strategy, filter_value);
+    }
+#endif
+    if (written) {
+        // png_write_end() only accepts image data written through libpng
+        png_write_chunk(png_ptr, const_cast<png_bytep>((const png_byte *)"IEND"), 0, 0);
+        frames_written++;
+        png_destroy_write_struct(&png_ptr, &info_ptr);
+        return true;
+    }
+
     switch (image.format()) {
     case QImage::Format_Mono:
     case QImage::Format_MonoLSB:
@@ -971,7 +1454,8 @@ bool QPNGImageWriter::writeImage(const QImage& image, volatile int quality_in, c
 }
 
 static bool write_png_image(const QImage &image, QIODevice *device,
-                            int quality, float gamma, const QString &description)
+                            int quality, float gamma, const QString &description,
+                            int compression, int filter)
 {
     QPNGImageWriter writer(device);
     if (quality >= 0) {
@@ -979,6 +1463,8 @@ static bool write_png_image(const QImage &image, QIODevice *device,
         quality = (100-quality) * 9 / 91; // map [0,100] -> [9,0]
     }
     writer.setGamma(gamma);
+    writer.setCompression(compression);
+    writer.setFilter(filter);
     return writer.writeImage(image, quality, description);
 }
 
@@ -1026,7 +1512,8 @@ bool QPngHandler::read(QImage *image)
 
 bool QPngHandler::write(const QImage &image)
 {
-    return write_png_image(image, device(), d->quality, d->gamma, d->description);
+    return write_png_image(image, device(), d->quality, d->gamma, d->description,
+                           d->compression, d->filter);
 }
 
 bool QPngHandler::supportsOption(ImageOption option) const
@@ -1035,12 +1522,28 @@ bool QPngHandler::supportsOption(ImageOption option) const
         || option == Description
         || option == ImageFormat
         || option == Quality
+        || option == CompressionRatio
+        || option == SubType
+        || option == SupportedSubTypes
         || option == Size
+        || option == ClipRect
         || option == ScaledSize;
 }
 
 QVariant QPngHandler::option(ImageOption option) const
 {
+    // the write options do not depend on the device
+    if (option == CompressionRatio) {
+        return d->compression;
+    } else if (option == SubType) {
+        return d->filter < 0 ? QByteArray() : QByteArray(png_filter_names[d->filter]);
+    } else if (option == SupportedSubTypes) {
+        QList<QByteArray> subTypes;
+        for (const char *name : png_filter_names)
+            subTypes << name;
+        return QVariant::fromValue(subTypes);
+    }
+
     if (d->state == QPngHandlerPrivate::Error)
         return QVariant();
     if (d->state == QPngHandlerPrivate::Ready && !d->readPngHeader())
@@ -1057,6 +1560,8 @@ QVariant QPngHandler::option(ImageOption option) const
                      png_get_image_height(d->png_ptr, d->info_ptr));
     else if (option == ScaledSize)
         return d->scaledSize;
+    else if (option == ClipRect)
+        return d->clipRect;
     else if (option == ImageFormat)
         return d->readImageFormat();
     return QVariant();
@@ -1068,10 +1573,16 @@ void QPngHandler::setOption(ImageOption option, const QVariant &value)
         d->gamma = value.toFloat();
     else if (option == Quality)
         d->quality = value.toInt();
+    else if (option == CompressionRatio)
+        d->compression = value.toInt();
+    else if (option == SubType)
+        d->filter = png_filter_from_sub_type(value.toByteArray());
     else if (option == Description)
         d->description = value.toString();
     else if (option == ScaledSize)
         d->scaledSize = value.toSize();
+    else if (option == ClipRect)
+        d->clipRect = value.toRect();
 }
 
 QByteArray QPngHandler::name() const
@@ -0,0 +1,427 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsharedimagecache_p.h"
+
+#include <QtCore/qatomic.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QSharedImageCache
+    \inmodule QtGui
+    \internal
+
+    \brief The QSharedImageCache class provides a process wide cache of decoded
+    images that can be used from any thread.
+
+    Unlike QPixmapCache, which can only be used from the GUI thread, the
+    shared image cache stores QImage objects and can be populated by worker
+    threads that decode images, for instance the QtQuick image reader. QIcon
+    uses it for icons loaded from files, so that an image decoded for a
+    QtQuick Image and a widget icon is only kept in memory once.
+
+    The cache is split into shards with a lock each, so that threads looking
+    up different images rarely contend. Every entry belongs to a Category
+    with its own memory budget. When a category exceeds its budget, entries
+    are evicted in least recently used order; entries that were hit since
+    they were last considered for eviction get a second chance.
+
+    trim() releases memory on request, for instance when the platform signals
+    memory pressure, and forwards the request to the handlers registered with
+    addMemoryPressureHandler(), so that other caches can release memory too.
+*/
+
+namespace {
+
+enum {
+    ShardCount = 16,
+    MaxFrequency = 3
+};
+
+struct Node
+{
+    QString key;
+    QImage image;
+    int cost;
+    QSharedImageCache::Category category;
+    int frequency;
+    Node *prev;
+    Node *next;
+};
+
+// Each shard keeps one LRU list per category, most recently used first
+struct Shard
+{
+    Shard()
+    {
+        for (int i = 0; i < QSharedImageCache::CategoryCount; ++i)
+            head[i] = tail[i] = nullptr;
+    }
+    ~Shard()
+    {
+        qDeleteAll(nodes);
+    }
+
+    void link(Node *node)
+    {
+        const int c = node->category;
+        node->prev = nullptr;
+        node->next = head[c];
+        if (head[c])
+            head[c]->prev = node;
+        head[c] = node;
+        if (!tail[c])
+            tail[c] = node;
+    }
+
+    void unlink(Node *node)
+    {
+        const int c = node->category;
+        if (node->prev)
+            node->prev->next = node->next;
+        else
+            head[c] = node->next;
+        if (node->next)
+            node->next->prev = node->prev;
+        else
+            tail[c] = node->prev;
+        node->prev = node->next = nullptr;
+    }
+
+    QMutex mutex;
+    QHash<QString, Node *> nodes;
+    Node *head[QSharedImageCache::CategoryCount];
+    Node *tail[QSharedImageCache::CategoryCount];
+};
+
+struct SharedImageCacheData
+{
+    SharedImageCacheData()
+    {
+        budgets[QSharedImageCache::GeneralCategory].store(10240);
+        budgets[QSharedImageCache::IconCategory].store(5120);
+        budgets[QSharedImageCache::QuickCategory].store(20480);
+        for (int i = 0; i < QSharedImageCache::CategoryCount; ++i)
+            usages[i].store(0);
+    }
+
+    Shard &shardFor(const QString &key)
+    {
+        return shards[qHash(key) % ShardCount];
+    }
+
+    void releaseNode(Shard &shard, Node *node);
+    bool evictOne(Shard &shard, QSharedImageCache::Category category, bool force);
+    void evict(QSharedImageCache::Category category, int limit, int lastShard = -1);
+
+    Shard shards[ShardCount];
+    QAtomicInt budgets[QSharedImageCache::CategoryCount];
+    QAtomicInt usages[QSharedImageCache::CategoryCount];
+    QAtomicInt evictionCursor;
+
+    QMutex handlerMutex;
+    QVector<QPair<int, QSharedImageCache::MemoryPressureHandler> > handlers;
+    int nextHandlerId = 1;
+};
+
+// must be called with the shard locked
+void SharedImageCacheData::releaseNode(Shard &shard, Node *node)
+{
+    shard.unlink(node);
+    shard.nodes.remove(node->key);
+    usages[node->category].fetchAndAddRelaxed(-node->cost);
+    delete node;
+}
+
+bool SharedImageCacheData::evictOne(Shard &shard, QSharedImageCache::Category category, bool force)
+{
+    QMutexLocker locker(&shard.mutex);
+    Node *node = shard.tail[category];
+    if (!force) {
+        // Second chance: recently hit entries go back to the front
+        while (node && node->frequency > 0) {
+            --node->frequency;
+            shard.unlink(node);
+            shard.link(node);
+            node = shard.tail[category];
+        }
+    }
+    if (!node)
+        return false;
+    releaseNode(shard, node);
+    return true;
+}
+
+// Shards are visited round robin, so that eviction pressure is spread over all
+// of them. The shard an image was just inserted into is visited last.
+void SharedImageCacheData::evict(QSharedImageCache::Category category, int limit, int lastShard)
+{
+    const uint start = uint(evictionCursor.fetchAndAddRelaxed(1));
+    for (int i = 0; i <= ShardCount && usages[category].load() > limit; ++i) {
+        const int index = i < ShardCount ? int((start + uint(i)) % ShardCount) : lastShard;
+        if (index < 0 || (i < ShardCount && index == lastShard))
+            continue;
+        Shard &shard = shards[index];
+        while (usages[category].load() > limit && evictOne(shard, category, limit == 0))
+            ;
+    }
+}
+
+static int imageCost(const QImage &image)
+{
+    return qMax(1, int((image.sizeInBytes() + 1023) / 1024));
+}
+
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(SharedImageCacheData, sharedImageCache)
+
+/*!
+    Looks up the image stored under \a key. Returns \c true and assigns the
+    image to \a image if it was found, otherwise returns \c false.
+*/
+bool QSharedImageCache::find(const QString &key, QImage *image)
+{
+    SharedImageCacheData *d = sharedImageCache();
+    if (!d || key.isEmpty())
+        return false;
+    Shard &shard = d->shardFor(key);
+    QMutexLocker locker(&shard.mutex);
+    Node *node = shard.nodes.value(key);
+    if (!node)
+        return false;
+    if (node->frequency < MaxFrequency)
+        ++node->frequency;
+    shard.unlink(node);
+    shard.link(node);
+    if (image)
+        *image = node->image;
+    return true;
+}
+
+/*!
+    Stores \a image under \a key in \a category, replacing any image
+    previously stored under the same key. Other images of the category are
+    evicted as needed to stay within its budget.
+
+    Returns \c false if the image is null or larger than the budget of the
+    category.
+*/
+bool QSharedImageCache::insert(const QString &key, const QImage &image, Category category)
+{
+    SharedImageCacheData *d = sharedImageCache();
+    if (!d || key.isEmpty() || image.isNull() || category < 0 || category >= CategoryCount)
+        return false;
+
+    const int cost = imageCost(image);
+    const int limit = d->budgets[category].load();
+    if (cost > limit) {
+        remove(key);
+        return false;
+    }
+
+    const int shardIndex = qHash(key) % ShardCount;
+    Shard &shard = d->shards[shardIndex];
+    {
+        QMutexLocker locker(&shard.mutex);
+        if (Node *old = shard.nodes.value(key))
+            d->releaseNode(shard, old);
+        Node *node = new Node;
+        node->key = key;
+        node->image = image;
+        node->cost = cost;
+        node->category = category;
+        node->frequency = 0;
+        shard.link(node);
+        shard.nodes.insert(key, node);
+        d->usages[category].fetchAndAddRelaxed(cost);
+    }
+
+    // Evict outside the lock of the inserting shard, one shard at a time
+    if (d->usages[category].load() > limit)
+        d->evict(category, limit, shardIndex);
+    return true;
+}
+
+/*!
+    Removes the image stored under \a key, if any.
+*/
+void QSharedImageCache::remove(const QString &key)
+{
+    SharedImageCacheData *d = sharedImageCache();
+    if (!d || key.isEmpty())
+        return;
+    Shard &shard = d->shardFor(key);
+    QMutexLocker locker(&shard.mutex);
+    if (Node *node = shard.nodes.value(key))
+        d->releaseNode(shard, node);
+}
+
+/*!
+    Removes all images from the cache.
+*/
+void QSharedImageCache::clear()
+{
+    SharedImageCacheData *d = sharedImageCache();
+    if (!d)
+        return;
+    for (int c = 0; c < CategoryCount; ++c)
+        d->evict(Category(c), 0);
+}
+
+/*!
+    Sets the memory budget of \a category to \a kilobytes, evicting images
+    if the category currently uses more.
+*/
+void QSharedImageCache::setBudget(Category category, int kilobytes)
+{
+    SharedImageCacheData *d = sharedImageCache();
+    if (!d || category < 0 || category >= CategoryCount)
+        return;
+    kilobytes = qMax(0, kilobytes);
+    d->budgets[category].store(kilobytes);
+    d->evict(category, kilobytes);
+}
+
+/*!
+    Returns the memory budget of \a category in kilobytes.
+*/
+int QSharedImageCache::budget(Category category)
+{
+    SharedImageCacheData *d = sharedImageCache();
+    if (!d || category < 0 || category >= CategoryCount)
+        return 0;
+    return d->budgets[category].load();
+}
+
+/*!
+    Returns the memory currently used by the images of \a category in
+    kilobytes.
+*/
+int QSharedImageCache::usage(Category category)
+{
+    SharedImageCacheData *d = sharedImageCache();
+    if (!d || category < 0 || category >= CategoryCount)
+        return 0;
+    return d->usages[category].load();
+}
+
+/*!
+    Releases memory. TrimModerate evicts images until every category uses at
+    most half of its budget, TrimAll empties the cache. The registered memory
+    pressure handlers are called afterwards with \a level, on the calling
+    thread.
+*/
+void QSharedImageCache::trim(TrimLevel level)
+{
+    SharedImageCacheData *d = sharedImageCache();
+    if (!d)
+        return;
+    for (int c = 0; c < CategoryCount; ++c)
+        d->evict(Category(c), level == TrimAll ? 0 : d->budgets[c].load() / 2);
+
+    QVector<QPair<int, MemoryPressureHandler> > handlers;
+    {
+        QMutexLocker locker(&d->handlerMutex);
+        handlers = d->handlers;
+    }
+    for (const auto &handler : qAsConst(handlers))
+        handler.second(level);
+}
+
+/*!
+    Registers \a handler to be called by trim(), and returns an id that can
+    be passed to removeMemoryPressureHandler(). The handler can be called from
+    any thread.
+*/
+int QSharedImageCache::addMemoryPressureHandler(const MemoryPressureHandler &handler)
+{
+    SharedImageCacheData *d = sharedImageCache();
+    if (!d || !handler)
+        return 0;
+    QMutexLocker locker(&d->handlerMutex);
+    const int id = d->nextHandlerId++;
+    d->handlers.append(qMakePair(id, handler));
+    return id;
+}
+
+/*!
+    Unregisters the memory pressure handler with the given \a id.
+*/
+void QSharedImageCache::removeMemoryPressureHandler(int id)
+{
+    SharedImageCacheData *d = sharedImageCache();
+    if (!d)
+        return;
+    QMutexLocker locker(&d->handlerMutex);
+    for (int i = 0; i < d->handlers.size(); ++i) {
+        if (d->handlers.at(i).first == id) {
+            d->handlers.remove(i);
+            break;
+        }
+    }
+}
+
+/*!
+    Returns a key for the image file described by \a info, decoded at
+    \a requestedSize. The key changes when the file is modified, so stale
+    images are never returned. Returns an empty string if the file does not
+    exist.
+*/
+QString QSharedImageCache::fileKey(const QFileInfo &info, const QSize &requestedSize)
+{
+    if (!info.exists())
+        return QString();
+    QString key = QLatin1String("qt_file_") + info.absoluteFilePath()
+            + QLatin1Char('_') + QString::number(info.lastModified().toMSecsSinceEpoch(), 16)
+            + QLatin1Char('_') + QString::number(info.size(), 16);
+    if (requestedSize.isValid()) {
+        key += QLatin1Char('_') + QString::number(requestedSize.width())
+                + QLatin1Char('x') + QString::number(requestedSize.height());
+    }
+    return key;
+}
+
+QT_END_NAMESPACE
@@ -8,6 +8,7 @@ KERNEL_P= kernel
 HEADERS += \
         kernel/qtguiglobal.h \
         kernel/qtguiglobal_p.h \
+        kernel/qtgui_tracepoints_p.h \
         kernel/qgenericpluginfactory.h \
         kernel/qgenericplugin.h \
         kernel/qwindowsysteminterface.h \
@@ -82,6 +83,7 @@ HEADERS += \
 
 
 SOURCES += \
+        kernel/qtgui_tracepoints.cpp \
         kernel/qgenericpluginfactory.cpp \
         kernel/qgenericplugin.cpp \
         kernel/qwindowsysteminterface.cpp \
@@ -153,3 +155,12 @@ qtConfig(opengl) {
 }
 
 win32:HEADERS+=kernel/qwindowdefs_win.h
+
+# Tracepoints are compiled out unless qmake is run with QT_TRACE_BACKEND=lttng
+# or QT_TRACE_BACKEND=etw, see qtrace_p.h
+equals(QT_TRACE_BACKEND, lttng) {
+    DEFINES += Q_TRACEPOINT QT_TRACE_BACKEND_LTTNG
+    LIBS_PRIVATE += -llttng-ust -ldl
+} else: equals(QT_TRACE_BACKEND, etw) {
+    DEFINES += Q_TRACEPOINT QT_TRACE_BACKEND_ETW
+}
@@ -128,6 +128,7 @@ Qt::MouseButtons QGuiApplicationPrivate::mouse_buttons = Qt::NoButton;
 Qt::KeyboardModifiers QGuiApplicationPrivate::modifier_buttons = Qt::NoModifier;
 
 QPointF QGuiApplicationPrivate::lastCursorPosition(qInf(), qInf());
+const QVector<QWindowSystemInterfacePrivate::MotionSample> *QGuiApplicationPrivate::currentMotionHistory = 0;
 
 QWindow *QGuiApplicationPrivate::currentMouseWindow = 0;
 
@@ -1733,8 +1734,43 @@ bool QGuiApplicationPrivate::processNativeEvent(QWindow *window, const QByteArra
     return window->nativeEvent(eventType, message, result);
 }
 
+/*!
+    \internal
+
+    Returns the positions that were merged into the mouse, tablet or touch
+    event currently being delivered when the window system interface
+    compressed several motion events into one, oldest first. The last
+    sample corresponds to the event itself. Returns an empty vector if the
+    event was not compressed.
+
+    \sa Qt::AA_CompressHighFrequencyEvents, Qt::AA_CompressTabletEvents
+*/
+QVector<QWindowSystemInterfacePrivate::MotionSample> QGuiApplicationPrivate::motionHistory()
+{
+    return currentMotionHistory ? *currentMotionHistory : QVector<QWindowSystemInterfacePrivate::MotionSample>();
+}
+
+namespace {
+struct MotionHistoryScope
+{
+    MotionHistoryScope(QWindowSystemInterfacePrivate::WindowSystemEvent *e)
+        : previous(QGuiApplicationPrivate::currentMotionHistory)
+    {
+        const bool motion = e->type == QWindowSystemInterfacePrivate::Mouse
+                || e->type == QWindowSystemInterfacePrivate::Tablet
+                || e->type == QWindowSystemInterfacePrivate::Touch;
+        QGuiApplicationPrivate::currentMotionHistory =
+                motion ? &static_cast<QWindowSystemInterfacePrivate::InputEvent *>(e)->motionHistory : 0;
+    }
+    ~MotionHistoryScope() { QGuiApplicationPrivate::currentMotionHistory = previous; }
+    const QVector<QWindowSystemInterfacePrivate::MotionSample> *previous;
+};
+}
+
 void QGuiApplicationPrivate::processWindowSystemEvent(QWindowSystemInterfacePrivate::WindowSystemEvent *e)
 {
+    const MotionHistoryScope motionHistoryScope(e);
+
     switch(e->type) {
     case QWindowSystemInterfacePrivate::FrameStrutMouse:
     case QWindowSystemInterfacePrivate::Mouse:
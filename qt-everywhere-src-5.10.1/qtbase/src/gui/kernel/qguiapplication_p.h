@@ -150,6 +150,9 @@ public:
     static void processFileOpenEvent(QWindowSystemInterfacePrivate::FileOpenEvent *e);
 
     static void processTabletEvent(QWindowSystemInterfacePrivate::TabletEvent *e);
+
+    static QVector<QWindowSystemInterfacePrivate::MotionSample> motionHistory();
+    static const QVector<QWindowSystemInterfacePrivate::MotionSample> *currentMotionHistory;
     static void processTabletEnterProximityEvent(QWindowSystemInterfacePrivate::TabletEnterProximityEvent *e);
     static void processTabletLeaveProximityEvent(QWindowSystemInterfacePrivate::TabletLeaveProximityEvent *e);
 
@@ -1079,7 +1079,19 @@ QSurface *QOpenGLContext::surface() const
 void QOpenGLContext::swapBuffers(QSurface *surface)
 {
     Q_D(QOpenGLContext);
-    if (!isValid())
+    d->swapBuffers(surface, QRegion());
+}
+
+/*!
+    \internal
+
+    Swaps the buffers of \a surface like QOpenGLContext::swapBuffers(), telling
+    the platform that only \a damage, in device pixels, has changed.
+*/
+void QOpenGLContextPrivate::swapBuffers(QSurface *surface, const QRegion &damage)
+{
+    Q_Q(QOpenGLContext);
+    if (!q->isValid())
         return;
 
     if (!surface) {
@@ -1103,12 +1115,28 @@ void QOpenGLContext::swapBuffers(QSurface *surface)
         return;
 
 #if !defined(QT_NO_DEBUG)
-    if (!QOpenGLContextPrivate::toggleMakeCurrentTracker(this, false))
+    if (!QOpenGLContextPrivate::toggleMakeCurrentTracker(q, false))
         qWarning("QOpenGLContext::swapBuffers() called without corresponding makeCurrent()");
 #endif
     if (surface->format().swapBehavior() == QSurfaceFormat::SingleBuffer)
-        functions()->glFlush();
-    d->platformGLContext->swapBuffers(surfaceHandle);
+        q->functions()->glFlush();
+    if (damage.isEmpty())
+        platformGLContext->swapBuffers(surfaceHandle);
+    else
+        platformGLContext->swapBuffersWithDamage(surfaceHandle, damage);
+}
+
+/*!
+    \internal
+
+    Returns the age of the back buffer of \a surface, see
+    QPlatformOpenGLContext::bufferAge(). The context must be current.
+*/
+int QOpenGLContextPrivate::bufferAge(QSurface *surface) const
+{
+    if (!platformGLContext || !surface || !surface->surfaceHandle())
+        return 0;
+    return platformGLContext->bufferAge(surface->surfaceHandle());
 }
 
 /*!
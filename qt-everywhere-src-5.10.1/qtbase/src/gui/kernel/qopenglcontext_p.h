@@ -59,6 +59,7 @@
 #include "qopenglcontext.h"
 #include <private/qobject_p.h>
 #include <qmutex.h>
+#include <qregion.h>
 
 #include <QtCore/QByteArray>
 #include <QtCore/QHash>
@@ -264,6 +265,10 @@ public:
 
     int maxTextureSize();
 
+    // An empty damage region swaps the whole surface
+    void swapBuffers(QSurface *surface, const QRegion &damage);
+    int bufferAge(QSurface *surface) const;
+
     static QOpenGLContextPrivate *get(QOpenGLContext *context)
     {
         return context ? context->d_func() : Q_NULLPTR;
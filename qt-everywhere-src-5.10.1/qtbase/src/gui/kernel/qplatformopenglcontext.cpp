@@ -115,6 +115,40 @@ GLuint QPlatformOpenGLContext::defaultFramebufferObject(QPlatformSurface *) cons
     return 0;
 }
 
+/*!
+    \since 5.11
+
+    Swaps the buffers of \a surface, telling the windowing system that only
+    \a damage, in device pixels with the origin in the top-left corner, has
+    changed since the last swap. Reimplement in subclass if the platform can
+    make use of this, for example with EGL_KHR_swap_buffers_with_damage.
+
+    The default implementation calls swapBuffers().
+*/
+void QPlatformOpenGLContext::swapBuffersWithDamage(QPlatformSurface *surface, const QRegion &damage)
+{
+    Q_UNUSED(damage);
+    swapBuffers(surface);
+}
+
+/*!
+    \since 5.11
+
+    Returns the number of frames ago the content of the current back buffer of
+    \a surface was presented, or 0 when the content is undefined or unknown.
+    A buffer age of 1 means that the back buffer holds the previous frame, so
+    only the areas changed since then have to be repainted. The context must be
+    current for \a surface.
+
+    Reimplement in subclass if the platform supports, for example,
+    EGL_EXT_buffer_age. The default implementation returns 0.
+*/
+int QPlatformOpenGLContext::bufferAge(QPlatformSurface *surface) const
+{
+    Q_UNUSED(surface);
+    return 0;
+}
+
 QOpenGLContext *QPlatformOpenGLContext::context() const
 {
     Q_D(const QPlatformOpenGLContext);
@@ -0,0 +1,183 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+// Tracepoints of the QtGui module, see qtrace_p.h. With the LTTng backend this
+// header is read several times by <lttng/tracepoint-event.h>, which is why
+// the event definitions are not covered by the include guard.
+
+#include <QtCore/private/qtrace_p.h>
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED) && defined(QT_TRACE_BACKEND_LTTNG)
+
+#undef TRACEPOINT_PROVIDER
+#define TRACEPOINT_PROVIDER qtgui
+
+#undef TRACEPOINT_INCLUDE
+#define TRACEPOINT_INCLUDE <QtGui/private/qtgui_tracepoints_p.h>
+
+#if !defined(QTGUI_TRACEPOINTS_P_H_LTTNG) || defined(TRACEPOINT_HEADER_MULTI_READ)
+#define QTGUI_TRACEPOINTS_P_H_LTTNG
+
+#include <lttng/tracepoint.h>
+
+TRACEPOINT_EVENT(qtgui, QImageReader_read_entry,
+    TP_ARGS(const void *, reader, const char *, format),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, reader, reinterpret_cast<quintptr>(reader))
+        ctf_string(format, format)
+    )
+)
+
+TRACEPOINT_EVENT(qtgui, QImageReader_read_exit,
+    TP_ARGS(const void *, reader, int, result),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, reader, reinterpret_cast<quintptr>(reader))
+        ctf_integer(int, result, result)
+    )
+)
+
+#endif // !QTGUI_TRACEPOINTS_P_H_LTTNG || TRACEPOINT_HEADER_MULTI_READ
+
+#include <lttng/tracepoint-event.h>
+
+#endif // Q_TRACEPOINT && QT_TRACE_BACKEND_LTTNG
+
+#if !defined(QTGUI_TRACEPOINTS_P_H) && !defined(TRACEPOINT_HEADER_MULTI_READ)
+#define QTGUI_TRACEPOINTS_P_H
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED)
+
+#if defined(QT_TRACE_BACKEND_ETW)
+#include <QtCore/qt_windows.h>
+#include <TraceLoggingProvider.h>
+
+TRACELOGGING_DECLARE_PROVIDER(qtgui_provider);
+#endif
+
+QT_BEGIN_NAMESPACE
+
+class QImageReader;
+
+namespace QtPrivate {
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QImageReader_read_entry(QImageReader *reader, const char *format)
+{
+    tracepoint(qtgui, QImageReader_read_entry, reader, format);
+}
+
+inline void do_trace_QImageReader_read_entry(QImageReader *reader, const char *format)
+{
+    do_tracepoint(qtgui, QImageReader_read_entry, reader, format);
+}
+
+inline bool trace_QImageReader_read_entry_enabled()
+{
+    return tracepoint_enabled(qtgui, QImageReader_read_entry);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QImageReader_read_entry(QImageReader *reader, const char *format)
+{
+    TraceLoggingWrite(qtgui_provider, "QImageReader_read_entry",
+                      TraceLoggingPointer(reader, "reader"),
+                      TraceLoggingString(format, "format"));
+}
+
+inline void do_trace_QImageReader_read_entry(QImageReader *reader, const char *format)
+{
+    trace_QImageReader_read_entry(reader, format);
+}
+
+inline bool trace_QImageReader_read_entry_enabled()
+{
+    return TraceLoggingProviderEnabled(qtgui_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QImageReader_read_exit(QImageReader *reader, bool result)
+{
+    tracepoint(qtgui, QImageReader_read_exit, reader, result);
+}
+
+inline void do_trace_QImageReader_read_exit(QImageReader *reader, bool result)
+{
+    do_tracepoint(qtgui, QImageReader_read_exit, reader, result);
+}
+
+inline bool trace_QImageReader_read_exit_enabled()
+{
+    return tracepoint_enabled(qtgui, QImageReader_read_exit);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QImageReader_read_exit(QImageReader *reader, bool result)
+{
+    TraceLoggingWrite(qtgui_provider, "QImageReader_read_exit",
+                      TraceLoggingPointer(reader, "reader"),
+                      TraceLoggingBool(result, "result"));
+}
+
+inline void do_trace_QImageReader_read_exit(QImageReader *reader, bool result)
+{
+    trace_QImageReader_read_exit(reader, result);
+}
+
+inline bool trace_QImageReader_read_exit_enabled()
+{
+    return TraceLoggingProviderEnabled(qtgui_provider, 0, 0);
+}
+#endif
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
+
+#endif // Q_TRACEPOINT && !QT_BOOTSTRAPPED
+#endif // QTGUI_TRACEPOINTS_P_H
@@ -60,6 +60,8 @@ QMutex QWindowSystemInterfacePrivate::flushEventMutex;
 QAtomicInt QWindowSystemInterfacePrivate::eventAccepted;
 QWindowSystemEventHandler *QWindowSystemInterfacePrivate::eventHandler;
 QWindowSystemInterfacePrivate::WindowSystemEventList QWindowSystemInterfacePrivate::windowSystemEventQueue;
+Qt::MouseButtons QWindowSystemInterfacePrivate::queuedMouseButtons = Qt::NoButton;
+Qt::MouseButtons QWindowSystemInterfacePrivate::queuedTabletButtons = Qt::NoButton;
 
 extern QPointer<QWindow> qt_last_mouse_receiver;
 
@@ -76,7 +78,7 @@ extern QPointer<QWindow> qt_last_mouse_receiver;
 template<>
 bool QWindowSystemInterfacePrivate::handleWindowSystemEvent<QWindowSystemInterface::AsynchronousDelivery>(WindowSystemEvent *ev)
 {
-    windowSystemEventQueue.append(ev);
+    windowSystemEventQueue.appendOrCompress(ev);
     if (QAbstractEventDispatcher *dispatcher = QGuiApplicationPrivate::qt_qpa_core_dispatcher())
         dispatcher->wakeUp();
     return true;
@@ -136,6 +138,121 @@ bool QWindowSystemInterfacePrivate::handleWindowSystemEvent<QWindowSystemInterfa
         return handleWindowSystemEvent<QWindowSystemInterface::AsynchronousDelivery>(ev);
 }
 
+static void addMotionSample(QVector<QWindowSystemInterfacePrivate::MotionSample> *history, ulong timestamp, int id,
+                            const QPointF &localPos, const QPointF &globalPos, qreal pressure)
+{
+    if (history->size() >= QWindowSystemInterfacePrivate::MaxMotionHistory)
+        history->removeFirst();
+    const QWindowSystemInterfacePrivate::MotionSample sample = { timestamp, id, localPos, globalPos, pressure };
+    history->append(sample);
+}
+
+static void addTouchSamples(QVector<QWindowSystemInterfacePrivate::MotionSample> *history,
+                            const QWindowSystemInterfacePrivate::TouchEvent *e)
+{
+    for (const QTouchEvent::TouchPoint &point : e->points) {
+        if (point.state() == Qt::TouchPointMoved)
+            addMotionSample(history, e->timestamp, point.id(), QPointF(), point.screenPos(), point.pressure());
+    }
+}
+
+static bool canMergeTouchPoints(const QList<QTouchEvent::TouchPoint> &a, const QList<QTouchEvent::TouchPoint> &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (int i = 0; i < a.size(); ++i) {
+        if (a.at(i).id() != b.at(i).id()
+            || (a.at(i).state() | b.at(i).state()) & (Qt::TouchPointPressed | Qt::TouchPointReleased))
+            return false;
+    }
+    return true;
+}
+
+/*
+    Merges the motion event \a e into \a last, the last event in the queue, if
+    both move the same pointer with the same buttons and modifiers. This way a
+    pointer that reports at a higher rate than the application processes events
+    results in one event per event loop iteration. The positions that are merged
+    away are kept in the motion history of the remaining event.
+
+    Mouse and touch events are compressed when Qt::AA_CompressHighFrequencyEvents
+    is set, tablet events when Qt::AA_CompressTabletEvents is set as well.
+
+    Returns true if \a e was merged and can be deleted. Called with the queue locked.
+*/
+bool QWindowSystemInterfacePrivate::compressMotionEvent(WindowSystemEvent *last, WindowSystemEvent *e)
+{
+    switch (e->type) {
+    case Mouse: {
+        MouseEvent *me = static_cast<MouseEvent *>(e);
+        if (me->buttons == queuedMouseButtons)
+            me->flags |= WindowSystemEvent::Motion;
+        queuedMouseButtons = me->buttons;
+        if (!(me->flags & WindowSystemEvent::Motion) || !last || last->type != Mouse
+            || !(last->flags & WindowSystemEvent::Motion)
+            || !QCoreApplication::testAttribute(Qt::AA_CompressHighFrequencyEvents))
+            return false;
+        MouseEvent *lastMe = static_cast<MouseEvent *>(last);
+        if (lastMe->window != me->window || lastMe->buttons != me->buttons
+            || lastMe->modifiers != me->modifiers || lastMe->source != me->source)
+            return false;
+        if (lastMe->motionHistory.isEmpty())
+            addMotionSample(&lastMe->motionHistory, lastMe->timestamp, 0, lastMe->localPos, lastMe->globalPos, 0);
+        addMotionSample(&lastMe->motionHistory, me->timestamp, 0, me->localPos, me->globalPos, 0);
+        lastMe->timestamp = me->timestamp;
+        lastMe->localPos = me->localPos;
+        lastMe->globalPos = me->globalPos;
+        return true;
+    }
+    case Tablet: {
+        TabletEvent *te = static_cast<TabletEvent *>(e);
+        if (te->buttons == queuedTabletButtons)
+            te->flags |= WindowSystemEvent::Motion;
+        queuedTabletButtons = te->buttons;
+        if (!(te->flags & WindowSystemEvent::Motion) || !last || last->type != Tablet
+            || !(last->flags & WindowSystemEvent::Motion)
+            || !QCoreApplication::testAttribute(Qt::AA_CompressHighFrequencyEvents)
+            || !QCoreApplication::testAttribute(Qt::AA_CompressTabletEvents))
+            return false;
+        TabletEvent *lastTe = static_cast<TabletEvent *>(last);
+        if (lastTe->window != te->window || lastTe->buttons != te->buttons || lastTe->modifiers != te->modifiers
+            || lastTe->device != te->device || lastTe->pointerType != te->pointerType || lastTe->uid != te->uid)
+            return false;
+        if (lastTe->motionHistory.isEmpty())
+            addMotionSample(&lastTe->motionHistory, lastTe->timestamp, 0, lastTe->local, lastTe->global, lastTe->pressure);
+        addMotionSample(&lastTe->motionHistory, te->timestamp, 0, te->local, te->global, te->pressure);
+        QVector<MotionSample> history = std::move(lastTe->motionHistory);
+        *lastTe = *te;
+        lastTe->motionHistory = std::move(history);
+        return true;
+    }
+    case Touch: {
+        TouchEvent *te = static_cast<TouchEvent *>(e);
+        if (te->touchType != QEvent::TouchUpdate || !last || last->type != Touch
+            || !QCoreApplication::testAttribute(Qt::AA_CompressHighFrequencyEvents))
+            return false;
+        TouchEvent *lastTe = static_cast<TouchEvent *>(last);
+        if (lastTe->touchType != QEvent::TouchUpdate || lastTe->window != te->window
+            || lastTe->device != te->device || lastTe->modifiers != te->modifiers
+            || !canMergeTouchPoints(lastTe->points, te->points))
+            return false;
+        if (lastTe->motionHistory.isEmpty())
+            addTouchSamples(&lastTe->motionHistory, lastTe);
+        addTouchSamples(&lastTe->motionHistory, te);
+        // a point that moved in either event has moved
+        for (int i = 0; i < te->points.size(); ++i) {
+            if (lastTe->points.at(i).state() == Qt::TouchPointMoved)
+                te->points[i].setState(Qt::TouchPointMoved);
+        }
+        lastTe->timestamp = te->timestamp;
+        lastTe->points = te->points;
+        return true;
+    }
+    default:
+        return false;
+    }
+}
+
 int QWindowSystemInterfacePrivate::windowSystemEventsQueued()
 {
     return windowSystemEventQueue.count();
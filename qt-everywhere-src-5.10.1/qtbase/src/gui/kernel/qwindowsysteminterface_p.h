@@ -57,6 +57,7 @@
 #include <QPointer>
 #include <QMutex>
 #include <QList>
+#include <QVector>
 #include <QWaitCondition>
 #include <QAtomicInt>
 
@@ -106,7 +107,8 @@ public:
     public:
         enum {
             Synthetic = 0x1,
-            NullWindow = 0x2
+            NullWindow = 0x2,
+            Motion = 0x4 // a move that may be merged with the next one, see compressMotionEvent()
         };
 
         explicit WindowSystemEvent(EventType t)
@@ -226,11 +228,22 @@ public:
         unsigned long timestamp;
     };
 
+    // One position of a pointer that was merged into a later motion event
+    struct MotionSample {
+        ulong timestamp;
+        int id; // the touch point id, 0 for mouse and tablet events
+        QPointF localPos; // not set for touch points
+        QPointF globalPos;
+        qreal pressure;
+    };
+
     class InputEvent: public UserEvent {
     public:
         InputEvent(QWindow * w, ulong time, EventType t, Qt::KeyboardModifiers mods)
             : UserEvent(w, time, t), modifiers(mods) {}
         Qt::KeyboardModifiers modifiers;
+        // all samples of a coalesced motion event, oldest first; empty if nothing was merged
+        QVector<MotionSample> motionHistory;
     };
 
     class MouseEvent : public InputEvent {
@@ -477,6 +490,14 @@ public:
         }
         void append(WindowSystemEvent *e)
         { const QMutexLocker locker(&mutex); impl.append(e); }
+        void appendOrCompress(WindowSystemEvent *e)
+        {
+            const QMutexLocker locker(&mutex);
+            if (compressMotionEvent(impl.isEmpty() ? 0 : impl.last(), e))
+                delete e;
+            else
+                impl.append(e);
+        }
         int count() const
         { const QMutexLocker locker(&mutex); return impl.count(); }
         WindowSystemEvent *peekAtFirstOfType(EventType t) const
@@ -504,6 +525,11 @@ public:
 
     static WindowSystemEventList windowSystemEventQueue;
 
+    enum { MaxMotionHistory = 512 };
+    static bool compressMotionEvent(WindowSystemEvent *last, WindowSystemEvent *e);
+    static Qt::MouseButtons queuedMouseButtons;
+    static Qt::MouseButtons queuedTabletButtons;
+
     static int windowSystemEventsQueued();
     static bool nonUserInputEventsQueued();
     static WindowSystemEvent *getWindowSystemEvent();
@@ -540,6 +566,8 @@ public:
     virtual bool sendEvent(QWindowSystemInterfacePrivate::WindowSystemEvent *event);
 };
 
+Q_DECLARE_TYPEINFO(QWindowSystemInterfacePrivate::MotionSample, Q_MOVABLE_TYPE);
+
 QT_END_NAMESPACE
 
 #endif // QWINDOWSYSTEMINTERFACE_P_H
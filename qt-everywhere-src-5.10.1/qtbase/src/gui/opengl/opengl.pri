@@ -34,7 +34,8 @@ qtConfig(opengl) {
                opengl/qopengltexturehelper_p.h \
                opengl/qopenglpixeltransferoptions.h \
                opengl/qopenglextrafunctions.h \
-               opengl/qopenglprogrambinarycache_p.h
+               opengl/qopenglprogrambinarycache_p.h \
+               opengl/qopengldamagehistory_p.h
 
     SOURCES += opengl/qopengl.cpp \
                opengl/qopenglfunctions.cpp \
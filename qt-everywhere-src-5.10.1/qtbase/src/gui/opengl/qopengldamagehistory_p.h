@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPENGLDAMAGEHISTORY_P_H
+#define QOPENGLDAMAGEHISTORY_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtGui/private/qtguiglobal_p.h>
+#include <QtGui/qregion.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// Remembers what the last few frames presented on a surface changed, so that
+// with a known buffer age only the stale parts of the back buffer have to be
+// repainted instead of the whole surface. All regions are in device pixels
+// with the origin in the top-left corner.
+class QOpenGLDamageHistory
+{
+public:
+    enum { MaxBufferAge = 4 };
+
+    // The region that has to be repainted in a back buffer that is
+    // bufferAge frames old for a frame that changes damage.
+    QRegion repaintRegion(const QRegion &damage, int bufferAge, const QRect &surfaceRect) const
+    {
+        if (bufferAge <= 0 || bufferAge > m_frames.size() + 1 || surfaceRect != m_surfaceRect)
+            return surfaceRect;
+        QRegion region = damage & surfaceRect;
+        for (int i = 0; i < bufferAge - 1; ++i)
+            region |= m_frames.at(i);
+        return region;
+    }
+
+    void addFrame(const QRegion &damage, const QRect &surfaceRect)
+    {
+        if (surfaceRect != m_surfaceRect) {
+            m_frames.clear();
+            m_surfaceRect = surfaceRect;
+        }
+        m_frames.prepend(damage & surfaceRect);
+        if (m_frames.size() > MaxBufferAge - 1)
+            m_frames.removeLast();
+    }
+
+    void clear()
+    {
+        m_frames.clear();
+        m_surfaceRect = QRect();
+    }
+
+    // The bounding rect of region in the bottom-left based coordinates of glScissor()
+    static QRect scissorRect(const QRegion &region, int surfaceHeight)
+    {
+        const QRect r = region.boundingRect();
+        return QRect(r.x(), surfaceHeight - r.y() - r.height(), r.width(), r.height());
+    }
+
+private:
+    QVector<QRegion> m_frames; // the most recent frame first
+    QRect m_surfaceRect;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPENGLDAMAGEHISTORY_P_H
@@ -86,22 +86,67 @@
 #include "qopengltextureglyphcache_p.h"
 
 #include <QDebug>
+#include <QtCore/qloggingcategory.h>
 
 QT_BEGIN_NAMESPACE
 
+Q_LOGGING_CATEGORY(lcGLPaintEngine, "qt.opengl.paintengine")
+
+// Initial size of the streaming vertex buffer, in bytes
+static const int StreamBufferSize = 1024 * 1024;
 
 
 Q_GUI_EXPORT QImage qt_imageForBrush(int brushStyle, bool invert);
 
 ////////////////////////////////// Private Methods //////////////////////////////////////////
 
+/*
+    Appends \a size bytes of \a data to the streaming vertex buffer and returns
+    their offset in it, leaving the buffer bound.
+
+    The data is written to the free part of the buffer with an unsynchronized
+    mapping, so the driver does not have to wait for draw calls still reading
+    the earlier parts. Once the buffer is full its storage is orphaned, which
+    hands the driver a fresh block while the old one stays alive until the
+    GPU is done with it.
+*/
+GLintptr QOpenGL2PaintEngineExPrivate::streamVertexData(const void *data, int size)
+{
+    vertexBuffer.bind();
+    if (size <= 0)
+        return streamBufferOffset;
+
+    // keep the attributes 16 byte aligned
+    const int alignedSize = (size + 15) & ~15;
+    if (streamBufferOffset + alignedSize > streamBufferSize) {
+        streamBufferSize = qMax(streamBufferSize, StreamBufferSize);
+        while (streamBufferSize < alignedSize)
+            streamBufferSize *= 2;
+        vertexBuffer.allocate(streamBufferSize);
+        streamBufferOffset = 0;
+    }
+
+    const GLintptr offset = streamBufferOffset;
+    void *p = vertexBuffer.mapRange(offset, size, QOpenGLBuffer::RangeWrite
+                                                  | QOpenGLBuffer::RangeInvalidate
+                                                  | QOpenGLBuffer::RangeUnsynchronized);
+    if (p) {
+        memcpy(p, data, size);
+        vertexBuffer.unmap();
+    } else {
+        vertexBuffer.write(offset, data, size);
+    }
+
+    streamBufferOffset += alignedSize;
+    streamedBytes += size;
+    return offset;
+}
+
 QOpenGL2PaintEngineExPrivate::~QOpenGL2PaintEngineExPrivate()
 {
     delete shaderManager;
 
     vertexBuffer.destroy();
-    texCoordBuffer.destroy();
-    opacityBuffer.destroy();
     indexBuffer.destroy();
     vao.destroy();
 
@@ -590,7 +635,7 @@ void QOpenGL2PaintEngineExPrivate::drawTexture(const QOpenGLRect& dest, const QO
     uploadData(QT_VERTEX_COORDS_ATTR, staticVertexCoordinateArray, 8);
     uploadData(QT_TEXTURE_COORDS_ATTR, staticTextureCoordinateArray, 8);
 
-    funcs.glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+    drawArrays(GL_TRIANGLE_FAN, 0, 4);
 }
 
 void QOpenGL2PaintEngineEx::beginNativePainting()
@@ -764,6 +809,21 @@ void QOpenGL2PaintEngineExPrivate::cleanupVectorPath(QPaintEngineEx *engine, voi
     delete c;
 }
 
+struct QOpenGL2PEStrokeCache
+{
+    QPen pen;
+    QPainter::RenderHints hints;
+    qreal iscale;
+    QRectF clip; // only used by dashed pens
+    QVector<float> vertices;
+};
+
+void QOpenGL2PaintEngineExPrivate::cleanupStrokeCache(QPaintEngineEx *engine, void *data)
+{
+    Q_UNUSED(engine);
+    delete static_cast<QOpenGL2PEStrokeCache *>(data);
+}
+
 // Assumes everything is configured for the brush you want to use
 void QOpenGL2PaintEngineExPrivate::fill(const QVectorPath& path)
 {
@@ -848,7 +908,7 @@ void QOpenGL2PaintEngineExPrivate::fill(const QVectorPath& path)
 #else
             uploadData(QT_VERTEX_COORDS_ATTR, cache->vertices, cache->vertexCount * 2);
 #endif
-            funcs.glDrawArrays(cache->primitiveType, 0, cache->vertexCount);
+            drawArrays(cache->primitiveType, 0, cache->vertexCount);
 
         } else {
       //        printf(" - Marking path as cachable...\n");
@@ -943,16 +1003,16 @@ void QOpenGL2PaintEngineExPrivate::fill(const QVectorPath& path)
             uploadData(QT_VERTEX_COORDS_ATTR, 0, cache->vertexCount);
             setVertexAttributePointer(QT_VERTEX_COORDS_ATTR, 0);
             if (cache->indexType == QVertexIndexVector::UnsignedInt)
-                funcs.glDrawElements(cache->primitiveType, cache->indexCount, GL_UNSIGNED_INT, 0);
+                drawElements(cache->primitiveType, cache->indexCount, GL_UNSIGNED_INT, 0);
             else
-                funcs.glDrawElements(cache->primitiveType, cache->indexCount, GL_UNSIGNED_SHORT, 0);
+                drawElements(cache->primitiveType, cache->indexCount, GL_UNSIGNED_SHORT, 0);
             funcs.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             funcs.glBindBuffer(GL_ARRAY_BUFFER, 0);
 #else
             uploadData(QT_VERTEX_COORDS_ATTR, cache->vertices, cache->vertexCount * 2);
             const GLenum indexValueType = cache->indexType == QVertexIndexVector::UnsignedInt ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
             const bool useIndexVbo = uploadIndexData(cache->indices, indexValueType, cache->indexCount);
-            funcs.glDrawElements(cache->primitiveType, cache->indexCount, indexValueType, useIndexVbo ? nullptr : cache->indices);
+            drawElements(cache->primitiveType, cache->indexCount, indexValueType, useIndexVbo ? nullptr : cache->indices);
 #endif
 
         } else {
@@ -980,7 +1040,7 @@ void QOpenGL2PaintEngineExPrivate::fill(const QVectorPath& path)
                     uploadData(QT_VERTEX_COORDS_ATTR, vertices.constData(), vertices.size());
                     const GLenum indexValueType = funcs.hasOpenGLExtension(QOpenGLExtensions::ElementIndexUint) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
                     const bool useIndexVbo = uploadIndexData(polys.indices.data(), indexValueType, polys.indices.size());
-                    funcs.glDrawElements(GL_TRIANGLES, polys.indices.size(), indexValueType, useIndexVbo ? nullptr : polys.indices.data());
+                    drawElements(GL_TRIANGLES, polys.indices.size(), indexValueType, useIndexVbo ? nullptr : polys.indices.data());
                 } else {
                     // We can't handle big, concave painter paths with OpenGL without stencil buffer.
                     qWarning("Painter path exceeds +/-32767 pixels.");
@@ -1092,7 +1152,7 @@ void QOpenGL2PaintEngineExPrivate::fillStencilWithVertexArray(const float *data,
 #if 0
         funcs.glStencilOp(GL_KEEP, GL_KEEP, GL_INVERT); // Simply invert the stencil bit
         setVertexAttributePointer(QT_VERTEX_COORDS_ATTR, data);
-        funcs.glDrawArrays(GL_TRIANGLE_STRIP, 0, count);
+        drawArrays(GL_TRIANGLE_STRIP, 0, count);
 #else
 
         funcs.glStencilOp(GL_KEEP, GL_KEEP, GL_REPLACE);
@@ -1104,7 +1164,7 @@ void QOpenGL2PaintEngineExPrivate::fillStencilWithVertexArray(const float *data,
         }
 
         uploadData(QT_VERTEX_COORDS_ATTR, data, count * 2);
-        funcs.glDrawArrays(GL_TRIANGLE_STRIP, 0, count);
+        drawArrays(GL_TRIANGLE_STRIP, 0, count);
 #endif
     }
 
@@ -1235,7 +1295,7 @@ void QOpenGL2PaintEngineExPrivate::composite(const QOpenGLRect& boundingRect)
     setCoords(staticVertexCoordinateArray, boundingRect);
 
     uploadData(QT_VERTEX_COORDS_ATTR, staticVertexCoordinateArray, 8);
-    funcs.glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+    drawArrays(GL_TRIANGLE_FAN, 0, 4);
 }
 
 // Draws the vertex array as a set of <vertexArrayStops.size()> triangle fans.
@@ -1249,7 +1309,7 @@ void QOpenGL2PaintEngineExPrivate::drawVertexArrays(const float *data, int *stop
     for (int i=0; i<stopCount; ++i) {
         int stop = stops[i];
 
-        funcs.glDrawArrays(primitive, previousStop, stop - previousStop);
+        drawArrays(primitive, previousStop, stop - previousStop);
         previousStop = stop;
     }
 }
@@ -1322,26 +1382,62 @@ void QOpenGL2PaintEngineExPrivate::stroke(const QVectorPath &path, const QPen &p
                                                         ? q->state()->rectangleClip
                                                         : QRectF(0, 0, width, height));
 
-    if (penStyle == Qt::SolidLine) {
-        stroker.process(path, pen, clip, s->renderHints);
+    // Paths that are stroked more than once keep their triangulation
+    QOpenGL2PEStrokeCache *cache = 0;
+    bool cacheValid = false;
+    if (s->renderHints & QPainter::StrokeCaching) {
+        if (!path.isCacheable()) {
+            path.makeCacheable();
+        } else {
+            QVectorPath::CacheEntry *data = path.lookupCacheData(q, QVectorPath::StrokeVertexCache);
+            if (data) {
+                cache = static_cast<QOpenGL2PEStrokeCache *>(data->data);
+                cacheValid = cache->iscale == inverseScale
+                             && cache->hints == s->renderHints
+                             && qpen_geometry_equals(cache->pen, pen)
+                             && (penStyle == Qt::SolidLine || cache->clip == clip);
+            } else {
+                cache = new QOpenGL2PEStrokeCache;
+                path.addCacheData(q, cache, cleanupStrokeCache, QVectorPath::StrokeVertexCache);
+            }
+        }
+    }
+
+    if (!cacheValid) {
+        if (penStyle == Qt::SolidLine) {
+            stroker.process(path, pen, clip, s->renderHints);
 
-    } else { // Some sort of dash
-        dasher.process(path, pen, clip, s->renderHints);
+        } else { // Some sort of dash
+            dasher.process(path, pen, clip, s->renderHints);
 
-        QVectorPath dashStroke(dasher.points(),
-                               dasher.elementCount(),
-                               dasher.elementTypes());
-        stroker.process(dashStroke, pen, clip, s->renderHints);
+            QVectorPath dashStroke(dasher.points(),
+                                   dasher.elementCount(),
+                                   dasher.elementTypes());
+            stroker.process(dashStroke, pen, clip, s->renderHints);
+        }
+
+        if (cache) {
+            cache->pen = pen;
+            cache->hints = s->renderHints;
+            cache->iscale = inverseScale;
+            cache->clip = clip;
+            cache->vertices = QVector<float>(stroker.vertexCount());
+            if (stroker.vertexCount())
+                memcpy(cache->vertices.data(), stroker.vertices(), stroker.vertexCount() * sizeof(float));
+        }
     }
 
-    if (!stroker.vertexCount())
+    const float *vertices = cacheValid ? cache->vertices.constData() : stroker.vertices();
+    const int vertexCount = cacheValid ? cache->vertices.size() : stroker.vertexCount();
+
+    if (!vertexCount)
         return;
 
     if (opaque) {
         prepareForDraw(opaque);
 
-        uploadData(QT_VERTEX_COORDS_ATTR, stroker.vertices(), stroker.vertexCount());
-        funcs.glDrawArrays(GL_TRIANGLE_STRIP, 0, stroker.vertexCount() / 2);
+        uploadData(QT_VERTEX_COORDS_ATTR, vertices, vertexCount);
+        drawArrays(GL_TRIANGLE_STRIP, 0, vertexCount / 2);
     } else {
         qreal width = qpen_widthf(pen) / 2;
         if (width == 0)
@@ -1355,7 +1451,7 @@ void QOpenGL2PaintEngineExPrivate::stroke(const QVectorPath &path, const QPen &p
 
         QRectF bounds = path.controlPointRect().adjusted(-extra, -extra, extra, extra);
 
-        fillStencilWithVertexArray(stroker.vertices(), stroker.vertexCount() / 2,
+        fillStencilWithVertexArray(vertices, vertexCount / 2,
                                       0, 0, bounds, QOpenGL2PaintEngineExPrivate::TriStripStrokeFillMode);
 
         funcs.glStencilOp(GL_KEEP, GL_REPLACE, GL_REPLACE);
@@ -1913,10 +2009,10 @@ void QOpenGL2PaintEngineExPrivate::drawCachedGlyphs(QFontEngine::GlyphFormat gly
             updateTexture(QT_MASK_TEXTURE_UNIT, cache->texture(), GL_REPEAT, GL_NEAREST, ForceUpdate);
 
 #if defined(QT_OPENGL_DRAWCACHEDGLYPHS_INDEX_ARRAY_VBO)
-            funcs.glDrawElements(GL_TRIANGLE_STRIP, 6 * numGlyphs, GL_UNSIGNED_SHORT, 0);
+            drawElements(GL_TRIANGLE_STRIP, 6 * numGlyphs, GL_UNSIGNED_SHORT, 0);
 #else
             const bool useIndexVbo = uploadIndexData(elementIndices.data(), GL_UNSIGNED_SHORT, 6 * numGlyphs);
-            funcs.glDrawElements(GL_TRIANGLE_STRIP, 6 * numGlyphs, GL_UNSIGNED_SHORT, useIndexVbo ? nullptr : elementIndices.data());
+            drawElements(GL_TRIANGLE_STRIP, 6 * numGlyphs, GL_UNSIGNED_SHORT, useIndexVbo ? nullptr : elementIndices.data());
 #endif
 
             shaderManager->setMaskType(QOpenGLEngineShaderManager::SubPixelMaskPass2);
@@ -1964,11 +2060,11 @@ void QOpenGL2PaintEngineExPrivate::drawCachedGlyphs(QFontEngine::GlyphFormat gly
     updateTexture(textureUnit, cache->texture(), GL_REPEAT, glFilterMode, updateMode);
 
 #if defined(QT_OPENGL_DRAWCACHEDGLYPHS_INDEX_ARRAY_VBO)
-    funcs.glDrawElements(GL_TRIANGLE_STRIP, 6 * numGlyphs, GL_UNSIGNED_SHORT, 0);
+    drawElements(GL_TRIANGLE_STRIP, 6 * numGlyphs, GL_UNSIGNED_SHORT, 0);
     funcs.glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 #else
     const bool useIndexVbo = uploadIndexData(elementIndices.data(), GL_UNSIGNED_SHORT, 6 * numGlyphs);
-    funcs.glDrawElements(GL_TRIANGLE_STRIP, 6 * numGlyphs, GL_UNSIGNED_SHORT, useIndexVbo ? nullptr : elementIndices.data());
+    drawElements(GL_TRIANGLE_STRIP, 6 * numGlyphs, GL_UNSIGNED_SHORT, useIndexVbo ? nullptr : elementIndices.data());
 #endif
 }
 
@@ -2067,7 +2163,7 @@ void QOpenGL2PaintEngineExPrivate::drawPixmapFragments(const QPainter::PixmapFra
         shaderManager->currentProgram()->setUniformValue(location(QOpenGLEngineShaderManager::PatternColor), col);
     }
 
-    funcs.glDrawArrays(GL_TRIANGLES, 0, 6 * fragmentCount);
+    drawArrays(GL_TRIANGLES, 0, 6 * fragmentCount);
 }
 
 bool QOpenGL2PaintEngineEx::begin(QPaintDevice *pdev)
@@ -2090,9 +2186,9 @@ bool QOpenGL2PaintEngineEx::begin(QPaintDevice *pdev)
     if (d->ctx != QOpenGLContext::currentContext()
             || (d->ctx && QOpenGLContext::currentContext() && d->ctx->format() != QOpenGLContext::currentContext()->format())) {
         d->vertexBuffer.destroy();
-        d->texCoordBuffer.destroy();
-        d->opacityBuffer.destroy();
         d->indexBuffer.destroy();
+        d->streamBufferSize = 0;
+        d->streamBufferOffset = 0;
         d->vao.destroy();
     }
 
@@ -2124,14 +2220,6 @@ bool QOpenGL2PaintEngineEx::begin(QPaintDevice *pdev)
                 // Set its usage to StreamDraw, we will use this buffer only a few times before refilling it
                 d->vertexBuffer.setUsagePattern(QOpenGLBuffer::StreamDraw);
             }
-            if (!d->texCoordBuffer.isCreated()) {
-                d->texCoordBuffer.create();
-                d->texCoordBuffer.setUsagePattern(QOpenGLBuffer::StreamDraw);
-            }
-            if (!d->opacityBuffer.isCreated()) {
-                d->opacityBuffer.create();
-                d->opacityBuffer.setUsagePattern(QOpenGLBuffer::StreamDraw);
-            }
             if (!d->indexBuffer.isCreated()) {
                 d->indexBuffer.create();
                 d->indexBuffer.setUsagePattern(QOpenGLBuffer::StreamDraw);
@@ -2142,6 +2230,9 @@ bool QOpenGL2PaintEngineEx::begin(QPaintDevice *pdev)
     for (int i = 0; i < QT_GL_VERTEX_ARRAY_TRACKED_COUNT; ++i)
         d->vertexAttributeArraysEnabledState[i] = false;
 
+    d->drawCallCount = 0;
+    d->streamedBytes = 0;
+
     const QSize sz = d->device->size();
     d->width = sz.width();
     d->height = sz.height();
@@ -2201,6 +2292,9 @@ bool QOpenGL2PaintEngineEx::end()
     d->shaderManager = 0;
     d->currentBrush = QBrush();
 
+    qCDebug(lcGLPaintEngine, "%d draw calls, %lld bytes of vertex data streamed",
+            d->drawCallCount, d->streamedBytes);
+
 #ifdef QT_OPENGL_CACHE_AS_VBOS
     if (!d->unusedVBOSToClean.isEmpty()) {
         glDeleteBuffers(d->unusedVBOSToClean.size(), d->unusedVBOSToClean.constData());
@@ -198,9 +198,11 @@ public:
             inverseScale(1),
             lastTextureUnitUsed(QT_UNKNOWN_TEXTURE_UNIT),
             vertexBuffer(QOpenGLBuffer::VertexBuffer),
-            texCoordBuffer(QOpenGLBuffer::VertexBuffer),
-            opacityBuffer(QOpenGLBuffer::VertexBuffer),
-            indexBuffer(QOpenGLBuffer::IndexBuffer)
+            indexBuffer(QOpenGLBuffer::IndexBuffer),
+            streamBufferSize(0),
+            streamBufferOffset(0),
+            drawCallCount(0),
+            streamedBytes(0)
     { }
 
     ~QOpenGL2PaintEngineExPrivate();
@@ -231,6 +233,11 @@ public:
     // Calls glVertexAttributePointer if the pointer has changed
     inline void uploadData(unsigned int arrayIndex, const GLfloat *data, GLuint count);
     inline bool uploadIndexData(const void *data, GLenum indexValueType, GLuint count);
+    GLintptr streamVertexData(const void *data, int size);
+
+    // All draw calls go through these, so that they can be counted
+    inline void drawArrays(GLenum mode, GLint first, GLsizei count);
+    inline void drawElements(GLenum mode, GLsizei count, GLenum type, const void *indices);
 
     // draws whatever is in the vertex array:
     void drawVertexArrays(const float *data, int *stops, int stopCount, GLenum primitive);
@@ -273,6 +280,7 @@ public:
     static QOpenGLEngineShaderManager* shaderManagerForEngine(QOpenGL2PaintEngineEx *engine) { return engine->d_func()->shaderManager; }
     static QOpenGL2PaintEngineExPrivate *getData(QOpenGL2PaintEngineEx *engine) { return engine->d_func(); }
     static void cleanupVectorPath(QPaintEngineEx *engine, void *data);
+    static void cleanupStrokeCache(QPaintEngineEx *engine, void *data);
 
     QOpenGLExtensions funcs;
 
@@ -322,10 +330,14 @@ public:
     GLuint lastTextureUsed;
 
     QOpenGLVertexArrayObject vao;
-    QOpenGLBuffer vertexBuffer;
-    QOpenGLBuffer texCoordBuffer;
-    QOpenGLBuffer opacityBuffer;
+    QOpenGLBuffer vertexBuffer; // ring buffer shared by all vertex attributes
     QOpenGLBuffer indexBuffer;
+    int streamBufferSize;
+    int streamBufferOffset;
+
+    // statistics of the current begin()/end() pair
+    int drawCallCount;
+    qint64 streamedBytes;
 
     bool needsSync;
     bool multisamplingAlwaysEnabled;
@@ -348,22 +360,11 @@ void QOpenGL2PaintEngineExPrivate::uploadData(unsigned int arrayIndex, const GLf
     // and we will upload the data via a QOpenGLBuffer. Otherwise we will use
     // the legacy way of uploading the data via glVertexAttribPointer.
     if (vao.isCreated()) {
-        if (arrayIndex == QT_VERTEX_COORDS_ATTR) {
-            vertexBuffer.bind();
-            vertexBuffer.allocate(data, count * sizeof(float));
-        }
-        if (arrayIndex == QT_TEXTURE_COORDS_ATTR) {
-            texCoordBuffer.bind();
-            texCoordBuffer.allocate(data, count * sizeof(float));
-        }
-        if (arrayIndex == QT_OPACITY_ATTR) {
-            opacityBuffer.bind();
-            opacityBuffer.allocate(data, count * sizeof(float));
-        }
+        const void *offset = reinterpret_cast<const void *>(streamVertexData(data, count * sizeof(float)));
         if (arrayIndex == QT_OPACITY_ATTR)
-            funcs.glVertexAttribPointer(arrayIndex, 1, GL_FLOAT, GL_FALSE, 0, 0);
+            funcs.glVertexAttribPointer(arrayIndex, 1, GL_FLOAT, GL_FALSE, 0, offset);
         else
-            funcs.glVertexAttribPointer(arrayIndex, 2, GL_FLOAT, GL_FALSE, 0, 0);
+            funcs.glVertexAttribPointer(arrayIndex, 2, GL_FLOAT, GL_FALSE, 0, offset);
     } else {
         // If we already uploaded the data we don't have to do it again
         if (data == vertexAttribPointers[arrayIndex])
@@ -391,6 +392,18 @@ bool QOpenGL2PaintEngineExPrivate::uploadIndexData(const void *data, GLenum inde
     return false;
 }
 
+void QOpenGL2PaintEngineExPrivate::drawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    ++drawCallCount;
+    funcs.glDrawArrays(mode, first, count);
+}
+
+void QOpenGL2PaintEngineExPrivate::drawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    ++drawCallCount;
+    funcs.glDrawElements(mode, count, type, indices);
+}
+
 QT_END_NAMESPACE
 
 #endif
@@ -225,6 +225,7 @@ public:
 
 bool QOpenGLProgramBinaryCache::load(const QByteArray &cacheKey, uint programId)
 {
+    QMutexLocker lock(&m_mutex);
     if (m_memCache.contains(cacheKey)) {
         const MemCacheEntry *e = m_memCache[cacheKey];
         return setProgramBinary(programId, e->format, e->blob.constData(), e->blob.size());
@@ -363,6 +364,10 @@ void QOpenGLProgramBinaryCache::save(const QByteArray &cacheKey, uint programId)
 
     writeUInt(&blobFormatPtr, blobFormat);
 
+    QMutexLocker lock(&m_mutex);
+    // spare the next program with the same sources the disk access
+    m_memCache.insert(cacheKey, new MemCacheEntry(p, blobSize, blobFormat));
+
     QSaveFile f(cacheFileName(cacheKey));
     if (f.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
         f.write(blob);
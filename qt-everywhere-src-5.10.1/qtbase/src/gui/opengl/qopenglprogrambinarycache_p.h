@@ -54,6 +54,7 @@
 #include <QtGui/qtguiglobal.h>
 #include <QtGui/qopenglshaderprogram.h>
 #include <QtCore/qcache.h>
+#include <QtCore/qmutex.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -93,6 +94,8 @@ private:
         uint format;
     };
     QCache<QByteArray, MemCacheEntry> m_memCache;
+    // programs may be linked on several render threads at once
+    QMutex m_mutex;
 };
 
 QT_END_NAMESPACE
@@ -40,6 +40,7 @@
 #include "qopenglshaderprogram.h"
 #include "qopenglprogrambinarycache_p.h"
 #include "qopenglfunctions.h"
+#include "qopenglextrafunctions.h"
 #include "private/qopenglcontext_p.h"
 #include <QtCore/private/qobject_p.h>
 #include <QtCore/qdebug.h>
@@ -211,6 +212,10 @@ Q_LOGGING_CATEGORY(DBG_SHADER_CACHE, "qt.opengl.diskcache")
 #define GL_PATCH_DEFAULT_INNER_LEVEL  0x8E73
 #endif
 
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+
 #ifndef GL_NUM_PROGRAM_BINARY_FORMATS
 #define GL_NUM_PROGRAM_BINARY_FORMATS     0x87FE
 #endif
@@ -3812,9 +3817,18 @@ bool QOpenGLShaderProgramPrivate::linkBinary()
 
     Q_Q(QOpenGLShaderProgram);
 
+    // The GL implementation is part of the key, so that the binaries of
+    // several GPUs or driver versions sharing a cache do not replace
+    // each other.
     QCryptographicHash keyBuilder(QCryptographicHash::Sha1);
-    for (const QOpenGLProgramBinaryCache::ShaderDesc &shader : qAsConst(binaryProgram.shaders))
+    for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+        if (const char *str = reinterpret_cast<const char *>(glfuncs->glGetString(name)))
+            keyBuilder.addData(str, int(qstrlen(str)) + 1);
+    }
+    for (const QOpenGLProgramBinaryCache::ShaderDesc &shader : qAsConst(binaryProgram.shaders)) {
+        keyBuilder.addData(QByteArray::number(shader.type));
         keyBuilder.addData(shader.source);
+    }
 
     const QByteArray cacheKey = keyBuilder.result().toHex();
     if (DBG_SHADER_CACHE().isEnabled(QtDebugMsg))
@@ -3840,6 +3854,11 @@ bool QOpenGLShaderProgramPrivate::linkBinary()
             needsSave = true;
         else
             return false;
+        // some implementations only return a binary when asked for it
+        // before linking
+        QOpenGLContext *ctx = QOpenGLContext::currentContext();
+        if (ctx->isOpenGLES())
+            ctx->extraFunctions()->glProgramParameteri(q->programId(), GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     }
 
     linkBinaryRecursion = true;
@@ -6341,6 +6341,31 @@ static void qInitDrawhelperFunctions()
     qt_functionForMode_C[QPainter::CompositionMode_Source] = comp_func_Source_sse2;
     qt_functionForMode_C[QPainter::CompositionMode_Plus] = comp_func_Plus_sse2;
 
+    extern void QT_FASTCALL comp_func_Multiply_sse2(uint *dst, const uint *src, int length, uint const_alpha);
+    extern void QT_FASTCALL comp_func_solid_Multiply_sse2(uint *dst, int length, uint color, uint const_alpha);
+    extern void QT_FASTCALL comp_func_Screen_sse2(uint *dst, const uint *src, int length, uint const_alpha);
+    extern void QT_FASTCALL comp_func_solid_Screen_sse2(uint *dst, int length, uint color, uint const_alpha);
+    extern void QT_FASTCALL comp_func_Darken_sse2(uint *dst, const uint *src, int length, uint const_alpha);
+    extern void QT_FASTCALL comp_func_solid_Darken_sse2(uint *dst, int length, uint color, uint const_alpha);
+    extern void QT_FASTCALL comp_func_Lighten_sse2(uint *dst, const uint *src, int length, uint const_alpha);
+    extern void QT_FASTCALL comp_func_solid_Lighten_sse2(uint *dst, int length, uint color, uint const_alpha);
+    extern void QT_FASTCALL comp_func_Difference_sse2(uint *dst, const uint *src, int length, uint const_alpha);
+    extern void QT_FASTCALL comp_func_solid_Difference_sse2(uint *dst, int length, uint color, uint const_alpha);
+    extern void QT_FASTCALL comp_func_Exclusion_sse2(uint *dst, const uint *src, int length, uint const_alpha);
+    extern void QT_FASTCALL comp_func_solid_Exclusion_sse2(uint *dst, int length, uint color, uint const_alpha);
+    qt_functionForMode_C[QPainter::CompositionMode_Multiply] = comp_func_Multiply_sse2;
+    qt_functionForModeSolid_C[QPainter::CompositionMode_Multiply] = comp_func_solid_Multiply_sse2;
+    qt_functionForMode_C[QPainter::CompositionMode_Screen] = comp_func_Screen_sse2;
+    qt_functionForModeSolid_C[QPainter::CompositionMode_Screen] = comp_func_solid_Screen_sse2;
+    qt_functionForMode_C[QPainter::CompositionMode_Darken] = comp_func_Darken_sse2;
+    qt_functionForModeSolid_C[QPainter::CompositionMode_Darken] = comp_func_solid_Darken_sse2;
+    qt_functionForMode_C[QPainter::CompositionMode_Lighten] = comp_func_Lighten_sse2;
+    qt_functionForModeSolid_C[QPainter::CompositionMode_Lighten] = comp_func_solid_Lighten_sse2;
+    qt_functionForMode_C[QPainter::CompositionMode_Difference] = comp_func_Difference_sse2;
+    qt_functionForModeSolid_C[QPainter::CompositionMode_Difference] = comp_func_solid_Difference_sse2;
+    qt_functionForMode_C[QPainter::CompositionMode_Exclusion] = comp_func_Exclusion_sse2;
+    qt_functionForModeSolid_C[QPainter::CompositionMode_Exclusion] = comp_func_solid_Exclusion_sse2;
+
 #ifdef QT_COMPILER_SUPPORTS_SSSE3
     if (qCpuHasFeature(SSSE3)) {
         extern void qt_blend_argb32_on_argb32_ssse3(uchar *destPixels, int dbpl,
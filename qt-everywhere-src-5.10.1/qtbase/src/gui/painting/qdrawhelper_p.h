@@ -313,6 +313,9 @@ struct QSpanData
     QRasterBuffer *rasterBuffer;
     ProcessSpans blend;
     ProcessSpans unclipped_blend;
+#ifndef QT_NO_THREAD
+    ProcessSpans serial_blend; // the blend function unclipped_blend may distribute across threads
+#endif
     BitmapBlitFunc bitmapBlit;
     AlphamapBlitFunc alphamapBlit;
     AlphaRGBBlitFunc alphaRGBBlit;
@@ -233,6 +233,235 @@ void QT_FASTCALL comp_func_Source_sse2(uint *dst, const uint *src, int length, u
     }
 }
 
+// qcompositionfunctions.cpp
+void QT_FASTCALL comp_func_Multiply(uint *dest, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_solid_Multiply(uint *dest, int length, uint color, uint const_alpha);
+void QT_FASTCALL comp_func_Screen(uint *dest, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_solid_Screen(uint *dest, int length, uint color, uint const_alpha);
+void QT_FASTCALL comp_func_Darken(uint *dest, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_solid_Darken(uint *dest, int length, uint color, uint const_alpha);
+void QT_FASTCALL comp_func_Lighten(uint *dest, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_solid_Lighten(uint *dest, int length, uint color, uint const_alpha);
+void QT_FASTCALL comp_func_Difference(uint *dest, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_solid_Difference(uint *dest, int length, uint color, uint const_alpha);
+void QT_FASTCALL comp_func_Exclusion(uint *dest, const uint *src, int length, uint const_alpha);
+void QT_FASTCALL comp_func_solid_Exclusion(uint *dest, int length, uint color, uint const_alpha);
+
+/*
+    The separable blend modes below work on two pixels at a time, unpacked to
+    one 16 bit lane per channel, and give the same results as the C versions
+    in qcompositionfunctions.cpp bit for bit, including the truncation of
+    out of range channels done by qRgba(). Intermediate sums that do not fit
+    in 16 bits are computed on 32 bit lanes.
+*/
+static inline __m128i div255_epi32_sse2(__m128i x)
+{
+    // (x + (x >> 8) + 0x80) >> 8, like qt_div_255()
+    x = _mm_add_epi32(x, _mm_srli_epi32(x, 8));
+    x = _mm_add_epi32(x, _mm_set1_epi32(0x80));
+    return _mm_srli_epi32(x, 8);
+}
+
+static inline __m128i div255_epu16_sse2(__m128i x)
+{
+    // only valid for x <= 255 * 255
+    x = _mm_add_epi16(x, _mm_srli_epi16(x, 8));
+    x = _mm_add_epi16(x, _mm_set1_epi16(0x80));
+    return _mm_srli_epi16(x, 8);
+}
+
+static inline __m128i min_epu16_sse2(__m128i a, __m128i b)
+{
+    const __m128i sign = _mm_set1_epi16(short(0x8000));
+    return _mm_xor_si128(_mm_min_epi16(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign)), sign);
+}
+
+static inline __m128i max_epu16_sse2(__m128i a, __m128i b)
+{
+    const __m128i sign = _mm_set1_epi16(short(0x8000));
+    return _mm_xor_si128(_mm_max_epi16(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign)), sign);
+}
+
+// div255(a + b + c) for unsigned 16 bit a, b and c
+static inline __m128i div255_sum3_epu16_sse2(__m128i a, __m128i b, __m128i c)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i lo = _mm_add_epi32(_mm_unpacklo_epi16(a, zero), _mm_unpacklo_epi16(b, zero));
+    __m128i hi = _mm_add_epi32(_mm_unpackhi_epi16(a, zero), _mm_unpackhi_epi16(b, zero));
+    lo = _mm_add_epi32(lo, _mm_unpacklo_epi16(c, zero));
+    hi = _mm_add_epi32(hi, _mm_unpackhi_epi16(c, zero));
+    return _mm_packs_epi32(div255_epi32_sse2(lo), div255_epi32_sse2(hi));
+}
+
+// div255(2 * a) for unsigned 16 bit a
+static inline __m128i div255_double_epu16_sse2(__m128i a)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = _mm_slli_epi32(_mm_unpacklo_epi16(a, zero), 1);
+    const __m128i hi = _mm_slli_epi32(_mm_unpackhi_epi16(a, zero), 1);
+    return _mm_packs_epi32(div255_epi32_sse2(lo), div255_epi32_sse2(hi));
+}
+
+// s * (255 - da) + d * (255 - sa), the part shared by most of the modes, as two terms
+#define SEPARABLE_OUTSIDE_TERMS_SSE2(s, d, sa, da) \
+    const __m128i one = _mm_set1_epi16(0xff); \
+    const __m128i sOut = _mm_mullo_epi16(s, _mm_sub_epi16(one, da)); \
+    const __m128i dOut = _mm_mullo_epi16(d, _mm_sub_epi16(one, sa));
+
+struct QMultiplyOp_sse2 {
+    static inline __m128i channels(__m128i s, __m128i d, __m128i sa, __m128i da)
+    {
+        SEPARABLE_OUTSIDE_TERMS_SSE2(s, d, sa, da)
+        return div255_sum3_epu16_sse2(_mm_mullo_epi16(s, d), sOut, dOut);
+    }
+};
+
+struct QDarkenOp_sse2 {
+    static inline __m128i channels(__m128i s, __m128i d, __m128i sa, __m128i da)
+    {
+        SEPARABLE_OUTSIDE_TERMS_SSE2(s, d, sa, da)
+        const __m128i m = min_epu16_sse2(_mm_mullo_epi16(s, da), _mm_mullo_epi16(d, sa));
+        return div255_sum3_epu16_sse2(m, sOut, dOut);
+    }
+};
+
+struct QLightenOp_sse2 {
+    static inline __m128i channels(__m128i s, __m128i d, __m128i sa, __m128i da)
+    {
+        SEPARABLE_OUTSIDE_TERMS_SSE2(s, d, sa, da)
+        const __m128i m = max_epu16_sse2(_mm_mullo_epi16(s, da), _mm_mullo_epi16(d, sa));
+        return div255_sum3_epu16_sse2(m, sOut, dOut);
+    }
+};
+
+#undef SEPARABLE_OUTSIDE_TERMS_SSE2
+
+struct QDifferenceOp_sse2 {
+    static inline __m128i channels(__m128i s, __m128i d, __m128i sa, __m128i da)
+    {
+        const __m128i m = min_epu16_sse2(_mm_mullo_epi16(s, da), _mm_mullo_epi16(d, sa));
+        return _mm_sub_epi16(_mm_add_epi16(s, d), div255_double_epu16_sse2(m));
+    }
+};
+
+// comp_func_Screen() divides by 256, comp_func_solid_Screen() by 255
+template <bool Solid>
+struct QScreenOp_sse2 {
+    static inline __m128i channels(__m128i s, __m128i d, __m128i, __m128i)
+    {
+        const __m128i one = _mm_set1_epi16(0xff);
+        const __m128i p = _mm_mullo_epi16(_mm_sub_epi16(one, s), _mm_sub_epi16(one, d));
+        return _mm_sub_epi16(one, Solid ? div255_epu16_sse2(p) : _mm_srli_epi16(p, 8));
+    }
+};
+
+// comp_func_Exclusion() uses (s * d) >> 7, comp_func_solid_Exclusion() div255(2 * s * d)
+template <bool Solid>
+struct QExclusionOp_sse2 {
+    static inline __m128i channels(__m128i s, __m128i d, __m128i, __m128i)
+    {
+        const __m128i p = _mm_mullo_epi16(s, d);
+        return _mm_sub_epi16(_mm_add_epi16(s, d), Solid ? div255_double_epu16_sse2(p) : _mm_srli_epi16(p, 7));
+    }
+};
+
+template <typename Op>
+static inline __m128i blendSeparable_helper_sse2(__m128i s, __m128i d)
+{
+    const __m128i one = _mm_set1_epi16(0xff);
+    const __m128i sa = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128i da = _mm_shufflehi_epi16(_mm_shufflelo_epi16(d, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    // the alpha channel is mix_alpha(da, sa) for all the separable modes
+    const __m128i alpha = _mm_sub_epi16(one, _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(one, sa), _mm_sub_epi16(one, da)), 8));
+    const __m128i alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i color = _mm_and_si128(Op::channels(s, d, sa, da), one);
+    return _mm_or_si128(_mm_andnot_si128(alphaMask, color), _mm_and_si128(alphaMask, alpha));
+}
+
+template <typename Op>
+static inline __m128i blendSeparable_sse2(__m128i srcVector, __m128i dstVector)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = blendSeparable_helper_sse2<Op>(_mm_unpacklo_epi8(srcVector, zero), _mm_unpacklo_epi8(dstVector, zero));
+    const __m128i hi = blendSeparable_helper_sse2<Op>(_mm_unpackhi_epi8(srcVector, zero), _mm_unpackhi_epi8(dstVector, zero));
+    return _mm_packus_epi16(lo, hi);
+}
+
+template <typename Op>
+static inline int comp_func_separable_sse2(uint *dst, const uint *src, int length, uint const_alpha)
+{
+    int x = 0;
+    if (const_alpha == 255) {
+        for (; x < length - 3; x += 4) {
+            const __m128i srcVector = _mm_loadu_si128((const __m128i *)&src[x]);
+            const __m128i dstVector = _mm_loadu_si128((const __m128i *)&dst[x]);
+            _mm_storeu_si128((__m128i *)&dst[x], blendSeparable_sse2<Op>(srcVector, dstVector));
+        }
+    } else {
+        const __m128i half = _mm_set1_epi16(0x80);
+        const __m128i colorMask = _mm_set1_epi32(0x00ff00ff);
+        const __m128i constAlphaVector = _mm_set1_epi16(const_alpha);
+        const __m128i oneMinusConstAlpha = _mm_set1_epi16(255 - const_alpha);
+        for (; x < length - 3; x += 4) {
+            const __m128i srcVector = _mm_loadu_si128((const __m128i *)&src[x]);
+            const __m128i dstVector = _mm_loadu_si128((const __m128i *)&dst[x]);
+            __m128i result = blendSeparable_sse2<Op>(srcVector, dstVector);
+            INTERPOLATE_PIXEL_255_SSE2(result, result, dstVector, constAlphaVector, oneMinusConstAlpha, colorMask, half)
+            _mm_storeu_si128((__m128i *)&dst[x], result);
+        }
+    }
+    return x;
+}
+
+template <typename Op>
+static inline int comp_func_solid_separable_sse2(uint *dst, int length, uint color, uint const_alpha)
+{
+    int x = 0;
+    const __m128i colorVector = _mm_set1_epi32(color);
+    if (const_alpha == 255) {
+        for (; x < length - 3; x += 4) {
+            const __m128i dstVector = _mm_loadu_si128((const __m128i *)&dst[x]);
+            _mm_storeu_si128((__m128i *)&dst[x], blendSeparable_sse2<Op>(colorVector, dstVector));
+        }
+    } else {
+        const __m128i half = _mm_set1_epi16(0x80);
+        const __m128i colorMask = _mm_set1_epi32(0x00ff00ff);
+        const __m128i constAlphaVector = _mm_set1_epi16(const_alpha);
+        const __m128i oneMinusConstAlpha = _mm_set1_epi16(255 - const_alpha);
+        for (; x < length - 3; x += 4) {
+            const __m128i dstVector = _mm_loadu_si128((const __m128i *)&dst[x]);
+            __m128i result = blendSeparable_sse2<Op>(colorVector, dstVector);
+            INTERPOLATE_PIXEL_255_SSE2(result, result, dstVector, constAlphaVector, oneMinusConstAlpha, colorMask, half)
+            _mm_storeu_si128((__m128i *)&dst[x], result);
+        }
+    }
+    return x;
+}
+
+// The remaining pixels are handled by the C versions.
+#define QT_DEFINE_SEPARABLE_COMP_FUNC_SSE2(Mode, Op, SolidOp) \
+void QT_FASTCALL comp_func_##Mode##_sse2(uint *dst, const uint *src, int length, uint const_alpha) \
+{ \
+    const int x = comp_func_separable_sse2<Op>(dst, src, length, const_alpha); \
+    if (x < length) \
+        comp_func_##Mode(dst + x, src + x, length - x, const_alpha); \
+} \
+void QT_FASTCALL comp_func_solid_##Mode##_sse2(uint *dst, int length, uint color, uint const_alpha) \
+{ \
+    const int x = comp_func_solid_separable_sse2<SolidOp>(dst, length, color, const_alpha); \
+    if (x < length) \
+        comp_func_solid_##Mode(dst + x, length - x, color, const_alpha); \
+}
+
+QT_DEFINE_SEPARABLE_COMP_FUNC_SSE2(Multiply, QMultiplyOp_sse2, QMultiplyOp_sse2)
+QT_DEFINE_SEPARABLE_COMP_FUNC_SSE2(Screen, QScreenOp_sse2<false>, QScreenOp_sse2<true>)
+QT_DEFINE_SEPARABLE_COMP_FUNC_SSE2(Darken, QDarkenOp_sse2, QDarkenOp_sse2)
+QT_DEFINE_SEPARABLE_COMP_FUNC_SSE2(Lighten, QLightenOp_sse2, QLightenOp_sse2)
+QT_DEFINE_SEPARABLE_COMP_FUNC_SSE2(Difference, QDifferenceOp_sse2, QDifferenceOp_sse2)
+QT_DEFINE_SEPARABLE_COMP_FUNC_SSE2(Exclusion, QExclusionOp_sse2<false>, QExclusionOp_sse2<true>)
+
+#undef QT_DEFINE_SEPARABLE_COMP_FUNC_SSE2
+
 void qt_memfill32(quint32 *dest, quint32 value, int count)
 {
     if (count < 7) {
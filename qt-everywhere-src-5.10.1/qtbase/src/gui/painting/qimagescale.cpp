@@ -38,6 +38,7 @@
 ****************************************************************************/
 #include <private/qimagescale_p.h>
 #include <private/qdrawhelper_p.h>
+#include <private/qimage_p.h>
 
 #include "qimage.h"
 #include "qcolor.h"
@@ -745,12 +746,20 @@ QImage qSmoothScaleImage(const QImage &src, int dw, int dh)
         return QImage();
     }
 
-    if (src.hasAlphaChannel())
-        qt_qimageScaleAARGBA(scaleinfo, (unsigned int *)buffer.scanLine(0),
-                             dw, dh, dw, src.bytesPerLine() / 4);
-    else
-        qt_qimageScaleAARGB(scaleinfo, (unsigned int *)buffer.scanLine(0),
-                            dw, dh, dw, src.bytesPerLine() / 4);
+    const bool hasAlpha = src.hasAlphaChannel();
+    const int sow = src.bytesPerLine() / 4;
+    unsigned int *dest = (unsigned int *)buffer.scanLine(0);
+    // each band scales its destination rows through a shifted copy of the scale info
+    auto scaleRows = [=](int yStart, int yEnd) {
+        QImageScaleInfo isi = *scaleinfo;
+        isi.ypoints += yStart;
+        isi.yapoints += yStart;
+        if (hasAlpha)
+            qt_qimageScaleAARGBA(&isi, dest + qptrdiff(yStart) * dw, dw, yEnd - yStart, dw, sow);
+        else
+            qt_qimageScaleAARGB(&isi, dest + qptrdiff(yStart) * dw, dw, yEnd - yStart, dw, sow);
+    };
+    qt_imageProcessRows(qint64(qMax(w, dw)) * qMax(h, dh), dh, scaleRows);
 
     qimageFreeScaleInfo(scaleinfo);
     return buffer;
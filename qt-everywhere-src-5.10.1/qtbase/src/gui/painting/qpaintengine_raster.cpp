@@ -39,6 +39,8 @@
 
 #include <QtCore/qglobal.h>
 #include <QtCore/qmutex.h>
+#include <QtCore/qsemaphore.h>
+#include <QtCore/qthreadpool.h>
 
 #define QT_FT_BEGIN_HEADER
 #define QT_FT_END_HEADER
@@ -188,6 +190,9 @@ bool QRasterPaintEngine::clearTypeFontsEnabled()
 static void qt_span_fill_clipRect(int count, const QSpan *spans, void *userData);
 static void qt_span_fill_clipped(int count, const QSpan *spans, void *userData);
 static void qt_span_clip(int count, const QSpan *spans, void *userData);
+#ifndef QT_NO_THREAD
+static void qt_span_fill_parallel(int count, const QSpan *spans, void *userData);
+#endif
 
 struct ClipData
 {
@@ -4100,6 +4105,105 @@ static void qt_span_fill_clipRect(int count, const QSpan *spans,
         fillData->unclipped_blend(count, spans, fillData);
 }
 
+#ifndef QT_NO_THREAD
+/*
+    Large span batches are blended on a thread pool of their own, so that
+    painting into big images (as for printing or exporting) can use more than
+    one core. Each batch is cut into horizontal bands at scanline boundaries,
+    so every pixel is still written by a single thread, in the original order.
+
+    The spans of one batch have to be sorted by scanline for this, which the
+    rasterizers always do; other batches are blended on the calling thread.
+*/
+enum {
+    ParallelBlendMinSpans = 32,
+    ParallelBlendMinPixelsPerBand = 32 * 1024,
+    ParallelBlendMaxBands = 16
+};
+
+// -1 until decided; set to 0 to blend everything on the painting thread
+Q_AUTOTEST_EXPORT QBasicAtomicInt qt_raster_parallel_blend = Q_BASIC_ATOMIC_INITIALIZER(-1);
+
+static bool qt_rasterParallelBlendEnabled()
+{
+    int enabled = qt_raster_parallel_blend.load();
+    if (enabled < 0) {
+        enabled = QThread::idealThreadCount() > 1 && !qEnvironmentVariableIsSet("QT_NO_PARALLEL_RASTER");
+        qt_raster_parallel_blend.testAndSetRelaxed(-1, enabled);
+        enabled = qt_raster_parallel_blend.load();
+    }
+    return enabled;
+}
+
+Q_GLOBAL_STATIC(QThreadPool, qt_rasterThreadPool)
+
+namespace {
+class QRasterBlendBand : public QRunnable
+{
+public:
+    QRasterBlendBand() { setAutoDelete(false); }
+    void run() override
+    {
+        data->serial_blend(count, spans, data);
+        done->release();
+    }
+
+    QSpanData *data;
+    const QSpan *spans;
+    int count;
+    QSemaphore *done;
+};
+} // unnamed namespace
+
+static void qt_span_fill_parallel(int count, const QSpan *spans, void *userData)
+{
+    QSpanData *fillData = reinterpret_cast<QSpanData *>(userData);
+    QThreadPool *pool = qt_rasterThreadPool();
+    if (count < ParallelBlendMinSpans || !pool) {
+        fillData->serial_blend(count, spans, fillData);
+        return;
+    }
+
+    qint64 pixels = spans[0].len;
+    for (int i = 1; i < count; ++i) {
+        if (spans[i].y < spans[i - 1].y) {
+            fillData->serial_blend(count, spans, fillData);
+            return;
+        }
+        pixels += spans[i].len;
+    }
+    const int bands = int(qMin<qint64>(qMin(pool->maxThreadCount() + 1, int(ParallelBlendMaxBands)),
+                                       pixels / ParallelBlendMinPixelsPerBand));
+    if (bands < 2) {
+        fillData->serial_blend(count, spans, fillData);
+        return;
+    }
+
+    QSemaphore done;
+    QRasterBlendBand tasks[ParallelBlendMaxBands];
+    int started = 0;
+    int begin = 0;
+    for (int band = 1; band <= bands && begin < count; ++band) {
+        int end = qMax(begin, int(qint64(count) * band / bands));
+        while (end < count && end > begin && spans[end].y == spans[end - 1].y)
+            ++end;
+        if (band == bands || end == count) {
+            // the last band is blended on the painting thread
+            fillData->serial_blend(end - begin, spans + begin, fillData);
+        } else if (end > begin) {
+            QRasterBlendBand &task = tasks[started++];
+            task.data = fillData;
+            task.spans = spans + begin;
+            task.count = end - begin;
+            task.done = &done;
+            pool->start(&task);
+        }
+        begin = end;
+    }
+    done.acquire(started);
+}
+#endif // QT_NO_THREAD
+
 static void qt_span_clip(int count, const QSpan *spans, void *userData)
 {
     ClipData *clipData = reinterpret_cast<ClipData *>(userData);
@@ -4606,6 +4710,15 @@ void QSpanData::adjustSpanMethods()
 
         break;
     }
+#ifndef QT_NO_THREAD
+    // qt_gradient_quint16() modifies the span data while blending, and the
+    // pixels of formats below 8 bits per pixel share bytes
+    serial_blend = unclipped_blend;
+    if (unclipped_blend && rasterBuffer->format != QImage::Format_RGB16
+        && qt_depthForFormat(rasterBuffer->format) >= 8 && qt_rasterParallelBlendEnabled()) {
+        unclipped_blend = qt_span_fill_parallel;
+    }
+#endif
     // setup clipping
     if (!unclipped_blend) {
         blend = 0;
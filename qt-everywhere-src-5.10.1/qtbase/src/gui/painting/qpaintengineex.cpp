@@ -112,8 +112,8 @@ QRectF QVectorPath::controlPointRect() const
 
 
 QVectorPath::CacheEntry *QVectorPath::addCacheData(QPaintEngineEx *engine, void *data,
-                                                   qvectorpath_cache_cleanup cleanup) const{
-    Q_ASSERT(!lookupCacheData(engine));
+                                                   qvectorpath_cache_cleanup cleanup, CacheType type) const{
+    Q_ASSERT(!lookupCacheData(engine, type));
     if ((m_hints & IsCachedHint) == 0) {
         m_cache = 0;
         m_hints |= IsCachedHint;
@@ -122,6 +122,7 @@ QVectorPath::CacheEntry *QVectorPath::addCacheData(QPaintEngineEx *engine, void
     e->engine = engine;
     e->data = data;
     e->cleanup = cleanup;
+    e->type = type;
     e->next = m_cache;
     m_cache = e;
     return m_cache;
@@ -175,6 +176,35 @@ QPaintEngineExPrivate::~QPaintEngineExPrivate()
 }
 
 
+/*
+    The outline of a stroke kept with the stroked path when the
+    QPainter::StrokeCaching render hint is set. It can be reused as long as
+    neither the geometry of the pen nor the transformation, which decides
+    the curve flattening and dash clipping, change.
+*/
+struct QStrokeCache
+{
+    QPen pen;
+    QTransform matrix;
+    QRect deviceRect;
+    bool cosmetic;
+    uint flags;
+    QVector<qreal> pts;
+    QVector<QPainterPath::ElementType> types;
+
+    bool isValidFor(const QPen &p, const QTransform &m, const QRect &r, bool c) const
+    {
+        return cosmetic == c && deviceRect == r && matrix == m && qpen_geometry_equals(pen, p);
+    }
+};
+
+static void qpaintengineex_cleanupStrokeCache(QPaintEngineEx *engine, void *data)
+{
+    Q_UNUSED(engine);
+    delete static_cast<QStrokeCache *>(data);
+}
+
+
 void QPaintEngineExPrivate::replayClipOperations()
 {
     Q_Q(QPaintEngineEx);
@@ -439,6 +469,31 @@ void QPaintEngineEx::stroke(const QVectorPath &path, const QPen &pen)
         }
     }
 
+    const bool cosmetic = qt_pen_is_cosmetic(pen, state()->renderHints);
+
+    // Paths that are stroked more than once keep their outline
+    QStrokeCache *cache = 0;
+    if (state()->renderHints & QPainter::StrokeCaching) {
+        if (!path.isCacheable()) {
+            path.makeCacheable();
+        } else {
+            QVectorPath::CacheEntry *e = path.lookupCacheData(this, QVectorPath::StrokeCache);
+            if (e) {
+                cache = static_cast<QStrokeCache *>(e->data);
+                if (cache->isValidFor(pen, state()->matrix, d->exDeviceRect, cosmetic)) {
+                    QVectorPath strokePath(cache->pts.constData(), cache->types.size(),
+                                           cache->types.constData(), cache->flags);
+                    fillStroke(strokePath, pen, cosmetic);
+                    return;
+                }
+            } else {
+                cache = new QStrokeCache;
+                path.addCacheData(this, cache, qpaintengineex_cleanupStrokeCache,
+                                  QVectorPath::StrokeCache);
+            }
+        }
+    }
+
     const QPainterPath::ElementType *types = path.elements();
     const qreal *points = path.points();
     int pointCount = path.elementCount();
@@ -458,7 +513,7 @@ void QPaintEngineEx::stroke(const QVectorPath &path, const QPen &pen)
         flags |= QVectorPath::CurvedShapeMask;
 
     // ### Perspective Xforms are currently not supported...
-    if (!qt_pen_is_cosmetic(pen, state()->renderHints)) {
+    if (!cosmetic) {
         // We include cosmetic pens in this case to avoid having to
         // change the current transform. Normal transformed,
         // non-cosmetic pens will be transformed as part of fill
@@ -504,15 +559,6 @@ void QPaintEngineEx::stroke(const QVectorPath &path, const QPen &pen)
                 d->activeStroker->lineTo(path.points()[0], path.points()[1]);
         }
         d->activeStroker->end();
-
-        if (!d->strokeHandler->types.size()) // an empty path...
-            return;
-
-        QVectorPath strokePath(d->strokeHandler->pts.data(),
-                               d->strokeHandler->types.size(),
-                               d->strokeHandler->types.data(),
-                               flags);
-        fill(strokePath, pen.brush());
     } else {
         // For cosmetic pens we need a bit of trickery... We to process xform the input points
         if (state()->matrix.type() >= QTransform::TxProject) {
@@ -571,25 +617,59 @@ void QPaintEngineEx::stroke(const QVectorPath &path, const QPen &pen)
             }
             d->activeStroker->end();
         }
+    }
 
-        QVectorPath strokePath(d->strokeHandler->pts.data(),
-                               d->strokeHandler->types.size(),
-                               d->strokeHandler->types.data(),
-                               flags);
+    const int elementCount = d->strokeHandler->types.size();
+    if (cache) {
+        cache->pen = pen;
+        cache->matrix = state()->matrix;
+        cache->deviceRect = d->exDeviceRect;
+        cache->cosmetic = cosmetic;
+        cache->flags = flags;
+        cache->pts = QVector<qreal>(elementCount * 2);
+        cache->types = QVector<QPainterPath::ElementType>(elementCount);
+        if (elementCount) {
+            memcpy(cache->pts.data(), d->strokeHandler->pts.data(), elementCount * 2 * sizeof(qreal));
+            memcpy(cache->types.data(), d->strokeHandler->types.data(),
+                   elementCount * sizeof(QPainterPath::ElementType));
+        }
+    }
 
-        QTransform xform = state()->matrix;
-        state()->matrix = QTransform();
-        transformChanged();
+    QVectorPath strokePath(d->strokeHandler->pts.data(),
+                           elementCount,
+                           d->strokeHandler->types.data(),
+                           flags);
+    fillStroke(strokePath, pen, cosmetic);
+}
 
-        QBrush brush = pen.brush();
-        if (qbrush_style(brush) != Qt::SolidPattern)
-            brush.setTransform(brush.transform() * xform);
+/*!
+    \internal
 
-        fill(strokePath, brush);
+    Fills the outline \a strokePath created by stroke() with the brush of
+    \a pen. The outline of a \a cosmetic pen is in device coordinates.
+*/
+void QPaintEngineEx::fillStroke(const QVectorPath &strokePath, const QPen &pen, bool cosmetic)
+{
+    if (!strokePath.elementCount()) // an empty path...
+        return;
 
-        state()->matrix = xform;
-        transformChanged();
+    if (!cosmetic) {
+        fill(strokePath, pen.brush());
+        return;
     }
+
+    QTransform xform = state()->matrix;
+    state()->matrix = QTransform();
+    transformChanged();
+
+    QBrush brush = pen.brush();
+    if (qbrush_style(brush) != Qt::SolidPattern)
+        brush.setTransform(brush.transform() * xform);
+
+    fill(strokePath, brush);
+
+    state()->matrix = xform;
+    transformChanged();
 }
 
 void QPaintEngineEx::draw(const QVectorPath &path)
@@ -157,6 +157,8 @@ public:
 
 protected:
     QPaintEngineEx(QPaintEngineExPrivate &data);
+
+    void fillStroke(const QVectorPath &strokePath, const QPen &pen, bool cosmetic);
 };
 
 class Q_GUI_EXPORT QPaintEngineExPrivate : public QPaintEnginePrivate
@@ -1427,6 +1427,13 @@ void QPainterPrivate::updateState(QPainterState *newState)
     by slightly less than half a pixel. Also will treat default constructed pens
     as cosmetic. Potentially useful when porting a Qt 4 application to Qt 5.
 
+    \value StrokeCaching Indicates that the engine should keep the result
+    of stroking a QPainterPath that is drawn repeatedly, and reuse it as long
+    as the path, the geometry of the pen and the transformation do not change.
+    This speeds up redrawing large, static paths at the cost of memory. The
+    raster engine caches antialiased strokes and the OpenGL engine caches the
+    triangulated strokes. This enum value has been added in Qt 5.11.
+
     \sa renderHints(), setRenderHint(), {QPainter#Rendering
     Quality}{Rendering Quality}, {Concentric Circles Example}
 
@@ -88,6 +88,21 @@ inline Qt::PenStyle qpen_style(const QPen &p) { return data_ptr(p)->style; }
 inline Qt::PenCapStyle qpen_capStyle(const QPen &p) { return data_ptr(p)->capStyle; }
 inline Qt::PenJoinStyle qpen_joinStyle(const QPen &p) { return data_ptr(p)->joinStyle; }
 
+// true if the two pens produce the same stroke outline, whatever their brushes
+inline bool qpen_geometry_equals(const QPen &a, const QPen &b)
+{
+    const QPenPrivate *pa = data_ptr(a);
+    const QPenPrivate *pb = data_ptr(b);
+    if (pa == pb)
+        return true;
+    if (pa->width != pb->width || pa->style != pb->style || pa->capStyle != pb->capStyle
+        || pa->joinStyle != pb->joinStyle || pa->miterLimit != pb->miterLimit
+        || pa->cosmetic != pb->cosmetic || pa->defaultWidth != pb->defaultWidth)
+        return false;
+    return pa->style == Qt::SolidLine || pa->style == Qt::NoPen
+        || (pa->dashOffset == pb->dashOffset && a.dashPattern() == b.dashPattern());
+}
+
 // QBrush inline functions...
 inline QBrush::DataPtr &data_ptr(const QBrush &p) { return const_cast<QBrush &>(p).data_ptr(); }
 inline bool qbrush_fast_equals(const QBrush &a, const QBrush &b) { return data_ptr(a) == data_ptr(b); }
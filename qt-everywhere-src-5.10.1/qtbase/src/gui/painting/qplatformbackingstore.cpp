@@ -51,6 +51,8 @@
 #ifndef QT_NO_OPENGL
 #include <QtGui/qopengltextureblitter.h>
 #include <QtGui/qoffscreensurface.h>
+#include <QtGui/private/qopenglcontext_p.h>
+#include <QtGui/private/qopengldamagehistory_p.h>
 #endif
 #include <qpa/qplatformgraphicsbuffer.h>
 #include <qpa/qplatformgraphicsbufferhelper.h>
@@ -118,6 +120,7 @@ public:
     mutable bool needsSwizzle;
     mutable bool premultiplied;
     QOpenGLTextureBlitter *blitter;
+    QOpenGLDamageHistory damageHistory;
 #endif
 };
 
@@ -343,8 +346,27 @@ void QPlatformBackingStore::composeAndFlush(QWindow *window, const QRegion &regi
 
     QWindowPrivate::get(window)->lastComposeTime.start();
 
+    const QRect deviceWindowRect = deviceRect(QRect(QPoint(), window->size()), window);
+    const QPoint deviceWindowOffset = deviceOffset(offset, window);
+
+    // With a known buffer age only what changed since the back buffer was
+    // last presented is recomposed and presented. Texture content is not
+    // tracked, so the widgets providing textures are always recomposed.
+    QRegion damage = deviceRegion(region, window, QPoint());
+    for (int i = 0; i < textures->count(); ++i)
+        damage |= deviceRect(textures->geometry(i).translated(-offset), window);
+    const int bufferAge = QOpenGLContextPrivate::get(d_ptr->context.data())->bufferAge(window);
+    const QRegion repaintRegion = d_ptr->damageHistory.repaintRegion(damage, bufferAge, deviceWindowRect);
+    const bool partialUpdate = repaintRegion != QRegion(deviceWindowRect);
+    d_ptr->damageHistory.addFrame(damage, deviceWindowRect);
+
     QOpenGLFunctions *funcs = d_ptr->context->functions();
     funcs->glViewport(0, 0, window->width() * window->devicePixelRatio(), window->height() * window->devicePixelRatio());
+    if (partialUpdate) {
+        const QRect scissor = QOpenGLDamageHistory::scissorRect(repaintRegion, deviceWindowRect.height());
+        funcs->glScissor(scissor.x(), scissor.y(), scissor.width(), scissor.height());
+        funcs->glEnable(GL_SCISSOR_TEST);
+    }
     funcs->glClearColor(0, 0, 0, translucentBackground ? 0 : 1);
     funcs->glClear(GL_COLOR_BUFFER_BIT);
 
@@ -355,9 +377,6 @@ void QPlatformBackingStore::composeAndFlush(QWindow *window, const QRegion &regi
 
     d_ptr->blitter->bind();
 
-    const QRect deviceWindowRect = deviceRect(QRect(QPoint(), window->size()), window);
-    const QPoint deviceWindowOffset = deviceOffset(offset, window);
-
     bool canUseSrgb = false;
     // If there are any sRGB textures in the list, check if the destination
     // framebuffer is sRGB capable.
@@ -449,7 +468,12 @@ void QPlatformBackingStore::composeAndFlush(QWindow *window, const QRegion &regi
     funcs->glDisable(GL_BLEND);
     d_ptr->blitter->release();
 
-    d_ptr->context->swapBuffers(window);
+    if (partialUpdate) {
+        funcs->glDisable(GL_SCISSOR_TEST);
+        QOpenGLContextPrivate::get(d_ptr->context.data())->swapBuffers(window, damage);
+    } else {
+        d_ptr->context->swapBuffers(window);
+    }
 }
 #endif
 /*!
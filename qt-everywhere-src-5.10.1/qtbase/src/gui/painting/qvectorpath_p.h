@@ -147,19 +147,27 @@ public:
         }
     }
 
+    enum CacheType {
+        FillCache,          // engine specific fill data
+        StrokeCache,        // stroke outline, see QPaintEngineEx::stroke()
+        StrokeVertexCache   // engine specific stroke data
+    };
+
     struct CacheEntry {
         QPaintEngineEx *engine;
         void *data;
         qvectorpath_cache_cleanup cleanup;
         CacheEntry *next;
+        CacheType type;
     };
 
-    CacheEntry *addCacheData(QPaintEngineEx *engine, void *data, qvectorpath_cache_cleanup cleanup) const;
-    inline CacheEntry *lookupCacheData(QPaintEngineEx *engine) const {
+    CacheEntry *addCacheData(QPaintEngineEx *engine, void *data, qvectorpath_cache_cleanup cleanup,
+                             CacheType type = FillCache) const;
+    inline CacheEntry *lookupCacheData(QPaintEngineEx *engine, CacheType type = FillCache) const {
         Q_ASSERT(m_hints & ShouldUseCacheHint);
         CacheEntry *e = m_cache;
         while (e) {
-            if (e->engine == engine)
+            if (e->engine == engine && e->type == type)
                 return e;
             e = e->next;
         }
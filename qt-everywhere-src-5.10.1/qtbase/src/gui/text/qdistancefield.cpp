@@ -925,6 +925,15 @@ QDistanceField::QDistanceField(const QPainterPath &path, glyph_t glyph, bool dou
 }
 
 
+// Takes a copy of the tightly packed data of a previously rendered field
+QDistanceField::QDistanceField(int width, int height, const uchar *data, glyph_t glyph)
+    : d(QDistanceFieldData::create(QSize(width, height)))
+{
+    if (d->data)
+        memcpy(d->data, data, d->nbytes);
+    d->glyph = glyph;
+}
+
 QDistanceField::QDistanceField(QDistanceFieldData *data)
     : d(data)
 {
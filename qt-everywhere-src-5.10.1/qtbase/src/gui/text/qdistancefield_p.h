@@ -94,6 +94,7 @@ public:
     QDistanceField(const QRawFont &font, glyph_t glyph, bool doubleResolution = false);
     QDistanceField(QFontEngine *fontEngine, glyph_t glyph, bool doubleResolution = false);
     QDistanceField(const QPainterPath &path, glyph_t glyph, bool doubleResolution = false);
+    QDistanceField(int width, int height, const uchar *data, glyph_t glyph);
     QDistanceField(const QDistanceField &other);
 
     bool isNull() const;
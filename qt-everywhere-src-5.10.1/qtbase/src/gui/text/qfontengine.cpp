@@ -244,8 +244,10 @@ Q_AUTOTEST_EXPORT QList<QFontEngine *> QFontEngine_stopCollectingEngines()
 
 #define kBearingNotInitialized std::numeric_limits<qreal>::max()
 
+static QBasicAtomicInteger<quint64> fontEngineSerialNumber = Q_BASIC_ATOMIC_INITIALIZER(0);
+
 QFontEngine::QFontEngine(Type type)
-    : m_type(type), ref(0),
+    : m_type(type), m_serialNumber(fontEngineSerialNumber.fetchAndAddRelaxed(1) + 1), ref(0),
       font_(),
       face_(),
       m_minLeftBearing(kBearingNotInitialized),
@@ -948,6 +950,18 @@ void QFontEngine::unlockAlphaMapForGlyph()
     currentlyLockedAlphaMap = QImage();
 }
 
+/*
+    Renders the \a numGlyphs glyphs in \a glyphs in the given \a format into
+    the engine's internal cache ahead of their use. Engines without internal
+    caching ignore this.
+*/
+void QFontEngine::prefetchGlyphs(const glyph_t *glyphs, int numGlyphs, GlyphFormat format)
+{
+    Q_UNUSED(glyphs);
+    Q_UNUSED(numGlyphs);
+    Q_UNUSED(format);
+}
+
 QImage QFontEngine::alphaMapForGlyph(glyph_t glyph)
 {
     glyph_metrics_t gm = boundingBox(glyph);
@@ -127,6 +127,8 @@ public:
     virtual ~QFontEngine();
 
     inline Type type() const { return m_type; }
+    // unique for the lifetime of the process, unlike the engine's address
+    inline quint64 serialNumber() const { return m_serialNumber; }
 
     // all of these are in unscaled metrics if the engine supports uncsaled metrics,
     // otherwise in design metrics
@@ -197,6 +199,7 @@ public:
                                            QPoint *offset = 0);
     virtual void unlockAlphaMapForGlyph();
     virtual bool hasInternalCaching() const { return false; }
+    virtual void prefetchGlyphs(const glyph_t *glyphs, int numGlyphs, GlyphFormat format);
 
     virtual glyph_metrics_t alphaMapBoundingBox(glyph_t glyph, QFixed /*subPixelPosition*/, const QTransform &matrix, GlyphFormat /*format*/)
     {
@@ -280,6 +283,7 @@ public:
 
 private:
     const Type m_type;
+    const quint64 m_serialNumber;
 
 public:
     QAtomicInt ref;
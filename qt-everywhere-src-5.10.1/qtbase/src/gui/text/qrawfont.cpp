@@ -288,6 +288,35 @@ QImage QRawFont::alphaMapForGlyph(quint32 glyphIndex, AntialiasingType antialias
     return d->fontEngine->alphaMapForGlyph(glyphIndex, QFixed(), transform);
 }
 
+/*!
+   \since 5.11
+
+   Renders the glyphs in \a glyphIndexes ahead of their use, so that later calls to
+   alphaMapForGlyph() with the same \a antialiasingType and without a transformation,
+   as well as drawing the glyphs at the current pixel size, do not need to rasterize them.
+
+   Font engines that cache their glyphs render glyphs missing from the cache on several
+   threads at once. This is useful before painting a large amount of text for the first
+   time, for instance in scripts with many different glyphs such as Chinese or Japanese.
+   The function returns when all glyphs have been rendered.
+
+   \sa alphaMapForGlyph()
+*/
+void QRawFont::prefetchGlyphs(const QVector<quint32> &glyphIndexes, AntialiasingType antialiasingType) const
+{
+    if (!d->isValid() || glyphIndexes.isEmpty())
+        return;
+
+    QFontEngine::GlyphFormat format;
+    if (d->fontEngine->glyphFormat == QFontEngine::Format_ARGB)
+        format = QFontEngine::Format_ARGB;
+    else if (antialiasingType == SubPixelAntialiasing)
+        format = QFontEngine::Format_A32;
+    else
+        format = QFontEngine::Format_A8;
+    d->fontEngine->prefetchGlyphs(glyphIndexes.constData(), glyphIndexes.size(), format);
+}
+
 /*!
    This function returns the shape of the glyph at a given \a glyphIndex in the underlying font
    if the QRawFont is valid. Otherwise, it returns an empty QPainterPath.
@@ -109,6 +109,8 @@ public:
     QImage alphaMapForGlyph(quint32 glyphIndex,
                             AntialiasingType antialiasingType = SubPixelAntialiasing,
                             const QTransform &transform = QTransform()) const;
+    void prefetchGlyphs(const QVector<quint32> &glyphIndexes,
+                        AntialiasingType antialiasingType = SubPixelAntialiasing) const;
     QPainterPath pathForGlyph(quint32 glyphIndex) const;
     QRectF boundingRect(quint32 glyphIndex) const;
 
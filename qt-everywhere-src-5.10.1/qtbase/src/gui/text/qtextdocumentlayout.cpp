@@ -461,6 +461,13 @@ public:
     mutable QBasicTimer sizeChangedTimer;
     uint showLayoutProgress : 1;
     uint insideDocumentChange : 1;
+    uint incrementalLayoutEnabled : 1;
+    uint relayoutingChange : 1;
+
+    // while the blocks after an edit are only being moved by the lazy layout,
+    // the end of the root frame's flow is already known (positionInFrame != -1)
+    mutable QCheckPoint estimatedFlowEnd;
+    int changeLengthDelta;
 
     int lastPageCount;
     qreal idealWidth;
@@ -540,6 +547,10 @@ QTextDocumentLayoutPrivate::QTextDocumentLayoutPrivate()
 {
     showLayoutProgress = true;
     insideDocumentChange = false;
+    incrementalLayoutEnabled = true;
+    relayoutingChange = false;
+    estimatedFlowEnd.positionInFrame = -1;
+    changeLengthDelta = 0;
     idealWidth = 0;
     contentHasAlignment = false;
 }
@@ -2247,10 +2258,30 @@ void QTextDocumentLayoutPrivate::layoutFlow(QTextFrame::Iterator it, QTextLayout
 
     QTextFrame::Iterator previousIt;
 
+    // the checkpoints after the edited blocks and the end of the flow before the edit
+    QVector<QCheckPoint> oldCheckPoints;
+    QCheckPoint oldFlowEnd;
+    oldFlowEnd.positionInFrame = -1;
+
     const bool inRootFrame = (it.parentFrame() == document->rootFrame());
     if (inRootFrame) {
         bool redoCheckPoints = layoutStruct->fullLayout || checkPoints.isEmpty();
 
+        if (relayoutingChange) {
+            if (currentLazyLayoutPosition == -1 && !checkPoints.isEmpty())
+                oldFlowEnd = checkPoints.constLast();
+            else
+                oldFlowEnd = estimatedFlowEnd;
+            estimatedFlowEnd.positionInFrame = -1;
+
+            // page breaks and floats make the position of the following blocks
+            // depend on more than the height of the edited ones
+            if (!incrementalLayoutEnabled || redoCheckPoints || layoutStruct->pageHeight != QFIXED_MAX
+                || !fd->floats.isEmpty()) {
+                oldFlowEnd.positionInFrame = -1;
+            }
+        }
+
         if (!redoCheckPoints) {
             QVector<QCheckPoint>::Iterator checkPoint = std::lower_bound(checkPoints.begin(), checkPoints.end(), layoutFrom);
             if (checkPoint != checkPoints.end()) {
@@ -2269,6 +2300,8 @@ void QTextDocumentLayoutPrivate::layoutFlow(QTextFrame::Iterator it, QTextLayout
                 }
 
                 it = frameIteratorForTextPosition(checkPoint->positionInFrame);
+                if (oldFlowEnd.positionInFrame != -1)
+                    oldCheckPoints = checkPoints.mid(checkPoint - checkPoints.begin() + 1);
                 checkPoints.resize(checkPoint - checkPoints.begin() + 1);
 
                 if (checkPoint != checkPoints.begin()) {
@@ -2296,6 +2329,8 @@ void QTextDocumentLayoutPrivate::layoutFlow(QTextFrame::Iterator it, QTextLayout
     QTextBlockFormat previousBlockFormat = previousIt.currentBlock().blockFormat();
 
     QFixed maximumBlockWidth = 0;
+    int oldCheckPointIndex = 0;
+    int previousDocPos = -1;
     while (!it.atEnd()) {
         QTextFrame *c = it.currentFrame();
 
@@ -2305,6 +2340,39 @@ void QTextDocumentLayoutPrivate::layoutFlow(QTextFrame::Iterator it, QTextLayout
         else
             docPos = it.currentBlock().position();
 
+        // Once neither this element nor the previous one was touched by the edit,
+        // everything from here on only moves by the height difference of the
+        // edited blocks. That difference is known as soon as we reach a position
+        // that had a checkpoint before, so leave moving the remaining blocks to
+        // the lazy layout and take the end of the flow from the old layout.
+        if (oldFlowEnd.positionInFrame != -1 && previousDocPos > layoutTo) {
+            while (oldCheckPointIndex < oldCheckPoints.size()
+                   && oldCheckPoints.at(oldCheckPointIndex).positionInFrame + changeLengthDelta < docPos) {
+                ++oldCheckPointIndex;
+            }
+            if (oldCheckPointIndex < oldCheckPoints.size()
+                && oldCheckPoints.at(oldCheckPointIndex).positionInFrame + changeLengthDelta == docPos) {
+                const QFixed delta = layoutStruct->y - oldCheckPoints.at(oldCheckPointIndex).y;
+
+                if (checkPoints.constLast().positionInFrame != docPos) {
+                    QCheckPoint p;
+                    p.y = layoutStruct->y;
+                    p.frameY = layoutStruct->frameY;
+                    p.positionInFrame = docPos;
+                    p.minimumWidth = layoutStruct->minimumWidth;
+                    p.maximumWidth = layoutStruct->maximumWidth;
+                    p.contentsWidth = layoutStruct->contentsWidth;
+                    checkPoints.append(p);
+                }
+
+                estimatedFlowEnd = oldFlowEnd;
+                estimatedFlowEnd.y += delta;
+                estimatedFlowEnd.positionInFrame = docPrivate->length();
+                break;
+            }
+        }
+        previousDocPos = docPos;
+
         if (inRootFrame) {
             if (qAbs(layoutStruct->y - checkPoints.constLast().y) > 2000) {
                 QFixed left, right;
@@ -2555,10 +2623,20 @@ void QTextDocumentLayoutPrivate::layoutFlow(QTextFrame::Iterator it, QTextLayout
             cp.contentsWidth = layoutStruct->contentsWidth;
             checkPoints.append(cp);
             checkPoints.reserve(checkPoints.size());
+            estimatedFlowEnd.positionInFrame = -1;
         } else {
             currentLazyLayoutPosition = checkPoints.constLast().positionInFrame;
             // #######
             //checkPoints.last().positionInFrame = q->document()->docHandle()->length();
+
+            // only the widths can still change when the remaining blocks are moved
+            if (estimatedFlowEnd.positionInFrame != -1) {
+                layoutStruct->y = estimatedFlowEnd.y;
+                layoutStruct->minimumWidth = qMax(layoutStruct->minimumWidth, estimatedFlowEnd.minimumWidth);
+                if (estimatedFlowEnd.maximumWidth != QFIXED_MAX)
+                    layoutStruct->maximumWidth = qMax(layoutStruct->maximumWidth, estimatedFlowEnd.maximumWidth);
+                layoutStruct->contentsWidth = qMax(layoutStruct->contentsWidth, estimatedFlowEnd.contentsWidth);
+            }
         }
     }
 
@@ -2958,10 +3036,14 @@ void QTextDocumentLayout::documentChanged(int from, int oldLength, int length)
         d->contentHasAlignment = false;
         d->currentLazyLayoutPosition = 0;
         d->checkPoints.clear();
+        d->estimatedFlowEnd.positionInFrame = -1;
         d->layoutStep();
     } else {
         d->ensureLayoutedByPosition(from);
+        d->relayoutingChange = true;
+        d->changeLengthDelta = length - oldLength;
         updateRect = doLayout(from, oldLength, length);
+        d->relayoutingChange = false;
     }
 
     if (!d->layoutTimer.isActive() && d->currentLazyLayoutPosition != -1)
@@ -2969,7 +3051,7 @@ void QTextDocumentLayout::documentChanged(int from, int oldLength, int length)
 
     d->insideDocumentChange = false;
 
-    if (d->showLayoutProgress) {
+    if (d->showLayoutProgress || d->estimatedFlowEnd.positionInFrame != -1) {
         const QSizeF newSize = dynamicDocumentSize();
         if (newSize != d->lastReportedSize) {
             d->lastReportedSize = newSize;
@@ -3170,7 +3252,9 @@ void QTextDocumentLayoutPrivate::ensureLayoutedByPosition(int position) const
         return;
     while (currentLazyLayoutPosition != -1
            && currentLazyLayoutPosition < position) {
-        const_cast<QTextDocumentLayout *>(q_func())->doLayout(currentLazyLayoutPosition, 0, INT_MAX - currentLazyLayoutPosition);
+        // blocks that are only waiting to be moved don't need to be laid out again
+        const int length = estimatedFlowEnd.positionInFrame != -1 ? 0 : INT_MAX - currentLazyLayoutPosition;
+        const_cast<QTextDocumentLayout *>(q_func())->doLayout(currentLazyLayoutPosition, 0, length);
     }
 }
 
@@ -3198,6 +3282,28 @@ void QTextDocumentLayout::setFixedColumnWidth(int width)
     d->fixedColumnWidth = width;
 }
 
+/*!
+    \internal
+
+    When \a enable is true, which is the default, an edit only lays out the
+    changed blocks synchronously. The blocks after them are moved by the lazy
+    layout in the event loop or when a part of the document that depends on
+    them is accessed, while documentSize() and dynamicDocumentSize() already
+    report the final height. When false, all following blocks are moved
+    before documentChanged() returns.
+*/
+void QTextDocumentLayout::setIncrementalLayoutEnabled(bool enable)
+{
+    Q_D(QTextDocumentLayout);
+    d->incrementalLayoutEnabled = enable;
+}
+
+bool QTextDocumentLayout::isIncrementalLayoutEnabled() const
+{
+    Q_D(const QTextDocumentLayout);
+    return d->incrementalLayoutEnabled;
+}
+
 QRectF QTextDocumentLayout::tableCellBoundingRect(QTextTable *table, const QTextTableCell &cell) const
 {
     if (!cell.isValid())
@@ -3300,7 +3406,8 @@ int QTextDocumentLayout::layoutStatus() const
 {
     Q_D(const QTextDocumentLayout);
     int pos = d->currentLazyLayoutPosition;
-    if (pos == -1)
+    // the size is final if only moving blocks is left to do
+    if (pos == -1 || d->estimatedFlowEnd.positionInFrame != -1)
         return 100;
     return pos * 100 / d->document->docHandle()->length();
 }
@@ -85,6 +85,10 @@ public:
     // internal, to support the ugly FixedColumnWidth wordwrap mode in QTextEdit
     void setFixedColumnWidth(int width);
 
+    // internal, moves the blocks after an edit in the event loop
+    void setIncrementalLayoutEnabled(bool enable);
+    bool isIncrementalLayoutEnabled() const;
+
     // internal for QTextEdit's NoWrap mode
     void setViewport(const QRectF &viewport);
 
@@ -55,6 +55,8 @@
 #include "qrawfont_p.h"
 #include <qguiapplication.h>
 #include <qinputmethod.h>
+#include <qcache.h>
+#include <qmutex.h>
 #include <algorithm>
 #include <stdlib.h>
 
@@ -960,6 +962,129 @@ void QTextEngine::shapeLine(const QScriptLine &line)
 extern bool qt_useHarfbuzzNG(); // defined in qfontengine.cpp
 #endif
 
+namespace {
+
+struct ShapedRunKey
+{
+    QString text;
+    quint64 fontEngine;
+    uint script;
+    uint flags;
+};
+
+inline bool operator==(const ShapedRunKey &lhs, const ShapedRunKey &rhs)
+{
+    return lhs.fontEngine == rhs.fontEngine && lhs.script == rhs.script
+            && lhs.flags == rhs.flags && lhs.text == rhs.text;
+}
+
+inline uint qHash(const ShapedRunKey &key, uint seed = 0) Q_DECL_NOTHROW
+{
+    QtPrivate::QHashCombine hash;
+    seed = hash(seed, key.text);
+    seed = hash(seed, key.fontEngine);
+    seed = hash(seed, key.script);
+    return hash(seed, key.flags);
+}
+
+// the result of shaping one item, before letter and word spacing are applied
+struct ShapedRun
+{
+    QByteArray glyphData;
+    QVector<ushort> logClusters;
+    int numGlyphs;
+    QFixed ascent;
+    QFixed descent;
+    QFixed leading;
+};
+
+enum {
+    MaxShapedRunLength = 1024,
+    DefaultShapedRunCacheSize = 1024 * 1024
+};
+
+struct ShapedRunCache
+{
+    ShapedRunCache()
+        : runs(DefaultShapedRunCacheSize)
+    {
+        bool ok;
+        const int kilobytes = qEnvironmentVariableIntValue("QT_SHAPED_RUN_CACHE_SIZE", &ok);
+        if (ok && kilobytes >= 0)
+            runs.setMaxCost(kilobytes * 1024);
+    }
+
+    QMutex mutex;
+    QCache<ShapedRunKey, ShapedRun> runs;
+    quint64 hits = 0;
+    quint64 misses = 0;
+};
+
+} // unnamed namespace
+
+Q_GLOBAL_STATIC(ShapedRunCache, shapedRunCache)
+
+static inline void copyGlyphData(const QGlyphLayout &destination, const QGlyphLayout &source, int num)
+{
+    memcpy(static_cast<void *>(destination.offsets), source.offsets, num * sizeof(QFixedPoint));
+    memcpy(destination.glyphs, source.glyphs, num * sizeof(glyph_t));
+    memcpy(static_cast<void *>(destination.advances), source.advances, num * sizeof(QFixed));
+    memcpy(static_cast<void *>(destination.justifications), source.justifications, num * sizeof(QGlyphJustification));
+    memcpy(destination.attributes, source.attributes, num * sizeof(QGlyphAttributes));
+}
+
+/*!
+    \internal
+
+    Returns the hit and miss counts and the memory used by the shaped run cache.
+*/
+QTextEngine::ShapedRunCacheStatistics QTextEngine::shapedRunCacheStatistics()
+{
+    ShapedRunCacheStatistics statistics;
+    ShapedRunCache *cache = shapedRunCache();
+    if (!cache)
+        return statistics;
+
+    QMutexLocker locker(&cache->mutex);
+    statistics.hits = cache->hits;
+    statistics.misses = cache->misses;
+    statistics.runs = cache->runs.count();
+    statistics.memoryUsage = cache->runs.totalCost();
+    statistics.maximumMemoryUsage = cache->runs.maxCost();
+    return statistics;
+}
+
+/*!
+    \internal
+
+    Limits the memory used by the shaped run cache to \a bytes, evicting the
+    least recently used runs if needed. A size of 0 disables the cache. The
+    default of 1 MB can be changed with the QT_SHAPED_RUN_CACHE_SIZE
+    environment variable, given in kilobytes.
+*/
+void QTextEngine::setShapedRunCacheSize(qint64 bytes)
+{
+    if (ShapedRunCache *cache = shapedRunCache()) {
+        QMutexLocker locker(&cache->mutex);
+        cache->runs.setMaxCost(int(qBound<qint64>(0, bytes, INT_MAX)));
+    }
+}
+
+/*!
+    \internal
+
+    Removes all runs from the shaped run cache and resets its statistics.
+*/
+void QTextEngine::clearShapedRunCache()
+{
+    if (ShapedRunCache *cache = shapedRunCache()) {
+        QMutexLocker locker(&cache->mutex);
+        cache->runs.clear();
+        cache->hits = 0;
+        cache->misses = 0;
+    }
+}
+
 void QTextEngine::shapeText(int item) const
 {
     Q_ASSERT(item < layoutData->items.size());
@@ -1033,78 +1158,139 @@ void QTextEngine::shapeText(int item) const
             letterSpacing *= font.d->dpi / qt_defaultDpiY();
     }
 
-    // split up the item into parts that come from different font engines
-    // k * 3 entries, array[k] == index in string, array[k + 1] == index in glyphs, array[k + 2] == engine index
-    QVector<uint> itemBoundaries;
-    itemBoundaries.reserve(24);
-
-    QGlyphLayout initialGlyphs = availableGlyphs(&si);
-    int nGlyphs = initialGlyphs.numGlyphs;
-    if (fontEngine->type() == QFontEngine::Multi || !shapingEnabled) {
-        // ask the font engine to find out which glyphs (as an index in the specific font)
-        // to use for the text in one item.
-        QFontEngine::ShaperFlags shaperFlags =
-                shapingEnabled
-                    ? QFontEngine::GlyphIndicesOnly
-                    : QFontEngine::ShaperFlag(0);
-        if (!fontEngine->stringToCMap(reinterpret_cast<const QChar *>(string), itemLength, &initialGlyphs, &nGlyphs, shaperFlags))
-            Q_UNREACHABLE();
-    }
-
-    if (fontEngine->type() == QFontEngine::Multi) {
-        uint lastEngine = ~0u;
-        for (int i = 0, glyph_pos = 0; i < itemLength; ++i, ++glyph_pos) {
-            const uint engineIdx = initialGlyphs.glyphs[glyph_pos] >> 24;
-            if (lastEngine != engineIdx) {
-                itemBoundaries.append(i);
-                itemBoundaries.append(glyph_pos);
-                itemBoundaries.append(engineIdx);
-
-                if (engineIdx != 0) {
-                    QFontEngine *actualFontEngine = static_cast<QFontEngineMulti *>(fontEngine)->engine(engineIdx);
-                    si.ascent = qMax(actualFontEngine->ascent(), si.ascent);
-                    si.descent = qMax(actualFontEngine->descent(), si.descent);
-                    si.leading = qMax(actualFontEngine->leading(), si.leading);
-                }
+#if QT_CONFIG(harfbuzz)
+    const bool useHarfbuzzNG = qt_useHarfbuzzNG();
+#else
+    const bool useHarfbuzzNG = false;
+#endif
 
-                lastEngine = engineIdx;
+    // items are shaped independently of their context, so the result only
+    // depends on the text, the font engine and the shaping options
+    ShapedRunCache *cache = shapingEnabled && itemLength <= MaxShapedRunLength ? shapedRunCache() : nullptr;
+    ShapedRunKey cacheKey;
+    if (cache) {
+        cacheKey.text = QString::fromRawData(reinterpret_cast<const QChar *>(string), itemLength);
+        cacheKey.fontEngine = fontEngine->serialNumber();
+        cacheKey.script = si.analysis.script;
+        cacheKey.flags = uint(si.analysis.flags)
+                | uint(si.analysis.bidiLevel) << 8
+                | uint(kerningEnabled) << 16
+                | uint(letterSpacing != 0) << 17
+                | uint(option.useDesignMetrics()) << 18
+                | uint(useHarfbuzzNG) << 19;
+
+        QMutexLocker locker(&cache->mutex);
+        if (const ShapedRun *run = cache->runs.object(cacheKey)) {
+            if (Q_LIKELY(ensureSpace(run->numGlyphs))) {
+                ++cache->hits;
+                QGlyphLayout cachedGlyphs(const_cast<char *>(run->glyphData.constData()), run->numGlyphs);
+                copyGlyphData(availableGlyphs(&si), cachedGlyphs, run->numGlyphs);
+                memcpy(logClusters(&si), run->logClusters.constData(), itemLength * sizeof(ushort));
+                si.ascent = run->ascent;
+                si.descent = run->descent;
+                si.leading = run->leading;
+                si.num_glyphs = run->numGlyphs;
             }
+        } else {
+            ++cache->misses;
+        }
+    }
+
+    if (!si.num_glyphs) {
+        // split up the item into parts that come from different font engines
+        // k * 3 entries, array[k] == index in string, array[k + 1] == index in glyphs, array[k + 2] == engine index
+        QVector<uint> itemBoundaries;
+        itemBoundaries.reserve(24);
 
-            if (QChar::isHighSurrogate(string[i]) && i + 1 < itemLength && QChar::isLowSurrogate(string[i + 1]))
-                ++i;
+        QGlyphLayout initialGlyphs = availableGlyphs(&si);
+        int nGlyphs = initialGlyphs.numGlyphs;
+        if (fontEngine->type() == QFontEngine::Multi || !shapingEnabled) {
+            // ask the font engine to find out which glyphs (as an index in the specific font)
+            // to use for the text in one item.
+            QFontEngine::ShaperFlags shaperFlags =
+                    shapingEnabled
+                        ? QFontEngine::GlyphIndicesOnly
+                        : QFontEngine::ShaperFlag(0);
+            if (!fontEngine->stringToCMap(reinterpret_cast<const QChar *>(string), itemLength, &initialGlyphs, &nGlyphs, shaperFlags))
+                Q_UNREACHABLE();
         }
-    } else {
-        itemBoundaries.append(0);
-        itemBoundaries.append(0);
-        itemBoundaries.append(0);
-    }
-
-    if (Q_UNLIKELY(!shapingEnabled)) {
-        ushort *log_clusters = logClusters(&si);
-
-        int glyph_pos = 0;
-        for (int i = 0; i < itemLength; ++i, ++glyph_pos) {
-            log_clusters[i] = glyph_pos;
-            initialGlyphs.attributes[glyph_pos].clusterStart = true;
-            if (QChar::isHighSurrogate(string[i])
-                    && i + 1 < itemLength
-                    && QChar::isLowSurrogate(string[i + 1])) {
-                ++i;
-                log_clusters[i] = glyph_pos;
+
+        if (fontEngine->type() == QFontEngine::Multi) {
+            uint lastEngine = ~0u;
+            for (int i = 0, glyph_pos = 0; i < itemLength; ++i, ++glyph_pos) {
+                const uint engineIdx = initialGlyphs.glyphs[glyph_pos] >> 24;
+                if (lastEngine != engineIdx) {
+                    itemBoundaries.append(i);
+                    itemBoundaries.append(glyph_pos);
+                    itemBoundaries.append(engineIdx);
+
+                    if (engineIdx != 0) {
+                        QFontEngine *actualFontEngine = static_cast<QFontEngineMulti *>(fontEngine)->engine(engineIdx);
+                        si.ascent = qMax(actualFontEngine->ascent(), si.ascent);
+                        si.descent = qMax(actualFontEngine->descent(), si.descent);
+                        si.leading = qMax(actualFontEngine->leading(), si.leading);
+                    }
+
+                    lastEngine = engineIdx;
+                }
+
+                if (QChar::isHighSurrogate(string[i]) && i + 1 < itemLength && QChar::isLowSurrogate(string[i + 1]))
+                    ++i;
             }
+        } else {
+            itemBoundaries.append(0);
+            itemBoundaries.append(0);
+            itemBoundaries.append(0);
         }
 
-        si.num_glyphs = glyph_pos;
+        if (Q_UNLIKELY(!shapingEnabled)) {
+            ushort *log_clusters = logClusters(&si);
+
+            int glyph_pos = 0;
+            for (int i = 0; i < itemLength; ++i, ++glyph_pos) {
+                log_clusters[i] = glyph_pos;
+                initialGlyphs.attributes[glyph_pos].clusterStart = true;
+                if (QChar::isHighSurrogate(string[i])
+                        && i + 1 < itemLength
+                        && QChar::isLowSurrogate(string[i + 1])) {
+                    ++i;
+                    log_clusters[i] = glyph_pos;
+                }
+            }
+
+            si.num_glyphs = glyph_pos;
 #if QT_CONFIG(harfbuzz)
-    } else if (Q_LIKELY(qt_useHarfbuzzNG())) {
-        si.num_glyphs = shapeTextWithHarfbuzzNG(si, string, itemLength, fontEngine, itemBoundaries, kerningEnabled, letterSpacing != 0);
+        } else if (Q_LIKELY(qt_useHarfbuzzNG())) {
+            si.num_glyphs = shapeTextWithHarfbuzzNG(si, string, itemLength, fontEngine, itemBoundaries, kerningEnabled, letterSpacing != 0);
 #endif
-    } else {
-        si.num_glyphs = shapeTextWithHarfbuzz(si, string, itemLength, fontEngine, itemBoundaries, kerningEnabled);
-    }
-    if (Q_UNLIKELY(si.num_glyphs == 0)) {
-        Q_UNREACHABLE(); // ### report shaping errors somehow
-        return;
+        } else {
+            si.num_glyphs = shapeTextWithHarfbuzz(si, string, itemLength, fontEngine, itemBoundaries, kerningEnabled);
+        }
+        if (Q_UNLIKELY(si.num_glyphs == 0)) {
+            Q_UNREACHABLE(); // ### report shaping errors somehow
+            return;
+        }
+
+        if (cache) {
+            ShapedRun *run = new ShapedRun;
+            run->numGlyphs = si.num_glyphs;
+            run->glyphData.resize(si.num_glyphs * QGlyphLayout::SpaceNeeded);
+            copyGlyphData(QGlyphLayout(run->glyphData.data(), si.num_glyphs), availableGlyphs(&si), si.num_glyphs);
+            run->logClusters.resize(itemLength);
+            memcpy(run->logClusters.data(), logClusters(&si), itemLength * sizeof(ushort));
+            run->ascent = si.ascent;
+            run->descent = si.descent;
+            run->leading = si.leading;
+
+            // the key must not keep referring to the layout's string
+            cacheKey.text = QString(reinterpret_cast<const QChar *>(string), itemLength);
+            const int cost = int(sizeof(ShapedRunKey) + sizeof(ShapedRun))
+                    + itemLength * int(sizeof(QChar) + sizeof(ushort))
+                    + run->glyphData.size();
+
+            QMutexLocker locker(&cache->mutex);
+            cache->runs.insert(cacheKey, run, cost);
+        }
     }
 
 
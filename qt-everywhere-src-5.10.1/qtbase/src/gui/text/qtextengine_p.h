@@ -452,6 +452,21 @@ public:
 
     void shape(int item) const;
 
+    // process-wide LRU cache of shaped text items, shared by all engines
+    struct ShapedRunCacheStatistics {
+        quint64 hits = 0;
+        quint64 misses = 0;
+        int runs = 0;
+        qint64 memoryUsage = 0;
+        qint64 maximumMemoryUsage = 0;
+
+        qreal hitRate() const
+        { return hits + misses ? qreal(hits) / qreal(hits + misses) : qreal(0); }
+    };
+    static ShapedRunCacheStatistics shapedRunCacheStatistics();
+    static void setShapedRunCacheSize(qint64 bytes);
+    static void clearShapedRunCache();
+
     void justify(const QScriptLine &si);
     QFixed alignLine(const QScriptLine &line);
 
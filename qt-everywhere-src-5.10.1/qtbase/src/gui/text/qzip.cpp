@@ -47,6 +47,7 @@
 #include <qendian.h>
 #include <qdebug.h>
 #include <qdir.h>
+#include <private/qcompressiondevice_p.h>
 
 #include <zlib.h>
 
@@ -126,71 +127,6 @@ static void writeMSDosDate(uchar *dest, const QDateTime& dt)
     }
 }
 
-static int inflate(Bytef *dest, ulong *destLen, const Bytef *source, ulong sourceLen)
-{
-    z_stream stream;
-    int err;
-
-    stream.next_in = const_cast<Bytef*>(source);
-    stream.avail_in = (uInt)sourceLen;
-    if ((uLong)stream.avail_in != sourceLen)
-        return Z_BUF_ERROR;
-
-    stream.next_out = dest;
-    stream.avail_out = (uInt)*destLen;
-    if ((uLong)stream.avail_out != *destLen)
-        return Z_BUF_ERROR;
-
-    stream.zalloc = (alloc_func)0;
-    stream.zfree = (free_func)0;
-
-    err = inflateInit2(&stream, -MAX_WBITS);
-    if (err != Z_OK)
-        return err;
-
-    err = inflate(&stream, Z_FINISH);
-    if (err != Z_STREAM_END) {
-        inflateEnd(&stream);
-        if (err == Z_NEED_DICT || (err == Z_BUF_ERROR && stream.avail_in == 0))
-            return Z_DATA_ERROR;
-        return err;
-    }
-    *destLen = stream.total_out;
-
-    err = inflateEnd(&stream);
-    return err;
-}
-
-static int deflate (Bytef *dest, ulong *destLen, const Bytef *source, ulong sourceLen)
-{
-    z_stream stream;
-    int err;
-
-    stream.next_in = const_cast<Bytef*>(source);
-    stream.avail_in = (uInt)sourceLen;
-    stream.next_out = dest;
-    stream.avail_out = (uInt)*destLen;
-    if ((uLong)stream.avail_out != *destLen) return Z_BUF_ERROR;
-
-    stream.zalloc = (alloc_func)0;
-    stream.zfree = (free_func)0;
-    stream.opaque = (voidpf)0;
-
-    err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
-    if (err != Z_OK) return err;
-
-    err = deflate(&stream, Z_FINISH);
-    if (err != Z_STREAM_END) {
-        deflateEnd(&stream);
-        return err == Z_OK ? Z_BUF_ERROR : err;
-    }
-    *destLen = stream.total_out;
-
-    err = deflateEnd(&stream);
-    return err;
-}
-
-
 namespace WindowsFileAttributes {
 enum {
     Dir        = 0x10, // FILE_ATTRIBUTE_DIRECTORY
@@ -682,27 +618,13 @@ void QZipWriterPrivate::addEntry(EntryType type, const QString &fileName, const
     if (compression == QZipWriter::AlwaysCompress) {
         writeUShort(header.h.compression_method, CompressionMethodDeflated);
 
-       ulong len = contents.length();
-        // shamelessly copied form zlib
-        len += (len >> 12) + (len >> 14) + 11;
-        int res;
-        do {
-            data.resize(len);
-            res = deflate((uchar*)data.data(), &len, (const uchar*)contents.constData(), contents.length());
-
-            switch (res) {
-            case Z_OK:
-                data.resize(len);
-                break;
-            case Z_MEM_ERROR:
-                qWarning("QZip: Z_MEM_ERROR: Not enough memory to compress file, skipping");
-                data.resize(0);
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
+        QZlibStream deflater;
+        data.clear();
+        if (!deflater.init(QZlibStream::Compress, QCompressionDevice::RawDeflate)
+                || !deflater.process(contents.constData(), contents.length(), &data, QZlibStream::Finish)) {
+            qWarning("QZip: Could not compress file, skipping: %s", qPrintable(deflater.errorString()));
+            data.clear();
+        }
     }
 // TODO add a check if data.length() > contents.length().  Then try to store the original and revert the compression method to be uncompressed
     writeUInt(header.h.compressed_size, data.length());
@@ -984,29 +906,17 @@ QByteArray QZipReader::fileData(const QString &fileName) const
         //qDebug("compressed=%d", compressed.size());
         compressed.truncate(compressed_size);
         QByteArray baunzip;
-        ulong len = qMax(uncompressed_size,  1);
-        int res;
-        do {
-            baunzip.resize(len);
-            res = inflate((uchar*)baunzip.data(), &len,
-                          (const uchar*)compressed.constData(), compressed_size);
-
-            switch (res) {
-            case Z_OK:
-                if ((int)len != baunzip.size())
-                    baunzip.resize(len);
-                break;
-            case Z_MEM_ERROR:
-                qWarning("QZip: Z_MEM_ERROR: Not enough memory");
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            case Z_DATA_ERROR:
-                qWarning("QZip: Z_DATA_ERROR: Input data is corrupted");
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
+        baunzip.reserve(qMax(uncompressed_size, 1));
+        QZlibStream inflater;
+        if (!inflater.init(QZlibStream::Decompress, QCompressionDevice::RawDeflate)
+                || !inflater.process(compressed.constData(), compressed.size(), &baunzip, QZlibStream::Finish)) {
+            qWarning("QZip: Could not uncompress data: %s", qPrintable(inflater.errorString()));
+            return QByteArray();
+        }
+        if (!inflater.isFinished()) {
+            qWarning("QZip: Input data is truncated");
+            return QByteArray();
+        }
         return baunzip;
     }
 
@@ -38,6 +38,8 @@ HEADERS += \
     access/qhttp2protocolhandler_p.h \
     access/qhsts_p.h \
     access/qhstspolicy.h \
+    access/qhttp2configuration.h \
+    access/qhttpconnectionpoolconfiguration.h \
     access/qhstsstore_p.h
 
 SOURCES += \
@@ -71,6 +73,8 @@ SOURCES += \
     access/qhttp2protocolhandler.cpp \
     access/qhsts.cpp \
     access/qhstspolicy.cpp \
+    access/qhttp2configuration.cpp \
+    access/qhttpconnectionpoolconfiguration.cpp \
     access/qhstsstore.cpp
 
 qtConfig(ftp) {
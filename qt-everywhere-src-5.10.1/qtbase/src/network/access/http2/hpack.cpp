@@ -38,11 +38,13 @@
 ****************************************************************************/
 
 #include "bitstreams_p.h"
+#include "huffman_p.h"
 #include "hpack_p.h"
 
 #include <QtCore/qbytearray.h>
 #include <QtCore/qdebug.h>
 
+#include <algorithm>
 #include <limits>
 
 QT_BEGIN_NAMESPACE
@@ -145,11 +147,38 @@ bool is_request_pseudo_header(const QByteArray &name)
            name == ":authority" || name == ":path";
 }
 
+// Huffman coding makes some strings (random tokens, for example) longer,
+// send those as they are.
+bool use_huffman(const QByteArray &string, bool compress)
+{
+    return compress && string.size()
+           && huffman_encoded_bit_length(string) < quint64(string.size()) * 8;
+}
+
+// Values of these fields are usually different in each request, if we
+// indexed them, they would only push out the ones that do repeat.
+bool is_rarely_repeated(const QByteArray &name)
+{
+    return name == ":path" || name == "content-length"
+           || name == "if-modified-since" || name == "if-none-match";
+}
+
+void write_size_update(BitOStream &outputStream, quint32 size)
+{
+    write_bit_pattern(SizeUpdate, outputStream);
+    outputStream.write(size);
+}
+
 } // unnamed namespace
 
 Encoder::Encoder(quint32 size, bool compress)
     : lookupTable(size, true /*encoder needs search index*/),
-      compressStrings(compress)
+      compressStrings(compress),
+      indexingEnabled(true),
+      peerMaxTableSize(size),
+      tableSizeLimit(std::numeric_limits<quint32>::max()),
+      sizeUpdatePending(false),
+      smallestPendingSize(size)
 {
 }
 
@@ -165,6 +194,8 @@ bool Encoder::encodeRequest(BitOStream &outputStream, const HttpHeader &header)
         return false;
     }
 
+    encodePendingSizeUpdates(outputStream);
+
     if (!encodeRequestPseudoHeaders(outputStream, header))
         return false;
 
@@ -172,8 +203,12 @@ bool Encoder::encodeRequest(BitOStream &outputStream, const HttpHeader &header)
         if (is_request_pseudo_header(field.name))
             continue;
 
-        if (!encodeHeaderField(outputStream, field))
+        if (field.name == "cookie") {
+            if (!encodeCookieCrumbs(outputStream, field))
+                return false;
+        } else if (!encodeHeaderField(outputStream, field)) {
             return false;
+        }
     }
 
     return true;
@@ -186,6 +221,8 @@ bool Encoder::encodeResponse(BitOStream &outputStream, const HttpHeader &header)
         return false;
     }
 
+    encodePendingSizeUpdates(outputStream);
+
     if (!encodeResponsePseudoHeaders(outputStream, header))
         return false;
 
@@ -207,17 +244,113 @@ bool Encoder::encodeSizeUpdate(BitOStream &outputStream, quint32 newSize)
         return false;
     }
 
-    write_bit_pattern(SizeUpdate, outputStream);
-    outputStream.write(newSize);
+    write_size_update(outputStream, newSize);
 
     return true;
 }
 
 void Encoder::setMaxDynamicTableSize(quint32 size)
 {
-    // Up to a caller (HTTP2 protocol handler)
-    // to validate this size first.
-    lookupTable.setMaxDynamicTableSize(size);
+    // Whatever our peer allows, we still respect our own limit,
+    // so there is nothing to validate here.
+    peerMaxTableSize = size;
+    updateTableCapacity();
+}
+
+void Encoder::setDynamicTableSizeLimit(quint32 limit)
+{
+    tableSizeLimit = limit;
+    updateTableCapacity();
+}
+
+void Encoder::setCompressStrings(bool compress)
+{
+    compressStrings = compress;
+}
+
+void Encoder::setIndexingEnabled(bool enable)
+{
+    indexingEnabled = enable;
+}
+
+void Encoder::setNeverIndexedFields(const std::vector<QByteArray> &names)
+{
+    neverIndexed = names;
+}
+
+void Encoder::updateTableCapacity()
+{
+    const quint32 newSize = std::min(peerMaxTableSize, tableSizeLimit);
+    if (newSize == lookupTable.dynamicTableCapacity() && !sizeUpdatePending)
+        return;
+
+    // This evicts entries (if needed) immediately, our peer will do
+    // the same when decoding our size update.
+    lookupTable.setMaxDynamicTableSize(newSize);
+    smallestPendingSize = sizeUpdatePending ? std::min(smallestPendingSize, newSize) : newSize;
+    sizeUpdatePending = true;
+}
+
+void Encoder::encodePendingSizeUpdates(BitOStream &outputStream)
+{
+    if (!sizeUpdatePending)
+        return;
+
+    const quint32 size = lookupTable.dynamicTableCapacity();
+    if (smallestPendingSize < size)
+        write_size_update(outputStream, smallestPendingSize);
+    write_size_update(outputStream, size);
+    sizeUpdatePending = false;
+}
+
+const BitPattern &Encoder::literalFieldType(const HeaderField &field) const
+{
+    if (std::find(neverIndexed.begin(), neverIndexed.end(), field.name) != neverIndexed.end())
+        return LiteralNeverIndexing;
+
+    if (!indexingEnabled || is_rarely_repeated(field.name))
+        return LiteralNoIndexing;
+
+    // A field taking most of the table would evict (almost) everything
+    // else we have there, and it is unlikely to be worth it.
+    const HeaderSize size = entry_size(field);
+    if (!size.first || size.second > lookupTable.dynamicTableCapacity() / 4 * 3)
+        return LiteralNoIndexing;
+
+    return LiteralIncrementalIndexing;
+}
+
+bool Encoder::encodeCookieCrumbs(BitOStream &outputStream, const HeaderField &field)
+{
+    // HTTP/2, 8.1.2.5: the cookie header field can be split into separate
+    // fields, one for each cookie-pair. Crumbs that did not change compress
+    // to an index, even if other cookies did.
+    const QByteArray &value = field.value;
+    if (value.isEmpty())
+        return encodeHeaderField(outputStream, field);
+
+    int from = 0;
+    while (from < value.size()) {
+        int to = value.indexOf(';', from);
+        if (to == -1)
+            to = value.size();
+        int begin = from;
+        while (begin < to && value.at(begin) == ' ')
+            ++begin;
+        if (begin < to) {
+            // Most crumbs are found in the table, look them up without a copy.
+            const QByteArray crumb = QByteArray::fromRawData(value.constData() + begin, to - begin);
+            if (const auto index = lookupTable.indexOf(field.name, crumb)) {
+                if (!encodeIndexedField(outputStream, index))
+                    return false;
+            } else if (!encodeHeaderField(outputStream, HeaderField(field.name, value.mid(begin, to - begin)))) {
+                return false;
+            }
+        }
+        from = to + 1;
+    }
+
+    return true;
 }
 
 bool Encoder::encodeRequestPseudoHeaders(BitOStream &outputStream,
@@ -293,21 +426,22 @@ bool Encoder::encodeRequestPseudoHeaders(BitOStream &outputStream,
 
 bool Encoder::encodeHeaderField(BitOStream &outputStream, const HeaderField &field)
 {
-    // TODO: at the moment we never use LiteralNo/Never Indexing ...
-
     // Here we try:
     // 1. indexed
-    // 2. literal indexed with indexed name/literal value
-    // 3. literal indexed with literal name/literal value
+    // 2. literal with indexed name/literal value
+    // 3. literal with literal name/literal value
+    // where a literal is added to the dynamic table unless it's
+    // never indexed, or too big (see literalFieldType()).
     if (const auto index = lookupTable.indexOf(field.name, field.value))
         return encodeIndexedField(outputStream, index);
 
+    const BitPattern &fieldType = literalFieldType(field);
     if (const auto index = lookupTable.indexOf(field.name)) {
-        return encodeLiteralField(outputStream, LiteralIncrementalIndexing,
+        return encodeLiteralField(outputStream, fieldType,
                                   index, field.value, compressStrings);
     }
 
-    return encodeLiteralField(outputStream, LiteralIncrementalIndexing,
+    return encodeLiteralField(outputStream, fieldType,
                               field.name, field.value, compressStrings);
 }
 
@@ -320,7 +454,7 @@ bool Encoder::encodeMethod(BitOStream &outputStream, const HeaderField &field)
 
     index = lookupTable.indexOf(field.name);
     Q_ASSERT(index); // ":method" is always in the static table ...
-    return encodeLiteralField(outputStream, LiteralIncrementalIndexing,
+    return encodeLiteralField(outputStream, literalFieldType(field),
                               index, field.value, compressStrings);
 }
 
@@ -384,8 +518,8 @@ bool Encoder::encodeLiteralField(BitOStream &outputStream, const BitPattern &fie
     write_bit_pattern(fieldType, outputStream);
 
     outputStream.write(0);
-    outputStream.write(name, withCompression);
-    outputStream.write(value, withCompression);
+    outputStream.write(name, use_huffman(name, withCompression));
+    outputStream.write(value, use_huffman(value, withCompression));
 
     return true;
 }
@@ -407,7 +541,7 @@ bool Encoder::encodeLiteralField(BitOStream &outputStream, const BitPattern &fie
 
     write_bit_pattern(fieldType, outputStream);
     outputStream.write(nameIndex);
-    outputStream.write(value, withCompression);
+    outputStream.write(value, use_huffman(value, withCompression));
 
     return true;
 }
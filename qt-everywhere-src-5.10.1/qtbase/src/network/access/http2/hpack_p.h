@@ -53,14 +53,13 @@
 
 #include "hpacktable_p.h"
 
+#include <QtCore/qbytearray.h>
 #include <QtCore/qglobal.h>
 
 #include <vector>
 
 QT_BEGIN_NAMESPACE
 
-class QByteArray;
-
 namespace HPack
 {
 
@@ -82,9 +81,24 @@ public:
     bool encodeSizeUpdate(BitOStream &outputStream,
                           quint32 newSize);
 
+    // The table size our peer allows (SETTINGS_HEADER_TABLE_SIZE):
     void setMaxDynamicTableSize(quint32 size);
+    // Our own limit, we never use a bigger table:
+    void setDynamicTableSizeLimit(quint32 limit);
+
+    void setCompressStrings(bool compress);
+    void setIndexingEnabled(bool enable);
+    // Fields with these (lower case) names are sent as 'never indexed'
+    // literals (HPACK, 6.2.3), no intermediary is allowed to index them:
+    void setNeverIndexedFields(const std::vector<QByteArray> &names);
 
 private:
+    void updateTableCapacity();
+    void encodePendingSizeUpdates(BitOStream &outputStream);
+    const struct BitPattern &literalFieldType(const HeaderField &field) const;
+    bool encodeCookieCrumbs(BitOStream &outputStream,
+                            const HeaderField &field);
+
     bool encodeRequestPseudoHeaders(BitOStream &outputStream,
                                     const HttpHeader &header);
     bool encodeHeaderField(BitOStream &outputStream,
@@ -112,6 +126,15 @@ private:
 
     FieldLookupTable lookupTable;
     bool compressStrings;
+    bool indexingEnabled;
+    std::vector<QByteArray> neverIndexed;
+
+    quint32 peerMaxTableSize;
+    quint32 tableSizeLimit;
+    // HPACK, 4.2: we must signal the smallest size we used since the
+    // last header block and then the current one.
+    bool sizeUpdatePending;
+    quint32 smallestPendingSize;
 };
 
 class Q_AUTOTEST_EXPORT Decoder
@@ -161,6 +161,7 @@ public:
     quint32 numberOfStaticEntries() const;
     quint32 numberOfDynamicEntries() const;
     quint32 dynamicDataSize() const;
+    quint32 dynamicTableCapacity() const { return tableCapacity; }
     void clearDynamicTable();
 
     bool indexIsValid(quint32 index) const;
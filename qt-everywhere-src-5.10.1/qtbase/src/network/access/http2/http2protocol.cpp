@@ -71,6 +71,16 @@ ProtocolParameters::ProtocolParameters()
     settingsFrameData[Settings::ENABLE_PUSH_ID] = 0;
 }
 
+ProtocolParameters::ProtocolParameters(const QHttp2Configuration &config)
+    : ProtocolParameters()
+{
+    maxSessionReceiveWindowSize = qint32(config.sessionReceiveWindowSize());
+    // validate() does not accept a stream window larger than the session's:
+    settingsFrameData[Settings::INITIAL_WINDOW_SIZE_ID] =
+        qMin(config.streamReceiveWindowSize(), config.sessionReceiveWindowSize());
+    windowAutoTuning = config.windowAutoTuningEnabled();
+}
+
 bool ProtocolParameters::validate() const
 {
     // 0. Huffman/indexing: any values are valid and allowed.
@@ -52,17 +52,20 @@
 //
 
 #include <QtNetwork/qnetworkreply.h>
+#include <QtNetwork/qhttp2configuration.h>
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qbytearray.h>
 #include <QtCore/qmetatype.h>
 #include <QtCore/qglobal.h>
 
+#include <vector>
+
 // Different HTTP/2 constants/values as defined by RFC 7540.
 
 QT_BEGIN_NAMESPACE
 
 class QHttpNetworkRequest;
 class QHttpNetworkReply;
-class QByteArray;
 class QString;
 
 namespace Http2
@@ -148,14 +151,16 @@ const qint32 qtDefaultStreamReceiveWindowSize = maxSessionReceiveWindowSize / ma
 // The class ProtocolParameters allows client code to customize HTTP/2 protocol
 // handler, if needed. Normally, we use our own default parameters (see below).
 // In 5.10 we can also use setProperty/property on a QNAM object to pass the
-// non-default values to the protocol handler. In 5.11 this will probably become
-// a public API.
+// non-default values to the protocol handler. Since 5.11 the window sizes are
+// also public API, QNetworkAccessManager::setHttp2Configuration(), the
+// property still takes precedence if set.
 
 using RawSettings = QMap<Settings, quint32>;
 
 struct Q_AUTOTEST_EXPORT ProtocolParameters
 {
     ProtocolParameters();
+    explicit ProtocolParameters(const QHttp2Configuration &config);
 
     bool validate() const;
     QByteArray settingsFrameToBase64() const;
@@ -163,13 +168,23 @@ struct Q_AUTOTEST_EXPORT ProtocolParameters
     void addProtocolUpgradeHeaders(QHttpNetworkRequest *request) const;
 
     // HPACK:
-    // TODO: for now we ignore them (fix it for 5.11, would require changes in HPACK)
     bool useHuffman = true;
     bool indexStrings = true;
+    // The dynamic table we use to compress our headers never grows beyond
+    // this size, even if our peer allows more in SETTINGS_HEADER_TABLE_SIZE
+    // (the table for the headers we receive is set in settingsFrameData):
+    quint32 maxEncoderTableSize = 65536;
+    // Lower case names of header fields that must not be added to any
+    // dynamic table, for example short secrets (HPACK, 7.1.3):
+    std::vector<QByteArray> neverIndexedHeaders;
 
     // This parameter is not negotiated via SETTINGS frames, so we have it
     // as a member and will convey it to our peer as a WINDOW_UPDATE frame:
     qint32 maxSessionReceiveWindowSize = Http2::maxSessionReceiveWindowSize;
+    // Grow the stream receive windows from SETTINGS_INITIAL_WINDOW_SIZE up to
+    // maxSessionReceiveWindowSize, using PING frames to measure how much data
+    // our peer has in flight:
+    bool windowAutoTuning = false;
 
     // This is our default SETTINGS frame:
     //
@@ -0,0 +1,218 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qhttp2configuration.h"
+
+#include "private/http2protocol_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QHttp2Configuration
+    \brief The QHttp2Configuration class controls HTTP/2 parameters and settings.
+    \since 5.11
+    \ingroup network
+    \inmodule QtNetwork
+
+    QHttp2Configuration controls the flow control window sizes
+    QNetworkAccessManager uses on its HTTP/2 connections. The receive windows
+    limit how much data a server can send before it has to wait for the client
+    to acknowledge it; on links with a high bandwidth-delay product a window
+    that is smaller than the amount of data in flight caps the download speed,
+    whatever the link can do.
+
+    The settings are applied when a new HTTP/2 connection is opened, and are
+    shared by all requests sent over that connection.
+
+    \sa QNetworkAccessManager::setHttp2Configuration()
+*/
+
+class QHttp2ConfigurationPrivate : public QSharedData
+{
+public:
+    unsigned sessionWindowSize = Http2::maxSessionReceiveWindowSize;
+    unsigned streamWindowSize = Http2::qtDefaultStreamReceiveWindowSize;
+    bool windowAutoTuning = false;
+
+    bool operator == (const QHttp2ConfigurationPrivate &other) const
+    {
+        return sessionWindowSize == other.sessionWindowSize
+               && streamWindowSize == other.streamWindowSize
+               && windowAutoTuning == other.windowAutoTuning;
+    }
+};
+
+/*!
+    Returns \c true if \a lhs and \a rhs have the same set of HTTP/2
+    parameters.
+*/
+bool operator==(const QHttp2Configuration &lhs, const QHttp2Configuration &rhs)
+{
+    return lhs.d == rhs.d || *lhs.d == *rhs.d;
+}
+
+/*!
+    Constructs a configuration with the default window sizes: 2^31 - 1 bytes
+    for the session and a hundredth of that per stream, without auto-tuning.
+*/
+QHttp2Configuration::QHttp2Configuration() : d(new QHttp2ConfigurationPrivate)
+{
+}
+
+/*!
+    Creates a copy of \a other.
+*/
+QHttp2Configuration::QHttp2Configuration(const QHttp2Configuration &other)
+    : d(other.d)
+{
+}
+
+/*!
+    Destructor.
+*/
+QHttp2Configuration::~QHttp2Configuration()
+{
+}
+
+/*!
+    Copy-assignment operator, makes a copy of \a other.
+*/
+QHttp2Configuration &QHttp2Configuration::operator=(const QHttp2Configuration &other)
+{
+    d = other.d;
+    return *this;
+}
+
+/*!
+    Sets the window size for the connection (the HTTP/2 session) to \a size
+    bytes. This is the total amount of data all streams can receive before
+    the server has to wait for a WINDOW_UPDATE frame.
+
+    Returns \c false and leaves the configuration unchanged if \a size is
+    outside the range [65535, 2^31 - 1] allowed by RFC 7540.
+
+    \sa sessionReceiveWindowSize(), setStreamReceiveWindowSize()
+*/
+bool QHttp2Configuration::setSessionReceiveWindowSize(unsigned size)
+{
+    if (size < Http2::defaultSessionWindowSize
+        || size > unsigned(Http2::maxSessionReceiveWindowSize)) {
+        qCWarning(QT_HTTP2, "Session receive window must be in the range [65535, 2^31-1]");
+        return false;
+    }
+
+    d->sessionWindowSize = size;
+    return true;
+}
+
+/*!
+    Returns the window size for the connection.
+
+    \sa setSessionReceiveWindowSize()
+*/
+unsigned QHttp2Configuration::sessionReceiveWindowSize() const
+{
+    return d->sessionWindowSize;
+}
+
+/*!
+    Sets the initial window size for each stream to \a size bytes. It's sent
+    to the server as SETTINGS_INITIAL_WINDOW_SIZE and limits how much of one
+    response can be in flight. The stream window is never larger than the
+    session window.
+
+    Returns \c false and leaves the configuration unchanged if \a size is
+    outside the range [1, 2^31 - 1].
+
+    \sa streamReceiveWindowSize(), setWindowAutoTuningEnabled()
+*/
+bool QHttp2Configuration::setStreamReceiveWindowSize(unsigned size)
+{
+    if (!size || size > unsigned(Http2::maxSessionReceiveWindowSize)) {
+        qCWarning(QT_HTTP2, "Stream receive window must be in the range (0, 2^31-1]");
+        return false;
+    }
+
+    d->streamWindowSize = size;
+    return true;
+}
+
+/*!
+    Returns the initial window size for each stream.
+
+    \sa setStreamReceiveWindowSize()
+*/
+unsigned QHttp2Configuration::streamReceiveWindowSize() const
+{
+    return d->streamWindowSize;
+}
+
+/*!
+    If \a enable is \c true, the stream window starts at
+    streamReceiveWindowSize() and grows while a connection is in use.
+
+    The window is tuned from the bandwidth-delay product of the connection:
+    when data arrives, a PING frame is sent, and the amount of data received
+    until the server acknowledges it is what the server delivers in one round
+    trip. If that gets close to the stream window, the window is what limits
+    the download, and it is raised to twice the measured amount, up to
+    sessionReceiveWindowSize().
+    Auto-tuning never shrinks the windows.
+
+    Auto-tuning is disabled by default.
+
+    \sa windowAutoTuningEnabled()
+*/
+void QHttp2Configuration::setWindowAutoTuningEnabled(bool enable)
+{
+    d->windowAutoTuning = enable;
+}
+
+/*!
+    Returns \c true if the stream window grows with the measured
+    bandwidth-delay product of the connection.
+
+    \sa setWindowAutoTuningEnabled()
+*/
+bool QHttp2Configuration::windowAutoTuningEnabled() const
+{
+    return d->windowAutoTuning;
+}
+
+QT_END_NAMESPACE
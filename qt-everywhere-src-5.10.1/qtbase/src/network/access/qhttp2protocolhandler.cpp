@@ -161,7 +161,6 @@ bool sum_will_overflow(qint32 windowSize, qint32 delta)
 using namespace Http2;
 
 const std::deque<quint32>::size_type QHttp2ProtocolHandler::maxRecycledStreams = 10000;
-const quint32 QHttp2ProtocolHandler::maxAcceptableTableSize;
 
 QHttp2ProtocolHandler::QHttp2ProtocolHandler(QHttpNetworkConnectionChannel *channel)
     : QAbstractProtocolHandler(channel),
@@ -176,17 +175,30 @@ QHttp2ProtocolHandler::QHttp2ProtocolHandler(QHttpNetworkConnectionChannel *chan
     Q_ASSERT(params.validate());
 
     maxSessionReceiveWindowSize = params.maxSessionReceiveWindowSize;
+    windowAutoTuning = params.windowAutoTuning;
+
+    encoder.setCompressStrings(params.useHuffman);
+    encoder.setIndexingEnabled(params.indexStrings);
+    encoder.setDynamicTableSizeLimit(params.maxEncoderTableSize);
+    encoder.setNeverIndexedFields(params.neverIndexedHeaders);
 
     const RawSettings &data = params.settingsFrameData;
     for (auto param = data.cbegin(), end = data.cend(); param != end; ++param) {
         switch (param.key()) {
         case Settings::INITIAL_WINDOW_SIZE_ID:
             streamInitialReceiveWindowSize = param.value();
+            streamReceiveWindowSize = param.value();
             break;
         case Settings::ENABLE_PUSH_ID:
             pushPromiseEnabled = param.value();
             break;
         case Settings::HEADER_TABLE_SIZE_ID:
+            // Until our SETTINGS are acknowledged, the peer can still assume
+            // the default size, so we can only grow the table right now.
+            decoderTableSize = param.value();
+            if (decoderTableSize > HPack::FieldLookupTable::DefaultSize)
+                decoder.setMaxDynamicTableSize(decoderTableSize);
+            break;
         case Settings::MAX_CONCURRENT_STREAMS_ID:
         case Settings::MAX_FRAME_SIZE_ID:
         case Settings::MAX_HEADER_LIST_SIZE_ID:
@@ -523,6 +535,18 @@ bool QHttp2ProtocolHandler::sendWINDOW_UPDATE(quint32 streamID, quint32 delta)
     return frameWriter.write(*m_socket);
 }
 
+bool QHttp2ProtocolHandler::sendPING()
+{
+    Q_ASSERT(m_socket);
+
+    uchar data[8];
+    qToBigEndian(++bdpPingPayload, data);
+
+    frameWriter.start(FrameType::PING, FrameFlag::EMPTY, connectionStreamID);
+    frameWriter.append(data, data + 8);
+    return frameWriter.write(*m_socket);
+}
+
 bool QHttp2ProtocolHandler::sendRST_STREAM(quint32 streamID, quint32 errorCode)
 {
     Q_ASSERT(m_socket);
@@ -575,15 +599,18 @@ void QHttp2ProtocolHandler::handleDATA()
             if (inboundFrame.flags().testFlag(FrameFlag::END_STREAM)) {
                 finishStream(stream);
                 deleteActiveStream(stream.streamID);
-            } else if (stream.recvWindow < streamInitialReceiveWindowSize / 2) {
+            } else if (stream.recvWindow < streamReceiveWindowSize / 2) {
                 QMetaObject::invokeMethod(this, "sendWINDOW_UPDATE", Qt::QueuedConnection,
                                           Q_ARG(quint32, stream.streamID),
-                                          Q_ARG(quint32, streamInitialReceiveWindowSize - stream.recvWindow));
-                stream.recvWindow = streamInitialReceiveWindowSize;
+                                          Q_ARG(quint32, streamReceiveWindowSize - stream.recvWindow));
+                stream.recvWindow = streamReceiveWindowSize;
             }
         }
     }
 
+    if (windowAutoTuning)
+        sampleBandwidthDelay(inboundFrame.payloadSize());
+
     if (sessionReceiveWindowSize < maxSessionReceiveWindowSize / 2) {
         QMetaObject::invokeMethod(this, "sendWINDOW_UPDATE", Qt::QueuedConnection,
                                   Q_ARG(quint32, connectionStreamID),
@@ -699,6 +726,8 @@ void QHttp2ProtocolHandler::handleSETTINGS()
         if (!waitingForSettingsACK)
             return connectionError(PROTOCOL_ERROR, "unexpected SETTINGS ACK");
         waitingForSettingsACK = false;
+        if (decoderTableSize < HPack::FieldLookupTable::DefaultSize)
+            decoder.setMaxDynamicTableSize(decoderTableSize);
         return;
     }
 
@@ -777,11 +806,16 @@ void QHttp2ProtocolHandler::handlePING()
     if (inboundFrame.streamID() != connectionStreamID)
         return connectionError(PROTOCOL_ERROR, "PING on invalid stream");
 
-    if (inboundFrame.flags() & FrameFlag::ACK)
-        return connectionError(PROTOCOL_ERROR, "unexpected PING ACK");
-
     Q_ASSERT(inboundFrame.dataSize() == 8);
 
+    if (inboundFrame.flags() & FrameFlag::ACK) {
+        // The only PING we send is the one measuring the bandwidth-delay product.
+        if (!bdpPingPending || qFromBigEndian<quint64>(inboundFrame.dataBegin()) != bdpPingPayload)
+            return connectionError(PROTOCOL_ERROR, "unexpected PING ACK");
+        bdpPingPending = false;
+        return growStreamReceiveWindow();
+    }
+
     frameWriter.start(FrameType::PING, FrameFlag::ACK, connectionStreamID);
     frameWriter.append(inboundFrame.dataBegin(), inboundFrame.dataBegin() + 8);
     frameWriter.write(*m_socket);
@@ -981,10 +1015,8 @@ void QHttp2ProtocolHandler::handleContinuedHEADERS()
 bool QHttp2ProtocolHandler::acceptSetting(Http2::Settings identifier, quint32 newValue)
 {
     if (identifier == Settings::HEADER_TABLE_SIZE_ID) {
-        if (newValue > maxAcceptableTableSize) {
-            connectionError(PROTOCOL_ERROR, "SETTINGS invalid table size");
-            return false;
-        }
+        // Any value is valid, the encoder won't go beyond its own limit
+        // and signals the size it actually uses in the next HEADERS.
         encoder.setMaxDynamicTableSize(newValue);
     }
 
@@ -1047,6 +1079,46 @@ bool QHttp2ProtocolHandler::acceptSetting(Http2::Settings identifier, quint32 ne
     return true;
 }
 
+void QHttp2ProtocolHandler::sampleBandwidthDelay(quint32 payloadSize)
+{
+    Q_ASSERT(windowAutoTuning);
+
+    if (bdpPingPending) {
+        bdpBytes += payloadSize;
+        return;
+    }
+
+    // The windows cannot grow any further, no need to measure anything.
+    if (streamReceiveWindowSize >= maxSessionReceiveWindowSize)
+        return;
+
+    bdpBytes = payloadSize;
+    bdpPingPending = sendPING();
+}
+
+void QHttp2ProtocolHandler::growStreamReceiveWindow()
+{
+    // bdpBytes is how much our peer sent during one round trip. If this is
+    // close to the stream window, the peer had to wait for our WINDOW_UPDATE
+    // frames and the window, not the network, limits the throughput.
+    if (bdpBytes <= quint64(streamReceiveWindowSize) / 3 * 2)
+        return;
+
+    const qint32 newSize = qint32(qMin(bdpBytes * 2, quint64(maxSessionReceiveWindowSize)));
+    if (newSize <= streamReceiveWindowSize)
+        return;
+
+    streamReceiveWindowSize = newSize;
+
+    // Let the streams that are already sending use the larger window now:
+    for (auto &stream : activeStreams) {
+        if (stream.recvWindow < streamReceiveWindowSize) {
+            sendWINDOW_UPDATE(stream.streamID, streamReceiveWindowSize - stream.recvWindow);
+            stream.recvWindow = streamReceiveWindowSize;
+        }
+    }
+}
+
 void QHttp2ProtocolHandler::updateStream(Stream &stream, const HPack::HttpHeader &headers,
                                          Qt::ConnectionType connectionType)
 {
@@ -108,6 +108,7 @@ private:
     Q_INVOKABLE bool sendWINDOW_UPDATE(quint32 streamID, quint32 delta);
     bool sendRST_STREAM(quint32 streamID, quint32 errorCoder);
     bool sendGOAWAY(quint32 errorCode);
+    bool sendPING();
 
     void handleDATA();
     void handleHEADERS();
@@ -124,6 +125,9 @@ private:
 
     bool acceptSetting(Http2::Settings identifier, quint32 newValue);
 
+    void sampleBandwidthDelay(quint32 payloadSize);
+    void growStreamReceiveWindow();
+
     void updateStream(Stream &stream, const HPack::HttpHeader &headers,
                       Qt::ConnectionType connectionType = Qt::DirectConnection);
     void updateStream(Stream &stream, const Http2::Frame &dataFrame,
@@ -150,7 +154,9 @@ private:
     // the client's preface 24-byte message.
     bool waitingForSettingsACK = false;
 
-    static const quint32 maxAcceptableTableSize = 16 * HPack::FieldLookupTable::DefaultSize;
+    // The size of our decoder's table we sent in SETTINGS_HEADER_TABLE_SIZE,
+    // it's in effect after the peer has acknowledged our SETTINGS:
+    quint32 decoderTableSize = HPack::FieldLookupTable::DefaultSize;
     // HTTP/2 4.3: Header compression is stateful. One compression context and
     // one decompression context are used for the entire connection.
     HPack::Decoder decoder;
@@ -193,6 +199,17 @@ private:
     // Our per-stream receive window size, default is 64 Kb, will be updated
     // from QNAM's Http2::ProtocolParameters. Again, signed - can become negative.
     qint32 streamInitialReceiveWindowSize = Http2::defaultSessionWindowSize;
+    // The size we replenish stream windows to. It starts as the initial size,
+    // with auto-tuning it can later grow up to maxSessionReceiveWindowSize.
+    qint32 streamReceiveWindowSize = Http2::defaultSessionWindowSize;
+
+    // Window auto-tuning: we send a PING when DATA arrives and count the bytes
+    // received until it's ACKed, which is the bandwidth-delay product seen by
+    // our peer. Only one such PING is in flight at a time.
+    bool windowAutoTuning = false;
+    bool bdpPingPending = false;
+    quint64 bdpPingPayload = 0;
+    quint64 bdpBytes = 0;
 
     // These are our peer's receive window sizes, they will be updated by the
     // peer's SETTINGS and WINDOW_UPDATE frames.
@@ -0,0 +1,271 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qhttpconnectionpoolconfiguration.h"
+
+#include <QtCore/qdebug.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QHttpConnectionPoolConfiguration
+    \brief The QHttpConnectionPoolConfiguration class controls how
+    QNetworkAccessManager opens and reuses HTTP connections.
+    \since 5.11
+    \ingroup network
+    \inmodule QtNetwork
+
+    QNetworkAccessManager keeps the connections it opened to a server after
+    a reply has finished, so that later requests to the same server do not
+    have to wait for a new TCP connection and TLS handshake. For HTTP/1.1,
+    it opens several connections to a server to send requests in parallel;
+    a request that finds no free connection waits in a queue.
+    QHttpConnectionPoolConfiguration sets the limits of this pool: how many
+    connections are opened per server and in total, and how long an unused
+    connection is kept.
+
+    Newly queued requests are sent on the connection that was used most
+    recently, which is the one most likely to still be open and to have
+    its TCP congestion window already opened up. Connections that stay
+    unused for longer than idleTimeout() are closed.
+
+    The limits on the number of connections apply to HTTP/1.1; an HTTP/2
+    connection multiplexes all requests to a server over a single
+    connection. To open connections before they are needed, use
+    QNetworkAccessManager::connectToHost() or
+    QNetworkAccessManager::connectToHostEncrypted().
+
+    \sa QNetworkAccessManager::setHttpConnectionPoolConfiguration(),
+        QNetworkAccessManager::hostConnectionStatistics()
+*/
+
+class QHttpConnectionPoolConfigurationPrivate : public QSharedData
+{
+public:
+    int maximumConnectionsPerHost = 6;
+    int maximumConnections = 0;
+    int idleTimeout = 120000;
+    int maximumPipelinedRequests = 3;
+
+    bool operator == (const QHttpConnectionPoolConfigurationPrivate &other) const
+    {
+        return maximumConnectionsPerHost == other.maximumConnectionsPerHost
+               && maximumConnections == other.maximumConnections
+               && idleTimeout == other.idleTimeout
+               && maximumPipelinedRequests == other.maximumPipelinedRequests;
+    }
+};
+
+/*!
+    Returns \c true if \a lhs and \a rhs have the same limits.
+*/
+bool operator==(const QHttpConnectionPoolConfiguration &lhs, const QHttpConnectionPoolConfiguration &rhs)
+{
+    return lhs.d == rhs.d || *lhs.d == *rhs.d;
+}
+
+/*!
+    Constructs a configuration with the defaults QNetworkAccessManager has
+    always used: up to 6 connections per server, no total limit, unused
+    connections kept for two minutes and up to 3 pipelined requests.
+*/
+QHttpConnectionPoolConfiguration::QHttpConnectionPoolConfiguration()
+    : d(new QHttpConnectionPoolConfigurationPrivate)
+{
+}
+
+/*!
+    Creates a copy of \a other.
+*/
+QHttpConnectionPoolConfiguration::QHttpConnectionPoolConfiguration(const QHttpConnectionPoolConfiguration &other)
+    : d(other.d)
+{
+}
+
+/*!
+    Destructor.
+*/
+QHttpConnectionPoolConfiguration::~QHttpConnectionPoolConfiguration()
+{
+}
+
+/*!
+    Copy-assignment operator, makes a copy of \a other.
+*/
+QHttpConnectionPoolConfiguration &QHttpConnectionPoolConfiguration::operator=(const QHttpConnectionPoolConfiguration &other)
+{
+    d = other.d;
+    return *this;
+}
+
+/*!
+    Sets the number of connections opened in parallel to one server to
+    \a count. The default is 6.
+
+    Returns \c false and leaves the configuration unchanged if \a count is
+    outside the range [1, 64].
+
+    \sa maximumConnectionsPerHost(), setMaximumConnections()
+*/
+bool QHttpConnectionPoolConfiguration::setMaximumConnectionsPerHost(int count)
+{
+    if (count < 1 || count > 64) {
+        qWarning("QHttpConnectionPoolConfiguration: connections per host must be in the range [1, 64]");
+        return false;
+    }
+
+    d->maximumConnectionsPerHost = count;
+    return true;
+}
+
+/*!
+    Returns the number of connections opened in parallel to one server.
+
+    \sa setMaximumConnectionsPerHost()
+*/
+int QHttpConnectionPoolConfiguration::maximumConnectionsPerHost() const
+{
+    return d->maximumConnectionsPerHost;
+}
+
+/*!
+    Sets the number of connections that can be open to all servers together
+    to \a count, or removes the limit if \a count is 0, which is the default.
+
+    When the limit is reached, an unused connection to another server is
+    closed to make room; if all connections are in use, the request waits
+    until one becomes free. Each server can always get one connection, so
+    requests to a new server are never blocked by the other servers.
+
+    Returns \c false and leaves the configuration unchanged if \a count is
+    negative.
+
+    \sa maximumConnections(), setMaximumConnectionsPerHost()
+*/
+bool QHttpConnectionPoolConfiguration::setMaximumConnections(int count)
+{
+    if (count < 0) {
+        qWarning("QHttpConnectionPoolConfiguration: the connection limit cannot be negative");
+        return false;
+    }
+
+    d->maximumConnections = count;
+    return true;
+}
+
+/*!
+    Returns the number of connections that can be open to all servers
+    together, or 0 if there is no limit.
+
+    \sa setMaximumConnections()
+*/
+int QHttpConnectionPoolConfiguration::maximumConnections() const
+{
+    return d->maximumConnections;
+}
+
+/*!
+    Sets the time an unused connection is kept open to \a msecs
+    milliseconds. The default is 120000 (two minutes).
+
+    Servers usually close idle connections after some time; setting the
+    timeout below the server's avoids sending requests on connections that
+    are about to be closed.
+
+    Returns \c false and leaves the configuration unchanged if \a msecs is
+    not positive.
+
+    \sa idleTimeout()
+*/
+bool QHttpConnectionPoolConfiguration::setIdleTimeout(int msecs)
+{
+    if (msecs <= 0) {
+        qWarning("QHttpConnectionPoolConfiguration: the idle timeout must be positive");
+        return false;
+    }
+
+    d->idleTimeout = msecs;
+    return true;
+}
+
+/*!
+    Returns the time in milliseconds an unused connection is kept open.
+
+    \sa setIdleTimeout()
+*/
+int QHttpConnectionPoolConfiguration::idleTimeout() const
+{
+    return d->idleTimeout;
+}
+
+/*!
+    Sets the number of requests that can be sent on a connection while it
+    is still receiving a response to \a count. The default is 3.
+
+    This only applies to requests that allow HTTP pipelining, see
+    QNetworkRequest::HttpPipeliningAllowedAttribute. A \a count of 0
+    disables pipelining.
+
+    Returns \c false and leaves the configuration unchanged if \a count is
+    outside the range [0, 64].
+
+    \sa maximumPipelinedRequests()
+*/
+bool QHttpConnectionPoolConfiguration::setMaximumPipelinedRequests(int count)
+{
+    if (count < 0 || count > 64) {
+        qWarning("QHttpConnectionPoolConfiguration: pipelined requests must be in the range [0, 64]");
+        return false;
+    }
+
+    d->maximumPipelinedRequests = count;
+    return true;
+}
+
+/*!
+    Returns the number of requests that can be pipelined on a connection.
+
+    \sa setMaximumPipelinedRequests()
+*/
+int QHttpConnectionPoolConfiguration::maximumPipelinedRequests() const
+{
+    return d->maximumPipelinedRequests;
+}
+
+QT_END_NAMESPACE
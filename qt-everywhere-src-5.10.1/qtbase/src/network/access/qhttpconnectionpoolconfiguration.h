@@ -0,0 +1,94 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QHTTPCONNECTIONPOOLCONFIGURATION_H
+#define QHTTPCONNECTIONPOOLCONFIGURATION_H
+
+#include <QtNetwork/qtnetworkglobal.h>
+
+#include <QtCore/qshareddata.h>
+
+QT_BEGIN_NAMESPACE
+
+class QHttpConnectionPoolConfigurationPrivate;
+class Q_NETWORK_EXPORT QHttpConnectionPoolConfiguration
+{
+public:
+    QHttpConnectionPoolConfiguration();
+    QHttpConnectionPoolConfiguration(const QHttpConnectionPoolConfiguration &other);
+    QHttpConnectionPoolConfiguration &operator=(const QHttpConnectionPoolConfiguration &other);
+    QHttpConnectionPoolConfiguration &operator=(QHttpConnectionPoolConfiguration &&other) Q_DECL_NOTHROW { swap(other); return *this; }
+    ~QHttpConnectionPoolConfiguration();
+
+    void swap(QHttpConnectionPoolConfiguration &other) Q_DECL_NOTHROW { qSwap(d, other.d); }
+
+    bool setMaximumConnectionsPerHost(int count);
+    int maximumConnectionsPerHost() const;
+
+    bool setMaximumConnections(int count);
+    int maximumConnections() const;
+
+    bool setIdleTimeout(int msecs);
+    int idleTimeout() const;
+
+    bool setMaximumPipelinedRequests(int count);
+    int maximumPipelinedRequests() const;
+
+private:
+
+    QSharedDataPointer<QHttpConnectionPoolConfigurationPrivate> d;
+
+    friend Q_NETWORK_EXPORT bool operator==(const QHttpConnectionPoolConfiguration &lhs,
+                                            const QHttpConnectionPoolConfiguration &rhs);
+};
+
+Q_DECLARE_SHARED(QHttpConnectionPoolConfiguration)
+
+Q_NETWORK_EXPORT bool operator==(const QHttpConnectionPoolConfiguration &lhs,
+                                 const QHttpConnectionPoolConfiguration &rhs);
+
+inline bool operator!=(const QHttpConnectionPoolConfiguration &lhs,
+                       const QHttpConnectionPoolConfiguration &rhs)
+{
+    return !(lhs == rhs);
+}
+
+QT_END_NAMESPACE
+
+#endif // QHTTPCONNECTIONPOOLCONFIGURATION_H
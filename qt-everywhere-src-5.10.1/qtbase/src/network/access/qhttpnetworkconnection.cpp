@@ -52,6 +52,10 @@
 #include <qbuffer.h>
 #include <qpair.h>
 #include <qdebug.h>
+#include <qelapsedtimer.h>
+#include <qvarlengtharray.h>
+
+#include <algorithm>
 
 #ifndef QT_NO_HTTP
 
@@ -74,6 +78,8 @@ const int QHttpNetworkConnectionPrivate::defaultPipelineLength = 3;
 // Only re-fill the pipeline if there's defaultRePipelineLength slots free in the pipeline.
 // This means that there are 2 requests in flight and 2 slots free that will be re-filled.
 const int QHttpNetworkConnectionPrivate::defaultRePipelineLength = 2;
+// Connected channels that have not been used for this long get closed.
+const int QHttpNetworkConnectionPrivate::defaultIdleTimeout = 120 * 1000;
 
 
 QHttpNetworkConnectionPrivate::QHttpNetworkConnectionPrivate(const QString &hostName,
@@ -93,6 +99,8 @@ QHttpNetworkConnectionPrivate::QHttpNetworkConnectionPrivate(const QString &host
 #endif
   , preConnectRequests(0)
   , connectionType(type)
+  , pipelineLength(defaultPipelineLength)
+  , idleTimeout(defaultIdleTimeout)
 {
     // We allocate all 6 channels even if it's SPDY or HTTP/2 enabled
     // connection: in case the protocol negotiation via NPN/ALPN fails,
@@ -106,12 +114,19 @@ QHttpNetworkConnectionPrivate::QHttpNetworkConnectionPrivate(quint16 connectionC
                                                              QHttpNetworkConnection::ConnectionType type)
 : state(RunningState), networkLayerState(Unknown),
   hostName(hostName), port(port), encrypt(encrypt), delayIpv4(true),
-  activeChannelCount(connectionCount), channelCount(connectionCount)
+  activeChannelCount(type == QHttpNetworkConnection::ConnectionTypeHTTP2
+#ifndef QT_NO_SSL
+                     || type == QHttpNetworkConnection::ConnectionTypeSPDY
+#endif
+                     ? 1 : connectionCount),
+  channelCount(connectionCount)
 #ifndef QT_NO_NETWORKPROXY
   , networkProxy(QNetworkProxy::NoProxy)
 #endif
   , preConnectRequests(0)
   , connectionType(type)
+  , pipelineLength(defaultPipelineLength)
+  , idleTimeout(defaultIdleTimeout)
 {
     channels = new QHttpNetworkConnectionChannel[channelCount];
 }
@@ -120,6 +135,8 @@ QHttpNetworkConnectionPrivate::QHttpNetworkConnectionPrivate(quint16 connectionC
 
 QHttpNetworkConnectionPrivate::~QHttpNetworkConnectionPrivate()
 {
+    if (pool)
+        pool->removeConnection(this);
     for (int i = 0; i < channelCount; ++i) {
         if (channels[i].socket) {
             QObject::disconnect(channels[i].socket, Q_NULLPTR, &channels[i], Q_NULLPTR);
@@ -144,6 +161,9 @@ void QHttpNetworkConnectionPrivate::init()
 
     delayedConnectionTimer.setSingleShot(true);
     QObject::connect(&delayedConnectionTimer, SIGNAL(timeout()), q, SLOT(_q_connectDelayedChannel()));
+
+    idleTimer.setSingleShot(true);
+    QObject::connect(&idleTimer, SIGNAL(timeout()), q, SLOT(_q_closeIdleChannels()));
 }
 
 void QHttpNetworkConnectionPrivate::pauseConnection()
@@ -767,7 +787,11 @@ void QHttpNetworkConnectionPrivate::fillPipeline(QAbstractSocket *socket)
     if (channels[i].reply == 0)
         return;
 
-    if (! (defaultPipelineLength - channels[i].alreadyPipelinedRequests.length() >= defaultRePipelineLength)) {
+    if (pipelineLength <= 0)
+        return;
+
+    if (! (pipelineLength - channels[i].alreadyPipelinedRequests.length()
+           >= qMin(defaultRePipelineLength, pipelineLength))) {
         return;
     }
 
@@ -811,7 +835,7 @@ void QHttpNetworkConnectionPrivate::fillPipeline(QAbstractSocket *socket)
         lengthBefore = channels[i].alreadyPipelinedRequests.length();
         fillPipeline(highPriorityQueue, channels[i]);
 
-        if (channels[i].alreadyPipelinedRequests.length() >= defaultPipelineLength) {
+        if (channels[i].alreadyPipelinedRequests.length() >= pipelineLength) {
             channels[i].pipelineFlush();
             return;
         }
@@ -824,7 +848,7 @@ void QHttpNetworkConnectionPrivate::fillPipeline(QAbstractSocket *socket)
         lengthBefore = channels[i].alreadyPipelinedRequests.length();
         fillPipeline(lowPriorityQueue, channels[i]);
 
-        if (channels[i].alreadyPipelinedRequests.length() >= defaultPipelineLength) {
+        if (channels[i].alreadyPipelinedRequests.length() >= pipelineLength) {
             channels[i].pipelineFlush();
             return;
         }
@@ -1025,6 +1049,13 @@ void QHttpNetworkConnectionPrivate::removeReply(QHttpNetworkReply *reply)
 // exception is documented in QHttpNetworkConnectionPrivate::queueRequest
 // although it is called _q_startNextRequest, it will actually start multiple requests when possible
 void QHttpNetworkConnectionPrivate::_q_startNextRequest()
+{
+    startNextRequest();
+    if (pool)
+        pool->connectionUpdated(this);
+}
+
+void QHttpNetworkConnectionPrivate::startNextRequest()
 {
     // If there is no network layer state decided we should not start any new requests.
     if (networkLayerState == Unknown || networkLayerState == HostLookupPending || networkLayerState == IPv4or6)
@@ -1055,14 +1086,22 @@ void QHttpNetworkConnectionPrivate::_q_startNextRequest()
             return;
 
         // try to get a free AND connected socket
+        QVarLengthArray<int, 8> freeChannels;
         for (int i = 0; i < activeChannelCount; ++i) {
             if (channels[i].socket) {
-                if (!channels[i].reply && !channels[i].isSocketBusy() && channels[i].socket->state() == QAbstractSocket::ConnectedState) {
-                    if (dequeueRequest(channels[i].socket))
-                        channels[i].sendRequest();
-                }
+                if (!channels[i].reply && !channels[i].isSocketBusy() && channels[i].socket->state() == QAbstractSocket::ConnectedState)
+                    freeChannels.append(i);
             }
         }
+        // use the most recently used one first: it is the least likely to have
+        // been closed by the server and the others can time out in peace
+        std::sort(freeChannels.begin(), freeChannels.end(), [this](int a, int b) {
+            return channels[a].lastUsed > channels[b].lastUsed;
+        });
+        for (int i : freeChannels) {
+            if (dequeueRequest(channels[i].socket))
+                channels[i].sendRequest();
+        }
         break;
     }
     case QHttpNetworkConnection::ConnectionTypeHTTP2:
@@ -1125,6 +1164,8 @@ void QHttpNetworkConnectionPrivate::_q_startNextRequest()
         }
 
         if (connectChannel) {
+            if (pool && !pool->reserveChannel(this))
+                break; // the pool calls us again once a channel becomes available
             if (networkLayerState == IPv4)
                 channels[i].networkLayerPreference = QAbstractSocket::IPv4Protocol;
             else if (networkLayerState == IPv6)
@@ -1310,6 +1351,238 @@ void QHttpNetworkConnectionPrivate::_q_connectDelayedChannel()
         channels[1].ensureConnection();
 }
 
+qint64 QHttpNetworkConnectionPrivate::currentTime()
+{
+    // one monotonic clock for all connections, so that the pool can compare
+    // the channels of different connections
+    QElapsedTimer timer;
+    timer.start();
+    return timer.msecsSinceReference();
+}
+
+// A channel is idle when it is connected but has nothing to send or receive.
+// Only HTTP/1.1 channels can be idle; an HTTP/2 connection stays busy while open.
+bool QHttpNetworkConnectionPrivate::isChannelIdle(int i) const
+{
+    const QHttpNetworkConnectionChannel &channel = channels[i];
+    return connectionType == QHttpNetworkConnection::ConnectionTypeHTTP
+            && channel.socket && channel.socket->state() == QAbstractSocket::ConnectedState
+            && !channel.reply && !channel.isSocketBusy() && !channel.pendingEncrypt
+            && !channel.resendCurrent && channel.alreadyPipelinedRequests.isEmpty();
+}
+
+void QHttpNetworkConnectionPrivate::scheduleIdleCheck()
+{
+    if (connectionType == QHttpNetworkConnection::ConnectionTypeHTTP && !idleTimer.isActive())
+        idleTimer.start(idleTimeout);
+}
+
+void QHttpNetworkConnectionPrivate::_q_closeIdleChannels()
+{
+    const qint64 now = currentTime();
+    qint64 next = -1;
+    for (int i = 0; i < activeChannelCount; ++i) {
+        if (!isChannelIdle(i))
+            continue;
+        const qint64 unused = now - channels[i].lastUsed;
+        if (unused >= idleTimeout)
+            channels[i].close();
+        else if (next < 0 || idleTimeout - unused < next)
+            next = idleTimeout - unused;
+    }
+    if (next >= 0)
+        idleTimer.start(int(next));
+    if (pool)
+        pool->connectionUpdated(this);
+}
+
+QHttpNetworkConnectionPool::QHttpNetworkConnectionPool()
+    : maximum(0)
+{
+}
+
+void QHttpNetworkConnectionPool::setMaximumConnections(int count)
+{
+    maximum.store(count);
+}
+
+int QHttpNetworkConnectionPool::maximumConnections() const
+{
+    return maximum.load();
+}
+
+QVector<QNetworkAccessManager::HostConnectionStatistics> QHttpNetworkConnectionPool::statistics() const
+{
+    QVector<QNetworkAccessManager::HostConnectionStatistics> result;
+    const auto merge = [&result](const Counters &c) {
+        auto it = std::find_if(result.begin(), result.end(),
+                               [&c](const QNetworkAccessManager::HostConnectionStatistics &s) {
+            return s.hostName == c.hostName && s.port == c.port && s.encrypted == c.encrypted;
+        });
+        if (it == result.end()) {
+            QNetworkAccessManager::HostConnectionStatistics s;
+            s.hostName = c.hostName;
+            s.port = c.port;
+            s.encrypted = c.encrypted;
+            it = result.insert(result.end(), s);
+        }
+        it->activeConnections += c.activeConnections;
+        it->idleConnections += c.idleConnections;
+        it->queuedRequests += c.queuedRequests;
+        it->connectionsOpened += c.connectionsOpened;
+    };
+
+    QMutexLocker locker(&mutex);
+    for (const Counters &c : counters)
+        merge(c);
+    for (const Counters &c : retired)
+        merge(c);
+    return result;
+}
+
+void QHttpNetworkConnectionPool::addConnection(QHttpNetworkConnectionPrivate *connection)
+{
+    connections.append(connection);
+
+    Counters c;
+    c.hostName = connection->hostName;
+    c.port = connection->port;
+    c.encrypted = connection->encrypt;
+    c.activeConnections = 0;
+    c.idleConnections = 0;
+    c.queuedRequests = 0;
+    c.connectionsOpened = 0;
+    QMutexLocker locker(&mutex);
+    counters.insert(connection, c);
+}
+
+void QHttpNetworkConnectionPool::removeConnection(QHttpNetworkConnectionPrivate *connection)
+{
+    connections.removeOne(connection);
+    waiting.removeOne(connection);
+    {
+        QMutexLocker locker(&mutex);
+        Counters c = counters.take(connection);
+        c.activeConnections = 0;
+        c.idleConnections = 0;
+        c.queuedRequests = 0;
+        // keep the history: a later connection to the same host adds to it
+        auto it = std::find_if(retired.begin(), retired.end(), [&c](const Counters &r) {
+            return r.hostName == c.hostName && r.port == c.port && r.encrypted == c.encrypted;
+        });
+        if (it == retired.end())
+            retired.append(c);
+        else
+            it->connectionsOpened += c.connectionsOpened;
+    }
+    wakeWaiting();
+}
+
+bool QHttpNetworkConnectionPool::reserveChannel(QHttpNetworkConnectionPrivate *connection)
+{
+    const int max = maximum.load();
+    if (max <= 0)
+        return true;
+
+    int open = 0;
+    bool requesterHasChannel = false;
+    QHttpNetworkConnectionPrivate *victim = 0;
+    int victimChannel = -1;
+    for (QHttpNetworkConnectionPrivate *c : qAsConst(connections)) {
+        for (int i = 0; i < c->channelCount; ++i) {
+            const QAbstractSocket *socket = c->channels[i].socket;
+            if (!socket || socket->state() == QAbstractSocket::UnconnectedState)
+                continue;
+            ++open;
+            if (c == connection) {
+                requesterHasChannel = true;
+            } else if (c->isChannelIdle(i)
+                       && (!victim || c->channels[i].lastUsed < victim->channels[victimChannel].lastUsed)) {
+                victim = c;
+                victimChannel = i;
+            }
+        }
+    }
+
+    // every host gets at least one connection, or requests to it would
+    // starve behind busy connections to other hosts
+    if (open < max || !requesterHasChannel)
+        return true;
+
+    if (victim) {
+        victim->channels[victimChannel].close();
+        return true;
+    }
+
+    if (!waiting.contains(connection))
+        waiting.append(connection);
+    return false;
+}
+
+void QHttpNetworkConnectionPool::connectionUpdated(QHttpNetworkConnectionPrivate *connection)
+{
+    int active = 0;
+    int idle = 0;
+    for (int i = 0; i < connection->channelCount; ++i) {
+        const QAbstractSocket *socket = connection->channels[i].socket;
+        if (!socket || socket->state() == QAbstractSocket::UnconnectedState)
+            continue;
+        if (connection->isChannelIdle(i))
+            ++idle;
+        else
+            ++active;
+    }
+    int queued = connection->highPriorityQueue.count() + connection->lowPriorityQueue.count()
+            + connection->channels[0].spdyRequestsToSend.count();
+
+    {
+        QMutexLocker locker(&mutex);
+        const auto it = counters.find(connection);
+        if (it != counters.end()) {
+            it->activeConnections = active;
+            it->idleConnections = idle;
+            it->queuedRequests = queued;
+        }
+    }
+
+    wakeWaiting();
+}
+
+void QHttpNetworkConnectionPool::connectionOpened(QHttpNetworkConnectionPrivate *connection)
+{
+    QMutexLocker locker(&mutex);
+    const auto it = counters.find(connection);
+    if (it != counters.end())
+        ++it->connectionsOpened;
+}
+
+void QHttpNetworkConnectionPool::wakeWaiting()
+{
+    if (waiting.isEmpty())
+        return;
+
+    // only wake the waiting connections if one of them can get a channel now
+    int open = 0;
+    bool idle = false;
+    for (QHttpNetworkConnectionPrivate *c : qAsConst(connections)) {
+        for (int i = 0; i < c->channelCount; ++i) {
+            const QAbstractSocket *socket = c->channels[i].socket;
+            if (socket && socket->state() != QAbstractSocket::UnconnectedState) {
+                ++open;
+                idle = idle || (c->isChannelIdle(i) && !waiting.contains(c));
+            }
+        }
+    }
+    const int max = maximum.load();
+    if (max > 0 && open >= max && !idle)
+        return;
+
+    const QVector<QHttpNetworkConnectionPrivate *> woken = std::move(waiting);
+    waiting.clear();
+    for (QHttpNetworkConnectionPrivate *c : woken)
+        QMetaObject::invokeMethod(c->q_ptr, "_q_startNextRequest", Qt::QueuedConnection);
+}
+
 #ifndef QT_NO_BEARERMANAGEMENT
 QHttpNetworkConnection::QHttpNetworkConnection(const QString &hostName, quint16 port, bool encrypt,
                                                QHttpNetworkConnection::ConnectionType connectionType,
@@ -1518,6 +1791,28 @@ void QHttpNetworkConnection::preConnectFinished()
     d_func()->preConnectRequests--;
 }
 
+void QHttpNetworkConnection::setPipelineLength(int length)
+{
+    d_func()->pipelineLength = length;
+}
+
+void QHttpNetworkConnection::setIdleTimeout(int msecs)
+{
+    d_func()->idleTimeout = msecs;
+}
+
+void QHttpNetworkConnection::setConnectionPool(const QSharedPointer<QHttpNetworkConnectionPool> &pool)
+{
+    Q_D(QHttpNetworkConnection);
+    if (d->pool == pool)
+        return;
+    if (d->pool)
+        d->pool->removeConnection(d);
+    d->pool = pool;
+    if (d->pool)
+        d->pool->addConnection(d);
+}
+
 #ifndef QT_NO_NETWORKPROXY
 // only called from QHttpNetworkConnectionChannel::_q_proxyAuthenticationRequired, not
 // from QHttpNetworkConnectionChannel::handleAuthenticationChallenge
@@ -56,6 +56,7 @@
 #include <QtNetwork/qnetworkreply.h>
 #include <QtNetwork/qabstractsocket.h>
 #include <QtNetwork/qnetworksession.h>
+#include <QtNetwork/qnetworkaccessmanager.h>
 
 #include <private/qobject_p.h>
 #include <qauthenticator.h>
@@ -63,6 +64,9 @@
 #include <qbuffer.h>
 #include <qtimer.h>
 #include <qsharedpointer.h>
+#include <qmutex.h>
+#include <qhash.h>
+#include <qvector.h>
 
 #include <private/qhttpnetworkheader_p.h>
 #include <private/qhttpnetworkrequest_p.h>
@@ -86,6 +90,7 @@ class QSslContext;
 #endif // !QT_NO_SSL
 
 class QHttpNetworkConnectionPrivate;
+class QHttpNetworkConnectionPool;
 class Q_AUTOTEST_EXPORT QHttpNetworkConnection : public QObject
 {
     Q_OBJECT
@@ -153,6 +158,10 @@ public:
 
     void preConnectFinished();
 
+    void setPipelineLength(int length);
+    void setIdleTimeout(int msecs);
+    void setConnectionPool(const QSharedPointer<QHttpNetworkConnectionPool> &pool);
+
 private:
     Q_DECLARE_PRIVATE(QHttpNetworkConnection)
     Q_DISABLE_COPY(QHttpNetworkConnection)
@@ -167,6 +176,7 @@ private:
     Q_PRIVATE_SLOT(d_func(), void _q_startNextRequest())
     Q_PRIVATE_SLOT(d_func(), void _q_hostLookupFinished(QHostInfo))
     Q_PRIVATE_SLOT(d_func(), void _q_connectDelayedChannel())
+    Q_PRIVATE_SLOT(d_func(), void _q_closeIdleChannels())
 };
 
 
@@ -181,6 +191,7 @@ public:
     static const int defaultHttpChannelCount;
     static const int defaultPipelineLength;
     static const int defaultRePipelineLength;
+    static const int defaultIdleTimeout;
 
     enum ConnectionState {
         RunningState = 0,
@@ -233,9 +244,15 @@ public:
 
     // private slots
     void _q_startNextRequest(); // send the next request from the queue
+    void startNextRequest();
 
     void _q_hostLookupFinished(const QHostInfo &info);
     void _q_connectDelayedChannel();
+    void _q_closeIdleChannels();
+
+    bool isChannelIdle(int i) const;
+    void scheduleIdleCheck();
+    static qint64 currentTime();
 
     void createAuthorization(QAbstractSocket *socket, QHttpNetworkRequest &request);
 
@@ -288,9 +305,60 @@ public:
 
     Http2::ProtocolParameters http2Parameters;
 
+    // HTTP/1.1 requests pipelined behind the one being read:
+    int pipelineLength;
+    // Connected channels unused for this long get closed:
+    int idleTimeout;
+    QTimer idleTimer;
+    QSharedPointer<QHttpNetworkConnectionPool> pool;
+
     friend class QHttpNetworkConnectionChannel;
 };
 
+// Shared by all connections of one QNetworkAccessManager. It enforces the
+// limit on connections open at the same time and collects the per-host
+// statistics. Everything but the statistics is only used from the thread
+// the connections live in.
+class Q_AUTOTEST_EXPORT QHttpNetworkConnectionPool
+{
+public:
+    QHttpNetworkConnectionPool();
+
+    void setMaximumConnections(int count);
+    int maximumConnections() const;
+
+    QVector<QNetworkAccessManager::HostConnectionStatistics> statistics() const;
+
+    void addConnection(QHttpNetworkConnectionPrivate *connection);
+    void removeConnection(QHttpNetworkConnectionPrivate *connection);
+
+    // true if connection may open one more channel now; otherwise it is
+    // woken up through _q_startNextRequest once a channel becomes available
+    bool reserveChannel(QHttpNetworkConnectionPrivate *connection);
+    void connectionUpdated(QHttpNetworkConnectionPrivate *connection);
+    void connectionOpened(QHttpNetworkConnectionPrivate *connection);
+
+private:
+    struct Counters {
+        QString hostName;
+        quint16 port;
+        bool encrypted;
+        int activeConnections;
+        int idleConnections;
+        int queuedRequests;
+        quint64 connectionsOpened;
+    };
+
+    void wakeWaiting();
+
+    mutable QMutex mutex;
+    QAtomicInt maximum;
+    QHash<const QHttpNetworkConnectionPrivate *, Counters> counters; // guarded by mutex
+    QVector<Counters> retired; // guarded by mutex
+    QVector<QHttpNetworkConnectionPrivate *> connections;
+    QVector<QHttpNetworkConnectionPrivate *> waiting;
+};
+
 
 
 QT_END_NAMESPACE
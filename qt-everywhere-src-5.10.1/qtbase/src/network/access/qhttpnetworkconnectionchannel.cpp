@@ -96,6 +96,7 @@ QHttpNetworkConnectionChannel::QHttpNetworkConnectionChannel()
     , lastStatus(0)
     , pendingEncrypt(false)
     , reconnectAttempts(reconnectAttemptsDefault)
+    , lastUsed(0)
     , authMethod(QAuthenticatorPrivate::None)
     , proxyAuthMethod(QAuthenticatorPrivate::None)
     , authenticationCredentialsSent(false)
@@ -250,6 +251,7 @@ void QHttpNetworkConnectionChannel::abort()
 bool QHttpNetworkConnectionChannel::sendRequest()
 {
     Q_ASSERT(!protocolHandler.isNull());
+    lastUsed = QHttpNetworkConnectionPrivate::currentTime();
     return protocolHandler->sendRequest();
 }
 
@@ -490,6 +492,7 @@ void QHttpNetworkConnectionChannel::allDone()
     // reset the reconnection attempts after we receive a complete reply.
     // in case of failures, each channel will attempt two reconnects before emitting error.
     reconnectAttempts = reconnectAttemptsDefault;
+    lastUsed = QHttpNetworkConnectionPrivate::currentTime();
 
     // now the channel can be seen as free/idle again, all signal emissions for the reply have been done
     if (state != QHttpNetworkConnectionChannel::ClosingState)
@@ -541,8 +544,10 @@ void QHttpNetworkConnectionChannel::allDone()
         if (connectionCloseEnabled)
             if (socket->state() != QAbstractSocket::UnconnectedState)
                 close();
-        if (qobject_cast<QHttpNetworkConnection*>(connection))
+        if (qobject_cast<QHttpNetworkConnection*>(connection)) {
+            connection->d_func()->scheduleIdleCheck();
             QMetaObject::invokeMethod(connection, "_q_startNextRequest", Qt::QueuedConnection);
+        }
     }
 }
 
@@ -834,6 +839,9 @@ void QHttpNetworkConnectionChannel::_q_disconnected()
     requeueCurrentlyPipelinedRequests();
 
     pendingEncrypt = false;
+
+    if (connection->d_func()->pool)
+        connection->d_func()->pool->connectionUpdated(connection->d_func());
 }
 
 
@@ -877,6 +885,10 @@ void QHttpNetworkConnectionChannel::_q_connected()
     // not sure yet if it helps, but it makes sense
     socket->setSocketOption(QAbstractSocket::KeepAliveOption, 1);
 
+    lastUsed = QHttpNetworkConnectionPrivate::currentTime();
+    if (connection->d_func()->pool)
+        connection->d_func()->pool->connectionOpened(connection->d_func());
+
     pipeliningSupported = QHttpNetworkConnectionChannel::PipeliningSupportUnknown;
 
     // ### FIXME: if the server closes the connection unexpectedly, we shouldn't send the same broken request again!
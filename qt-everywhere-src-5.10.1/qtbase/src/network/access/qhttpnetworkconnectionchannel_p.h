@@ -116,6 +116,7 @@ public:
     int lastStatus; // last status received on this channel
     bool pendingEncrypt; // for https (send after encrypted)
     int reconnectAttempts; // maximum 2 reconnection attempts
+    qint64 lastUsed; // QHttpNetworkConnectionPrivate::currentTime() of the last request or reply
     QAuthenticatorPrivate::Method authMethod;
     QAuthenticatorPrivate::Method proxyAuthMethod;
     QAuthenticator authenticator;
@@ -58,7 +58,7 @@
 #include <qplatformdefs.h>
 
 #ifndef QT_NO_COMPRESS
-struct z_stream_s;
+#include <QtCore/private/qcompressiondevice_p.h>
 #endif
 
 #include <QtNetwork/qtcpsocket.h>
@@ -274,8 +274,8 @@ public:
     QUrl redirectUrl;
 
 #ifndef QT_NO_COMPRESS
-    z_stream_s *inflateStrm;
-    int initializeInflateStream();
+    QZlibStream inflateStrm;
+    bool initializeInflateStream();
     qint64 uncompressBodyData(QByteDataBuffer *in, QByteDataBuffer *out);
 #endif
 };
@@ -49,6 +49,9 @@
 #include "private/qhttpnetworkreply_p.h"
 #include "private/qnetworkaccesscache_p.h"
 #include "private/qnoncontiguousbytedevice_p.h"
+#ifndef QT_NO_SSL
+#include "private/qsslsocket_p.h"
+#endif
 
 #ifndef QT_NO_HTTP
 
@@ -182,15 +185,15 @@ class QNetworkAccessCachedHttpConnection: public QHttpNetworkConnection,
     // Q_OBJECT
 public:
 #ifdef QT_NO_BEARERMANAGEMENT
-    QNetworkAccessCachedHttpConnection(const QString &hostName, quint16 port, bool encrypt,
-                                       QHttpNetworkConnection::ConnectionType connectionType)
-        : QHttpNetworkConnection(hostName, port, encrypt, connectionType)
+    QNetworkAccessCachedHttpConnection(quint16 channelCount, const QString &hostName, quint16 port,
+                                       bool encrypt, QHttpNetworkConnection::ConnectionType connectionType)
+        : QHttpNetworkConnection(channelCount, hostName, port, encrypt, /*parent=*/0, connectionType)
 #else
-    QNetworkAccessCachedHttpConnection(const QString &hostName, quint16 port, bool encrypt,
-                                       QHttpNetworkConnection::ConnectionType connectionType,
+    QNetworkAccessCachedHttpConnection(quint16 channelCount, const QString &hostName, quint16 port,
+                                       bool encrypt, QHttpNetworkConnection::ConnectionType connectionType,
                                        QSharedPointer<QNetworkSession> networkSession)
-        : QHttpNetworkConnection(hostName, port, encrypt, connectionType, /*parent=*/0,
-                                 qMove(networkSession))
+        : QHttpNetworkConnection(channelCount, hostName, port, encrypt, /*parent=*/0,
+                                 qMove(networkSession), connectionType)
 #endif
     {
         setExpires(true);
@@ -204,6 +207,41 @@ public:
 #endif
         delete this;
     }
+
+#ifndef QT_NO_SSL
+    void setInitialSslConfiguration(const QSslConfiguration &config)
+    {
+        initialSslConfiguration = config;
+        setSslConfiguration(config);
+    }
+
+    // RFC 7540, 9.1.1: a request for another origin may reuse this connection
+    // if it negotiated HTTP/2 and the server certificate is valid for that host.
+    // The caller still has to verify that the host resolves to the peer address.
+    bool canCoalesce(const QString &host, const QSslConfiguration &config)
+    {
+        if (connectionType() != ConnectionTypeHTTP2 || !isSsl())
+            return false;
+        const QHttpNetworkConnectionChannel &channel = channels()[0];
+        QSslSocket *socket = qobject_cast<QSslSocket *>(channel.socket);
+        if (!socket || !socket->isEncrypted() || socket->state() != QAbstractSocket::ConnectedState)
+            return false;
+        // a connection whose certificate errors were ignored must not vouch for other hosts
+        if (channel.ignoreAllSslErrors || !channel.ignoreSslErrorsList.isEmpty())
+            return false;
+        if (!(initialSslConfiguration == config))
+            return false;
+        return QSslSocketPrivate::isMatchingHostname(socket->peerCertificate(), host);
+    }
+
+    QHostAddress peerAddress() const
+    {
+        return channels()[0].socket ? channels()[0].socket->peerAddress() : QHostAddress();
+    }
+
+private:
+    QSslConfiguration initialSslConfiguration;
+#endif
 };
 
 
@@ -228,6 +266,9 @@ QHttpThreadDelegate::~QHttpThreadDelegate()
 QHttpThreadDelegate::QHttpThreadDelegate(QObject *parent) :
     QObject(parent)
     , ssl(false)
+#ifndef QT_NO_SSL
+    , coalesceHttp2Connections(false)
+#endif
     , downloadBufferMaximumSize(0)
     , readBufferMaxSize(0)
     , bytesEmitted(0)
@@ -244,6 +285,9 @@ QHttpThreadDelegate::QHttpThreadDelegate(QObject *parent) :
     , httpConnection(0)
     , httpReply(0)
     , synchronousRequestLoop(0)
+#ifndef QT_NO_SSL
+    , coalescingLookupId(-1)
+#endif
 {
 }
 
@@ -284,6 +328,7 @@ void QHttpThreadDelegate::startRequest()
     if (!connections.hasLocalData()) {
         connections.setLocalData(new QNetworkAccessCache());
     }
+    connections.localData()->setExpiryTimeout(connectionPoolConfiguration.idleTimeout());
 
     // check if we have an open connection to this host
     QUrl urlCopy = httpRequest.url();
@@ -323,17 +368,90 @@ void QHttpThreadDelegate::startRequest()
 
     // the http object is actually a QHttpNetworkConnection
     httpConnection = static_cast<QNetworkAccessCachedHttpConnection *>(connections.localData()->requestEntryNow(cacheKey));
+#ifndef QT_NO_SSL
+    if (httpConnection == 0 && startCoalescingLookup(urlCopy))
+        return;
+#endif
+    startRequestOnConnection(urlCopy, connectionType);
+}
+
+#ifndef QT_NO_SSL
+// Looks for an open HTTP/2 connection to another host that could also serve
+// this request. If there is one, we only reuse it once we know that our host
+// resolves to the address it is connected to.
+bool QHttpThreadDelegate::startCoalescingLookup(const QUrl &url)
+{
+    if (!coalesceHttp2Connections || synchronous || !ssl || !httpRequest.isHTTP2Allowed())
+        return false;
+#ifndef QT_NO_NETWORKPROXY
+    if (transparentProxy.type() != QNetworkProxy::NoProxy
+        || cacheProxy.type() != QNetworkProxy::NoProxy) {
+        return false;
+    }
+#endif
+    const QString host = url.host();
+    if (host.isEmpty() || !QHostAddress(host).isNull())
+        return false;
+
+    const auto entries = connections.localData()->entries();
+    for (QNetworkAccessCache::CacheableObject *entry : entries) {
+        QNetworkAccessCachedHttpConnection *connection
+            = static_cast<QNetworkAccessCachedHttpConnection *>(entry);
+        if (connection->port() == url.port() && connection->hostName() != host
+            && connection->canCoalesce(host, *incomingSslConfiguration)) {
+            coalescingCandidate = connection;
+            break;
+        }
+    }
+    if (!coalescingCandidate)
+        return false;
+
+    coalescingLookupId = QHostInfo::lookupHost(host, this, SLOT(coalescingLookupFinished(QHostInfo)));
+    return true;
+}
+
+void QHttpThreadDelegate::coalescingLookupFinished(const QHostInfo &hostInfo)
+{
+    if (hostInfo.lookupId() != coalescingLookupId)
+        return;
+    coalescingLookupId = -1;
+
+    QUrl urlCopy = httpRequest.url();
+    urlCopy.setPort(urlCopy.port(443));
+
+    // someone may have opened a connection to our host in the meantime
+    httpConnection = static_cast<QNetworkAccessCachedHttpConnection *>(connections.localData()->requestEntryNow(cacheKey));
+    if (!httpConnection && coalescingCandidate
+        && coalescingCandidate->canCoalesce(urlCopy.host(), *incomingSslConfiguration)
+        && hostInfo.addresses().contains(coalescingCandidate->peerAddress())) {
+        cacheKey = coalescingCandidate->cacheKey();
+        httpConnection = static_cast<QNetworkAccessCachedHttpConnection *>(connections.localData()->requestEntryNow(cacheKey));
+    }
+    coalescingCandidate.clear();
+
+    startRequestOnConnection(urlCopy, QHttpNetworkConnection::ConnectionTypeHTTP2);
+}
+#endif // QT_NO_SSL
+
+void QHttpThreadDelegate::startRequestOnConnection(const QUrl &urlCopy,
+                                                   QHttpNetworkConnection::ConnectionType connectionType)
+{
     if (httpConnection == 0) {
         // no entry in cache; create an object
         // the http object is actually a QHttpNetworkConnection
+        const quint16 channelCount = connectionPoolConfiguration.maximumConnectionsPerHost();
 #ifdef QT_NO_BEARERMANAGEMENT
-        httpConnection = new QNetworkAccessCachedHttpConnection(urlCopy.host(), urlCopy.port(), ssl,
-                                                                connectionType);
+        httpConnection = new QNetworkAccessCachedHttpConnection(channelCount, urlCopy.host(),
+                                                                urlCopy.port(), ssl, connectionType);
 #else
-        httpConnection = new QNetworkAccessCachedHttpConnection(urlCopy.host(), urlCopy.port(), ssl,
-                                                                connectionType,
+        httpConnection = new QNetworkAccessCachedHttpConnection(channelCount, urlCopy.host(),
+                                                                urlCopy.port(), ssl, connectionType,
                                                                 networkSession);
 #endif // QT_NO_BEARERMANAGEMENT
+        httpConnection->setPipelineLength(connectionPoolConfiguration.maximumPipelinedRequests());
+        httpConnection->setIdleTimeout(connectionPoolConfiguration.idleTimeout());
+        if (connectionPool)
+            httpConnection->setConnectionPool(connectionPool);
         if (connectionType == QHttpNetworkConnection::ConnectionTypeHTTP2
             && http2Parameters.validate()) {
             httpConnection->setHttp2Parameters(http2Parameters);
@@ -341,7 +459,7 @@ void QHttpThreadDelegate::startRequest()
 #ifndef QT_NO_SSL
         // Set the QSslConfiguration from this QNetworkRequest.
         if (ssl)
-            httpConnection->setSslConfiguration(*incomingSslConfiguration);
+            httpConnection->setInitialSslConfiguration(*incomingSslConfiguration);
 #endif
 
 #ifndef QT_NO_NETWORKPROXY
@@ -416,6 +534,12 @@ void QHttpThreadDelegate::abortRequest()
 {
 #ifdef QHTTPTHREADDELEGATE_DEBUG
     qDebug() << "QHttpThreadDelegate::abortRequest() thread=" << QThread::currentThreadId() << "sync=" << synchronous;
+#endif
+#ifndef QT_NO_SSL
+    if (coalescingLookupId != -1) {
+        QHostInfo::abortHostLookup(coalescingLookupId);
+        coalescingLookupId = -1;
+    }
 #endif
     if (httpReply) {
         httpReply->abort();
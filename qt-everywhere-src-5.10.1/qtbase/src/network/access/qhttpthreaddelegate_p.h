@@ -64,9 +64,12 @@
 #include "qhttpnetworkconnection_p.h"
 #include <QSharedPointer>
 #include <QScopedPointer>
+#include <QPointer>
+#include <QHostInfo>
 #include "private/qnoncontiguousbytedevice_p.h"
 #include "qnetworkaccessauthenticationmanager_p.h"
 #include <QtNetwork/private/http2protocol_p.h>
+#include <QtNetwork/qhttpconnectionpoolconfiguration.h>
 
 #ifndef QT_NO_HTTP
 
@@ -90,6 +93,8 @@ public:
     bool ssl;
 #ifndef QT_NO_SSL
     QScopedPointer<QSslConfiguration> incomingSslConfiguration;
+    // share HTTP/2 connections between hosts, see QNetworkAccessManager::setHttp2Enabled()
+    bool coalesceHttp2Connections;
 #endif
     QHttpNetworkRequest httpRequest;
     qint64 downloadBufferMaximumSize;
@@ -117,6 +122,8 @@ public:
     QNetworkReply::NetworkError incomingErrorCode;
     QString incomingErrorDetail;
     Http2::ProtocolParameters http2Parameters;
+    QHttpConnectionPoolConfiguration connectionPoolConfiguration;
+    QSharedPointer<QHttpNetworkConnectionPool> connectionPool;
 #ifndef QT_NO_BEARERMANAGEMENT
     QSharedPointer<QNetworkSession> networkSession;
 #endif
@@ -132,6 +139,16 @@ protected:
     // Used for implementing the synchronous HTTP, see startRequestSynchronously()
     QEventLoop *synchronousRequestLoop;
 
+#ifndef QT_NO_SSL
+    // An HTTP/2 connection to another host that this request may share,
+    // pending the lookup of this request's host
+    QPointer<QNetworkAccessCachedHttpConnection> coalescingCandidate;
+    int coalescingLookupId;
+
+    bool startCoalescingLookup(const QUrl &url);
+#endif
+    void startRequestOnConnection(const QUrl &url, QHttpNetworkConnection::ConnectionType connectionType);
+
 signals:
     void authenticationRequired(const QHttpNetworkRequest &request, QAuthenticator *);
 #ifndef QT_NO_NETWORKPROXY
@@ -175,6 +192,7 @@ protected slots:
     void encryptedSlot();
     void sslErrorsSlot(const QList<QSslError> &errors);
     void preSharedKeyAuthenticationRequiredSlot(QSslPreSharedKeyAuthenticator *authenticator);
+    void coalescingLookupFinished(const QHostInfo &hostInfo);
 #endif
 
     void synchronousAuthenticationRequiredSlot(const QHttpNetworkRequest &request, QAuthenticator *);
@@ -102,7 +102,7 @@ void QNetworkAccessCache::CacheableObject::setShareable(bool enable)
 }
 
 QNetworkAccessCache::QNetworkAccessCache()
-    : oldest(0), newest(0)
+    : oldest(0), newest(0), expiryTimeoutMsecs(ExpiryTime * 1000)
 {
 }
 
@@ -132,6 +132,20 @@ void QNetworkAccessCache::clear()
     oldest = newest = 0;
 }
 
+/*!
+    Sets the time an entry is kept after it was last released to \a msecs
+    milliseconds. Entries released before this call keep their expiry time.
+ */
+void QNetworkAccessCache::setExpiryTimeout(int msecs)
+{
+    expiryTimeoutMsecs = msecs;
+}
+
+int QNetworkAccessCache::expiryTimeout() const
+{
+    return expiryTimeoutMsecs;
+}
+
 /*!
     Appends the entry given by \a key to the end of the linked list.
     (i.e., makes it the newest entry)
@@ -157,7 +171,7 @@ void QNetworkAccessCache::linkEntry(const QByteArray &key)
         oldest = node;
     }
 
-    node->timestamp = QDateTime::currentDateTimeUtc().addSecs(ExpiryTime);
+    node->timestamp = QDateTime::currentDateTimeUtc().addMSecs(expiryTimeoutMsecs);
     newest = node;
 }
 
@@ -265,6 +279,16 @@ bool QNetworkAccessCache::hasEntry(const QByteArray &key) const
     return hash.contains(key);
 }
 
+// Returns all cached objects, whether they are in use or not.
+QVector<QNetworkAccessCache::CacheableObject *> QNetworkAccessCache::entries() const
+{
+    QVector<CacheableObject *> result;
+    result.reserve(hash.size());
+    for (NodeHash::ConstIterator it = hash.constBegin(); it != hash.constEnd(); ++it)
+        result.append(it->object);
+    return result;
+}
+
 bool QNetworkAccessCache::requestEntry(const QByteArray &key, QObject *target, const char *member)
 {
     NodeHash::Iterator it = hash.find(key);
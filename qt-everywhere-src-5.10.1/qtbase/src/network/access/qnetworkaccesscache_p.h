@@ -56,6 +56,7 @@
 #include "QtCore/qbasictimer.h"
 #include "QtCore/qbytearray.h"
 #include "QtCore/qhash.h"
+#include "QtCore/qvector.h"
 #include "QtCore/qmetatype.h"
 
 QT_BEGIN_NAMESPACE
@@ -95,8 +96,12 @@ public:
 
     void clear();
 
+    void setExpiryTimeout(int msecs);
+    int expiryTimeout() const;
+
     void addEntry(const QByteArray &key, CacheableObject *entry);
     bool hasEntry(const QByteArray &key) const;
+    QVector<CacheableObject *> entries() const;
     bool requestEntry(const QByteArray &key, QObject *target, const char *member);
     CacheableObject *requestEntryNow(const QByteArray &key);
     void releaseEntry(const QByteArray &key);
@@ -113,6 +118,7 @@ private:
     NodeHash hash;
     Node *oldest;
     Node *newest;
+    int expiryTimeoutMsecs;
 
     QBasicTimer timer;
 
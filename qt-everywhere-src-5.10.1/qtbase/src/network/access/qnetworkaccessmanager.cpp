@@ -46,6 +46,8 @@
 #include "qnetworkcookiejar.h"
 #include "qabstractnetworkcache.h"
 #include "qhstspolicy.h"
+#include "qhttp2configuration.h"
+#include "qhttpconnectionpoolconfiguration.h"
 #include "qhsts_p.h"
 
 #include "QtNetwork/qnetworksession.h"
@@ -70,6 +72,7 @@
 #include "qhttpmultipart_p.h"
 
 #include "qnetworkreplyhttpimpl_p.h"
+#include "qhttpnetworkconnection_p.h"
 
 #include "qthread.h"
 
@@ -1238,6 +1241,185 @@ QNetworkRequest::RedirectPolicy QNetworkAccessManager::redirectPolicy() const
     return d->redirectPolicy;
 }
 
+/*!
+    \since 5.11
+
+    If \a enabled is \c true, encrypted HTTP requests that set neither
+    QNetworkRequest::HTTP2AllowedAttribute nor
+    QNetworkRequest::SpdyAllowedAttribute are allowed to use HTTP/2. The
+    protocol is negotiated with ALPN during the TLS handshake, so servers
+    that do not support HTTP/2 are still talked to with HTTP/1.1. Setting
+    HTTP2AllowedAttribute on a request overrides this setting. Unencrypted
+    requests are not affected.
+
+    With HTTP/2 enabled, QNetworkAccessManager also reuses an HTTP/2
+    connection for requests to other hosts, if the host name resolves to
+    the address the connection was made to and the certificate the server
+    presented is valid for the host name (connection coalescing, RFC 7540,
+    section 9.1.1). This allows a single connection to multiplex the
+    requests to all hosts served under one certificate, such as the
+    subdomains of a site. Connections are not coalesced when a proxy is
+    used, when SSL errors were ignored on the connection, or when the
+    requests use different SSL configurations.
+
+    By default HTTP/2 is disabled.
+
+    \sa isHttp2Enabled(), QNetworkRequest::HTTP2AllowedAttribute
+*/
+void QNetworkAccessManager::setHttp2Enabled(bool enabled)
+{
+    Q_D(QNetworkAccessManager);
+    d->http2Enabled = enabled;
+}
+
+/*!
+    \since 5.11
+
+    Returns \c true if HTTP/2 is used for encrypted requests that do not
+    choose a protocol themselves.
+
+    \sa setHttp2Enabled()
+*/
+bool QNetworkAccessManager::isHttp2Enabled() const
+{
+    Q_D(const QNetworkAccessManager);
+    return d->http2Enabled;
+}
+
+/*!
+    \since 5.11
+
+    Sets the HTTP/2 parameters, such as the flow control window sizes, to
+    \a configuration. The parameters are used for HTTP/2 connections opened
+    after this call; connections that are already open keep their settings.
+
+    \sa http2Configuration(), QNetworkRequest::HTTP2AllowedAttribute
+*/
+void QNetworkAccessManager::setHttp2Configuration(const QHttp2Configuration &configuration)
+{
+    Q_D(QNetworkAccessManager);
+    d->http2Configuration = configuration;
+}
+
+/*!
+    \since 5.11
+
+    Returns the HTTP/2 parameters used for new HTTP/2 connections.
+
+    \sa setHttp2Configuration()
+*/
+QHttp2Configuration QNetworkAccessManager::http2Configuration() const
+{
+    Q_D(const QNetworkAccessManager);
+    return d->http2Configuration;
+}
+
+/*!
+    \class QNetworkAccessManager::HostConnectionStatistics
+    \inmodule QtNetwork
+    \since 5.11
+
+    \brief The HostConnectionStatistics struct describes the HTTP connections
+    of a QNetworkAccessManager to one server.
+
+    \sa QNetworkAccessManager::hostConnectionStatistics()
+*/
+
+/*!
+    \variable QNetworkAccessManager::HostConnectionStatistics::hostName
+    The name of the server.
+*/
+
+/*!
+    \variable QNetworkAccessManager::HostConnectionStatistics::port
+    The port of the server.
+*/
+
+/*!
+    \variable QNetworkAccessManager::HostConnectionStatistics::encrypted
+    Whether the connections use TLS.
+*/
+
+/*!
+    \variable QNetworkAccessManager::HostConnectionStatistics::activeConnections
+    The number of connections that are being opened or are sending or
+    receiving. An HTTP/2 connection counts as active for as long as it is open.
+*/
+
+/*!
+    \variable QNetworkAccessManager::HostConnectionStatistics::idleConnections
+    The number of open connections that are waiting to be reused.
+*/
+
+/*!
+    \variable QNetworkAccessManager::HostConnectionStatistics::queuedRequests
+    The number of requests that wait for a connection to become available.
+*/
+
+/*!
+    \variable QNetworkAccessManager::HostConnectionStatistics::connectionsOpened
+    The number of connections opened to the server since the manager was
+    created.
+*/
+
+/*!
+    \since 5.11
+
+    Sets the limits of the HTTP connection pool to \a configuration.
+    The limit on the total number of connections takes effect immediately;
+    the other settings apply to connections opened after this call.
+
+    Synchronous requests, see QNetworkRequest::SynchronousRequestAttribute,
+    do not count against the limit on the total number of connections.
+
+    \sa httpConnectionPoolConfiguration(), hostConnectionStatistics()
+*/
+void QNetworkAccessManager::setHttpConnectionPoolConfiguration(const QHttpConnectionPoolConfiguration &configuration)
+{
+    Q_D(QNetworkAccessManager);
+    d->httpConnectionPoolConfiguration = configuration;
+#ifndef QT_NO_HTTP
+    if (d->httpConnectionPool)
+        d->httpConnectionPool->setMaximumConnections(configuration.maximumConnections());
+#endif
+}
+
+/*!
+    \since 5.11
+
+    Returns the limits of the HTTP connection pool.
+
+    \sa setHttpConnectionPoolConfiguration()
+*/
+QHttpConnectionPoolConfiguration QNetworkAccessManager::httpConnectionPoolConfiguration() const
+{
+    Q_D(const QNetworkAccessManager);
+    return d->httpConnectionPoolConfiguration;
+}
+
+/*!
+    \since 5.11
+
+    Returns the state of the HTTP connections this manager has opened,
+    one entry per server. Servers the manager no longer has connections to
+    are still listed, so that HostConnectionStatistics::connectionsOpened
+    can be used to see how well connections were reused.
+
+    The statistics are updated by the thread that handles the connections,
+    so they can lag slightly behind the replies' signals.
+
+    \sa setHttpConnectionPoolConfiguration()
+*/
+QVector<QNetworkAccessManager::HostConnectionStatistics> QNetworkAccessManager::hostConnectionStatistics() const
+{
+#ifndef QT_NO_HTTP
+    Q_D(const QNetworkAccessManager);
+    if (d->httpConnectionPool)
+        return d->httpConnectionPool->statistics();
+#endif
+    return QVector<HostConnectionStatistics>();
+}
+
 /*!
     \since 4.7
 
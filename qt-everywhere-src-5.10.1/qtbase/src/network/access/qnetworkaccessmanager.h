@@ -64,6 +64,8 @@ class QNetworkProxy;
 class QNetworkProxyFactory;
 class QSslError;
 class QHstsPolicy;
+class QHttp2Configuration;
+class QHttpConnectionPoolConfiguration;
 #ifndef QT_NO_BEARERMANAGEMENT
 class QNetworkConfiguration;
 #endif
@@ -100,6 +102,17 @@ public:
     Q_ENUM(NetworkAccessibility)
 #endif
 
+    struct HostConnectionStatistics
+    {
+        QString hostName;
+        quint16 port = 0;
+        bool encrypted = false;
+        int activeConnections = 0;
+        int idleConnections = 0;
+        int queuedRequests = 0;
+        quint64 connectionsOpened = 0;
+    };
+
     explicit QNetworkAccessManager(QObject *parent = Q_NULLPTR);
     ~QNetworkAccessManager();
 
@@ -161,6 +174,16 @@ public:
     void setRedirectPolicy(QNetworkRequest::RedirectPolicy policy);
     QNetworkRequest::RedirectPolicy redirectPolicy() const;
 
+    void setHttp2Enabled(bool enabled);
+    bool isHttp2Enabled() const;
+
+    void setHttp2Configuration(const QHttp2Configuration &configuration);
+    QHttp2Configuration http2Configuration() const;
+
+    void setHttpConnectionPoolConfiguration(const QHttpConnectionPoolConfiguration &configuration);
+    QHttpConnectionPoolConfiguration httpConnectionPoolConfiguration() const;
+    QVector<HostConnectionStatistics> hostConnectionStatistics() const;
+
 Q_SIGNALS:
 #ifndef QT_NO_NETWORKPROXY
     void proxyAuthenticationRequired(const QNetworkProxy &proxy, QAuthenticator *authenticator);
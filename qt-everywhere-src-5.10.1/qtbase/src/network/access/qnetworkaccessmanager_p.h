@@ -58,6 +58,8 @@
 #include "qnetworkrequest.h"
 #include "qhstsstore_p.h"
 #include "qhsts_p.h"
+#include "qhttp2configuration.h"
+#include "qhttpconnectionpoolconfiguration.h"
 #include "private/qobject_p.h"
 #include "QtNetwork/qnetworkproxy.h"
 #include "QtNetwork/qnetworksession.h"
@@ -72,6 +74,7 @@ class QAuthenticator;
 class QAbstractNetworkCache;
 class QNetworkAuthenticationCredential;
 class QNetworkCookieJar;
+class QHttpNetworkConnectionPool;
 
 class QNetworkAccessManagerPrivate: public QObjectPrivate
 {
@@ -215,6 +218,15 @@ public:
     QScopedPointer<QHstsStore> stsStore;
     bool stsEnabled = false;
 
+    bool http2Enabled = false;
+    QHttp2Configuration http2Configuration;
+
+    QHttpConnectionPoolConfiguration httpConnectionPoolConfiguration;
+#ifndef QT_NO_HTTP
+    // shared with the HTTP connections living in thread
+    QSharedPointer<QHttpNetworkConnectionPool> httpConnectionPool;
+#endif
+
 #ifndef QT_NO_BEARERMANAGEMENT
     Q_AUTOTEST_EXPORT static const QWeakPointer<const QNetworkSession> getNetworkSession(const QNetworkAccessManager *manager);
 #endif
@@ -49,6 +49,7 @@
 #include <qdatastream.h>
 #include <qdatetime.h>
 #include <qdiriterator.h>
+#include <qsavefile.h>
 #include <qurl.h>
 #include <qcryptographichash.h>
 #include <qdebug.h>
@@ -57,6 +58,7 @@
 #define PREPARED_SLASH QLatin1String("prepared/")
 #define CACHE_VERSION 8
 #define DATA_DIR QLatin1String("data")
+#define INDEX_FILE QLatin1String("index")
 
 #define MAX_COMPRESSION_SIZE (1024 * 1024 * 3)
 
@@ -74,6 +76,12 @@ QT_BEGIN_NAMESPACE
     are compressed using qCompress.  Data is written to disk only in insert()
     and updateMetaData().
 
+    The size and the order of last use of the cache files are kept in an
+    index in memory, so looking up a URL that is not cached and expiring
+    the cache do not need to access the file system. The index is saved in
+    the cache directory when the cache is destroyed and loaded when it is
+    first used; if it is missing, it is rebuilt from the cache files.
+
     Currently you cannot share the same cache files with more than
     one disk cache.
 
@@ -113,6 +121,8 @@ QNetworkDiskCache::~QNetworkDiskCache()
 {
     Q_D(QNetworkDiskCache);
     qDeleteAll(d->inserting);
+    if (d->indexLoaded)
+        d->writeIndex();
 }
 
 /*!
@@ -142,6 +152,12 @@ void QNetworkDiskCache::setCacheDirectory(const QString &cacheDir)
     Q_D(QNetworkDiskCache);
     if (cacheDir.isEmpty())
         return;
+    if (d->indexLoaded) {
+        d->writeIndex();
+        d->clearIndex();
+        d->indexLoaded = false;
+    }
+    d->currentCacheSize = -1;
     d->cacheDirectory = cacheDir;
     QDir dir(d->cacheDirectory);
     d->cacheDirectory = dir.absolutePath();
@@ -270,8 +286,9 @@ void QNetworkDiskCachePrivate::storeItem(QCacheItem *cacheItem)
     QString fileName = cacheFileName(cacheItem->metaData.url());
     Q_ASSERT(!fileName.isEmpty());
 
+    ensureIndex();
     if (QFile::exists(fileName)) {
-        if (!QFile::remove(fileName)) {
+        if (!removeFile(fileName)) {
             qWarning() << "QNetworkDiskCache: couldn't remove the cache file " << fileName;
             return;
         }
@@ -294,10 +311,11 @@ void QNetworkDiskCachePrivate::storeItem(QCacheItem *cacheItem)
         && cacheItem->file->error() == QFile::NoError) {
         cacheItem->file->setAutoRemove(false);
         // ### use atomic rename rather then remove & rename
-        if (cacheItem->file->rename(fileName))
-            currentCacheSize += cacheItem->file->size();
-        else
+        if (cacheItem->file->rename(fileName)) {
+            addToIndex(uniqueFileName(cacheItem->metaData.url()), cacheItem->file->size());
+        } else {
             cacheItem->file->setAutoRemove(true);
+        }
     }
     if (cacheItem->metaData.url() == lastItem.metaData.url())
         lastItem.reset();
@@ -343,8 +361,12 @@ bool QNetworkDiskCachePrivate::removeFile(const QString &file)
     if (!fileName.endsWith(CACHE_POSTFIX))
         return false;
     qint64 size = info.size();
+    const QString key = indexKey(file);
     if (QFile::remove(file)) {
-        currentCacheSize -= size;
+        if (findIndexEntry(key))
+            removeFromIndex(key);
+        else
+            currentCacheSize -= size;
         return true;
     }
     return false;
@@ -361,6 +383,14 @@ QNetworkCacheMetaData QNetworkDiskCache::metaData(const QUrl &url)
     Q_D(QNetworkDiskCache);
     if (d->lastItem.metaData.url() == url)
         return d->lastItem.metaData;
+    d->ensureIndex();
+    if (d->indexLoaded) {
+        QNetworkDiskCachePrivate::IndexEntry *entry =
+                d->findIndexEntry(QNetworkDiskCachePrivate::uniqueFileName(url));
+        if (!entry)
+            return QNetworkCacheMetaData();
+        d->touch(entry);
+    }
     return fileMetaData(d->cacheFileName(url));
 }
 
@@ -376,8 +406,12 @@ QNetworkCacheMetaData QNetworkDiskCache::fileMetaData(const QString &fileName) c
 #endif
     Q_D(const QNetworkDiskCache);
     QFile file(fileName);
-    if (!file.open(QFile::ReadOnly))
+    if (!file.open(QFile::ReadOnly)) {
+        // removed behind our back
+        QNetworkDiskCachePrivate *that = const_cast<QNetworkDiskCachePrivate*>(d);
+        that->removeFromIndex(d->indexKey(fileName));
         return QNetworkCacheMetaData();
+    }
     if (!d->lastItem.read(&file, false)) {
         file.close();
         QNetworkDiskCachePrivate *that = const_cast<QNetworkDiskCachePrivate*>(d);
@@ -402,9 +436,19 @@ QIODevice *QNetworkDiskCache::data(const QUrl &url)
         buffer.reset(new QBuffer);
         buffer->setData(d->lastItem.data.data());
     } else {
+        const QString key = QNetworkDiskCachePrivate::uniqueFileName(url);
+        d->ensureIndex();
+        if (d->indexLoaded) {
+            QNetworkDiskCachePrivate::IndexEntry *entry = d->findIndexEntry(key);
+            if (!entry)
+                return 0;
+            d->touch(entry);
+        }
         QScopedPointer<QFile> file(new QFile(d->cacheFileName(url)));
-        if (!file->open(QFile::ReadOnly | QIODevice::Unbuffered))
+        if (!file->open(QFile::ReadOnly | QIODevice::Unbuffered)) {
+            d->removeFromIndex(key);
             return 0;
+        }
 
         if (!d->lastItem.read(file.data(), true)) {
             file->close();
@@ -501,8 +545,10 @@ void QNetworkDiskCache::setMaximumCacheSize(qint64 size)
 
     When the current size of the cache is greater than the maximumCacheSize()
     older cache files are removed until the total size is less then 90% of
-    maximumCacheSize() starting with the oldest ones first using the file
-    creation date to determine how old a cache file is.
+    maximumCacheSize() starting with the least recently used ones. A cache
+    file is used when it is inserted, and when it is looked up with
+    metaData() or data(). For cache files already present when the index
+    had to be rebuilt, the file creation date is used instead.
 
     Subclasses can reimplement this function to change the order that cache
     files are removed taking into account information in the application
@@ -524,59 +570,27 @@ qint64 QNetworkDiskCache::expire()
         return 0;
     }
 
+    d->ensureIndex();
+
     // close file handle to prevent "in use" error when QFile::remove() is called
     d->lastItem.reset();
 
-    QDir::Filters filters = QDir::AllDirs | QDir:: Files | QDir::NoDotAndDotDot;
-    QDirIterator it(cacheDirectory(), filters, QDirIterator::Subdirectories);
-
-    QMultiMap<QDateTime, QString> cacheItems;
-    qint64 totalSize = 0;
-    while (it.hasNext()) {
-        QString path = it.next();
-        QFileInfo info = it.fileInfo();
-        QString fileName = info.fileName();
-        if (fileName.endsWith(CACHE_POSTFIX)) {
-            const QDateTime birthTime = info.fileTime(QFile::FileBirthTime);
-            cacheItems.insert(birthTime.isValid() ? birthTime
-                              : info.fileTime(QFile::FileMetadataChangeTime), path);
-            totalSize += info.size();
-        }
-    }
-
     int removedFiles = 0;
     qint64 goal = (maximumCacheSize() * 9) / 10;
-    QMultiMap<QDateTime, QString>::const_iterator i = cacheItems.constBegin();
-    while (i != cacheItems.constEnd()) {
-        if (totalSize < goal)
-            break;
-        QString name = i.value();
-        QFile file(name);
-
-        if (name.contains(PREPARED_SLASH)) {
-            for (QCacheItem *item : qAsConst(d->inserting)) {
-                if (item && item->file && item->file->fileName() == name) {
-                    delete item->file;
-                    item->file = 0;
-                    break;
-                }
-            }
-        }
-
-        qint64 size = file.size();
-        file.remove();
-        totalSize -= size;
+    while (d->indexSize >= goal && d->leastRecentlyUsed) {
+        const QString key = d->leastRecentlyUsed->key;
+        d->removeFromIndex(key);
+        QFile::remove(d->dataDirectory + key);
         ++removedFiles;
-        ++i;
     }
 #if defined(QNETWORKDISKCACHE_DEBUG)
     if (removedFiles > 0) {
         qDebug() << "QNetworkDiskCache::expire()"
                 << "Removed:" << removedFiles
-                << "Kept:" << cacheItems.count() - removedFiles;
+                << "Kept:" << d->index.count();
     }
 #endif
-    return totalSize;
+    return d->indexSize;
 }
 
 /*!
@@ -668,6 +682,7 @@ bool QCacheItem::canCompress() const
 enum
 {
     CacheMagic = 0xe8,
+    IndexMagic = 0xe9,
     CurrentCacheVersion = CACHE_VERSION
 };
 
@@ -736,4 +751,211 @@ bool QCacheItem::read(QFile *device, bool readData)
     return metaData.isValid();
 }
 
+QString QNetworkDiskCachePrivate::indexFileName() const
+{
+    return dataDirectory + INDEX_FILE;
+}
+
+/*!
+    Returns the index key of the cache file \a filePath, or an empty string
+    if the file is not in the data directory.
+ */
+QString QNetworkDiskCachePrivate::indexKey(const QString &filePath) const
+{
+    if (dataDirectory.isEmpty() || !filePath.startsWith(dataDirectory))
+        return QString();
+    return filePath.mid(dataDirectory.length());
+}
+
+/*!
+    Loads the index on first use, from the index file written when the cache
+    was last destroyed or, if there is none, by scanning the data directory.
+ */
+void QNetworkDiskCachePrivate::ensureIndex()
+{
+    if (indexLoaded || dataDirectory.isEmpty())
+        return;
+    indexLoaded = true;
+    if (!readIndex()) {
+        clearIndex();
+        scanDataDirectory();
+    }
+    // the index file is only written again when the cache is destroyed, so
+    // that after a crash the next cache rebuilds it rather than trusting it
+    QFile::remove(indexFileName());
+    currentCacheSize = indexSize;
+}
+
+bool QNetworkDiskCachePrivate::readIndex()
+{
+    QFile file(indexFileName());
+    if (!file.open(QFile::ReadOnly))
+        return false;
+
+    const qint64 size = file.size();
+    const uchar *p = 0;
+#if !defined(Q_OS_INTEGRITY)
+    p = file.map(0, size);
+#endif
+    const QByteArray contents = p ? QByteArray::fromRawData((const char *)p, size) : file.readAll();
+    QDataStream in(contents);
+    in.setVersion(QDataStream::Qt_5_0);
+
+    qint32 marker;
+    qint32 version;
+    quint32 count;
+    in >> marker >> version >> count;
+    if (in.status() != QDataStream::Ok || marker != IndexMagic || version != CurrentCacheVersion
+        || count > quint64(size) / sizeof(qint64)) {
+        return false;
+    }
+
+    index.reserve(count);
+    for (quint32 i = 0; i < count; ++i) {
+        QString key;
+        qint64 fileSize;
+        in >> key >> fileSize;
+        if (in.status() != QDataStream::Ok || key.isEmpty() || fileSize < 0)
+            return false;
+        addToIndex(key, fileSize);
+    }
+    return true;
+}
+
+/*!
+    Rebuilds the index from the files in the data directory. Without any
+    record of the last uses, the oldest files are considered the least
+    recently used ones.
+ */
+void QNetworkDiskCachePrivate::scanDataDirectory()
+{
+    QMultiMap<QDateTime, QPair<QString, qint64> > cacheItems;
+    QDirIterator it(dataDirectory, QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        QString path = it.next();
+        QFileInfo info = it.fileInfo();
+        if (info.fileName().endsWith(CACHE_POSTFIX)) {
+            const QDateTime birthTime = info.fileTime(QFile::FileBirthTime);
+            cacheItems.insert(birthTime.isValid() ? birthTime
+                              : info.fileTime(QFile::FileMetadataChangeTime),
+                              qMakePair(path.mid(dataDirectory.length()), info.size()));
+        }
+    }
+    for (auto i = cacheItems.cbegin(), end = cacheItems.cend(); i != end; ++i)
+        addToIndex(i.value().first, i.value().second);
+
+    // remove files left over by insertions that never completed
+    QDirIterator prepared(cacheDirectory + PREPARED_SLASH, QDir::Files | QDir::NoDotAndDotDot);
+    while (prepared.hasNext()) {
+        const QString path = prepared.next();
+        if (!path.endsWith(CACHE_POSTFIX))
+            continue;
+        bool inUse = false;
+        for (QCacheItem *item : qAsConst(inserting)) {
+            if (item && item->file && item->file->fileName() == path) {
+                inUse = true;
+                break;
+            }
+        }
+        if (!inUse)
+            QFile::remove(path);
+    }
+}
+
+void QNetworkDiskCachePrivate::writeIndex()
+{
+    if (index.isEmpty())
+        return;
+
+    QSaveFile file(indexFileName());
+    if (!file.open(QIODevice::WriteOnly))
+        return;
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << qint32(IndexMagic) << qint32(CurrentCacheVersion) << quint32(index.size());
+    for (IndexEntry *entry = leastRecentlyUsed; entry; entry = entry->next)
+        out << entry->key << entry->size;
+    if (!file.commit())
+        qWarning() << "QNetworkDiskCache: couldn't write the index file" << file.fileName();
+}
+
+void QNetworkDiskCachePrivate::clearIndex()
+{
+    qDeleteAll(index);
+    index.clear();
+    indexSize = 0;
+    leastRecentlyUsed = 0;
+    mostRecentlyUsed = 0;
+}
+
+QNetworkDiskCachePrivate::IndexEntry *QNetworkDiskCachePrivate::findIndexEntry(const QString &key) const
+{
+    return index.value(key);
+}
+
+void QNetworkDiskCachePrivate::addToIndex(const QString &key, qint64 size)
+{
+    IndexEntry *&entry = index[key];
+    if (entry) {
+        indexSize -= entry->size;
+        currentCacheSize -= entry->size;
+        entry->size = size;
+        touch(entry);
+    } else {
+        entry = new IndexEntry;
+        entry->key = key;
+        entry->size = size;
+        entry->previous = mostRecentlyUsed;
+        entry->next = 0;
+        if (mostRecentlyUsed)
+            mostRecentlyUsed->next = entry;
+        else
+            leastRecentlyUsed = entry;
+        mostRecentlyUsed = entry;
+    }
+    indexSize += size;
+    currentCacheSize += size;
+}
+
+void QNetworkDiskCachePrivate::removeFromIndex(const QString &key)
+{
+    if (key.isEmpty())
+        return;
+    IndexEntry *entry = index.take(key);
+    if (!entry)
+        return;
+    unlink(entry);
+    indexSize -= entry->size;
+    currentCacheSize -= entry->size;
+    delete entry;
+}
+
+/*!
+    Marks \a entry as the most recently used one.
+ */
+void QNetworkDiskCachePrivate::touch(IndexEntry *entry)
+{
+    if (entry == mostRecentlyUsed)
+        return;
+    unlink(entry);
+    entry->previous = mostRecentlyUsed;
+    entry->next = 0;
+    mostRecentlyUsed->next = entry;
+    mostRecentlyUsed = entry;
+}
+
+void QNetworkDiskCachePrivate::unlink(IndexEntry *entry)
+{
+    if (entry->previous)
+        entry->previous->next = entry->next;
+    else
+        leastRecentlyUsed = entry->next;
+    if (entry->next)
+        entry->next->previous = entry->previous;
+    else
+        mostRecentlyUsed = entry->previous;
+    entry->previous = 0;
+    entry->next = 0;
+}
+
 QT_END_NAMESPACE
@@ -97,11 +97,28 @@ public:
 class QNetworkDiskCachePrivate : public QAbstractNetworkCachePrivate
 {
 public:
+    // a cache file in the index, linked in least recently used order
+    struct IndexEntry
+    {
+        QString key; // file name relative to dataDirectory
+        qint64 size;
+        IndexEntry *previous;
+        IndexEntry *next;
+    };
+
     QNetworkDiskCachePrivate()
         : QAbstractNetworkCachePrivate()
         , maximumCacheSize(1024 * 1024 * 50)
         , currentCacheSize(-1)
+        , indexLoaded(false)
+        , indexSize(0)
+        , leastRecentlyUsed(0)
+        , mostRecentlyUsed(0)
         {}
+    ~QNetworkDiskCachePrivate()
+    {
+        clearIndex();
+    }
 
     static QString uniqueFileName(const QUrl &url);
     QString cacheFileName(const QUrl &url) const;
@@ -111,12 +128,32 @@ public:
     void prepareLayout();
     static quint32 crc32(const char *data, uint len);
 
+    QString indexFileName() const;
+    QString indexKey(const QString &filePath) const;
+    void ensureIndex();
+    bool readIndex();
+    void scanDataDirectory();
+    void writeIndex();
+    void clearIndex();
+    IndexEntry *findIndexEntry(const QString &key) const;
+    void addToIndex(const QString &key, qint64 size);
+    void removeFromIndex(const QString &key);
+    void touch(IndexEntry *entry);
+    void unlink(IndexEntry *entry);
+
     mutable QCacheItem lastItem;
     QString cacheDirectory;
     QString dataDirectory;
     qint64 maximumCacheSize;
     qint64 currentCacheSize;
 
+    // once loaded, the index also keeps currentCacheSize up to date
+    bool indexLoaded;
+    qint64 indexSize;
+    QHash<QString, IndexEntry *> index;
+    IndexEntry *leastRecentlyUsed;
+    IndexEntry *mostRecentlyUsed;
+
     QHash<QIODevice*, QCacheItem*> inserting;
     Q_DECLARE_PUBLIC(QNetworkDiskCache)
 };
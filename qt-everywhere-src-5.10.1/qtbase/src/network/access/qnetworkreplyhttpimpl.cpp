@@ -57,6 +57,7 @@
 #include "QtCore/qcoreapplication.h"
 
 #include <QtCore/private/qthread_p.h>
+#include <QtNetwork/private/qtnetwork_tracepoints_p.h>
 
 #include "qnetworkcookiejar.h"
 
@@ -190,6 +191,11 @@ QNetworkReplyHttpImpl::QNetworkReplyHttpImpl(QNetworkAccessManager* const manage
     d->operation = operation;
     d->outgoingData = outgoingData;
     d->url = request.url();
+    const QVariant downloadSink = request.attribute(QNetworkRequest::DownloadSinkAttribute);
+    if (downloadSink.isValid()) {
+        d->downloadSink = downloadSink.value<QIODevice *>();
+        d->downloadToSink = true;
+    }
 #ifndef QT_NO_SSL
     if (request.url().scheme() == QLatin1String("https"))
         d->sslConfiguration.reset(new QSslConfiguration(request.sslConfiguration()));
@@ -460,6 +466,7 @@ QNetworkReplyHttpImplPrivate::QNetworkReplyHttpImplPrivate()
     , downloadBufferReadPosition(0)
     , downloadBufferCurrentSize(0)
     , downloadZerocopyBuffer(0)
+    , downloadToSink(false)
     , pendingDownloadDataEmissions(QSharedPointer<QAtomicInt>::create())
     , pendingDownloadProgressEmissions(QSharedPointer<QAtomicInt>::create())
     #ifndef QT_NO_SSL
@@ -619,6 +626,7 @@ QHttpNetworkRequest::Priority QNetworkReplyHttpImplPrivate::convert(const QNetwo
 void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpRequest)
 {
     Q_Q(QNetworkReplyHttpImpl);
+    Q_TRACE(QNetworkReplyHttpImpl_postRequest, q, newHttpRequest.url().toEncoded().constData());
 
     QThread *thread = 0;
     if (synchronous) {
@@ -767,10 +775,14 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
     if (newHttpRequest.attribute(QNetworkRequest::HttpPipeliningAllowedAttribute).toBool())
         httpRequest.setPipeliningAllowed(true);
 
-    if (request.attribute(QNetworkRequest::SpdyAllowedAttribute).toBool())
+    const bool spdyAllowed = request.attribute(QNetworkRequest::SpdyAllowedAttribute).toBool();
+    if (spdyAllowed)
         httpRequest.setSPDYAllowed(true);
 
-    if (request.attribute(QNetworkRequest::HTTP2AllowedAttribute).toBool())
+    // the manager's setting only applies to requests that don't choose a protocol
+    const QVariant http2Allowed = request.attribute(QNetworkRequest::HTTP2AllowedAttribute);
+    const bool defaultToHttp2 = managerPrivate->http2Enabled && ssl && !spdyAllowed;
+    if (http2Allowed.isValid() ? http2Allowed.toBool() : defaultToHttp2)
         httpRequest.setHTTP2Allowed(true);
 
     if (static_cast<QNetworkRequest::LoadControl>
@@ -788,6 +800,8 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
     const QVariant blob(manager->property(Http2::http2ParametersPropertyName));
     if (blob.isValid() && blob.canConvert<Http2::ProtocolParameters>())
         delegate->http2Parameters = blob.value<Http2::ProtocolParameters>();
+    else
+        delegate->http2Parameters = Http2::ProtocolParameters(managerPrivate->http2Configuration);
 #ifndef QT_NO_BEARERMANAGEMENT
     delegate->networkSession = managerPrivate->getNetworkSession();
 #endif
@@ -806,11 +820,24 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
 #ifndef QT_NO_SSL
     if (ssl)
         delegate->incomingSslConfiguration.reset(new QSslConfiguration(newHttpRequest.sslConfiguration()));
+    delegate->coalesceHttp2Connections = managerPrivate->http2Enabled;
 #endif
 
     // Do we use synchronous HTTP?
     delegate->synchronous = synchronous;
 
+    delegate->connectionPoolConfiguration = managerPrivate->httpConnectionPoolConfiguration;
+    if (!synchronous) {
+        // synchronous requests use their own thread and connections, which
+        // do not count against the limits of the manager's pool
+        if (!managerPrivate->httpConnectionPool) {
+            managerPrivate->httpConnectionPool.reset(new QHttpNetworkConnectionPool);
+            managerPrivate->httpConnectionPool->setMaximumConnections(
+                        managerPrivate->httpConnectionPoolConfiguration.maximumConnections());
+        }
+        delegate->connectionPool = managerPrivate->httpConnectionPool;
+    }
+
     // The authentication manager is used to avoid the BlockingQueuedConnection communication
     // from HTTP thread to user thread in some cases.
     delegate->authenticationManager = managerPrivate->authenticationManager;
@@ -818,7 +845,10 @@ void QNetworkReplyHttpImplPrivate::postRequest(const QNetworkRequest &newHttpReq
     if (!synchronous) {
         // Tell our zerocopy policy to the delegate
         QVariant downloadBufferMaximumSizeAttribute = newHttpRequest.attribute(QNetworkRequest::MaximumDownloadBufferSizeAttribute);
-        if (downloadBufferMaximumSizeAttribute.isValid()) {
+        if (downloadToSink) {
+            // the data goes to the sink as it arrives
+            delegate->downloadBufferMaximumSize = 0;
+        } else if (downloadBufferMaximumSizeAttribute.isValid()) {
             delegate->downloadBufferMaximumSize = downloadBufferMaximumSizeAttribute.toLongLong();
         } else {
             // If there is no MaximumDownloadBufferSizeAttribute set (which is for the majority
@@ -1040,6 +1070,8 @@ void QNetworkReplyHttpImplPrivate::replyDownloadData(QByteArray d)
     if (!q->isOpen())
         return;
 
+    Q_TRACE(QNetworkReplyHttpImpl_replyDownloadData, q, d.size());
+
     int pendingSignals = (int)pendingDownloadDataEmissions->fetchAndAddAcquire(-1) - 1;
 
     if (pendingSignals > 0) {
@@ -1076,8 +1108,12 @@ void QNetworkReplyHttpImplPrivate::replyDownloadData(QByteArray d)
         if (cacheSaveDevice)
             cacheSaveDevice->write(item.constData(), item.size());
 
-        if (!isHttpRedirectResponse())
-            buffer.append(item);
+        if (!isHttpRedirectResponse()) {
+            if (!downloadToSink)
+                buffer.append(item);
+            else if (!writeToDownloadSink(item))
+                return;
+        }
 
         bytesWritten += item.size();
     }
@@ -1093,7 +1129,8 @@ void QNetworkReplyHttpImplPrivate::replyDownloadData(QByteArray d)
 
     bytesDownloaded += bytesWritten;
 
-    emit q->readyRead();
+    if (!downloadToSink)
+        emit q->readyRead();
     // emit readyRead before downloadProgress incase this will cause events to be
     // processed and we get into a recursive call (as in QProgressDialog).
     if (downloadProgressSignalChoke.elapsed() >= progressSignalInterval) {
@@ -1104,6 +1141,25 @@ void QNetworkReplyHttpImplPrivate::replyDownloadData(QByteArray d)
 
 }
 
+// Returns false and fails the reply if the sink did not take all of \a data
+bool QNetworkReplyHttpImplPrivate::writeToDownloadSink(const QByteArray &data)
+{
+    Q_Q(QNetworkReplyHttpImpl);
+
+    if (downloadSink && downloadSink->write(data) == data.size())
+        return true;
+
+    const QString sinkError = downloadSink ? downloadSink->errorString()
+                                           : QCoreApplication::translate("QNetworkReply", "Device deleted");
+    q->QNetworkReply::close();
+    error(QNetworkReply::UnknownContentError,
+          QCoreApplication::translate("QNetworkReply", "Error writing downloaded data: %1").arg(sinkError));
+    finished();
+    state = Aborted;
+    emit q->abortHttpRequest();
+    return false;
+}
+
 void QNetworkReplyHttpImplPrivate::replyFinished()
 {
     // We are already loading from cache, we still however
@@ -1265,6 +1321,7 @@ void QNetworkReplyHttpImplPrivate::replyDownloadMetaData(const QList<QPair<QByte
 {
     Q_Q(QNetworkReplyHttpImpl);
     Q_UNUSED(contentLength);
+    Q_TRACE(QNetworkReplyHttpImpl_replyDownloadMetaData, q, sc, contentLength);
 
     statusCode = sc;
     reasonPhrase = rp;
@@ -1287,8 +1344,7 @@ void QNetworkReplyHttpImplPrivate::replyDownloadMetaData(const QList<QPair<QByte
     }
 
     q->setAttribute(QNetworkRequest::HttpPipeliningWasUsedAttribute, pu);
-    const QVariant http2Allowed = request.attribute(QNetworkRequest::HTTP2AllowedAttribute);
-    if (http2Allowed.isValid() && http2Allowed.toBool()) {
+    if (httpRequest.isHTTP2Allowed()) {
         q->setAttribute(QNetworkRequest::HTTP2WasUsedAttribute, spdyWasUsed);
         q->setAttribute(QNetworkRequest::SpdyWasUsedAttribute, false);
     } else {
@@ -1940,8 +1996,15 @@ void QNetworkReplyHttpImplPrivate::_q_cacheLoadReadyRead()
     // processed and we get into a recursive call (as in QProgressDialog).
 
     if (!(isHttpRedirectResponse())) {
-        // This readyRead() goes to the user. The user then may or may not read() anything.
-        emit q->readyRead();
+        if (downloadToSink) {
+            while (cacheLoadDevice->bytesAvailable()) {
+                if (!writeToDownloadSink(cacheLoadDevice->readAll()))
+                    return;
+            }
+        } else {
+            // This readyRead() goes to the user. The user then may or may not read() anything.
+            emit q->readyRead();
+        }
 
         if (downloadProgressSignalChoke.elapsed() >= progressSignalInterval) {
             downloadProgressSignalChoke.restart();
@@ -2217,6 +2280,7 @@ void QNetworkReplyHttpImplPrivate::finished()
 
     state = Finished;
     q->setFinished(true);
+    Q_TRACE(QNetworkReplyHttpImpl_finished, q, bytesDownloaded);
 
     if (totalSize.isNull() || totalSize == -1) {
         emit q->downloadProgress(bytesDownloaded, bytesDownloaded);
@@ -2248,6 +2312,7 @@ void QNetworkReplyHttpImplPrivate::error(QNetworkReplyImpl::NetworkError code, c
 
     errorCode = code;
     q->setErrorString(errorMessage);
+    Q_TRACE(QNetworkReplyHttpImpl_error, q, code);
 
     // note: might not be a good idea, since users could decide to delete us
     // which would delete the backend too...
@@ -259,6 +259,12 @@ public:
     QSharedPointer<char> downloadBufferPointer;
     char* downloadZerocopyBuffer;
 
+    // Set from QNetworkRequest::DownloadSinkAttribute, the body is written
+    // there instead of being buffered in the reply
+    QPointer<QIODevice> downloadSink;
+    bool downloadToSink;
+    bool writeToDownloadSink(const QByteArray &data);
+
     // Will be increased by HTTP thread:
     QSharedPointer<QAtomicInt> pendingDownloadDataEmissions;
     QSharedPointer<QAtomicInt> pendingDownloadProgressEmissions;
@@ -298,6 +298,20 @@ QT_BEGIN_NAMESPACE
         This attribute obsoletes FollowRedirectsAttribute.
         (This value was introduced in 5.9.)
 
+    \value DownloadSinkAttribute
+        Requests only, type: QMetaType::QObjectStar (a QIODevice pointer,
+        set with QVariant::fromValue()).
+        Indicates that the body of an HTTP reply is written to this
+        device as it is received, instead of being buffered in the
+        QNetworkReply. The reply then never has data to read and does
+        not emit readyRead(); downloadProgress() and finished() are
+        emitted as usual. This avoids copying the data out of the reply
+        for large downloads. The device must be open for writing, live
+        in the thread of the reply and stay valid until the reply has
+        finished. If it fails to take the data, the reply finishes with
+        QNetworkReply::UnknownContentError.
+        (This value was introduced in 5.11.)
+
     \value User
         Special type. Additional information can be passed in
         QVariants with types ranging from User to UserMax. The default
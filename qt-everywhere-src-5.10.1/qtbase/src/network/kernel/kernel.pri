@@ -5,6 +5,7 @@ INCLUDEPATH += $$PWD
 
 HEADERS += kernel/qtnetworkglobal.h \
            kernel/qtnetworkglobal_p.h \
+           kernel/qtnetwork_tracepoints_p.h \
            kernel/qauthenticator.h \
            kernel/qauthenticator_p.h \
            kernel/qdnslookup.h \
@@ -19,7 +20,8 @@ HEADERS += kernel/qtnetworkglobal.h \
            kernel/qnetworkinterface_p.h \
            kernel/qnetworkproxy.h
 
-SOURCES += kernel/qauthenticator.cpp \
+SOURCES += kernel/qtnetwork_tracepoints.cpp \
+           kernel/qauthenticator.cpp \
            kernel/qdnslookup.cpp \
            kernel/qhostaddress.cpp \
            kernel/qhostinfo.cpp \
@@ -33,6 +35,11 @@ qtConfig(ftp) {
 }
 
 unix {
+    !integrity:!android {
+        DEFINES += QT_HOSTINFO_DNS_RESOLVER
+        HEADERS += kernel/qdnsresolver_p.h
+        SOURCES += kernel/qdnsresolver.cpp
+    }
     !integrity: SOURCES += kernel/qdnslookup_unix.cpp
     SOURCES += kernel/qhostinfo_unix.cpp kernel/qnetworkinterface_unix.cpp
 }
@@ -67,3 +74,12 @@ else: qtConfig(libproxy) {
     QMAKE_USE_PRIVATE += libproxy libdl
 }
 else:SOURCES += kernel/qnetworkproxy_generic.cpp
+
+# Tracepoints are compiled out unless qmake is run with QT_TRACE_BACKEND=lttng
+# or QT_TRACE_BACKEND=etw, see qtrace_p.h
+equals(QT_TRACE_BACKEND, lttng) {
+    DEFINES += Q_TRACEPOINT QT_TRACE_BACKEND_LTTNG
+    LIBS_PRIVATE += -llttng-ust -ldl
+} else: equals(QT_TRACE_BACKEND, etw) {
+    DEFINES += Q_TRACEPOINT QT_TRACE_BACKEND_ETW
+}
@@ -85,6 +85,16 @@ public:
     QList<QDnsTextRecord> textRecords;
 };
 
+// Resolver settings of the system, as far as QDnsResolver is concerned.
+struct QDnsResolverConfiguration
+{
+    QList<QHostAddress> nameservers;
+    bool hasSearchList = false;
+    int ndots = 1;
+    int timeout = 5; // seconds, per attempt
+    int attempts = 2;
+};
+
 class QDnsLookupPrivate : public QObjectPrivate
 {
 public:
@@ -120,6 +130,11 @@ public:
     { }
     void run() Q_DECL_OVERRIDE;
 
+    // packet level helpers shared with QDnsResolver, only available on Unix
+    static QByteArray buildQuery(quint16 id, int requestType, const QByteArray &requestName);
+    static void parseReply(const unsigned char *response, int responseLength, QDnsLookupReply *reply);
+    static bool systemConfiguration(QDnsResolverConfiguration *configuration);
+
 signals:
     void finished(const QDnsLookupReply &reply);
 
@@ -63,6 +63,38 @@
 
 QT_BEGIN_NAMESPACE
 
+QByteArray QDnsLookupRunnable::buildQuery(quint16 id, int requestType, const QByteArray &requestName)
+{
+    // Header: our ID, recursion desired and a single question.
+    QByteArray packet;
+    packet.reserve(12 + requestName.size() + 6);
+    packet.append(char(id >> 8)).append(char(id & 0xff));
+    packet.append(char(0x01)).append(char(0x00));
+    static const char counts[] = { 0, 1, 0, 0, 0, 0, 0, 0 };
+    packet.append(counts, sizeof(counts));
+
+    // Question: the name as a sequence of labels, type and class.
+    const QList<QByteArray> labels = requestName.split('.');
+    for (int i = 0; i < labels.size(); ++i) {
+        const QByteArray &label = labels.at(i);
+        if (label.isEmpty()) {
+            // only the root label following a trailing dot may be empty
+            if (i != labels.size() - 1 || i == 0)
+                return QByteArray();
+            break;
+        }
+        if (label.size() > 63)
+            return QByteArray();
+        packet.append(char(label.size())).append(label);
+    }
+    packet.append(char(0));
+    if (packet.size() - 12 > 255)
+        return QByteArray();
+    packet.append(char(requestType >> 8)).append(char(requestType & 0xff));
+    packet.append(char(0x00)).append(char(0x01)); // C_IN
+    return packet;
+}
+
 #if QT_CONFIG(library)
 
 #if defined(Q_OS_OPENBSD)
@@ -207,11 +239,23 @@ void QDnsLookupRunnable::query(const int requestType, const QByteArray &requestN
         }
     }
 
-    unsigned char *response = buffer.data();
+    parseReply(buffer.data(), responseLength, reply);
+}
+
+void QDnsLookupRunnable::parseReply(const unsigned char *response, int responseLength, QDnsLookupReply *reply)
+{
+    // Load dn_expand on demand.
+    resolveLibrary();
+    if (!local_dn_expand) {
+        reply->error = QDnsLookup::ResolverError;
+        reply->errorString = tr("Resolver functions not found");
+        return;
+    }
+
     // Check the response header. Though res_nquery returns -1 as a
     // responseLength in case of error, we still can extract the
     // exact error code from the response.
-    HEADER *header = (HEADER*)response;
+    const HEADER *header = (const HEADER*)response;
     const int answerCount = ntohs(header->ancount);
     switch (header->rcode) {
     case NOERROR:
@@ -247,7 +291,7 @@ void QDnsLookupRunnable::query(const int requestType, const QByteArray &requestN
 
     // Skip the query host, type (2 bytes) and class (2 bytes).
     char host[PACKETSZ], answer[PACKETSZ];
-    unsigned char *p = response + sizeof(HEADER);
+    const unsigned char *p = response + sizeof(HEADER);
     int status = local_dn_expand(response, response + responseLength, p, host, sizeof(host));
     if (status < 0) {
         reply->error = QDnsLookup::InvalidReplyError;
@@ -268,6 +312,13 @@ void QDnsLookupRunnable::query(const int requestType, const QByteArray &requestN
         const QString name = QUrl::fromAce(host);
 
         p += status;
+        // The fixed part of the record and its data must be within the reply.
+        if (response + responseLength - p < 10
+                || response + responseLength - p - 10 < ((p[8] << 8) | p[9])) {
+            reply->error = QDnsLookup::InvalidReplyError;
+            reply->errorString = tr("Invalid reply received");
+            return;
+        }
         const quint16 type = (p[0] << 8) | p[1];
         p += 2; // RR type
         p += 2; // RR class
@@ -368,7 +419,7 @@ void QDnsLookupRunnable::query(const int requestType, const QByteArray &requestN
             record.d->weight = weight;
             reply->serviceRecords.append(record);
         } else if (type == QDnsLookup::TXT) {
-            unsigned char *txt = p;
+            const unsigned char *txt = p;
             QDnsTextRecord record;
             record.d->name = name;
             record.d->timeToLive = ttl;
@@ -380,7 +431,7 @@ void QDnsLookupRunnable::query(const int requestType, const QByteArray &requestN
                     reply->errorString = tr("Invalid text record");
                     return;
                 }
-                record.d->values << QByteArray((char*)txt, length);
+                record.d->values << QByteArray((const char*)txt, length);
                 txt += length;
             }
             reply->textRecords.append(record);
@@ -390,6 +441,43 @@ void QDnsLookupRunnable::query(const int requestType, const QByteArray &requestN
     }
 }
 
+bool QDnsLookupRunnable::systemConfiguration(QDnsResolverConfiguration *configuration)
+{
+    // Load res_ninit and res_nclose on demand.
+    resolveLibrary();
+    if (!local_res_nclose || !local_res_ninit)
+        return false;
+
+    struct __res_state state;
+    std::memset(&state, 0, sizeof(state));
+    if (local_res_ninit(&state) < 0)
+        return false;
+    QScopedPointer<struct __res_state, QDnsLookupStateDeleter> state_ptr(&state);
+
+    configuration->nameservers.clear();
+    for (int i = 0; i < state.nscount && i < MAXNS; ++i) {
+#if defined(Q_OS_LINUX)
+        // IPv6 nameservers only show up in the extended part of the state
+        if (const struct sockaddr_in6 *ns = state._u._ext.nsaddrs[i]) {
+            if (ns->sin6_family == AF_INET6) {
+                QHostAddress address(ns->sin6_addr.s6_addr);
+                if (ns->sin6_scope_id)
+                    address.setScopeId(QString::number(ns->sin6_scope_id));
+                configuration->nameservers.append(address);
+            }
+            continue;
+        }
+#endif
+        if (state.nsaddr_list[i].sin_family == AF_INET)
+            configuration->nameservers.append(QHostAddress(ntohl(state.nsaddr_list[i].sin_addr.s_addr)));
+    }
+    configuration->hasSearchList = state.dnsrch[0] && *state.dnsrch[0];
+    configuration->ndots = state.ndots;
+    configuration->timeout = qMax(1, int(state.retrans));
+    configuration->attempts = qMax(1, int(state.retry));
+    return true;
+}
+
 #else
 void QDnsLookupRunnable::query(const int requestType, const QByteArray &requestName, const QHostAddress &nameserver, QDnsLookupReply *reply)
 {
@@ -401,6 +489,20 @@ void QDnsLookupRunnable::query(const int requestType, const QByteArray &requestN
     return;
 }
 
+void QDnsLookupRunnable::parseReply(const unsigned char *response, int responseLength, QDnsLookupReply *reply)
+{
+    Q_UNUSED(response)
+    Q_UNUSED(responseLength)
+    reply->error = QDnsLookup::ResolverError;
+    reply->errorString = tr("Resolver library can't be loaded: No runtime library loading support");
+}
+
+bool QDnsLookupRunnable::systemConfiguration(QDnsResolverConfiguration *configuration)
+{
+    Q_UNUSED(configuration)
+    return false;
+}
+
 #endif /* QT_CONFIG(library) */
 
 QT_END_NAMESPACE
@@ -0,0 +1,586 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qdnsresolver_p.h"
+#include "qhostinfo_p.h"
+
+#ifndef QT_NO_UDPSOCKET
+
+#include <qfile.h>
+#include <qfileinfo.h>
+#include <qrandom.h>
+#include <qtimer.h>
+#include <qudpsocket.h>
+#include <qurl.h>
+#ifndef QT_NO_NETWORKINTERFACE
+#include <qnetworkinterface.h>
+#endif
+
+#include <netdb.h>
+
+QT_BEGIN_NAMESPACE
+
+static const quint16 NameserverPort = 53;
+static const int DnsHeaderSize = 12;
+
+// Compares the question sections, which servers echo back but may change the
+// case of.
+static bool isSameQuestion(const QByteArray &reply, const QByteArray &query)
+{
+    if (reply.size() < query.size() || reply.at(4) != query.at(4) || reply.at(5) != query.at(5))
+        return false;
+    for (int i = DnsHeaderSize; i < query.size(); ++i) {
+        char a = reply.at(i);
+        char b = query.at(i);
+        if (a >= 'A' && a <= 'Z')
+            a += 'a' - 'A';
+        if (b >= 'A' && b <= 'Z')
+            b += 'a' - 'A';
+        if (a != b)
+            return false;
+    }
+    return true;
+}
+
+/*
+    Returns \c true if host name lookups should go through QDnsResolver,
+    which is the case if the QT_HOSTINFO_DNS_RESOLVER environment variable
+    is set to a non-zero value.
+*/
+bool QDnsResolver::isEnabled()
+{
+    return qEnvironmentVariableIntValue("QT_HOSTINFO_DNS_RESOLVER") != 0;
+}
+
+QDnsResolver::QDnsResolver(QHostInfoLookupManager *manager)
+    : manager(manager),
+      timer(new QTimer(this)),
+      processingScheduled(false)
+{
+    familyConfigured[IPv6] = familyConfigured[IPv4] = true;
+    timer->setSingleShot(true);
+    connect(timer, &QTimer::timeout, this, &QDnsResolver::checkTimeouts);
+    connect(&thread, &QThread::finished, this, &QDnsResolver::shutdown, Qt::DirectConnection);
+    thread.setObjectName(QStringLiteral("Qt DNS resolver"));
+    moveToThread(&thread);
+    thread.start();
+}
+
+QDnsResolver::~QDnsResolver()
+{
+    thread.quit();
+    thread.wait();
+}
+
+// called by QHostInfoLookupManager
+void QDnsResolver::lookup(QHostInfoRunnable *r)
+{
+    QMutexLocker locker(&mutex);
+    scheduledLookups.enqueue(r);
+
+    // lookups started in a row are picked up in one go
+    if (!processingScheduled) {
+        processingScheduled = true;
+        QMetaObject::invokeMethod(this, "processScheduledLookups", Qt::QueuedConnection);
+    }
+}
+
+// called by QHostInfoLookupManager
+bool QDnsResolver::abortLookup(int id)
+{
+    QMutexLocker locker(&mutex);
+
+    for (int i = 0; i < scheduledLookups.size(); ++i) {
+        if (scheduledLookups.at(i)->id == id) {
+            delete scheduledLookups.takeAt(i);
+            return true;
+        }
+    }
+
+    for (Query *q : qAsConst(queries)) {
+        for (int i = 0; i < q->waiters.size(); ++i) {
+            if (q->waiters.at(i)->id == id) {
+                delete q->waiters.takeAt(i);
+                return true;
+            }
+        }
+    }
+
+    // not ours (any more), the manager takes care of it
+    return false;
+}
+
+void QDnsResolver::processScheduledLookups()
+{
+    {
+        QMutexLocker locker(&mutex);
+        processingScheduled = false;
+        refreshConfiguration();
+
+        while (!scheduledLookups.isEmpty()) {
+            QHostInfoRunnable *r = scheduledLookups.head();
+
+            // only one query per host name is in flight
+            if (Query *q = queries.value(r->toBeLookedUp)) {
+                q->waiters.append(scheduledLookups.dequeue());
+                if (q->delivered)
+                    deliver(q);
+                continue;
+            }
+
+            QByteArray aceName;
+            bool searchable = false;
+            if (!canResolve(r->toBeLookedUp, &aceName, &searchable)) {
+                handedBackLookups.append(scheduledLookups.dequeue());
+                continue;
+            }
+
+            // another lookup for the same host may have finished in the meantime
+            if (manager->cache.isEnabled()) {
+                bool valid = false;
+                const QHostInfo info = manager->cache.get(r->toBeLookedUp, &valid);
+                if (valid) {
+                    finishedLookups.append(qMakePair(scheduledLookups.dequeue(), info));
+                    continue;
+                }
+            }
+
+            // the rest is picked up again when a query finishes
+            if (queries.size() >= MaxConcurrentQueries)
+                break;
+
+            startQuery(scheduledLookups.dequeue(), aceName, searchable);
+        }
+
+        updateTimer();
+    }
+    emitResults();
+}
+
+void QDnsResolver::checkTimeouts()
+{
+    {
+        QMutexLocker locker(&mutex);
+        const QList<Query *> current = queries.values();
+        for (Query *q : current) {
+            // Happy Eyeballs: don't hold up the connection attempts any longer
+            // for a family that is slow to answer
+            if (!q->delivered && q->deliveryDeadline.hasExpired())
+                deliver(q);
+            if (q->retransmitDeadline.hasExpired())
+                retry(q);
+        }
+        updateTimer();
+    }
+    emitResults();
+}
+
+void QDnsResolver::shutdown()
+{
+    QMutexLocker locker(&mutex);
+    timer->stop();
+    for (Query *q : qAsConst(queries)) {
+        qDeleteAll(q->waiters);
+        delete q->socket;
+        delete q;
+    }
+    queries.clear();
+    qDeleteAll(scheduledLookups);
+    scheduledLookups.clear();
+    for (const auto &lookup : qAsConst(finishedLookups))
+        delete lookup.first;
+    finishedLookups.clear();
+    qDeleteAll(handedBackLookups);
+    handedBackLookups.clear();
+}
+
+void QDnsResolver::refreshConfiguration()
+{
+    if (lastRefresh.isValid() && !lastRefresh.hasExpired(RefreshInterval))
+        return;
+    lastRefresh.start();
+
+    if (!QDnsLookupRunnable::systemConfiguration(&configuration))
+        configuration.nameservers.clear();
+
+#ifndef QT_NO_NETWORKINTERFACE
+    // like AI_ADDRCONFIG, only ask for the address families we can connect to
+    familyConfigured[IPv6] = familyConfigured[IPv4] = false;
+    const QHostAddress linkLocal(QStringLiteral("fe80::"));
+    const QList<QHostAddress> localAddresses = QNetworkInterface::allAddresses();
+    for (const QHostAddress &address : localAddresses) {
+        if (address.isLoopback())
+            continue;
+        if (address.protocol() == QAbstractSocket::IPv4Protocol)
+            familyConfigured[IPv4] = true;
+        else if (address.protocol() == QAbstractSocket::IPv6Protocol && !address.isInSubnet(linkLocal, 10))
+            familyConfigured[IPv6] = true;
+    }
+#endif
+
+    // getaddrinfo() consults the hosts file before the DNS, so leave the
+    // names in there to it
+#if defined(_PATH_HOSTS)
+    const QString hostsPath = QFile::decodeName(_PATH_HOSTS);
+#else
+    const QString hostsPath = QStringLiteral("/etc/hosts");
+#endif
+    const QDateTime modified = QFileInfo(hostsPath).lastModified();
+    if (modified == hostsFileModified)
+        return;
+    hostsFileModified = modified;
+    hostsFileNames.clear();
+    QFile hostsFile(hostsPath);
+    if (!hostsFile.open(QIODevice::ReadOnly))
+        return;
+    while (!hostsFile.atEnd()) {
+        QByteArray line = hostsFile.readLine();
+        const int comment = line.indexOf('#');
+        if (comment != -1)
+            line.truncate(comment);
+        const QList<QByteArray> fields = line.simplified().split(' ');
+        // the first field is the address
+        for (int i = 1; i < fields.size(); ++i) {
+            QByteArray name = fields.at(i).toLower();
+            if (name.endsWith('.'))
+                name.chop(1);
+            hostsFileNames.insert(name);
+        }
+    }
+}
+
+bool QDnsResolver::canResolve(const QString &name, QByteArray *aceName, bool *searchable) const
+{
+    if (configuration.nameservers.isEmpty())
+        return false;
+
+    // reverse lookups are left to getnameinfo()
+    QHostAddress address;
+    if (address.setAddress(name))
+        return false;
+
+    QByteArray ace = QUrl::toAce(name).toLower();
+    const bool absolute = ace.endsWith('.');
+    if (absolute)
+        ace.chop(1);
+    if (ace.isEmpty())
+        return false;
+
+    // names getaddrinfo() doesn't (only) look for in the DNS
+    if (ace == "localhost" || ace.endsWith(".localhost") || ace.endsWith(".local")
+            || hostsFileNames.contains(ace)) {
+        return false;
+    }
+
+    // names with fewer dots than ndots are tried with the search list first
+    *searchable = !absolute && configuration.hasSearchList;
+    if (*searchable && ace.count('.') < configuration.ndots)
+        return false;
+
+    *aceName = ace;
+    return true;
+}
+
+void QDnsResolver::startQuery(QHostInfoRunnable *r, const QByteArray &aceName, bool searchable)
+{
+    Query *q = new Query;
+    q->name = r->toBeLookedUp;
+    q->searchable = searchable;
+    q->waiters.append(r);
+
+    // ask for both families at once (RFC 8305, section 3), unless we know
+    // that we can't use one of them
+    static const int types[2] = { QDnsLookup::AAAA, QDnsLookup::A };
+    const bool anyConfigured = familyConfigured[IPv6] || familyConfigured[IPv4];
+    for (int family = IPv6; family <= IPv4; ++family) {
+        if (anyConfigured && !familyConfigured[family])
+            continue;
+        const quint16 id = quint16(QRandomGenerator::global()->generate());
+        q->packets[family] = QDnsLookupRunnable::buildQuery(id, types[family], aceName);
+        q->pending[family] = !q->packets[family].isEmpty();
+    }
+
+    // not something we can put into a query
+    if (!q->pending[IPv6] && !q->pending[IPv4]) {
+        handedBackLookups += q->waiters;
+        delete q;
+        return;
+    }
+
+    q->socket = new QUdpSocket(this);
+    q->socket->bind(QHostAddress::Any);
+    connect(q->socket, &QUdpSocket::readyRead, this, [this, q]() { readReplies(q); });
+    queries.insert(q->name, q);
+    sendQueries(q);
+}
+
+void QDnsResolver::sendQueries(Query *q)
+{
+    const QHostAddress &server = configuration.nameservers.at(q->attempt % configuration.nameservers.size());
+    for (int family = IPv6; family <= IPv4; ++family) {
+        if (q->pending[family])
+            q->socket->writeDatagram(q->packets[family], server, NameserverPort);
+    }
+    q->retransmitDeadline.setRemainingTime(configuration.timeout * 1000);
+}
+
+void QDnsResolver::readReplies(Query *q)
+{
+    {
+        QMutexLocker locker(&mutex);
+        bool alive = true;
+        while (alive && q->socket->hasPendingDatagrams()) {
+            QByteArray datagram(int(qMax<qint64>(q->socket->pendingDatagramSize(), 0)), Qt::Uninitialized);
+            QHostAddress sender;
+            quint16 port = 0;
+            const qint64 size = q->socket->readDatagram(datagram.data(), datagram.size(), &sender, &port);
+            if (size < 0)
+                break;
+            datagram.resize(int(size));
+
+            // ignore anything that doesn't come from one of our nameservers
+            if (port != NameserverPort || !configuration.nameservers.contains(sender))
+                continue;
+            alive = handleReply(q, datagram);
+        }
+        updateTimer();
+    }
+    emitResults();
+}
+
+// Returns \c false if \a q has been removed.
+bool QDnsResolver::handleReply(Query *q, const QByteArray &datagram)
+{
+    if (datagram.size() < DnsHeaderSize)
+        return true;
+
+    // match the reply to the query by ID and question
+    int family = -1;
+    for (int i = IPv6; i <= IPv4; ++i) {
+        const QByteArray &packet = q->packets[i];
+        if (q->pending[i] && datagram.at(0) == packet.at(0) && datagram.at(1) == packet.at(1)
+                && isSameQuestion(datagram, packet)) {
+            family = i;
+            break;
+        }
+    }
+    const uchar *data = reinterpret_cast<const uchar *>(datagram.constData());
+    if (family == -1 || !(data[2] & 0x80))
+        return true;
+
+    // truncated, the TCP retry is left to getaddrinfo()
+    if (data[2] & 0x02) {
+        fallBack(q);
+        return false;
+    }
+
+    QDnsLookupReply reply;
+    QDnsLookupRunnable::parseReply(data, datagram.size(), &reply);
+    switch (reply.error) {
+    case QDnsLookup::NoError: {
+        const QAbstractSocket::NetworkLayerProtocol protocol = family == IPv6
+                ? QAbstractSocket::IPv6Protocol : QAbstractSocket::IPv4Protocol;
+        for (const QDnsHostAddressRecord &record : qAsConst(reply.hostAddressRecords)) {
+            if (record.value().protocol() != protocol)
+                continue;
+            if (!q->addresses[family].contains(record.value()))
+                q->addresses[family].append(record.value());
+            q->ttl = qMin(q->ttl, record.timeToLive());
+        }
+        for (const QDnsDomainNameRecord &record : qAsConst(reply.canonicalNameRecords))
+            q->ttl = qMin(q->ttl, record.timeToLive());
+        q->pending[family] = false;
+        break;
+    }
+    case QDnsLookup::NotFoundError:
+        // the name doesn't exist, whatever the record type
+        q->notFound = true;
+        q->pending[family] = false;
+        break;
+    default:
+        // try the next nameserver right away
+        return retry(q);
+    }
+    return updateQuery(q);
+}
+
+// Returns \c false if \a q has been removed.
+bool QDnsResolver::updateQuery(Query *q)
+{
+    if (!q->pending[IPv6] && !q->pending[IPv4]) {
+        finishQuery(q);
+        return false;
+    }
+
+    // one family has answered, give the other one the resolution delay
+    if (!q->delivered && q->deliveryDeadline.isForever()
+            && (!q->addresses[IPv6].isEmpty() || !q->addresses[IPv4].isEmpty())) {
+        q->deliveryDeadline.setRemainingTime(ResolutionDelay);
+    }
+    return true;
+}
+
+// Returns \c false if \a q has been removed.
+bool QDnsResolver::retry(Query *q)
+{
+    if (++q->attempt < configuration.attempts * configuration.nameservers.size()) {
+        sendQueries(q);
+        return true;
+    }
+
+    // out of attempts, go with what we have or let getaddrinfo() try
+    if (q->addresses[IPv6].isEmpty() && q->addresses[IPv4].isEmpty()) {
+        fallBack(q);
+        return false;
+    }
+    q->pending[IPv6] = q->pending[IPv4] = false;
+    finishQuery(q);
+    return false;
+}
+
+void QDnsResolver::deliver(Query *q)
+{
+    const QHostInfo info = result(q);
+    for (QHostInfoRunnable *r : qAsConst(q->waiters))
+        finishedLookups.append(qMakePair(r, info));
+    q->waiters.clear();
+    q->delivered = true;
+}
+
+void QDnsResolver::finishQuery(Query *q)
+{
+    // getaddrinfo() would go on with the search list
+    if (q->notFound && q->searchable
+            && q->addresses[IPv6].isEmpty() && q->addresses[IPv4].isEmpty()) {
+        fallBack(q);
+        return;
+    }
+
+    if (manager->cache.isEnabled())
+        manager->cache.put(q->name, result(q), int(qMin<quint32>(q->ttl, INT_MAX)));
+    deliver(q);
+    removeQuery(q);
+}
+
+void QDnsResolver::fallBack(Query *q)
+{
+    handedBackLookups += q->waiters;
+    q->waiters.clear();
+    removeQuery(q);
+}
+
+void QDnsResolver::removeQuery(Query *q)
+{
+    queries.remove(q->name);
+    // we may be called from its readyRead()
+    q->socket->disconnect(this);
+    q->socket->deleteLater();
+    delete q;
+
+    if (!scheduledLookups.isEmpty() && !processingScheduled) {
+        processingScheduled = true;
+        QMetaObject::invokeMethod(this, "processScheduledLookups", Qt::QueuedConnection);
+    }
+}
+
+void QDnsResolver::updateTimer()
+{
+    qint64 next = -1;
+    for (const Query *q : qAsConst(queries)) {
+        qint64 remaining = q->retransmitDeadline.remainingTime();
+        if (!q->delivered && !q->deliveryDeadline.isForever())
+            remaining = qMin(remaining, q->deliveryDeadline.remainingTime());
+        if (next == -1 || remaining < next)
+            next = remaining;
+    }
+
+    if (next == -1)
+        timer->stop();
+    else
+        timer->start(int(next));
+}
+
+void QDnsResolver::emitResults()
+{
+    QVector<QPair<QHostInfoRunnable *, QHostInfo> > results;
+    QList<QHostInfoRunnable *> handedBack;
+    {
+        QMutexLocker locker(&mutex);
+        results.swap(finishedLookups);
+        handedBack.swap(handedBackLookups);
+    }
+
+    for (const auto &lookup : qAsConst(results)) {
+        QHostInfo info = lookup.second;
+        info.setLookupId(lookup.first->id);
+        lookup.first->resultEmitter.emitResultsReady(info);
+        delete lookup.first;
+    }
+
+    for (QHostInfoRunnable *r : qAsConst(handedBack))
+        manager->startThreadPoolLookup(r);
+}
+
+QHostInfo QDnsResolver::result(const Query *q) const
+{
+    // interleave the families, starting with IPv6 (RFC 8305, section 4)
+    const QList<QHostAddress> &ipv6 = q->addresses[IPv6];
+    const QList<QHostAddress> &ipv4 = q->addresses[IPv4];
+    QList<QHostAddress> addresses;
+    addresses.reserve(ipv6.size() + ipv4.size());
+    for (int i = 0; i < qMax(ipv6.size(), ipv4.size()); ++i) {
+        if (i < ipv6.size())
+            addresses.append(ipv6.at(i));
+        if (i < ipv4.size())
+            addresses.append(ipv4.at(i));
+    }
+
+    QHostInfo info;
+    info.setHostName(q->name);
+    info.setAddresses(addresses);
+    if (addresses.isEmpty()) {
+        info.setError(QHostInfo::HostNotFound);
+        info.setErrorString(QHostInfoAgent::tr("Host not found"));
+    }
+    return info;
+}
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_UDPSOCKET
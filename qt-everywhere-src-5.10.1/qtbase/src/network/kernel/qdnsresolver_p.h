@@ -0,0 +1,167 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QDNSRESOLVER_P_H
+#define QDNSRESOLVER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of the QHostInfo class.  This header file may change from
+// version to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtNetwork/private/qtnetworkglobal_p.h>
+#include "QtCore/qobject.h"
+#include "QtCore/qthread.h"
+#include "QtCore/qmutex.h"
+#include "QtCore/qhash.h"
+#include "QtCore/qset.h"
+#include "QtCore/qqueue.h"
+#include "QtCore/qvector.h"
+#include "QtCore/qpair.h"
+#include "QtCore/qdatetime.h"
+#include "QtCore/qdeadlinetimer.h"
+#include "QtCore/qelapsedtimer.h"
+#include "QtNetwork/qhostaddress.h"
+#include "QtNetwork/qhostinfo.h"
+#include "private/qdnslookup_p.h"
+
+#ifndef QT_NO_UDPSOCKET
+
+QT_BEGIN_NAMESPACE
+
+class QTimer;
+class QUdpSocket;
+class QHostInfoRunnable;
+class QHostInfoLookupManager;
+
+// Resolves host names for QHostInfo by sending A and AAAA queries straight to
+// the configured nameservers, so that lookups don't tie up a thread each while
+// waiting for the network. Everything it can't answer with the same result as
+// getaddrinfo() (hosts file entries, search lists, truncated replies, servers
+// not responding) is handed back to the thread pool of QHostInfoLookupManager.
+class QDnsResolver : public QObject
+{
+    Q_OBJECT
+public:
+    explicit QDnsResolver(QHostInfoLookupManager *manager);
+    ~QDnsResolver();
+
+    static bool isEnabled();
+
+    // called from QHostInfoLookupManager, in any thread
+    void lookup(QHostInfoRunnable *r);
+    bool abortLookup(int id);
+
+private Q_SLOTS:
+    void processScheduledLookups();
+    void checkTimeouts();
+    void shutdown();
+
+private:
+    enum {
+        MaxConcurrentQueries = 64,
+        ResolutionDelay = 50, // msecs to wait for the second answer, RFC 8305
+        RefreshInterval = 5000 // msecs between rereading the system configuration
+    };
+
+    enum Family { IPv6 = 0, IPv4 = 1 };
+
+    // one host name being resolved, with everyone waiting for it
+    struct Query
+    {
+        QString name;
+        bool searchable = false;
+        QList<QHostInfoRunnable *> waiters;
+        QUdpSocket *socket = nullptr;
+        QByteArray packets[2];
+        bool pending[2] = { false, false };
+        QList<QHostAddress> addresses[2];
+        quint32 ttl = 0xffffffff;
+        bool notFound = false;
+        bool delivered = false;
+        int attempt = 0;
+        QDeadlineTimer retransmitDeadline;
+        QDeadlineTimer deliveryDeadline{QDeadlineTimer::Forever};
+    };
+
+    void refreshConfiguration();
+    bool canResolve(const QString &name, QByteArray *aceName, bool *searchable) const;
+    void startQuery(QHostInfoRunnable *r, const QByteArray &aceName, bool searchable);
+    void sendQueries(Query *q);
+    void readReplies(Query *q);
+    bool handleReply(Query *q, const QByteArray &datagram);
+    bool updateQuery(Query *q);
+    bool retry(Query *q);
+    void deliver(Query *q);
+    void finishQuery(Query *q);
+    void fallBack(Query *q);
+    void removeQuery(Query *q);
+    void updateTimer();
+    void emitResults();
+    QHostInfo result(const Query *q) const;
+
+    QHostInfoLookupManager *manager;
+    QThread thread;
+    QTimer *timer;
+
+    // guards everything below; results are emitted without holding it
+    QMutex mutex;
+    QQueue<QHostInfoRunnable *> scheduledLookups;
+    bool processingScheduled;
+    QHash<QString, Query *> queries;
+    QVector<QPair<QHostInfoRunnable *, QHostInfo> > finishedLookups;
+    QList<QHostInfoRunnable *> handedBackLookups;
+    QDnsResolverConfiguration configuration;
+    bool familyConfigured[2];
+    QSet<QByteArray> hostsFileNames;
+    QDateTime hostsFileModified;
+    QElapsedTimer lastRefresh;
+};
+
+QT_END_NAMESPACE
+
+#endif // QT_NO_UDPSOCKET
+
+#endif // QDNSRESOLVER_P_H
@@ -39,6 +39,9 @@
 
 #include "qhostinfo.h"
 #include "qhostinfo_p.h"
+#ifdef QT_HOSTINFO_DNS_RESOLVER
+#include "qdnsresolver_p.h"
+#endif
 
 #include "QtCore/qscopedpointer.h"
 #include <qabstracteventdispatcher.h>
@@ -178,7 +181,16 @@ void emit_results_ready(const QHostInfo &hostInfo, const QObject *receiver,
     but also changes the order of signal emissions when using lookupHost()
     compared to previous versions of Qt.
     \note Since Qt 4.6.3 QHostInfo is using a small internal 60 second DNS cache
-    for performance improvements.
+    for performance improvements. Since Qt 5.11 it also remembers for 10
+    seconds that a host was not found.
+
+    \note On Unix, setting the \c QT_HOSTINFO_DNS_RESOLVER environment variable
+    to \c 1 makes lookupHost() send its A and AAAA queries directly to the
+    nameservers in \c{/etc/resolv.conf}, instead of occupying a thread of the
+    pool for every lookup. Results are then cached as long as their time to
+    live allows, up to 60 seconds. Host names that the system resolver would
+    not look up in the DNS alone, such as those in \c{/etc/hosts}, are still
+    resolved by the system.
 
     \sa QAbstractSocket, {http://www.rfc-editor.org/rfc/rfc3492.txt}{RFC 3492}
 */
@@ -730,11 +742,17 @@ QHostInfoLookupManager::QHostInfoLookupManager() : mutex(QMutex::Recursive), was
     moveToThread(QCoreApplicationPrivate::mainThread());
     connect(QCoreApplication::instance(), SIGNAL(destroyed()), SLOT(waitForThreadPoolDone()), Qt::DirectConnection);
     threadPool.setMaxThreadCount(20); // do up to 20 DNS lookups in parallel
+#ifdef QT_HOSTINFO_DNS_RESOLVER
+    dnsResolver = QDnsResolver::isEnabled() ? new QDnsResolver(this) : nullptr;
+#endif
 }
 
 QHostInfoLookupManager::~QHostInfoLookupManager()
 {
     wasDeleted = true;
+#ifdef QT_HOSTINFO_DNS_RESOLVER
+    delete dnsResolver;
+#endif
 
     // don't qDeleteAll currentLookups, the QThreadPool has ownership
     clear();
@@ -812,6 +830,22 @@ void QHostInfoLookupManager::work()
 
 // called by QHostInfo
 void QHostInfoLookupManager::scheduleLookup(QHostInfoRunnable *r)
+{
+    if (wasDeleted)
+        return;
+
+#ifdef QT_HOSTINFO_DNS_RESOLVER
+    // the resolver calls startThreadPoolLookup() for what it can't handle
+    if (dnsResolver) {
+        dnsResolver->lookup(r);
+        return;
+    }
+#endif
+    startThreadPoolLookup(r);
+}
+
+// called by QHostInfoLookupManager and QDnsResolver
+void QHostInfoLookupManager::startThreadPoolLookup(QHostInfoRunnable *r)
 {
     if (wasDeleted)
         return;
@@ -827,6 +861,12 @@ void QHostInfoLookupManager::abortLookup(int id)
     if (wasDeleted)
         return;
 
+#ifdef QT_HOSTINFO_DNS_RESOLVER
+    // lookups the resolver is working on don't show up in our lists
+    if (dnsResolver && dnsResolver->abortLookup(id))
+        return;
+#endif
+
     QMutexLocker locker(&this->mutex);
 
     // is postponed? delete and return
@@ -920,9 +960,9 @@ void qt_qhostinfo_cache_inject(const QString &hostname, const QHostInfo &resolut
 }
 #endif
 
-// cache for 60 seconds
-// cache 128 items
-QHostInfoCache::QHostInfoCache() : max_age(60), enabled(true), cache(128)
+// cache for 60 seconds at most, negative results for 10 seconds
+// cache 1024 items
+QHostInfoCache::QHostInfoCache() : max_age(60), negative_max_age(10), enabled(true), cache(1024)
 {
 #ifdef QT_QHOSTINFO_CACHE_DISABLED_BY_DEFAULT
     enabled = false;
@@ -948,7 +988,7 @@ QHostInfo QHostInfoCache::get(const QString &name, bool *valid)
 
     *valid = false;
     if (QHostInfoCacheElement *element = cache.object(name)) {
-        if (element->age.elapsed() < max_age*1000)
+        if (!element->expiry.hasExpired())
             *valid = true;
         return element->info;
 
@@ -962,14 +1002,27 @@ QHostInfo QHostInfoCache::get(const QString &name, bool *valid)
 
 void QHostInfoCache::put(const QString &name, const QHostInfo &info)
 {
-    // if the lookup failed, don't cache
-    if (info.error() != QHostInfo::NoError)
+    put(name, info, max_age);
+}
+
+// ttl is the time to live in seconds reported by the DNS, it is capped to
+// max_age or negative_max_age.
+void QHostInfoCache::put(const QString &name, const QHostInfo &info, int ttl)
+{
+    // if the lookup failed for another reason than the host not existing,
+    // don't cache
+    if (info.error() == QHostInfo::NoError)
+        ttl = qMin(ttl, max_age);
+    else if (info.error() == QHostInfo::HostNotFound)
+        ttl = qMin(ttl, negative_max_age);
+    else
+        return;
+    if (ttl <= 0)
         return;
 
     QHostInfoCacheElement* element = new QHostInfoCacheElement();
     element->info = info;
-    element->age = QElapsedTimer();
-    element->age.start();
+    element->expiry = QDeadlineTimer(qint64(ttl) * 1000);
 
     QMutexLocker locker(&this->mutex);
     cache.insert(name, element); // cache will take ownership
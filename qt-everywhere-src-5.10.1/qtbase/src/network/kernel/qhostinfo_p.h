@@ -66,6 +66,7 @@
 #include "QtCore/qlist.h"
 #include "QtCore/qqueue.h"
 #include <QElapsedTimer>
+#include <QDeadlineTimer>
 #include <QCache>
 
 #include <QNetworkSession>
@@ -74,6 +75,11 @@
 
 QT_BEGIN_NAMESPACE
 
+#if defined(QT_HOSTINFO_DNS_RESOLVER) && defined(QT_NO_UDPSOCKET)
+#  undef QT_HOSTINFO_DNS_RESOLVER
+#endif
+
+class QDnsResolver;
 
 class QHostInfoResult : public QObject
 {
@@ -169,9 +175,11 @@ class QHostInfoCache
 public:
     QHostInfoCache();
     const int max_age; // seconds
+    const int negative_max_age; // seconds
 
     QHostInfo get(const QString &name, bool *valid);
     void put(const QString &name, const QHostInfo &info);
+    void put(const QString &name, const QHostInfo &info, int ttl);
     void clear();
 
     bool isEnabled();
@@ -180,7 +188,7 @@ private:
     bool enabled;
     struct QHostInfoCacheElement {
         QHostInfo info;
-        QElapsedTimer age;
+        QDeadlineTimer expiry;
     };
     QCache<QString,QHostInfoCacheElement> cache;
     QMutex mutex;
@@ -232,6 +240,9 @@ public:
     void scheduleLookup(QHostInfoRunnable *r);
     void abortLookup(int id);
 
+    // called from QDnsResolver for what it cannot resolve itself
+    void startThreadPoolLookup(QHostInfoRunnable *r);
+
     // called from QHostInfoRunnable
     void lookupFinished(QHostInfoRunnable *r);
     bool wasAborted(int id);
@@ -245,6 +256,9 @@ protected:
     QList<int> abortedLookups; // ids of aborted lookups
 
     QThreadPool threadPool;
+#ifdef QT_HOSTINFO_DNS_RESOLVER
+    QDnsResolver *dnsResolver;
+#endif
 
     QMutex mutex;
 
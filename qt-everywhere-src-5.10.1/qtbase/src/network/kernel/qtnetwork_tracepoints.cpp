@@ -0,0 +1,74 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+// Instantiates the tracepoints declared in qtnetwork_tracepoints_p.h, see qtrace_p.h.
+
+#include <QtCore/private/qtrace_p.h>
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED) && defined(QT_TRACE_BACKEND_LTTNG)
+#  define TRACEPOINT_CREATE_PROBES
+#  define TRACEPOINT_DEFINE
+#endif
+
+#include "qtnetwork_tracepoints_p.h"
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED) && defined(QT_TRACE_BACKEND_ETW)
+
+// The provider GUID is derived from the provider name the way EventSource
+// does it, so that tools can also enable the provider by name.
+TRACELOGGING_DEFINE_PROVIDER(qtnetwork_provider, "QtNetwork",
+    (0x25d26a3a, 0x9d14, 0x5b54, 0x1f, 0x75, 0xfd, 0x08, 0xf1, 0x61, 0xfb, 0xd8));
+
+QT_BEGIN_NAMESPACE
+
+static void qt_qtnetwork_register_trace_provider()
+{
+    TraceLoggingRegister(qtnetwork_provider);
+}
+Q_CONSTRUCTOR_FUNCTION(qt_qtnetwork_register_trace_provider)
+
+static void qt_qtnetwork_unregister_trace_provider()
+{
+    TraceLoggingUnregister(qtnetwork_provider);
+}
+Q_DESTRUCTOR_FUNCTION(qt_qtnetwork_unregister_trace_provider)
+
+QT_END_NAMESPACE
+
+#endif // Q_TRACEPOINT && QT_TRACE_BACKEND_ETW
@@ -0,0 +1,311 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtNetwork module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+// Tracepoints of the QtNetwork module, see qtrace_p.h. With the LTTng backend this
+// header is read several times by <lttng/tracepoint-event.h>, which is why
+// the event definitions are not covered by the include guard.
+
+#include <QtCore/private/qtrace_p.h>
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED) && defined(QT_TRACE_BACKEND_LTTNG)
+
+#undef TRACEPOINT_PROVIDER
+#define TRACEPOINT_PROVIDER qtnetwork
+
+#undef TRACEPOINT_INCLUDE
+#define TRACEPOINT_INCLUDE <QtNetwork/private/qtnetwork_tracepoints_p.h>
+
+#if !defined(QTNETWORK_TRACEPOINTS_P_H_LTTNG) || defined(TRACEPOINT_HEADER_MULTI_READ)
+#define QTNETWORK_TRACEPOINTS_P_H_LTTNG
+
+#include <lttng/tracepoint.h>
+
+TRACEPOINT_EVENT(qtnetwork, QNetworkReplyHttpImpl_postRequest,
+    TP_ARGS(const void *, reply, const char *, url),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, reply, reinterpret_cast<quintptr>(reply))
+        ctf_string(url, url)
+    )
+)
+
+TRACEPOINT_EVENT(qtnetwork, QNetworkReplyHttpImpl_replyDownloadMetaData,
+    TP_ARGS(const void *, reply, int, statusCode, qint64, contentLength),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, reply, reinterpret_cast<quintptr>(reply))
+        ctf_integer(int, statusCode, statusCode)
+        ctf_integer(qint64, contentLength, contentLength)
+    )
+)
+
+TRACEPOINT_EVENT(qtnetwork, QNetworkReplyHttpImpl_replyDownloadData,
+    TP_ARGS(const void *, reply, int, size),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, reply, reinterpret_cast<quintptr>(reply))
+        ctf_integer(int, size, size)
+    )
+)
+
+TRACEPOINT_EVENT(qtnetwork, QNetworkReplyHttpImpl_error,
+    TP_ARGS(const void *, reply, int, code),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, reply, reinterpret_cast<quintptr>(reply))
+        ctf_integer(int, code, code)
+    )
+)
+
+TRACEPOINT_EVENT(qtnetwork, QNetworkReplyHttpImpl_finished,
+    TP_ARGS(const void *, reply, qint64, bytesDownloaded),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, reply, reinterpret_cast<quintptr>(reply))
+        ctf_integer(qint64, bytesDownloaded, bytesDownloaded)
+    )
+)
+
+#endif // !QTNETWORK_TRACEPOINTS_P_H_LTTNG || TRACEPOINT_HEADER_MULTI_READ
+
+#include <lttng/tracepoint-event.h>
+
+#endif // Q_TRACEPOINT && QT_TRACE_BACKEND_LTTNG
+
+#if !defined(QTNETWORK_TRACEPOINTS_P_H) && !defined(TRACEPOINT_HEADER_MULTI_READ)
+#define QTNETWORK_TRACEPOINTS_P_H
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED)
+
+#if defined(QT_TRACE_BACKEND_ETW)
+#include <QtCore/qt_windows.h>
+#include <TraceLoggingProvider.h>
+
+TRACELOGGING_DECLARE_PROVIDER(qtnetwork_provider);
+#endif
+
+QT_BEGIN_NAMESPACE
+
+class QNetworkReply;
+
+namespace QtPrivate {
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QNetworkReplyHttpImpl_postRequest(QNetworkReply *reply, const char *url)
+{
+    tracepoint(qtnetwork, QNetworkReplyHttpImpl_postRequest, reply, url);
+}
+
+inline void do_trace_QNetworkReplyHttpImpl_postRequest(QNetworkReply *reply, const char *url)
+{
+    do_tracepoint(qtnetwork, QNetworkReplyHttpImpl_postRequest, reply, url);
+}
+
+inline bool trace_QNetworkReplyHttpImpl_postRequest_enabled()
+{
+    return tracepoint_enabled(qtnetwork, QNetworkReplyHttpImpl_postRequest);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QNetworkReplyHttpImpl_postRequest(QNetworkReply *reply, const char *url)
+{
+    TraceLoggingWrite(qtnetwork_provider, "QNetworkReplyHttpImpl_postRequest",
+                      TraceLoggingPointer(reply, "reply"),
+                      TraceLoggingString(url, "url"));
+}
+
+inline void do_trace_QNetworkReplyHttpImpl_postRequest(QNetworkReply *reply, const char *url)
+{
+    trace_QNetworkReplyHttpImpl_postRequest(reply, url);
+}
+
+inline bool trace_QNetworkReplyHttpImpl_postRequest_enabled()
+{
+    return TraceLoggingProviderEnabled(qtnetwork_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QNetworkReplyHttpImpl_replyDownloadMetaData(QNetworkReply *reply, int statusCode, qint64 contentLength)
+{
+    tracepoint(qtnetwork, QNetworkReplyHttpImpl_replyDownloadMetaData, reply, statusCode, contentLength);
+}
+
+inline void do_trace_QNetworkReplyHttpImpl_replyDownloadMetaData(QNetworkReply *reply, int statusCode, qint64 contentLength)
+{
+    do_tracepoint(qtnetwork, QNetworkReplyHttpImpl_replyDownloadMetaData, reply, statusCode, contentLength);
+}
+
+inline bool trace_QNetworkReplyHttpImpl_replyDownloadMetaData_enabled()
+{
+    return tracepoint_enabled(qtnetwork, QNetworkReplyHttpImpl_replyDownloadMetaData);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QNetworkReplyHttpImpl_replyDownloadMetaData(QNetworkReply *reply, int statusCode, qint64 contentLength)
+{
+    TraceLoggingWrite(qtnetwork_provider, "QNetworkReplyHttpImpl_replyDownloadMetaData",
+                      TraceLoggingPointer(reply, "reply"),
+                      TraceLoggingInt32(statusCode, "statusCode"),
+                      TraceLoggingInt64(contentLength, "contentLength"));
+}
+
+inline void do_trace_QNetworkReplyHttpImpl_replyDownloadMetaData(QNetworkReply *reply, int statusCode, qint64 contentLength)
+{
+    trace_QNetworkReplyHttpImpl_replyDownloadMetaData(reply, statusCode, contentLength);
+}
+
+inline bool trace_QNetworkReplyHttpImpl_replyDownloadMetaData_enabled()
+{
+    return TraceLoggingProviderEnabled(qtnetwork_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QNetworkReplyHttpImpl_replyDownloadData(QNetworkReply *reply, int size)
+{
+    tracepoint(qtnetwork, QNetworkReplyHttpImpl_replyDownloadData, reply, size);
+}
+
+inline void do_trace_QNetworkReplyHttpImpl_replyDownloadData(QNetworkReply *reply, int size)
+{
+    do_tracepoint(qtnetwork, QNetworkReplyHttpImpl_replyDownloadData, reply, size);
+}
+
+inline bool trace_QNetworkReplyHttpImpl_replyDownloadData_enabled()
+{
+    return tracepoint_enabled(qtnetwork, QNetworkReplyHttpImpl_replyDownloadData);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QNetworkReplyHttpImpl_replyDownloadData(QNetworkReply *reply, int size)
+{
+    TraceLoggingWrite(qtnetwork_provider, "QNetworkReplyHttpImpl_replyDownloadData",
+                      TraceLoggingPointer(reply, "reply"),
+                      TraceLoggingInt32(size, "size"));
+}
+
+inline void do_trace_QNetworkReplyHttpImpl_replyDownloadData(QNetworkReply *reply, int size)
+{
+    trace_QNetworkReplyHttpImpl_replyDownloadData(reply, size);
+}
+
+inline bool trace_QNetworkReplyHttpImpl_replyDownloadData_enabled()
+{
+    return TraceLoggingProviderEnabled(qtnetwork_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QNetworkReplyHttpImpl_error(QNetworkReply *reply, int code)
+{
+    tracepoint(qtnetwork, QNetworkReplyHttpImpl_error, reply, code);
+}
+
+inline void do_trace_QNetworkReplyHttpImpl_error(QNetworkReply *reply, int code)
+{
+    do_tracepoint(qtnetwork, QNetworkReplyHttpImpl_error, reply, code);
+}
+
+inline bool trace_QNetworkReplyHttpImpl_error_enabled()
+{
+    return tracepoint_enabled(qtnetwork, QNetworkReplyHttpImpl_error);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QNetworkReplyHttpImpl_error(QNetworkReply *reply, int code)
+{
+    TraceLoggingWrite(qtnetwork_provider, "QNetworkReplyHttpImpl_error",
+                      TraceLoggingPointer(reply, "reply"),
+                      TraceLoggingInt32(code, "code"));
+}
+
+inline void do_trace_QNetworkReplyHttpImpl_error(QNetworkReply *reply, int code)
+{
+    trace_QNetworkReplyHttpImpl_error(reply, code);
+}
+
+inline bool trace_QNetworkReplyHttpImpl_error_enabled()
+{
+    return TraceLoggingProviderEnabled(qtnetwork_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QNetworkReplyHttpImpl_finished(QNetworkReply *reply, qint64 bytesDownloaded)
+{
+    tracepoint(qtnetwork, QNetworkReplyHttpImpl_finished, reply, bytesDownloaded);
+}
+
+inline void do_trace_QNetworkReplyHttpImpl_finished(QNetworkReply *reply, qint64 bytesDownloaded)
+{
+    do_tracepoint(qtnetwork, QNetworkReplyHttpImpl_finished, reply, bytesDownloaded);
+}
+
+inline bool trace_QNetworkReplyHttpImpl_finished_enabled()
+{
+    return tracepoint_enabled(qtnetwork, QNetworkReplyHttpImpl_finished);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QNetworkReplyHttpImpl_finished(QNetworkReply *reply, qint64 bytesDownloaded)
+{
+    TraceLoggingWrite(qtnetwork_provider, "QNetworkReplyHttpImpl_finished",
+                      TraceLoggingPointer(reply, "reply"),
+                      TraceLoggingInt64(bytesDownloaded, "bytesDownloaded"));
+}
+
+inline void do_trace_QNetworkReplyHttpImpl_finished(QNetworkReply *reply, qint64 bytesDownloaded)
+{
+    trace_QNetworkReplyHttpImpl_finished(reply, bytesDownloaded);
+}
+
+inline bool trace_QNetworkReplyHttpImpl_finished_enabled()
+{
+    return TraceLoggingProviderEnabled(qtnetwork_provider, 0, 0);
+}
+#endif
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
+
+#endif // Q_TRACEPOINT && !QT_BOOTSTRAPPED
+#endif // QTNETWORK_TRACEPOINTS_P_H
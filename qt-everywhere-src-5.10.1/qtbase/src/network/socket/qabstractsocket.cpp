@@ -468,6 +468,7 @@
 #include <qpointer.h>
 #include <qtimer.h>
 #include <qelapsedtimer.h>
+#include <qfile.h>
 #include <qscopedvaluerollback.h>
 #include <qvarlengtharray.h>
 
@@ -594,6 +595,7 @@ void QAbstractSocketPrivate::resetSocketLayer()
 #endif
 
     hasPendingData = false;
+    pendingFiles.clear();
     if (socketEngine) {
         socketEngine->close();
         socketEngine->disconnect();
@@ -814,7 +816,8 @@ void QAbstractSocketPrivate::connectionNotification()
 
 /*! \internal
 
-    Writes one pending data block in the write buffer to the socket.
+    Writes pending data from the write buffer, or from the first pending file
+    once everything buffered before it has been sent, to the socket.
 
     It is usually invoked by canWriteNotification after one or more
     calls to write().
@@ -824,7 +827,7 @@ void QAbstractSocketPrivate::connectionNotification()
 bool QAbstractSocketPrivate::writeToSocket()
 {
     Q_Q(QAbstractSocket);
-    if (!socketEngine || !socketEngine->isValid() || (writeBuffer.isEmpty()
+    if (!socketEngine || !socketEngine->isValid() || (!hasPendingWrites()
         && socketEngine->bytesToWrite() == 0)) {
 #if defined (QABSTRACTSOCKET_DEBUG)
     qDebug("QAbstractSocketPrivate::writeToSocket() nothing to do: valid ? %s, writeBuffer.isEmpty() ? %s",
@@ -842,11 +845,27 @@ bool QAbstractSocketPrivate::writeToSocket()
         return false;
     }
 
-    qint64 nextSize = writeBuffer.nextDataBlockSize();
-    const char *ptr = writeBuffer.readPointer();
+    qint64 written;
+    if (!pendingFiles.isEmpty() && pendingFiles.constFirst().bufferedBefore == 0) {
+        PendingFile &pending = pendingFiles.first();
+        if (!pending.file) {
+            setErrorAndEmit(QAbstractSocket::UnknownSocketError,
+                            QAbstractSocket::tr("File was destroyed before it was fully sent"));
+            q->abort();
+            return false;
+        }
+
+        written = socketEngine->sendFile(pending.file, pending.offset, pending.remaining);
+        if (written > 0) {
+            pending.offset += written;
+            pending.remaining -= written;
+            if (pending.remaining == 0)
+                pendingFiles.removeFirst();
+        }
+    } else {
+        written = writeBufferToSocket();
+    }
 
-    // Attempt to write it all in one chunk.
-    qint64 written = nextSize ? socketEngine->write(ptr, nextSize) : Q_INT64_C(0);
     if (written < 0) {
 #if defined (QABSTRACTSOCKET_DEBUG)
         qDebug() << "QAbstractSocketPrivate::writeToSocket() write error, aborting."
@@ -863,15 +882,11 @@ bool QAbstractSocketPrivate::writeToSocket()
            written);
 #endif
 
-    if (written > 0) {
-        // Remove what we wrote so far.
-        writeBuffer.free(written);
-
-        // Emit notifications.
+    // Emit notifications.
+    if (written > 0)
         emitBytesWritten(written);
-    }
 
-    if (writeBuffer.isEmpty() && socketEngine && !socketEngine->bytesToWrite())
+    if (!hasPendingWrites() && socketEngine && !socketEngine->bytesToWrite())
         socketEngine->setWriteNotificationEnabled(false);
     if (state == QAbstractSocket::ClosingState)
         q->disconnectFromHost();
@@ -879,6 +894,81 @@ bool QAbstractSocketPrivate::writeToSocket()
     return written > 0;
 }
 
+/*! \internal
+
+    Writes as much of the write buffer as the socket accepts, stopping at the
+    first pending file. Several buffer chunks are handed to the socket engine
+    at once, so that many small write() calls do not turn into as many system
+    calls. Removes the written data from the buffer and returns its size, or -1
+    if an error occurred.
+*/
+qint64 QAbstractSocketPrivate::writeBufferToSocket()
+{
+    enum { MaxBlocks = 16 };
+
+    const qint64 limit = pendingFiles.isEmpty() ? writeBuffer.size()
+                                                : pendingFiles.constFirst().bufferedBefore;
+    const char *blocks[MaxBlocks];
+    qint64 sizes[MaxBlocks];
+    int count = 0;
+    for (qint64 pos = 0; count < MaxBlocks && pos < limit; ++count) {
+        qint64 length;
+        blocks[count] = writeBuffer.readPointerAtPosition(pos, length);
+        sizes[count] = qMin(length, limit - pos);
+        pos += sizes[count];
+    }
+
+    // Attempt to write it all in one go.
+    qint64 written = Q_INT64_C(0);
+    if (count == 1)
+        written = socketEngine->write(blocks[0], sizes[0]);
+    else if (count > 1)
+        written = socketEngine->writeBlocks(blocks, sizes, count);
+
+    if (written > 0) {
+        // Remove what we wrote so far.
+        writeBuffer.free(written);
+        if (!pendingFiles.isEmpty())
+            pendingFiles.first().bufferedBefore -= written;
+    }
+    return written;
+}
+
+/*! \internal
+
+    Queues \a length bytes of \a file, starting at \a offset, to be sent after
+    the data currently in the write buffer.
+*/
+void QAbstractSocketPrivate::queueFile(QFile *file, qint64 offset, qint64 length)
+{
+    qint64 bufferedBeforeLast = 0;
+    for (const PendingFile &pending : qAsConst(pendingFiles))
+        bufferedBeforeLast += pending.bufferedBefore;
+
+    PendingFile pending;
+    pending.file = file;
+    pending.offset = offset;
+    pending.remaining = length;
+    pending.bufferedBefore = writeBuffer.size() - bufferedBeforeLast;
+    pendingFiles.append(pending);
+
+    if (socketEngine)
+        socketEngine->setWriteNotificationEnabled(true);
+}
+
+/*! \internal
+
+    Returns the number of file bytes queued by QTcpSocket::sendFile() that
+    have not been sent yet.
+*/
+qint64 QAbstractSocketPrivate::pendingFileBytes() const
+{
+    qint64 total = 0;
+    for (const PendingFile &pending : pendingFiles)
+        total += pending.remaining;
+    return total;
+}
+
 /*! \internal
 
     Writes pending data in the write buffers to the socket. The function
@@ -889,7 +979,7 @@ bool QAbstractSocketPrivate::flush()
 {
     bool dataWasWritten = false;
 
-    while (!allWriteBuffersEmpty() && writeToSocket())
+    while ((!allWriteBuffersEmpty() || !pendingFiles.isEmpty()) && writeToSocket())
         dataWasWritten = true;
 
     return dataWasWritten;
@@ -1771,7 +1861,7 @@ void QAbstractSocket::connectToHost(const QHostAddress &address, quint16 port,
 */
 qint64 QAbstractSocket::bytesToWrite() const
 {
-    const qint64 pendingBytes = QIODevice::bytesToWrite();
+    const qint64 pendingBytes = QIODevice::bytesToWrite() + d_func()->pendingFileBytes();
 #if defined(QABSTRACTSOCKET_DEBUG)
     qDebug("QAbstractSocket::bytesToWrite() == %lld", pendingBytes);
 #endif
@@ -2226,7 +2316,7 @@ bool QAbstractSocket::waitForReadyRead(int msecs)
 
         bool readyToRead = false;
         bool readyToWrite = false;
-        if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite, true, !d->writeBuffer.isEmpty(),
+        if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite, true, d->hasPendingWrites(),
                                                qt_subtract_from_timeout(msecs, stopWatch.elapsed()))) {
 #if defined (QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocket::waitForReadyRead(%i) failed (%i, %s)",
@@ -2278,7 +2368,7 @@ bool QAbstractSocket::waitForBytesWritten(int msecs)
         return false;
     }
 
-    if (d->writeBuffer.isEmpty())
+    if (!d->hasPendingWrites())
         return false;
 
     QElapsedTimer stopWatch;
@@ -2295,7 +2385,7 @@ bool QAbstractSocket::waitForBytesWritten(int msecs)
         bool readyToWrite = false;
         if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite,
                                   !d->readBufferMaxSize || d->buffer.size() < d->readBufferMaxSize,
-                                  !d->writeBuffer.isEmpty(),
+                                  d->hasPendingWrites(),
                                   qt_subtract_from_timeout(msecs, stopWatch.elapsed()))) {
 #if defined (QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocket::waitForBytesWritten(%i) failed (%i, %s)",
@@ -2374,7 +2464,7 @@ bool QAbstractSocket::waitForDisconnected(int msecs)
         bool readyToRead = false;
         bool readyToWrite = false;
         if (!d->socketEngine->waitForReadOrWrite(&readyToRead, &readyToWrite, state() == ConnectedState,
-                                               !d->writeBuffer.isEmpty(),
+                                               d->hasPendingWrites(),
                                                qt_subtract_from_timeout(msecs, stopWatch.elapsed()))) {
 #if defined (QABSTRACTSOCKET_DEBUG)
             qDebug("QAbstractSocket::waitForReadyRead(%i) failed (%i, %s)",
@@ -2411,6 +2501,7 @@ void QAbstractSocket::abort()
     qDebug("QAbstractSocket::abort()");
 #endif
     d->setWriteChannelCount(0);
+    d->pendingFiles.clear();
     if (d->state == UnconnectedState)
         return;
 #ifndef QT_NO_SSL
@@ -2520,7 +2611,7 @@ qint64 QAbstractSocket::writeData(const char *data, qint64 size)
     }
 
     if (!d->isBuffered && d->socketType == TcpSocket
-        && d->socketEngine && d->writeBuffer.isEmpty()) {
+        && d->socketEngine && d->writeBuffer.isEmpty() && d->pendingFiles.isEmpty()) {
         // This code is for the new Unbuffered QTcpSocket use case
         qint64 written = size ? d->socketEngine->write(data, size) : Q_INT64_C(0);
         if (written < 0) {
@@ -2751,7 +2842,7 @@ void QAbstractSocket::disconnectFromHost()
 
         // Wait for pending data to be written.
         if (d->socketEngine && d->socketEngine->isValid() && (!d->allWriteBuffersEmpty()
-            || d->socketEngine->bytesToWrite() > 0)) {
+            || !d->pendingFiles.isEmpty() || d->socketEngine->bytesToWrite() > 0)) {
             d->socketEngine->setWriteNotificationEnabled(true);
 
 #if defined(QABSTRACTSOCKET_DEBUG)
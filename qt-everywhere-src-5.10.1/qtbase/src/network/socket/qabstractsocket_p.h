@@ -55,13 +55,16 @@
 #include "QtNetwork/qabstractsocket.h"
 #include "QtCore/qbytearray.h"
 #include "QtCore/qlist.h"
+#include "QtCore/qpointer.h"
 #include "QtCore/qtimer.h"
+#include "QtCore/qvector.h"
 #include "private/qiodevice_p.h"
 #include "private/qabstractsocketengine_p.h"
 #include "qnetworkproxy.h"
 
 QT_BEGIN_NAMESPACE
 
+class QFile;
 class QHostInfo;
 
 class QAbstractSocketPrivate : public QIODevicePrivate, public QAbstractSocketEngineReceiver
@@ -71,6 +74,8 @@ public:
     QAbstractSocketPrivate();
     virtual ~QAbstractSocketPrivate();
 
+    static QAbstractSocketPrivate *get(QAbstractSocket *socket) { return socket->d_func(); }
+
     // from QAbstractSocketEngineReceiver
     inline void readNotification() override { canReadNotification(); }
     inline void writeNotification() override { canWriteNotification(); }
@@ -136,6 +141,11 @@ public:
     void fetchConnectionParameters();
     bool readFromSocket();
     virtual bool writeToSocket();
+    qint64 writeBufferToSocket();
+    void queueFile(QFile *file, qint64 offset, qint64 length);
+    qint64 pendingFileBytes() const;
+    inline bool hasPendingWrites() const
+    { return !writeBuffer.isEmpty() || !pendingFiles.isEmpty(); }
     void emitReadyRead(int channel = 0);
     void emitBytesWritten(qint64 bytes, int channel = 0);
 
@@ -146,6 +156,17 @@ public:
     bool isBuffered;
     bool hasPendingData;
 
+    // files passed to QTcpSocket::sendFile(), in the order they are to be sent
+    struct PendingFile
+    {
+        QPointer<QFile> file;
+        qint64 offset;
+        qint64 remaining;
+        // bytes of the write buffer that go out between the previous file and this one
+        qint64 bufferedBefore;
+    };
+    QVector<PendingFile> pendingFiles;
+
     QTimer *connectTimer;
 
     int hostLookupId;
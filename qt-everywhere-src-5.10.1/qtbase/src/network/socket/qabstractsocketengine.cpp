@@ -46,6 +46,7 @@
 #endif
 
 #include "qmutex.h"
+#include "qfile.h"
 #include "qnetworkproxy.h"
 
 QT_BEGIN_NAMESPACE
@@ -273,4 +274,121 @@ int QAbstractSocketEngine::outboundStreamCount() const
     return d_func()->outboundStreamCount;
 }
 
+/*!
+    \internal
+
+    Writes the \a count blocks in \a blocks, whose sizes are in \a sizes, to
+    the socket as if they were one contiguous buffer. Returns the number of
+    bytes written, or -1 if an error occurred before anything was written.
+
+    The default implementation calls write() once per block and stops at the
+    first short write.
+*/
+qint64 QAbstractSocketEngine::writeBlocks(const char * const *blocks, const qint64 *sizes, int count)
+{
+    qint64 total = 0;
+    for (int i = 0; i < count; ++i) {
+        const qint64 written = write(blocks[i], sizes[i]);
+        if (written < 0)
+            return total ? total : Q_INT64_C(-1);
+        total += written;
+        if (written < sizes[i])
+            break;
+    }
+    return total;
+}
+
+/*!
+    \internal
+
+    Writes up to \a length bytes of \a file, starting at \a offset, to the
+    socket and returns the number of bytes written, or -1 if an error occurred
+    (including \a file ending before \a offset + \a length).
+
+    The default implementation reads a chunk of the file into memory and
+    passes it to write(); socket engines that can have the operating system
+    copy file data directly should reimplement it.
+*/
+qint64 QAbstractSocketEngine::sendFile(QFile *file, qint64 offset, qint64 length)
+{
+    enum { ChunkSize = 64 * 1024 };
+
+    if (!file->seek(offset)) {
+        setError(QAbstractSocket::UnknownSocketError, file->errorString());
+        return -1;
+    }
+
+    QByteArray chunk(int(qMin<qint64>(length, ChunkSize)), Qt::Uninitialized);
+    const qint64 readBytes = file->read(chunk.data(), chunk.size());
+    if (readBytes <= 0) {
+        setError(QAbstractSocket::UnknownSocketError,
+                 readBytes < 0 ? file->errorString() : tr("Unexpected end of file"));
+        return -1;
+    }
+    return write(chunk.constData(), readBytes);
+}
+
+#ifndef QT_NO_UDPSOCKET
+/*!
+    \internal
+
+    Reads up to \a count pending datagrams into the preallocated \a datagrams,
+    each one truncated to \a maxSize bytes (or read in full if \a maxSize is
+    negative), and fills their headers according to \a options. Returns the
+    number of datagrams read, 0 if none was pending, or -1 if the first read
+    failed.
+
+    The default implementation calls readDatagram() once per datagram; socket
+    engines that can receive several datagrams in a single system call should
+    reimplement it.
+*/
+int QAbstractSocketEngine::readDatagrams(QNetworkDatagramPrivate * const *datagrams, int count,
+                                         qint64 maxSize, PacketHeaderOptions options)
+{
+    int received = 0;
+    while (received < count && hasPendingDatagrams()) {
+        QNetworkDatagramPrivate *datagram = datagrams[received];
+        const qint64 size = maxSize < 0 ? pendingDatagramSize() : maxSize;
+        if (size < 0)
+            break;
+
+        datagram->data.resize(int(size));
+        const qint64 readBytes = readDatagram(datagram->data.data(), size, &datagram->header,
+                                              options);
+        if (readBytes < 0) {
+            datagram->data.clear();
+            if (readBytes == -2)
+                break;
+            return received ? received : -1;
+        }
+        datagram->data.truncate(int(readBytes));
+        ++received;
+    }
+    return received;
+}
+
+/*!
+    \internal
+
+    Sends the first \a count datagrams of \a datagrams and returns how many of
+    them were sent, -2 if the first one could not be sent without blocking, or
+    -1 if sending the first one failed. Sending stops at the first datagram
+    that cannot be sent.
+
+    The default implementation calls writeDatagram() once per datagram.
+*/
+int QAbstractSocketEngine::writeDatagrams(const QNetworkDatagramPrivate * const *datagrams, int count)
+{
+    int sent = 0;
+    for ( ; sent < count; ++sent) {
+        const QNetworkDatagramPrivate *datagram = datagrams[sent];
+        const qint64 result = writeDatagram(datagram->data.constData(), datagram->data.size(),
+                                            datagram->header);
+        if (result < 0)
+            return sent ? sent : int(result);
+    }
+    return sent;
+}
+#endif // QT_NO_UDPSOCKET
+
 QT_END_NAMESPACE
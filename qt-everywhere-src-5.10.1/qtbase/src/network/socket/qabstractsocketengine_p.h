@@ -61,6 +61,7 @@
 QT_BEGIN_NAMESPACE
 
 class QAuthenticator;
+class QFile;
 class QAbstractSocketEnginePrivate;
 #ifndef QT_NO_NETWORKINTERFACE
 class QNetworkInterface;
@@ -105,7 +106,8 @@ public:
         TypeOfServiceOption,
         ReceivePacketInformation,
         ReceiveHopLimit,
-        MaxStreamsSocketOption
+        MaxStreamsSocketOption,
+        ReusePortOption
     };
 
     enum PacketHeaderOption {
@@ -139,6 +141,8 @@ public:
 
     virtual qint64 read(char *data, qint64 maxlen) = 0;
     virtual qint64 write(const char *data, qint64 len) = 0;
+    virtual qint64 writeBlocks(const char * const *blocks, const qint64 *sizes, int count);
+    virtual qint64 sendFile(QFile *file, qint64 offset, qint64 length);
 
 #ifndef QT_NO_UDPSOCKET
 #ifndef QT_NO_NETWORKINTERFACE
@@ -157,6 +161,11 @@ public:
     virtual qint64 readDatagram(char *data, qint64 maxlen, QIpPacketHeader *header = 0,
                                 PacketHeaderOptions = WantNone) = 0;
     virtual qint64 writeDatagram(const char *data, qint64 len, const QIpPacketHeader &header) = 0;
+#ifndef QT_NO_UDPSOCKET
+    virtual int readDatagrams(QNetworkDatagramPrivate * const *datagrams, int count, qint64 maxSize,
+                              PacketHeaderOptions options = WantNone);
+    virtual int writeDatagrams(const QNetworkDatagramPrivate * const *datagrams, int count);
+#endif
     virtual qint64 bytesToWrite() const = 0;
 
     virtual int option(SocketOption option) const = 0;
@@ -184,6 +184,38 @@ QLocalServer::SocketOptions QLocalServer::socketOptions() const
     return d->socketOptions;
 }
 
+/*!
+    \since 5.11
+
+    Sets the type of the sockets the server accepts to \a type. Clients
+    have to connect with the same type, see QLocalSocket::setSocketType().
+
+    The type must be set before listen() is called. It is ignored when the
+    server listens on an existing socket descriptor.
+
+    \note QLocalSocket::SeqPacketSocket is only supported on Unix.
+
+    \sa socketType()
+*/
+void QLocalServer::setSocketType(QLocalSocket::LocalSocketType type)
+{
+    Q_D(QLocalServer);
+    d->socketType = type;
+}
+
+/*!
+    \since 5.11
+
+    Returns the type of the sockets the server accepts.
+
+    \sa setSocketType()
+*/
+QLocalSocket::LocalSocketType QLocalServer::socketType() const
+{
+    Q_D(const QLocalServer);
+    return d->socketType;
+}
+
 /*!
     \since 5.10
     Returns the native socket descriptor the server uses to listen
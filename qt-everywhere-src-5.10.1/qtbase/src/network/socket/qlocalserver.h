@@ -42,12 +42,12 @@
 
 #include <QtNetwork/qtnetworkglobal.h>
 #include <QtNetwork/qabstractsocket.h>
+#include <QtNetwork/qlocalsocket.h>
 
 QT_REQUIRE_CONFIG(localserver);
 
 QT_BEGIN_NAMESPACE
 
-class QLocalSocket;
 class QLocalServerPrivate;
 
 class Q_NETWORK_EXPORT QLocalServer : public QObject
@@ -92,6 +92,9 @@ public:
     void setSocketOptions(SocketOptions options);
     SocketOptions socketOptions() const;
 
+    void setSocketType(QLocalSocket::LocalSocketType type);
+    QLocalSocket::LocalSocketType socketType() const;
+
     qintptr socketDescriptor() const;
 
 protected:
@@ -81,7 +81,8 @@ public:
             listenSocket(-1), socketNotifier(0),
 #endif
             maxPendingConnections(30), error(QAbstractSocket::UnknownSocketError),
-            socketOptions(QLocalServer::NoOptions)
+            socketOptions(QLocalServer::NoOptions),
+            socketType(QLocalSocket::StreamSocket)
     {
     }
 
@@ -124,6 +125,7 @@ public:
     QString errorString;
     QAbstractSocket::SocketError error;
     QLocalServer::SocketOptions socketOptions;
+    QLocalSocket::LocalSocketType socketType;
 };
 
 QT_END_NAMESPACE
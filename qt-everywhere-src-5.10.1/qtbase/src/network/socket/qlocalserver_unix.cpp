@@ -105,7 +105,8 @@ bool QLocalServerPrivate::listen(const QString &requestedServerName)
     }
 
     // create the unix socket
-    listenSocket = qt_safe_socket(PF_UNIX, SOCK_STREAM, 0);
+    listenSocket = qt_safe_socket(PF_UNIX, socketType == QLocalSocket::SeqPacketSocket
+                                  ? SOCK_SEQPACKET : SOCK_STREAM, 0);
     if (-1 == listenSocket) {
         setError(QLatin1String("QLocalServer::listen"));
         closeServer();
@@ -40,6 +40,8 @@
 #include "qlocalsocket.h"
 #include "qlocalsocket_p.h"
 
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -442,6 +444,135 @@ QString QLocalSocket::fullServerName() const
     return d->fullServerName;
 }
 
+/*!
+    \since 5.11
+
+    Sets the type of the socket to \a type. The type determines whether the
+    connection is a byte stream or preserves message boundaries, and has to
+    match the type of the server, see QLocalServer::setSocketType().
+
+    This function must be called when the socket is not connected. Sockets
+    set up with setSocketDescriptor() take the type of the descriptor.
+
+    \note SeqPacketSocket is only supported on Unix. On other platforms the
+    socket is always a StreamSocket.
+
+    \sa socketType(), readMessage()
+*/
+void QLocalSocket::setSocketType(LocalSocketType type)
+{
+    Q_D(QLocalSocket);
+    if (d->state != UnconnectedState) {
+        qWarning("QLocalSocket::setSocketType() called while not in unconnected state");
+        return;
+    }
+    d->socketType = type;
+}
+
+/*!
+    \since 5.11
+
+    Returns the type of the socket.
+
+    \sa setSocketType()
+*/
+QLocalSocket::LocalSocketType QLocalSocket::socketType() const
+{
+    Q_D(const QLocalSocket);
+    return d->socketType;
+}
+
+/*!
+    \since 5.11
+
+    Reads the next message from a SeqPacketSocket and returns it, or an empty
+    QByteArray if no message is pending. For a StreamSocket this is the same
+    as readAll().
+
+    In SeqPacketSocket mode, every call to write() sends the data as a single
+    message, and the peer receives it in one piece. Reading with read() also
+    returns at most one message per call, but any part of the message that
+    does not fit into the buffer passed to read() is discarded.
+
+    \sa setSocketType()
+*/
+QByteArray QLocalSocket::readMessage()
+{
+    Q_D(QLocalSocket);
+    if (d->socketType != SeqPacketSocket)
+        return readAll();
+
+    // The reported size may cover more than one pending message, but a read on a
+    // packet socket never returns more than one of them.
+    const qint64 available = bytesAvailable();
+    if (available <= 0)
+        return QByteArray();
+
+    QByteArray message;
+    message.resize(int(qMin<qint64>(available, std::numeric_limits<int>::max())));
+    const qint64 readBytes = read(message.data(), message.size());
+    message.resize(int(qMax<qint64>(readBytes, 0)));
+    return message;
+}
+
+/*!
+    \fn bool QLocalSocket::writeFileDescriptors(const QVector<int> &descriptors, const QByteArray &data)
+    \since 5.11
+
+    Writes \a data to the socket and passes the file \a descriptors along
+    with it to the peer, which receives duplicates of them and can retrieve
+    them with takeFileDescriptors(). The descriptors stay owned by the caller.
+    This allows handing over memfd, dma-buf or shared memory handles instead
+    of copying their content through the socket.
+
+    At least one byte of \a data has to be sent with the descriptors. Data
+    written earlier with write() is sent first, so this function may block
+    until it has been written. Returns \c true if the data and descriptors
+    were sent; otherwise returns \c false and sets errorString().
+
+    \note This function is only supported on Unix.
+
+    \sa takeFileDescriptors(), writeSharedMemory()
+*/
+
+/*!
+    \fn QVector<int> QLocalSocket::takeFileDescriptors()
+    \since 5.11
+
+    Returns the file descriptors that the peer passed with
+    writeFileDescriptors() and that have been received so far, and transfers
+    their ownership to the caller, who is responsible for closing them.
+    The descriptors of a message become available once its data has been
+    received, that is when readyRead() is emitted. Descriptors that are not
+    taken are closed when the socket is closed.
+
+    \note This function is only supported on Unix. On other platforms it
+    returns an empty vector.
+
+    \sa writeFileDescriptors()
+*/
+
+/*!
+    \fn bool QLocalSocket::writeSharedMemory(const QByteArray &data)
+    \since 5.11
+
+    Copies \a data into an anonymous shared memory file and sends the file's
+    descriptor instead of the data itself. The payload sent with the
+    descriptor is the size of \a data as a quint64 in host byte order. The
+    peer takes the descriptor with takeFileDescriptors() and maps it, for
+    instance with QFile::open(int, OpenMode) and QFile::map(), without
+    copying it through the socket.
+
+    On Linux the file is a sealed memfd, so the peer can rely on its size
+    and content not changing.
+
+    Returns \c true if the descriptor was sent; otherwise returns \c false.
+
+    \note This function is only supported on Unix.
+
+    \sa writeFileDescriptors()
+*/
+
 /*!
     Returns the state of the socket.
 
@@ -502,6 +633,20 @@ bool QLocalSocket::isSequential() const
         (data may still be waiting to be written).
  */
 
+/*!
+    \enum QLocalSocket::LocalSocketType
+    \since 5.11
+
+    This enum describes the type of the connection.
+
+    \value StreamSocket A reliable byte stream. This is the default.
+    \value SeqPacketSocket A reliable, connection-oriented socket that
+        preserves message boundaries. On Unix this is a
+        \c SOCK_SEQPACKET local domain socket.
+
+    \sa setSocketType(), readMessage()
+ */
+
 #ifndef QT_NO_DEBUG_STREAM
 QDebug operator<<(QDebug debug, QLocalSocket::LocalSocketError error)
 {
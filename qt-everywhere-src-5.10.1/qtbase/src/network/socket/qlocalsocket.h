@@ -42,6 +42,7 @@
 
 #include <QtNetwork/qtnetworkglobal.h>
 #include <QtCore/qiodevice.h>
+#include <QtCore/qvector.h>
 #include <QtNetwork/qabstractsocket.h>
 
 QT_REQUIRE_CONFIG(localserver);
@@ -79,6 +80,12 @@ public:
         ClosingState = QAbstractSocket::ClosingState
     };
 
+    enum LocalSocketType
+    {
+        StreamSocket,
+        SeqPacketSocket
+    };
+
     QLocalSocket(QObject *parent = Q_NULLPTR);
     ~QLocalSocket();
 
@@ -90,6 +97,9 @@ public:
     QString serverName() const;
     QString fullServerName() const;
 
+    void setSocketType(LocalSocketType type);
+    LocalSocketType socketType() const;
+
     void abort();
     virtual bool isSequential() const Q_DECL_OVERRIDE;
     virtual qint64 bytesAvailable() const Q_DECL_OVERRIDE;
@@ -108,6 +118,11 @@ public:
                              OpenMode openMode = ReadWrite);
     qintptr socketDescriptor() const;
 
+    QByteArray readMessage();
+    bool writeFileDescriptors(const QVector<int> &descriptors, const QByteArray &data);
+    QVector<int> takeFileDescriptors();
+    bool writeSharedMemory(const QByteArray &data);
+
     LocalSocketState state() const;
     bool waitForBytesWritten(int msecs = 30000) Q_DECL_OVERRIDE;
     bool waitForConnected(int msecs = 30000);
@@ -75,6 +75,10 @@ QT_REQUIRE_CONFIG(localserver);
 
 QT_BEGIN_NAMESPACE
 
+#if !defined(Q_OS_WIN) && !defined(QT_LOCALSOCKET_TCP)
+class QNativeSocketEngine;
+#endif
+
 #if !defined(Q_OS_WIN) || defined(QT_LOCALSOCKET_TCP)
 class QLocalUnixSocket : public QTcpSocket
 {
@@ -147,6 +151,9 @@ public:
     void _q_connectToSocket();
     void _q_abortConnectionAttempt();
     void cancelDelayedConnect();
+    QIODevice::OpenMode prepareUnixSocket(QIODevice::OpenMode openMode);
+    void enableFileDescriptorPassing();
+    QNativeSocketEngine *nativeSocketEngine() const;
     QSocketNotifier *delayConnect;
     QTimer *connectTimer;
     int connectingSocket;
@@ -157,6 +164,7 @@ public:
     QString serverName;
     QString fullServerName;
     QLocalSocket::LocalSocketState state;
+    QLocalSocket::LocalSocketType socketType;
 };
 
 QT_END_NAMESPACE
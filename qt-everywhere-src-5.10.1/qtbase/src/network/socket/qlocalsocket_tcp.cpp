@@ -50,7 +50,8 @@ QT_BEGIN_NAMESPACE
 QLocalSocketPrivate::QLocalSocketPrivate() : QIODevicePrivate(),
         tcpSocket(0),
         ownsTcpSocket(true),
-        state(QLocalSocket::UnconnectedState)
+        state(QLocalSocket::UnconnectedState),
+        socketType(QLocalSocket::StreamSocket)
 {
 }
 
@@ -436,4 +437,28 @@ bool QLocalSocket::waitForReadyRead(int msecs)
     return (d->tcpSocket->waitForReadyRead(msecs));
 }
 
+bool QLocalSocket::writeFileDescriptors(const QVector<int> &descriptors, const QByteArray &data)
+{
+    Q_D(QLocalSocket);
+    Q_UNUSED(descriptors);
+    Q_UNUSED(data);
+    setErrorString(d->generateErrorString(UnsupportedSocketOperationError,
+                                          QLatin1String("QLocalSocket::writeFileDescriptors")));
+    return false;
+}
+
+QVector<int> QLocalSocket::takeFileDescriptors()
+{
+    return QVector<int>();
+}
+
+bool QLocalSocket::writeSharedMemory(const QByteArray &data)
+{
+    Q_D(QLocalSocket);
+    Q_UNUSED(data);
+    setErrorString(d->generateErrorString(UnsupportedSocketOperationError,
+                                          QLatin1String("QLocalSocket::writeSharedMemory")));
+    return false;
+}
+
 QT_END_NAMESPACE
@@ -40,6 +40,8 @@
 #include "qlocalsocket.h"
 #include "qlocalsocket_p.h"
 #include "qnet_unix_p.h"
+#include "private/qabstractsocket_p.h"
+#include "private/qnativesocketengine_p.h"
 
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -51,11 +53,22 @@
 #include <qdir.h>
 #include <qdebug.h>
 #include <qelapsedtimer.h>
+#include <qtemporaryfile.h>
 
 #ifdef Q_OS_VXWORKS
 #  include <selectLib.h>
 #endif
 
+#ifdef Q_OS_LINUX
+#  include <sys/syscall.h>
+#  ifndef MFD_CLOEXEC
+#    define MFD_CLOEXEC 0x0001U
+#  endif
+#  ifndef MFD_ALLOW_SEALING
+#    define MFD_ALLOW_SEALING 0x0002U
+#  endif
+#endif
+
 #define QT_CONNECT_TIMEOUT 30000
 
 QT_BEGIN_NAMESPACE
@@ -65,7 +78,8 @@ QLocalSocketPrivate::QLocalSocketPrivate() : QIODevicePrivate(),
         connectTimer(0),
         connectingSocket(-1),
         connectingOpenMode(0),
-        state(QLocalSocket::UnconnectedState)
+        state(QLocalSocket::UnconnectedState),
+        socketType(QLocalSocket::StreamSocket)
 {
 }
 
@@ -239,7 +253,8 @@ void QLocalSocket::connectToServer(OpenMode openMode)
     }
 
     // create the socket
-    if (-1 == (d->connectingSocket = qt_safe_socket(PF_UNIX, SOCK_STREAM, 0, O_NONBLOCK))) {
+    const int type = d->socketType == SeqPacketSocket ? SOCK_SEQPACKET : SOCK_STREAM;
+    if (-1 == (d->connectingSocket = qt_safe_socket(PF_UNIX, type, 0, O_NONBLOCK))) {
         d->errorOccurred(UnsupportedSocketOperationError,
                         QLatin1String("QLocalSocket::connectToServer"));
         return;
@@ -327,7 +342,8 @@ void QLocalSocketPrivate::_q_connectToSocket()
     serverName = connectingName;
     fullServerName = connectingPathName;
     if (unixSocket.setSocketDescriptor(connectingSocket,
-        QAbstractSocket::ConnectedState, connectingOpenMode)) {
+        QAbstractSocket::ConnectedState, prepareUnixSocket(connectingOpenMode))) {
+        enableFileDescriptorPassing();
         q->QIODevice::open(connectingOpenMode | QIODevice::Unbuffered);
         q->emit connected();
     } else {
@@ -358,10 +374,147 @@ bool QLocalSocket::setSocketDescriptor(qintptr socketDescriptor,
         newSocketState = QAbstractSocket::UnconnectedState;
         break;
     }
+    int type = SOCK_STREAM;
+    socklen_t typeSize = sizeof(type);
+    if (::getsockopt(socketDescriptor, SOL_SOCKET, SO_TYPE, &type, &typeSize) == 0)
+        d->socketType = type == SOCK_SEQPACKET ? SeqPacketSocket : StreamSocket;
+    openMode = d->prepareUnixSocket(openMode);
     QIODevice::open(openMode);
     d->state = socketState;
-    return d->unixSocket.setSocketDescriptor(socketDescriptor,
-                                             newSocketState, openMode);
+    if (!d->unixSocket.setSocketDescriptor(socketDescriptor, newSocketState, openMode))
+        return false;
+    d->enableFileDescriptorPassing();
+    return true;
+}
+
+/*!
+    \internal
+
+    Configures the internal socket for the socket type before it gets a
+    descriptor and returns the open mode to use for it.
+*/
+QIODevice::OpenMode QLocalSocketPrivate::prepareUnixSocket(QIODevice::OpenMode openMode)
+{
+    QAbstractSocketPrivate *socketPrivate = QAbstractSocketPrivate::get(&unixSocket);
+    if (socketType == QLocalSocket::SeqPacketSocket) {
+        // Every write() and read() has to map to exactly one message, so
+        // bypass the buffers and go straight to the socket engine like a
+        // connected UDP socket does.
+        socketPrivate->isBuffered = false;
+        socketPrivate->socketType = QAbstractSocket::UnknownSocketType;
+        return openMode | QIODevice::Unbuffered;
+    }
+    socketPrivate->isBuffered = true;
+    socketPrivate->socketType = QAbstractSocket::TcpSocket;
+    return openMode;
+}
+
+void QLocalSocketPrivate::enableFileDescriptorPassing()
+{
+    if (QNativeSocketEngine *engine = nativeSocketEngine())
+        engine->setFileDescriptorPassingEnabled(true);
+}
+
+QNativeSocketEngine *QLocalSocketPrivate::nativeSocketEngine() const
+{
+    QAbstractSocketPrivate *socketPrivate =
+            QAbstractSocketPrivate::get(const_cast<QLocalUnixSocket *>(&unixSocket));
+    return qobject_cast<QNativeSocketEngine *>(socketPrivate->socketEngine);
+}
+
+bool QLocalSocket::writeFileDescriptors(const QVector<int> &descriptors, const QByteArray &data)
+{
+    Q_D(QLocalSocket);
+    const QString function = QLatin1String("QLocalSocket::writeFileDescriptors");
+    if (descriptors.isEmpty() || data.isEmpty()) {
+        qWarning("QLocalSocket::writeFileDescriptors: Descriptors have to be sent with at least one byte of data");
+        return false;
+    }
+    QNativeSocketEngine *engine = d->nativeSocketEngine();
+    if (!engine || state() != ConnectedState || !isWritable()) {
+        setErrorString(d->generateErrorString(OperationError, function));
+        return false;
+    }
+
+    // Keep the stream in order: whatever write() has buffered goes first.
+    while (d->unixSocket.bytesToWrite() > 0) {
+        if (!d->unixSocket.waitForBytesWritten()) {
+            setErrorString(d->unixSocket.errorString());
+            return false;
+        }
+    }
+
+    qint64 written;
+    while ((written = engine->writeWithFileDescriptors(data.constData(), data.size(),
+                                                       descriptors)) == 0) {
+        bool timedOut = false;
+        if (!engine->waitForWrite(30000, &timedOut)) {
+            setErrorString(d->generateErrorString(timedOut ? SocketTimeoutError
+                                                           : UnknownSocketError, function));
+            return false;
+        }
+    }
+    if (written < 0) {
+        setErrorString(engine->errorString());
+        return false;
+    }
+
+    emit bytesWritten(written);
+    // A stream socket may accept only part of the data; the descriptors
+    // went out with that part, the rest is ordinary data.
+    if (written < data.size()
+        && d->unixSocket.write(data.constData() + written, data.size() - written) < 0) {
+        setErrorString(d->unixSocket.errorString());
+        return false;
+    }
+    return true;
+}
+
+QVector<int> QLocalSocket::takeFileDescriptors()
+{
+    Q_D(QLocalSocket);
+    QNativeSocketEngine *engine = d->nativeSocketEngine();
+    return engine ? engine->takeReceivedFileDescriptors() : QVector<int>();
+}
+
+bool QLocalSocket::writeSharedMemory(const QByteArray &data)
+{
+    Q_D(QLocalSocket);
+    int fd = -1;
+#if defined(Q_OS_LINUX) && defined(SYS_memfd_create)
+    fd = int(::syscall(SYS_memfd_create, "qlocalsocket", MFD_CLOEXEC | MFD_ALLOW_SEALING));
+#endif
+    if (fd == -1) {
+        // No memfd, fall back to a temporary file that is gone from the
+        // file system as soon as only descriptors refer to it.
+        QTemporaryFile file;
+        if (file.open())
+            fd = qt_safe_dup(file.handle());
+    }
+    if (fd == -1) {
+        setErrorString(d->generateErrorString(SocketResourceError,
+                                              QLatin1String("QLocalSocket::writeSharedMemory")));
+        return false;
+    }
+
+    if (qt_safe_write(fd, data.constData(), data.size()) != data.size()) {
+        setErrorString(d->generateErrorString(SocketResourceError,
+                                              QLatin1String("QLocalSocket::writeSharedMemory")));
+        qt_safe_close(fd);
+        return false;
+    }
+#ifdef F_ADD_SEALS
+    // Nobody can change the content or the size under the receiver's feet.
+    // This fails harmlessly for the temporary file.
+    ::fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL);
+#endif
+
+    const quint64 size = quint64(data.size());
+    const bool result = writeFileDescriptors(QVector<int>() << fd,
+                                             QByteArray(reinterpret_cast<const char *>(&size),
+                                                        sizeof(size)));
+    qt_safe_close(fd);
+    return result;
 }
 
 void QLocalSocketPrivate::_q_abortConnectionAttempt()
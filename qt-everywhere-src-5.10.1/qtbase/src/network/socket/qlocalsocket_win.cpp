@@ -105,7 +105,8 @@ QLocalSocketPrivate::QLocalSocketPrivate() : QIODevicePrivate(),
        pipeWriter(0),
        pipeReader(0),
        error(QLocalSocket::UnknownSocketError),
-       state(QLocalSocket::UnconnectedState)
+       state(QLocalSocket::UnconnectedState),
+       socketType(QLocalSocket::StreamSocket)
 {
     writeBufferChunkSize = QIODEVICE_BUFFERSIZE;
 }
@@ -451,4 +452,26 @@ bool QLocalSocket::waitForBytesWritten(int msecs)
     return d->pipeWriter->waitForWrite(msecs);
 }
 
+bool QLocalSocket::writeFileDescriptors(const QVector<int> &descriptors, const QByteArray &data)
+{
+    Q_UNUSED(descriptors);
+    Q_UNUSED(data);
+    setErrorString(tr("%1: The socket operation is not supported")
+                   .arg(QLatin1String("QLocalSocket::writeFileDescriptors")));
+    return false;
+}
+
+QVector<int> QLocalSocket::takeFileDescriptors()
+{
+    return QVector<int>();
+}
+
+bool QLocalSocket::writeSharedMemory(const QByteArray &data)
+{
+    Q_UNUSED(data);
+    setErrorString(tr("%1: The socket operation is not supported")
+                   .arg(QLatin1String("QLocalSocket::writeSharedMemory")));
+    return false;
+}
+
 QT_END_NAMESPACE
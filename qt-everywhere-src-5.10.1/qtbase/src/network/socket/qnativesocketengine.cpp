@@ -194,6 +194,9 @@ QNativeSocketEnginePrivate::QNativeSocketEnginePrivate() :
     readNotifier(0),
     writeNotifier(0),
     exceptNotifier(0)
+#ifdef Q_OS_UNIX
+    , passFileDescriptors(false)
+#endif
 {
 #if defined(Q_OS_WIN) && !defined(Q_OS_WINRT)
     QSysInfo::machineHostName();        // this initializes ws2_32.dll
@@ -902,6 +905,49 @@ qint64 QNativeSocketEngine::writeDatagram(const char *data, qint64 size, const Q
     return d->nativeSendDatagram(data, size, header);
 }
 
+#ifndef QT_NO_UDPSOCKET
+/*!
+    Reads up to \a count pending datagrams into \a datagrams, truncating each
+    one to \a maxSize bytes unless \a maxSize is negative, and returns the
+    number of datagrams read. Where the operating system supports it, the
+    datagrams are received with a single system call.
+
+    Returns -1 if an error occurred before any datagram was read.
+
+    \sa readDatagram()
+*/
+int QNativeSocketEngine::readDatagrams(QNetworkDatagramPrivate * const *datagrams, int count,
+                                       qint64 maxSize, PacketHeaderOptions options)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::readDatagrams(), -1);
+    Q_CHECK_STATES(QNativeSocketEngine::readDatagrams(), QAbstractSocket::BoundState,
+                   QAbstractSocket::ConnectedState, -1);
+
+    return d->nativeReceiveDatagrams(datagrams, count, maxSize, options);
+}
+
+/*!
+    Sends the first \a count datagrams of \a datagrams, in order, and returns
+    the number of datagrams sent. Where the operating system supports it, the
+    datagrams are sent with a single system call.
+
+    Returns -2 if the first datagram could not be sent without blocking, or -1
+    if an error occurred before any datagram was sent.
+
+    \sa writeDatagram()
+*/
+int QNativeSocketEngine::writeDatagrams(const QNetworkDatagramPrivate * const *datagrams, int count)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeDatagrams(), -1);
+    Q_CHECK_STATES(QNativeSocketEngine::writeDatagrams(), QAbstractSocket::BoundState,
+                   QAbstractSocket::ConnectedState, -1);
+
+    return d->nativeSendDatagrams(datagrams, count);
+}
+#endif // QT_NO_UDPSOCKET
+
 /*!
     Writes a block of \a size bytes from \a data to the socket.
     Returns the number of bytes written, or -1 if an error occurred.
@@ -918,6 +964,82 @@ qint64 QNativeSocketEngine::write(const char *data, qint64 size)
     return d->nativeWrite(data, size);
 }
 
+/*!
+    Writes the \a count blocks in \a blocks, whose sizes are in \a sizes, to
+    the socket with a single system call where possible. Returns the number
+    of bytes written, or -1 if an error occurred.
+*/
+qint64 QNativeSocketEngine::writeBlocks(const char * const *blocks, const qint64 *sizes, int count)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeBlocks(), -1);
+    Q_CHECK_STATE(QNativeSocketEngine::writeBlocks(), QAbstractSocket::ConnectedState, -1);
+    return d->nativeWriteBlocks(blocks, sizes, count);
+}
+
+/*!
+    Writes up to \a length bytes of \a file, starting at \a offset, to the
+    socket. Where the operating system supports it, the data is copied from
+    the file to the socket by the kernel without passing through user space.
+    Returns the number of bytes written, or -1 if an error occurred.
+*/
+qint64 QNativeSocketEngine::sendFile(QFile *file, qint64 offset, qint64 length)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::sendFile(), -1);
+    Q_CHECK_STATE(QNativeSocketEngine::sendFile(), QAbstractSocket::ConnectedState, -1);
+    return d->nativeSendFile(file, offset, length);
+}
+
+#ifdef Q_OS_UNIX
+/*!
+    Enables receiving of file descriptors passed with SCM_RIGHTS if \a enable
+    is true. Only meaningful for Unix domain sockets. When enabled, reads
+    collect the descriptors sent along with the data, and they can be
+    retrieved with takeReceivedFileDescriptors().
+*/
+void QNativeSocketEngine::setFileDescriptorPassingEnabled(bool enable)
+{
+    Q_D(QNativeSocketEngine);
+    d->passFileDescriptors = enable;
+}
+
+bool QNativeSocketEngine::isFileDescriptorPassingEnabled() const
+{
+    Q_D(const QNativeSocketEngine);
+    return d->passFileDescriptors;
+}
+
+/*!
+    Writes \a len bytes of \a data to the socket, passing \a descriptors
+    with them to the peer. At least one byte of data must be sent. Returns
+    the number of bytes written, 0 if the socket is not ready for writing, or
+    -1 if an error occurred.
+
+    The descriptors are only sent if some data was written.
+*/
+qint64 QNativeSocketEngine::writeWithFileDescriptors(const char *data, qint64 len,
+                                                     const QVector<int> &descriptors)
+{
+    Q_D(QNativeSocketEngine);
+    Q_CHECK_VALID_SOCKETLAYER(QNativeSocketEngine::writeWithFileDescriptors(), -1);
+    Q_CHECK_STATE(QNativeSocketEngine::writeWithFileDescriptors(), QAbstractSocket::ConnectedState, -1);
+    return d->nativeWriteWithFileDescriptors(data, len, descriptors);
+}
+
+/*!
+    Returns the file descriptors received so far, in the order they were
+    received, and passes their ownership to the caller.
+*/
+QVector<int> QNativeSocketEngine::takeReceivedFileDescriptors()
+{
+    Q_D(QNativeSocketEngine);
+    QVector<int> descriptors;
+    descriptors.swap(d->receivedFileDescriptors);
+    return descriptors;
+}
+#endif
+
 
 qint64 QNativeSocketEngine::bytesToWrite() const
 {
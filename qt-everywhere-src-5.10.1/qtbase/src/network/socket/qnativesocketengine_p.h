@@ -146,6 +146,15 @@ public:
 
     qint64 read(char *data, qint64 maxlen) Q_DECL_OVERRIDE;
     qint64 write(const char *data, qint64 len) Q_DECL_OVERRIDE;
+    qint64 writeBlocks(const char * const *blocks, const qint64 *sizes, int count) Q_DECL_OVERRIDE;
+    qint64 sendFile(QFile *file, qint64 offset, qint64 length) Q_DECL_OVERRIDE;
+
+#ifdef Q_OS_UNIX
+    void setFileDescriptorPassingEnabled(bool enable);
+    bool isFileDescriptorPassingEnabled() const;
+    qint64 writeWithFileDescriptors(const char *data, qint64 len, const QVector<int> &descriptors);
+    QVector<int> takeReceivedFileDescriptors();
+#endif
 
 #ifndef QT_NO_UDPSOCKET
 #ifndef QT_NO_NETWORKINTERFACE
@@ -164,6 +173,11 @@ public:
     qint64 readDatagram(char *data, qint64 maxlen, QIpPacketHeader * = 0,
                         PacketHeaderOptions = WantNone) Q_DECL_OVERRIDE;
     qint64 writeDatagram(const char *data, qint64 len, const QIpPacketHeader &) Q_DECL_OVERRIDE;
+#ifndef QT_NO_UDPSOCKET
+    int readDatagrams(QNetworkDatagramPrivate * const *datagrams, int count, qint64 maxSize,
+                      PacketHeaderOptions = WantNone) Q_DECL_OVERRIDE;
+    int writeDatagrams(const QNetworkDatagramPrivate * const *datagrams, int count) Q_DECL_OVERRIDE;
+#endif
     qint64 bytesToWrite() const Q_DECL_OVERRIDE;
 
 #if 0   // currently unused
@@ -216,6 +230,12 @@ public:
     LPFN_WSASENDMSG sendmsg;
     LPFN_WSARECVMSG recvmsg;
 #  endif
+#ifdef Q_OS_UNIX
+    // SCM_RIGHTS descriptors received along with stream data, owned by
+    // the engine until they are taken
+    QVector<int> receivedFileDescriptors;
+    bool passFileDescriptors;
+#endif
     enum ErrorString {
         NonBlockingInitFailedErrorString,
         BroadcastingInitFailedErrorString,
@@ -277,8 +297,23 @@ public:
     qint64 nativeReceiveDatagram(char *data, qint64 maxLength, QIpPacketHeader *header,
                                  QAbstractSocketEngine::PacketHeaderOptions options);
     qint64 nativeSendDatagram(const char *data, qint64 length, const QIpPacketHeader &header);
+#ifndef QT_NO_UDPSOCKET
+    int nativeReceiveDatagrams(QNetworkDatagramPrivate * const *datagrams, int count, qint64 maxSize,
+                               QAbstractSocketEngine::PacketHeaderOptions options);
+    int nativeSendDatagrams(const QNetworkDatagramPrivate * const *datagrams, int count);
+#endif
+#ifdef Q_OS_UNIX
+    void prepareSendMessage(const QIpPacketHeader &header, struct msghdr *msg, qt_sockaddr *aa,
+                            quintptr *controlBuffer);
+#endif
     qint64 nativeRead(char *data, qint64 maxLength);
     qint64 nativeWrite(const char *data, qint64 length);
+    qint64 nativeWriteBlocks(const char * const *blocks, const qint64 *sizes, int count);
+    qint64 nativeSendFile(QFile *file, qint64 offset, qint64 length);
+#ifdef Q_OS_UNIX
+    qint64 nativeWriteWithFileDescriptors(const char *data, qint64 length, const QVector<int> &descriptors);
+    void closeReceivedFileDescriptors();
+#endif
     int nativeSelect(int timeout, bool selectForRead) const;
     int nativeSelect(int timeout, bool checkRead, bool checkWrite,
                      bool *selectForRead, bool *selectForWrite) const;
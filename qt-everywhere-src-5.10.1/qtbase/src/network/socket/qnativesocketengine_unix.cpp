@@ -46,6 +46,7 @@
 #include "qelapsedtimer.h"
 #include "qvarlengtharray.h"
 #include "qnetworkinterface.h"
+#include "qfile.h"
 #include <time.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -73,6 +74,14 @@
 #include <sys/socket.h>
 #include <netinet/sctp.h>
 #endif
+#ifdef Q_OS_LINUX
+#include <sys/sendfile.h>
+#  if defined(QT_USE_XOPEN_LFS_EXTENSIONS) && defined(QT_LARGEFILE_SUPPORT)
+#    define QT_SENDFILE ::sendfile64
+#  else
+#    define QT_SENDFILE ::sendfile
+#  endif
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -164,6 +173,11 @@ static void convertToLevelAndOption(QNativeSocketEngine::SocketOption opt,
     case QNativeSocketEngine::AddressReusable:
         n = SO_REUSEADDR;
         break;
+    case QNativeSocketEngine::ReusePortOption:
+#ifdef SO_REUSEPORT
+        n = SO_REUSEPORT;
+#endif
+        break;
     case QNativeSocketEngine::ReceiveOutOfBandData:
         n = SO_OOBINLINE;
         break;
@@ -905,11 +919,11 @@ qint64 QNativeSocketEnginePrivate::nativePendingDatagramSize() const
     return qint64(recvResult);
 }
 
-qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxSize, QIpPacketHeader *header,
-                                                         QAbstractSocketEngine::PacketHeaderOptions options)
+namespace {
+// we use quintptr to force the alignment
+struct ReceiveControlBuffer
 {
-    // we use quintptr to force the alignment
-    quintptr cbuf[(CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
+    quintptr data[(CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
 #if !defined(IP_PKTINFO) && defined(IP_RECVIF) && defined(Q_OS_BSD4)
                    + CMSG_SPACE(sizeof(sockaddr_dl))
 #endif
@@ -917,6 +931,91 @@ qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxS
                    + CMSG_SPACE(sizeof(struct sctp_sndrcvinfo))
 #endif
                    + sizeof(quintptr) - 1) / sizeof(quintptr)];
+};
+
+struct SendControlBuffer
+{
+    quintptr data[(CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
+#ifndef QT_NO_SCTP
+                   + CMSG_SPACE(sizeof(struct sctp_sndrcvinfo))
+#endif
+                   + sizeof(quintptr) - 1) / sizeof(quintptr)];
+};
+}
+
+/*
+    Fills \a header from the sender address \a aa and the ancillary data of
+    the received message \a msg.
+*/
+static void qt_parseReceivedHeader(struct msghdr *msg, const qt_sockaddr *aa, quint16 localPort,
+                                   QIpPacketHeader *header)
+{
+    qt_socket_getPortAndAddress(aa, &header->senderPort, &header->senderAddress);
+    header->destinationPort = localPort;
+    header->endOfRecord = (msg->msg_flags & MSG_EOR) != 0;
+
+    // parse the ancillary data
+    struct cmsghdr *cmsgptr;
+    for (cmsgptr = CMSG_FIRSTHDR(msg); cmsgptr != NULL;
+         cmsgptr = CMSG_NXTHDR(msg, cmsgptr)) {
+        if (cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_PKTINFO
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in6_pktinfo))) {
+            in6_pktinfo *info = reinterpret_cast<in6_pktinfo *>(CMSG_DATA(cmsgptr));
+
+            header->destinationAddress.setAddress(reinterpret_cast<quint8 *>(&info->ipi6_addr));
+            header->ifindex = info->ipi6_ifindex;
+            if (header->ifindex)
+                header->destinationAddress.setScopeId(QString::number(info->ipi6_ifindex));
+        }
+
+#ifdef IP_PKTINFO
+        if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_PKTINFO
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_pktinfo))) {
+            in_pktinfo *info = reinterpret_cast<in_pktinfo *>(CMSG_DATA(cmsgptr));
+
+            header->destinationAddress.setAddress(ntohl(info->ipi_addr.s_addr));
+            header->ifindex = info->ipi_ifindex;
+        }
+#else
+#  ifdef IP_RECVDSTADDR
+        if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVDSTADDR
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_addr))) {
+            in_addr *addr = reinterpret_cast<in_addr *>(CMSG_DATA(cmsgptr));
+
+            header->destinationAddress.setAddress(ntohl(addr->s_addr));
+        }
+#  endif
+#  if defined(IP_RECVIF) && defined(Q_OS_BSD4)
+        if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVIF
+                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sockaddr_dl))) {
+            sockaddr_dl *sdl = reinterpret_cast<sockaddr_dl *>(CMSG_DATA(cmsgptr));
+            header->ifindex = sdl->sdl_index;
+        }
+#  endif
+#endif
+
+        if (cmsgptr->cmsg_len == CMSG_LEN(sizeof(int))
+                && ((cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_HOPLIMIT)
+                    || (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_TTL))) {
+            Q_STATIC_ASSERT(sizeof(header->hopLimit) == sizeof(int));
+            memcpy(&header->hopLimit, CMSG_DATA(cmsgptr), sizeof(header->hopLimit));
+        }
+
+#ifndef QT_NO_SCTP
+        if (cmsgptr->cmsg_level == IPPROTO_SCTP && cmsgptr->cmsg_type == SCTP_SNDRCV
+            && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sctp_sndrcvinfo))) {
+            sctp_sndrcvinfo *rcvInfo = reinterpret_cast<sctp_sndrcvinfo *>(CMSG_DATA(cmsgptr));
+
+            header->streamNumber = int(rcvInfo->sinfo_stream);
+        }
+#endif
+    }
+}
+
+qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxSize, QIpPacketHeader *header,
+                                                         QAbstractSocketEngine::PacketHeaderOptions options)
+{
+    ReceiveControlBuffer cbuf;
 
     struct msghdr msg;
     struct iovec vec;
@@ -936,8 +1035,8 @@ qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxS
     }
     if (options & (QAbstractSocketEngine::WantDatagramHopLimit | QAbstractSocketEngine::WantDatagramDestination
                    | QAbstractSocketEngine::WantStreamNumber)) {
-        msg.msg_control = cbuf;
-        msg.msg_controllen = sizeof(cbuf);
+        msg.msg_control = cbuf.data;
+        msg.msg_controllen = sizeof(cbuf.data);
     }
 
     ssize_t recvResult = 0;
@@ -964,66 +1063,7 @@ qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxS
             header->clear();
     } else if (options != QAbstractSocketEngine::WantNone) {
         Q_ASSERT(header);
-        qt_socket_getPortAndAddress(&aa, &header->senderPort, &header->senderAddress);
-        header->destinationPort = localPort;
-        header->endOfRecord = (msg.msg_flags & MSG_EOR) != 0;
-
-        // parse the ancillary data
-        struct cmsghdr *cmsgptr;
-        for (cmsgptr = CMSG_FIRSTHDR(&msg); cmsgptr != NULL;
-             cmsgptr = CMSG_NXTHDR(&msg, cmsgptr)) {
-            if (cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_PKTINFO
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in6_pktinfo))) {
-                in6_pktinfo *info = reinterpret_cast<in6_pktinfo *>(CMSG_DATA(cmsgptr));
-
-                header->destinationAddress.setAddress(reinterpret_cast<quint8 *>(&info->ipi6_addr));
-                header->ifindex = info->ipi6_ifindex;
-                if (header->ifindex)
-                    header->destinationAddress.setScopeId(QString::number(info->ipi6_ifindex));
-            }
-
-#ifdef IP_PKTINFO
-            if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_PKTINFO
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_pktinfo))) {
-                in_pktinfo *info = reinterpret_cast<in_pktinfo *>(CMSG_DATA(cmsgptr));
-
-                header->destinationAddress.setAddress(ntohl(info->ipi_addr.s_addr));
-                header->ifindex = info->ipi_ifindex;
-            }
-#else
-#  ifdef IP_RECVDSTADDR
-            if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVDSTADDR
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(in_addr))) {
-                in_addr *addr = reinterpret_cast<in_addr *>(CMSG_DATA(cmsgptr));
-
-                header->destinationAddress.setAddress(ntohl(addr->s_addr));
-            }
-#  endif
-#  if defined(IP_RECVIF) && defined(Q_OS_BSD4)
-            if (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_RECVIF
-                    && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sockaddr_dl))) {
-                sockaddr_dl *sdl = reinterpret_cast<sockaddr_dl *>(CMSG_DATA(cmsgptr));
-                header->ifindex = sdl->sdl_index;
-            }
-#  endif
-#endif
-
-            if (cmsgptr->cmsg_len == CMSG_LEN(sizeof(int))
-                    && ((cmsgptr->cmsg_level == IPPROTO_IPV6 && cmsgptr->cmsg_type == IPV6_HOPLIMIT)
-                        || (cmsgptr->cmsg_level == IPPROTO_IP && cmsgptr->cmsg_type == IP_TTL))) {
-                Q_STATIC_ASSERT(sizeof(header->hopLimit) == sizeof(int));
-                memcpy(&header->hopLimit, CMSG_DATA(cmsgptr), sizeof(header->hopLimit));
-            }
-
-#ifndef QT_NO_SCTP
-            if (cmsgptr->cmsg_level == IPPROTO_SCTP && cmsgptr->cmsg_type == SCTP_SNDRCV
-                && cmsgptr->cmsg_len >= CMSG_LEN(sizeof(sctp_sndrcvinfo))) {
-                sctp_sndrcvinfo *rcvInfo = reinterpret_cast<sctp_sndrcvinfo *>(CMSG_DATA(cmsgptr));
-
-                header->streamNumber = int(rcvInfo->sinfo_stream);
-            }
-#endif
-        }
+        qt_parseReceivedHeader(&msg, &aa, localPort, header);
     }
 
 #if defined (QNATIVESOCKETENGINE_DEBUG)
@@ -1038,37 +1078,33 @@ qint64 QNativeSocketEnginePrivate::nativeReceiveDatagram(char *data, qint64 maxS
     return qint64((maxSize || recvResult < 0) ? recvResult : Q_INT64_C(0));
 }
 
-qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 len, const QIpPacketHeader &header)
-{
-    // we use quintptr to force the alignment
-    quintptr cbuf[(CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int))
-#ifndef QT_NO_SCTP
-                   + CMSG_SPACE(sizeof(struct sctp_sndrcvinfo))
-#endif
-                   + sizeof(quintptr) - 1) / sizeof(quintptr)];
+/*!
+    \internal
 
-    struct cmsghdr *cmsgptr = reinterpret_cast<struct cmsghdr *>(cbuf);
-    struct msghdr msg;
-    struct iovec vec;
-    qt_sockaddr aa;
+    Fills \a msg with the destination contained in \a header, stored in \a aa,
+    and with the ancillary data for its other fields, stored in \a
+    controlBuffer. The caller sets up the message's data vector.
+*/
+void QNativeSocketEnginePrivate::prepareSendMessage(const QIpPacketHeader &header, struct msghdr *msg,
+                                                    qt_sockaddr *aa, quintptr *controlBuffer)
+{
+    struct cmsghdr *cmsgptr = reinterpret_cast<struct cmsghdr *>(controlBuffer);
 
-    memset(&msg, 0, sizeof(msg));
-    memset(&aa, 0, sizeof(aa));
-    vec.iov_base = const_cast<char *>(data);
-    vec.iov_len = len;
-    msg.msg_iov = &vec;
-    msg.msg_iovlen = 1;
-    msg.msg_control = &cbuf;
+    memset(aa, 0, sizeof(*aa));
+    msg->msg_name = 0;
+    msg->msg_namelen = 0;
+    msg->msg_control = controlBuffer;
+    msg->msg_controllen = 0;
 
     if (header.destinationPort != 0) {
-        msg.msg_name = &aa.a;
+        msg->msg_name = &aa->a;
         setPortAndAddress(header.destinationPort, header.destinationAddress,
-                          &aa, &msg.msg_namelen);
+                          aa, &msg->msg_namelen);
     }
 
-    if (msg.msg_namelen == sizeof(aa.a6)) {
+    if (msg->msg_namelen == sizeof(aa->a6)) {
         if (header.hopLimit != -1) {
-            msg.msg_controllen += CMSG_SPACE(sizeof(int));
+            msg->msg_controllen += CMSG_SPACE(sizeof(int));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(int));
             cmsgptr->cmsg_level = IPPROTO_IPV6;
             cmsgptr->cmsg_type = IPV6_HOPLIMIT;
@@ -1078,7 +1114,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
         if (header.ifindex != 0 || !header.senderAddress.isNull()) {
             struct in6_pktinfo *data = reinterpret_cast<in6_pktinfo *>(CMSG_DATA(cmsgptr));
             memset(data, 0, sizeof(*data));
-            msg.msg_controllen += CMSG_SPACE(sizeof(*data));
+            msg->msg_controllen += CMSG_SPACE(sizeof(*data));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(*data));
             cmsgptr->cmsg_level = IPPROTO_IPV6;
             cmsgptr->cmsg_type = IPV6_PKTINFO;
@@ -1090,7 +1126,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
         }
     } else {
         if (header.hopLimit != -1) {
-            msg.msg_controllen += CMSG_SPACE(sizeof(int));
+            msg->msg_controllen += CMSG_SPACE(sizeof(int));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(int));
             cmsgptr->cmsg_level = IPPROTO_IP;
             cmsgptr->cmsg_type = IP_TTL;
@@ -1112,7 +1148,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
             data->s_addr = htonl(header.senderAddress.toIPv4Address());
 #  endif
             cmsgptr->cmsg_level = IPPROTO_IP;
-            msg.msg_controllen += CMSG_SPACE(sizeof(*data));
+            msg->msg_controllen += CMSG_SPACE(sizeof(*data));
             cmsgptr->cmsg_len = CMSG_LEN(sizeof(*data));
             cmsgptr = reinterpret_cast<cmsghdr *>(reinterpret_cast<char *>(cmsgptr) + CMSG_SPACE(sizeof(*data)));
         }
@@ -1123,7 +1159,7 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     if (header.streamNumber != -1) {
         struct sctp_sndrcvinfo *data = reinterpret_cast<sctp_sndrcvinfo *>(CMSG_DATA(cmsgptr));
         memset(data, 0, sizeof(*data));
-        msg.msg_controllen += CMSG_SPACE(sizeof(sctp_sndrcvinfo));
+        msg->msg_controllen += CMSG_SPACE(sizeof(sctp_sndrcvinfo));
         cmsgptr->cmsg_len = CMSG_LEN(sizeof(sctp_sndrcvinfo));
         cmsgptr->cmsg_level = IPPROTO_SCTP;
         cmsgptr->cmsg_type =  SCTP_SNDRCV;
@@ -1132,8 +1168,24 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     }
 #endif
 
-    if (msg.msg_controllen == 0)
-        msg.msg_control = 0;
+    if (msg->msg_controllen == 0)
+        msg->msg_control = 0;
+}
+
+qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 len, const QIpPacketHeader &header)
+{
+    SendControlBuffer cbuf;
+    struct msghdr msg;
+    struct iovec vec;
+    qt_sockaddr aa;
+
+    memset(&msg, 0, sizeof(msg));
+    vec.iov_base = const_cast<char *>(data);
+    vec.iov_len = len;
+    msg.msg_iov = &vec;
+    msg.msg_iovlen = 1;
+    prepareSendMessage(header, &msg, &aa, cbuf.data);
+
     ssize_t sentBytes = qt_safe_sendmsg(socketDescriptor, &msg, 0);
 
     if (sentBytes < 0) {
@@ -1165,6 +1217,168 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     return qint64(sentBytes);
 }
 
+#ifndef QT_NO_UDPSOCKET
+int QNativeSocketEnginePrivate::nativeReceiveDatagrams(QNetworkDatagramPrivate * const *datagrams,
+                                                       int count, qint64 maxSize,
+                                                       QAbstractSocketEngine::PacketHeaderOptions options)
+{
+#ifdef QT_NET_HAVE_MMSG
+    enum { MaxBatchSize = 64, MaxBatchBytes = 1024 * 1024, MaxDatagramSize = 65536 };
+
+    // Receive into one scratch buffer and copy each datagram out at its real
+    // size, so that reading a batch of small datagrams does not allocate 64k
+    // per datagram. As in nativeReceiveDatagram(), at least one byte is read.
+    const int bufferSize = maxSize < 0 ? int(MaxDatagramSize)
+                                       : int(qBound<qint64>(1, maxSize, MaxDatagramSize));
+    const int batchSize = qMin(qMin(count, int(MaxBatchSize)),
+                               qMax(1, int(MaxBatchBytes) / bufferSize));
+    const bool wantSender = options & QAbstractSocketEngine::WantDatagramSender;
+    const bool wantControl = options & (QAbstractSocketEngine::WantDatagramHopLimit
+                                        | QAbstractSocketEngine::WantDatagramDestination
+                                        | QAbstractSocketEngine::WantStreamNumber);
+
+    QByteArray scratch(batchSize * bufferSize, Qt::Uninitialized);
+    QVarLengthArray<struct mmsghdr, MaxBatchSize> msgs(batchSize);
+    QVarLengthArray<struct iovec, MaxBatchSize> vecs(batchSize);
+    QVarLengthArray<qt_sockaddr, MaxBatchSize> addrs(batchSize);
+    QVarLengthArray<ReceiveControlBuffer, MaxBatchSize> cbufs(wantControl ? batchSize : 0);
+
+    int received = 0;
+    while (received < count) {
+        const int batch = qMin(batchSize, count - received);
+        memset(msgs.data(), 0, batch * sizeof(struct mmsghdr));
+        for (int i = 0; i < batch; ++i) {
+            struct msghdr &msg = msgs[i].msg_hdr;
+            vecs[i].iov_base = scratch.data() + i * bufferSize;
+            vecs[i].iov_len = bufferSize;
+            msg.msg_iov = &vecs[i];
+            msg.msg_iovlen = 1;
+            if (wantSender) {
+                memset(&addrs[i], 0, sizeof(qt_sockaddr));
+                msg.msg_name = &addrs[i];
+                msg.msg_namelen = sizeof(qt_sockaddr);
+            }
+            if (wantControl) {
+                msg.msg_control = cbufs[i].data;
+                msg.msg_controllen = sizeof(cbufs[i].data);
+            }
+        }
+
+        const int result = qt_safe_recvmmsg(socketDescriptor, msgs.data(), batch, 0);
+        if (result < 0) {
+            // report the error on the next call if we already have something
+            if (received)
+                break;
+
+            switch (errno) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+            case EWOULDBLOCK:
+#endif
+            case EAGAIN:
+                // No datagram was available for reading
+                return 0;
+            case ECONNREFUSED:
+                setError(QAbstractSocket::ConnectionRefusedError, ConnectionRefusedErrorString);
+                break;
+            default:
+                setError(QAbstractSocket::NetworkError, ReceiveDatagramErrorString);
+            }
+            return -1;
+        }
+
+        for (int i = 0; i < result; ++i) {
+            QNetworkDatagramPrivate *datagram = datagrams[received + i];
+            if (maxSize == 0)
+                datagram->data.clear();
+            else
+                datagram->data = QByteArray(scratch.constData() + i * bufferSize,
+                                            int(qMin<uint>(msgs[i].msg_len, uint(bufferSize))));
+            if (options != QAbstractSocketEngine::WantNone)
+                qt_parseReceivedHeader(&msgs[i].msg_hdr, &addrs[i], localPort, &datagram->header);
+        }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+        qDebug("QNativeSocketEnginePrivate::nativeReceiveDatagrams(%d, %lli) received %d",
+               batch, maxSize, result);
+#endif
+
+        received += result;
+        if (result < batch)
+            break;
+    }
+    return received;
+#else
+    Q_Q(QNativeSocketEngine);
+    return q->QAbstractSocketEngine::readDatagrams(datagrams, count, maxSize, options);
+#endif
+}
+
+int QNativeSocketEnginePrivate::nativeSendDatagrams(const QNetworkDatagramPrivate * const *datagrams,
+                                                    int count)
+{
+#ifdef QT_NET_HAVE_MMSG
+    enum { MaxBatchSize = 64 };
+
+    const int batchSize = qMin(count, int(MaxBatchSize));
+    QVarLengthArray<struct mmsghdr, MaxBatchSize> msgs(batchSize);
+    QVarLengthArray<struct iovec, MaxBatchSize> vecs(batchSize);
+    QVarLengthArray<qt_sockaddr, MaxBatchSize> addrs(batchSize);
+    QVarLengthArray<SendControlBuffer, MaxBatchSize> cbufs(batchSize);
+
+    int sent = 0;
+    while (sent < count) {
+        const int batch = qMin(batchSize, count - sent);
+        memset(msgs.data(), 0, batch * sizeof(struct mmsghdr));
+        for (int i = 0; i < batch; ++i) {
+            const QNetworkDatagramPrivate *datagram = datagrams[sent + i];
+            struct msghdr &msg = msgs[i].msg_hdr;
+            vecs[i].iov_base = const_cast<char *>(datagram->data.constData());
+            vecs[i].iov_len = datagram->data.size();
+            msg.msg_iov = &vecs[i];
+            msg.msg_iovlen = 1;
+            prepareSendMessage(datagram->header, &msg, &addrs[i], cbufs[i].data);
+        }
+
+        const int result = qt_safe_sendmmsg(socketDescriptor, msgs.data(), batch, 0);
+        if (result < 0) {
+            // the failing datagram will be retried, and its error reported, on the next call
+            if (sent)
+                break;
+
+            switch (errno) {
+#if defined(EWOULDBLOCK) && EWOULDBLOCK != EAGAIN
+            case EWOULDBLOCK:
+#endif
+            case EAGAIN:
+                return -2;
+            case EMSGSIZE:
+                setError(QAbstractSocket::DatagramTooLargeError, DatagramTooLargeErrorString);
+                break;
+            case ECONNRESET:
+                setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+                break;
+            default:
+                setError(QAbstractSocket::NetworkError, SendDatagramErrorString);
+            }
+            return -1;
+        }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+        qDebug("QNativeSocketEnginePrivate::nativeSendDatagrams(%d) sent %d", batch, result);
+#endif
+
+        sent += result;
+        if (result < batch)
+            break;
+    }
+    return sent;
+#else
+    Q_Q(QNativeSocketEngine);
+    return q->QAbstractSocketEngine::writeDatagrams(datagrams, count);
+#endif
+}
+#endif // QT_NO_UDPSOCKET
+
 bool QNativeSocketEnginePrivate::fetchConnectionParameters()
 {
     localPort = 0;
@@ -1294,6 +1508,87 @@ void QNativeSocketEnginePrivate::nativeClose()
 #endif
 
     qt_safe_close(socketDescriptor);
+    closeReceivedFileDescriptors();
+}
+
+void QNativeSocketEnginePrivate::closeReceivedFileDescriptors()
+{
+    for (int descriptor : qAsConst(receivedFileDescriptors))
+        qt_safe_close(descriptor);
+    receivedFileDescriptors.clear();
+}
+
+// Linux limits a single SCM_RIGHTS message to SCM_MAX_FD (253) descriptors
+enum { MaxPassedFileDescriptors = 253 };
+
+qint64 QNativeSocketEnginePrivate::nativeWriteWithFileDescriptors(const char *data, qint64 len,
+                                                                  const QVector<int> &descriptors)
+{
+    Q_Q(QNativeSocketEngine);
+
+    if (descriptors.size() > MaxPassedFileDescriptors) {
+        setError(QAbstractSocket::SocketResourceError, ResourceErrorString);
+        return -1;
+    }
+
+    struct iovec vec;
+    vec.iov_base = const_cast<char *>(data);
+    vec.iov_len = len;
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &vec;
+    msg.msg_iovlen = 1;
+
+    // quintptr keeps the control buffer aligned for cmsghdr
+    const size_t descriptorsSize = descriptors.size() * sizeof(int);
+    QVarLengthArray<quintptr, 16> controlBuffer;
+    if (!descriptors.isEmpty()) {
+        const size_t controlSize = CMSG_SPACE(descriptorsSize);
+        controlBuffer.resize(int((controlSize + sizeof(quintptr) - 1) / sizeof(quintptr)));
+        memset(controlBuffer.data(), 0, controlBuffer.size() * sizeof(quintptr));
+        msg.msg_control = controlBuffer.data();
+        msg.msg_controllen = controlSize;
+
+        struct cmsghdr *cmsgptr = CMSG_FIRSTHDR(&msg);
+        cmsgptr->cmsg_level = SOL_SOCKET;
+        cmsgptr->cmsg_type = SCM_RIGHTS;
+        cmsgptr->cmsg_len = CMSG_LEN(descriptorsSize);
+        memcpy(CMSG_DATA(cmsgptr), descriptors.constData(), descriptorsSize);
+    }
+
+    ssize_t writtenBytes = qt_safe_sendmsg(socketDescriptor, &msg, 0);
+
+    if (writtenBytes < 0) {
+        switch (errno) {
+        case EPIPE:
+        case ECONNRESET:
+            writtenBytes = -1;
+            setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+            q->close();
+            break;
+        case EAGAIN:
+            writtenBytes = 0;
+            break;
+        case EMSGSIZE:
+            setError(QAbstractSocket::DatagramTooLargeError, DatagramTooLargeErrorString);
+            break;
+        case EBADF:
+        case ETOOMANYREFS:
+            setError(QAbstractSocket::SocketResourceError, ResourceErrorString);
+            break;
+        default:
+            setError(QAbstractSocket::NetworkError, WriteErrorString);
+            break;
+        }
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeWriteWithFileDescriptors(%p, %llu, %d descriptors) == %i",
+           data, len, descriptors.size(), (int) writtenBytes);
+#endif
+
+    return qint64(writtenBytes);
 }
 
 qint64 QNativeSocketEnginePrivate::nativeWrite(const char *data, qint64 len)
@@ -1330,6 +1625,96 @@ qint64 QNativeSocketEnginePrivate::nativeWrite(const char *data, qint64 len)
 
     return qint64(writtenBytes);
 }
+
+qint64 QNativeSocketEnginePrivate::nativeWriteBlocks(const char * const *blocks, const qint64 *sizes,
+                                                     int count)
+{
+    Q_Q(QNativeSocketEngine);
+
+    // well below IOV_MAX on all supported systems
+    enum { MaxBlocks = 64 };
+    struct iovec vec[MaxBlocks];
+    count = qMin(count, int(MaxBlocks));
+    for (int i = 0; i < count; ++i) {
+        vec[i].iov_base = const_cast<char *>(blocks[i]);
+        vec[i].iov_len = sizes[i];
+    }
+
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = vec;
+    msg.msg_iovlen = count;
+
+    ssize_t writtenBytes = qt_safe_sendmsg(socketDescriptor, &msg, 0);
+
+    if (writtenBytes < 0) {
+        switch (errno) {
+        case EPIPE:
+        case ECONNRESET:
+            writtenBytes = -1;
+            setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+            q->close();
+            break;
+        case EAGAIN:
+            writtenBytes = 0;
+            break;
+        default:
+            setError(QAbstractSocket::NetworkError, WriteErrorString);
+            break;
+        }
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeWriteBlocks(%d blocks) == %i", count, (int) writtenBytes);
+#endif
+
+    return qint64(writtenBytes);
+}
+
+qint64 QNativeSocketEnginePrivate::nativeSendFile(QFile *file, qint64 offset, qint64 length)
+{
+    Q_Q(QNativeSocketEngine);
+#ifdef Q_OS_LINUX
+    // files without a descriptor (e.g. resources) go through the generic copy
+    const int fd = file->handle();
+    if (fd != -1) {
+        // bound each call so that other sockets get a chance to be serviced
+        enum { MaxChunkSize = 1024 * 1024 };
+        QT_OFF_T pos = offset;
+        ssize_t sentBytes;
+        EINTR_LOOP(sentBytes, QT_SENDFILE(socketDescriptor, fd, &pos,
+                                          size_t(qMin<qint64>(length, MaxChunkSize))));
+
+        if (sentBytes < 0) {
+            switch (errno) {
+            case EPIPE:
+            case ECONNRESET:
+                setError(QAbstractSocket::RemoteHostClosedError, RemoteHostClosedErrorString);
+                q->close();
+                return -1;
+            case EAGAIN:
+                return 0;
+            case EINVAL:
+            case ENOSYS:
+                break;
+            default:
+                setError(QAbstractSocket::NetworkError, WriteErrorString);
+                return -1;
+            }
+        } else if (sentBytes > 0 || length == 0) {
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+            qDebug("QNativeSocketEnginePrivate::nativeSendFile(%d, %lld, %lld) == %lld",
+                   fd, offset, length, qint64(sentBytes));
+#endif
+            return qint64(sentBytes);
+        }
+        // the file can't be used with sendfile(), or it shrank: let the
+        // generic code deal with it
+    }
+#endif
+    return q->QAbstractSocketEngine::sendFile(file, offset, length);
+}
+
 /*
 */
 qint64 QNativeSocketEnginePrivate::nativeRead(char *data, qint64 maxSize)
@@ -1341,7 +1726,49 @@ qint64 QNativeSocketEnginePrivate::nativeRead(char *data, qint64 maxSize)
     }
 
     ssize_t r = 0;
-    r = qt_safe_read(socketDescriptor, data, maxSize);
+    if (passFileDescriptors) {
+        struct iovec vec;
+        vec.iov_base = data;
+        vec.iov_len = maxSize;
+
+        union {
+            struct cmsghdr header;
+            char buffer[CMSG_SPACE(sizeof(int) * MaxPassedFileDescriptors)];
+        } control;
+
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = &vec;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control.buffer;
+        msg.msg_controllen = sizeof(control.buffer);
+
+        int flags = 0;
+#ifdef MSG_CMSG_CLOEXEC
+        flags |= MSG_CMSG_CLOEXEC;
+#endif
+        r = qt_safe_recvmsg(socketDescriptor, &msg, flags);
+
+        if (r >= 0 && msg.msg_controllen > 0) {
+            for (struct cmsghdr *cmsgptr = CMSG_FIRSTHDR(&msg); cmsgptr != nullptr;
+                 cmsgptr = CMSG_NXTHDR(&msg, cmsgptr)) {
+                if (cmsgptr->cmsg_level != SOL_SOCKET || cmsgptr->cmsg_type != SCM_RIGHTS)
+                    continue;
+                const int count = int((cmsgptr->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+                const int *descriptors = reinterpret_cast<const int *>(CMSG_DATA(cmsgptr));
+                for (int i = 0; i < count; ++i) {
+                    int descriptor;
+                    memcpy(&descriptor, descriptors + i, sizeof(int));
+#ifndef MSG_CMSG_CLOEXEC
+                    ::fcntl(descriptor, F_SETFD, FD_CLOEXEC);
+#endif
+                    receivedFileDescriptors.append(descriptor);
+                }
+            }
+        }
+    } else {
+        r = qt_safe_read(socketDescriptor, data, maxSize);
+    }
 
     if (r < 0) {
         r = -1;
@@ -216,6 +216,7 @@ static void convertToLevelAndOption(QNativeSocketEngine::SocketOption opt,
     case QNativeSocketEngine::NonBlockingSocketOption:      // WSAIoctl
     case QNativeSocketEngine::TypeOfServiceOption:          // not supported
     case QNativeSocketEngine::MaxStreamsSocketOption:
+    case QNativeSocketEngine::ReusePortOption:
         Q_UNREACHABLE();
 
     case QNativeSocketEngine::ReceiveBufferSocketOption:
@@ -457,6 +458,7 @@ int QNativeSocketEnginePrivate::option(QNativeSocketEngine::SocketOption opt) co
     }
     case QNativeSocketEngine::TypeOfServiceOption:
     case QNativeSocketEngine::MaxStreamsSocketOption:
+    case QNativeSocketEngine::ReusePortOption:
         return -1;
 
     default:
@@ -508,6 +510,7 @@ bool QNativeSocketEnginePrivate::setOption(QNativeSocketEngine::SocketOption opt
         }
     case QNativeSocketEngine::TypeOfServiceOption:
     case QNativeSocketEngine::MaxStreamsSocketOption:
+    case QNativeSocketEngine::ReusePortOption:
         return false;
 
     default:
@@ -1430,6 +1433,24 @@ qint64 QNativeSocketEnginePrivate::nativeSendDatagram(const char *data, qint64 l
     return ret;
 }
 
+#ifndef QT_NO_UDPSOCKET
+int QNativeSocketEnginePrivate::nativeReceiveDatagrams(QNetworkDatagramPrivate * const *datagrams,
+                                                       int count, qint64 maxSize,
+                                                       QAbstractSocketEngine::PacketHeaderOptions options)
+{
+    // Windows has no batched receive; read the datagrams one by one
+    Q_Q(QNativeSocketEngine);
+    return q->QAbstractSocketEngine::readDatagrams(datagrams, count, maxSize, options);
+}
+
+int QNativeSocketEnginePrivate::nativeSendDatagrams(const QNetworkDatagramPrivate * const *datagrams,
+                                                    int count)
+{
+    Q_Q(QNativeSocketEngine);
+    return q->QAbstractSocketEngine::writeDatagrams(datagrams, count);
+}
+#endif // QT_NO_UDPSOCKET
+
 
 qint64 QNativeSocketEnginePrivate::nativeWrite(const char *data, qint64 len)
 {
@@ -1489,6 +1510,53 @@ qint64 QNativeSocketEnginePrivate::nativeWrite(const char *data, qint64 len)
     return ret;
 }
 
+qint64 QNativeSocketEnginePrivate::nativeWriteBlocks(const char * const *blocks, const qint64 *sizes,
+                                                     int count)
+{
+    Q_Q(QNativeSocketEngine);
+
+    enum { MaxBlocks = 64 };
+    WSABUF bufs[MaxBlocks];
+    count = qMin(count, int(MaxBlocks));
+    for (int i = 0; i < count; ++i) {
+        bufs[i].buf = const_cast<char *>(blocks[i]);
+        bufs[i].len = sizes[i];
+    }
+
+    DWORD bytesWritten = 0;
+    if (::WSASend(socketDescriptor, bufs, count, &bytesWritten, 0, 0, 0) == SOCKET_ERROR) {
+        int err = WSAGetLastError();
+        WS_ERROR_DEBUG(err);
+        switch (err) {
+        case WSAEWOULDBLOCK:
+        case WSAENOBUFS:
+            return 0;
+        case WSAECONNRESET:
+        case WSAECONNABORTED:
+            setError(QAbstractSocket::NetworkError, WriteErrorString);
+            q->close();
+            return -1;
+        default:
+            setError(QAbstractSocket::NetworkError, WriteErrorString);
+            return -1;
+        }
+    }
+
+#if defined (QNATIVESOCKETENGINE_DEBUG)
+    qDebug("QNativeSocketEnginePrivate::nativeWriteBlocks(%d blocks) == %li", count, long(bytesWritten));
+#endif
+
+    return qint64(bytesWritten);
+}
+
+qint64 QNativeSocketEnginePrivate::nativeSendFile(QFile *file, qint64 offset, qint64 length)
+{
+    // TransmitFile() blocks on non-overlapped sockets, which the event
+    // dispatcher can not cope with; copy through user space instead
+    Q_Q(QNativeSocketEngine);
+    return q->QAbstractSocketEngine::sendFile(file, offset, length);
+}
+
 qint64 QNativeSocketEnginePrivate::nativeRead(char *data, qint64 maxLength)
 {
     qint64 ret = -1;
@@ -104,6 +104,7 @@
 #include "qhostaddress.h"
 #include "qlist.h"
 #include "qpointer.h"
+#include "qthread.h"
 #include "qabstractsocketengine_p.h"
 #include "qtcpsocket.h"
 #include "qnetworkproxy.h"
@@ -124,6 +125,8 @@ QTcpServerPrivate::QTcpServerPrivate()
  , socketEngine(0)
  , serverSocketError(QAbstractSocket::UnknownSocketError)
  , maxConnections(30)
+ , acceptThreadCount(0)
+ , acceptedConnections(0)
 {
 }
 
@@ -218,6 +221,10 @@ void QTcpServerPrivate::readNotification()
 #if defined (QTCPSERVER_DEBUG)
         qDebug("QTcpServerPrivate::_q_processIncomingConnection() accepted socket %i", descriptor);
 #endif
+        {
+            QMutexLocker locker(&acceptMutex);
+            ++acceptedConnections;
+        }
         q->incomingConnection(descriptor);
 
         QPointer<QTcpServer> that = q;
@@ -227,6 +234,214 @@ void QTcpServerPrivate::readNotification()
     }
 }
 
+/*! \internal
+
+    Services one of the additional listening sockets created for
+    QTcpServer::setAcceptThreadCount(). It lives in its own thread.
+*/
+class QTcpServerAcceptor : public QObject, public QAbstractSocketEngineReceiver
+{
+public:
+    explicit QTcpServerAcceptor(QTcpServerPrivate *server)
+        : server(server), socketEngine(0), acceptThread(new QThread)
+    {}
+
+    // from QAbstractSocketEngineReceiver
+    void readNotification() Q_DECL_OVERRIDE;
+    void closeNotification() Q_DECL_OVERRIDE { readNotification(); }
+    void writeNotification() Q_DECL_OVERRIDE {}
+    void exceptionNotification() Q_DECL_OVERRIDE {}
+    void connectionNotification() Q_DECL_OVERRIDE {}
+#ifndef QT_NO_NETWORKPROXY
+    void proxyAuthenticationRequired(const QNetworkProxy &, QAuthenticator *) Q_DECL_OVERRIDE {}
+#endif
+
+    QTcpServerPrivate *server;
+    QAbstractSocketEngine *socketEngine;
+    QThread *acceptThread;
+};
+
+void QTcpServerAcceptor::readNotification()
+{
+    for (;;) {
+        int descriptor = socketEngine->accept();
+        if (descriptor == -1) {
+            if (socketEngine->error() != QAbstractSocket::TemporaryError) {
+                socketEngine->setReadNotificationEnabled(false);
+                server->reportAcceptError(socketEngine->error(), socketEngine->errorString());
+            }
+            break;
+        }
+#if defined (QTCPSERVER_DEBUG)
+        qDebug("QTcpServerAcceptor::readNotification() accepted socket %i", descriptor);
+#endif
+        server->acceptedInThread(descriptor);
+    }
+}
+
+/*! \internal
+
+    Creates acceptThreadCount listening sockets bound to \a address and \a
+    port next to the one of the server, and starts a thread servicing each.
+    The server's socket must have been bound with ReusePortOption.
+*/
+bool QTcpServerPrivate::startAcceptThreads(const QHostAddress &address, quint16 port,
+                                           const QNetworkProxy &proxy)
+{
+    for (int i = 0; i < acceptThreadCount; ++i) {
+        QTcpServerAcceptor *acceptor = new QTcpServerAcceptor(this);
+        QAbstractSocketEngine *engine =
+                QAbstractSocketEngine::createSocketEngine(socketType, proxy, acceptor);
+        if (!engine || !engine->initialize(socketType, socketEngine->protocol())
+            || !engine->setOption(QAbstractSocketEngine::ReusePortOption, 1)
+            || !engine->bind(address, port) || !engine->listen()) {
+#if defined (QTCPSERVER_DEBUG)
+            qDebug("QTcpServerPrivate::startAcceptThreads() failed (%s)",
+                   engine ? engine->errorString().toLatin1().constData() : "no engine");
+#endif
+            delete acceptor->acceptThread;
+            delete acceptor;
+            stopAcceptThreads();
+            return false;
+        }
+
+        acceptor->socketEngine = engine;
+        acceptor->acceptThread->setObjectName(QLatin1String("QTcpServer accept thread"));
+        acceptor->moveToThread(acceptor->acceptThread);
+        acceptor->acceptThread->start();
+        QMetaObject::invokeMethod(acceptor, [acceptor]() {
+            acceptor->socketEngine->setReceiver(acceptor);
+            acceptor->socketEngine->setReadNotificationEnabled(true);
+        }, Qt::QueuedConnection);
+        acceptors.append(acceptor);
+    }
+    return true;
+}
+
+/*! \internal
+
+    Closes the listening sockets of the accept threads and waits for the
+    threads to finish. Connections they accepted that did not reach the
+    server's thread yet are closed.
+*/
+void QTcpServerPrivate::stopAcceptThreads()
+{
+    QVector<QThread *> threads;
+    threads.reserve(acceptors.size());
+    for (QTcpServerAcceptor *acceptor : qAsConst(acceptors)) {
+        QThread *thread = acceptor->acceptThread;
+        threads.append(thread);
+        // deleted in its own thread, together with its socket engine
+        acceptor->deleteLater();
+        thread->quit();
+    }
+    acceptors.clear();
+
+    for (QThread *thread : qAsConst(threads)) {
+        thread->wait();
+        delete thread;
+    }
+
+    QVector<qintptr> descriptors;
+    {
+        QMutexLocker locker(&acceptMutex);
+        descriptors.swap(handedOverConnections);
+    }
+    for (qintptr descriptor : qAsConst(descriptors)) {
+        QTcpSocket socket;
+        socket.setSocketDescriptor(descriptor);
+    }
+}
+
+/*! \internal
+*/
+void QTcpServerPrivate::setAcceptorsEnabled(bool enable)
+{
+    for (QTcpServerAcceptor *acceptor : qAsConst(acceptors)) {
+        QMetaObject::invokeMethod(acceptor, [acceptor, enable]() {
+            acceptor->socketEngine->setReadNotificationEnabled(enable);
+        }, Qt::QueuedConnection);
+    }
+}
+
+/*! \internal
+
+    Called in an accept thread for each connection it accepted.
+*/
+void QTcpServerPrivate::acceptedInThread(qintptr socketDescriptor)
+{
+    Q_Q(QTcpServer);
+    {
+        QMutexLocker locker(&acceptMutex);
+        ++acceptedConnections;
+    }
+    q->incomingConnection(socketDescriptor);
+}
+
+/*! \internal
+
+    Called in an accept thread when accepting failed; reports the error from
+    the server's thread.
+*/
+void QTcpServerPrivate::reportAcceptError(QAbstractSocket::SocketError error,
+                                          const QString &errorString)
+{
+    Q_Q(QTcpServer);
+    QMetaObject::invokeMethod(q, [this, error, errorString]() {
+        Q_Q(QTcpServer);
+        if (state != QAbstractSocket::ListeningState)
+            return;
+        q->pauseAccepting();
+        serverSocketError = error;
+        serverSocketErrorString = errorString;
+        emit q->acceptError(error);
+    }, Qt::QueuedConnection);
+}
+
+/*! \internal
+
+    Queues a connection accepted in an accept thread for the default
+    incomingConnection() implementation in the server's thread.
+*/
+void QTcpServerPrivate::handOverConnection(qintptr socketDescriptor)
+{
+    Q_Q(QTcpServer);
+    QMutexLocker locker(&acceptMutex);
+    handedOverConnections.append(socketDescriptor);
+    if (handedOverConnections.size() == 1) {
+        locker.unlock();
+        QMetaObject::invokeMethod(q, [this]() { processHandedOverConnections(); },
+                                  Qt::QueuedConnection);
+    }
+}
+
+/*! \internal
+*/
+void QTcpServerPrivate::processHandedOverConnections()
+{
+    Q_Q(QTcpServer);
+    QVector<qintptr> descriptors;
+    {
+        QMutexLocker locker(&acceptMutex);
+        descriptors.swap(handedOverConnections);
+    }
+
+    // create all the sockets first, so that none is lost if a slot
+    // connected to newConnection() deletes the server
+    for (qintptr descriptor : qAsConst(descriptors)) {
+        QTcpSocket *socket = new QTcpSocket(q);
+        socket->setSocketDescriptor(descriptor);
+        q->addPendingConnection(socket);
+    }
+
+    QPointer<QTcpServer> that = q;
+    for (int i = 0; i < descriptors.size(); ++i) {
+        emit q->newConnection();
+        if (!that || !q->isListening())
+            return;
+    }
+}
+
 /*!
     Constructs a QTcpServer object.
 
@@ -329,6 +544,13 @@ bool QTcpServer::listen(const QHostAddress &address, quint16 port)
 
     d->configureCreatedSocket();
 
+    bool reusePort = false;
+#ifdef Q_OS_LINUX
+    // Linux distributes new connections over all the sockets listening with SO_REUSEPORT
+    if (d->acceptThreadCount > 0 && d->socketType == QAbstractSocket::TcpSocket)
+        reusePort = d->socketEngine->setOption(QAbstractSocketEngine::ReusePortOption, 1);
+#endif
+
     if (!d->socketEngine->bind(addr, port)) {
         d->serverSocketError = d->socketEngine->error();
         d->serverSocketErrorString = d->socketEngine->errorString();
@@ -348,6 +570,13 @@ bool QTcpServer::listen(const QHostAddress &address, quint16 port)
     d->address = d->socketEngine->localAddress();
     d->port = d->socketEngine->localPort();
 
+    {
+        QMutexLocker locker(&d->acceptMutex);
+        d->acceptedConnections = 0;
+    }
+    if (reusePort)
+        d->startAcceptThreads(addr, d->port, proxy);
+
 #if defined (QTCPSERVER_DEBUG)
     qDebug("QTcpServer::listen(%i, \"%s\") == true (listening on port %i)", port,
            address.toString().toLatin1().constData(), d->socketEngine->localPort());
@@ -378,6 +607,8 @@ void QTcpServer::close()
 {
     Q_D(QTcpServer);
 
+    d->stopAcceptThreads();
+
     qDeleteAll(d->pendingConnections);
     d->pendingConnections.clear();
 
@@ -605,6 +836,12 @@ void QTcpServer::incomingConnection(qintptr socketDescriptor)
     qDebug("QTcpServer::incomingConnection(%i)", socketDescriptor);
 #endif
 
+    if (QThread::currentThread() != thread()) {
+        // called from an accept thread; create the socket in the server's thread
+        d_func()->handOverConnection(socketDescriptor);
+        return;
+    }
+
     QTcpSocket *socket = new QTcpSocket(this);
     socket->setSocketDescriptor(socketDescriptor);
     addPendingConnection(socket);
@@ -657,6 +894,75 @@ int QTcpServer::maxPendingConnections() const
     return d_func()->maxConnections;
 }
 
+/*!
+    \since 5.11
+
+    Sets the number of additional threads accepting connections for this
+    server to \a count. The default is 0, which means all connections are
+    accepted in the thread the server lives in.
+
+    When \a count is greater than 0, listen() opens \a count more sockets
+    listening on the same address and port using the SO_REUSEPORT socket
+    option, each serviced by the event loop of its own thread. The operating
+    system then distributes new connections between them and the server's
+    own socket, which avoids a single thread becoming the bottleneck for
+    servers handling very high connection rates. This is only supported
+    on Linux; elsewhere, or when the server uses a proxy, the setting is
+    ignored.
+
+    Connections accepted by the additional threads are passed to
+    incomingConnection() in those threads. The default implementation
+    creates the QTcpSocket in the server's thread and emits newConnection()
+    as usual. A reimplementation must be thread-safe, and must not call
+    addPendingConnection() when it is not called in the server's thread;
+    a common choice is to hand the socket descriptor over to a worker
+    living in the thread it was accepted in. Subclasses reimplementing
+    incomingConnection() should call close() in their destructor.
+
+    \note Any process of the same user can bind to a port listened on with
+    SO_REUSEPORT and receive a share of its connections.
+
+    This function must be called before listen().
+
+    \sa acceptThreadCount(), acceptedConnectionCount()
+*/
+void QTcpServer::setAcceptThreadCount(int count)
+{
+    Q_D(QTcpServer);
+    if (d->state == QAbstractSocket::ListeningState) {
+        qWarning("QTcpServer::setAcceptThreadCount() called when already listening");
+        return;
+    }
+    d->acceptThreadCount = qMax(0, count);
+}
+
+/*!
+    \since 5.11
+
+    Returns the number of additional threads accepting connections for this
+    server.
+
+    \sa setAcceptThreadCount()
+*/
+int QTcpServer::acceptThreadCount() const
+{
+    return d_func()->acceptThreadCount;
+}
+
+/*!
+    \since 5.11
+
+    Returns the number of connections accepted since listen() was called,
+    including those accepted by the additional threads set with
+    setAcceptThreadCount(). This function is thread-safe.
+*/
+quint64 QTcpServer::acceptedConnectionCount() const
+{
+    Q_D(const QTcpServer);
+    QMutexLocker locker(&d->acceptMutex);
+    return d->acceptedConnections;
+}
+
 /*!
     Returns an error code for the last error that occurred.
 
@@ -687,7 +993,9 @@ QString QTcpServer::errorString() const
 */
 void QTcpServer::pauseAccepting()
 {
-    d_func()->socketEngine->setReadNotificationEnabled(false);
+    Q_D(QTcpServer);
+    d->socketEngine->setReadNotificationEnabled(false);
+    d->setAcceptorsEnabled(false);
 }
 
 /*!
@@ -699,7 +1007,9 @@ void QTcpServer::pauseAccepting()
 */
 void QTcpServer::resumeAccepting()
 {
-    d_func()->socketEngine->setReadNotificationEnabled(true);
+    Q_D(QTcpServer);
+    d->socketEngine->setReadNotificationEnabled(true);
+    d->setAcceptorsEnabled(true);
 }
 
 #ifndef QT_NO_NETWORKPROXY
@@ -69,6 +69,10 @@ public:
     void setMaxPendingConnections(int numConnections);
     int maxPendingConnections() const;
 
+    void setAcceptThreadCount(int count);
+    int acceptThreadCount() const;
+    quint64 acceptedConnectionCount() const;
+
     quint16 serverPort() const;
     QHostAddress serverAddress() const;
 
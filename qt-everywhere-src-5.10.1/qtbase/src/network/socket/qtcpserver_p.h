@@ -59,10 +59,14 @@
 #include "QtNetwork/qabstractsocket.h"
 #include "qnetworkproxy.h"
 #include "QtCore/qlist.h"
+#include "QtCore/qmutex.h"
+#include "QtCore/qvector.h"
 #include "qhostaddress.h"
 
 QT_BEGIN_NAMESPACE
 
+class QTcpServerAcceptor;
+
 class Q_NETWORK_EXPORT QTcpServerPrivate : public QObjectPrivate,
                                            public QAbstractSocketEngineReceiver
 {
@@ -85,6 +89,23 @@ public:
 
     int maxConnections;
 
+    // additional listening sockets sharing the port, each serviced by its own thread
+    int acceptThreadCount;
+    QVector<QTcpServerAcceptor *> acceptors;
+
+    mutable QMutex acceptMutex;
+    // protected by acceptMutex
+    QVector<qintptr> handedOverConnections;
+    quint64 acceptedConnections;
+
+    bool startAcceptThreads(const QHostAddress &address, quint16 port, const QNetworkProxy &proxy);
+    void stopAcceptThreads();
+    void setAcceptorsEnabled(bool enable);
+    void acceptedInThread(qintptr socketDescriptor);
+    void reportAcceptError(QAbstractSocket::SocketError error, const QString &errorString);
+    void handOverConnection(qintptr socketDescriptor);
+    void processHandedOverConnections();
+
 #ifndef QT_NO_NETWORKPROXY
     QNetworkProxy proxy;
     QNetworkProxy resolveProxy(const QHostAddress &address, quint16 port);
@@ -68,6 +68,10 @@
 #include "qtcpsocket_p.h"
 #include "qlist.h"
 #include "qhostaddress.h"
+#include "qfile.h"
+#ifndef QT_NO_SSL
+#include "qsslsocket.h"
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -100,6 +104,77 @@ QTcpSocket::~QTcpSocket()
 #endif
 }
 
+/*!
+    \since 5.11
+
+    Sends \a length bytes of \a file, starting at \a offset, after any data
+    already written to the socket. If \a length is -1 (the default), the rest
+    of the file is sent. Data written after this call is sent once the file
+    has been. Returns \c true if the transfer was queued; otherwise returns
+    \c false, for instance if \a file is not open for reading or the range
+    lies outside of it.
+
+    Unlike reading the file and passing its contents to write(), this does
+    not copy the file into the socket's write buffer: the data is read from
+    the file only when the socket can accept more. On Linux it is handed over
+    by the kernel without passing through the application at all (using \c
+    sendfile()). bytesWritten() is emitted as the file's contents are sent,
+    and bytesToWrite() includes the part of the file not sent yet.
+
+    \a file must stay open, and must not be read from, resized or destroyed,
+    until it has been sent; its current position is unspecified afterwards.
+    On encrypted sockets the file contents are read immediately and written
+    with write().
+
+    \sa write(), bytesToWrite()
+*/
+bool QTcpSocket::sendFile(QFile *file, qint64 offset, qint64 length)
+{
+    Q_D(QTcpSocket);
+    if (!file || !file->isReadable()) {
+        qWarning("QTcpSocket::sendFile: file is not open for reading");
+        return false;
+    }
+    if (!isWritable()) {
+        qWarning("QTcpSocket::sendFile: device not open for writing");
+        return false;
+    }
+    if (d->state == UnconnectedState) {
+        d->setError(UnknownSocketError, QAbstractSocket::tr("Socket is not connected"));
+        return false;
+    }
+
+    const qint64 fileSize = file->size();
+    if (length < 0)
+        length = fileSize - offset;
+    if (offset < 0 || length < 0 || offset + length > fileSize)
+        return false;
+    if (length == 0)
+        return true;
+
+    bool queue = d->socketType == TcpSocket && !file->isSequential();
+#ifndef QT_NO_SSL
+    // the data needs to go through the encryption layer
+    if (qobject_cast<QSslSocket *>(this))
+        queue = false;
+#endif
+    if (queue) {
+        d->queueFile(file, offset, length);
+        return true;
+    }
+
+    if (!file->isSequential() && !file->seek(offset))
+        return false;
+    char buffer[16384];
+    while (length > 0) {
+        const qint64 readBytes = file->read(buffer, qMin<qint64>(sizeof(buffer), length));
+        if (readBytes <= 0 || write(buffer, readBytes) != readBytes)
+            return false;
+        length -= readBytes;
+    }
+    return true;
+}
+
 /*!
     \internal
 */
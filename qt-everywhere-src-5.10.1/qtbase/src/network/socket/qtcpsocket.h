@@ -47,6 +47,7 @@
 QT_BEGIN_NAMESPACE
 
 
+class QFile;
 class QTcpSocketPrivate;
 
 class Q_NETWORK_EXPORT QTcpSocket : public QAbstractSocket
@@ -56,6 +57,8 @@ public:
     explicit QTcpSocket(QObject *parent = Q_NULLPTR);
     virtual ~QTcpSocket();
 
+    bool sendFile(QFile *file, qint64 offset = 0, qint64 length = -1);
+
 protected:
     QTcpSocket(QTcpSocketPrivate &dd, QObject *parent = Q_NULLPTR);
     QTcpSocket(QAbstractSocket::SocketType socketType, QTcpSocketPrivate &dd,
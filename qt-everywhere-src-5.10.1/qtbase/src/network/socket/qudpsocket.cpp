@@ -430,6 +430,68 @@ qint64 QUdpSocket::writeDatagram(const QNetworkDatagram &datagram)
     return sent;
 }
 
+/*!
+    \since 5.11
+
+    Sends the datagrams in \a datagrams, in order, as writeDatagram() would
+    send each of them. On platforms that support it (such as Linux), several
+    datagrams are handed to the operating system in a single call.
+
+    Returns the number of datagrams sent, which can be less than the size of
+    \a datagrams if the socket's send buffer filled up or an error occurred
+    part-way; the remaining datagrams can be passed again later. Returns -1 if
+    no datagram could be sent.
+
+    \sa writeDatagram(), receiveDatagrams()
+*/
+int QUdpSocket::writeDatagrams(const QVector<QNetworkDatagram> &datagrams)
+{
+    Q_D(QUdpSocket);
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::writeDatagrams(%d)", datagrams.size());
+#endif
+    if (datagrams.isEmpty())
+        return 0;
+    if (!d->doEnsureInitialized(QHostAddress::Any, 0, datagrams.first().destinationAddress()))
+        return -1;
+    if (state() == UnconnectedState)
+        bind();
+
+    enum { BatchSize = 64 };
+    const QNetworkDatagramPrivate *batch[BatchSize];
+    int sent = 0;
+    qint64 bytes = 0;
+    int result = 0;
+    while (sent < datagrams.size()) {
+        const int count = qMin(int(BatchSize), datagrams.size() - sent);
+        for (int i = 0; i < count; ++i)
+            batch[i] = datagrams.at(sent + i).d;
+
+        result = d->socketEngine->writeDatagrams(batch, count);
+        if (result <= 0)
+            break;
+        for (int i = 0; i < result; ++i)
+            bytes += batch[i]->data.size();
+        sent += result;
+        if (result < count)
+            break;
+    }
+    d->cachedSocketDescriptor = d->socketEngine->socketDescriptor();
+
+    if (sent > 0) {
+        emit bytesWritten(bytes);
+        return sent;
+    }
+    if (result == -2) {
+        // Socket engine reports EAGAIN. Treat as a temporary error.
+        d->setErrorAndEmit(QAbstractSocket::TemporaryError,
+                           tr("Unable to send a datagram"));
+    } else {
+        d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+    }
+    return -1;
+}
+
 /*!
     Receives a datagram no larger than \a maxSize bytes and returns it in the
     QNetworkDatagram object, along with the sender's host address and port. If
@@ -473,6 +535,57 @@ QNetworkDatagram QUdpSocket::receiveDatagram(qint64 maxSize)
     return result;
 }
 
+/*!
+    \since 5.11
+
+    Receives up to \a maxCount pending datagrams, each no larger than \a
+    maxSize bytes, and returns them in the order they arrived, along with their
+    sender and destination information as in receiveDatagram(). On platforms
+    that support it (such as Linux), the datagrams are read from the operating
+    system in batches, which is considerably cheaper than calling
+    receiveDatagram() once per datagram.
+
+    Returns an empty list if no datagram was pending or if an error occurred.
+
+    \a maxSize has the same meaning as in receiveDatagram().
+
+    \sa receiveDatagram(), writeDatagrams()
+*/
+QVector<QNetworkDatagram> QUdpSocket::receiveDatagrams(int maxCount, qint64 maxSize)
+{
+    Q_D(QUdpSocket);
+
+#if defined QUDPSOCKET_DEBUG
+    qDebug("QUdpSocket::receiveDatagrams(%d, %lld)", maxCount, maxSize);
+#endif
+    QT_CHECK_BOUND("QUdpSocket::receiveDatagrams()", QVector<QNetworkDatagram>());
+
+    enum { BatchSize = 64 };
+    QVector<QNetworkDatagram> result;
+    QNetworkDatagramPrivate *batch[BatchSize];
+    bool failed = false;
+    while (result.size() < maxCount) {
+        const int first = result.size();
+        const int count = qMin(int(BatchSize), maxCount - first);
+        result.resize(first + count);
+        for (int i = 0; i < count; ++i)
+            batch[i] = result[first + i].d;
+
+        const int received = d->socketEngine->readDatagrams(batch, count, maxSize,
+                                                            QAbstractSocketEngine::WantAll);
+        failed = received < 0;
+        result.resize(first + qMax(received, 0));
+        if (received < count)
+            break;
+    }
+
+    d->hasPendingData = false;
+    d->socketEngine->setReadNotificationEnabled(true);
+    if (failed)
+        d->setErrorAndEmit(d->socketEngine->error(), d->socketEngine->errorString());
+    return result;
+}
+
 /*!
     Receives a datagram no larger than \a maxSize bytes and stores
     it in \a data. The sender's host address and port is stored in
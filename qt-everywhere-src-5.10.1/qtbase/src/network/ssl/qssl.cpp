@@ -167,7 +167,10 @@ Q_LOGGING_CATEGORY(lcSsl, "qt.network.ssl");
     option can allow connections for legacy servers, but it introduces the
     possibility that an attacker could inject plaintext into the SSL session.
     \value SslOptionDisableSessionSharing Disables SSL session sharing via
-    the session ID handshake attribute.
+    the session ID handshake attribute. Since Qt 5.11 this also stops client
+    sockets from resuming, or offering to other sockets, the sessions kept in
+    the process-wide session cache of the OpenSSL backend, which holds the
+    last session of up to 256 verified peers, keyed by peer name and port.
     \value SslOptionDisableSessionPersistence Disables storing the SSL session
     in ASN.1 format as returned by QSslConfiguration::sessionTicket(). Enabling
     this feature adds memory overhead of approximately 1K per used session
@@ -227,6 +227,57 @@ int QSslContext::sessionTicketLifeTimeHint() const
     return m_sessionTicketLifeTimeHint;
 }
 
+Q_GLOBAL_STATIC(QSslSessionCache, globalSessionCache)
+
+QSslSessionCache *QSslSessionCache::instance()
+{
+    return globalSessionCache();
+}
+
+QSslSessionCache::Entry::~Entry()
+{
+    q_SSL_SESSION_free(session);
+}
+
+// Called when a handshake completed, replaces any session cached for 'key'
+void QSslSessionCache::insert(const QByteArray &key, SSL *ssl)
+{
+    SSL_SESSION *session = q_SSL_get1_session(ssl);
+    if (!session)
+        return;
+
+    Entry *entry = new Entry(session);
+    // The hint is in seconds, 0 means it is not specified:
+    if (const unsigned long hint = q_SSL_SESSION_get_ticket_lifetime_hint(session))
+        entry->expiry.setRemainingTime(qint64(hint) * 1000);
+
+    QMutexLocker locker(&mutex);
+    entries.insert(key, entry);
+}
+
+// Offers the session cached for 'key', if any, on a handshake not started yet
+bool QSslSessionCache::resume(const QByteArray &key, SSL *ssl)
+{
+    QMutexLocker locker(&mutex);
+    Entry *entry = entries.object(key);
+    if (!entry)
+        return false;
+
+    if (entry->expiry.hasExpired()) {
+        entries.remove(key);
+        return false;
+    }
+
+    // SSL_set_session takes its own reference:
+    if (!q_SSL_set_session(ssl, entry->session)) {
+        qCWarning(lcSsl, "could not set SSL session");
+        entries.remove(key);
+        return false;
+    }
+
+    return true;
+}
+
 QSslError::SslError QSslContext::error() const
 {
     return errorCode;
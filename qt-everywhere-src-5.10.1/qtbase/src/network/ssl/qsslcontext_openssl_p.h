@@ -55,6 +55,9 @@
 
 #include <QtNetwork/private/qtnetworkglobal_p.h>
 #include <QtCore/qvariant.h>
+#include <QtCore/qcache.h>
+#include <QtCore/qdeadlinetimer.h>
+#include <QtCore/qmutex.h>
 #include <QtNetwork/qsslcertificate.h>
 #include <QtNetwork/qsslconfiguration.h>
 #include <openssl/ssl.h>
@@ -123,6 +126,32 @@ private:
 #endif // OPENSSL_VERSION_NUMBER >= 0x1000100fL ...
 };
 
+// Process-wide cache of client sessions, it lets sockets that do not share
+// a QSslContext resume a session established by another socket.
+class QSslSessionCache
+{
+public:
+    enum { MaxEntries = 256 };
+
+    static QSslSessionCache *instance();
+
+    void insert(const QByteArray &key, SSL *ssl);
+    bool resume(const QByteArray &key, SSL *ssl);
+
+private:
+    struct Entry
+    {
+        explicit Entry(SSL_SESSION *s) : session(s) {}
+        ~Entry();
+
+        SSL_SESSION *session;
+        QDeadlineTimer expiry{QDeadlineTimer::Forever};
+    };
+
+    QMutex mutex;
+    QCache<QByteArray, Entry> entries{MaxEntries};
+};
+
 #endif // QT_NO_SSL
 
 QT_END_NAMESPACE
@@ -340,6 +340,8 @@ bool QSslSocketBackendPrivate::initSslContext()
         }
     }
 
+    resumeSharedSession();
+
     // Clear the session.
     errorList.clear();
 
@@ -1035,6 +1037,58 @@ void QSslSocketBackendPrivate::storePeerCertificates()
     }
 }
 
+// Client sessions are shared through QSslSessionCache, across sockets which
+// talk to the same peer with the same local certificate and protocol.
+QByteArray QSslSocketBackendPrivate::sharedSessionKey() const
+{
+    Q_Q(const QSslSocket);
+
+    QString peer = verificationPeerName.isEmpty() ? q->peerName() : verificationPeerName;
+    if (peer.isEmpty())
+        peer = hostName;
+
+    QByteArray key = QUrl::toAce(peer);
+    key += ':' + QByteArray::number(q->peerPort());
+    key += '/' + QByteArray::number(int(configuration.protocol));
+    if (!configuration.localCertificateChain.isEmpty())
+        key += '/' + configuration.localCertificateChain.first().digest(QCryptographicHash::Sha256).toHex();
+    return key;
+}
+
+void QSslSocketBackendPrivate::resumeSharedSession()
+{
+    if (mode != QSslSocket::SslClientMode
+        || (configuration.sslOptions & QSsl::SslOptionDisableSessionSharing)) {
+        return;
+    }
+
+    // A session from our own QSslContext (or the user's session ticket) wins:
+    if (q_SSL_get_session(ssl))
+        return;
+
+    if (QSslSessionCache *cache = QSslSessionCache::instance())
+        cache->resume(sharedSessionKey(), ssl);
+}
+
+void QSslSocketBackendPrivate::storeSharedSession()
+{
+    if (mode != QSslSocket::SslClientMode
+        || (configuration.sslOptions & QSsl::SslOptionDisableSessionSharing)) {
+        return;
+    }
+
+    // OpenSSL does not verify the peer again when a session is resumed, only
+    // store the sessions of handshakes that verified the peer without errors.
+    if (configuration.peerVerifyMode == QSslSocket::VerifyNone
+        || configuration.peerVerifyMode == QSslSocket::QueryPeer
+        || !sslErrors.isEmpty()) {
+        return;
+    }
+
+    if (QSslSessionCache *cache = QSslSessionCache::instance())
+        cache->insert(sharedSessionKey(), ssl);
+}
+
 bool QSslSocketBackendPrivate::checkSslErrors()
 {
     Q_Q(QSslSocket);
@@ -239,6 +239,7 @@ void QSslSocketBackendPrivate::continueHandshake()
                 configuration.sslSessionTicketLifeTimeHint = sslContextPointer->sessionTicketLifeTimeHint();
             }
         }
+        storeSharedSession();
     }
 
 #if !defined(OPENSSL_NO_NEXTPROTONEG)
@@ -143,6 +143,9 @@ public:
     void continueHandshake() Q_DECL_OVERRIDE;
     bool checkSslErrors();
     void storePeerCertificates();
+    QByteArray sharedSessionKey() const;
+    void resumeSharedSession();
+    void storeSharedSession();
     unsigned int tlsPskClientCallback(const char *hint, char *identity, unsigned int max_identity_len, unsigned char *psk, unsigned int max_psk_len);
     unsigned int tlsPskServerCallback(const char *identity, unsigned char *psk, unsigned int max_psk_len);
 #ifdef Q_OS_WIN
@@ -371,6 +371,7 @@ void QSslSocketBackendPrivate::continueHandshake()
                 configuration.sslSessionTicketLifeTimeHint = sslContextPointer->sessionTicketLifeTimeHint();
             }
         }
+        storeSharedSession();
     }
 
 #if OPENSSL_VERSION_NUMBER >= 0x1000100fL && !defined(OPENSSL_NO_NEXTPROTONEG)
@@ -42,6 +42,8 @@
 #include "qeglpbuffer_p.h"
 #include <qpa/qplatformwindow.h>
 #include <QOpenGLContext>
+#include <QRegion>
+#include <QVarLengthArray>
 #include <QtPlatformHeaders/QEGLNativeContext>
 #include <QDebug>
 
@@ -94,6 +96,11 @@ QT_BEGIN_NAMESPACE
 #define EGL_CONTEXT_OPENGL_COMPATIBILITY_PROFILE_BIT_KHR 0x00000002
 #endif
 
+// Constant from EGL_EXT_buffer_age
+#ifndef EGL_BUFFER_AGE_EXT
+#define EGL_BUFFER_AGE_EXT 0x313D
+#endif
+
 // Constants for OpenGL which are not available in the ES headers.
 #ifndef GL_CONTEXT_FLAGS
 #define GL_CONTEXT_FLAGS 0x821E
@@ -121,6 +128,8 @@ QEGLPlatformContext::QEGLPlatformContext(const QSurfaceFormat &format, QPlatform
     , m_swapIntervalEnvChecked(false)
     , m_swapIntervalFromEnv(-1)
     , m_flags(flags)
+    , m_hasBufferAge(false)
+    , m_swapBuffersWithDamage(0)
 {
     if (nativeHandle.isNull()) {
         m_eglConfig = config ? *config : q_configFromGLFormat(display, format);
@@ -130,6 +139,19 @@ QEGLPlatformContext::QEGLPlatformContext(const QSurfaceFormat &format, QPlatform
         m_ownsContext = false;
         adopt(nativeHandle, share);
     }
+    resolveSwapExtensions();
+}
+
+void QEGLPlatformContext::resolveSwapExtensions()
+{
+    m_hasBufferAge = q_hasEglExtension(m_eglDisplay, "EGL_EXT_buffer_age");
+    if (q_hasEglExtension(m_eglDisplay, "EGL_KHR_swap_buffers_with_damage")) {
+        m_swapBuffersWithDamage = reinterpret_cast<SwapBuffersWithDamageProc>(
+                    eglGetProcAddress("eglSwapBuffersWithDamageKHR"));
+    } else if (q_hasEglExtension(m_eglDisplay, "EGL_EXT_swap_buffers_with_damage")) {
+        m_swapBuffersWithDamage = reinterpret_cast<SwapBuffersWithDamageProc>(
+                    eglGetProcAddress("eglSwapBuffersWithDamageEXT"));
+    }
 }
 
 void QEGLPlatformContext::init(const QSurfaceFormat &format, QPlatformOpenGLContext *share)
@@ -450,6 +472,51 @@ void QEGLPlatformContext::swapBuffers(QPlatformSurface *surface)
     }
 }
 
+void QEGLPlatformContext::swapBuffersWithDamage(QPlatformSurface *surface, const QRegion &damage)
+{
+    if (!m_swapBuffersWithDamage) {
+        swapBuffers(surface);
+        return;
+    }
+
+    eglBindAPI(m_api);
+    EGLSurface eglSurface = eglSurfaceForPlatformSurface(surface);
+    if (eglSurface == EGL_NO_SURFACE) // skip if using surfaceless context
+        return;
+
+    EGLint height = 0;
+    eglQuerySurface(m_eglDisplay, eglSurface, EGL_HEIGHT, &height);
+
+    // EGL expects the rectangles with the origin in the bottom-left corner
+    QVarLengthArray<EGLint, 64> rects;
+    rects.reserve(damage.rectCount() * 4);
+    for (const QRect &r : damage) {
+        rects.append(r.x());
+        rects.append(height - r.y() - r.height());
+        rects.append(r.width());
+        rects.append(r.height());
+    }
+
+    bool ok = m_swapBuffersWithDamage(m_eglDisplay, eglSurface, rects.data(), damage.rectCount());
+    if (!ok)
+        qWarning("QEGLPlatformContext: eglSwapBuffersWithDamage failed: %x", eglGetError());
+}
+
+int QEGLPlatformContext::bufferAge(QPlatformSurface *surface) const
+{
+    if (!m_hasBufferAge)
+        return 0;
+
+    EGLSurface eglSurface = const_cast<QEGLPlatformContext *>(this)->eglSurfaceForPlatformSurface(surface);
+    if (eglSurface == EGL_NO_SURFACE)
+        return 0;
+
+    EGLint age = 0;
+    if (!eglQuerySurface(m_eglDisplay, eglSurface, EGL_BUFFER_AGE_EXT, &age))
+        return 0;
+    return age;
+}
+
 QFunctionPointer QEGLPlatformContext::getProcAddress(const char *procName)
 {
     eglBindAPI(m_api);
@@ -45,6 +45,10 @@ QT_BEGIN_NAMESPACE
 
 class QAbstractEventDispatcher *createUnixEventDispatcher()
 {
+#if defined(Q_OS_LINUX)
+    if (QEventDispatcherEpoll::isRequested())
+        return new QUnixEpollEventDispatcherQPA();
+#endif
 #if !defined(QT_NO_GLIB) && !defined(Q_OS_WIN)
     if (qEnvironmentVariableIsEmpty("QT_NO_GLIB") && QEventDispatcherGlib::versionSupported())
         return new QPAEventDispatcherGlib();
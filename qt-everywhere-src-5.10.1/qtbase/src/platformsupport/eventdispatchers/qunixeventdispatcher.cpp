@@ -81,4 +81,31 @@ void QUnixEventDispatcherQPA::flush()
         qApp->sendPostedEvents();
 }
 
+#if defined(Q_OS_LINUX)
+QUnixEpollEventDispatcherQPA::QUnixEpollEventDispatcherQPA(QObject *parent)
+    : QEventDispatcherEpoll(parent)
+{ }
+
+QUnixEpollEventDispatcherQPA::~QUnixEpollEventDispatcherQPA()
+{ }
+
+bool QUnixEpollEventDispatcherQPA::processEvents(QEventLoop::ProcessEventsFlags flags)
+{
+    const bool didSendEvents = QEventDispatcherEpoll::processEvents(flags);
+    return QWindowSystemInterface::sendWindowSystemEvents(flags) || didSendEvents;
+}
+
+bool QUnixEpollEventDispatcherQPA::hasPendingEvents()
+{
+    extern uint qGlobalPostedEventsCount(); // from qapplication.cpp
+    return qGlobalPostedEventsCount() || QWindowSystemInterface::windowSystemEventsQueued();
+}
+
+void QUnixEpollEventDispatcherQPA::flush()
+{
+    if (qApp)
+        qApp->sendPostedEvents();
+}
+#endif
+
 QT_END_NAMESPACE
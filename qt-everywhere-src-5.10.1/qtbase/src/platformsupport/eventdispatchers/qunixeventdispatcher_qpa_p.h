@@ -53,6 +53,9 @@
 
 #include <QtCore/qglobal.h>
 #include <QtCore/private/qeventdispatcher_unix_p.h>
+#if defined(Q_OS_LINUX)
+#  include <QtCore/private/qeventdispatcher_epoll_p.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
@@ -73,6 +76,22 @@ public:
     void flush();
 };
 
+#if defined(Q_OS_LINUX)
+class QUnixEpollEventDispatcherQPA : public QEventDispatcherEpoll
+{
+    Q_OBJECT
+
+public:
+    explicit QUnixEpollEventDispatcherQPA(QObject *parent = 0);
+    ~QUnixEpollEventDispatcherQPA();
+
+    bool processEvents(QEventLoop::ProcessEventsFlags flags);
+    bool hasPendingEvents();
+
+    void flush();
+};
+#endif
+
 QT_END_NAMESPACE
 
 #endif // QUNIXEVENTDISPATCHER_QPA_H
@@ -45,6 +45,17 @@
 #include <QtCore/QList>
 #include <QtCore/QElapsedTimer>
 #include <QtCore/QFile>
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDataStream>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QSaveFile>
+#include <QtCore/QSet>
+#include <QtCore/QStandardPaths>
+#include <QtCore/QThread>
+#include <QtCore/QVector>
 
 #include <qpa/qplatformnativeinterface.h>
 #include <qpa/qplatformscreen.h>
@@ -369,7 +380,15 @@ static inline bool requiresOpenType(int writingSystem)
             || writingSystem == QFontDatabase::Khmer || writingSystem == QFontDatabase::Nko);
 }
 
-static void populateFromPattern(FcPattern *pattern)
+static inline bool equalsCaseInsensitive(const QString &a, const QString &b)
+{
+    return a.size() == b.size() && a.compare(b, Qt::CaseInsensitive) == 0;
+}
+
+// Registers the fonts described by \a pattern. When \a requestedFamily is set,
+// only the fonts of that family are registered and aliases are skipped, they
+// have been registered by populateFontDatabase() already.
+static void populateFromPattern(FcPattern *pattern, const QString &requestedFamily = QString())
 {
     QString familyName;
     QString familyNameLang;
@@ -459,9 +478,8 @@ static void populateFromPattern(FcPattern *pattern)
         writingSystems.setSupported(QFontDatabase::Other);
     }
 
-    FontFile *fontFile = new FontFile;
-    fontFile->fileName = QString::fromLocal8Bit((const char *)file_value);
-    fontFile->indexValue = indexValue;
+    const QString fileName = QString::fromLocal8Bit((const char *)file_value);
+    const bool registerAll = requestedFamily.isEmpty();
 
     QFont::Style style = (slant_value == FC_SLANT_ITALIC)
                      ? QFont::StyleItalic
@@ -479,7 +497,12 @@ static void populateFromPattern(FcPattern *pattern)
     // Note: stretch should really be an int but registerFont incorrectly uses an enum
     QFont::Stretch stretch = QFont::Stretch(stretchFromFcWidth(width_value));
     QString styleName = style_value ? QString::fromUtf8((const char *) style_value) : QString();
-    QPlatformFontDatabase::registerFont(familyName,styleName,QLatin1String((const char *)foundry_value),weight,style,stretch,antialias,scalable,pixel_size,fixedPitch,writingSystems,fontFile);
+    if (registerAll || equalsCaseInsensitive(familyName, requestedFamily)) {
+        FontFile *fontFile = new FontFile;
+        fontFile->fileName = fileName;
+        fontFile->indexValue = indexValue;
+        QPlatformFontDatabase::registerFont(familyName,styleName,QLatin1String((const char *)foundry_value),weight,style,stretch,antialias,scalable,pixel_size,fixedPitch,writingSystems,fontFile);
+    }
 //        qDebug() << familyName << (const char *)foundry_value << weight << style << &writingSystems << scalable << true << pixel_size;
 
     for (int k = 1; FcPatternGetString(pattern, FC_FAMILY, k, &value) == FcResultMatch; ++k) {
@@ -500,47 +523,251 @@ static void populateFromPattern(FcPattern *pattern)
             altFamilyNameLang = familyNameLang;
 
         if (familyNameLang == altFamilyNameLang && altStyleName != styleName) {
-            FontFile *altFontFile = new FontFile(*fontFile);
-            QPlatformFontDatabase::registerFont(altFamilyName, altStyleName, QLatin1String((const char *)foundry_value),weight,style,stretch,antialias,scalable,pixel_size,fixedPitch,writingSystems,altFontFile);
-        } else {
+            if (registerAll || equalsCaseInsensitive(altFamilyName, requestedFamily)) {
+                FontFile *altFontFile = new FontFile;
+                altFontFile->fileName = fileName;
+                altFontFile->indexValue = indexValue;
+                QPlatformFontDatabase::registerFont(altFamilyName, altStyleName, QLatin1String((const char *)foundry_value),weight,style,stretch,antialias,scalable,pixel_size,fixedPitch,writingSystems,altFontFile);
+            }
+        } else if (registerAll) {
             QPlatformFontDatabase::registerAliasToFontFamily(familyName, altFamilyName);
         }
     }
 
 }
 
-void QFontconfigDatabase::populateFontDatabase()
+static FcFontSet *listFonts(FcPattern *pattern, const char * const *properties)
 {
-    FcInit();
-    FcFontSet  *fonts;
+    FcObjectSet *os = FcObjectSetCreate();
+    for (const char * const *p = properties; *p; ++p)
+        FcObjectSetAdd(os, *p);
+    FcFontSet *fonts = FcFontList(0, pattern, os);
+    FcObjectSetDestroy(os);
+    return fonts;
+}
 
-    {
-        FcObjectSet *os = FcObjectSetCreate();
-        FcPattern *pattern = FcPatternCreate();
-        const char *properties [] = {
-            FC_FAMILY, FC_STYLE, FC_WEIGHT, FC_SLANT,
-            FC_SPACING, FC_FILE, FC_INDEX,
-            FC_LANG, FC_CHARSET, FC_FOUNDRY, FC_SCALABLE, FC_PIXEL_SIZE,
-            FC_WIDTH, FC_FAMILYLANG,
+// Everything populateFromPattern() needs
+static const char * const patternProperties[] = {
+    FC_FAMILY, FC_STYLE, FC_WEIGHT, FC_SLANT,
+    FC_SPACING, FC_FILE, FC_INDEX,
+    FC_LANG, FC_CHARSET, FC_FOUNDRY, FC_SCALABLE, FC_PIXEL_SIZE,
+    FC_WIDTH, FC_FAMILYLANG,
 #if FC_VERSION >= 20297
-            FC_CAPABILITY,
+    FC_CAPABILITY,
 #endif
-            (const char *)0
-        };
-        const char **p = properties;
-        while (*p) {
-            FcObjectSetAdd(os, *p);
-            ++p;
+    (const char *)0
+};
+
+/*
+    The names of all the families and their aliases, which is all that is
+    needed to register the families for lazy population.
+*/
+struct QFontconfigFamilyList
+{
+    QStringList families;
+    QVector<QPair<QString, QString> > aliases; // (family, alias)
+};
+
+static QFontconfigFamilyList listFamilies()
+{
+    static const char * const properties[] = { FC_FAMILY, FC_STYLE, FC_FAMILYLANG, (const char *)0 };
+
+    FcPattern *pattern = FcPatternCreate();
+    FcFontSet *fonts = listFonts(pattern, properties);
+    FcPatternDestroy(pattern);
+
+    QFontconfigFamilyList list;
+    QSet<QString> families;
+    QSet<QPair<QString, QString> > aliases;
+    for (int i = 0; fonts && i < fonts->nfont; ++i) {
+        FcPattern *font = fonts->fonts[i];
+        FcChar8 *value = 0;
+        if (FcPatternGetString(font, FC_FAMILY, 0, &value) != FcResultMatch)
+            continue;
+        const QString familyName = QString::fromUtf8((const char *)value);
+        QString familyNameLang;
+        if (FcPatternGetString(font, FC_FAMILYLANG, 0, &value) == FcResultMatch)
+            familyNameLang = QString::fromUtf8((const char *)value);
+        QString styleName;
+        if (FcPatternGetString(font, FC_STYLE, 0, &value) == FcResultMatch)
+            styleName = QString::fromUtf8((const char *)value);
+
+        families.insert(familyName);
+
+        // Same classification of the extra names as in populateFromPattern()
+        for (int k = 1; FcPatternGetString(font, FC_FAMILY, k, &value) == FcResultMatch; ++k) {
+            const QString altFamilyName = QString::fromUtf8((const char *)value);
+            QString altStyleName = styleName;
+            if (FcPatternGetString(font, FC_STYLE, k, &value) == FcResultMatch)
+                altStyleName = QString::fromUtf8((const char *)value);
+            QString altFamilyNameLang = familyNameLang;
+            if (FcPatternGetString(font, FC_FAMILYLANG, k, &value) == FcResultMatch)
+                altFamilyNameLang = QString::fromUtf8((const char *)value);
+
+            if (familyNameLang == altFamilyNameLang && altStyleName != styleName)
+                families.insert(altFamilyName);
+            else if (!altFamilyName.isEmpty())
+                aliases.insert(qMakePair(familyName, altFamilyName));
         }
-        fonts = FcFontList(0, pattern, os);
-        FcObjectSetDestroy(os);
+    }
+    if (fonts)
+        FcFontSetDestroy(fonts);
+
+    list.families = families.toList();
+    list.aliases.reserve(aliases.size());
+    for (const auto &alias : qAsConst(aliases))
+        list.aliases.append(alias);
+    return list;
+}
+
+/*
+    The family list is cached on disk. Fontconfig rescans a directory when its
+    modification time changes and reloads its configuration when one of the
+    configuration files changes, so those time stamps make up the cache key.
+*/
+static void addTimeStamps(QCryptographicHash *hash, FcStrList *list)
+{
+    if (!list)
+        return;
+    while (FcChar8 *path = FcStrListNext(list)) {
+        const QByteArray fileName(reinterpret_cast<const char *>(path));
+        hash->addData(fileName);
+        const QDateTime modified = QFileInfo(QFile::decodeName(fileName)).lastModified();
+        hash->addData(QByteArray::number(modified.isValid() ? modified.toMSecsSinceEpoch() : 0));
+    }
+    FcStrListDone(list);
+}
+
+static QByteArray familyCacheKey()
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArray::number(FcGetVersion()));
+    addTimeStamps(&hash, FcConfigGetFontDirs(0));
+    addTimeStamps(&hash, FcConfigGetConfigFiles(0));
+    return hash.result();
+}
+
+static QString familyCacheFileName()
+{
+    const QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation);
+    if (cacheDir.isEmpty())
+        return QString();
+    return cacheDir + QLatin1String("/qtfontconfig/families.cache");
+}
+
+enum { FamilyCacheVersion = 1 };
+
+static bool readFamilyCache(const QByteArray &key, QFontconfigFamilyList *list)
+{
+    QFile file(familyCacheFileName());
+    if (file.fileName().isEmpty() || !file.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_10);
+    quint32 version = 0;
+    QByteArray cachedKey;
+    stream >> version >> cachedKey;
+    if (version != FamilyCacheVersion || cachedKey != key)
+        return false;
+
+    stream >> list->families >> list->aliases;
+    return stream.status() == QDataStream::Ok;
+}
+
+static void writeFamilyCache(const QByteArray &key, const QFontconfigFamilyList &list)
+{
+    const QString fileName = familyCacheFileName();
+    if (fileName.isEmpty() || !QDir().mkpath(QFileInfo(fileName).absolutePath()))
+        return;
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly))
+        return;
+
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_10);
+    stream << quint32(FamilyCacheVersion) << key << list.families << list.aliases;
+    file.commit();
+}
+
+/*
+    Lists the complete patterns of all fonts in the background, so that the
+    families populated after the first paint do not need to wait for
+    fontconfig. Fontconfig is only thread-safe as of 2.10.91.
+*/
+class QFontconfigPrefetchThread : public QThread
+{
+public:
+    QFontconfigPrefetchThread() : m_fonts(0) { }
+    ~QFontconfigPrefetchThread()
+    {
+        wait();
+        if (m_fonts)
+            FcFontSetDestroy(m_fonts);
+    }
+
+    // Only to be called once isFinished() returns true
+    QVector<FcPattern *> patterns(const QString &familyName) const
+    {
+        return m_patterns.value(familyName.toCaseFolded());
+    }
+
+protected:
+    void run() Q_DECL_OVERRIDE
+    {
+        FcPattern *pattern = FcPatternCreate();
+        m_fonts = listFonts(pattern, patternProperties);
         FcPatternDestroy(pattern);
+
+        for (int i = 0; m_fonts && i < m_fonts->nfont; ++i) {
+            FcPattern *font = m_fonts->fonts[i];
+            FcChar8 *value = 0;
+            for (int k = 0; FcPatternGetString(font, FC_FAMILY, k, &value) == FcResultMatch; ++k)
+                m_patterns[QString::fromUtf8((const char *)value).toCaseFolded()].append(font);
+        }
     }
 
-    for (int i = 0; i < fonts->nfont; i++)
-        populateFromPattern(fonts->fonts[i]);
+private:
+    FcFontSet *m_fonts;
+    QHash<QString, QVector<FcPattern *> > m_patterns;
+};
+
+QFontconfigDatabase::QFontconfigDatabase()
+    : m_directPopulations(0)
+{
+}
+
+QFontconfigDatabase::~QFontconfigDatabase()
+{
+}
 
-    FcFontSetDestroy (fonts);
+/*
+    Only the family names are registered here, the fonts of a family are
+    registered by populateFamily() when it is first needed.
+*/
+void QFontconfigDatabase::populateFontDatabase()
+{
+    FcInit();
+
+    const QByteArray cacheKey = familyCacheKey();
+    QFontconfigFamilyList families;
+    if (!readFamilyCache(cacheKey, &families)) {
+        families = listFamilies();
+        writeFamilyCache(cacheKey, families);
+    }
+
+    for (const QString &family : qAsConst(families.families))
+        registerFontFamily(family);
+    for (const auto &alias : qAsConst(families.aliases))
+        registerAliasToFontFamily(alias.first, alias.second);
+
+#if FC_VERSION >= 21091
+    if (!m_prefetchThread) {
+        m_prefetchThread.reset(new QFontconfigPrefetchThread);
+        m_prefetchThread->start(QThread::LowPriority);
+    }
+#endif
 
     struct FcDefaultFont {
         const char *qtname;
@@ -575,8 +802,42 @@ void QFontconfigDatabase::populateFontDatabase()
 //    QApplication::setFont(font);
 }
 
+void QFontconfigDatabase::populateFamily(const QString &familyName)
+{
+    // Listing a single family is almost as expensive as listing all fonts, so
+    // only the few families needed before the prefetching has finished are
+    // listed directly. When everything is needed at once, e.g. to list the
+    // families supporting a writing system, wait for the prefetched patterns.
+    enum { MaxDirectPopulations = 16 };
+    if (m_prefetchThread && !m_prefetchThread->isFinished() && ++m_directPopulations > MaxDirectPopulations)
+        m_prefetchThread->wait();
+
+    if (m_prefetchThread && m_prefetchThread->isFinished()) {
+        const QVector<FcPattern *> patterns = m_prefetchThread->patterns(familyName);
+        for (FcPattern *pattern : patterns)
+            populateFromPattern(pattern, familyName);
+        return;
+    }
+
+    FcPattern *pattern = FcPatternCreate();
+    const QByteArray family = familyName.toUtf8();
+    FcPatternAddString(pattern, FC_FAMILY, (const FcChar8 *)family.constData());
+    FcFontSet *fonts = listFonts(pattern, patternProperties);
+    FcPatternDestroy(pattern);
+    if (!fonts)
+        return;
+
+    for (int i = 0; i < fonts->nfont; i++)
+        populateFromPattern(fonts->fonts[i], familyName);
+
+    FcFontSetDestroy(fonts);
+}
+
 void QFontconfigDatabase::invalidate()
 {
+    // The prefetched patterns may include application fonts.
+    m_prefetchThread.reset();
+
     // Clear app fonts.
     FcConfigAppFontClear(0);
 }
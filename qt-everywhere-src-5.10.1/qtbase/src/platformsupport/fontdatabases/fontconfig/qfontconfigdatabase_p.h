@@ -51,17 +51,23 @@
 // We mean it.
 //
 
+#include <QtCore/QScopedPointer>
 #include <qpa/qplatformfontdatabase.h>
 #include <QtFontDatabaseSupport/private/qfreetypefontdatabase_p.h>
 
 QT_BEGIN_NAMESPACE
 
 class QFontEngineFT;
+class QFontconfigPrefetchThread;
 
 class QFontconfigDatabase : public QFreeTypeFontDatabase
 {
 public:
+    QFontconfigDatabase();
+    ~QFontconfigDatabase();
+
     void populateFontDatabase() Q_DECL_OVERRIDE;
+    void populateFamily(const QString &familyName) Q_DECL_OVERRIDE;
     void invalidate() Q_DECL_OVERRIDE;
     QFontEngineMulti *fontEngineMulti(QFontEngine *fontEngine, QChar::Script script) Q_DECL_OVERRIDE;
     QFontEngine *fontEngine(const QFontDef &fontDef, void *handle) Q_DECL_OVERRIDE;
@@ -73,6 +79,9 @@ public:
 
 private:
     void setupFontEngine(QFontEngineFT *engine, const QFontDef &fontDef) const;
+
+    QScopedPointer<QFontconfigPrefetchThread> m_prefetchThread;
+    int m_directPopulations;
 };
 
 QT_END_NAMESPACE
@@ -55,6 +55,9 @@
 #include "qfileinfo.h"
 #include <qscopedvaluerollback.h>
 #include "qthreadstorage.h"
+#include <qrunnable.h>
+#include <qsemaphore.h>
+#include <qthreadpool.h>
 #include <qmath.h>
 #include <qendian.h>
 
@@ -1042,6 +1045,16 @@ QFontEngineFT::Glyph *QFontEngineFT::loadGlyph(QGlyphSet *set, uint glyph,
 {
 //     Q_ASSERT(freetype->lock == 1);
 
+    return loadGlyph(freetype->face, freetype->matrix, set, glyph, subPixelPosition, format,
+                     fetchMetricsOnly, disableOutlineDrawing);
+}
+
+QFontEngineFT::Glyph *QFontEngineFT::loadGlyph(FT_Face face, FT_Matrix matrix, QGlyphSet *set, uint glyph,
+                                               QFixed subPixelPosition,
+                                               GlyphFormat format,
+                                               bool fetchMetricsOnly,
+                                               bool disableOutlineDrawing) const
+{
     if (format == Format_None)
         format = defaultFormat != Format_None ? defaultFormat : Format_Mono;
     Q_ASSERT(format != Format_None);
@@ -1053,11 +1066,6 @@ QFontEngineFT::Glyph *QFontEngineFT::loadGlyph(QGlyphSet *set, uint glyph,
     if (!g && set && set->isGlyphMissing(glyph))
         return &emptyGlyph;
 
-
-    FT_Face face = freetype->face;
-
-    FT_Matrix matrix = freetype->matrix;
-
     FT_Vector v;
     v.x = format == Format_Mono ? 0 : FT_Pos(subPixelPosition.value());
     v.y = 0;
@@ -2075,6 +2083,123 @@ QFontEngineFT::Glyph *QFontEngineFT::loadGlyphFor(glyph_t g,
     return glyph;
 }
 
+// renders glyphs with the calling thread's own FreeType face, without
+// touching the glyph cache
+void QFontEngineFT::renderGlyphs(const glyph_t *glyphs, int numGlyphs, GlyphFormat format,
+                                 Glyph **results) const
+{
+    QFreetypeFace *face = QFreetypeFace::getFace(face_id, freetype->fontData);
+    if (!face)
+        return;
+
+    face->lock();
+    if (face->xsize != xsize || face->ysize != ysize) {
+        FT_Set_Char_Size(face->face, xsize, ysize, 0, 0);
+        face->xsize = xsize;
+        face->ysize = ysize;
+    }
+    face->matrix = matrix;
+    for (int i = 0; i < numGlyphs; ++i)
+        results[i] = loadGlyph(face->face, matrix, 0, glyphs[i], 0, format, false, true);
+    face->unlock();
+    face->release(face_id);
+}
+
+#ifndef QT_NO_THREAD
+namespace {
+class QFontEngineFTRenderTask : public QRunnable
+{
+public:
+    QFontEngineFTRenderTask()
+        : engine(0), glyphs(0), numGlyphs(0), format(QFontEngine::Format_None), results(0), done(0)
+    {
+        setAutoDelete(false);
+    }
+
+    void run() Q_DECL_OVERRIDE
+    {
+        engine->renderGlyphs(glyphs, numGlyphs, format, results);
+        done->release();
+    }
+
+    const QFontEngineFT *engine;
+    const glyph_t *glyphs;
+    int numGlyphs;
+    QFontEngine::GlyphFormat format;
+    QFontEngineFT::Glyph **results;
+    QSemaphore *done;
+};
+} // namespace
+#endif
+
+void QFontEngineFT::prefetchGlyphs(const glyph_t *glyphs, int numGlyphs, GlyphFormat format)
+{
+    if (!cacheEnabled || defaultGlyphSet.outline_drawing || isBitmapFont() || numGlyphs <= 0)
+        return;
+
+    // the same formats alphaMapForGlyph() and lockedAlphaMapForGlyph() ask for
+    if (format == Format_None)
+        format = defaultFormat != Format_None ? defaultFormat : Format_A8;
+    if (format == Format_A8 && !antialias)
+        format = Format_Mono;
+
+    QVector<glyph_t> missing;
+    missing.reserve(numGlyphs);
+    QSet<glyph_t> seen;
+    for (int i = 0; i < numGlyphs; ++i) {
+        const glyph_t glyph = glyphs[i];
+        if (defaultGlyphSet.getGlyph(glyph) || defaultGlyphSet.isGlyphMissing(glyph) || seen.contains(glyph))
+            continue;
+        seen.insert(glyph);
+        missing.append(glyph);
+    }
+    if (missing.isEmpty())
+        return;
+
+    // every thread renders into its own part of the results, which are then
+    // entered into the cache here without any locking
+    QVector<Glyph *> results(missing.size(), 0);
+    const int count = missing.size();
+#ifndef QT_NO_THREAD
+    enum { MinimumGlyphsPerTask = 16, MaximumTasks = 64 };
+    QThreadPool *pool = QThreadPool::globalInstance();
+    const int tasks = qMin(count / MinimumGlyphsPerTask, qMin(pool->maxThreadCount() + 1, int(MaximumTasks)));
+    if (tasks > 1) {
+        QSemaphore done;
+        QFontEngineFTRenderTask runnables[MaximumTasks - 1];
+        for (int i = 0; i < tasks - 1; ++i) {
+            const int begin = count * i / tasks;
+            QFontEngineFTRenderTask &task = runnables[i];
+            task.engine = this;
+            task.glyphs = missing.constData() + begin;
+            task.numGlyphs = count * (i + 1) / tasks - begin;
+            task.format = format;
+            task.results = results.data() + begin;
+            task.done = &done;
+            pool->start(&task);
+        }
+        const int begin = count * (tasks - 1) / tasks;
+        renderGlyphs(missing.constData() + begin, count - begin, format, results.data() + begin);
+        for (int i = tasks - 2; i >= 0; --i) {
+            if (pool->tryTake(&runnables[i]))
+                runnables[i].run();
+        }
+        done.acquire(tasks - 1);
+    } else
+#endif
+    {
+        renderGlyphs(missing.constData(), count, format, results.data());
+    }
+
+    for (int i = 0; i < count; ++i) {
+        Glyph *glyph = results.at(i);
+        if (glyph == &emptyGlyph)
+            defaultGlyphSet.setGlyphMissing(missing.at(i));
+        else if (glyph)
+            defaultGlyphSet.setGlyph(missing.at(i), 0, glyph);
+    }
+}
+
 QImage QFontEngineFT::alphaMapForGlyph(glyph_t g, QFixed subPixelPosition)
 {
     return alphaMapForGlyph(g, subPixelPosition, QTransform());
@@ -245,6 +245,7 @@ private:
                                    GlyphFormat neededFormat, const QTransform &t,
                                    QPoint *offset) Q_DECL_OVERRIDE;
     bool hasInternalCaching() const Q_DECL_OVERRIDE { return cacheEnabled; }
+    void prefetchGlyphs(const glyph_t *glyphs, int numGlyphs, GlyphFormat format) Q_DECL_OVERRIDE;
     void unlockAlphaMapForGlyph() Q_DECL_OVERRIDE;
     bool expectsGammaCorrectedBlending() const Q_DECL_OVERRIDE;
 
@@ -270,6 +271,8 @@ private:
     inline Glyph *loadGlyph(uint glyph, QFixed subPixelPosition, GlyphFormat format = Format_None, bool fetchMetricsOnly = false, bool disableOutlineDrawing = false) const
     { return loadGlyph(cacheEnabled ? &defaultGlyphSet : 0, glyph, subPixelPosition, format, fetchMetricsOnly, disableOutlineDrawing); }
     Glyph *loadGlyph(QGlyphSet *set, uint glyph, QFixed subPixelPosition, GlyphFormat = Format_None, bool fetchMetricsOnly = false, bool disableOutlineDrawing = false) const;
+    Glyph *loadGlyph(FT_Face face, FT_Matrix matrix, QGlyphSet *set, uint glyph, QFixed subPixelPosition, GlyphFormat format, bool fetchMetricsOnly, bool disableOutlineDrawing) const;
+    void renderGlyphs(const glyph_t *glyphs, int numGlyphs, GlyphFormat format, Glyph **results) const;
     Glyph *loadGlyphFor(glyph_t g, QFixed subPixelPosition, GlyphFormat format, const QTransform &t, bool fetchBoundingBox = false, bool disableOutlineDrawing = false);
 
     QGlyphSet *loadGlyphSet(const QTransform &matrix);
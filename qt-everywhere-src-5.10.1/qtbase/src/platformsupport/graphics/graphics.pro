@@ -6,7 +6,12 @@ CONFIG += static internal_module
 
 DEFINES += QT_NO_CAST_FROM_ASCII
 
-HEADERS += $$PWD/qrasterbackingstore_p.h
-SOURCES += $$PWD/qrasterbackingstore.cpp
+HEADERS += \
+    $$PWD/qrasterbackingstore_p.h \
+    $$PWD/qsharedmemorygraphicscache_p.h
+
+SOURCES += \
+    $$PWD/qrasterbackingstore.cpp \
+    $$PWD/qsharedmemorygraphicscache.cpp
 
 load(qt_module)
@@ -0,0 +1,516 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsharedmemorygraphicscache_p.h"
+
+#include <QtCore/qdebug.h>
+#ifndef QT_NO_OPENGL
+#include <QtGui/qopenglcontext.h>
+#include <QtGui/qopenglfunctions.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+/*
+    All processes using a cache with the same key and cache id attach to the
+    same shared memory segment, which holds an Alpha8 atlas together with a
+    hash table of the items in it. The segment is only accessed while holding
+    its lock. Items never move; when the atlas or the table is full, the cache
+    is reset and its epoch incremented, which makes every process invalidate
+    the items it has reported. Each process uploads the atlas into its own
+    texture whenever the generation of the pixel data has changed.
+*/
+
+namespace {
+
+enum {
+    CacheMagic = 0x51534743, // "QSGC"
+    AtlasWidth = 2048,
+    AtlasHeight = 2048,
+    TableSize = 8192, // a power of two
+    MaximumItems = TableSize / 2, // keeps the probe sequences short
+    ItemPadding = 1
+};
+
+struct SharedItem
+{
+    quint32 used;
+    quint32 id;
+    quint16 x;
+    quint16 y;
+    quint16 width;
+    quint16 height;
+};
+
+struct SharedHeader
+{
+    quint32 magic;
+    quint32 epoch; // incremented when the cache is reset
+    quint32 generation; // incremented when the pixel data changes
+    quint32 itemCount;
+    quint32 shelfX;
+    quint32 shelfY;
+    quint32 shelfHeight;
+    quint32 usedHeight;
+    SharedItem items[TableSize];
+};
+
+const int PixelOffset = (sizeof(SharedHeader) + 15) & ~15;
+const int SegmentSize = PixelOffset + AtlasWidth * AtlasHeight;
+
+inline SharedHeader *header(void *data)
+{
+    return static_cast<SharedHeader *>(data);
+}
+
+inline uchar *pixels(void *data)
+{
+    return static_cast<uchar *>(data) + PixelOffset;
+}
+
+inline uint slotForId(quint32 id)
+{
+    return (id * 2654435761u) & (TableSize - 1);
+}
+
+SharedItem *findItem(SharedHeader *h, quint32 id)
+{
+    for (uint slot = slotForId(id); h->items[slot].used; slot = (slot + 1) & (TableSize - 1)) {
+        if (h->items[slot].id == id)
+            return &h->items[slot];
+    }
+    return nullptr;
+}
+
+void resetCache(SharedHeader *h)
+{
+    const quint32 epoch = h->magic == CacheMagic ? h->epoch + 1 : 0;
+    const quint32 generation = h->magic == CacheMagic ? h->generation + 1 : 0;
+    memset(h, 0, sizeof(SharedHeader));
+    h->magic = CacheMagic;
+    h->epoch = epoch;
+    h->generation = generation;
+}
+
+// places an item on the current shelf, or on a new one below it
+bool allocateItem(SharedHeader *h, int width, int height, QPoint *position)
+{
+    const int w = width + ItemPadding;
+    const int h2 = height + ItemPadding;
+    if (w > AtlasWidth || h2 > AtlasHeight || h->itemCount >= uint(MaximumItems))
+        return false;
+    if (int(h->shelfX) + w > AtlasWidth) {
+        h->shelfY += h->shelfHeight;
+        h->shelfX = 0;
+        h->shelfHeight = 0;
+    }
+    if (int(h->shelfY) + h2 > AtlasHeight)
+        return false;
+    *position = QPoint(h->shelfX, h->shelfY);
+    h->shelfX += w;
+    h->shelfHeight = qMax<quint32>(h->shelfHeight, h2);
+    h->usedHeight = qMax<quint32>(h->usedHeight, h->shelfY + h2);
+    return true;
+}
+
+} // namespace
+
+struct QSharedMemoryGraphicsCacheLocker
+{
+    explicit QSharedMemoryGraphicsCacheLocker(QSharedMemoryGraphicsCache::Cache *cache)
+        : m_cache(cache)
+    {
+#ifndef QT_NO_SHAREDMEMORY
+        m_locked = m_cache->segment.isAttached() && m_cache->segment.lock();
+#endif
+    }
+    ~QSharedMemoryGraphicsCacheLocker()
+    {
+#ifndef QT_NO_SHAREDMEMORY
+        if (m_locked)
+            m_cache->segment.unlock();
+#endif
+    }
+
+    QSharedMemoryGraphicsCache::Cache *m_cache;
+    bool m_locked = false;
+};
+
+QSharedMemoryGraphicsCache::QSharedMemoryGraphicsCache(const QByteArray &key, QObject *parent)
+    : QPlatformSharedGraphicsCache(parent)
+    , m_key(key)
+    , m_batchStarted(false)
+{
+}
+
+QSharedMemoryGraphicsCache::~QSharedMemoryGraphicsCache()
+{
+#ifndef QT_NO_OPENGL
+    QOpenGLContext *context = QOpenGLContext::currentContext();
+    for (Cache *cache : qAsConst(m_caches)) {
+        if (cache->textureId && context && cache->textureContext == context)
+            context->functions()->glDeleteTextures(1, &cache->textureId);
+    }
+#endif
+    qDeleteAll(m_caches);
+}
+
+/*
+    Returns \c true if the platform integrations should offer the cache.
+
+    Sharing glyphs between processes is opt-in through the
+    QT_SHARED_GRAPHICS_CACHE environment variable.
+*/
+bool QSharedMemoryGraphicsCache::isEnabled()
+{
+#ifndef QT_NO_OPENGL
+    return qEnvironmentVariableIntValue("QT_SHARED_GRAPHICS_CACHE") > 0;
+#else
+    return false;
+#endif
+}
+
+void *QSharedMemoryGraphicsCache::Cache::data()
+{
+#ifndef QT_NO_SHAREDMEMORY
+    if (segment.isAttached())
+        return segment.data();
+#endif
+    return localData.data();
+}
+
+QSharedMemoryGraphicsCache::Cache *QSharedMemoryGraphicsCache::cache(const QByteArray &cacheId) const
+{
+    Cache *cache = m_caches.value(cacheId);
+    if (Q_UNLIKELY(!cache))
+        qWarning("QSharedMemoryGraphicsCache: Cache %s has not been initialized", cacheId.constData());
+    return cache;
+}
+
+void QSharedMemoryGraphicsCache::ensureCacheInitialized(const QByteArray &cacheId, BufferType bufferType,
+                                                        PixelFormat pixelFormat)
+{
+    // there is only one buffer type and pixel format
+    Q_UNUSED(bufferType);
+    Q_UNUSED(pixelFormat);
+
+    if (m_caches.contains(cacheId))
+        return;
+
+    Cache *cache = new Cache;
+    cache->cacheId = cacheId;
+#ifndef QT_NO_SHAREDMEMORY
+    cache->segment.setKey(QLatin1String("qt_shared_graphics_cache:") + QString::fromUtf8(m_key)
+                          + QLatin1Char(':') + QString::fromUtf8(cacheId));
+    if (!cache->segment.create(SegmentSize)
+            && (cache->segment.error() != QSharedMemory::AlreadyExists || !cache->segment.attach())) {
+        qWarning("QSharedMemoryGraphicsCache: Cannot share cache %s: %s", cacheId.constData(),
+                 qPrintable(cache->segment.errorString()));
+    } else if (cache->segment.size() < SegmentSize) {
+        qWarning("QSharedMemoryGraphicsCache: Cannot share cache %s: Segment too small", cacheId.constData());
+        cache->segment.detach();
+    }
+#endif
+    // not sharing keeps the cache working for this process
+    if (!cache->data()) {
+        cache->localData.resize(SegmentSize);
+        cache->localData.fill(0);
+    }
+
+    {
+        QSharedMemoryGraphicsCacheLocker locker(cache);
+        // whoever gets the lock first after creation initializes the segment
+        SharedHeader *h = header(cache->data());
+        if (h->magic != CacheMagic)
+            resetCache(h);
+        cache->epoch = h->epoch;
+    }
+    m_caches.insert(cacheId, cache);
+}
+
+void QSharedMemoryGraphicsCache::checkEpoch(Cache *cache)
+{
+    quint32 epoch;
+    {
+        QSharedMemoryGraphicsCacheLocker locker(cache);
+        epoch = header(cache->data())->epoch;
+    }
+    if (epoch == cache->epoch)
+        return;
+
+    // another process has reset the cache, the items need to be inserted again
+    cache->epoch = epoch;
+    const QVector<quint32> invalidated = cache->reportedItems.toList().toVector();
+    cache->reportedItems.clear();
+    if (!invalidated.isEmpty())
+        emit itemsInvalidated(cache->cacheId, invalidated);
+}
+
+void QSharedMemoryGraphicsCache::beginRequestBatch()
+{
+    m_batchStarted = true;
+}
+
+void QSharedMemoryGraphicsCache::endRequestBatch()
+{
+    if (!m_batchStarted)
+        return;
+    m_batchStarted = false;
+    for (Cache *cache : qAsConst(m_caches)) {
+        if (!cache->batchedRequests.isEmpty()) {
+            QVector<quint32> itemIds;
+            qSwap(itemIds, cache->batchedRequests);
+            processRequests(cache, itemIds);
+        }
+    }
+}
+
+bool QSharedMemoryGraphicsCache::requestBatchStarted() const
+{
+    return m_batchStarted;
+}
+
+void QSharedMemoryGraphicsCache::requestItems(const QByteArray &cacheId, const QVector<quint32> &itemIds)
+{
+    Cache *cache = this->cache(cacheId);
+    if (!cache)
+        return;
+    if (m_batchStarted)
+        cache->batchedRequests += itemIds;
+    else
+        processRequests(cache, itemIds);
+}
+
+void QSharedMemoryGraphicsCache::processRequests(Cache *cache, const QVector<quint32> &itemIds)
+{
+    checkEpoch(cache);
+
+    QVector<quint32> available;
+    QVector<QPoint> positions;
+    QVector<quint32> missing;
+    {
+        QSharedMemoryGraphicsCacheLocker locker(cache);
+        SharedHeader *h = header(cache->data());
+        for (quint32 id : itemIds) {
+            if (const SharedItem *item = findItem(h, id)) {
+                available.append(id);
+                positions.append(QPoint(item->x, item->y));
+            } else if (!missing.contains(id)) {
+                missing.append(id);
+            }
+        }
+    }
+
+    for (quint32 id : qAsConst(available)) {
+        cache->pendingItems.remove(id);
+        cache->reportedItems.insert(id);
+    }
+    for (quint32 id : qAsConst(missing))
+        cache->pendingItems.insert(id);
+
+    if (!available.isEmpty())
+        emit itemsAvailable(cache->cacheId, cache, available, positions);
+    if (!missing.isEmpty())
+        emit itemsMissing(cache->cacheId, missing);
+}
+
+void QSharedMemoryGraphicsCache::insertItems(const QByteArray &cacheId,
+                                             const QVector<quint32> &itemIds,
+                                             const QVector<QImage> &items)
+{
+    Cache *cache = this->cache(cacheId);
+    if (!cache)
+        return;
+    Q_ASSERT(itemIds.size() == items.size());
+
+    checkEpoch(cache);
+
+    QVector<quint32> available;
+    QVector<QPoint> positions;
+    QVector<quint32> invalidated;
+    {
+        QSharedMemoryGraphicsCacheLocker locker(cache);
+        SharedHeader *h = header(cache->data());
+        bool wasReset = false;
+        for (int i = 0; i < itemIds.size(); ++i) {
+            const quint32 id = itemIds.at(i);
+            if (const SharedItem *item = findItem(h, id)) {
+                // inserted by another process in the meantime
+                available.append(id);
+                positions.append(QPoint(item->x, item->y));
+                continue;
+            }
+
+            QImage image = items.at(i);
+            if (image.depth() != 8)
+                image = image.convertToFormat(QImage::Format_Alpha8);
+            QPoint position;
+            if (!allocateItem(h, image.width(), image.height(), &position)) {
+                if (wasReset) {
+                    qWarning("QSharedMemoryGraphicsCache: Item %u does not fit into cache %s",
+                             id, cacheId.constData());
+                    continue;
+                }
+                // start over with an empty cache, the items placed so far by
+                // this call are gone as well
+                resetCache(h);
+                wasReset = true;
+                cache->epoch = h->epoch;
+                invalidated = cache->reportedItems.toList().toVector();
+                cache->reportedItems.clear();
+                available.clear();
+                positions.clear();
+                i = -1;
+                continue;
+            }
+
+            uchar *dst = pixels(h) + position.y() * AtlasWidth + position.x();
+            for (int y = 0; y < image.height(); ++y)
+                memcpy(dst + y * AtlasWidth, image.constScanLine(y), image.width());
+
+            uint slot = slotForId(id);
+            while (h->items[slot].used)
+                slot = (slot + 1) & (TableSize - 1);
+            SharedItem &item = h->items[slot];
+            item.used = 1;
+            item.id = id;
+            item.x = position.x();
+            item.y = position.y();
+            item.width = image.width();
+            item.height = image.height();
+            ++h->itemCount;
+
+            available.append(id);
+            positions.append(position);
+        }
+        ++h->generation;
+    }
+
+    if (!invalidated.isEmpty())
+        emit itemsInvalidated(cacheId, invalidated);
+    for (quint32 id : qAsConst(available)) {
+        cache->pendingItems.remove(id);
+        cache->reportedItems.insert(id);
+    }
+    if (!available.isEmpty())
+        emit itemsAvailable(cacheId, cache, available, positions);
+}
+
+void QSharedMemoryGraphicsCache::releaseItems(const QByteArray &cacheId, const QVector<quint32> &itemIds)
+{
+    // the items stay in the atlas for the other processes
+    Cache *cache = this->cache(cacheId);
+    if (!cache)
+        return;
+    for (quint32 id : itemIds) {
+        cache->pendingItems.remove(id);
+        cache->reportedItems.remove(id);
+    }
+}
+
+uint QSharedMemoryGraphicsCache::textureIdForBuffer(void *bufferId)
+{
+#ifndef QT_NO_OPENGL
+    Cache *cache = static_cast<Cache *>(bufferId);
+    QOpenGLContext *context = QOpenGLContext::currentContext();
+    if (!cache || !context)
+        return 0;
+
+    QOpenGLFunctions *functions = context->functions();
+    if (!cache->textureId || cache->textureContext != context) {
+        functions->glGenTextures(1, &cache->textureId);
+        functions->glBindTexture(GL_TEXTURE_2D, cache->textureId);
+        functions->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        functions->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        functions->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        functions->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        functions->glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, AtlasWidth, AtlasHeight, 0,
+                                GL_ALPHA, GL_UNSIGNED_BYTE, nullptr);
+        cache->textureContext = context;
+        cache->textureGeneration = quint32(-1);
+    }
+
+    QSharedMemoryGraphicsCacheLocker locker(cache);
+    const SharedHeader *h = header(cache->data());
+    // after a reset by another process, keep showing the old items until
+    // they have been invalidated
+    if (h->epoch == cache->epoch && h->generation != cache->textureGeneration) {
+        functions->glBindTexture(GL_TEXTURE_2D, cache->textureId);
+        functions->glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        if (h->usedHeight > 0) {
+            functions->glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, AtlasWidth, h->usedHeight,
+                                       GL_ALPHA, GL_UNSIGNED_BYTE, pixels(cache->data()));
+        }
+        functions->glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        cache->textureGeneration = h->generation;
+    }
+    return cache->textureId;
+#else
+    Q_UNUSED(bufferId);
+    return 0;
+#endif
+}
+
+void QSharedMemoryGraphicsCache::referenceBuffer(void *bufferId)
+{
+    Cache *cache = static_cast<Cache *>(bufferId);
+    ++cache->refCount;
+}
+
+bool QSharedMemoryGraphicsCache::dereferenceBuffer(void *bufferId)
+{
+    Cache *cache = static_cast<Cache *>(bufferId);
+    Q_ASSERT(cache->refCount > 0);
+    return --cache->refCount > 0;
+}
+
+QSize QSharedMemoryGraphicsCache::sizeOfBuffer(void *bufferId)
+{
+    Q_UNUSED(bufferId);
+    return QSize(AtlasWidth, AtlasHeight);
+}
+
+void *QSharedMemoryGraphicsCache::eglImageForBuffer(void *bufferId)
+{
+    // the atlas lives in shared memory, not in an EGLImage
+    Q_UNUSED(bufferId);
+    return nullptr;
+}
+
+QT_END_NAMESPACE
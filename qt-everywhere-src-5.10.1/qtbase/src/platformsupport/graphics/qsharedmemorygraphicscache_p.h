@@ -0,0 +1,126 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtGui module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QSHAREDMEMORYGRAPHICSCACHE_P_H
+#define QSHAREDMEMORYGRAPHICSCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <qpa/qplatformsharedgraphicscache.h>
+
+#include <QtCore/qhash.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qset.h>
+#include <QtCore/qsharedmemory.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpenGLContext;
+
+class QSharedMemoryGraphicsCache : public QPlatformSharedGraphicsCache
+{
+public:
+    explicit QSharedMemoryGraphicsCache(const QByteArray &key, QObject *parent = nullptr);
+    ~QSharedMemoryGraphicsCache();
+
+    static bool isEnabled();
+
+    void beginRequestBatch() Q_DECL_OVERRIDE;
+    void ensureCacheInitialized(const QByteArray &cacheId, BufferType bufferType,
+                                PixelFormat pixelFormat) Q_DECL_OVERRIDE;
+    void requestItems(const QByteArray &cacheId, const QVector<quint32> &itemIds) Q_DECL_OVERRIDE;
+    void insertItems(const QByteArray &cacheId,
+                     const QVector<quint32> &itemIds,
+                     const QVector<QImage> &items) Q_DECL_OVERRIDE;
+    void releaseItems(const QByteArray &cacheId, const QVector<quint32> &itemIds) Q_DECL_OVERRIDE;
+    void endRequestBatch() Q_DECL_OVERRIDE;
+
+    bool requestBatchStarted() const Q_DECL_OVERRIDE;
+
+    uint textureIdForBuffer(void *bufferId) Q_DECL_OVERRIDE;
+    void referenceBuffer(void *bufferId) Q_DECL_OVERRIDE;
+    bool dereferenceBuffer(void *bufferId) Q_DECL_OVERRIDE;
+    QSize sizeOfBuffer(void *bufferId) Q_DECL_OVERRIDE;
+    void *eglImageForBuffer(void *bufferId) Q_DECL_OVERRIDE;
+
+private:
+    friend struct QSharedMemoryGraphicsCacheLocker;
+
+    struct Cache {
+        Cache() : refCount(0), epoch(0), textureId(0), textureGeneration(0) { }
+
+        void *data();
+
+        QByteArray cacheId;
+#ifndef QT_NO_SHAREDMEMORY
+        QSharedMemory segment;
+#endif
+        QByteArray localData; // used when the segment cannot be shared
+        int refCount;
+        quint32 epoch;
+        QSet<quint32> pendingItems; // requested, reported missing
+        QSet<quint32> reportedItems; // reported available
+        QVector<quint32> batchedRequests;
+
+        uint textureId;
+        quint32 textureGeneration;
+        QPointer<QOpenGLContext> textureContext;
+    };
+
+    Cache *cache(const QByteArray &cacheId) const;
+    void checkEpoch(Cache *cache);
+    void processRequests(Cache *cache, const QVector<quint32> &itemIds);
+
+    QByteArray m_key;
+    QHash<QByteArray, Cache *> m_caches;
+    bool m_batchStarted;
+};
+
+QT_END_NAMESPACE
+
+#endif // QSHAREDMEMORYGRAPHICSCACHE_P_H
@@ -49,6 +49,7 @@
 #include <QtCore/private/qcore_unix_p.h>
 #include <private/qguiapplication_p.h>
 #include <private/qinputdevicemanager_p_p.h>
+#include <qpa/qwindowsysteminterface_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -85,8 +86,32 @@ static void liLogHandler(libinput *libinput, libinput_log_priority priority, con
     }
 }
 
+static bool useReaderThread(const QString &spec)
+{
+    if (qEnvironmentVariableIsSet("QT_QPA_LIBINPUT_THREADED"))
+        return qEnvironmentVariableIntValue("QT_QPA_LIBINPUT_THREADED");
+    return spec.split(QLatin1Char(':')).contains(QLatin1String("threaded"));
+}
+
 QLibInputHandler::QLibInputHandler(const QString &key, const QString &spec)
+    : QLibInputHandler(key, spec, useReaderThread(spec))
+{
+}
+
+QLibInputHandler::QLibInputHandler(const QString &key, const QString &spec, bool threaded)
+    : m_udev(Q_NULLPTR),
+      m_li(Q_NULLPTR),
+      m_liFd(-1)
 {
+    if (threaded) {
+        // Read and translate the events on a dedicated thread so that input is
+        // timestamped and queued as it arrives, even while the GUI thread is busy.
+        qCDebug(qLcLibInput, "libinput: reading events on a dedicated thread");
+        m_thread.reset(new QLibInputHandlerThread(key, spec));
+        m_thread->start();
+        return;
+    }
+
     Q_UNUSED(key);
     Q_UNUSED(spec);
 
@@ -115,7 +140,7 @@ QLibInputHandler::QLibInputHandler(const QString &key, const QString &spec)
     m_touch.reset(new QLibInputTouch);
 
     QInputDeviceManager *manager = QGuiApplicationPrivate::inputDeviceManager();
-    connect(manager, &QInputDeviceManager::cursorPositionChangeRequested, [=](const QPoint &pos) {
+    connect(manager, &QInputDeviceManager::cursorPositionChangeRequested, this, [this](const QPoint &pos) {
         m_pointer->setPos(pos);
     });
 
@@ -125,6 +150,8 @@ QLibInputHandler::QLibInputHandler(const QString &key, const QString &spec)
 
 QLibInputHandler::~QLibInputHandler()
 {
+    m_thread.reset();
+
     if (m_li)
         libinput_unref(m_li);
 
@@ -146,6 +173,26 @@ void QLibInputHandler::onReadyRead()
     }
 }
 
+// Maps the CLOCK_MONOTONIC based libinput event time to the clock used by
+// QWindowSystemInterface, so that events keep the time they were generated at
+// no matter how long they spent in the queues.
+ulong QLibInputHandler::eventTimestamp(quint32 msec)
+{
+    const QElapsedTimer &eventTime(QWindowSystemInterfacePrivate::eventTime);
+    const qint64 elapsed = eventTime.elapsed();
+    const quint32 age = quint32(eventTime.msecsSinceReference() + elapsed) - msec;
+    return age <= elapsed ? ulong(elapsed - age) : ulong(elapsed);
+}
+
+void QLibInputHandler::setDeviceCount(QInputDeviceManager::DeviceType type, int count)
+{
+    QInputDeviceManager *manager = QGuiApplicationPrivate::inputDeviceManager();
+    // queued when running on the reader thread
+    QMetaObject::invokeMethod(manager, [manager, type, count]() {
+        QInputDeviceManagerPrivate::get(manager)->setDeviceCount(type, count);
+    });
+}
+
 void QLibInputHandler::processEvent(libinput_event *ev)
 {
     libinput_event_type type = libinput_event_get_type(ev);
@@ -157,45 +204,41 @@ void QLibInputHandler::processEvent(libinput_event *ev)
         // This is not just for hotplugging, it is also called for each input
         // device libinput reads from on startup. Hence it is suitable for doing
         // touch device registration.
-        QInputDeviceManagerPrivate *inputManagerPriv = QInputDeviceManagerPrivate::get(
-            QGuiApplicationPrivate::inputDeviceManager());
         if (libinput_device_has_capability(dev, LIBINPUT_DEVICE_CAP_TOUCH)) {
             m_touch->registerDevice(dev);
             int &count(m_devCount[QInputDeviceManager::DeviceTypeTouch]);
             ++count;
-            inputManagerPriv->setDeviceCount(QInputDeviceManager::DeviceTypeTouch, count);
+            setDeviceCount(QInputDeviceManager::DeviceTypeTouch, count);
         }
         if (libinput_device_has_capability(dev, LIBINPUT_DEVICE_CAP_POINTER)) {
             int &count(m_devCount[QInputDeviceManager::DeviceTypePointer]);
             ++count;
-            inputManagerPriv->setDeviceCount(QInputDeviceManager::DeviceTypePointer, count);
+            setDeviceCount(QInputDeviceManager::DeviceTypePointer, count);
         }
         if (libinput_device_has_capability(dev, LIBINPUT_DEVICE_CAP_KEYBOARD)) {
             int &count(m_devCount[QInputDeviceManager::DeviceTypeKeyboard]);
             ++count;
-            inputManagerPriv->setDeviceCount(QInputDeviceManager::DeviceTypeKeyboard, count);
+            setDeviceCount(QInputDeviceManager::DeviceTypeKeyboard, count);
         }
         break;
     }
     case LIBINPUT_EVENT_DEVICE_REMOVED:
     {
-        QInputDeviceManagerPrivate *inputManagerPriv = QInputDeviceManagerPrivate::get(
-            QGuiApplicationPrivate::inputDeviceManager());
         if (libinput_device_has_capability(dev, LIBINPUT_DEVICE_CAP_TOUCH)) {
             m_touch->unregisterDevice(dev);
             int &count(m_devCount[QInputDeviceManager::DeviceTypeTouch]);
             --count;
-            inputManagerPriv->setDeviceCount(QInputDeviceManager::DeviceTypeTouch, count);
+            setDeviceCount(QInputDeviceManager::DeviceTypeTouch, count);
         }
         if (libinput_device_has_capability(dev, LIBINPUT_DEVICE_CAP_POINTER)) {
             int &count(m_devCount[QInputDeviceManager::DeviceTypePointer]);
             --count;
-            inputManagerPriv->setDeviceCount(QInputDeviceManager::DeviceTypePointer, count);
+            setDeviceCount(QInputDeviceManager::DeviceTypePointer, count);
         }
         if (libinput_device_has_capability(dev, LIBINPUT_DEVICE_CAP_KEYBOARD)) {
             int &count(m_devCount[QInputDeviceManager::DeviceTypeKeyboard]);
             --count;
-            inputManagerPriv->setDeviceCount(QInputDeviceManager::DeviceTypeKeyboard, count);
+            setDeviceCount(QInputDeviceManager::DeviceTypeKeyboard, count);
         }
         break;
     }
@@ -231,4 +274,25 @@ void QLibInputHandler::processEvent(libinput_event *ev)
     }
 }
 
+QLibInputHandlerThread::QLibInputHandlerThread(const QString &key, const QString &spec)
+    : m_key(key), m_spec(spec), m_handler(Q_NULLPTR)
+{
+}
+
+QLibInputHandlerThread::~QLibInputHandlerThread()
+{
+    quit();
+    wait();
+}
+
+void QLibInputHandlerThread::run()
+{
+    m_handler = new QLibInputHandler(m_key, m_spec, false);
+
+    exec();
+
+    delete m_handler;
+    m_handler = Q_NULLPTR;
+}
+
 QT_END_NAMESPACE
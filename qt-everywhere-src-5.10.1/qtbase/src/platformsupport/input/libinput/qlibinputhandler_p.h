@@ -43,6 +43,8 @@
 #include <QtCore/QObject>
 #include <QtCore/QScopedPointer>
 #include <QtCore/QMap>
+#include <QtCore/private/qthread_p.h>
+#include <QtGui/private/qinputdevicemanager_p.h>
 
 //
 //  W A R N I N G
@@ -65,6 +67,7 @@ class QSocketNotifier;
 class QLibInputPointer;
 class QLibInputKeyboard;
 class QLibInputTouch;
+class QLibInputHandlerThread;
 
 class QLibInputHandler : public QObject
 {
@@ -74,9 +77,16 @@ public:
 
     void onReadyRead();
 
+    static ulong eventTimestamp(quint32 msec);
+
 private:
+    friend class QLibInputHandlerThread;
+    QLibInputHandler(const QString &key, const QString &spec, bool threaded);
+
     void processEvent(libinput_event *ev);
+    void setDeviceCount(QInputDeviceManager::DeviceType type, int count);
 
+    QScopedPointer<QLibInputHandlerThread> m_thread;
     udev *m_udev;
     libinput *m_li;
     int m_liFd;
@@ -87,6 +97,20 @@ private:
     QMap<int, int> m_devCount;
 };
 
+class QLibInputHandlerThread : public QDaemonThread
+{
+public:
+    QLibInputHandlerThread(const QString &key, const QString &spec);
+    ~QLibInputHandlerThread();
+
+    void run() Q_DECL_OVERRIDE;
+
+private:
+    QString m_key;
+    QString m_spec;
+    QLibInputHandler *m_handler;
+};
+
 QT_END_NAMESPACE
 
 #endif
@@ -38,6 +38,7 @@
 ****************************************************************************/
 
 #include "qlibinputkeyboard_p.h"
+#include "qlibinputhandler_p.h"
 #include <QtCore/QTextCodec>
 #include <QtCore/QLoggingCategory>
 #include <QtGui/private/qguiapplication_p.h>
@@ -217,7 +218,8 @@ void QLibInputKeyboard::processKey(libinput_event_keyboard *e)
 
     QGuiApplicationPrivate::inputDeviceManager()->setKeyboardModifiers(mods, qtkey);
 
-    QWindowSystemInterface::handleExtendedKeyEvent(Q_NULLPTR,
+    const ulong timestamp = QLibInputHandler::eventTimestamp(libinput_event_keyboard_get_time(e));
+    QWindowSystemInterface::handleExtendedKeyEvent(Q_NULLPTR, timestamp,
                                                    pressed ? QEvent::KeyPress : QEvent::KeyRelease,
                                                    qtkey, mods, k, sym, mods, text);
 
@@ -38,6 +38,7 @@
 ****************************************************************************/
 
 #include "qlibinputpointer_p.h"
+#include "qlibinputhandler_p.h"
 #include <libinput.h>
 #include <QtGui/QGuiApplication>
 #include <QtGui/QScreen>
@@ -80,7 +81,8 @@ void QLibInputPointer::processButton(libinput_event_pointer *e)
 
     m_buttons.setFlag(button, pressed);
 
-    QWindowSystemInterface::handleMouseEvent(Q_NULLPTR, m_pos, m_pos, m_buttons,
+    const ulong timestamp = QLibInputHandler::eventTimestamp(libinput_event_pointer_get_time(e));
+    QWindowSystemInterface::handleMouseEvent(Q_NULLPTR, timestamp, m_pos, m_pos, m_buttons,
                                              QGuiApplicationPrivate::inputDeviceManager()->keyboardModifiers());
 }
 
@@ -94,7 +96,8 @@ void QLibInputPointer::processMotion(libinput_event_pointer *e)
     m_pos.setX(qBound(g.left(), qRound(m_pos.x() + dx), g.right()));
     m_pos.setY(qBound(g.top(), qRound(m_pos.y() + dy), g.bottom()));
 
-    QWindowSystemInterface::handleMouseEvent(Q_NULLPTR, m_pos, m_pos, m_buttons,
+    const ulong timestamp = QLibInputHandler::eventTimestamp(libinput_event_pointer_get_time(e));
+    QWindowSystemInterface::handleMouseEvent(Q_NULLPTR, timestamp, m_pos, m_pos, m_buttons,
                                              QGuiApplicationPrivate::inputDeviceManager()->keyboardModifiers());
 }
 
@@ -121,7 +124,8 @@ void QLibInputPointer::processAxis(libinput_event_pointer *e)
     const int factor = 8;
     angleDelta *= -factor;
     Qt::KeyboardModifiers mods = QGuiApplication::keyboardModifiers();
-    QWindowSystemInterface::handleWheelEvent(nullptr, m_pos, m_pos, QPoint(), angleDelta, mods);
+    const ulong timestamp = QLibInputHandler::eventTimestamp(libinput_event_pointer_get_time(e));
+    QWindowSystemInterface::handleWheelEvent(nullptr, timestamp, m_pos, m_pos, QPoint(), angleDelta, mods);
 }
 
 void QLibInputPointer::setPos(const QPoint &pos)
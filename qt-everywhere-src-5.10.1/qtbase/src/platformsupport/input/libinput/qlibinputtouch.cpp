@@ -38,6 +38,7 @@
 ****************************************************************************/
 
 #include "qlibinputtouch_p.h"
+#include "qlibinputhandler_p.h"
 #include <libinput.h>
 #include <QtGui/QGuiApplication>
 #include <QtGui/QScreen>
@@ -150,7 +151,8 @@ void QLibInputTouch::processTouchCancel(libinput_event_touch *e)
 {
     DeviceState *state = deviceState(e);
     if (state->m_touchDevice)
-        QWindowSystemInterface::handleTouchCancelEvent(Q_NULLPTR, state->m_touchDevice, QGuiApplication::keyboardModifiers());
+        QWindowSystemInterface::handleTouchCancelEvent(Q_NULLPTR, QLibInputHandler::eventTimestamp(libinput_event_touch_get_time(e)),
+                                                       state->m_touchDevice, QGuiApplication::keyboardModifiers());
     else
         qWarning("TouchCancel without registered device");
 }
@@ -165,7 +167,8 @@ void QLibInputTouch::processTouchFrame(libinput_event_touch *e)
     if (state->m_points.isEmpty())
         return;
 
-    QWindowSystemInterface::handleTouchEvent(Q_NULLPTR, state->m_touchDevice, state->m_points,
+    const ulong timestamp = QLibInputHandler::eventTimestamp(libinput_event_touch_get_time(e));
+    QWindowSystemInterface::handleTouchEvent(Q_NULLPTR, timestamp, state->m_touchDevice, state->m_points,
                                              QGuiApplication::keyboardModifiers());
 
     for (int i = 0; i < state->m_points.count(); ++i) {
@@ -40,6 +40,7 @@
 #include <QtGui/QOpenGLContext>
 #include <QtGui/QOpenGLFramebufferObject>
 #include <QtGui/QWindow>
+#include <QtGui/private/qopenglcontext_p.h>
 #include <qpa/qplatformbackingstore.h>
 
 #include "qopenglcompositor_p.h"
@@ -67,6 +68,11 @@ QT_BEGIN_NAMESPACE
     raised and lowered (addWindow(), moveToTop(), etc.), and to
     schedule repaints (update()).
 
+    When the target surface reports its buffer age, for example through
+    EGL_EXT_buffer_age, repaints scheduled with a damage region only
+    recompose the parts of the back buffer that are out of date and
+    present the damage with swap_buffers_with_damage where available.
+
     \note To get support for QWidget-based windows, just use
     QOpenGLCompositorBackingStore. It will automatically create
     textures from the raster-rendered content and trigger the
@@ -78,7 +84,8 @@ static QOpenGLCompositor *compositor = 0;
 QOpenGLCompositor::QOpenGLCompositor()
     : m_context(0),
       m_targetWindow(0),
-      m_rotation(0)
+      m_rotation(0),
+      m_fullDamage(true)
 {
     Q_ASSERT(!compositor);
     m_updateTimer.setSingleShot(true);
@@ -110,6 +117,15 @@ void QOpenGLCompositor::setRotation(int degrees)
 
 void QOpenGLCompositor::update()
 {
+    m_fullDamage = true;
+    if (!m_updateTimer.isActive())
+        m_updateTimer.start();
+}
+
+// damage is in target window coordinates
+void QOpenGLCompositor::update(const QRegion &damage)
+{
+    m_damage |= damage;
     if (!m_updateTimer.isActive())
         m_updateTimer.start();
 }
@@ -135,6 +151,38 @@ void QOpenGLCompositor::renderAll(QOpenGLFramebufferObject *fbo)
     if (fbo)
         fbo->bind();
 
+    QRegion damage;
+    bool partialUpdate = false;
+    if (!fbo) {
+        // Windows that moved damage both their old and new position
+        const QRect surfaceRect(QPoint(), m_nativeTargetGeometry.size());
+        damage = m_damage;
+        for (QOpenGLCompositorWindow *window : qAsConst(m_windows)) {
+            const QRect geometry = window->sourceWindow()->geometry();
+            QRect &renderedGeometry = m_renderedGeometry[window];
+            if (renderedGeometry != geometry) {
+                damage |= renderedGeometry;
+                damage |= geometry;
+                renderedGeometry = geometry;
+            }
+        }
+        // Partial updates need the window coordinates to be device pixels
+        if (m_fullDamage || m_rotation || m_targetWindow->geometry().size() != surfaceRect.size())
+            damage = surfaceRect;
+        m_damage = QRegion();
+        m_fullDamage = false;
+
+        const int bufferAge = QOpenGLContextPrivate::get(m_context)->bufferAge(m_targetWindow);
+        const QRegion repaintRegion = m_damageHistory.repaintRegion(damage, bufferAge, surfaceRect);
+        m_damageHistory.addFrame(damage, surfaceRect);
+        partialUpdate = repaintRegion != QRegion(surfaceRect);
+        if (partialUpdate) {
+            const QRect scissor = QOpenGLDamageHistory::scissorRect(repaintRegion, surfaceRect.height());
+            glScissor(scissor.x(), scissor.y(), scissor.width(), scissor.height());
+            glEnable(GL_SCISSOR_TEST);
+        }
+    }
+
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);
     glViewport(0, 0, m_nativeTargetGeometry.width(), m_nativeTargetGeometry.height());
 
@@ -150,10 +198,14 @@ void QOpenGLCompositor::renderAll(QOpenGLFramebufferObject *fbo)
         render(m_windows.at(i));
 
     m_blitter.release();
-    if (!fbo)
+    if (partialUpdate) {
+        glDisable(GL_SCISSOR_TEST);
+        QOpenGLContextPrivate::get(m_context)->swapBuffers(m_targetWindow, damage);
+    } else if (!fbo) {
         m_context->swapBuffers(m_targetWindow);
-    else
+    } else {
         fbo->release();
+    }
 
     for (int i = 0; i < m_windows.size(); ++i)
         m_windows.at(i)->endCompositing();
@@ -276,6 +328,7 @@ void QOpenGLCompositor::addWindow(QOpenGLCompositorWindow *window)
 {
     if (!m_windows.contains(window)) {
         m_windows.append(window);
+        m_fullDamage = true;
         emit topWindowChanged(window);
     }
 }
@@ -283,6 +336,8 @@ void QOpenGLCompositor::addWindow(QOpenGLCompositorWindow *window)
 void QOpenGLCompositor::removeWindow(QOpenGLCompositorWindow *window)
 {
     m_windows.removeOne(window);
+    m_renderedGeometry.remove(window);
+    m_fullDamage = true;
     if (!m_windows.isEmpty())
         emit topWindowChanged(m_windows.last());
 }
@@ -291,6 +346,7 @@ void QOpenGLCompositor::moveToTop(QOpenGLCompositorWindow *window)
 {
     m_windows.removeOne(window);
     m_windows.append(window);
+    m_fullDamage = true;
     emit topWindowChanged(window);
 }
 
@@ -299,6 +355,7 @@ void QOpenGLCompositor::changeWindowIndex(QOpenGLCompositorWindow *window, int n
     int idx = m_windows.indexOf(window);
     if (idx != -1 && idx != newIdx) {
         m_windows.move(idx, newIdx);
+        m_fullDamage = true;
         if (newIdx == m_windows.size() - 1)
             emit topWindowChanged(m_windows.last());
     }
@@ -54,6 +54,7 @@
 #include <QtCore/QTimer>
 #include <QtGui/QOpenGLTextureBlitter>
 #include <QtGui/QMatrix4x4>
+#include <QtGui/private/qopengldamagehistory_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -86,6 +87,7 @@ public:
     QWindow *targetWindow() const { return m_targetWindow; }
 
     void update();
+    void update(const QRegion &damage);
     QImage grab();
 
     QList<QOpenGLCompositorWindow *> windows() const { return m_windows; }
@@ -115,6 +117,10 @@ private:
     QTimer m_updateTimer;
     QOpenGLTextureBlitter m_blitter;
     QList<QOpenGLCompositorWindow *> m_windows;
+    QHash<QOpenGLCompositorWindow *, QRect> m_renderedGeometry;
+    QRegion m_damage;
+    bool m_fullDamage;
+    QOpenGLDamageHistory m_damageHistory;
 };
 
 QT_END_NAMESPACE
@@ -182,7 +182,6 @@ void QOpenGLCompositorBackingStore::flush(QWindow *window, const QRegion &region
 {
     // Called for ordinary raster windows.
 
-    Q_UNUSED(region);
     Q_UNUSED(offset);
 
     QOpenGLCompositor *compositor = QOpenGLCompositor::instance();
@@ -198,7 +197,7 @@ void QOpenGLCompositorBackingStore::flush(QWindow *window, const QRegion &region
     m_textures->clear();
     m_textures->appendTexture(Q_NULLPTR, m_bsTexture, window->geometry());
 
-    compositor->update();
+    compositor->update(region.translated(window->geometry().topLeft()));
 }
 
 void QOpenGLCompositorBackingStore::composeAndFlush(QWindow *window, const QRegion &region, const QPoint &offset,
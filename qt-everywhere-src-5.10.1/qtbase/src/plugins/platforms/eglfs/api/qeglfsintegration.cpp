@@ -72,6 +72,7 @@
 #include <QtThemeSupport/private/qgenericunixthemes_p.h>
 #include <QtEventDispatcherSupport/private/qgenericunixeventdispatcher_p.h>
 #include <QtFbSupport/private/qfbvthandler_p.h>
+#include <QtGraphicsSupport/private/qsharedmemorygraphicscache_p.h>
 #ifndef QT_NO_OPENGL
 # include <QtPlatformCompositorSupport/private/qopenglcompositorbackingstore_p.h>
 #endif
@@ -270,10 +271,18 @@ bool QEglFSIntegration::hasCapability(QPlatformIntegration::Capability cap) cons
     case RasterGLSurface: return false;
 #endif
     case WindowManagement: return false;
+    case SharedGraphicsCache: return QSharedMemoryGraphicsCache::isEnabled();
     default: return QPlatformIntegration::hasCapability(cap);
     }
 }
 
+QPlatformSharedGraphicsCache *QEglFSIntegration::createPlatformSharedGraphicsCache(const char *cacheId) const
+{
+    if (!hasCapability(SharedGraphicsCache))
+        return QPlatformIntegration::createPlatformSharedGraphicsCache(cacheId);
+    return new QSharedMemoryGraphicsCache(cacheId);
+}
+
 QPlatformNativeInterface *QEglFSIntegration::nativeInterface() const
 {
     return const_cast<QEglFSIntegration *>(this);
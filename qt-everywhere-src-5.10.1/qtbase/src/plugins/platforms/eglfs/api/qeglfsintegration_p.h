@@ -87,6 +87,7 @@ public:
     QPlatformOffscreenSurface *createPlatformOffscreenSurface(QOffscreenSurface *surface) const override;
 #endif
     bool hasCapability(QPlatformIntegration::Capability cap) const override;
+    QPlatformSharedGraphicsCache *createPlatformSharedGraphicsCache(const char *cacheId) const override;
 
     QPlatformNativeInterface *nativeInterface() const override;
 
@@ -12,7 +12,7 @@ QT += \
     core-private gui-private \
     devicediscovery_support-private eventdispatcher_support-private \
     service_support-private theme_support-private fontdatabase_support-private \
-    fb_support-private egl_support-private
+    fb_support-private egl_support-private graphics_support-private
 
 qtHaveModule(input_support-private): \
     QT += input_support-private
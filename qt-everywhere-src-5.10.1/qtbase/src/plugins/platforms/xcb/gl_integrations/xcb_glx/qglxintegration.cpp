@@ -78,6 +78,10 @@ typedef GLXContext (*glXCreateContextAttribsARBProc)(Display*, GLXFBConfig, GLXC
 #define GLX_CONTEXT_ES2_PROFILE_BIT_EXT 0x00000004
 #endif
 
+#ifndef GLX_BACK_BUFFER_AGE_EXT
+#define GLX_BACK_BUFFER_AGE_EXT 0x20F4
+#endif
+
 #ifndef GLX_CONTEXT_PROFILE_MASK_ARB
 #define GLX_CONTEXT_PROFILE_MASK_ARB 0x9126
 #endif
@@ -558,6 +562,31 @@ void QGLXContext::swapBuffers(QPlatformSurface *surface)
     }
 }
 
+int QGLXContext::bufferAge(QPlatformSurface *surface) const
+{
+    if (surface->surface()->surfaceClass() != QSurface::Window)
+        return 0;
+
+    QXcbScreen *screen = screenForPlatformSurface(surface);
+    if (!screen)
+        return 0;
+
+    static bool resolved = false;
+    static bool supportsBufferAge = false;
+    if (!resolved) {
+        resolved = true;
+        const QByteArrayList glxExt = QByteArray(glXQueryExtensionsString(m_display,
+                                                                          screen->screenNumber())).split(' ');
+        supportsBufferAge = glxExt.contains("GLX_EXT_buffer_age");
+    }
+    if (!supportsBufferAge)
+        return 0;
+
+    unsigned int age = 0;
+    glXQueryDrawable(m_display, static_cast<QXcbWindow *>(surface)->xcb_window(), GLX_BACK_BUFFER_AGE_EXT, &age);
+    return int(age);
+}
+
 QFunctionPointer QGLXContext::getProcAddress(const char *procName)
 {
 #ifdef QT_STATIC
@@ -63,6 +63,7 @@ public:
     bool makeCurrent(QPlatformSurface *surface) override;
     void doneCurrent() override;
     void swapBuffers(QPlatformSurface *surface) override;
+    int bufferAge(QPlatformSurface *surface) const override;
     QFunctionPointer getProcAddress(const char *procName) override;
 
     QSurfaceFormat format() const override;
@@ -433,13 +433,23 @@ void QXcbConnection::initializeScreens()
                 }
 
                 if (outputCount) {
-                    auto primary = Q_XCB_REPLY(xcb_randr_get_output_primary, xcb_connection(), xcbScreen->root);
+                    // Send all the requests before waiting for the first reply
+                    const xcb_randr_get_output_primary_cookie_t primaryCookie =
+                        xcb_randr_get_output_primary(xcb_connection(), xcbScreen->root);
+                    QVarLengthArray<xcb_randr_get_output_info_cookie_t, 8> outputCookies(outputCount);
+                    for (int i = 0; i < outputCount; i++)
+                        outputCookies[i] = xcb_randr_get_output_info_unchecked(xcb_connection(), outputs[i], timestamp);
+
+                    std::unique_ptr<xcb_randr_get_output_primary_reply_t, decltype(std::free) *> primary(
+                        xcb_randr_get_output_primary_reply(xcb_connection(), primaryCookie, nullptr), std::free);
                     if (!primary) {
                         qWarning("failed to get the primary output of the screen");
+                        for (int i = 0; i < outputCount; i++)
+                            xcb_discard_reply(xcb_connection(), outputCookies[i].sequence);
                     } else {
                         for (int i = 0; i < outputCount; i++) {
-                            auto output = Q_XCB_REPLY_UNCHECKED(xcb_randr_get_output_info,
-                                                                xcb_connection(), outputs[i], timestamp);
+                            std::unique_ptr<xcb_randr_get_output_info_reply_t, decltype(std::free) *> output(
+                                xcb_randr_get_output_info_reply(xcb_connection(), outputCookies[i], nullptr), std::free);
                             // Invalid, disconnected or disabled output
                             if (!output)
                                 continue;
@@ -565,7 +575,7 @@ QXcbConnection::QXcbConnection(QXcbNativeInterface *nativeInterface, bool canGra
     m_reader->start();
 
     xcb_extension_t *extensions[] = {
-        &xcb_shm_id, &xcb_xfixes_id, &xcb_randr_id, &xcb_shape_id, &xcb_sync_id,
+        &xcb_shm_id, &xcb_xfixes_id, &xcb_randr_id, &xcb_shape_id, &xcb_sync_id, &xcb_xinerama_id,
 #if QT_CONFIG(xkb)
         &xcb_xkb_id,
 #endif
@@ -580,22 +590,27 @@ QXcbConnection::QXcbConnection(QXcbNativeInterface *nativeInterface, bool canGra
 
     m_setup = xcb_get_setup(xcb_connection());
 
+    // The version queries are answered while the atoms are being interned,
+    // so the whole initialization only waits for a couple of round-trips.
+    ExtensionQueries queries;
+    queryExtensions(&queries);
+
     initializeAllAtoms();
 
     if (!qEnvironmentVariableIsSet("QT_XCB_NO_XRANDR"))
-        initializeXRandr();
+        initializeXRandr(queries);
     if (!has_randr_extension)
-        initializeXinerama();
-    initializeXFixes();
+        initializeXinerama(queries);
+    initializeXFixes(queries);
     initializeScreens();
 
-    initializeXRender();
+    initializeXRender(queries);
 #if QT_CONFIG(xinput2)
     if (!qEnvironmentVariableIsSet("QT_XCB_NO_XI2"))
         initializeXInput2();
 #endif
-    initializeXShape();
-    initializeXKB();
+    initializeXShape(queries);
+    initializeXKB(queries);
 
     m_wmSupport.reset(new QXcbWMSupport(this));
     m_keyboard = new QXcbKeyboard(this);
@@ -1373,7 +1388,10 @@ void QXcbEventReader::run()
         while (m_connection && (event = local_xcb_poll_for_queued_event(m_connection->xcb_connection())))
             addEvent(event);
         m_mutex.unlock();
-        emit eventPending();
+        // Until the GUI thread gets around to it, further events are picked up
+        // by the same processXcbEvents() call
+        if (m_eventPendingEmitted.testAndSetOrdered(0, 1))
+            emit eventPending();
     }
 
     m_mutex.lock();
@@ -1729,6 +1747,7 @@ void QXcbConnection::processXcbEvents()
         exit(1);
     }
 
+    m_reader->aboutToProcessEvents();
     QXcbEventArray *eventqueue = m_reader->lock();
 
     for (int i = 0; i < eventqueue->size(); ++i) {
@@ -2041,7 +2060,14 @@ xcb_atom_t QXcbConnection::internAtom(const char *name)
     if (!name || *name == 0)
         return XCB_NONE;
 
-    return Q_XCB_REPLY(xcb_intern_atom, xcb_connection(), false, strlen(name), name)->atom;
+    const QByteArray key = QByteArray::fromRawData(name, int(strlen(name)));
+    const auto it = m_internedAtoms.constFind(key);
+    if (it != m_internedAtoms.constEnd())
+        return it.value();
+
+    const xcb_atom_t atom = Q_XCB_REPLY(xcb_intern_atom, xcb_connection(), false, strlen(name), name)->atom;
+    m_internedAtoms.insert(QByteArray(name), atom);
+    return atom;
 }
 
 QByteArray QXcbConnection::atomName(xcb_atom_t atom)
@@ -2049,13 +2075,19 @@ QByteArray QXcbConnection::atomName(xcb_atom_t atom)
     if (!atom)
         return QByteArray();
 
+    const auto it = m_atomNames.constFind(atom);
+    if (it != m_atomNames.constEnd())
+        return it.value();
+
     auto reply = Q_XCB_REPLY(xcb_get_atom_name, xcb_connection(), atom);
-    if (!reply)
+    if (!reply) {
         qWarning() << "QXcbConnection::atomName: bad Atom" << atom;
-    else
-        return QByteArray(xcb_get_atom_name_name(reply.get()), xcb_get_atom_name_name_length(reply.get()));
+        return QByteArray();
+    }
 
-    return QByteArray();
+    const QByteArray name(xcb_get_atom_name_name(reply.get()), xcb_get_atom_name_name_length(reply.get()));
+    m_atomNames.insert(atom, name);
+    return name;
 }
 
 const xcb_format_t *QXcbConnection::formatForDepth(uint8_t depth) const
@@ -2080,15 +2112,62 @@ void QXcbConnection::sync()
     free(xcb_get_input_focus_reply(xcb_connection(), cookie, 0));
 }
 
-void QXcbConnection::initializeXFixes()
+struct QXcbConnection::ExtensionQueries
+{
+    // a zero sequence number means that the request was not sent
+    xcb_xfixes_query_version_cookie_t xfixes = {};
+#if QT_CONFIG(xcb_render)
+    xcb_render_query_version_cookie_t render = {};
+#endif
+    xcb_randr_query_version_cookie_t randr = {};
+    xcb_xinerama_is_active_cookie_t xinerama = {};
+    xcb_shape_query_version_cookie_t shape = {};
+#if QT_CONFIG(xkb)
+    xcb_xkb_use_extension_cookie_t xkb = {};
+#endif
+};
+
+static inline bool extensionPresent(xcb_connection_t *connection, xcb_extension_t *extension)
+{
+    const xcb_query_extension_reply_t *reply = xcb_get_extension_data(connection, extension);
+    return reply && reply->present;
+}
+
+/*
+    Sends the version queries of all the extensions that are present without
+    waiting for any of the replies. The extension data has been prefetched, so
+    this costs a single round-trip for all of them.
+*/
+void QXcbConnection::queryExtensions(ExtensionQueries *queries)
+{
+    if (extensionPresent(m_connection, &xcb_xfixes_id))
+        queries->xfixes = xcb_xfixes_query_version(m_connection, XCB_XFIXES_MAJOR_VERSION, XCB_XFIXES_MINOR_VERSION);
+#if QT_CONFIG(xcb_render)
+    if (extensionPresent(m_connection, &xcb_render_id))
+        queries->render = xcb_render_query_version(m_connection, XCB_RENDER_MAJOR_VERSION, XCB_RENDER_MINOR_VERSION);
+#endif
+    const bool randr = !qEnvironmentVariableIsSet("QT_XCB_NO_XRANDR")
+            && extensionPresent(m_connection, &xcb_randr_id);
+    if (randr)
+        queries->randr = xcb_randr_query_version(m_connection, XCB_RANDR_MAJOR_VERSION, XCB_RANDR_MINOR_VERSION);
+    else if (extensionPresent(m_connection, &xcb_xinerama_id))
+        queries->xinerama = xcb_xinerama_is_active(m_connection);
+    if (extensionPresent(m_connection, &xcb_shape_id))
+        queries->shape = xcb_shape_query_version(m_connection);
+#if QT_CONFIG(xkb)
+    if (extensionPresent(m_connection, &xcb_xkb_id))
+        queries->xkb = xcb_xkb_use_extension(m_connection, XKB_X11_MIN_MAJOR_XKB_VERSION, XKB_X11_MIN_MINOR_XKB_VERSION);
+#endif
+}
+
+void QXcbConnection::initializeXFixes(const ExtensionQueries &queries)
 {
     const xcb_query_extension_reply_t *reply = xcb_get_extension_data(m_connection, &xcb_xfixes_id);
     if (!reply || !reply->present)
         return;
 
-    auto xfixes_query = Q_XCB_REPLY(xcb_xfixes_query_version, m_connection,
-                                    XCB_XFIXES_MAJOR_VERSION,
-                                    XCB_XFIXES_MINOR_VERSION);
+    std::unique_ptr<xcb_xfixes_query_version_reply_t, decltype(std::free) *> xfixes_query(
+        xcb_xfixes_query_version_reply(m_connection, queries.xfixes, nullptr), std::free);
     if (!xfixes_query || xfixes_query->major_version < 2) {
         qWarning("QXcbConnection: Failed to initialize XFixes");
         return;
@@ -2097,25 +2176,26 @@ void QXcbConnection::initializeXFixes()
     has_xfixes = true;
 }
 
-void QXcbConnection::initializeXRender()
+void QXcbConnection::initializeXRender(const ExtensionQueries &queries)
 {
 #if QT_CONFIG(xcb_render)
     const xcb_query_extension_reply_t *reply = xcb_get_extension_data(m_connection, &xcb_render_id);
     if (!reply || !reply->present)
         return;
 
-    auto xrender_query = Q_XCB_REPLY(xcb_render_query_version, m_connection,
-                                     XCB_RENDER_MAJOR_VERSION,
-                                     XCB_RENDER_MINOR_VERSION);
+    std::unique_ptr<xcb_render_query_version_reply_t, decltype(std::free) *> xrender_query(
+        xcb_render_query_version_reply(m_connection, queries.render, nullptr), std::free);
     if (!xrender_query || (xrender_query->major_version == 0 && xrender_query->minor_version < 5)) {
         qWarning("QXcbConnection: Failed to initialize XRender");
         return;
     }
     has_render_extension = true;
+#else
+    Q_UNUSED(queries);
 #endif
 }
 
-void QXcbConnection::initializeXRandr()
+void QXcbConnection::initializeXRandr(const ExtensionQueries &queries)
 {
     const xcb_query_extension_reply_t *reply = xcb_get_extension_data(m_connection, &xcb_randr_id);
     if (!reply || !reply->present)
@@ -2123,9 +2203,8 @@ void QXcbConnection::initializeXRandr()
 
     xrandr_first_event = reply->first_event;
 
-    auto xrandr_query = Q_XCB_REPLY(xcb_randr_query_version, m_connection,
-                                    XCB_RANDR_MAJOR_VERSION,
-                                    XCB_RANDR_MINOR_VERSION);
+    std::unique_ptr<xcb_randr_query_version_reply_t, decltype(std::free) *> xrandr_query(
+        xcb_randr_query_version_reply(m_connection, queries.randr, nullptr), std::free);
 
     has_randr_extension = true;
 
@@ -2146,24 +2225,29 @@ void QXcbConnection::initializeXRandr()
     }
 }
 
-void QXcbConnection::initializeXinerama()
+void QXcbConnection::initializeXinerama(const ExtensionQueries &queries)
 {
     const xcb_query_extension_reply_t *reply = xcb_get_extension_data(m_connection, &xcb_xinerama_id);
     if (!reply || !reply->present)
         return;
 
-    auto xinerama_is_active = Q_XCB_REPLY(xcb_xinerama_is_active, m_connection);
+    // Not queried up front if RandR is present but too old
+    const xcb_xinerama_is_active_cookie_t cookie = queries.xinerama.sequence
+            ? queries.xinerama : xcb_xinerama_is_active(m_connection);
+    std::unique_ptr<xcb_xinerama_is_active_reply_t, decltype(std::free) *> xinerama_is_active(
+        xcb_xinerama_is_active_reply(m_connection, cookie, nullptr), std::free);
     has_xinerama_extension = xinerama_is_active && xinerama_is_active->state;
 }
 
-void QXcbConnection::initializeXShape()
+void QXcbConnection::initializeXShape(const ExtensionQueries &queries)
 {
     const xcb_query_extension_reply_t *xshape_reply = xcb_get_extension_data(m_connection, &xcb_shape_id);
     if (!xshape_reply || !xshape_reply->present)
         return;
 
     has_shape_extension = true;
-    auto shape_query = Q_XCB_REPLY(xcb_shape_query_version, m_connection);
+    std::unique_ptr<xcb_shape_query_version_reply_t, decltype(std::free) *> shape_query(
+        xcb_shape_query_version_reply(m_connection, queries.shape, nullptr), std::free);
     if (!shape_query) {
         qWarning("QXcbConnection: Failed to initialize SHAPE extension");
     } else if (shape_query->major_version > 1 || (shape_query->major_version == 1 && shape_query->minor_version >= 1)) {
@@ -2172,7 +2256,7 @@ void QXcbConnection::initializeXShape()
     }
 }
 
-void QXcbConnection::initializeXKB()
+void QXcbConnection::initializeXKB(const ExtensionQueries &queries)
 {
 #if QT_CONFIG(xkb)
     const xcb_query_extension_reply_t *reply = xcb_get_extension_data(m_connection, &xcb_xkb_id);
@@ -2185,9 +2269,8 @@ void QXcbConnection::initializeXKB()
 
     xcb_connection_t *c = connection()->xcb_connection();
 
-    auto xkb_query = Q_XCB_REPLY(xcb_xkb_use_extension, c,
-                                 XKB_X11_MIN_MAJOR_XKB_VERSION,
-                                 XKB_X11_MIN_MINOR_XKB_VERSION);
+    std::unique_ptr<xcb_xkb_use_extension_reply_t, decltype(std::free) *> xkb_query(
+        xcb_xkb_use_extension_reply(c, queries.xkb, nullptr), std::free);
 
     if (!xkb_query) {
         qWarning("Qt: Failed to initialize XKB extension");
@@ -2231,6 +2314,8 @@ void QXcbConnection::initializeXKB()
         qWarning("Qt: failed to select notify events from xcb-xkb");
         return;
     }
+#else
+    Q_UNUSED(queries);
 #endif
 }
 
@@ -327,6 +327,8 @@ public:
 
     void registerEventDispatcher(QAbstractEventDispatcher *dispatcher);
 
+    void aboutToProcessEvents() { m_eventPendingEmitted.store(0); }
+
 signals:
     void eventPending();
 
@@ -338,6 +340,7 @@ private:
 
     QMutex m_mutex;
     QXcbEventArray m_events;
+    QAtomicInt m_eventPendingEmitted;
     QXcbConnection *m_connection;
 };
 
@@ -535,12 +538,14 @@ private slots:
 private:
     void initializeAllAtoms();
     void sendConnectionEvent(QXcbAtom::Atom atom, uint id = 0);
-    void initializeXFixes();
-    void initializeXRender();
-    void initializeXRandr();
-    void initializeXinerama();
-    void initializeXShape();
-    void initializeXKB();
+    struct ExtensionQueries;
+    void queryExtensions(ExtensionQueries *queries);
+    void initializeXFixes(const ExtensionQueries &queries);
+    void initializeXRender(const ExtensionQueries &queries);
+    void initializeXRandr(const ExtensionQueries &queries);
+    void initializeXinerama(const ExtensionQueries &queries);
+    void initializeXShape(const ExtensionQueries &queries);
+    void initializeXKB(const ExtensionQueries &queries);
     void handleClientMessageEvent(const xcb_client_message_event_t *event);
     QXcbScreen* findScreenForCrtc(xcb_window_t rootWindow, xcb_randr_crtc_t crtc) const;
     QXcbScreen* findScreenForOutput(xcb_window_t rootWindow, xcb_randr_output_t output) const;
@@ -642,6 +647,9 @@ private:
     int m_primaryScreenNumber = 0;
 
     xcb_atom_t m_allAtoms[QXcbAtom::NAtoms];
+    // atoms stay valid for the lifetime of the connection
+    QHash<QByteArray, xcb_atom_t> m_internedAtoms;
+    QHash<xcb_atom_t, QByteArray> m_atomNames;
 
     xcb_timestamp_t m_time = XCB_CURRENT_TIME;
     xcb_timestamp_t m_netWmUserTime = XCB_CURRENT_TIME;
@@ -58,6 +58,7 @@
 #include <QtEventDispatcherSupport/private/qgenericunixeventdispatcher_p.h>
 #include <QtFontDatabaseSupport/private/qgenericunixfontdatabase_p.h>
 #include <QtServiceSupport/private/qgenericunixservices_p.h>
+#include <QtGraphicsSupport/private/qsharedmemorygraphicscache_p.h>
 
 #include <stdio.h>
 
@@ -328,10 +329,20 @@ bool QXcbIntegration::hasCapability(QPlatformIntegration::Capability cap) const
             && m_connections.at(0)->glIntegration()->supportsSwitchableWidgetComposition();
     }
 
+    case SharedGraphicsCache:
+        return QSharedMemoryGraphicsCache::isEnabled() && hasCapability(OpenGL);
+
     default: return QPlatformIntegration::hasCapability(cap);
     }
 }
 
+QPlatformSharedGraphicsCache *QXcbIntegration::createPlatformSharedGraphicsCache(const char *cacheId) const
+{
+    if (!hasCapability(SharedGraphicsCache))
+        return QPlatformIntegration::createPlatformSharedGraphicsCache(cacheId);
+    return new QSharedMemoryGraphicsCache(cacheId);
+}
+
 QAbstractEventDispatcher *QXcbIntegration::createEventDispatcher() const
 {
     QAbstractEventDispatcher *dispatcher = createUnixEventDispatcher();
@@ -72,6 +72,7 @@ public:
     QPlatformOffscreenSurface *createPlatformOffscreenSurface(QOffscreenSurface *surface) const override;
 
     bool hasCapability(Capability cap) const override;
+    QPlatformSharedGraphicsCache *createPlatformSharedGraphicsCache(const char *cacheId) const override;
     QAbstractEventDispatcher *createEventDispatcher() const override;
     void initialize() override;
 
@@ -6,7 +6,7 @@ QT += \
     core-private gui-private \
     service_support-private theme_support-private \
     eventdispatcher_support-private fontdatabase_support-private \
-    edid_support-private
+    edid_support-private graphics_support-private
 
 qtHaveModule(linuxaccessibility_support-private): \
     QT += linuxaccessibility_support-private
@@ -152,6 +152,7 @@ protected:
     QVariant lastInsertId() const Q_DECL_OVERRIDE;
     bool prepare(const QString &query) Q_DECL_OVERRIDE;
     bool exec() Q_DECL_OVERRIDE;
+    bool execBatch(bool arrayBind = false) Q_DECL_OVERRIDE;
 };
 
 class QPSQLDriverPrivate : public QSqlDriverPrivate
@@ -239,6 +240,12 @@ public:
     { }
 
     QString fieldSerial(int i) const Q_DECL_OVERRIDE { return QLatin1Char('$') + QString::number(i + 1); }
+    bool int64Value(int i, qint64 *value, bool *ok) Q_DECL_OVERRIDE;
+    bool doubleValue(int i, double *value, bool *ok) Q_DECL_OVERRIDE;
+    bool canSendQuery() const Q_DECL_OVERRIDE;
+    bool sendQuery(const QString &query) Q_DECL_OVERRIDE;
+    qintptr querySocket() const Q_DECL_OVERRIDE;
+    bool consumeQueryInput() Q_DECL_OVERRIDE;
     void deallocatePreparedStmt();
 
     PGresult *result;
@@ -331,6 +338,101 @@ static QVariant::Type qDecodePSQLType(int t)
     return type;
 }
 
+// Numbers are parsed directly from the text PostgreSQL returns, without
+// the QString and QVariant data() creates. Anything else, including the
+// special floating point values, is left to data().
+bool QPSQLResultPrivate::int64Value(int i, qint64 *value, bool *ok)
+{
+    if (!result || i >= PQnfields(result))
+        return false;
+    const QVariant::Type type = qDecodePSQLType(PQftype(result, i));
+    if (type != QVariant::Int && type != QVariant::LongLong)
+        return false;
+    bool converted = !PQgetisnull(result, idx, i);
+    *value = 0;
+    if (converted) {
+        const QByteArray val = QByteArray::fromRawData(PQgetvalue(result, idx, i),
+                                                       PQgetlength(result, idx, i));
+        *value = val.toLongLong(&converted);
+    }
+    if (ok)
+        *ok = converted;
+    return true;
+}
+
+bool QPSQLResultPrivate::doubleValue(int i, double *value, bool *ok)
+{
+    if (!result || i >= PQnfields(result))
+        return false;
+    const QVariant::Type type = qDecodePSQLType(PQftype(result, i));
+    if (type != QVariant::Int && type != QVariant::LongLong && type != QVariant::Double)
+        return false;
+    if (PQgetisnull(result, idx, i)) {
+        *value = 0;
+        if (ok)
+            *ok = false;
+        return true;
+    }
+    bool converted;
+    const QByteArray val = QByteArray::fromRawData(PQgetvalue(result, idx, i),
+                                                   PQgetlength(result, idx, i));
+    *value = val.toDouble(&converted);
+    if (!converted)
+        return false;
+    if (ok)
+        *ok = true;
+    return true;
+}
+
+bool QPSQLResultPrivate::canSendQuery() const
+{
+    // the notification handler would consume the query's input
+    return drv_d_func()->seid.isEmpty();
+}
+
+bool QPSQLResultPrivate::sendQuery(const QString &query)
+{
+    Q_Q(QPSQLResult);
+    q->cleanup();
+    q->setQuery(query);
+    const QPSQLDriverPrivate *drv = drv_d_func();
+    const QByteArray stmt = drv->isUtf8 ? query.toUtf8() : query.toLocal8Bit();
+    if (!PQsendQuery(drv->connection, stmt.constData())) {
+        q->setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                        "Unable to send query"), QSqlError::StatementError, drv));
+        return false;
+    }
+    return true;
+}
+
+qintptr QPSQLResultPrivate::querySocket() const
+{
+    return PQsocket(drv_d_func()->connection);
+}
+
+bool QPSQLResultPrivate::consumeQueryInput()
+{
+    Q_Q(QPSQLResult);
+    PGconn *connection = drv_d_func()->connection;
+    if (!PQconsumeInput(connection)) {
+        q->setLastError(qMakeError(QCoreApplication::translate("QPSQLResult",
+                        "Unable to receive query result"), QSqlError::ConnectionError, drv_d_func()));
+        return false;
+    }
+    // like PQexec(), keep the result of the last statement
+    while (!PQisBusy(connection)) {
+        PGresult *next = PQgetResult(connection);
+        if (!next) {
+            processResults();
+            return false;
+        }
+        if (result)
+            PQclear(result);
+        result = next;
+    }
+    return true;
+}
+
 void QPSQLResultPrivate::deallocatePreparedStmt()
 {
     const QString stmt = QLatin1String("DEALLOCATE ") + preparedStmtId;
@@ -630,6 +732,15 @@ static QString qCreateParamString(const QVector<QVariant> &boundValues, const QS
     return params;
 }
 
+static QString qCreateExecuteString(const QString &stmtId, const QVector<QVariant> &boundValues,
+                                   const QSqlDriver *driver)
+{
+    const QString params = qCreateParamString(boundValues, driver);
+    if (params.isEmpty())
+        return QString::fromLatin1("EXECUTE %1").arg(stmtId);
+    return QString::fromLatin1("EXECUTE %1 (%2)").arg(stmtId, params);
+}
+
 QString qMakePreparedStmtId()
 {
     static QBasicAtomicInt qPreparedStmtCount = Q_BASIC_ATOMIC_INITIALIZER(0);
@@ -674,18 +785,68 @@ bool QPSQLResult::exec()
 
     cleanup();
 
-    QString stmt;
-    const QString params = qCreateParamString(boundValues(), driver());
-    if (params.isEmpty())
-        stmt = QString::fromLatin1("EXECUTE %1").arg(d->preparedStmtId);
-    else
-        stmt = QString::fromLatin1("EXECUTE %1 (%2)").arg(d->preparedStmtId, params);
-
-    d->result = d->drv_d_func()->exec(stmt);
+    d->result = d->drv_d_func()->exec(qCreateExecuteString(d->preparedStmtId, boundValues(), driver()));
 
     return d->processResults();
 }
 
+/*
+    Every EXECUTE is a round-trip to the server, so send the rows of a batch
+    as one multi-statement query per chunk of rows instead. The server runs
+    such a query in one implicit transaction, which means that nothing of a
+    failing chunk is kept. When not inside of a transaction block, the
+    chunk is repeated row by row then, so that the rows in front of the
+    failing one are kept and its error is reported, as before.
+*/
+bool QPSQLResult::execBatch(bool arrayBind)
+{
+    Q_D(QPSQLResult);
+    if (!d->preparedQueriesEnabled || d->preparedStmtId.isEmpty())
+        return QSqlResult::execBatch(arrayBind);
+
+    const QVector<QVariant> values = boundValues();
+    if (values.isEmpty())
+        return false;
+    QVector<QVariantList> columns;
+    columns.reserve(values.count());
+    for (const QVariant &value : values)
+        columns.append(value.toList());
+    const int rowCount = columns.at(0).count();
+
+    enum { MaxBatchRows = 1000, MaxBatchLength = 1024 * 1024 };
+    const bool inTransaction = PQtransactionStatus(d->drv_d_func()->connection) != PQTRANS_IDLE;
+    QVector<QVariant> row(columns.count());
+    QString stmt;
+    int first = 0;
+    while (first < rowCount) {
+        stmt.clear();
+        int last = first;
+        while (last < rowCount && last - first < MaxBatchRows && stmt.size() < MaxBatchLength) {
+            for (int j = 0; j < columns.count(); ++j)
+                row[j] = columns.at(j).value(last);
+            if (!stmt.isEmpty())
+                stmt.append(QLatin1String("; "));
+            stmt.append(qCreateExecuteString(d->preparedStmtId, row, driver()));
+            ++last;
+        }
+
+        cleanup();
+        d->result = d->drv_d_func()->exec(stmt);
+        if (!d->processResults()) {
+            if (inTransaction)
+                return false;
+            for (int i = first; i < last; ++i) {
+                for (int j = 0; j < columns.count(); ++j)
+                    bindValue(j, columns.at(j).value(i), QSql::In);
+                if (!exec())
+                    return false;
+            }
+        }
+        first = last;
+    }
+    return true;
+}
+
 ///////////////////////////////////////////////////////////////////
 
 bool QPSQLDriverPrivate::setEncodingUtf8()
@@ -130,6 +130,7 @@ protected:
     bool reset(const QString &query) Q_DECL_OVERRIDE;
     bool prepare(const QString &query) Q_DECL_OVERRIDE;
     bool exec() Q_DECL_OVERRIDE;
+    bool execBatch(bool arrayBind = false) Q_DECL_OVERRIDE;
     int size() Q_DECL_OVERRIDE;
     int numRowsAffected() Q_DECL_OVERRIDE;
     QVariant lastInsertId() const Q_DECL_OVERRIDE;
@@ -571,6 +572,35 @@ bool QSQLiteResult::exec()
     return true;
 }
 
+/*
+    Outside of a transaction SQLite commits, and thereby syncs the database
+    file, after every single statement. Run the whole batch inside of a
+    savepoint instead, so that it is committed once. The savepoint is
+    released on failure as well, which keeps the rows inserted before the
+    failing one, just like executing them one by one would.
+*/
+bool QSQLiteResult::execBatch(bool arrayBind)
+{
+    Q_D(QSQLiteResult);
+    sqlite3 *access = d->drv_d_func()->access;
+    const bool wrap = access && sqlite3_get_autocommit(access)
+            && sqlite3_exec(access, "SAVEPOINT qt_execbatch", 0, 0, 0) == SQLITE_OK;
+
+    const bool ok = QSqlCachedResult::execBatch(arrayBind);
+
+    if (wrap) {
+        const int res = sqlite3_exec(access, "RELEASE SAVEPOINT qt_execbatch", 0, 0, 0);
+        if (res != SQLITE_OK && ok) {
+            setLastError(qMakeError(access, QCoreApplication::translate("QSQLiteResult",
+                         "Unable to commit batch"), QSqlError::TransactionError, res));
+            sqlite3_exec(access, "ROLLBACK TO SAVEPOINT qt_execbatch", 0, 0, 0);
+            sqlite3_exec(access, "RELEASE SAVEPOINT qt_execbatch", 0, 0, 0);
+            return false;
+        }
+    }
+    return ok;
+}
+
 bool QSQLiteResult::gotoNext(QSqlCachedResult::ValueCache& row, int idx)
 {
     Q_D(QSQLiteResult);
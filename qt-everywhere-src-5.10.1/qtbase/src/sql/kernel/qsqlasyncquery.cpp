@@ -0,0 +1,320 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtSql module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsqlasyncquery.h"
+#include "qsqldriver.h"
+#include "qsqlquery.h"
+#include "qsqlresult.h"
+#include "qsocketnotifier.h"
+#include "qthread.h"
+#include "qthreadpool.h"
+#include "qrunnable.h"
+#include "qsemaphore.h"
+#include "private/qobject_p.h"
+#include "private/qsqlresult_p.h"
+
+QT_BEGIN_NAMESPACE
+
+class QSqlAsyncQueryPrivate : public QObjectPrivate
+{
+    Q_DECLARE_PUBLIC(QSqlAsyncQuery)
+
+public:
+    QSqlAsyncQueryPrivate(const QSqlDatabase &db)
+        : db(db.isValid() ? db : QSqlDatabase::database(QLatin1String(QSqlDatabase::defaultConnection), false)),
+          notifier(0),
+          running(false),
+          workerRunning(false)
+    { }
+
+    bool sendQuery(const QString &query);
+    bool startWorker(const QString &query);
+    void finishLater();
+    void finish();
+    void readInput();
+    void takeBackDriver();
+
+    QSqlResultPrivate *resultPrivate() const
+    {
+        return query.result()->d_ptr;
+    }
+
+    QSqlDatabase db;
+    QSqlQuery query;
+    QSocketNotifier *notifier;
+    bool running;
+    bool workerRunning;
+#ifndef QT_NO_THREAD
+    QSemaphore workerDone;
+#endif
+};
+
+#ifndef QT_NO_THREAD
+class QSqlAsyncQueryRunnable : public QRunnable
+{
+public:
+    QSqlAsyncQueryRunnable(QSqlAsyncQueryPrivate *d, const QString &query)
+        : d(d), query(query)
+    { }
+
+    void run() Q_DECL_OVERRIDE
+    {
+        QSqlDriver *driver = d->db.driver();
+        driver->moveToThread(QThread::currentThread());
+        d->query.exec(query);
+        driver->moveToThread(0);
+
+        QSqlAsyncQueryPrivate *priv = d;
+        QMetaObject::invokeMethod(d->q_ptr, [priv]() { priv->finish(); }, Qt::QueuedConnection);
+        // the QSqlAsyncQuery may be destroyed as soon as this is released
+        d->workerDone.release();
+    }
+
+private:
+    QSqlAsyncQueryPrivate *d;
+    QString query;
+};
+#endif
+
+/*!
+    \internal
+    Sends \a query without waiting for the result, if the driver supports
+    it. The result is then read once the connection's socket is readable.
+*/
+bool QSqlAsyncQueryPrivate::sendQuery(const QString &query)
+{
+    Q_Q(QSqlAsyncQuery);
+    QSqlResultPrivate *result = resultPrivate();
+    if (!result->canSendQuery())
+        return false;
+
+    if (!result->sendQuery(query)) {
+        finishLater();
+        return true;
+    }
+
+    notifier = new QSocketNotifier(result->querySocket(), QSocketNotifier::Read, q);
+    QObject::connect(notifier, &QSocketNotifier::activated, q, [this]() { readInput(); });
+    return true;
+}
+
+void QSqlAsyncQueryPrivate::readInput()
+{
+    if (resultPrivate()->consumeQueryInput())
+        return;
+    delete notifier;
+    notifier = 0;
+    finish();
+}
+
+/*!
+    \internal
+    Executes \a query in a pool thread. The driver is handed to that
+    thread for the duration of the query, the only thread change QObject
+    allows without running in the object's thread being to pull an object
+    without thread affinity.
+*/
+bool QSqlAsyncQueryPrivate::startWorker(const QString &query)
+{
+#ifndef QT_NO_THREAD
+    QSqlDriver *driver = db.driver();
+    if (!driver || driver->parent() || driver->thread() != QThread::currentThread())
+        return false;
+
+    driver->moveToThread(0);
+    workerRunning = true;
+    QThreadPool::globalInstance()->start(new QSqlAsyncQueryRunnable(this, query));
+    return true;
+#else
+    Q_UNUSED(query);
+    return false;
+#endif
+}
+
+void QSqlAsyncQueryPrivate::takeBackDriver()
+{
+#ifndef QT_NO_THREAD
+    if (!workerRunning)
+        return;
+    workerDone.acquire();
+    workerRunning = false;
+    db.driver()->moveToThread(QThread::currentThread());
+#endif
+}
+
+void QSqlAsyncQueryPrivate::finishLater()
+{
+    Q_Q(QSqlAsyncQuery);
+    QMetaObject::invokeMethod(q, [this]() { finish(); }, Qt::QueuedConnection);
+}
+
+void QSqlAsyncQueryPrivate::finish()
+{
+    Q_Q(QSqlAsyncQuery);
+    takeBackDriver();
+    running = false;
+    emit q->finished();
+}
+
+/*!
+    \class QSqlAsyncQuery
+    \brief The QSqlAsyncQuery class executes SQL statements without
+    blocking the calling thread.
+
+    \ingroup database
+    \inmodule QtSql
+    \since 5.11
+
+    QSqlQuery::exec() blocks until the database has executed the statement,
+    which keeps an application's event loop from running meanwhile.
+    QSqlAsyncQuery returns from exec() immediately, and emits finished()
+    once the statement has been executed. The result can then be read from
+    query(), like from any other QSqlQuery:
+
+    \code
+    QSqlAsyncQuery *asyncQuery = new QSqlAsyncQuery(db, this);
+    connect(asyncQuery, &QSqlAsyncQuery::finished, [asyncQuery]() {
+        QSqlQuery &query = asyncQuery->query();
+        while (query.next())
+            qDebug() << query.value(0).toString();
+    });
+    asyncQuery->exec("SELECT name FROM employee");
+    \endcode
+
+    Drivers that support it, currently QPSQL, send the statement and read
+    the result once it arrives, from the thread's event loop. For all
+    other drivers the statement is executed in a thread of
+    QThreadPool::globalInstance().
+
+    While a statement is running, the database connection must not be used
+    for anything else, and query() must not be accessed.
+
+    \sa QSqlQuery, QSqlDatabase
+*/
+
+/*!
+    \fn void QSqlAsyncQuery::finished()
+
+    This signal is emitted when the statement started by exec() has been
+    executed, whether successfully or not. The result and any error are
+    available from query().
+*/
+
+/*!
+    Constructs an asynchronous query for the database connection \a db,
+    with the given \a parent. If \a db is not given, the application's
+    default database is used.
+*/
+QSqlAsyncQuery::QSqlAsyncQuery(const QSqlDatabase &db, QObject *parent)
+    : QObject(*new QSqlAsyncQueryPrivate(db), parent)
+{
+}
+
+/*!
+    Destroys the query. If a statement is still running, the destructor
+    waits for it to complete.
+*/
+QSqlAsyncQuery::~QSqlAsyncQuery()
+{
+    Q_D(QSqlAsyncQuery);
+    if (d->notifier) {
+        // read the remaining result, so that the connection can be used again
+        while (d->resultPrivate()->consumeQueryInput())
+            QThread::msleep(1);
+    }
+    d->takeBackDriver();
+}
+
+/*!
+    Starts executing the SQL statement \a query and returns true.
+
+    The finished() signal is emitted once the statement has been executed,
+    also if the execution failed. Returns false without starting the
+    statement if another statement is still running, in which case
+    finished() is not emitted.
+
+    \sa isRunning(), query()
+*/
+bool QSqlAsyncQuery::exec(const QString &query)
+{
+    Q_D(QSqlAsyncQuery);
+    if (d->running) {
+        qWarning("QSqlAsyncQuery::exec: a query is already running");
+        return false;
+    }
+
+    d->running = true;
+    d->query = QSqlQuery(d->db);
+    if (d->db.isOpen() && !d->db.isOpenError()) {
+        if (d->sendQuery(query) || d->startWorker(query))
+            return true;
+    }
+
+    // execute synchronously, but report it the same way
+    d->query.exec(query);
+    d->finishLater();
+    return true;
+}
+
+/*!
+    Returns \c true if a statement started by exec() has not finished yet.
+
+    \sa finished()
+*/
+bool QSqlAsyncQuery::isRunning() const
+{
+    Q_D(const QSqlAsyncQuery);
+    return d->running;
+}
+
+/*!
+    Returns the query holding the result of the last statement executed
+    with exec(). It must not be used while the statement is running.
+*/
+QSqlQuery &QSqlAsyncQuery::query()
+{
+    Q_D(QSqlAsyncQuery);
+    if (d->running)
+        qWarning("QSqlAsyncQuery::query: a query is still running");
+    return d->query;
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qsqlasyncquery.cpp"
@@ -0,0 +1,76 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtSql module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QSQLASYNCQUERY_H
+#define QSQLASYNCQUERY_H
+
+#include <QtSql/qtsqlglobal.h>
+#include <QtSql/qsqldatabase.h>
+#include <QtCore/qobject.h>
+
+QT_BEGIN_NAMESPACE
+
+
+class QSqlQuery;
+class QSqlAsyncQueryPrivate;
+
+class Q_SQL_EXPORT QSqlAsyncQuery : public QObject
+{
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QSqlAsyncQuery)
+
+public:
+    explicit QSqlAsyncQuery(const QSqlDatabase &db = QSqlDatabase(), QObject *parent = Q_NULLPTR);
+    ~QSqlAsyncQuery();
+
+    bool exec(const QString &query);
+    bool isRunning() const;
+
+    QSqlQuery &query();
+
+Q_SIGNALS:
+    void finished();
+
+private:
+    Q_DISABLE_COPY(QSqlAsyncQuery)
+};
+
+QT_END_NAMESPACE
+
+#endif // QSQLASYNCQUERY_H
@@ -224,6 +224,39 @@ bool QSqlCachedResult::fetchLast()
     }
 }
 
+// Reads the value in place, saving the copy of the QVariant data() makes.
+const QVariant *QSqlCachedResultPrivate::cachedValue(int i) const
+{
+    const int cacheIdx = forwardOnly ? i : idx * colCount + i;
+    if (i >= colCount || i < 0 || idx < 0 || cacheIdx >= rowCacheEnd)
+        return 0;
+    return &cache.at(cacheIdx);
+}
+
+bool QSqlCachedResultPrivate::int64Value(int i, qint64 *value, bool *ok)
+{
+    const QVariant *v = cachedValue(i);
+    if (!v)
+        return false;
+    bool converted = !v->isNull();
+    *value = converted ? v->toLongLong(&converted) : 0;
+    if (ok)
+        *ok = converted;
+    return true;
+}
+
+bool QSqlCachedResultPrivate::doubleValue(int i, double *value, bool *ok)
+{
+    const QVariant *v = cachedValue(i);
+    if (!v)
+        return false;
+    bool converted = !v->isNull();
+    *value = converted ? v->toDouble(&converted) : 0;
+    if (ok)
+        *ok = converted;
+    return true;
+}
+
 QVariant QSqlCachedResult::data(int i)
 {
     Q_D(const QSqlCachedResult);
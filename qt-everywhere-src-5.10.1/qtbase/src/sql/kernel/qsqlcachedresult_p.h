@@ -108,6 +108,9 @@ public:
     void cleanup();
     int nextIndex();
     void revertLast();
+    bool int64Value(int i, qint64 *value, bool *ok) Q_DECL_OVERRIDE;
+    bool doubleValue(int i, double *value, bool *ok) Q_DECL_OVERRIDE;
+    const QVariant *cachedValue(int i) const;
 
     QSqlCachedResult::ValueCache cache;
     int rowCacheEnd;
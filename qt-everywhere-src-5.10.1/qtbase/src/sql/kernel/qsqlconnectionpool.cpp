@@ -0,0 +1,489 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtSql module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsqlconnectionpool.h"
+#include "qsqldriver.h"
+#include "qsqlquery.h"
+#include "qsqlerror.h"
+#include "qdebug.h"
+#include "qelapsedtimer.h"
+#include "qmutex.h"
+#include "qset.h"
+#include "qthread.h"
+#include "qvector.h"
+#include "qwaitcondition.h"
+
+QT_BEGIN_NAMESPACE
+
+class QSqlConnectionPoolPrivate
+{
+public:
+    struct IdleConnection
+    {
+        QSqlDatabase db;
+        QElapsedTimer idleTimer;
+    };
+
+    QSqlConnectionPoolPrivate()
+        : maxConnections(qMax(1, QThread::idealThreadCount())),
+          maxIdleTime(-1),
+          waiting(0),
+          opened(0),
+          nextId(0)
+    { }
+
+    QString createConnectionName()
+    {
+        return QString::fromLatin1("qt_sql_pool_%1_%2").arg(quintptr(this), 0, 16).arg(nextId++);
+    }
+    void expireIdleConnections();
+    static void discard(QSqlDatabase &db);
+
+    mutable QMutex mutex;
+    QWaitCondition connectionReleased;
+    QSqlDatabase templateDb;
+    QVector<IdleConnection> idle;
+    QSet<QString> active;
+    QString validationQuery;
+    int maxConnections;
+    int maxIdleTime;
+    int waiting;
+    int opened;
+    int nextId;
+};
+
+/*!
+    \internal
+    Closes and removes the idle connections that have not been used for
+    longer than maxIdleTime. Must be called with the mutex locked.
+*/
+void QSqlConnectionPoolPrivate::expireIdleConnections()
+{
+    if (maxIdleTime < 0)
+        return;
+    // the least recently released connections are at the front
+    while (!idle.isEmpty() && idle.first().idleTimer.hasExpired(maxIdleTime)) {
+        QSqlDatabase db = idle.takeFirst().db;
+        discard(db);
+    }
+}
+
+/*!
+    \internal
+    Closes \a db and removes its connection.
+*/
+void QSqlConnectionPoolPrivate::discard(QSqlDatabase &db)
+{
+    // idle connections have no thread affinity, adopt them so that the
+    // driver can clean up its objects
+    if (QSqlDriver *driver = db.driver()) {
+        if (!driver->thread())
+            driver->moveToThread(QThread::currentThread());
+    }
+    const QString name = db.connectionName();
+    db.close();
+    db = QSqlDatabase();
+    QSqlDatabase::removeDatabase(name);
+}
+
+/*!
+    \class QSqlConnectionPool
+    \brief The QSqlConnectionPool class keeps a set of open database
+    connections to be shared between threads.
+
+    \ingroup database
+    \inmodule QtSql
+    \since 5.11
+
+    Opening a database connection can be expensive, for example when it
+    involves a network round-trip and a TLS handshake. Since a connection
+    can only be used from one thread at a time, code running in a thread
+    pool typically ends up opening a new connection for every task.
+    QSqlConnectionPool instead keeps connections open after they have been
+    used, and leases them to the next thread that needs one.
+
+    The pool is created from a template connection, whose driver and
+    connection parameters are copied for every connection the pool opens.
+    The template itself is never opened. acquire() returns an open
+    connection, opening a new one if none is idle and fewer than
+    maxConnections() exist, or waiting for another thread to release one
+    otherwise. A leased connection can only be used by the thread that
+    acquired it, which has to hand it back with release() when done:
+
+    \code
+    QSqlConnectionPool pool(QSqlDatabase::database("template", false));
+    ...
+    // in a worker thread
+    QSqlDatabase db = pool.acquire();
+    {
+        QSqlQuery query(db);
+        query.exec("UPDATE accounts SET balance = 0");
+    }
+    pool.release(db);
+    \endcode
+
+    All queries on a connection must have been destroyed or cleared before
+    it is released. The driver of a released connection is detached from
+    the releasing thread, and attached to the acquiring thread again when
+    the connection is leased the next time.
+
+    Idle connections can be validated before they are leased by setting a
+    validationQuery(), and are closed after they have not been used for
+    maxIdleTime() milliseconds. The pool's state can be inspected with
+    connectionCount(), activeConnectionCount(), idleConnectionCount(),
+    waitingThreadCount() and openedConnectionCount().
+
+    All functions of this class are \l{thread-safe}.
+
+    \sa QSqlDatabase, {Threads and the SQL Module}
+*/
+
+/*!
+    Constructs a pool of connections with the driver and connection
+    parameters of \a templateDatabase.
+
+    The maximum number of connections defaults to
+    QThread::idealThreadCount().
+*/
+QSqlConnectionPool::QSqlConnectionPool(const QSqlDatabase &templateDatabase)
+    : d(new QSqlConnectionPoolPrivate)
+{
+    if (templateDatabase.isValid())
+        d->templateDb = QSqlDatabase::cloneDatabase(templateDatabase, d->createConnectionName());
+    else
+        qWarning("QSqlConnectionPool: invalid template database");
+}
+
+/*!
+    Closes all connections of the pool and destroys it.
+
+    All connections have to be released before the pool is destroyed.
+*/
+QSqlConnectionPool::~QSqlConnectionPool()
+{
+    QMutexLocker locker(&d->mutex);
+    if (!d->active.isEmpty()) {
+        qWarning("QSqlConnectionPool: destroyed while %d connections are still in use",
+                 d->active.size());
+    }
+    for (int i = 0; i < d->idle.size(); ++i)
+        QSqlConnectionPoolPrivate::discard(d->idle[i].db);
+    d->idle.clear();
+    for (const QString &name : qAsConst(d->active))
+        QSqlDatabase::removeDatabase(name);
+    if (d->templateDb.isValid())
+        QSqlConnectionPoolPrivate::discard(d->templateDb);
+    locker.unlock();
+    delete d;
+}
+
+/*!
+    Sets the maximum number of connections the pool keeps open, including
+    the ones that are leased, to \a maxConnections.
+
+    Lowering the maximum does not close connections, but acquire() does
+    not open new ones until the number of connections drops below it.
+
+    \sa maxConnections(), connectionCount()
+*/
+void QSqlConnectionPool::setMaxConnections(int maxConnections)
+{
+    QMutexLocker locker(&d->mutex);
+    d->maxConnections = qMax(1, maxConnections);
+    d->connectionReleased.wakeAll();
+}
+
+/*!
+    Returns the maximum number of connections of the pool.
+
+    \sa setMaxConnections()
+*/
+int QSqlConnectionPool::maxConnections() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->maxConnections;
+}
+
+/*!
+    Sets the time after which an idle connection is closed to \a msecs
+    milliseconds. A negative value, which is the default, keeps idle
+    connections open until the pool is destroyed.
+
+    Expired connections are closed the next time a connection is acquired
+    or released.
+
+    \sa maxIdleTime()
+*/
+void QSqlConnectionPool::setMaxIdleTime(int msecs)
+{
+    QMutexLocker locker(&d->mutex);
+    d->maxIdleTime = msecs;
+}
+
+/*!
+    Returns the time in milliseconds after which an idle connection is
+    closed, or a negative value if idle connections are kept open.
+
+    \sa setMaxIdleTime()
+*/
+int QSqlConnectionPool::maxIdleTime() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->maxIdleTime;
+}
+
+/*!
+    Sets the query that is executed on an idle connection before it is
+    leased to \a query, for example \c{SELECT 1}. If the query fails, the
+    connection is assumed to be broken and is reopened.
+
+    By default, no validation query is set and idle connections are only
+    checked for being open.
+
+    \sa validationQuery()
+*/
+void QSqlConnectionPool::setValidationQuery(const QString &query)
+{
+    QMutexLocker locker(&d->mutex);
+    d->validationQuery = query;
+}
+
+/*!
+    Returns the query used to validate idle connections.
+
+    \sa setValidationQuery()
+*/
+QString QSqlConnectionPool::validationQuery() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->validationQuery;
+}
+
+/*!
+    Leases an open connection to the calling thread and returns it.
+
+    If no connection is idle and the pool has already opened
+    maxConnections() connections, the calling thread is blocked until
+    another thread releases one or until \a msecs milliseconds have
+    passed. A negative value, the default, waits without a timeout.
+
+    An invalid QSqlDatabase is returned if the timeout expires or a new
+    connection cannot be opened.
+
+    \sa release()
+*/
+QSqlDatabase QSqlConnectionPool::acquire(int msecs)
+{
+    QElapsedTimer timer;
+    if (msecs > 0)
+        timer.start();
+
+    QMutexLocker locker(&d->mutex);
+    if (!d->templateDb.isValid())
+        return QSqlDatabase();
+
+    for (;;) {
+        d->expireIdleConnections();
+
+        if (!d->idle.isEmpty()) {
+            QSqlDatabase db = d->idle.takeLast().db;
+            d->active.insert(db.connectionName());
+            const QString validationQuery = d->validationQuery;
+            locker.unlock();
+
+            // only objects without thread affinity can be pulled into
+            // the current thread
+            if (QSqlDriver *driver = db.driver())
+                driver->moveToThread(QThread::currentThread());
+
+            bool valid = db.isOpen() && !db.isOpenError();
+            if (valid && !validationQuery.isEmpty()) {
+                QSqlQuery query(db);
+                valid = query.exec(validationQuery);
+            }
+            if (valid)
+                return db;
+
+            db.close();
+            if (db.open()) {
+                locker.relock();
+                ++d->opened;
+                return db;
+            }
+
+            locker.relock();
+            d->active.remove(db.connectionName());
+            QSqlConnectionPoolPrivate::discard(db);
+            d->connectionReleased.wakeOne();
+            return QSqlDatabase();
+        }
+
+        if (d->idle.size() + d->active.size() < d->maxConnections) {
+            const QString name = d->createConnectionName();
+            d->active.insert(name);
+            const QSqlDatabase templateDb = d->templateDb;
+            locker.unlock();
+
+            QSqlDatabase db = QSqlDatabase::cloneDatabase(templateDb, name);
+            const bool open = db.open();
+            if (!open) {
+                qWarning() << "QSqlConnectionPool::acquire: unable to open database:"
+                           << db.lastError().text();
+            }
+
+            locker.relock();
+            if (open) {
+                ++d->opened;
+                return db;
+            }
+            d->active.remove(name);
+            QSqlConnectionPoolPrivate::discard(db);
+            d->connectionReleased.wakeOne();
+            return QSqlDatabase();
+        }
+
+        if (msecs == 0)
+            return QSqlDatabase();
+        ++d->waiting;
+        const bool woken = msecs < 0
+                ? d->connectionReleased.wait(&d->mutex)
+                : d->connectionReleased.wait(&d->mutex, qMax<qint64>(0, msecs - timer.elapsed()));
+        --d->waiting;
+        if (!woken && d->idle.isEmpty() && d->idle.size() + d->active.size() >= d->maxConnections)
+            return QSqlDatabase();
+    }
+}
+
+/*!
+    Hands the connection \a db, which must have been returned by
+    acquire(), back to the pool.
+
+    This function must be called from the thread that acquired the
+    connection, after all queries on it have been destroyed. The
+    connection must not be used after it has been released.
+
+    \sa acquire()
+*/
+void QSqlConnectionPool::release(const QSqlDatabase &db)
+{
+    const QString name = db.connectionName();
+    {
+        QMutexLocker locker(&d->mutex);
+        if (!d->active.contains(name)) {
+            qWarning("QSqlConnectionPool::release: connection '%s' is not leased from this pool",
+                     qPrintable(name));
+            return;
+        }
+    }
+
+    QSqlConnectionPoolPrivate::IdleConnection connection;
+    connection.db = db;
+    if (QSqlDriver *driver = connection.db.driver()) {
+        if (connection.db.isOpen())
+            driver->moveToThread(0);
+    }
+
+    QMutexLocker locker(&d->mutex);
+    d->active.remove(name);
+    if (connection.db.isOpen()) {
+        connection.idleTimer.start();
+        d->idle.append(connection);
+    } else {
+        QSqlConnectionPoolPrivate::discard(connection.db);
+    }
+    d->expireIdleConnections();
+    d->connectionReleased.wakeOne();
+}
+
+/*!
+    Returns the number of connections that are currently open, whether
+    they are leased or idle.
+
+    \sa activeConnectionCount(), idleConnectionCount()
+*/
+int QSqlConnectionPool::connectionCount() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->idle.size() + d->active.size();
+}
+
+/*!
+    Returns the number of connections that are currently leased.
+
+    \sa acquire(), connectionCount()
+*/
+int QSqlConnectionPool::activeConnectionCount() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->active.size();
+}
+
+/*!
+    Returns the number of open connections waiting to be leased.
+
+    \sa release(), connectionCount()
+*/
+int QSqlConnectionPool::idleConnectionCount() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->idle.size();
+}
+
+/*!
+    Returns the number of threads blocked in acquire() waiting for a
+    connection to be released.
+*/
+int QSqlConnectionPool::waitingThreadCount() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->waiting;
+}
+
+/*!
+    Returns the number of times the pool opened a connection, including
+    the reopening of connections that failed validation. Comparing it to
+    the number of calls to acquire() shows how well the pool is used.
+*/
+int QSqlConnectionPool::openedConnectionCount() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->opened;
+}
+
+QT_END_NAMESPACE
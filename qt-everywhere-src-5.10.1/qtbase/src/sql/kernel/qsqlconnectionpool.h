@@ -0,0 +1,82 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtSql module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QSQLCONNECTIONPOOL_H
+#define QSQLCONNECTIONPOOL_H
+
+#include <QtSql/qtsqlglobal.h>
+#include <QtSql/qsqldatabase.h>
+
+QT_BEGIN_NAMESPACE
+
+
+class QSqlConnectionPoolPrivate;
+
+class Q_SQL_EXPORT QSqlConnectionPool
+{
+public:
+    explicit QSqlConnectionPool(const QSqlDatabase &templateDatabase);
+    ~QSqlConnectionPool();
+
+    void setMaxConnections(int maxConnections);
+    int maxConnections() const;
+
+    void setMaxIdleTime(int msecs);
+    int maxIdleTime() const;
+
+    void setValidationQuery(const QString &query);
+    QString validationQuery() const;
+
+    QSqlDatabase acquire(int msecs = -1);
+    void release(const QSqlDatabase &db);
+
+    int connectionCount() const;
+    int activeConnectionCount() const;
+    int idleConnectionCount() const;
+    int waitingThreadCount() const;
+    int openedConnectionCount() const;
+
+private:
+    Q_DISABLE_COPY(QSqlConnectionPool)
+    QSqlConnectionPoolPrivate *d;
+};
+
+QT_END_NAMESPACE
+
+#endif // QSQLCONNECTIONPOOL_H
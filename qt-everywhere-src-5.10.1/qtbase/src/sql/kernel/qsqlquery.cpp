@@ -46,6 +46,7 @@
 #include "qatomic.h"
 #include "qsqlrecord.h"
 #include "qsqlresult.h"
+#include "private/qsqlresult_p.h"
 #include "qsqldriver.h"
 #include "qsqldatabase.h"
 #include "private/qsqlnulldriver_p.h"
@@ -450,6 +451,68 @@ QVariant QSqlQuery::value(const QString& name) const
     return QVariant();
 }
 
+/*!
+    \since 5.11
+
+    Returns the value of field \a index in the current record converted
+    to a 64-bit integer.
+
+    Unlike value(), this function lets the driver convert the field
+    directly from its own buffers where possible, without creating a
+    QVariant. This makes a difference when reading large result sets.
+
+    If \a ok is not \c nullptr, *\a{ok} is set to \c false if the field
+    is NULL, if its value cannot be converted, or if the query is not
+    positioned on a valid record; otherwise *\a{ok} is set to \c true.
+    In those cases 0 is returned.
+
+    \sa value(), valueDouble(), isNull()
+*/
+qint64 QSqlQuery::valueInt64(int index, bool *ok) const
+{
+    if (isActive() && isValid() && (index > -1)) {
+        qint64 value;
+        if (d->sqlResult->d_ptr->int64Value(index, &value, ok))
+            return value;
+        if (!d->sqlResult->isNull(index))
+            return d->sqlResult->data(index).toLongLong(ok);
+    } else {
+        qWarning("QSqlQuery::valueInt64: not positioned on a valid record");
+    }
+    if (ok)
+        *ok = false;
+    return 0;
+}
+
+/*!
+    \since 5.11
+
+    Returns the value of field \a index in the current record converted
+    to a double, without creating a QVariant where the driver supports it.
+
+    If \a ok is not \c nullptr, *\a{ok} is set to \c false if the field
+    is NULL, if its value cannot be converted, or if the query is not
+    positioned on a valid record; otherwise *\a{ok} is set to \c true.
+    In those cases 0 is returned.
+
+    \sa value(), valueInt64(), isNull()
+*/
+double QSqlQuery::valueDouble(int index, bool *ok) const
+{
+    if (isActive() && isValid() && (index > -1)) {
+        double value;
+        if (d->sqlResult->d_ptr->doubleValue(index, &value, ok))
+            return value;
+        if (!d->sqlResult->isNull(index))
+            return d->sqlResult->data(index).toDouble(ok);
+    } else {
+        qWarning("QSqlQuery::valueDouble: not positioned on a valid record");
+    }
+    if (ok)
+        *ok = false;
+    return 0;
+}
+
 /*!
     Returns the current internal position of the query. The first
     record is at position zero. If the position is invalid, the
@@ -84,6 +84,8 @@ public:
     bool exec(const QString& query);
     QVariant value(int i) const;
     QVariant value(const QString& name) const;
+    qint64 valueInt64(int i, bool *ok = Q_NULLPTR) const;
+    double valueDouble(int i, bool *ok = Q_NULLPTR) const;
 
     void setNumericalPrecisionPolicy(QSql::NumericalPrecisionPolicy precisionPolicy);
     QSql::NumericalPrecisionPolicy numericalPrecisionPolicy() const;
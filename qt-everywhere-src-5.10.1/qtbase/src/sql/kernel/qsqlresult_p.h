@@ -115,6 +115,17 @@ public:
     }
 
     virtual QString fieldSerial(int) const;
+    // Typed access to field i of the current row without creating a
+    // QVariant. Return false if the value has to be taken from data().
+    virtual bool int64Value(int, qint64 *, bool *) { return false; }
+    virtual bool doubleValue(int, double *, bool *) { return false; }
+    // Asynchronous execution for QSqlAsyncQuery: sendQuery() starts the
+    // query, consumeQueryInput() is called whenever querySocket() becomes
+    // readable and returns true while the result is still incomplete.
+    virtual bool canSendQuery() const { return false; }
+    virtual bool sendQuery(const QString &) { return false; }
+    virtual qintptr querySocket() const { return -1; }
+    virtual bool consumeQueryInput() { return false; }
     QString positionalToNamedBinding(const QString &query) const;
     QString namedToPositionalBinding(const QString &query);
     QString holderAt(int index) const;
@@ -41,6 +41,7 @@
 #include "qsqlquerymodel_p.h"
 
 #include <qdebug.h>
+#include <qsqldatabase.h>
 #include <qsqldriver.h>
 #include <qsqlfield.h>
 
@@ -100,6 +101,102 @@ int QSqlQueryModelPrivate::columnInQuery(int modelColumn) const
     return modelColumn - colOffsets[modelColumn];
 }
 
+/*
+    Returns \a sql restricted to \a count rows starting at \a offset, or
+    an empty string if the DBMS of \a driver is not known to support it.
+*/
+QString QSqlQueryModelPrivate::windowStatement(const QSqlDriver *driver, const QString &sql,
+                                               int offset, int count)
+{
+    if (!driver)
+        return QString();
+    switch (driver->dbmsType()) {
+    case QSqlDriver::PostgreSQL:
+    case QSqlDriver::SQLite:
+    case QSqlDriver::MySqlServer:
+        break;
+    default:
+        return QString();
+    }
+
+    QString statement = sql.trimmed();
+    while (statement.endsWith(QLatin1Char(';')))
+        statement.chop(1);
+    return statement + QString::fromLatin1(" LIMIT %1 OFFSET %2").arg(count).arg(offset);
+}
+
+bool QSqlQueryModelPrivate::setWindowedQuery(const QString &sql, const QSqlDatabase &db)
+{
+    Q_Q(QSqlQueryModel);
+    if (windowStatement(db.driver(), sql, 0, windowSize).isEmpty())
+        return false;
+
+    q->beginResetModel();
+    clearWindow();
+    bottom = QModelIndex();
+    error = QSqlError();
+    atEnd = true;
+    windowSql = sql;
+    query = QSqlQuery(db);
+    query.setForwardOnly(true);
+
+    int rowCount = 0;
+    QString countSql = sql.trimmed();
+    while (countSql.endsWith(QLatin1Char(';')))
+        countSql.chop(1);
+    if (query.exec(QLatin1String("SELECT COUNT(*) FROM (") + countSql + QLatin1String(") qt_count"))
+            && query.next()) {
+        rowCount = query.value(0).toInt();
+    } else {
+        error = query.lastError();
+    }
+
+    QSqlRecord newRec;
+    if (fetchWindow(0))
+        newRec = query.record();
+    if (colOffsets.size() != newRec.count() || newRec != rec)
+        initColOffsets(newRec.count());
+    rec = newRec;
+    bottom = q->createIndex(error.isValid() ? -1 : rowCount - 1, rec.count() - 1);
+
+    q->endResetModel();
+    q->queryChange();
+    return true;
+}
+
+/*
+    Replaces the cached rows by the ones around \a row, so that scrolling
+    back and forth does not need a new query for every row.
+*/
+bool QSqlQueryModelPrivate::fetchWindow(int row)
+{
+    const int start = qMax(0, row - windowSize / 2);
+    windowCache.clear();
+    windowStart = start;
+    windowRows = 0;
+
+    if (!query.exec(windowStatement(query.driver(), windowSql, start, windowSize))) {
+        error = query.lastError();
+        return false;
+    }
+    const int columns = query.record().count();
+    windowCache.reserve(windowSize * columns);
+    while (query.next()) {
+        for (int i = 0; i < columns; ++i)
+            windowCache.append(query.value(i));
+        ++windowRows;
+    }
+    return true;
+}
+
+void QSqlQueryModelPrivate::clearWindow()
+{
+    windowSql.clear();
+    windowCache.clear();
+    windowStart = 0;
+    windowRows = 0;
+}
+
 /*!
     \class QSqlQueryModel
     \brief The QSqlQueryModel class provides a read-only data model for SQL
@@ -144,6 +241,10 @@ int QSqlQueryModelPrivate::columnInQuery(int modelColumn) const
     a query, the model will fetch rows incrementally.
     See fetchMore() for more information.
 
+    All rows fetched by the model are kept in memory. For large result
+    sets, a window size can be set with setWindowSize(), in which case
+    the model only keeps the rows around the last accessed one.
+
     \sa QSqlTableModel, QSqlRelationalTableModel, QSqlQuery,
         {Model/View Programming}, {Query Model Example}
 */
@@ -375,6 +476,15 @@ QVariant QSqlQueryModel::data(const QModelIndex &item, int role) const
     if (!d->rec.isGenerated(item.column()))
         return v;
     QModelIndex dItem = indexInQuery(item);
+    if (d->isWindowed()) {
+        const int row = dItem.row();
+        const int columns = d->query.record().count();
+        if (row < 0 || row > d->bottom.row() || dItem.column() < 0 || dItem.column() >= columns)
+            return v;
+        if (row < d->windowStart || row >= d->windowStart + d->windowRows)
+            const_cast<QSqlQueryModelPrivate *>(d)->fetchWindow(row);
+        return d->windowCache.value((row - d->windowStart) * columns + dItem.column());
+    }
     if (dItem.row() > d->bottom.row())
         const_cast<QSqlQueryModelPrivate *>(d)->prefetch(dItem.row());
 
@@ -446,6 +556,7 @@ void QSqlQueryModel::setQuery(const QSqlQuery &query)
     d->query = query;
     d->rec = newRec;
     d->atEnd = true;
+    d->clearWindow();
 
     if (query.isForwardOnly()) {
         d->error = QSqlError(QLatin1String("Forward-only queries "
@@ -488,13 +599,66 @@ void QSqlQueryModel::setQuery(const QSqlQuery &query)
     Example:
     \snippet code/src_sql_models_qsqlquerymodel.cpp 1
 
+    If a window size is set and the database supports it, the query is
+    not executed at once. Instead, the model counts the rows of the
+    result and fetches the rows it needs, see setWindowSize().
+
     \sa query(), queryChange(), lastError()
 */
 void QSqlQueryModel::setQuery(const QString &query, const QSqlDatabase &db)
 {
+    Q_D(QSqlQueryModel);
+    if (d->windowSize > 0) {
+        const QSqlDatabase database = db.isValid() ? db : QSqlDatabase::database();
+        if (d->setWindowedQuery(query, database))
+            return;
+    }
     setQuery(QSqlQuery(query, db));
 }
 
+/*!
+    \since 5.11
+
+    Sets the number of rows the model keeps in memory to \a rows.
+
+    By default, the window size is 0, and the model keeps every row it
+    fetched from the result set, so its memory use grows while the user
+    scrolls through a large result. With a positive window size, queries
+    set with setQuery(const QString &, const QSqlDatabase &) are handled
+    differently: the model determines rowCount() with a \c{COUNT(*)}
+    query, and only keeps the \a rows rows around the row last accessed
+    through data(). When a row outside of them is needed, they are fetched
+    again by running the query restricted with \c LIMIT and \c OFFSET.
+
+    The windowed mode is used for PostgreSQL, SQLite and MySQL. The query
+    should have an \c{ORDER BY} clause, so that rows keep their position
+    between fetches. Changes to the data after setQuery() are not
+    reflected in rowCount().
+
+    The window size applies to the next call of setQuery().
+
+    \sa windowSize()
+*/
+void QSqlQueryModel::setWindowSize(int rows)
+{
+    Q_D(QSqlQueryModel);
+    d->windowSize = qMax(0, rows);
+}
+
+/*!
+    \since 5.11
+
+    Returns the number of rows the model keeps in memory, or 0 if it keeps
+    all rows it fetched.
+
+    \sa setWindowSize()
+*/
+int QSqlQueryModel::windowSize() const
+{
+    Q_D(const QSqlQueryModel);
+    return d->windowSize;
+}
+
 /*!
     Clears the model and releases any acquired resource.
 */
@@ -505,6 +669,7 @@ void QSqlQueryModel::clear()
     d->error = QSqlError();
     d->atEnd = true;
     d->query.clear();
+    d->clearWindow();
     d->rec.clear();
     d->colOffsets.clear();
     d->bottom = QModelIndex();
@@ -66,13 +66,20 @@ class QSqlQueryModelPrivate: public QAbstractItemModelPrivate
 {
     Q_DECLARE_PUBLIC(QSqlQueryModel)
 public:
-    QSqlQueryModelPrivate() : atEnd(false), nestedResetLevel(0) {}
+    QSqlQueryModelPrivate() : atEnd(false), nestedResetLevel(0), windowSize(0), windowStart(0),
+        windowRows(0) {}
     ~QSqlQueryModelPrivate();
 
     void prefetch(int);
     void initColOffsets(int size);
     int columnInQuery(int modelColumn) const;
 
+    static QString windowStatement(const QSqlDriver *driver, const QString &sql, int offset, int count);
+    bool setWindowedQuery(const QString &sql, const QSqlDatabase &db);
+    bool fetchWindow(int row);
+    void clearWindow();
+    bool isWindowed() const { return !windowSql.isEmpty(); }
+
     mutable QSqlQuery query;
     mutable QSqlError error;
     QModelIndex bottom;
@@ -81,6 +88,14 @@ public:
     QVector<QHash<int, QVariant> > headers;
     QVarLengthArray<int, 56> colOffsets; // used to calculate indexInQuery of columns
     int nestedResetLevel;
+
+    // windowed mode: only the rows [windowStart, windowStart + windowRows)
+    // are kept, other rows are fetched again with windowStatement()
+    int windowSize;
+    QString windowSql;
+    QVector<QVariant> windowCache;
+    int windowStart;
+    int windowRows;
 };
 
 // helpers for building SQL expressions
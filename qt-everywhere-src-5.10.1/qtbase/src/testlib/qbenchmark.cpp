@@ -45,6 +45,9 @@
 #include <QtCore/qdir.h>
 #include <QtCore/qset.h>
 #include <QtCore/qdebug.h>
+#include <QtCore/qmath.h>
+
+#include <algorithm>
 
 QT_BEGIN_NAMESPACE
 
@@ -55,6 +58,7 @@ QBenchmarkGlobalData::QBenchmarkGlobalData()
     , walltimeMinimum(-1)
     , iterationCount(-1)
     , medianIterationCount(-1)
+    , warmupIterationCount(-1)
     , createChart(false)
     , verboseOutput(false)
     , minimumTotal(-1)
@@ -112,6 +116,72 @@ int QBenchmarkGlobalData::adjustMedianIterationCount()
     }
 }
 
+/*!
+    \internal
+    Returns the number of runs of a benchmark to discard before measuring.
+*/
+int QBenchmarkGlobalData::adjustWarmupIterationCount()
+{
+    if (warmupIterationCount != -1)
+        return warmupIterationCount;
+    return measurer->needsWarmupIteration() ? 1 : 0;
+}
+
+// Two-sided 95% quantiles of Student's t distribution
+static qreal tQuantile95(int degreesOfFreedom)
+{
+    static const qreal table[] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+    if (degreesOfFreedom < 1)
+        return 0;
+    if (degreesOfFreedom <= int(sizeof(table) / sizeof(table[0])))
+        return table[degreesOfFreedom - 1];
+    return 1.96;
+}
+
+// Linear interpolation between the closest ranks of the sorted \a samples
+static qreal percentile(const QVector<qreal> &samples, qreal p)
+{
+    const qreal rank = p * (samples.count() - 1);
+    const int lower = qFloor(rank);
+    const int upper = qMin(lower + 1, samples.count() - 1);
+    return samples.at(lower) + (rank - lower) * (samples.at(upper) - samples.at(lower));
+}
+
+QBenchmarkStatistics QBenchmarkStatistics::fromSamples(QVector<qreal> samples)
+{
+    QBenchmarkStatistics stats;
+    stats.count = samples.count();
+    if (samples.isEmpty()) {
+        stats.mean = stats.standardDeviation = stats.p50 = stats.p90 = stats.p99 = 0;
+        stats.confidenceLow = stats.confidenceHigh = 0;
+        return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    qreal sum = 0;
+    for (qreal sample : qAsConst(samples))
+        sum += sample;
+    stats.mean = sum / stats.count;
+
+    qreal squares = 0;
+    for (qreal sample : qAsConst(samples))
+        squares += (sample - stats.mean) * (sample - stats.mean);
+    stats.standardDeviation = stats.count > 1 ? qSqrt(squares / (stats.count - 1)) : 0;
+
+    stats.p50 = percentile(samples, 0.5);
+    stats.p90 = percentile(samples, 0.9);
+    stats.p99 = percentile(samples, 0.99);
+
+    const qreal margin = tQuantile95(stats.count - 1) * stats.standardDeviation / qSqrt(stats.count);
+    stats.confidenceLow = stats.mean - margin;
+    stats.confidenceHigh = stats.mean + margin;
+    return stats;
+}
+
 
 QBenchmarkTestMethodData *QBenchmarkTestMethodData::current;
 
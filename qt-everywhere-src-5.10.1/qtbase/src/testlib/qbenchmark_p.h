@@ -69,6 +69,7 @@
 
 #include <QtTest/private/qbenchmarkmeasurement_p.h>
 #include <QtCore/QMap>
+#include <QtCore/QVector>
 #include <QtTest/qtest_global.h>
 #ifdef QTESTLIB_USE_VALGRIND
 #include <QtTest/private/qbenchmarkvalgrind_p.h>
@@ -108,6 +109,7 @@ public:
     QTest::QBenchmarkMetric metric;
     bool setByMacro;
     bool valid;
+    QVector<qreal> samples; // value per iteration of every measured run
 
     QBenchmarkResult()
     : value(-1)
@@ -135,6 +137,24 @@ public:
 };
 Q_DECLARE_TYPEINFO(QBenchmarkResult, Q_MOVABLE_TYPE);
 
+/*
+    Summary statistics of the samples of a benchmark result.
+*/
+struct QBenchmarkStatistics
+{
+    int count;
+    qreal mean;
+    qreal standardDeviation;
+    qreal p50;
+    qreal p90;
+    qreal p99;
+    // 95% confidence interval of the mean
+    qreal confidenceLow;
+    qreal confidenceHigh;
+
+    static QBenchmarkStatistics fromSamples(QVector<qreal> samples);
+};
+
 /*
     The QBenchmarkGlobalData class stores global benchmark-related data.
     QBenchmarkGlobalData:current is created at the beginning of qExec()
@@ -152,12 +172,14 @@ public:
     Mode mode() const { return mode_; }
     QBenchmarkMeasurerBase *createMeasurer();
     int adjustMedianIterationCount();
+    int adjustWarmupIterationCount();
 
     QBenchmarkMeasurerBase *measurer;
     QBenchmarkContext context;
     int walltimeMinimum;
     int iterationCount;
     int medianIterationCount;
+    int warmupIterationCount;
     bool createChart;
     bool verboseOutput;
     QString callgrindOutFileBase;
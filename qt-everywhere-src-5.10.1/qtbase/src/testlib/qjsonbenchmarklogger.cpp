@@ -0,0 +1,145 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtTest module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qjsonbenchmarklogger_p.h"
+#include "qtestresult_p.h"
+#include "qbenchmark_p.h"
+
+#include <QtCore/qjsonarray.h>
+#include <QtCore/qjsondocument.h>
+#include <QtCore/qjsonobject.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    Writes the benchmark results as one JSON document:
+
+    { "testCase": "tst_Foo", "benchmarks": [ { "function": ..., "tag": ...,
+      "metric": ..., "iterations": ..., "value": ..., "samples": [ ... ],
+      "mean": ..., "stddev": ..., "p50": ..., "p90": ..., "p99": ...,
+      "ci95": [ low, high ] }, ... ] }
+
+    All figures are per iteration. "value" is the median that the other
+    loggers report, "samples" holds the result of every measured run
+    (see -median) and the statistics are computed from them.
+*/
+
+QJsonBenchmarkLogger::QJsonBenchmarkLogger(const char *filename)
+    : QAbstractTestLogger(filename)
+{
+}
+
+QJsonBenchmarkLogger::~QJsonBenchmarkLogger()
+{
+}
+
+void QJsonBenchmarkLogger::startLogging()
+{
+    // don't print anything
+}
+
+void QJsonBenchmarkLogger::stopLogging()
+{
+    // the document is written in one go, once it is complete
+    QJsonObject document;
+    document.insert(QStringLiteral("testCase"), QString::fromUtf8(QTestResult::currentTestObjectName()));
+    document.insert(QStringLiteral("benchmarks"), benchmarks);
+    outputString(QJsonDocument(document).toJson().constData());
+    QAbstractTestLogger::stopLogging();
+}
+
+void QJsonBenchmarkLogger::enterTestFunction(const char *)
+{
+    // don't print anything
+}
+
+void QJsonBenchmarkLogger::leaveTestFunction()
+{
+    // don't print anything
+}
+
+void QJsonBenchmarkLogger::addIncident(QAbstractTestLogger::IncidentTypes, const char *, const char *, int)
+{
+    // don't print anything
+}
+
+void QJsonBenchmarkLogger::addBenchmarkResult(const QBenchmarkResult &result)
+{
+    const char *fn = QTestResult::currentTestFunction() ? QTestResult::currentTestFunction()
+        : "UnknownTestFunc";
+    const char *tag = QTestResult::currentDataTag() ? QTestResult::currentDataTag() : "";
+    const char *gtag = QTestResult::currentGlobalDataTag()
+                     ? QTestResult::currentGlobalDataTag()
+                     : "";
+    const char *filler = (tag[0] && gtag[0]) ? ":" : "";
+
+    QVector<qreal> samples = result.samples;
+    if (samples.isEmpty())
+        samples.append(result.value / result.iterations);
+    const QBenchmarkStatistics stats = QBenchmarkStatistics::fromSamples(samples);
+
+    QJsonArray sampleArray;
+    for (qreal sample : qAsConst(samples))
+        sampleArray.append(sample);
+
+    QJsonObject object;
+    object.insert(QStringLiteral("function"), QString::fromUtf8(fn));
+    object.insert(QStringLiteral("tag"), QString::fromUtf8(gtag) + QLatin1String(filler)
+                                         + QString::fromUtf8(tag));
+    object.insert(QStringLiteral("metric"), QString::fromLatin1(QTest::benchmarkMetricName(result.metric)));
+    object.insert(QStringLiteral("iterations"), result.iterations);
+    object.insert(QStringLiteral("value"), result.value / result.iterations);
+    object.insert(QStringLiteral("samples"), sampleArray);
+    object.insert(QStringLiteral("mean"), stats.mean);
+    object.insert(QStringLiteral("stddev"), stats.standardDeviation);
+    object.insert(QStringLiteral("p50"), stats.p50);
+    object.insert(QStringLiteral("p90"), stats.p90);
+    object.insert(QStringLiteral("p99"), stats.p99);
+    object.insert(QStringLiteral("ci95"), QJsonArray() << stats.confidenceLow << stats.confidenceHigh);
+
+    benchmarks.append(object);
+}
+
+void QJsonBenchmarkLogger::addMessage(QAbstractTestLogger::MessageTypes, const QString &, const char *, int)
+{
+    // don't print anything
+}
+
+QT_END_NAMESPACE
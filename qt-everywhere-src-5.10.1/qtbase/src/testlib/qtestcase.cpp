@@ -512,6 +512,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, char *argv[], bool qml)
          "                       Valid formats are:\n"
          "                         txt      : Plain text\n"
          "                         csv      : CSV format (suitable for benchmarks)\n"
+         "                         json     : JSON document (benchmark statistics)\n"
          "                         xunitxml : XML XUnit document\n"
          "                         xml      : XML document\n"
          "                         lightxml : A stream of XML tags\n"
@@ -523,6 +524,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, char *argv[], bool qml)
          " -o filename         : Write the output into file\n"
          " -txt                : Output results in Plain Text\n"
          " -csv                : Output results in a CSV format (suitable for benchmarks)\n"
+         " -json               : Output benchmark statistics as JSON document\n"
          " -xunitxml           : Output results as XML XUnit document\n"
          " -xml                : Output results as XML document\n"
          " -lightxml           : Output results as stream of XML tags\n"
@@ -567,6 +569,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, char *argv[], bool qml)
          " -minimumtotal n     : Sets the minimum acceptable total for repeated executions of a test function\n"
          " -iterations  n      : Sets the number of accumulation iterations.\n"
          " -median  n          : Sets the number of median iterations.\n"
+         " -warmup  n          : Sets the number of runs to discard before measuring.\n"
          " -vb                 : Print out verbose benchmarking information.\n";
 
     for (int i = 1; i < argc; ++i) {
@@ -605,6 +608,8 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, char *argv[], bool qml)
             logFormat = QTestLog::Plain;
         } else if (strcmp(argv[i], "-csv") == 0) {
             logFormat = QTestLog::CSV;
+        } else if (strcmp(argv[i], "-json") == 0) {
+            logFormat = QTestLog::JSON;
         } else if (strcmp(argv[i], "-xunitxml") == 0) {
             logFormat = QTestLog::XunitXML;
         } else if (strcmp(argv[i], "-xml") == 0) {
@@ -639,6 +644,8 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, char *argv[], bool qml)
                     logFormat = QTestLog::Plain;
                 else if (strcmp(format, "csv") == 0)
                     logFormat = QTestLog::CSV;
+                else if (strcmp(format, "json") == 0)
+                    logFormat = QTestLog::JSON;
                 else if (strcmp(format, "lightxml") == 0)
                     logFormat = QTestLog::LightXML;
                 else if (strcmp(format, "xml") == 0)
@@ -648,7 +655,7 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, char *argv[], bool qml)
                 else if (strcmp(format, "teamcity") == 0)
                     logFormat = QTestLog::TeamCity;
                 else {
-                    fprintf(stderr, "output format must be one of txt, csv, lightxml, xml, teamcity or xunitxml\n");
+                    fprintf(stderr, "output format must be one of txt, csv, json, lightxml, xml, teamcity or xunitxml\n");
                     exit(1);
                 }
                 if (strcmp(filename, "-") == 0 && QTestLog::loggerUsingStdout()) {
@@ -759,6 +766,13 @@ Q_TESTLIB_EXPORT void qtest_qParseArgs(int argc, char *argv[], bool qml)
             } else {
                 QBenchmarkGlobalData::current->medianIterationCount = qToInt(argv[++i]);
             }
+        } else if (strcmp(argv[i], "-warmup") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "-warmup needs an extra parameter to indicate the number of warmup iterations\n");
+                exit(1);
+            } else {
+                QBenchmarkGlobalData::current->warmupIterationCount = qToInt(argv[++i]);
+            }
 
         } else if (strcmp(argv[i], "-vb") == 0) {
             QBenchmarkGlobalData::current->verboseOutput = true;
@@ -867,7 +881,8 @@ void TestMethods::invokeTestOnData(int index) const
     /* Benchmarking: for each median iteration*/
 
     bool isBenchmark = false;
-    int i = (QBenchmarkGlobalData::current->measurer->needsWarmupIteration()) ? -1 : 0;
+    // negative iterations are warmup iterations
+    int i = -QBenchmarkGlobalData::current->adjustWarmupIterationCount();
 
     QVector<QBenchmarkResult> results;
     bool minimumTotalReached = false;
@@ -915,11 +930,11 @@ void TestMethods::invokeTestOnData(int index) const
 
         QBenchmarkTestMethodData::current->endDataRun();
         if (!QTestResult::skipCurrentTest() && !QTestResult::currentTestFailed()) {
-            if (i > -1)  // iteration -1 is the warmup iteration.
+            if (i > -1)
                 results.append(QBenchmarkTestMethodData::current->result);
 
             if (isBenchmark && QBenchmarkGlobalData::current->verboseOutput) {
-                if (i == -1) {
+                if (i < 0) {
                     QTestLog::info(qPrintable(
                         QString::fromLatin1("warmup stage result      : %1")
                             .arg(QBenchmarkTestMethodData::current->result.value)), 0, 0);
@@ -947,8 +962,13 @@ void TestMethods::invokeTestOnData(int index) const
         bool testPassed = !QTestResult::skipCurrentTest() && !QTestResult::currentTestFailed();
         QTestResult::finishedCurrentTestDataCleanup();
         // Only report benchmark figures if the test passed
-        if (testPassed && QBenchmarkTestMethodData::current->resultsAccepted())
-            QTestLog::addBenchmarkResult(qMedian(results));
+        if (testPassed && QBenchmarkTestMethodData::current->resultsAccepted()) {
+            QBenchmarkResult median = qMedian(results);
+            median.samples.reserve(results.count());
+            for (const QBenchmarkResult &result : qAsConst(results))
+                median.samples.append(result.value / result.iterations);
+            QTestLog::addBenchmarkResult(median);
+        }
     }
 }
 
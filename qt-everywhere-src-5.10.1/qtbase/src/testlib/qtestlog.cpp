@@ -44,6 +44,7 @@
 #include <QtTest/private/qabstracttestlogger_p.h>
 #include <QtTest/private/qplaintestlogger_p.h>
 #include <QtTest/private/qcsvbenchmarklogger_p.h>
+#include <QtTest/private/qjsonbenchmarklogger_p.h>
 #include <QtTest/private/qxunittestlogger_p.h>
 #include <QtTest/private/qxmltestlogger_p.h>
 #include <QtTest/private/qteamcitylogger_p.h>
@@ -492,6 +493,9 @@ void QTestLog::addLogger(LogMode mode, const char *filename)
     case QTestLog::CSV:
         logger = new QCsvBenchmarkLogger(filename);
         break;
+    case QTestLog::JSON:
+        logger = new QJsonBenchmarkLogger(filename);
+        break;
     case QTestLog::XML:
         logger = new QXmlTestLogger(QXmlTestLogger::Complete, filename);
         break;
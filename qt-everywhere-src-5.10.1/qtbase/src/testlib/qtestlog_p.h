@@ -62,7 +62,7 @@ class Q_TESTLIB_EXPORT QTestLog
 {
 public:
     enum LogMode {
-        Plain = 0, XML, LightXML, XunitXML, CSV, TeamCity,
+        Plain = 0, XML, LightXML, XunitXML, CSV, TeamCity, JSON,
 #if defined(HAVE_XCTEST)
         XCTest
 #endif
@@ -57,6 +57,7 @@ SOURCES = qtestcase.cpp \
     qbenchmarkperfevents.cpp \
     qbenchmarkmetric.cpp \
     qcsvbenchmarklogger.cpp \
+    qjsonbenchmarklogger.cpp \
     qteamcitylogger.cpp \
     qtestelement.cpp \
     qtestelementattribute.cpp \
@@ -337,7 +337,21 @@ void Generator::generateCode()
 // build the data array
 //
 
+    QVector<QByteArray> methodNames;
+    for (const QVector<FunctionDef> *list : { &cdef->signalList, &cdef->slotList, &cdef->methodList }) {
+        for (const FunctionDef &f : *list)
+            methodNames.append(f.name);
+    }
+    QVector<QByteArray> propertyNames;
+    for (const PropertyDef &p : qAsConst(cdef->propertyList))
+        propertyNames.append(p.name);
+    const QVector<uint> methodNameTable = nameLookupTable(methodNames);
+    const QVector<uint> propertyNameTable = nameLookupTable(propertyNames);
+    const bool hasNameLookupTables = !methodNameTable.isEmpty() || !propertyNameTable.isEmpty();
+
     int index = MetaObjectPrivateFieldCount;
+    if (hasNameLookupTables)
+        index += 2 + methodNameTable.count() + propertyNameTable.count();
     fprintf(out, "static const uint qt_meta_data_%s[] = {\n", qualifiedClassNameIdentifier.constData());
     fprintf(out, "\n // content:\n");
     fprintf(out, "    %4d,       // revision\n", int(QMetaObjectPrivate::OutputRevision));
@@ -379,9 +393,19 @@ void Generator::generateCode()
         // by qdbusxml2cpp which generate code that require that we call qt_metacall for properties
         flags |= PropertyAccessInStaticMetaCall;
     }
+    if (hasNameLookupTables)
+        flags |= HasNameLookupTables;
     fprintf(out, "    %4d,       // flags\n", flags);
     fprintf(out, "    %4d,       // signalCount\n", cdef->signalList.count());
 
+//
+// Build name lookup tables
+//
+    if (hasNameLookupTables) {
+        generateNameLookupTable(methodNameTable, "method");
+        generateNameLookupTable(propertyNameTable, "property");
+    }
+
 
 //
 // Build classinfo array
@@ -628,6 +652,44 @@ void Generator::registerClassInfoStrings()
     }
 }
 
+/*
+    Builds the hash table QMetaObject uses to look up \a names, see
+    qMetaObjectNameHash(). Returns an empty table if there are too few names
+    for it to be worth it.
+*/
+QVector<uint> Generator::nameLookupTable(const QVector<QByteArray> &names)
+{
+    QVector<uint> table;
+    if (names.count() < MetaObjectNameTableMinimumCount)
+        return table;
+
+    int size = 1;
+    while (size < 2 * names.count())
+        size <<= 1;
+    table.fill(0, size);
+    const uint mask = uint(size - 1);
+    for (int i = 0; i < names.count(); ++i) {
+        const QByteArray &name = names.at(i);
+        uint slot = qMetaObjectNameHash(name.constData(), name.size()) & mask;
+        while (table.at(slot))
+            slot = (slot + 1) & mask;
+        table[slot] = uint(i + 1);
+    }
+    return table;
+}
+
+void Generator::generateNameLookupTable(const QVector<uint> &table, const char *kind)
+{
+    fprintf(out, "\n // %s name lookup table: size, slots\n", kind);
+    fprintf(out, "    %4d,\n", table.count());
+    for (int i = 0; i < table.count(); i += 8) {
+        fprintf(out, "   ");
+        for (int j = i; j < qMin(i + 8, table.count()); ++j)
+            fprintf(out, " %4u,", table.at(j));
+        fprintf(out, "\n");
+    }
+}
+
 void Generator::generateClassInfos()
 {
     if (cdef->classInfoList.isEmpty())
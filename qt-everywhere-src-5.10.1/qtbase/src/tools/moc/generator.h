@@ -43,6 +43,8 @@ public:
     void generateCode();
 private:
     bool registerableMetaType(const QByteArray &propertyType);
+    static QVector<uint> nameLookupTable(const QVector<QByteArray> &names);
+    void generateNameLookupTable(const QVector<uint> &table, const char *kind);
     void registerClassInfoStrings();
     void generateClassInfos();
     void registerFunctionStrings(const QVector<FunctionDef> &list);
@@ -136,6 +136,9 @@ int runRcc(int argc, char *argv[])
     QCommandLineOption thresholdOption(QStringLiteral("threshold"), QStringLiteral("Threshold to consider compressing files."), QStringLiteral("level"));
     parser.addOption(thresholdOption);
 
+    QCommandLineOption chunkSizeOption(QStringLiteral("chunk-size"), QStringLiteral("Compress files larger than <bytes> in blocks of that size, which can be read without uncompressing the whole file. Requires Qt 5.11 to read."), QStringLiteral("bytes"));
+    parser.addOption(chunkSizeOption);
+
     QCommandLineOption binaryOption(QStringLiteral("binary"), QStringLiteral("Output a binary file for use as a dynamic resource."));
     parser.addOption(binaryOption);
 
@@ -191,6 +194,12 @@ int runRcc(int argc, char *argv[])
         library.setCompressLevel(-2);
     if (parser.isSet(thresholdOption))
         library.setCompressThreshold(parser.value(thresholdOption).toInt());
+    if (parser.isSet(chunkSizeOption)) {
+        const int chunkSize = parser.value(chunkSizeOption).toInt();
+        if (chunkSize <= 0)
+            errorMsg = QLatin1String("Chunk size must be a positive number");
+        library.setCompressChunkSize(chunkSize);
+    }
     if (parser.isSet(binaryOption))
         library.setFormat(RCCResourceLibrary::Binary);
     if (parser.isSet(passOption)) {
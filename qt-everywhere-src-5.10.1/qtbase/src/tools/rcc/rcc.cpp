@@ -33,6 +33,7 @@
 #include <qdebug.h>
 #include <qdir.h>
 #include <qdiriterator.h>
+#include <qendian.h>
 #include <qfile.h>
 #include <qiodevice.h>
 #include <qlocale.h>
@@ -90,7 +91,8 @@ public:
     {
         NoFlags = 0x00,
         Compressed = 0x01,
-        Directory = 0x02
+        Directory = 0x02,
+        CompressedChunks = 0x04
     };
 
     RCCFileInfo(const QString &name = QString(), const QFileInfo &fileInfo = QFileInfo(),
@@ -213,6 +215,44 @@ void RCCFileInfo::writeDataInfo(RCCResourceLibrary &lib)
     }
 }
 
+#ifndef QT_NO_COMPRESS
+static void appendNumber4(QByteArray &data, quint32 number)
+{
+    const quint32 bigEndian = qToBigEndian(number);
+    data.append(reinterpret_cast<const char *>(&bigEndian), sizeof bigEndian);
+}
+
+/*
+    Compresses \a data in blocks of \a chunkSize bytes each, so that QResource
+    can uncompress only the blocks that are read. The result starts with:
+
+        quint32 uncompressed size
+        quint32 chunk size
+        quint32 number of chunks
+        quint32 offset of each chunk and of the end of the last one, relative
+                to the end of this table
+
+    followed by the chunks, each in the format produced by qCompress().
+*/
+static QByteArray compressChunks(const QByteArray &data, int chunkSize, int compressLevel)
+{
+    const int chunkCount = (data.size() + chunkSize - 1) / chunkSize;
+    QByteArray chunks;
+    QByteArray result;
+    appendNumber4(result, data.size());
+    appendNumber4(result, chunkSize);
+    appendNumber4(result, chunkCount);
+    for (int i = 0; i < chunkCount; ++i) {
+        appendNumber4(result, chunks.size());
+        const int size = qMin(chunkSize, data.size() - i * chunkSize);
+        chunks += qCompress(reinterpret_cast<const uchar *>(data.constData()) + i * chunkSize,
+                            size, compressLevel);
+    }
+    appendNumber4(result, chunks.size());
+    return result + chunks;
+}
+#endif // QT_NO_COMPRESS
+
 qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib, qint64 offset,
     QString *errorMessage)
 {
@@ -235,13 +275,15 @@ qint64 RCCFileInfo::writeDataBlob(RCCResourceLibrary &lib, qint64 offset,
 #ifndef QT_NO_COMPRESS
     // Check if compression is useful for this file
     if (m_compressLevel != 0 && data.size() != 0) {
-        QByteArray compressed =
-            qCompress(reinterpret_cast<uchar *>(data.data()), data.size(), m_compressLevel);
+        const bool chunked = lib.m_compressChunkSize > 0 && data.size() > lib.m_compressChunkSize;
+        QByteArray compressed = chunked
+            ? compressChunks(data, lib.m_compressChunkSize, m_compressLevel)
+            : qCompress(reinterpret_cast<uchar *>(data.data()), data.size(), m_compressLevel);
 
         int compressRatio = int(100.0 * (data.size() - compressed.size()) / data.size());
         if (compressRatio >= m_compressThreshold) {
             data = compressed;
-            m_flags |= Compressed;
+            m_flags |= chunked ? CompressedChunks : Compressed;
         }
     }
 #endif // QT_NO_COMPRESS
@@ -349,6 +391,7 @@ RCCResourceLibrary::RCCResourceLibrary(quint8 formatVersion)
     m_verbose(false),
     m_compressLevel(CONSTANT_COMPRESSLEVEL_DEFAULT),
     m_compressThreshold(CONSTANT_COMPRESSTHRESHOLD_DEFAULT),
+    m_compressChunkSize(0),
     m_treeOffset(0),
     m_namesOffset(0),
     m_dataOffset(0),
@@ -83,6 +83,9 @@ public:
     void setCompressThreshold(int t) { m_compressThreshold = t; }
     int compressThreshold() const { return m_compressThreshold; }
 
+    void setCompressChunkSize(int size) { m_compressChunkSize = size; }
+    int compressChunkSize() const { return m_compressChunkSize; }
+
     void setResourceRoot(const QString &root) { m_resourceRoot = root; }
     QString resourceRoot() const { return m_resourceRoot; }
 
@@ -135,6 +138,7 @@ private:
     bool m_verbose;
     int m_compressLevel;
     int m_compressThreshold;
+    int m_compressChunkSize;
     int m_treeOffset;
     int m_namesOffset;
     int m_dataOffset;
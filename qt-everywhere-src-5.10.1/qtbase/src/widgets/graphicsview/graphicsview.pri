@@ -15,10 +15,12 @@ HEADERS += graphicsview/qgraphicsgridlayout.h \
     graphicsview/qgraphicsscene.h \
     graphicsview/qgraphicsscene_bsp_p.h \
     graphicsview/qgraphicsscene_p.h \
+    graphicsview/qgraphicsscene_quadtree_p.h \
     graphicsview/qgraphicsscenebsptreeindex_p.h \
     graphicsview/qgraphicssceneevent.h \
     graphicsview/qgraphicssceneindex_p.h \
     graphicsview/qgraphicsscenelinearindex_p.h \
+    graphicsview/qgraphicsscenequadtreeindex_p.h \
     graphicsview/qgraphicstransform.h \
     graphicsview/qgraphicstransform_p.h \
     graphicsview/qgraphicsview.h \
@@ -42,10 +44,12 @@ SOURCES += graphicsview/qgraphicsgridlayout.cpp \
     graphicsview/qgraphicsproxywidget.cpp \
     graphicsview/qgraphicsscene.cpp \
     graphicsview/qgraphicsscene_bsp.cpp \
+    graphicsview/qgraphicsscene_quadtree.cpp \
     graphicsview/qgraphicsscenebsptreeindex.cpp \
     graphicsview/qgraphicssceneevent.cpp \
     graphicsview/qgraphicssceneindex.cpp \
     graphicsview/qgraphicsscenelinearindex.cpp \
+    graphicsview/qgraphicsscenequadtreeindex.cpp \
     graphicsview/qgraphicstransform.cpp \
     graphicsview/qgraphicsview.cpp \
     graphicsview/qgraphicswidget.cpp \
@@ -466,6 +466,7 @@ private:
     friend class QGraphicsScenePrivate;
     friend class QGraphicsSceneFindItemBspTreeVisitor;
     friend class QGraphicsSceneBspTree;
+    friend class QGraphicsSceneQuadTree;
     friend class QGraphicsView;
     friend class QGraphicsViewPrivate;
     friend class QGraphicsObject;
@@ -476,6 +477,8 @@ private:
     friend class QGraphicsSceneIndexPrivate;
     friend class QGraphicsSceneBspTreeIndex;
     friend class QGraphicsSceneBspTreeIndexPrivate;
+    friend class QGraphicsSceneQuadTreeIndex;
+    friend class QGraphicsSceneQuadTreeIndexPrivate;
     friend class QGraphicsItemEffectSourcePrivate;
     friend class QGraphicsTransformPrivate;
 #ifndef QT_NO_GESTURES
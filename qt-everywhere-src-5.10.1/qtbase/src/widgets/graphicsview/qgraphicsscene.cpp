@@ -193,6 +193,12 @@
     removing items is logarithmic. This approach is best for static scenes
     (i.e., scenes where most items do not move).
 
+    \value QuadTreeIndex A loose quadtree is applied. Item location is of an
+    order close to logarithmic complexity, as with BspTreeIndex, but moving
+    items only updates the parts of the tree they move through, and the tree
+    is never rebuilt. This approach is best for scenes with many items that
+    move continuously. This value has been added in Qt 5.11.
+
     \value NoIndex No index is applied. Item location is of linear complexity,
     as all items on the scene are searched. Adding, moving and removing items,
     however, is done in constant time. This approach is ideal for dynamic
@@ -215,6 +221,7 @@
 #include "qgraphicssceneindex_p.h"
 #include "qgraphicsscenebsptreeindex_p.h"
 #include "qgraphicsscenelinearindex_p.h"
+#include "qgraphicsscenequadtreeindex_p.h"
 
 #include <QtCore/qdebug.h>
 #include <QtCore/qlist.h>
@@ -1844,7 +1851,9 @@ void QGraphicsScene::render(QPainter *painter, const QRectF &target, const QRect
 
     For the common case, the default index method BspTreeIndex works fine.  If
     your scene uses many animations and you are experiencing slowness, you can
-    disable indexing by calling \c setItemIndexMethod(NoIndex).
+    switch to an index that is cheaper to update by calling
+    \c setItemIndexMethod(QuadTreeIndex), or disable indexing by calling
+    \c setItemIndexMethod(NoIndex).
 
     \sa bspTreeDepth
 */
@@ -1865,6 +1874,8 @@ void QGraphicsScene::setItemIndexMethod(ItemIndexMethod method)
     delete d->index;
     if (method == BspTreeIndex)
         d->index = new QGraphicsSceneBspTreeIndex(this);
+    else if (method == QuadTreeIndex)
+        d->index = new QGraphicsSceneQuadTreeIndex(this);
     else
         d->index = new QGraphicsSceneLinearIndex(this);
     for (int i = oldItems.size() - 1; i >= 0; --i)
@@ -1876,7 +1887,7 @@ void QGraphicsScene::setItemIndexMethod(ItemIndexMethod method)
     \brief the depth of QGraphicsScene's BSP index tree
     \since 4.3
 
-    This property has no effect when NoIndex is used.
+    This property has no effect unless BspTreeIndex is used.
 
     This value determines the depth of QGraphicsScene's BSP tree. The depth
     directly affects QGraphicsScene's performance and memory usage; the latter
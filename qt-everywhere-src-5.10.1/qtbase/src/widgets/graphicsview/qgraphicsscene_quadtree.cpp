@@ -0,0 +1,358 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWidgets module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qgraphicsscene_quadtree_p.h"
+
+#include <QtCore/qvarlengtharray.h>
+#include <private/qgraphicsitem_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    A loose quadtree: every item is stored in exactly one node, the deepest
+    one whose loose bounds (the node's cell grown to twice its size) contain
+    the item's bounding rect. Because the cells overlap, an item that moves
+    a little usually stays in its node, and moving an item only touches the
+    nodes it leaves and enters. Nodes are split once they hold more than
+    SplitThreshold items, and the root grows when an item is added outside
+    of it, so the tree never has to be rebuilt.
+*/
+
+static inline bool fitsLoosely(const QPointF &center, qreal halfSize, const QRectF &rect)
+{
+    const qreal extent = 2 * halfSize;
+    return rect.left() >= center.x() - extent && rect.right() <= center.x() + extent
+        && rect.top() >= center.y() - extent && rect.bottom() <= center.y() + extent;
+}
+
+// Like QRectF::intersects(), but for normalized rects including their edges,
+// so that empty item rects and point queries are found as well.
+static inline bool intersectsClosed(const QRectF &r1, const QRectF &r2)
+{
+    return r1.left() <= r2.right() && r2.left() <= r1.right()
+        && r1.top() <= r2.bottom() && r2.top() <= r1.bottom();
+}
+
+static inline bool isFinite(const QRectF &rect)
+{
+    return qIsFinite(rect.x()) && qIsFinite(rect.y())
+        && qIsFinite(rect.width()) && qIsFinite(rect.height());
+}
+
+static inline int quadrant(const QPointF &center, const QPointF &point)
+{
+    return (point.x() < center.x() ? 0 : 1) | (point.y() < center.y() ? 0 : 2);
+}
+
+static inline QPointF quadrantCenter(const QPointF &center, qreal halfSize, int quadrant)
+{
+    const qreal offset = halfSize / 2;
+    return QPointF(center.x() + ((quadrant & 1) ? offset : -offset),
+                   center.y() + ((quadrant & 2) ? offset : -offset));
+}
+
+QGraphicsSceneQuadTree::QGraphicsSceneQuadTree()
+    : root(-1)
+{
+}
+
+/*
+    Sets the rect used for the root cell once the first item is inserted.
+    It is only a hint; items outside of it make the tree grow.
+*/
+void QGraphicsSceneQuadTree::initialize(const QRectF &rect)
+{
+    this->rect = rect.normalized();
+}
+
+void QGraphicsSceneQuadTree::clear()
+{
+    nodes.clear();
+    itemNodes.clear();
+    root = -1;
+}
+
+void QGraphicsSceneQuadTree::insertItem(QGraphicsItem *item, const QRectF &rect)
+{
+    Q_ASSERT(!itemNodes.contains(item));
+    const QRectF itemRect = rect.normalized();
+
+    if (root == -1) {
+        const QRectF bounds = this->rect.isValid() ? this->rect : itemRect;
+        qreal halfSize = qMax(bounds.width(), bounds.height()) / 2;
+        if (!(halfSize > 0) || !isFinite(bounds))
+            halfSize = 1;
+        root = createNode(isFinite(bounds) ? bounds.center() : QPointF(), halfSize, 0, -1);
+    }
+
+    if (!isFinite(itemRect)) {
+        appendEntry(root, item, itemRect);
+        return;
+    }
+
+    while (!fitsLoosely(nodes.at(root).center, nodes.at(root).halfSize, itemRect))
+        growRoot(itemRect.center());
+    appendEntry(findNode(root, itemRect), item, itemRect);
+}
+
+/*
+    Moves \a item to the node that fits its new bounding \a rect, starting
+    the search from the node the item is currently stored in.
+*/
+void QGraphicsSceneQuadTree::updateItem(QGraphicsItem *item, const QRectF &rect)
+{
+    QHash<QGraphicsItem *, int>::const_iterator it = itemNodes.constFind(item);
+    if (it == itemNodes.constEnd()) {
+        insertItem(item, rect);
+        return;
+    }
+
+    const QRectF itemRect = rect.normalized();
+    int index = it.value();
+    if (!isFinite(itemRect)) {
+        removeItem(item);
+        insertItem(item, itemRect);
+        return;
+    }
+
+    if (fitsLoosely(nodes.at(index).center, nodes.at(index).halfSize, itemRect)) {
+        const int child = nodes.at(index).split ? childIndex(index, itemRect) : -1;
+        if (child == -1) {
+            // Common case: the item still belongs to the same node.
+            QVector<Entry> &entries = nodes[index].entries;
+            for (int i = 0; i < entries.size(); ++i) {
+                if (entries.at(i).item == item) {
+                    entries[i].rect = itemRect;
+                    break;
+                }
+            }
+            return;
+        }
+        takeEntry(index, item);
+        appendEntry(findNode(child, itemRect), item, itemRect);
+        return;
+    }
+
+    takeEntry(index, item);
+    while (nodes.at(index).parent != -1
+           && !fitsLoosely(nodes.at(index).center, nodes.at(index).halfSize, itemRect)) {
+        index = nodes.at(index).parent;
+    }
+    if (index == root) {
+        while (!fitsLoosely(nodes.at(root).center, nodes.at(root).halfSize, itemRect))
+            growRoot(itemRect.center());
+        index = root;
+    }
+    appendEntry(findNode(index, itemRect), item, itemRect);
+}
+
+bool QGraphicsSceneQuadTree::removeItem(QGraphicsItem *item)
+{
+    QHash<QGraphicsItem *, int>::iterator it = itemNodes.find(item);
+    if (it == itemNodes.end())
+        return false;
+    takeEntry(it.value(), item);
+    itemNodes.erase(it);
+    return true;
+}
+
+QList<QGraphicsItem *> QGraphicsSceneQuadTree::items(const QRectF &rect, bool onlyTopLevelItems) const
+{
+    QList<QGraphicsItem *> foundItems;
+    if (root == -1)
+        return foundItems;
+
+    const QRectF searchRect = rect.normalized();
+    QVarLengthArray<int, 64> stack;
+    stack.append(root);
+    while (!stack.isEmpty()) {
+        const Node &node = nodes.at(stack.last());
+        stack.removeLast();
+
+        const qreal extent = 2 * node.halfSize;
+        const QRectF looseBounds(node.center.x() - extent, node.center.y() - extent,
+                                 2 * extent, 2 * extent);
+        if (!intersectsClosed(looseBounds, searchRect))
+            continue;
+
+        for (const Entry &entry : node.entries) {
+            if (!intersectsClosed(entry.rect, searchRect))
+                continue;
+            QGraphicsItem *item = entry.item;
+            if (onlyTopLevelItems) {
+                if (item->d_ptr->parent)
+                    item = item->topLevelItem();
+                if (!item->d_func()->itemDiscovered && item->d_ptr->visible) {
+                    item->d_func()->itemDiscovered = 1;
+                    foundItems << item;
+                }
+            } else if (item->d_ptr->visible) {
+                foundItems << item;
+            }
+        }
+
+        if (node.split) {
+            for (int child : node.children) {
+                if (child != -1)
+                    stack.append(child);
+            }
+        }
+    }
+
+    if (onlyTopLevelItems) {
+        // Reset discovery bits.
+        for (int i = 0; i < foundItems.size(); ++i)
+            foundItems.at(i)->d_ptr->itemDiscovered = 0;
+    }
+    return foundItems;
+}
+
+int QGraphicsSceneQuadTree::createNode(const QPointF &center, qreal halfSize, int depth, int parent)
+{
+    Node node;
+    node.center = center;
+    node.halfSize = halfSize;
+    node.depth = depth;
+    node.parent = parent;
+    node.children[0] = node.children[1] = node.children[2] = node.children[3] = -1;
+    node.split = false;
+    nodes.append(node);
+    return nodes.size() - 1;
+}
+
+/*
+    Returns the child of the node at \a index that \a rect fits into,
+    creating it if needed, or -1 if the rect is too large for the children.
+*/
+int QGraphicsSceneQuadTree::childIndex(int index, const QRectF &rect)
+{
+    const Node &node = nodes.at(index);
+    const qreal childHalfSize = node.halfSize / 2;
+    if (qMax(rect.width(), rect.height()) / 2 > childHalfSize)
+        return -1;
+
+    // A former root keeps its own center, which may differ from the computed
+    // one by rounding errors, so use it when the child exists.
+    const int q = quadrant(node.center, rect.center());
+    int child = node.children[q];
+    const QPointF childCenter = child != -1 ? nodes.at(child).center
+                                            : quadrantCenter(node.center, node.halfSize, q);
+    if (!fitsLoosely(childCenter, childHalfSize, rect))
+        return -1;
+
+    if (child == -1) {
+        const int depth = node.depth + 1;
+        child = createNode(childCenter, childHalfSize, depth, index);
+        nodes[index].children[q] = child;
+    }
+    return child;
+}
+
+/*
+    Replaces the root by one twice its size that has the old root as one of
+    its quadrants, extending the tree in the direction of \a towards.
+*/
+void QGraphicsSceneQuadTree::growRoot(const QPointF &towards)
+{
+    const int oldRoot = root;
+    const QPointF center = nodes.at(oldRoot).center;
+    const qreal halfSize = nodes.at(oldRoot).halfSize;
+    const QPointF newCenter(towards.x() < center.x() ? center.x() - halfSize : center.x() + halfSize,
+                            towards.y() < center.y() ? center.y() - halfSize : center.y() + halfSize);
+
+    root = createNode(newCenter, 2 * halfSize, nodes.at(oldRoot).depth - 1, -1);
+    nodes[root].split = true;
+    nodes[root].children[quadrant(newCenter, center)] = oldRoot;
+    nodes[oldRoot].parent = root;
+}
+
+int QGraphicsSceneQuadTree::findNode(int index, const QRectF &rect)
+{
+    while (nodes.at(index).split) {
+        const int child = childIndex(index, rect);
+        if (child == -1)
+            break;
+        index = child;
+    }
+    return index;
+}
+
+void QGraphicsSceneQuadTree::appendEntry(int index, QGraphicsItem *item, const QRectF &rect)
+{
+    const Entry entry = { item, rect };
+    nodes[index].entries.append(entry);
+    itemNodes.insert(item, index);
+
+    const Node &node = nodes.at(index);
+    if (!node.split && node.entries.size() > SplitThreshold && node.depth < MaxDepth)
+        splitNode(index);
+}
+
+void QGraphicsSceneQuadTree::splitNode(int index)
+{
+    nodes[index].split = true;
+
+    const QVector<Entry> entries = nodes.at(index).entries;
+    QVector<Entry> remaining;
+    for (const Entry &entry : entries) {
+        const int child = childIndex(index, entry.rect);
+        if (child == -1)
+            remaining.append(entry);
+        else
+            appendEntry(child, entry.item, entry.rect);
+    }
+    nodes[index].entries = remaining;
+}
+
+bool QGraphicsSceneQuadTree::takeEntry(int index, QGraphicsItem *item)
+{
+    QVector<Entry> &entries = nodes[index].entries;
+    for (int i = 0; i < entries.size(); ++i) {
+        if (entries.at(i).item == item) {
+            // The order of the entries doesn't matter.
+            if (i != entries.size() - 1)
+                entries[i] = entries.last();
+            entries.removeLast();
+            return true;
+        }
+    }
+    return false;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,123 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWidgets module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QGRAPHICSSCENEQUADTREE_P_H
+#define QGRAPHICSSCENEQUADTREE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtWidgets/private/qtwidgetsglobal_p.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qrect.h>
+#include <QtCore/qvector.h>
+
+QT_REQUIRE_CONFIG(graphicsview);
+
+QT_BEGIN_NAMESPACE
+
+class QGraphicsItem;
+
+class QGraphicsSceneQuadTree
+{
+public:
+    QGraphicsSceneQuadTree();
+
+    void initialize(const QRectF &rect);
+    void clear();
+
+    void insertItem(QGraphicsItem *item, const QRectF &rect);
+    void updateItem(QGraphicsItem *item, const QRectF &rect);
+    bool removeItem(QGraphicsItem *item);
+
+    QList<QGraphicsItem *> items(const QRectF &rect, bool onlyTopLevelItems = false) const;
+    int nodeCount() const { return nodes.size(); }
+
+    struct Entry
+    {
+        QGraphicsItem *item;
+        QRectF rect;
+    };
+
+    struct Node
+    {
+        QPointF center;
+        qreal halfSize;
+        int depth;
+        int parent;
+        int children[4];
+        bool split;
+        QVector<Entry> entries;
+    };
+
+private:
+    enum {
+        SplitThreshold = 16,
+        MaxDepth = 24
+    };
+
+    int createNode(const QPointF &center, qreal halfSize, int depth, int parent);
+    int childIndex(int index, const QRectF &rect);
+    void growRoot(const QPointF &towards);
+    int findNode(int index, const QRectF &rect);
+    void appendEntry(int index, QGraphicsItem *item, const QRectF &rect);
+    void splitNode(int index);
+    bool takeEntry(int index, QGraphicsItem *item);
+
+    QVector<Node> nodes;
+    QHash<QGraphicsItem *, int> itemNodes;
+    QRectF rect;
+    int root;
+};
+
+Q_DECLARE_TYPEINFO(QGraphicsSceneQuadTree::Entry, Q_PRIMITIVE_TYPE);
+Q_DECLARE_TYPEINFO(QGraphicsSceneQuadTree::Node, Q_MOVABLE_TYPE);
+
+QT_END_NAMESPACE
+
+#endif // QGRAPHICSSCENEQUADTREE_P_H
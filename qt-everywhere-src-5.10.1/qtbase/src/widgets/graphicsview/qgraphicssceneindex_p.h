@@ -114,6 +114,7 @@ protected:
     friend class QGraphicsItem;
     friend class QGraphicsItemPrivate;
     friend class QGraphicsSceneBspTreeIndex;
+    friend class QGraphicsSceneQuadTreeIndex;
 private:
     Q_DISABLE_COPY(QGraphicsSceneIndex)
     Q_DECLARE_PRIVATE(QGraphicsSceneIndex)
@@ -0,0 +1,396 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWidgets module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+/*!
+    \class QGraphicsSceneQuadTreeIndex
+    \brief The QGraphicsSceneQuadTreeIndex class provides an implementation of
+    a loose quadtree indexing algorithm for discovering items in QGraphicsScene.
+    \since 5.11
+    \ingroup graphicsview-api
+
+    \internal
+
+    QGraphicsSceneQuadTreeIndex keeps every item in one node of a loose
+    quadtree. Unlike QGraphicsSceneBspTreeIndex, it never rebuilds the tree:
+    when an item moves, it is refitted starting from the node it is stored
+    in, which usually leaves it where it is. The tree also grows on its own
+    when items leave the scene rect. This makes it well suited for scenes
+    where a large number of items move continuously.
+
+    \sa QGraphicsScene, QGraphicsView, QGraphicsSceneIndex, QGraphicsSceneBspTreeIndex
+*/
+
+#include <QtCore/qglobal.h>
+
+#include <private/qgraphicsscene_p.h>
+#include <private/qgraphicsscenebsptreeindex_p.h>
+#include <private/qgraphicsscenequadtreeindex_p.h>
+#include <private/qgraphicssceneindex_p.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+QGraphicsSceneQuadTreeIndexPrivate::QGraphicsSceneQuadTreeIndexPrivate(QGraphicsScene *scene)
+    : QGraphicsSceneIndexPrivate(scene)
+{
+}
+
+/*!
+    \internal
+
+    Refits the items that moved since the last update and adds the pending
+    items to the tree. Like QGraphicsSceneBspTreeIndex, adding is delayed
+    because items are not completely constructed when they are added.
+*/
+void QGraphicsSceneQuadTreeIndexPrivate::updateIndex()
+{
+    indexTimer.stop();
+
+    for (QGraphicsItem *item : qAsConst(movedItems))
+        tree.updateItem(item, item->d_ptr->sceneEffectiveBoundingRect());
+    movedItems.clear();
+
+    for (int i = 0; i < unindexedItems.size(); ++i) {
+        QGraphicsItem *item = unindexedItems.at(i);
+        Q_ASSERT(!item->d_ptr->itemDiscovered);
+        if (!freeItemIndexes.isEmpty()) {
+            int freeIndex = freeItemIndexes.takeLast();
+            item->d_func()->index = freeIndex;
+            indexedItems[freeIndex] = item;
+        } else {
+            item->d_func()->index = indexedItems.size();
+            indexedItems << item;
+        }
+
+        if (item->d_ptr->itemIsUntransformable())
+            untransformableItems << item;
+        else if (isInTree(item))
+            tree.insertItem(item, item->d_ptr->sceneEffectiveBoundingRect());
+    }
+    unindexedItems.clear();
+}
+
+void QGraphicsSceneQuadTreeIndexPrivate::startIndexTimer()
+{
+    Q_Q(QGraphicsSceneQuadTreeIndex);
+    if (!indexTimer.isActive())
+        indexTimer.start(0, q);
+}
+
+void QGraphicsSceneQuadTreeIndexPrivate::addItem(QGraphicsItem *item, bool recursive)
+{
+    if (!item)
+        return;
+
+    if (item->d_ptr->index == -1) {
+        Q_ASSERT(!unindexedItems.contains(item));
+        unindexedItems << item;
+        startIndexTimer();
+    } else {
+        Q_ASSERT(indexedItems.contains(item));
+        qWarning("QGraphicsSceneQuadTreeIndex::addItem: item has already been added to this index");
+    }
+
+    if (recursive) {
+        for (int i = 0; i < item->d_ptr->children.size(); ++i)
+            addItem(item->d_ptr->children.at(i), recursive);
+    }
+}
+
+void QGraphicsSceneQuadTreeIndexPrivate::removeItem(QGraphicsItem *item, bool recursive,
+                                                    bool moveToUnindexedItems)
+{
+    if (!item)
+        return;
+
+    if (item->d_ptr->index != -1) {
+        Q_ASSERT(item->d_ptr->index < indexedItems.size());
+        Q_ASSERT(indexedItems.at(item->d_ptr->index) == item);
+        Q_ASSERT(!item->d_ptr->itemDiscovered);
+        freeItemIndexes << item->d_ptr->index;
+        indexedItems[item->d_ptr->index] = 0;
+        item->d_ptr->index = -1;
+
+        // The tree knows where the item is stored, so this does not call
+        // any virtual functions and is safe from the item's destructor.
+        if (!tree.removeItem(item))
+            untransformableItems.removeOne(item);
+        movedItems.remove(item);
+    } else {
+        unindexedItems.removeOne(item);
+    }
+
+    Q_ASSERT(item->d_ptr->index == -1);
+    Q_ASSERT(!indexedItems.contains(item));
+    Q_ASSERT(!unindexedItems.contains(item));
+    Q_ASSERT(!untransformableItems.contains(item));
+
+    if (moveToUnindexedItems)
+        addItem(item);
+
+    if (recursive) {
+        for (int i = 0; i < item->d_ptr->children.size(); ++i)
+            removeItem(item->d_ptr->children.at(i), recursive, moveToUnindexedItems);
+    }
+}
+
+QList<QGraphicsItem *> QGraphicsSceneQuadTreeIndexPrivate::estimateItems(const QRectF &rect, Qt::SortOrder order,
+                                                                         bool onlyTopLevelItems)
+{
+    Q_Q(QGraphicsSceneQuadTreeIndex);
+    if (onlyTopLevelItems && rect.isNull())
+        return q->QGraphicsSceneIndex::estimateTopLevelItems(rect, order);
+
+    updateIndex();
+
+    QList<QGraphicsItem *> rectItems = tree.items(rect, onlyTopLevelItems);
+    if (onlyTopLevelItems) {
+        for (int i = 0; i < untransformableItems.size(); ++i) {
+            QGraphicsItem *item = untransformableItems.at(i);
+            if (!item->d_ptr->parent) {
+                rectItems << item;
+            } else {
+                item = item->topLevelItem();
+                if (!rectItems.contains(item))
+                    rectItems << item;
+            }
+        }
+    } else {
+        rectItems += untransformableItems;
+    }
+
+    QGraphicsSceneBspTreeIndexPrivate::sortItems(&rectItems, order, /*cached=*/false, onlyTopLevelItems);
+    return rectItems;
+}
+
+/*!
+    Constructs a quadtree scene index for the given \a scene.
+*/
+QGraphicsSceneQuadTreeIndex::QGraphicsSceneQuadTreeIndex(QGraphicsScene *scene)
+    : QGraphicsSceneIndex(*new QGraphicsSceneQuadTreeIndexPrivate(scene), scene)
+{
+}
+
+QGraphicsSceneQuadTreeIndex::~QGraphicsSceneQuadTreeIndex()
+{
+    Q_D(QGraphicsSceneQuadTreeIndex);
+    for (int i = 0; i < d->indexedItems.size(); ++i) {
+        // Ensure item bits are reset properly.
+        if (QGraphicsItem *item = d->indexedItems.at(i)) {
+            Q_ASSERT(!item->d_ptr->itemDiscovered);
+            item->d_ptr->index = -1;
+        }
+    }
+}
+
+/*!
+    \internal
+    Clear the whole quadtree index.
+*/
+void QGraphicsSceneQuadTreeIndex::clear()
+{
+    Q_D(QGraphicsSceneQuadTreeIndex);
+    d->tree.clear();
+    d->indexTimer.stop();
+    for (int i = 0; i < d->indexedItems.size(); ++i) {
+        // Ensure item bits are reset properly.
+        if (QGraphicsItem *item = d->indexedItems.at(i)) {
+            Q_ASSERT(!item->d_ptr->itemDiscovered);
+            item->d_ptr->index = -1;
+        }
+    }
+    d->indexedItems.clear();
+    d->unindexedItems.clear();
+    d->untransformableItems.clear();
+    d->freeItemIndexes.clear();
+    d->movedItems.clear();
+}
+
+/*!
+    Add the \a item into the quadtree index.
+*/
+void QGraphicsSceneQuadTreeIndex::addItem(QGraphicsItem *item)
+{
+    Q_D(QGraphicsSceneQuadTreeIndex);
+    d->addItem(item);
+}
+
+/*!
+    Remove the \a item from the quadtree index.
+*/
+void QGraphicsSceneQuadTreeIndex::removeItem(QGraphicsItem *item)
+{
+    Q_D(QGraphicsSceneQuadTreeIndex);
+    d->removeItem(item);
+}
+
+/*!
+    \internal
+    Schedules the \a item to be refitted into the quadtree when its bounding
+    rect has changed.
+*/
+void QGraphicsSceneQuadTreeIndex::prepareBoundingRectChange(const QGraphicsItem *item)
+{
+    if (!item)
+        return;
+
+    if (item->d_ptr->index == -1 || !QGraphicsSceneQuadTreeIndexPrivate::isInTree(item))
+        return; // Item is not in the tree; nothing to do.
+
+    Q_D(QGraphicsSceneQuadTreeIndex);
+    QGraphicsItem *thatItem = const_cast<QGraphicsItem *>(item);
+    d->movedItems.insert(thatItem);
+    d->startIndexTimer();
+    for (int i = 0; i < item->d_ptr->children.size(); ++i)
+        prepareBoundingRectChange(item->d_ptr->children.at(i));
+}
+
+/*!
+    Returns an estimation visible items that are either inside or
+    intersect with the specified \a rect and return a list sorted using \a order.
+*/
+QList<QGraphicsItem *> QGraphicsSceneQuadTreeIndex::estimateItems(const QRectF &rect, Qt::SortOrder order) const
+{
+    Q_D(const QGraphicsSceneQuadTreeIndex);
+    return const_cast<QGraphicsSceneQuadTreeIndexPrivate*>(d)->estimateItems(rect, order);
+}
+
+QList<QGraphicsItem *> QGraphicsSceneQuadTreeIndex::estimateTopLevelItems(const QRectF &rect, Qt::SortOrder order) const
+{
+    Q_D(const QGraphicsSceneQuadTreeIndex);
+    return const_cast<QGraphicsSceneQuadTreeIndexPrivate*>(d)->estimateItems(rect, order, /*onlyTopLevels=*/true);
+}
+
+/*!
+    Return all items in the quadtree index and sort them using \a order.
+*/
+QList<QGraphicsItem *> QGraphicsSceneQuadTreeIndex::items(Qt::SortOrder order) const
+{
+    Q_D(const QGraphicsSceneQuadTreeIndex);
+    QList<QGraphicsItem *> itemList;
+    itemList.reserve(d->indexedItems.size() + d->unindexedItems.size());
+
+    QGraphicsItem *null = nullptr;
+    std::remove_copy(d->indexedItems.cbegin(), d->indexedItems.cend(),
+                     std::back_inserter(itemList), null);
+    itemList += d->unindexedItems;
+
+    QGraphicsSceneBspTreeIndexPrivate::sortItems(&itemList, order, /*cached=*/false);
+    return itemList;
+}
+
+/*!
+    \internal
+
+    The scene rect is only used as a hint for the size of the root node, so
+    the tree does not need to be rebuilt when it changes.
+*/
+void QGraphicsSceneQuadTreeIndex::updateSceneRect(const QRectF &rect)
+{
+    Q_D(QGraphicsSceneQuadTreeIndex);
+    d->tree.initialize(rect);
+}
+
+/*!
+    \internal
+
+    This method react to the \a change of the \a item and use the \a value to
+    update the tree if necessary.
+*/
+void QGraphicsSceneQuadTreeIndex::itemChange(const QGraphicsItem *item, QGraphicsItem::GraphicsItemChange change, const void *const value)
+{
+    Q_D(QGraphicsSceneQuadTreeIndex);
+    switch (change) {
+    case QGraphicsItem::ItemFlagsChange: {
+        // Handle ItemIgnoresTransformations
+        QGraphicsItem::GraphicsItemFlags newFlags = *static_cast<const QGraphicsItem::GraphicsItemFlags *>(value);
+        bool ignoredTransform = item->d_ptr->flags & QGraphicsItem::ItemIgnoresTransformations;
+        bool willIgnoreTransform = newFlags & QGraphicsItem::ItemIgnoresTransformations;
+        bool clipsChildren = item->d_ptr->flags & QGraphicsItem::ItemClipsChildrenToShape
+                             || item->d_ptr->flags & QGraphicsItem::ItemContainsChildrenInShape;
+        bool willClipChildren = newFlags & QGraphicsItem::ItemClipsChildrenToShape
+                                || newFlags & QGraphicsItem::ItemContainsChildrenInShape;
+        if ((ignoredTransform != willIgnoreTransform) || (clipsChildren != willClipChildren)) {
+            // Reindex the item and its descendants, so that they are put into
+            // the tree or the list of untransformable items as appropriate.
+            d->removeItem(const_cast<QGraphicsItem *>(item), /*recursive=*/true, /*moveToUnidexedItems=*/true);
+        }
+        break;
+    }
+    case QGraphicsItem::ItemParentChange: {
+        // Handle ItemIgnoresTransformations
+        const QGraphicsItem *newParent = static_cast<const QGraphicsItem *>(value);
+        bool ignoredTransform = item->d_ptr->itemIsUntransformable();
+        bool willIgnoreTransform = (item->d_ptr->flags & QGraphicsItem::ItemIgnoresTransformations)
+                                   || (newParent && newParent->d_ptr->itemIsUntransformable());
+        bool ancestorClippedChildren = item->d_ptr->ancestorFlags & QGraphicsItemPrivate::AncestorClipsChildren
+                                       || item->d_ptr->ancestorFlags & QGraphicsItemPrivate::AncestorContainsChildren;
+        bool ancestorWillClipChildren = newParent
+                            && ((newParent->d_ptr->flags & QGraphicsItem::ItemClipsChildrenToShape
+                                 || newParent->d_ptr->flags & QGraphicsItem::ItemContainsChildrenInShape)
+                                || (newParent->d_ptr->ancestorFlags & QGraphicsItemPrivate::AncestorClipsChildren
+                                    || newParent->d_ptr->ancestorFlags & QGraphicsItemPrivate::AncestorContainsChildren));
+        if ((ignoredTransform != willIgnoreTransform) || (ancestorClippedChildren != ancestorWillClipChildren)) {
+            // Reindex the item and its descendants, so that they are put into
+            // the tree or the list of untransformable items as appropriate.
+            d->removeItem(const_cast<QGraphicsItem *>(item), /*recursive=*/true, /*moveToUnidexedItems=*/true);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/*!
+    \reimp
+*/
+void QGraphicsSceneQuadTreeIndex::timerEvent(QTimerEvent *event)
+{
+    Q_D(QGraphicsSceneQuadTreeIndex);
+    if (event->timerId() == d->indexTimer.timerId())
+        d->updateIndex();
+    else
+        QGraphicsSceneIndex::timerEvent(event);
+}
+
+QT_END_NAMESPACE
+
+#include "moc_qgraphicsscenequadtreeindex_p.cpp"
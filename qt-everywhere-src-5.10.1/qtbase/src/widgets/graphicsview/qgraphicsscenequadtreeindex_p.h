@@ -0,0 +1,135 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtCore module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists for the convenience
+// of other Qt classes.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#ifndef QGRAPHICSSCENEQUADTREEINDEX_H
+#define QGRAPHICSSCENEQUADTREEINDEX_H
+
+#include <QtWidgets/private/qtwidgetsglobal_p.h>
+
+#include "qgraphicssceneindex_p.h"
+#include "qgraphicsitem_p.h"
+#include "qgraphicsscene_quadtree_p.h"
+
+#include <QtCore/qbasictimer.h>
+#include <QtCore/qlist.h>
+#include <QtCore/qrect.h>
+#include <QtCore/qset.h>
+
+QT_REQUIRE_CONFIG(graphicsview);
+
+QT_BEGIN_NAMESPACE
+
+class QGraphicsScene;
+class QGraphicsSceneQuadTreeIndexPrivate;
+
+class Q_AUTOTEST_EXPORT QGraphicsSceneQuadTreeIndex : public QGraphicsSceneIndex
+{
+    Q_OBJECT
+public:
+    QGraphicsSceneQuadTreeIndex(QGraphicsScene *scene = 0);
+    ~QGraphicsSceneQuadTreeIndex();
+
+    QList<QGraphicsItem *> estimateItems(const QRectF &rect, Qt::SortOrder order) const Q_DECL_OVERRIDE;
+    QList<QGraphicsItem *> estimateTopLevelItems(const QRectF &rect, Qt::SortOrder order) const Q_DECL_OVERRIDE;
+    QList<QGraphicsItem *> items(Qt::SortOrder order = Qt::DescendingOrder) const Q_DECL_OVERRIDE;
+
+protected Q_SLOTS:
+    void updateSceneRect(const QRectF &rect) Q_DECL_OVERRIDE;
+
+protected:
+    void timerEvent(QTimerEvent *event) Q_DECL_OVERRIDE;
+    void clear() Q_DECL_OVERRIDE;
+
+    void addItem(QGraphicsItem *item) Q_DECL_OVERRIDE;
+    void removeItem(QGraphicsItem *item) Q_DECL_OVERRIDE;
+    void prepareBoundingRectChange(const QGraphicsItem *item) Q_DECL_OVERRIDE;
+
+    void itemChange(const QGraphicsItem *item, QGraphicsItem::GraphicsItemChange change, const void *const value) Q_DECL_OVERRIDE;
+
+private:
+    Q_DECLARE_PRIVATE(QGraphicsSceneQuadTreeIndex)
+    Q_DISABLE_COPY(QGraphicsSceneQuadTreeIndex)
+
+    friend class QGraphicsScene;
+    friend class QGraphicsScenePrivate;
+};
+
+class QGraphicsSceneQuadTreeIndexPrivate : public QGraphicsSceneIndexPrivate
+{
+    Q_DECLARE_PUBLIC(QGraphicsSceneQuadTreeIndex)
+public:
+    QGraphicsSceneQuadTreeIndexPrivate(QGraphicsScene *scene);
+
+    QGraphicsSceneQuadTree tree;
+    QBasicTimer indexTimer;
+
+    QList<QGraphicsItem *> indexedItems;
+    QList<QGraphicsItem *> unindexedItems;
+    QList<QGraphicsItem *> untransformableItems;
+    QList<int> freeItemIndexes;
+    QSet<QGraphicsItem *> movedItems;
+
+    void updateIndex();
+    void startIndexTimer();
+    void addItem(QGraphicsItem *item, bool recursive = false);
+    void removeItem(QGraphicsItem *item, bool recursive = false, bool moveToUnindexedItems = false);
+    QList<QGraphicsItem *> estimateItems(const QRectF &rect, Qt::SortOrder order, bool onlyTopLevelItems = false);
+
+    static inline bool isInTree(const QGraphicsItem *item)
+    {
+        return !item->d_ptr->itemIsUntransformable()
+            && !(item->d_ptr->ancestorFlags & QGraphicsItemPrivate::AncestorClipsChildren
+                 || item->d_ptr->ancestorFlags & QGraphicsItemPrivate::AncestorContainsChildren);
+    }
+};
+
+QT_END_NAMESPACE
+
+#endif // QGRAPHICSSCENEQUADTREEINDEX_H
@@ -54,6 +54,7 @@
 #include <qvector.h>
 #include <qapplication.h>
 #include <qvarlengtharray.h>
+#include <qelapsedtimer.h>
 #include <qabstractitemdelegate.h>
 #include <qvariant.h>
 #include <private/qheaderview_p.h>
@@ -1882,6 +1883,10 @@ void QHeaderView::sectionsInserted(const QModelIndex &parent,
 
     QHeaderViewPrivate::SectionItem section(d->defaultSectionSize, d->globalResizeMode);
     d->sectionStartposRecalc = true;
+    if (d->sectionItems.isEmpty())
+        d->uniformSectionSize = d->defaultSectionSize;
+    else if (d->uniformSectionSize != d->defaultSectionSize)
+        d->uniformSectionSize = -1;
 
     if (d->sectionItems.isEmpty() || insertAt >= d->sectionItems.count()) {
         int insertLength = d->defaultSectionSize * insertCount;
@@ -2077,6 +2082,8 @@ void QHeaderViewPrivate::_q_layoutAboutToBeChanged()
     // after layoutChanged another section can be last stretched section
     if (stretchLastSection) {
         const int visual = visualIndex(lastSectionLogicalIdx);
+        if (sectionItems.at(visual).size != uint(lastSectionSize))
+            uniformSectionSize = -1;
         sectionItems[visual].size = lastSectionSize;
     }
     for (int i = 0; i < sectionItems.size(); ++i) {
@@ -2120,6 +2127,7 @@ void QHeaderViewPrivate::_q_layoutChanged()
     }
     // reset sections
     sectionItems.fill(SectionItem(defaultSectionSize, globalResizeMode), newCount);
+    uniformSectionSize = -1; // until recalcSectionStartPos() below
 
     // all hidden sections are in oldPersistentSections
     hiddenSectionSize.clear();
@@ -2312,6 +2320,8 @@ bool QHeaderView::event(QEvent *e)
         if (te->timerId() == d->delayedResize.timerId()) {
             d->delayedResize.stop();
             resizeSections();
+        } else if (te->timerId() == d->delayedContentsResize.timerId()) {
+            d->measureDeferredSections();
         }
         break; }
     case QEvent::StyleChange:
@@ -3295,6 +3305,8 @@ bool QHeaderViewPrivate::isSectionSelected(int section) const
 
 bool QHeaderViewPrivate::isFirstVisibleSection(int section) const
 {
+    if (uniformSectionSize >= 0)
+        return uniformSectionSize > 0 && section == 0;
     if (sectionStartposRecalc)
         recalcSectionStartPos();
     const SectionItem &item = sectionItems.at(section);
@@ -3303,6 +3315,8 @@ bool QHeaderViewPrivate::isFirstVisibleSection(int section) const
 
 bool QHeaderViewPrivate::isLastVisibleSection(int section) const
 {
+    if (uniformSectionSize >= 0)
+        return uniformSectionSize > 0 && section == sectionItems.count() - 1;
     if (sectionStartposRecalc)
         recalcSectionStartPos();
     const SectionItem &item = sectionItems.at(section);
@@ -3388,6 +3402,9 @@ void QHeaderViewPrivate::resizeSections(QHeaderView::ResizeMode globalMode, bool
         return;
     resizeRecursionBlock = true;
 
+    delayedContentsResize.stop();
+    deferredContentsRemaining = 0;
+
     invalidateCachedSizeHint();
     const int lastSectionVisualIdx = q->visualIndex(lastSectionLogicalIdx);
 
@@ -3396,6 +3413,26 @@ void QHeaderViewPrivate::resizeSections(QHeaderView::ResizeMode globalMode, bool
     if (stretchLastSection && !useGlobalMode)
         stretchSection = lastSectionVisualIdx;
 
+    // Measuring the contents of every section is expensive for large models.
+    // Unless a precise resize was asked for, only the visible sections are
+    // measured right away, the others keep their size until they have been
+    // measured by measureDeferredSections(). That is not possible when there
+    // are stretched sections, their size depends on all the others.
+    enum { MaxMeasuredSections = 1000 };
+    int firstMeasured = 0;
+    int lastMeasured = sectionCount() - 1;
+    const bool deferContents = !useGlobalMode && contentsSections > 0
+            && resizeContentsPrecision != -1 && sectionCount() > MaxMeasuredSections
+            && stretchSections == 0 && !stretchLastSection;
+    if (deferContents) {
+        const int viewportLength = (orientation == Qt::Horizontal ? viewport->width() : viewport->height());
+        firstMeasured = qMax(0, headerVisualIndexAt(offset));
+        lastMeasured = headerVisualIndexAt(offset + viewportLength);
+        if (lastMeasured < 0)
+            lastMeasured = sectionCount() - 1;
+        lastMeasured = qMin(lastMeasured, firstMeasured + MaxMeasuredSections - 1);
+    }
+
     // count up the number of stretched sections and how much space left for them
     int lengthToStretch = (orientation == Qt::Horizontal ? viewport->width() : viewport->height());
     int numberOfStretchedSections = 0;
@@ -3420,6 +3457,8 @@ void QHeaderViewPrivate::resizeSections(QHeaderView::ResizeMode globalMode, bool
         int sectionSize = 0;
         if (resizeMode == QHeaderView::Interactive || resizeMode == QHeaderView::Fixed) {
             sectionSize = qBound(q->minimumSectionSize(), headerSectionSize(i), q->maximumSectionSize());
+        } else if (i < firstMeasured || i > lastMeasured) { // ResizeToContents, measured later
+            sectionSize = qBound(q->minimumSectionSize(), headerSectionSize(i), q->maximumSectionSize());
         } else { // resizeMode == QHeaderView::ResizeToContents
             int logicalIndex = q->logicalIndex(i);
             sectionSize = qMax(viewSectionSizeHint(logicalIndex),
@@ -3499,11 +3538,70 @@ void QHeaderViewPrivate::resizeSections(QHeaderView::ResizeMode globalMode, bool
     //Q_ASSERT(headerLength() == length);
     resizeRecursionBlock = false;
     viewport->update();
+
+    if (deferContents && (firstMeasured > 0 || lastMeasured < sectionCount() - 1)) {
+        // continue after the visible sections and wrap around to the ones before them
+        deferredContentsPos = lastMeasured + 1;
+        deferredContentsRemaining = sectionCount() - (lastMeasured - firstMeasured + 1);
+        delayedContentsResize.start(0, q);
+    }
+}
+
+/*!
+    \internal
+    Measures the ResizeToContents sections skipped by resizeSections(), a few
+    at a time so that the event loop stays responsive.
+*/
+void QHeaderViewPrivate::measureDeferredSections()
+{
+    Q_Q(QHeaderView);
+    const int count = sectionCount();
+    if (deferredContentsRemaining <= 0 || count == 0) {
+        deferredContentsRemaining = 0;
+        delayedContentsResize.stop();
+        return;
+    }
+    if (state != NoState || resizeRecursionBlock)
+        return;
+
+    resizeRecursionBlock = true;
+    bool resized = false;
+    QElapsedTimer timer;
+    timer.start();
+    do {
+        const int visual = deferredContentsPos < count ? deferredContentsPos : 0;
+        deferredContentsPos = visual + 1;
+        --deferredContentsRemaining;
+        if (isVisualIndexHidden(visual) || headerSectionResizeMode(visual) != QHeaderView::ResizeToContents)
+            continue;
+
+        const int logical = logicalIndex(visual);
+        int size = qMax(viewSectionSizeHint(logical), q->sectionSizeHint(logical));
+        if (size > q->maximumSectionSize())
+            size = q->maximumSectionSize();
+        const int oldSize = headerSectionSize(visual);
+        if (size != oldSize) {
+            resizeSectionItem(visual, oldSize, size);
+            resized = true;
+        }
+    } while (deferredContentsRemaining > 0 && !timer.hasExpired(10));
+    resizeRecursionBlock = false;
+
+    if (deferredContentsRemaining <= 0)
+        delayedContentsResize.stop();
+    if (resized) {
+        invalidateCachedSizeHint();
+        viewport->update();
+    }
 }
 
 void QHeaderViewPrivate::createSectionItems(int start, int end, int size, QHeaderView::ResizeMode mode)
 {
     int sizePerSection = size / (end - start + 1);
+    if (start == 0 && end >= sectionItems.count() - 1)
+        uniformSectionSize = sizePerSection;
+    else if (sizePerSection != uniformSectionSize || start > sectionItems.count())
+        uniformSectionSize = -1;
     if (end >= sectionItems.count()) {
         sectionItems.resize(end + 1);
         sectionStartposRecalc = true;
@@ -3681,6 +3779,7 @@ void QHeaderViewPrivate::setDefaultSectionSize(int size)
     customDefaultSectionSize = true;
     if (state == QHeaderViewPrivate::ResizeSection)
         preventCursorChangeInSetOffset = true;
+    uniformSectionSize = hiddenSectionSize.isEmpty() ? size : -1;
     for (int i = 0; i < sectionItems.count(); ++i) {
         QHeaderViewPrivate::SectionItem &section = sectionItems[i];
         if (hiddenSectionSize.isEmpty() || !isVisualIndexHidden(i)) { // resize on not hidden.
@@ -3713,10 +3812,14 @@ void QHeaderViewPrivate::updateDefaultSectionSizeFromStyle()
 void QHeaderViewPrivate::recalcSectionStartPos() const // linear (but fast)
 {
     int pixelpos = 0;
+    int uniformSize = sectionItems.isEmpty() ? -1 : int(sectionItems.constFirst().size);
     for (QVector<SectionItem>::const_iterator i = sectionItems.constBegin(); i != sectionItems.constEnd(); ++i) {
         i->calculated_startpos = pixelpos; // write into const mutable
         pixelpos += i->size;
+        if (int(i->size) != uniformSize)
+            uniformSize = -1;
     }
+    uniformSectionSize = uniformSize;
     sectionStartposRecalc = false;
 }
 
@@ -3738,6 +3841,8 @@ int QHeaderViewPrivate::headerSectionSize(int visual) const
 int QHeaderViewPrivate::headerSectionPosition(int visual) const
 {
     if (visual < sectionCount() && visual >= 0) {
+        if (uniformSectionSize >= 0)
+            return visual * uniformSectionSize;
         if (sectionStartposRecalc)
             recalcSectionStartPos();
         return sectionItems.at(visual).calculated_startpos;
@@ -3747,6 +3852,13 @@ int QHeaderViewPrivate::headerSectionPosition(int visual) const
 
 int QHeaderViewPrivate::headerVisualIndexAt(int position) const
 {
+    if (uniformSectionSize >= 0) {
+        // all sections have the same size, no need to know where each one starts
+        if (uniformSectionSize == 0 || position < 0)
+            return -1;
+        const int visual = position / uniformSectionSize;
+        return visual < sectionCount() ? visual : -1;
+    }
     if (sectionStartposRecalc)
         recalcSectionStartPos();
     int startidx = 0;
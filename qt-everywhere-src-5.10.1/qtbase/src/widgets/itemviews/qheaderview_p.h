@@ -106,7 +106,10 @@ public:
 #endif
           globalResizeMode(QHeaderView::Interactive),
           sectionStartposRecalc(true),
-          resizeContentsPrecision(1000)
+          uniformSectionSize(-1),
+          resizeContentsPrecision(1000),
+          deferredContentsPos(0),
+          deferredContentsRemaining(0)
     {}
 
 
@@ -119,6 +122,7 @@ public:
     void updateSectionIndicator(int section, int position);
     void updateHiddenSections(int logicalFirst, int logicalLast);
     void resizeSections(QHeaderView::ResizeMode globalMode, bool useGlobalMode = false);
+    void measureDeferredSections();
     void _q_sectionsRemoved(const QModelIndex &,int,int);
     void _q_layoutAboutToBeChanged();
     void _q_layoutChanged() override;
@@ -301,7 +305,11 @@ public:
 #endif
     QHeaderView::ResizeMode globalResizeMode;
     mutable bool sectionStartposRecalc;
+    mutable int uniformSectionSize; // size shared by all sections, -1 if they differ or it is not known
     int resizeContentsPrecision;
+    QBasicTimer delayedContentsResize;
+    int deferredContentsPos; // next visual index measured by delayedContentsResize
+    int deferredContentsRemaining;
     // header sections
 
     struct SectionItem {
@@ -278,33 +278,45 @@ QString QStyledItemDelegate::displayText(const QVariant &value, const QLocale& l
 void QStyledItemDelegate::initStyleOption(QStyleOptionViewItem *option,
                                          const QModelIndex &index) const
 {
-    QVariant value = index.data(Qt::FontRole);
-    if (value.isValid() && !value.isNull()) {
-        option->font = qvariant_cast<QFont>(value).resolve(option->font);
+    // fetch all the roles needed with a single call into the model
+    QModelRoleData roleData[] = {
+        QModelRoleData(Qt::FontRole),
+        QModelRoleData(Qt::TextAlignmentRole),
+        QModelRoleData(Qt::ForegroundRole),
+        QModelRoleData(Qt::CheckStateRole),
+        QModelRoleData(Qt::DecorationRole),
+        QModelRoleData(Qt::DisplayRole),
+        QModelRoleData(Qt::BackgroundRole)
+    };
+    index.multiData(roleData);
+
+    const QVariant *value = &roleData[0].data();
+    if (value->isValid() && !value->isNull()) {
+        option->font = qvariant_cast<QFont>(*value).resolve(option->font);
         option->fontMetrics = QFontMetrics(option->font);
     }
 
-    value = index.data(Qt::TextAlignmentRole);
-    if (value.isValid() && !value.isNull())
-        option->displayAlignment = Qt::Alignment(value.toInt());
+    value = &roleData[1].data();
+    if (value->isValid() && !value->isNull())
+        option->displayAlignment = Qt::Alignment(value->toInt());
 
-    value = index.data(Qt::ForegroundRole);
-    if (value.canConvert<QBrush>())
-        option->palette.setBrush(QPalette::Text, qvariant_cast<QBrush>(value));
+    value = &roleData[2].data();
+    if (value->canConvert<QBrush>())
+        option->palette.setBrush(QPalette::Text, qvariant_cast<QBrush>(*value));
 
     option->index = index;
-    value = index.data(Qt::CheckStateRole);
-    if (value.isValid() && !value.isNull()) {
+    value = &roleData[3].data();
+    if (value->isValid() && !value->isNull()) {
         option->features |= QStyleOptionViewItem::HasCheckIndicator;
-        option->checkState = static_cast<Qt::CheckState>(value.toInt());
+        option->checkState = static_cast<Qt::CheckState>(value->toInt());
     }
 
-    value = index.data(Qt::DecorationRole);
-    if (value.isValid() && !value.isNull()) {
+    value = &roleData[4].data();
+    if (value->isValid() && !value->isNull()) {
         option->features |= QStyleOptionViewItem::HasDecoration;
-        switch (value.type()) {
+        switch (value->type()) {
         case QVariant::Icon: {
-            option->icon = qvariant_cast<QIcon>(value);
+            option->icon = qvariant_cast<QIcon>(*value);
             QIcon::Mode mode;
             if (!(option->state & QStyle::State_Enabled))
                 mode = QIcon::Disabled;
@@ -321,18 +333,18 @@ void QStyledItemDelegate::initStyleOption(QStyleOptionViewItem *option,
         }
         case QVariant::Color: {
             QPixmap pixmap(option->decorationSize);
-            pixmap.fill(qvariant_cast<QColor>(value));
+            pixmap.fill(qvariant_cast<QColor>(*value));
             option->icon = QIcon(pixmap);
             break;
         }
         case QVariant::Image: {
-            QImage image = qvariant_cast<QImage>(value);
+            QImage image = qvariant_cast<QImage>(*value);
             option->icon = QIcon(QPixmap::fromImage(image));
             option->decorationSize = image.size() / image.devicePixelRatio();
             break;
         }
         case QVariant::Pixmap: {
-            QPixmap pixmap = qvariant_cast<QPixmap>(value);
+            QPixmap pixmap = qvariant_cast<QPixmap>(*value);
             option->icon = QIcon(pixmap);
             option->decorationSize = pixmap.size() / pixmap.devicePixelRatio();
             break;
@@ -342,13 +354,13 @@ void QStyledItemDelegate::initStyleOption(QStyleOptionViewItem *option,
         }
     }
 
-    value = index.data(Qt::DisplayRole);
-    if (value.isValid() && !value.isNull()) {
+    value = &roleData[5].data();
+    if (value->isValid() && !value->isNull()) {
         option->features |= QStyleOptionViewItem::HasDisplay;
-        option->text = displayText(value, option->locale);
+        option->text = displayText(*value, option->locale);
     }
 
-    option->backgroundBrush = qvariant_cast<QBrush>(index.data(Qt::BackgroundRole));
+    option->backgroundBrush = qvariant_cast<QBrush>(roleData[6].data());
 
     // disable style animations for checkboxes etc. within itemviews (QTBUG-30146)
     option->styleObject = 0;
@@ -1171,6 +1171,10 @@ void QTreeView::scrollTo(const QModelIndex &index, ScrollHint hint)
     }
 
     int item = d->viewIndex(index);
+    if (item < 0 && !d->chunkedLayouts.isEmpty()) {
+        d->finishChunkedLayouts();
+        item = d->viewIndex(index);
+    }
     if (item < 0)
         return;
 
@@ -1279,6 +1283,11 @@ void QTreeView::timerEvent(QTimerEvent *event)
             setExpanded(index, !isExpanded(index));
         }
         d->openTimer.stop();
+    } else if (event->timerId() == d->chunkedLayoutTimer.timerId()) {
+        if (d->layoutNextChunk()) {
+            updateGeometries();
+            d->viewport->update();
+        }
     }
 
     QAbstractItemView::timerEvent(event);
@@ -2133,6 +2142,7 @@ void QTreeView::reset()
     d->hiddenIndexes.clear();
     d->spanningIndexes.clear();
     d->viewItems.clear();
+    d->chunkedLayouts.clear();
     QAbstractItemView::reset();
 }
 
@@ -2332,6 +2342,7 @@ QModelIndex QTreeView::moveCursor(CursorAction cursorAction, Qt::KeyboardModifie
     case MoveHome:
         return d->model->index(0, current.column(), d->root);
     case MoveEnd:
+        d->finishChunkedLayouts();
         return d->modelIndex(d->viewItems.count() - 1, current.column());
     }
     return current;
@@ -2767,6 +2778,9 @@ void QTreeView::expandToDepth(int depth)
     old_expandedIndexes = d->expandedIndexes;
     d->expandedIndexes.clear();
     d->interruptDelayedItemsLayout();
+    d->chunkedLayouts.clear();
+    // the loop below expands the items as it finds them, so lay them out in one go
+    ++d->chunkedLayoutBlocked;
     d->layout(-1);
     for (int i = 0; i < d->viewItems.count(); ++i) {
         if (d->viewItems.at(i).level <= (uint)depth) {
@@ -2775,6 +2789,7 @@ void QTreeView::expandToDepth(int depth)
             d->storeExpanded(d->viewItems.at(i).index);
         }
     }
+    --d->chunkedLayoutBlocked;
 
     bool someSignalEnabled = isSignalConnected(QMetaMethod::fromSignal(&QTreeView::collapsed));
     someSignalEnabled |= isSignalConnected(QMetaMethod::fromSignal(&QTreeView::expanded));
@@ -3285,6 +3300,7 @@ void QTreeViewPrivate::_q_endAnimatedOperation()
 void QTreeViewPrivate::_q_modelAboutToBeReset()
 {
     viewItems.clear();
+    chunkedLayouts.clear();
 }
 
 void QTreeViewPrivate::_q_columnsAboutToBeRemoved(const QModelIndex &parent, int start, int end)
@@ -3311,7 +3327,6 @@ void QTreeViewPrivate::_q_columnsRemoved(const QModelIndex &parent, int start, i
 void QTreeViewPrivate::layout(int i, bool recursiveExpanding, bool afterIsUninitialized)
 {
     Q_Q(QTreeView);
-    QModelIndex current;
     QModelIndex parent = (i < 0) ? (QModelIndex)root : modelIndex(i);
 
     if (i>=0 && !parent.isValid()) {
@@ -3328,31 +3343,75 @@ void QTreeViewPrivate::layout(int i, bool recursiveExpanding, bool afterIsUninit
         count = model->rowCount(parent);
     }
 
+    // Items with a lot of children get only their first chunk of children laid out
+    // right away, layoutNextChunk() adds the others from the event loop.
+    if (i == -1)
+        chunkedLayouts.clear();
+    else
+        cancelChunkedLayouts(parent);
+    int rowCount = count;
+    if (count > LayoutChunkSize && !chunkedLayoutBlocked) {
+        rowCount = LayoutChunkSize;
+        const ChunkedLayout chunk = { parent, rowCount, i == -1, recursiveExpanding };
+        chunkedLayouts.append(chunk);
+        if (!chunkedLayoutTimer.isActive())
+            chunkedLayoutTimer.start(0, q);
+    }
+
     bool expanding = true;
     if (i == -1) {
         if (uniformRowHeights) {
             QModelIndex index = model->index(0, 0, parent);
             defaultItemHeight = q->indexRowSizeHint(index);
         }
-        viewItems.resize(count);
+        viewItems.resize(rowCount);
         afterIsUninitialized = true;
-    } else if (viewItems[i].total != (uint)count) {
+    } else if (viewItems[i].total != (uint)rowCount) {
         if (!afterIsUninitialized)
-            insertViewItems(i + 1, count, QTreeViewItem()); // expand
-        else if (count > 0)
-            viewItems.resize(viewItems.count() + count);
+            insertViewItems(i + 1, rowCount, QTreeViewItem()); // expand
+        else if (rowCount > 0)
+            viewItems.resize(viewItems.count() + rowCount);
     } else {
         expanding = false;
     }
 
-    int first = i + 1;
+    const int visible = layoutRows(i, parent, i + 1, 0, rowCount, -1, rowCount < count,
+                                   recursiveExpanding, afterIsUninitialized);
+
+    if (!expanding)
+        return; // nothing changed
+
+    while (i > -1) {
+        viewItems[i].total += visible;
+        i = viewItems[i].parentItem;
+    }
+}
+
+/** \internal
+    fills the \a rowCount view items at \a first with the children of \a parent,
+    starting at \a startRow, and returns how many of them are visible.
+
+    \a previousSibling is the view item of the child laid out last time, or -1.
+    \a moreRows is set when the remaining children are laid out later.
+ */
+int QTreeViewPrivate::layoutRows(int i, const QModelIndex &parent, int first, int startRow,
+                                 int rowCount, int previousSibling, bool moreRows,
+                                 bool recursiveExpanding, bool afterIsUninitialized)
+{
+    Q_Q(QTreeView);
+    QModelIndex current;
+
     int level = (i >= 0 ? viewItems.at(i).level + 1 : 0);
     int hidden = 0;
     int last = 0;
     int children = 0;
     QTreeViewItem *item = 0;
-    for (int j = first; j < first + count; ++j) {
-        current = model->index(j - first, 0, parent);
+    if (previousSibling >= 0) {
+        item = &viewItems[previousSibling];
+        item->hasMoreSiblings = false;
+    }
+    for (int j = first; j < first + rowCount; ++j) {
+        current = model->index(startRow + j - first, 0, parent);
         if (isRowHidden(current)) {
             ++hidden;
             last = j - hidden + children;
@@ -3383,6 +3442,9 @@ void QTreeViewPrivate::layout(int i, bool recursiveExpanding, bool afterIsUninit
             }
         }
     }
+    // the siblings still to come are most likely visible
+    if (item && moreRows)
+        item->hasMoreSiblings = true;
 
     // remove hidden items
     if (hidden > 0) {
@@ -3392,12 +3454,90 @@ void QTreeViewPrivate::layout(int i, bool recursiveExpanding, bool afterIsUninit
             viewItems.resize(viewItems.size() - hidden);
     }
 
-    if (!expanding)
-        return; // nothing changed
+    return rowCount - hidden;
+}
 
-    while (i > -1) {
-        viewItems[i].total += count - hidden;
-        i = viewItems[i].parentItem;
+/*!
+  \internal
+  Lays out the next chunk of children of the first pending chunked layout.
+  Returns \c false if there is nothing left to lay out.
+*/
+bool QTreeViewPrivate::layoutNextChunk()
+{
+    while (!chunkedLayouts.isEmpty()) {
+        if (delayedPendingLayout || viewItems.isEmpty()) {
+            // the items are laid out again from scratch anyway
+            chunkedLayouts.clear();
+            break;
+        }
+
+        ChunkedLayout &chunk = chunkedLayouts.first();
+        int item = -1;
+        if (!chunk.topLevel) {
+            item = viewIndex(chunk.parent);
+            if (item == -1 || !viewItems.at(item).expanded) {
+                chunkedLayouts.removeFirst();
+                continue;
+            }
+        }
+        const int count = model->rowCount(chunk.parent);
+        if (chunk.nextRow >= count) {
+            chunkedLayouts.removeFirst();
+            continue;
+        }
+
+        // the children are appended after the ones laid out so far
+        const int first = item == -1 ? viewItems.count() : item + viewItems.at(item).total + 1;
+        int previousSibling = first - 1;
+        while (previousSibling > item && viewItems.at(previousSibling).parentItem != item)
+            previousSibling = viewItems.at(previousSibling).parentItem;
+        if (previousSibling == item)
+            previousSibling = -1;
+
+        const int startRow = chunk.nextRow;
+        const int rowCount = qMin(int(LayoutChunkSize), count - startRow);
+        const bool recursiveExpanding = chunk.recursiveExpanding;
+        const QModelIndex parent = chunk.parent;
+        chunk.nextRow += rowCount;
+        const bool moreRows = chunk.nextRow < count;
+        if (!moreRows)
+            chunkedLayouts.removeFirst();
+
+        const bool afterIsUninitialized = (first == viewItems.count());
+        if (afterIsUninitialized)
+            viewItems.resize(viewItems.count() + rowCount);
+        else
+            insertViewItems(first, rowCount, QTreeViewItem());
+        const int visible = layoutRows(item, parent, first, startRow, rowCount, previousSibling,
+                                       moreRows, recursiveExpanding, afterIsUninitialized);
+        while (item > -1) {
+            viewItems[item].total += visible;
+            item = viewItems.at(item).parentItem;
+        }
+        return true;
+    }
+    chunkedLayoutTimer.stop();
+    return false;
+}
+
+/*!
+  \internal
+  Lays out all the children still missing from chunked layouts.
+*/
+void QTreeViewPrivate::finishChunkedLayouts()
+{
+    if (chunkedLayouts.isEmpty())
+        return;
+    while (layoutNextChunk()) {}
+    q_func()->updateGeometries();
+    viewport->update();
+}
+
+void QTreeViewPrivate::cancelChunkedLayouts(const QModelIndex &parent)
+{
+    for (int i = chunkedLayouts.count() - 1; i >= 0; --i) {
+        if (!chunkedLayouts.at(i).topLevel && chunkedLayouts.at(i).parent == parent)
+            chunkedLayouts.remove(i);
     }
 }
 
@@ -3905,6 +4045,9 @@ bool QTreeViewPrivate::hasVisibleChildren(const QModelIndex& parent) const
             return true;
         if (q->isIndexHidden(parent))
             return false;
+        // don't make the model count (and fetch) the children before they are shown
+        if (model->canFetchMore(parent))
+            return true;
         int rowCount = model->rowCount(parent);
         for (int i = 0; i < rowCount; ++i) {
             if (!q->isRowHidden(i, parent))
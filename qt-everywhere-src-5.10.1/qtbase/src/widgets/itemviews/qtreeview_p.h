@@ -92,7 +92,7 @@ public:
           allColumnsShowFocus(false), customIndent(false), current(0), spanning(false),
           animationsEnabled(false), columnResizeTimerID(0),
           autoExpandDelay(-1), hoverBranch(-1), geometryRecursionBlock(false), hasRemovedItems(false),
-          treePosition(0) {}
+          treePosition(0), chunkedLayoutBlocked(0) {}
 
     ~QTreeViewPrivate() {}
     void initialize();
@@ -135,6 +135,12 @@ public:
     void _q_modelDestroyed() override;
 
     void layout(int item, bool recusiveExpanding = false, bool afterIsUninitialized = false);
+    int layoutRows(int item, const QModelIndex &parent, int first, int startRow, int rowCount,
+                   int previousSibling, bool moreRows, bool recursiveExpanding,
+                   bool afterIsUninitialized);
+    bool layoutNextChunk();
+    void finishChunkedLayouts();
+    void cancelChunkedLayouts(const QModelIndex &parent);
 
     int pageUp(int item) const;
     int pageDown(int item) const;
@@ -268,8 +274,22 @@ public:
 
     // tree position
     int treePosition;
+
+    // used for laying out items with many children across several event loop iterations
+    enum { LayoutChunkSize = 10000 };
+    struct ChunkedLayout {
+        QPersistentModelIndex parent;
+        int nextRow;
+        bool topLevel; // parent is the root index
+        bool recursiveExpanding;
+    };
+    QVector<ChunkedLayout> chunkedLayouts;
+    QBasicTimer chunkedLayoutTimer;
+    int chunkedLayoutBlocked;
 };
 
+Q_DECLARE_TYPEINFO(QTreeViewPrivate::ChunkedLayout, Q_MOVABLE_TYPE);
+
 QT_END_NAMESPACE
 
 #endif // QTREEVIEW_P_H
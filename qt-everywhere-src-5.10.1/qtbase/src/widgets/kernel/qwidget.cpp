@@ -5616,7 +5616,10 @@ void QWidgetPrivate::drawWidget(QPaintDevice *pdev, const QRegion &rgn, const QP
 
             if (!skipPaintEvent) {
                 //actually send the paint event
-                sendPaintEvent(toBePainted);
+                if (paintEngine && !sharedPainter && !onScreen && q->testAttribute(Qt::WA_CachedLayer))
+                    drawCachedLayer(pdev, toBePainted, offset);
+                else
+                    sendPaintEvent(toBePainted);
             }
 
             // Native widgets need to be marked dirty on screen so painting will be done in correct context
@@ -5684,6 +5687,49 @@ void QWidgetPrivate::sendPaintEvent(const QRegion &toBePainted)
 #endif // QT_NO_OPENGL
 }
 
+/*!
+    \internal
+
+    Draws \a rgn of the widget from its Qt::WA_CachedLayer layer. The parts of
+    \a rgn that were invalidated since they were last drawn are repainted
+    into the layer first. Painting must already be redirected to \a pdev.
+*/
+void QWidgetPrivate::drawCachedLayer(QPaintDevice *pdev, const QRegion &rgn, const QPoint &offset)
+{
+    Q_Q(QWidget);
+    if (!extra)
+        createExtra();
+
+    const qreal dpr = pdev->devicePixelRatioF();
+    QImage &layer = extra->cachedLayer;
+    const QSize layerSize = q->size() * dpr;
+    if (layer.size() != layerSize || layer.devicePixelRatioF() != dpr) {
+        layer = QImage(layerSize, QImage::Format_ARGB32_Premultiplied);
+        layer.setDevicePixelRatio(dpr);
+        extra->cachedLayerDirty = q->rect();
+    }
+
+    const QRegion dirty = extra->cachedLayerDirty & rgn;
+    if (!dirty.isEmpty()) {
+        {
+            QPainter p(&layer);
+            p.setCompositionMode(QPainter::CompositionMode_Source);
+            for (const QRect &rect : dirty)
+                p.fillRect(rect, Qt::transparent);
+        }
+        QPaintEngine *layerEngine = layer.paintEngine();
+        setRedirected(&layer, QPoint());
+        setSystemClip(layerEngine, dpr, dirty);
+        sendPaintEvent(dirty);
+        setSystemClip(layerEngine, 1, QRegion());
+        setRedirected(pdev, -offset);
+        extra->cachedLayerDirty -= dirty;
+    }
+
+    QPainter p(q);
+    p.drawImage(QPoint(), layer);
+}
+
 void QWidgetPrivate::render(QPaintDevice *target, const QPoint &targetOffset,
                             const QRegion &sourceRegion, QWidget::RenderFlags renderFlags)
 {
@@ -10919,6 +10965,7 @@ void QWidget::scroll(int dx, int dy)
 void QWidgetPrivate::scroll_sys(int dx, int dy)
 {
     Q_Q(QWidget);
+    invalidateCachedLayer(q->rect());
     scrollChildren(dx, dy);
     scrollRect(q->rect(), dx, dy);
 }
@@ -10959,6 +11006,7 @@ void QWidget::scroll(int dx, int dy, const QRect &r)
 
 void QWidgetPrivate::scroll_sys(int dx, int dy, const QRect &r)
 {
+    invalidateCachedLayer(r);
     scrollRect(r, dx, dy);
 }
 
@@ -11030,6 +11078,8 @@ void QWidgetPrivate::repaint(T r)
 {
     Q_Q(QWidget);
 
+    invalidateCachedLayer(r);
+
     if (!q->isVisible() || !q->updatesEnabled() || r.isEmpty())
         return;
 
@@ -11098,6 +11148,8 @@ void QWidgetPrivate::update(T r)
 {
     Q_Q(QWidget);
 
+    invalidateCachedLayer(r);
+
     if (!q->isVisible() || !q->updatesEnabled())
         return;
 
@@ -11295,6 +11347,13 @@ void QWidget::setAttribute(Qt::WidgetAttribute attribute, bool on)
         QEvent e(QEvent::TabletTrackingChange);
         QApplication::sendEvent(this, &e);
         break; }
+    case Qt::WA_CachedLayer:
+        if (!on && d->extra) {
+            d->extra->cachedLayer = QImage();
+            d->extra->cachedLayerDirty = QRegion();
+        }
+        update();
+        break;
     case Qt::WA_NativeWindow: {
         d->createTLExtra();
         if (on)
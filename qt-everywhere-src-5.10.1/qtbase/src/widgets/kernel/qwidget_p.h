@@ -57,6 +57,7 @@
 #include "QtCore/qrect.h"
 #include "QtCore/qlocale.h"
 #include "QtCore/qset.h"
+#include "QtGui/qimage.h"
 #include "QtGui/qregion.h"
 #include "QtGui/qinputmethod.h"
 #include "QtGui/qopengl.h"
@@ -247,6 +248,8 @@ struct QWExtra {
     // Implicit pointers (shared_empty/shared_null).
     QRegion mask; // widget mask
     QString styleSheet;
+    QImage cachedLayer; // Qt::WA_CachedLayer
+    QRegion cachedLayerDirty;
 
     // Other variables.
     qint32 minw;
@@ -410,7 +413,14 @@ public:
     void drawWidget(QPaintDevice *pdev, const QRegion &rgn, const QPoint &offset, int flags,
                     QPainter *sharedPainter = 0, QWidgetBackingStore *backingStore = 0);
     void sendPaintEvent(const QRegion &toBePainted);
+    void drawCachedLayer(QPaintDevice *pdev, const QRegion &rgn, const QPoint &offset);
 
+    template <typename T>
+    inline void invalidateCachedLayer(const T &r)
+    {
+        if (extra && !extra->cachedLayer.isNull())
+            extra->cachedLayerDirty += r;
+    }
 
     void paintSiblingsRecursive(QPaintDevice *pdev, const QObjectList& children, int index,
                                 const QRegion &rgn, const QPoint &offset, int flags,
@@ -52,6 +52,7 @@
 #include <qmenubar.h>
 #endif
 #include <qpainter.h>
+#include <qpixmapcache.h>
 #include <qstyleoption.h>
 #if QT_CONFIG(lineedit)
 #include <qlineedit.h>
@@ -495,7 +496,7 @@ struct QStyleSheetImageData : public QSharedData
 class QRenderRule
 {
 public:
-    QRenderRule() : features(0), hasFont(false), pal(0), b(0), bg(0), bd(0), ou(0), geo(0), p(0), img(0), clipset(0) { }
+    QRenderRule() : features(0), hasFont(false), pal(0), b(0), bg(0), bd(0), ou(0), geo(0), p(0), img(0), clipset(0), cacheId(0) { }
     QRenderRule(const QVector<QCss::Declaration> &, const QObject *);
 
     QRect borderRect(const QRect &r) const;
@@ -515,6 +516,7 @@ public:
     void drawBackground(QPainter *, const QRect&, const QPoint& = QPoint(0, 0));
     void drawBackgroundImage(QPainter *, const QRect&, QPoint = QPoint(0, 0));
     void drawFrame(QPainter *, const QRect&);
+    bool canCacheFrame(const QPainter *, const QRect&) const;
     void drawImage(QPainter *p, const QRect &rect);
     void drawRule(QPainter *, const QRect&);
     void configurePalette(QPalette *, QPalette::ColorGroup, const QWidget *, bool);
@@ -622,6 +624,8 @@ public:
 
     int clipset;
     QPainterPath clipPath;
+
+    int cacheId; // identifies the rule's frame pixmaps in QPixmapCache, 0 for none
 };
 Q_DECLARE_TYPEINFO(QRenderRule, Q_MOVABLE_TYPE);
 
@@ -897,8 +901,11 @@ static QStyle::StandardPixmap subControlIcon(int pe)
     return QStyle::SP_CustomBase;
 }
 
+static QBasicAtomicInt nextRenderRuleCacheId = Q_BASIC_ATOMIC_INITIALIZER(0);
+
 QRenderRule::QRenderRule(const QVector<Declaration> &declarations, const QObject *object)
-: features(0), hasFont(false), pal(0), b(0), bg(0), bd(0), ou(0), geo(0), p(0), img(0), clipset(0)
+: features(0), hasFont(false), pal(0), b(0), bg(0), bd(0), ou(0), geo(0), p(0), img(0), clipset(0),
+  cacheId(nextRenderRuleCacheId.fetchAndAddRelaxed(1) + 1)
 {
     QPalette palette = QApplication::palette(); // ###: ideally widget's palette
     ValueExtractor v(declarations, palette);
@@ -1356,8 +1363,78 @@ void QRenderRule::drawBackground(QPainter *p, const QRect& rect, const QPoint& o
     drawBackgroundImage(p, rect, off);
 }
 
+// brushes that look the same when painted at a different position
+static bool isTranslationInvariant(const QBrush &brush)
+{
+    switch (brush.style()) {
+    case Qt::NoBrush:
+    case Qt::SolidPattern:
+        return true;
+    case Qt::LinearGradientPattern:
+    case Qt::RadialGradientPattern:
+    case Qt::ConicalGradientPattern:
+        return brush.gradient()->coordinateMode() == QGradient::ObjectBoundingMode;
+    default:
+        return false;
+    }
+}
+
+/*! \internal
+  Returns \c true if the frame is expensive enough to draw to be worth caching
+  and looks the same when drawn from a pixmap.
+ */
+bool QRenderRule::canCacheFrame(const QPainter *p, const QRect &rect) const
+{
+    enum { MaxCachedFrameArea = 256 * 256 };
+    if (!cacheId || rect.isEmpty() || rect.width() * rect.height() > MaxCachedFrameArea)
+        return false;
+    if (p->transform().type() > QTransform::TxTranslate
+        || p->compositionMode() != QPainter::CompositionMode_SourceOver)
+        return false;
+
+    const QBrush brush = hasBackground() && background()->brush.style() != Qt::NoBrush
+                         ? background()->brush : defaultBackground;
+    if (!isTranslationInvariant(brush))
+        return false;
+
+    bool expensive = hasGradientBackground();
+    if (hasBorder()) {
+        if (border()->hasBorderImage())
+            return true;
+        for (int i = 0; i < 4; i++) {
+            if (!isTranslationInvariant(bd->colors[i]))
+                return false;
+            expensive |= bd->radii[i].isValid();
+        }
+    }
+    return expensive;
+}
+
 void QRenderRule::drawFrame(QPainter *p, const QRect& rect)
 {
+    if (canCacheFrame(p, rect)) {
+        const qreal dpr = p->device()->devicePixelRatioF();
+        const QString key = QLatin1String("qt_stylesheet_frame_") + QString::number(cacheId)
+                            + QLatin1Char('_') + QString::number(rect.width())
+                            + QLatin1Char('x') + QString::number(rect.height())
+                            + QLatin1Char('@') + QString::number(dpr);
+        QPixmap pixmap;
+        if (!QPixmapCache::find(key, &pixmap)) {
+            pixmap = QPixmap(rect.size() * dpr);
+            pixmap.setDevicePixelRatio(dpr);
+            pixmap.fill(Qt::transparent);
+            QPainter pixmapPainter(&pixmap);
+            const QRect pixmapRect(QPoint(0, 0), rect.size());
+            drawBackground(&pixmapPainter, pixmapRect);
+            if (hasBorder())
+                drawBorder(&pixmapPainter, borderRect(pixmapRect));
+            pixmapPainter.end();
+            QPixmapCache::insert(key, pixmap);
+        }
+        p->drawPixmap(rect.topLeft(), pixmap);
+        return;
+    }
+
     drawBackground(p, rect);
     if (hasBorder())
         drawBorder(p, borderRect(rect));
@@ -1558,6 +1635,36 @@ private:
     mutable QHash<const QObject *, QHash<QString, QString> > m_attributeCache;
 };
 
+static void inspectSelectors(const StyleRule &rule, bool *simpleSelectors, QStringList *attributes)
+{
+    for (const Selector &selector : rule.selectors) {
+        if (selector.basicSelectors.count() > 1)
+            *simpleSelectors = false;
+        for (const BasicSelector &basicSelector : selector.basicSelectors) {
+            for (const AttributeSelector &attributeSelector : basicSelector.attributeSelectors) {
+                if (!attributes->contains(attributeSelector.name))
+                    attributes->append(attributeSelector.name);
+            }
+        }
+    }
+}
+
+QHash<const void *, QStyleSheetStyleCaches::ParsedStyleSheet>::const_iterator
+QStyleSheetStyleCaches::insertStyleSheet(const void *key, const StyleSheet &styleSheet)
+{
+    ParsedStyleSheet parsed;
+    parsed.styleSheet = styleSheet;
+    parsed.id = ++lastStyleSheetId;
+    parsed.simpleSelectors = true;
+    for (const StyleRule &rule : styleSheet.styleRules)
+        inspectSelectors(rule, &parsed.simpleSelectors, &parsed.attributes);
+    for (const StyleRule &rule : styleSheet.nameIndex)
+        inspectSelectors(rule, &parsed.simpleSelectors, &parsed.attributes);
+    for (const StyleRule &rule : styleSheet.idIndex)
+        inspectSelectors(rule, &parsed.simpleSelectors, &parsed.attributes);
+    return styleSheetCache.insert(key, parsed);
+}
+
 QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
 {
     QHash<const QObject *, QVector<StyleRule> >::const_iterator cacheIt = styleSheetCaches->styleRulesCache.constFind(obj);
@@ -1569,23 +1676,35 @@ QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
     }
 
     QStyleSheetStyleSelector styleSelector;
+    typedef QHash<const void *, QStyleSheetStyleCaches::ParsedStyleSheet>::const_iterator ParsedStyleSheetIterator;
+
+    // Objects matched by simple selectors only get the same rules if they have the
+    // same class, name and attributes, so these objects share their rules.
+    bool simpleSelectors = true;
+    QStringList attributes;
+    QString sharedKey;
+    auto addStyleSheet = [&](ParsedStyleSheetIterator it) {
+        simpleSelectors &= it->simpleSelectors;
+        for (const QString &attribute : it->attributes) {
+            if (!attributes.contains(attribute))
+                attributes.append(attribute);
+        }
+        sharedKey += QString::number(it->id) + QLatin1Char(',');
+        return it->styleSheet;
+    };
 
-    StyleSheet defaultSs;
-    QHash<const void *, StyleSheet>::const_iterator defaultCacheIt = styleSheetCaches->styleSheetCache.constFind(baseStyle());
+    ParsedStyleSheetIterator defaultCacheIt = styleSheetCaches->styleSheetCache.constFind(baseStyle());
     if (defaultCacheIt == styleSheetCaches->styleSheetCache.constEnd()) {
-        defaultSs = getDefaultStyleSheet();
         QStyle *bs = baseStyle();
-        styleSheetCaches->styleSheetCache.insert(bs, defaultSs);
+        defaultCacheIt = styleSheetCaches->insertStyleSheet(bs, getDefaultStyleSheet());
         QObject::connect(bs, SIGNAL(destroyed(QObject*)), styleSheetCaches, SLOT(styleDestroyed(QObject*)), Qt::UniqueConnection);
-    } else {
-        defaultSs = defaultCacheIt.value();
     }
-    styleSelector.styleSheets += defaultSs;
+    styleSelector.styleSheets += addStyleSheet(defaultCacheIt);
 
     if (!qApp->styleSheet().isEmpty()) {
-        StyleSheet appSs;
-        QHash<const void *, StyleSheet>::const_iterator appCacheIt = styleSheetCaches->styleSheetCache.constFind(qApp);
+        ParsedStyleSheetIterator appCacheIt = styleSheetCaches->styleSheetCache.constFind(qApp);
         if (appCacheIt == styleSheetCaches->styleSheetCache.constEnd()) {
+            StyleSheet appSs;
             QString ss = qApp->styleSheet();
             if (ss.startsWith(QLatin1String("file:///")))
                 ss.remove(0, 8);
@@ -1594,11 +1713,9 @@ QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
                 qWarning("Could not parse application stylesheet");
             appSs.origin = StyleSheetOrigin_Inline;
             appSs.depth = 1;
-            styleSheetCaches->styleSheetCache.insert(qApp, appSs);
-        } else {
-            appSs = appCacheIt.value();
+            appCacheIt = styleSheetCaches->insertStyleSheet(qApp, appSs);
         }
-        styleSelector.styleSheets += appSs;
+        styleSelector.styleSheets += addStyleSheet(appCacheIt);
     }
 
     QVector<QCss::StyleSheet> objectSs;
@@ -1606,9 +1723,9 @@ QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
         QString styleSheet = o->property("styleSheet").toString();
         if (styleSheet.isEmpty())
             continue;
-        StyleSheet ss;
-        QHash<const void *, StyleSheet>::const_iterator objCacheIt = styleSheetCaches->styleSheetCache.constFind(o);
+        ParsedStyleSheetIterator objCacheIt = styleSheetCaches->styleSheetCache.constFind(o);
         if (objCacheIt == styleSheetCaches->styleSheetCache.constEnd()) {
+            StyleSheet ss;
             parser.init(styleSheet);
             if (!parser.parse(&ss)) {
                 parser.init(QLatin1String("* {") + styleSheet + QLatin1Char('}'));
@@ -1616,11 +1733,9 @@ QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
                    qWarning("Could not parse stylesheet of object %p", o);
             }
             ss.origin = StyleSheetOrigin_Inline;
-            styleSheetCaches->styleSheetCache.insert(o, ss);
-        } else {
-            ss = objCacheIt.value();
+            objCacheIt = styleSheetCaches->insertStyleSheet(o, ss);
         }
-        objectSs.append(ss);
+        objectSs.append(addStyleSheet(objCacheIt));
     }
 
     for (int i = 0; i < objectSs.count(); i++)
@@ -1630,8 +1745,30 @@ QVector<QCss::StyleRule> QStyleSheetStyle::styleRules(const QObject *obj) const
 
     StyleSelector::NodePtr n;
     n.ptr = const_cast<QObject *>(obj);
+
+    if (simpleSelectors) {
+        sharedKey += QLatin1Char(';') + QString::number(quintptr(obj->metaObject()), 16)
+                     + QLatin1Char(';') + obj->objectName();
+        for (const QString &attribute : qAsConst(attributes)) {
+            const QString value = styleSelector.attribute(n, attribute);
+            sharedKey += QLatin1Char(';') + attribute
+                         + (value.isNull() ? QLatin1String("!") : QLatin1String("=")) + value;
+        }
+        QHash<QString, QVector<StyleRule> >::const_iterator sharedIt = styleSheetCaches->sharedStyleRulesCache.constFind(sharedKey);
+        if (sharedIt != styleSheetCaches->sharedStyleRulesCache.constEnd()) {
+            styleSheetCaches->styleRulesCache.insert(obj, sharedIt.value());
+            return sharedIt.value();
+        }
+    }
+
     QVector<QCss::StyleRule> rules = styleSelector.styleRulesForNode(n);
     styleSheetCaches->styleRulesCache.insert(obj, rules);
+    if (simpleSelectors) {
+        // ids of style sheets that were parsed again never come back, so drop them now and then
+        if (styleSheetCaches->sharedStyleRulesCache.size() >= 4096)
+            styleSheetCaches->sharedStyleRulesCache.clear();
+        styleSheetCaches->sharedStyleRulesCache.insert(sharedKey, rules);
+    }
     return rules;
 }
 
@@ -2891,6 +3028,7 @@ void QStyleSheetStyle::repolish(QApplication *app)
     const QList<const QObject*> allObjects = styleSheetCaches->styleRulesCache.keys();
     styleSheetCaches->styleSheetCache.remove(qApp);
     styleSheetCaches->styleRulesCache.clear();
+    styleSheetCaches->sharedStyleRulesCache.clear();
     styleSheetCaches->hasStyleRuleCache.clear();
     styleSheetCaches->renderRulesCache.clear();
     updateObjects(allObjects);
@@ -2930,6 +3068,7 @@ void QStyleSheetStyle::unpolish(QApplication *app)
     baseStyle()->unpolish(app);
     RECURSION_GUARD(return)
     styleSheetCaches->styleRulesCache.clear();
+    styleSheetCaches->sharedStyleRulesCache.clear();
     styleSheetCaches->hasStyleRuleCache.clear();
     styleSheetCaches->renderRulesCache.clear();
     styleSheetCaches->styleSheetCache.remove(qApp);
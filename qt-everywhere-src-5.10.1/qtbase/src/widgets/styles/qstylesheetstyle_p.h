@@ -187,7 +187,17 @@ public:
     QHash<const QObject *, QHash<int, bool> > hasStyleRuleCache;
     typedef QHash<int, QHash<quint64, QRenderRule> > QRenderRules;
     QHash<const QObject *, QRenderRules> renderRulesCache;
-    QHash<const void *, QCss::StyleSheet> styleSheetCache; // parsed style sheets
+    struct ParsedStyleSheet {
+        QCss::StyleSheet styleSheet;
+        int id; // new for every parse, so it identifies the style sheet's contents
+        bool simpleSelectors; // matching doesn't depend on the parents or siblings
+        QStringList attributes; // the property names used by attribute selectors
+    };
+    QHash<const void *, ParsedStyleSheet> styleSheetCache; // parsed style sheets
+    QHash<const void *, ParsedStyleSheet>::const_iterator insertStyleSheet(const void *key, const QCss::StyleSheet &styleSheet);
+    // rules of objects that only simple selectors apply to, by style sheet ids, class, name and attributes
+    QHash<QString, QVector<QCss::StyleRule> > sharedStyleRulesCache;
+    int lastStyleSheetId = 0;
     QSet<const QWidget *> autoFillDisabledWidgets;
     // widgets with whose palettes and fonts we have tampered:
     template <typename T>
@@ -49,6 +49,7 @@
 #include <qiodevice.h>
 #include <qlist.h>
 #include <qregexp.h>
+#include <qset.h>
 #include <qtextcodec.h>
 #include <qtextstream.h>
 #include <qxml.h>
@@ -608,6 +609,9 @@ public:
     int errorColumn;
 
 private:
+    QString internedName(const QString &name);
+    void internNames(QDomNodePrivate *n);
+
     QDomDocumentPrivate *doc;
     QDomNodePrivate *node;
     QString entityName;
@@ -615,6 +619,9 @@ private:
     bool nsProcessing;
     QXmlLocator *locator;
     QXmlSimpleReader *reader;
+    // Element and attribute names and namespace URIs seen so far. Nodes
+    // share the string data, as documents typically repeat few names.
+    QSet<QString> names;
 };
 
 /**************************************************************
@@ -7391,19 +7398,39 @@ bool QDomHandler::startDTD(const QString& name, const QString& publicId, const Q
     return true;
 }
 
+QString QDomHandler::internedName(const QString &name)
+{
+    if (name.isEmpty())
+        return name;
+    return *names.insert(name);
+}
+
+/*
+    Prefixed names are split into new strings when a node is created,
+    replace them with the shared ones.
+*/
+void QDomHandler::internNames(QDomNodePrivate *n)
+{
+    if (!n->prefix.isEmpty()) {
+        n->prefix = internedName(n->prefix);
+        n->name = internedName(n->name);
+    }
+}
+
 bool QDomHandler::startElement(const QString& nsURI, const QString&, const QString& qName, const QXmlAttributes& atts)
 {
     // tag name
     QDomNodePrivate* n;
     if (nsProcessing) {
-        n = doc->createElementNS(nsURI, qName);
+        n = doc->createElementNS(internedName(nsURI), internedName(qName));
     } else {
-        n = doc->createElement(qName);
+        n = doc->createElement(internedName(qName));
     }
 
     if (!n)
         return false;
 
+    internNames(n);
     n->setLocation(locator->lineNumber(), locator->columnNumber());
 
     node->appendChild(n);
@@ -7413,12 +7440,18 @@ bool QDomHandler::startElement(const QString& nsURI, const QString&, const QStri
     for (int i=0; i<atts.length(); i++)
     {
         if (nsProcessing) {
-            ((QDomElementPrivate*)node)->setAttributeNS(atts.uri(i), atts.qName(i), atts.value(i));
+            ((QDomElementPrivate*)node)->setAttributeNS(internedName(atts.uri(i)), internedName(atts.qName(i)), atts.value(i));
         } else {
-            ((QDomElementPrivate*)node)->setAttribute(atts.qName(i), atts.value(i));
+            ((QDomElementPrivate*)node)->setAttribute(internedName(atts.qName(i)), atts.value(i));
         }
     }
 
+    if (nsProcessing) {
+        const QHash<QString, QDomNodePrivate *> &attributes = ((QDomElementPrivate*)node)->m_attr->map;
+        for (QDomNodePrivate *attribute : attributes)
+            internNames(attribute);
+    }
+
     return true;
 }
 
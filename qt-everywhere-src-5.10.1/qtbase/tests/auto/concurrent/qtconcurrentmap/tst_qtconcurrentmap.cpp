@@ -46,6 +46,7 @@ private slots:
     void blocking_mapped();
     void mappedReduced();
     void blocking_mappedReduced();
+    void blocking_mapReduce();
     void assignResult();
     void functionOverloads();
     void noExceptFunctionOverloads();
@@ -2002,6 +2003,67 @@ void tst_QtConcurrentMap::blocking_mappedReduced()
     // ### the same as above, with an initial result value
 }
 
+void intAppendReduce(QVector<int> &result, int value)
+{
+    result.append(value);
+}
+
+void intVectorCombine(QVector<int> &result, const QVector<int> &other)
+{
+    result += other;
+}
+
+void tst_QtConcurrentMap::blocking_mapReduce()
+{
+    QList<int> list;
+    list << 1 << 2 << 3;
+    QLinkedList<int> linkedList;
+    linkedList << 1 << 2 << 3;
+
+    {
+        int sum = QtConcurrent::blockingMapReduce<int>(list, IntSquare(), IntSumReduce());
+        QCOMPARE(sum, 14);
+        int sum2 = QtConcurrent::blockingMapReduce<int>(list.constBegin(),
+                                                        list.constEnd(),
+                                                        intSquare,
+                                                        intSumReduce);
+        QCOMPARE(sum2, 14);
+        int sum3 = QtConcurrent::blockingMapReduce<int>(linkedList, intSquare, intSumReduce);
+        QCOMPARE(sum3, 14);
+    }
+
+    // empty sequences produce the default constructed value
+    {
+        int sum = QtConcurrent::blockingMapReduce<int>(QList<int>(), intSquare, intSumReduce);
+        QCOMPARE(sum, 0);
+    }
+
+    // more items than threads, with a separate combine function; the
+    // accumulators are combined in sequence order
+    {
+        const int count = 100000;
+        QVector<int> vector;
+        vector.reserve(count);
+        for (int i = 0; i < count; ++i)
+            vector.append(i);
+
+        const QVector<int> result = QtConcurrent::blockingMapReduce<QVector<int> >(vector,
+                                                                                  intSquare,
+                                                                                  intAppendReduce,
+                                                                                  intVectorCombine);
+        QCOMPARE(result.size(), count);
+        for (int i = 0; i < count; ++i)
+            QCOMPARE(result.at(i), i * i);
+
+        const QVector<int> result2 = QtConcurrent::blockingMapReduce<QVector<int> >(vector.constBegin(),
+                                                                                   vector.constEnd(),
+                                                                                   intSquare,
+                                                                                   intAppendReduce,
+                                                                                   intVectorCombine);
+        QCOMPARE(result2, result);
+    }
+}
+
 int sleeper(int val)
 {
     QTest::qSleep(100);
@@ -166,6 +166,14 @@ void tst_Utf8::roundTrip()
 
     QCOMPARE(to8Bit(from8Bit(utf8)), utf8);
     QCOMPARE(from8Bit(to8Bit(utf16)), utf16);
+
+    // and surrounded by enough multibyte text for the SIMD decoders to kick in
+    const QString multibyte = QString::fromUtf8("\320\237\321\200\320\270\320\262\320\265\321\202 "
+                                                "\344\270\255\346\226\207 \303\251t\303\251 ");
+    utf8 = to8Bit(multibyte) + utf8 + to8Bit(multibyte);
+    utf16 = multibyte + utf16 + multibyte;
+    QCOMPARE(to8Bit(utf16), utf8);
+    QCOMPARE(from8Bit(utf8), utf16);
 }
 
 void tst_Utf8::charByChar_data()
@@ -230,6 +238,16 @@ void tst_Utf8::invalidUtf8()
         QVERIFY(decoder->hasFailure());
     else if (!decoder->hasFailure())
         qWarning("System codec does not report failure when it should. Should report bug upstream.");
+
+    // the SIMD decoders must not accept it either when it's in the middle of valid text
+    if (!useLocale) {
+        const QByteArray multibyte("\320\237\321\200\320\270\320\262\320\265\321\202 "
+                                   "\344\270\255\346\226\207 \303\251t\303\251 ");
+        const QScopedPointer<QTextDecoder> embeddedDecoder(codec->makeDecoder());
+        embeddedDecoder->toUnicode(multibyte + utf8 + multibyte);
+        QVERIFY(embeddedDecoder->hasFailure());
+        QVERIFY(QString::fromUtf8(multibyte + utf8 + multibyte).contains(QChar(QChar::ReplacementCharacter)));
+    }
 }
 
 void tst_Utf8::nonCharacters_data()
@@ -0,0 +1,184 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCore/QAsyncFile>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QThreadPool>
+
+class tst_QAsyncFile : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void openModes();
+    void readWrite();
+    void concurrentReads();
+    void readPastEnd();
+    void notOpen();
+    void futureWatcher();
+    void closeWaits();
+
+private:
+    QTemporaryDir m_temporaryDir;
+};
+
+void tst_QAsyncFile::initTestCase()
+{
+    QVERIFY2(m_temporaryDir.isValid(), qPrintable(m_temporaryDir.errorString()));
+}
+
+void tst_QAsyncFile::openModes()
+{
+    QAsyncFile file(m_temporaryDir.filePath(QStringLiteral("modes")));
+    QVERIFY(!file.isOpen());
+
+    QTest::ignoreMessage(QtWarningMsg, "QAsyncFile::open: Append and Text modes are not supported");
+    QVERIFY(!file.open(QIODevice::WriteOnly | QIODevice::Append));
+
+    QVERIFY(file.open(QIODevice::ReadWrite));
+    QVERIFY(file.isOpen());
+    QCOMPARE(file.openMode(), QIODevice::ReadWrite);
+    file.close();
+    QVERIFY(!file.isOpen());
+
+    QAsyncFile missing(m_temporaryDir.filePath(QStringLiteral("missing/file")));
+    QVERIFY(!missing.open(QIODevice::ReadOnly));
+    QCOMPARE(missing.error(), QFileDevice::OpenError);
+}
+
+void tst_QAsyncFile::readWrite()
+{
+    QAsyncFile file(m_temporaryDir.filePath(QStringLiteral("readwrite")));
+    QVERIFY(file.open(QIODevice::ReadWrite | QIODevice::Truncate));
+
+    QFuture<qint64> first = file.write(0, QByteArray("Hello"));
+    QFuture<qint64> second = file.write(10, QByteArray("World"));
+    QCOMPARE(first.result(), qint64(5));
+    QCOMPARE(second.result(), qint64(5));
+    QCOMPARE(file.size(), qint64(15));
+
+    QCOMPARE(file.read(0, 5).result(), QByteArray("Hello"));
+    QCOMPARE(file.read(10, 100).result(), QByteArray("World"));
+    QCOMPARE(file.read(5, 5).result(), QByteArray(5, '\0'));
+    file.close();
+
+    QFile check(file.fileName());
+    QVERIFY(check.open(QIODevice::ReadOnly));
+    QCOMPARE(check.readAll(), QByteArray("Hello\0\0\0\0\0World", 15));
+}
+
+void tst_QAsyncFile::concurrentReads()
+{
+    const int blockSize = 4096;
+    const int blockCount = 64;
+    const QString fileName = m_temporaryDir.filePath(QStringLiteral("blocks"));
+    {
+        QFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        for (int i = 0; i < blockCount; ++i)
+            QCOMPARE(file.write(QByteArray(blockSize, char('A' + i % 26))), qint64(blockSize));
+    }
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(4);
+    QAsyncFile file(fileName);
+    file.setThreadPool(&pool);
+    QCOMPARE(file.threadPool(), &pool);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+
+    QVector<QFuture<QByteArray> > futures;
+    for (int i = blockCount - 1; i >= 0; --i)
+        futures.append(file.read(qint64(i) * blockSize, blockSize));
+    file.waitForPendingOperations();
+    QCOMPARE(file.pendingOperations(), 0);
+
+    for (int i = 0; i < blockCount; ++i) {
+        const int block = blockCount - 1 - i;
+        QVERIFY(futures.at(i).isFinished());
+        QCOMPARE(futures.at(i).result(), QByteArray(blockSize, char('A' + block % 26)));
+    }
+}
+
+void tst_QAsyncFile::readPastEnd()
+{
+    QAsyncFile file(m_temporaryDir.filePath(QStringLiteral("short")));
+    QVERIFY(file.open(QIODevice::ReadWrite | QIODevice::Truncate));
+    QCOMPARE(file.write(0, QByteArray("abc")).result(), qint64(3));
+
+    QCOMPARE(file.read(1, 1000).result(), QByteArray("bc"));
+    QVERIFY(file.read(3, 10).result().isEmpty());
+    QVERIFY(file.read(100, 10).result().isEmpty());
+    QVERIFY(file.read(-1, 10).result().isEmpty());
+}
+
+void tst_QAsyncFile::notOpen()
+{
+    QAsyncFile file(m_temporaryDir.filePath(QStringLiteral("notopen")));
+    QFuture<QByteArray> read = file.read(0, 10);
+    QVERIFY(read.isFinished());
+    QVERIFY(read.result().isEmpty());
+    QFuture<qint64> write = file.write(0, QByteArray("x"));
+    QVERIFY(write.isFinished());
+    QCOMPARE(write.result(), qint64(-1));
+
+    QVERIFY(file.open(QIODevice::WriteOnly));
+    QVERIFY(file.read(0, 10).result().isEmpty());
+}
+
+void tst_QAsyncFile::futureWatcher()
+{
+    QAsyncFile file(m_temporaryDir.filePath(QStringLiteral("watcher")));
+    QVERIFY(file.open(QIODevice::ReadWrite | QIODevice::Truncate));
+    QCOMPARE(file.write(0, QByteArray("watched")).result(), qint64(7));
+
+    QFutureWatcher<QByteArray> watcher;
+    QSignalSpy spy(&watcher, &QFutureWatcher<QByteArray>::finished);
+    watcher.setFuture(file.read(0, 7));
+    QTRY_COMPARE(spy.count(), 1);
+    QCOMPARE(watcher.result(), QByteArray("watched"));
+}
+
+void tst_QAsyncFile::closeWaits()
+{
+    const QString fileName = m_temporaryDir.filePath(QStringLiteral("close"));
+    const QByteArray block(1024 * 1024, 'z');
+    {
+        QAsyncFile file(fileName);
+        QVERIFY(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        for (int i = 0; i < 8; ++i)
+            file.write(qint64(i) * block.size(), block);
+        // the destructor must not close the file under the writes
+    }
+    QCOMPARE(QFileInfo(fileName).size(), qint64(8) * block.size());
+}
+
+QTEST_MAIN(tst_QAsyncFile)
+#include "tst_qasyncfile.moc"
@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qcompressiondevice
+QT = core testlib
+SOURCES = tst_qcompressiondevice.cpp
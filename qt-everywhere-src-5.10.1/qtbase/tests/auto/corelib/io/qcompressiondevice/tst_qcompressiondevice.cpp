@@ -0,0 +1,326 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/QBuffer>
+#include <QtCore/QCompressionDevice>
+
+// A sequential device that only hands out the data made available so far.
+class PartialDevice : public QIODevice
+{
+public:
+    explicit PartialDevice(const QByteArray &data)
+        : m_data(data), m_pos(0), m_available(0)
+    {}
+
+    void makeAvailable(int bytes)
+    {
+        m_available = qMin(m_available + bytes, m_data.size());
+        emit readyRead();
+    }
+
+    bool isSequential() const override { return true; }
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) override
+    {
+        const int size = int(qMin<qint64>(maxSize, m_available - m_pos));
+        memcpy(data, m_data.constData() + m_pos, size);
+        m_pos += size;
+        return size;
+    }
+    qint64 writeData(const char *, qint64) override { return -1; }
+
+private:
+    QByteArray m_data;
+    int m_pos;
+    int m_available;
+};
+
+class tst_QCompressionDevice : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void roundTrip_data();
+    void roundTrip();
+    void compatibleWithQCompress();
+    void autoDetect_data();
+    void autoDetect();
+    void levelsAndStrategies();
+    void flush();
+    void sequentialSource();
+    void truncatedInput();
+    void corruptInput();
+    void openModes();
+
+private:
+    static QByteArray compress(const QByteArray &data, QCompressionDevice::Format format,
+                               int chunkSize = 64 * 1024);
+    static QByteArray decompress(const QByteArray &data, QCompressionDevice::Format format,
+                                 int chunkSize = 64 * 1024);
+
+    QByteArray m_text;
+};
+
+QByteArray tst_QCompressionDevice::compress(const QByteArray &data, QCompressionDevice::Format format,
+                                            int chunkSize)
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QCompressionDevice device(&buffer, format);
+    device.setChunkSize(chunkSize);
+    if (!device.open(QIODevice::WriteOnly) || device.write(data) != data.size())
+        return QByteArray();
+    device.close();
+    return buffer.data();
+}
+
+QByteArray tst_QCompressionDevice::decompress(const QByteArray &data, QCompressionDevice::Format format,
+                                              int chunkSize)
+{
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+    QCompressionDevice device(&buffer, format);
+    device.setChunkSize(chunkSize);
+    if (!device.open(QIODevice::ReadOnly))
+        return QByteArray();
+    const QByteArray result = device.readAll();
+    return device.atEnd() ? result : QByteArray();
+}
+
+void tst_QCompressionDevice::initTestCase()
+{
+    for (int i = 0; i < 20000; ++i)
+        m_text += "line " + QByteArray::number(i) + ": the quick brown fox jumps over the lazy dog\n";
+}
+
+void tst_QCompressionDevice::roundTrip_data()
+{
+    QTest::addColumn<QCompressionDevice::Format>("format");
+    QTest::addColumn<int>("chunkSize");
+
+    QTest::newRow("zlib") << QCompressionDevice::Zlib << 64 * 1024;
+    QTest::newRow("gzip") << QCompressionDevice::Gzip << 64 * 1024;
+    QTest::newRow("raw") << QCompressionDevice::RawDeflate << 64 * 1024;
+    QTest::newRow("zlib-small-chunks") << QCompressionDevice::Zlib << 7;
+    QTest::newRow("gzip-small-chunks") << QCompressionDevice::Gzip << 100;
+}
+
+void tst_QCompressionDevice::roundTrip()
+{
+    QFETCH(QCompressionDevice::Format, format);
+    QFETCH(int, chunkSize);
+
+    const QByteArray compressed = compress(m_text, format, chunkSize);
+    QVERIFY(!compressed.isEmpty());
+    QVERIFY(compressed.size() < m_text.size() / 4);
+    QCOMPARE(decompress(compressed, format, chunkSize), m_text);
+
+    QCOMPARE(decompress(compress(QByteArray(), format), format), QByteArray());
+}
+
+void tst_QCompressionDevice::compatibleWithQCompress()
+{
+    // qCompress() prefixes the zlib stream with the uncompressed size
+    const QByteArray qcompressed = qCompress(m_text);
+    QCOMPARE(decompress(qcompressed.mid(4), QCompressionDevice::Zlib), m_text);
+
+    const QByteArray compressed = compress(m_text, QCompressionDevice::Zlib);
+    QByteArray prefixed(4, '\0');
+    qToBigEndian<quint32>(m_text.size(), prefixed.data());
+    QCOMPARE(qUncompress(prefixed + compressed), m_text);
+}
+
+void tst_QCompressionDevice::autoDetect_data()
+{
+    QTest::addColumn<QCompressionDevice::Format>("format");
+
+    QTest::newRow("zlib") << QCompressionDevice::Zlib;
+    QTest::newRow("gzip") << QCompressionDevice::Gzip;
+    QTest::newRow("raw") << QCompressionDevice::RawDeflate;
+}
+
+void tst_QCompressionDevice::autoDetect()
+{
+    QFETCH(QCompressionDevice::Format, format);
+
+    const QByteArray compressed = compress(m_text, format);
+    QCOMPARE(decompress(compressed, QCompressionDevice::AutoDetect), m_text);
+}
+
+void tst_QCompressionDevice::levelsAndStrategies()
+{
+    QBuffer fast;
+    fast.open(QIODevice::WriteOnly);
+    QCompressionDevice fastDevice(&fast);
+    fastDevice.setCompressionLevel(1);
+    QCOMPARE(fastDevice.compressionLevel(), 1);
+    QVERIFY(fastDevice.open(QIODevice::WriteOnly));
+    fastDevice.write(m_text);
+    fastDevice.close();
+
+    QBuffer stored;
+    stored.open(QIODevice::WriteOnly);
+    QCompressionDevice storedDevice(&stored);
+    storedDevice.setCompressionLevel(0);
+    QVERIFY(storedDevice.open(QIODevice::WriteOnly));
+    storedDevice.write(m_text);
+    storedDevice.close();
+
+    QBuffer huffman;
+    huffman.open(QIODevice::WriteOnly);
+    QCompressionDevice huffmanDevice(&huffman);
+    huffmanDevice.setStrategy(QCompressionDevice::HuffmanOnlyStrategy);
+    QCOMPARE(huffmanDevice.strategy(), QCompressionDevice::HuffmanOnlyStrategy);
+    QVERIFY(huffmanDevice.open(QIODevice::WriteOnly));
+    huffmanDevice.write(m_text);
+    huffmanDevice.close();
+
+    QVERIFY(stored.size() > m_text.size());
+    QVERIFY(fast.size() < huffman.size());
+    QCOMPARE(decompress(fast.data(), QCompressionDevice::Zlib), m_text);
+    QCOMPARE(decompress(stored.data(), QCompressionDevice::Zlib), m_text);
+    QCOMPARE(decompress(huffman.data(), QCompressionDevice::Zlib), m_text);
+
+    QCompressionDevice device;
+    device.setCompressionLevel(42);
+    QCOMPARE(device.compressionLevel(), 9);
+    device.setCompressionLevel(-5);
+    QCOMPARE(device.compressionLevel(), -1);
+}
+
+void tst_QCompressionDevice::flush()
+{
+    QBuffer buffer;
+    buffer.open(QIODevice::WriteOnly);
+    QCompressionDevice device(&buffer, QCompressionDevice::Gzip);
+    QVERIFY(device.open(QIODevice::WriteOnly));
+
+    const QByteArray first = "first message";
+    QCOMPARE(device.write(first), qint64(first.size()));
+    QVERIFY(device.flush());
+
+    // everything written so far can be decoded before the stream ends
+    QBuffer reader;
+    reader.setData(buffer.data());
+    reader.open(QIODevice::ReadOnly);
+    QCompressionDevice readDevice(&reader, QCompressionDevice::Gzip);
+    QVERIFY(readDevice.open(QIODevice::ReadOnly));
+    QCOMPARE(readDevice.read(first.size()), first);
+    QVERIFY(!readDevice.atEnd());
+
+    device.write("second message");
+    device.close();
+    QCOMPARE(decompress(buffer.data(), QCompressionDevice::Gzip), QByteArray("first messagesecond message"));
+}
+
+void tst_QCompressionDevice::sequentialSource()
+{
+    const QByteArray compressed = compress(m_text, QCompressionDevice::Gzip);
+    PartialDevice source(compressed);
+    source.open(QIODevice::ReadOnly);
+
+    QCompressionDevice device(&source, QCompressionDevice::AutoDetect);
+    QSignalSpy readyReadSpy(&device, &QIODevice::readyRead);
+    QVERIFY(device.open(QIODevice::ReadOnly));
+    QVERIFY(device.isSequential());
+
+    QByteArray result;
+    const int step = compressed.size() / 5 + 1;
+    for (int i = 0; i < 5; ++i) {
+        source.makeAvailable(step);
+        result += device.readAll();
+        QCOMPARE(device.atEnd(), i == 4);
+    }
+    QCOMPARE(readyReadSpy.count(), 5);
+    QVERIFY(device.atEnd());
+    QCOMPARE(result, m_text);
+}
+
+void tst_QCompressionDevice::truncatedInput()
+{
+    const QByteArray compressed = compress(m_text, QCompressionDevice::Zlib);
+
+    QBuffer buffer;
+    buffer.setData(compressed.left(compressed.size() / 2));
+    buffer.open(QIODevice::ReadOnly);
+    QCompressionDevice device(&buffer);
+    QVERIFY(device.open(QIODevice::ReadOnly));
+    const QByteArray result = device.readAll();
+    QVERIFY(result.size() < m_text.size());
+    QVERIFY(m_text.startsWith(result));
+    QVERIFY(!device.atEnd());
+    QCOMPARE(device.errorString(), QLatin1String("Unexpected end of compressed data"));
+}
+
+void tst_QCompressionDevice::corruptInput()
+{
+    QByteArray compressed = compress(m_text, QCompressionDevice::Gzip);
+    compressed[0] = 'X';
+
+    QBuffer buffer;
+    buffer.setData(compressed);
+    buffer.open(QIODevice::ReadOnly);
+    QCompressionDevice device(&buffer, QCompressionDevice::Gzip);
+    QVERIFY(device.open(QIODevice::ReadOnly));
+    QVERIFY(device.readAll().isEmpty());
+    QVERIFY(!device.atEnd());
+    QVERIFY(!device.errorString().isEmpty());
+}
+
+void tst_QCompressionDevice::openModes()
+{
+    QBuffer buffer;
+    QCompressionDevice device(&buffer);
+
+    QTest::ignoreMessage(QtWarningMsg, "QCompressionDevice::open: Open mode must be either ReadOnly or WriteOnly");
+    QVERIFY(!device.open(QIODevice::ReadWrite));
+
+    // the underlying device is not opened implicitly
+    QVERIFY(!device.open(QIODevice::ReadOnly));
+    QCOMPARE(device.errorString(), QLatin1String("Underlying device is not open for reading"));
+
+    buffer.open(QIODevice::WriteOnly);
+    QVERIFY(!device.open(QIODevice::ReadOnly));
+    QVERIFY(device.open(QIODevice::WriteOnly));
+
+    QTest::ignoreMessage(QtWarningMsg, "QCompressionDevice::setDevice: Cannot change the device while open");
+    device.setDevice(Q_NULLPTR);
+    QCOMPARE(device.device(), &buffer);
+
+    device.close();
+    QVERIFY(!device.isOpen());
+    QVERIFY(buffer.isOpen());
+    QVERIFY(!buffer.data().isEmpty());
+}
+
+QTEST_MAIN(tst_QCompressionDevice)
+#include "tst_qcompressiondevice.moc"
@@ -34,6 +34,8 @@
 #include <qdiriterator.h>
 #include <qfileinfo.h>
 #include <qstringlist.h>
+#include <qmutex.h>
+#include <qthreadpool.h>
 
 #include <QtCore/private/qfsfileengine_p.h>
 
@@ -100,6 +102,8 @@ private slots:
 #endif
     void absoluteFilePathsFromRelativeIteratorPath();
     void recurseWithFilters() const;
+    void fastScan() const;
+    void walk() const;
     void longPath();
     void dirorder();
     void relativePaths();
@@ -539,6 +543,49 @@ void tst_QDirIterator::recurseWithFilters() const
     QVERIFY(!it.hasNext());
 }
 
+void tst_QDirIterator::fastScan() const
+{
+    QDirIterator it("recursiveDirs/", QStringList("*.txt"), QDir::Files,
+                    QDirIterator::Subdirectories | QDirIterator::FastScan);
+
+    QSet<QString> actualEntries;
+    while (it.hasNext())
+        actualEntries.insert(it.next());
+
+    QSet<QString> expectedEntries;
+    expectedEntries.insert(QString::fromLatin1("recursiveDirs/dir1/textFileB.txt"));
+    expectedEntries.insert(QString::fromLatin1("recursiveDirs/textFileA.txt"));
+    QCOMPARE(actualEntries, expectedEntries);
+}
+
+void tst_QDirIterator::walk() const
+{
+    QThreadPool pool;
+    pool.setMaxThreadCount(2);
+
+    QMutex mutex;
+    QSet<QString> actualEntries;
+    QDirIterator::walk("recursiveDirs", QStringList(), QDir::AllEntries | QDir::NoDotAndDotDot,
+                       QDirIterator::FastScan, [&](const QFileInfo &fileInfo) {
+        QMutexLocker locker(&mutex);
+        actualEntries.insert(fileInfo.filePath());
+    }, &pool);
+
+    QSet<QString> expectedEntries;
+    QDirIterator it("recursiveDirs", QDir::AllEntries | QDir::NoDotAndDotDot,
+                    QDirIterator::Subdirectories);
+    while (it.hasNext())
+        expectedEntries.insert(it.next());
+    QCOMPARE(expectedEntries.size(), 4);
+    QCOMPARE(actualEntries, expectedEntries);
+
+    // no entries, no calls
+    int calls = 0;
+    QDirIterator::walk("empty", QStringList(), QDir::AllEntries | QDir::NoDotAndDotDot,
+                       QDirIterator::NoIteratorFlags, [&calls](const QFileInfo &) { ++calls; }, &pool);
+    QCOMPARE(calls, 0);
+}
+
 void tst_QDirIterator::longPath()
 {
     QDir dir;
@@ -250,6 +250,7 @@ private slots:
     void mapOpenMode();
     void mapWrittenFile_data();
     void mapWrittenFile();
+    void accessPatternHints();
 
     void openStandardStreamsFileDescriptors();
     void openStandardStreamsBufferedStreams();
@@ -3224,6 +3225,50 @@ void tst_QFile::mapWrittenFile()
     file.remove();
 }
 
+void tst_QFile::accessPatternHints()
+{
+    // large enough to be read through a mapping on platforms supporting it
+    const qint64 size = Q_INT64_C(64) * 1024 * 1024 + 4097;
+    const qint64 markers[] = { 0, 16 * 1024 * 1024 - 3, 40 * 1024 * 1024 + 11, size - 8 };
+    const QByteArray marker("QtMarker");
+
+    QTemporaryFile tmp;
+    QVERIFY(tmp.open());
+    QVERIFY(tmp.resize(size));
+    for (qint64 offset : markers) {
+        QVERIFY(tmp.seek(offset));
+        QCOMPARE(tmp.write(marker), qint64(marker.size()));
+    }
+    tmp.close();
+
+    QFile file(tmp.fileName());
+    QCOMPARE(file.accessPatternHints(), QFile::NoAccessPatternHint);
+    file.setAccessPatternHints(QFile::SequentialAccessHint | QFile::NoReuseHint);
+    QCOMPARE(file.accessPatternHints(), QFile::SequentialAccessHint | QFile::NoReuseHint);
+    QVERIFY2(file.open(QIODevice::ReadOnly), msgOpenFailed(file).constData());
+
+    QByteArray contents;
+    contents.reserve(int(size));
+    while (!file.atEnd()) {
+        const QByteArray chunk = file.read(3 * 1024 * 1024 + 5);
+        QVERIFY(!chunk.isEmpty());
+        contents += chunk;
+    }
+    QCOMPARE(qint64(contents.size()), size);
+    for (qint64 offset : markers)
+        QCOMPARE(contents.mid(int(offset), marker.size()), marker);
+    QCOMPARE(contents.at(int(markers[1]) - 1), '\0');
+
+    // seeking backwards must not return stale data
+    QVERIFY(file.seek(markers[2]));
+    QCOMPARE(file.read(marker.size()), marker);
+
+    // changing the hints on an open file is fine as well
+    file.setAccessPatternHints(QFile::RandomAccessHint);
+    QVERIFY(file.seek(markers[1]));
+    QCOMPARE(file.read(marker.size()), marker);
+}
+
 void tst_QFile::openDirectory()
 {
     QFile f1(m_resourcesDir);
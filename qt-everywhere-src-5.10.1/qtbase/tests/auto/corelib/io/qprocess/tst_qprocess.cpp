@@ -39,6 +39,9 @@
 #include <QtCore/QMetaType>
 #include <QtNetwork/QHostInfo>
 #include <stdlib.h>
+#ifdef Q_OS_UNIX
+#  include <unistd.h>
+#endif
 
 typedef void (QProcess::*QProcessFinishedSignal1)(int);
 typedef void (QProcess::*QProcessFinishedSignal2)(int, QProcess::ExitStatus);
@@ -109,6 +112,9 @@ private slots:
     void discardUnwantedOutput();
     void setWorkingDirectory();
     void setNonExistentWorkingDirectory();
+#ifdef Q_OS_UNIX
+    void setupChildProcess();
+#endif
 
     void exitStatus_data();
     void exitStatus();
@@ -2246,6 +2252,27 @@ void tst_QProcess::setNonExistentWorkingDirectory()
 #endif
 }
 
+#ifdef Q_OS_UNIX
+class SetupChildProcess : public QProcess
+{
+protected:
+    void setupChildProcess() Q_DECL_OVERRIDE
+    {
+        ::_exit(42);
+    }
+};
+
+void tst_QProcess::setupChildProcess()
+{
+    // a process that needs setupChildProcess() must not be spawned without it
+    SetupChildProcess process;
+    process.start("testProcessNormal/testProcessNormal");
+    QVERIFY2(process.waitForFinished(5000), qPrintable(process.errorString()));
+    QCOMPARE(process.exitStatus(), QProcess::NormalExit);
+    QCOMPARE(process.exitCode(), 42);
+}
+#endif
+
 void tst_QProcess::startFinishStartFinish()
 {
     QProcess process;
@@ -187,6 +187,7 @@ private slots:
     void bom();
     void embeddedZeroByte_data();
     void embeddedZeroByte();
+    void backgroundSync();
 
     void testXdg();
 private:
@@ -708,6 +709,37 @@ void tst_QSettings::iniCodec()
 
 }
 
+void tst_QSettings::backgroundSync()
+{
+    const QString fileName = settingsPath("backgroundsync.ini");
+    QFile::remove(fileName);
+
+    QSettings settings(fileName, QSettings::IniFormat);
+    QVERIFY(!settings.isBackgroundSyncEnabled());
+    settings.setBackgroundSyncEnabled(true);
+    QVERIFY(settings.isBackgroundSyncEnabled());
+
+    for (int i = 0; i < 100; ++i)
+        settings.setValue(QStringLiteral("key%1").arg(i), i);
+    QCOMPARE(QFileInfo(fileName).size(), qint64(0));
+
+    // the changes are written without an explicit sync()
+    QTRY_VERIFY(QFileInfo(fileName).size() > 0);
+
+    // and are visible to other instances right away
+    settings.setValue("late", "value");
+    QCOMPARE(QSettings(fileName, QSettings::IniFormat).value("late").toString(),
+             QStringLiteral("value"));
+
+    settings.sync();
+    QCOMPARE(settings.status(), QSettings::NoError);
+    QFile file(fileName);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    const QByteArray contents = file.readAll();
+    QVERIFY(contents.contains("key99=99"));
+    QVERIFY(contents.contains("late=value"));
+}
+
 void tst_QSettings::bom()
 {
     QSettings s(":/bom.ini", QSettings::IniFormat);
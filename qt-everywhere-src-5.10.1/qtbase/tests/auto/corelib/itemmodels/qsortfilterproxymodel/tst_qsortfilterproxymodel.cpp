@@ -111,6 +111,8 @@ private slots:
     void sortColumnTracking2();
 
     void sortStable();
+    void sortKeyCaching_data();
+    void sortKeyCaching();
 
     void hiddenColumns();
     void insertRowsSort();
@@ -2580,6 +2582,64 @@ void tst_QSortFilterProxyModel::sortStable()
     QCOMPARE(lastItemData, filterModel->index(2,0, firstRoot).data());
 }
 
+void tst_QSortFilterProxyModel::sortKeyCaching_data()
+{
+    QTest::addColumn<Qt::SortOrder>("order");
+    QTest::addColumn<bool>("parallel");
+
+    QTest::newRow("ascending") << Qt::AscendingOrder << false;
+    QTest::newRow("descending") << Qt::DescendingOrder << false;
+    QTest::newRow("ascending-parallel") << Qt::AscendingOrder << true;
+    QTest::newRow("descending-parallel") << Qt::DescendingOrder << true;
+}
+
+static QVector<int> proxyToSourceRows(const QSortFilterProxyModel &proxy)
+{
+    QVector<int> rows;
+    for (int row = 0; row < proxy.rowCount(); ++row)
+        rows.append(proxy.mapToSource(proxy.index(row, 0)).row());
+    return rows;
+}
+
+void tst_QSortFilterProxyModel::sortKeyCaching()
+{
+    QFETCH(Qt::SortOrder, order);
+    QFETCH(bool, parallel);
+
+    // big enough for the parallel sort to split the work, with many equal
+    // keys so that differences in stability would show
+    QStringList strings;
+    for (int i = 0; i < 40000; ++i)
+        strings.append(QString::number((i * 7919) % 997));
+    QStringListModel model(strings);
+
+    QSortFilterProxyModel reference;
+    reference.setSourceModel(&model);
+    reference.sort(0, order);
+
+    QSortFilterProxyModel cached;
+    QVERIFY(!cached.isSortKeyCachingEnabled());
+    QVERIFY(!cached.isParallelSortingEnabled());
+    cached.setSortKeyCachingEnabled(true);
+    cached.setParallelSortingEnabled(parallel);
+    QVERIFY(cached.isSortKeyCachingEnabled());
+    QCOMPARE(cached.isParallelSortingEnabled(), parallel);
+    cached.setSourceModel(&model);
+    cached.sort(0, order);
+
+    QCOMPARE(proxyToSourceRows(cached), proxyToSourceRows(reference));
+
+    // rows inserted into a sorted proxy are placed with the same comparisons
+    QVERIFY(model.insertRows(100, 3));
+    model.setData(model.index(100, 0), QStringLiteral("500"));
+    model.setData(model.index(101, 0), QStringLiteral("0"));
+    model.setData(model.index(102, 0), QStringLiteral("5"));
+    QCOMPARE(proxyToSourceRows(cached), proxyToSourceRows(reference));
+
+    model.setData(model.index(0, 0), QStringLiteral("999"));
+    QCOMPARE(proxyToSourceRows(cached), proxyToSourceRows(reference));
+}
+
 void tst_QSortFilterProxyModel::hiddenColumns()
 {
     class MyStandardItemModel : public QStandardItemModel
@@ -82,6 +82,8 @@ private slots:
     void setData_emits_both_roles();
 
     void supportedDragDropActions();
+
+    void multiData();
 };
 
 void tst_QStringListModel::rowsAboutToBeRemoved_rowsRemoved_data()
@@ -260,4 +262,42 @@ void tst_QStringListModel::supportedDragDropActions()
 }
 
 QTEST_MAIN(tst_QStringListModel)
+void tst_QStringListModel::multiData()
+{
+    QStringListModel model(QStringList() << QStringLiteral("a") << QStringLiteral("b"));
+    const QModelIndex index = model.index(1, 0);
+
+    QModelRoleData roleData[] = {
+        QModelRoleData(Qt::DisplayRole),
+        QModelRoleData(Qt::ToolTipRole),
+        QModelRoleData(Qt::EditRole)
+    };
+    QModelRoleDataSpan span(roleData);
+    QCOMPARE(span.size(), qsizetype(3));
+    index.multiData(span);
+    QCOMPARE(roleData[0].data(), QVariant(QStringLiteral("b")));
+    QVERIFY(!roleData[1].data().isValid());
+    QCOMPARE(roleData[2].data(), QVariant(QStringLiteral("b")));
+    QCOMPARE(*span.dataForRole(Qt::EditRole), QVariant(QStringLiteral("b")));
+
+    // the result matches data() for every role
+    QVector<QModelRoleData> vector;
+    for (int role = 0; role < Qt::UserRole; ++role)
+        vector.append(QModelRoleData(role));
+    model.multiData(model.index(0, 0), vector);
+    for (const QModelRoleData &data : qAsConst(vector))
+        QCOMPARE(data.data(), model.data(model.index(0, 0), data.role()));
+
+    QModelRoleData single(Qt::DisplayRole);
+    single.setData(42);
+    QCOMPARE(single.data(), QVariant(42));
+    model.multiData(index, single);
+    QCOMPARE(single.data(), QVariant(QStringLiteral("b")));
+    single.clearData();
+    QVERIFY(!single.data().isValid());
+
+    QModelIndex().multiData(single); // no model, nothing to do
+    QVERIFY(!single.data().isValid());
+}
+
 #include "tst_qstringlistmodel.moc"
@@ -32,6 +32,8 @@
 #include "qjsonobject.h"
 #include "qjsonvalue.h"
 #include "qjsondocument.h"
+#include "qjsonstreamreader.h"
+#include "qjsonstreamwriter.h"
 #include "qregularexpression.h"
 #include <limits>
 
@@ -151,6 +153,14 @@ private Q_SLOTS:
     void implicitValueType();
     void implicitDocumentType();
 
+    void streamReaderTokens();
+    void streamReaderFile();
+    void streamReaderIncremental();
+    void streamReaderErrors_data();
+    void streamReaderErrors();
+    void streamWriter();
+    void streamWriterDocument();
+
 private:
     QString testDataDir;
 };
@@ -2986,5 +2996,240 @@ void tst_QtJson::implicitDocumentType()
     QCOMPARE(arrayDocument[-1].toInt(123), 123);
 }
 
+void tst_QtJson::streamReaderTokens()
+{
+    const QByteArray json = "{ \"a\": [1, -2.5e2, true, false, null],"
+                            " \"b\\u00e9\": \"x\\ty\", \"c\": {}, \"" UNICODE_DJE "\": \"" UNICODE_DJE "\" }";
+    QJsonStreamReader reader(json);
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::NoToken);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.depth(), 0);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.name(), QLatin1String("a"));
+    QCOMPARE(reader.depth(), 1);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Double);
+    QVERIFY(reader.name().isEmpty());
+    QCOMPARE(reader.doubleValue(), 1.);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Double);
+    QCOMPARE(reader.doubleValue(), -250.);
+    QCOMPARE(reader.depth(), 2);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+    QCOMPARE(reader.boolValue(), true);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Bool);
+    QCOMPARE(reader.boolValue(), false);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::Null);
+    QCOMPARE(reader.value(), QJsonValue(QJsonValue::Null));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.depth(), 1);
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.name(), QString::fromUtf8("b\xc3\xa9"));
+    QCOMPARE(reader.utf8Name(), QByteArray("b\xc3\xa9"));
+    QCOMPARE(reader.text(), QLatin1String("x\ty"));
+    QCOMPARE(reader.utf8Text(), QByteArray("x\ty"));
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartObject);
+    QCOMPARE(reader.name(), QLatin1String("c"));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+
+    // strings without escape sequences refer to the input
+    QCOMPARE(reader.readNext(), QJsonStreamReader::String);
+    QCOMPARE(reader.name(), QString::fromUtf8(UNICODE_DJE));
+    QCOMPARE(reader.text(), QString::fromUtf8(UNICODE_DJE));
+    const QByteArray text = reader.utf8Text();
+    QCOMPARE(text, QByteArray(UNICODE_DJE));
+    QVERIFY(text.constData() >= json.constData());
+    QVERIFY(text.constData() < json.constData() + json.size());
+    QCOMPARE(reader.tokenOffset(), qint64(text.constData() - json.constData() - 7));
+
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndObject);
+    QVERIFY(!reader.atEnd());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+    QVERIFY(reader.atEnd());
+    QVERIFY(!reader.hasError());
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QtJson::streamReaderFile()
+{
+    QFile file(testDataDir + "/test.json");
+    QVERIFY(file.open(QFile::ReadOnly));
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll());
+    QVERIFY(doc.isArray());
+
+    // mapped file
+    QVERIFY(file.seek(0));
+    QJsonStreamReader reader(&file);
+    QCOMPARE(reader.device(), &file);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.readValue(), QJsonValue(doc.array()));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+
+    // device that is read in chunks
+    QVERIFY(file.seek(0));
+    QBuffer buffer;
+    buffer.setData(file.readAll());
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    reader.setDevice(&buffer);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QCOMPARE(reader.readValue(), QJsonValue(doc.array()));
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+
+    // skipping a container
+    QVERIFY(buffer.seek(0));
+    reader.setDevice(&buffer);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::StartArray);
+    QVERIFY(reader.skipCurrentContainer());
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::EndArray);
+    QCOMPARE(reader.depth(), 0);
+    QCOMPARE(reader.readNext(), QJsonStreamReader::EndDocument);
+}
+
+void tst_QtJson::streamReaderIncremental()
+{
+    const QByteArray json = "\xef\xbb\xbf[ {\"key\": \"value\\n\"}, 12.5e1, [true, false, null] ]";
+    QJsonStreamReader complete(json);
+    QJsonStreamReader reader;
+    int fed = 0;
+    for (;;) {
+        const QJsonStreamReader::TokenType expected = complete.readNext();
+        QJsonStreamReader::TokenType type = reader.readNext();
+        while (type == QJsonStreamReader::Invalid
+               && reader.error() == QJsonStreamReader::PrematureEndOfDocumentError) {
+            QVERIFY(reader.atEnd());
+            QVERIFY(fed < json.size());
+            reader.addData(json.mid(fed++, 1));
+            QVERIFY(!reader.atEnd());
+            type = reader.readNext();
+        }
+        QCOMPARE(type, expected);
+        QCOMPARE(reader.name(), complete.name());
+        QCOMPARE(reader.value(), complete.value());
+        QCOMPARE(reader.depth(), complete.depth());
+        if (type == QJsonStreamReader::EndDocument)
+            break;
+        QCOMPARE(reader.tokenOffset(), complete.tokenOffset());
+    }
+    QVERIFY(!reader.hasError());
+}
+
+void tst_QtJson::streamReaderErrors_data()
+{
+    QTest::addColumn<QByteArray>("json");
+    QTest::addColumn<int>("error");
+    QTest::addColumn<int>("parseError");
+
+    QTest::newRow("empty") << QByteArray("") << int(QJsonStreamReader::PrematureEndOfDocumentError)
+                           << int(QJsonParseError::IllegalValue);
+    QTest::newRow("no container") << QByteArray("1") << int(QJsonStreamReader::NotWellFormedError)
+                                  << int(QJsonParseError::IllegalValue);
+    QTest::newRow("unterminated array") << QByteArray("[1, 2") << int(QJsonStreamReader::PrematureEndOfDocumentError)
+                                        << int(QJsonParseError::TerminationByNumber);
+    QTest::newRow("unterminated object") << QByteArray("{\"a\": 1 ") << int(QJsonStreamReader::PrematureEndOfDocumentError)
+                                         << int(QJsonParseError::UnterminatedObject);
+    QTest::newRow("unterminated string") << QByteArray("[\"abc") << int(QJsonStreamReader::PrematureEndOfDocumentError)
+                                         << int(QJsonParseError::UnterminatedString);
+    QTest::newRow("missing separator") << QByteArray("[1 2]") << int(QJsonStreamReader::NotWellFormedError)
+                                       << int(QJsonParseError::MissingValueSeparator);
+    QTest::newRow("missing name separator") << QByteArray("{\"a\" 1}") << int(QJsonStreamReader::NotWellFormedError)
+                                            << int(QJsonParseError::MissingNameSeparator);
+    QTest::newRow("missing object") << QByteArray("{\"a\": 1,}") << int(QJsonStreamReader::NotWellFormedError)
+                                    << int(QJsonParseError::MissingObject);
+    QTest::newRow("illegal value") << QByteArray("[tru]") << int(QJsonStreamReader::NotWellFormedError)
+                                   << int(QJsonParseError::IllegalValue);
+    QTest::newRow("illegal number") << QByteArray("[-]") << int(QJsonStreamReader::NotWellFormedError)
+                                    << int(QJsonParseError::IllegalNumber);
+    QTest::newRow("illegal escape") << QByteArray("[\"\\u12x4\"]") << int(QJsonStreamReader::NotWellFormedError)
+                                    << int(QJsonParseError::IllegalEscapeSequence);
+    QTest::newRow("illegal utf8") << QByteArray("[\"" INVALID_UNICODE "\"]") << int(QJsonStreamReader::NotWellFormedError)
+                                  << int(QJsonParseError::IllegalUTF8String);
+    QTest::newRow("garbage at end") << QByteArray("[] x") << int(QJsonStreamReader::NotWellFormedError)
+                                    << int(QJsonParseError::GarbageAtEnd);
+    QTest::newRow("deep nesting") << QByteArray(1025, '[') + QByteArray(1025, ']')
+                                  << int(QJsonStreamReader::NotWellFormedError)
+                                  << int(QJsonParseError::DeepNesting);
+}
+
+void tst_QtJson::streamReaderErrors()
+{
+    QFETCH(QByteArray, json);
+    QFETCH(int, error);
+    QFETCH(int, parseError);
+
+    QJsonStreamReader reader(json);
+    while (!reader.atEnd())
+        reader.readNext();
+    QVERIFY(reader.hasError());
+    QCOMPARE(reader.tokenType(), QJsonStreamReader::Invalid);
+    QCOMPARE(int(reader.error()), error);
+    QCOMPARE(int(reader.parseError()), parseError);
+    QVERIFY(!reader.errorString().isEmpty());
+
+    // the document parser agrees that the data is invalid
+    QJsonParseError documentError;
+    QJsonDocument::fromJson(json, &documentError);
+    QVERIFY(documentError.error != QJsonParseError::NoError);
+}
+
+void tst_QtJson::streamWriter()
+{
+    QByteArray json;
+    QJsonStreamWriter writer(&json);
+    QVERIFY(!writer.autoFormatting());
+    writer.writeStartObject();
+    writer.writeStartArray(QStringLiteral("a"));
+    writer.writeDouble(1);
+    writer.writeDouble(-2.5);
+    writer.writeDouble(qInf());
+    writer.writeBool(true);
+    writer.writeNull();
+    writer.writeString(QString::fromUtf8("\"\\\n\x01" UNICODE_DJE "\xf0\x9f\x98\x80"));
+    writer.writeEndArray();
+    QCOMPARE(json, QByteArray("{\"a\":[1,-2.5,null,true,null,"
+                              "\"\\\"\\\\\\n\\u0001" UNICODE_DJE "\xf0\x9f\x98\x80\"]"));
+    writer.writeStartObject(QStringLiteral("b"));
+    writer.writeEndObject();
+    writer.writeValue(QStringLiteral("c"), QJsonArray{1, QJsonObject{{"d", false}}});
+    writer.writeEndObject();
+    QCOMPARE(json, QByteArray("{\"a\":[1,-2.5,null,true,null,"
+                              "\"\\\"\\\\\\n\\u0001" UNICODE_DJE "\xf0\x9f\x98\x80\"],"
+                              "\"b\":{},\"c\":[1,{\"d\":false}]}"));
+    QVERIFY(!writer.hasError());
+
+    QJsonParseError error;
+    const QJsonDocument doc = QJsonDocument::fromJson(json, &error);
+    QCOMPARE(error.error, QJsonParseError::NoError);
+    QCOMPARE(doc.object().value("a").toArray().at(5).toString(),
+             QString::fromUtf8("\"\\\n\x01" UNICODE_DJE "\xf0\x9f\x98\x80"));
+}
+
+void tst_QtJson::streamWriterDocument()
+{
+    QFile file(testDataDir + "/test.json");
+    QVERIFY(file.open(QFile::ReadOnly));
+    QJsonArray array = QJsonDocument::fromJson(file.readAll()).array();
+    QVERIFY(!array.isEmpty());
+    // make the output larger than the writer's buffer
+    const QString longString(100000, QLatin1Char('\n'));
+    array.append(longString);
+    for (int i = 0; i < 1000; ++i)
+        array.append(QJsonObject{{"key", i}, {"value", 0.5 + i}});
+    const QJsonDocument doc(array);
+
+    for (bool indented : {false, true}) {
+        QBuffer buffer;
+        QVERIFY(buffer.open(QIODevice::WriteOnly));
+        {
+            QJsonStreamWriter writer(&buffer);
+            QCOMPARE(writer.device(), &buffer);
+            writer.setAutoFormatting(indented);
+            writer.writeValue(doc.array());
+            QVERIFY(!writer.hasError());
+        }
+        QCOMPARE(buffer.data(), doc.toJson(indented ? QJsonDocument::Indented : QJsonDocument::Compact));
+    }
+}
+
 QTEST_MAIN(tst_QtJson)
 #include "tst_qtjson.moc"
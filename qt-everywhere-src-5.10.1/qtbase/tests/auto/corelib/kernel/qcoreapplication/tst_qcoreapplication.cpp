@@ -532,6 +532,52 @@ void tst_QCoreApplication::deliverInDefinedOrder()
     QObject::connect(&obj, SIGNAL(done()), &app, SLOT(quit()));
     app.exec();
 }
+
+class CrossThreadPoster : public QThread
+{
+public:
+    QObject *one;
+    QObject *two;
+
+    void run() Q_DECL_OVERRIDE
+    {
+        for (int i = 0; i < 100; ++i) {
+            QCoreApplication::postEvent(one, new QEvent(QEvent::Type(QEvent::User + i)));
+            QCoreApplication::postEvent(two, new QEvent(QEvent::Type(QEvent::User + i)),
+                                        i % 2 ? Qt::HighEventPriority : Qt::NormalEventPriority);
+        }
+    }
+};
+
+void tst_QCoreApplication::postEventFromOtherThread()
+{
+    int argc = 1;
+    char *argv[] = { const_cast<char*>(QTest::currentAppName()) };
+    TestApplication app(argc, argv);
+
+    EventSpy spy;
+    QObject one, two;
+    one.installEventFilter(&spy);
+    two.installEventFilter(&spy);
+
+    CrossThreadPoster poster;
+    poster.one = &one;
+    poster.two = &two;
+    poster.start();
+    QVERIFY(poster.wait());
+
+    // events pushed from another thread are subject to removePostedEvents()
+    QCoreApplication::removePostedEvents(&one);
+
+    // and are delivered by priority, in posting order for equal priorities
+    QList<int> expected;
+    for (int i = 1; i < 100; i += 2)
+        expected << QEvent::User + i;
+    for (int i = 0; i < 100; i += 2)
+        expected << QEvent::User + i;
+    QCoreApplication::sendPostedEvents();
+    QCOMPARE(spy.recordedEvents, expected);
+}
 #endif // QT_NO_QTHREAD
 
 void tst_QCoreApplication::applicationPid()
@@ -45,6 +45,7 @@ private slots:
     void removePostedEvents();
 #ifndef QT_NO_THREAD
     void deliverInDefinedOrder();
+    void postEventFromOtherThread();
 #endif
     void applicationPid();
     void globalPostedEventsCount();
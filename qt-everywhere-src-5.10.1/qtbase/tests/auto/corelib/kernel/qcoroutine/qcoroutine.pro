@@ -0,0 +1,7 @@
+CONFIG += testcase
+TARGET = tst_qcoroutine
+QT = core testlib
+SOURCES = tst_qcoroutine.cpp
+
+# Coroutines need C++20
+gcc|clang: QMAKE_CXXFLAGS += -std=c++2a
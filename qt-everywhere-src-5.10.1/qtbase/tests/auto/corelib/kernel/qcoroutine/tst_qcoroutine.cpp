@@ -0,0 +1,203 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include <QtCore/qbuffer.h>
+#include <QtCore/qcoroutine.h>
+
+#ifdef QT_HAS_COROUTINES
+
+static QtCoroutine::Task<int> immediateValue(int value)
+{
+    co_return value;
+}
+
+static QtCoroutine::Task<int> addDelayed(int a, int b)
+{
+    co_await QtCoroutine::delay(10);
+    co_return a + b;
+}
+
+static QtCoroutine::Task<> sumInto(int *result)
+{
+    const int first = co_await immediateValue(1);
+    const int second = co_await addDelayed(first, 2);
+    *result = second;
+}
+
+static QtCoroutine::Task<> waitForObjectName(QObject *object, QString *name)
+{
+    co_await QtCoroutine::signal(object, &QObject::objectNameChanged);
+    *name = object->objectName();
+}
+
+static QtCoroutine::Task<> readAvailable(QIODevice *device, QByteArray *data)
+{
+    co_await QtCoroutine::readyRead(device);
+    *data = device->readAll();
+}
+
+static QtCoroutine::Task<> awaitFuture(QFuture<int> future, int *result, QThread **thread)
+{
+    *result = co_await future;
+    *thread = QThread::currentThread();
+}
+
+static QtCoroutine::Task<int> throwDelayed()
+{
+    co_await QtCoroutine::delay(0);
+    throw 42;
+}
+
+static QtCoroutine::Task<> catchFrom(int *caught)
+{
+    try {
+        co_await throwDelayed();
+    } catch (int value) {
+        *caught = value;
+    }
+}
+
+#endif // QT_HAS_COROUTINES
+
+class tst_QCoroutine : public QObject
+{
+    Q_OBJECT
+private slots:
+    void immediate();
+    void chained();
+    void detached();
+    void signal();
+    void readyRead();
+    void future();
+    void exceptions();
+};
+
+#ifdef QT_HAS_COROUTINES
+
+void tst_QCoroutine::immediate()
+{
+    QtCoroutine::Task<int> task = immediateValue(5);
+    QVERIFY(task.isFinished());
+}
+
+void tst_QCoroutine::chained()
+{
+    int result = 0;
+    QtCoroutine::Task<> task = sumInto(&result);
+    QVERIFY(!task.isFinished());
+    QCOMPARE(result, 0);
+    QTRY_VERIFY(task.isFinished());
+    QCOMPARE(result, 3);
+}
+
+void tst_QCoroutine::detached()
+{
+    // a detached task keeps running and frees itself when done
+    int result = 0;
+    sumInto(&result);
+    QTRY_COMPARE(result, 3);
+}
+
+void tst_QCoroutine::signal()
+{
+    QObject object;
+    QString name;
+    QtCoroutine::Task<> task = waitForObjectName(&object, &name);
+    QVERIFY(!task.isFinished());
+    object.setObjectName(QStringLiteral("first"));
+    QVERIFY(task.isFinished());
+    QCOMPARE(name, QStringLiteral("first"));
+
+    // the connection is gone once the coroutine has resumed
+    object.setObjectName(QStringLiteral("second"));
+    QCOMPARE(name, QStringLiteral("first"));
+}
+
+void tst_QCoroutine::readyRead()
+{
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::ReadWrite));
+    QByteArray data;
+    QtCoroutine::Task<> task = readAvailable(&buffer, &data);
+    QVERIFY(!task.isFinished());
+    buffer.write("hello");
+    buffer.seek(0);
+    QTRY_VERIFY(task.isFinished());
+    QCOMPARE(data, QByteArray("hello"));
+}
+
+void tst_QCoroutine::future()
+{
+    QFutureInterface<int> promise;
+    promise.reportStarted();
+    int result = 0;
+    QThread *thread = nullptr;
+    QtCoroutine::Task<> task = awaitFuture(promise.future(), &result, &thread);
+    QVERIFY(!task.isFinished());
+
+    promise.reportResult(42);
+    promise.reportFinished();
+    // resumption goes through the event loop of the awaiting thread
+    QVERIFY(!task.isFinished());
+    QTRY_VERIFY(task.isFinished());
+    QCOMPARE(result, 42);
+    QCOMPARE(thread, QThread::currentThread());
+
+    // an already finished future does not suspend
+    task = awaitFuture(promise.future(), &result, &thread);
+    QVERIFY(task.isFinished());
+}
+
+void tst_QCoroutine::exceptions()
+{
+#ifndef QT_NO_EXCEPTIONS
+    int caught = 0;
+    QtCoroutine::Task<> task = catchFrom(&caught);
+    QTRY_VERIFY(task.isFinished());
+    QCOMPARE(caught, 42);
+#else
+    QSKIP("This test requires exception support");
+#endif
+}
+
+#else
+
+void tst_QCoroutine::immediate() { QSKIP("This test requires C++20 coroutine support"); }
+void tst_QCoroutine::chained() { QSKIP("This test requires C++20 coroutine support"); }
+void tst_QCoroutine::detached() { QSKIP("This test requires C++20 coroutine support"); }
+void tst_QCoroutine::signal() { QSKIP("This test requires C++20 coroutine support"); }
+void tst_QCoroutine::readyRead() { QSKIP("This test requires C++20 coroutine support"); }
+void tst_QCoroutine::future() { QSKIP("This test requires C++20 coroutine support"); }
+void tst_QCoroutine::exceptions() { QSKIP("This test requires C++20 coroutine support"); }
+
+#endif // QT_HAS_COROUTINES
+
+QTEST_MAIN(tst_QCoroutine)
+#include "tst_qcoroutine.moc"
@@ -36,6 +36,9 @@
 #if defined(Q_OS_UNIX)
   #include <private/qeventdispatcher_unix_p.h>
   #include <QtCore/private/qcore_unix_p.h>
+  #if defined(Q_OS_LINUX)
+    #include <private/qeventdispatcher_epoll_p.h>
+  #endif
   #if defined(HAVE_GLIB)
     #include <private/qeventdispatcher_glib_p.h>
   #endif
@@ -170,6 +173,9 @@ private slots:
     void quit();
 #if defined(Q_OS_UNIX)
     void processEventsExcludeSocket();
+#endif
+#if defined(Q_OS_LINUX)
+    void processEventsExcludeSocketEpoll();
 #endif
     void processEventsExcludeTimers();
     void deliverInDefinedOrder();
@@ -480,6 +486,20 @@ void tst_QEventLoop::processEventsExcludeSocket()
 }
 #endif
 
+#if defined(Q_OS_LINUX)
+void tst_QEventLoop::processEventsExcludeSocketEpoll()
+{
+    SocketTestThread thread;
+    thread.setEventDispatcher(new QEventDispatcherEpoll);
+    thread.start();
+    QVERIFY(thread.wait());
+    QVERIFY(thread.dataSent);
+    QVERIFY(thread.dataReadable);
+    QVERIFY(!thread.testResult);
+    QVERIFY(thread.dataArrived);
+}
+#endif
+
 class TimerReceiver : public QObject
 {
 public:
@@ -513,12 +533,15 @@ void tst_QEventLoop::processEventsExcludeTimers()
 #if defined(Q_OS_UNIX)
     QAbstractEventDispatcher *eventDispatcher = QCoreApplication::eventDispatcher();
     if (!qobject_cast<QEventDispatcherUNIX *>(eventDispatcher)
+  #if defined(Q_OS_LINUX)
+        && !qobject_cast<QEventDispatcherEpoll *>(eventDispatcher)
+  #endif
   #if defined(HAVE_GLIB)
         && !qobject_cast<QEventDispatcherGlib *>(eventDispatcher)
   #endif
         )
 #endif
-        QEXPECT_FAIL("", "X11ExcludeTimers only supported in the UNIX/Glib dispatchers", Continue);
+        QEXPECT_FAIL("", "X11ExcludeTimers only supported in the UNIX/epoll/Glib dispatchers", Continue);
 
     QCOMPARE(timerReceiver.gotTimerEvent, -1);
     timerReceiver.gotTimerEvent = -1;
@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qeventloopprofiler
+QT = core-private testlib
+SOURCES = tst_qeventloopprofiler.cpp
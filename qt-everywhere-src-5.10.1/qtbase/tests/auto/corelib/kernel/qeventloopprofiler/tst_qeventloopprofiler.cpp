@@ -0,0 +1,228 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include <QtCore/qcoreapplication.h>
+#include <QtCore/qeventloop.h>
+#include <QtCore/qtimer.h>
+#include <QtCore/private/qeventloopprofiler_p.h>
+
+class tst_QEventLoopProfiler : public QObject
+{
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+
+    void histogram();
+    void disabled();
+    void eventStatistics();
+    void nestedEvents();
+    void iterationBusyTime();
+    void stallWatchdog();
+};
+
+class Receiver : public QObject
+{
+public:
+    bool event(QEvent *e) override
+    {
+        if (e->type() != QEvent::User)
+            return QObject::event(e);
+        if (sleepMSecs)
+            QTest::qSleep(sleepMSecs);
+        if (nested) {
+            QEvent inner(QEvent::User);
+            QCoreApplication::sendEvent(nested, &inner);
+        }
+        return true;
+    }
+
+    int sleepMSecs = 0;
+    QObject *nested = nullptr;
+};
+
+class NestedReceiver : public QObject
+{
+public:
+    bool event(QEvent *e) override
+    {
+        return e->type() == QEvent::User || QObject::event(e);
+    }
+};
+
+static QEventLoopProfiler::EventStatistics statisticsFor(int type, const char *className)
+{
+    const QVector<QEventLoopProfiler::EventStatistics> events = QEventLoopProfiler::statistics().events;
+    for (const QEventLoopProfiler::EventStatistics &statistics : events) {
+        if (statistics.eventType == type && statistics.receiverClassName == className)
+            return statistics;
+    }
+    const QEventLoopProfiler::EventStatistics none = { type, QByteArray(className), { { 0 }, 0, 0, 0 } };
+    return none;
+}
+
+void tst_QEventLoopProfiler::init()
+{
+    QEventLoopProfiler::setStatisticsEnabled(true);
+    QEventLoopProfiler::reset();
+}
+
+void tst_QEventLoopProfiler::cleanup()
+{
+    QEventLoopProfiler::setStatisticsEnabled(false);
+    QEventLoopProfiler::setStallThreshold(0);
+    QEventLoopProfiler::reset();
+}
+
+void tst_QEventLoopProfiler::histogram()
+{
+    QEventLoopProfiler::Histogram histogram = { { 0 }, 0, 0, 0 };
+    QCOMPARE(histogram.percentile(0.5), qint64(0));
+
+    histogram.add(500);         // < 1 us
+    histogram.add(1500);        // [1, 2) us
+    histogram.add(3000);        // [2, 4) us
+    histogram.add(100000);      // [64, 128) us
+    QCOMPARE(histogram.count, quint64(4));
+    QCOMPARE(histogram.totalNSecs, qint64(105000));
+    QCOMPARE(histogram.maxNSecs, qint64(100000));
+    QCOMPARE(histogram.buckets[0], quint64(1));
+    QCOMPARE(histogram.buckets[1], quint64(1));
+    QCOMPARE(histogram.buckets[2], quint64(1));
+    QCOMPARE(histogram.buckets[7], quint64(1));
+    QCOMPARE(QEventLoopProfiler::Histogram::bucketLimit(7), qint64(128));
+    QCOMPARE(histogram.percentile(0.5), qint64(2));
+    QCOMPARE(histogram.percentile(1.0), qint64(128));
+
+    // the last bucket is open-ended
+    histogram.add(Q_INT64_C(3600000000000));
+    QCOMPARE(histogram.buckets[QEventLoopProfiler::Histogram::BucketCount - 1], quint64(1));
+    QCOMPARE(QEventLoopProfiler::Histogram::bucketLimit(QEventLoopProfiler::Histogram::BucketCount - 1),
+             qint64(-1));
+    QCOMPARE(histogram.percentile(1.0), qint64(3600000000));
+}
+
+void tst_QEventLoopProfiler::disabled()
+{
+    QEventLoopProfiler::setStatisticsEnabled(false);
+    QVERIFY(!QEventLoopProfiler::isStatisticsEnabled());
+
+    Receiver receiver;
+    QEvent event(QEvent::User);
+    QCoreApplication::sendEvent(&receiver, &event);
+
+    QCOMPARE(statisticsFor(QEvent::User, "QObject").latency.count, quint64(0));
+    QVERIFY(QEventLoopProfiler::statistics().events.isEmpty());
+}
+
+void tst_QEventLoopProfiler::eventStatistics()
+{
+    QVERIFY(QEventLoopProfiler::isStatisticsEnabled());
+
+    QTimer timer;
+    Receiver receiver;
+    receiver.sleepMSecs = 5;
+    for (int i = 0; i < 3; ++i) {
+        QEvent event(QEvent::User);
+        QCoreApplication::sendEvent(&receiver, &event);
+    }
+    QEvent event(QEvent::User);
+    QCoreApplication::sendEvent(&timer, &event);
+
+    // Receiver has no meta object of its own
+    const QEventLoopProfiler::EventStatistics statistics = statisticsFor(QEvent::User, "QObject");
+    QCOMPARE(statistics.latency.count, quint64(3));
+    QVERIFY(statistics.latency.totalNSecs >= Q_INT64_C(15000000));
+    QVERIFY(statistics.latency.maxNSecs >= Q_INT64_C(5000000));
+    QCOMPARE(statisticsFor(QEvent::User, "QTimer").latency.count, quint64(1));
+
+    // sorted by total time
+    QCOMPARE(QEventLoopProfiler::statistics().events.first().receiverClassName, QByteArray("QObject"));
+
+    QEventLoopProfiler::reset();
+    QVERIFY(QEventLoopProfiler::statistics().events.isEmpty());
+}
+
+void tst_QEventLoopProfiler::nestedEvents()
+{
+    QTimer inner;
+    Receiver receiver;
+    receiver.nested = &inner;
+    QEvent event(QEvent::User);
+    QCoreApplication::sendEvent(&receiver, &event);
+
+    QCOMPARE(statisticsFor(QEvent::User, "QObject").latency.count, quint64(1));
+    QCOMPARE(statisticsFor(QEvent::User, "QTimer").latency.count, quint64(0));
+}
+
+void tst_QEventLoopProfiler::iterationBusyTime()
+{
+    // the profiler hooks into the event dispatcher when the first event is
+    // delivered
+    NestedReceiver receiver;
+    QEvent event(QEvent::User);
+    QCoreApplication::sendEvent(&receiver, &event);
+    QEventLoopProfiler::reset();
+
+    QEventLoop loop;
+    QTimer::singleShot(10, [] { QTest::qSleep(5); });
+    QTimer::singleShot(50, &loop, &QEventLoop::quit);
+    loop.exec();
+
+    const QEventLoopProfiler::Histogram busy = QEventLoopProfiler::statistics().iterationBusyTime;
+    QVERIFY(busy.count > 0);
+    QVERIFY(busy.maxNSecs >= Q_INT64_C(5000000));
+}
+
+void tst_QEventLoopProfiler::stallWatchdog()
+{
+    QEventLoopProfiler::setStallThreshold(20);
+    QCOMPARE(QEventLoopProfiler::stallThreshold(), 20);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression("^Event loop stalled for \\d+ ms delivering User \\(1000\\) to QObject$"));
+    Receiver receiver;
+    receiver.sleepMSecs = 300;
+    QEvent event(QEvent::User);
+    QCoreApplication::sendEvent(&receiver, &event);
+
+    QCOMPARE(QEventLoopProfiler::statistics().stalls, 1);
+
+    // a quick event does not trigger the watchdog
+    receiver.sleepMSecs = 0;
+    QCoreApplication::sendEvent(&receiver, &event);
+    QTest::qSleep(50);
+    QCOMPARE(QEventLoopProfiler::statistics().stalls, 1);
+
+    QEventLoopProfiler::setStallThreshold(0);
+    QCOMPARE(QEventLoopProfiler::stallThreshold(), 0);
+}
+
+QTEST_MAIN(tst_QEventLoopProfiler)
+#include "tst_qeventloopprofiler.moc"
@@ -32,6 +32,7 @@
 #include <qmetaobject.h>
 #include <qabstractproxymodel.h>
 #include <private/qmetaobject_p.h>
+#include <private/qmetaobjectbuilder_p.h>
 
 Q_DECLARE_METATYPE(const QMetaObject *)
 
@@ -303,6 +304,8 @@ private slots:
 
     void indexOfMethodPMF();
 
+    void nameLookupTables();
+
     void signalOffset_data();
     void signalOffset();
     void signalCount_data();
@@ -1585,6 +1588,37 @@ void tst_QMetaObject::indexOfMethod()
     QCOMPARE(object->metaObject()->indexOfSignal(name), !isSignal ? -1 : idx);
 }
 
+void tst_QMetaObject::nameLookupTables()
+{
+    // moc generates name lookup tables for this class, which has more than
+    // enough slots and properties; meta objects built at runtime have none and
+    // are searched linearly. Both have to find the same indexes.
+    const QMetaObject *mo = &staticMetaObject;
+    QVERIFY(QMetaObjectPrivate::get(mo)->flags & HasNameLookupTables);
+
+    QMetaObjectBuilder builder(mo);
+    QScopedPointer<QMetaObject, QScopedPointerPodDeleter> built(builder.toMetaObject());
+    QVERIFY(!(QMetaObjectPrivate::get(built.data())->flags & HasNameLookupTables));
+
+    for (int i = mo->methodOffset(); i < mo->methodCount(); ++i) {
+        const QByteArray signature = mo->method(i).methodSignature();
+        QCOMPARE(mo->indexOfMethod(signature.constData()), i);
+        QCOMPARE(built->indexOfMethod(signature.constData()), i);
+    }
+    for (int i = mo->propertyOffset(); i < mo->propertyCount(); ++i) {
+        const char *name = mo->property(i).name();
+        QCOMPARE(mo->indexOfProperty(name), i);
+        QCOMPARE(built->indexOfProperty(name), i);
+    }
+
+    QCOMPARE(mo->indexOfSignal("value7Changed(QString)"), mo->indexOfMethod("value7Changed(QString)"));
+    QCOMPARE(mo->indexOfSlot("value7Changed(QString)"), -1);
+    QCOMPARE(mo->indexOfMethod("noSuchMethod()"), -1);
+    QCOMPARE(mo->indexOfProperty("noSuchProperty"), -1);
+    QCOMPARE(mo->indexOfMethod("deleteLater()"), QObject::staticMetaObject.indexOfMethod("deleteLater()"));
+    QCOMPARE(mo->indexOfProperty("objectName"), QObject::staticMetaObject.indexOfProperty("objectName"));
+}
+
 void tst_QMetaObject::indexOfMethodPMF()
 {
 #define INDEXOFMETHODPMF_HELPER(ObjectType, Name, Arguments)  { \
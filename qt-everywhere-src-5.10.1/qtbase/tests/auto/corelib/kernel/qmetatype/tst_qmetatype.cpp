@@ -1055,8 +1055,14 @@ void tst_QMetaType::registerType()
     QVERIFY(unregId >= int(QMetaType::User));
     QCOMPARE(unregId2, unregId + 2);
 
+    // looked up names are cached, make sure unregistering invalidates them
+    QCOMPARE(QMetaType::type("UnregisterMe"), unregId);
+    QCOMPARE(QMetaType::type("const UnregisterMe &"), unregId);
+    QCOMPARE(QMetaType::type("UnregisterMeTypedef"), unregId);
+
     QVERIFY(QMetaType::unregisterType(unregId));
     QCOMPARE(QMetaType::type("UnregisterMe"), 0);
+    QCOMPARE(QMetaType::type("const UnregisterMe &"), 0);
     QCOMPARE(QMetaType::type("UnregisterMeTypedef"), 0);
     QCOMPARE(QMetaType::type("UnregisterMe2"), unregId2);
     QVERIFY(QMetaType::unregisterType(unregId2));
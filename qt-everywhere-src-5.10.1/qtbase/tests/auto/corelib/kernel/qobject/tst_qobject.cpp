@@ -100,6 +100,7 @@ private slots:
     void qobjectConstCast();
     void uniqConnection();
     void uniqConnectionPtr();
+    void coalescedConnection();
     void interfaceIid();
     void deleteQObjectWhenDeletingEvent();
     void overloads();
@@ -3584,6 +3585,36 @@ void tst_QObject::uniqConnectionPtr()
     delete r2;
 }
 
+void tst_QObject::coalescedConnection()
+{
+    QObject sender;
+    QObject context;
+    QStringList received;
+    const Qt::ConnectionType type = Qt::ConnectionType(Qt::QueuedConnection | Qt::CoalescedConnection);
+    QVERIFY(connect(&sender, &QObject::objectNameChanged, &context,
+                    [&received](const QString &name) { received << name; }, type));
+
+    // only the latest of the pending emissions is delivered
+    sender.setObjectName(QStringLiteral("a"));
+    sender.setObjectName(QStringLiteral("b"));
+    sender.setObjectName(QStringLiteral("c"));
+    QVERIFY(received.isEmpty());
+    QCoreApplication::sendPostedEvents(&context, QEvent::MetaCall);
+    QCOMPARE(received, QStringList() << QStringLiteral("c"));
+
+    // a delivered emission does not absorb the next one
+    sender.setObjectName(QStringLiteral("d"));
+    QCoreApplication::sendPostedEvents(&context, QEvent::MetaCall);
+    QCOMPARE(received, QStringList() << QStringLiteral("c") << QStringLiteral("d"));
+
+    // pending arguments are released with the event
+    sender.setObjectName(QStringLiteral("e"));
+    QCoreApplication::removePostedEvents(&context, QEvent::MetaCall);
+    sender.setObjectName(QStringLiteral("f"));
+    QCoreApplication::sendPostedEvents(&context, QEvent::MetaCall);
+    QCOMPARE(received, QStringList() << QStringLiteral("c") << QStringLiteral("d") << QStringLiteral("f"));
+}
+
 void tst_QObject::interfaceIid()
 {
     QCOMPARE(QByteArray(qobject_interface_iid<Foo::Bleh *>()),
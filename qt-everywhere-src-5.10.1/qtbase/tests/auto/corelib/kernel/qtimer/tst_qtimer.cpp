@@ -67,6 +67,7 @@ private slots:
     void timerFiresOnlyOncePerProcessEvents();
     void timerIdPersistsAfterThreadExit();
     void cancelLongTimer();
+    void manyCoarseTimers();
     void singleShotStaticFunctionZeroTimeout();
     void recurseOnTimeoutAndStopTimer();
     void singleShotToFunctors();
@@ -690,6 +691,35 @@ void tst_QTimer::cancelLongTimer()
     QVERIFY(!timer.isActive());
 }
 
+void tst_QTimer::manyCoarseTimers()
+{
+    // coarse timers are kept in a timer wheel, make sure that starting and
+    // stopping lots of them in arbitrary order keeps every one of them right
+    const int count = 1000;
+    TimerHelper helper;
+    QVector<QTimer *> timers;
+    for (int i = 0; i < count; ++i) {
+        QTimer *timer = new QTimer(&helper);
+        timer->setSingleShot(true);
+        timer->setTimerType(i % 2 ? Qt::CoarseTimer : Qt::VeryCoarseTimer);
+        connect(timer, SIGNAL(timeout()), &helper, SLOT(timeout()));
+        timer->start(i % 2 ? 50 + (i * 37) % 500 : 1000 * 60 * 60);
+        timers.append(timer);
+    }
+
+    // stop every fourth coarse timer again
+    for (int i = 1; i < count; i += 4)
+        timers.at(i)->stop();
+
+    const int remaining = timers.at(0)->remainingTime();
+    QVERIFY(remaining > 1000 * 60 * 59);
+    QVERIFY(remaining <= 1000 * 60 * 60 + 1000);
+
+    QTRY_COMPARE_WITH_TIMEOUT(helper.count, count / 4, 5000);
+    for (int i = 0; i < count; ++i)
+        QCOMPARE(timers.at(i)->isActive(), i % 2 == 0);
+}
+
 void tst_QTimer::singleShotStaticFunctionZeroTimeout()
 {
     TimerHelper helper;
@@ -5,5 +5,5 @@ SOURCES = tst_qtranslator.cpp
 RESOURCES += qtranslator.qrc
 
 android:!android-embedded: RESOURCES += android_testdata.qrc
-else: TESTDATA += dependencies_la.qm hellotr_la.qm msgfmt_from_po.qm
+else: TESTDATA += dependencies_la.qm hellotr_la.qm hellotr_perfecthash_la.qm msgfmt_from_po.qm
 
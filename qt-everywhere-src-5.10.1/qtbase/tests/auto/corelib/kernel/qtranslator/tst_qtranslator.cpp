@@ -46,6 +46,8 @@ private slots:
     void threadLoad();
     void testLanguageChange();
     void plural();
+    void perfectHashes();
+    void translationCache();
     void translate_qm_file_generated_with_msgfmt();
     void loadFromResource();
     void loadDirectory();
@@ -222,6 +224,38 @@ void tst_QTranslator::plural()
     QCOMPARE(QCoreApplication::translate("QPushButton", "Hello %n world(s)!", 0, 2), QLatin1String("Hallo 2 Welten!"));
 }
 
+void tst_QTranslator::perfectHashes()
+{
+    // Same translations as hellotr_la, with a PerfectHashes block
+    QTranslator tor;
+    QVERIFY(tor.load("hellotr_perfecthash_la"));
+    QCOMPARE(tor.translate("QPushButton", "Hello world!"), QLatin1String("Hallo Welt!"));
+    QCOMPARE(tor.translate("QPushButton", "Hello world!", "disambiguation"), QLatin1String("Hallo Welt!"));
+    QCOMPARE(tor.translate("QPushButton", "Hello %n world(s)!", 0, 1), QLatin1String("Hallo %n Welt!"));
+    QCOMPARE(tor.translate("QPushButton", "Hello %n world(s)!", 0, 2), QLatin1String("Hallo %n Welten!"));
+    QVERIFY(tor.translate("QPushButton", "Goodbye world!").isNull());
+    QVERIFY(tor.translate("QLabel", "Hello world!").isNull());
+}
+
+void tst_QTranslator::translationCache()
+{
+    QTranslator tor;
+    QVERIFY(tor.load("hellotr_la"));
+    const QString first = tor.translate("QPushButton", "Hello world!");
+    QCOMPARE(first, QLatin1String("Hallo Welt!"));
+    const QString second = tor.translate("QPushButton", "Hello world!");
+    QVERIFY(second.isSharedWith(first));
+
+    // Different numerus forms are cached separately
+    QCOMPARE(tor.translate("QPushButton", "Hello %n world(s)!", 0, 1), QLatin1String("Hallo %n Welt!"));
+    QCOMPARE(tor.translate("QPushButton", "Hello %n world(s)!", 0, 2), QLatin1String("Hallo %n Welten!"));
+    QCOMPARE(tor.translate("QPushButton", "Hello %n world(s)!", 0, 1), QLatin1String("Hallo %n Welt!"));
+
+    // Loading another file drops cached translations
+    QVERIFY(!tor.load("does_not_exist"));
+    QVERIFY(tor.translate("QPushButton", "Hello world!").isNull());
+}
+
 void tst_QTranslator::translate_qm_file_generated_with_msgfmt()
 {
     QTranslator translator;
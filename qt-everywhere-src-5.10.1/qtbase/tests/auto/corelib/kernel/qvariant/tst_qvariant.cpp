@@ -242,6 +242,8 @@ private slots:
 
     void numericalConvert_data();
     void numericalConvert();
+    void arithmeticCast_data();
+    void arithmeticCast();
     void moreCustomTypes();
     void movabilityTest();
     void variantInVariant();
@@ -3503,6 +3505,49 @@ void tst_QVariant::numericalConvert()
 }
 
 
+void tst_QVariant::arithmeticCast_data()
+{
+    QTest::addColumn<QVariant>("v");
+    QTest::newRow("bool") << QVariant(true);
+    QTest::newRow("int") << QVariant(7);
+    QTest::newRow("negative int") << QVariant(-3);
+    QTest::newRow("uint") << QVariant(4000000000u);
+    QTest::newRow("qlonglong") << QVariant(Q_INT64_C(-5000000000));
+    QTest::newRow("qulonglong") << QVariant(Q_UINT64_C(0xffffffffffffffff));
+    QTest::newRow("double") << QVariant(2.5);
+    QTest::newRow("negative double") << QVariant(-2.5);
+    QTest::newRow("small double") << QVariant(0.4);
+    QTest::newRow("float") << QVariant(0.49999997f);
+    QTest::newRow("negative float") << QVariant(-1.5f);
+    QTest::newRow("null int") << QVariant(QVariant::Int);
+}
+
+// qvariant_cast() converts between the builtin arithmetic types inline; the
+// result has to match the one of the generic conversion in QVariant::convert()
+template<typename T> static void compareArithmeticCast(const QVariant &v)
+{
+    QVariant converted = v;
+    converted.convert(qMetaTypeId<T>());
+    const T expected = *reinterpret_cast<const T *>(converted.constData());
+    QCOMPARE(qvariant_cast<T>(v), expected);
+}
+
+void tst_QVariant::arithmeticCast()
+{
+    QFETCH(QVariant, v);
+
+    compareArithmeticCast<bool>(v);
+    compareArithmeticCast<int>(v);
+    compareArithmeticCast<uint>(v);
+    compareArithmeticCast<qlonglong>(v);
+    compareArithmeticCast<qulonglong>(v);
+    compareArithmeticCast<double>(v);
+    compareArithmeticCast<float>(v);
+
+    QCOMPARE(v.toInt(), qvariant_cast<int>(v));
+    QCOMPARE(v.toDouble(), qvariant_cast<double>(v));
+}
+
 template<class T> void playWithVariant(const T &orig, bool isNull, const QString &toString, double toDouble, bool toBool)
 {
     QVariant v = QVariant::fromValue(orig);
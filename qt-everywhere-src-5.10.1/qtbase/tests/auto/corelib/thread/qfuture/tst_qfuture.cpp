@@ -75,6 +75,11 @@ private slots:
     void nestedExceptions();
 #endif
     void nonGlobalThreadPool();
+    void then();
+    void thenExecutors();
+    void thenCanceled();
+    void whenAll();
+    void whenAny();
 };
 
 void tst_QFuture::resultStore()
@@ -1486,5 +1491,175 @@ void tst_QFuture::nonGlobalThreadPool()
     }
 }
 
+void tst_QFuture::then()
+{
+    // attached before the future finishes
+    {
+        QFutureInterface<int> i;
+        i.reportStarted();
+        QFuture<QString> f = i.future()
+                .then([](int value) { return value * 2; })
+                .then([](int value) { return QString::number(value); });
+        QVERIFY(!f.isFinished());
+        i.reportResult(21);
+        i.reportFinished();
+        QVERIFY(f.isFinished());
+        QCOMPARE(f.result(), QStringLiteral("42"));
+    }
+
+    // attached after the future finished
+    {
+        QFutureInterface<int> i;
+        i.reportStarted();
+        i.reportResult(1);
+        i.reportFinished();
+        int received = 0;
+        QFuture<void> f = i.future().then([&received](int value) { received = value; });
+        QVERIFY(f.isFinished());
+        QCOMPARE(received, 1);
+    }
+
+    // from and to QFuture<void>
+    {
+        QFutureInterface<void> i;
+        i.reportStarted();
+        bool called = false;
+        QFuture<int> f = i.future().then([]() { return 7; });
+        QFuture<void> g = f.then([&called](int) { called = true; });
+        i.reportFinished();
+        QCOMPARE(f.result(), 7);
+        QVERIFY(g.isFinished());
+        QVERIFY(called);
+    }
+}
+
+void tst_QFuture::thenExecutors()
+{
+    // thread pool
+    {
+        QThreadPool pool;
+        QFutureInterface<int> i;
+        i.reportStarted();
+        QFuture<QThread *> f = i.future().then(&pool, [](int) { return QThread::currentThread(); });
+        i.reportResult(0);
+        i.reportFinished();
+        QVERIFY(pool.waitForDone(10000));
+        QVERIFY(f.isFinished());
+        QVERIFY(f.result() != QThread::currentThread());
+    }
+
+    // context object: runs from its thread's event loop
+    {
+        QObject context;
+        QFutureInterface<int> i;
+        i.reportStarted();
+        QFuture<QThread *> f = i.future().then(&context, [](int) { return QThread::currentThread(); });
+        i.reportResult(0);
+        i.reportFinished();
+        QVERIFY(!f.isFinished());
+        QTRY_VERIFY(f.isFinished());
+        QCOMPARE(f.result(), QThread::currentThread());
+    }
+
+    // destroying the context cancels the continuation
+    {
+        QObject *context = new QObject;
+        QFutureInterface<int> i;
+        i.reportStarted();
+        bool called = false;
+        QFuture<void> f = i.future().then(context, [&called](int) { called = true; });
+        i.reportResult(0);
+        i.reportFinished();
+        delete context;
+        QVERIFY(f.isFinished());
+        QVERIFY(f.isCanceled());
+        QCoreApplication::processEvents();
+        QVERIFY(!called);
+    }
+}
+
+void tst_QFuture::thenCanceled()
+{
+    QFutureInterface<int> i;
+    i.reportStarted();
+    bool called = false;
+    QFuture<int> f = i.future().then([&called](int value) { called = true; return value; });
+    i.reportCanceled();
+    i.reportFinished();
+    QVERIFY(f.isFinished());
+    QVERIFY(f.isCanceled());
+    QVERIFY(!called);
+
+#ifndef QT_NO_EXCEPTIONS
+    // exceptions propagate along the chain
+    QFuture<int> g = createExceptionResultFuture().then([](int value) { return value; });
+    QVERIFY(g.isCanceled());
+    bool caught = false;
+    try {
+        g.waitForFinished();
+    } catch (QException &) {
+        caught = true;
+    }
+    QVERIFY(caught);
+
+    // and so do exceptions thrown by a continuation
+    QFutureInterface<int> j;
+    j.reportStarted();
+    QFuture<int> h = j.future().then([](int) -> int { throw DerivedException(); });
+    j.reportResult(0);
+    j.reportFinished();
+    caught = false;
+    try {
+        h.waitForFinished();
+    } catch (DerivedException &) {
+        caught = true;
+    }
+    QVERIFY(caught);
+#endif
+}
+
+void tst_QFuture::whenAll()
+{
+    QFutureInterface<int> a;
+    QFutureInterface<int> b;
+    a.reportStarted();
+    b.reportStarted();
+    const QList<QFuture<int> > futures = QList<QFuture<int> >() << a.future() << b.future();
+
+    QFuture<QList<QFuture<int> > > all = QtFuture::whenAll(futures);
+    QVERIFY(!all.isFinished());
+    b.reportResult(2);
+    b.reportFinished();
+    QVERIFY(!all.isFinished());
+    a.reportCanceled();
+    a.reportFinished();
+    QVERIFY(all.isFinished());
+    QCOMPARE(all.result().size(), 2);
+    QVERIFY(all.result().at(0).isCanceled());
+    QCOMPARE(all.result().at(1).result(), 2);
+
+    QVERIFY(QtFuture::whenAll(QList<QFuture<int> >()).isFinished());
+}
+
+void tst_QFuture::whenAny()
+{
+    QFutureInterface<void> a;
+    QFutureInterface<void> b;
+    a.reportStarted();
+    b.reportStarted();
+    const QList<QFuture<void> > futures = QList<QFuture<void> >() << a.future() << b.future();
+
+    QFuture<QtFuture::WhenAnyResult<void> > any = QtFuture::whenAny(futures);
+    QVERIFY(!any.isFinished());
+    b.reportFinished();
+    QVERIFY(any.isFinished());
+    QCOMPARE(any.result().index, 1);
+    QVERIFY(any.result().future == futures.at(1));
+    a.reportFinished();
+    QCOMPARE(any.result().index, 1);
+
+    QCOMPARE(QtFuture::whenAny(QList<QFuture<void> >()).result().index, -1);
+}
+
 QTEST_MAIN(tst_QFuture)
 #include "tst_qfuture.moc"
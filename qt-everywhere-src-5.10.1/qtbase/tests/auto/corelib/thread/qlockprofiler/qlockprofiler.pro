@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qlockprofiler
+QT = core-private testlib
+SOURCES = tst_qlockprofiler.cpp
@@ -0,0 +1,184 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qreadwritelock.h>
+#include <QtCore/qthread.h>
+#include <QtCore/private/qlockprofiler_p.h>
+
+#include <functional>
+
+class tst_QLockProfiler : public QObject
+{
+    Q_OBJECT
+private slots:
+    void init();
+    void cleanup();
+
+    void disabled();
+    void mutex();
+    void readWriteLock();
+};
+
+class LockingThread : public QThread
+{
+public:
+    explicit LockingThread(std::function<void()> body) : body(std::move(body)) {}
+
+    void run() override
+    {
+        body();
+        QLockProfiler::flush();
+    }
+
+    std::function<void()> body;
+};
+
+static QLockProfiler::Site siteFor(const void *lock)
+{
+    QLockProfiler::Site result = { nullptr, nullptr, QLockProfiler::Mutex, 0, 0, 0, 0, 0, 0 };
+    const QVector<QLockProfiler::Site> sites = QLockProfiler::sites();
+    for (const QLockProfiler::Site &site : sites) {
+        if (site.lock != lock)
+            continue;
+        result.lock = site.lock;
+        result.type = site.type;
+        result.contentions += site.contentions;
+        result.waitSamples += site.waitSamples;
+        result.totalWaitNSecs += site.totalWaitNSecs;
+        result.holdSamples += site.holdSamples;
+        result.totalHoldNSecs += site.totalHoldNSecs;
+    }
+    return result;
+}
+
+void tst_QLockProfiler::init()
+{
+#ifndef Q_COMPILER_THREAD_LOCAL
+    QSKIP("Lock profiling requires thread_local support");
+#endif
+    QLockProfiler::setSampleInterval(1);
+    QLockProfiler::reset();
+}
+
+void tst_QLockProfiler::cleanup()
+{
+    QLockProfiler::setSampleInterval(0);
+    QLockProfiler::reset();
+}
+
+void tst_QLockProfiler::disabled()
+{
+    QLockProfiler::setSampleInterval(0);
+    QVERIFY(!QLockProfiler::isEnabled());
+
+    QMutex mutex;
+    mutex.lock();
+    LockingThread thread([&mutex] {
+        mutex.lock();
+        mutex.unlock();
+    });
+    thread.start();
+    QTest::qSleep(20);
+    mutex.unlock();
+    QVERIFY(thread.wait());
+
+    QCOMPARE(siteFor(&mutex).contentions, quint64(0));
+}
+
+void tst_QLockProfiler::mutex()
+{
+    QVERIFY(QLockProfiler::isEnabled());
+
+    // uncontended locking is not recorded
+    QMutex mutex;
+    mutex.lock();
+    mutex.unlock();
+    QCOMPARE(siteFor(&mutex).contentions, quint64(0));
+
+    mutex.lock();
+    LockingThread thread([&mutex] {
+        mutex.lock();
+        QTest::qSleep(10);
+        mutex.unlock();
+    });
+    thread.start();
+    QTest::qSleep(50);
+    mutex.unlock();
+    QVERIFY(thread.wait());
+
+    const QLockProfiler::Site site = siteFor(&mutex);
+    QCOMPARE(site.type, QLockProfiler::Mutex);
+    QCOMPARE(site.contentions, quint64(1));
+    QCOMPARE(site.waitSamples, quint64(1));
+    QVERIFY(site.totalWaitNSecs > 0);
+    QCOMPARE(site.holdSamples, quint64(1));
+    QVERIFY(site.totalHoldNSecs >= 5 * 1000 * 1000);
+}
+
+void tst_QLockProfiler::readWriteLock()
+{
+    QReadWriteLock lock;
+    lock.lockForWrite();
+    LockingThread thread([&lock] {
+        lock.lockForRead();
+        lock.unlock();
+    });
+    thread.start();
+    QTest::qSleep(50);
+    lock.unlock();
+    QVERIFY(thread.wait());
+
+    const QLockProfiler::Site site = siteFor(&lock);
+    QCOMPARE(site.type, QLockProfiler::ReadLock);
+    QCOMPARE(site.contentions, quint64(1));
+    QCOMPARE(site.holdSamples, quint64(1));
+
+    // timed out attempts are counted, but not held
+    QLockProfiler::reset();
+    lock.lockForRead();
+    bool locked = true;
+    LockingThread writer([&lock, &locked] {
+        locked = lock.tryLockForWrite(10);
+    });
+    writer.start();
+    QVERIFY(writer.wait());
+    lock.unlock();
+    QVERIFY(!locked);
+
+    const QLockProfiler::Site writeSite = siteFor(&lock);
+    QCOMPARE(writeSite.type, QLockProfiler::WriteLock);
+    QCOMPARE(writeSite.contentions, quint64(1));
+    QCOMPARE(writeSite.waitSamples, quint64(1));
+    QCOMPARE(writeSite.holdSamples, quint64(0));
+}
+
+QTEST_MAIN(tst_QLockProfiler)
+#include "tst_qlockprofiler.moc"
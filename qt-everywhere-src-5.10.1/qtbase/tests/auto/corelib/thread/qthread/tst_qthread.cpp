@@ -106,6 +106,9 @@ private slots:
     void quitLock();
 
     void create();
+
+    void cpuAffinity();
+    void numaTopology();
 };
 
 enum { one_minute = 60 * 1000, five_minutes = 5 * one_minute };
@@ -1627,5 +1630,70 @@ void tst_QThread::requestTermination()
     QVERIFY(!thread.isInterruptionRequested());
 }
 
+class CpuRecordingThread : public QThread
+{
+public:
+    int cpu = -1;
+
+    void run() override
+    {
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+        cpu = sched_getcpu();
+#endif
+    }
+};
+
+void tst_QThread::cpuAffinity()
+{
+    const QVector<int> cpus = QThread::numaNodeCpus(0);
+    QVERIFY(!cpus.isEmpty());
+
+    CpuRecordingThread thread;
+    QVERIFY(thread.cpuAffinity().isEmpty());
+    QCOMPARE(thread.numaNode(), -1);
+
+    thread.setCpuAffinity(QVector<int>() << cpus.first());
+    QCOMPARE(thread.cpuAffinity(), QVector<int>() << cpus.first());
+    thread.start();
+    QVERIFY(thread.wait());
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    QCOMPARE(thread.cpu, cpus.first());
+#endif
+
+    thread.setNumaNode(0);
+    QCOMPARE(thread.numaNode(), 0);
+    QCOMPARE(thread.cpuAffinity(), cpus);
+
+    // setting the affinity explicitly drops the node
+    thread.setCpuAffinity(QVector<int>());
+    QCOMPARE(thread.numaNode(), -1);
+    QVERIFY(thread.cpuAffinity().isEmpty());
+
+    QTest::ignoreMessage(QtWarningMsg, "QThread::setNumaNode: NUMA node 100000 does not exist");
+    thread.setNumaNode(100000);
+    QCOMPARE(thread.numaNode(), -1);
+}
+
+void tst_QThread::numaTopology()
+{
+    const int nodeCount = QThread::numaNodeCount();
+    QVERIFY(nodeCount >= 1);
+
+    int cpuCount = 0;
+    for (int node = 0; node < nodeCount; ++node)
+        cpuCount += QThread::numaNodeCpus(node).size();
+    QVERIFY(cpuCount >= 1);
+    QVERIFY(QThread::numaNodeCpus(-1).isEmpty());
+    QVERIFY(QThread::numaNodeCpus(nodeCount + 1000).isEmpty());
+
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+    QByteArray data(1024 * 1024, 'x');
+    const int node = QThread::numaNodeOfAddress(data.constData());
+    if (node == -1)
+        QSKIP("get_mempolicy() is not available");
+    QVERIFY(node < nodeCount);
+#endif
+}
+
 QTEST_MAIN(tst_QThread)
 #include "tst_qthread.moc"
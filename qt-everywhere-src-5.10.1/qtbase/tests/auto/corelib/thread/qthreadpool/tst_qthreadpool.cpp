@@ -96,6 +96,9 @@ private slots:
     void stressTest();
     void takeAllAndIncreaseMaxThreadCount();
     void waitForDoneAfterTake();
+    void workStealing();
+    void workStealingTryTake();
+    void numaAware();
 
 private:
     QMutex m_functionTestMutex;
@@ -1335,5 +1338,145 @@ void tst_QThreadPool::waitForDoneAfterTake()
 
 }
 
+void tst_QThreadPool::workStealing()
+{
+    class Task : public QRunnable
+    {
+    public:
+        Task(QThreadPool *pool, QAtomicInt *count, int depth)
+            : m_pool(pool), m_count(count), m_depth(depth)
+        {}
+
+        void run()
+        {
+            m_count->ref();
+            if (m_depth > 0) {
+                m_pool->start(new Task(m_pool, m_count, m_depth - 1));
+                m_pool->start(new Task(m_pool, m_count, m_depth - 1));
+            }
+        }
+
+    private:
+        QThreadPool *m_pool;
+        QAtomicInt *m_count;
+        int m_depth;
+    };
+
+    const int depth = 14;
+    QThreadPool threadPool;
+    QVERIFY(!threadPool.isWorkStealingEnabled());
+    threadPool.setWorkStealingEnabled(true);
+    QVERIFY(threadPool.isWorkStealingEnabled());
+
+    for (int i = 0; i < 3; ++i) {
+        QAtomicInt count;
+        threadPool.start(new Task(&threadPool, &count, depth));
+        QVERIFY(threadPool.waitForDone(30000));
+        QCOMPARE(count.load(), (1 << (depth + 1)) - 1);
+        QCOMPARE(threadPool.activeThreadCount(), 0);
+    }
+}
+
+void tst_QThreadPool::workStealingTryTake()
+{
+    class Child : public QRunnable
+    {
+    public:
+        Child() { setAutoDelete(false); }
+        void run() { ran = true; }
+        bool ran = false;
+    };
+
+    class Parent : public QRunnable
+    {
+    public:
+        Parent(QThreadPool *pool, Child *child, QSemaphore *started, QSemaphore *finish)
+            : m_pool(pool), m_child(child), m_started(started), m_finish(finish)
+        {}
+
+        void run()
+        {
+            // only one thread: the child stays in this thread's deque
+            m_pool->start(m_child);
+            m_started->release();
+            m_finish->acquire();
+        }
+
+    private:
+        QThreadPool *m_pool;
+        Child *m_child;
+        QSemaphore *m_started;
+        QSemaphore *m_finish;
+    };
+
+    QSemaphore started;
+    QSemaphore finish;
+    Child child;
+
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(1);
+    threadPool.setWorkStealingEnabled(true);
+    threadPool.start(new Parent(&threadPool, &child, &started, &finish));
+    started.acquire();
+
+    QVERIFY(threadPool.tryTake(&child));
+    QVERIFY(!threadPool.tryTake(&child));
+    finish.release();
+    QVERIFY(threadPool.waitForDone(30000));
+    QVERIFY(!child.ran);
+}
+
+void tst_QThreadPool::numaAware()
+{
+    class NodeRecorder : public QRunnable
+    {
+    public:
+        explicit NodeRecorder(QAtomicInt *count) : m_count(count) {}
+        void run() override
+        {
+            node = QThread::currentThread()->numaNode();
+            m_count->ref();
+        }
+        int node = -2;
+
+    private:
+        QAtomicInt *m_count;
+    };
+
+    QAtomicInt count;
+    QThreadPool threadPool;
+    QVERIFY(!threadPool.isNumaAware());
+
+    // without NUMA awareness, runnables go to the shared threads
+    NodeRecorder shared(&count);
+    shared.setAutoDelete(false);
+    threadPool.startOnNumaNode(0, &shared);
+    QVERIFY(threadPool.waitForDone(30000));
+    QCOMPARE(shared.node, -1);
+
+    threadPool.setNumaAware(true);
+    QVERIFY(threadPool.isNumaAware());
+
+    const int nodeCount = QThread::numaNodeCount();
+    QVector<NodeRecorder *> recorders;
+    for (int node = 0; node < nodeCount; ++node) {
+        NodeRecorder *recorder = new NodeRecorder(&count);
+        recorder->setAutoDelete(false);
+        recorders.append(recorder);
+        threadPool.startOnNumaNode(node, recorder);
+    }
+    // an invalid node falls back to start()
+    NodeRecorder fallback(&count);
+    fallback.setAutoDelete(false);
+    threadPool.startOnNumaNode(nodeCount + 1000, &fallback);
+
+    QVERIFY(threadPool.waitForDone(30000));
+    QCOMPARE(count.load(), nodeCount + 2);
+    QCOMPARE(fallback.node, -1);
+    for (int node = 0; node < nodeCount; ++node)
+        QCOMPARE(recorders.at(node)->node, nodeCount > 1 ? node : -1);
+    qDeleteAll(recorders);
+}
+
 QTEST_MAIN(tst_QThreadPool);
 #include "tst_qthreadpool.moc"
@@ -97,6 +97,7 @@ private slots:
     void typeinfo();
     void qstring();
     void list();
+    void inlineLargeList();
     void linkedList();
     void vector();
     void byteArray();
@@ -164,6 +165,32 @@ struct Pod {
     int i1, i2;
 };
 
+struct InlineLarge {
+    static int count;
+    InlineLarge(int v = 0) : value(v), self(this) { ++count; }
+    InlineLarge(const InlineLarge &o) : value(o.value), self(this) { ++count; }
+    InlineLarge &operator=(const InlineLarge &o) { value = o.value; return *this; }
+    ~InlineLarge() { --count; }
+    bool operator==(const InlineLarge &o) const { return value == o.value; }
+    int value;
+    void *self;
+    double padding;
+};
+
+int InlineLarge::count = 0;
+
+struct InlinePod {
+    double x, y;
+    bool operator==(const InlinePod &o) const { return x == o.x && y == o.y; }
+};
+
+QT_BEGIN_NAMESPACE
+Q_DECLARE_TYPEINFO(InlineLarge, Q_MOVABLE_TYPE);
+Q_DECLARE_LIST_INLINE_STORAGE(InlineLarge)
+Q_DECLARE_TYPEINFO(InlinePod, Q_PRIMITIVE_TYPE);
+Q_DECLARE_LIST_INLINE_STORAGE(InlinePod)
+QT_END_NAMESPACE
+
 void tst_Collections::typeinfo()
 {
     QVERIFY(QTypeInfo<int*>::isPointer);
@@ -745,6 +772,106 @@ void tst_Collections::list()
     }
 }
 
+void tst_Collections::inlineLargeList()
+{
+    {
+        QList<InlineLarge> list;
+        for (int i = 0; i < 10; ++i)
+            list.append(InlineLarge(i));
+        list.prepend(InlineLarge(-1));
+        list.insert(5, InlineLarge(100));
+        QCOMPARE(list.size(), 12);
+        QCOMPARE(InlineLarge::count, 12);
+        QCOMPARE(list.first().value, -1);
+        QCOMPARE(list.at(5).value, 100);
+        QCOMPARE(list.at(6).value, 4);
+        QCOMPARE(list.last().value, 9);
+        QCOMPARE(list.indexOf(InlineLarge(100)), 5);
+        QCOMPARE(list.lastIndexOf(InlineLarge(9)), 11);
+        QVERIFY(list.contains(InlineLarge(3)));
+        QCOMPARE(list.count(InlineLarge(3)), 1);
+
+        // the elements are stored in the array
+        QVERIFY(&list.at(1) + 1 == &list.at(2) || sizeof(InlineLarge) % sizeof(void *));
+
+        QList<InlineLarge> copy = list;
+        copy.removeAt(5);
+        QCOMPARE(copy.size(), 11);
+        QCOMPARE(list.size(), 12);
+        QCOMPARE(copy.at(5).value, 4);
+        QCOMPARE(copy.takeFirst().value, -1);
+        QCOMPARE(copy.takeLast().value, 9);
+        QCOMPARE(copy.takeAt(2).value, 2);
+        QCOMPARE(copy.size(), 8);
+
+        list.move(0, 11);
+        QCOMPARE(list.last().value, -1);
+        QCOMPARE(list.first().value, 0);
+        list.move(11, 0);
+        QCOMPARE(list.first().value, -1);
+        list.swap(0, 1);
+        QCOMPARE(list.at(0).value, 0);
+        QCOMPARE(list.at(1).value, -1);
+
+        list.erase(list.begin() + 2, list.begin() + 6);
+        QCOMPARE(list.size(), 8);
+        QCOMPARE(list.at(2).value, 4);
+
+        QList<InlineLarge> middle = list.mid(2, 3);
+        QCOMPARE(middle.size(), 3);
+        QCOMPARE(middle.at(0).value, 4);
+        QCOMPARE(middle.at(2).value, 6);
+
+        middle += list;
+        QCOMPARE(middle.size(), 11);
+        QCOMPARE(middle.last().value, 9);
+        QCOMPARE(list.removeAll(InlineLarge(5)), 1);
+        QCOMPARE(list.size(), 7);
+
+        // shared insertions and prepends
+        QList<InlineLarge> shared = list;
+        shared.insert(3, InlineLarge(42));
+        shared.prepend(InlineLarge(43));
+        QCOMPARE(shared.size(), 9);
+        QCOMPARE(shared.at(0).value, 43);
+        QCOMPARE(shared.at(4).value, 42);
+        QCOMPARE(list.size(), 7);
+
+        int sum = 0;
+        for (QList<InlineLarge>::const_iterator it = list.constBegin(); it != list.constEnd(); ++it)
+            sum += it->value;
+        QCOMPARE(sum, 0 - 1 + 4 + 6 + 7 + 8 + 9);
+        QCOMPARE(list.constEnd() - list.constBegin(), 7);
+
+        list.reserve(100);
+        for (int i = 0; i < 100; ++i)
+            list.insert(list.size() / 2, InlineLarge(i));
+        QCOMPARE(list.size(), 107);
+        const QList<InlineLarge> other = list;
+        QVERIFY(other == list);
+        list.clear();
+        QVERIFY(list.isEmpty());
+    }
+    QCOMPARE(InlineLarge::count, 0);
+
+    {
+        QList<InlinePod> list;
+        for (int i = 0; i < 50; ++i)
+            list.prepend(InlinePod{double(i), -double(i)});
+        QCOMPARE(list.size(), 50);
+        QCOMPARE(list.first().x, 49.);
+        QCOMPARE(list.last().y, 0.);
+        QVERIFY(list.contains(InlinePod{10., -10.}));
+        QCOMPARE(list.count(InlinePod{10., -10.}), 1);
+        QList<InlinePod> copy = list;
+        QVERIFY(copy == list);
+        copy[3].x = 1000.;
+        QVERIFY(copy != list);
+        QCOMPARE(list.at(3).x, 46.);
+        QCOMPARE(list.toVector().at(3).x, 46.);
+    }
+}
+
 void tst_Collections::linkedList()
 {
     {
@@ -0,0 +1,217 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <QtCore/qarena.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qvector.h>
+
+class tst_QArena : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void allocate();
+    void alignment();
+    void largeAllocation();
+    void release();
+    void scope();
+    void nestedScopes();
+    void containers();
+    void containerOutlivesScope();
+};
+
+void tst_QArena::allocate()
+{
+    QArena arena(256);
+    QCOMPARE(arena.bytesAllocated(), size_t(0));
+
+    char *p1 = static_cast<char *>(arena.allocate(10));
+    char *p2 = static_cast<char *>(arena.allocate(10));
+    QVERIFY(p1);
+    QVERIFY(p2);
+    QVERIFY(p1 != p2);
+    QVERIFY(arena.contains(p1));
+    QVERIFY(arena.contains(p2));
+    QCOMPARE(arena.bytesAllocated(), size_t(20));
+
+    // must be writable and not overlap
+    memset(p1, 'a', 10);
+    memset(p2, 'b', 10);
+    QCOMPARE(p1[9], 'a');
+    QCOMPARE(p2[0], 'b');
+
+    int onStack = 0;
+    QVERIFY(!arena.contains(&onStack));
+}
+
+void tst_QArena::alignment()
+{
+    QArena arena;
+    for (size_t alignment = 1; alignment <= 256; alignment *= 2) {
+        arena.allocate(1, 1);
+        void *p = arena.allocate(8, alignment);
+        QVERIFY(p);
+        QCOMPARE(quintptr(p) & (alignment - 1), quintptr(0));
+    }
+}
+
+void tst_QArena::largeAllocation()
+{
+    QArena arena(256);
+    char *small = static_cast<char *>(arena.allocate(16));
+    char *large = static_cast<char *>(arena.allocate(100000));
+    QVERIFY(small);
+    QVERIFY(large);
+    memset(large, 'x', 100000);
+    QVERIFY(arena.contains(large + 99999));
+    QVERIFY(arena.contains(small));
+}
+
+void tst_QArena::release()
+{
+    QArena arena;
+    void *p = arena.allocate(100);
+    QVERIFY(arena.contains(p));
+    arena.release();
+    QVERIFY(!arena.contains(p));
+    QCOMPARE(arena.bytesAllocated(), size_t(0));
+
+    // can be used again
+    QVERIFY(arena.allocate(100));
+}
+
+void tst_QArena::scope()
+{
+    QVERIFY(!QArena::current());
+#ifdef Q_COMPILER_THREAD_LOCAL
+    QArena arena;
+    {
+        QArenaScope scope(&arena);
+        QCOMPARE(QArena::current(), &arena);
+    }
+    QVERIFY(!QArena::current());
+#endif
+}
+
+void tst_QArena::nestedScopes()
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    QArena outer;
+    QArena inner;
+    QArenaScope outerScope(&outer);
+    {
+        QArenaScope innerScope(&inner);
+        QCOMPARE(QArena::current(), &inner);
+        {
+            QArenaScope noArena(nullptr);
+            QVERIFY(!QArena::current());
+        }
+        QCOMPARE(QArena::current(), &inner);
+    }
+    QCOMPARE(QArena::current(), &outer);
+#else
+    QSKIP("QArenaScope requires thread_local support");
+#endif
+}
+
+void tst_QArena::containers()
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    QArena arena;
+    QArenaScope scope(&arena);
+
+    QVector<int> vector;
+    for (int i = 0; i < 1000; ++i)
+        vector.append(i);
+    QVERIFY(arena.contains(vector.constData()));
+    QCOMPARE(vector.size(), 1000);
+    QCOMPARE(vector.at(999), 999);
+
+    QString string = QString::number(42).repeated(100);
+    QVERIFY(arena.contains(string.constData()));
+    QCOMPARE(string.size(), 200);
+
+    QHash<int, QString> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, QString::number(i));
+    QCOMPARE(hash.size(), 100);
+    QCOMPARE(hash.value(57), QStringLiteral("57"));
+    for (int i = 0; i < 50; ++i)
+        hash.remove(i);
+    QCOMPARE(hash.size(), 50);
+
+    vector.squeeze();
+    QCOMPARE(vector.at(500), 500);
+
+    QVERIFY(arena.bytesAllocated() > 1000 * sizeof(int));
+#else
+    QSKIP("QArenaScope requires thread_local support");
+#endif
+}
+
+void tst_QArena::containerOutlivesScope()
+{
+#ifdef Q_COMPILER_THREAD_LOCAL
+    QArena arena;
+    QVector<int> vector;
+    {
+        QArenaScope scope(&arena);
+        vector.resize(100);
+    }
+    QVERIFY(arena.contains(vector.constData()));
+
+    // copies made outside of the scope that detach use the system allocator
+    QVector<int> copy = vector;
+    copy.append(1);
+    QVERIFY(!arena.contains(copy.constData()));
+    QCOMPARE(copy.size(), 101);
+
+    // and so does growing; the arena's block is simply not freed
+    vector.reserve(10000);
+    QVERIFY(!arena.contains(vector.constData()));
+    QCOMPARE(vector.size(), 100);
+
+    // strings are reallocated in the arena they come from
+    QString string;
+    {
+        QArenaScope scope(&arena);
+        string = QStringLiteral("arena").repeated(10);
+    }
+    QVERIFY(arena.contains(string.constData()));
+    string.reserve(1000);
+    QVERIFY(arena.contains(string.constData()));
+    QCOMPARE(string.left(10), QStringLiteral("arenaarena"));
+#else
+    QSKIP("QArenaScope requires thread_local support");
+#endif
+}
+
+QTEST_APPLESS_MAIN(tst_QArena)
+#include "tst_qarena.moc"
@@ -0,0 +1,163 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <qcompactstring.h>
+#include <qhash.h>
+
+class tst_QCompactString : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void size();
+    void construct_data();
+    void construct();
+    void sharesLongStrings();
+    void copyAndMove();
+    void compare();
+    void hash();
+};
+
+void tst_QCompactString::size()
+{
+    QCOMPARE(sizeof(QCompactString), size_t(24));
+
+    QCompactString empty;
+    QVERIFY(empty.isEmpty());
+    QVERIFY(empty.isInline());
+    QCOMPARE(empty.size(), 0);
+    QCOMPARE(empty.toString(), QString());
+}
+
+void tst_QCompactString::construct_data()
+{
+    QTest::addColumn<QString>("string");
+
+    QTest::newRow("empty") << QString("");
+    QTest::newRow("short") << QString("abc");
+    QTest::newRow("capacity") << QString("abcdefghijk");
+    QTest::newRow("capacity+1") << QString("abcdefghijkl");
+    QTest::newRow("long") << QString("The quick brown fox jumps over the lazy dog");
+    QTest::newRow("non-latin1") << QString::fromUtf8("\xe2\x82\xac\xe2\x82\xac");
+}
+
+void tst_QCompactString::construct()
+{
+    QFETCH(QString, string);
+    const bool inlined = string.size() <= QCompactString::InlineCapacity;
+
+    QCompactString fromString(string);
+    QCOMPARE(fromString.isInline(), inlined);
+    QCOMPARE(fromString.size(), string.size());
+    QCOMPARE(fromString.toString(), string);
+    QVERIFY(fromString.view() == QStringView(string));
+
+    QCompactString fromView{QStringView(string)};
+    QCOMPARE(fromView.isInline(), inlined);
+    QCOMPARE(fromView.toString(), string);
+
+    QString temporary = string;
+    QCompactString fromRvalue(std::move(temporary));
+    QCOMPARE(fromRvalue.isInline(), inlined);
+    QCOMPARE(fromRvalue.toString(), string);
+
+    const QByteArray latin1 = string.toLatin1();
+    QCompactString fromLatin1(QLatin1String(latin1.constData(), latin1.size()));
+    QCOMPARE(fromLatin1.isInline(), inlined);
+    QCOMPARE(fromLatin1.toString(), QString::fromLatin1(latin1));
+
+    for (int i = 0; i < string.size(); ++i)
+        QCOMPARE(fromString.at(i), string.at(i));
+}
+
+void tst_QCompactString::sharesLongStrings()
+{
+    const QString string("a string that does not fit inline");
+    QCompactString compact(string);
+    QVERIFY(!compact.isInline());
+    QCOMPARE(compact.constData(), string.constData());
+    QCOMPARE(compact.toString().constData(), string.constData());
+}
+
+void tst_QCompactString::copyAndMove()
+{
+    const QString longString("a string that does not fit inline");
+    QCompactString shortOne(QStringLiteral("short"));
+    QCompactString longOne(longString);
+
+    QCompactString copy = longOne;
+    QCOMPARE(copy, longOne);
+    QCOMPARE(copy.constData(), longString.constData());
+    copy = shortOne;
+    QCOMPARE(copy, shortOne);
+    QVERIFY(copy.isInline());
+
+    QCompactString moved(std::move(longOne));
+    QVERIFY(longOne.isEmpty());
+    QCOMPARE(moved.toString(), longString);
+    moved = std::move(shortOne);
+    QCOMPARE(moved.toString(), QString("short"));
+
+    moved.swap(copy);
+    QCOMPARE(moved.toString(), QString("short"));
+    moved.clear();
+    QVERIFY(moved.isEmpty());
+}
+
+void tst_QCompactString::compare()
+{
+    const QCompactString a(QLatin1String("abc"));
+    const QCompactString b(QLatin1String("abd"));
+    const QCompactString c(QLatin1String("abcdefghijklmnop"));
+
+    QVERIFY(a == QCompactString(QString("abc")));
+    QVERIFY(a != b);
+    QVERIFY(a < b);
+    QVERIFY(a < c);
+    QVERIFY(c < b);
+    QVERIFY(b > c);
+    QVERIFY(a <= a);
+    QVERIFY(b >= a);
+}
+
+void tst_QCompactString::hash()
+{
+    const QString string("identifier");
+    QCOMPARE(qHash(QCompactString(string), 42), qHash(string, 42));
+
+    QHash<QCompactString, int> hash;
+    hash.insert(QCompactString(QLatin1String("one")), 1);
+    hash.insert(QCompactString(QLatin1String("a rather long key")), 2);
+    QCOMPARE(hash.value(QCompactString(QString("one"))), 1);
+    QCOMPARE(hash.value(QCompactString(QString("a rather long key"))), 2);
+}
+
+QTEST_APPLESS_MAIN(tst_QCompactString)
+#include "tst_qcompactstring.moc"
@@ -0,0 +1,383 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+#include <qflathash.h>
+#include <qhash.h>
+#include <qset.h>
+#include <qstring.h>
+
+class tst_QFlatHash : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void insert();
+    void operator_bracket();
+    void remove();
+    void take();
+    void erase();
+    void reuseDeleted();
+    void reserveAndSqueeze();
+    void implicitSharing();
+    void iterators();
+    void compare();
+    void stringKeys();
+    void randomOperations();
+    void flatSet();
+};
+
+struct Key
+{
+    Key(int k = 0) : k(k) {}
+    int k;
+    bool operator==(const Key &other) const { return k == other.k; }
+};
+
+// deliberately poor hash function to exercise the collision handling
+uint qHash(const Key &key, uint seed)
+{
+    return uint(key.k % 7) ^ seed;
+}
+
+void tst_QFlatHash::insert()
+{
+    QFlatHash<int, int> hash;
+    QVERIFY(hash.isEmpty());
+    QCOMPARE(hash.capacity(), 0);
+    QCOMPARE(hash.value(1), 0);
+    QCOMPARE(hash.value(1, 42), 42);
+    QVERIFY(!hash.contains(1));
+
+    QFlatHash<int, int>::iterator it = hash.insert(1, 10);
+    QCOMPARE(it.key(), 1);
+    QCOMPARE(it.value(), 10);
+    QCOMPARE(hash.size(), 1);
+
+    // inserting an existing key replaces its value
+    it = hash.insert(1, 11);
+    QCOMPARE(it.value(), 11);
+    QCOMPARE(hash.size(), 1);
+
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i * 2);
+    QCOMPARE(hash.size(), 1000);
+    QVERIFY(hash.capacity() >= 1000);
+    for (int i = 0; i < 1000; ++i) {
+        QVERIFY(hash.contains(i));
+        QCOMPARE(hash.value(i), i * 2);
+    }
+    QVERIFY(!hash.contains(1000));
+    QVERIFY(!hash.contains(-1));
+
+    QFlatHash<Key, int> colliding;
+    for (int i = 0; i < 200; ++i)
+        colliding.insert(Key(i), i);
+    QCOMPARE(colliding.size(), 200);
+    for (int i = 0; i < 200; ++i)
+        QCOMPARE(colliding.value(Key(i), -1), i);
+    QCOMPARE(colliding.value(Key(200), -1), -1);
+}
+
+void tst_QFlatHash::operator_bracket()
+{
+    QFlatHash<QString, int> hash;
+    hash[QStringLiteral("one")] = 1;
+    hash[QStringLiteral("two")] = 2;
+    ++hash[QStringLiteral("one")];
+    QCOMPARE(hash.size(), 2);
+    QCOMPARE(hash.value(QStringLiteral("one")), 2);
+    QCOMPARE(hash[QStringLiteral("three")], 0);
+    QCOMPARE(hash.size(), 3);
+
+    const QFlatHash<QString, int> &constHash = hash;
+    QCOMPARE(constHash[QStringLiteral("two")], 2);
+    QCOMPARE(constHash[QStringLiteral("four")], 0);
+    QCOMPARE(hash.size(), 3);
+}
+
+void tst_QFlatHash::remove()
+{
+    QFlatHash<int, int> hash;
+    QCOMPARE(hash.remove(1), 0);
+
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, i);
+    for (int i = 0; i < 100; i += 2)
+        QCOMPARE(hash.remove(i), 1);
+    QCOMPARE(hash.remove(0), 0);
+    QCOMPARE(hash.size(), 50);
+    for (int i = 0; i < 100; ++i)
+        QCOMPARE(hash.contains(i), i % 2 == 1);
+}
+
+void tst_QFlatHash::take()
+{
+    QFlatHash<int, QString> hash;
+    QCOMPARE(hash.take(1), QString());
+    hash.insert(1, QStringLiteral("one"));
+    hash.insert(2, QStringLiteral("two"));
+    QCOMPARE(hash.take(1), QStringLiteral("one"));
+    QCOMPARE(hash.take(1), QString());
+    QCOMPARE(hash.size(), 1);
+    QCOMPARE(hash.value(2), QStringLiteral("two"));
+}
+
+void tst_QFlatHash::erase()
+{
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 100; ++i)
+        hash.insert(i, i);
+
+    QFlatHash<int, int>::iterator it = hash.begin();
+    while (it != hash.end()) {
+        if (it.value() % 3 == 0)
+            it = hash.erase(it);
+        else
+            ++it;
+    }
+    QCOMPARE(hash.size(), 66);
+    for (int i = 0; i < 100; ++i)
+        QCOMPARE(hash.contains(i), i % 3 != 0);
+
+    // erasing through a shared copy detaches first
+    QFlatHash<int, int> copy = hash;
+    it = copy.find(1);
+    QVERIFY(it != copy.end());
+    copy.erase(it);
+    QVERIFY(!copy.contains(1));
+    QVERIFY(hash.contains(1));
+}
+
+void tst_QFlatHash::reuseDeleted()
+{
+    // removing and reinserting must not grow the table without bounds
+    QFlatHash<int, int> hash;
+    hash.reserve(100);
+    const int capacity = hash.capacity();
+    for (int i = 0; i < 100000; ++i) {
+        hash.insert(i, i);
+        if (i >= 50)
+            QCOMPARE(hash.remove(i - 50), 1);
+    }
+    QCOMPARE(hash.size(), 50);
+    QCOMPARE(hash.capacity(), capacity);
+    for (int i = 100000 - 50; i < 100000; ++i)
+        QCOMPARE(hash.value(i), i);
+}
+
+void tst_QFlatHash::reserveAndSqueeze()
+{
+    QFlatHash<int, int> hash;
+    hash.reserve(1000);
+    QVERIFY(hash.capacity() >= 1000);
+    const int capacity = hash.capacity();
+    for (int i = 0; i < 1000; ++i)
+        hash.insert(i, i);
+    QCOMPARE(hash.capacity(), capacity);
+
+    for (int i = 10; i < 1000; ++i)
+        hash.remove(i);
+    hash.squeeze();
+    QVERIFY(hash.capacity() < capacity);
+    QVERIFY(hash.capacity() >= 10);
+    for (int i = 0; i < 10; ++i)
+        QCOMPARE(hash.value(i), i);
+
+    hash.clear();
+    QVERIFY(hash.isEmpty());
+    QCOMPARE(hash.capacity(), 0);
+    hash.squeeze();
+    QCOMPARE(hash.capacity(), 0);
+}
+
+void tst_QFlatHash::implicitSharing()
+{
+    QFlatHash<int, QString> hash;
+    hash.insert(1, QStringLiteral("one"));
+    hash.insert(2, QStringLiteral("two"));
+
+    QFlatHash<int, QString> copy = hash;
+    QVERIFY(copy.isSharedWith(hash));
+    QVERIFY(!hash.isDetached());
+
+    copy.insert(3, QStringLiteral("three"));
+    QVERIFY(!copy.isSharedWith(hash));
+    QVERIFY(hash.isDetached());
+    QCOMPARE(hash.size(), 2);
+    QCOMPARE(copy.size(), 3);
+    QVERIFY(!hash.contains(3));
+
+    copy = hash;
+    copy[1] = QStringLiteral("uno");
+    QCOMPARE(hash.value(1), QStringLiteral("one"));
+    QCOMPARE(copy.value(1), QStringLiteral("uno"));
+
+    QFlatHash<int, QString> moved = std::move(copy);
+    QCOMPARE(moved.size(), 2);
+    QVERIFY(copy.isEmpty());
+
+    moved.swap(hash);
+    QCOMPARE(moved.value(1), QStringLiteral("one"));
+    QCOMPARE(hash.value(1), QStringLiteral("uno"));
+}
+
+void tst_QFlatHash::iterators()
+{
+    QFlatHash<int, int> empty;
+    QVERIFY(empty.constBegin() == empty.constEnd());
+    QVERIFY(empty.begin() == empty.end());
+
+    QFlatHash<int, int> hash;
+    for (int i = 0; i < 500; ++i)
+        hash.insert(i, -i);
+
+    QSet<int> seen;
+    for (QFlatHash<int, int>::const_iterator it = hash.constBegin(); it != hash.constEnd(); ++it) {
+        QCOMPARE(it.value(), -it.key());
+        seen.insert(it.key());
+    }
+    QCOMPARE(seen.size(), 500);
+
+    for (QFlatHash<int, int>::iterator it = hash.begin(); it != hash.end(); ++it)
+        *it = it.key() * 3;
+    for (int i = 0; i < 500; ++i)
+        QCOMPARE(hash.value(i), i * 3);
+
+    QCOMPARE(hash.keys().size(), 500);
+    QCOMPARE(hash.values().size(), 500);
+
+    QFlatHash<int, int>::const_iterator it = hash.constFind(7);
+    QVERIFY(it != hash.constEnd());
+    QCOMPARE(it.value(), 21);
+    QVERIFY(hash.constFind(500) == hash.constEnd());
+}
+
+void tst_QFlatHash::compare()
+{
+    QFlatHash<int, int> a;
+    QFlatHash<int, int> b;
+    QVERIFY(a == b);
+    for (int i = 0; i < 100; ++i)
+        a.insert(i, i);
+    for (int i = 99; i >= 0; --i)
+        b.insert(i, i);
+    QVERIFY(a == b);
+    b.insert(50, 0);
+    QVERIFY(a != b);
+    b.remove(50);
+    QVERIFY(a != b);
+    QFlatHash<int, int> c = { { 1, 2 }, { 3, 4 } };
+    QCOMPARE(c.size(), 2);
+    QCOMPARE(c.value(3), 4);
+}
+
+void tst_QFlatHash::stringKeys()
+{
+    QFlatHash<QString, QString> hash;
+    for (int i = 0; i < 2000; ++i)
+        hash.insert(QString::number(i), QString::number(i * i));
+    for (int i = 0; i < 2000; ++i)
+        QCOMPARE(hash.value(QString::number(i)), QString::number(i * i));
+    for (int i = 0; i < 2000; i += 3)
+        hash.remove(QString::number(i));
+    for (int i = 0; i < 2000; ++i)
+        QCOMPARE(hash.contains(QString::number(i)), i % 3 != 0);
+    hash.squeeze();
+    for (int i = 0; i < 2000; ++i)
+        QCOMPARE(hash.contains(QString::number(i)), i % 3 != 0);
+}
+
+void tst_QFlatHash::randomOperations()
+{
+    // compare against QHash as the reference implementation
+    QFlatHash<int, int> hash;
+    QHash<int, int> reference;
+    uint state = 1;
+    for (int i = 0; i < 20000; ++i) {
+        state = state * 1103515245 + 12345;
+        const int key = int((state >> 16) % 512);
+        switch ((state >> 8) % 4) {
+        case 0:
+        case 1:
+            hash.insert(key, i);
+            reference.insert(key, i);
+            break;
+        case 2:
+            QCOMPARE(hash.remove(key), reference.remove(key));
+            break;
+        case 3:
+            QCOMPARE(hash.value(key, -1), reference.value(key, -1));
+            break;
+        }
+        QCOMPARE(hash.size(), reference.size());
+    }
+    for (QHash<int, int>::const_iterator it = reference.constBegin(); it != reference.constEnd(); ++it)
+        QCOMPARE(hash.value(it.key(), -1), it.value());
+}
+
+void tst_QFlatHash::flatSet()
+{
+    QFlatSet<QString> set;
+    QVERIFY(set.isEmpty());
+    set.insert(QStringLiteral("a"));
+    set.insert(QStringLiteral("b"));
+    set.insert(QStringLiteral("a"));
+    QCOMPARE(set.size(), 2);
+    QVERIFY(set.contains(QStringLiteral("a")));
+    QVERIFY(!set.contains(QStringLiteral("c")));
+
+    QFlatSet<QString> copy = set;
+    QVERIFY(copy.remove(QStringLiteral("a")));
+    QVERIFY(!copy.remove(QStringLiteral("a")));
+    QCOMPARE(copy.size(), 1);
+    QCOMPARE(set.size(), 2);
+    QVERIFY(copy != set);
+
+    int count = 0;
+    for (QFlatSet<QString>::const_iterator it = set.constBegin(); it != set.constEnd(); ++it) {
+        QVERIFY(*it == QLatin1String("a") || *it == QLatin1String("b"));
+        ++count;
+    }
+    QCOMPARE(count, 2);
+    QCOMPARE(set.values().size(), 2);
+
+    QFlatSet<QString>::const_iterator it = set.find(QStringLiteral("b"));
+    QVERIFY(it != set.constEnd());
+    set.erase(it);
+    QCOMPARE(set.size(), 1);
+
+    QFlatSet<int> ints = { 1, 2, 3, 2 };
+    QCOMPARE(ints.size(), 3);
+    QVERIFY(ints == (QFlatSet<int>{ 3, 2, 1 }));
+}
+
+QTEST_APPLESS_MAIN(tst_QFlatHash)
+
+#include "tst_qflathash.moc"
@@ -53,6 +53,7 @@ private Q_SLOTS:
     void qhash();
     void qhash_of_empty_and_null_qstring();
     void qhash_of_empty_and_null_qbytearray();
+    void qhash_of_long_keys();
     void fp_qhash_of_zero_is_seed();
     void qthash_data();
     void qthash();
@@ -189,6 +190,40 @@ void tst_QHashFunctions::qhash_of_empty_and_null_qbytearray()
     QCOMPARE(qHash(null, seed), qHash(empty, seed));
 }
 
+void tst_QHashFunctions::qhash_of_long_keys()
+{
+    // exercise the block and tail handling of the vectorized hashes
+    QByteArray buffer(200, Qt::Uninitialized);
+    for (int i = 0; i < buffer.size(); ++i)
+        buffer[i] = char(i * 37 + 11);
+    const QString string = QString::fromLatin1(buffer.constData(), buffer.size());
+
+    for (int len = 0; len <= 100; ++len) {
+        const QByteArray key = buffer.left(len);
+        const uint h = qHash(key, seed);
+        QCOMPARE(qHashBits(key.constData(), size_t(len), seed), h);
+
+        // the hash does not depend on the alignment of the data
+        for (int offset = 1; offset < 16; ++offset) {
+            const QByteArray shifted = QByteArray(offset, 'x') + key;
+            QCOMPARE(qHashBits(shifted.constData() + offset, size_t(len), seed), h);
+        }
+
+        // every byte contributes to the hash
+        for (int i = 0; i < len; ++i) {
+            QByteArray modified = key;
+            modified[i] = char(modified.at(i) ^ 0x10);
+            QVERIFY(qHash(modified, seed) != h);      // not guaranteed
+        }
+        if (len)
+            QVERIFY(qHash(buffer.left(len - 1), seed) != h);    // not guaranteed
+
+        const QString s = string.left(len);
+        QCOMPARE(qHash(QStringView(s), seed), qHash(s, seed));
+        QCOMPARE(qHash(string.leftRef(len), seed), qHash(s, seed));
+    }
+}
+
 void tst_QHashFunctions::fp_qhash_of_zero_is_seed()
 {
     QCOMPARE(qHash(-0.0f, seed), seed);
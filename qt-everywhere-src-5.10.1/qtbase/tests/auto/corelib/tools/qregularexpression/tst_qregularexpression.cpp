@@ -1647,6 +1647,52 @@ void tst_QRegularExpression::pcreJitStackUsage()
     }
 }
 
+void tst_QRegularExpression::maximumJitStackSize()
+{
+    const int oldSize = QRegularExpression::maximumJitStackSize();
+    QCOMPARE(oldSize, 512 * 1024);
+
+    QRegularExpression::setMaximumJitStackSize(4 * 1024 * 1024);
+    QCOMPARE(QRegularExpression::maximumJitStackSize(), 4 * 1024 * 1024);
+
+    // the default stack size is the minimum
+    QRegularExpression::setMaximumJitStackSize(1024);
+    QCOMPARE(QRegularExpression::maximumJitStackSize(), 32 * 1024);
+
+    QRegularExpression::setMaximumJitStackSize(oldSize);
+    QCOMPARE(QRegularExpression::maximumJitStackSize(), oldSize);
+}
+
+void tst_QRegularExpression::sharedCompiledPattern()
+{
+    // independent objects with the same pattern share the compiled pattern;
+    // matching with them must not interfere
+    const QString pattern = QStringLiteral("(\\w+)@(\\w+)\\.com");
+    QRegularExpression re1(pattern);
+    QRegularExpression re2(pattern);
+    QRegularExpression re3(pattern, QRegularExpression::CaseInsensitiveOption);
+
+    for (int i = 0; i < 50; ++i) {
+        QRegularExpressionMatch m1 = re1.match(QStringLiteral("mail user@example.com"));
+        QVERIFY(m1.hasMatch());
+        QCOMPARE(m1.captured(1), QStringLiteral("user"));
+        QCOMPARE(m1.captured(2), QStringLiteral("example"));
+
+        QRegularExpressionMatch m2 = re2.match(QStringLiteral("mail USER@example.COM"));
+        QVERIFY(!m2.hasMatch());
+
+        QRegularExpressionMatch m3 = re3.match(QStringLiteral("mail USER@example.COM"));
+        QVERIFY(m3.hasMatch());
+        QCOMPARE(m3.captured(1), QStringLiteral("USER"));
+    }
+
+    re2.setPattern(QStringLiteral("(a)(b)(c)(d)"));
+    QCOMPARE(re2.captureCount(), 4);
+    QCOMPARE(re1.captureCount(), 2);
+    QCOMPARE(re2.match(QStringLiteral("xabcd")).captured(4), QStringLiteral("d"));
+    QCOMPARE(re1.match(QStringLiteral("a@b.com")).captured(2), QStringLiteral("b"));
+}
+
 void tst_QRegularExpression::regularExpressionMatch_data()
 {
     QTest::addColumn<QString>("pattern");
@@ -63,6 +63,8 @@ private slots:
     void captureNames();
     void pcreJitStackUsage_data();
     void pcreJitStackUsage();
+    void maximumJitStackSize();
+    void sharedCompiledPattern();
     void regularExpressionMatch_data();
     void regularExpressionMatch();
     void JOptionUsage_data();
@@ -472,6 +472,7 @@ private slots:
     void indexOfInvalidRegex();
     void indexOf2_data();
     void indexOf2();
+    void indexOfBlocks();
     void indexOf3_data();
 //  void indexOf3();
     void sprintf();
@@ -518,6 +519,7 @@ private slots:
     void toUcs4();
     void arg();
     void number();
+    void multiArgStringLike();
     void arg_fillChar_data();
     void arg_fillChar();
     void capacity_data();
@@ -1603,6 +1605,43 @@ void tst_QString::indexOf2()
     }
 }
 
+void tst_QString::indexOfBlocks()
+{
+    // searches and comparisons process eight characters at a time where
+    // possible; put the interesting part at every position of those blocks
+    const QChar kelvin(0x212a);
+    for (int pos = 0; pos < 40; ++pos) {
+        QString haystack(60, QLatin1Char('a'));
+        haystack.replace(pos, 6, QLatin1String("Needle"));
+
+        QCOMPARE(haystack.indexOf(QLatin1String("Needle")), pos);
+        QCOMPARE(haystack.indexOf(QString("Needle")), pos);
+        QCOMPARE(haystack.indexOf(QString("nEEDLE"), 0, Qt::CaseInsensitive), pos);
+        QCOMPARE(haystack.indexOf(QString("nEEDLe"), 0, Qt::CaseSensitive), -1);
+        QCOMPARE(haystack.indexOf(QString("Needlf"), 0, Qt::CaseInsensitive), -1);
+        QCOMPARE(haystack.indexOf(QChar('n'), 0, Qt::CaseInsensitive), pos);
+        QCOMPARE(haystack.indexOf(QChar('D'), 0, Qt::CaseInsensitive), pos + 3);
+        QVERIFY(haystack.contains(QString("aNEEDLEa").mid(pos ? 0 : 1), Qt::CaseInsensitive));
+
+        QString upper = haystack.toUpper();
+        QCOMPARE(QString::compare(haystack, upper, Qt::CaseInsensitive), 0);
+        QCOMPARE(QString::compare(haystack, QLatin1String(upper.toLatin1()), Qt::CaseInsensitive), 0);
+        upper[pos] = QLatin1Char('Z');
+        QVERIFY(QString::compare(haystack, upper, Qt::CaseInsensitive) < 0);
+        QVERIFY(QString::compare(haystack, QLatin1String(upper.toLatin1()), Qt::CaseInsensitive) < 0);
+
+        // non-ASCII characters can fold to ASCII ones
+        haystack[pos + 1] = kelvin;
+        QCOMPARE(haystack.indexOf(QString("nkedle"), 0, Qt::CaseInsensitive), pos);
+        QCOMPARE(haystack.indexOf(QChar('K'), 0, Qt::CaseInsensitive), pos + 1);
+        QCOMPARE(QString("aaaaaaaaaaaaka").indexOf(QString(kelvin) + QLatin1Char('a'), 0,
+                                                    Qt::CaseInsensitive), 12);
+        upper = haystack.toUpper();
+        upper[pos + 1] = QLatin1Char('k');
+        QCOMPARE(QString::compare(haystack, upper, Qt::CaseInsensitive), 0);
+    }
+}
+
 void tst_QString::indexOfInvalidRegex()
 {
     QTest::ignoreMessage(QtWarningMsg, "QString::indexOf: invalid QRegularExpression object");
@@ -5967,6 +6006,43 @@ void tst_QString::nanAndInf()
     QVERIFY(qIsInf(valueFromString));
 }
 
+void tst_QString::multiArgStringLike()
+{
+    const QString str = QStringLiteral("one");
+    const QString fmt = QStringLiteral("%1 %2 %3");
+
+    QCOMPARE(fmt.arg(str, QStringView(str), QLatin1String("three")),
+             QLatin1String("one one three"));
+    QCOMPARE(fmt.arg(QLatin1String("a"), QLatin1String("b"), QLatin1String("c")),
+             QLatin1String("a b c"));
+    QCOMPARE(QStringLiteral("%3%1%2").arg(QStringView(), QLatin1String("x"), str),
+             QLatin1String("onex"));
+
+    // placeholders are numbered independently of their order in the format
+    QCOMPARE(QStringLiteral("%99 %50 %1 %50").arg(QLatin1String("a"), QStringView(str), QLatin1String("c")),
+             QLatin1String("c one a one"));
+
+    // more than nine arguments
+    QCOMPARE(QStringLiteral("%1%2%3%4%5%6%7%8%9%10").arg(QLatin1String("0"), QLatin1String("1"),
+                                                         QLatin1String("2"), QLatin1String("3"),
+                                                         QLatin1String("4"), QLatin1String("5"),
+                                                         QLatin1String("6"), QLatin1String("7"),
+                                                         QLatin1String("8"), QLatin1String("9")),
+             QLatin1String("0123456789"));
+
+    // escapes without a matching argument are left in place
+    QCOMPARE(QStringLiteral("%1 %2 %4").arg(QLatin1String("a"), QStringView(str)),
+             QLatin1String("a one %4"));
+
+    QTest::ignoreMessage(QtWarningMsg, "QString::arg: 1 argument(s) missing in %1");
+    QCOMPARE(QStringLiteral("%1").arg(QLatin1String("a"), QLatin1String("b")),
+             QLatin1String("a"));
+
+    // QStringView as a QStringBuilder operand
+    const QString built = QStringView(str) % QLatin1Char('-') % QStringView(fmt).left(2);
+    QCOMPARE(built, QLatin1String("one-%1"));
+}
+
 void tst_QString::arg_fillChar_data()
 {
     QTest::addColumn<QString>("pattern");
@@ -188,6 +188,7 @@ private slots:
     void introspect();
     void introspectUnknownTypes();
     void introspectVirtualObject();
+    void introspectAsync();
     void callMethod();
     void invokeMethod();
     void invokeMethodWithReturn();
@@ -458,6 +459,58 @@ void tst_QDBusInterface::introspectVirtualObject()
                 ".*</interface>.*<interface name=") ));
 }
 
+class IntrospectionCounter: public QDBusVirtualObject
+{
+public:
+    IntrospectionCounter() : introspectCount(0) {}
+
+    QString introspect(const QString &) const
+    {
+        ++introspectCount;
+        return  "  <interface name=\"org.qtproject.QtDBus.AsyncIntrospection\">\n"
+                "    <method name=\"ring\" />\n"
+                "  </interface>\n" ;
+    }
+
+    bool handleMessage(const QDBusMessage &, const QDBusConnection &)
+    {
+        return false;
+    }
+
+    mutable int introspectCount;
+};
+
+void tst_QDBusInterface::introspectAsync()
+{
+    QDBusConnection con = QDBusConnection::sessionBus();
+    QVERIFY(con.isConnected());
+    IntrospectionCounter obj;
+
+    const QString path = "/some/path/asyncIntrospection";
+    const QString interface = "org.qtproject.QtDBus.AsyncIntrospection";
+    QVERIFY(con.registerVirtualObject(path, &obj));
+
+    QDBusPendingCall call = QDBusInterface::introspectAsync(con.baseService(), path, interface, con);
+    QVERIFY(!call.isFinished());
+    QDBusPendingCallWatcher watcher(call);
+    QSignalSpy spy(&watcher, &QDBusPendingCallWatcher::finished);
+    QTRY_COMPARE(spy.count(), 1);
+    QVERIFY(!call.isError());
+    QCOMPARE(obj.introspectCount, 1);
+
+    // the description is cached now
+    QDBusInterface iface(con.baseService(), path, interface, con);
+    QVERIFY(iface.isValid());
+    QVERIFY(iface.metaObject()->indexOfMethod("ring()") != -1);
+    QCOMPARE(obj.introspectCount, 1);
+
+    call = QDBusInterface::introspectAsync(con.baseService(), path, interface, con);
+    QVERIFY(call.isFinished());
+    QCOMPARE(obj.introspectCount, 1);
+
+    con.unregisterObject(path);
+}
+
 void tst_QDBusInterface::callMethod()
 {
     QDBusConnection con = QDBusConnection::sessionBus();
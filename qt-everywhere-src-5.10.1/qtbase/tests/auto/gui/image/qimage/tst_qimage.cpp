@@ -120,6 +120,11 @@ private slots:
 
     void smoothScaleBig();
     void smoothScaleAlpha();
+#ifndef QT_NO_THREAD
+    void parallelProcessing_data();
+    void parallelProcessing();
+    void processingThreadPool();
+#endif
 
     void transformed_data();
     void transformed();
@@ -1857,6 +1862,70 @@ void tst_QImage::smoothScaleBig()
     QCOMPARE(wideScaled.pixel(0, 0), QRgb(0x0));
 }
 
+#ifndef QT_NO_THREAD
+void tst_QImage::parallelProcessing_data()
+{
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<QSize>("scaledSize");
+
+    QTest::newRow("RGB30") << QImage::Format_RGB30 << QSize(1500, 1000);
+    QTest::newRow("RGB444") << QImage::Format_RGB444 << QSize(300, 211);
+    QTest::newRow("ARGB4444_Premultiplied") << QImage::Format_ARGB4444_Premultiplied << QSize(640, 480);
+    QTest::newRow("RGBA8888") << QImage::Format_RGBA8888 << QSize(2000, 120);
+    QTest::newRow("RGB16") << QImage::Format_RGB16 << QSize(97, 1403);
+}
+
+void tst_QImage::parallelProcessing()
+{
+    QFETCH(QImage::Format, format);
+    QFETCH(QSize, scaledSize);
+
+    QImage src(1024, 701, QImage::Format_ARGB32);
+    QRandomGenerator random(0x1234);
+    for (int y = 0; y < src.height(); ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(src.scanLine(y));
+        for (int x = 0; x < src.width(); ++x)
+            line[x] = random.generate();
+    }
+
+    QVERIFY(QImage::isParallelProcessingEnabled());
+    const QImage converted = src.convertToFormat(format);
+    const QImage dithered = src.convertToFormat(format, Qt::OrderedDither | Qt::PreferDither);
+    const QImage convertedInPlace = QImage(src).convertToFormat(format);
+    const QImage scaled = src.scaled(scaledSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+    QImage::setParallelProcessingEnabled(false);
+    QVERIFY(!QImage::isParallelProcessingEnabled());
+    const QImage serialConverted = src.convertToFormat(format);
+    const QImage serialDithered = src.convertToFormat(format, Qt::OrderedDither | Qt::PreferDither);
+    const QImage serialScaled = src.scaled(scaledSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    QImage::setParallelProcessingEnabled(true);
+
+    QCOMPARE(converted, serialConverted);
+    QCOMPARE(dithered, serialDithered);
+    QCOMPARE(convertedInPlace, serialConverted);
+    QCOMPARE(scaled, serialScaled);
+}
+
+void tst_QImage::processingThreadPool()
+{
+    QCOMPARE(QImage::processingThreadPool(), QThreadPool::globalInstance());
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(3);
+    QImage::setProcessingThreadPool(&pool);
+    QCOMPARE(QImage::processingThreadPool(), &pool);
+
+    QImage src(800, 800, QImage::Format_RGB32);
+    src.fill(Qt::red);
+    const QImage converted = src.convertToFormat(QImage::Format_RGB444);
+    QCOMPARE(converted.pixel(799, 799), QColor(Qt::red).rgb());
+
+    QImage::setProcessingThreadPool(nullptr);
+    QCOMPARE(QImage::processingThreadPool(), QThreadPool::globalInstance());
+}
+#endif
+
 void tst_QImage::smoothScaleAlpha()
 {
     QImage src(128, 128, QImage::Format_ARGB32_Premultiplied);
@@ -0,0 +1,6 @@
+CONFIG += testcase
+TARGET = tst_qimagereader
+SOURCES += tst_qimagereader.cpp
+QT += testlib
+
+TESTDATA += images/*
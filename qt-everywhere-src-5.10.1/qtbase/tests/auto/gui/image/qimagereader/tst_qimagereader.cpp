@@ -0,0 +1,179 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+
+#include <qbuffer.h>
+#include <qimage.h>
+#include <qimagereader.h>
+#include <qimagewriter.h>
+#include <qpainter.h>
+#include <qtemporarydir.h>
+
+Q_DECLARE_METATYPE(QImage::Format)
+
+class tst_QImageReader : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void pngClipRect_data();
+    void pngClipRect();
+    void pngScaledInterlaced();
+    void readImages();
+
+private:
+    QImage testImage(QImage::Format format) const;
+    QString adam7File;
+};
+
+void tst_QImageReader::initTestCase()
+{
+    adam7File = QFINDTESTDATA("images/gradient_adam7.png");
+    QVERIFY(!adam7File.isEmpty());
+}
+
+QImage tst_QImageReader::testImage(QImage::Format format) const
+{
+    QImage image(173, 121, QImage::Format_ARGB32);
+    image.fill(Qt::transparent);
+    QPainter p(&image);
+    QLinearGradient gradient(0, 0, image.width(), image.height());
+    gradient.setColorAt(0, QColor(255, 0, 0, 200));
+    gradient.setColorAt(1, QColor(0, 0, 255, 255));
+    p.fillRect(image.rect(), gradient);
+    p.setPen(Qt::black);
+    p.drawEllipse(QRect(10, 10, 100, 80));
+    p.end();
+    return image.convertToFormat(format);
+}
+
+void tst_QImageReader::pngClipRect_data()
+{
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<QRect>("clipRect");
+
+    QTest::newRow("argb32") << QImage::Format_ARGB32 << QRect(17, 23, 64, 48);
+    QTest::newRow("rgb32") << QImage::Format_RGB32 << QRect(0, 0, 173, 1);
+    QTest::newRow("indexed8") << QImage::Format_Indexed8 << QRect(100, 60, 73, 61);
+    QTest::newRow("grayscale8") << QImage::Format_Grayscale8 << QRect(1, 2, 3, 4);
+    QTest::newRow("mono") << QImage::Format_Mono << QRect(3, 5, 77, 31);
+}
+
+void tst_QImageReader::pngClipRect()
+{
+    QFETCH(QImage::Format, format);
+    QFETCH(QRect, clipRect);
+
+    const QImage image = testImage(format);
+    QByteArray data;
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QVERIFY(QImageWriter(&buffer, "png").write(image));
+    buffer.close();
+
+    const QImage full = QImage::fromData(data, "png");
+    QVERIFY(!full.isNull());
+
+    QVERIFY(buffer.open(QIODevice::ReadOnly));
+    QImageReader reader(&buffer, "png");
+    QVERIFY(reader.supportsOption(QImageIOHandler::ClipRect));
+    reader.setClipRect(clipRect);
+    const QImage clipped = reader.read();
+    QCOMPARE(clipped.size(), clipRect.size());
+    QCOMPARE(clipped, full.copy(clipRect));
+}
+
+void tst_QImageReader::pngScaledInterlaced()
+{
+    const QSize scaledSize(32, 24);
+
+    QImageReader fullReader(adam7File);
+    const QImage full = fullReader.read();
+    QCOMPARE(full.size(), QSize(256, 192));
+    const QImage expected = full.scaled(scaledSize, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+    QImageReader reader(adam7File);
+    reader.setScaledSize(scaledSize);
+    const QImage scaled = reader.read();
+    QCOMPARE(scaled.size(), scaledSize);
+    QCOMPARE(scaled.format(), expected.format());
+
+    // only every fourth pixel of every fourth row is decoded, so allow for
+    // small differences on the smooth gradient
+    for (int y = 0; y < scaledSize.height(); ++y) {
+        for (int x = 0; x < scaledSize.width(); ++x) {
+            const QRgb a = scaled.pixel(x, y);
+            const QRgb b = expected.pixel(x, y);
+            QVERIFY2(qAbs(qRed(a) - qRed(b)) <= 4 && qAbs(qGreen(a) - qGreen(b)) <= 4
+                     && qAbs(qBlue(a) - qBlue(b)) <= 4,
+                     qPrintable(QString::fromLatin1("pixel %1,%2: %3 vs %4")
+                                .arg(x).arg(y).arg(a, 8, 16).arg(b, 8, 16)));
+        }
+    }
+
+    QImageReader clipReader(adam7File);
+    clipReader.setClipRect(QRect(5, 7, 50, 60));
+    QCOMPARE(clipReader.read(), full.copy(QRect(5, 7, 50, 60)));
+}
+
+void tst_QImageReader::readImages()
+{
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    QStringList fileNames;
+    const QImage::Format formats[] = { QImage::Format_ARGB32, QImage::Format_RGB32, QImage::Format_Indexed8 };
+    for (QImage::Format format : formats) {
+        const QString fileName = dir.filePath(QString::fromLatin1("image%1.png").arg(fileNames.size()));
+        QVERIFY(testImage(format).save(fileName));
+        fileNames << fileName;
+    }
+    fileNames << adam7File << dir.filePath(QStringLiteral("missing.png"));
+
+    const QVector<QImage> images = QImageReader::readImages(fileNames);
+    QCOMPARE(images.size(), fileNames.size());
+    for (int i = 0; i < fileNames.size() - 1; ++i)
+        QCOMPARE(images.at(i), QImage(fileNames.at(i)));
+    QVERIFY(images.last().isNull());
+
+    const QVector<QImage> thumbnails = QImageReader::readImages(fileNames, QSize(64, 64), Qt::KeepAspectRatio);
+    QCOMPARE(thumbnails.size(), fileNames.size());
+    for (int i = 0; i < fileNames.size() - 1; ++i) {
+        const QSize expectedSize = images.at(i).size().scaled(64, 64, Qt::KeepAspectRatio);
+        QCOMPARE(thumbnails.at(i).size(), expectedSize);
+    }
+    QVERIFY(thumbnails.last().isNull());
+
+    QVERIFY(QImageReader::readImages(QStringList()).isEmpty());
+}
+
+QTEST_MAIN(tst_QImageReader)
+#include "tst_qimagereader.moc"
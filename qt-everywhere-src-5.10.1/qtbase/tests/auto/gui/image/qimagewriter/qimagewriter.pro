@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qimagewriter
+SOURCES += tst_qimagewriter.cpp
+QT += testlib
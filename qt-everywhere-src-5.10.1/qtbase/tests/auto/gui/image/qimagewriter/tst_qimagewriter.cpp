@@ -0,0 +1,146 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+
+#include <qbuffer.h>
+#include <qimage.h>
+#include <qimagereader.h>
+#include <qimagewriter.h>
+#include <qpainter.h>
+
+Q_DECLARE_METATYPE(QImage::Format)
+
+class tst_QImageWriter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void pngSupportedSubTypes();
+    void pngWriteOptions_data();
+    void pngWriteOptions();
+
+private:
+    QByteArray writePng(const QImage &image, int compression, const QByteArray &subType) const;
+};
+
+QByteArray tst_QImageWriter::writePng(const QImage &image, int compression, const QByteArray &subType) const
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    if (!buffer.open(QIODevice::WriteOnly))
+        return QByteArray();
+    QImageWriter writer(&buffer, "png");
+    writer.setCompression(compression);
+    writer.setSubType(subType);
+    if (!writer.write(image))
+        return QByteArray();
+    return data;
+}
+
+void tst_QImageWriter::pngSupportedSubTypes()
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QImageWriter writer(&buffer, "png");
+    QVERIFY(writer.supportsOption(QImageIOHandler::CompressionRatio));
+    QVERIFY(writer.supportsOption(QImageIOHandler::SubType));
+    const QList<QByteArray> expected = QList<QByteArray>()
+            << "none" << "sub" << "up" << "average" << "paeth";
+    QCOMPARE(writer.supportedSubTypes(), expected);
+}
+
+void tst_QImageWriter::pngWriteOptions_data()
+{
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<int>("compression");
+    QTest::addColumn<QByteArray>("subType");
+
+    const QImage::Format formats[] = {
+        QImage::Format_ARGB32, QImage::Format_RGB32, QImage::Format_RGB888,
+        QImage::Format_Indexed8, QImage::Format_Grayscale8, QImage::Format_ARGB32_Premultiplied,
+        QImage::Format_Mono
+    };
+    const char *const formatNames[] = {
+        "argb32", "rgb32", "rgb888", "indexed8", "grayscale8", "argb32pm", "mono"
+    };
+    for (int i = 0; i < int(sizeof(formats) / sizeof(formats[0])); ++i) {
+        for (int compression = 0; compression <= 3; ++compression) {
+            QTest::newRow(QByteArray(formatNames[i]) + ", compression " + QByteArray::number(compression))
+                    << formats[i] << compression << QByteArray();
+        }
+        for (const char *subType : { "none", "sub", "up", "average", "paeth" }) {
+            QTest::newRow(QByteArray(formatNames[i]) + ", " + subType)
+                    << formats[i] << 0 << QByteArray(subType);
+        }
+    }
+}
+
+void tst_QImageWriter::pngWriteOptions()
+{
+    QFETCH(QImage::Format, format);
+    QFETCH(int, compression);
+    QFETCH(QByteArray, subType);
+
+    // large enough to be compressed by several threads
+    QImage image(640, 480, QImage::Format_ARGB32);
+    for (int y = 0; y < image.height(); ++y) {
+        QRgb *line = reinterpret_cast<QRgb *>(image.scanLine(y));
+        for (int x = 0; x < image.width(); ++x)
+            line[x] = qRgba(x, y, (x * y) >> 4, 128 + ((x ^ y) & 127));
+    }
+    QPainter p(&image);
+    p.setPen(Qt::black);
+    p.drawEllipse(QRect(40, 30, 500, 400));
+    p.end();
+    image = image.convertToFormat(format);
+
+    const QByteArray data = writePng(image, compression, subType);
+    QVERIFY(!data.isEmpty());
+    QImage decoded = QImage::fromData(data, "png");
+    QVERIFY(!decoded.isNull());
+
+#ifndef QT_NO_THREAD
+    const bool wasEnabled = QImage::isParallelProcessingEnabled();
+    QImage::setParallelProcessingEnabled(false);
+    const QByteArray serialData = writePng(image, compression, subType);
+    QImage::setParallelProcessingEnabled(wasEnabled);
+    QVERIFY(!serialData.isEmpty());
+    const QImage serialDecoded = QImage::fromData(serialData, "png");
+    QCOMPARE(decoded, serialDecoded);
+#endif
+
+    QImage expected = image;
+    if (expected.format() == QImage::Format_ARGB32_Premultiplied)
+        expected = expected.convertToFormat(QImage::Format_ARGB32);
+    decoded = decoded.convertToFormat(expected.format(), expected.colorTable());
+    QCOMPARE(decoded, expected);
+}
+
+QTEST_MAIN(tst_QImageWriter)
+#include "tst_qimagewriter.moc"
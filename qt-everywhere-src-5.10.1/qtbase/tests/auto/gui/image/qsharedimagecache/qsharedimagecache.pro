@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qsharedimagecache
+QT += gui-private testlib
+SOURCES  += tst_qsharedimagecache.cpp
@@ -0,0 +1,236 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/qtemporaryfile.h>
+#include <QtGui/private/qsharedimagecache_p.h>
+
+class tst_QSharedImageCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+    void insertAndFind();
+    void replace();
+    void remove();
+    void budget();
+    void frequentlyUsedSurvive();
+    void categoriesAreIndependent();
+    void trim();
+    void memoryPressureHandler();
+    void fileKey();
+    void concurrentAccess();
+};
+
+static QImage makeImage(int kilobytes, QRgb color = 0xff000000)
+{
+    // 256 ARGB32 pixels per kilobyte
+    QImage image(256, kilobytes, QImage::Format_ARGB32);
+    image.fill(color);
+    return image;
+}
+
+void tst_QSharedImageCache::init()
+{
+    QSharedImageCache::clear();
+    QSharedImageCache::setBudget(QSharedImageCache::GeneralCategory, 100);
+    QSharedImageCache::setBudget(QSharedImageCache::IconCategory, 100);
+}
+
+void tst_QSharedImageCache::cleanup()
+{
+    QSharedImageCache::clear();
+}
+
+void tst_QSharedImageCache::insertAndFind()
+{
+    const QImage image = makeImage(4, 0xffff0000);
+    QVERIFY(QSharedImageCache::insert(QLatin1String("red"), image));
+    QCOMPARE(QSharedImageCache::usage(QSharedImageCache::GeneralCategory), 4);
+
+    QImage found;
+    QVERIFY(QSharedImageCache::find(QLatin1String("red"), &found));
+    QCOMPARE(found, image);
+    QVERIFY(!QSharedImageCache::find(QLatin1String("blue"), &found));
+
+    QVERIFY(!QSharedImageCache::insert(QLatin1String("null"), QImage()));
+    QVERIFY(!QSharedImageCache::insert(QString(), image));
+}
+
+void tst_QSharedImageCache::replace()
+{
+    QSharedImageCache::insert(QLatin1String("image"), makeImage(4, 0xffff0000));
+    QSharedImageCache::insert(QLatin1String("image"), makeImage(8, 0xff00ff00));
+    QCOMPARE(QSharedImageCache::usage(QSharedImageCache::GeneralCategory), 8);
+
+    QImage found;
+    QVERIFY(QSharedImageCache::find(QLatin1String("image"), &found));
+    QCOMPARE(found.pixel(0, 0), 0xff00ff00);
+}
+
+void tst_QSharedImageCache::remove()
+{
+    QSharedImageCache::insert(QLatin1String("image"), makeImage(4));
+    QSharedImageCache::remove(QLatin1String("image"));
+    QVERIFY(!QSharedImageCache::find(QLatin1String("image"), nullptr));
+    QCOMPARE(QSharedImageCache::usage(QSharedImageCache::GeneralCategory), 0);
+}
+
+void tst_QSharedImageCache::budget()
+{
+    for (int i = 0; i < 50; ++i)
+        QVERIFY(QSharedImageCache::insert(QString::number(i), makeImage(10)));
+    QVERIFY(QSharedImageCache::usage(QSharedImageCache::GeneralCategory) <= 100);
+    // the most recently inserted image is never evicted right away
+    QVERIFY(QSharedImageCache::find(QString::number(49), nullptr));
+
+    // images larger than the budget are rejected
+    QVERIFY(!QSharedImageCache::insert(QLatin1String("huge"), makeImage(200)));
+
+    QSharedImageCache::setBudget(QSharedImageCache::GeneralCategory, 20);
+    QCOMPARE(QSharedImageCache::budget(QSharedImageCache::GeneralCategory), 20);
+    QVERIFY(QSharedImageCache::usage(QSharedImageCache::GeneralCategory) <= 20);
+}
+
+void tst_QSharedImageCache::frequentlyUsedSurvive()
+{
+    QSharedImageCache::insert(QLatin1String("frequent"), makeImage(10));
+    for (int i = 0; i < 9; ++i)
+        QSharedImageCache::insert(QString::number(i), makeImage(10));
+
+    // "frequent" is the least recently used entry, but was hit since
+    for (int i = 0; i < 20; ++i) {
+        QVERIFY(QSharedImageCache::find(QLatin1String("frequent"), nullptr));
+        QSharedImageCache::insert(QLatin1String("new") + QString::number(i), makeImage(10));
+    }
+    QVERIFY(QSharedImageCache::find(QLatin1String("frequent"), nullptr));
+}
+
+void tst_QSharedImageCache::categoriesAreIndependent()
+{
+    QSharedImageCache::insert(QLatin1String("icon"), makeImage(50), QSharedImageCache::IconCategory);
+    for (int i = 0; i < 20; ++i)
+        QSharedImageCache::insert(QString::number(i), makeImage(10));
+
+    QVERIFY(QSharedImageCache::find(QLatin1String("icon"), nullptr));
+    QCOMPARE(QSharedImageCache::usage(QSharedImageCache::IconCategory), 50);
+}
+
+void tst_QSharedImageCache::trim()
+{
+    for (int i = 0; i < 10; ++i)
+        QSharedImageCache::insert(QString::number(i), makeImage(10));
+    QCOMPARE(QSharedImageCache::usage(QSharedImageCache::GeneralCategory), 100);
+
+    QSharedImageCache::trim(QSharedImageCache::TrimModerate);
+    QVERIFY(QSharedImageCache::usage(QSharedImageCache::GeneralCategory) <= 50);
+    QVERIFY(QSharedImageCache::usage(QSharedImageCache::GeneralCategory) > 0);
+
+    QSharedImageCache::trim(QSharedImageCache::TrimAll);
+    QCOMPARE(QSharedImageCache::usage(QSharedImageCache::GeneralCategory), 0);
+}
+
+void tst_QSharedImageCache::memoryPressureHandler()
+{
+    QVector<QSharedImageCache::TrimLevel> levels;
+    const int id = QSharedImageCache::addMemoryPressureHandler([&levels](QSharedImageCache::TrimLevel level) {
+        levels.append(level);
+    });
+    QVERIFY(id > 0);
+
+    QSharedImageCache::trim(QSharedImageCache::TrimModerate);
+    QSharedImageCache::trim(QSharedImageCache::TrimAll);
+    QCOMPARE(levels.size(), 2);
+    QCOMPARE(levels.at(0), QSharedImageCache::TrimModerate);
+    QCOMPARE(levels.at(1), QSharedImageCache::TrimAll);
+
+    QSharedImageCache::removeMemoryPressureHandler(id);
+    QSharedImageCache::trim(QSharedImageCache::TrimAll);
+    QCOMPARE(levels.size(), 2);
+}
+
+void tst_QSharedImageCache::fileKey()
+{
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    file.write("data");
+    file.flush();
+
+    const QFileInfo info(file.fileName());
+    const QString key = QSharedImageCache::fileKey(info);
+    QVERIFY(!key.isEmpty());
+    QCOMPARE(QSharedImageCache::fileKey(info), key);
+    QVERIFY(QSharedImageCache::fileKey(info, QSize(16, 16)) != key);
+
+    // the key changes with the contents of the file
+    file.write("more data");
+    file.flush();
+    QVERIFY(QSharedImageCache::fileKey(QFileInfo(file.fileName())) != key);
+
+    QVERIFY(QSharedImageCache::fileKey(QFileInfo(QLatin1String("does/not/exist.png"))).isEmpty());
+}
+
+class CacheUser : public QThread
+{
+public:
+    explicit CacheUser(int id) : id(id) {}
+
+    void run() override
+    {
+        for (int i = 0; i < 500; ++i) {
+            const QString key = QString::number((id * 7 + i) % 40);
+            QImage image;
+            if (!QSharedImageCache::find(key, &image))
+                QSharedImageCache::insert(key, makeImage(5));
+            if (i % 50 == 0)
+                QSharedImageCache::remove(key);
+        }
+    }
+
+    int id;
+};
+
+void tst_QSharedImageCache::concurrentAccess()
+{
+    QVector<CacheUser *> threads;
+    for (int i = 0; i < 8; ++i)
+        threads.append(new CacheUser(i));
+    for (CacheUser *thread : qAsConst(threads))
+        thread->start();
+    for (CacheUser *thread : qAsConst(threads))
+        QVERIFY(thread->wait(30000));
+    qDeleteAll(threads);
+
+    QVERIFY(QSharedImageCache::usage(QSharedImageCache::GeneralCategory) <= 100);
+    QVERIFY(QSharedImageCache::usage(QSharedImageCache::GeneralCategory) >= 0);
+}
+
+QTEST_MAIN(tst_QSharedImageCache)
+#include "tst_qsharedimagecache.moc"
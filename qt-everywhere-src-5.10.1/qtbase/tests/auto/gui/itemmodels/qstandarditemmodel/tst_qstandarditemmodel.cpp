@@ -95,6 +95,7 @@ private slots:
     void persistentIndexes();
     void removingPersistentIndexes();
     void updatingPersistentIndexes();
+    void persistentIndexesInRemovedSubtrees();
 
     void checkChildren();
     void data();
@@ -647,6 +648,68 @@ void tst_QStandardItemModel::updatingPersistentIndexes()
                         this, SLOT(updateRowAboutToBeRemoved()));
 }
 
+void tst_QStandardItemModel::persistentIndexesInRemovedSubtrees()
+{
+    QStandardItemModel model;
+    for (int i = 0; i < 3; ++i) {
+        QStandardItem *top = new QStandardItem(QString::number(i));
+        for (int j = 0; j < 3; ++j) {
+            QStandardItem *child = new QStandardItem(QString::number(i * 10 + j));
+            for (int k = 0; k < 3; ++k)
+                child->appendRow(new QStandardItem(QString::number(i * 100 + j * 10 + k)));
+            top->appendRow(child);
+        }
+        model.appendRow(top);
+    }
+
+    // persistent indexes on the two lower levels, sharing their ancestors
+    QList<QPersistentModelIndex> children;
+    QList<QPersistentModelIndex> grandChildren;
+    for (int i = 0; i < 3; ++i) {
+        const QModelIndex top = model.index(i, 0);
+        for (int j = 0; j < 3; ++j) {
+            const QModelIndex child = model.index(j, 0, top);
+            children << child;
+            for (int k = 0; k < 3; ++k)
+                grandChildren << model.index(k, 0, child);
+        }
+    }
+
+    // removing a child invalidates its subtree and moves its siblings up
+    QVERIFY(model.removeRow(0, model.index(0, 0)));
+    for (int k = 0; k < 3; ++k)
+        QVERIFY(!grandChildren.at(k).isValid());
+    QVERIFY(!children.at(0).isValid());
+    QCOMPARE(children.at(1).row(), 0);
+    QCOMPARE(children.at(2).row(), 1);
+    for (int k = 3; k < 9; ++k) {
+        QVERIFY(grandChildren.at(k).isValid());
+        QCOMPARE(grandChildren.at(k).row(), k % 3);
+        QCOMPARE(grandChildren.at(k).data().toInt(), (k / 3) * 10 + k % 3);
+    }
+
+    // removing a top level item invalidates all of its descendants
+    QVERIFY(model.removeRow(1));
+    for (int j = 3; j < 6; ++j)
+        QVERIFY(!children.at(j).isValid());
+    for (int k = 9; k < 18; ++k)
+        QVERIFY(!grandChildren.at(k).isValid());
+    for (int k = 18; k < 27; ++k) {
+        QVERIFY(grandChildren.at(k).isValid());
+        QCOMPARE(grandChildren.at(k).parent().parent().row(), 1);
+    }
+    for (int j = 6; j < 9; ++j) {
+        QVERIFY(children.at(j).isValid());
+        QCOMPARE(children.at(j).parent().row(), 1);
+        QCOMPARE(children.at(j).data().toInt(), 20 + j - 6);
+    }
+
+    // removing a column under the root invalidates everything below it
+    QVERIFY(model.removeColumn(0));
+    for (const QPersistentModelIndex &index : qAsConst(grandChildren))
+        QVERIFY(!index.isValid());
+}
+
 void tst_QStandardItemModel::modelChanged(ModelChanged change, const QModelIndex &parent,
                                           int first, int last)
 {
@@ -0,0 +1,4 @@
+CONFIG += testcase
+TARGET = tst_qsharedmemorygraphicscache
+SOURCES += tst_qsharedmemorygraphicscache.cpp
+QT += testlib gui-private graphics_support-private
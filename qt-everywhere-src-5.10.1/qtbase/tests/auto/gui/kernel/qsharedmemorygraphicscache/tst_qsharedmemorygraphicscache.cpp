@@ -0,0 +1,168 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtTest/QtTest>
+
+#include <qimage.h>
+#include <QtGraphicsSupport/private/qsharedmemorygraphicscache_p.h>
+
+class CacheClient
+{
+public:
+    explicit CacheClient(const QByteArray &key)
+        : cache(key)
+    {
+        QObject::connect(&cache, &QPlatformSharedGraphicsCache::itemsMissing,
+                         [this](const QByteArray &, const QVector<quint32> &ids) { missing += ids; });
+        QObject::connect(&cache, &QPlatformSharedGraphicsCache::itemsAvailable,
+                         [this](const QByteArray &, void *buffer, const QVector<quint32> &ids,
+                                const QVector<QPoint> &positions) {
+            bufferId = buffer;
+            for (int i = 0; i < ids.size(); ++i)
+                available.insert(ids.at(i), positions.at(i));
+        });
+        QObject::connect(&cache, &QPlatformSharedGraphicsCache::itemsInvalidated,
+                         [this](const QByteArray &, const QVector<quint32> &ids) { invalidated += ids; });
+        cache.ensureCacheInitialized(cacheId, QPlatformSharedGraphicsCache::OpenGLTexture,
+                                     QPlatformSharedGraphicsCache::Alpha8);
+    }
+
+    void clear()
+    {
+        missing.clear();
+        available.clear();
+        invalidated.clear();
+    }
+
+    const QByteArray cacheId = QByteArrayLiteral("Sans 12 DF");
+    QSharedMemoryGraphicsCache cache;
+    QVector<quint32> missing;
+    QHash<quint32, QPoint> available;
+    QVector<quint32> invalidated;
+    void *bufferId = nullptr;
+};
+
+class tst_QSharedMemoryGraphicsCache : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void shareItems();
+    void batchRequests();
+    void resetWhenFull();
+
+private:
+    static QImage glyph(int size, int value);
+    QByteArray uniqueKey() const;
+};
+
+QImage tst_QSharedMemoryGraphicsCache::glyph(int size, int value)
+{
+    QImage image(size, size, QImage::Format_Alpha8);
+    image.fill(value);
+    return image;
+}
+
+QByteArray tst_QSharedMemoryGraphicsCache::uniqueKey() const
+{
+    return "tst_qsharedmemorygraphicscache_" + QByteArray::number(QCoreApplication::applicationPid())
+            + '_' + QTest::currentTestFunction();
+}
+
+void tst_QSharedMemoryGraphicsCache::shareItems()
+{
+    // two caches with the same key stand in for two processes
+    const QByteArray key = uniqueKey();
+    CacheClient first(key);
+    CacheClient second(key);
+
+    const QVector<quint32> ids = { 1, 2, 3 };
+    first.cache.requestItems(first.cacheId, ids);
+    QCOMPARE(first.missing, ids);
+    QVERIFY(first.available.isEmpty());
+
+    first.cache.insertItems(first.cacheId, ids, { glyph(10, 1), glyph(20, 2), glyph(30, 3) });
+    QCOMPARE(first.available.size(), 3);
+    QVERIFY(first.bufferId);
+    QCOMPARE(first.cache.sizeOfBuffer(first.bufferId), QSize(2048, 2048));
+
+    second.cache.requestItems(second.cacheId, ids);
+    QVERIFY(second.missing.isEmpty());
+    QCOMPARE(second.available, first.available);
+
+    // the items do not overlap
+    QRect previous;
+    for (quint32 id : ids) {
+        const QRect rect(first.available.value(id), QSize(id * 10, id * 10));
+        QVERIFY(!rect.intersects(previous));
+        previous = rect;
+    }
+
+    first.cache.referenceBuffer(first.bufferId);
+    first.cache.referenceBuffer(first.bufferId);
+    QVERIFY(first.cache.dereferenceBuffer(first.bufferId));
+    QVERIFY(!first.cache.dereferenceBuffer(first.bufferId));
+}
+
+void tst_QSharedMemoryGraphicsCache::batchRequests()
+{
+    CacheClient client(uniqueKey());
+
+    client.cache.beginRequestBatch();
+    QVERIFY(client.cache.requestBatchStarted());
+    client.cache.requestItems(client.cacheId, { 7 });
+    client.cache.requestItems(client.cacheId, { 8, 7 });
+    QVERIFY(client.missing.isEmpty());
+    client.cache.endRequestBatch();
+    QVERIFY(!client.cache.requestBatchStarted());
+    QCOMPARE(client.missing, QVector<quint32>({ 7, 8 }));
+}
+
+void tst_QSharedMemoryGraphicsCache::resetWhenFull()
+{
+    const QByteArray key = uniqueKey();
+    CacheClient first(key);
+    CacheClient second(key);
+
+    first.cache.insertItems(first.cacheId, { 1 }, { glyph(512, 1) });
+    second.cache.requestItems(second.cacheId, { 1 });
+    QVERIFY(second.available.contains(1));
+
+    // 16 of these fill the atlas, the 17th resets it
+    for (quint32 id = 2; id <= 17; ++id)
+        first.cache.insertItems(first.cacheId, { id }, { glyph(510, id) });
+    QCOMPARE(first.invalidated.size(), 16);
+    QVERIFY(first.invalidated.contains(1));
+    QCOMPARE(first.available.value(17), QPoint(0, 0));
+
+    second.cache.requestItems(second.cacheId, { 17 });
+    QCOMPARE(second.invalidated, QVector<quint32>({ 1 }));
+    QCOMPARE(second.available.value(17), QPoint(0, 0));
+}
+
+QTEST_MAIN(tst_QSharedMemoryGraphicsCache)
+#include "tst_qsharedmemorygraphicscache.moc"
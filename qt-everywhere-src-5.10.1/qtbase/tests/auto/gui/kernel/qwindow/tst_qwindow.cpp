@@ -85,6 +85,7 @@ private slots:
     void mouseEventSequence();
     void windowModality();
     void inputReentrancy();
+    void motionCompression();
     void tabletEvents();
     void windowModality_QTBUG27039();
     void visibility();
@@ -924,6 +925,7 @@ public:
             ++mouseMovedCount;
             mouseMoveButton = event->button();
             mouseMoveScreenPos = event->screenPos();
+            mouseMoveHistory = QGuiApplicationPrivate::motionHistory();
         }
     }
     void mouseDoubleClickEvent(QMouseEvent *event) {
@@ -953,6 +955,7 @@ public:
                 break;
             case Qt::TouchPointMoved:
                 ++touchMovedCount;
+                touchMoveHistory = QGuiApplicationPrivate::motionHistory();
                 break;
             default:
                 break;
@@ -992,6 +995,7 @@ public:
     int mousePressedCount, mouseReleasedCount, mouseMovedCount, mouseDoubleClickedCount;
     QString mouseSequenceSignature;
     QPointF mousePressScreenPos, mouseMoveScreenPos, mousePressLocalPos;
+    QVector<QWindowSystemInterfacePrivate::MotionSample> mouseMoveHistory, touchMoveHistory;
     int touchPressedCount, touchReleasedCount, touchMovedCount;
     QEvent::Type touchEventType;
     int enterEventCount, leaveEventCount;
@@ -1662,6 +1666,66 @@ void tst_QWindow::inputReentrancy()
     QCOMPARE(window.touchReleasedCount, 1);
 }
 
+void tst_QWindow::motionCompression()
+{
+    const bool compress = QCoreApplication::testAttribute(Qt::AA_CompressHighFrequencyEvents);
+    QCoreApplication::setAttribute(Qt::AA_CompressHighFrequencyEvents, true);
+
+    InputTestWindow window;
+    window.setGeometry(QRect(m_availableTopLeft + QPoint(80, 80), m_testWindowSize));
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    // Consecutive moves are delivered as one event that carries all positions.
+    QPointF local(12, 34);
+    for (int i = 0; i < 5; ++i, local += QPointF(2, 1))
+        QWindowSystemInterface::handleMouseEvent(&window, local, window.mapToGlobal(local.toPoint()), Qt::NoButton);
+    QCoreApplication::processEvents();
+    QCOMPARE(window.mouseMovedCount, 1);
+    QCOMPARE(window.mouseMoveScreenPos, QPointF(window.mapToGlobal(QPoint(20, 38))));
+    QCOMPARE(window.mouseMoveHistory.size(), 5);
+    QCOMPARE(window.mouseMoveHistory.first().localPos, QPointF(12, 34));
+    QCOMPARE(window.mouseMoveHistory.last().localPos, QPointF(20, 38));
+
+    // A press is never merged with the moves around it.
+    window.resetCounters();
+    QWindowSystemInterface::handleMouseEvent(&window, local, local, Qt::NoButton);
+    QWindowSystemInterface::handleMouseEvent(&window, local, local, Qt::LeftButton);
+    local += QPointF(2, 2);
+    QWindowSystemInterface::handleMouseEvent(&window, local, local, Qt::LeftButton);
+    local += QPointF(2, 2);
+    QWindowSystemInterface::handleMouseEvent(&window, local, local, Qt::LeftButton);
+    QWindowSystemInterface::handleMouseEvent(&window, local, local, Qt::NoButton);
+    QCoreApplication::processEvents();
+    QCOMPARE(window.mousePressedCount, 1);
+    QCOMPARE(window.mouseMovedCount, 2);
+    QCOMPARE(window.mouseReleasedCount, 1);
+    QCOMPARE(window.mouseSequenceSignature, QLatin1String("pr"));
+
+    // Touch updates of the same points are merged as well.
+    QList<QWindowSystemInterface::TouchPoint> points;
+    QWindowSystemInterface::TouchPoint tp1;
+    tp1.id = 1;
+    tp1.state = Qt::TouchPointPressed;
+    tp1.area = QRectF(10, 10, 4, 4);
+    points << tp1;
+    QWindowSystemInterface::handleTouchEvent(&window, touchDevice, points);
+    points[0].state = Qt::TouchPointMoved;
+    for (int i = 0; i < 4; ++i) {
+        points[0].area.translate(3, 0);
+        QWindowSystemInterface::handleTouchEvent(&window, touchDevice, points);
+    }
+    points[0].state = Qt::TouchPointReleased;
+    QWindowSystemInterface::handleTouchEvent(&window, touchDevice, points);
+    QCoreApplication::processEvents();
+    QCOMPARE(window.touchPressedCount, 1);
+    QCOMPARE(window.touchMovedCount, 1);
+    QCOMPARE(window.touchReleasedCount, 1);
+    QCOMPARE(window.touchMoveHistory.size(), 4);
+
+    QCoreApplication::setAttribute(Qt::AA_CompressHighFrequencyEvents, compress);
+}
+
 #if QT_CONFIG(tabletevent)
 class TabletTestWindow : public QWindow
 {
@@ -48,6 +48,12 @@
 #include <qrandom.h>
 
 #include <private/qdrawhelper_p.h>
+
+#ifdef QT_BUILD_INTERNAL
+QT_BEGIN_NAMESPACE
+extern Q_GUI_EXPORT QBasicAtomicInt qt_raster_parallel_blend;
+QT_END_NAMESPACE
+#endif
 #include <qpainter.h>
 
 #ifndef QT_NO_WIDGETS
@@ -252,6 +258,8 @@ private slots:
     void inactivePainter();
 
     void extendedBlendModes();
+    void separableBlendModes_data();
+    void separableBlendModes();
 
     void zeroOpacity();
     void clippingBug();
@@ -306,6 +314,12 @@ private slots:
 
     void fillPolygon();
 
+    void parallelBlend_data();
+    void parallelBlend();
+
+    void strokeCaching_data();
+    void strokeCaching();
+
 private:
     void fillData();
     void setPenColor(QPainter& p);
@@ -4225,6 +4239,86 @@ void tst_QPainter::extendedBlendModes()
     QVERIFY(testCompositionMode(191, 191,  96, QPainter::CompositionMode_Exclusion));
 }
 
+void tst_QPainter::separableBlendModes_data()
+{
+    QTest::addColumn<QPainter::CompositionMode>("mode");
+    QTest::addColumn<qreal>("opacity");
+
+    const QPainter::CompositionMode modes[] = {
+        QPainter::CompositionMode_Multiply,
+        QPainter::CompositionMode_Screen,
+        QPainter::CompositionMode_Darken,
+        QPainter::CompositionMode_Lighten,
+        QPainter::CompositionMode_Difference,
+        QPainter::CompositionMode_Exclusion
+    };
+    for (QPainter::CompositionMode mode : modes) {
+        QTest::newRow(qPrintable(QString::fromLatin1("%1, opaque").arg(mode))) << mode << qreal(1.0);
+        QTest::newRow(qPrintable(QString::fromLatin1("%1, translucent").arg(mode))) << mode << qreal(0.6);
+    }
+}
+
+// Blending whole scanlines goes through the SIMD code paths where there are
+// any, blending one pixel at a time only through the plain C ones.
+void tst_QPainter::separableBlendModes()
+{
+    QFETCH(QPainter::CompositionMode, mode);
+    QFETCH(qreal, opacity);
+
+    const int width = 67;
+    const int height = 8;
+    QImage src(width, height, QImage::Format_ARGB32_Premultiplied);
+    QImage dst(width, height, QImage::Format_ARGB32_Premultiplied);
+    uint seed = 1;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            seed = seed * 1103515245 + 12345;
+            src.setPixel(x, y, qPremultiply(seed));
+            seed = seed * 1103515245 + 12345;
+            dst.setPixel(x, y, qPremultiply(seed ^ 0x5a5a5a5a));
+        }
+    }
+    const QColor color(QRgb(0xb4308ad2));
+
+    QImage scanlines = dst;
+    QImage pixels = dst;
+    {
+        QPainter p(&scanlines);
+        p.setCompositionMode(mode);
+        p.setOpacity(opacity);
+        p.drawImage(0, 0, src);
+    }
+    {
+        QPainter p(&pixels);
+        p.setCompositionMode(mode);
+        p.setOpacity(opacity);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x)
+                p.drawImage(x, y, src, x, y, 1, 1);
+        }
+    }
+    QCOMPARE(scanlines, pixels);
+
+    scanlines = dst;
+    pixels = dst;
+    {
+        QPainter p(&scanlines);
+        p.setCompositionMode(mode);
+        p.setOpacity(opacity);
+        p.fillRect(scanlines.rect(), color);
+    }
+    {
+        QPainter p(&pixels);
+        p.setCompositionMode(mode);
+        p.setOpacity(opacity);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x)
+                p.fillRect(x, y, 1, 1, color);
+        }
+    }
+    QCOMPARE(scanlines, pixels);
+}
+
 void tst_QPainter::zeroOpacity()
 {
     QImage source(1, 1, QImage::Format_ARGB32_Premultiplied);
@@ -5253,6 +5347,154 @@ void tst_QPainter::fillPolygon()
     }
 }
 
+void tst_QPainter::parallelBlend_data()
+{
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<int>("scene");
+
+    const struct {
+        QImage::Format format;
+        const char *name;
+    } formats[] = {
+        { QImage::Format_ARGB32_Premultiplied, "ARGB32_PM" },
+        { QImage::Format_RGB32, "RGB32" },
+        { QImage::Format_RGB888, "RGB888" },
+        { QImage::Format_Grayscale8, "Grayscale8" }
+    };
+    const char *scenes[] = { "solid", "gradient", "texture", "clipped" };
+
+    for (const auto &format : formats) {
+        for (int scene = 0; scene < int(sizeof(scenes) / sizeof(scenes[0])); ++scene) {
+            QTest::newRow(QByteArray(format.name) + ' ' + scenes[scene])
+                    << format.format << scene;
+        }
+    }
+}
+
+static QImage renderParallelBlendScene(QImage::Format format, int scene)
+{
+    QImage image(1600, 1200, format);
+    image.fill(Qt::white);
+
+    QPainter p(&image);
+    p.setRenderHint(QPainter::Antialiasing);
+    p.setPen(Qt::NoPen);
+    switch (scene) {
+    case 0:
+        p.setBrush(QColor(40, 80, 160, 180));
+        p.drawEllipse(QRectF(10.5, 20.25, 1500, 1100));
+        break;
+    case 1: {
+        QRadialGradient gradient(800, 600, 700);
+        gradient.setColorAt(0, QColor(255, 0, 0, 200));
+        gradient.setColorAt(0.5, Qt::green);
+        gradient.setColorAt(1, QColor(0, 0, 255, 100));
+        p.setCompositionMode(QPainter::CompositionMode_Multiply);
+        p.setBrush(gradient);
+        p.drawRoundedRect(QRectF(5, 5, 1590, 1190), 200, 200);
+        break;
+    }
+    case 2: {
+        QImage texture(64, 64, QImage::Format_ARGB32_Premultiplied);
+        for (int y = 0; y < texture.height(); ++y) {
+            for (int x = 0; x < texture.width(); ++x)
+                texture.setPixel(x, y, ((x / 8 + y / 8) & 1) ? 0xff204080 : 0x80c0a000);
+        }
+        p.setRenderHint(QPainter::SmoothPixmapTransform);
+        p.translate(800, 600);
+        p.rotate(17);
+        p.setBrush(QBrush(texture));
+        p.drawRect(QRectF(-900, -700, 1800, 1400));
+        break;
+    }
+    case 3: {
+        QPainterPath clip;
+        clip.addEllipse(QRectF(0, 0, 1600, 1200));
+        p.setClipPath(clip);
+        QLinearGradient gradient(0, 0, 1600, 1200);
+        gradient.setColorAt(0, Qt::black);
+        gradient.setColorAt(1, QColor(255, 255, 0, 128));
+        p.setBrush(gradient);
+        p.drawRect(image.rect());
+        break;
+    }
+    }
+    p.end();
+    return image;
+}
+
+void tst_QPainter::parallelBlend()
+{
+#ifdef QT_BUILD_INTERNAL
+    QFETCH(QImage::Format, format);
+    QFETCH(int, scene);
+
+    const int oldValue = qt_raster_parallel_blend.load();
+    qt_raster_parallel_blend.store(0);
+    const QImage serial = renderParallelBlendScene(format, scene);
+    qt_raster_parallel_blend.store(1);
+    const QImage parallel = renderParallelBlendScene(format, scene);
+    qt_raster_parallel_blend.store(oldValue);
+
+    QCOMPARE(parallel, serial);
+#else
+    QSKIP("This test requires a developer build");
+#endif
+}
+
+void tst_QPainter::strokeCaching_data()
+{
+    QTest::addColumn<QPen>("pen");
+
+    QTest::newRow("solid") << QPen(Qt::red, 6);
+    QTest::newRow("round join") << QPen(Qt::red, 9, Qt::SolidLine, Qt::RoundCap, Qt::RoundJoin);
+    QTest::newRow("dashed") << QPen(Qt::red, 3, Qt::DashDotLine);
+    QTest::newRow("cosmetic") << QPen(Qt::red, 0);
+    QTest::newRow("cosmetic dashed") << QPen(Qt::red, 0, Qt::DashLine);
+}
+
+void tst_QPainter::strokeCaching()
+{
+    QFETCH(QPen, pen);
+
+    QPainterPath path;
+    path.moveTo(10, 10);
+    path.cubicTo(80, 0, 20, 90, 90, 90);
+    path.lineTo(30, 70);
+    path.quadTo(5, 40, 10, 10);
+
+    const QTransform transforms[] = {
+        QTransform(),
+        QTransform(),
+        QTransform::fromScale(1.5, 1.5),
+        QTransform::fromScale(1.5, 1.5),
+        QTransform().rotate(20),
+        QTransform()
+    };
+
+    QImage reference(150, 150, QImage::Format_ARGB32_Premultiplied);
+    QImage cached(150, 150, QImage::Format_ARGB32_Premultiplied);
+
+    for (const QTransform &transform : transforms) {
+        for (int i = 0; i < 2; ++i) {
+            QImage &image = i ? cached : reference;
+            image.fill(Qt::white);
+            QPainter p(&image);
+            p.setRenderHint(QPainter::Antialiasing);
+            p.setRenderHint(QPainter::StrokeCaching, i == 1);
+            p.setTransform(transform);
+            p.strokePath(path, pen);
+
+            // the brush is not part of the cached stroke
+            QPen bluePen = pen;
+            bluePen.setColor(Qt::blue);
+            p.setOpacity(0.5);
+            p.strokePath(path, bluePen);
+        }
+        QCOMPARE(cached, reference);
+    }
+}
+
 QTEST_MAIN(tst_QPainter)
 
 #include "tst_qpainter.moc"
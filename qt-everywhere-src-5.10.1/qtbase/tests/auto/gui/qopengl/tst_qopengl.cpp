@@ -44,6 +44,7 @@
 #include <QtGui/qopengltextureblitter.h>
 #include <QtGui/private/qguiapplication_p.h>
 #include <QtGui/private/qopenglextensions_p.h>
+#include <QtGui/private/qopengldamagehistory_p.h>
 #include <qpa/qplatformintegration.h>
 #include <qpa/qplatformnativeinterface.h>
 
@@ -112,6 +113,7 @@ private slots:
     void bufferCreate();
     void bufferMapRange();
     void defaultQGLCurrentBuffer();
+    void damageHistory();
 };
 
 struct SharedResourceTracker
@@ -1624,6 +1626,41 @@ void tst_QOpenGL::nullTextureInitializtion()
     QVERIFY(!t.isCreated());
 }
 
+void tst_QOpenGL::damageHistory()
+{
+    const QRect surface(0, 0, 100, 100);
+    const QRect a(0, 0, 10, 10);
+    const QRect b(20, 20, 10, 10);
+    const QRect c(50, 50, 10, 10);
+    QOpenGLDamageHistory history;
+
+    // nothing is known about a new surface
+    QCOMPARE(history.repaintRegion(a, 1, surface), QRegion(surface));
+    history.addFrame(surface, surface);
+    history.addFrame(a, surface);
+    history.addFrame(b, surface);
+
+    // the buffer age decides how many previous frames are stale
+    QCOMPARE(history.repaintRegion(c, 1, surface), QRegion(c));
+    QCOMPARE(history.repaintRegion(c, 2, surface), QRegion(c) | b);
+    QCOMPARE(history.repaintRegion(c, 3, surface), QRegion(c) | b | a);
+    QCOMPARE(history.repaintRegion(c, 4, surface), QRegion(surface));
+
+    // undefined content and unknown ages repaint everything
+    QCOMPARE(history.repaintRegion(c, 0, surface), QRegion(surface));
+    QCOMPARE(history.repaintRegion(c, 5, surface), QRegion(surface));
+
+    // so do resizes, which start a new history
+    const QRect resized(0, 0, 50, 50);
+    QCOMPARE(history.repaintRegion(c, 1, resized), QRegion(resized));
+    history.addFrame(resized, resized);
+    history.addFrame(b, resized);
+    QCOMPARE(history.repaintRegion(a, 2, resized), QRegion(a) | b);
+    QCOMPARE(history.repaintRegion(a, 4, resized), QRegion(resized));
+
+    QCOMPARE(QOpenGLDamageHistory::scissorRect(QRegion(a) | b, 100), QRect(0, 70, 30, 30));
+}
+
 QTEST_MAIN(tst_QOpenGL)
 
 #include "tst_qopengl.moc"
@@ -93,6 +93,9 @@ private slots:
 
     void fallbackFontsOrder();
 
+    void prefetchGlyphs_data();
+    void prefetchGlyphs();
+
 private:
     QString testFont;
     QString testFontBoldItalic;
@@ -105,6 +108,7 @@ Q_DECLARE_METATYPE(QFont::HintingPreference)
 Q_DECLARE_METATYPE(QFont::Style)
 Q_DECLARE_METATYPE(QFont::Weight)
 Q_DECLARE_METATYPE(QFontDatabase::WritingSystem)
+Q_DECLARE_METATYPE(QRawFont::AntialiasingType)
 
 void tst_QRawFont::init()
 {
@@ -1044,6 +1048,44 @@ void tst_QRawFont::fallbackFontsOrder()
     fontDatabase.removeApplicationFont(id);
 }
 
+void tst_QRawFont::prefetchGlyphs_data()
+{
+    QTest::addColumn<QRawFont::AntialiasingType>("antialiasingType");
+    QTest::addColumn<QFont::HintingPreference>("hintingPreference");
+
+    QTest::newRow("pixel antialiasing") << QRawFont::PixelAntialiasing << QFont::PreferDefaultHinting;
+    QTest::newRow("subpixel antialiasing") << QRawFont::SubPixelAntialiasing << QFont::PreferDefaultHinting;
+    QTest::newRow("pixel antialiasing, full hinting") << QRawFont::PixelAntialiasing << QFont::PreferFullHinting;
+}
+
+void tst_QRawFont::prefetchGlyphs()
+{
+    QFETCH(QRawFont::AntialiasingType, antialiasingType);
+    QFETCH(QFont::HintingPreference, hintingPreference);
+
+    // enough glyphs to be rendered by several threads
+    QVector<quint32> glyphIndexes;
+    for (quint32 i = 0; i < 120; ++i)
+        glyphIndexes << i << i;
+
+    QRawFont prefetched(testFontBoldItalic, 24, hintingPreference);
+    QRawFont reference(testFontBoldItalic, 24, hintingPreference);
+    QVERIFY(prefetched.isValid());
+    QVERIFY(reference.isValid());
+
+    prefetched.prefetchGlyphs(glyphIndexes, antialiasingType);
+    // prefetching cached glyphs again is a no-op
+    prefetched.prefetchGlyphs(glyphIndexes, antialiasingType);
+
+    for (int i = 0; i < glyphIndexes.size(); i += 2) {
+        const quint32 glyphIndex = glyphIndexes.at(i);
+        QCOMPARE(prefetched.alphaMapForGlyph(glyphIndex, antialiasingType),
+                 reference.alphaMapForGlyph(glyphIndex, antialiasingType));
+    }
+
+    QRawFont().prefetchGlyphs(glyphIndexes, antialiasingType);
+}
+
 #endif // QT_NO_RAWFONT
 
 QTEST_MAIN(tst_QRawFont)
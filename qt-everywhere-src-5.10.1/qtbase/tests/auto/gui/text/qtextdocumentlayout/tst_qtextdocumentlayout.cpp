@@ -34,6 +34,7 @@
 #include <qdebug.h>
 #include <qpainter.h>
 #include <qtexttable.h>
+#include <private/qtextdocumentlayout_p.h>
 #ifndef QT_NO_WIDGETS
 #include <qtextedit.h>
 #include <qscrollbar.h>
@@ -58,6 +59,8 @@ private slots:
     void floatingTablePageBreak();
     void imageAtRightAlignedTab();
     void blockVisibility();
+    void incrementalLayout_data();
+    void incrementalLayout();
 
 private:
     QTextDocument *doc;
@@ -344,5 +347,57 @@ void tst_QTextDocumentLayout::blockVisibility()
     QCOMPARE(doc->size(), halfSize);
 }
 
+void tst_QTextDocumentLayout::incrementalLayout_data()
+{
+    QTest::addColumn<bool>("incremental");
+
+    QTest::newRow("incremental") << true;
+    QTest::newRow("synchronous") << false;
+}
+
+void tst_QTextDocumentLayout::incrementalLayout()
+{
+    QFETCH(bool, incremental);
+
+    QStringList lines;
+    for (int i = 0; i < 3000; ++i)
+        lines << QString::fromLatin1("Line %1 of a long log").arg(i);
+    doc->setPlainText(lines.join(QLatin1Char('\n')));
+
+    QTextDocumentLayout *layout = qobject_cast<QTextDocumentLayout *>(doc->documentLayout());
+    QVERIFY(layout);
+    layout->setIncrementalLayoutEnabled(incremental);
+    QCOMPARE(layout->isIncrementalLayoutEnabled(), incremental);
+    const QSizeF oldSize = layout->documentSize();
+    const QPointF oldLastPosition = doc->lastBlock().layout()->position();
+
+    QTextCursor cursor(doc->findBlockByNumber(10));
+    cursor.insertText(QStringLiteral("Inserted line\n"));
+    lines.insert(10, QStringLiteral("Inserted line"));
+    cursor.setPosition(doc->findBlockByNumber(20).position());
+    cursor.insertText(QStringLiteral("Another one\n"));
+    lines.insert(20, QStringLiteral("Another one"));
+
+    QTextDocument reference;
+    reference.setPlainText(lines.join(QLatin1Char('\n')));
+    const QSizeF expectedSize = reference.documentLayout()->documentSize();
+    const QRectF expectedLastRect = reference.documentLayout()->blockBoundingRect(reference.lastBlock());
+    QVERIFY(expectedSize.height() > oldSize.height());
+
+    // the final size is known before the blocks after the edits have been moved
+    QCOMPARE(layout->layoutStatus(), 100);
+    QCOMPARE(layout->dynamicDocumentSize(), expectedSize);
+    if (incremental)
+        QCOMPARE(doc->lastBlock().layout()->position(), oldLastPosition);
+    else
+        QCOMPARE(doc->lastBlock().layout()->position(), expectedLastRect.topLeft());
+
+    QCOMPARE(layout->blockBoundingRect(doc->lastBlock()), expectedLastRect);
+    QCOMPARE(layout->documentSize(), expectedSize);
+    const QTextBlock middle = doc->findBlockByNumber(1500);
+    QCOMPARE(layout->blockBoundingRect(middle),
+             reference.documentLayout()->blockBoundingRect(reference.findBlockByNumber(1500)));
+}
+
 QTEST_MAIN(tst_QTextDocumentLayout)
 #include "tst_qtextdocumentlayout.moc"
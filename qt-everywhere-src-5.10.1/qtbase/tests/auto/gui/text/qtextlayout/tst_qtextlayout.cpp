@@ -137,6 +137,7 @@ private slots:
     void nbspWithFormat();
     void noModificationOfInputString();
     void superscriptCrash_qtbug53911();
+    void shapedRunCache();
 
 private:
     QFont testFont;
@@ -2291,5 +2292,57 @@ void tst_QTextLayout::nbspWithFormat()
     QCOMPARE(layout.lineAt(1).textLength(), s2.length() + 1 + s3.length());
 }
 
+static QList<QGlyphRun> layoutGlyphRuns(const QString &text, const QFont &font, qreal letterSpacing = 0)
+{
+    QFont f = font;
+    if (letterSpacing != 0)
+        f.setLetterSpacing(QFont::AbsoluteSpacing, letterSpacing);
+
+    QTextLayout layout(text, f);
+    layout.beginLayout();
+    while (layout.createLine().isValid())
+        ;
+    layout.endLayout();
+    return layout.glyphRuns();
+}
+
+void tst_QTextLayout::shapedRunCache()
+{
+    const QString text = QStringLiteral("Cached runs are shaped only once");
+
+    QTextEngine::clearShapedRunCache();
+    const QList<QGlyphRun> expected = layoutGlyphRuns(text, testFont);
+    const QTextEngine::ShapedRunCacheStatistics first = QTextEngine::shapedRunCacheStatistics();
+    QCOMPARE(first.hits, quint64(0));
+    QVERIFY(first.misses > 0);
+    QCOMPARE(quint64(first.runs), first.misses);
+    QVERIFY(first.memoryUsage > 0);
+    QVERIFY(first.memoryUsage <= first.maximumMemoryUsage);
+
+    // a new layout of the same text reuses the shaped runs
+    QCOMPARE(layoutGlyphRuns(text, testFont), expected);
+    const QTextEngine::ShapedRunCacheStatistics second = QTextEngine::shapedRunCacheStatistics();
+    QCOMPARE(second.hits, first.misses);
+    QCOMPARE(second.misses, first.misses);
+    QCOMPARE(second.runs, first.runs);
+    QCOMPARE(second.hitRate(), 0.5);
+
+    // letter spacing is applied on top of cached runs
+    const QList<QGlyphRun> spaced = layoutGlyphRuns(text, testFont, 5);
+    QCOMPARE(layoutGlyphRuns(text, testFont, 5), spaced);
+    QVERIFY(spaced != expected);
+
+    QTextEngine::setShapedRunCacheSize(0);
+    QCOMPARE(QTextEngine::shapedRunCacheStatistics().runs, 0);
+    QCOMPARE(layoutGlyphRuns(text, testFont), expected);
+    QCOMPARE(QTextEngine::shapedRunCacheStatistics().runs, 0);
+
+    QTextEngine::setShapedRunCacheSize(first.maximumMemoryUsage);
+    QTextEngine::clearShapedRunCache();
+    const QTextEngine::ShapedRunCacheStatistics cleared = QTextEngine::shapedRunCacheStatistics();
+    QCOMPARE(cleared.runs, 0);
+    QCOMPARE(cleared.hits + cleared.misses, quint64(0));
+}
+
 QTEST_MAIN(tst_QTextLayout)
 #include "tst_qtextlayout.moc"
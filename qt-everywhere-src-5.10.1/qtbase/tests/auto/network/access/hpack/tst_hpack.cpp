@@ -71,6 +71,12 @@ private Q_SLOTS:
     void hpackDecodeResponse_data();
     void hpackDecodeResponse();
 
+    void hpackEncoderTableSizeUpdate();
+    void hpackEncoderNeverIndexed();
+    void hpackEncoderNoIndexingForLargeFields();
+    void hpackEncoderCookieCrumbs();
+    void hpackEncoderHuffmanOnlyIfShorter();
+
     // TODO: more-more-more tests needed!
 
 private:
@@ -847,6 +853,187 @@ void tst_Hpack::hpackDecodeResponse()
     }
 }
 
+void tst_Hpack::hpackEncoderTableSizeUpdate()
+{
+    const HttpHeader header = {{":method", "GET"},
+                               {":scheme", "https"},
+                               {":path", "/"},
+                               {":authority", "www.example.com"},
+                               {"custom-key", "custom-value"}};
+
+    Encoder encoder(4096, false);
+    Decoder decoder(4096);
+
+    std::vector<uchar> buffer1;
+    BitOStream outputStream1(buffer1);
+    QVERIFY(encoder.encodeRequest(outputStream1, header));
+    QCOMPARE(encoder.dynamicTableSize(), quint32(111));
+
+    BitIStream inputStream1(outputStream1.begin(), outputStream1.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream1));
+    QCOMPARE(decoder.dynamicTableSize(), encoder.dynamicTableSize());
+
+    // Our peer disables the table, then allows 2048 bytes: HPACK 4.2 requires
+    // us to signal both sizes.
+    encoder.setMaxDynamicTableSize(0);
+    QCOMPARE(encoder.dynamicTableSize(), quint32(0));
+    encoder.setMaxDynamicTableSize(2048);
+
+    std::vector<uchar> buffer2;
+    BitOStream outputStream2(buffer2);
+    QVERIFY(encoder.encodeRequest(outputStream2, header));
+    QVERIFY(outputStream2.byteLength() > 4);
+    QCOMPARE(outputStream2.begin()[0], uchar(0x20));
+    QCOMPARE(outputStream2.begin()[1], uchar(0x3f));
+    QCOMPARE(outputStream2.begin()[2], uchar(0xe1));
+    QCOMPARE(outputStream2.begin()[3], uchar(0x0f));
+    QCOMPARE(encoder.dynamicTableSize(), quint32(111));
+
+    BitIStream inputStream2(outputStream2.begin(), outputStream2.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream2));
+    QVERIFY(decoder.decodedHeader() == header);
+    QCOMPARE(decoder.dynamicTableSize(), encoder.dynamicTableSize());
+
+    // Our own limit wins over what the peer allows, and with a table of
+    // size 0 nothing gets indexed:
+    encoder.setDynamicTableSizeLimit(0);
+    std::vector<uchar> buffer3;
+    BitOStream outputStream3(buffer3);
+    QVERIFY(encoder.encodeRequest(outputStream3, header));
+    QCOMPARE(outputStream3.begin()[0], uchar(0x20));
+    QCOMPARE(encoder.dynamicTableSize(), quint32(0));
+
+    BitIStream inputStream3(outputStream3.begin(), outputStream3.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream3));
+    QVERIFY(decoder.decodedHeader() == header);
+    QCOMPARE(decoder.dynamicTableSize(), quint32(0));
+
+    // No more updates pending:
+    std::vector<uchar> buffer4;
+    BitOStream outputStream4(buffer4);
+    QVERIFY(encoder.encodeRequest(outputStream4, header));
+    QCOMPARE(outputStream4.begin()[0], uchar(0x82)); // :method GET
+}
+
+void tst_Hpack::hpackEncoderNeverIndexed()
+{
+    const HttpHeader header = {{":method", "GET"},
+                               {":scheme", "https"},
+                               {":path", "/"},
+                               {"authorization", "Basic dXNlcjpwYXNz"},
+                               {"custom-key", "custom-value"}};
+
+    Encoder encoder(4096, true);
+    encoder.setNeverIndexedFields({"authorization"});
+    Decoder decoder(4096);
+
+    for (int i = 0; i < 2; ++i) {
+        std::vector<uchar> buffer;
+        BitOStream outputStream(buffer);
+        QVERIFY(encoder.encodeRequest(outputStream, header));
+        // Only custom-key is in the table:
+        QCOMPARE(encoder.dynamicTableSize(), quint32(54));
+
+        BitIStream inputStream(outputStream.begin(), outputStream.end());
+        QVERIFY(decoder.decodeHeaderFields(inputStream));
+        QVERIFY(decoder.decodedHeader() == header);
+        QCOMPARE(decoder.dynamicTableSize(), quint32(54));
+    }
+}
+
+void tst_Hpack::hpackEncoderNoIndexingForLargeFields()
+{
+    const QByteArray large(1000, 'x');
+    const HttpHeader header = {{":method", "GET"},
+                               {":scheme", "https"},
+                               {":path", "/"},
+                               {"custom-key", large}};
+
+    // 1042 bytes is more than 3/4 of a 1024 table, but fine in a 4096 one.
+    Encoder encoder(1024, false);
+    std::vector<uchar> buffer1;
+    BitOStream outputStream1(buffer1);
+    QVERIFY(encoder.encodeRequest(outputStream1, header));
+    QCOMPARE(encoder.dynamicTableSize(), quint32(0));
+
+    Decoder decoder(1024);
+    BitIStream inputStream(outputStream1.begin(), outputStream1.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream));
+    QVERIFY(decoder.decodedHeader() == header);
+
+    Encoder bigEncoder(4096, false);
+    std::vector<uchar> buffer2;
+    BitOStream outputStream2(buffer2);
+    QVERIFY(bigEncoder.encodeRequest(outputStream2, header));
+    QCOMPARE(bigEncoder.dynamicTableSize(), quint32(1042));
+}
+
+void tst_Hpack::hpackEncoderCookieCrumbs()
+{
+    Encoder encoder(4096, true);
+    Decoder decoder(4096);
+
+    const HttpHeader header1 = {{":method", "GET"},
+                                {":scheme", "https"},
+                                {":path", "/"},
+                                {"cookie", "a=1; b=2;c=3"}};
+    const HttpHeader crumbs1 = {{":method", "GET"},
+                                {":scheme", "https"},
+                                {":path", "/"},
+                                {"cookie", "a=1"},
+                                {"cookie", "b=2"},
+                                {"cookie", "c=3"}};
+
+    std::vector<uchar> buffer1;
+    BitOStream outputStream1(buffer1);
+    QVERIFY(encoder.encodeRequest(outputStream1, header1));
+    BitIStream inputStream1(outputStream1.begin(), outputStream1.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream1));
+    QVERIFY(decoder.decodedHeader() == crumbs1);
+
+    // Only one cookie changed, the other two are found in the table
+    // and encoded as one byte each.
+    const HttpHeader header2 = {{":method", "GET"},
+                                {":scheme", "https"},
+                                {":path", "/"},
+                                {"cookie", "a=1; b=2; c=4"}};
+    std::vector<uchar> buffer2;
+    BitOStream outputStream2(buffer2);
+    QVERIFY(encoder.encodeRequest(outputStream2, header2));
+    QVERIFY(outputStream2.byteLength() < outputStream1.byteLength());
+    BitIStream inputStream2(outputStream2.begin(), outputStream2.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream2));
+    QCOMPARE(decoder.decodedHeader().size(), std::size_t(6));
+    QVERIFY(decoder.decodedHeader()[5] == HeaderField("cookie", "c=4"));
+}
+
+void tst_Hpack::hpackEncoderHuffmanOnlyIfShorter()
+{
+    // '~' and '\\' have codes longer than 8 bits in HPACK's Huffman table:
+    const HttpHeader header = {{":method", "GET"},
+                               {":scheme", "https"},
+                               {":path", "/"},
+                               {"custom-key", "~~~~\\\\~~~~"}};
+
+    Encoder plain(4096, false);
+    std::vector<uchar> buffer1;
+    BitOStream outputStream1(buffer1);
+    QVERIFY(plain.encodeRequest(outputStream1, header));
+
+    Encoder huffman(4096, true);
+    std::vector<uchar> buffer2;
+    BitOStream outputStream2(buffer2);
+    QVERIFY(huffman.encodeRequest(outputStream2, header));
+
+    // Only the name is shorter with Huffman coding:
+    QCOMPARE(outputStream2.byteLength(), outputStream1.byteLength() - 2);
+
+    Decoder decoder(4096);
+    BitIStream inputStream(outputStream2.begin(), outputStream2.end());
+    QVERIFY(decoder.decodeHeaderFields(inputStream));
+    QVERIFY(decoder.decodedHeader() == header);
+}
+
 QTEST_MAIN(tst_Hpack)
 
 #include "tst_hpack.moc"
@@ -575,7 +575,7 @@ void Http2Server::handleIncomingFrame()
         // TODO: this is not tested for now.
         break;
     case FrameType::PING:
-        // TODO: this is not tested for now.
+        handlePING();
         break;
     case FrameType::GOAWAY:
         // TODO: this is not tested for now.
@@ -721,10 +721,22 @@ void Http2Server::handleWINDOW_UPDATE()
         return;
     }
 
-    emit windowUpdate(streamID);
+    emit windowUpdate(streamID, delta);
     sendDATA(streamID, delta);
 }
 
+void Http2Server::handlePING()
+{
+    // We never send PING frames ourselves, so this cannot be an ACK
+    // we are waiting for:
+    if (inboundFrame.flags().testFlag(FrameFlag::ACK))
+        return;
+
+    writer.start(FrameType::PING, FrameFlag::ACK, connectionStreamID);
+    writer.append(inboundFrame.dataBegin(), inboundFrame.dataBegin() + 8);
+    writer.write(*socket);
+}
+
 void Http2Server::sendResponse(quint32 streamID, bool emptyBody)
 {
     Q_ASSERT(activeRequests.find(streamID) != activeRequests.end());
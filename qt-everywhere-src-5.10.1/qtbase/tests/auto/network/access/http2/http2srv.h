@@ -92,6 +92,7 @@ public:
     Q_INVOKABLE void handleSETTINGS();
     Q_INVOKABLE void handleDATA();
     Q_INVOKABLE void handleWINDOW_UPDATE();
+    Q_INVOKABLE void handlePING();
 
     Q_INVOKABLE void sendResponse(quint32 streamID, bool emptyBody);
 
@@ -109,7 +110,7 @@ Q_SIGNALS:
     void decompressionFailed(quint32 streamID);
     void receivedRequest(quint32 streamID);
     void receivedData(quint32 streamID);
-    void windowUpdate(quint32 streamID);
+    void windowUpdate(quint32 streamID, quint32 delta);
 
 private slots:
     void connectionEstablished();
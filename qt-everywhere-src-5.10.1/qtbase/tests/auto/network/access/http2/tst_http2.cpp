@@ -31,9 +31,11 @@
 #include "http2srv.h"
 
 #include <QtNetwork/private/http2protocol_p.h>
+#include <QtNetwork/qhttp2configuration.h>
 #include <QtNetwork/qnetworkaccessmanager.h>
 #include <QtNetwork/qnetworkrequest.h>
 #include <QtNetwork/qnetworkreply.h>
+#include <QtCore/qbuffer.h>
 #include <QtCore/qglobal.h>
 #include <QtCore/qobject.h>
 #include <QtCore/qthread.h>
@@ -71,9 +73,12 @@ private slots:
     void multipleRequests();
     void flowControlClientSide();
     void flowControlServerSide();
+    void flowControlAutoTuning();
     void pushPromise();
     void goaway_data();
     void goaway();
+    void http2EnabledByManager();
+    void downloadSink();
 
 protected slots:
     // Slots to listen to our in-process server:
@@ -86,7 +91,7 @@ protected slots:
     void decompressionFailed(quint32 streamID);
     void receivedRequest(quint32 streamID);
     void receivedData(quint32 streamID);
-    void windowUpdated(quint32 streamID);
+    void windowUpdated(quint32 streamID, quint32 delta);
     void replyFinished();
     void replyFinishedWithError();
 
@@ -116,6 +121,7 @@ private:
     int nSentRequests = 0;
 
     int windowUpdates = 0;
+    quint32 largestWindowUpdate = 0;
     bool prefaceOK = false;
     bool serverGotSettingsACK = false;
 
@@ -317,6 +323,46 @@ void tst_Http2::flowControlServerSide()
     QVERIFY(serverGotSettingsACK);
 }
 
+void tst_Http2::flowControlAutoTuning()
+{
+    // Start with the smallest possible stream window: with auto-tuning
+    // the client must notice it's what limits the response and grow it,
+    // so the server gets more credit than the initial window at once.
+    using namespace Http2;
+
+    clearHTTP2State();
+
+    serverPort = 0;
+    nRequests = 1;
+
+    QHttp2Configuration config;
+    QVERIFY(config.setStreamReceiveWindowSize(Http2::defaultSessionWindowSize));
+    QVERIFY(!config.setSessionReceiveWindowSize(1024));
+    QVERIFY(!config.windowAutoTuningEnabled());
+    config.setWindowAutoTuningEnabled(true);
+    manager.setHttp2Configuration(config);
+    QCOMPARE(manager.http2Configuration(), config);
+
+    ServerPtr srv(newServer(defaultServerSettings, Http2::ProtocolParameters(config)));
+
+    const QByteArray respond(int(Http2::defaultSessionWindowSize * 50), 'x');
+    srv->setResponseBody(respond);
+
+    QMetaObject::invokeMethod(srv.data(), "startServer", Qt::QueuedConnection);
+
+    runEventLoop();
+    QVERIFY(serverPort != 0);
+
+    sendRequest(1);
+
+    runEventLoop(120000);
+
+    QVERIFY(nRequests == 0);
+    QVERIFY(prefaceOK);
+    QVERIFY(serverGotSettingsACK);
+    QVERIFY(largestWindowUpdate > quint32(Http2::defaultSessionWindowSize));
+}
+
 void tst_Http2::pushPromise()
 {
     // We will first send some request, the server should reply and also emulate
@@ -439,6 +485,89 @@ void tst_Http2::goaway()
     QVERIFY(!serverGotSettingsACK);
 }
 
+void tst_Http2::http2EnabledByManager()
+{
+    // Requests without HTTP2AllowedAttribute use HTTP/2 once it's
+    // enabled on the manager; this needs ALPN to negotiate the protocol.
+    if (clearTextHTTP2)
+        QSKIP("This test requires ALPN support");
+
+    clearHTTP2State();
+
+    QVERIFY(!manager.isHttp2Enabled());
+    manager.setHttp2Enabled(true);
+    QVERIFY(manager.isHttp2Enabled());
+
+    serverPort = 0;
+    nRequests = 1;
+
+    ServerPtr srv(newServer(defaultServerSettings));
+
+    QMetaObject::invokeMethod(srv.data(), "startServer", Qt::QueuedConnection);
+    runEventLoop();
+
+    QVERIFY(serverPort != 0);
+
+    auto url = requestUrl();
+    url.setPath("/index.html");
+
+    auto reply = manager.get(QNetworkRequest(url));
+    connect(reply, &QNetworkReply::finished, this, &tst_Http2::replyFinished);
+    reply->ignoreSslErrors();
+
+    runEventLoop();
+
+    QVERIFY(nRequests == 0);
+    QVERIFY(prefaceOK);
+    QVERIFY(serverGotSettingsACK);
+
+    QCOMPARE(reply->error(), QNetworkReply::NoError);
+    QVERIFY(reply->isFinished());
+}
+
+void tst_Http2::downloadSink()
+{
+    clearHTTP2State();
+
+    serverPort = 0;
+    nRequests = 1;
+
+    ServerPtr srv(newServer(defaultServerSettings));
+
+    const QByteArray respond(int(Http2::defaultSessionWindowSize * 4), 'x');
+    srv->setResponseBody(respond);
+
+    QMetaObject::invokeMethod(srv.data(), "startServer", Qt::QueuedConnection);
+    runEventLoop();
+
+    QVERIFY(serverPort != 0);
+
+    auto url = requestUrl();
+    url.setPath("/index.html");
+
+    QBuffer sink;
+    QVERIFY(sink.open(QIODevice::WriteOnly));
+
+    QNetworkRequest request(url);
+    request.setAttribute(QNetworkRequest::HTTP2AllowedAttribute, QVariant(true));
+    request.setAttribute(QNetworkRequest::DownloadSinkAttribute,
+                         QVariant::fromValue<QIODevice *>(&sink));
+
+    auto reply = manager.get(request);
+    connect(reply, &QNetworkReply::finished, this, &tst_Http2::replyFinished);
+    QSignalSpy readyReadSpy(reply, &QNetworkReply::readyRead);
+    reply->ignoreSslErrors();
+
+    runEventLoop();
+
+    QVERIFY(nRequests == 0);
+    QCOMPARE(reply->error(), QNetworkReply::NoError);
+    QVERIFY(reply->isFinished());
+    QCOMPARE(readyReadSpy.count(), 0);
+    QCOMPARE(reply->bytesAvailable(), qint64(0));
+    QCOMPARE(sink.data(), respond);
+}
+
 void tst_Http2::serverStarted(quint16 port)
 {
     serverPort = port;
@@ -448,9 +577,12 @@ void tst_Http2::serverStarted(quint16 port)
 void tst_Http2::clearHTTP2State()
 {
     windowUpdates = 0;
+    largestWindowUpdate = 0;
     prefaceOK = false;
     serverGotSettingsACK = false;
     manager.setProperty(Http2::http2ParametersPropertyName, QVariant());
+    manager.setHttp2Configuration(QHttp2Configuration());
+    manager.setHttp2Enabled(false);
 }
 
 void tst_Http2::runEventLoop(int ms)
@@ -573,11 +705,12 @@ void tst_Http2::receivedData(quint32 streamID)
                               Q_ARG(bool, true /*HEADERS only*/));
 }
 
-void tst_Http2::windowUpdated(quint32 streamID)
+void tst_Http2::windowUpdated(quint32 streamID, quint32 delta)
 {
     Q_UNUSED(streamID)
 
     ++windowUpdates;
+    largestWindowUpdate = qMax(largestWindowUpdate, delta);
 }
 
 void tst_Http2::replyFinished()
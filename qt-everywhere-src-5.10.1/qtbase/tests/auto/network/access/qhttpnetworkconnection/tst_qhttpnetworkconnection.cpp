@@ -32,6 +32,7 @@
 #include "private/qnoncontiguousbytedevice_p.h"
 #include <QAuthenticator>
 #include <QTcpServer>
+#include <QHttpConnectionPoolConfiguration>
 
 #include "../../../network-settings.h"
 
@@ -89,6 +90,9 @@ private Q_SLOTS:
     void getMultipleWithPipeliningAndMultiplePriorities();
     void getMultipleWithPriorities();
 
+    void connectionPoolConfiguration();
+    void connectionPoolLimit();
+
     void getEmptyWithPipelining();
 
     void getAndEverythingShouldBePipelined();
@@ -850,6 +854,69 @@ public Q_SLOTS:
     }
 };
 
+void tst_QHttpNetworkConnection::connectionPoolConfiguration()
+{
+    QHttpConnectionPoolConfiguration configuration;
+    QCOMPARE(configuration.maximumConnectionsPerHost(), 6);
+    QCOMPARE(configuration.maximumConnections(), 0);
+    QCOMPARE(configuration.idleTimeout(), 120000);
+    QCOMPARE(configuration.maximumPipelinedRequests(), 3);
+
+    QVERIFY(!configuration.setMaximumConnectionsPerHost(0));
+    QVERIFY(!configuration.setMaximumConnectionsPerHost(65));
+    QVERIFY(!configuration.setMaximumConnections(-1));
+    QVERIFY(!configuration.setIdleTimeout(0));
+    QVERIFY(!configuration.setMaximumPipelinedRequests(-1));
+    QCOMPARE(configuration, QHttpConnectionPoolConfiguration());
+
+    QVERIFY(configuration.setMaximumConnectionsPerHost(2));
+    QVERIFY(configuration.setMaximumConnections(4));
+    QVERIFY(configuration.setIdleTimeout(5000));
+    QVERIFY(configuration.setMaximumPipelinedRequests(0));
+    QCOMPARE(configuration.maximumConnectionsPerHost(), 2);
+    QCOMPARE(configuration.maximumConnections(), 4);
+    QCOMPARE(configuration.idleTimeout(), 5000);
+    QCOMPARE(configuration.maximumPipelinedRequests(), 0);
+    QVERIFY(configuration != QHttpConnectionPoolConfiguration());
+}
+
+void tst_QHttpNetworkConnection::connectionPoolLimit()
+{
+    // With a limit of one connection, both connections still get one
+    // channel each, but never more than that.
+    QSharedPointer<QHttpNetworkConnectionPool> pool(new QHttpNetworkConnectionPool);
+    pool->setMaximumConnections(1);
+
+    QHttpNetworkConnection connection1(3, QtNetworkSettings::serverName());
+    QHttpNetworkConnection connection2(3, QtNetworkSettings::serverName());
+    connection1.setConnectionPool(pool);
+    connection2.setConnectionPool(pool);
+
+    QList<QHttpNetworkRequest*> requests;
+    QList<QHttpNetworkReply*> replies;
+    for (int i = 0; i < 6; i++) {
+        QHttpNetworkRequest *request = new QHttpNetworkRequest("http://" + QtNetworkSettings::serverName() + "/qtest/rfc3252.txt");
+        requests.append(request);
+        replies.append((i % 2 ? connection1 : connection2).sendRequest(*request));
+    }
+
+    QTRY_VERIFY_WITH_TIMEOUT(allRepliesFinished(&replies), 60000);
+    for (QHttpNetworkReply *reply : qAsConst(replies))
+        QCOMPARE(reply->statusCode(), 200);
+
+    const auto statistics = pool->statistics();
+    QCOMPARE(statistics.size(), 1);
+    QCOMPARE(statistics.first().hostName, QtNetworkSettings::serverName());
+    QCOMPARE(statistics.first().port, quint16(80));
+    QVERIFY(!statistics.first().encrypted);
+    QVERIFY(statistics.first().connectionsOpened >= 2);
+    QVERIFY(statistics.first().activeConnections + statistics.first().idleConnections <= 2);
+    QCOMPARE(statistics.first().queuedRequests, 0);
+
+    qDeleteAll(requests);
+    qDeleteAll(replies);
+}
+
 void tst_QHttpNetworkConnection::getEmptyWithPipelining()
 {
     quint16 requestCount = 50;
@@ -69,6 +69,8 @@ private slots:
     void updateMetaData();
     void fileMetaData();
     void expire();
+    void expireLeastRecentlyUsed();
+    void persistentIndex();
 
     void oldCacheVersionFile_data();
     void oldCacheVersionFile();
@@ -529,6 +531,71 @@ void tst_QNetworkDiskCache::expire()
     }
 }
 
+static void insertItem(QNetworkDiskCache *cache, const QUrl &url, int size)
+{
+    QNetworkCacheMetaData m;
+    m.setUrl(url);
+    QIODevice *d = cache->prepare(m);
+    QVERIFY(d);
+    d->write(QByteArray(size, 'Z'));
+    cache->insert(d);
+}
+
+void tst_QNetworkDiskCache::expireLeastRecentlyUsed()
+{
+    SubQNetworkDiskCache cache;
+    cache.setCacheDirectory(tempDir.path());
+    cache.clear();
+    const int itemSize = 1024 * 100;
+    cache.setMaximumCacheSize(itemSize * 10);
+
+    for (int i = 0; i < 5; ++i)
+        insertItem(&cache, QUrl("http://localhost:4/" + QString::number(i)), itemSize);
+    // use the oldest items, which should then be kept
+    QVERIFY(cache.metaData(QUrl("http://localhost:4/0")).isValid());
+    QScopedPointer<QIODevice> device(cache.data(QUrl("http://localhost:4/1")));
+    QVERIFY(device);
+    device.reset();
+
+    for (int i = 5; i < 12; ++i)
+        insertItem(&cache, QUrl("http://localhost:4/" + QString::number(i)), itemSize);
+
+    QVERIFY(cache.cacheSize() < cache.maximumCacheSize());
+    QVERIFY(cache.metaData(QUrl("http://localhost:4/0")).isValid());
+    QVERIFY(cache.metaData(QUrl("http://localhost:4/1")).isValid());
+    QVERIFY(!cache.metaData(QUrl("http://localhost:4/2")).isValid());
+    QVERIFY(cache.metaData(QUrl("http://localhost:4/11")).isValid());
+}
+
+void tst_QNetworkDiskCache::persistentIndex()
+{
+    const QUrl url("http://localhost:4/persistent");
+    qint64 size;
+    {
+        QNetworkDiskCache cache;
+        cache.setCacheDirectory(tempDir.path());
+        cache.clear();
+        insertItem(&cache, url, 1024);
+        size = cache.cacheSize();
+        QVERIFY(size > 0);
+    }
+
+    SubQNetworkDiskCache cache;
+    cache.setCacheDirectory(tempDir.path());
+    QCOMPARE(cache.cacheSize(), size);
+    QVERIFY(cache.metaData(url).isValid());
+    QVERIFY(!cache.metaData(QUrl("http://localhost:4/missing")).isValid());
+
+    // a cache file removed behind the cache's back is dropped from the index
+    const QStringList files = countFiles(cache.cacheDirectory());
+    for (const QString &fileName : files) {
+        if (fileName.endsWith(".d"))
+            QVERIFY(QFile::remove(fileName));
+    }
+    QVERIFY(!cache.data(url));
+    QCOMPARE(cache.cacheSize(), qint64(0));
+}
+
 void tst_QNetworkDiskCache::oldCacheVersionFile_data()
 {
     QTest::addColumn<int>("pass");
@@ -109,6 +109,7 @@ private slots:
     void multipleDifferentLookups();
 
     void cache();
+    void cacheNegativeResult();
 
     void abortHostLookup();
 protected slots:
@@ -642,6 +643,27 @@ void tst_QHostInfo::cache()
     QCOMPARE(lookupsDoneCounter, 2);
 }
 
+void tst_QHostInfo::cacheNegativeResult()
+{
+    QFETCH_GLOBAL(bool, cache);
+    if (!cache)
+        return; // test makes only sense when cache enabled
+
+    QHostInfo notFound;
+    notFound.setHostName("no-such-host" TEST_DOMAIN);
+    notFound.setError(QHostInfo::HostNotFound);
+    notFound.setErrorString("Host not found");
+    qt_qhostinfo_cache_inject("no-such-host" TEST_DOMAIN, notFound);
+
+    // the failure should be remembered and come directly
+    bool valid = false;
+    int id = -1;
+    QHostInfo result = qt_qhostinfo_lookup("no-such-host" TEST_DOMAIN, this, SLOT(resultsReady(QHostInfo)), &valid, &id);
+    QVERIFY(valid);
+    QCOMPARE(result.error(), QHostInfo::HostNotFound);
+    QVERIFY(result.addresses().isEmpty());
+}
+
 void tst_QHostInfo::resultsReady(const QHostInfo &hi)
 {
     lookupDone = true;
@@ -116,6 +116,10 @@ private slots:
     void verifyListenWithDescriptor();
     void verifyListenWithDescriptor_data();
 
+    void seqPacketMessageBoundaries();
+    void passFileDescriptors();
+    void writeSharedMemory();
+
 };
 
 tst_QLocalSocket::tst_QLocalSocket()
@@ -1405,6 +1409,111 @@ void tst_QLocalSocket::verifyListenWithDescriptor_data()
 
 }
 
+void tst_QLocalSocket::seqPacketMessageBoundaries()
+{
+#ifdef Q_OS_UNIX
+    LocalServer server;
+    server.setSocketType(QLocalSocket::SeqPacketSocket);
+    QCOMPARE(server.socketType(), QLocalSocket::SeqPacketSocket);
+    QVERIFY2(server.listen("tst_seqpacket"), qPrintable(server.errorString()));
+
+    QLocalSocket client;
+    client.setSocketType(QLocalSocket::SeqPacketSocket);
+    client.connectToServer(server.serverName());
+    QVERIFY(client.waitForConnected(1000));
+    QVERIFY(server.waitForNewConnection(1000));
+    QLocalSocket *serverSocket = server.nextPendingConnection();
+    QVERIFY(serverSocket);
+    QCOMPARE(serverSocket->socketType(), QLocalSocket::SeqPacketSocket);
+
+    const QByteArrayList messages = { QByteArray("first"), QByteArray(1000, 'x'),
+                                      QByteArray("third") };
+    for (const QByteArray &message : messages)
+        QCOMPARE(client.write(message), qint64(message.size()));
+    QVERIFY(client.waitForBytesWritten(1000) || client.bytesToWrite() == 0);
+
+    for (const QByteArray &message : messages) {
+        if (!serverSocket->bytesAvailable())
+            QVERIFY(serverSocket->waitForReadyRead(1000));
+        QCOMPARE(serverSocket->readMessage(), message);
+    }
+#else
+    QSKIP("SOCK_SEQPACKET is only supported on Unix");
+#endif
+}
+
+void tst_QLocalSocket::passFileDescriptors()
+{
+#ifdef Q_OS_UNIX
+    LocalServer server;
+    QVERIFY2(server.listen("tst_passfds"), qPrintable(server.errorString()));
+
+    QLocalSocket client;
+    client.connectToServer(server.serverName());
+    QVERIFY(client.waitForConnected(1000));
+    QVERIFY(server.waitForNewConnection(1000));
+    QLocalSocket *serverSocket = server.nextPendingConnection();
+    QVERIFY(serverSocket);
+
+    int pipeFds[2];
+    QVERIFY(::pipe(pipeFds) == 0);
+    QVERIFY(client.writeFileDescriptors(QVector<int>() << pipeFds[1], "fd"));
+    ::close(pipeFds[1]);
+
+    while (serverSocket->bytesAvailable() < 2)
+        QVERIFY(serverSocket->waitForReadyRead(1000));
+    QCOMPARE(serverSocket->readAll(), QByteArray("fd"));
+    const QVector<int> received = serverSocket->takeFileDescriptors();
+    QCOMPARE(received.size(), 1);
+    QVERIFY(serverSocket->takeFileDescriptors().isEmpty());
+
+    // the received descriptor refers to the same pipe
+    QCOMPARE(::write(received.first(), "ok", 2), ssize_t(2));
+    ::close(received.first());
+    char buffer[2];
+    QCOMPARE(::read(pipeFds[0], buffer, sizeof(buffer)), ssize_t(2));
+    QCOMPARE(QByteArray(buffer, 2), QByteArray("ok"));
+    ::close(pipeFds[0]);
+#else
+    QSKIP("Passing file descriptors is only supported on Unix");
+#endif
+}
+
+void tst_QLocalSocket::writeSharedMemory()
+{
+#ifdef Q_OS_UNIX
+    LocalServer server;
+    QVERIFY2(server.listen("tst_sharedmemory"), qPrintable(server.errorString()));
+
+    QLocalSocket client;
+    client.connectToServer(server.serverName());
+    QVERIFY(client.waitForConnected(1000));
+    QVERIFY(server.waitForNewConnection(1000));
+    QLocalSocket *serverSocket = server.nextPendingConnection();
+    QVERIFY(serverSocket);
+
+    const QByteArray data(100000, 'q');
+    QVERIFY(client.writeSharedMemory(data));
+
+    while (serverSocket->bytesAvailable() < qint64(sizeof(quint64)))
+        QVERIFY(serverSocket->waitForReadyRead(1000));
+    quint64 size = 0;
+    QCOMPARE(serverSocket->read(reinterpret_cast<char *>(&size), sizeof(size)),
+             qint64(sizeof(size)));
+    QCOMPARE(size, quint64(data.size()));
+    const QVector<int> received = serverSocket->takeFileDescriptors();
+    QCOMPARE(received.size(), 1);
+
+    QFile file;
+    QVERIFY(file.open(received.first(), QIODevice::ReadOnly, QFileDevice::AutoCloseHandle));
+    uchar *memory = file.map(0, size);
+    QVERIFY(memory);
+    QCOMPARE(QByteArray(reinterpret_cast<const char *>(memory), int(size)), data);
+#else
+    QSKIP("Passing file descriptors is only supported on Unix");
+#endif
+}
+
 QTEST_MAIN(tst_QLocalSocket)
 #include "tst_qlocalsocket.moc"
 
@@ -117,6 +117,8 @@ private slots:
 
     void canAccessPendingConnectionsWhileNotListening();
 
+    void acceptThreads();
+
 private:
     bool shouldSkipIpv6TestsForBrokenGetsockopt();
 #ifdef SHOULD_CHECK_SYSCALL_SUPPORT
@@ -1052,5 +1054,50 @@ void tst_QTcpServer::canAccessPendingConnectionsWhileNotListening()
     QCOMPARE(&socket, server.nextPendingConnection());
 }
 
+void tst_QTcpServer::acceptThreads()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QTcpServer server;
+    server.setAcceptThreadCount(2);
+    QCOMPARE(server.acceptThreadCount(), 2);
+    QVERIFY(server.listen(QHostAddress::LocalHost));
+    QCOMPARE(server.acceptedConnectionCount(), quint64(0));
+
+    int newConnections = 0;
+    connect(&server, &QTcpServer::newConnection, [&newConnections]() { ++newConnections; });
+
+    const int clientCount = 20;
+    QVector<QTcpSocket *> clients;
+    for (int i = 0; i < clientCount; ++i) {
+        QTcpSocket *client = new QTcpSocket(&server);
+        client->connectToHost(QHostAddress::LocalHost, server.serverPort());
+        clients.append(client);
+    }
+    for (QTcpSocket *client : qAsConst(clients))
+        QVERIFY(client->waitForConnected(5000));
+
+    QTRY_COMPARE(server.acceptedConnectionCount(), quint64(clientCount));
+    QTRY_COMPARE(newConnections, clientCount);
+
+    int pending = 0;
+    while (QTcpSocket *socket = server.nextPendingConnection()) {
+        QCOMPARE(socket->state(), QAbstractSocket::ConnectedState);
+        QCOMPARE(socket->thread(), server.thread());
+        ++pending;
+    }
+    QCOMPARE(pending, clientCount);
+
+    // the count cannot change while listening
+    QTest::ignoreMessage(QtWarningMsg, "QTcpServer::setAcceptThreadCount() called when already listening");
+    server.setAcceptThreadCount(0);
+    QCOMPARE(server.acceptThreadCount(), 2);
+
+    server.close();
+    QCOMPARE(server.acceptThreadCount(), 2);
+}
+
 QTEST_MAIN(tst_QTcpServer)
 #include "tst_qtcpserver.moc"
@@ -202,6 +202,7 @@ private slots:
     void socketDiscardDataInWriteMode();
     void writeOnReadBufferOverflow();
     void readNotificationsAfterBind();
+    void sendFile();
 
 protected slots:
     void nonBlockingIMAP_hostFound();
@@ -3145,4 +3146,67 @@ void tst_QTcpSocket::readNotificationsAfterBind()
 }
 
 QTEST_MAIN(tst_QTcpSocket)
+// Test that file contents queued with sendFile() are sent in order with the
+// data written before and after it
+void tst_QTcpSocket::sendFile()
+{
+    QFETCH_GLOBAL(bool, setProxy);
+    if (setProxy)
+        return;
+
+    QTemporaryFile file;
+    QVERIFY(file.open());
+    QByteArray contents;
+    for (int i = 0; i < 256 * 1024; ++i)
+        contents += char(i % 251);
+    QCOMPARE(file.write(contents), qint64(contents.size()));
+    QVERIFY(file.flush());
+
+    QTcpServer tcpServer;
+    QTcpSocket *socket = newSocket();
+
+    QVERIFY(tcpServer.listen(QHostAddress::LocalHost));
+    socket->connectToHost(tcpServer.serverAddress(), tcpServer.serverPort());
+    QVERIFY(socket->waitForConnected(5000));
+    QVERIFY2(tcpServer.waitForNewConnection(5000), "Network timeout");
+    QTcpSocket *newConnection = tcpServer.nextPendingConnection();
+    QVERIFY(newConnection != nullptr);
+
+    // many small writes, which are flushed together
+    QByteArray expected;
+    for (int i = 0; i < 100; ++i) {
+        const QByteArray chunk = QByteArray::number(i) + ' ';
+        QCOMPARE(socket->write(chunk), qint64(chunk.size()));
+        expected += chunk;
+    }
+
+    const qint64 offset = 1000;
+    const qint64 length = contents.size() - 2 * offset;
+    QVERIFY(!socket->sendFile(&file, contents.size() + 1));
+    QVERIFY(socket->sendFile(&file, offset, length));
+    expected += contents.mid(offset, length);
+    QCOMPARE(socket->bytesToWrite(), qint64(expected.size()));
+
+    QVERIFY(socket->sendFile(&file, contents.size() - 10));
+    expected += contents.right(10);
+    QCOMPARE(socket->write("end"), qint64(3));
+    expected += "end";
+
+    QByteArray received;
+    QElapsedTimer timer;
+    timer.start();
+    while (received.size() < expected.size() && timer.elapsed() < 10000) {
+        if (socket->bytesToWrite())
+            socket->waitForBytesWritten(100);
+        if (newConnection->waitForReadyRead(100) || newConnection->bytesAvailable())
+            received += newConnection->readAll();
+    }
+    QCOMPARE(socket->bytesToWrite(), qint64(0));
+    QCOMPARE(received.size(), expected.size());
+    QVERIFY(received == expected);
+
+    delete newConnection;
+    delete socket;
+}
+
 #include "tst_qtcpsocket.moc"
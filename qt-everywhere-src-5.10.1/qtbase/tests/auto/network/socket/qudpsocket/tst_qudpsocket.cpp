@@ -89,6 +89,7 @@ private slots:
     void bindAndConnectToHost();
     void pendingDatagramSize();
     void writeDatagram();
+    void batchedDatagrams();
     void performance();
     void bindMode();
     void writeDatagramToNonExistingPeer_data();
@@ -903,6 +904,62 @@ void tst_QUdpSocket::writeDatagram()
     }
 }
 
+void tst_QUdpSocket::batchedDatagrams()
+{
+    QUdpSocket server;
+    QVERIFY2(server.bind(QHostAddress::LocalHost), server.errorString().toLatin1().constData());
+    QUdpSocket client;
+    QVERIFY2(client.bind(QHostAddress::LocalHost), client.errorString().toLatin1().constData());
+
+    QHostAddress serverAddress = makeNonAny(server.localAddress());
+
+    // more than one batch, with different sizes including an empty datagram
+    const int count = 100;
+    QVector<QNetworkDatagram> datagrams;
+    qint64 totalSize = 0;
+    for (int i = 0; i < count; ++i) {
+        datagrams << QNetworkDatagram(QByteArray(i * 7, char('a' + i % 26)), serverAddress,
+                                      server.localPort());
+        totalSize += i * 7;
+    }
+
+    QSignalSpy bytesspy(&client, SIGNAL(bytesWritten(qint64)));
+    QCOMPARE(client.writeDatagrams(datagrams), count);
+    QCOMPARE(bytesspy.count(), 1);
+    QCOMPARE(bytesspy.at(0).at(0).toLongLong(), totalSize);
+
+    QVector<QNetworkDatagram> received;
+    QElapsedTimer timer;
+    timer.start();
+    while (received.size() < count && timer.elapsed() < 5000) {
+        if (!server.hasPendingDatagrams() && !server.waitForReadyRead(1000))
+            continue;
+        received += server.receiveDatagrams(count - received.size());
+    }
+    if (received.size() != count)
+        QSKIP("UDP packets lost, unable to complete the test.");
+
+    for (int i = 0; i < count; ++i) {
+        QCOMPARE(received.at(i).data(), datagrams.at(i).data());
+        QCOMPARE(received.at(i).senderAddress(), makeNonAny(client.localAddress()));
+        QCOMPARE(received.at(i).senderPort(), int(client.localPort()));
+    }
+
+    // truncation applies to each datagram of the batch
+    QCOMPARE(client.writeDatagrams(datagrams.mid(50, 2)), 2);
+    received.clear();
+    timer.start();
+    while (received.size() < 2 && timer.elapsed() < 5000) {
+        if (!server.hasPendingDatagrams() && !server.waitForReadyRead(1000))
+            continue;
+        received += server.receiveDatagrams(2 - received.size(), 10);
+    }
+    if (received.size() != 2)
+        QSKIP("UDP packets lost, unable to complete the test.");
+    QCOMPARE(received.at(0).data(), datagrams.at(50).data().left(10));
+    QCOMPARE(received.at(1).data(), datagrams.at(51).data().left(10));
+}
+
 void tst_QUdpSocket::performance()
 {
     QByteArray arr(8192, '@');
@@ -0,0 +1,5 @@
+CONFIG += testcase
+TARGET = tst_qsqlasyncquery
+SOURCES  += tst_qsqlasyncquery.cpp
+
+QT = core sql testlib
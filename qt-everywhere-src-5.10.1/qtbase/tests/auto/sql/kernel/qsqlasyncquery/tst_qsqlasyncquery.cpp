@@ -0,0 +1,151 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtSql/QtSql>
+
+class tst_QSqlAsyncQuery : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void select();
+    void error();
+    void alreadyRunning();
+    void destroyWhileRunning();
+    void invalidDatabase();
+
+private:
+    QTemporaryDir dir;
+};
+
+static const char connectionName[] = "tst_qsqlasyncquery";
+
+void tst_QSqlAsyncQuery::initTestCase()
+{
+    if (!QSqlDatabase::isDriverAvailable("QSQLITE"))
+        QSKIP("This test requires the SQLite driver");
+    QVERIFY(dir.isValid());
+
+    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", connectionName);
+    db.setDatabaseName(dir.filePath("async.db"));
+    QVERIFY(db.open());
+    QSqlQuery q(db);
+    QVERIFY(q.exec("CREATE TABLE numbers (id INTEGER)"));
+    for (int i = 0; i < 10; ++i)
+        QVERIFY(q.exec(QString("INSERT INTO numbers VALUES (%1)").arg(i)));
+}
+
+void tst_QSqlAsyncQuery::cleanupTestCase()
+{
+    QSqlDatabase::removeDatabase(connectionName);
+}
+
+void tst_QSqlAsyncQuery::select()
+{
+    QSqlDatabase db = QSqlDatabase::database(connectionName);
+    QSqlAsyncQuery asyncQuery(db);
+    QSignalSpy spy(&asyncQuery, &QSqlAsyncQuery::finished);
+    QVERIFY(!asyncQuery.isRunning());
+
+    QVERIFY(asyncQuery.exec("SELECT id FROM numbers ORDER BY id"));
+    QVERIFY(asyncQuery.isRunning());
+    QVERIFY(spy.wait());
+    QCOMPARE(spy.count(), 1);
+    QVERIFY(!asyncQuery.isRunning());
+    QCOMPARE(db.driver()->thread(), QThread::currentThread());
+
+    QSqlQuery &query = asyncQuery.query();
+    QVERIFY(query.isActive());
+    QVERIFY(query.isSelect());
+    QCOMPARE(query.lastQuery(), QString("SELECT id FROM numbers ORDER BY id"));
+    int i = 0;
+    while (query.next())
+        QCOMPARE(query.value(0).toInt(), i++);
+    QCOMPARE(i, 10);
+
+    // the connection can be used synchronously again
+    QSqlQuery q(db);
+    QVERIFY(q.exec("SELECT COUNT(*) FROM numbers"));
+    QVERIFY(q.next());
+    QCOMPARE(q.value(0).toInt(), 10);
+
+    // and the asynchronous query can be reused
+    QVERIFY(asyncQuery.exec("SELECT COUNT(*) FROM numbers"));
+    QVERIFY(spy.wait());
+    QVERIFY(asyncQuery.query().next());
+    QCOMPARE(asyncQuery.query().value(0).toInt(), 10);
+}
+
+void tst_QSqlAsyncQuery::error()
+{
+    QSqlAsyncQuery asyncQuery(QSqlDatabase::database(connectionName));
+    QSignalSpy spy(&asyncQuery, &QSqlAsyncQuery::finished);
+    QVERIFY(asyncQuery.exec("SELECT * FROM nonexisting_table"));
+    QVERIFY(spy.wait());
+    QVERIFY(!asyncQuery.query().isActive());
+    QVERIFY(asyncQuery.query().lastError().isValid());
+}
+
+void tst_QSqlAsyncQuery::alreadyRunning()
+{
+    QSqlAsyncQuery asyncQuery(QSqlDatabase::database(connectionName));
+    QSignalSpy spy(&asyncQuery, &QSqlAsyncQuery::finished);
+    QVERIFY(asyncQuery.exec("SELECT id FROM numbers"));
+    QTest::ignoreMessage(QtWarningMsg, "QSqlAsyncQuery::exec: a query is already running");
+    QVERIFY(!asyncQuery.exec("SELECT id FROM numbers"));
+    QVERIFY(spy.wait());
+    QTest::qWait(10);
+    QCOMPARE(spy.count(), 1);
+}
+
+void tst_QSqlAsyncQuery::destroyWhileRunning()
+{
+    QSqlDatabase db = QSqlDatabase::database(connectionName);
+    {
+        QSqlAsyncQuery asyncQuery(db);
+        QVERIFY(asyncQuery.exec("SELECT id FROM numbers"));
+    }
+    QCOMPARE(db.driver()->thread(), QThread::currentThread());
+    QSqlQuery q(db);
+    QVERIFY(q.exec("SELECT COUNT(*) FROM numbers"));
+}
+
+void tst_QSqlAsyncQuery::invalidDatabase()
+{
+    QSqlAsyncQuery asyncQuery(QSqlDatabase::database("nonexisting_connection", false));
+    QSignalSpy spy(&asyncQuery, &QSqlAsyncQuery::finished);
+    QVERIFY(asyncQuery.exec("SELECT 1"));
+    QVERIFY(spy.wait());
+    QVERIFY(!asyncQuery.query().isActive());
+}
+
+QTEST_MAIN(tst_QSqlAsyncQuery)
+#include "tst_qsqlasyncquery.moc"
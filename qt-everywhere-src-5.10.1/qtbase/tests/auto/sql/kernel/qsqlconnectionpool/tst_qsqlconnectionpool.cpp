@@ -0,0 +1,237 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtSql/QtSql>
+
+class tst_QSqlConnectionPool : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void reuse();
+    void maxConnections();
+    void maxIdleTime();
+    void validation();
+    void invalidRelease();
+    void threads();
+
+private:
+    QTemporaryDir dir;
+};
+
+static const char templateName[] = "tst_qsqlconnectionpool";
+
+void tst_QSqlConnectionPool::initTestCase()
+{
+    if (!QSqlDatabase::isDriverAvailable("QSQLITE"))
+        QSKIP("This test requires the SQLite driver");
+    QVERIFY(dir.isValid());
+
+    QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", templateName);
+    db.setDatabaseName(dir.filePath("pool.db"));
+    QVERIFY(db.open());
+    QSqlQuery q(db);
+    QVERIFY(q.exec("CREATE TABLE counter (id INTEGER)"));
+    db.close();
+}
+
+void tst_QSqlConnectionPool::cleanupTestCase()
+{
+    QSqlDatabase::removeDatabase(templateName);
+}
+
+void tst_QSqlConnectionPool::reuse()
+{
+    QSqlConnectionPool pool(QSqlDatabase::database(templateName, false));
+    QCOMPARE(pool.connectionCount(), 0);
+
+    QSqlDatabase db = pool.acquire();
+    QVERIFY(db.isValid());
+    QVERIFY(db.isOpen());
+    QVERIFY(db.connectionName() != QLatin1String(templateName));
+    QCOMPARE(db.databaseName(), dir.filePath("pool.db"));
+    QCOMPARE(pool.activeConnectionCount(), 1);
+    QCOMPARE(pool.idleConnectionCount(), 0);
+    const QString name = db.connectionName();
+    pool.release(db);
+    QCOMPARE(pool.activeConnectionCount(), 0);
+    QCOMPARE(pool.idleConnectionCount(), 1);
+
+    db = pool.acquire();
+    QCOMPARE(db.connectionName(), name);
+    QVERIFY(db.isOpen());
+    QCOMPARE(pool.openedConnectionCount(), 1);
+    pool.release(db);
+}
+
+void tst_QSqlConnectionPool::maxConnections()
+{
+    QSqlConnectionPool pool(QSqlDatabase::database(templateName, false));
+    pool.setMaxConnections(2);
+    QCOMPARE(pool.maxConnections(), 2);
+
+    QSqlDatabase db1 = pool.acquire();
+    QSqlDatabase db2 = pool.acquire();
+    QVERIFY(db1.isOpen());
+    QVERIFY(db2.isOpen());
+    QVERIFY(db1.connectionName() != db2.connectionName());
+    QCOMPARE(pool.connectionCount(), 2);
+
+    QVERIFY(!pool.acquire(0).isValid());
+    QVERIFY(!pool.acquire(10).isValid());
+
+    pool.setMaxConnections(3);
+    QSqlDatabase db3 = pool.acquire(0);
+    QVERIFY(db3.isOpen());
+    QCOMPARE(pool.openedConnectionCount(), 3);
+
+    pool.release(db1);
+    pool.release(db2);
+    pool.release(db3);
+    QCOMPARE(pool.idleConnectionCount(), 3);
+}
+
+void tst_QSqlConnectionPool::maxIdleTime()
+{
+    QSqlConnectionPool pool(QSqlDatabase::database(templateName, false));
+    QCOMPARE(pool.maxIdleTime(), -1);
+    pool.setMaxIdleTime(0);
+
+    QSqlDatabase db = pool.acquire();
+    pool.release(db);
+    QTest::qWait(5);
+    db = pool.acquire();
+    QVERIFY(db.isOpen());
+    QCOMPARE(pool.openedConnectionCount(), 2);
+    QCOMPARE(pool.connectionCount(), 1);
+    pool.release(db);
+}
+
+void tst_QSqlConnectionPool::validation()
+{
+    QSqlConnectionPool pool(QSqlDatabase::database(templateName, false));
+    pool.setValidationQuery("SELECT COUNT(*) FROM counter");
+
+    QSqlDatabase db = pool.acquire();
+    pool.release(db);
+    db = pool.acquire();
+    QCOMPARE(pool.openedConnectionCount(), 1);
+    pool.release(db);
+
+    // a failing validation query makes the pool reopen the connection
+    pool.setValidationQuery("SELECT * FROM nonexisting_table");
+    db = pool.acquire();
+    QVERIFY(db.isOpen());
+    QCOMPARE(pool.openedConnectionCount(), 2);
+    pool.release(db);
+
+    // closed connections are not returned to the pool
+    db = pool.acquire();
+    db.close();
+    pool.release(db);
+    QCOMPARE(pool.connectionCount(), 0);
+}
+
+void tst_QSqlConnectionPool::invalidRelease()
+{
+    QSqlConnectionPool pool(QSqlDatabase::database(templateName, false));
+    QTest::ignoreMessage(QtWarningMsg, "QSqlConnectionPool::release: connection 'tst_qsqlconnectionpool' is not leased from this pool");
+    pool.release(QSqlDatabase::database(templateName, false));
+    QCOMPARE(pool.connectionCount(), 0);
+}
+
+class PoolThread : public QThread
+{
+public:
+    PoolThread(QSqlConnectionPool *pool) : pool(pool), failures(0) {}
+
+    void run() override
+    {
+        for (int i = 0; i < 20; ++i) {
+            QSqlDatabase db = pool->acquire();
+            if (!db.isOpen() || db.driver()->thread() != QThread::currentThread()) {
+                ++failures;
+                continue;
+            }
+            {
+                QSqlQuery q(db);
+                if (!q.exec("INSERT INTO counter VALUES (1)"))
+                    ++failures;
+            }
+            pool->release(db);
+        }
+    }
+
+    QSqlConnectionPool *pool;
+    int failures;
+};
+
+void tst_QSqlConnectionPool::threads()
+{
+    {
+        QSqlQuery q(QSqlDatabase::database(templateName));
+        QVERIFY(q.exec("DELETE FROM counter"));
+    }
+    QSqlDatabase::database(templateName, false).close();
+
+    QSqlConnectionPool pool(QSqlDatabase::database(templateName, false));
+    pool.setMaxConnections(2);
+
+    QVector<PoolThread *> threads;
+    for (int i = 0; i < 4; ++i)
+        threads.append(new PoolThread(&pool));
+    for (PoolThread *thread : qAsConst(threads))
+        thread->start();
+    for (PoolThread *thread : qAsConst(threads)) {
+        QVERIFY(thread->wait(60000));
+        QCOMPARE(thread->failures, 0);
+    }
+    qDeleteAll(threads);
+
+    QVERIFY(pool.openedConnectionCount() <= 2);
+    QCOMPARE(pool.activeConnectionCount(), 0);
+    QCOMPARE(pool.waitingThreadCount(), 0);
+
+    // connections released by other threads can be used here
+    QSqlDatabase db = pool.acquire();
+    QVERIFY(db.isOpen());
+    QCOMPARE(db.driver()->thread(), QThread::currentThread());
+    {
+        QSqlQuery q(db);
+        QVERIFY(q.exec("SELECT COUNT(*) FROM counter"));
+        QVERIFY(q.next());
+        QCOMPARE(q.value(0).toInt(), 80);
+    }
+    pool.release(db);
+}
+
+QTEST_MAIN(tst_QSqlConnectionPool)
+#include "tst_qsqlconnectionpool.moc"
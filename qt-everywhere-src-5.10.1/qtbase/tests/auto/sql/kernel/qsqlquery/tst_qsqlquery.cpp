@@ -52,6 +52,8 @@ public slots:
 private slots:
     void value_data() { generic_data(); }
     void value();
+    void typedValue_data() { generic_data(); }
+    void typedValue();
     void isValid_data() { generic_data(); }
     void isValid();
     void isActive_data() { generic_data(); }
@@ -979,6 +981,41 @@ void tst_QSqlQuery::value()
     }
 }
 
+void tst_QSqlQuery::typedValue()
+{
+    QFETCH( QString, dbName );
+    QSqlDatabase db = QSqlDatabase::database( dbName );
+    CHECK_DATABASE( db );
+    const QString qtest_null(qTableName("qtest_null", __FILE__, db));
+
+    for (int forwardOnly = 0; forwardOnly < 2; ++forwardOnly) {
+        QSqlQuery q( db );
+        q.setForwardOnly(forwardOnly);
+        QVERIFY_SQL( q, exec( "select id, t_varchar from " + qtest_null + " order by id" ) );
+
+        bool ok = true;
+        QTest::ignoreMessage(QtWarningMsg, "QSqlQuery::valueInt64: not positioned on a valid record");
+        QCOMPARE( q.valueInt64( 0, &ok ), Q_INT64_C(0) );
+        QVERIFY( !ok );
+
+        int i = 0;
+        while ( q.next() ) {
+            QCOMPARE( q.valueInt64( 0, &ok ), qint64( i ) );
+            QVERIFY( ok );
+            QCOMPARE( q.valueDouble( 0, &ok ), double( i ) );
+            QVERIFY( ok );
+
+            // NULL and non-numeric values
+            QCOMPARE( q.valueInt64( 1, &ok ), Q_INT64_C(0) );
+            QVERIFY( !ok );
+            QCOMPARE( q.valueDouble( 1, &ok ), 0.0 );
+            QVERIFY( !ok );
+            ++i;
+        }
+        QCOMPARE( i, 4 );
+    }
+}
+
 #define SETUP_RECORD_TABLE \
     do { \
         QVERIFY_SQL(q, exec("CREATE TABLE " + tst_record + " (id integer, extra varchar(50))")); \
@@ -70,6 +70,8 @@ private slots:
     void setHeaderData();
     void fetchMore_data() { generic_data(); }
     void fetchMore();
+    void windowed_data() { generic_data(); }
+    void windowed();
 
     //problem specific tests
     void withSortFilterProxyModel_data() { generic_data(); }
@@ -490,6 +492,46 @@ void tst_QSqlQueryModel::fetchMore()
     }
 }
 
+void tst_QSqlQueryModel::windowed()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+    const QSqlDriver::DbmsType dbType = tst_Databases::getDatabaseType(db);
+    if (dbType != QSqlDriver::PostgreSQL && dbType != QSqlDriver::SQLite
+        && dbType != QSqlDriver::MySqlServer) {
+        QSKIP("Windowed mode is not supported for this database");
+    }
+
+    QSqlQueryModel model;
+    QCOMPARE(model.windowSize(), 0);
+    model.setWindowSize(100);
+    QCOMPARE(model.windowSize(), 100);
+
+    QSignalSpy modelResetSpy(&model, SIGNAL(modelReset()));
+    model.setQuery("select id, name from " + qTableName("many", __FILE__, db) + " order by id", db);
+    QVERIFY2(!model.lastError().isValid(), qPrintable(model.lastError().text()));
+    QCOMPARE(modelResetSpy.count(), 1);
+
+    // the row count is known without fetching all rows
+    QCOMPARE(model.rowCount(), 2048);
+    QVERIFY(!model.canFetchMore());
+    QCOMPARE(model.columnCount(), 2);
+    QCOMPARE(model.record().fieldName(0).toLower(), QString("id"));
+
+    QCOMPARE(model.data(model.index(0, 0)).toInt(), 0);
+    QCOMPARE(model.data(model.index(2000, 0)).toInt(), 2000);
+    QCOMPARE(model.data(model.index(5, 1)).toString(), QString("harry"));
+    QCOMPARE(model.data(model.index(1024, 0)).toInt(), 1024);
+    QCOMPARE(model.data(model.index(2047, 0)).toInt(), 2047);
+    QVERIFY(!model.data(model.index(2048, 0)).isValid());
+    QCOMPARE(model.record(7).value(0).toInt(), 7);
+
+    // setting a QSqlQuery goes back to the normal mode
+    model.setQuery(QSqlQuery("select id from " + qTableName("test", __FILE__, db) + " order by id", db));
+    QCOMPARE(model.data(model.index(1, 0)).toInt(), 2);
+}
+
 // For task 149491: When used with QSortFilterProxyModel, a view and a
 // database that doesn't support the QuerySize feature, blank rows was
 // appended if the query returned more than 256 rows and setQuery()
@@ -32,6 +32,7 @@
 #include <private/qgraphicsscenebsptreeindex_p.h>
 #include <private/qgraphicssceneindex_p.h>
 #include <private/qgraphicsscenelinearindex_p.h>
+#include <private/qgraphicsscenequadtreeindex_p.h>
 
 class tst_QGraphicsSceneIndex : public QObject
 {
@@ -46,6 +47,8 @@ private slots:
     void overlappedItems();
     void movingItems_data();
     void movingItems();
+    void manyMovingItems_data();
+    void manyMovingItems();
     void connectedToSceneRectChanged();
     void items();
     void boundingRectPointIntersection_data();
@@ -56,6 +59,7 @@ private slots:
 private:
     void common_data();
     QGraphicsSceneIndex *createIndex(const QString &name);
+    static QGraphicsScene::ItemIndexMethod itemIndexMethod(const QString &name);
 };
 
 void tst_QGraphicsSceneIndex::initTestCase()
@@ -68,6 +72,7 @@ void tst_QGraphicsSceneIndex::common_data()
 
     QTest::newRow("BSP") << QString("bsp");
     QTest::newRow("Linear") << QString("linear");
+    QTest::newRow("QuadTree") << QString("quadtree");
 }
 
 QGraphicsSceneIndex *tst_QGraphicsSceneIndex::createIndex(const QString &indexMethod)
@@ -80,9 +85,21 @@ QGraphicsSceneIndex *tst_QGraphicsSceneIndex::createIndex(const QString &indexMe
     if (indexMethod == "linear")
         index = new QGraphicsSceneLinearIndex(scene);
 
+    if (indexMethod == "quadtree")
+        index = new QGraphicsSceneQuadTreeIndex(scene);
+
     return index;
 }
 
+QGraphicsScene::ItemIndexMethod tst_QGraphicsSceneIndex::itemIndexMethod(const QString &indexMethod)
+{
+    if (indexMethod == "linear")
+        return QGraphicsScene::NoIndex;
+    if (indexMethod == "quadtree")
+        return QGraphicsScene::QuadTreeIndex;
+    return QGraphicsScene::BspTreeIndex;
+}
+
 void tst_QGraphicsSceneIndex::scatteredItems_data()
 {
     common_data();
@@ -93,7 +110,7 @@ void tst_QGraphicsSceneIndex::scatteredItems()
     QFETCH(QString, indexMethod);
 
     QGraphicsScene scene;
-    scene.setItemIndexMethod(indexMethod == "linear" ? QGraphicsScene::NoIndex : QGraphicsScene::BspTreeIndex);
+    scene.setItemIndexMethod(itemIndexMethod(indexMethod));
 
     for (int i = 0; i < 10; ++i)
         scene.addRect(i*50, i*50, 40, 35);
@@ -117,7 +134,7 @@ void tst_QGraphicsSceneIndex::overlappedItems()
     QFETCH(QString, indexMethod);
 
     QGraphicsScene scene;
-    scene.setItemIndexMethod(indexMethod == "linear" ? QGraphicsScene::NoIndex : QGraphicsScene::BspTreeIndex);
+    scene.setItemIndexMethod(itemIndexMethod(indexMethod));
 
     for (int i = 0; i < 10; ++i)
         for (int j = 0; j < 10; ++j)
@@ -146,7 +163,7 @@ void tst_QGraphicsSceneIndex::movingItems()
     QFETCH(QString, indexMethod);
 
     QGraphicsScene scene;
-    scene.setItemIndexMethod(indexMethod == "linear" ? QGraphicsScene::NoIndex : QGraphicsScene::BspTreeIndex);
+    scene.setItemIndexMethod(itemIndexMethod(indexMethod));
 
     for (int i = 0; i < 10; ++i)
         scene.addRect(i*50, i*50, 40, 35);
@@ -168,6 +185,59 @@ void tst_QGraphicsSceneIndex::movingItems()
     QCOMPARE(scene.items(QRectF(0, 0, 1000, 1000)).count(), 11);
 }
 
+void tst_QGraphicsSceneIndex::manyMovingItems_data()
+{
+    common_data();
+}
+
+void tst_QGraphicsSceneIndex::manyMovingItems()
+{
+    QFETCH(QString, indexMethod);
+
+    QGraphicsScene scene;
+    scene.setItemIndexMethod(itemIndexMethod(indexMethod));
+
+    QList<QGraphicsRectItem *> boxes;
+    for (int i = 0; i < 40; ++i) {
+        for (int j = 0; j < 40; ++j) {
+            QGraphicsRectItem *box = scene.addRect(0, 0, 8, 8);
+            box->setPos(i * 10, j * 10);
+            boxes << box;
+        }
+    }
+    QCOMPARE(scene.items(QRectF(0, 0, 400, 400)).count(), 1600);
+    QCOMPARE(scene.items(QPointF(4, 4)).count(), 1);
+    QCOMPARE(scene.items(QPointF(9, 9)).count(), 0);
+
+    // Move every item a little, so that most of them stay in their cell.
+    for (QGraphicsRectItem *box : qAsConst(boxes))
+        box->moveBy(1, 1);
+    QCOMPARE(scene.items(QPointF(0.2, 0.2)).count(), 0);
+    QCOMPARE(scene.items(QPointF(9, 9)).count(), 1);
+    QCOMPARE(scene.items(QRectF(1, 1, 399, 399)).count(), 1600);
+
+    // Move the items far outside of the original scene rect.
+    for (int i = 0; i < boxes.size(); ++i)
+        boxes.at(i)->moveBy(-100000 + (i % 2) * 200000, 50000);
+    QCOMPARE(scene.items(QRectF(0, 0, 500, 500)).count(), 0);
+    QCOMPARE(scene.items(QRectF(-100000, 50000, 500, 500)).count(), 800);
+    QCOMPARE(scene.items(QRectF(100000, 50000, 500, 500)).count(), 800);
+
+    // Back again, with growing items.
+    for (int i = 0; i < boxes.size(); ++i) {
+        QGraphicsRectItem *box = boxes.at(i);
+        box->setPos(i / 40 * 10, i % 40 * 10);
+        box->setRect(0, 0, 15, 15);
+    }
+    QCOMPARE(scene.items(QPointF(4, 4)).count(), 1);
+    QCOMPARE(scene.items(QPointF(12, 12)).count(), 4);
+    QCOMPARE(scene.items(QRectF(0, 0, 500, 500)).count(), 1600);
+
+    qDeleteAll(boxes.mid(0, 800));
+    QCOMPARE(scene.items(QRectF(0, 0, 500, 500)).count(), 800);
+    QCOMPARE(scene.items().count(), 800);
+}
+
 void tst_QGraphicsSceneIndex::connectedToSceneRectChanged()
 {
 
@@ -182,6 +252,9 @@ void tst_QGraphicsSceneIndex::connectedToSceneRectChanged()
 
     scene.setItemIndexMethod(QGraphicsScene::NoIndex); // QGraphicsSceneLinearIndex
     QCOMPARE(scene.receivers(SIGNAL(sceneRectChanged(QRectF))), 1);
+
+    scene.setItemIndexMethod(QGraphicsScene::QuadTreeIndex); // QGraphicsSceneQuadTreeIndex
+    QCOMPARE(scene.receivers(SIGNAL(sceneRectChanged(QRectF))), 1);
 }
 
 void tst_QGraphicsSceneIndex::items()
@@ -241,6 +241,8 @@ private slots:
     void stretchAndRestoreLastSection();
 
     void sizeHintCrash();
+    void uniformSectionSizes();
+    void deferredResizeToContents();
 
 protected:
     void setupTestData(bool use_reset_model = false);
@@ -3053,6 +3055,84 @@ void tst_QHeaderView::sizeHintCrash()
     treeView.header()->sizeHintForRow(0);
 }
 
+static void verifySectionPositions(const QHeaderView &header, int cppline)
+{
+    int pos = 0;
+    for (int visual = 0; visual < header.count(); ++visual) {
+        const int logical = header.logicalIndex(visual);
+        if (header.isSectionHidden(logical))
+            continue;
+        const int size = header.sectionSize(logical);
+        QVERIFY2(header.sectionPosition(logical) == pos, qPrintable(QString::number(cppline)));
+        QVERIFY2(header.visualIndexAt(pos) == visual, qPrintable(QString::number(cppline)));
+        QVERIFY2(header.visualIndexAt(pos + size - 1) == visual, qPrintable(QString::number(cppline)));
+        pos += size;
+    }
+    QCOMPARE(header.length(), pos);
+    QCOMPARE(header.visualIndexAt(pos), -1);
+}
+
+void tst_QHeaderView::uniformSectionSizes()
+{
+    QStandardItemModel m(500, 2);
+    QHeaderView header(Qt::Vertical);
+    header.setModel(&m);
+    header.setDefaultSectionSize(20);
+
+    verifySectionPositions(header, __LINE__);
+    QCOMPARE(header.sectionPosition(499), 499 * 20);
+    QCOMPARE(header.visualIndexAt(250 * 20 + 5), 250);
+
+    header.resizeSection(100, 35);
+    verifySectionPositions(header, __LINE__);
+    header.resizeSection(100, 20);
+    verifySectionPositions(header, __LINE__);
+
+    header.hideSection(42);
+    verifySectionPositions(header, __LINE__);
+    header.showSection(42);
+    verifySectionPositions(header, __LINE__);
+
+    header.moveSection(3, 300);
+    verifySectionPositions(header, __LINE__);
+
+    m.insertRows(250, 10);
+    verifySectionPositions(header, __LINE__);
+    m.removeRows(0, 5);
+    verifySectionPositions(header, __LINE__);
+
+    header.setDefaultSectionSize(15);
+    verifySectionPositions(header, __LINE__);
+    QCOMPARE(header.length(), header.count() * 15);
+}
+
+void tst_QHeaderView::deferredResizeToContents()
+{
+    const int rowCount = 5000;
+    QStandardItemModel m(rowCount, 1);
+    for (int row = 0; row < rowCount; ++row)
+        m.setData(m.index(row, 0), row % 7 == 0 ? QStringLiteral("A\nB\nC") : QStringLiteral("A"));
+
+    QTableView tv;
+    tv.setModel(&m);
+    tv.resize(200, 200);
+    QAbstractItemView *itemView = &tv; // sizeHintForRow() is public here
+    QHeaderView *header = tv.verticalHeader();
+    header->setSectionResizeMode(QHeaderView::ResizeToContents);
+    tv.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&tv));
+
+    // the rows in view are measured right away
+    const int firstVisible = header->logicalIndexAt(0);
+    QVERIFY(firstVisible >= 0);
+    QCOMPARE(header->sectionSize(firstVisible), itemView->sizeHintForRow(firstVisible));
+
+    // the rest is measured from the event loop
+    QTRY_COMPARE(header->sectionSize(rowCount - 7), itemView->sizeHintForRow(rowCount - 7));
+    QTRY_COMPARE(header->sectionSize(rowCount - 1), itemView->sizeHintForRow(rowCount - 1));
+    QVERIFY(header->sectionSize(rowCount - 7) > header->sectionSize(rowCount - 1));
+}
+
 void tst_QHeaderView::stretchAndRestoreLastSection()
 {
     QStandardItemModel m(10, 10);
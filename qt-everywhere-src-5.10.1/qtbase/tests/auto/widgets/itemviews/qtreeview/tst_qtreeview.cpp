@@ -198,6 +198,7 @@ private slots:
     void taskQTBUG_7232_AllowUserToControlSingleStep();
     void taskQTBUG_8376();
     void testInitialFocus();
+    void chunkedLayout();
 };
 
 class QtTestModel: public QAbstractItemModel
@@ -4610,5 +4611,45 @@ void tst_QTreeView::taskQTBUG_8376()
     QCOMPARE(rowHeightLvl1Visible, rowHeightLvl1Visible2);
 }
 
+void tst_QTreeView::chunkedLayout()
+{
+    const int childCount = 25000;
+    QStandardItemModel model;
+    QStandardItem *parentItem = new QStandardItem(QStringLiteral("parent"));
+    QList<QStandardItem *> children;
+    children.reserve(childCount);
+    for (int i = 0; i < childCount; ++i)
+        children << new QStandardItem(QString::number(i));
+    parentItem->appendRows(children);
+    model.appendRow(parentItem);
+    model.appendRow(new QStandardItem(QStringLiteral("sibling")));
+
+    QTreeView view;
+    view.setModel(&model);
+    const QModelIndex parent = model.index(0, 0);
+    const QModelIndex sibling = model.index(1, 0);
+    const QModelIndex lastChild = model.index(childCount - 1, 0, parent);
+    view.setRowHidden(20000, parent, true);
+
+    // the first children are there right away, the others follow from the event loop
+    view.expand(parent);
+    QCOMPARE(view.indexBelow(model.index(0, 0, parent)), model.index(1, 0, parent));
+    QTRY_COMPARE(view.indexAbove(sibling), lastChild);
+    QCOMPARE(view.indexBelow(model.index(9999, 0, parent)), model.index(10000, 0, parent));
+    QCOMPARE(view.indexBelow(model.index(19999, 0, parent)), model.index(20001, 0, parent));
+
+    // collapsing drops the children still to be laid out
+    view.collapse(parent);
+    view.expand(parent);
+    view.collapse(parent);
+    QCoreApplication::processEvents();
+    QCOMPARE(view.indexBelow(parent), sibling);
+
+    // scrolling to a child that is not laid out yet lays out the rest
+    view.expand(parent);
+    view.scrollTo(lastChild);
+    QCOMPARE(view.indexAbove(sibling), lastChild);
+}
+
 QTEST_MAIN(tst_QTreeView)
 #include "tst_qtreeview.moc"
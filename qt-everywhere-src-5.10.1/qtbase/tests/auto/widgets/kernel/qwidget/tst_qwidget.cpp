@@ -306,6 +306,7 @@ private slots:
     void repaintWhenChildDeleted();
     void hideOpaqueChildWhileHidden();
     void updateWhileMinimized();
+    void cachedLayer();
     void alienWidgets();
     void adjustSize();
     void adjustSize_data();
@@ -7619,6 +7620,56 @@ void tst_QWidget::updateWhileMinimized()
     QCOMPARE(widget.paintedRegion, QRegion(0, 0, 50, 50));
 }
 
+class CachedLayerWidget : public UpdateWidget
+{
+public:
+    CachedLayerWidget(QWidget *parent = 0) : UpdateWidget(parent) {}
+
+    void paintEvent(QPaintEvent *e) override
+    {
+        UpdateWidget::paintEvent(e);
+        QPainter p(this);
+        p.fillRect(rect(), Qt::red);
+    }
+};
+
+void tst_QWidget::cachedLayer()
+{
+    QWidget parent;
+    parent.resize(200, 200);
+    CachedLayerWidget child(&parent);
+    child.setGeometry(50, 50, 100, 100);
+    child.setAttribute(Qt::WA_CachedLayer);
+    parent.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&parent));
+    QTRY_VERIFY(child.numPaintEvents > 0);
+
+    // Repainting the parent draws the child from its layer.
+    child.reset();
+    parent.repaint();
+    QCOMPARE(child.numPaintEvents, 0);
+    const QImage image = parent.grab().toImage();
+    QCOMPARE(image.pixel(image.rect().center()), QColor(Qt::red).rgb());
+    QCOMPARE(child.numPaintEvents, 0);
+
+    // Only the area that was updated is repainted into the layer.
+    child.repaint(10, 10, 20, 20);
+    QCOMPARE(child.numPaintEvents, 1);
+    QCOMPARE(child.paintedRegion, QRegion(10, 10, 20, 20));
+
+    // Resizing invalidates the layer.
+    child.reset();
+    child.resize(120, 120);
+    QTRY_COMPARE(child.paintedRegion, QRegion(child.rect()));
+
+    // Without the attribute, every repaint of the parent reaches the child.
+    child.setAttribute(Qt::WA_CachedLayer, false);
+    QApplication::processEvents();
+    child.reset();
+    parent.repaint();
+    QCOMPARE(child.numPaintEvents, 1);
+}
+
 class PaintOnScreenWidget: public QWidget
 {
 public:
@@ -0,0 +1,166 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtCore/QtCore>
+#include <QtTest/QtTest>
+
+class tst_QReadWriteLock : public QObject
+{
+    Q_OBJECT
+
+    int threadCount;
+
+public:
+    tst_QReadWriteLock()
+    {
+        // at least 2 threads, even on single cpu/core machines
+        threadCount = qMax(2, QThread::idealThreadCount());
+        qDebug("thread count: %d", threadCount);
+    }
+
+private slots:
+    void uncontendedRead();
+    void uncontendedWrite();
+
+    void contended_data();
+    void contended();
+};
+
+void tst_QReadWriteLock::uncontendedRead()
+{
+    QReadWriteLock lock;
+    QBENCHMARK {
+        lock.lockForRead();
+        lock.unlock();
+    }
+}
+
+void tst_QReadWriteLock::uncontendedWrite()
+{
+    QReadWriteLock lock;
+    QBENCHMARK {
+        lock.lockForWrite();
+        lock.unlock();
+    }
+}
+
+void tst_QReadWriteLock::contended_data()
+{
+    QTest::addColumn<int>("threads");
+    QTest::addColumn<int>("writePercent");
+    QTest::addColumn<int>("holdIterations");
+
+    QVector<int> counts;
+    counts << 2 << 4 << threadCount << 2 * threadCount;
+    std::sort(counts.begin(), counts.end());
+    counts.erase(std::unique(counts.begin(), counts.end()), counts.end());
+    for (int threads : qAsConst(counts)) {
+        const QByteArray t = QByteArray::number(threads) + " threads";
+        QTest::newRow(t + ", read only") << threads << 0 << 0;
+        QTest::newRow(t + ", read only, long hold") << threads << 0 << 200;
+        QTest::newRow(t + ", 1% writes") << threads << 1 << 0;
+        QTest::newRow(t + ", 1% writes, long hold") << threads << 1 << 200;
+        QTest::newRow(t + ", 10% writes") << threads << 10 << 0;
+        QTest::newRow(t + ", 50% writes") << threads << 50 << 0;
+    }
+}
+
+class LockThread : public QThread
+{
+public:
+    QReadWriteLock *lock;
+    QSemaphore *startSemaphore;
+    QSemaphore *doneSemaphore;
+    int writePercent;
+    int holdIterations;
+    int iterations;
+    volatile int *shared;
+
+    void run() override
+    {
+        for (;;) {
+            startSemaphore->acquire();
+            if (iterations < 0)
+                return;
+            for (int i = 0; i < iterations; ++i) {
+                if (writePercent && (i % 100) < writePercent) {
+                    QWriteLocker locker(lock);
+                    for (int j = 0; j <= holdIterations; ++j)
+                        ++*shared;
+                } else {
+                    QReadLocker locker(lock);
+                    int sum = 0;
+                    for (int j = 0; j <= holdIterations; ++j)
+                        sum += *shared;
+                    Q_UNUSED(sum);
+                }
+            }
+            doneSemaphore->release();
+        }
+    }
+};
+
+void tst_QReadWriteLock::contended()
+{
+    QFETCH(int, threads);
+    QFETCH(int, writePercent);
+    QFETCH(int, holdIterations);
+
+    QReadWriteLock lock;
+    QSemaphore start, done;
+    volatile int shared = 0;
+    QVector<LockThread *> workers;
+    for (int i = 0; i < threads; ++i) {
+        LockThread *thread = new LockThread;
+        thread->lock = &lock;
+        thread->startSemaphore = &start;
+        thread->doneSemaphore = &done;
+        thread->writePercent = writePercent;
+        thread->holdIterations = holdIterations;
+        thread->iterations = 10000;
+        thread->shared = &shared;
+        thread->start();
+        workers.append(thread);
+    }
+
+    QBENCHMARK {
+        start.release(threads);
+        done.acquire(threads);
+    }
+
+    for (LockThread *thread : qAsConst(workers))
+        thread->iterations = -1;
+    start.release(threads);
+    for (LockThread *thread : qAsConst(workers)) {
+        thread->wait();
+        delete thread;
+    }
+}
+
+QTEST_MAIN(tst_QReadWriteLock)
+#include "tst_qreadwritelock.moc"
@@ -0,0 +1,229 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QList>
+#include <QTest>
+
+// Compares QList's two layouts for a type larger than a pointer: one node
+// allocated per element (the default), and the elements stored in the array
+// (opted in with Q_DECLARE_LIST_INLINE_STORAGE).
+
+struct IndirectPoint
+{
+    IndirectPoint(double x = 0, double y = 0) : x(x), y(y) {}
+    bool operator==(const IndirectPoint &other) const { return x == other.x && y == other.y; }
+    double x, y;
+};
+
+struct InlinePoint
+{
+    InlinePoint(double x = 0, double y = 0) : x(x), y(y) {}
+    bool operator==(const InlinePoint &other) const { return x == other.x && y == other.y; }
+    double x, y;
+};
+
+QT_BEGIN_NAMESPACE
+Q_DECLARE_TYPEINFO(IndirectPoint, Q_PRIMITIVE_TYPE);
+Q_DECLARE_TYPEINFO(InlinePoint, Q_PRIMITIVE_TYPE);
+Q_DECLARE_LIST_INLINE_STORAGE(InlinePoint)
+QT_END_NAMESPACE
+
+class tst_QList : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void append_data() { layouts(); }
+    void append();
+    void prepend_data() { layouts(); }
+    void prepend();
+    void insertMiddle_data() { layouts(); }
+    void insertMiddle();
+    void iterate_data() { layouts(); }
+    void iterate();
+    void indexOf_data() { layouts(); }
+    void indexOf();
+    void copyAndDetach_data() { layouts(); }
+    void copyAndDetach();
+
+private:
+    void layouts();
+};
+
+void tst_QList::layouts()
+{
+    QTest::addColumn<bool>("inlineStorage");
+    QTest::addColumn<int>("size");
+
+    for (int size : {10, 1000, 100000}) {
+        const QByteArray suffix = '-' + QByteArray::number(size);
+        QTest::newRow(("indirect" + suffix).constData()) << false << size;
+        QTest::newRow(("inline" + suffix).constData()) << true << size;
+    }
+}
+
+template <typename T>
+static QList<T> makeList(int size)
+{
+    QList<T> list;
+    list.reserve(size);
+    for (int i = 0; i < size; ++i)
+        list.append(T(i, -i));
+    return list;
+}
+
+template <typename T>
+static void appendImpl(int size)
+{
+    QBENCHMARK {
+        QList<T> list;
+        for (int i = 0; i < size; ++i)
+            list.append(T(i, i));
+    }
+}
+
+void tst_QList::append()
+{
+    QFETCH(bool, inlineStorage);
+    QFETCH(int, size);
+    if (inlineStorage)
+        appendImpl<InlinePoint>(size);
+    else
+        appendImpl<IndirectPoint>(size);
+}
+
+template <typename T>
+static void prependImpl(int size)
+{
+    QBENCHMARK {
+        QList<T> list;
+        for (int i = 0; i < size; ++i)
+            list.prepend(T(i, i));
+    }
+}
+
+void tst_QList::prepend()
+{
+    QFETCH(bool, inlineStorage);
+    QFETCH(int, size);
+    if (inlineStorage)
+        prependImpl<InlinePoint>(size);
+    else
+        prependImpl<IndirectPoint>(size);
+}
+
+template <typename T>
+static void insertMiddleImpl(int size)
+{
+    // quadratic; keep the larger sizes reasonable
+    size = qMin(size, 10000);
+    QBENCHMARK {
+        QList<T> list;
+        for (int i = 0; i < size; ++i)
+            list.insert(list.size() / 2, T(i, i));
+    }
+}
+
+void tst_QList::insertMiddle()
+{
+    QFETCH(bool, inlineStorage);
+    QFETCH(int, size);
+    if (inlineStorage)
+        insertMiddleImpl<InlinePoint>(size);
+    else
+        insertMiddleImpl<IndirectPoint>(size);
+}
+
+template <typename T>
+static void iterateImpl(int size)
+{
+    const QList<T> list = makeList<T>(size);
+    double sum = 0;
+    QBENCHMARK {
+        for (const T &point : list)
+            sum += point.x + point.y;
+    }
+    QVERIFY(sum == 0);
+}
+
+void tst_QList::iterate()
+{
+    QFETCH(bool, inlineStorage);
+    QFETCH(int, size);
+    if (inlineStorage)
+        iterateImpl<InlinePoint>(size);
+    else
+        iterateImpl<IndirectPoint>(size);
+}
+
+template <typename T>
+static void indexOfImpl(int size)
+{
+    const QList<T> list = makeList<T>(size);
+    const T last(size - 1, -(size - 1));
+    int index = -1;
+    QBENCHMARK {
+        index = list.indexOf(last);
+    }
+    QCOMPARE(index, size - 1);
+}
+
+void tst_QList::indexOf()
+{
+    QFETCH(bool, inlineStorage);
+    QFETCH(int, size);
+    if (inlineStorage)
+        indexOfImpl<InlinePoint>(size);
+    else
+        indexOfImpl<IndirectPoint>(size);
+}
+
+template <typename T>
+static void copyAndDetachImpl(int size)
+{
+    const QList<T> list = makeList<T>(size);
+    QBENCHMARK {
+        QList<T> copy = list;
+        copy[0] = T(1, 1); // detaches
+    }
+}
+
+void tst_QList::copyAndDetach()
+{
+    QFETCH(bool, inlineStorage);
+    QFETCH(int, size);
+    if (inlineStorage)
+        copyAndDetachImpl<InlinePoint>(size);
+    else
+        copyAndDetachImpl<IndirectPoint>(size);
+}
+
+QTEST_APPLESS_MAIN(tst_QList)
+
+#include "main.moc"
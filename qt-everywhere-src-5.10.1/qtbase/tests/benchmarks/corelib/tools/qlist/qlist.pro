@@ -0,0 +1,5 @@
+TARGET = tst_bench_qlist
+
+SOURCES += main.cpp
+
+QT = core testlib
@@ -170,6 +170,8 @@ private slots:
 
     void compositionModes_data();
     void compositionModes();
+    void compositionModesPerFormat_data();
+    void compositionModesPerFormat();
 
     void fillPrimitives_10_data() { drawPrimitives_data_helper(false); }
     void fillPrimitives_100_data() { drawPrimitives_data_helper(false); }
@@ -834,6 +836,71 @@ void tst_QPainter::compositionModes()
     }
 }
 
+void tst_QPainter::compositionModesPerFormat_data()
+{
+    QTest::addColumn<QPainter::CompositionMode>("mode");
+    QTest::addColumn<QImage::Format>("format");
+    QTest::addColumn<bool>("solid");
+
+    static const struct {
+        QImage::Format format;
+        const char *name;
+    } formats[] = {
+        { QImage::Format_ARGB32_Premultiplied, "argb32pm" },
+        { QImage::Format_RGB32, "rgb32" },
+        { QImage::Format_RGBA8888_Premultiplied, "rgba8888pm" },
+        { QImage::Format_ARGB32, "argb32" },
+        { QImage::Format_RGB16, "rgb16" }
+    };
+
+    for (int i = 0; i <= QPainter::CompositionMode_Exclusion; ++i) {
+        for (const auto &f : formats) {
+            QTest::newRow(qPrintable(QString::fromLatin1("%1:%2:image").arg(i).arg(f.name)))
+                << QPainter::CompositionMode(i) << f.format << false;
+            QTest::newRow(qPrintable(QString::fromLatin1("%1:%2:solid").arg(i).arg(f.name)))
+                << QPainter::CompositionMode(i) << f.format << true;
+        }
+    }
+}
+
+void tst_QPainter::compositionModesPerFormat()
+{
+    QFETCH(QPainter::CompositionMode, mode);
+    QFETCH(QImage::Format, format);
+    QFETCH(bool, solid);
+
+    const QSize size(512, 512);
+    QImage dest(size, format);
+    QImage src(size, QImage::Format_ARGB32_Premultiplied);
+    {
+        QLinearGradient gradient(0, 0, size.width(), size.height());
+        gradient.setColorAt(0, QColor(255, 0, 0, 64));
+        gradient.setColorAt(1, QColor(0, 0, 255, 255));
+        QPainter p(&dest);
+        p.setCompositionMode(QPainter::CompositionMode_Source);
+        p.fillRect(dest.rect(), gradient);
+        gradient.setColorAt(0, QColor(0, 255, 0, 200));
+        gradient.setColorAt(1, QColor(255, 255, 0, 32));
+        src.fill(Qt::transparent);
+        QPainter sp(&src);
+        sp.fillRect(src.rect(), gradient);
+    }
+    const QColor color(80, 160, 240, 180);
+
+    QPainter p(&dest);
+    p.setCompositionMode(mode);
+
+    if (solid) {
+        QBENCHMARK {
+            p.fillRect(dest.rect(), color);
+        }
+    } else {
+        QBENCHMARK {
+            p.drawImage(0, 0, src);
+        }
+    }
+}
+
 void tst_QPainter::drawTiledPixmap_data()
 {
     QTest::addColumn<QSize>("srcSize");
@@ -0,0 +1,9 @@
+TEMPLATE = app
+TARGET = tst_bench_hpack
+
+QT -= gui
+QT += core-private network network-private testlib
+
+CONFIG += release c++14
+
+SOURCES += tst_bench_hpack.cpp
@@ -0,0 +1,147 @@
+/****************************************************************************
+**
+** Copyright (C) 2016 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include <QtTest/QtTest>
+
+#include <QtNetwork/private/bitstreams_p.h>
+#include <QtNetwork/private/hpack_p.h>
+
+#include <QtCore/qbytearray.h>
+
+#include <vector>
+
+using namespace HPack;
+
+class tst_bench_Hpack : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void encodeRequests_data();
+    void encodeRequests();
+
+private:
+    std::vector<HttpHeader> requests;
+};
+
+Q_DECLARE_METATYPE(std::vector<QByteArray>)
+
+namespace {
+
+// A session of API calls: all of them send the same authorization and a
+// cookie header of about 2 KB, where one of the cookies changes now and then.
+std::vector<HttpHeader> apiSession(int count)
+{
+    QByteArray cookie;
+    for (int i = 0; i < 20; ++i)
+        cookie += "cookie" + QByteArray::number(i) + '=' + QByteArray(90, char('a' + i)) + "; ";
+    cookie.chop(2);
+    const QByteArray authorization = "Bearer " + QByteArray(300, 'T');
+
+    std::vector<HttpHeader> session;
+    for (int i = 0; i < count; ++i) {
+        HttpHeader header = {{":method", "GET"},
+                             {":scheme", "https"},
+                             {":authority", "api.example.com"},
+                             {":path", "/v1/items/" + QByteArray::number(i) + "?fields=all"},
+                             {"accept", "application/json"},
+                             {"user-agent", "Mozilla/5.0"},
+                             {"authorization", authorization},
+                             {"cookie", cookie + "; session=" + QByteArray::number(i / 10)}};
+        session.push_back(header);
+    }
+    return session;
+}
+
+quint64 plainSize(const HttpHeader &header)
+{
+    // As sent by HTTP/1.1: "name: value\r\n".
+    quint64 size = 0;
+    for (const HeaderField &field : header)
+        size += field.name.size() + field.value.size() + 4;
+    return size;
+}
+
+} // unnamed namespace
+
+void tst_bench_Hpack::encodeRequests_data()
+{
+    QTest::addColumn<quint32>("tableSize");
+    QTest::addColumn<bool>("huffman");
+    QTest::addColumn<bool>("indexing");
+    QTest::addColumn<std::vector<QByteArray>>("neverIndexed");
+
+    const std::vector<QByteArray> none;
+    QTest::newRow("default") << quint32(4096) << true << true << none;
+    QTest::newRow("no-huffman") << quint32(4096) << false << true << none;
+    QTest::newRow("no-indexing") << quint32(4096) << true << false << none;
+    QTest::newRow("never-index-authorization") << quint32(4096) << true << true
+                                               << std::vector<QByteArray>{"authorization"};
+    QTest::newRow("table-1024") << quint32(1024) << true << true << none;
+    QTest::newRow("table-16384") << quint32(16384) << true << true << none;
+}
+
+void tst_bench_Hpack::encodeRequests()
+{
+    QFETCH(quint32, tableSize);
+    QFETCH(bool, huffman);
+    QFETCH(bool, indexing);
+    QFETCH(std::vector<QByteArray>, neverIndexed);
+
+    if (requests.empty())
+        requests = apiSession(100);
+
+    quint64 encodedSize = 0;
+    QBENCHMARK {
+        Encoder encoder(4096, huffman);
+        encoder.setIndexingEnabled(indexing);
+        encoder.setNeverIndexedFields(neverIndexed);
+        encoder.setMaxDynamicTableSize(tableSize);
+
+        encodedSize = 0;
+        for (const HttpHeader &header : requests) {
+            std::vector<uchar> buffer;
+            BitOStream outputStream(buffer);
+            QVERIFY(encoder.encodeRequest(outputStream, header));
+            encodedSize += outputStream.byteLength();
+        }
+    }
+
+    quint64 uncompressedSize = 0;
+    for (const HttpHeader &header : requests)
+        uncompressedSize += plainSize(header);
+
+    qDebug("%llu bytes per request, %.1f%% of %llu bytes uncompressed",
+           encodedSize / requests.size(), 100.0 * encodedSize / uncompressedSize,
+           uncompressedSize / requests.size());
+}
+
+QTEST_MAIN(tst_bench_Hpack)
+
+#include "tst_bench_hpack.moc"
@@ -0,0 +1,17 @@
+TEMPLATE = app
+TARGET = tst_bench_httpthroughput
+
+QT -= gui
+QT += core-private network network-private testlib
+
+CONFIG += release c++14
+
+include(../../shared/networkbenchmark.pri)
+
+# HTTP/2 is served by the server of the HTTP/2 auto test
+HTTP2_TEST_DIR = $$PWD/../../../../auto/network/access/http2
+INCLUDEPATH += $$HTTP2_TEST_DIR
+HEADERS += $$HTTP2_TEST_DIR/http2srv.h
+SOURCES += tst_bench_httpthroughput.cpp $$HTTP2_TEST_DIR/http2srv.cpp
+
+DEFINES += SRCDIR=\\\"$$HTTP2_TEST_DIR/\\\"
@@ -0,0 +1,314 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qeventloop.h>
+#include <QtCore/qhash.h>
+#include <QtNetwork/qnetworkaccessmanager.h>
+#include <QtNetwork/qnetworkreply.h>
+#include <QtNetwork/qnetworkrequest.h>
+#include <QtNetwork/qtcpserver.h>
+#include <QtNetwork/qtcpsocket.h>
+#ifndef QT_NO_SSL
+#include <QtNetwork/qsslsocket.h>
+#endif
+
+#include "networkbenchmark.h"
+#include "http2srv.h"
+
+#include <functional>
+
+using namespace NetworkBenchmark;
+
+// Data downloaded per row, bounded by the request counts below
+static const qint64 httpTransferSize = 64 * 1024 * 1024;
+static const int maxRequests = 2000;
+static const int timeout = 60000;
+
+// A minimal keep-alive HTTP/1.1 server. A GET for /<n> returns n bytes.
+class Http11Server : public QTcpServer
+{
+    Q_OBJECT
+public:
+    explicit Http11Server(bool tls)
+        : tls(tls)
+    {
+    }
+
+    Q_INVOKABLE quint16 start()
+    {
+        return listen(QHostAddress::LocalHost) ? serverPort() : quint16(0);
+    }
+
+protected:
+    void incomingConnection(qintptr socketDescriptor) override
+    {
+        QTcpSocket *socket;
+#ifndef QT_NO_SSL
+        if (tls) {
+            QSslSocket *sslSocket = new QSslSocket(this);
+            setupServerSocket(sslSocket);
+            sslSocket->setSocketDescriptor(socketDescriptor);
+            sslSocket->startServerEncryption();
+            socket = sslSocket;
+        } else
+#endif
+        {
+            socket = new QTcpSocket(this);
+            socket->setSocketDescriptor(socketDescriptor);
+        }
+        connect(socket, &QTcpSocket::readyRead, this, &Http11Server::handleRequests);
+        connect(socket, &QTcpSocket::disconnected, this, &Http11Server::dropConnection);
+    }
+
+private slots:
+    void handleRequests()
+    {
+        QTcpSocket *socket = static_cast<QTcpSocket *>(sender());
+        QByteArray &buffer = pendingRequests[socket];
+        buffer += socket->readAll();
+
+        int end;
+        while ((end = buffer.indexOf("\r\n\r\n")) != -1) {
+            // The request line is "GET /<n> HTTP/1.1"
+            const int pathStart = buffer.indexOf('/');
+            const int pathEnd = buffer.indexOf(' ', pathStart);
+            const int size = buffer.mid(pathStart + 1, pathEnd - pathStart - 1).toInt();
+            buffer.remove(0, end + 4);
+
+            QByteArray &body = bodies[size];
+            if (body.size() != size)
+                body.fill('x', size);
+            socket->write("HTTP/1.1 200 OK\r\n"
+                          "Content-Type: application/octet-stream\r\n"
+                          "Content-Length: " + QByteArray::number(size) + "\r\n\r\n");
+            socket->write(body);
+        }
+    }
+
+    void dropConnection()
+    {
+        QTcpSocket *socket = static_cast<QTcpSocket *>(sender());
+        pendingRequests.remove(socket);
+        socket->deleteLater();
+    }
+
+private:
+    QHash<QTcpSocket *, QByteArray> pendingRequests;
+    QHash<int, QByteArray> bodies;
+    bool tls;
+};
+
+class tst_HttpThroughput : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_HttpThroughput();
+    ~tst_HttpThroughput();
+
+private slots:
+    void initTestCase();
+    void requestRate_data();
+    void requestRate();
+
+private:
+    bool runRequests(QNetworkAccessManager *manager, const QNetworkRequest &request,
+                     int count, int inFlight, LatencyRecorder *latencies, qint64 *bytes);
+    void stopServer(QObject *server);
+
+    ServerThread serverThread;
+    // Lives in serverThread, to run code there
+    QObject serverContext;
+    bool tlsAvailable = false;
+    bool alpnAvailable = false;
+};
+
+tst_HttpThroughput::tst_HttpThroughput()
+{
+    serverContext.moveToThread(&serverThread);
+    serverThread.start();
+}
+
+tst_HttpThroughput::~tst_HttpThroughput()
+{
+    serverThread.quit();
+    serverThread.wait();
+}
+
+void tst_HttpThroughput::initTestCase()
+{
+#ifndef QT_NO_SSL
+    QSslSocket socket;
+    tlsAvailable = QSslSocket::supportsSsl() && setupServerSocket(&socket);
+    // HTTP/2 over TLS is negotiated with ALPN, which needs OpenSSL 1.0.2
+    alpnAvailable = tlsAvailable && QSslSocket::sslLibraryVersionNumber() >= 0x10002000L;
+#endif
+    if (!tlsAvailable)
+        qDebug("TLS rows are skipped, no TLS support or no test certificate");
+}
+
+void tst_HttpThroughput::stopServer(QObject *server)
+{
+    // Make sure the server and its connections are gone before the next row
+    QMetaObject::invokeMethod(&serverContext, [server] { delete server; },
+                              Qt::BlockingQueuedConnection);
+}
+
+bool tst_HttpThroughput::runRequests(QNetworkAccessManager *manager, const QNetworkRequest &request,
+                                     int count, int inFlight, LatencyRecorder *latencies,
+                                     qint64 *bytes)
+{
+    QEventLoop loop;
+    QElapsedTimer timer;
+    int started = 0;
+    int finished = 0;
+    bool ok = true;
+
+    std::function<void()> sendNext = [&] {
+        if (started == count)
+            return;
+        ++started;
+        const qint64 startTime = timer.nsecsElapsed();
+        QNetworkReply *reply = manager->get(request);
+        // The test certificate is self-signed
+        reply->ignoreSslErrors();
+        connect(reply, &QNetworkReply::finished, &loop, [&, reply, startTime] {
+            if (reply->error() != QNetworkReply::NoError) {
+                qWarning("%s", qPrintable(reply->errorString()));
+                ok = false;
+            }
+            *bytes += reply->readAll().size();
+            latencies->addSample(timer.nsecsElapsed() - startTime);
+            reply->deleteLater();
+            if (++finished == count || !ok)
+                loop.quit();
+            else
+                sendNext();
+        });
+    };
+    QTimer::singleShot(timeout, &loop, &QEventLoop::quit);
+
+    timer.start();
+    for (int i = 0; i < inFlight; ++i)
+        sendNext();
+    loop.exec();
+    return ok && finished == count;
+}
+
+void tst_HttpThroughput::requestRate_data()
+{
+    QTest::addColumn<bool>("http2");
+    QTest::addColumn<bool>("tls");
+    QTest::addColumn<int>("inFlight");
+    QTest::addColumn<int>("payloadSize");
+
+    for (bool http2 : { false, true }) {
+        for (bool tls : { false, true }) {
+            for (int inFlight : { 1, 6, 32 }) {
+                for (int payloadSize : { 1024, 64 * 1024, 1024 * 1024 }) {
+                    QTest::newRow(qPrintable(QStringLiteral("%1-%2-%3inflight-%4KB")
+                                             .arg(QLatin1String(http2 ? "http2" : "http1.1"))
+                                             .arg(QLatin1String(tls ? "tls" : "plain"))
+                                             .arg(inFlight).arg(payloadSize / 1024)))
+                            << http2 << tls << inFlight << payloadSize;
+                }
+            }
+        }
+    }
+}
+
+void tst_HttpThroughput::requestRate()
+{
+    QFETCH(bool, http2);
+    QFETCH(bool, tls);
+    QFETCH(int, inFlight);
+    QFETCH(int, payloadSize);
+
+    if (tls && !tlsAvailable)
+        QSKIP("TLS is not available");
+    if (http2 && tls && !alpnAvailable)
+        QSKIP("HTTP/2 over TLS needs ALPN support");
+
+    QObject *server;
+    quint16 port = 0;
+    if (http2) {
+        // Without TLS, the server expects the 'h2c' protocol upgrade
+        Http2Server *http2Server = new Http2Server(!tls, {{Http2::Settings::MAX_CONCURRENT_STREAMS_ID, 100}},
+                                                   Http2::ProtocolParameters().settingsFrameData);
+        http2Server->setResponseBody(QByteArray(payloadSize, 'x'));
+        http2Server->moveToThread(&serverThread);
+        QMetaObject::invokeMethod(http2Server, "startServer", Qt::BlockingQueuedConnection);
+        port = http2Server->serverPort();
+        server = http2Server;
+    } else {
+        Http11Server *http11Server = new Http11Server(tls);
+        http11Server->moveToThread(&serverThread);
+        QMetaObject::invokeMethod(http11Server, "start", Qt::BlockingQueuedConnection,
+                                  Q_RETURN_ARG(quint16, port));
+        server = http11Server;
+    }
+    QVERIFY(port);
+
+    QUrl url(QLatin1String(tls ? "https://127.0.0.1" : "http://127.0.0.1"));
+    url.setPort(port);
+    url.setPath(QLatin1Char('/') + QString::number(payloadSize));
+    QNetworkRequest request(url);
+    request.setAttribute(QNetworkRequest::HTTP2AllowedAttribute, http2);
+
+    QNetworkAccessManager manager;
+    LatencyRecorder latencies;
+    qint64 bytes = 0;
+
+    // Set up the connections first, connectLatency of the socket
+    // benchmark covers that part
+    QVERIFY(runRequests(&manager, request, inFlight, inFlight, &latencies, &bytes));
+
+    const int requests = qBound(4 * inFlight, int(httpTransferSize / payloadSize), maxRequests);
+    latencies = LatencyRecorder();
+    latencies.reserve(requests);
+    bytes = 0;
+
+    const quint64 allocationsBefore = allocationCount();
+    QElapsedTimer timer;
+    timer.start();
+    QVERIFY(runRequests(&manager, request, requests, inFlight, &latencies, &bytes));
+    const qint64 elapsed = timer.nsecsElapsed();
+    const quint64 allocations = allocationCount() - allocationsBefore;
+
+    QCOMPARE(bytes, qint64(requests) * payloadSize);
+    QTest::setBenchmarkResult(double(elapsed) / requests, QTest::WalltimeNanoseconds);
+    reportThroughput("requests", requests, bytes, elapsed, allocations);
+    latencies.report();
+
+    stopServer(server);
+}
+
+QTEST_MAIN(tst_HttpThroughput)
+#include "tst_bench_httpthroughput.moc"
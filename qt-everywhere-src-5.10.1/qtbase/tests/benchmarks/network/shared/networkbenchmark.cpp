@@ -0,0 +1,168 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "networkbenchmark.h"
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qfile.h>
+#ifndef QT_NO_SSL
+#include <QtNetwork/qsslcertificate.h>
+#include <QtNetwork/qsslkey.h>
+#include <QtNetwork/qsslsocket.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<quint64> allocations(0);
+thread_local bool allocationsExcluded = false;
+
+inline void countAllocation()
+{
+    if (!allocationsExcluded)
+        allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // unnamed namespace
+
+#if defined(__GLIBC__)
+// Interpose the allocator entry points, so that QArrayData based
+// containers are counted as well as operator new.
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+
+void *malloc(size_t size)
+{
+    countAllocation();
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    countAllocation();
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    countAllocation();
+    return __libc_realloc(ptr, size);
+}
+}
+#else
+void *operator new(std::size_t size)
+{
+    countAllocation();
+    if (void *ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    std::free(ptr);
+}
+#endif
+
+namespace NetworkBenchmark {
+
+quint64 allocationCount()
+{
+    return allocations.load(std::memory_order_relaxed);
+}
+
+void excludeCurrentThreadFromAllocationCount()
+{
+    allocationsExcluded = true;
+}
+
+qint64 LatencyRecorder::percentile(int p) const
+{
+    if (samples.isEmpty())
+        return 0;
+    QVector<qint64> sorted = samples;
+    const int index = (qBound(0, p, 100) * (sorted.size() - 1)) / 100;
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted.at(index);
+}
+
+void LatencyRecorder::report() const
+{
+    qDebug("\t\tlatency (us): p50 %.1f, p90 %.1f, p99 %.1f, max %.1f (%d samples)",
+           percentile(50) / 1000., percentile(90) / 1000., percentile(99) / 1000.,
+           percentile(100) / 1000., count());
+}
+
+void reportThroughput(const char *unit, qint64 count, qint64 bytes,
+                      qint64 nsecs, quint64 allocations)
+{
+    const double secs = nsecs / 1e9;
+    qDebug("\t\t%.0f %s/s, %.2f MB/s, %.1f allocations/%s",
+           secs > 0 ? count / secs : 0., unit,
+           secs > 0 ? bytes / secs / (1024 * 1024) : 0.,
+           count > 0 ? double(allocations) / count : 0., unit);
+}
+
+bool setupServerSocket(QSslSocket *socket)
+{
+#ifndef QT_NO_SSL
+    QFile keyFile(QLatin1String(CERTDIR "fluke.key"));
+    if (!keyFile.open(QIODevice::ReadOnly))
+        return false;
+    const QList<QSslCertificate> certificates =
+            QSslCertificate::fromPath(QLatin1String(CERTDIR "fluke.cert"));
+    if (certificates.isEmpty())
+        return false;
+
+    socket->setPrivateKey(QSslKey(keyFile.readAll(), QSsl::Rsa, QSsl::Pem, QSsl::PrivateKey));
+    socket->setLocalCertificateChain(certificates);
+    socket->setPeerVerifyMode(QSslSocket::VerifyNone);
+    return true;
+#else
+    Q_UNUSED(socket);
+    return false;
+#endif
+}
+
+} // namespace NetworkBenchmark
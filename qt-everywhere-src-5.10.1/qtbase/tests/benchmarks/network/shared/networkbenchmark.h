@@ -0,0 +1,84 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef NETWORKBENCHMARK_H
+#define NETWORKBENCHMARK_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qvector.h>
+
+QT_FORWARD_DECLARE_CLASS(QSslSocket)
+
+// Helpers shared by the loopback network benchmarks.
+namespace NetworkBenchmark {
+
+// Number of heap allocations done so far by all threads that were not
+// excluded. On glibc this counts malloc() calls, which includes the storage
+// of Qt containers; elsewhere only operator new is counted.
+quint64 allocationCount();
+void excludeCurrentThreadFromAllocationCount();
+
+// The loopback servers run in their own thread, so that client and server
+// do not share an event loop. Their allocations are not counted.
+class ServerThread : public QThread
+{
+protected:
+    void run() override
+    {
+        excludeCurrentThreadFromAllocationCount();
+        exec();
+    }
+};
+
+class LatencyRecorder
+{
+public:
+    void reserve(int count) { samples.reserve(count); }
+    void addSample(qint64 nsecs) { samples.append(nsecs); }
+    int count() const { return samples.size(); }
+
+    // p in [0, 100]; 0 if there are no samples
+    qint64 percentile(int p) const;
+    void report() const;
+
+private:
+    QVector<qint64> samples;
+};
+
+// Prints count/s, MB/s and allocations per unit of a finished run.
+void reportThroughput(const char *unit, qint64 count, qint64 bytes,
+                      qint64 nsecs, quint64 allocations);
+
+// Sets up socket as a TLS server with the test certificate. Returns false
+// if the certificate is not available.
+bool setupServerSocket(QSslSocket *socket);
+
+} // namespace NetworkBenchmark
+
+#endif // NETWORKBENCHMARK_H
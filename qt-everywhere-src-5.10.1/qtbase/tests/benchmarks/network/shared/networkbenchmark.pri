@@ -0,0 +1,6 @@
+INCLUDEPATH += $$PWD
+HEADERS += $$PWD/networkbenchmark.h
+SOURCES += $$PWD/networkbenchmark.cpp
+
+# The loopback servers use the certificate of the HTTP/2 auto test
+DEFINES += CERTDIR=\\\"$$PWD/../../../auto/network/access/http2/certs/\\\"
@@ -0,0 +1,11 @@
+TEMPLATE = app
+TARGET = tst_bench_socketthroughput
+
+QT -= gui
+QT += network testlib
+
+CONFIG += release c++14
+
+include(../../shared/networkbenchmark.pri)
+
+SOURCES += tst_bench_socketthroughput.cpp
@@ -0,0 +1,507 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtTest/QtTest>
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qeventloop.h>
+#include <QtCore/qhash.h>
+#include <QtNetwork/qtcpserver.h>
+#include <QtNetwork/qtcpsocket.h>
+#include <QtNetwork/qudpsocket.h>
+#ifndef QT_NO_SSL
+#include <QtNetwork/qsslsocket.h>
+#endif
+
+#include "networkbenchmark.h"
+
+#include <functional>
+
+using namespace NetworkBenchmark;
+
+// Data sent per row of tcpThroughput, split over the connections
+static const qint64 tcpTransferSize = 64 * 1024 * 1024;
+static const int connectAttempts = 512;
+static const int udpDatagrams = 50000;
+static const int timeout = 60000;
+
+// Accepts connections and discards what it reads. Every time a connection
+// has received ackInterval bytes, it writes a single byte back.
+class SinkServer : public QTcpServer
+{
+    Q_OBJECT
+public:
+    SinkServer(bool tls, qint64 ackInterval)
+        : tls(tls), ackInterval(ackInterval)
+    {
+    }
+
+    Q_INVOKABLE quint16 start()
+    {
+        return listen(QHostAddress::LocalHost) ? serverPort() : quint16(0);
+    }
+
+protected:
+    void incomingConnection(qintptr socketDescriptor) override
+    {
+        QTcpSocket *socket;
+#ifndef QT_NO_SSL
+        if (tls) {
+            QSslSocket *sslSocket = new QSslSocket(this);
+            setupServerSocket(sslSocket);
+            sslSocket->setSocketDescriptor(socketDescriptor);
+            sslSocket->startServerEncryption();
+            socket = sslSocket;
+        } else
+#endif
+        {
+            socket = new QTcpSocket(this);
+            socket->setSocketDescriptor(socketDescriptor);
+        }
+        received.insert(socket, 0);
+        connect(socket, &QTcpSocket::readyRead, this, &SinkServer::readData);
+        connect(socket, &QTcpSocket::disconnected, this, &SinkServer::dropConnection);
+    }
+
+private slots:
+    void readData()
+    {
+        QTcpSocket *socket = static_cast<QTcpSocket *>(sender());
+        char buffer[64 * 1024];
+        qint64 &count = received[socket];
+        qint64 read;
+        while ((read = socket->read(buffer, sizeof buffer)) > 0) {
+            count += read;
+            if (ackInterval && count >= ackInterval) {
+                count -= ackInterval;
+                socket->write("A", 1);
+            }
+        }
+    }
+
+    void dropConnection()
+    {
+        QTcpSocket *socket = static_cast<QTcpSocket *>(sender());
+        received.remove(socket);
+        socket->deleteLater();
+    }
+
+private:
+    QHash<QTcpSocket *, qint64> received;
+    bool tls;
+    qint64 ackInterval;
+};
+
+// Sends every datagram back to where it came from.
+class UdpEchoServer : public QObject
+{
+    Q_OBJECT
+public:
+    Q_INVOKABLE quint16 start()
+    {
+        socket = new QUdpSocket(this);
+        if (!socket->bind(QHostAddress(QHostAddress::LocalHost)))
+            return 0;
+        connect(socket, &QUdpSocket::readyRead, this, &UdpEchoServer::echo);
+        return socket->localPort();
+    }
+
+private slots:
+    void echo()
+    {
+        QByteArray datagram;
+        QHostAddress sender;
+        quint16 senderPort;
+        while (socket->hasPendingDatagrams()) {
+            datagram.resize(int(socket->pendingDatagramSize()));
+            const qint64 size = socket->readDatagram(datagram.data(), datagram.size(),
+                                                     &sender, &senderPort);
+            if (size >= 0)
+                socket->writeDatagram(datagram.constData(), size, sender, senderPort);
+        }
+    }
+
+private:
+    QUdpSocket *socket = nullptr;
+};
+
+class tst_SocketThroughput : public QObject
+{
+    Q_OBJECT
+
+public:
+    tst_SocketThroughput();
+    ~tst_SocketThroughput();
+
+private slots:
+    void initTestCase();
+    void tcpThroughput_data();
+    void tcpThroughput();
+    void connectLatency_data();
+    void connectLatency();
+    void udpPacketRate_data();
+    void udpPacketRate();
+
+private:
+    void addTlsColumnRows(const QVector<int> &counts, const char *countName);
+    template <typename Server>
+    quint16 startServer(Server *server);
+    void stopServer(QObject *server);
+    QTcpSocket *newClient(bool tls);
+    void connectClient(QTcpSocket *socket, quint16 port, bool tls);
+
+    ServerThread serverThread;
+    // Lives in serverThread, to run code there
+    QObject serverContext;
+    bool tlsAvailable = false;
+};
+
+tst_SocketThroughput::tst_SocketThroughput()
+{
+    serverContext.moveToThread(&serverThread);
+    serverThread.start();
+}
+
+tst_SocketThroughput::~tst_SocketThroughput()
+{
+    serverThread.quit();
+    serverThread.wait();
+}
+
+void tst_SocketThroughput::initTestCase()
+{
+#ifndef QT_NO_SSL
+    QSslSocket socket;
+    tlsAvailable = QSslSocket::supportsSsl() && setupServerSocket(&socket);
+#endif
+    if (!tlsAvailable)
+        qDebug("TLS rows are skipped, no TLS support or no test certificate");
+}
+
+template <typename Server>
+quint16 tst_SocketThroughput::startServer(Server *server)
+{
+    server->moveToThread(&serverThread);
+    quint16 port = 0;
+    QMetaObject::invokeMethod(server, "start", Qt::BlockingQueuedConnection,
+                              Q_RETURN_ARG(quint16, port));
+    return port;
+}
+
+void tst_SocketThroughput::stopServer(QObject *server)
+{
+    // Make sure the server and its connections are gone before the next row
+    QMetaObject::invokeMethod(&serverContext, [server] { delete server; },
+                              Qt::BlockingQueuedConnection);
+}
+
+QTcpSocket *tst_SocketThroughput::newClient(bool tls)
+{
+#ifndef QT_NO_SSL
+    if (tls) {
+        QSslSocket *socket = new QSslSocket(this);
+        socket->setPeerVerifyMode(QSslSocket::VerifyNone);
+        return socket;
+    }
+#else
+    Q_UNUSED(tls);
+#endif
+    return new QTcpSocket(this);
+}
+
+void tst_SocketThroughput::connectClient(QTcpSocket *socket, quint16 port, bool tls)
+{
+#ifndef QT_NO_SSL
+    if (tls) {
+        static_cast<QSslSocket *>(socket)->connectToHostEncrypted(QStringLiteral("127.0.0.1"), port);
+        return;
+    }
+#else
+    Q_UNUSED(tls);
+#endif
+    socket->connectToHost(QHostAddress::LocalHost, port);
+}
+
+void tst_SocketThroughput::addTlsColumnRows(const QVector<int> &counts, const char *countName)
+{
+    for (bool tls : { false, true }) {
+        for (int count : counts) {
+            QTest::newRow(qPrintable(QStringLiteral("%1-%2%3")
+                                     .arg(QLatin1String(tls ? "tls" : "plain"))
+                                     .arg(count).arg(QLatin1String(countName))))
+                    << count << tls;
+        }
+    }
+}
+
+void tst_SocketThroughput::tcpThroughput_data()
+{
+    QTest::addColumn<int>("connections");
+    QTest::addColumn<int>("payloadSize");
+    QTest::addColumn<bool>("tls");
+
+    for (bool tls : { false, true }) {
+        for (int connections : { 1, 8, 64 }) {
+            for (int payloadSize : { 1024, 64 * 1024, 1024 * 1024 }) {
+                QTest::newRow(qPrintable(QStringLiteral("%1-%2conn-%3KB")
+                                         .arg(QLatin1String(tls ? "tls" : "plain"))
+                                         .arg(connections).arg(payloadSize / 1024)))
+                        << connections << payloadSize << tls;
+            }
+        }
+    }
+}
+
+void tst_SocketThroughput::tcpThroughput()
+{
+    QFETCH(int, connections);
+    QFETCH(int, payloadSize);
+    QFETCH(bool, tls);
+
+    if (tls && !tlsAvailable)
+        QSKIP("TLS is not available");
+
+    const qint64 writesPerConnection = qMax<qint64>(1, tcpTransferSize / connections / payloadSize);
+    const qint64 bytesPerConnection = writesPerConnection * payloadSize;
+    SinkServer *server = new SinkServer(tls, bytesPerConnection);
+    const quint16 port = startServer(server);
+    QVERIFY(port);
+
+    QVector<QTcpSocket *> clients;
+    for (int i = 0; i < connections; ++i) {
+        QTcpSocket *client = newClient(tls);
+        connectClient(client, port, tls);
+        clients.append(client);
+    }
+    for (QTcpSocket *client : qAsConst(clients)) {
+#ifndef QT_NO_SSL
+        if (tls)
+            QVERIFY2(static_cast<QSslSocket *>(client)->waitForEncrypted(timeout),
+                     qPrintable(client->errorString()));
+        else
+#endif
+            QVERIFY2(client->waitForConnected(timeout), qPrintable(client->errorString()));
+    }
+
+    const QByteArray payload(payloadSize, 'x');
+    QEventLoop loop;
+    QHash<QTcpSocket *, qint64> writes;
+    int pendingAcks = connections;
+    // Keep a few payloads queued per connection so the socket never idles,
+    // without buffering the whole transfer in user space
+    auto writeMore = [&](QTcpSocket *client) {
+        qint64 &done = writes[client];
+        while (done < writesPerConnection && client->bytesToWrite() < 4 * payloadSize) {
+            client->write(payload);
+            ++done;
+        }
+    };
+    for (QTcpSocket *client : qAsConst(clients)) {
+        connect(client, &QTcpSocket::bytesWritten, &loop, [&, client] { writeMore(client); });
+        connect(client, &QTcpSocket::readyRead, &loop, [&, client] {
+            client->readAll();
+            if (--pendingAcks == 0)
+                loop.quit();
+        });
+    }
+    QTimer::singleShot(timeout, &loop, &QEventLoop::quit);
+
+    const quint64 allocationsBefore = allocationCount();
+    QElapsedTimer timer;
+    timer.start();
+    for (QTcpSocket *client : qAsConst(clients))
+        writeMore(client);
+    loop.exec();
+    const qint64 elapsed = timer.nsecsElapsed();
+    const quint64 allocations = allocationCount() - allocationsBefore;
+
+    QCOMPARE(pendingAcks, 0);
+    const qint64 bytes = bytesPerConnection * connections;
+    QTest::setBenchmarkResult(bytes * 1e9 / elapsed, QTest::BytesPerSecond);
+    reportThroughput("writes", writesPerConnection * connections, bytes, elapsed, allocations);
+
+    qDeleteAll(clients);
+    stopServer(server);
+}
+
+void tst_SocketThroughput::connectLatency_data()
+{
+    QTest::addColumn<int>("inFlight");
+    QTest::addColumn<bool>("tls");
+
+    addTlsColumnRows({ 1, 16, 64 }, "parallel");
+}
+
+void tst_SocketThroughput::connectLatency()
+{
+    QFETCH(int, inFlight);
+    QFETCH(bool, tls);
+
+    if (tls && !tlsAvailable)
+        QSKIP("TLS is not available");
+
+    SinkServer *server = new SinkServer(tls, 0);
+    const quint16 port = startServer(server);
+    QVERIFY(port);
+
+    QEventLoop loop;
+    LatencyRecorder latencies;
+    latencies.reserve(connectAttempts);
+    QElapsedTimer timer;
+    int started = 0;
+    int failed = 0;
+
+    std::function<void()> startConnection = [&] {
+        if (started == connectAttempts)
+            return;
+        ++started;
+        QTcpSocket *client = newClient(tls);
+        const qint64 startTime = timer.nsecsElapsed();
+        auto finish = [&, client, startTime](bool ok) {
+            if (ok)
+                latencies.addSample(timer.nsecsElapsed() - startTime);
+            else
+                ++failed;
+            client->disconnect(&loop);
+            client->abort();
+            client->deleteLater();
+            if (latencies.count() + failed == connectAttempts)
+                loop.quit();
+            else
+                startConnection();
+        };
+#ifndef QT_NO_SSL
+        if (tls)
+            connect(static_cast<QSslSocket *>(client), &QSslSocket::encrypted, &loop, [finish] { finish(true); });
+        else
+#endif
+            connect(client, &QTcpSocket::connected, &loop, [finish] { finish(true); });
+        connect(client, QOverload<QAbstractSocket::SocketError>::of(&QAbstractSocket::error),
+                &loop, [finish] { finish(false); });
+        connectClient(client, port, tls);
+    };
+    QTimer::singleShot(timeout, &loop, &QEventLoop::quit);
+
+    const quint64 allocationsBefore = allocationCount();
+    timer.start();
+    for (int i = 0; i < inFlight; ++i)
+        startConnection();
+    loop.exec();
+    const qint64 elapsed = timer.nsecsElapsed();
+    const quint64 allocations = allocationCount() - allocationsBefore;
+
+    QCOMPARE(failed, 0);
+    QCOMPARE(latencies.count(), connectAttempts);
+    QTest::setBenchmarkResult(latencies.percentile(50), QTest::WalltimeNanoseconds);
+    reportThroughput("connections", connectAttempts, 0, elapsed, allocations);
+    latencies.report();
+
+    stopServer(server);
+}
+
+void tst_SocketThroughput::udpPacketRate_data()
+{
+    QTest::addColumn<int>("window");
+    QTest::addColumn<int>("payloadSize");
+
+    for (int window : { 1, 16, 64 }) {
+        for (int payloadSize : { 64, 512, 1400 }) {
+            QTest::newRow(qPrintable(QStringLiteral("%1window-%2B").arg(window).arg(payloadSize)))
+                    << window << payloadSize;
+        }
+    }
+}
+
+void tst_SocketThroughput::udpPacketRate()
+{
+    QFETCH(int, window);
+    QFETCH(int, payloadSize);
+
+    UdpEchoServer *server = new UdpEchoServer;
+    const quint16 port = startServer(server);
+    QVERIFY(port);
+
+    QUdpSocket client;
+    QVERIFY(client.bind(QHostAddress(QHostAddress::LocalHost)));
+
+    // Each datagram carries its sequence number, so the round trip time can
+    // be matched up with the send time
+    QVector<qint64> sendTimes(udpDatagrams);
+    QByteArray datagram(payloadSize, 'x');
+    LatencyRecorder latencies;
+    latencies.reserve(udpDatagrams);
+    QElapsedTimer timer;
+    QEventLoop loop;
+    int sent = 0;
+
+    auto sendNext = [&] {
+        if (sent == udpDatagrams)
+            return;
+        const qint32 sequence = sent++;
+        memcpy(datagram.data(), &sequence, sizeof sequence);
+        sendTimes[sequence] = timer.nsecsElapsed();
+        client.writeDatagram(datagram, QHostAddress::LocalHost, port);
+    };
+    QByteArray buffer(payloadSize, Qt::Uninitialized);
+    connect(&client, &QUdpSocket::readyRead, &loop, [&] {
+        while (client.hasPendingDatagrams()) {
+            if (client.readDatagram(buffer.data(), buffer.size()) != payloadSize)
+                continue;
+            qint32 sequence;
+            memcpy(&sequence, buffer.constData(), sizeof sequence);
+            if (sequence >= 0 && sequence < sent)
+                latencies.addSample(timer.nsecsElapsed() - sendTimes.at(sequence));
+            sendNext();
+        }
+        if (latencies.count() == udpDatagrams)
+            loop.quit();
+    });
+    QTimer::singleShot(timeout, &loop, &QEventLoop::quit);
+
+    const quint64 allocationsBefore = allocationCount();
+    timer.start();
+    for (int i = 0; i < window; ++i)
+        sendNext();
+    loop.exec();
+    const qint64 elapsed = timer.nsecsElapsed();
+    const quint64 allocations = allocationCount() - allocationsBefore;
+
+    // Loopback should not drop datagrams, but if it does, the window
+    // shrinks and the run ends at the timeout
+    if (latencies.count() != udpDatagrams)
+        qWarning("%d of %d datagrams lost", udpDatagrams - latencies.count(), udpDatagrams);
+    QVERIFY(latencies.count() > 0);
+    const qint64 bytes = qint64(latencies.count()) * payloadSize;
+    QTest::setBenchmarkResult(bytes * 1e9 / elapsed, QTest::BytesPerSecond);
+    reportThroughput("datagrams", latencies.count(), bytes, elapsed, allocations);
+    latencies.report();
+
+    stopServer(server);
+}
+
+QTEST_MAIN(tst_SocketThroughput)
+#include "tst_bench_socketthroughput.moc"
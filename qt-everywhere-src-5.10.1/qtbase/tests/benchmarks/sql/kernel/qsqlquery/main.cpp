@@ -52,6 +52,8 @@ private slots:
     void benchmark();
     void benchmarkSelectPrepared_data() { generic_data(); }
     void benchmarkSelectPrepared();
+    void benchmarkBatchInsert_data() { generic_data(); }
+    void benchmarkBatchInsert();
 
 private:
     // returns all database connections
@@ -299,4 +301,40 @@ void tst_QSqlQuery::benchmarkSelectPrepared()
     tst_Databases::safeDropTable(db, tableName);
 }
 
+void tst_QSqlQuery::benchmarkBatchInsert()
+{
+    QFETCH(QString, dbName);
+    QSqlDatabase db = QSqlDatabase::database(dbName);
+    CHECK_DATABASE(db);
+
+    QSqlQuery q(db);
+    const QString tableName(qTableName("benchmark", __FILE__, db));
+
+    tst_Databases::safeDropTable(db, tableName);
+
+    QVERIFY_SQL(q, exec("CREATE TABLE " + tableName + "(id INT NOT NULL, txt VARCHAR(20))"));
+
+    const int NUM_ROWS = 10000;
+    QVariantList ids;
+    QVariantList texts;
+    for (int i = 0; i < NUM_ROWS; ++i) {
+        ids << i;
+        texts << QString("Value%1").arg(i);
+    }
+
+    QBENCHMARK {
+        QVERIFY_SQL(q, exec("DELETE FROM " + tableName));
+        QVERIFY_SQL(q, prepare("INSERT INTO " + tableName + " VALUES (?, ?)"));
+        q.addBindValue(ids);
+        q.addBindValue(texts);
+        QVERIFY_SQL(q, execBatch());
+    }
+
+    QVERIFY_SQL(q, exec("SELECT COUNT(*) FROM " + tableName));
+    QVERIFY(q.next());
+    QCOMPARE(q.value(0).toInt(), NUM_ROWS);
+
+    tst_Databases::safeDropTable(db, tableName);
+}
+
 #include "main.moc"
@@ -0,0 +1,5 @@
+TEMPLATE = app
+TARGET = benchmarkcompare
+SOURCES += main.cpp
+QT = core
+CONFIG += console
@@ -0,0 +1,195 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the utils of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMap>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+#include <QtCore/qmath.h>
+
+#include <stdio.h>
+
+struct Sample
+{
+    QString metric;
+    QVector<double> values;
+
+    double mean() const
+    {
+        double sum = 0;
+        for (double value : values)
+            sum += value;
+        return sum / values.count();
+    }
+
+    double variance() const
+    {
+        if (values.count() < 2)
+            return 0;
+        const double m = mean();
+        double squares = 0;
+        for (double value : values)
+            squares += (value - m) * (value - m);
+        return squares / (values.count() - 1);
+    }
+};
+
+// Two-sided 95% quantiles of Student's t distribution
+static double tQuantile95(double degreesOfFreedom)
+{
+    static const double table[] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+    const int df = qFloor(degreesOfFreedom);
+    if (df < 1)
+        return table[0];
+    if (df <= int(sizeof(table) / sizeof(table[0])))
+        return table[df - 1];
+    return 1.96;
+}
+
+static bool higherIsBetter(const QString &metric)
+{
+    return metric.endsWith(QLatin1String("PerSecond"));
+}
+
+static bool load(const QString &fileName, QMap<QString, Sample> *results)
+{
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        fprintf(stderr, "Cannot open %s: %s\n", qPrintable(fileName), qPrintable(file.errorString()));
+        return false;
+    }
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(file.readAll(), &error);
+    if (error.error != QJsonParseError::NoError) {
+        fprintf(stderr, "%s: %s\n", qPrintable(fileName), qPrintable(error.errorString()));
+        return false;
+    }
+
+    const QJsonArray benchmarks = document.object().value(QLatin1String("benchmarks")).toArray();
+    for (const QJsonValue &value : benchmarks) {
+        const QJsonObject benchmark = value.toObject();
+        QString key = benchmark.value(QLatin1String("function")).toString();
+        const QString tag = benchmark.value(QLatin1String("tag")).toString();
+        if (!tag.isEmpty())
+            key += QLatin1Char(':') + tag;
+
+        Sample sample;
+        sample.metric = benchmark.value(QLatin1String("metric")).toString();
+        const QJsonArray values = benchmark.value(QLatin1String("samples")).toArray();
+        for (const QJsonValue &v : values)
+            sample.values.append(v.toDouble());
+        if (sample.values.isEmpty())
+            sample.values.append(benchmark.value(QLatin1String("value")).toDouble());
+        results->insert(key, sample);
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QStringList args = app.arguments().mid(1);
+    double threshold = 5;
+    if (args.count() == 4 && args.at(0) == QLatin1String("-threshold")) {
+        threshold = args.at(1).toDouble();
+        args = args.mid(2);
+    }
+    if (args.count() != 2) {
+        printf("Usage: ./benchmarkcompare [-threshold percent] baseline.json current.json\n"
+               "Compares two benchmark result files written with -o file,json and\n"
+               "reports the benchmarks that got significantly worse.\n");
+        return 2;
+    }
+
+    QMap<QString, Sample> baseline;
+    QMap<QString, Sample> current;
+    if (!load(args.at(0), &baseline) || !load(args.at(1), &current))
+        return 2;
+
+    int regressions = 0;
+    for (auto it = current.cbegin(), end = current.cend(); it != end; ++it) {
+        const Sample &after = it.value();
+        const auto found = baseline.constFind(it.key());
+        if (found == baseline.cend() || found->metric != after.metric) {
+            printf("new         %s\n", qPrintable(it.key()));
+            continue;
+        }
+        const Sample &before = found.value();
+
+        const double oldMean = before.mean();
+        const double newMean = after.mean();
+        const double change = oldMean != 0 ? 100 * (newMean - oldMean) / oldMean : 0;
+        // positive if it got worse
+        const double loss = higherIsBetter(after.metric) ? -change : change;
+
+        // Welch's t-test, which does not assume equal variances
+        const char *verdict = "ok";
+        const int n1 = before.values.count();
+        const int n2 = after.values.count();
+        if (n1 < 2 || n2 < 2) {
+            verdict = "untested";
+        } else {
+            const double v1 = before.variance() / n1;
+            const double v2 = after.variance() / n2;
+            const double error = qSqrt(v1 + v2);
+            bool significant;
+            if (error == 0) {
+                significant = oldMean != newMean;
+            } else {
+                const double t = qAbs(newMean - oldMean) / error;
+                const double df = (v1 + v2) * (v1 + v2)
+                        / (v1 * v1 / (n1 - 1) + v2 * v2 / (n2 - 1));
+                significant = t > tQuantile95(df);
+            }
+            if (significant && loss > threshold) {
+                verdict = "REGRESSION";
+                ++regressions;
+            } else if (significant && loss < -threshold) {
+                verdict = "improved";
+            }
+        }
+
+        printf("%-11s %s: %g -> %g %s (%+.1f%%)\n", verdict, qPrintable(it.key()),
+               oldMean, newMean, qPrintable(after.metric), change);
+    }
+
+    for (auto it = baseline.cbegin(), end = baseline.cend(); it != end; ++it) {
+        if (!current.contains(it.key()))
+            printf("missing     %s\n", qPrintable(it.key()));
+    }
+
+    return regressions ? 1 : 0;
+}
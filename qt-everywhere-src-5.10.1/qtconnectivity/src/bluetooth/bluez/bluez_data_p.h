@@ -384,6 +384,7 @@ enum OpCodeCommandField {
     OcfLeClearWhiteList = 0x10,
     OcfLeAddToWhiteList = 0x11,
     OcfLeConnectionUpdate = 0x13,
+    OcfLeSetDataLength = 0x22,
 };
 
 /* Command opcode pack/unpack */
@@ -376,6 +376,24 @@ bool HciManager::sendConnectionUpdateCommand(quint16 handle,
     return sendCommand(OgfLinkControl, OcfLeConnectionUpdate, data);
 }
 
+// Data length extension, Spec v4.2, Vol 2, Part E, 7.8.33
+bool HciManager::sendDataLengthCommand(quint16 handle, quint16 txOctets)
+{
+    struct CommandParams {
+        quint16 handle;
+        quint16 txOctets;
+        quint16 txTime;
+    } __attribute__ ((packed)) commandParams;
+    txOctets = qBound<quint16>(27, txOctets, 251);
+    commandParams.handle = qToLittleEndian(handle);
+    commandParams.txOctets = qToLittleEndian(txOctets);
+    // Transmission time of a packet with txOctets payload on the 1M PHY
+    commandParams.txTime = qToLittleEndian(quint16((txOctets + 14) * 8));
+    const QByteArray data = QByteArray::fromRawData(reinterpret_cast<char *>(&commandParams),
+                                                    sizeof commandParams);
+    return sendCommand(OgfLinkControl, OcfLeSetDataLength, data);
+}
+
 bool HciManager::sendConnectionParameterUpdateRequest(quint16 handle,
                                                       const QLowEnergyConnectionParameters &params)
 {
@@ -89,6 +89,7 @@ public:
     bool sendConnectionUpdateCommand(quint16 handle, const QLowEnergyConnectionParameters &params);
     bool sendConnectionParameterUpdateRequest(quint16 handle,
                                               const QLowEnergyConnectionParameters &params);
+    bool sendDataLengthCommand(quint16 handle, quint16 txOctets);
 
 signals:
     void encryptionChangedEvent(const QBluetoothAddress &address, bool wasSuccess);
@@ -266,6 +266,18 @@ Q_DECLARE_LOGGING_CATEGORY(QT_BT)
     \sa requestConnectionUpdate()
 */
 
+/*!
+    \fn void QLowEnergyController::mtuChanged(int mtu)
+
+    This signal is emitted when the maximum transmission unit (MTU) of the
+    connection changes, usually right after the connection was established
+    and the MTU was negotiated with the remote device. The new value is
+    passed as \a mtu.
+
+    \since 5.11
+    \sa mtu()
+*/
+
 
 void registerQLowEnergyControllerMetaType()
 {
@@ -1028,6 +1040,24 @@ void QLowEnergyController::requestConnectionUpdate(const QLowEnergyConnectionPar
     }
 }
 
+/*!
+    Returns the maximum transmission unit (MTU) of the attribute protocol
+    for the current connection, in bytes. A characteristic value that is
+    written without response must not be larger than the MTU minus 3 bytes.
+
+    The MTU is negotiated when the connection is established. Until then,
+    and on platforms which do not expose it, \c -1 is returned.
+
+    \note Currently, this functionality is only implemented on Linux.
+
+    \sa mtuChanged()
+    \since 5.11
+ */
+int QLowEnergyController::mtu() const
+{
+    return d_ptr->mtu();
+}
+
 /*!
     Returns the last occurred error or \l NoError.
 */
@@ -132,6 +132,7 @@ public:
     QLowEnergyService *addService(const QLowEnergyServiceData &service, QObject *parent = nullptr);
 
     void requestConnectionUpdate(const QLowEnergyConnectionParameters &parameters);
+    int mtu() const;
 
     Error error() const;
     QString errorString() const;
@@ -147,6 +148,7 @@ Q_SIGNALS:
     void serviceDiscovered(const QBluetoothUuid &newService);
     void discoveryFinished();
     void connectionUpdated(const QLowEnergyConnectionParameters &parameters);
+    void mtuChanged(int mtu);
 
 private:
     explicit QLowEnergyController(QObject *parent = nullptr); // For the peripheral role.
@@ -1053,6 +1053,12 @@ void QLowEnergyControllerPrivate::requestConnectionUpdate(const QLowEnergyConnec
         qCWarning(QT_BT_ANDROID) << "Cannot set connection update priority";
 }
 
+int QLowEnergyControllerPrivate::mtu() const
+{
+    // Android negotiates the MTU in BluetoothGatt.requestMtu(), which is not used yet
+    return -1;
+}
+
 /*
  * Returns the Java char permissions based on the given characteristic data.
  */
@@ -51,6 +51,7 @@
 #include <QtCore/QFileInfo>
 #include <QtCore/QLoggingCategory>
 #include <QtCore/QSettings>
+#include <QtCore/QSocketNotifier>
 #include <QtCore/QTimer>
 #include <QtBluetooth/QBluetoothLocalDevice>
 #include <QtBluetooth/QBluetoothSocket>
@@ -68,7 +69,8 @@
 #include <unistd.h>
 
 #define ATT_DEFAULT_LE_MTU 23
-#define ATT_MAX_LE_MTU 0x200
+#define ATT_MAX_LE_MTU 517 // largest attribute value (512) plus header
+#define LE_MAX_DATA_LENGTH 251
 
 #define GATT_PRIMARY_SERVICE    quint16(0x2800)
 #define GATT_SECONDARY_SERVICE  quint16(0x2801)
@@ -294,6 +296,11 @@ void QLowEnergyControllerPrivate::init()
     connect(hciManager, &HciManager::connectionComplete, [this](quint16 handle) {
         connectionHandle = handle;
         qCDebug(QT_BT_BLUEZ) << "received connection complete event, handle:" << handle;
+        // Ask for the largest link layer packets, so that an ATT packet of the
+        // negotiated MTU is not fragmented into many 27 byte packets. Controllers
+        // without data length extension reject the command, which is harmless.
+        if (!hciManager->sendDataLengthCommand(handle, LE_MAX_DATA_LENGTH))
+            qCDebug(QT_BT_BLUEZ) << "cannot request data length extension";
     });
     connect(hciManager, &HciManager::connectionUpdate,
             [this](quint16 handle, const QLowEnergyConnectionParameters &params) {
@@ -522,6 +529,16 @@ void QLowEnergyControllerPrivate::requestConnectionUpdate(const QLowEnergyConnec
         hciManager->sendConnectionParameterUpdateRequest(connectionHandle, params);
 }
 
+int QLowEnergyControllerPrivate::mtu() const
+{
+    if (state == QLowEnergyController::UnconnectedState
+            || state == QLowEnergyController::ConnectingState
+            || state == QLowEnergyController::AdvertisingState) {
+        return -1;
+    }
+    return mtuSize;
+}
+
 void QLowEnergyControllerPrivate::connectToDevice()
 {
     if (remoteDevice.isNull()) {
@@ -794,6 +811,10 @@ void QLowEnergyControllerPrivate::resetController()
 {
     openRequests.clear();
     openPrepareWriteRequests.clear();
+    pendingPackets.clear();
+    delete writeNotifier;
+    writeNotifier = nullptr;
+    mtuSize = ATT_DEFAULT_LE_MTU;
     scheduledIndications.clear();
     indicationInFlight = false;
     requestPending = false;
@@ -963,12 +984,35 @@ void QLowEnergyControllerPrivate::encryptionChangedEvent(
     sendNextPendingRequest();
 }
 
+/*
+    Writes without response and notifications are not acknowledged by the
+    remote device, so many of them can be sent back to back. Once the socket's
+    send buffer is full, further packets are queued in pendingPackets and sent
+    as soon as the socket becomes writable again, instead of being dropped.
+    Other packets are queued behind them to keep the order intact.
+*/
 void QLowEnergyControllerPrivate::sendPacket(const QByteArray &packet)
+{
+    if (pendingPackets.isEmpty() && writePacket(packet))
+        return;
+
+    pendingPackets.enqueue(packet);
+    if (!writeNotifier) {
+        writeNotifier = new QSocketNotifier(l2cpSocket->socketDescriptor(),
+                                            QSocketNotifier::Write, this);
+        connect(writeNotifier, &QSocketNotifier::activated,
+                this, &QLowEnergyControllerPrivate::flushPendingPackets);
+    }
+    writeNotifier->setEnabled(true);
+}
+
+// Returns false if the packet must be retried because the send buffer is full
+bool QLowEnergyControllerPrivate::writePacket(const QByteArray &packet)
 {
     qint64 result = l2cpSocket->write(packet.constData(),
                                       packet.size());
-    // We ignore result == 0 which is likely to be caused by EAGAIN.
-    // This packet is effectively discarded but the controller can still recover
+    if (result == 0) // EAGAIN
+        return false;
 
     if (result == -1) {
         qCDebug(QT_BT_BLUEZ) << "Cannot write L2CP packet:" << hex
@@ -979,7 +1023,18 @@ void QLowEnergyControllerPrivate::sendPacket(const QByteArray &packet)
         qCWarning(QT_BT_BLUEZ) << "L2CP write request incomplete:"
                                << result << "of" << packet.size();
     }
+    return true;
+}
 
+void QLowEnergyControllerPrivate::flushPendingPackets()
+{
+    while (!pendingPackets.isEmpty()) {
+        if (!l2cpSocket || !writePacket(pendingPackets.head()))
+            return;
+        pendingPackets.dequeue();
+    }
+    if (writeNotifier)
+        writeNotifier->setEnabled(false);
 }
 
 void QLowEnergyControllerPrivate::sendNextPendingRequest()
@@ -1068,15 +1123,14 @@ void QLowEnergyControllerPrivate::processReply(
     {
         Q_ASSERT(request.command == ATT_OP_EXCHANGE_MTU_REQUEST);
         if (isErrorResponse) {
-            mtuSize = ATT_DEFAULT_LE_MTU;
+            setMtu(ATT_DEFAULT_LE_MTU);
             break;
         }
 
+        // Both sides use the smaller of the two MTUs
         const char *data = response.constData();
         quint16 mtu = bt_get_le16(&data[1]);
-        mtuSize = mtu;
-        if (mtuSize < ATT_DEFAULT_LE_MTU)
-            mtuSize = ATT_DEFAULT_LE_MTU;
+        setMtu(qBound<quint16>(ATT_DEFAULT_LE_MTU, mtu, ATT_MAX_LE_MTU));
 
         qCDebug(QT_BT_BLUEZ) << "Server MTU:" << mtu << "resulting mtu:" << mtuSize;
     }
@@ -1860,6 +1914,15 @@ void QLowEnergyControllerPrivate::exchangeMTU()
     sendNextPendingRequest();
 }
 
+void QLowEnergyControllerPrivate::setMtu(quint16 newMtu)
+{
+    Q_Q(QLowEnergyController);
+    if (mtuSize == newMtu)
+        return;
+    mtuSize = newMtu;
+    emit q->mtuChanged(mtuSize);
+}
+
 int QLowEnergyControllerPrivate::securityLevel() const
 {
     int socket = l2cpSocket->socketDescriptor();
@@ -2272,7 +2335,7 @@ void QLowEnergyControllerPrivate::handleExchangeMtuRequest(const QByteArray &pac
 
     // Apply requested MTU.
     const quint16 clientRxMtu = bt_get_le16(packet.constData() + 1);
-    mtuSize = qMax<quint16>(ATT_DEFAULT_LE_MTU, qMin<quint16>(clientRxMtu, ATT_MAX_LE_MTU));
+    setMtu(qMax<quint16>(ATT_DEFAULT_LE_MTU, qMin<quint16>(clientRxMtu, ATT_MAX_LE_MTU)));
     qCDebug(QT_BT_BLUEZ) << "MTU request from client:" << clientRxMtu
                          << "effective client RX MTU:" << mtuSize;
     qCDebug(QT_BT_BLUEZ) << "Sending server RX MTU" << ATT_MAX_LE_MTU;
@@ -1380,6 +1380,11 @@ void QLowEnergyController::requestConnectionUpdate(const QLowEnergyConnectionPar
     qCWarning(QT_BT_OSX) << "Connection update not implemented on your platform";
 }
 
+int QLowEnergyController::mtu() const
+{
+    return -1;
+}
+
 QT_END_NAMESPACE
 
 #include "moc_qlowenergycontroller_osx_p.cpp"
@@ -136,6 +136,11 @@ void QLowEnergyControllerPrivate::requestConnectionUpdate(const QLowEnergyConnec
 {
 }
 
+int QLowEnergyControllerPrivate::mtu() const
+{
+    return -1;
+}
+
 void QLowEnergyControllerPrivate::addToGenericAttributeList(const QLowEnergyServiceData &/* service */,
                                                             QLowEnergyHandle /* startHandle */)
 {
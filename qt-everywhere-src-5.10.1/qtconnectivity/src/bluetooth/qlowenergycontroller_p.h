@@ -139,6 +139,7 @@ public:
     void stopAdvertising();
 
     void requestConnectionUpdate(const QLowEnergyConnectionParameters &params);
+    int mtu() const;
 
     // misc helpers
     QSharedPointer<QLowEnergyServicePrivate> serviceForHandle(
@@ -225,6 +226,11 @@ private:
     };
     QQueue<Request> openRequests;
 
+    // Packets which did not fit into the socket's send buffer, in the order
+    // they have to be sent in. They are flushed once the socket is writable.
+    QQueue<QByteArray> pendingPackets;
+    QSocketNotifier *writeNotifier = nullptr;
+
     struct WriteRequest {
         WriteRequest() {}
         WriteRequest(quint16 h, quint16 o, const QByteArray &v)
@@ -316,6 +322,7 @@ private:
     QString keySettingsFilePath() const;
 
     void sendPacket(const QByteArray &packet);
+    bool writePacket(const QByteArray &packet);
     void sendNextPendingRequest();
     void processReply(const Request &request, const QByteArray &reply);
 
@@ -335,6 +342,7 @@ private:
                                 QLowEnergyHandle startingHandle);
     void processUnsolicitedReply(const QByteArray &msg);
     void exchangeMTU();
+    void setMtu(quint16 newMtu);
     bool setSecurityLevel(int level);
     int securityLevel() const;
     void sendExecuteWriteRequest(const QLowEnergyHandle attrHandle,
@@ -428,6 +436,7 @@ private slots:
     void encryptionChangedEvent(const QBluetoothAddress&, bool);
     void handleGattRequestTimeout();
     void activeConnectionTerminationDone();
+    void flushPendingPackets();
 #elif defined(QT_ANDROID_BLUETOOTH)
     LowEnergyNotificationHub *hub;
 
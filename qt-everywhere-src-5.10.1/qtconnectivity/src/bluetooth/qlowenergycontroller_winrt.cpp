@@ -690,6 +690,11 @@ void QLowEnergyControllerPrivate::requestConnectionUpdate(const QLowEnergyConnec
     Q_UNIMPLEMENTED();
 }
 
+int QLowEnergyControllerPrivate::mtu() const
+{
+    return -1;
+}
+
 void QLowEnergyControllerPrivate::readCharacteristic(const QSharedPointer<QLowEnergyServicePrivate> service,
                         const QLowEnergyHandle charHandle)
 {
@@ -561,6 +561,7 @@ void TestQLowEnergyControllerGattServer::controllerType()
     const QScopedPointer<QLowEnergyController> controller(QLowEnergyController::createPeripheral());
     QVERIFY(!controller.isNull());
     QCOMPARE(controller->role(), QLowEnergyController::PeripheralRole);
+    QCOMPARE(controller->mtu(), -1); // not connected
 }
 
 void TestQLowEnergyControllerGattServer::serviceData()
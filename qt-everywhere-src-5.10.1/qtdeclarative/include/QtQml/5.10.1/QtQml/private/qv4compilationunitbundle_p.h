@@ -0,0 +1 @@
+#include "../../../../../src/qml/compiler/qv4compilationunitbundle_p.h"
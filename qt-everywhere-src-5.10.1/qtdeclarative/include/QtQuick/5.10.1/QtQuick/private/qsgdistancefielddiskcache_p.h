@@ -0,0 +1 @@
+#include "../../../../../src/quick/scenegraph/util/qsgdistancefielddiskcache_p.h"
@@ -0,0 +1 @@
+#include "../../../../../src/quick/scenegraph/compressedtexture/qsgetcencoder_p.h"
@@ -0,0 +1 @@
+#include "../../../../../src/quick/util/qtquick_tracepoints_p.h"
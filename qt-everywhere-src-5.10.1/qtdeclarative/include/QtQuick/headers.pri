@@ -1,7 +1,7 @@
 SYNCQT.HEADER_FILES = qtquickglobal.h items/qquickframebufferobject.h items/qquickitem.h items/qquickitemgrabresult.h items/qquickpainteditem.h items/qquickrendercontrol.h items/qquicktextdocument.h items/qquickview.h items/qquickwindow.h util/qquickimageprovider.h scenegraph/coreapi/qsgabstractrenderer.h scenegraph/coreapi/qsggeometry.h scenegraph/coreapi/qsgmaterial.h scenegraph/coreapi/qsgnode.h scenegraph/coreapi/qsgrendererinterface.h scenegraph/coreapi/qsgrendernode.h scenegraph/util/qsgengine.h scenegraph/util/qsgflatcolormaterial.h scenegraph/util/qsgimagenode.h scenegraph/util/qsgninepatchnode.h scenegraph/util/qsgrectanglenode.h scenegraph/util/qsgsimplematerial.h scenegraph/util/qsgsimplerectnode.h scenegraph/util/qsgsimpletexturenode.h scenegraph/util/qsgtexture.h scenegraph/util/qsgtexturematerial.h scenegraph/util/qsgtextureprovider.h scenegraph/util/qsgvertexcolormaterial.h ../../include/QtQuick/qtquickversion.h ../../include/QtQuick/QtQuick 
 SYNCQT.INJECTED_HEADER_FILES = 
 SYNCQT.HEADER_CLASSES = ../../include/QtQuick/QQuickFramebufferObject ../../include/QtQuick/QQuickTransform ../../include/QtQuick/QQuickItem ../../include/QtQuick/QQuickItemGrabResult ../../include/QtQuick/QQuickPaintedItem ../../include/QtQuick/QQuickRenderControl ../../include/QtQuick/QQuickTextDocument ../../include/QtQuick/QQuickView ../../include/QtQuick/QQuickWindow ../../include/QtQuick/QQuickTextureFactory ../../include/QtQuick/QQuickImageResponse ../../include/QtQuick/QQuickImageProvider ../../include/QtQuick/QQuickAsyncImageProvider ../../include/QtQuick/QSGAbstractRenderer ../../include/QtQuick/QSGGeometry ../../include/QtQuick/QSGMaterialShader ../../include/QtQuick/QSGMaterialType ../../include/QtQuick/QSGMaterial ../../include/QtQuick/QSGNode ../../include/QtQuick/QSGBasicGeometryNode ../../include/QtQuick/QSGGeometryNode ../../include/QtQuick/QSGClipNode ../../include/QtQuick/QSGTransformNode ../../include/QtQuick/QSGRootNode ../../include/QtQuick/QSGOpacityNode ../../include/QtQuick/QSGNodeVisitor ../../include/QtQuick/QSGRendererInterface ../../include/QtQuick/QSGRenderNode ../../include/QtQuick/QSGEngine ../../include/QtQuick/QSGFlatColorMaterial ../../include/QtQuick/QSGImageNode ../../include/QtQuick/QSGNinePatchNode ../../include/QtQuick/QSGRectangleNode ../../include/QtQuick/QSGSimpleMaterialShader ../../include/QtQuick/QSGSimpleMaterial ../../include/QtQuick/QSGSimpleMaterialComparableMaterial ../../include/QtQuick/QSGSimpleRectNode ../../include/QtQuick/QSGSimpleTextureNode ../../include/QtQuick/QSGTexture ../../include/QtQuick/QSGDynamicTexture ../../include/QtQuick/QSGOpaqueTextureMaterial ../../include/QtQuick/QSGTextureMaterial ../../include/QtQuick/QSGTextureProvider ../../include/QtQuick/QSGVertexColorMaterial ../../include/QtQuick/QtQuickVersion 
-SYNCQT.PRIVATE_HEADER_FILES = qtquick2_p.h qtquickglobal_p.h accessible/qaccessiblequickitem_p.h accessible/qaccessiblequickview_p.h accessible/qquickaccessiblefactory_p.h designer/qqmldesignermetaobject_p.h designer/qquickdesignercustomobjectdata_p.h designer/qquickdesignercustomparserobject_p.h designer/qquickdesignersupport_p.h designer/qquickdesignersupportitems_p.h designer/qquickdesignersupportmetainfo_p.h designer/qquickdesignersupportproperties_p.h designer/qquickdesignersupportpropertychanges_p.h designer/qquickdesignersupportstates_p.h designer/qquickdesignerwindowmanager_p.h handlers/qquickdraghandler_p.h handlers/qquickhandlersmodule_p.h handlers/qquickmultipointhandler_p.h handlers/qquickpinchhandler_p.h handlers/qquickpointerdevicehandler_p.h handlers/qquickpointerhandler_p.h handlers/qquickpointhandler_p.h handlers/qquicksinglepointhandler_p.h handlers/qquicktaphandler_p.h items/qquickaccessibleattached_p.h items/qquickanchors_p.h items/qquickanchors_p_p.h items/qquickanimatedimage_p.h items/qquickanimatedimage_p_p.h items/qquickanimatedsprite_p.h items/qquickanimatedsprite_p_p.h items/qquickborderimage_p.h items/qquickborderimage_p_p.h items/qquickclipnode_p.h items/qquickdrag_p.h items/qquickdroparea_p.h items/qquickevents_p_p.h items/qquickflickable_p.h items/qquickflickable_p_p.h items/qquickflickablebehavior_p.h items/qquickflipable_p.h items/qquickfocusscope_p.h items/qquickgenericshadereffect_p.h items/qquickgraphicsinfo_p.h items/qquickgridview_p.h items/qquickimage_p.h items/qquickimage_p_p.h items/qquickimagebase_p.h items/qquickimagebase_p_p.h items/qquickimplicitsizeitem_p.h items/qquickimplicitsizeitem_p_p.h items/qquickitem_p.h items/qquickitemanimation_p.h items/qquickitemanimation_p_p.h items/qquickitemchangelistener_p.h items/qquickitemsmodule_p.h items/qquickitemview_p.h items/qquickitemview_p_p.h items/qquickitemviewtransition_p.h items/qquicklistview_p.h items/qquickloader_p.h items/qquickloader_p_p.h items/qquickmousearea_p.h items/qquickmousearea_p_p.h items/qquickmultipointtoucharea_p.h items/qquickopenglinfo_p.h items/qquickopenglshadereffect_p.h items/qquickopenglshadereffectnode_p.h items/qquickpainteditem_p.h items/qquickpathview_p.h items/qquickpathview_p_p.h items/qquickpincharea_p.h items/qquickpincharea_p_p.h items/qquickpositioners_p.h items/qquickpositioners_p_p.h items/qquickrectangle_p.h items/qquickrectangle_p_p.h items/qquickrendercontrol_p.h items/qquickrepeater_p.h items/qquickrepeater_p_p.h items/qquickscalegrid_p_p.h items/qquickscreen_p.h items/qquickshadereffect_p.h items/qquickshadereffectmesh_p.h items/qquickshadereffectsource_p.h items/qquicksprite_p.h items/qquickspriteengine_p.h items/qquickspritesequence_p.h items/qquickspritesequence_p_p.h items/qquickstateoperations_p.h items/qquicktext_p.h items/qquicktext_p_p.h items/qquicktextcontrol_p.h items/qquicktextcontrol_p_p.h items/qquicktextdocument_p.h items/qquicktextedit_p.h items/qquicktextedit_p_p.h items/qquicktextinput_p.h items/qquicktextinput_p_p.h items/qquicktextnode_p.h items/qquicktextnodeengine_p.h items/qquicktextutil_p.h items/qquicktranslate_p.h items/qquickview_p.h items/qquickwindow_p.h items/qquickwindowattached_p.h items/qquickwindowmodule_p.h scenegraph/qsgadaptationlayer_p.h scenegraph/qsgbasicglyphnode_p.h scenegraph/qsgbasicinternalimagenode_p.h scenegraph/qsgbasicinternalrectanglenode_p.h scenegraph/qsgcontext_p.h scenegraph/qsgcontextplugin_p.h scenegraph/qsgdefaultcontext_p.h scenegraph/qsgdefaultdistancefieldglyphcache_p.h scenegraph/qsgdefaultglyphnode_p.h scenegraph/qsgdefaultglyphnode_p_p.h scenegraph/qsgdefaultinternalimagenode_p.h scenegraph/qsgdefaultinternalrectanglenode_p.h scenegraph/qsgdefaultlayer_p.h scenegraph/qsgdefaultrendercontext_p.h scenegraph/qsgdefaultspritenode_p.h scenegraph/qsgdistancefieldglyphnode_p.h scenegraph/qsgdistancefieldglyphnode_p_p.h scenegraph/qsgrenderloop_p.h scenegraph/qsgthreadedrenderloop_p.h scenegraph/qsgwindowsrenderloop_p.h util/qquickanimation_p.h util/qquickanimation_p_p.h util/qquickanimationcontroller_p.h util/qquickanimator_p.h util/qquickanimator_p_p.h util/qquickanimatorcontroller_p.h util/qquickanimatorjob_p.h util/qquickapplication_p.h util/qquickbehavior_p.h util/qquickfontloader_p.h util/qquickfontmetrics_p.h util/qquickpath_p.h util/qquickpath_p_p.h util/qquickpathinterpolator_p.h util/qquickpixmapcache_p.h util/qquickprofiler_p.h util/qquickpropertychanges_p.h util/qquickshortcut_p.h util/qquicksmoothedanimation_p.h util/qquicksmoothedanimation_p_p.h util/qquickspringanimation_p.h util/qquickstate_p.h util/qquickstate_p_p.h util/qquickstatechangescript_p.h util/qquickstategroup_p.h util/qquickstyledtext_p.h util/qquicksvgparser_p.h util/qquicksystempalette_p.h util/qquicktextmetrics_p.h util/qquicktimeline_p_p.h util/qquicktransition_p.h util/qquicktransitionmanager_p_p.h util/qquickutilmodule_p.h util/qquickvalidator_p.h util/qquickvaluetypes_p.h items/context2d/qquickcanvascontext_p.h items/context2d/qquickcanvasitem_p.h items/context2d/qquickcontext2d_p.h items/context2d/qquickcontext2dcommandbuffer_p.h items/context2d/qquickcontext2dtexture_p.h items/context2d/qquickcontext2dtile_p.h scenegraph/compressedtexture/qsgpkmhandler_p.h scenegraph/coreapi/qsgabstractrenderer_p.h scenegraph/coreapi/qsgbatchrenderer_p.h scenegraph/coreapi/qsggeometry_p.h scenegraph/coreapi/qsgmaterialshader_p.h scenegraph/coreapi/qsgnode_p.h scenegraph/coreapi/qsgnodeupdater_p.h scenegraph/coreapi/qsgrenderer_p.h scenegraph/coreapi/qsgrendernode_p.h scenegraph/util/qsgareaallocator_p.h scenegraph/util/qsgatlastexture_p.h scenegraph/util/qsgdefaultimagenode_p.h scenegraph/util/qsgdefaultninepatchnode_p.h scenegraph/util/qsgdefaultpainternode_p.h scenegraph/util/qsgdefaultrectanglenode_p.h scenegraph/util/qsgdepthstencilbuffer_p.h scenegraph/util/qsgengine_p.h scenegraph/util/qsgshadersourcebuilder_p.h scenegraph/util/qsgtexture_p.h scenegraph/util/qsgtexturematerial_p.h scenegraph/util/qsgtexturereader_p.h scenegraph/adaptations/software/qsgabstractsoftwarerenderer_p.h scenegraph/adaptations/software/qsgsoftwareadaptation_p.h scenegraph/adaptations/software/qsgsoftwarecontext_p.h scenegraph/adaptations/software/qsgsoftwareglyphnode_p.h scenegraph/adaptations/software/qsgsoftwareinternalimagenode_p.h scenegraph/adaptations/software/qsgsoftwareinternalrectanglenode_p.h scenegraph/adaptations/software/qsgsoftwarelayer_p.h scenegraph/adaptations/software/qsgsoftwarepainternode_p.h scenegraph/adaptations/software/qsgsoftwarepixmaprenderer_p.h scenegraph/adaptations/software/qsgsoftwarepixmaptexture_p.h scenegraph/adaptations/software/qsgsoftwarepublicnodes_p.h scenegraph/adaptations/software/qsgsoftwarerenderablenode_p.h scenegraph/adaptations/software/qsgsoftwarerenderablenodeupdater_p.h scenegraph/adaptations/software/qsgsoftwarerenderer_p.h scenegraph/adaptations/software/qsgsoftwarerenderlistbuilder_p.h scenegraph/adaptations/software/qsgsoftwarerenderloop_p.h scenegraph/adaptations/software/qsgsoftwarespritenode_p.h scenegraph/adaptations/software/qsgsoftwarethreadedrenderloop_p.h 
+SYNCQT.PRIVATE_HEADER_FILES = qtquick2_p.h qtquickglobal_p.h accessible/qaccessiblequickitem_p.h accessible/qaccessiblequickview_p.h accessible/qquickaccessiblefactory_p.h designer/qqmldesignermetaobject_p.h designer/qquickdesignercustomobjectdata_p.h designer/qquickdesignercustomparserobject_p.h designer/qquickdesignersupport_p.h designer/qquickdesignersupportitems_p.h designer/qquickdesignersupportmetainfo_p.h designer/qquickdesignersupportproperties_p.h designer/qquickdesignersupportpropertychanges_p.h designer/qquickdesignersupportstates_p.h designer/qquickdesignerwindowmanager_p.h handlers/qquickdraghandler_p.h handlers/qquickhandlersmodule_p.h handlers/qquickmultipointhandler_p.h handlers/qquickpinchhandler_p.h handlers/qquickpointerdevicehandler_p.h handlers/qquickpointerhandler_p.h handlers/qquickpointhandler_p.h handlers/qquicksinglepointhandler_p.h handlers/qquicktaphandler_p.h items/qquickaccessibleattached_p.h items/qquickanchors_p.h items/qquickanchors_p_p.h items/qquickanimatedimage_p.h items/qquickanimatedimage_p_p.h items/qquickanimatedsprite_p.h items/qquickanimatedsprite_p_p.h items/qquickborderimage_p.h items/qquickborderimage_p_p.h items/qquickclipnode_p.h items/qquickdrag_p.h items/qquickdroparea_p.h items/qquickevents_p_p.h items/qquickflickable_p.h items/qquickflickable_p_p.h items/qquickflickablebehavior_p.h items/qquickflipable_p.h items/qquickfocusscope_p.h items/qquickgenericshadereffect_p.h items/qquickgraphicsinfo_p.h items/qquickgridview_p.h items/qquickimage_p.h items/qquickimage_p_p.h items/qquickimagebase_p.h items/qquickimagebase_p_p.h items/qquickimplicitsizeitem_p.h items/qquickimplicitsizeitem_p_p.h items/qquickitem_p.h items/qquickitemanimation_p.h items/qquickitemanimation_p_p.h items/qquickitemchangelistener_p.h items/qquickitemsmodule_p.h items/qquickitemview_p.h items/qquickitemview_p_p.h items/qquickitemviewtransition_p.h items/qquicklistview_p.h items/qquickloader_p.h items/qquickloader_p_p.h items/qquickmousearea_p.h items/qquickmousearea_p_p.h items/qquickmultipointtoucharea_p.h items/qquickopenglinfo_p.h items/qquickopenglshadereffect_p.h items/qquickopenglshadereffectnode_p.h items/qquickpainteditem_p.h items/qquickpathview_p.h items/qquickpathview_p_p.h items/qquickpincharea_p.h items/qquickpincharea_p_p.h items/qquickpositioners_p.h items/qquickpositioners_p_p.h items/qquickrectangle_p.h items/qquickrectangle_p_p.h items/qquickrendercontrol_p.h items/qquickrepeater_p.h items/qquickrepeater_p_p.h items/qquickscalegrid_p_p.h items/qquickscreen_p.h items/qquickshadereffect_p.h items/qquickshadereffectmesh_p.h items/qquickshadereffectsource_p.h items/qquicksprite_p.h items/qquickspriteengine_p.h items/qquickspritesequence_p.h items/qquickspritesequence_p_p.h items/qquickstateoperations_p.h items/qquicktext_p.h items/qquicktext_p_p.h items/qquicktextcontrol_p.h items/qquicktextcontrol_p_p.h items/qquicktextdocument_p.h items/qquicktextedit_p.h items/qquicktextedit_p_p.h items/qquicktextinput_p.h items/qquicktextinput_p_p.h items/qquicktextnode_p.h items/qquicktextnodeengine_p.h items/qquicktextutil_p.h items/qquicktranslate_p.h items/qquickview_p.h items/qquickwindow_p.h items/qquickwindowattached_p.h items/qquickwindowmodule_p.h scenegraph/qsgadaptationlayer_p.h scenegraph/qsgbasicglyphnode_p.h scenegraph/qsgbasicinternalimagenode_p.h scenegraph/qsgbasicinternalrectanglenode_p.h scenegraph/qsgcontext_p.h scenegraph/qsgcontextplugin_p.h scenegraph/qsgdefaultcontext_p.h scenegraph/qsgdefaultdistancefieldglyphcache_p.h scenegraph/qsgdefaultglyphnode_p.h scenegraph/qsgdefaultglyphnode_p_p.h scenegraph/qsgdefaultinternalimagenode_p.h scenegraph/qsgdefaultinternalrectanglenode_p.h scenegraph/qsgdefaultlayer_p.h scenegraph/qsgdefaultrendercontext_p.h scenegraph/qsgdefaultspritenode_p.h scenegraph/qsgdistancefieldglyphnode_p.h scenegraph/qsgdistancefieldglyphnode_p_p.h scenegraph/qsgrenderloop_p.h scenegraph/qsgthreadedrenderloop_p.h scenegraph/qsgwindowsrenderloop_p.h util/qquickanimation_p.h util/qquickanimation_p_p.h util/qquickanimationcontroller_p.h util/qquickanimator_p.h util/qquickanimator_p_p.h util/qquickanimatorcontroller_p.h util/qquickanimatorjob_p.h util/qquickapplication_p.h util/qquickbehavior_p.h util/qquickfontloader_p.h util/qquickfontmetrics_p.h util/qquickpath_p.h util/qquickpath_p_p.h util/qquickpathinterpolator_p.h util/qquickpixmapcache_p.h util/qquickprofiler_p.h util/qquickpropertychanges_p.h util/qquickshortcut_p.h util/qquicksmoothedanimation_p.h util/qquicksmoothedanimation_p_p.h util/qquickspringanimation_p.h util/qquickstate_p.h util/qquickstate_p_p.h util/qquickstatechangescript_p.h util/qquickstategroup_p.h util/qquickstyledtext_p.h util/qquicksvgparser_p.h util/qquicksystempalette_p.h util/qquicktextmetrics_p.h util/qquicktimeline_p_p.h util/qquicktransition_p.h util/qquicktransitionmanager_p_p.h util/qquickutilmodule_p.h util/qquickvalidator_p.h util/qquickvaluetypes_p.h util/qtquick_tracepoints_p.h items/context2d/qquickcanvascontext_p.h items/context2d/qquickcanvasitem_p.h items/context2d/qquickcontext2d_p.h items/context2d/qquickcontext2dcommandbuffer_p.h items/context2d/qquickcontext2dtexture_p.h items/context2d/qquickcontext2dtile_p.h scenegraph/compressedtexture/qsgpkmhandler_p.h scenegraph/coreapi/qsgabstractrenderer_p.h scenegraph/coreapi/qsgbatchrenderer_p.h scenegraph/coreapi/qsggeometry_p.h scenegraph/coreapi/qsgmaterialshader_p.h scenegraph/coreapi/qsgnode_p.h scenegraph/coreapi/qsgnodeupdater_p.h scenegraph/coreapi/qsgrenderer_p.h scenegraph/coreapi/qsgrendernode_p.h scenegraph/util/qsgareaallocator_p.h scenegraph/util/qsgatlastexture_p.h scenegraph/util/qsgdefaultimagenode_p.h scenegraph/util/qsgdefaultninepatchnode_p.h scenegraph/util/qsgdefaultpainternode_p.h scenegraph/util/qsgdefaultrectanglenode_p.h scenegraph/util/qsgdepthstencilbuffer_p.h scenegraph/util/qsgengine_p.h scenegraph/util/qsgshadersourcebuilder_p.h scenegraph/util/qsgtexture_p.h scenegraph/util/qsgtexturematerial_p.h scenegraph/util/qsgtexturereader_p.h scenegraph/adaptations/software/qsgabstractsoftwarerenderer_p.h scenegraph/adaptations/software/qsgsoftwareadaptation_p.h scenegraph/adaptations/software/qsgsoftwarecontext_p.h scenegraph/adaptations/software/qsgsoftwareglyphnode_p.h scenegraph/adaptations/software/qsgsoftwareinternalimagenode_p.h scenegraph/adaptations/software/qsgsoftwareinternalrectanglenode_p.h scenegraph/adaptations/software/qsgsoftwarelayer_p.h scenegraph/adaptations/software/qsgsoftwarepainternode_p.h scenegraph/adaptations/software/qsgsoftwarepixmaprenderer_p.h scenegraph/adaptations/software/qsgsoftwarepixmaptexture_p.h scenegraph/adaptations/software/qsgsoftwarepublicnodes_p.h scenegraph/adaptations/software/qsgsoftwarerenderablenode_p.h scenegraph/adaptations/software/qsgsoftwarerenderablenodeupdater_p.h scenegraph/adaptations/software/qsgsoftwarerenderer_p.h scenegraph/adaptations/software/qsgsoftwarerenderlistbuilder_p.h scenegraph/adaptations/software/qsgsoftwarerenderloop_p.h scenegraph/adaptations/software/qsgsoftwarespritenode_p.h scenegraph/adaptations/software/qsgsoftwarethreadedrenderloop_p.h 
 SYNCQT.INJECTED_PRIVATE_HEADER_FILES = 
 SYNCQT.QPA_HEADER_FILES = 
 SYNCQT.CLEAN_HEADER_FILES = qtquickglobal.h items/qquickframebufferobject.h items/qquickitem.h items/qquickitemgrabresult.h items/qquickpainteditem.h items/qquickrendercontrol.h items/qquicktextdocument.h items/qquickview.h items/qquickwindow.h util/qquickimageprovider.h scenegraph/coreapi/qsgabstractrenderer.h scenegraph/coreapi/qsggeometry.h scenegraph/coreapi/qsgmaterial.h scenegraph/coreapi/qsgnode.h scenegraph/coreapi/qsgrendererinterface.h scenegraph/coreapi/qsgrendernode.h scenegraph/util/qsgengine.h scenegraph/util/qsgflatcolormaterial.h scenegraph/util/qsgimagenode.h scenegraph/util/qsgninepatchnode.h scenegraph/util/qsgrectanglenode.h scenegraph/util/qsgsimplematerial.h scenegraph/util/qsgsimplerectnode.h scenegraph/util/qsgsimpletexturenode.h scenegraph/util/qsgtexture.h scenegraph/util/qsgtexturematerial.h scenegraph/util/qsgtextureprovider.h scenegraph/util/qsgvertexcolormaterial.h 
@@ -66,6 +66,12 @@ QV4ProfilerAdapter::QV4ProfilerAdapter(QQmlProfilerService *service, QV4::Execut
             engine->profiler(), &QV4::Profiling::Profiler::setTimer);
     connect(engine->profiler(), &QV4::Profiling::Profiler::dataReady,
             this, &QV4ProfilerAdapter::receiveData);
+    connect(engine->profiler(), &QV4::Profiling::Profiler::heapSnapshotReady,
+            this, &QV4ProfilerAdapter::receiveHeapSnapshot);
+    connect(engine->profiler(), &QV4::Profiling::Profiler::regExpStatisticsReady,
+            this, &QV4ProfilerAdapter::receiveRegExpStatistics);
+    connect(engine->profiler(), &QV4::Profiling::Profiler::samplesReady,
+            this, &QV4ProfilerAdapter::receiveSamples);
 }
 
 qint64 QV4ProfilerAdapter::appendMemoryEvents(qint64 until, QList<QByteArray> &messages,
@@ -98,6 +104,30 @@ qint64 QV4ProfilerAdapter::finalizeMessages(qint64 until, QList<QByteArray> &mes
     if (memoryNext == -1) {
         m_memoryData.clear();
         m_memoryPos = 0;
+        if (callNext == -1) {
+            // Samples, statistics and heap snapshots are reported when profiling stops,
+            // after all other events
+            for (const auto &samples : qAsConst(m_samples)) {
+                d << samples.first << int(JavaScriptSamples) << samples.second;
+                messages.append(d.squeezedData());
+                d.clear();
+            }
+            m_samples.clear();
+            for (const auto &statistics : qAsConst(m_regExpStatistics)) {
+                const QV4::Profiling::RegExpStatistics &s = statistics.second;
+                d << statistics.first << int(RegExpStatistics) << s.compiled << s.jitCompiled
+                  << s.reused << s.matches << s.interpretedMatches;
+                messages.append(d.squeezedData());
+                d.clear();
+            }
+            m_regExpStatistics.clear();
+            for (const auto &snapshot : qAsConst(m_heapSnapshots)) {
+                d << snapshot.first << int(HeapSnapshot) << snapshot.second;
+                messages.append(d.squeezedData());
+                d.clear();
+            }
+            m_heapSnapshots.clear();
+        }
         return callNext;
     }
 
@@ -188,6 +218,23 @@ void QV4ProfilerAdapter::receiveData(
     service->dataReady(this);
 }
 
+void QV4ProfilerAdapter::receiveHeapSnapshot(qint64 timestamp, const QByteArray &snapshot)
+{
+    // The data reported right after the snapshot triggers sending it.
+    m_heapSnapshots.append(qMakePair(timestamp, snapshot));
+}
+
+void QV4ProfilerAdapter::receiveRegExpStatistics(
+        qint64 timestamp, const QV4::Profiling::RegExpStatistics &statistics)
+{
+    m_regExpStatistics.append(qMakePair(timestamp, statistics));
+}
+
+void QV4ProfilerAdapter::receiveSamples(qint64 timestamp, const QByteArray &foldedStacks)
+{
+    m_samples.append(qMakePair(timestamp, foldedStacks));
+}
+
 quint64 QV4ProfilerAdapter::translateFeatures(quint64 qmlFeatures)
 {
     quint64 v4Features = 0;
@@ -196,6 +243,10 @@ quint64 QV4ProfilerAdapter::translateFeatures(quint64 qmlFeatures)
         v4Features |= (one << QV4::Profiling::FeatureFunctionCall);
     if (qmlFeatures & (one << ProfileMemory))
         v4Features |= (one << QV4::Profiling::FeatureMemoryAllocation);
+    if (qmlFeatures & (one << ProfileHeapSnapshot))
+        v4Features |= (one << QV4::Profiling::FeatureHeapSnapshot);
+    if (qmlFeatures & (one << ProfileJavaScriptSamples))
+        v4Features |= (one << QV4::Profiling::FeatureSampling);
     return v4Features;
 }
 
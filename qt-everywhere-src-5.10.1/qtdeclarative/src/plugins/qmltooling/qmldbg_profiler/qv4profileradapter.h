@@ -73,6 +73,10 @@ public:
     void receiveData(const QV4::Profiling::FunctionLocationHash &,
                      const QVector<QV4::Profiling::FunctionCallProperties> &,
                      const QVector<QV4::Profiling::MemoryAllocationProperties> &);
+    void receiveHeapSnapshot(qint64 timestamp, const QByteArray &snapshot);
+    void receiveRegExpStatistics(qint64 timestamp,
+                                 const QV4::Profiling::RegExpStatistics &statistics);
+    void receiveSamples(qint64 timestamp, const QByteArray &foldedStacks);
 
 signals:
     void v4ProfilingEnabled(quint64 v4Features);
@@ -82,6 +86,9 @@ private:
     QV4::Profiling::FunctionLocationHash m_functionLocations;
     QVector<QV4::Profiling::FunctionCallProperties> m_functionCallData;
     QVector<QV4::Profiling::MemoryAllocationProperties> m_memoryData;
+    QList<QPair<qint64, QByteArray> > m_heapSnapshots;
+    QList<QPair<qint64, QV4::Profiling::RegExpStatistics> > m_regExpStatistics;
+    QList<QPair<qint64, QByteArray> > m_samples;
     int m_functionCallPos;
     int m_memoryPos;
     QStack<qint64> m_stack;
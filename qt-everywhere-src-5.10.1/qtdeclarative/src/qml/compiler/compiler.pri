@@ -29,14 +29,16 @@ HEADERS += \
     $$PWD/qqmltypecompiler_p.h \
     $$PWD/qqmlpropertycachecreator_p.h \
     $$PWD/qqmlpropertyvalidator_p.h \
-    $$PWD/qv4compilationunitmapper_p.h
+    $$PWD/qv4compilationunitmapper_p.h \
+    $$PWD/qv4compilationunitbundle_p.h
 
 
 SOURCES += \
     $$PWD/qqmltypecompiler.cpp \
     $$PWD/qqmlpropertycachecreator.cpp \
     $$PWD/qqmlpropertyvalidator.cpp \
-    $$PWD/qv4compilationunitmapper.cpp
+    $$PWD/qv4compilationunitmapper.cpp \
+    $$PWD/qv4compilationunitbundle.cpp
 
 unix: SOURCES += $$PWD/qv4compilationunitmapper_unix.cpp
 else: SOURCES += $$PWD/qv4compilationunitmapper_win.cpp
@@ -1043,6 +1043,22 @@ QStringRef IRBuilder::textRefAt(const QQmlJS::AST::SourceLocation &first, const
     return QStringRef(&sourceCode, first.offset, last.offset + last.length - first.offset);
 }
 
+// Returns "a.b.c" for bindings that only read a chain of properties, such as
+// "parent.width" or "model.name", and an empty string otherwise.
+static QString propertyChain(QQmlJS::AST::ExpressionNode *expr)
+{
+    QStringList names;
+    while (QQmlJS::AST::FieldMemberExpression *member = QQmlJS::AST::cast<QQmlJS::AST::FieldMemberExpression *>(expr)) {
+        names.prepend(member->name.toString());
+        expr = member->base;
+    }
+    QQmlJS::AST::IdentifierExpression *identifier = QQmlJS::AST::cast<QQmlJS::AST::IdentifierExpression *>(expr);
+    if (!identifier)
+        return QString();
+    names.prepend(identifier->name.toString());
+    return names.join(QLatin1Char('.'));
+}
+
 void IRBuilder::setBindingValue(QV4::CompiledData::Binding *binding, QQmlJS::AST::Statement *statement)
 {
     QQmlJS::AST::SourceLocation loc = statement->firstSourceLocation();
@@ -1092,6 +1108,15 @@ void IRBuilder::setBindingValue(QV4::CompiledData::Binding *binding, QQmlJS::AST
         // We don't need to store the binding script as string, except for script strings
         // and types with custom parsers. Those will be added later in the compilation phase.
         binding->stringIndex = emptyStringIndex;
+
+        // Plain property reads can be evaluated by QQmlBinding without calling the function.
+        if (exprStmt) {
+            const QString chain = propertyChain(exprStmt->expression);
+            if (!chain.isEmpty()) {
+                binding->flags |= QV4::CompiledData::Binding::IsPropertyChain;
+                binding->stringIndex = registerString(chain);
+            }
+        }
     }
 }
 
@@ -0,0 +1,269 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qv4compilationunitbundle_p.h"
+
+#include "qv4compileddata_p.h"
+#include <QSaveFile>
+
+#include <algorithm>
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+using namespace QV4;
+
+static const char bundle_magic_str[] = "qv4cbndl";
+static const quint32 BundleVersion = 1;
+static const quint32 UnitAlignment = 16;
+
+static inline quint32 alignedOffset(quint32 offset)
+{
+    return (offset + UnitAlignment - 1) & ~(UnitAlignment - 1);
+}
+
+static inline int comparePaths(const char *path, quint32 length, const QByteArray &other)
+{
+    const int result = memcmp(path, other.constData(), qMin<size_t>(length, size_t(other.size())));
+    if (result)
+        return result;
+    return int(length) - other.size();
+}
+
+CompilationUnitBundle::CompilationUnitBundle()
+    : data(nullptr)
+    , header(nullptr)
+    , entries(nullptr)
+{
+}
+
+CompilationUnitBundle::~CompilationUnitBundle()
+{
+    close();
+}
+
+bool CompilationUnitBundle::open(const QString &fileName, QString *errorString)
+{
+    close();
+
+    file.setFileName(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        *errorString = file.errorString();
+        return false;
+    }
+
+    const qint64 size = file.size();
+    if (size < qint64(sizeof(Header)) || size > qint64(std::numeric_limits<quint32>::max())) {
+        *errorString = QStringLiteral("Invalid size for a cache bundle");
+        file.close();
+        return false;
+    }
+
+    const uchar *mapping = file.map(0, size);
+    if (!mapping) {
+        *errorString = file.errorString();
+        file.close();
+        return false;
+    }
+
+    const Header *h = reinterpret_cast<const Header *>(mapping);
+    if (memcmp(h->magic, bundle_magic_str, sizeof(h->magic))) {
+        *errorString = QStringLiteral("Magic bytes in the bundle header do not match");
+    } else if (h->version != BundleVersion) {
+        *errorString = QString::fromUtf8("Bundle version mismatch. Found %1 expected %2").arg(h->version).arg(BundleVersion);
+    } else if (h->qtVersion != quint32(QT_VERSION)) {
+        *errorString = QString::fromUtf8("Qt version mismatch. Found %1 expected %2").arg(h->qtVersion, 0, 16).arg(QT_VERSION, 0, 16);
+    } else if (sizeof(Header) + quint64(h->entryCount) * sizeof(Entry) > quint64(size)) {
+        *errorString = QStringLiteral("Bundle too small for its index");
+    } else {
+        // Validate the index once, so that lookups don't need any checks.
+        const Entry *e = reinterpret_cast<const Entry *>(mapping + sizeof(Header));
+        bool valid = true;
+        for (quint32 i = 0; valid && i < h->entryCount; ++i) {
+            valid = quint64(e[i].sourcePathOffset) + e[i].sourcePathLength <= quint64(size)
+                    && quint64(e[i].unitOffset) + e[i].unitLength <= quint64(size)
+                    && e[i].unitLength >= sizeof(CompiledData::Unit)
+                    && e[i].unitOffset % UnitAlignment == 0;
+        }
+        if (valid) {
+            data = mapping;
+            header = h;
+            entries = e;
+            return true;
+        }
+        *errorString = QStringLiteral("Bundle index is corrupt");
+    }
+
+    file.unmap(const_cast<uchar *>(mapping));
+    file.close();
+    return false;
+}
+
+void CompilationUnitBundle::close()
+{
+    if (data)
+        file.unmap(const_cast<uchar *>(data));
+    file.close();
+    data = nullptr;
+    header = nullptr;
+    entries = nullptr;
+}
+
+const CompiledData::Unit *CompilationUnitBundle::unitForSource(const QString &sourcePath) const
+{
+    if (!data)
+        return nullptr;
+
+    const QByteArray path = sourcePath.toUtf8();
+    const char *base = reinterpret_cast<const char *>(data);
+    const Entry *end = entries + header->entryCount;
+    const Entry *it = std::lower_bound(entries, end, path, [base](const Entry &entry, const QByteArray &key) {
+        return comparePaths(base + entry.sourcePathOffset, entry.sourcePathLength, key) < 0;
+    });
+    if (it == end || comparePaths(base + it->sourcePathOffset, it->sourcePathLength, path) != 0)
+        return nullptr;
+    return reinterpret_cast<const CompiledData::Unit *>(data + it->unitOffset);
+}
+
+/*
+    Writes the existing \a cacheFiles into a single bundle. The units are
+    copied verbatim, including the code that follows them, so the bundle is
+    only valid as long as the individual cache files would be.
+*/
+bool CompilationUnitBundle::write(const QString &fileName, const QVector<CacheFile> &cacheFiles, QString *errorString)
+{
+    struct PendingEntry {
+        QByteArray sourcePath;
+        QByteArray unit;
+    };
+    std::vector<PendingEntry> pending;
+    pending.reserve(cacheFiles.size());
+
+    for (const CacheFile &cacheFile : cacheFiles) {
+        QFile f(cacheFile.cacheFilePath);
+        if (!f.open(QIODevice::ReadOnly)) {
+            *errorString = f.errorString();
+            return false;
+        }
+        PendingEntry entry = { cacheFile.sourcePath.toUtf8(), f.readAll() };
+        if (entry.unit.size() < int(sizeof(CompiledData::Unit))
+                || memcmp(entry.unit.constData(), CompiledData::magic_str, sizeof(CompiledData::magic_str) - 1)) {
+            *errorString = QString::fromUtf8("%1 is not a cache file").arg(cacheFile.cacheFilePath);
+            return false;
+        }
+        pending.push_back(entry);
+    }
+
+    std::sort(pending.begin(), pending.end(), [](const PendingEntry &a, const PendingEntry &b) {
+        return comparePaths(a.sourcePath.constData(), a.sourcePath.size(), b.sourcePath) < 0;
+    });
+
+    Header h;
+    memcpy(h.magic, bundle_magic_str, sizeof(h.magic));
+    h.version = BundleVersion;
+    h.qtVersion = QT_VERSION;
+    h.entryCount = quint32(pending.size());
+    h.padding = 0;
+
+    // The paths follow the index, the units follow the paths.
+    QVector<Entry> index(int(pending.size()));
+    quint64 offset = sizeof(Header) + quint64(pending.size()) * sizeof(Entry);
+    for (size_t i = 0; i < pending.size(); ++i) {
+        index[int(i)].sourcePathOffset = quint32(offset);
+        index[int(i)].sourcePathLength = quint32(pending[i].sourcePath.size());
+        offset += pending[i].sourcePath.size();
+    }
+    for (size_t i = 0; i < pending.size(); ++i) {
+        offset = alignedOffset(quint32(offset));
+        index[int(i)].unitOffset = quint32(offset);
+        index[int(i)].unitLength = quint32(pending[i].unit.size());
+        offset += pending[i].unit.size();
+        if (offset > std::numeric_limits<quint32>::max()) {
+            *errorString = QStringLiteral("Too much data for a cache bundle");
+            return false;
+        }
+    }
+
+    QSaveFile out(fileName);
+    if (!out.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        *errorString = out.errorString();
+        return false;
+    }
+
+    QByteArray contents;
+    contents.reserve(int(offset));
+    contents.append(reinterpret_cast<const char *>(&h), sizeof(h));
+    contents.append(reinterpret_cast<const char *>(index.constData()), index.size() * int(sizeof(Entry)));
+    for (const PendingEntry &entry : pending)
+        contents.append(entry.sourcePath);
+    for (const PendingEntry &entry : pending) {
+        contents.append(QByteArray(int(alignedOffset(contents.size()) - contents.size()), '\0'));
+        contents.append(entry.unit);
+    }
+
+    if (out.write(contents) != contents.size() || !out.commit()) {
+        *errorString = out.errorString();
+        return false;
+    }
+    return true;
+}
+
+namespace {
+struct GlobalBundle : public CompilationUnitBundle
+{
+    GlobalBundle()
+    {
+        const QString fileName = qEnvironmentVariable("QML_DISK_CACHE_BUNDLE");
+        QString errorString;
+        if (!fileName.isEmpty() && !open(fileName, &errorString))
+            qWarning("Cannot open QML cache bundle %s: %s", qPrintable(fileName), qPrintable(errorString));
+    }
+};
+}
+
+Q_GLOBAL_STATIC(GlobalBundle, globalBundle)
+
+const CompilationUnitBundle *CompilationUnitBundle::instance()
+{
+    const CompilationUnitBundle *bundle = globalBundle();
+    return bundle && bundle->isOpen() ? bundle : nullptr;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,121 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQml module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QV4COMPILATIONUNITBUNDLE_P_H
+#define QV4COMPILATIONUNITBUNDLE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qv4global_p.h>
+#include <private/qendian_p.h>
+#include <QFile>
+#include <QVector>
+
+QT_BEGIN_NAMESPACE
+
+namespace QV4 {
+
+namespace CompiledData {
+struct Unit;
+}
+
+// A single file holding the cache files of many QML and JS sources, so that
+// they can be mapped with one open() and one mmap() instead of one each.
+// The index is sorted by the UTF-8 encoded source path and is searched in
+// place, nothing is copied out of the mapping.
+class Q_QML_PRIVATE_EXPORT CompilationUnitBundle
+{
+public:
+    struct Header {
+        char magic[8];
+        quint32_le version;
+        quint32_le qtVersion;
+        quint32_le entryCount;
+        quint32_le padding;
+    };
+
+    struct Entry {
+        quint32_le sourcePathOffset;
+        quint32_le sourcePathLength;
+        quint32_le unitOffset;
+        quint32_le unitLength;
+    };
+
+    struct CacheFile {
+        QString sourcePath;
+        QString cacheFilePath;
+    };
+
+    CompilationUnitBundle();
+    ~CompilationUnitBundle();
+
+    bool open(const QString &fileName, QString *errorString);
+    void close();
+    bool isOpen() const { return data != nullptr; }
+
+    const CompiledData::Unit *unitForSource(const QString &sourcePath) const;
+
+    static bool write(const QString &fileName, const QVector<CacheFile> &cacheFiles, QString *errorString);
+
+    // The bundle named by QML_DISK_CACHE_BUNDLE, mapped on first use, or null.
+    static const CompilationUnitBundle *instance();
+
+private:
+    Q_DISABLE_COPY(CompilationUnitBundle)
+
+    QFile file;
+    const uchar *data;
+    const Header *header;
+    const Entry *entries;
+};
+
+}
+
+QT_END_NAMESPACE
+
+#endif // QV4COMPILATIONUNITBUNDLE_P_H
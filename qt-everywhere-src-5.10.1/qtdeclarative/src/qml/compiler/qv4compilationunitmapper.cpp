@@ -40,6 +40,7 @@
 #include "qv4compilationunitmapper_p.h"
 
 #include "qv4compileddata_p.h"
+#include "qv4compilationunitbundle_p.h"
 #include <QFileInfo>
 #include <QDateTime>
 #include <QCoreApplication>
@@ -91,4 +92,28 @@ bool CompilationUnitMapper::verifyHeader(const CompiledData::Unit *header, QDate
     return true;
 }
 
+// Units in the cache bundle are mapped for the lifetime of the process, so
+// there is nothing for close() to release.
+CompiledData::Unit *CompilationUnitMapper::openFromBundle(const QString &sourcePath, const QDateTime &sourceTimeStamp, QString *errorString)
+{
+    close();
+
+    const CompilationUnitBundle *bundle = CompilationUnitBundle::instance();
+    if (!bundle) {
+        *errorString = QStringLiteral("No cache bundle");
+        return nullptr;
+    }
+
+    const CompiledData::Unit *unit = bundle->unitForSource(sourcePath);
+    if (!unit) {
+        *errorString = QStringLiteral("Source file is not part of the cache bundle");
+        return nullptr;
+    }
+
+    if (!verifyHeader(unit, sourceTimeStamp, errorString))
+        return nullptr;
+
+    return const_cast<CompiledData::Unit *>(unit);
+}
+
 QT_END_NAMESPACE
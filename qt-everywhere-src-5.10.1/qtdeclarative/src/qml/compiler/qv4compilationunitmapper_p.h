@@ -69,6 +69,7 @@ public:
     ~CompilationUnitMapper();
 
     CompiledData::Unit *open(const QString &cacheFilePath, const QDateTime &sourceTimeStamp, QString *errorString);
+    CompiledData::Unit *openFromBundle(const QString &sourcePath, const QDateTime &sourceTimeStamp, QString *errorString);
     void close();
 
 private:
@@ -359,7 +359,9 @@ bool CompilationUnit::loadFromDisk(const QUrl &url, const QDateTime &sourceTimeS
     const QString sourcePath = QQmlFile::urlToLocalFileOrQrc(url);
     QScopedPointer<CompilationUnitMapper> cacheFile(new CompilationUnitMapper());
 
-    CompiledData::Unit *mappedUnit = cacheFile->open(cacheFilePath(url), sourceTimeStamp, errorString);
+    CompiledData::Unit *mappedUnit = cacheFile->openFromBundle(sourcePath, sourceTimeStamp, errorString);
+    if (!mappedUnit)
+        mappedUnit = cacheFile->open(cacheFilePath(url), sourceTimeStamp, errorString);
     if (!mappedUnit)
         return false;
 
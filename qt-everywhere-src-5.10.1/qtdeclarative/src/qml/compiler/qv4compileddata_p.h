@@ -72,7 +72,7 @@
 QT_BEGIN_NAMESPACE
 
 // Bump this whenever the compiler data structures change in an incompatible way.
-#define QV4_DATA_STRUCTURE_VERSION 0x14
+#define QV4_DATA_STRUCTURE_VERSION 0x15
 
 class QIODevice;
 class QQmlPropertyCache;
@@ -301,6 +301,7 @@ struct Q_QML_PRIVATE_EXPORT Binding
         IsBindingToAlias = 0x40,
         IsDeferredBinding = 0x80,
         IsCustomParserBinding = 0x100,
+        IsPropertyChain = 0x200, // Type_Script binding of the form "a.b.c", stringIndex holds the chain
     };
 
     union {
@@ -69,6 +69,9 @@ struct QQmlProfilerDefinitions {
         PixmapCacheEvent,
         SceneGraphFrame,
         MemoryAllocation,
+        HeapSnapshot,
+        RegExpStatistics,
+        JavaScriptSamples,
 
         MaximumMessage
     };
@@ -143,6 +146,8 @@ struct QQmlProfilerDefinitions {
         ProfileHandlingSignal,
         ProfileInputEvents,
         ProfileDebugMessages,
+        ProfileHeapSnapshot,
+        ProfileJavaScriptSamples,
 
         MaximumProfileFeature
     };
@@ -48,6 +48,7 @@
 #include <qv4errorobject_p.h>
 #include <qv4functionobject_p.h>
 #include "qv4function_p.h"
+#include "qv4lookup_p.h"
 #include <qv4mathobject_p.h>
 #include <qv4numberobject_p.h>
 #include <qv4regexpobject_p.h>
@@ -131,8 +132,6 @@ qint32 ExecutionEngine::maxCallDepth = -1;
 
 ExecutionEngine::ExecutionEngine(EvalISelFactory *factory)
     : executableAllocator(new QV4::ExecutableAllocator)
-    , regExpAllocator(new QV4::ExecutableAllocator)
-    , bumperPointerAllocator(new WTF::BumpPointerAllocator)
     , jsStack(new WTF::PageAllocation)
     , gcStack(new WTF::PageAllocation)
     , globalCode(0)
@@ -141,6 +140,9 @@ ExecutionEngine::ExecutionEngine(EvalISelFactory *factory)
     , nArgumentsAccessors(0)
     , m_engineId(engineSerial.fetchAndAddOrdered(1))
     , regExpCache(0)
+    , regExpCompilationCache(0)
+    , lookupCache(0)
+    , qobjectLookupCache(0)
     , m_multiplyWrappedQObjects(0)
 {
     memoryManager = new QV4::MemoryManager(this);
@@ -509,9 +511,13 @@ ExecutionEngine::~ExecutionEngine()
 
     internalClasses[Class_Empty]->destroy();
     delete classPool;
-    delete bumperPointerAllocator;
     delete regExpCache;
-    delete regExpAllocator;
+    if (regExpCompilationCache)
+        regExpCompilationCache->release();
+    if (lookupCache)
+        lookupCache->dumpStatistics();
+    delete lookupCache;
+    delete qobjectLookupCache;
     delete executableAllocator;
     jsStack->deallocate();
     delete jsStack;
@@ -63,7 +63,6 @@
 #endif
 
 namespace WTF {
-class BumpPointerAllocator;
 class PageAllocation;
 }
 
@@ -99,11 +98,8 @@ private:
     friend struct Heap::ExecutionContext;
 public:
     ExecutableAllocator *executableAllocator;
-    ExecutableAllocator *regExpAllocator;
     QScopedPointer<EvalISelFactory> iselFactory;
 
-    WTF::BumpPointerAllocator *bumperPointerAllocator; // Used by Yarr Regex engine.
-
     enum {
         JSStackLimit = 4*1024*1024,
         GCStackLimit = 2*1024*1024
@@ -322,6 +318,9 @@ public:
     quint32 m_engineId;
 
     RegExpCache *regExpCache;
+    RegExpCompilationCache *regExpCompilationCache;
+    LookupCache *lookupCache;
+    QObjectLookupCache *qobjectLookupCache;
 
     // Scarce resources are "exceptionally high cost" QVariant types where allowing the
     // normal JavaScript GC to clean them up is likely to lead to out-of-memory or other
@@ -522,7 +521,10 @@ void Heap::Base::mark(QV4::MarkStack *markStack)
     Q_ASSERT(!Chunk::testBit(c->extendsBitmap, index));
     quintptr *bitmap = c->blackBitmap + Chunk::bitmapIndex(index);
     quintptr bit = Chunk::bitForIndex(index);
-    if (!(*bitmap & bit)) {
+    if (Q_UNLIKELY(markStack->parallelMarker)) {
+        if (!Chunk::testAndSetBitAtomic(bitmap, bit))
+            markStack->push(this);
+    } else if (!(*bitmap & bit)) {
         *bitmap |= bit;
         markStack->push(this);
     }
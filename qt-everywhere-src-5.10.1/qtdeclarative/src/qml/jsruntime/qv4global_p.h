@@ -196,6 +196,8 @@ struct Value;
 template<size_t> struct HeapValue;
 template<size_t> struct ValueArray;
 struct Lookup;
+struct LookupCache;
+struct QObjectLookupCache;
 struct ArrayData;
 struct VTable;
 struct Function;
@@ -241,6 +243,7 @@ class WeakValue;
 
 struct IdentifierTable;
 class RegExpCache;
+class RegExpCompilationCache;
 class MultiplyWrappedQObjectMap;
 
 namespace Global {
@@ -112,6 +112,7 @@ InternalClass::InternalClass(ExecutionEngine *engine)
     , size(0)
     , extensible(true)
 {
+    ++engine->classPool->classCount;
 }
 
 
@@ -129,6 +130,7 @@ InternalClass::InternalClass(const QV4::InternalClass &other)
     , extensible(other.extensible)
 {
     Q_ASSERT(extensible);
+    ++engine->classPool->classCount;
 }
 
 static void insertHoleIntoPropertyData(Object *object, int idx)
@@ -173,7 +175,15 @@ InternalClassTransition &InternalClass::lookupOrInsertTransition(const InternalC
     if (it != transitions.end() && *it == t) {
         return *it;
     } else {
+        // Most classes only ever get one or two transitions, so grow the
+        // table one entry at a time for those instead of doubling it.
+        if (transitions.size() == transitions.capacity() && transitions.size() < 4) {
+            const size_t offset = it - transitions.begin();
+            transitions.reserve(transitions.size() + 1);
+            it = transitions.begin() + offset;
+        }
         it = transitions.insert(it, t);
+        ++engine->classPool->transitionCount;
         return *it;
     }
 }
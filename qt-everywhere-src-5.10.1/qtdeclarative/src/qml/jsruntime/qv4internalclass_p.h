@@ -307,6 +307,10 @@ private:
 struct InternalClassPool : public QQmlJS::MemoryPool
 {
     void markObjects(MarkStack *markStack);
+
+    // classes are never freed before the engine, so these only grow
+    uint classCount = 0;
+    uint transitionCount = 0;
 };
 
 }
@@ -76,6 +76,7 @@ JsonParser::JsonParser(ExecutionEngine *engine, const QChar *json, int length)
     : engine(engine), head(json), json(json), nestingLevel(0), lastError(QJsonParseError::NoError)
 {
     end = json + length;
+    memset(keyCache, 0, sizeof(keyCache));
 }
 
 
@@ -247,9 +248,16 @@ bool JsonParser::parseMember(Object *o)
     BEGIN << "parseMember";
     Scope scope(engine);
 
-    QString key;
-    if (!parseString(&key))
-        return false;
+    ScopedString s(scope);
+    if (const QChar *quote = plainStringEnd()) {
+        s = cachedKey(json, quote - json);
+        json = quote + 1;
+    } else {
+        QString key;
+        if (!parseString(&key))
+            return false;
+        s = engine->newIdentifier(key);
+    }
     QChar token = nextToken();
     if (token != NameSeparator) {
         lastError = QJsonParseError::MissingNameSeparator;
@@ -259,7 +267,6 @@ bool JsonParser::parseMember(Object *o)
     if (!parseValue(val))
         return false;
 
-    ScopedString s(scope, engine->newIdentifier(key));
     uint idx = s->asArrayIndex();
     if (idx < UINT_MAX) {
         o->putIndexed(idx, val);
@@ -469,6 +476,22 @@ bool JsonParser::parseNumber(Value *val)
             ++json;
     }
 
+    if (isInt) {
+        // small integers don't need to go through QString
+        const QChar *ch = start;
+        const bool negative = (*ch == '-');
+        if (negative)
+            ++ch;
+        if (ch < json && json - ch < 8) {
+            int n = 0;
+            for (; ch < json; ++ch)
+                n = n * 10 + (ch->unicode() - '0');
+            *val = Primitive::fromInt32(negative ? -n : n);
+            END;
+            return true;
+        }
+    }
+
     QString number(start, json - start);
     DEBUG << "numberstring" << number;
 
@@ -577,10 +600,52 @@ static inline bool scanEscapeSequence(const QChar *&json, const QChar *end, uint
 }
 
 
+/*
+    Returns the position of the closing quote of the string starting at the
+    current position, if the string has no escape sequences and can be used
+    as it is. Otherwise returns 0.
+*/
+const QChar *JsonParser::plainStringEnd() const
+{
+    for (const QChar *ch = json; ch < end; ++ch) {
+        const ushort c = ch->unicode();
+        if (c == Quote)
+            return ch;
+        if (c == '\\' || c <= 0x1f)
+            return 0;
+    }
+    return 0;
+}
+
+/*
+    Most JSON documents use the same few keys over and over again. Cache
+    their identifiers by their characters, so that they don't have to be
+    converted to a QString and looked up in the identifier table each time.
+*/
+Heap::String *JsonParser::cachedKey(const QChar *key, int length)
+{
+    uint hash = length;
+    if (length)
+        hash = (hash * 31 + key[0].unicode()) * 31 + key[length - 1].unicode();
+    Heap::String *&entry = keyCache[hash % KeyCacheSize];
+    if (!entry || entry->len != uint(length)
+            || memcmp(entry->text->data(), key, length * sizeof(QChar)) != 0) {
+        entry = engine->newIdentifier(QString(key, length));
+    }
+    return entry;
+}
+
 bool JsonParser::parseString(QString *string)
 {
     BEGIN << "parse string stringPos=" << json;
 
+    if (const QChar *quote = plainStringEnd()) {
+        *string = QString(json, quote - json);
+        json = quote + 1;
+        END;
+        return true;
+    }
+
     while (json < end) {
         if (*json == '"')
             break;
@@ -127,6 +127,9 @@ private:
     bool parseValue(Value *val);
     bool parseNumber(Value *val);
 
+    const QChar *plainStringEnd() const;
+    Heap::String *cachedKey(const QChar *key, int length);
+
     ExecutionEngine *engine;
     const QChar *head;
     const QChar *json;
@@ -134,6 +137,9 @@ private:
 
     int nestingLevel;
     QJsonParseError::ParseError lastError;
+
+    enum { KeyCacheSize = 64 };
+    Heap::String *keyCache[KeyCacheSize];
 };
 
 }
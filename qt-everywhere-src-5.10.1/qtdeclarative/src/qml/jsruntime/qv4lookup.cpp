@@ -42,10 +42,14 @@
 #include "qv4string_p.h"
 #include <private/qv4identifiertable_p.h>
 
+#include <QtCore/qloggingcategory.h>
+
 QT_BEGIN_NAMESPACE
 
 using namespace QV4;
 
+Q_LOGGING_CATEGORY(lcLookupStats, "qt.qml.lookup.statistics")
+
 
 ReturnedValue Lookup::lookup(const Value &thisObject, Object *o, PropertyAttributes *attrs)
 {
@@ -363,8 +367,56 @@ ReturnedValue Lookup::getterTwoClasses(Lookup *l, ExecutionEngine *engine, const
     return getterFallback(l, engine, object);
 }
 
+// Looks up own and prototype properties through the engine's lookup cache,
+// returns false if the property is neither.
+static bool cachedGet(ExecutionEngine *engine, const Object *o, Identifier *id, ReturnedValue *result)
+{
+    LookupCache *cache = LookupCache::get(engine);
+    Heap::Object *obj = o->d();
+    InternalClass *ic = obj->internalClass;
+    LookupCache::Entry &e = cache->entries[LookupCache::hash(ic, id)];
+    if (e.identifier == id && e.classList[0] == ic) {
+        Heap::Object *holder = e.level ? ic->prototype : obj;
+        if (holder && holder->internalClass == e.classList[e.level]) {
+            ++cache->hits;
+            *result = Object::getValue(*o, *holder->propertyData(e.index),
+                                       holder->internalClass->propertyData.at(e.index));
+            return true;
+        }
+    }
+
+    ++cache->misses;
+    Heap::Object *holder = obj;
+    for (uint level = 0; level < 2 && holder; ++level) {
+        uint index = holder->internalClass->find(id);
+        if (index != UINT_MAX) {
+            e.classList[0] = ic;
+            e.classList[1] = level ? holder->internalClass : nullptr;
+            e.identifier = id;
+            e.index = index;
+            e.level = level;
+            *result = Object::getValue(*o, *holder->propertyData(index),
+                                       holder->internalClass->propertyData.at(index));
+            return true;
+        }
+        holder = holder->prototype();
+    }
+    return false;
+}
+
 ReturnedValue Lookup::getterFallback(Lookup *l, ExecutionEngine *engine, const Value &object)
 {
+    if (const Object *o = object.as<Object>()) {
+        if (o->vtable()->get == Object::static_vtbl.get) {
+            Heap::String *name = engine->current->compilationUnit->runtimeStrings[l->nameIndex];
+            if (Identifier *id = engine->identifierTable->identifier(name)) {
+                ReturnedValue v;
+                if (cachedGet(engine, o, id, &v))
+                    return v;
+            }
+        }
+    }
+
     QV4::Scope scope(engine);
     QV4::ScopedObject o(scope, object.toObject(scope.engine));
     if (!o)
@@ -439,6 +491,19 @@ ReturnedValue Lookup::getter0Inlinegetter0Inline(Lookup *l, ExecutionEngine *eng
         if (l->classList[2] == o->internalClass)
             return o->inlinePropertyData(l->index2)->asReturnedValue();
     }
+    const uint index0 = l->index;
+    const uint index1 = l->index2;
+    if (index0 <= 0xffff && index1 <= 0xffff) {
+        l->classList[1] = l->classList[2];
+        l->classList[2] = nullptr;
+        l->classList[3] = nullptr;
+        l->polymorphicIndex[0] = quint16(index0);
+        l->polymorphicIndex[1] = quint16(index1);
+        l->polymorphicIndex[2] = 0;
+        l->polymorphicIndex[3] = 0;
+        l->getter = getter0Polymorphic;
+        return getterPolymorphic(l, engine, object);
+    }
     l->getter = getterFallback;
     return getterFallback(l, engine, object);
 }
@@ -454,6 +519,19 @@ ReturnedValue Lookup::getter0Inlinegetter0MemberData(Lookup *l, ExecutionEngine
         if (l->classList[2] == o->internalClass)
             return o->memberData->values.data()[l->index2].asReturnedValue();
     }
+    const uint index0 = l->index;
+    const uint index1 = l->index2 + l->classList[2]->vtable->nInlineProperties;
+    if (index0 <= 0xffff && index1 <= 0xffff) {
+        l->classList[1] = l->classList[2];
+        l->classList[2] = nullptr;
+        l->classList[3] = nullptr;
+        l->polymorphicIndex[0] = quint16(index0);
+        l->polymorphicIndex[1] = quint16(index1);
+        l->polymorphicIndex[2] = 0;
+        l->polymorphicIndex[3] = 0;
+        l->getter = getter0Polymorphic;
+        return getterPolymorphic(l, engine, object);
+    }
     l->getter = getterFallback;
     return getterFallback(l, engine, object);
 }
@@ -469,6 +547,19 @@ ReturnedValue Lookup::getter0MemberDatagetter0MemberData(Lookup *l, ExecutionEng
         if (l->classList[2] == o->internalClass)
             return o->memberData->values.data()[l->index2].asReturnedValue();
     }
+    const uint index0 = l->index + l->classList[0]->vtable->nInlineProperties;
+    const uint index1 = l->index2 + l->classList[2]->vtable->nInlineProperties;
+    if (index0 <= 0xffff && index1 <= 0xffff) {
+        l->classList[1] = l->classList[2];
+        l->classList[2] = nullptr;
+        l->classList[3] = nullptr;
+        l->polymorphicIndex[0] = quint16(index0);
+        l->polymorphicIndex[1] = quint16(index1);
+        l->polymorphicIndex[2] = 0;
+        l->polymorphicIndex[3] = 0;
+        l->getter = getter0Polymorphic;
+        return getterPolymorphic(l, engine, object);
+    }
     l->getter = getterFallback;
     return getterFallback(l, engine, object);
 }
@@ -522,6 +613,47 @@ ReturnedValue Lookup::getter1getter1(Lookup *l, ExecutionEngine *engine, const V
 }
 
 
+/*
+    Called when a polymorphic lookup meets an object of a new class. Own data
+    properties of up to Size classes are handled, after that the lookup becomes
+    megamorphic and goes through the engine's lookup cache.
+*/
+ReturnedValue Lookup::getterPolymorphic(Lookup *l, ExecutionEngine *engine, const Value &object)
+{
+    if (const Object *o = object.as<Object>()) {
+        InternalClass *ic = o->internalClass();
+        for (uint i = 0; i < Size; ++i) {
+            if (l->classList[i])
+                continue;
+            Identifier *id = engine->identifierTable->identifier(engine->current->compilationUnit->runtimeStrings[l->nameIndex]);
+            uint index = id ? ic->find(id) : UINT_MAX;
+            if (index > 0xffff || !ic->propertyData.at(index).isData())
+                break;
+            l->classList[i] = ic;
+            l->polymorphicIndex[i] = quint16(index);
+            ++LookupCache::get(engine)->polymorphicShapes;
+            return o->propertyData(index)->asReturnedValue();
+        }
+    }
+    ++LookupCache::get(engine)->megamorphicTransitions;
+    l->getter = getterFallback;
+    return getterFallback(l, engine, object);
+}
+
+ReturnedValue Lookup::getter0Polymorphic(Lookup *l, ExecutionEngine *engine, const Value &object)
+{
+    // we can safely cast to a QV4::Object here. If object is actually a string,
+    // the internal class won't match
+    Heap::Object *o = static_cast<Heap::Object *>(object.heapObject());
+    if (o) {
+        for (uint i = 0; i < Size; ++i) {
+            if (l->classList[i] == o->internalClass)
+                return o->propertyData(l->polymorphicIndex[i])->asReturnedValue();
+        }
+    }
+    return getterPolymorphic(l, engine, object);
+}
+
 ReturnedValue Lookup::getterAccessor0(Lookup *l, ExecutionEngine *engine, const Value &object)
 {
     // we can safely cast to a QV4::Object here. If object is actually a string,
@@ -966,9 +1098,21 @@ void Lookup::setter0setter0(Lookup *l, ExecutionEngine *engine, Value &object, c
         }
     }
 
+    const uint index0 = l->index;
+    const uint index1 = l->index2;
+    if (index0 <= 0xffff && index1 <= 0xffff) {
+        l->classList[2] = nullptr;
+        l->classList[3] = nullptr;
+        l->polymorphicIndex[0] = quint16(index0);
+        l->polymorphicIndex[1] = quint16(index1);
+        l->polymorphicIndex[2] = 0;
+        l->polymorphicIndex[3] = 0;
+        l->setter = setter0Polymorphic;
+        setterPolymorphic(l, engine, object, value);
+        return;
+    }
     l->setter = setterFallback;
     setterFallback(l, engine, object, value);
-
 }
 
 QT_END_NAMESPACE
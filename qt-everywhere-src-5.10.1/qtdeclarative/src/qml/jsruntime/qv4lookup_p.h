@@ -83,11 +83,17 @@ struct Lookup {
         };
     };
     union {
-        int level;
-        uint index2;
-        unsigned type;
+        struct {
+            union {
+                int level;
+                uint index2;
+                unsigned type;
+            };
+            uint index;
+        };
+        // property indexes for the classes in classList, used by the polymorphic lookups
+        quint16 polymorphicIndex[Size];
     };
-    uint index;
     uint nameIndex;
 
     static ReturnedValue indexedGetterGeneric(Lookup *l, ExecutionEngine *engine, const Value &object, const Value &index);
@@ -112,6 +118,8 @@ struct Lookup {
     static ReturnedValue getter0Inlinegetter1(Lookup *l, ExecutionEngine *engine, const Value &object);
     static ReturnedValue getter0MemberDatagetter1(Lookup *l, ExecutionEngine *engine, const Value &object);
     static ReturnedValue getter1getter1(Lookup *l, ExecutionEngine *engine, const Value &object);
+    static ReturnedValue getterPolymorphic(Lookup *l, ExecutionEngine *engine, const Value &object);
+    static ReturnedValue getter0Polymorphic(Lookup *l, ExecutionEngine *engine, const Value &object);
     static ReturnedValue getterAccessor0(Lookup *l, ExecutionEngine *engine, const Value &object);
     static ReturnedValue getterAccessor1(Lookup *l, ExecutionEngine *engine, const Value &object);
     static ReturnedValue getterAccessor2(Lookup *l, ExecutionEngine *engine, const Value &object);
@@ -142,12 +150,52 @@ struct Lookup {
     static void setterInsert1(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
     static void setterInsert2(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
     static void setter0setter0(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
+    static void setterPolymorphic(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
+    static void setter0Polymorphic(Lookup *l, ExecutionEngine *engine, Value &object, const Value &value);
 
     ReturnedValue lookup(const Value &thisObject, Object *obj, PropertyAttributes *attrs);
     ReturnedValue lookup(const Object *obj, PropertyAttributes *attrs);
 
 };
 
+/*
+    Remembers where properties were found for lookups that have seen too many
+    internal classes to be specialized. Internal classes never change once they
+    have been created, so an entry stays valid as long as the internal classes
+    of the object and of the prototype it was found on match.
+*/
+struct LookupCache {
+    enum { Size = 1024 };
+    struct Entry {
+        InternalClass *classList[2];
+        Identifier *identifier;
+        uint index;
+        uint level;
+    };
+
+    LookupCache() { memset(entries, 0, sizeof(entries)); }
+
+    static LookupCache *get(ExecutionEngine *engine)
+    {
+        if (!engine->lookupCache)
+            engine->lookupCache = new LookupCache;
+        return engine->lookupCache;
+    }
+
+    static uint hash(const InternalClass *ic, const Identifier *id)
+    { return uint((quintptr(ic) >> 4) ^ (quintptr(id) >> 3)) & (Size - 1); }
+
+    void dumpStatistics() const;
+
+    Entry entries[Size];
+
+    // statistics, printed with the qt.qml.lookup.statistics logging category
+    quint64 hits = 0;
+    quint64 misses = 0;
+    uint polymorphicShapes = 0;
+    uint megamorphicTransitions = 0;
+};
+
 Q_STATIC_ASSERT(std::is_standard_layout<Lookup>::value);
 // Ensure that these offsets are always at this point to keep generated code compatible
 // across 32-bit and 64-bit (matters when cross-compiling).
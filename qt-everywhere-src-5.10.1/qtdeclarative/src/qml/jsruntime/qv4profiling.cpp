@@ -40,12 +40,52 @@
 #include "qv4profiling_p.h"
 #include <private/qv4mm_p.h>
 #include <private/qv4string_p.h>
+#include <private/qv4context_p.h>
+#include <QtCore/qthread.h>
 
 QT_BEGIN_NAMESPACE
 
 namespace QV4 {
 namespace Profiling {
 
+/*
+    Requests a sample from the profiler at a fixed interval. The engine takes
+    the sample on its own thread the next time it calls a function, so that
+    the stack doesn't change while it is being looked at.
+*/
+class Sampler : public QThread
+{
+public:
+    Sampler(QAtomicInt *request)
+        : m_request(request)
+    {
+        bool ok = false;
+        m_interval = qEnvironmentVariableIntValue("QV4_PROFILER_SAMPLING_INTERVAL", &ok);
+        if (!ok || m_interval <= 0)
+            m_interval = 1000; // microseconds
+    }
+
+    void stop()
+    {
+        m_stop.storeRelease(1);
+        wait();
+    }
+
+protected:
+    void run() override
+    {
+        while (!m_stop.loadAcquire()) {
+            QThread::usleep(m_interval);
+            m_request->storeRelease(1);
+        }
+    }
+
+private:
+    QAtomicInt *m_request;
+    QAtomicInt m_stop;
+    int m_interval;
+};
+
 FunctionLocation FunctionCall::resolveLocation() const
 {
     return FunctionLocation(m_function->name()->toQString(),
@@ -69,15 +109,48 @@ Profiler::Profiler(QV4::ExecutionEngine *engine) : featuresEnabled(0), m_engine(
     static const int metatypes[] = {
         qRegisterMetaType<QVector<QV4::Profiling::FunctionCallProperties> >(),
         qRegisterMetaType<QVector<QV4::Profiling::MemoryAllocationProperties> >(),
-        qRegisterMetaType<FunctionLocationHash>()
+        qRegisterMetaType<FunctionLocationHash>(),
+        qRegisterMetaType<RegExpStatistics>()
     };
     Q_UNUSED(metatypes);
+    memset(&m_regExpStatistics, 0, sizeof(m_regExpStatistics));
+    m_sampler = nullptr;
     m_timer.start();
 }
 
+Profiler::~Profiler()
+{
+    if (m_sampler) {
+        m_sampler->stop();
+        delete m_sampler;
+    }
+}
+
 void Profiler::stopProfiling()
 {
+    // The snapshot walks the heap, so it can only be taken on the engine's thread
+    const bool takeHeapSnapshot = (featuresEnabled & (1 << FeatureHeapSnapshot))
+            && thread() == QThread::currentThread();
+    const bool reportRegExpStatistics = featuresEnabled & (1 << FeatureFunctionCall);
+    const bool reportSamples = featuresEnabled & (1 << FeatureSampling);
     featuresEnabled = 0;
+    if (m_sampler) {
+        m_sampler->stop();
+        delete m_sampler;
+        m_sampler = nullptr;
+        m_sampleRequested.store(0);
+    }
+    if (reportRegExpStatistics)
+        emit regExpStatisticsReady(m_timer.nsecsElapsed(), m_regExpStatistics);
+    if (reportSamples) {
+        emit samplesReady(m_timer.nsecsElapsed(), foldedSamples());
+        m_samples.clear();
+        m_sampledFunctions.clear();
+    }
+    if (takeHeapSnapshot) {
+        qint64 timestamp = m_timer.nsecsElapsed();
+        emit heapSnapshotReady(timestamp, m_engine->memoryManager->heapSnapshot());
+    }
     reportData(true);
     m_sentLocations.clear();
 }
@@ -134,8 +207,68 @@ void Profiler::startProfiling(quint64 features)
             m_memory_data.append(large);
         }
 
+        memset(&m_regExpStatistics, 0, sizeof(m_regExpStatistics));
         featuresEnabled = features;
+
+        if (features & (1 << FeatureSampling)) {
+            m_sampler = new Sampler(&m_sampleRequested);
+            m_sampler->start();
+        }
+    }
+}
+
+void Profiler::takeSample()
+{
+    m_sampleRequested.store(0);
+
+    QVector<quintptr> stack;
+    for (ExecutionContext *c = m_engine->currentContext; c; c = m_engine->parentContext(c)) {
+        // Catch and with contexts belong to the call context further up the stack
+        if (const SimpleCallContext *callContext = c->asSimpleCallContext()) {
+            Function *function = callContext->d()->v4Function;
+            if (!function)
+                continue;
+            const quintptr id = reinterpret_cast<quintptr>(function);
+            SentMarker &marker = m_sampledFunctions[id];
+            if (!marker.isValid())
+                marker.setFunction(function);
+            stack.append(id);
+        }
+    }
+    if (!stack.isEmpty())
+        ++m_samples[stack];
+}
+
+/*
+    Returns the samples in the "folded" format understood by flame graph tools:
+    one line per distinct stack, with the frames from the outermost to the
+    innermost one separated by semicolons, followed by the number of samples.
+*/
+QByteArray Profiler::foldedSamples() const
+{
+    QHash<quintptr, QByteArray> frames;
+    for (auto it = m_sampledFunctions.constBegin(), end = m_sampledFunctions.constEnd();
+         it != end; ++it) {
+        Function *function = it.value().function();
+        QString frame = function->name()->toQString();
+        if (frame.isEmpty())
+            frame = QStringLiteral("<anonymous>");
+        frame += QStringLiteral(" (%1:%2)").arg(function->compilationUnit->fileName())
+                .arg(function->compiledFunction->location.line);
+        frames.insert(it.key(), frame.replace(QLatin1Char(';'), QLatin1Char(',')).toUtf8());
+    }
+
+    QByteArray folded;
+    for (auto it = m_samples.constBegin(), end = m_samples.constEnd(); it != end; ++it) {
+        const QVector<quintptr> &stack = it.key();
+        for (int i = stack.size() - 1; i >= 0; --i) {
+            folded += frames.value(stack.at(i));
+            folded += i ? ';' : ' ';
+        }
+        folded += QByteArray::number(it.value());
+        folded += '\n';
     }
+    return folded;
 }
 
 } // namespace Profiling
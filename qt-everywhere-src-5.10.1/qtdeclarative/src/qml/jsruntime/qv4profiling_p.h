@@ -62,6 +62,7 @@
 #define Q_V4_PROFILE_ALLOC(engine, size, type) (!engine)
 #define Q_V4_PROFILE_DEALLOC(engine, size, type) (!engine)
 #define Q_V4_PROFILE(engine, function) (function->code(engine, function->codeData))
+#define Q_V4_PROFILE_REGEXP(engine, event) (!engine)
 
 QT_BEGIN_NAMESPACE
 
@@ -87,10 +88,16 @@ QT_END_NAMESPACE
 
 #define Q_V4_PROFILE(engine, function)\
     (Q_UNLIKELY(engine->profiler()) &&\
-            (engine->profiler()->featuresEnabled & (1 << Profiling::FeatureFunctionCall)) ?\
+            (engine->profiler()->featuresEnabled & ((1 << Profiling::FeatureFunctionCall) |\
+                                                    (1 << Profiling::FeatureSampling))) ?\
         Profiling::FunctionCallProfiler::profileCall(engine->profiler(), engine, function) :\
         function->code(engine, function->codeData))
 
+#define Q_V4_PROFILE_REGEXP(engine, event) \
+    (Q_UNLIKELY(engine->profiler()) &&\
+            (engine->profiler()->featuresEnabled & (1 << Profiling::FeatureFunctionCall)) ?\
+        engine->profiler()->trackRegExp(Profiling::event) : false)
+
 QT_BEGIN_NAMESPACE
 
 namespace QV4 {
@@ -99,7 +106,9 @@ namespace Profiling {
 
 enum Features {
     FeatureFunctionCall,
-    FeatureMemoryAllocation
+    FeatureMemoryAllocation,
+    FeatureHeapSnapshot,
+    FeatureSampling
 };
 
 enum MemoryType {
@@ -108,6 +117,22 @@ enum MemoryType {
     SmallItem
 };
 
+enum RegExpEvent {
+    RegExpCompiled,
+    RegExpJitCompiled,
+    RegExpReused,
+    RegExpMatched,
+    RegExpInterpreted
+};
+
+struct RegExpStatistics {
+    quint64 compiled;           // patterns compiled
+    quint64 jitCompiled;        // compiled patterns that got JIT code
+    quint64 reused;             // patterns found compiled in the thread's cache
+    quint64 matches;
+    quint64 interpretedMatches; // matches run by the bytecode interpreter
+};
+
 struct FunctionCallProperties {
     qint64 start;
     qint64 end;
@@ -183,6 +208,8 @@ private:
     qint64 m_end;
 };
 
+class Sampler;
+
 class Q_QML_EXPORT Profiler : public QObject {
     Q_OBJECT
 public:
@@ -222,11 +249,15 @@ public:
         bool isValid() const
         { return m_function != nullptr; }
 
+        Function *function() const
+        { return m_function; }
+
     private:
         Function *m_function;
     };
 
     Profiler(QV4::ExecutionEngine *engine);
+    ~Profiler();
 
     bool trackAlloc(size_t size, MemoryType type)
     {
@@ -250,6 +281,24 @@ public:
         }
     }
 
+    bool trackRegExp(RegExpEvent event)
+    {
+        switch (event) {
+        case RegExpCompiled: ++m_regExpStatistics.compiled; break;
+        case RegExpJitCompiled: ++m_regExpStatistics.jitCompiled; break;
+        case RegExpReused: ++m_regExpStatistics.reused; break;
+        case RegExpMatched: ++m_regExpStatistics.matches; break;
+        case RegExpInterpreted: ++m_regExpStatistics.interpretedMatches; break;
+        }
+        return true;
+    }
+
+    const RegExpStatistics &regExpStatistics() const { return m_regExpStatistics; }
+
+    bool sampleRequested() const { return m_sampleRequested.load(); }
+    void takeSample();
+    QByteArray foldedSamples() const;
+
     quint64 featuresEnabled;
 
     void stopProfiling();
@@ -261,6 +310,10 @@ signals:
     void dataReady(const QV4::Profiling::FunctionLocationHash &,
                    const QVector<QV4::Profiling::FunctionCallProperties> &,
                    const QVector<QV4::Profiling::MemoryAllocationProperties> &);
+    void heapSnapshotReady(qint64 timestamp, const QByteArray &snapshot);
+    void regExpStatisticsReady(qint64 timestamp,
+                               const QV4::Profiling::RegExpStatistics &statistics);
+    void samplesReady(qint64 timestamp, const QByteArray &foldedStacks);
 
 private:
     QV4::ExecutionEngine *m_engine;
@@ -268,6 +321,13 @@ private:
     QVector<FunctionCall> m_data;
     QVector<MemoryAllocationProperties> m_memory_data;
     QHash<quintptr, SentMarker> m_sentLocations;
+    RegExpStatistics m_regExpStatistics;
+
+    // Stacks of function ids sampled, innermost first, and how often each was seen
+    QHash<QVector<quintptr>, int> m_samples;
+    QHash<quintptr, SentMarker> m_sampledFunctions;
+    QAtomicInt m_sampleRequested;
+    Sampler *m_sampler;
 
     friend class FunctionCallProfiler;
 };
@@ -289,6 +349,10 @@ public:
 
     static ReturnedValue profileCall(Profiler *profiler, ExecutionEngine *engine, Function *function)
     {
+        if (profiler->sampleRequested())
+            profiler->takeSample();
+        if (!(profiler->featuresEnabled & (1 << FeatureFunctionCall)))
+            return function->code(engine, function->codeData);
         FunctionCallProfiler callProfiler(profiler, function);
         return function->code(engine, function->codeData);
     }
@@ -304,6 +368,7 @@ public:
 
 Q_DECLARE_TYPEINFO(QV4::Profiling::MemoryAllocationProperties, Q_MOVABLE_TYPE);
 Q_DECLARE_TYPEINFO(QV4::Profiling::FunctionCallProperties, Q_MOVABLE_TYPE);
+Q_DECLARE_TYPEINFO(QV4::Profiling::RegExpStatistics, Q_PRIMITIVE_TYPE);
 Q_DECLARE_TYPEINFO(QV4::Profiling::FunctionCall, Q_MOVABLE_TYPE);
 Q_DECLARE_TYPEINFO(QV4::Profiling::FunctionLocation, Q_MOVABLE_TYPE);
 Q_DECLARE_TYPEINFO(QV4::Profiling::Profiler::SentMarker, Q_MOVABLE_TYPE);
@@ -312,6 +377,7 @@ QT_END_NAMESPACE
 Q_DECLARE_METATYPE(QV4::Profiling::FunctionLocationHash)
 Q_DECLARE_METATYPE(QVector<QV4::Profiling::FunctionCallProperties>)
 Q_DECLARE_METATYPE(QVector<QV4::Profiling::MemoryAllocationProperties>)
+Q_DECLARE_METATYPE(QV4::Profiling::RegExpStatistics)
 
 #endif // QT_NO_QML_DEBUGGER
 
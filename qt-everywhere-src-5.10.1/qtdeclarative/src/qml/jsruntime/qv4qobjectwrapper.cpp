@@ -217,10 +217,24 @@ QQmlPropertyData *QObjectWrapper::findProperty(ExecutionEngine *engine, QObject
 
     QQmlData *ddata = QQmlData::get(o, false);
     QQmlPropertyData *result = 0;
-    if (ddata && ddata->propertyCache)
-        result = ddata->propertyCache->property(name, o, qmlContext);
-    else
+    if (ddata && ddata->propertyCache) {
+        // the context only matters for objects with a QML defined meta object
+        if (!ddata->hasVMEMetaObject) {
+            name->makeIdentifier();
+            Identifier *id = name->identifier();
+            QObjectLookupCache *cache = QObjectLookupCache::get(engine);
+            result = cache->find(ddata->propertyCache, id);
+            if (!result) {
+                result = ddata->propertyCache->property(name, o, qmlContext);
+                if (result)
+                    cache->insert(ddata->propertyCache, id, result);
+            }
+        } else {
+            result = ddata->propertyCache->property(name, o, qmlContext);
+        }
+    } else {
         result = QQmlPropertyCache::property(engine->jsEngine(), o, name, qmlContext, *local);
+    }
     return result;
 }
 
@@ -276,6 +276,62 @@ struct Q_QML_EXPORT QmlSignalHandler : public QV4::Object
     static void initProto(ExecutionEngine *v4);
 };
 
+/*
+    Remembers the property data that names resolved to in property caches.
+    Only used for objects without a QML defined meta object, as only their
+    property lookup doesn't depend on the calling QML context. The entries
+    keep a reference to their property cache, so that they can't match a
+    property cache that is created at the same address later.
+*/
+struct QObjectLookupCache {
+    enum { Size = 512 };
+    struct Entry {
+        QQmlPropertyCache *propertyCache;
+        Identifier *identifier;
+        QQmlPropertyData *property;
+    };
+
+    QObjectLookupCache() { memset(entries, 0, sizeof(entries)); }
+    ~QObjectLookupCache()
+    {
+        for (const Entry &e : entries) {
+            if (e.propertyCache)
+                e.propertyCache->release();
+        }
+    }
+
+    static QObjectLookupCache *get(ExecutionEngine *engine)
+    {
+        if (!engine->qobjectLookupCache)
+            engine->qobjectLookupCache = new QObjectLookupCache;
+        return engine->qobjectLookupCache;
+    }
+
+    static uint hash(const QQmlPropertyCache *cache, const Identifier *id)
+    { return uint((quintptr(cache) >> 4) ^ (quintptr(id) >> 3)) & (Size - 1); }
+
+    QQmlPropertyData *find(const QQmlPropertyCache *cache, const Identifier *id) const
+    {
+        const Entry &e = entries[hash(cache, id)];
+        return (e.propertyCache == cache && e.identifier == id) ? e.property : nullptr;
+    }
+
+    void insert(QQmlPropertyCache *cache, Identifier *id, QQmlPropertyData *property)
+    {
+        Entry &e = entries[hash(cache, id)];
+        if (e.propertyCache != cache) {
+            cache->addref();
+            if (e.propertyCache)
+                e.propertyCache->release();
+            e.propertyCache = cache;
+        }
+        e.identifier = id;
+        e.property = property;
+    }
+
+    Entry entries[Size];
+};
+
 class MultiplyWrappedQObjectMap : public QObject,
                                   private QHash<QObject*, QV4::WeakValue>
 {
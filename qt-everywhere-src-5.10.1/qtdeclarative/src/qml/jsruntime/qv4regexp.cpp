@@ -40,8 +40,11 @@
 #include "qv4regexp_p.h"
 #include "qv4engine_p.h"
 #include "qv4scopedvalue_p.h"
+#include "qv4profiling_p.h"
 #include <private/qv4mm_p.h>
 
+#include <QtCore/qthreadstorage.h>
+
 using namespace QV4;
 
 RegExpCache::~RegExpCache()
@@ -52,6 +55,135 @@ RegExpCache::~RegExpCache()
     }
 }
 
+namespace {
+struct RegExpCompilationCacheRef
+{
+    RegExpCompilationCacheRef(RegExpCompilationCache *cache) : cache(cache) {}
+    ~RegExpCompilationCacheRef() { cache->release(); }
+    RegExpCompilationCache *cache;
+};
+}
+
+Q_GLOBAL_STATIC(QThreadStorage<RegExpCompilationCacheRef *>, regExpCompilationCaches)
+
+RegExpCompilationCache::RegExpCompilationCache()
+    : refCount(1)
+{
+}
+
+RegExpCompilationCache::~RegExpCompilationCache()
+{
+    for (CompiledRegExp *compiled : qAsConst(patterns))
+        compiled->release();
+}
+
+/*
+    Returns the cache of the current thread with a reference taken for the caller.
+*/
+RegExpCompilationCache *RegExpCompilationCache::forCurrentThread()
+{
+    QThreadStorage<RegExpCompilationCacheRef *> *caches = regExpCompilationCaches();
+    if (!caches) // during static destruction
+        return new RegExpCompilationCache;
+    if (!caches->hasLocalData())
+        caches->setLocalData(new RegExpCompilationCacheRef(new RegExpCompilationCache));
+    RegExpCompilationCache *cache = caches->localData()->cache;
+    cache->addref();
+    return cache;
+}
+
+void RegExpCompilationCache::dropUnusedPatterns()
+{
+    for (auto it = patterns.begin(); it != patterns.end();) {
+        // Only the cache refers to the pattern. As references are only added
+        // with the mutex held, it cannot be picked up again meanwhile.
+        if (it.value()->refCount.load() == 1) {
+            it.value()->release();
+            it = patterns.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+CompiledRegExp::CompiledRegExp(const QString &pattern, bool ignoreCase, bool multiline, bool jit)
+    : refCount(1)
+    , pattern(pattern)
+    , byteCode(0)
+#if ENABLE(YARR_JIT)
+    , jitCode(0)
+#endif
+    , subPatternCount(0)
+    , ignoreCase(ignoreCase)
+    , multiLine(multiline)
+    , jit(jit)
+{
+}
+
+CompiledRegExp::~CompiledRegExp()
+{
+#if ENABLE(YARR_JIT)
+    delete jitCode;
+#endif
+    delete byteCode;
+}
+
+/*
+    Returns the compiled form of \a pattern with a reference taken for the
+    caller. Patterns are compiled once per thread and shared by all engines
+    running on it, also by engines that are created later on.
+*/
+CompiledRegExp *CompiledRegExp::get(ExecutionEngine *engine, const QString &pattern, bool ignoreCase, bool multiline)
+{
+    RegExpCompilationCache *cache = engine->regExpCompilationCache;
+    if (!cache)
+        cache = engine->regExpCompilationCache = RegExpCompilationCache::forCurrentThread();
+
+#if ENABLE(YARR_JIT)
+    const bool jit = engine->iselFactory->jitCompileRegexps();
+#else
+    const bool jit = false;
+#endif
+
+    QMutexLocker locker(&cache->mutex);
+    for (auto it = cache->patterns.constFind(pattern), end = cache->patterns.constEnd();
+         it != end && it.key() == pattern; ++it) {
+        CompiledRegExp *compiled = it.value();
+        if (compiled->ignoreCase == ignoreCase && compiled->multiLine == multiline
+                && compiled->jit == jit) {
+            compiled->addref();
+            Q_V4_PROFILE_REGEXP(engine, RegExpReused);
+            return compiled;
+        }
+    }
+
+    CompiledRegExp *compiled = new CompiledRegExp(pattern, ignoreCase, multiline, jit);
+    Q_V4_PROFILE_REGEXP(engine, RegExpCompiled);
+
+    const char* error = 0;
+    JSC::Yarr::YarrPattern yarrPattern(WTF::String(pattern), ignoreCase, multiline, &error);
+    if (!error) {
+        compiled->subPatternCount = yarrPattern.m_numSubpatterns;
+        OwnPtr<JSC::Yarr::BytecodePattern> p = JSC::Yarr::byteCompile(yarrPattern, &cache->bumpPointerAllocator);
+        compiled->byteCode = p.take();
+#if ENABLE(YARR_JIT)
+        compiled->jitCode = new JSC::Yarr::YarrCodeBlock;
+        if (!yarrPattern.m_containsBackreferences && jit) {
+            JSC::JSGlobalData dummy(&cache->executableAllocator);
+            JSC::Yarr::jitCompile(yarrPattern, JSC::Yarr::Char16, &dummy, *compiled->jitCode);
+            if (!compiled->jitCode->isFallBack() && compiled->jitCode->has16BitCode())
+                Q_V4_PROFILE_REGEXP(engine, RegExpJitCompiled);
+        }
+#endif
+    }
+
+    if (cache->patterns.size() >= RegExpCompilationCache::MaxPatterns)
+        cache->dropUnusedPatterns();
+    compiled->addref();
+    cache->patterns.insert(pattern, compiled);
+    return compiled;
+}
+
 DEFINE_MANAGED_VTABLE(RegExp);
 
 uint RegExp::match(const QString &string, int start, uint *matchOffsets)
@@ -60,12 +192,14 @@ uint RegExp::match(const QString &string, int start, uint *matchOffsets)
         return JSC::Yarr::offsetNoMatch;
 
     WTF::String s(string);
+    Q_V4_PROFILE_REGEXP(engine(), RegExpMatched);
 
 #if ENABLE(YARR_JIT)
     if (!jitCode()->isFallBack() && jitCode()->has16BitCode())
         return uint(jitCode()->execute(s.characters16(), start, s.length(), (int*)matchOffsets).start);
 #endif
 
+    Q_V4_PROFILE_REGEXP(engine(), RegExpInterpreted);
     return JSC::Yarr::interpret(byteCode(), s.characters16(), string.length(), start, matchOffsets);
 }
 
@@ -98,20 +232,8 @@ void Heap::RegExp::init(ExecutionEngine* engine, const QString &pattern, bool ig
     this->multiLine = multiline;
     this->global = global;
 
-    const char* error = 0;
-    JSC::Yarr::YarrPattern yarrPattern(WTF::String(pattern), ignoreCase, multiline, &error);
-    if (error)
-        return;
-    subPatternCount = yarrPattern.m_numSubpatterns;
-    OwnPtr<JSC::Yarr::BytecodePattern> p = JSC::Yarr::byteCompile(yarrPattern, engine->bumperPointerAllocator);
-    byteCode = p.take();
-#if ENABLE(YARR_JIT)
-    jitCode = new JSC::Yarr::YarrCodeBlock;
-    if (!yarrPattern.m_containsBackreferences && engine->iselFactory->jitCompileRegexps()) {
-        JSC::JSGlobalData dummy(engine->regExpAllocator);
-        JSC::Yarr::jitCompile(yarrPattern, JSC::Yarr::Char16, &dummy, *jitCode);
-    }
-#endif
+    compiled = CompiledRegExp::get(engine, pattern, ignoreCase, multiline);
+    subPatternCount = compiled->subPatternCount;
 }
 
 void Heap::RegExp::destroy()
@@ -120,10 +242,7 @@ void Heap::RegExp::destroy()
         RegExpCacheKey key(this);
         cache->remove(key);
     }
-#if ENABLE(YARR_JIT)
-    delete jitCode;
-#endif
-    delete byteCode;
+    compiled->release();
     delete pattern;
     Base::destroy();
 }
@@ -52,6 +52,8 @@
 
 #include <QString>
 #include <QVector>
+#include <QHash>
+#include <QMutex>
 
 #include <wtf/RefPtr.h>
 #include <wtf/FastAllocBase.h>
@@ -65,6 +67,7 @@
 
 #include "qv4managed_p.h"
 #include "qv4engine_p.h"
+#include "qv4executableallocator_p.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -72,6 +75,72 @@ namespace QV4 {
 
 struct ExecutionEngine;
 struct RegExpCacheKey;
+class RegExpCompilationCache;
+
+// The compiled form of a pattern. It only depends on the pattern and the
+// ignoreCase and multiline flags, and is shared by all engines of a thread
+// through the RegExpCompilationCache.
+struct CompiledRegExp
+{
+    CompiledRegExp(const QString &pattern, bool ignoreCase, bool multiline, bool jit);
+    ~CompiledRegExp();
+
+    static CompiledRegExp *get(ExecutionEngine *engine, const QString &pattern, bool ignoreCase, bool multiline);
+
+    void addref() { refCount.ref(); }
+    void release()
+    {
+        if (!refCount.deref())
+            delete this;
+    }
+
+    QAtomicInt refCount;
+    QString pattern;
+    JSC::Yarr::BytecodePattern *byteCode;
+#if ENABLE(YARR_JIT)
+    JSC::Yarr::YarrCodeBlock *jitCode;
+#endif
+    int subPatternCount;
+    bool ignoreCase;
+    bool multiLine;
+    bool jit;
+
+private:
+    Q_DISABLE_COPY(CompiledRegExp)
+};
+
+// Engines keep a reference to the cache of the thread they first compiled a
+// pattern on, so that the patterns stay valid as long as any engine uses them.
+// The cache holds a reference of its own to each pattern and drops unused ones
+// once it grows beyond MaxPatterns.
+class RegExpCompilationCache
+{
+public:
+    enum { MaxPatterns = 256 };
+
+    static RegExpCompilationCache *forCurrentThread();
+
+    void addref() { refCount.ref(); }
+    void release()
+    {
+        if (!refCount.deref())
+            delete this;
+    }
+
+private:
+    friend struct CompiledRegExp;
+
+    RegExpCompilationCache();
+    ~RegExpCompilationCache();
+    void dropUnusedPatterns();
+
+    QAtomicInt refCount;
+    QMutex mutex;
+    QMultiHash<QString, CompiledRegExp *> patterns;
+    // The interpreter's scratch memory, only used on the cache's thread
+    WTF::BumpPointerAllocator bumpPointerAllocator;
+    ExecutableAllocator executableAllocator;
+};
 
 namespace Heap {
 
@@ -80,10 +149,7 @@ struct RegExp : Base {
     void destroy();
 
     QString *pattern;
-    JSC::Yarr::BytecodePattern *byteCode;
-#if ENABLE(YARR_JIT)
-    JSC::Yarr::YarrCodeBlock *jitCode;
-#endif
+    CompiledRegExp *compiled;
     RegExpCache *cache;
     int subPatternCount;
     bool ignoreCase;
@@ -104,9 +170,9 @@ struct RegExp : public Managed
     V4_INTERNALCLASS(RegExp)
 
     QString pattern() const { return *d()->pattern; }
-    JSC::Yarr::BytecodePattern *byteCode() { return d()->byteCode; }
+    JSC::Yarr::BytecodePattern *byteCode() { return d()->compiled->byteCode; }
 #if ENABLE(YARR_JIT)
-    JSC::Yarr::YarrCodeBlock *jitCode() const { return d()->jitCode; }
+    JSC::Yarr::YarrCodeBlock *jitCode() const { return d()->compiled->jitCode; }
 #endif
     RegExpCache *cache() const { return d()->cache; }
     int subPatternCount() const { return d()->subPatternCount; }
@@ -116,7 +182,7 @@ struct RegExp : public Managed
 
     static Heap::RegExp *create(ExecutionEngine* engine, const QString& pattern, bool ignoreCase = false, bool multiline = false, bool global = false);
 
-    bool isValid() const { return d()->byteCode; }
+    bool isValid() const { return d()->compiled->byteCode; }
 
     uint match(const QString& string, int start, uint *matchOffsets);
 
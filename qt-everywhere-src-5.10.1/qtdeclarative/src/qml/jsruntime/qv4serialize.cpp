@@ -49,6 +49,8 @@
 #include <private/qv4sequenceobject_p.h>
 #include <private/qv4objectproto_p.h>
 #include <private/qv4qobjectwrapper_p.h>
+#include <private/qv4arraybuffer_p.h>
+#include <private/qv4typedarray_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -66,6 +68,8 @@ using namespace QV4;
 //    + Number
 //    + Date
 //    + RegExp
+//    + ArrayBuffer
+//    + TypedArray
 // <quint8 type><quint24 size><data>
 
 enum Type {
@@ -83,7 +87,9 @@ enum Type {
     WorkerDate,
     WorkerRegexp,
     WorkerListModel,
-    WorkerSequence
+    WorkerSequence,
+    WorkerArrayBuffer,
+    WorkerTypedArray
 };
 
 static inline quint32 valueheader(Type type, quint32 size = 0)
@@ -146,6 +152,28 @@ static inline void *popPtr(const char *&data)
 // serialization/deserialization failures
 
 #define ALIGN(size) (((size) + 3) & ~3)
+
+// The raw bytes are copied in one go, rather than element by element
+static inline void pushBytes(QByteArray &data, const char *bytes, uint length)
+{
+    reserve(data, sizeof(quint32) + ALIGN(length));
+    push(data, (quint32)length);
+
+    int offset = data.size();
+    data.resize(data.size() + ALIGN(length));
+    memcpy(data.data() + offset, bytes, length);
+}
+
+static inline Heap::ArrayBuffer *popArrayBuffer(const char *&data, ExecutionEngine *engine)
+{
+    quint32 length = popUint32(data);
+    Heap::ArrayBuffer *buffer = engine->newArrayBuffer(length);
+    if (buffer->data)
+        memcpy(buffer->data->data(), data, length);
+    data += ALIGN(length);
+    return buffer;
+}
+
 void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine *engine)
 {
     QV4::Scope scope(engine);
@@ -225,6 +253,18 @@ void Serialize::serialize(QByteArray &data, const QV4::Value &v, ExecutionEngine
         char *buffer = data.data() + offset;
 
         memcpy(buffer, pattern.constData(), length*sizeof(QChar));
+    } else if (const ArrayBuffer *buffer = v.as<ArrayBuffer>()) {
+        const QTypedArrayData<char> *bufferData = buffer->d()->data;
+        push(data, valueheader(WorkerArrayBuffer));
+        pushBytes(data, bufferData ? bufferData->data() : 0, bufferData ? bufferData->size : 0);
+    } else if (const TypedArray *array = v.as<TypedArray>()) {
+        // Only the viewed part of the buffer is sent
+        const QTypedArrayData<char> *bufferData = array->d()->buffer->data;
+        uint bufferLength = bufferData ? bufferData->size : 0;
+        uint offset = qMin(array->d()->byteOffset, bufferLength);
+        uint length = qMin(array->byteLength(), bufferLength - offset);
+        push(data, valueheader(WorkerTypedArray, array->arrayType()));
+        pushBytes(data, bufferData ? bufferData->data() + offset : 0, length);
     } else if (const QObjectWrapper *qobjectWrapper = v.as<QV4::QObjectWrapper>()) {
         // XXX TODO: Generalize passing objects between the main thread and worker scripts so
         // that others can trivially plug in their elements.
@@ -387,6 +427,18 @@ ReturnedValue Serialize::deserialize(const char *&data, ExecutionEngine *engine)
         QVariant seqVariant = QV4::SequencePrototype::toVariant(array, sequenceType, &succeeded);
         return QV4::SequencePrototype::fromVariant(engine, seqVariant, &succeeded);
     }
+    case WorkerArrayBuffer:
+        return popArrayBuffer(data, engine)->asReturnedValue();
+    case WorkerTypedArray:
+    {
+        Heap::TypedArray::Type arrayType = Heap::TypedArray::Type(headersize(header));
+        Scoped<ArrayBuffer> buffer(scope, popArrayBuffer(data, engine));
+        Scoped<TypedArray> array(scope, TypedArray::create(engine, arrayType));
+        array->d()->buffer.set(engine, buffer->d());
+        array->d()->byteLength = buffer->byteLength();
+        array->d()->byteOffset = 0;
+        return array.asReturnedValue();
+    }
     }
     Q_ASSERT(!"Unreachable");
     return QV4::Encode::undefined();
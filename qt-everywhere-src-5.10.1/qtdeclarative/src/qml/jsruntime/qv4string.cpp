@@ -59,7 +59,8 @@ void String::markObjects(Heap::Base *that, MarkStack *markStack)
     String::Data *s = static_cast<String::Data *>(that);
     if (s->largestSubLength) {
         s->left->mark(markStack);
-        s->right->mark(markStack);
+        if (s->right)
+            s->right->mark(markStack);
     }
 }
 
@@ -112,6 +113,29 @@ void Heap::String::init(String *l, String *r)
         simplifyString();
 }
 
+void Heap::String::init(String *base, uint offset, uint length)
+{
+    Base::init();
+
+    Q_ASSERT(length && offset + length <= base->len);
+    if (base->isSubstring()) {
+        offset += base->substringOffset;
+        base = base->left;
+    } else if (base->largestSubLength) {
+        base->simplifyString();
+    }
+    Q_ASSERT(!base->largestSubLength);
+
+    subtype = String::StringType_Unknown;
+
+    left = base;
+    right = 0;
+    stringHash = UINT_MAX;
+    largestSubLength = length;
+    len = length;
+    substringOffset = offset;
+}
+
 void Heap::String::destroy() {
     if (!largestSubLength) {
         internalClass->engine->memoryManager->changeUnmanagedHeapSizeUsage(qptrdiff(-text->size) * (int)sizeof(QChar));
@@ -172,7 +196,10 @@ void Heap::String::append(const String *data, QChar *ch)
         const String *item = worklist.back();
         worklist.pop_back();
 
-        if (item->largestSubLength) {
+        if (item->isSubstring()) {
+            memcpy(ch, item->left->text->data() + item->substringOffset, item->len * sizeof(QChar));
+            ch += item->len;
+        } else if (item->largestSubLength) {
             worklist.push_back(item->right);
             worklist.push_back(item->left);
         } else {
@@ -74,14 +74,18 @@ struct Q_QML_PRIVATE_EXPORT String : Base {
 #ifndef V4_BOOTSTRAP
     void init(const QString &text);
     void init(String *l, String *n);
+    void init(String *base, uint offset, uint length);
     void destroy();
     void simplifyString() const;
     int length() const {
         Q_ASSERT((largestSubLength &&
-                  (len == left->len + right->len)) ||
+                  (!right || len == left->len + right->len)) ||
                  len == (uint)text->size);
         return len;
     }
+    // A substring that shares the characters of the flat string in left
+    // until it gets simplified.
+    bool isSubstring() const { return largestSubLength && !right; }
     std::size_t retainedTextSize() const {
         return largestSubLength ? 0 : (std::size_t(text->size) * sizeof(QChar));
     }
@@ -126,6 +130,7 @@ struct Q_QML_PRIVATE_EXPORT String : Base {
     mutable uint stringHash;
     mutable uint largestSubLength;
     uint len;
+    uint substringOffset;
 private:
     static void append(const String *data, QChar *ch);
 #endif
@@ -197,9 +202,13 @@ struct Q_QML_PRIVATE_EXPORT String : public Managed {
 
     bool startsWithUpper() const {
         const String::Data *l = d();
-        while (l->largestSubLength)
+        uint offset = 0;
+        while (l->largestSubLength) {
+            if (l->isSubstring())
+                offset += l->substringOffset;
             l = l->left;
-        return l->text->size && QChar::isUpper(l->text->data()[0]);
+        }
+        return uint(l->text->size) > offset && QChar::isUpper(l->text->data()[offset]);
     }
 
     Identifier *identifier() const { return d()->identifier; }
@@ -222,6 +222,23 @@ static QString getThisString(Scope &scope, CallData *callData)
     return t->toQString();
 }
 
+// Long substrings share the characters of the string they are taken from
+// until they are read. Short ones, or ones that would keep a much larger
+// string alive, are copied right away.
+static Heap::String *newSubstring(Scope &scope, CallData *callData, const QString &text, int start, int count)
+{
+    if (count >= 32 && count < text.length() && count >= text.length() / 4) {
+        Heap::String *base = nullptr;
+        if (String *s = callData->thisObject.stringValue())
+            base = s->d();
+        else if (StringObject *o = callData->thisObject.as<StringObject>())
+            base = o->d()->string;
+        if (base)
+            return scope.engine->memoryManager->alloc<String>(base, uint(start), uint(count));
+    }
+    return scope.engine->newString(text.mid(start, count));
+}
+
 void StringPrototype::method_toString(const BuiltinFunction *, Scope &scope, CallData *callData)
 {
     if (callData->thisObject.isString())
@@ -676,7 +693,7 @@ void StringPrototype::method_slice(const BuiltinFunction *, Scope &scope, CallDa
     const int intEnd = int(end);
 
     int count = qMax(0, intEnd - intStart);
-    scope.result = scope.engine->newString(text.mid(intStart, count));
+    scope.result = newSubstring(scope, callData, text, intStart, count);
 }
 
 void StringPrototype::method_split(const BuiltinFunction *, Scope &scope, CallData *callData)
@@ -803,7 +820,7 @@ void StringPrototype::method_substr(const BuiltinFunction *, Scope &scope, CallD
 
     qint32 x = Primitive::toInt32(start);
     qint32 y = Primitive::toInt32(length);
-    scope.result = scope.engine->newString(value.mid(x, y));
+    scope.result = newSubstring(scope, callData, value, x, y);
 }
 
 void StringPrototype::method_substring(const BuiltinFunction *, Scope &scope, CallData *callData)
@@ -843,7 +860,7 @@ void StringPrototype::method_substring(const BuiltinFunction *, Scope &scope, Ca
 
     qint32 x = (int)start;
     qint32 y = (int)(end - start);
-    scope.result = scope.engine->newString(value.mid(x, y));
+    scope.result = newSubstring(scope, callData, value, x, y);
 }
 
 void StringPrototype::method_toLowerCase(const BuiltinFunction *, Scope &scope, CallData *callData)
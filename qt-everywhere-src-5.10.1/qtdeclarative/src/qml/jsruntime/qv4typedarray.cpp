@@ -40,7 +40,9 @@
 #include "qv4arraybuffer_p.h"
 #include "qv4string_p.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 using namespace QV4;
 
@@ -76,6 +78,25 @@ void UInt8ArrayWrite(ExecutionEngine *e, char *data, int index, const Value &val
     data[index] = v;
 }
 
+static unsigned char toUInt8Clamped(double d)
+{
+    // ### is there a way to optimise this?
+    if (d <= 0 || std::isnan(d))
+        return 0;
+    if (d >= 255)
+        return 255;
+    double f = std::floor(d);
+    if (f + 0.5 < d)
+        return (unsigned char)(f + 1);
+    if (d < f + 0.5)
+        return (unsigned char)(f);
+    if (int(f) % 2) {
+        // odd number
+        return (unsigned char)(f + 1);
+    }
+    return (unsigned char)(f);
+}
+
 void UInt8ClampedArrayWrite(ExecutionEngine *e, char *data, int index, const Value &value)
 {
     if (value.isInteger()) {
@@ -85,30 +106,7 @@ void UInt8ClampedArrayWrite(ExecutionEngine *e, char *data, int index, const Val
     double d = value.toNumber();
     if (e->hasException)
         return;
-    // ### is there a way to optimise this?
-    if (d <= 0 || std::isnan(d)) {
-        data[index] = 0;
-        return;
-    }
-    if (d >= 255) {
-        data[index] = (char)(255);
-        return;
-    }
-    double f = std::floor(d);
-    if (f + 0.5 < d) {
-        data[index] = (unsigned char)(f + 1);
-        return;
-    }
-    if (d < f + 0.5) {
-        data[index] = (unsigned char)(f);
-        return;
-    }
-    if (int(f) % 2) {
-        // odd number
-        data[index] = (unsigned char)(f + 1);
-        return;
-    }
-    data[index] = (unsigned char)(f);
+    data[index] = (char)toUInt8Clamped(d);
 }
 
 ReturnedValue Int16ArrayRead(const char *data, int index)
@@ -201,6 +199,223 @@ const TypedArrayOperations operations[Heap::TypedArray::NTypes] = {
     { 8, "Float64Array", Float64ArrayRead, Float64ArrayWrite },
 };
 
+namespace {
+
+// Native element types of the typed arrays. The builtins below use them to
+// operate on the buffer directly instead of going through a Value for every
+// element.
+template <typename T>
+struct SignedElement
+{
+    typedef T Type;
+    static T fromNumber(double d) { return T(Primitive::toInt32(d)); }
+};
+
+template <typename T>
+struct UnsignedElement
+{
+    typedef T Type;
+    static T fromNumber(double d) { return T(Primitive::toUInt32(d)); }
+};
+
+struct ClampedElement
+{
+    typedef unsigned char Type;
+    static Type fromNumber(double d) { return toUInt8Clamped(d); }
+};
+
+template <typename T>
+struct FloatElement
+{
+    typedef T Type;
+    static T fromNumber(double d) { return T(d); }
+};
+
+template <typename Op>
+void forElementType(Heap::TypedArray::Type type, Op &op)
+{
+    switch (type) {
+    case Heap::TypedArray::Int8Array:
+        op.template run<SignedElement<signed char> >();
+        break;
+    case Heap::TypedArray::UInt8Array:
+        op.template run<UnsignedElement<unsigned char> >();
+        break;
+    case Heap::TypedArray::UInt8ClampedArray:
+        op.template run<ClampedElement>();
+        break;
+    case Heap::TypedArray::Int16Array:
+        op.template run<SignedElement<short> >();
+        break;
+    case Heap::TypedArray::UInt16Array:
+        op.template run<UnsignedElement<unsigned short> >();
+        break;
+    case Heap::TypedArray::Int32Array:
+        op.template run<SignedElement<int> >();
+        break;
+    case Heap::TypedArray::UInt32Array:
+        op.template run<UnsignedElement<unsigned int> >();
+        break;
+    case Heap::TypedArray::Float32Array:
+        op.template run<FloatElement<float> >();
+        break;
+    case Heap::TypedArray::Float64Array:
+        op.template run<FloatElement<double> >();
+        break;
+    default:
+        Q_UNREACHABLE();
+    }
+}
+
+template <typename Dest>
+struct ConvertFrom
+{
+    typename Dest::Type *dest;
+    const char *src;
+    uint count;
+
+    template <typename Src>
+    void run()
+    {
+        const typename Src::Type *s = reinterpret_cast<const typename Src::Type *>(src);
+        for (uint i = 0; i < count; ++i)
+            dest[i] = Dest::fromNumber(s[i]);
+    }
+};
+
+struct ConvertElements
+{
+    char *dest;
+    const char *src;
+    Heap::TypedArray::Type srcType;
+    uint count;
+
+    template <typename Dest>
+    void run()
+    {
+        ConvertFrom<Dest> convert = { reinterpret_cast<typename Dest::Type *>(dest), src, count };
+        forElementType(srcType, convert);
+    }
+};
+
+struct FillElements
+{
+    char *data;
+    uint begin;
+    uint end;
+    double value;
+
+    template <typename T>
+    void run()
+    {
+        typename T::Type *d = reinterpret_cast<typename T::Type *>(data);
+        const typename T::Type v = T::fromNumber(value);
+        if (sizeof(v) == 1)
+            memset(d + begin, v, end - begin);
+        else
+            std::fill(d + begin, d + end, v);
+    }
+};
+
+struct FindElement
+{
+    const char *data;
+    uint from;
+    uint length;
+    double value;
+    int result;
+
+    template <typename T>
+    void run()
+    {
+        typedef typename T::Type Type;
+        // elements can only be strictly equal to numbers they can represent
+        if (std::numeric_limits<Type>::is_integer) {
+            if (!(value >= std::numeric_limits<Type>::min() && value <= std::numeric_limits<Type>::max()))
+                return;
+        } else if (std::isnan(value)
+                   || (std::isfinite(value) && std::fabs(value) > std::numeric_limits<Type>::max())) {
+            return;
+        }
+        const Type v = Type(value);
+        if (double(v) != value)
+            return;
+
+        const Type *d = reinterpret_cast<const Type *>(data);
+        if (sizeof(Type) == 1) {
+            // memchr is vectorized by the C library
+            const void *found = memchr(d + from, v, length - from);
+            if (found)
+                result = int(static_cast<const Type *>(found) - d);
+            return;
+        }
+        for (uint i = from; i < length; ++i) {
+            if (d[i] == v) {
+                result = int(i);
+                return;
+            }
+        }
+    }
+};
+
+template <typename T>
+struct SortLessThan
+{
+    bool operator()(T a, T b) const { return a < b; }
+};
+
+// NaNs are sorted to the end, and -0 before +0
+template <typename T>
+struct FloatSortLessThan
+{
+    bool operator()(T a, T b) const
+    {
+        if (std::isnan(a))
+            return false;
+        if (std::isnan(b))
+            return true;
+        if (a == b)
+            return std::signbit(a) && !std::signbit(b);
+        return a < b;
+    }
+};
+
+template <> struct SortLessThan<float> : FloatSortLessThan<float> {};
+template <> struct SortLessThan<double> : FloatSortLessThan<double> {};
+
+struct SortElements
+{
+    char *data;
+    uint length;
+
+    template <typename T>
+    void run()
+    {
+        typedef typename T::Type Type;
+        Type *d = reinterpret_cast<Type *>(data);
+        std::sort(d, d + length, SortLessThan<Type>());
+    }
+};
+
+struct CompareFunctionLessThan
+{
+    Scope &scope;
+    FunctionObject *comparefn;
+    CallData *callData;
+
+    bool operator()(double a, double b) const
+    {
+        if (scope.engine->hasException)
+            return false;
+        callData->args[0] = Encode(a);
+        callData->args[1] = Encode(b);
+        comparefn->call(scope, callData);
+        return scope.result.toNumber() < 0;
+    }
+};
+
+} // namespace
+
 
 void Heap::TypedArrayCtor::init(QV4::ExecutionContext *scope, TypedArray::Type t)
 {
@@ -433,6 +648,9 @@ void TypedArrayPrototype::init(ExecutionEngine *engine, TypedArrayCtor *ctor)
 
     defineDefaultProperty(QStringLiteral("set"), method_set, 1);
     defineDefaultProperty(QStringLiteral("subarray"), method_subarray, 0);
+    defineDefaultProperty(QStringLiteral("fill"), method_fill, 1);
+    defineDefaultProperty(QStringLiteral("indexOf"), method_indexOf, 1);
+    defineDefaultProperty(QStringLiteral("sort"), method_sort, 1);
 }
 
 void TypedArrayPrototype::method_get_buffer(const BuiltinFunction *, Scope &scope, CallData *callData)
@@ -543,15 +761,9 @@ void TypedArrayPrototype::method_set(const BuiltinFunction *, Scope &scope, Call
         src = srcCopy;
     }
 
-    // typed arrays of different kind, need to manually loop
-    uint srcElementSize = srcTypedArray->d()->type->bytesPerElement;
-    TypedArrayRead read = srcTypedArray->d()->type->read;
-    TypedArrayWrite write = a->d()->type->write;
-    for (uint i = 0; i < l; ++i) {
-        Primitive val;
-        val.setRawValue(read(src, i*srcElementSize));
-        write(scope.engine, dest, i*elementSize, val);
-    }
+    // typed arrays of different kind, convert the elements natively
+    ConvertElements convert = { dest, src, srcTypedArray->arrayType(), l };
+    forElementType(a->arrayType(), convert);
 
     if (srcCopy)
         delete [] srcCopy;
@@ -598,3 +810,109 @@ void TypedArrayPrototype::method_subarray(const BuiltinFunction *, Scope &scope,
     cData->args[2] = Encode(newLen);
     constructor->construct(scope, cData);
 }
+
+void TypedArrayPrototype::method_fill(const BuiltinFunction *, Scope &scope, CallData *callData)
+{
+    Scoped<TypedArray> a(scope, callData->thisObject);
+    if (!a)
+        THROW_TYPE_ERROR();
+
+    Scoped<ArrayBuffer> buffer(scope, a->d()->buffer);
+    if (!buffer)
+        THROW_TYPE_ERROR();
+
+    uint len = a->length();
+    double value = ScopedValue(scope, callData->argument(0))->toNumber();
+    double b = callData->argc > 1 ? callData->args[1].toInteger() : 0;
+    double e = callData->argc < 3 || callData->args[2].isUndefined() ? len : callData->args[2].toInteger();
+    if (scope.engine->hasException)
+        RETURN_UNDEFINED();
+
+    if (b < 0)
+        b = len + b;
+    uint begin = (uint)qBound(0., b, (double)len);
+    if (e < 0)
+        e = len + e;
+    uint end = (uint)qBound(0., e, (double)len);
+
+    if (begin < end) {
+        FillElements fill = { buffer->data() + a->d()->byteOffset, begin, end, value };
+        forElementType(a->arrayType(), fill);
+    }
+
+    scope.result = a;
+}
+
+void TypedArrayPrototype::method_indexOf(const BuiltinFunction *, Scope &scope, CallData *callData)
+{
+    Scoped<TypedArray> a(scope, callData->thisObject);
+    if (!a)
+        THROW_TYPE_ERROR();
+
+    Scoped<ArrayBuffer> buffer(scope, a->d()->buffer);
+    if (!buffer)
+        THROW_TYPE_ERROR();
+
+    uint len = a->length();
+    if (!len)
+        RETURN_RESULT(Encode(-1));
+
+    double f = callData->argc > 1 ? callData->args[1].toInteger() : 0;
+    if (scope.engine->hasException)
+        RETURN_UNDEFINED();
+    if (f >= len)
+        RETURN_RESULT(Encode(-1));
+    if (f < 0)
+        f = qMax(len + f, 0.);
+
+    // only numbers can be strictly equal to an element
+    ScopedValue searchValue(scope, callData->argument(0));
+    if (!searchValue->isNumber())
+        RETURN_RESULT(Encode(-1));
+
+    FindElement find = { buffer->constData() + a->d()->byteOffset, (uint)f, len, searchValue->toNumber(), -1 };
+    forElementType(a->arrayType(), find);
+    scope.result = Encode(find.result);
+}
+
+void TypedArrayPrototype::method_sort(const BuiltinFunction *, Scope &scope, CallData *callData)
+{
+    Scoped<TypedArray> a(scope, callData->thisObject);
+    if (!a)
+        THROW_TYPE_ERROR();
+
+    Scoped<ArrayBuffer> buffer(scope, a->d()->buffer);
+    if (!buffer)
+        THROW_TYPE_ERROR();
+
+    ScopedValue comparefn(scope, callData->argument(0));
+    ScopedFunctionObject f(scope, comparefn);
+    if (!comparefn->isUndefined() && !f)
+        THROW_TYPE_ERROR();
+
+    uint len = a->length();
+    char *data = buffer->data() + a->d()->byteOffset;
+    if (!f) {
+        SortElements sort = { data, len };
+        forElementType(a->arrayType(), sort);
+        RETURN_RESULT(a);
+    }
+
+    // Sort a copy of the elements as numbers, so that the compare function
+    // can not see partially sorted data.
+    QVector<double> numbers(len);
+    ConvertFrom<FloatElement<double> > read = { numbers.data(), data, len };
+    forElementType(a->arrayType(), read);
+
+    ScopedCallData cData(scope, 2);
+    cData->thisObject = Primitive::undefinedValue();
+    CompareFunctionLessThan lessThan = { scope, f.getPointer(), cData };
+    std::stable_sort(numbers.begin(), numbers.end(), lessThan);
+    if (scope.engine->hasException)
+        RETURN_UNDEFINED();
+
+    ConvertElements write = { buffer->data() + a->d()->byteOffset, reinterpret_cast<const char *>(numbers.constData()),
+                              Heap::TypedArray::Float64Array, len };
+    forElementType(a->arrayType(), write);
+    RETURN_RESULT(a);
+}
@@ -160,6 +160,9 @@ struct TypedArrayPrototype : Object
 
     static void method_set(const BuiltinFunction *, Scope &scope, CallData *callData);
     static void method_subarray(const BuiltinFunction *, Scope &scope, CallData *callData);
+    static void method_fill(const BuiltinFunction *, Scope &scope, CallData *callData);
+    static void method_indexOf(const BuiltinFunction *, Scope &scope, CallData *callData);
+    static void method_sort(const BuiltinFunction *, Scope &scope, CallData *callData);
 };
 
 inline void
@@ -42,6 +42,10 @@
 #include "qv4objectproto_p.h"
 #include "qv4mm_p.h"
 #include "qv4qobjectwrapper_p.h"
+#include "qv4objectiterator_p.h"
+#include "qv4functionobject_p.h"
+#include "qv4qmlcontext_p.h"
+#include <private/qqmlcontext_p.h>
 #include <QtCore/qalgorithms.h>
 #include <QtCore/private/qnumeric_p.h>
 #include <QtCore/qloggingcategory.h>
@@ -51,9 +55,15 @@
 #include "PageAllocationAligned.h"
 #include "StdLibExtras.h"
 
+#include <QDataStream>
 #include <QElapsedTimer>
 #include <QMap>
 #include <QScopedValueRollback>
+#include <QMutex>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+#include <QWaitCondition>
 
 #include <iostream>
 #include <cstdlib>
@@ -105,7 +115,9 @@ namespace QV4 {
 
 enum {
     MinSlotsGCLimit = QV4::Chunk::AvailableSlots*16,
-    GCOverallocation = 200 /* Max overallocation by the GC in % */
+    GCOverallocation = 200, /* Max overallocation by the GC in % */
+    MaxMarkThreads = 8,
+    ParallelMarkMinChunks = 64 /* smaller heaps are marked faster on one thread */
 };
 
 struct MemorySegment {
@@ -621,6 +633,7 @@ HeapItem *BlockAllocator::allocate(size_t size, bool forceAllocation) {
 
     HeapItem *m;
 
+retry:
     if (slotsRequired < NumBins - 1) {
         m = freeBins[slotsRequired];
         if (m) {
@@ -690,9 +703,19 @@ HeapItem *BlockAllocator::allocate(size_t size, bool forceAllocation) {
     }
 
     if (!m) {
-        if (!forceAllocation)
-            return 0;
-        Chunk *newChunk = chunkAllocator->allocate();
+        Chunk *newChunk;
+        if (!recycledChunks.empty()) {
+            // the memory is still committed, so reusing it doesn't grow the heap
+            newChunk = recycledChunks.back();
+            recycledChunks.pop_back();
+        } else {
+            // sweep the chunks left over from the last GC before growing the heap
+            if (sweepNextChunk())
+                goto retry;
+            if (!forceAllocation)
+                return 0;
+            newChunk = chunkAllocator->allocate();
+        }
         Q_V4_PROFILE_ALLOC(engine, Chunk::DataSize, Profiling::HeapPage);
         chunks.push_back(newChunk);
         nextFree = newChunk->first();
@@ -711,6 +734,17 @@ done:
 
 void BlockAllocator::sweep()
 {
+    startSweep();
+    finishSweep();
+}
+
+/*
+    Hands all chunks over to the lazy sweeper. The free lists are emptied, so that
+    the next allocations sweep chunk by chunk until they find enough space.
+*/
+void BlockAllocator::startSweep()
+{
+    Q_ASSERT(unsweptChunks.empty());
     nextFree = 0;
     nFree = 0;
     memset(freeBins, 0, sizeof(freeBins));
@@ -718,21 +752,40 @@ void BlockAllocator::sweep()
 //    qDebug() << "BlockAlloc: sweep";
     usedSlotsAfterLastSweep = 0;
 
-    auto isFree = [this] (Chunk *c) {
-        bool isUsed = c->sweep(engine);
+    // sweep in the original order, as chunks are taken from the back
+    unsweptChunks.assign(chunks.rbegin(), chunks.rend());
+    chunks.clear();
+}
 
-        if (isUsed) {
-            c->sortIntoBins(freeBins, NumBins);
-            usedSlotsAfterLastSweep += c->nUsedSlots();
-        } else {
-            Q_V4_PROFILE_DEALLOC(engine, Chunk::DataSize, Profiling::HeapPage);
+bool BlockAllocator::sweepNextChunk()
+{
+    if (unsweptChunks.empty())
+        return false;
+
+    Chunk *c = unsweptChunks.back();
+    unsweptChunks.pop_back();
+
+    if (c->sweep(engine)) {
+        c->resetBlackBits();
+        c->sortIntoBins(freeBins, NumBins);
+        usedSlotsAfterLastSweep += c->nUsedSlots();
+        chunks.push_back(c);
+    } else {
+        Q_V4_PROFILE_DEALLOC(engine, Chunk::DataSize, Profiling::HeapPage);
+        // the bitmaps of an empty chunk are all cleared, and allocated items get
+        // cleared by the memory manager, so the chunk can be reused as is
+        if (recycledChunks.size() < MaxRecycledChunks)
+            recycledChunks.push_back(c);
+        else
             chunkAllocator->free(c);
-        }
-        return !isUsed;
-    };
+    }
+    return true;
+}
 
-    auto newEnd = std::remove_if(chunks.begin(), chunks.end(), isFree);
-    chunks.erase(newEnd, chunks.end());
+void BlockAllocator::finishSweep()
+{
+    while (sweepNextChunk())
+        ;
 }
 
 void BlockAllocator::freeAll()
@@ -742,6 +795,9 @@ void BlockAllocator::freeAll()
         Q_V4_PROFILE_DEALLOC(engine, Chunk::DataSize, Profiling::HeapPage);
         chunkAllocator->free(c);
     }
+    for (auto c : recycledChunks)
+        chunkAllocator->free(c);
+    recycledChunks.clear();
 }
 
 void BlockAllocator::resetBlackBits()
@@ -842,6 +898,14 @@ MemoryManager::MemoryManager(ExecutionEngine *engine)
     memset(statistics.allocations, 0, sizeof(statistics.allocations));
     if (gcStats)
         blockAllocator.allocationStats = statistics.allocations;
+
+#ifndef QT_NO_THREAD
+    bool ok = false;
+    markThreads = qEnvironmentVariableIntValue("QV4_MM_MARK_THREADS", &ok);
+    if (!ok)
+        markThreads = QThread::idealThreadCount();
+    markThreads = qBound(1, markThreads, int(MaxMarkThreads));
+#endif
 }
 
 #ifdef MM_STATS
@@ -864,6 +928,9 @@ Heap::Base *MemoryManager::allocString(std::size_t unmanagedSize)
     }
 
     unmanagedHeapSize += unmanagedSize;
+    // strings that are still waiting to be swept hold on to their unmanaged memory
+    if (unmanagedHeapSize > unmanagedHeapSizeGCLimit && blockAllocator.isSweeping())
+        blockAllocator.finishSweep();
     if (unmanagedHeapSize > unmanagedHeapSizeGCLimit) {
         if (!didGCRun)
             runGC();
@@ -880,7 +947,7 @@ Heap::Base *MemoryManager::allocString(std::size_t unmanagedSize)
     HeapItem *m = blockAllocator.allocate(stringSize);
     if (!m) {
         if (!didGCRun && shouldRunGC())
-            runGC();
+            runGC(/*lazySweep*/true);
         m = blockAllocator.allocate(stringSize, true);
     }
 
@@ -916,7 +983,7 @@ Heap::Base *MemoryManager::allocData(std::size_t size)
     HeapItem *m = blockAllocator.allocate(size);
     if (!m) {
         if (!didRunGC && shouldRunGC())
-            runGC();
+            runGC(/*lazySweep*/true);
         m = blockAllocator.allocate(size, true);
     }
 
@@ -975,8 +1042,212 @@ MarkStack::MarkStack(ExecutionEngine *engine)
     limit = base + ExecutionEngine::GCStackLimit/sizeof(Heap::Base)*3/4;
 }
 
+MarkStack::MarkStack(ExecutionEngine *engine, Heap::Base **base, size_t size, ParallelMarker *parallelMarker)
+    : top(base), base(base), limit(base + size*3/4), engine(engine), parallelMarker(parallelMarker)
+{
+}
+
+#ifndef QT_NO_THREAD
+/*
+    Marks the heap on several threads. Every thread drains its own mark stack, and
+    hands half of it over to the shared work list when other threads run out of work.
+    The black bits are set atomically, so that every object is marked only once.
+
+    Only objects that are marked through their mark table or one of the known
+    markObjects() callbacks below are marked on the worker threads. All others (e.g.
+    QObject wrappers, which walk the QObject tree) are deferred to the engine thread.
+*/
+struct ParallelMarker
+{
+    enum {
+        WorkerStackSize = 256*1024,
+        ShareThreshold = 4*1024
+    };
+
+    ParallelMarker(MarkStack *engineStack)
+        : engineStack(engineStack)
+    {}
+
+    static bool canMarkConcurrently(Heap::Base *h)
+    {
+        auto markObjects = h->vtable()->markObjects;
+        return !markObjects || markObjects == Object::staticVTable()->markObjects
+                || markObjects == String::staticVTable()->markObjects
+                || markObjects == ForEachIteratorObject::staticVTable()->markObjects;
+    }
+
+    void run(MarkStack *markStack);
+    void drain(MarkStack *markStack);
+
+private:
+    void share(MarkStack *markStack);
+    void defer(Heap::Base *h);
+    bool takeWork(MarkStack *markStack);
+
+public:
+    MarkStack *engineStack;
+    QMutex mutex;
+    QWaitCondition workAvailable;
+    std::vector<Heap::Base *> sharedWork;
+    std::vector<Heap::Base *> deferredWork;
+    QAtomicInt idleThreads;
+    QAtomicInt markedObjects;
+    int threads = 0;
+    bool done = false;
+};
+
+void ParallelMarker::run(MarkStack *markStack)
+{
+    {
+        QMutexLocker locker(&mutex);
+        ++threads;
+    }
+    do {
+        drain(markStack);
+    } while (takeWork(markStack));
+}
+
+void ParallelMarker::drain(MarkStack *markStack)
+{
+    const bool engineThread = (markStack == engineStack);
+    int marked = 0;
+    while (markStack->top > markStack->base) {
+        Heap::Base *h = markStack->pop();
+        Q_ASSERT(h);
+        if (!engineThread && !canMarkConcurrently(h)) {
+            defer(h);
+            continue;
+        }
+        ++marked;
+        h->markChildren(markStack);
+
+        const qptrdiff depth = markStack->top - markStack->base;
+        if (depth > ShareThreshold || (depth > 1 && idleThreads.load()))
+            share(markStack);
+    }
+    markedObjects.fetchAndAddRelaxed(marked);
+}
+
+void ParallelMarker::share(MarkStack *markStack)
+{
+    const qptrdiff depth = markStack->top - markStack->base;
+    const qptrdiff n = depth/2;
+    QMutexLocker locker(&mutex);
+    sharedWork.insert(sharedWork.end(), markStack->base, markStack->base + n);
+    memmove(markStack->base, markStack->base + n, (depth - n)*sizeof(Heap::Base *));
+    markStack->top -= n;
+    workAvailable.wakeAll();
+}
+
+void ParallelMarker::defer(Heap::Base *h)
+{
+    QMutexLocker locker(&mutex);
+    deferredWork.push_back(h);
+    workAvailable.wakeAll();
+}
+
+bool ParallelMarker::takeWork(MarkStack *markStack)
+{
+    const bool engineThread = (markStack == engineStack);
+    QMutexLocker locker(&mutex);
+    for (;;) {
+        std::vector<Heap::Base *> *work = nullptr;
+        if (engineThread && !deferredWork.empty())
+            work = &deferredWork;
+        else if (!sharedWork.empty())
+            work = &sharedWork;
+        if (work) {
+            const size_t n = qMin(work->size(), size_t(ShareThreshold));
+            for (auto it = work->end() - n; it != work->end(); ++it)
+                markStack->push(*it);
+            work->erase(work->end() - n, work->end());
+            return true;
+        }
+        if (done)
+            return false;
+        if (idleThreads.load() + 1 == threads && deferredWork.empty()) {
+            done = true;
+            workAvailable.wakeAll();
+            return false;
+        }
+        idleThreads.ref();
+        workAvailable.wait(&mutex);
+        idleThreads.deref();
+    }
+}
+
+class MarkWorker : public QRunnable
+{
+public:
+    MarkWorker(ExecutionEngine *engine, ParallelMarker *marker)
+        : engine(engine), marker(marker)
+    {}
+
+    void run() override
+    {
+        QScopedArrayPointer<Heap::Base *> stack(new Heap::Base *[ParallelMarker::WorkerStackSize]);
+        MarkStack markStack(engine, stack.data(), ParallelMarker::WorkerStackSize, marker);
+        marker->run(&markStack);
+    }
+
+private:
+    ExecutionEngine *engine;
+    ParallelMarker *marker;
+};
+#endif // QT_NO_THREAD
+
+/*
+    Records the objects pushed onto the mark stack as the children of the
+    current node, instead of marking them. Every object gets a node the first
+    time it is seen, and its black bit is cleared again, so that it is pushed
+    for all of its retainers and no marks are left behind.
+*/
+struct HeapSnapshotCollector
+{
+    QHash<Heap::Base *, quint32> indices;
+    QVector<Heap::Base *> nodes;
+    QVector<quint32> edges;
+    quint32 current = 0;
+
+    HeapSnapshotCollector()
+    {
+        nodes.append(nullptr); // the GC roots
+    }
+
+    void collect(MarkStack *markStack)
+    {
+        while (markStack->top > markStack->base) {
+            Heap::Base *h = markStack->pop();
+            HeapItem *item = reinterpret_cast<HeapItem *>(h);
+            Chunk *c = item->chunk();
+            Chunk::clearBit(c->blackBitmap, item - c->realBase());
+
+            QHash<Heap::Base *, quint32>::const_iterator it = indices.constFind(h);
+            quint32 index;
+            if (it == indices.constEnd()) {
+                index = nodes.size();
+                indices.insert(h, index);
+                nodes.append(h);
+            } else {
+                index = *it;
+            }
+            edges << current << index;
+        }
+    }
+};
+
 void MarkStack::drain()
 {
+    if (snapshotCollector) {
+        snapshotCollector->collect(this);
+        return;
+    }
+#ifndef QT_NO_THREAD
+    if (parallelMarker) {
+        parallelMarker->drain(this);
+        return;
+    }
+#endif
     while (top > base) {
         Heap::Base *h = pop();
         ++markStackSize;
@@ -1037,9 +1308,38 @@ void MemoryManager::mark()
     MarkStack markStack(engine);
     collectRoots(&markStack);
 
+#ifndef QT_NO_THREAD
+    if (markThreads > 1 && blockAllocator.chunks.size() + hugeItemAllocator.chunks.size() >= ParallelMarkMinChunks) {
+        markInParallel(&markStack);
+        return;
+    }
+#endif
+
     markStack.drain();
 }
 
+void MemoryManager::markInParallel(MarkStack *markStack)
+{
+#ifndef QT_NO_THREAD
+    if (!markThreadPool) {
+        markThreadPool = new QThreadPool;
+        markThreadPool->setMaxThreadCount(markThreads - 1);
+    }
+
+    ParallelMarker marker(markStack);
+    markStack->parallelMarker = &marker;
+    for (int i = 0; i < markThreads - 1; ++i)
+        markThreadPool->start(new MarkWorker(engine, &marker));
+    marker.run(markStack);
+    // workers that started late return right away, but they still use the marker
+    markThreadPool->waitForDone();
+    markStack->parallelMarker = nullptr;
+    markStackSize += marker.markedObjects.load();
+#else
+    markStack->drain();
+#endif
+}
+
 void MemoryManager::sweep(bool lastSweep, ClassDestroyStatsCallback classCountPtr)
 {
     for (PersistentValueStorage::Iterator it = m_weakValues->begin(); it != m_weakValues->end(); ++it) {
@@ -1087,14 +1387,14 @@ void MemoryManager::sweep(bool lastSweep, ClassDestroyStatsCallback classCountPt
         }
     }
 
-    blockAllocator.sweep();
+    blockAllocator.startSweep();
     hugeItemAllocator.sweep(classCountPtr);
 }
 
 bool MemoryManager::shouldRunGC() const
 {
     size_t total = blockAllocator.totalSlots();
-    if (total > MinSlotsGCLimit && usedSlotsAfterLastFullSweep * GCOverallocation < total * 100)
+    if (total > MinSlotsGCLimit && blockAllocator.usedSlotsAfterLastSweep * GCOverallocation < total * 100)
         return true;
     return false;
 }
@@ -1128,7 +1428,11 @@ size_t dumpBins(BlockAllocator *b, bool printOutput = true)
     return totalSlotMem*Chunk::SlotSize;
 }
 
-void MemoryManager::runGC()
+/*
+    Marks the heap and sweeps it. With \a lazySweep, only the weak values and huge
+    items are swept right away, the chunks are swept by the following allocations.
+*/
+void MemoryManager::runGC(bool lazySweep)
 {
     if (gcBlocked) {
 //        qDebug() << "Not running GC.";
@@ -1138,6 +1442,9 @@ void MemoryManager::runGC()
     QScopedValueRollback<bool> gcBlocker(gcBlocked, true);
 //    qDebug() << "runGC";
 
+    // the black bits of chunks from the last GC have to be cleared before marking
+    blockAllocator.finishSweep();
+
     if (gcStats) {
         statistics.maxReservedMem = qMax(statistics.maxReservedMem, getAllocatedMem());
         statistics.maxAllocatedMem = qMax(statistics.maxAllocatedMem, getUsedMem() + getLargeItemsMem());
@@ -1146,6 +1453,8 @@ void MemoryManager::runGC()
     if (!gcCollectorStats) {
         mark();
         sweep();
+        if (!lazySweep || aggressiveGC)
+            blockAllocator.finishSweep();
     } else {
         bool triggeredByUnmanagedHeap = (unmanagedHeapSize > unmanagedHeapSizeGCLimit);
         size_t oldUnmanagedSize = unmanagedHeapSize;
@@ -1176,6 +1485,7 @@ void MemoryManager::runGC()
         qint64 markTime = t.nsecsElapsed()/1000;
         t.restart();
         sweep(false, increaseFreedCountForClass);
+        blockAllocator.finishSweep();
         const size_t usedAfter = getUsedMem();
         const size_t largeItemsAfter = getLargeItemsMem();
         qint64 sweepTime = t.nsecsElapsed()/1000;
@@ -1232,9 +1542,7 @@ void MemoryManager::runGC()
         Q_ASSERT(blockAllocator.allocatedMem() == getUsedMem() + dumpBins(&blockAllocator, false));
     }
 
-    usedSlotsAfterLastFullSweep = blockAllocator.usedSlotsAfterLastSweep;
-
-    // reset all black bits
+    // reset all black bits, the chunks still to be swept keep theirs until then
     blockAllocator.resetBlackBits();
     hugeItemAllocator.resetBlackBits();
 }
@@ -1260,11 +1568,17 @@ MemoryManager::~MemoryManager()
 
     dumpStats();
 
+    blockAllocator.finishSweep();
     sweep(/*lastSweep*/true);
+    blockAllocator.finishSweep();
     blockAllocator.freeAll();
     hugeItemAllocator.freeAll();
     stackAllocator.freeAll();
 
+#ifndef QT_NO_THREAD
+    delete markThreadPool;
+#endif
+
     delete m_weakValues;
 #ifdef V4_USE_VALGRIND
     VALGRIND_DESTROY_MEMPOOL(this);
@@ -1272,6 +1586,135 @@ MemoryManager::~MemoryManager()
     delete chunkAllocator;
 }
 
+static QString heapSnapshotName(Heap::Base *h)
+{
+    const Value v = Value::fromHeapObject(h);
+    if (const FunctionObject *f = v.as<FunctionObject>()) {
+        Function *function = f->function();
+        if (!function)
+            return QString();
+        return QStringLiteral("%1 (%2:%3)").arg(function->name()->toQString(),
+                                                function->sourceFile(),
+                                                QString::number(function->compiledFunction->location.line));
+    }
+    if (const QObjectWrapper *wrapper = v.as<QObjectWrapper>()) {
+        QObject *object = wrapper->object();
+        if (!object)
+            return QString();
+        QString name = QString::fromUtf8(object->metaObject()->className());
+        if (!object->objectName().isEmpty())
+            name += QLatin1Char(' ') + object->objectName();
+        QQmlData *ddata = QQmlData::get(object, false);
+        if (ddata && ddata->outerContext)
+            name += QStringLiteral(" (%1)").arg(ddata->outerContext->urlString());
+        return name;
+    }
+    if (const QQmlContextWrapper *wrapper = v.as<QQmlContextWrapper>()) {
+        QQmlContextData *context = wrapper->getContext();
+        return context ? context->urlString() : QString();
+    }
+    return QString();
+}
+
+/*
+    Runs a full garbage collection and returns a snapshot of the objects that
+    survived it, together with the references between them.
+
+    All numbers are written by a QDataStream, strings are UTF-8 encoded
+    QByteArrays:
+
+    \list
+    \li quint32 magic (0x51563448), quint32 version (1)
+    \li quint32 string count, followed by the strings
+    \li quint32 node count, followed by one quint64 address, quint32 type
+        (string index of the class name), quint32 name (string index, or
+        0xffffffff if there is none) and quint32 size in bytes per node
+    \li quint32 edge count, followed by one quint32 retainer and one quint32
+        retained node index per edge
+    \endlist
+
+    Node 0 stands for the GC roots. Function objects are named after the
+    function and its location, QObject wrappers after the object and the QML
+    context it was created in, and QML context wrappers after their URL.
+*/
+QByteArray MemoryManager::heapSnapshot()
+{
+    if (gcBlocked)
+        return QByteArray();
+
+    runGC();
+    blockAllocator.finishSweep();
+
+    QScopedValueRollback<bool> gcBlocker(gcBlocked, true);
+
+    HeapSnapshotCollector collector;
+    MarkStack markStack(engine);
+    markStack.snapshotCollector = &collector;
+    collectRoots(&markStack);
+    markStack.drain();
+    for (int i = 1; i < collector.nodes.size(); ++i) {
+        collector.current = i;
+        collector.nodes.at(i)->markChildren(&markStack);
+        markStack.drain();
+    }
+
+    // Items in huge and stack chunks don't have their size in the extends bitmap
+    QHash<Chunk *, size_t> chunkItemSizes;
+    for (const HugeItemAllocator::HugeChunk &c : hugeItemAllocator.chunks)
+        chunkItemSizes.insert(c.chunk, c.size);
+    for (Chunk *c : stackAllocator.chunks)
+        chunkItemSizes.insert(c, stackAllocator.requiredSlots * Chunk::SlotSize);
+
+    QVector<QByteArray> strings;
+    QHash<const char *, quint32> typeIndices;
+    QHash<QString, quint32> nameIndices;
+    const quint32 noName = 0xffffffff;
+
+    QByteArray nodeData;
+    QDataStream nodeStream(&nodeData, QIODevice::WriteOnly);
+    for (int i = 0; i < collector.nodes.size(); ++i) {
+        Heap::Base *h = collector.nodes.at(i);
+        const char *className = h ? h->vtable()->className : "(GC roots)";
+        QHash<const char *, quint32>::const_iterator type = typeIndices.constFind(className);
+        if (type == typeIndices.constEnd()) {
+            type = typeIndices.insert(className, strings.size());
+            strings.append(QByteArray(className));
+        }
+
+        quint32 nameIndex = noName;
+        const QString name = h ? heapSnapshotName(h) : QString();
+        if (!name.isEmpty()) {
+            QHash<QString, quint32>::const_iterator it = nameIndices.constFind(name);
+            if (it == nameIndices.constEnd()) {
+                it = nameIndices.insert(name, strings.size());
+                strings.append(name.toUtf8());
+            }
+            nameIndex = *it;
+        }
+
+        quint32 size = 0;
+        if (h) {
+            HeapItem *item = reinterpret_cast<HeapItem *>(h);
+            QHash<Chunk *, size_t>::const_iterator it = chunkItemSizes.constFind(item->chunk());
+            size = quint32(it != chunkItemSizes.constEnd() ? *it : item->size());
+        }
+
+        nodeStream << quint64(quintptr(h)) << *type << nameIndex << size;
+    }
+
+    QByteArray snapshot;
+    QDataStream stream(&snapshot, QIODevice::WriteOnly);
+    stream << quint32(0x51563448) << quint32(1);
+    stream << quint32(strings.size());
+    for (const QByteArray &string : qAsConst(strings))
+        stream << string;
+    stream << quint32(collector.nodes.size());
+    stream.writeRawData(nodeData.constData(), nodeData.size());
+    stream << quint32(collector.edges.size() / 2);
+    for (quint32 index : qAsConst(collector.edges))
+        stream << index;
+    return snapshot;
+}
 
 void MemoryManager::dumpStats() const
 {
@@ -1287,6 +1730,8 @@ void MemoryManager::dumpStats() const
     for (int i = 1; i < BlockAllocator::NumBins - 1; ++i)
         qDebug(stats) << "     <" << (i << Chunk::SlotSizeShift) << " bytes: " << statistics.allocations[i];
     qDebug(stats) << "     >=" << ((BlockAllocator::NumBins - 1) << Chunk::SlotSizeShift) << " bytes: " << statistics.allocations[BlockAllocator::NumBins - 1];
+    qDebug(stats) << "Internal classes:" << engine->classPool->classCount
+                  << "with" << engine->classPool->transitionCount << "transitions";
 }
 
 void MemoryManager::collectFromJSStack(MarkStack *markStack) const
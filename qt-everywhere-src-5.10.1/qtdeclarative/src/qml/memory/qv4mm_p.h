@@ -66,6 +66,8 @@
 
 QT_BEGIN_NAMESPACE
 
+class QThreadPool;
+
 namespace QV4 {
 
 struct ChunkAllocator;
@@ -122,7 +124,10 @@ struct BlockAllocator {
         memset(freeBins, 0, sizeof(freeBins));
     }
 
-    enum { NumBins = 8 };
+    enum {
+        NumBins = 8,
+        MaxRecycledChunks = 8
+    };
 
     static inline size_t binForSlots(size_t nSlots) {
         return nSlots >= NumBins ? NumBins - 1 : nSlots;
@@ -131,20 +136,27 @@ struct BlockAllocator {
     HeapItem *allocate(size_t size, bool forceAllocation = false);
 
     size_t totalSlots() const {
-        return Chunk::AvailableSlots*chunks.size();
+        return Chunk::AvailableSlots*(chunks.size() + unsweptChunks.size());
     }
 
     size_t allocatedMem() const {
-        return chunks.size()*Chunk::DataSize;
+        return (chunks.size() + unsweptChunks.size())*Chunk::DataSize;
     }
     size_t usedMem() const {
         uint used = 0;
         for (auto c : chunks)
             used += c->nUsedSlots()*Chunk::SlotSize;
+        for (auto c : unsweptChunks)
+            used += c->nUsedSlots()*Chunk::SlotSize;
         return used;
     }
 
+    bool isSweeping() const { return !unsweptChunks.empty(); }
+
     void sweep();
+    void startSweep();
+    bool sweepNextChunk();
+    void finishSweep();
     void freeAll();
     void resetBlackBits();
     void collectGrayItems(MarkStack *markStack);
@@ -157,6 +169,12 @@ struct BlockAllocator {
     ChunkAllocator *chunkAllocator;
     ExecutionEngine *engine;
     std::vector<Chunk *> chunks;
+    // chunks that have been marked, but not yet swept. They are swept on demand
+    // by allocate(), so that the cost of sweeping is spread over the allocations.
+    std::vector<Chunk *> unsweptChunks;
+    // chunks in which all objects died. Short lived objects tend to fill and free
+    // whole chunks, so these are kept for bump allocation instead of being decommitted.
+    std::vector<Chunk *> recycledChunks;
     uint *allocationStats = nullptr;
 };
 
@@ -425,10 +443,12 @@ public:
         return t->d();
     }
 
-    void runGC();
+    void runGC(bool lazySweep = false);
 
     void dumpStats() const;
 
+    QByteArray heapSnapshot();
+
     size_t getUsedMem() const;
     size_t getAllocatedMem() const;
     size_t getLargeItemsMem() const;
@@ -445,6 +465,7 @@ protected:
 private:
     void collectFromJSStack(MarkStack *markStack) const;
     void mark();
+    void markInParallel(MarkStack *markStack);
     void sweep(bool lastSweep = false, ClassDestroyStatsCallback classCountPtr = nullptr);
     bool shouldRunGC() const;
     void collectRoots(MarkStack *markStack);
@@ -461,12 +482,13 @@ public:
 
     std::size_t unmanagedHeapSize = 0; // the amount of bytes of heap that is not managed by the memory manager, but which is held onto by managed items.
     std::size_t unmanagedHeapSizeGCLimit;
-    std::size_t usedSlotsAfterLastFullSweep = 0;
 
     bool gcBlocked = false;
     bool aggressiveGC = false;
     bool gcStats = false;
     bool gcCollectorStats = false;
+    int markThreads = 1;
+    QThreadPool *markThreadPool = nullptr;
 
     struct {
         size_t maxReservedMem = 0;
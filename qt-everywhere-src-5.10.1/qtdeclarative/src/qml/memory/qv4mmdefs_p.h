@@ -53,6 +53,7 @@
 #include <private/qv4global_p.h>
 #include <private/qv4runtimeapi_p.h>
 #include <QtCore/qalgorithms.h>
+#include <QtCore/qatomic.h>
 #include <qdebug.h>
 
 QT_BEGIN_NAMESPACE
@@ -60,6 +61,8 @@ QT_BEGIN_NAMESPACE
 namespace QV4 {
 
 struct MarkStack;
+struct ParallelMarker;
+struct HeapSnapshotCollector;
 
 typedef void(*ClassDestroyStatsCallback)(const char *);
 
@@ -129,6 +132,12 @@ struct Chunk {
         quintptr bit = bitForIndex(index);
         *bitmap |= bit;
     }
+    // returns whether the bit was already set
+    static Q_ALWAYS_INLINE bool testAndSetBitAtomic(quintptr *bitmap, quintptr bit) {
+        Q_STATIC_ASSERT(sizeof(QAtomicInteger<quintptr>) == sizeof(quintptr));
+        QAtomicInteger<quintptr> *word = reinterpret_cast<QAtomicInteger<quintptr> *>(bitmap);
+        return (word->load() & bit) || (word->fetchAndOrRelaxed(bit) & bit);
+    }
     static void clearBit(quintptr *bitmap, size_t index) {
 //        Q_ASSERT(index >= HeaderSize/SlotSize && index < ChunkSize/SlotSize);
         bitmap += bitmapIndex(index);
@@ -273,10 +282,13 @@ Q_STATIC_ASSERT((1 << Chunk::BitShift) == Chunk::Bits);
 
 struct MarkStack {
     MarkStack(ExecutionEngine *engine);
+    MarkStack(ExecutionEngine *engine, Heap::Base **base, size_t size, ParallelMarker *parallelMarker);
     Heap::Base **top = 0;
     Heap::Base **base = 0;
     Heap::Base **limit = 0;
     ExecutionEngine *engine;
+    ParallelMarker *parallelMarker = nullptr; // set while marking on several threads
+    HeapSnapshotCollector *snapshotCollector = nullptr; // set while taking a heap snapshot
     void push(Heap::Base *m) {
         *top = m;
         ++top;
@@ -86,7 +86,8 @@ public:
 
     void insert(int idx, const T &v) {
         if (m_count == m_capacity) {
-            m_capacity += Increment;
+            // Grow geometrically so that appending n items stays linear
+            m_capacity += qMax(int(Increment), m_capacity / 2);
             m_data = (T *)realloc(m_data, m_capacity * sizeof(T));
         }
         int moveCount = m_count - idx;
@@ -107,6 +107,7 @@ protected:
     friend class QQmlData;
     friend class QQmlValueTypeProxyBinding;
     friend class QQmlObjectCreator;
+    friend class QQmlEnginePrivate;
 
     inline void setAddedToObject(bool v);
     inline bool isAddedToObject() const;
@@ -135,6 +135,53 @@ void QQmlBinding::setNotifyOnValueChanged(bool v)
     QQmlJavaScriptExpression::setNotifyOnValueChanged(v);
 }
 
+static bool isPropertyChainName(const QString &name)
+{
+    // destroy() and toString() are provided by the QObject wrapper itself
+    if (name.isEmpty() || name == QLatin1String("destroy") || name == QLatin1String("toString"))
+        return false;
+    for (int i = 0; i < name.length(); ++i) {
+        const QChar c = name.at(i);
+        if (!c.isLetter() && c != QLatin1Char('_') && c != QLatin1Char('$') && (i == 0 || !c.isDigit()))
+            return false;
+    }
+    return true;
+}
+
+/*
+    Lets the binding read \a chain, such as "parent.width", directly from the
+    properties involved instead of calling its function. The compiler marks
+    such bindings with QV4::CompiledData::Binding::IsPropertyChain.
+
+    The function is still used whenever the chain can't be followed exactly
+    the way JavaScript would, for example if an object in the chain is null,
+    or if the value needs to be converted to the type of the target property.
+*/
+void QQmlBinding::setPropertyChain(const QString &chain)
+{
+    m_propertyChain.clear();
+
+    QStringList names = chain.split(QLatin1Char('.'));
+    for (QString &name : names) {
+        name = name.trimmed();
+        if (!isPropertyChainName(name))
+            return;
+    }
+
+    // Imported types and scripts as well as the properties of the global object
+    // are found before any QML property of the same name.
+    const QString &first = names.first();
+    if (first.at(0).isUpper())
+        return;
+    QV4::ExecutionEngine *v4 = QQmlEnginePrivate::getV4Engine(context()->engine);
+    QV4::Scope scope(v4);
+    QV4::ScopedString name(scope, v4->newIdentifier(first));
+    if (v4->globalObject->hasProperty(name))
+        return;
+
+    m_propertyChain = names;
+}
+
 void QQmlBinding::update(QQmlPropertyData::WriteFlags flags)
 {
     if (!enabledFlag() || !context() || !context()->isValid())
@@ -201,14 +248,23 @@ protected:
         auto ep = QQmlEnginePrivate::get(scope.engine);
         ep->referenceScarceResources();
 
-        bool isUndefined = false;
+        bool error = false;
+        QVariant value;
+        if (evaluatePropertyChain(&value)) {
+            if (!watcher.wasDeleted() && isAddedToObject() && !hasError()) {
+                QQmlPropertyData *pd = nullptr;
+                getPropertyData(&pd, nullptr);
+                error = !pd->writeProperty(targetObject(), value.data(), flags);
+            }
+        } else {
+            bool isUndefined = false;
 
-        QV4::ScopedCallData callData(scope);
-        QQmlJavaScriptExpression::evaluate(callData, &isUndefined, scope);
+            QV4::ScopedCallData callData(scope);
+            QQmlJavaScriptExpression::evaluate(callData, &isUndefined, scope);
 
-        bool error = false;
-        if (!watcher.wasDeleted() && isAddedToObject() && !hasError())
-            error = !write(scope.result, isUndefined, flags);
+            if (!watcher.wasDeleted() && isAddedToObject() && !hasError())
+                error = !write(scope.result, isUndefined, flags);
+        }
 
         if (!watcher.wasDeleted()) {
 
@@ -454,6 +510,156 @@ Q_NEVER_INLINE bool QQmlBinding::slowWrite(const QQmlPropertyData &core,
     return true;
 }
 
+// Returns true if the binding was evaluated or deleted without running its function.
+bool QQmlBinding::evaluatePropertyChain(QVariant *result)
+{
+    // Once the function has registered permanent dependencies, keep using it, so
+    // that no property is captured twice.
+    if (m_propertyChain.isEmpty() || !permanentGuards.isEmpty() || m_targetIndex.hasValueTypeIndex())
+        return false;
+
+    QQmlEnginePrivate *ep = QQmlEnginePrivate::get(context()->engine);
+    if (ep->v4engine()->debugger())
+        return false;
+
+    QQmlPropertyData *targetProperty = nullptr;
+    getPropertyData(&targetProperty, nullptr);
+    if (!targetProperty->isFullyResolved() || targetProperty->isVarProperty() || targetProperty->isQList())
+        return false;
+
+    // Urls are resolved relative to the binding's context when written, and
+    // QVariant and QJSValue properties take whatever the function returns.
+    const int targetType = targetProperty->propType();
+    if (targetType == QMetaType::QUrl || targetType == QMetaType::QVariant
+        || targetType == qMetaTypeId<QJSValue>()) {
+        return false;
+    }
+
+    DeleteWatcher watcher(this);
+    QQmlPropertyCapture capture(context()->engine, this, &watcher);
+    QQmlPropertyCapture *lastPropertyCapture = ep->propertyCapture;
+    ep->propertyCapture = notifyOnValueChanged() ? &capture : 0;
+
+    if (notifyOnValueChanged())
+        capture.guards.copyAndClearPrepend(activeGuards);
+
+    const bool read = readPropertyChain(ep, targetType, watcher, result);
+
+    if (capture.errorString) {
+        // The function reports these itself when we fall back to it
+        if (read) {
+            for (int ii = 0; ii < capture.errorString->count(); ++ii)
+                qWarning("%s", qPrintable(capture.errorString->at(ii)));
+        }
+        delete capture.errorString;
+        capture.errorString = 0;
+    }
+
+    while (QQmlJavaScriptExpressionGuard *g = capture.guards.takeFirst())
+        g->Delete();
+
+    ep->propertyCapture = lastPropertyCapture;
+
+    if (watcher.wasDeleted())
+        return true;
+    if (read && hasDelayedError())
+        delayedError()->clearError();
+    return read;
+}
+
+bool QQmlBinding::readPropertyChain(QQmlEnginePrivate *ep, int targetType, const DeleteWatcher &watcher,
+                                    QVariant *result) const
+{
+    QQmlContextData *ctxt = context();
+    QQmlPropertyData local;
+    auto findProperty = [&](QObject *object, const QString &name) -> QQmlPropertyData * {
+        if (QQmlData::wasDeleted(object))
+            return nullptr;
+        QQmlData *ddata = QQmlData::get(object, false);
+        if (!ddata || !ddata->propertyCache)
+            return QQmlPropertyCache::property(ctxt->engine, object, name, ctxt, local);
+        QQmlPropertyData *property = ddata->propertyCache->property(name, object, ctxt);
+        if (property && property->hasRevision() && !ddata->propertyCache->isAllowedInRevision(property))
+            return nullptr;
+        return property;
+    };
+
+    // Look up the first name like QQmlContextWrapper does: for each context, the
+    // ids and context properties, then the scope object, then the context object.
+    const QString &first = m_propertyChain.first();
+    QObject *object = nullptr;
+    QQmlPropertyData *property = nullptr;
+    int index = 0;
+    QObject *scope = scopeObject();
+    for (QQmlContextData *c = ctxt; c; c = c->parent) {
+        const QV4::IdentifierHash<int> &names = c->propertyNames();
+        const int propertyIdx = names.count() ? names.value(first) : -1;
+        if (propertyIdx != -1) {
+            if (propertyIdx >= c->idValueCount)
+                return false;
+            if (ep->propertyCapture)
+                ep->propertyCapture->captureProperty(&c->idValues[propertyIdx].bindings);
+            object = c->idValues[propertyIdx];
+            index = 1;
+            break;
+        }
+        if (scope && (property = findProperty(scope, first))) {
+            object = scope;
+            break;
+        }
+        scope = nullptr;
+        if (c->contextObject && (property = findProperty(c->contextObject, first))) {
+            object = c->contextObject;
+            break;
+        }
+    }
+
+    for (;;) {
+        if (!object)
+            return false;
+        if (!property) {
+            // A chain that ends with an id is converted by the function
+            if (index == m_propertyChain.count())
+                return false;
+            property = findProperty(object, m_propertyChain.at(index));
+            if (!property)
+                return false;
+        }
+        if (property->isFunction() || property->isVarProperty() || property->isQList()
+            || !property->isFullyResolved()) {
+            return false;
+        }
+
+        QQmlData::flushPendingBinding(object, QQmlPropertyIndex(property->coreIndex()));
+        if (watcher.wasDeleted() || QQmlData::wasDeleted(object))
+            return false;
+
+        if (ep->propertyCapture && !property->isConstant())
+            ep->propertyCapture->captureProperty(object, property->coreIndex(), property->notifyIndex());
+
+        if (++index == m_propertyChain.count())
+            break;
+
+        if (!property->isQObject())
+            return false;
+        QObject *next = nullptr;
+        property->readProperty(object, &next);
+        object = next;
+        property = nullptr;
+    }
+
+    const int type = property->propType();
+    if (type == targetType) {
+        *result = QVariant(type, nullptr);
+        property->readProperty(object, result->data());
+        return true;
+    } else if (type == QMetaType::QVariant) {
+        property->readProperty(object, result);
+        return result->userType() == targetType;
+    }
+    return false;
+}
+
 QVariant QQmlBinding::evaluate()
 {
     QQmlEnginePrivate *ep = QQmlEnginePrivate::get(context()->engine);
@@ -481,6 +687,11 @@ QString QQmlBinding::expressionIdentifier() const
 
 void QQmlBinding::expressionChanged()
 {
+    if (context() && context()->engine) {
+        QQmlEnginePrivate *ep = QQmlEnginePrivate::get(context()->engine);
+        if (ep->deferBindingUpdates && ep->deferBindingUpdate(this, isAddedToObject()))
+            return;
+    }
     update();
 }
 
@@ -85,6 +85,7 @@ public:
     void setTarget(QObject *, const QQmlPropertyData &, const QQmlPropertyData *valueType);
 
     void setNotifyOnValueChanged(bool);
+    void setPropertyChain(const QString &chain);
 
     void refresh() Q_DECL_OVERRIDE;
 
@@ -121,6 +122,8 @@ protected:
     bool slowWrite(const QQmlPropertyData &core, const QQmlPropertyData &valueTypeData,
                    const QV4::Value &result, bool isUndefined, QQmlPropertyData::WriteFlags flags);
 
+    bool evaluatePropertyChain(QVariant *result);
+
 private:
     inline bool updatingFlag() const;
     inline void setUpdatingFlag(bool);
@@ -128,6 +131,11 @@ private:
     inline void setEnabledFlag(bool);
 
     static QQmlBinding *newBinding(QQmlEnginePrivate *engine, const QQmlPropertyData *property);
+
+    bool readPropertyChain(QQmlEnginePrivate *ep, int targetType, const DeleteWatcher &watcher,
+                           QVariant *result) const;
+
+    QStringList m_propertyChain;
 };
 
 bool QQmlBinding::updatingFlag() const
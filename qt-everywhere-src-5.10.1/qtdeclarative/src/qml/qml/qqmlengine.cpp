@@ -93,6 +93,10 @@
 #include <private/qquickworkerscript_p.h>
 #include <private/qqmlinstantiator_p.h>
 #include <private/qqmlloggingcategory_p.h>
+#include <private/qv4compilationunitbundle_p.h>
+#include <private/qqmlbinding_p.h>
+
+#include <algorithm>
 
 #ifdef Q_OS_WIN // for %APPDATA%
 #  include <qt_windows.h>
@@ -675,6 +679,8 @@ QQmlEnginePrivate::QQmlEnginePrivate(QQmlEngine *e)
 #endif
   outputWarningsToMsgLog(true),
   cleanup(0), erroredBindings(0), inProgressCreations(0),
+  deferBindingUpdates(qEnvironmentVariableIntValue("QML_DEFERRED_BINDING_UPDATES") > 0),
+  currentBindingDepth(-1),
   workerScriptEngine(0),
   activeObjectCreator(0),
 #if QT_CONFIG(qml_network)
@@ -690,6 +696,10 @@ QQmlEnginePrivate::~QQmlEnginePrivate()
     if (inProgressCreations)
         qWarning() << QQmlEngine::tr("There are still \"%1\" items in the process of being created at engine destruction.").arg(inProgressCreations);
 
+    for (const QQmlAbstractBinding::Ptr &binding : qAsConst(dirtyBindings))
+        static_cast<QQmlBinding *>(binding.data())->m_updatePending = false;
+    dirtyBindings.clear();
+
     while (cleanup) {
         QQmlCleanup *c = cleanup;
         cleanup = c->next;
@@ -955,6 +965,9 @@ void QQmlEnginePrivate::init()
 
     v8engine()->setEngine(q);
 
+    // Map the cache bundle, if any, before the first component is loaded.
+    QV4::CompilationUnitBundle::instance();
+
     rootContext = new QQmlContext(q,true);
 }
 
@@ -1488,6 +1501,8 @@ bool QQmlEngine::event(QEvent *e)
     Q_D(QQmlEngine);
     if (e->type() == QEvent::User)
         d->doDeleteInEngineThread();
+    else if (e->type() == QQmlEnginePrivate::deferredBindingsEvent())
+        d->flushDeferredBindings();
     else if (e->type() == QEvent::LanguageChange) {
         retranslate();
     }
@@ -1506,6 +1521,81 @@ void QQmlEnginePrivate::doDeleteInEngineThread()
         delete d;
 }
 
+QEvent::Type QQmlEnginePrivate::deferredBindingsEvent()
+{
+    static const QEvent::Type type = QEvent::Type(QEvent::registerEventType());
+    return type;
+}
+
+/*
+    Marks \a binding dirty instead of evaluating it right away. Returns false
+    if the binding has to be evaluated immediately, because it is not part of
+    its target object (anymore).
+*/
+bool QQmlEnginePrivate::deferBindingUpdate(QQmlBinding *binding, bool addedToObject)
+{
+    Q_ASSERT(deferBindingUpdates);
+
+    // A binding dirtied by the evaluation of another one is evaluated after it
+    // from then on. This approximates a topological order of the binding
+    // graph without having to store it.
+    if (currentBindingDepth >= 0 && binding->m_updateDepth <= currentBindingDepth)
+        binding->m_updateDepth = quint16(qMin(currentBindingDepth + 1, 0xffff));
+
+    if (binding->m_updatePending)
+        return true;
+    if (!addedToObject)
+        return false;
+
+    binding->m_updatePending = true;
+    if (dirtyBindings.isEmpty() && currentBindingDepth < 0)
+        QCoreApplication::postEvent(q_func(), new QEvent(deferredBindingsEvent()));
+    dirtyBindings.append(QQmlAbstractBinding::Ptr(binding));
+    return true;
+}
+
+/*
+    Evaluates all dirty bindings, each of them once. Bindings dirtied in the
+    process are evaluated in further passes.
+*/
+void QQmlEnginePrivate::flushDeferredBindings()
+{
+    if (currentBindingDepth >= 0)
+        return; // already flushing
+
+    const int MaxPasses = 1000;
+    int passes = 0;
+    while (!dirtyBindings.isEmpty()) {
+        QVector<QQmlAbstractBinding::Ptr> bindings;
+        bindings.swap(dirtyBindings);
+
+        if (++passes > MaxPasses) {
+            for (const QQmlAbstractBinding::Ptr &b : qAsConst(bindings))
+                static_cast<QQmlBinding *>(b.data())->m_updatePending = false;
+            qWarning("QQmlEngine: Deferred bindings keep changing each other, giving up");
+            break;
+        }
+
+        std::stable_sort(bindings.begin(), bindings.end(),
+                         [](const QQmlAbstractBinding::Ptr &a, const QQmlAbstractBinding::Ptr &b) {
+            return static_cast<QQmlBinding *>(a.data())->m_updateDepth
+                    < static_cast<QQmlBinding *>(b.data())->m_updateDepth;
+        });
+
+        for (const QQmlAbstractBinding::Ptr &b : qAsConst(bindings)) {
+            QQmlBinding *binding = static_cast<QQmlBinding *>(b.data());
+            if (!binding->m_updatePending)
+                continue;
+            binding->m_updatePending = false;
+            if (!binding->isAddedToObject())
+                continue;
+            currentBindingDepth = binding->m_updateDepth;
+            binding->update();
+        }
+        currentBindingDepth = -1;
+    }
+}
+
 namespace QtQml {
 
 void qmlExecuteDeferred(QObject *object)
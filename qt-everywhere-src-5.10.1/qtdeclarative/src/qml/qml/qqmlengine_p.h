@@ -62,6 +62,7 @@
 #include "qqmlcontext_p.h"
 #include "qqmlexpression.h"
 #include "qqmlproperty_p.h"
+#include "qqmlabstractbinding_p.h"
 #include "qqmlpropertycache_p.h"
 #include "qqmlmetatype_p.h"
 #include "qqmldirparser_p.h"
@@ -93,6 +94,7 @@ class QNetworkAccessManager;
 class QQmlNetworkAccessManagerFactory;
 class QQmlTypeNameCache;
 class QQmlComponentAttached;
+class QQmlBinding;
 class QQmlCleanup;
 class QQmlDelayedError;
 class QQuickWorkerScriptEngine;
@@ -150,6 +152,16 @@ public:
     QQmlDelayedError *erroredBindings;
     int inProgressCreations;
 
+    // With deferred binding updates (QML_DEFERRED_BINDING_UPDATES), bindings
+    // whose dependencies changed are only marked dirty and evaluated together,
+    // once per event loop iteration and before a window syncs its scene graph.
+    bool deferBindingUpdates;
+    int currentBindingDepth;
+    QVector<QQmlAbstractBinding::Ptr> dirtyBindings;
+    bool deferBindingUpdate(QQmlBinding *binding, bool addedToObject);
+    void flushDeferredBindings();
+    static QEvent::Type deferredBindingsEvent();
+
     QV8Engine *v8engine() const { return q_func()->handle(); }
     QV4::ExecutionEngine *v4engine() const { return QV8Engine::getV4(q_func()->handle()); }
 
@@ -174,6 +174,7 @@ private:
     friend class QQmlPropertyCapture;
     friend void QQmlJavaScriptExpressionGuard_callback(QQmlNotifierEndpoint *, void **);
     friend class QQmlTranslationBinding;
+    friend class QQmlEnginePrivate;
 
     QQmlDelayedError *m_error;
 
@@ -181,6 +182,9 @@ private:
     QQmlJavaScriptExpression **m_prevExpression;
     QQmlJavaScriptExpression  *m_nextExpression;
     bool m_permanentDependenciesRegistered = false;
+    // Only used by deferred binding updates, see QQmlEnginePrivate::deferBindingUpdate()
+    bool m_updatePending = false;
+    quint16 m_updateDepth = 0;
 
     QV4::PersistentValue m_qmlScope;
     QQmlRefPointer<QV4::CompiledData::CompilationUnit> m_compilationUnit;
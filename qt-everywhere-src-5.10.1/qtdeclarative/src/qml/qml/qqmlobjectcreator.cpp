@@ -905,6 +905,8 @@ bool QQmlObjectCreator::setPropertyBinding(const QQmlPropertyData *property, con
             } else {
                 QV4::Function *runtimeFunction = compilationUnit->runtimeFunctions[binding->value.compiledScriptIndex];
                 qmlBinding = QQmlBinding::create(prop, runtimeFunction, _scopeObject, context, currentQmlContext());
+                if (binding->flags & QV4::CompiledData::Binding::IsPropertyChain)
+                    qmlBinding->setPropertyChain(stringAt(binding->stringIndex));
             }
             qmlBinding->setTarget(_bindingTarget, *prop, subprop);
 
@@ -51,6 +51,7 @@
 #include <private/qqmlpropertyvalidator_p.h>
 #include <private/qqmlpropertycachecreator_p.h>
 #include <private/qdeferredcleanup_p.h>
+#include <private/qv4compilationunitbundle_p.h>
 
 #include <QtCore/qdir.h>
 #include <QtCore/qfile.h>
@@ -58,6 +59,8 @@
 #include <QtCore/qdebug.h>
 #include <QtCore/qmutex.h>
 #include <QtCore/qthread.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qsemaphore.h>
 #include <QtQml/qqmlfile.h>
 #include <QtCore/qdiriterator.h>
 #include <QtQml/qqmlcomponent.h>
@@ -102,6 +105,7 @@
 DEFINE_BOOL_CONFIG_OPTION(dumpErrors, QML_DUMP_ERRORS);
 DEFINE_BOOL_CONFIG_OPTION(disableDiskCache, QML_DISABLE_DISK_CACHE);
 DEFINE_BOOL_CONFIG_OPTION(forceDiskCache, QML_FORCE_DISK_CACHE);
+DEFINE_BOOL_CONFIG_OPTION(disableParallelParsing, QML_DISABLE_PARALLEL_PARSING);
 
 Q_DECLARE_LOGGING_CATEGORY(DBG_DISK_CACHE)
 Q_LOGGING_CATEGORY(DBG_DISK_CACHE, "qt.qml.diskcache")
@@ -119,6 +123,53 @@ namespace {
     };
 }
 
+/*
+    Reads and parses a QML source file into a QmlIR::Document. The job only
+    touches its own members, so it can run on any thread. The loader thread
+    starts jobs for the composite types a component depends on before it
+    loads them one after another, and each load then picks up its result.
+*/
+class QQmlTypeLoader::ParseJob : public QRunnable
+{
+public:
+    ParseJob(const QQmlDataBlob::SourceCodeData &source, const QString &finalUrl,
+             const QSet<QString> &illegalNames, bool debugMode)
+        : source(source), finalUrl(finalUrl), illegalNames(illegalNames), debugMode(debugMode)
+        , parsed(false)
+    {
+        setAutoDelete(false);
+    }
+
+    void run() override
+    {
+        parse();
+        finished.release();
+    }
+
+    void parse()
+    {
+        document.reset(new QmlIR::Document(debugMode));
+        const QString code = source.readAll(&sourceError);
+        if (!sourceError.isEmpty())
+            return;
+        QmlIR::IRBuilder compiler(illegalNames);
+        parsed = compiler.generateFromQml(code, finalUrl, document.data());
+        if (!parsed)
+            errors = compiler.errors;
+    }
+
+    const QQmlDataBlob::SourceCodeData source;
+    const QString finalUrl;
+    const QSet<QString> illegalNames;
+    const bool debugMode;
+
+    QScopedPointer<QmlIR::Document> document;
+    QString sourceError;
+    QList<QQmlJS::DiagnosticMessage> errors;
+    bool parsed;
+    QSemaphore finished;
+};
+
 #if QT_CONFIG(qml_network)
 // This is a lame object that we need to ensure that slots connected to
 // QNetworkReply get called in the correct thread (the loader thread).
@@ -1325,6 +1376,91 @@ void QQmlTypeLoader::shutdownThread()
         m_thread->shutdown();
 }
 
+/*
+    Starts parsing the local QML files at \a urls on the global thread pool,
+    unless they are loaded already or will likely be loaded from a cache.
+    Only worthwhile when there is more than one file, as the loader thread
+    waits for the first one right away.
+*/
+void QQmlTypeLoader::prefetchTypes(const QVector<QUrl> &urls)
+{
+    ASSERT_LOADTHREAD();
+
+    if (urls.size() < 2 || disableParallelParsing() || m_engine->urlInterceptor())
+        return;
+
+    QV4::ExecutionEngine *v4 = QV8Engine::getV4(m_engine);
+    const bool debugMode = v4->debugger() != 0;
+    const bool diskCacheEnabled = !debugMode && (!disableDiskCache() || forceDiskCache());
+    const QV4::CompilationUnitBundle *bundle = QV4::CompilationUnitBundle::instance();
+
+    QVector<ParseJob *> jobs;
+    {
+        LockHolder<QQmlTypeLoader> holder(this);
+        for (const QUrl &url : urls) {
+            if (!QQmlFile::isSynchronous(url) || m_typeCache.contains(url) || m_parseJobs.contains(url))
+                continue;
+            if (QQmlMetaType::findCachedCompilationUnit(url))
+                continue;
+
+            const QString fileName = QQmlFile::urlToLocalFileOrQrc(url);
+            if (diskCacheEnabled && ((bundle && bundle->unitForSource(fileName))
+                                     || QFile::exists(fileName + QLatin1Char('c')))) {
+                continue;
+            }
+
+            QQmlDataBlob::SourceCodeData source;
+            source.fileInfo = QFileInfo(fileName);
+            ParseJob *job = new ParseJob(source, url.toString(), v4->v8Engine->illegalNames(), debugMode);
+            m_parseJobs.insert(url, job);
+            jobs.append(job);
+        }
+    }
+
+    QThreadPool *pool = QThreadPool::globalInstance();
+    for (ParseJob *job : qAsConst(jobs))
+        pool->start(job);
+}
+
+/*
+    Returns the finished parse job for \a url, or null if none was started.
+    A job that is still queued is parsed right here instead of waiting for a
+    pool thread to pick it up.
+*/
+QQmlTypeLoader::ParseJob *QQmlTypeLoader::takeParseJob(const QUrl &url)
+{
+    ParseJob *job = nullptr;
+    {
+        LockHolder<QQmlTypeLoader> holder(this);
+        if (m_parseJobs.isEmpty())
+            return nullptr;
+        job = m_parseJobs.take(url);
+    }
+    if (!job)
+        return nullptr;
+
+    if (QThreadPool::globalInstance()->tryTake(job))
+        job->parse();
+    else
+        job->finished.acquire();
+    return job;
+}
+
+void QQmlTypeLoader::clearParseJobs()
+{
+    QHash<QUrl, ParseJob *> jobs;
+    {
+        LockHolder<QQmlTypeLoader> holder(this);
+        jobs.swap(m_parseJobs);
+    }
+
+    for (ParseJob *job : qAsConst(jobs)) {
+        if (!QThreadPool::globalInstance()->tryTake(job))
+            job->finished.acquire();
+        delete job;
+    }
+}
+
 QQmlTypeLoader::Blob::Blob(const QUrl &url, QQmlDataBlob::Type type, QQmlTypeLoader *loader)
   : QQmlDataBlob(url, type, loader), m_importCache(loader)
 {
@@ -1966,6 +2102,8 @@ and qmldir information.
 */
 void QQmlTypeLoader::clearCache()
 {
+    clearParseJobs();
+
     for (TypeCache::Iterator iter = m_typeCache.begin(), end = m_typeCache.end(); iter != end; ++iter)
         (*iter)->release();
     for (ScriptCache::Iterator iter = m_scriptCache.begin(), end = m_scriptCache.end(); iter != end; ++iter)
@@ -2452,22 +2590,28 @@ void QQmlTypeData::initializeFromCachedUnit(const QQmlPrivate::CachedQmlUnit *un
 
 bool QQmlTypeData::loadFromSource()
 {
-    m_document.reset(new QmlIR::Document(isDebugging()));
+    QScopedPointer<QQmlTypeLoader::ParseJob> job(typeLoader()->takeParseJob(url()));
+    if (job && (job->finalUrl != finalUrlString() || job->debugMode != isDebugging()))
+        job.reset();
+    if (!job) {
+        QQmlEngine *qmlEngine = typeLoader()->engine();
+        job.reset(new QQmlTypeLoader::ParseJob(m_backupSourceCode, finalUrlString(),
+                                               QV8Engine::get(qmlEngine)->illegalNames(), isDebugging()));
+        job->parse();
+    }
+
+    m_document.reset(job->document.take());
     m_document->jsModule.sourceTimeStamp = m_backupSourceCode.sourceTimeStamp();
-    QQmlEngine *qmlEngine = typeLoader()->engine();
-    QmlIR::IRBuilder compiler(QV8Engine::get(qmlEngine)->illegalNames());
 
-    QString sourceError;
-    const QString source = m_backupSourceCode.readAll(&sourceError);
-    if (!sourceError.isEmpty()) {
-        setError(sourceError);
+    if (!job->sourceError.isEmpty()) {
+        setError(job->sourceError);
         return false;
     }
 
-    if (!compiler.generateFromQml(source, finalUrlString(), m_document.data())) {
+    if (!job->parsed) {
         QList<QQmlError> errors;
-        errors.reserve(compiler.errors.count());
-        for (const QQmlJS::DiagnosticMessage &msg : qAsConst(compiler.errors)) {
+        errors.reserve(job->errors.count());
+        for (const QQmlJS::DiagnosticMessage &msg : qAsConst(job->errors)) {
             QQmlError e;
             e.setUrl(url());
             e.setLine(msg.loc.startLine);
@@ -2692,10 +2836,6 @@ void QQmlTypeData::resolveTypes()
                          QQmlType::AnyRegistrationType) && reportErrors)
             return;
 
-        if (ref.type.isComposite()) {
-            ref.typeData = typeLoader()->getType(ref.type.sourceUrl());
-            addDependency(ref.typeData);
-        }
         ref.majorVersion = majorVersion;
         ref.minorVersion = minorVersion;
 
@@ -2707,6 +2847,22 @@ void QQmlTypeData::resolveTypes()
         m_resolvedTypes.insert(unresolvedRef.key(), ref);
     }
 
+    // Load the composite types only once all of them are known, so that
+    // their sources can be parsed in parallel. They are still loaded and
+    // compiled in the same order as before.
+    QVector<QUrl> compositeUrls;
+    for (const TypeReference &ref : qAsConst(m_resolvedTypes)) {
+        if (ref.type.isComposite())
+            compositeUrls.append(ref.type.sourceUrl());
+    }
+    typeLoader()->prefetchTypes(compositeUrls);
+    for (TypeReference &ref : m_resolvedTypes) {
+        if (ref.type.isComposite()) {
+            ref.typeData = typeLoader()->getType(ref.type.sourceUrl());
+            addDependency(ref.typeData);
+        }
+    }
+
     // ### this allows enums to work without explicit import or instantiation of the type
     if (!m_implicitImportLoaded)
         loadImplicitImport();
@@ -335,6 +335,7 @@ public:
 
 private:
     friend class QQmlDataBlob;
+    friend class QQmlTypeData;
     friend class QQmlTypeLoaderThread;
 #if QT_CONFIG(qml_network)
     friend class QQmlTypeLoaderNetworkReplyProxy;
@@ -342,6 +343,11 @@ private:
 
     void shutdownThread();
 
+    class ParseJob;
+    void prefetchTypes(const QVector<QUrl> &urls);
+    ParseJob *takeParseJob(const QUrl &url);
+    void clearParseJobs();
+
     void loadThread(QQmlDataBlob *);
     void loadWithStaticDataThread(QQmlDataBlob *, const QByteArray &);
     void loadWithCachedUnitThread(QQmlDataBlob *blob, const QQmlPrivate::CachedQmlUnit *unit);
@@ -395,6 +401,7 @@ private:
     QmldirCache m_qmldirCache;
     ImportDirCache m_importDirCache;
     ImportQmlDirCache m_importQmlDirCache;
+    QHash<QUrl, ParseJob *> m_parseJobs;
 
     template<typename Loader>
     void doLoad(const Loader &loader, QQmlDataBlob *blob, Mode mode);
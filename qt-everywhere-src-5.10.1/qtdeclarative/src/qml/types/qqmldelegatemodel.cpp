@@ -264,7 +264,8 @@ QQmlDelegateModel::~QQmlDelegateModel()
 {
     Q_D(QQmlDelegateModel);
 
-    for (QQmlDelegateModelItem *cacheItem : qAsConst(d->m_cache)) {
+    const QList<QQmlDelegateModelItem *> items = d->m_cache + d->m_reusableItemsPool;
+    for (QQmlDelegateModelItem *cacheItem : items) {
         if (cacheItem->object) {
             delete cacheItem->object;
 
@@ -375,6 +376,7 @@ void QQmlDelegateModel::setModel(const QVariant &model)
     if (d->m_complete)
         _q_itemsRemoved(0, d->m_count);
 
+    d->drainReusableItemsPool(0);
     d->m_adaptorModel.setModel(model, this, d->m_context->engine());
     d->m_adaptorModel.replaceWatchedRoles(QList<QByteArray>(), d->m_watchedRoles);
     for (int i = 0; d->m_parts && i < d->m_parts->models.count(); ++i) {
@@ -411,6 +413,7 @@ void QQmlDelegateModel::setDelegate(QQmlComponent *delegate)
     bool wasValid = d->m_delegate != 0;
     d->m_delegate = delegate;
     d->m_delegateValidated = false;
+    d->drainReusableItemsPool(0);
     if (wasValid && d->m_complete) {
         for (int i = 1; i < d->m_groupCount; ++i) {
             QQmlDelegateModelGroupPrivate::get(d->m_groups[i])->changeSet.remove(
@@ -534,22 +537,34 @@ int QQmlDelegateModel::count() const
     return d->m_compositor.count(d->m_compositorGroup);
 }
 
-QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *object)
+QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *object, QQmlInstanceModel::ReusableFlag reusableFlag)
 {
+    Q_Q(QQmlDelegateModel);
     QQmlDelegateModel::ReleaseFlags stat = 0;
     if (!object)
         return stat;
 
     if (QQmlDelegateModelItem *cacheItem = QQmlDelegateModelItem::dataForObject(object)) {
         if (cacheItem->releaseObject()) {
-            cacheItem->destroyObject();
-            emitDestroyingItem(object);
-            if (cacheItem->incubationTask) {
-                releaseIncubator(cacheItem->incubationTask);
-                cacheItem->incubationTask = 0;
+            // An item can only be pooled if nothing but the view refers to it, as it will
+            // show a different row once it is reused.
+            if (reusableFlag == QQmlInstanceModel::Reusable
+                    && cacheItem->scriptRef == 1
+                    && !cacheItem->incubationTask
+                    && cacheItem->modelIndex() != -1
+                    && cacheItem->delegate == m_delegate
+                    && cacheItem->canBeReused(m_adaptorModel)
+                    && !qmlobject_cast<QQuickPackage *>(object)) {
+                const int index = cacheItem->groupIndex(m_compositorGroup);
+                removeCacheItem(cacheItem);
+                cacheItem->poolTime = 0;
+                m_reusableItemsPool.append(cacheItem);
+                emit q->itemPooled(index, object);
+                stat |= QQmlInstanceModel::Pooled;
+            } else {
+                destroyCacheItem(cacheItem);
+                stat |= QQmlInstanceModel::Destroyed;
             }
-            cacheItem->Dispose();
-            stat |= QQmlInstanceModel::Destroyed;
         } else {
             stat |= QQmlDelegateModel::Referenced;
         }
@@ -557,17 +572,81 @@ QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *objec
     return stat;
 }
 
+void QQmlDelegateModelPrivate::destroyCacheItem(QQmlDelegateModelItem *cacheItem)
+{
+    QObject *object = cacheItem->object;
+    cacheItem->destroyObject();
+    emitDestroyingItem(object);
+    if (cacheItem->incubationTask) {
+        releaseIncubator(cacheItem->incubationTask);
+        cacheItem->incubationTask = 0;
+    }
+    cacheItem->Dispose();
+}
+
+/*
+    Takes an item for the row at \a modelIndex out of the pool of reusable
+    items, preferring one that showed that row before, so that its bindings
+    don't have to change. Returns 0 if the pool holds no suitable item.
+*/
+QQmlDelegateModelItem *QQmlDelegateModelPrivate::takeReusableItem(int modelIndex)
+{
+    int poolIndex = -1;
+    for (int i = 0; i < m_reusableItemsPool.count(); ++i) {
+        QQmlDelegateModelItem *cacheItem = m_reusableItemsPool.at(i);
+        if (cacheItem->delegate != m_delegate || !cacheItem->canBeReused(m_adaptorModel))
+            continue;
+        if (poolIndex == -1 || cacheItem->modelIndex() == modelIndex)
+            poolIndex = i;
+        if (cacheItem->modelIndex() == modelIndex)
+            break;
+    }
+    return poolIndex != -1 ? m_reusableItemsPool.takeAt(poolIndex) : 0;
+}
+
+/*
+    Destroys the pooled items that have not been reused within the last
+    \a maxPoolTime calls.
+*/
+void QQmlDelegateModelPrivate::drainReusableItemsPool(int maxPoolTime)
+{
+    // destroyCacheItem() emits destroyingItem(), so work on a copy of the pool
+    const QList<QQmlDelegateModelItem *> pool = m_reusableItemsPool;
+    for (QQmlDelegateModelItem *cacheItem : pool) {
+        if (++cacheItem->poolTime <= maxPoolTime)
+            continue;
+        m_reusableItemsPool.removeOne(cacheItem);
+        destroyCacheItem(cacheItem);
+    }
+}
+
 /*
   Returns ReleaseStatus flags.
+
+  If \a reusableFlag is QQmlInstanceModel::Reusable, the item may be moved to a
+  pool instead of being destroyed, and handed out again by object() for another
+  row. Pooled items are destroyed by drainReusableItemsPool().
 */
 
-QQmlDelegateModel::ReleaseFlags QQmlDelegateModel::release(QObject *item)
+QQmlDelegateModel::ReleaseFlags QQmlDelegateModel::release(QObject *item, ReusableFlag reusableFlag)
 {
     Q_D(QQmlDelegateModel);
-    QQmlInstanceModel::ReleaseFlags stat = d->release(item);
+    QQmlInstanceModel::ReleaseFlags stat = d->release(item, reusableFlag);
     return stat;
 }
 
+void QQmlDelegateModel::drainReusableItemsPool(int maxPoolTime)
+{
+    Q_D(QQmlDelegateModel);
+    d->drainReusableItemsPool(maxPoolTime);
+}
+
+int QQmlDelegateModel::poolSize()
+{
+    Q_D(QQmlDelegateModel);
+    return d->m_reusableItemsPool.count();
+}
+
 // Cancel a requested async item
 void QQmlDelegateModel::cancel(int index)
 {
@@ -945,7 +1024,8 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
     QQmlDelegateModelItem *cacheItem = it->inCache() ? m_cache.at(it.cacheIndex) : 0;
 
     if (!cacheItem) {
-        cacheItem = m_adaptorModel.createItem(m_cacheMetaType, it.modelIndex());
+        QQmlDelegateModelItem *reusedItem = takeReusableItem(it.modelIndex());
+        cacheItem = reusedItem ? reusedItem : m_adaptorModel.createItem(m_cacheMetaType, it.modelIndex());
         if (!cacheItem)
             return 0;
 
@@ -954,6 +1034,18 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
         m_cache.insert(it.cacheIndex, cacheItem);
         m_compositor.setFlags(it, 1, Compositor::CacheFlag);
         Q_ASSERT(m_cache.count() == m_compositor.count(Compositor::Cache));
+
+        if (reusedItem) {
+            // Point the pooled item at its new row. This notifies the index and all the
+            // roles, so that the bindings of the delegate pick up the new data.
+            reusedItem->reuse(m_adaptorModel, it.modelIndex());
+            if (QQmlDelegateModelAttached *attached = reusedItem->attached) {
+                for (int i = 1; i < m_groupCount; ++i)
+                    attached->m_currentIndex[i] = it.index[i];
+                attached->emitChanges();
+            }
+            emit q_func()->itemReused(index, reusedItem->object);
+        }
     }
 
     // Bump the reference counts temporarily so neither the content data or the delegate object
@@ -971,6 +1063,7 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
         QQmlContext *creationContext = m_delegate->creationContext();
 
         cacheItem->scriptRef += 1;
+        cacheItem->delegate = m_delegate;
 
         cacheItem->incubationTask = new QQDMIncubationTask(this, incubationMode);
         cacheItem->incubationTask->incubating = cacheItem;
@@ -1921,6 +2014,7 @@ QQmlDelegateModelItem::QQmlDelegateModelItem(
     , scriptRef(0)
     , groups(0)
     , index(modelIndex)
+    , poolTime(0)
 {
     metaType->addref();
 }
@@ -1999,7 +2093,9 @@ int QQmlDelegateModelItem::groupIndex(Compositor::Group group)
     if (QQmlDelegateModelPrivate * const model = metaType->model
             ? QQmlDelegateModelPrivate::get(metaType->model)
             : 0) {
-        return model->m_compositor.find(Compositor::Cache, model->m_cache.indexOf(this)).index[group];
+        const int cacheIndex = model->m_cache.indexOf(this);
+        if (cacheIndex != -1)
+            return model->m_compositor.find(Compositor::Cache, cacheIndex).index[group];
     }
     return -1;
 }
@@ -3161,7 +3257,7 @@ QObject *QQmlPartsModel::object(int index, QQmlIncubator::IncubationMode incubat
     return 0;
 }
 
-QQmlInstanceModel::ReleaseFlags QQmlPartsModel::release(QObject *item)
+QQmlInstanceModel::ReleaseFlags QQmlPartsModel::release(QObject *item, ReusableFlag)
 {
     QQmlInstanceModel::ReleaseFlags flags = 0;
 
@@ -43,6 +43,7 @@
 #include "qqmldelegatemodel_p.h"
 #include <private/qv4qobjectwrapper_p.h>
 
+#include <QtQml/qqmlcomponent.h>
 #include <QtQml/qqmlcontext.h>
 #include <QtQml/qqmlincubator.h>
 
@@ -125,6 +126,8 @@ public:
 
     virtual void setValue(const QString &role, const QVariant &value) { Q_UNUSED(role); Q_UNUSED(value); }
     virtual bool resolveIndex(const QQmlAdaptorModel &, int) { return false; }
+    virtual bool canBeReused(const QQmlAdaptorModel &) const { return false; }
+    virtual void reuse(const QQmlAdaptorModel &, int) {}
 
     static void get_model(const QV4::BuiltinFunction *, QV4::Scope &scope, QV4::CallData *callData);
     static void get_groups(const QV4::BuiltinFunction *, QV4::Scope &scope, QV4::CallData *callData);
@@ -139,10 +142,12 @@ public:
     QPointer<QObject> object;
     QPointer<QQmlDelegateModelAttached> attached;
     QQDMIncubationTask *incubationTask;
+    QPointer<QQmlComponent> delegate;
     int objectRef;
     int scriptRef;
     int groups;
     int index;
+    int poolTime;
 
 Q_SIGNALS:
     void modelIndexChanged();
@@ -257,7 +262,10 @@ public:
 
     void requestMoreIfNecessary();
     QObject *object(Compositor::Group group, int index, QQmlIncubator::IncubationMode incubationMode);
-    QQmlDelegateModel::ReleaseFlags release(QObject *object);
+    QQmlDelegateModel::ReleaseFlags release(QObject *object, QQmlInstanceModel::ReusableFlag reusableFlag = QQmlInstanceModel::NotReusable);
+    QQmlDelegateModelItem *takeReusableItem(int modelIndex);
+    void drainReusableItemsPool(int maxPoolTime);
+    void destroyCacheItem(QQmlDelegateModelItem *cacheItem);
     QString stringValue(Compositor::Group group, int index, const QString &name);
     void emitCreatedPackage(QQDMIncubationTask *incubationTask, QQuickPackage *package);
     void emitInitPackage(QQDMIncubationTask *incubationTask, QQuickPackage *package);
@@ -310,6 +318,7 @@ public:
     QQmlDelegateModelGroupEmitterList m_pendingParts;
 
     QList<QQmlDelegateModelItem *> m_cache;
+    QList<QQmlDelegateModelItem *> m_reusableItemsPool;
     QList<QQDMIncubationTask *> m_finishedIncubating;
     QList<QByteArray> m_watchedRoles;
 
@@ -353,7 +362,7 @@ public:
     int count() const override;
     bool isValid() const override;
     QObject *object(int index, QQmlIncubator::IncubationMode incubationMode = QQmlIncubator::AsynchronousIfNested) override;
-    ReleaseFlags release(QObject *item) override;
+    ReleaseFlags release(QObject *item, ReusableFlag reusableFlag = NotReusable) override;
     QString stringValue(int index, const QString &role) override;
     QList<QByteArray> watchedRoles() const { return m_watchedRoles; }
     void setWatchedRoles(const QList<QByteArray> &roles) override;
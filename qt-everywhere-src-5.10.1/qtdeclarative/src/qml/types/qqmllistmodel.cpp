@@ -364,6 +364,14 @@ void ListModel::insertElement(int index)
     updateCacheIndices(index);
 }
 
+void ListModel::insertElements(int index, int count)
+{
+    elements.insertBlank(index, count);
+    for (int i = 0; i < count; ++i)
+        elements[index + i] = new ListElement;
+    updateCacheIndices(index + count);
+}
+
 void ListModel::move(int from, int to, int n)
 {
     if (from > to) {
@@ -2110,13 +2118,15 @@ void QQmlListModel::insert(QQmlV4Function *args)
 
             int objectArrayLength = objectArray->getLength();
             emitItemsAboutToBeInserted(index, objectArrayLength);
+            if (!m_dynamicRoles)
+                m_listModel->insertElements(index, objectArrayLength);
             for (int i=0 ; i < objectArrayLength ; ++i) {
                 argObject = objectArray->getIndexed(i);
 
                 if (m_dynamicRoles) {
                     m_modelObjects.insert(index+i, DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this));
                 } else {
-                    m_listModel->insert(index+i, argObject);
+                    m_listModel->set(index+i, argObject);
                 }
             }
             emitItemsInserted(index, objectArrayLength);
@@ -2220,13 +2230,15 @@ void QQmlListModel::append(QQmlV4Function *args)
             int index = count();
             emitItemsAboutToBeInserted(index, objectArrayLength);
 
+            if (!m_dynamicRoles)
+                m_listModel->insertElements(index, objectArrayLength);
             for (int i=0 ; i < objectArrayLength ; ++i) {
                 argObject = objectArray->getIndexed(i);
 
                 if (m_dynamicRoles) {
                     m_modelObjects.append(DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this));
                 } else {
-                    m_listModel->append(argObject);
+                    m_listModel->set(index+i, argObject);
                 }
             }
 
@@ -370,6 +370,7 @@ public:
 
     int appendElement();
     void insertElement(int index);
+    void insertElements(int index, int count);
 
     void move(int from, int to, int n);
 
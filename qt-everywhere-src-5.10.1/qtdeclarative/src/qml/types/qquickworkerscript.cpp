@@ -670,12 +670,18 @@ void QQuickWorkerScript::setSource(const QUrl &source)
     \list
     \li boolean, number, string
     \li JavaScript objects and arrays
+    \li ArrayBuffer and typed array objects (since Qt 5.11)
     \li ListModel objects (any other type of QObject* is not allowed)
     \endlist
 
     All objects and arrays are copied to the \c message. With the exception
     of ListModel objects, any modifications by the other thread to an object
     passed in \c message will not be reflected in the original object.
+
+    The contents of ArrayBuffer and typed array objects are copied as a
+    single block of memory, which makes them the most efficient way to
+    pass large amounts of numeric data. A typed array arrives with a new
+    buffer of its own that only holds the elements it covered.
 */
 void QQuickWorkerScript::sendMessage(QQmlV4Function *args)
 {
@@ -124,6 +124,7 @@ public:
         , propertyCache(0)
         , propertyOffset(0)
         , signalOffset(0)
+        , dataGeneration(0)
         , hasModelData(false)
     {
     }
@@ -142,6 +143,9 @@ public:
             int count,
             const QVector<int> &roles) const override
     {
+        // invalidates the role data items have fetched from the model
+        ++const_cast<VDMModelDelegateDataType *>(this)->dataGeneration;
+
         bool changed = roles.isEmpty() && !watchedRoles.isEmpty();
         if (!changed && !watchedRoles.isEmpty() && watchedRoleIds.isEmpty()) {
             QList<int> roleIds;
@@ -252,11 +256,13 @@ public:
     QList<int> watchedRoleIds;
     QList<QByteArray> watchedRoles;
     QHash<QByteArray, int> roleNames;
+    QVector<int> fetchedRoles; // roles delegates have read, fetched together
     QQmlAdaptorModel *model;
     QMetaObject *metaObject;
     QQmlPropertyCache *propertyCache;
     int propertyOffset;
     int signalOffset;
+    int dataGeneration;
     bool hasModelData;
 };
 
@@ -400,6 +406,8 @@ public:
             VDMModelDelegateDataType *dataType,
             int index)
         : QQmlDMCachedModelData(metaType, dataType, index)
+        , roleDataIndex(-1)
+        , roleDataGeneration(0)
     {
     }
 
@@ -415,15 +423,53 @@ public:
 
     QVariant value(int role) const override
     {
-        return type->model->aim()->index(index, 0, type->model->rootIndex).data(role);
+        if (roleDataIndex == index && roleDataGeneration == type->dataGeneration) {
+            for (const QModelRoleData &data : roleData) {
+                if (data.role() == role)
+                    return data.data();
+            }
+        }
+
+        // Fetch the role together with all the other roles the delegates of
+        // this model have read so far, with one call into the model. After the
+        // first delegate, a single multiData() call serves all bindings.
+        if (!type->fetchedRoles.contains(role))
+            type->fetchedRoles.append(role);
+        roleData.clear();
+        roleData.reserve(type->fetchedRoles.size());
+        for (int fetchedRole : qAsConst(type->fetchedRoles))
+            roleData.append(QModelRoleData(fetchedRole));
+        type->model->aim()->index(index, 0, type->model->rootIndex).multiData(roleData);
+        roleDataIndex = index;
+        roleDataGeneration = type->dataGeneration;
+
+        return *QModelRoleDataSpan(roleData).dataForRole(role);
     }
 
     void setValue(int role, const QVariant &value) override
     {
+        roleDataIndex = -1;
         type->model->aim()->setData(
                 type->model->aim()->index(index, 0, type->model->rootIndex), value, role);
     }
 
+    bool canBeReused(const QQmlAdaptorModel &model) const override
+    {
+        // the roles of the item are those of the model it was created for
+        return model.accessors == type;
+    }
+
+    void reuse(const QQmlAdaptorModel &, int idx) override
+    {
+        index = idx;
+        roleDataIndex = -1;
+        emit modelIndexChanged();
+        const QMetaObject *meta = metaObject();
+        const int propertyCount = type->propertyRoles.count();
+        for (int i = 0; i < propertyCount; ++i)
+            QMetaObject::activate(this, meta, i, 0);
+    }
+
     QV4::ReturnedValue get() override
     {
         if (type->prototype.isUndefined()) {
@@ -437,6 +483,13 @@ public:
         ++scriptRef;
         return o.asReturnedValue();
     }
+
+private:
+    // role data of the row this item was at when roleDataIndex was set,
+    // valid until the model reports a change (see dataGeneration)
+    mutable QVector<QModelRoleData> roleData;
+    mutable int roleDataIndex;
+    mutable int roleDataGeneration;
 };
 
 class VDMAbstractItemModelDataType : public VDMModelDelegateDataType
@@ -631,6 +684,15 @@ public:
         }
     }
 
+    bool canBeReused(const QQmlAdaptorModel &model) const override;
+
+    void reuse(const QQmlAdaptorModel &model, int idx) override
+    {
+        index = idx;
+        cachedData = model.list.at(idx);
+        emit modelIndexChanged();
+        emit modelDataChanged();
+    }
 
 Q_SIGNALS:
     void modelDataChanged();
@@ -882,6 +944,11 @@ QQmlDMObjectData::QQmlDMObjectData(
 static const QQmlAdaptorModel::Accessors qt_vdm_null_accessors;
 static const VDMListDelegateDataType qt_vdm_list_accessors;
 
+bool QQmlDMListAccessorData::canBeReused(const QQmlAdaptorModel &model) const
+{
+    return model.accessors == &qt_vdm_list_accessors;
+}
+
 QQmlAdaptorModel::Accessors::~Accessors()
 {
 }
@@ -156,6 +156,30 @@ void QQmlProfilerClient::memoryAllocation(QQmlProfilerDefinitions::MemoryType ty
     Q_UNUSED(amount);
 }
 
+void QQmlProfilerClient::heapSnapshot(qint64 time, const QByteArray &snapshot)
+{
+    Q_UNUSED(time);
+    Q_UNUSED(snapshot);
+}
+
+void QQmlProfilerClient::regExpStatistics(qint64 time, quint64 compiled, quint64 jitCompiled,
+                                          quint64 reused, quint64 matches,
+                                          quint64 interpretedMatches)
+{
+    Q_UNUSED(time);
+    Q_UNUSED(compiled);
+    Q_UNUSED(jitCompiled);
+    Q_UNUSED(reused);
+    Q_UNUSED(matches);
+    Q_UNUSED(interpretedMatches);
+}
+
+void QQmlProfilerClient::javaScriptSamples(qint64 time, const QByteArray &foldedStacks)
+{
+    Q_UNUSED(time);
+    Q_UNUSED(foldedStacks);
+}
+
 void QQmlProfilerClient::inputEvent(QQmlProfilerDefinitions::InputEventType type, qint64 time,
                                     int a, int b)
 {
@@ -322,6 +346,24 @@ void QQmlProfilerClient::messageReceived(const QByteArray &data)
         qint64 delta;
         stream >> type >> delta;
         memoryAllocation((QQmlProfilerDefinitions::MemoryType)type, time, delta);
+    } else if (messageType == QQmlProfilerDefinitions::HeapSnapshot) {
+        if (!(d->features & one << QQmlProfilerDefinitions::ProfileHeapSnapshot))
+            return;
+        QByteArray snapshot;
+        stream >> snapshot;
+        heapSnapshot(time, snapshot);
+    } else if (messageType == QQmlProfilerDefinitions::RegExpStatistics) {
+        if (!(d->features & one << QQmlProfilerDefinitions::ProfileJavaScript))
+            return;
+        quint64 compiled, jitCompiled, reused, matches, interpretedMatches;
+        stream >> compiled >> jitCompiled >> reused >> matches >> interpretedMatches;
+        regExpStatistics(time, compiled, jitCompiled, reused, matches, interpretedMatches);
+    } else if (messageType == QQmlProfilerDefinitions::JavaScriptSamples) {
+        if (!(d->features & one << QQmlProfilerDefinitions::ProfileJavaScriptSamples))
+            return;
+        QByteArray foldedStacks;
+        stream >> foldedStacks;
+        javaScriptSamples(time, foldedStacks);
     } else {
         int range;
         stream >> range;
@@ -97,6 +97,13 @@ private:
     virtual void memoryAllocation(QQmlProfilerDefinitions::MemoryType type, qint64 time,
                                   qint64 amount);
 
+    virtual void heapSnapshot(qint64 time, const QByteArray &snapshot);
+
+    virtual void regExpStatistics(qint64 time, quint64 compiled, quint64 jitCompiled,
+                                  quint64 reused, quint64 matches, quint64 interpretedMatches);
+
+    virtual void javaScriptSamples(qint64 time, const QByteArray &foldedStacks);
+
     virtual void inputEvent(QQmlProfilerDefinitions::InputEventType type, qint64 time, int a,
                             int b);
 
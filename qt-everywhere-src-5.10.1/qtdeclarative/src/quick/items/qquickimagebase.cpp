@@ -238,6 +238,9 @@ void QQuickImageBase::load()
             options |= QQuickPixmap::Asynchronous;
         if (d->cache)
             options |= QQuickPixmap::Cache;
+        // Hidden images are usually prefetched, let the visible ones go first
+        if (!isVisible())
+            options |= QQuickPixmap::LowPriority;
         d->pix.clear(this);
 
         const qreal targetDevicePixelRatio = (window() ? window()->effectiveDevicePixelRatio() : qApp->devicePixelRatio());
@@ -336,6 +339,8 @@ void QQuickImageBase::itemChange(ItemChange change, const ItemChangeData &value)
         if (qmlEngine(this) && isComponentComplete() && d->url.isValid()) {
             load();
         }
+    } else if (change == ItemVisibleHasChanged && d->pix.isLoading()) {
+        d->pix.setLowPriority(!value.boolValue);
     }
     QQuickItem::itemChange(change, value);
 }
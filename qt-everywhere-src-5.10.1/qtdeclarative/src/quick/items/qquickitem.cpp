@@ -151,7 +151,8 @@ QQuickTransform::~QQuickTransform()
     Q_D(QQuickTransform);
     for (int ii = 0; ii < d->items.count(); ++ii) {
         QQuickItemPrivate *p = QQuickItemPrivate::get(d->items.at(ii));
-        p->transforms.removeOne(this);
+        if (p->extra.isAllocated())
+            p->extra->transforms.removeOne(this);
         p->dirty(QQuickItemPrivate::Transform);
     }
 }
@@ -2414,21 +2415,21 @@ QQuickItem::~QQuickItem()
        remove themselves from our list of transforms when that list has already
        been destroyed after ~QQuickItem() has run.
     */
-    for (int ii = 0; ii < d->transforms.count(); ++ii) {
-        QQuickTransform *t = d->transforms.at(ii);
-        QQuickTransformPrivate *tp = QQuickTransformPrivate::get(t);
-        tp->items.removeOne(this);
-    }
-
     if (d->extra.isAllocated()) {
+        for (int ii = 0; ii < d->extra->transforms.count(); ++ii) {
+            QQuickTransform *t = d->extra->transforms.at(ii);
+            QQuickTransformPrivate *tp = QQuickTransformPrivate::get(t);
+            tp->items.removeOne(this);
+        }
+
         delete d->extra->contents; d->extra->contents = 0;
 #if QT_CONFIG(quick_shadereffect)
         delete d->extra->layer; d->extra->layer = 0;
 #endif
+        delete d->extra->stateGroup; d->extra->stateGroup = 0;
     }
 
     delete d->_anchors; d->_anchors = 0;
-    delete d->_stateGroup; d->_stateGroup = 0;
 }
 
 /*!
@@ -2902,8 +2903,8 @@ static bool itemZOrder_sort(QQuickItem *lhs, QQuickItem *rhs)
 
 QList<QQuickItem *> QQuickItemPrivate::paintOrderChildItems() const
 {
-    if (sortedChildItems)
-        return *sortedChildItems;
+    if (paintOrderValid)
+        return paintOrderSorted ? extra->sortedChildItems : childItems;
 
     // If none of the items have set Z then the paint order list is the same as
     // the childItems list.  This is by far the most common case.
@@ -2914,14 +2915,15 @@ QList<QQuickItem *> QQuickItemPrivate::paintOrderChildItems() const
             break;
         }
     }
+    paintOrderValid = true;
+    paintOrderSorted = haveZ;
     if (haveZ) {
-        sortedChildItems = new QList<QQuickItem*>(childItems);
-        std::stable_sort(sortedChildItems->begin(), sortedChildItems->end(), itemZOrder_sort);
-        return *sortedChildItems;
+        QList<QQuickItem *> &sortedChildItems = extra.value().sortedChildItems;
+        sortedChildItems = childItems;
+        std::stable_sort(sortedChildItems.begin(), sortedChildItems.end(), itemZOrder_sort);
+        return sortedChildItems;
     }
 
-    sortedChildItems = const_cast<QList<QQuickItem*>*>(&childItems);
-
     return childItems;
 }
 
@@ -3106,10 +3108,10 @@ void QQuickItemPrivate::itemToParentTransform(QTransform &t) const
     if (x || y)
         t.translate(x, y);
 
-    if (!transforms.isEmpty()) {
+    if (hasTransforms()) {
         QMatrix4x4 m(t);
-        for (int ii = transforms.count() - 1; ii >= 0; --ii)
-            transforms.at(ii)->applyTo(&m);
+        for (int ii = extra->transforms.count() - 1; ii >= 0; --ii)
+            extra->transforms.at(ii)->applyTo(&m);
         t = m.toTransform();
     }
 
@@ -3161,7 +3163,6 @@ bool QQuickItem::isComponentComplete() const
 
 QQuickItemPrivate::QQuickItemPrivate()
     : _anchors(0)
-    , _stateGroup(0)
     , flags(0)
     , widthValid(false)
     , heightValid(false)
@@ -3201,13 +3202,14 @@ QQuickItemPrivate::QQuickItemPrivate()
 #else
     , touchEnabled(false)
 #endif
+    , paintOrderValid(true)
+    , paintOrderSorted(false)
     , dirtyAttributes(0)
+    , windowRefCount(0)
     , nextDirtyItem(0)
     , prevDirtyItem(0)
     , window(0)
-    , windowRefCount(0)
     , parentItem(0)
-    , sortedChildItems(&childItems)
     , subFocusItem(0)
     , x(0)
     , y(0)
@@ -3223,8 +3225,6 @@ QQuickItemPrivate::QQuickItemPrivate()
 
 QQuickItemPrivate::~QQuickItemPrivate()
 {
-    if (sortedChildItems != &childItems)
-        delete sortedChildItems;
 }
 
 void QQuickItemPrivate::init(QQuickItem *parent)
@@ -3459,7 +3459,7 @@ int QQuickItemPrivate::transform_count(QQmlListProperty<QQuickTransform> *prop)
     QQuickItem *that = static_cast<QQuickItem *>(prop->object);
     QQuickItemPrivate *p = QQuickItemPrivate::get(that);
 
-    return p->transforms.count();
+    return p->extra.isAllocated() ? p->extra->transforms.count() : 0;
 }
 
 void QQuickTransform::appendToItem(QQuickItem *item)
@@ -3470,11 +3470,12 @@ void QQuickTransform::appendToItem(QQuickItem *item)
 
     QQuickItemPrivate *p = QQuickItemPrivate::get(item);
 
-    if (!d->items.isEmpty() && !p->transforms.isEmpty() && p->transforms.contains(this)) {
-        p->transforms.removeOne(this);
-        p->transforms.append(this);
+    QList<QQuickTransform *> &transforms = p->extra.value().transforms;
+    if (!d->items.isEmpty() && !transforms.isEmpty() && transforms.contains(this)) {
+        transforms.removeOne(this);
+        transforms.append(this);
     } else {
-        p->transforms.append(this);
+        transforms.append(this);
         d->items.append(item);
     }
 
@@ -3489,11 +3490,12 @@ void QQuickTransform::prependToItem(QQuickItem *item)
 
     QQuickItemPrivate *p = QQuickItemPrivate::get(item);
 
-    if (!d->items.isEmpty() && !p->transforms.isEmpty() && p->transforms.contains(this)) {
-        p->transforms.removeOne(this);
-        p->transforms.prepend(this);
+    QList<QQuickTransform *> &transforms = p->extra.value().transforms;
+    if (!d->items.isEmpty() && !transforms.isEmpty() && transforms.contains(this)) {
+        transforms.removeOne(this);
+        transforms.prepend(this);
     } else {
-        p->transforms.prepend(this);
+        transforms.prepend(this);
         d->items.append(item);
     }
 
@@ -3514,10 +3516,10 @@ QQuickTransform *QQuickItemPrivate::transform_at(QQmlListProperty<QQuickTransfor
     QQuickItem *that = static_cast<QQuickItem *>(prop->object);
     QQuickItemPrivate *p = QQuickItemPrivate::get(that);
 
-    if (idx < 0 || idx >= p->transforms.count())
+    if (!p->extra.isAllocated() || idx < 0 || idx >= p->extra->transforms.count())
         return 0;
     else
-        return p->transforms.at(idx);
+        return p->extra->transforms.at(idx);
 }
 
 void QQuickItemPrivate::transform_clear(QQmlListProperty<QQuickTransform> *prop)
@@ -3525,13 +3527,16 @@ void QQuickItemPrivate::transform_clear(QQmlListProperty<QQuickTransform> *prop)
     QQuickItem *that = static_cast<QQuickItem *>(prop->object);
     QQuickItemPrivate *p = QQuickItemPrivate::get(that);
 
-    for (int ii = 0; ii < p->transforms.count(); ++ii) {
-        QQuickTransform *t = p->transforms.at(ii);
+    if (!p->extra.isAllocated())
+        return;
+
+    for (int ii = 0; ii < p->extra->transforms.count(); ++ii) {
+        QQuickTransform *t = p->extra->transforms.at(ii);
         QQuickTransformPrivate *tp = QQuickTransformPrivate::get(t);
         tp->items.removeOne(that);
     }
 
-    p->transforms.clear();
+    p->extra->transforms.clear();
 
     p->dirty(QQuickItemPrivate::Transform);
 }
@@ -4871,10 +4876,10 @@ QQmlListProperty<QQuickTransition> QQuickItemPrivate::transitions()
 
 QString QQuickItemPrivate::state() const
 {
-    if (!_stateGroup)
+    if (!stateGroup())
         return QString();
     else
-        return _stateGroup->state();
+        return extra->stateGroup->state();
 }
 
 void QQuickItemPrivate::setState(const QString &state)
@@ -4946,8 +4951,8 @@ void QQuickItem::classBegin()
 {
     Q_D(QQuickItem);
     d->componentComplete = false;
-    if (d->_stateGroup)
-        d->_stateGroup->classBegin();
+    if (QQuickStateGroup *stateGroup = d->stateGroup())
+        stateGroup->classBegin();
     if (d->_anchors)
         d->_anchors->classBegin();
 #if QT_CONFIG(quick_shadereffect)
@@ -4965,8 +4970,8 @@ void QQuickItem::componentComplete()
 {
     Q_D(QQuickItem);
     d->componentComplete = true;
-    if (d->_stateGroup)
-        d->_stateGroup->componentComplete();
+    if (QQuickStateGroup *stateGroup = d->stateGroup())
+        stateGroup->componentComplete();
     if (d->_anchors) {
         d->_anchors->componentComplete();
         QQuickAnchorsPrivate::get(d->_anchors)->updateOnComplete();
@@ -4994,15 +4999,16 @@ void QQuickItem::componentComplete()
 QQuickStateGroup *QQuickItemPrivate::_states()
 {
     Q_Q(QQuickItem);
-    if (!_stateGroup) {
-        _stateGroup = new QQuickStateGroup;
+    QQuickStateGroup *&stateGroup = extra.value().stateGroup;
+    if (!stateGroup) {
+        stateGroup = new QQuickStateGroup;
         if (!componentComplete)
-            _stateGroup->classBegin();
-        qmlobject_connect(_stateGroup, QQuickStateGroup, SIGNAL(stateChanged(QString)),
+            stateGroup->classBegin();
+        qmlobject_connect(stateGroup, QQuickStateGroup, SIGNAL(stateChanged(QString)),
                           q, QQuickItem, SIGNAL(stateChanged(QString)))
     }
 
-    return _stateGroup;
+    return stateGroup;
 }
 
 QPointF QQuickItemPrivate::computeTransformOrigin() const
@@ -8542,9 +8548,13 @@ void QQuickItemLayer::updateMatrix()
     QQuickItemPrivate *ld = QQuickItemPrivate::get(l);
     l->setScale(m_item->scale());
     l->setRotation(m_item->rotation());
-    ld->transforms = QQuickItemPrivate::get(m_item)->transforms;
-    if (ld->origin() != QQuickItemPrivate::get(m_item)->origin())
-        ld->extra.value().origin = QQuickItemPrivate::get(m_item)->origin();
+    QQuickItemPrivate *itemPriv = QQuickItemPrivate::get(m_item);
+    if (itemPriv->hasTransforms())
+        ld->extra.value().transforms = itemPriv->extra->transforms;
+    else if (ld->extra.isAllocated())
+        ld->extra->transforms.clear();
+    if (ld->origin() != itemPriv->origin())
+        ld->extra.value().origin = itemPriv->origin();
     ld->dirty(QQuickItemPrivate::Transform);
 }
 #endif // quick_shadereffect
@@ -8560,6 +8570,7 @@ QQuickItemPrivate::ExtraData::ExtraData()
   effectRefCount(0), hideRefCount(0),
   recursiveEffectRefCount(0),
   opacityNode(0), clipNode(0), rootNode(0),
+  stateGroup(0),
   acceptedMouseButtons(0), origin(QQuickItem::Center),
   transparentForPositioner(false)
 {
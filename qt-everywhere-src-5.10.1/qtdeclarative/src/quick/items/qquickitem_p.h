@@ -372,6 +372,12 @@ public:
 
         QObjectList resourcesList;
 
+        // Rarely used, kept here to keep QQuickItemPrivate small
+        QQuickStateGroup *stateGroup;
+        QList<QQuickTransform *> transforms;
+        // Only used when some child has a z value, see paintOrderSorted
+        mutable QList<QQuickItem *> sortedChildItems;
+
         // Although acceptedMouseButtons is inside ExtraData, we actually store
         // the LeftButton flag in the extra.flag() bit.  This is because it is
         // extremely common to set acceptedMouseButtons to LeftButton, but very
@@ -398,7 +404,7 @@ public:
     void updateOrRemoveGeometryChangeListener(QQuickItemChangeListener *listener, QQuickGeometryChange types);
 
     QQuickStateGroup *_states();
-    QQuickStateGroup *_stateGroup;
+    QQuickStateGroup *stateGroup() const { return extra.isAllocated()?extra->stateGroup:0; }
 
     inline QQuickItem::TransformOrigin origin() const;
 
@@ -445,6 +451,10 @@ public:
     bool isTabFence:1;
     bool replayingPressEvent:1;
     bool touchEnabled:1;
+    // paintOrderChildItems() cache: when paintOrderSorted is set the paint
+    // order is in extra->sortedChildItems, otherwise it is childItems.
+    mutable bool paintOrderValid:1;
+    mutable bool paintOrderSorted:1;
 
     enum DirtyType {
         TransformOrigin         = 0x00000001,
@@ -479,6 +489,8 @@ public:
     };
 
     quint32 dirtyAttributes;
+    // Next to dirtyAttributes to share its 64-bit word
+    int windowRefCount;
     QString dirtyToString() const;
     void dirty(DirtyType);
     void addToDirtyList();
@@ -489,14 +501,12 @@ public:
     void setCulled(bool);
 
     QQuickWindow *window;
-    int windowRefCount;
     inline QSGContext *sceneGraphContext() const;
     inline QSGRenderContext *sceneGraphRenderContext() const;
 
     QQuickItem *parentItem;
 
     QList<QQuickItem *> childItems;
-    mutable QList<QQuickItem *> *sortedChildItems;
     QList<QQuickItem *> paintOrderChildItems() const;
     void addChild(QQuickItem *);
     void removeChild(QQuickItem *);
@@ -532,7 +542,7 @@ public:
 
     qreal baselineOffset;
 
-    QList<QQuickTransform *> transforms;
+    inline bool hasTransforms() const { return extra.isAllocated() && !extra->transforms.isEmpty(); }
 
     inline qreal z() const { return extra.isAllocated()?extra->z:0; }
     inline qreal scale() const { return extra.isAllocated()?extra->scale:1; }
@@ -908,12 +918,13 @@ QSGRenderContext *QQuickItemPrivate::sceneGraphRenderContext() const
 
 void QQuickItemPrivate::markSortedChildrenDirty(QQuickItem *child)
 {
-    // If sortedChildItems == &childItems then all in childItems have z == 0
+    // If the paint order is not sorted then all in childItems have z == 0
     // and we don't need to invalidate if the changed item also has z == 0.
-    if (child->z() != 0. || sortedChildItems != &childItems) {
-        if (sortedChildItems != &childItems)
-            delete sortedChildItems;
-        sortedChildItems = 0;
+    if (child->z() != 0. || paintOrderSorted) {
+        if (paintOrderSorted)
+            extra->sortedChildItems.clear();
+        paintOrderValid = false;
+        paintOrderSorted = false;
     }
 }
 
@@ -406,6 +406,16 @@ static void qt_quickitems_defineModule(const char *uri, int major, int minor)
     qmlRegisterType<QQuickFlickable, 10>(uri, 2, 10, "Flickable");
     qmlRegisterType<QQuickTextEdit, 10>(uri, 2, 10, "TextEdit");
     qmlRegisterType<QQuickText, 10>(uri, 2, 10, "Text");
+
+#if QT_CONFIG(quick_itemview)
+    qmlRegisterUncreatableType<QQuickItemView, 11>(uri, 2, 11, itemViewName, itemViewMessage);
+#endif
+#if QT_CONFIG(quick_listview)
+    qmlRegisterType<QQuickListView, 11>(uri, 2, 11, "ListView");
+#endif
+#if QT_CONFIG(quick_gridview)
+    qmlRegisterType<QQuickGridView, 11>(uri, 2, 11, "GridView");
+#endif
 }
 
 static void initResources()
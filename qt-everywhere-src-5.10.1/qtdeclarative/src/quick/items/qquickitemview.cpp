@@ -51,6 +51,11 @@ Q_LOGGING_CATEGORY(lcItemViewDelegateLifecycle, "qt.quick.itemview.lifecycle")
 #define QML_VIEW_DEFAULTCACHEBUFFER 320
 #endif
 
+// the number of refills an item released with reuseItems stays pooled
+#ifndef QML_VIEW_MAXPOOLTIME
+#define QML_VIEW_MAXPOOLTIME 2
+#endif
+
 FxViewItem::FxViewItem(QQuickItem *i, QQuickItemView *v, bool own, QQuickItemViewAttached *attached)
     : item(i)
     , view(v)
@@ -267,6 +272,8 @@ QQuickItemView::~QQuickItemView()
     d->clear();
     if (d->ownModel)
         delete d->model;
+    else if (d->model)
+        d->model->drainReusableItemsPool(0);
     delete d->header;
     delete d->footer;
 }
@@ -299,11 +306,15 @@ void QQuickItemView::setModel(const QVariant &m)
         disconnect(d->model, SIGNAL(initItem(int,QObject*)), this, SLOT(initItem(int,QObject*)));
         disconnect(d->model, SIGNAL(createdItem(int,QObject*)), this, SLOT(createdItem(int,QObject*)));
         disconnect(d->model, SIGNAL(destroyingItem(QObject*)), this, SLOT(destroyingItem(QObject*)));
+        disconnect(d->model, SIGNAL(itemPooled(int,QObject*)), this, SLOT(pooledItem(int,QObject*)));
+        disconnect(d->model, SIGNAL(itemReused(int,QObject*)), this, SLOT(reusedItem(int,QObject*)));
     }
 
     QQmlInstanceModel *oldModel = d->model;
 
     d->clear();
+    if (oldModel)
+        oldModel->drainReusableItemsPool(0);
     d->model = 0;
     d->setPosition(d->contentStartOffset());
     d->modelVariant = model;
@@ -334,6 +345,8 @@ void QQuickItemView::setModel(const QVariant &m)
         connect(d->model, SIGNAL(createdItem(int,QObject*)), this, SLOT(createdItem(int,QObject*)));
         connect(d->model, SIGNAL(initItem(int,QObject*)), this, SLOT(initItem(int,QObject*)));
         connect(d->model, SIGNAL(destroyingItem(QObject*)), this, SLOT(destroyingItem(QObject*)));
+        connect(d->model, SIGNAL(itemPooled(int,QObject*)), this, SLOT(pooledItem(int,QObject*)));
+        connect(d->model, SIGNAL(itemReused(int,QObject*)), this, SLOT(reusedItem(int,QObject*)));
         if (isComponentComplete()) {
             d->updateSectionCriteria();
             d->refill();
@@ -796,6 +809,24 @@ void QQuickItemView::setHighlightMoveDuration(int duration)
     }
 }
 
+bool QQuickItemView::reuseItems() const
+{
+    Q_D(const QQuickItemView);
+    return d->reuseItems;
+}
+
+void QQuickItemView::setReuseItems(bool reuse)
+{
+    Q_D(QQuickItemView);
+    if (d->reuseItems == reuse)
+        return;
+
+    d->reuseItems = reuse;
+    if (!reuse && d->model)
+        d->model->drainReusableItemsPool(0);
+    emit reuseItemsChanged();
+}
+
 QQuickTransition *QQuickItemView::populateTransition() const
 {
     Q_D(const QQuickItemView);
@@ -1573,7 +1604,7 @@ QQuickItemViewPrivate::QQuickItemViewPrivate()
     , inLayout(false), inViewportMoved(false), forceLayout(false), currentIndexCleared(false)
     , haveHighlightRange(false), autoHighlight(true), highlightRangeStartValid(false), highlightRangeEndValid(false)
     , fillCacheBuffer(false), inRequest(false)
-    , runDelayedRemoveTransition(false), delegateValidated(false)
+    , runDelayedRemoveTransition(false), delegateValidated(false), reuseItems(false)
 {
     bufferPause.addAnimationChangeListener(this, QAbstractAnimationJob::Completion);
     bufferPause.setLoopCount(1);
@@ -1853,6 +1884,10 @@ void QQuickItemViewPrivate::refill(qreal from, qreal to)
         if (prevCount != itemCount)
             emit q->countChanged();
     } while (currentChanges.hasPendingChanges() || bufferedChanges.hasPendingChanges());
+
+    // Keep the items that left the view around for a few refills, so that
+    // they can be reused for the ones that enter it.
+    model->drainReusableItemsPool(QML_VIEW_MAXPOOLTIME);
 }
 
 void QQuickItemViewPrivate::regenerate(bool orientationChanged)
@@ -2428,6 +2463,20 @@ void QQuickItemView::destroyingItem(QObject *object)
     }
 }
 
+void QQuickItemView::pooledItem(int, QObject *object)
+{
+    Q_D(QQuickItemView);
+    if (QQuickItemViewAttached *attached = d->getAttachedObject(object))
+        attached->emitPooled();
+}
+
+void QQuickItemView::reusedItem(int, QObject *object)
+{
+    Q_D(QQuickItemView);
+    if (QQuickItemViewAttached *attached = d->getAttachedObject(object))
+        attached->emitReused();
+}
+
 bool QQuickItemViewPrivate::releaseItem(FxViewItem *item)
 {
     Q_Q(QQuickItemView);
@@ -2437,12 +2486,18 @@ bool QQuickItemViewPrivate::releaseItem(FxViewItem *item)
         trackedItem = 0;
     item->trackGeometry(false);
 
-    QQmlInstanceModel::ReleaseFlags flags = model->release(item->item);
+    QQmlInstanceModel::ReleaseFlags flags = model->release(item->item,
+            reuseItems ? QQmlInstanceModel::Reusable : QQmlInstanceModel::NotReusable);
     if (item->item) {
         if (flags == 0) {
             // item was not destroyed, and we no longer reference it.
             QQuickItemPrivate::get(item->item)->setCulled(true);
             unrequestedItems.insert(item->item, model->indexOf(item->item, q));
+        } else if (flags & QQmlInstanceModel::Pooled) {
+            // item is kept by the model, and may be handed out again for another index
+            QQuickItemPrivate::get(item->item)->setCulled(true);
+            if (item->attached)
+                item->attached->setIsCurrentItem(false);
         } else if (flags & QQmlInstanceModel::Destroyed) {
             item->item->setParentItem(0);
         }
@@ -110,6 +110,8 @@ class Q_QUICK_PRIVATE_EXPORT QQuickItemView : public QQuickFlickable
     Q_PROPERTY(qreal preferredHighlightEnd READ preferredHighlightEnd WRITE setPreferredHighlightEnd NOTIFY preferredHighlightEndChanged RESET resetPreferredHighlightEnd)
     Q_PROPERTY(int highlightMoveDuration READ highlightMoveDuration WRITE setHighlightMoveDuration NOTIFY highlightMoveDurationChanged)
 
+    Q_PROPERTY(bool reuseItems READ reuseItems WRITE setReuseItems NOTIFY reuseItemsChanged REVISION 11)
+
 public:
     // this holds all layout enum values so they can be referred to by other enums
     // to ensure consistent values - e.g. QML references to GridView.TopToBottom flow
@@ -222,6 +224,9 @@ public:
     int highlightMoveDuration() const;
     virtual void setHighlightMoveDuration(int);
 
+    bool reuseItems() const;
+    void setReuseItems(bool reuse);
+
     enum PositionMode { Beginning, Center, End, Visible, Contain, SnapPosition };
     Q_ENUM(PositionMode)
 
@@ -276,6 +281,8 @@ Q_SIGNALS:
     void preferredHighlightEndChanged();
     void highlightMoveDurationChanged();
 
+    Q_REVISION(11) void reuseItemsChanged();
+
 protected:
     void updatePolish() override;
     void componentComplete() override;
@@ -291,6 +298,8 @@ protected Q_SLOTS:
     virtual void initItem(int index, QObject *item);
     void modelUpdated(const QQmlChangeSet &changeSet, bool reset);
     void destroyingItem(QObject *item);
+    void pooledItem(int index, QObject *item);
+    void reusedItem(int index, QObject *item);
     void animStopped();
     void trackedPositionChanged();
 
@@ -381,6 +390,8 @@ public:
 
     void emitAdd() { Q_EMIT add(); }
     void emitRemove() { Q_EMIT remove(); }
+    void emitPooled() { Q_EMIT pooled(); }
+    void emitReused() { Q_EMIT reused(); }
 
 Q_SIGNALS:
     void viewChanged();
@@ -389,6 +400,8 @@ Q_SIGNALS:
 
     void add();
     void remove();
+    void pooled();
+    void reused();
 
     void sectionChanged();
     void prevSectionChanged();
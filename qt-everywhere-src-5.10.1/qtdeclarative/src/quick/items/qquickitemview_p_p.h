@@ -341,6 +341,7 @@ public:
     bool inRequest : 1;
     bool runDelayedRemoveTransition : 1;
     bool delegateValidated : 1;
+    bool reuseItems : 1;
 
 protected:
     virtual Qt::Orientation layoutOrientation() const = 0;
@@ -373,6 +374,7 @@ protected:
     virtual void visibleItemsChanged() {}
 
     virtual FxViewItem *newViewItem(int index, QQuickItem *item) = 0;
+    virtual QQuickItemViewAttached *getAttachedObject(const QObject *object) const = 0;
     virtual void repositionItemAt(FxViewItem *item, int index, qreal sizeBuffer) = 0;
     virtual void repositionPackageItemAt(QQuickItem *item, int index) = 0;
     virtual void resetFirstItemPosition(qreal pos = 0.0) = 0;
@@ -90,6 +90,7 @@ public:
     void removeItem(FxViewItem *item);
 
     FxViewItem *newViewItem(int index, QQuickItem *item) override;
+    QQuickItemViewAttached *getAttachedObject(const QObject *object) const override;
     void initializeViewItem(FxViewItem *item) override;
     bool releaseItem(FxViewItem *item) override;
     void repositionItemAt(FxViewItem *item, int index, qreal sizeBuffer) override;
@@ -600,6 +601,12 @@ FxViewItem *QQuickListViewPrivate::newViewItem(int modelIndex, QQuickItem *item)
     return listItem;
 }
 
+QQuickItemViewAttached *QQuickListViewPrivate::getAttachedObject(const QObject *object) const
+{
+    QObject *attachedObject = qmlAttachedPropertiesObject<QQuickListView>(object);
+    return static_cast<QQuickItemViewAttached *>(attachedObject);
+}
+
 void QQuickListViewPrivate::initializeViewItem(FxViewItem *item)
 {
     QQuickItemViewPrivate::initializeViewItem(item);
@@ -1971,6 +1978,48 @@ QQuickListView::~QQuickListView()
     The corresponding handler is \c onRemove.
 */
 
+/*!
+    \qmlattachedsignal QtQuick::ListView::pooled()
+    \since 5.11
+    This attached signal is emitted after an item has been moved to the pool
+    of reusable items, see \l reuseItems.
+
+    The corresponding handler is \c onPooled.
+*/
+
+/*!
+    \qmlattachedsignal QtQuick::ListView::reused()
+    \since 5.11
+    This attached signal is emitted after an item has been taken out of the
+    pool of reusable items and assigned to a new index, see \l reuseItems.
+
+    The corresponding handler is \c onReused.
+*/
+
+/*!
+    \qmlproperty bool QtQuick::ListView::reuseItems
+    \since 5.11
+
+    This property holds whether delegate items that move out of the view are
+    reused for the items that move into it, instead of being destroyed and
+    created again.
+
+    When an item is no longer needed by the view, it is moved to a pool of
+    reusable items. The next time the view needs a delegate, it takes an item
+    from the pool and assigns it to the new index, which updates the \c index
+    and the model roles of the delegate. Items that are not reused within a
+    few updates of the view are destroyed.
+
+    A reused item keeps all the state that is not bound to the model, so the
+    delegate should reset such state in the \l pooled() or \l reused()
+    attached signal handlers.
+
+    Items of delegates that are \l Package types, or that are referenced by
+    other parts of the application, are never reused.
+
+    The default value is \c false.
+*/
+
 /*!
     \qmlproperty model QtQuick::ListView::model
     This property holds the model providing data for the list.
@@ -2043,118 +2043,130 @@ QSGNode *QQuickTextEdit::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *
         if (!oldNode)
             rootNode = new RootNode;
 
-        int firstDirtyPos = 0;
-        if (nodeIterator != d->textNodeMap.end()) {
-            firstDirtyPos = (*nodeIterator)->startPos();
-            do {
-                rootNode->removeChildNode((*nodeIterator)->textNode());
-                delete (*nodeIterator)->textNode();
-                delete *nodeIterator;
-                nodeIterator = d->textNodeMap.erase(nodeIterator);
-            } while (nodeIterator != d->textNodeMap.end() && (*nodeIterator)->dirty());
-        }
-
         // FIXME: the text decorations could probably be handled separately (only updated for affected textFrames)
         rootNode->resetFrameDecorations(d->createTextNode());
         resetEngine(&frameDecorationsEngine, d->color, d->selectedTextColor, d->selectionColor);
 
-        QQuickTextNode *node = 0;
-
-        int currentNodeSize = 0;
-        int nodeStart = firstDirtyPos;
         QPointF basePosition(d->xoff, d->yoff);
         QMatrix4x4 basePositionMatrix;
         basePositionMatrix.translate(basePosition.x(), basePosition.y());
         rootNode->setMatrix(basePositionMatrix);
 
-        QPointF nodeOffset;
-        TextNode *firstCleanNode = (nodeIterator != d->textNodeMap.end()) ? *nodeIterator : 0;
-
-        QList<QTextFrame *> frames;
-        frames.append(d->document->rootFrame());
-
-        while (!frames.isEmpty()) {
-            QTextFrame *textFrame = frames.takeFirst();
-            frames.append(textFrame->childFrames());
-            frameDecorationsEngine.addFrameDecorations(d->document, textFrame);
-
-            if (textFrame->lastPosition() < firstDirtyPos || (firstCleanNode && textFrame->firstPosition() >= firstCleanNode->startPos()))
-                continue;
-            node = d->createTextNode();
-            resetEngine(&engine, d->color, d->selectedTextColor, d->selectionColor);
-
-            if (textFrame->firstPosition() > textFrame->lastPosition()
-                    && textFrame->frameFormat().position() != QTextFrameFormat::InFlow) {
-                updateNodeTransform(node, d->document->documentLayout()->frameBoundingRect(textFrame).topLeft());
-                const int pos = textFrame->firstPosition() - 1;
-                ProtectedLayoutAccessor *a = static_cast<ProtectedLayoutAccessor *>(d->document->documentLayout());
-                QTextCharFormat format = a->formatAccessor(pos);
-                QTextBlock block = textFrame->firstCursorPosition().block();
-                engine.setCurrentLine(block.layout()->lineForTextPosition(pos - block.position()));
-                engine.addTextObject(QPointF(0, 0), format, QQuickTextNodeEngine::Unselected, d->document,
-                                              pos, textFrame->frameFormat().position());
-                nodeStart = pos;
-            } else {
-                // Having nodes spanning across frame boundaries will break the current bookkeeping mechanism. We need to prevent that.
-                QList<int> frameBoundaries;
-                frameBoundaries.reserve(frames.size());
-                for (QTextFrame *frame : qAsConst(frames))
-                    frameBoundaries.append(frame->firstPosition());
-                std::sort(frameBoundaries.begin(), frameBoundaries.end());
-
-                QTextFrame::iterator it = textFrame->begin();
-                while (!it.atEnd()) {
-                    QTextBlock block = it.currentBlock();
-                    ++it;
-                    if (block.position() < firstDirtyPos)
-                        continue;
-
-                    if (!engine.hasContents()) {
-                        nodeOffset = d->document->documentLayout()->blockBoundingRect(block).topLeft();
-                        updateNodeTransform(node, nodeOffset);
-                        nodeStart = block.position();
-                    }
-
-                    engine.addTextBlock(d->document, block, -nodeOffset, d->color, QColor(), selectionStart(), selectionEnd() - 1);
-                    currentNodeSize += block.length();
-
-                    if ((it.atEnd()) || (firstCleanNode && block.next().position() >= firstCleanNode->startPos())) // last node that needed replacing or last block of the frame
-                        break;
+        // Regenerate every run of dirty nodes, keeping the clean nodes in between
+        // so that an edit or a selection change only re-creates the glyph nodes
+        // of the blocks it touched.
+        bool frameDecorationsAdded = false;
+        do {
+            int firstDirtyPos = 0;
+            if (nodeIterator != d->textNodeMap.end()) {
+                firstDirtyPos = (*nodeIterator)->startPos();
+                do {
+                    rootNode->removeChildNode((*nodeIterator)->textNode());
+                    delete (*nodeIterator)->textNode();
+                    delete *nodeIterator;
+                    nodeIterator = d->textNodeMap.erase(nodeIterator);
+                } while (nodeIterator != d->textNodeMap.end() && (*nodeIterator)->dirty());
+            }
 
-                    QList<int>::const_iterator lowerBound = std::lower_bound(frameBoundaries.constBegin(), frameBoundaries.constEnd(), block.next().position());
-                    if (currentNodeSize > nodeBreakingSize || lowerBound == frameBoundaries.constEnd() || *lowerBound > nodeStart) {
-                        currentNodeSize = 0;
-                        d->addCurrentTextNodeToRoot(&engine, rootNode, node, nodeIterator, nodeStart);
-                        node = d->createTextNode();
-                        resetEngine(&engine, d->color, d->selectedTextColor, d->selectionColor);
-                        nodeStart = block.next().position();
+            QQuickTextNode *node = 0;
+
+            int currentNodeSize = 0;
+            int nodeStart = firstDirtyPos;
+            QPointF nodeOffset;
+            TextNode *firstCleanNode = (nodeIterator != d->textNodeMap.end()) ? *nodeIterator : 0;
+
+            QList<QTextFrame *> frames;
+            frames.append(d->document->rootFrame());
+
+            while (!frames.isEmpty()) {
+                QTextFrame *textFrame = frames.takeFirst();
+                frames.append(textFrame->childFrames());
+                if (!frameDecorationsAdded)
+                    frameDecorationsEngine.addFrameDecorations(d->document, textFrame);
+
+                if (textFrame->lastPosition() < firstDirtyPos || (firstCleanNode && textFrame->firstPosition() >= firstCleanNode->startPos()))
+                    continue;
+                node = d->createTextNode();
+                resetEngine(&engine, d->color, d->selectedTextColor, d->selectionColor);
+
+                if (textFrame->firstPosition() > textFrame->lastPosition()
+                        && textFrame->frameFormat().position() != QTextFrameFormat::InFlow) {
+                    updateNodeTransform(node, d->document->documentLayout()->frameBoundingRect(textFrame).topLeft());
+                    const int pos = textFrame->firstPosition() - 1;
+                    ProtectedLayoutAccessor *a = static_cast<ProtectedLayoutAccessor *>(d->document->documentLayout());
+                    QTextCharFormat format = a->formatAccessor(pos);
+                    QTextBlock block = textFrame->firstCursorPosition().block();
+                    engine.setCurrentLine(block.layout()->lineForTextPosition(pos - block.position()));
+                    engine.addTextObject(QPointF(0, 0), format, QQuickTextNodeEngine::Unselected, d->document,
+                                                  pos, textFrame->frameFormat().position());
+                    nodeStart = pos;
+                } else {
+                    // Having nodes spanning across frame boundaries will break the current bookkeeping mechanism. We need to prevent that.
+                    QList<int> frameBoundaries;
+                    frameBoundaries.reserve(frames.size());
+                    for (QTextFrame *frame : qAsConst(frames))
+                        frameBoundaries.append(frame->firstPosition());
+                    std::sort(frameBoundaries.begin(), frameBoundaries.end());
+
+                    QTextFrame::iterator it = textFrame->begin();
+                    while (!it.atEnd()) {
+                        QTextBlock block = it.currentBlock();
+                        ++it;
+                        if (block.position() < firstDirtyPos)
+                            continue;
+
+                        if (!engine.hasContents()) {
+                            nodeOffset = d->document->documentLayout()->blockBoundingRect(block).topLeft();
+                            updateNodeTransform(node, nodeOffset);
+                            nodeStart = block.position();
+                        }
+
+                        engine.addTextBlock(d->document, block, -nodeOffset, d->color, QColor(), selectionStart(), selectionEnd() - 1);
+                        currentNodeSize += block.length();
+
+                        if ((it.atEnd()) || (firstCleanNode && block.next().position() >= firstCleanNode->startPos())) // last node that needed replacing or last block of the frame
+                            break;
+
+                        QList<int>::const_iterator lowerBound = std::lower_bound(frameBoundaries.constBegin(), frameBoundaries.constEnd(), block.next().position());
+                        if (currentNodeSize > nodeBreakingSize || lowerBound == frameBoundaries.constEnd() || *lowerBound > nodeStart) {
+                            currentNodeSize = 0;
+                            d->addCurrentTextNodeToRoot(&engine, rootNode, node, nodeIterator, nodeStart);
+                            node = d->createTextNode();
+                            resetEngine(&engine, d->color, d->selectedTextColor, d->selectionColor);
+                            nodeStart = block.next().position();
+                        }
                     }
                 }
+                d->addCurrentTextNodeToRoot(&engine, rootNode, node, nodeIterator, nodeStart);
             }
-            d->addCurrentTextNodeToRoot(&engine, rootNode, node, nodeIterator, nodeStart);
-        }
-        frameDecorationsEngine.addToSceneGraph(rootNode->frameDecorationsNode, QQuickText::Normal, QColor());
-        // Now prepend the frame decorations since we want them rendered first, with the text nodes and cursor in front.
-        rootNode->prependChildNode(rootNode->frameDecorationsNode);
+            Q_ASSERT(nodeIterator == d->textNodeMap.end() || (*nodeIterator) == firstCleanNode);
+            // Update the position of the subsequent text blocks.
+            if (firstCleanNode) {
+                QPointF oldOffset = firstCleanNode->textNode()->matrix().map(QPointF(0,0));
+                QPointF currentOffset = d->document->documentLayout()->blockBoundingRect(d->document->findBlock(firstCleanNode->startPos())).topLeft();
+                QPointF delta = currentOffset - oldOffset;
+                while (nodeIterator != d->textNodeMap.end()) {
+                    QMatrix4x4 transformMatrix = (*nodeIterator)->textNode()->matrix();
+                    transformMatrix.translate(delta.x(), delta.y());
+                    (*nodeIterator)->textNode()->setMatrix(transformMatrix);
+                    ++nodeIterator;
+                }
 
-        Q_ASSERT(nodeIterator == d->textNodeMap.end() || (*nodeIterator) == firstCleanNode);
-        // Update the position of the subsequent text blocks.
-        if (firstCleanNode) {
-            QPointF oldOffset = firstCleanNode->textNode()->matrix().map(QPointF(0,0));
-            QPointF currentOffset = d->document->documentLayout()->blockBoundingRect(d->document->findBlock(firstCleanNode->startPos())).topLeft();
-            QPointF delta = currentOffset - oldOffset;
-            while (nodeIterator != d->textNodeMap.end()) {
-                QMatrix4x4 transformMatrix = (*nodeIterator)->textNode()->matrix();
-                transformMatrix.translate(delta.x(), delta.y());
-                (*nodeIterator)->textNode()->setMatrix(transformMatrix);
-                ++nodeIterator;
             }
 
-        }
+            // Since we iterate over blocks from different text frames that are potentially not sorted
+            // we need to ensure that our list of nodes is sorted again:
+            std::sort(d->textNodeMap.begin(), d->textNodeMap.end(), &comesBefore);
+            frameDecorationsAdded = true;
+
+            nodeIterator = d->textNodeMap.begin();
+            while (nodeIterator != d->textNodeMap.end() && !(*nodeIterator)->dirty())
+                ++nodeIterator;
+        } while (nodeIterator != d->textNodeMap.end());
 
-        // Since we iterate over blocks from different text frames that are potentially not sorted
-        // we need to ensure that our list of nodes is sorted again:
-        std::sort(d->textNodeMap.begin(), d->textNodeMap.end(), &comesBefore);
+        frameDecorationsEngine.addToSceneGraph(rootNode->frameDecorationsNode, QQuickText::Normal, QColor());
+        // Now prepend the frame decorations since we want them rendered first, with the text nodes and cursor in front.
+        rootNode->prependChildNode(rootNode->frameDecorationsNode);
     }
 
     if (d->cursorComponent == 0) {
@@ -2392,7 +2404,18 @@ void QQuickTextEdit::updateSelection()
 
     // No need for node updates when we go from an empty selection to another empty selection
     if (d->control->textCursor().hasSelection() || d->hadSelection) {
-        markDirtyNodesForRange(qMin(d->lastSelectionStart, d->control->textCursor().selectionStart()), qMax(d->control->textCursor().selectionEnd(), d->lastSelectionEnd), 0);
+        const int newSelectionStart = d->control->textCursor().selectionStart();
+        const int newSelectionEnd = d->control->textCursor().selectionEnd();
+        if (!d->hadSelection) {
+            markDirtyNodesForRange(newSelectionStart, newSelectionEnd, 0);
+        } else if (!d->control->textCursor().hasSelection()) {
+            markDirtyNodesForRange(d->lastSelectionStart, d->lastSelectionEnd, 0);
+        } else {
+            // Only the text between the old and the new selection boundaries changes
+            // appearance, so leave the nodes in the middle of the selection alone.
+            markDirtyNodesForRange(qMin(d->lastSelectionStart, newSelectionStart), qMax(d->lastSelectionStart, newSelectionStart), 0);
+            markDirtyNodesForRange(qMin(d->lastSelectionEnd, newSelectionEnd), qMax(d->lastSelectionEnd, newSelectionEnd), 0);
+        }
         polish();
         if (isComponentComplete()) {
             d->updateType = QQuickTextEditPrivate::UpdatePaintNode;
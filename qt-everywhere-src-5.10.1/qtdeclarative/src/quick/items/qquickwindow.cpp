@@ -72,6 +72,7 @@
 #include <QtQuick/private/qquickpixmapcache_p.h>
 
 #include <private/qqmlmemoryprofiler_p.h>
+#include <private/qqmlengine_p.h>
 #include <private/qqmldebugserviceinterfaces_p.h>
 #include <private/qqmldebugconnector_p.h>
 #if QT_CONFIG(opengl)
@@ -289,6 +290,18 @@ static bool transformDirtyOnItemOrAncestor(const QQuickItem *item)
 
 void QQuickWindowPrivate::polishItems()
 {
+    // With deferred binding updates, the bindings must be up to date before
+    // the items are polished and the scene graph is synchronized.
+    Q_Q(QQuickWindow);
+    QQmlEngine *engine = qmlEngine(q);
+    if (!engine)
+        engine = qmlEngine(contentItem);
+    if (engine) {
+        QQmlEnginePrivate *ep = QQmlEnginePrivate::get(engine);
+        if (ep->deferBindingUpdates)
+            ep->flushDeferredBindings();
+    }
+
     // An item can trigger polish on another item, or itself for that matter,
     // during its updatePolish() call. Because of this, we cannot simply
     // iterate through the set, we must continue pulling items out until it
@@ -3222,8 +3235,10 @@ void QQuickWindowPrivate::updateDirtyNode(QQuickItem *item)
         if (itemPriv->x != 0. || itemPriv->y != 0.)
             matrix.translate(itemPriv->x, itemPriv->y);
 
-        for (int ii = itemPriv->transforms.count() - 1; ii >= 0; --ii)
-            itemPriv->transforms.at(ii)->applyTo(&matrix);
+        if (itemPriv->hasTransforms()) {
+            for (int ii = itemPriv->extra->transforms.count() - 1; ii >= 0; --ii)
+                itemPriv->extra->transforms.at(ii)->applyTo(&matrix);
+        }
 
         if (itemPriv->scale() != 1. || itemPriv->rotation() != 0.) {
             QPointF origin = item->transformOriginPoint();
@@ -4941,6 +4956,60 @@ void QQuickWindow::setTextRenderType(QQuickWindow::TextRenderType renderType)
     QQuickWindowPrivate::textRenderType = renderType;
 }
 
+/*!
+    \class QQuickWindow::FrameStatistics
+    \inmodule QtQuick
+    \since 5.11
+
+    \brief The FrameStatistics struct describes the timing of the frames
+    rendered for a QQuickWindow.
+
+    All durations are in milliseconds and averaged over the recent frames.
+    The timestamps are in milliseconds in the time base of
+    QElapsedTimer::msecsSinceReference().
+
+    \list
+    \li \c frameCount is the number of frames presented so far.
+    \li \c lateSyncCount is the number of frames for which the
+    synchronization with the GUI thread started too late to render the frame
+    in time for the next predicted present.
+    \li \c renderAhead is the number of frames the render thread may
+    currently queue up on the GPU, or 0 when frame pacing is disabled.
+    \li \c frameInterval is the measured interval between presented frames.
+    \li \c syncTime and \c renderTime are the time spent in the
+    synchronization and the rendering of a frame.
+    \li \c lastPresentTime is the time the last frame was presented and
+    \c predictedPresentTime the time the last submitted frame is expected
+    to reach the screen.
+    \endlist
+
+    \sa QQuickWindow::frameStatistics()
+*/
+
+/*!
+    \since 5.11
+
+    Returns the timing statistics of the frames rendered for this window.
+
+    The statistics are only gathered by the \c threaded render loop; with
+    other render loops, a default constructed FrameStatistics is returned.
+
+    Setting the \c QSG_RENDER_AHEAD environment variable to 1 or 2 enables
+    frame pacing in the \c threaded render loop: the render thread then
+    waits for the GPU before it gets more than that many frames ahead. When
+    the synchronization misses its deadline, the render thread is allowed to
+    use the full render-ahead; after a series of frames on time, it goes back
+    to a single frame to keep the latency low.
+
+    \note This function is thread-safe.
+*/
+QQuickWindow::FrameStatistics QQuickWindow::frameStatistics() const
+{
+    Q_D(const QQuickWindow);
+    QMutexLocker locker(&d->frameStatisticsMutex);
+    return d->frameStatistics;
+}
+
 #ifndef QT_NO_DEBUG_STREAM
 QDebug operator<<(QDebug debug, const QQuickWindow *win)
 {
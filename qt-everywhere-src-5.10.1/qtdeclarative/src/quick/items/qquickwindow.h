@@ -106,6 +106,17 @@ public:
     };
     Q_ENUM(TextRenderType)
 
+    struct FrameStatistics {
+        int frameCount = 0;
+        int lateSyncCount = 0;
+        int renderAhead = 0;
+        qreal frameInterval = 0;
+        qreal syncTime = 0;
+        qreal renderTime = 0;
+        qint64 lastPresentTime = 0;
+        qint64 predictedPresentTime = 0;
+    };
+
     explicit QQuickWindow(QWindow *parent = Q_NULLPTR);
     explicit QQuickWindow(QQuickRenderControl *renderControl);
 
@@ -179,6 +190,8 @@ public:
     static TextRenderType textRenderType();
     static void setTextRenderType(TextRenderType renderType);
 
+    FrameStatistics frameStatistics() const;
+
 Q_SIGNALS:
     void frameSwapped();
     Q_REVISION(2) void openglContextCreated(QOpenGLContext *context);
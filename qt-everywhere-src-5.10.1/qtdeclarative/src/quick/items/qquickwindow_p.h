@@ -319,6 +319,9 @@ public:
                                               QString *untranslatedMessage,
                                               bool isEs);
 
+    mutable QMutex frameStatisticsMutex;
+    QQuickWindow::FrameStatistics frameStatistics;
+
     QMutex renderJobMutex;
     QList<QRunnable *> beforeSynchronizingJobs;
     QList<QRunnable *> afterSynchronizingJobs;
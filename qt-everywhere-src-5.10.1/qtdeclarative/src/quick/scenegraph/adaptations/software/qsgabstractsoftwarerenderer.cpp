@@ -45,6 +45,13 @@
 #include "qsgsoftwarerenderablenode_p.h"
 
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QRunnable>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVarLengthArray>
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
 #include <QtGui/QWindow>
 #include <QtQuick/QSGSimpleRectNode>
 
@@ -52,6 +59,73 @@ Q_LOGGING_CATEGORY(lc2DRender, "qt.scenegraph.softwarecontext.abstractrenderer")
 
 QT_BEGIN_NAMESPACE
 
+int qt_sg_envInt(const char *name, int defaultValue);
+
+#ifndef QT_NO_THREAD
+
+Q_GLOBAL_STATIC(QThreadPool, qsg_softwareRenderThreadPool)
+
+// The damaged area is split in horizontal bands, each of them painted
+// with its own QPainter into the rows of the target image it covers.
+struct BandPaintJob
+{
+    const QVarLengthArray<QSGSoftwareRenderableNode *, 64> *nodes;
+    QSGSoftwareRenderableNode *background;
+    const QImage *target;
+    uchar *bits;
+    QPainter::RenderHints renderHints;
+    QRect area;
+    int bandHeight;
+    int bandCount;
+    QAtomicInt next;
+    QSemaphore done;
+};
+
+class BandPaintTask : public QRunnable
+{
+public:
+    BandPaintTask(BandPaintJob *job) : m_job(job) { }
+
+    void run() override
+    {
+        paintBands(m_job);
+        m_job->done.release();
+    }
+
+    static void paintBands(BandPaintJob *job)
+    {
+        const QImage *target = job->target;
+        const int dpr = target->devicePixelRatio();
+        for (int band = job->next.fetchAndAddRelaxed(1); band < job->bandCount; band = job->next.fetchAndAddRelaxed(1)) {
+            const int y = job->area.y() + band * job->bandHeight;
+            const int height = qMin(job->bandHeight, job->area.y() + job->area.height() - y);
+            const QRect bandRect(job->area.x(), y, job->area.width(), height);
+
+            QImage bandImage(job->bits + y * dpr * target->bytesPerLine(),
+                             target->width(), height * dpr, target->bytesPerLine(), target->format());
+            bandImage.setDevicePixelRatio(dpr);
+
+            QPainter painter(&bandImage);
+            painter.setRenderHints(job->renderHints);
+            // Map the logical coordinates of the band to the top of the image
+            painter.setWindow(0, y, bandImage.width(), bandImage.height());
+            painter.setViewport(0, 0, bandImage.width(), bandImage.height());
+
+            for (int i = 0; i < job->nodes->size(); ++i) {
+                QSGSoftwareRenderableNode *node = job->nodes->at(i);
+                const QRegion region = node->dirtyRegion() & bandRect;
+                if (!region.isEmpty())
+                    node->paintRegion(&painter, region, node == job->background);
+            }
+        }
+    }
+
+private:
+    BandPaintJob *m_job;
+};
+
+#endif
+
 QSGAbstractSoftwareRenderer::QSGAbstractSoftwareRenderer(QSGRenderContext *context)
     : QSGRenderer(context)
     , m_background(new QSGSimpleRectNode)
@@ -60,6 +134,14 @@ QSGAbstractSoftwareRenderer::QSGAbstractSoftwareRenderer(QSGRenderContext *conte
     // Setup special background node
     auto backgroundRenderable = new QSGSoftwareRenderableNode(QSGSoftwareRenderableNode::SimpleRect, m_background);
     addNodeMapping(m_background, backgroundRenderable);
+
+#ifndef QT_NO_THREAD
+    m_renderThreadCount = qt_sg_envInt("QSG_SOFTWARE_RENDER_THREADS", qBound(1, QThread::idealThreadCount(), 4));
+#else
+    m_renderThreadCount = 1;
+#endif
+    m_renderThreadAreaThreshold = qt_sg_envInt("QSG_SOFTWARE_RENDER_THREAD_AREA_THRESHOLD", 256 * 256);
+    qCDebug(lc2DRender) << "Render threads:" << m_renderThreadCount << "area threshold:" << m_renderThreadAreaThreshold;
 }
 
 QSGAbstractSoftwareRenderer::~QSGAbstractSoftwareRenderer()
@@ -123,6 +205,9 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
     if (m_renderableNodes.isEmpty())
         return dirtyRegion;
 
+    if (renderNodesConcurrently(painter, &dirtyRegion))
+        return dirtyRegion;
+
     auto iterator = m_renderableNodes.begin();
     // First node is the background and needs to painted without blending
     auto backgroundNode = *iterator;
@@ -137,6 +222,77 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
     return dirtyRegion;
 }
 
+bool QSGAbstractSoftwareRenderer::renderNodesConcurrently(QPainter *painter, QRegion *dirtyRegion)
+{
+#ifndef QT_NO_THREAD
+    if (m_renderThreadCount < 2)
+        return false;
+
+    // Bands are painted straight into the rows of the target image, so the
+    // painter must not do anything but the device pixel ratio scaling
+    QPaintDevice *device = painter->device();
+    if (device->devType() != QInternal::Image || device->devicePixelRatioF() != device->devicePixelRatio())
+        return false;
+    if (painter->hasClipping() || !painter->worldTransform().isIdentity() || painter->window() != painter->viewport())
+        return false;
+
+    QVarLengthArray<QSGSoftwareRenderableNode *, 64> nodes;
+    QRect damage;
+    for (auto node : qAsConst(m_renderableNodes)) {
+        if (!node->needsPainting())
+            continue;
+        if (!node->canPaintConcurrently())
+            return false;
+        nodes.append(node);
+        damage |= node->dirtyRegion().boundingRect();
+    }
+
+    QImage *target = static_cast<QImage *>(device);
+    const int dpr = target->devicePixelRatio();
+    damage &= QRect(0, 0, target->width() / dpr, target->height() / dpr);
+    if (damage.width() * damage.height() < m_renderThreadAreaThreshold)
+        return false;
+
+    // A few more bands than threads, to balance the load
+    const int bandCount = qMin(m_renderThreadCount * 2, damage.height() / 16);
+    if (bandCount < 2)
+        return false;
+
+    for (int i = 0; i < nodes.size(); ++i)
+        nodes.at(i)->prepareForPainting(painter);
+
+    BandPaintJob job;
+    job.nodes = &nodes;
+    job.background = renderableNode(m_background);
+    job.target = target;
+    job.bits = target->bits();
+    job.renderHints = painter->renderHints();
+    job.area = damage;
+    job.bandHeight = (damage.height() + bandCount - 1) / bandCount;
+    job.bandCount = (damage.height() + job.bandHeight - 1) / job.bandHeight;
+    const int taskCount = qMin(m_renderThreadCount, job.bandCount) - 1;
+    for (int i = 0; i < taskCount; ++i)
+        qsg_softwareRenderThreadPool()->start(new BandPaintTask(&job));
+    // The render thread takes its share of the bands as well.
+    BandPaintTask::paintBands(&job);
+    job.done.acquire(taskCount);
+
+    for (int i = 0; i < nodes.size(); ++i)
+        *dirtyRegion += nodes.at(i)->finishPainting();
+    // Nothing is left to paint, this only resets the dirty state of the
+    // nodes which were skipped
+    for (auto node : qAsConst(m_renderableNodes))
+        node->renderNode(painter);
+
+    qCDebug(lc2DRender) << "renderNodesConcurrently" << nodes.size() << "nodes" << job.bandCount << "bands" << damage;
+    return true;
+#else
+    Q_UNUSED(painter);
+    Q_UNUSED(dirtyRegion);
+    return false;
+#endif
+}
+
 void QSGAbstractSoftwareRenderer::buildRenderList()
 {
     // Clear the previous renderlist
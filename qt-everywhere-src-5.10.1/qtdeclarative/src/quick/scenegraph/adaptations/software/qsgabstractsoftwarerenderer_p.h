@@ -79,6 +79,7 @@ public:
 
 protected:
     QRegion renderNodes(QPainter *painter);
+    bool renderNodesConcurrently(QPainter *painter, QRegion *dirtyRegion);
     void buildRenderList();
     QRegion optimizeRenderList();
 
@@ -106,6 +107,9 @@ private:
     QRegion m_obscuredRegion;
     bool m_isOpaque = false;
 
+    int m_renderThreadCount;
+    int m_renderThreadAreaThreshold;
+
     QSGSoftwareRenderableNodeUpdater *m_nodeUpdater;
 };
 
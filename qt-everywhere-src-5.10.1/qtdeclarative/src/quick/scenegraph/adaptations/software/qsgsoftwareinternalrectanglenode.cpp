@@ -223,14 +223,20 @@ void QSGSoftwareInternalRectangleNode::update()
     }
 }
 
+void QSGSoftwareInternalRectangleNode::setDevicePixelRatio(int ratio)
+{
+    if (ratio == m_devicePixelRatio)
+        return;
+
+    m_devicePixelRatio = ratio;
+    generateCornerPixmap();
+}
+
 void QSGSoftwareInternalRectangleNode::paint(QPainter *painter)
 {
     //We can only check for a device pixel ratio change when we know what
     //paint device is being used.
-    if (painter->device()->devicePixelRatio() != m_devicePixelRatio) {
-        m_devicePixelRatio = painter->device()->devicePixelRatio();
-        generateCornerPixmap();
-    }
+    setDevicePixelRatio(painter->device()->devicePixelRatio());
 
     if (painter->transform().isRotating()) {
         //Rotated rectangles lose the benefits of direct rendering, and have poor rendering
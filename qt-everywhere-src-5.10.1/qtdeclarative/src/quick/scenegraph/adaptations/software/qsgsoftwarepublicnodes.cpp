@@ -94,8 +94,7 @@ void QSGSoftwareImageNode::setTextureCoordinatesTransform(QSGImageNode::TextureC
 
 void QSGSoftwareImageNode::paint(QPainter *painter)
 {
-    if (m_cachedMirroredPixmapIsDirty)
-        updateCachedMirroredPixmap();
+    updateCachedPixmap();
 
     painter->setRenderHint(QPainter::SmoothPixmapTransform, (m_filtering == QSGTexture::Linear));
 
@@ -110,6 +109,12 @@ void QSGSoftwareImageNode::paint(QPainter *painter)
     }
 }
 
+void QSGSoftwareImageNode::updateCachedPixmap()
+{
+    if (m_cachedMirroredPixmapIsDirty)
+        updateCachedMirroredPixmap();
+}
+
 void QSGSoftwareImageNode::updateCachedMirroredPixmap()
 {
     if (m_transformMode == NoTransform) {
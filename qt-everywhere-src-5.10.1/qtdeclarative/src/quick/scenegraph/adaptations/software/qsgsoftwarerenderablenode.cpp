@@ -54,12 +54,29 @@
 #include <private/qsgrendernode_p.h>
 #include <private/qsgtexture_p.h>
 
+#include <QtCore/qmutex.h>
 #include <qmath.h>
 
 Q_LOGGING_CATEGORY(lcRenderable, "qt.scenegraph.softwarecontext.renderable")
 
 QT_BEGIN_NAMESPACE
 
+int qt_sg_envInt(const char *name, int defaultValue);
+
+// Memory, in bytes, used by the layers of all renderable nodes
+static QBasicAtomicInt qsg_layerCacheUsage = Q_BASIC_ATOMIC_INITIALIZER(0);
+
+static bool qsg_reserveLayerCache(int bytes)
+{
+    static const int budget = qBound(0, qt_sg_envInt("QSG_SOFTWARE_LAYER_CACHE_SIZE", 16384), INT_MAX / 1024) * 1024;
+    int used = qsg_layerCacheUsage.load();
+    do {
+        if (bytes > budget - used)
+            return false;
+    } while (!qsg_layerCacheUsage.testAndSetOrdered(used, used + bytes, used));
+    return true;
+}
+
 // Largest subrectangle with integer coordinates
 inline QRect toRectMin(const QRectF & r)
 {
@@ -82,6 +99,7 @@ QSGSoftwareRenderableNode::QSGSoftwareRenderableNode(NodeType type, QSGNode *nod
     , m_isDirty(true)
     , m_hasClipRegion(false)
     , m_opacity(1.0f)
+    , m_unchangedPaintCount(0)
 {
     switch (m_nodeType) {
     case QSGSoftwareRenderableNode::SimpleRect:
@@ -127,7 +145,7 @@ QSGSoftwareRenderableNode::QSGSoftwareRenderableNode(NodeType type, QSGNode *nod
 
 QSGSoftwareRenderableNode::~QSGSoftwareRenderableNode()
 {
-
+    releaseLayer();
 }
 
 void QSGSoftwareRenderableNode::update()
@@ -136,6 +154,10 @@ void QSGSoftwareRenderableNode::update()
     m_isDirty = true;
     m_isOpaque = false;
 
+    // Whatever changed, the rasterized content is out of date
+    releaseLayer();
+    m_unchangedPaintCount = 0;
+
     QRectF boundingRect;
 
     switch (m_nodeType) {
@@ -247,50 +269,107 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
     Q_ASSERT(painter);
 
     // Check for don't paint conditions
-    if (m_nodeType != RenderNode) {
-        if (!m_isDirty || qFuzzyIsNull(m_opacity) || m_dirtyRegion.isEmpty()) {
-            m_isDirty = false;
-            m_dirtyRegion = QRegion();
-            return QRegion();
-        }
-    } else {
-        if (!m_isDirty || qFuzzyIsNull(m_opacity)) {
-            m_isDirty = false;
-            m_dirtyRegion = QRegion();
-            return QRegion();
-        } else {
-            QSGRenderNodePrivate *rd = QSGRenderNodePrivate::get(m_handle.renderNode);
-            QMatrix4x4 m = m_transform;
-            rd->m_matrix = &m;
-            rd->m_opacity = m_opacity;
-
-            // all the clip region below is in world coordinates, taking m_transform into account already
-            QRegion cr = m_dirtyRegion;
-            if (m_clipRegion.rectCount() > 1)
-                cr &= m_clipRegion;
-
-            painter->save();
-            RenderNodeState rs;
-            rs.cr = cr;
-            m_handle.renderNode->render(&rs);
-            painter->restore();
-
-            const QRect br = m_handle.renderNode->flags().testFlag(QSGRenderNode::BoundedRectRendering)
-                ? m_boundingRectMax // already mapped to world
-                : QRect(0, 0, painter->device()->width(), painter->device()->height());
-            m_previousDirtyRegion = QRegion(br);
-            m_isDirty = false;
-            m_dirtyRegion = QRegion();
-            return br;
-        }
+    if (!needsPainting()) {
+        m_isDirty = false;
+        m_dirtyRegion = QRegion();
+        return QRegion();
+    }
+
+    if (m_nodeType == RenderNode) {
+        QSGRenderNodePrivate *rd = QSGRenderNodePrivate::get(m_handle.renderNode);
+        QMatrix4x4 m = m_transform;
+        rd->m_matrix = &m;
+        rd->m_opacity = m_opacity;
+
+        // all the clip region below is in world coordinates, taking m_transform into account already
+        QRegion cr = m_dirtyRegion;
+        if (m_clipRegion.rectCount() > 1)
+            cr &= m_clipRegion;
+
+        painter->save();
+        RenderNodeState rs;
+        rs.cr = cr;
+        m_handle.renderNode->render(&rs);
+        painter->restore();
+
+        const QRect br = m_handle.renderNode->flags().testFlag(QSGRenderNode::BoundedRectRendering)
+            ? m_boundingRectMax // already mapped to world
+            : QRect(0, 0, painter->device()->width(), painter->device()->height());
+        m_previousDirtyRegion = QRegion(br);
+        m_isDirty = false;
+        m_dirtyRegion = QRegion();
+        return br;
+    }
+
+    prepareForPainting(painter);
+    paintRegion(painter, m_dirtyRegion, forceOpaquePainting);
+    return finishPainting();
+}
+
+bool QSGSoftwareRenderableNode::needsPainting() const
+{
+    if (!m_isDirty || qFuzzyIsNull(m_opacity))
+        return false;
+    // Render nodes are not limited to their dirty region
+    return m_nodeType == RenderNode || !m_dirtyRegion.isEmpty();
+}
+
+bool QSGSoftwareRenderableNode::canPaintConcurrently() const
+{
+    switch (m_nodeType) {
+    case QSGSoftwareRenderableNode::RenderNode:
+        // Renders through the active painter of the render context
+        return false;
+    case QSGSoftwareRenderableNode::Rectangle:
+        // Rotated rectangles go through a temporary QPixmap, unless cached
+        return !m_transform.isRotating() || !m_layer.isNull();
+    default:
+        return true;
+    }
+}
+
+void QSGSoftwareRenderableNode::prepareForPainting(QPainter *painter)
+{
+    // Anything lazily updated at paint time must be done here, so that
+    // paintRegion() does not modify the node
+    switch (m_nodeType) {
+    case QSGSoftwareRenderableNode::Rectangle:
+        m_handle.rectangleNode->setDevicePixelRatio(painter->device()->devicePixelRatio());
+        break;
+    case QSGSoftwareRenderableNode::SimpleImage:
+        static_cast<QSGSoftwareImageNode *>(m_handle.simpleImageNode)->updateCachedPixmap();
+        break;
+    default:
+        break;
     }
 
+    if (!canUseLayer(painter)) {
+        releaseLayer();
+        return;
+    }
+
+    // Only keep a layer for nodes which are repainted without being changed
+    if (m_layer.isNull() && ++m_unchangedPaintCount > 1)
+        updateLayer(painter);
+}
+
+void QSGSoftwareRenderableNode::paintRegion(QPainter *painter, const QRegion &region, bool forceOpaquePainting)
+{
     painter->save();
-    painter->setOpacity(m_opacity);
 
-    // Set clipRegion to m_dirtyRegion (in world coordinates, so must be done before the setTransform below)
+    // Set clipRegion to region (in world coordinates, so must be done before the setTransform below)
     // as m_dirtyRegion already accounts for clipRegion
-    painter->setClipRegion(m_dirtyRegion, Qt::ReplaceClip);
+    painter->setClipRegion(region, Qt::ReplaceClip);
+
+    if (!m_layer.isNull()) {
+        // Opacity, transform and clipRegion are already applied to the layer
+        painter->setTransform(QTransform(), false);
+        painter->drawImage(m_layerRect.topLeft(), m_layer);
+        painter->restore();
+        return;
+    }
+
+    painter->setOpacity(m_opacity);
     if (m_clipRegion.rectCount() > 1)
         painter->setClipRegion(m_clipRegion, Qt::IntersectClip);
 
@@ -298,6 +377,23 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
     if (forceOpaquePainting || m_isOpaque)
         painter->setCompositionMode(QPainter::CompositionMode_Source);
 
+    paintContent(painter);
+
+    painter->restore();
+}
+
+QRegion QSGSoftwareRenderableNode::finishPainting()
+{
+    QRegion areaToBeFlushed = m_dirtyRegion;
+    m_previousDirtyRegion = QRegion(m_boundingRectMax);
+    m_isDirty = false;
+    m_dirtyRegion = QRegion();
+
+    return areaToBeFlushed;
+}
+
+void QSGSoftwareRenderableNode::paintContent(QPainter *painter)
+{
     switch (m_nodeType) {
     case QSGSoftwareRenderableNode::SimpleRect:
         painter->fillRect(m_handle.simpleRectNode->rect(), m_handle.simpleRectNode->color());
@@ -324,7 +420,12 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
         m_handle.rectangleNode->paint(painter);
         break;
     case QSGSoftwareRenderableNode::Glyph:
+    {
+        // The glyph caches of the font engines are not thread-safe
+        static QBasicMutex glyphMutex;
+        QMutexLocker locker(&glyphMutex);
         m_handle.glpyhNode->paint(painter);
+    }
         break;
     case QSGSoftwareRenderableNode::NinePatch:
         m_handle.ninePatchNode->paint(painter);
@@ -343,15 +444,62 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
     default:
         break;
     }
+}
 
-    painter->restore();
+bool QSGSoftwareRenderableNode::canUseLayer(QPainter *painter) const
+{
+    // Only nodes which are expensive to paint and blended anyway, opaque
+    // nodes are painted with CompositionMode_Source.
+    if (m_isOpaque || (m_nodeType != Rectangle && m_nodeType != NinePatch))
+        return false;
+    if (m_boundingRectMax.isEmpty())
+        return false;
+
+    // The layer is blitted 1:1, so the device must not scale beyond its
+    // (integer) device pixel ratio
+    const int dpr = painter->device()->devicePixelRatio();
+    if (painter->device()->devicePixelRatioF() != dpr)
+        return false;
+    const QTransform deviceTransform = painter->deviceTransform();
+    return deviceTransform.type() <= QTransform::TxScale
+            && qFuzzyCompare(deviceTransform.m11(), qreal(dpr))
+            && qFuzzyCompare(deviceTransform.m22(), qreal(dpr))
+            && deviceTransform.dx() == qRound(deviceTransform.dx())
+            && deviceTransform.dy() == qRound(deviceTransform.dy());
+}
 
-    QRegion areaToBeFlushed = m_dirtyRegion;
-    m_previousDirtyRegion = QRegion(m_boundingRectMax);
-    m_isDirty = false;
-    m_dirtyRegion = QRegion();
+void QSGSoftwareRenderableNode::updateLayer(QPainter *painter)
+{
+    const int dpr = painter->device()->devicePixelRatio();
+    const QSize size = m_boundingRectMax.size() * dpr;
+    if (!qsg_reserveLayerCache(size.width() * size.height() * 4))
+        return;
 
-    return areaToBeFlushed;
+    m_layerRect = m_boundingRectMax;
+    m_layer = QImage(size, QImage::Format_ARGB32_Premultiplied);
+    m_layer.setDevicePixelRatio(dpr);
+    m_layer.fill(Qt::transparent);
+
+    QPainter layerPainter(&m_layer);
+    layerPainter.setRenderHints(painter->renderHints());
+    const QTransform toLayer = QTransform::fromTranslate(-m_layerRect.x(), -m_layerRect.y());
+    if (m_clipRegion.rectCount() > 1) {
+        layerPainter.setTransform(toLayer);
+        layerPainter.setClipRegion(m_clipRegion);
+    }
+    layerPainter.setOpacity(m_opacity);
+    layerPainter.setTransform(m_transform * toLayer);
+    paintContent(&layerPainter);
+
+    qCDebug(lcRenderable) << "layer created" << m_layerRect << "cache usage" << qsg_layerCacheUsage.load();
+}
+
+void QSGSoftwareRenderableNode::releaseLayer()
+{
+    if (m_layer.isNull())
+        return;
+    qsg_layerCacheUsage.fetchAndAddOrdered(-m_layer.width() * m_layer.height() * 4);
+    m_layer = QImage();
 }
 
 bool QSGSoftwareRenderableNode::isDirtyRegionEmpty() const
@@ -53,6 +53,7 @@
 
 #include <QtQuick/private/qtquickglobal_p.h>
 
+#include <QtGui/QImage>
 #include <QtGui/QRegion>
 #include <QtCore/QRect>
 #include <QtGui/QTransform>
@@ -98,6 +99,17 @@ public:
     void update();
 
     QRegion renderNode(QPainter *painter, bool forceOpaquePainting = false);
+
+    // renderNode() split up so that the dirty region can be painted in several
+    // parts at once. prepareForPainting() and finishPainting() must be called
+    // on the render thread, paintRegion() is safe to call from other threads
+    // for disjoint regions when canPaintConcurrently() returns true.
+    bool needsPainting() const;
+    bool canPaintConcurrently() const;
+    void prepareForPainting(QPainter *painter);
+    void paintRegion(QPainter *painter, const QRegion &region, bool forceOpaquePainting = false);
+    QRegion finishPainting();
+
     QRect boundingRectMin() const { return m_boundingRectMin; }
     QRect boundingRectMax() const { return m_boundingRectMax; }
     NodeType type() const { return m_nodeType; }
@@ -122,6 +134,11 @@ public:
     QRegion dirtyRegion() const;
 
 private:
+    void paintContent(QPainter *painter);
+    bool canUseLayer(QPainter *painter) const;
+    void updateLayer(QPainter *painter);
+    void releaseLayer();
+
     union RenderableNodeHandle {
         QSGSimpleRectNode *simpleRectNode;
         QSGSimpleTextureNode *simpleTextureNode;
@@ -152,6 +169,11 @@ private:
 
     QRect m_boundingRectMin;
     QRect m_boundingRectMax;
+
+    // Rasterized content of a node which did not change in a while
+    QImage m_layer;
+    QRect m_layerRect;
+    int m_unchangedPaintCount;
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,237 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qsgetcencoder_p.h"
+
+#include <QtGui/qimage.h>
+#include <qendian.h>
+
+QT_BEGIN_NAMESPACE
+
+/*
+    A fast ETC1 encoder. Each 4x4 block is split into two halves, either side
+    by side or on top of each other. Each half gets a base color and one of
+    eight modifier tables, and each pixel picks one of the four modifiers of its
+    half's table. The base colors use the differential mode (5 bit colors) when
+    the two averages are close enough and the individual mode (4 bit colors)
+    otherwise.
+
+    The encoder never produces the overflowing differential colors that ETC2
+    uses for its additional modes, so the result is valid ETC2 RGB8 data too.
+*/
+
+static const int etcModifierTable[8][2] = {
+    { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 },
+    { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 }
+};
+
+static const int pkmHeaderSize = 16;
+
+// Finds the table and the modifiers with the smallest error for the eight
+// pixels of one half of a block around the given base color.
+static int fitHalfBlock(const int (*block)[3], const int *pixels, const int *base,
+                        int *table, int *modifiers)
+{
+    int bestError = INT_MAX;
+    for (int t = 0; t < 8; ++t) {
+        const int values[4] = { etcModifierTable[t][0], etcModifierTable[t][1],
+                                -etcModifierTable[t][0], -etcModifierTable[t][1] };
+        int candidates[4][3];
+        for (int m = 0; m < 4; ++m) {
+            for (int c = 0; c < 3; ++c)
+                candidates[m][c] = qBound(0, base[c] + values[m], 255);
+        }
+
+        int error = 0;
+        int chosen[8];
+        for (int i = 0; i < 8 && error < bestError; ++i) {
+            const int *pixel = block[pixels[i]];
+            int pixelError = INT_MAX;
+            for (int m = 0; m < 4; ++m) {
+                const int dr = candidates[m][0] - pixel[0];
+                const int dg = candidates[m][1] - pixel[1];
+                const int db = candidates[m][2] - pixel[2];
+                const int e = dr * dr + dg * dg + db * db;
+                if (e < pixelError) {
+                    pixelError = e;
+                    chosen[i] = m;
+                }
+            }
+            error += pixelError;
+        }
+
+        if (error < bestError) {
+            bestError = error;
+            *table = t;
+            memcpy(modifiers, chosen, sizeof(chosen));
+        }
+    }
+    return bestError;
+}
+
+static quint64 encodeBlock(const int (*block)[3])
+{
+    quint64 bestBits = 0;
+    int bestError = INT_MAX;
+
+    for (int flip = 0; flip < 2; ++flip) {
+        int pixels[2][8];
+        int count[2] = { 0, 0 };
+        int average[2][3] = { { 0, 0, 0 }, { 0, 0, 0 } };
+        for (int y = 0; y < 4; ++y) {
+            for (int x = 0; x < 4; ++x) {
+                const int half = flip ? (y >= 2) : (x >= 2);
+                const int p = y * 4 + x;
+                pixels[half][count[half]++] = p;
+                for (int c = 0; c < 3; ++c)
+                    average[half][c] += block[p][c];
+            }
+        }
+
+        int quantized[2][3];
+        int base[2][3];
+        bool differential = true;
+        for (int h = 0; h < 2; ++h) {
+            for (int c = 0; c < 3; ++c)
+                quantized[h][c] = ((average[h][c] + 4) / 8 * 31 + 127) / 255;
+        }
+        for (int c = 0; c < 3; ++c) {
+            const int delta = quantized[1][c] - quantized[0][c];
+            if (delta < -4 || delta > 3)
+                differential = false;
+        }
+        for (int h = 0; h < 2; ++h) {
+            for (int c = 0; c < 3; ++c) {
+                if (differential) {
+                    base[h][c] = (quantized[h][c] << 3) | (quantized[h][c] >> 2);
+                } else {
+                    quantized[h][c] = ((average[h][c] + 4) / 8 * 15 + 127) / 255;
+                    base[h][c] = (quantized[h][c] << 4) | quantized[h][c];
+                }
+            }
+        }
+
+        int tables[2];
+        int modifiers[2][8];
+        const int error = fitHalfBlock(block, pixels[0], base[0], &tables[0], modifiers[0])
+                        + fitHalfBlock(block, pixels[1], base[1], &tables[1], modifiers[1]);
+        if (error >= bestError)
+            continue;
+        bestError = error;
+
+        quint64 bits = 0;
+        for (int c = 0; c < 3; ++c) {
+            if (differential) {
+                bits |= quint64(quantized[0][c]) << (59 - 8 * c);
+                bits |= quint64((quantized[1][c] - quantized[0][c]) & 7) << (56 - 8 * c);
+            } else {
+                bits |= quint64(quantized[0][c]) << (60 - 8 * c);
+                bits |= quint64(quantized[1][c]) << (56 - 8 * c);
+            }
+        }
+        bits |= quint64(tables[0]) << 37;
+        bits |= quint64(tables[1]) << 34;
+        if (differential)
+            bits |= Q_UINT64_C(1) << 33;
+        if (flip)
+            bits |= Q_UINT64_C(1) << 32;
+
+        // The pixel indices are stored column by column, the most significant
+        // bits of all pixels first.
+        for (int h = 0; h < 2; ++h) {
+            for (int i = 0; i < 8; ++i) {
+                const int p = pixels[h][i];
+                const int bit = (p % 4) * 4 + p / 4;
+                bits |= quint64(modifiers[h][i] >> 1) << (16 + bit);
+                bits |= quint64(modifiers[h][i] & 1) << bit;
+            }
+        }
+        bestBits = bits;
+    }
+    return bestBits;
+}
+
+/*
+    Returns the contents of a PKM file holding \a image as ETC1 compressed
+    texture, or an empty byte array if the image is too large for the format.
+    The alpha channel of the image is ignored.
+*/
+QByteArray QSGEtcEncoder::encodePkm(const QImage &image)
+{
+    const int width = image.width();
+    const int height = image.height();
+    const int paddedWidth = (width + 3) & ~3;
+    const int paddedHeight = (height + 3) & ~3;
+    if (image.isNull() || paddedWidth > 0xffff || paddedHeight > 0xffff)
+        return QByteArray();
+
+    const QImage source = image.convertToFormat(QImage::Format_RGB32);
+
+    QByteArray data(pkmHeaderSize + paddedWidth * paddedHeight / 2, Qt::Uninitialized);
+    char *header = data.data();
+    memcpy(header, "PKM 10", 6);
+    qToBigEndian<quint16>(0, header + 6); // ETC1_RGB_NO_MIPMAPS
+    qToBigEndian<quint16>(paddedWidth, header + 8);
+    qToBigEndian<quint16>(paddedHeight, header + 10);
+    qToBigEndian<quint16>(width, header + 12);
+    qToBigEndian<quint16>(height, header + 14);
+
+    uchar *out = reinterpret_cast<uchar *>(data.data()) + pkmHeaderSize;
+    int block[16][3];
+    for (int by = 0; by < paddedHeight; by += 4) {
+        for (int bx = 0; bx < paddedWidth; bx += 4) {
+            // Pixels outside of the image repeat the last row and column.
+            for (int y = 0; y < 4; ++y) {
+                const QRgb *line = reinterpret_cast<const QRgb *>(source.constScanLine(qMin(by + y, height - 1)));
+                for (int x = 0; x < 4; ++x) {
+                    const QRgb pixel = line[qMin(bx + x, width - 1)];
+                    block[y * 4 + x][0] = qRed(pixel);
+                    block[y * 4 + x][1] = qGreen(pixel);
+                    block[y * 4 + x][2] = qBlue(pixel);
+                }
+            }
+            qToBigEndian<quint64>(encodeBlock(block), out);
+            out += 8;
+        }
+    }
+    return data;
+}
+
+QT_END_NAMESPACE
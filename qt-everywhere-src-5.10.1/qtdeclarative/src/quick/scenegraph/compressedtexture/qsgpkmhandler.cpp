@@ -126,7 +126,11 @@ void QEtcTexture::bind()
     QOpenGLContext *ctx = QOpenGLContext::currentContext();
     Q_ASSERT(ctx != 0);
     const int compFactor = m_type == GL_COMPRESSED_RGBA8_ETC2_EAC ? 1 : 2;
-    ctx->functions()->glCompressedTexImage2D(GL_TEXTURE_2D, 0, m_type,
+    // ETC2 is a superset of ETC1, use it where the ETC1 extension is missing
+    GLenum type = m_type;
+    if (type == GL_ETC1_RGB8_OES && !ctx->hasExtension("GL_OES_compressed_ETC1_RGB8_texture"))
+        type = GL_COMPRESSED_RGB8_ETC2;
+    ctx->functions()->glCompressedTexImage2D(GL_TEXTURE_2D, 0, type,
                                              m_size.width(), m_size.height(), 0,
                                              (m_paddedSize.width() * m_paddedSize.height()) / compFactor,
                                              m_data.data() + headerSize);
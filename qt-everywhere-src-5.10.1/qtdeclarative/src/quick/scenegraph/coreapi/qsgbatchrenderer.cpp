@@ -48,6 +48,10 @@
 
 #include <QtCore/QElapsedTimer>
 #include <QtCore/QtNumeric>
+#include <QtCore/QSemaphore>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVarLengthArray>
 
 #include <QtGui/QGuiApplication>
 #include <QtGui/QOpenGLFramebufferObject>
@@ -55,6 +59,10 @@
 #include <QtGui/QOpenGLFunctions_1_0>
 #include <QtGui/QOpenGLFunctions_3_2_Core>
 
+#include <QtQuick/qsgflatcolormaterial.h>
+#include <QtQuick/qsgtexturematerial.h>
+#include <QtQuick/qsgvertexcolormaterial.h>
+
 #include <private/qquickprofiler_p.h>
 #include "qsgmaterialshader_p.h"
 
@@ -85,10 +93,18 @@ DECLARE_DEBUG_VAR(dump)
 DECLARE_DEBUG_VAR(noalpha)
 DECLARE_DEBUG_VAR(noopaque)
 DECLARE_DEBUG_VAR(noclip)
+DECLARE_DEBUG_VAR(culling)
 #undef DECLARE_DEBUG_VAR
 
 static QElapsedTimer qsg_renderer_timer;
 
+// An element whose geometry changes in VolatileChangeCount frames, each at most
+// VolatileFrameGap frames after the previous change, is kept out of batches
+// with static elements until it has not changed for VolatileTimeout frames.
+static const uint VolatileChangeCount = 8;
+static const uint VolatileFrameGap = 4;
+static const uint VolatileTimeout = 120;
+
 #define QSGNODE_TRAVERSE(NODE) for (QSGNode *child = NODE->firstChild(); child; child = child->nextSibling())
 #define SHADOWNODE_TRAVERSE(NODE) for (Node *child = NODE->firstChild(); child; child = child->sibling())
 
@@ -131,6 +147,11 @@ struct QMatrix4x4_Accessor
 
 const float OPAQUE_LIMIT                = 0.999f;
 
+// Pixels around the viewport and the occluders which are not trusted when
+// culling, as antialiasing may move vertices outwards in the vertex shader.
+const int CULL_MARGIN                   = 4;
+const int MAX_OCCLUDERS                 = 16;
+
 ShaderManager::Shader *ShaderManager::prepareMaterial(QSGMaterial *material)
 {
     QSGMaterialType *type = material->type();
@@ -681,6 +702,7 @@ void Batch::invalidate()
     Element *e = first;
     first = 0;
     root = 0;
+    retained = false;
     while (e) {
         e->batch = 0;
         Element *n = e->nextInBatch;
@@ -764,6 +786,7 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
     , m_tmpAlphaElements(16)
     , m_tmpOpaqueElements(16)
     , m_rebuild(FullRebuild)
+    , m_frameCounter(0)
     , m_zRange(0)
     , m_renderOrderRebuildLower(-1)
     , m_renderOrderRebuildUpper(-1)
@@ -802,9 +825,20 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx)
 
     m_batchNodeThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_NODE_THRESHOLD", 64);
     m_batchVertexThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_VERTEX_THRESHOLD", 1024);
+#ifndef QT_NO_THREAD
+    m_uploadThreadCount = qt_sg_envInt("QSG_RENDERER_UPLOAD_THREADS", qBound(1, QThread::idealThreadCount(), 4));
+#else
+    m_uploadThreadCount = 1;
+#endif
+    m_uploadThreadVertexThreshold = qt_sg_envInt("QSG_RENDERER_UPLOAD_THREAD_VERTEX_THRESHOLD", 8192);
+    m_cullingEnabled = qt_sg_envInt("QSG_RENDERER_CULLING", 1) != 0;
+    m_viewportCulledCount = 0;
+    m_occlusionCulledCount = 0;
 
     if (Q_UNLIKELY(debug_build() || debug_render())) {
         qDebug() << "Batch thresholds: nodes:" << m_batchNodeThreshold << " vertices:" << m_batchVertexThreshold;
+        qDebug() << "Upload threads:" << m_uploadThreadCount << " vertex threshold:" << m_uploadThreadVertexThreshold;
+        qDebug() << "Culling:" << (m_cullingEnabled ? "enabled" : "disabled");
         qDebug() << "Using buffer strategy:" << (m_bufferStrategy == GL_STATIC_DRAW ? "static" : (m_bufferStrategy == GL_DYNAMIC_DRAW ? "dynamic" : "stream"));
     }
 
@@ -1005,6 +1039,7 @@ void Renderer::nodeWasTransformed(Node *node, int *vertexCount)
                     e->batch->needsUpload = true;
                 }
             }
+            elementGeometryChanged(e);
         }
     }
 
@@ -1224,6 +1259,7 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
                     b->needsUpload = true;
                 }
             }
+            elementGeometryChanged(e);
         }
     }
 
@@ -1466,6 +1502,42 @@ void Renderer::buildRenderListsFromScratch()
     buildRenderLists(rootNode());
 }
 
+/*
+ * Marks the vertex data of \a e as changed and keeps track of how often that
+ * happens. An element that keeps changing is taken out of its batch, so that
+ * the static elements it was merged with are not uploaded again every time.
+ */
+void Renderer::elementGeometryChanged(Element *e)
+{
+    e->geometryDirty = true;
+    if (e->changeStreak && e->lastChangeFrame == m_frameCounter)
+        return;
+    if (e->changeStreak && m_frameCounter - e->lastChangeFrame <= VolatileFrameGap)
+        ++e->changeStreak;
+    else
+        e->changeStreak = 1;
+    e->lastChangeFrame = m_frameCounter;
+
+    if (!e->volatileGeometry && e->changeStreak >= VolatileChangeCount) {
+        e->volatileGeometry = true;
+        if (e->batch && (e->batch->first != e || e->nextInBatch))
+            invalidateBatchAndOverlappingRenderOrders(e->batch);
+    }
+}
+
+/*
+ * Returns whether \a e has volatile geometry. Elements that have settled down
+ * again are batched with the static ones the next time batches are built.
+ */
+static inline bool qsg_hasVolatileGeometry(Element *e, uint frame)
+{
+    if (e->volatileGeometry && frame - e->lastChangeFrame > VolatileTimeout) {
+        e->volatileGeometry = false;
+        e->changeStreak = 0;
+    }
+    return e->volatileGeometry;
+}
+
 void Renderer::invalidateBatchAndOverlappingRenderOrders(Batch *batch)
 {
     Q_ASSERT(batch);
@@ -1510,7 +1582,7 @@ void Renderer::prepareOpaqueBatches()
 {
     for (int i=m_opaqueRenderList.size() - 1; i >= 0; --i) {
         Element *ei = m_opaqueRenderList.at(i);
-        if (!ei || ei->batch || ei->node->geometry()->vertexCount() == 0)
+        if (!ei || ei->batch || ei->culled || ei->node->geometry()->vertexCount() == 0)
             continue;
         Batch *batch = newBatch();
         batch->first = ei;
@@ -1525,6 +1597,7 @@ void Renderer::prepareOpaqueBatches()
         Element *next = ei;
 
         QSGGeometryNode *gni = ei->node;
+        const bool volatileGeometry = qsg_hasVolatileGeometry(ei, m_frameCounter);
 
         for (int j = i - 1; j >= 0; --j) {
             Element *ej = m_opaqueRenderList.at(j);
@@ -1532,7 +1605,7 @@ void Renderer::prepareOpaqueBatches()
                 continue;
             if (ej->root != ei->root)
                 break;
-            if (ej->batch || ej->node->geometry()->vertexCount() == 0)
+            if (ej->batch || ej->culled || ej->node->geometry()->vertexCount() == 0)
                 continue;
 
             QSGGeometryNode *gnj = ej->node;
@@ -1543,7 +1616,8 @@ void Renderer::prepareOpaqueBatches()
                     && gni->geometry()->attributes() == gnj->geometry()->attributes()
                     && gni->inheritedOpacity() == gnj->inheritedOpacity()
                     && gni->activeMaterial()->type() == gnj->activeMaterial()->type()
-                    && gni->activeMaterial()->compare(gnj->activeMaterial()) == 0) {
+                    && gni->activeMaterial()->compare(gnj->activeMaterial()) == 0
+                    && qsg_hasVolatileGeometry(ej, m_frameCounter) == volatileGeometry) {
                 ej->batch = batch;
                 next->nextInBatch = ej;
                 next = ej;
@@ -1558,7 +1632,7 @@ bool Renderer::checkOverlap(int first, int last, const Rect &bounds)
 {
     for (int i=first; i<=last; ++i) {
         Element *e = m_alphaRenderList.at(i);
-        if (!e || e->batch)
+        if (!e || e->batch || e->culled)
             continue;
         Q_ASSERT(e->boundsComputed);
         if (e->bounds.intersects(bounds))
@@ -1604,7 +1678,7 @@ void Renderer::prepareAlphaBatches()
             continue;
         }
 
-        if (ei->node->geometry()->vertexCount() == 0)
+        if (ei->culled || ei->node->geometry()->vertexCount() == 0)
             continue;
 
         Batch *batch = newBatch();
@@ -1617,6 +1691,7 @@ void Renderer::prepareAlphaBatches()
 
         QSGGeometryNode *gni = ei->node;
         batch->positionAttribute = qsg_positionAttribute(gni->geometry());
+        const bool volatileGeometry = qsg_hasVolatileGeometry(ei, m_frameCounter);
 
         Rect overlapBounds;
         overlapBounds.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
@@ -1629,7 +1704,7 @@ void Renderer::prepareAlphaBatches()
                 continue;
             if (ej->root != ei->root || ej->isRenderNode)
                 break;
-            if (ej->batch)
+            if (ej->batch || ej->culled)
                 continue;
 
             QSGGeometryNode *gnj = ej->node;
@@ -1642,7 +1717,8 @@ void Renderer::prepareAlphaBatches()
                     && gni->geometry()->attributes() == gnj->geometry()->attributes()
                     && gni->inheritedOpacity() == gnj->inheritedOpacity()
                     && gni->activeMaterial()->type() == gnj->activeMaterial()->type()
-                    && gni->activeMaterial()->compare(gnj->activeMaterial()) == 0) {
+                    && gni->activeMaterial()->compare(gnj->activeMaterial()) == 0
+                    && qsg_hasVolatileGeometry(ej, m_frameCounter) == volatileGeometry) {
                 if (!overlapBounds.intersects(ej->bounds) || !checkOverlap(i+1, j - 1, ej->bounds)) {
                     ej->batch = batch;
                     next->nextInBatch = ej;
@@ -1686,6 +1762,14 @@ static inline int qsg_fixIndexCount(int iCount, GLenum drawMode) {
     }
 }
 
+static inline int qsg_mergedIndexCount(QSGGeometry *g, GLenum drawMode)
+{
+    int iCount = g->indexCount();
+    if (iCount == 0)
+        iCount = g->vertexCount();
+    return qsg_fixIndexCount(iCount, drawMode);
+}
+
 /* These parameters warrant some explanation...
  *
  * vaOffset: The byte offset into the vertex data to the location of the
@@ -1777,40 +1861,370 @@ static QMatrix4x4 qsg_matrixForRoot(Node *node)
     return *c->matrix();
 }
 
-void Renderer::uploadBatch(Batch *b)
+static inline bool qsg_overlapsClosed(const Rect &r1, const Rect &r2)
+{
+    return r1.tl.x <= r2.br.x && r2.tl.x <= r1.br.x
+        && r1.tl.y <= r2.br.y && r2.tl.y <= r1.br.y;
+}
+
+static inline bool qsg_contains(const Rect &outer, const Rect &inner)
+{
+    return inner.tl.x >= outer.tl.x && inner.br.x <= outer.br.x
+        && inner.tl.y >= outer.tl.y && inner.br.y <= outer.br.y;
+}
+
+// Returns the bounds of \a e in scene coordinates, or false if they are unknown.
+static bool qsg_sceneBounds(Element *e, Rect *bounds)
+{
+    e->ensureBoundsValid();
+    if (e->boundsOutsideFloatRange)
+        return false;
+    *bounds = e->bounds;
+    if (e->root)
+        bounds->map(qsg_matrixForRoot(e->root));
+    return true;
+}
+
+/* An occluder is an unclipped, opaque, axis aligned rectangle drawn with one
+ * of the built-in materials, whose shaders are known to neither move the
+ * vertices nor discard fragments.
+ */
+static bool qsg_isOccluder(Element *e)
+{
+    QSGGeometryNode *gn = e->node;
+    if (e->isRenderNode || gn->clipList() || gn->inheritedOpacity() <= OPAQUE_LIMIT)
+        return false;
+
+    QSGMaterial *m = gn->activeMaterial();
+    if (m->flags() & QSGMaterial::Blending)
+        return false;
+    static QSGFlatColorMaterial flatColorMaterial;
+    static QSGOpaqueTextureMaterial opaqueTextureMaterial;
+    static QSGVertexColorMaterial vertexColorMaterial;
+    static QSGMaterialType *const occluderTypes[] = {
+        static_cast<QSGMaterial *>(&flatColorMaterial)->type(),
+        static_cast<QSGMaterial *>(&opaqueTextureMaterial)->type(),
+        static_cast<QSGMaterial *>(&vertexColorMaterial)->type()
+    };
+    QSGMaterialType *type = m->type();
+    if (type != occluderTypes[0] && type != occluderTypes[1] && type != occluderTypes[2])
+        return false;
+
+    QSGGeometry *g = gn->geometry();
+    if (g->drawingMode() != GL_TRIANGLE_STRIP || g->vertexCount() != 4 || g->indexCount() != 0
+            || qsg_positionAttribute(g) != 0)
+        return false;
+    if (!QMatrix4x4_Accessor::isScale(*gn->matrix())
+            || (e->root && !QMatrix4x4_Accessor::isScale(qsg_matrixForRoot(e->root))))
+        return false;
+
+    // The strip must span an axis aligned rectangle, as in QSGGeometry::updateRectGeometry()
+    const char *vd = static_cast<const char *>(g->vertexData());
+    const int stride = g->sizeOfVertex();
+    const Pt &p0 = *reinterpret_cast<const Pt *>(vd);
+    const Pt &p1 = *reinterpret_cast<const Pt *>(vd + stride);
+    const Pt &p2 = *reinterpret_cast<const Pt *>(vd + 2 * stride);
+    const Pt &p3 = *reinterpret_cast<const Pt *>(vd + 3 * stride);
+    if (p0.x != p1.x || p2.x != p3.x || p0.y != p2.y || p1.y != p3.y)
+        return false;
+
+    // Vertex colors are drawn as they are, so they all need to be opaque
+    if (type == occluderTypes[2]) {
+        if (g->attributeCount() != 2 || g->attributes()[1].type != GL_UNSIGNED_BYTE
+                || g->attributes()[1].tupleSize != 4)
+            return false;
+        for (int i = 0; i < 4; ++i) {
+            const uchar *color = reinterpret_cast<const uchar *>(vd + i * stride + 2 * sizeof(float));
+            if (color[3] != 255)
+                return false;
+        }
+    }
+    return true;
+}
+
+struct Occluder {
+    Rect rect;
+    int order;
+};
+
+/* Elements that are outside the viewport or outside one of their rectangular
+ * clips, and elements completely covered by an opaque rectangle drawn on top
+ * of them, are left out of the batches, so they are neither uploaded nor
+ * drawn. This is decided again every frame; an element that changes between
+ * culled and not culled invalidates the batches it affects.
+ */
+void Renderer::cullElements()
+{
+    m_viewportCulledCount = 0;
+    m_occlusionCulledCount = 0;
+    if (!m_cullingEnabled)
+        return;
+
+    const QRect viewport = viewportRect();
+    const QMatrix4x4 projection = projectionMatrix();
+    bool invertible = false;
+    const QMatrix4x4 inverse = projection.inverted(&invertible);
+    if (viewport.isEmpty() || !invertible || !QMatrix4x4_Accessor::isScale(projection))
+        return;
+
+    Rect visible;
+    visible.set(-1.0f - CULL_MARGIN * 2.0f / viewport.width(),
+                -1.0f - CULL_MARGIN * 2.0f / viewport.height(),
+                1.0f + CULL_MARGIN * 2.0f / viewport.width(),
+                1.0f + CULL_MARGIN * 2.0f / viewport.height());
+    visible.map(inverse);
+    const float marginX = CULL_MARGIN * (visible.br.x - visible.tl.x) / (viewport.width() + 2 * CULL_MARGIN);
+    const float marginY = CULL_MARGIN * (visible.br.y - visible.tl.y) / (viewport.height() + 2 * CULL_MARGIN);
+
+    // Keep the largest occluders, shrunk by the margin
+    QVarLengthArray<Occluder, MAX_OCCLUDERS> occluders;
+    QDataBuffer<Element *> *lists[] = { &m_opaqueRenderList, &m_alphaRenderList };
+    for (QDataBuffer<Element *> *list : lists) {
+        for (int i = 0; i < list->size(); ++i) {
+            Element *e = list->at(i);
+            if (!e || e->removed || !qsg_isOccluder(e))
+                continue;
+            Occluder o;
+            if (!qsg_sceneBounds(e, &o.rect) || !qsg_overlapsClosed(o.rect, visible))
+                continue;
+            o.rect.set(o.rect.tl.x + marginX, o.rect.tl.y + marginY, o.rect.br.x - marginX, o.rect.br.y - marginY);
+            if (o.rect.tl.x >= o.rect.br.x || o.rect.tl.y >= o.rect.br.y)
+                continue;
+            o.order = e->order;
+            const float area = (o.rect.br.x - o.rect.tl.x) * (o.rect.br.y - o.rect.tl.y);
+            if (occluders.size() < MAX_OCCLUDERS) {
+                occluders.append(o);
+                continue;
+            }
+            int smallest = 0;
+            float smallestArea = FLT_MAX;
+            for (int j = 0; j < occluders.size(); ++j) {
+                const Rect &r = occluders.at(j).rect;
+                const float a = (r.br.x - r.tl.x) * (r.br.y - r.tl.y);
+                if (a < smallestArea) {
+                    smallestArea = a;
+                    smallest = j;
+                }
+            }
+            if (area > smallestArea)
+                occluders[smallest] = o;
+        }
+    }
+
+    for (QDataBuffer<Element *> *list : lists) {
+        const bool alpha = list == &m_alphaRenderList;
+        for (int i = 0; i < list->size(); ++i) {
+            Element *e = list->at(i);
+            if (!e || e->removed || e->isRenderNode)
+                continue;
+
+            bool culled = false;
+            Rect bounds;
+            if (qsg_sceneBounds(e, &bounds)) {
+                culled = !qsg_overlapsClosed(bounds, visible);
+                for (const QSGClipNode *clip = e->node->clipList(); clip && !culled; clip = clip->clipList()) {
+                    if (!clip->isRectangular() || !clip->matrix() || !QMatrix4x4_Accessor::isScale(*clip->matrix()))
+                        continue;
+                    const QRectF r = clip->clipRect();
+                    Rect clipBounds;
+                    clipBounds.set(r.left(), r.top(), r.right(), r.bottom());
+                    clipBounds.map(*clip->matrix());
+                    culled = !qsg_overlapsClosed(bounds, clipBounds);
+                }
+                if (culled) {
+                    ++m_viewportCulledCount;
+                } else {
+                    for (const Occluder &o : qAsConst(occluders)) {
+                        if (o.order > e->order && qsg_contains(o.rect, bounds)) {
+                            culled = true;
+                            ++m_occlusionCulledCount;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if (culled == bool(e->culled))
+                continue;
+            e->culled = culled;
+            if (e->batch) {
+                invalidateBatchAndOverlappingRenderOrders(e->batch);
+            } else if (!culled) {
+                // Alpha batches drawn across the element's order must be rebuilt to include it
+                if (alpha) {
+                    for (int j = 0; j < m_alphaBatches.size(); ++j) {
+                        Batch *b = m_alphaBatches.at(j);
+                        if (b->first && b->first->order < e->order && b->lastOrderInBatch > e->order)
+                            b->invalidate();
+                    }
+                }
+                m_rebuild |= BuildBatches;
+            }
+        }
+    }
+
+    if (Q_UNLIKELY(debug_culling() || debug_render())) {
+        qDebug() << " -> culled" << m_viewportCulledCount << "outside viewport or clip,"
+                 << m_occlusionCulledCount << "occluded, of"
+                 << (m_opaqueRenderList.size() + m_alphaRenderList.size()) << "elements,"
+                 << occluders.size() << "occluders";
+    }
+}
+
+static bool qsg_canMergeBatch(const Batch *b)
+{
+    QSGGeometryNode *gn = b->first->node;
+    QSGGeometry *g =  gn->geometry();
+    QSGMaterial::Flags flags = gn->activeMaterial()->flags();
+    return (g->drawingMode() == GL_TRIANGLES || g->drawingMode() == GL_TRIANGLE_STRIP ||
+            g->drawingMode() == GL_LINES || g->drawingMode() == GL_POINTS)
+           && b->positionAttribute >= 0
+           && g->indexType() == GL_UNSIGNED_SHORT
+           && (flags & (QSGMaterial::CustomCompileStep | QSGMaterial_FullMatrix)) == 0
+           && ((flags & QSGMaterial::RequiresFullMatrixExceptTranslate) == 0 || b->isTranslateOnlyToRoot())
+           && b->isSafeToBatch();
+}
+
+/*
+ * Updates only the parts of a merged batch's buffers that belong to elements
+ * whose vertex data changed. This requires the batch to have the layout of its
+ * last upload: the same elements with the same vertex and index counts and
+ * render orders. Returns false if the batch needs a full upload instead.
+ */
+bool Renderer::updateRetainedBatch(Batch *b)
+{
+    if (!b->needsUpload || !b->retained || !b->first || b->isRenderNode || !b->vbo.id)
+        return false;
+    // Without the upload pools the buffers are kept in client memory.
+    if (m_context->hasBrokenIndexBufferObjects() || m_visualizeMode != VisualizeNothing)
+        return false;
+    if (m_useDepthBuffer && b->uploadedZRange != float(m_zRange))
+        return false;
+    if (!qsg_canMergeBatch(b))
+        return false;
+
+    QSGGeometry *g = b->first->node->geometry();
+    const int vSize = g->sizeOfVertex();
+    const int zSize = m_useDepthBuffer ? sizeof(float) : 0;
+
+    int elementCount = 0;
+    int dirtyVertexCount = 0;
+    int dirtyIndexCount = 0;
+    for (Element *e = b->first; e; e = e->nextInBatch) {
+        QSGGeometry *eg = e->node->geometry();
+        if (eg->vertexCount() != e->uploadedVertexCount
+                || qsg_mergedIndexCount(eg, g->drawingMode()) != e->uploadedIndexCount
+                || e->order != e->uploadedOrder) {
+            return false;
+        }
+        if (e->geometryDirty) {
+            dirtyVertexCount += e->uploadedVertexCount;
+            dirtyIndexCount += e->uploadedIndexCount;
+        }
+        ++elementCount;
+    }
+    // Replacing most of the batch is better done in one go.
+    if (elementCount != b->uploadedElementCount || dirtyVertexCount * 2 > b->vertexCount)
+        return false;
+
+    if (Q_UNLIKELY(debug_upload())) qDebug() << " - batch" << b << "updating" << dirtyVertexCount
+                                             << "of" << b->vertexCount << "vertices";
+
+    const int scratchSize = dirtyVertexCount * (vSize + zSize) + dirtyIndexCount * int(sizeof(quint16));
+    if (scratchSize > m_vertexUploadPool.size())
+        m_vertexUploadPool.resize(scratchSize);
+    char *vertexData = m_vertexUploadPool.data();
+    char *zData = vertexData + dirtyVertexCount * vSize;
+    char *indexData = zData + dirtyVertexCount * zSize;
+
+    const int zStart = b->vertexCount * vSize;
+    glBindBuffer(GL_ARRAY_BUFFER, b->vbo.id);
+#ifdef QSG_SEPARATE_INDEX_BUFFER
+    const GLenum indexTarget = GL_ELEMENT_ARRAY_BUFFER;
+    const int indexStart = 0;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, b->ibo.id);
+#else
+    const GLenum indexTarget = GL_ARRAY_BUFFER;
+    const int indexStart = zStart + b->vertexCount * zSize;
+#endif
+
+    // Walk the elements in runs of dirty and clean ones, mirroring the
+    // layout and draw set splitting of fillBatch().
+    int vertexOffset = 0;
+    int indexOffset = 0;
+    quint16 iBase = 0;
+    int verticesInSet = 0;
+    Element *e = b->first;
+    while (e) {
+        const bool dirty = e->geometryDirty;
+        const int runVertexOffset = vertexOffset;
+        const int runIndexOffset = indexOffset;
+        char *runVertexData = vertexData;
+        char *runZData = zData;
+        char *runIndexData = indexData;
+        while (e && bool(e->geometryDirty) == dirty) {
+            verticesInSet += e->uploadedVertexCount;
+            if (verticesInSet > 0xffff) {
+                iBase = 0;
+                verticesInSet = e->uploadedVertexCount;
+            }
+            if (dirty) {
+                quint16 base = iBase;
+                int indexCount = 0;
+                uploadMergedElement(e, b->positionAttribute, &vertexData, &zData, &indexData, &base, &indexCount);
+                Q_ASSERT(indexCount == e->uploadedIndexCount);
+                e->geometryDirty = false;
+            }
+            iBase += e->uploadedVertexCount;
+            vertexOffset += e->uploadedVertexCount;
+            indexOffset += e->uploadedIndexCount;
+            e = e->nextInBatch;
+        }
+        if (dirty) {
+            const int runVertexCount = vertexOffset - runVertexOffset;
+            glBufferSubData(GL_ARRAY_BUFFER, runVertexOffset * vSize, runVertexCount * vSize, runVertexData);
+            if (zSize)
+                glBufferSubData(GL_ARRAY_BUFFER, zStart + runVertexOffset * zSize, runVertexCount * zSize, runZData);
+            glBufferSubData(indexTarget, indexStart + runIndexOffset * sizeof(quint16),
+                            (indexOffset - runIndexOffset) * sizeof(quint16), runIndexData);
+        }
+    }
+
+    b->needsUpload = false;
+
+    if (Q_UNLIKELY(debug_render()))
+        b->uploadedThisFrame = true;
+    return true;
+}
+
+/*
+ * Computes the layout of the batch and the sizes of the buffers it needs.
+ * Returns false if the batch does not need to be uploaded.
+ */
+bool Renderer::prepareBatchUpload(Batch *b, int *vertexBufferSize, int *indexBufferSize)
 {
         // Early out if nothing has changed in this batch..
         if (!b->needsUpload) {
             if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "already uploaded...";
-            return;
+            return false;
         }
 
         if (!b->first) {
             if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "is invalid...";
-            return;
+            return false;
         }
 
         if (b->isRenderNode) {
             if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch: " << b << "is a render node...";
-            return;
+            return false;
         }
 
         // Figure out if we can merge or not, if not, then just render the batch as is..
         Q_ASSERT(b->first);
         Q_ASSERT(b->first->node);
 
-        QSGGeometryNode *gn = b->first->node;
-        QSGGeometry *g =  gn->geometry();
-        QSGMaterial::Flags flags = gn->activeMaterial()->flags();
-        bool canMerge = (g->drawingMode() == GL_TRIANGLES || g->drawingMode() == GL_TRIANGLE_STRIP ||
-                         g->drawingMode() == GL_LINES || g->drawingMode() == GL_POINTS)
-                        && b->positionAttribute >= 0
-                        && g->indexType() == GL_UNSIGNED_SHORT
-                        && (flags & (QSGMaterial::CustomCompileStep | QSGMaterial_FullMatrix)) == 0
-                        && ((flags & QSGMaterial::RequiresFullMatrixExceptTranslate) == 0 || b->isTranslateOnlyToRoot())
-                        && b->isSafeToBatch();
-
-        b->merged = canMerge;
+        QSGGeometry *g = b->first->node->geometry();
+        b->merged = qsg_canMergeBatch(b);
 
         // Figure out how much memory we need...
         b->vertexCount = 0;
@@ -1823,9 +2237,7 @@ void Renderer::uploadBatch(Batch *b)
             b->vertexCount += eg->vertexCount();
             int iCount = eg->indexCount();
             if (b->merged) {
-                if (iCount == 0)
-                    iCount = eg->vertexCount();
-                iCount = qsg_fixIndexCount(iCount, g->drawingMode());
+                iCount = qsg_mergedIndexCount(eg, g->drawingMode());
             } else {
                 unmergedIndexSize += iCount * eg->sizeOfIndex();
             }
@@ -1836,7 +2248,7 @@ void Renderer::uploadBatch(Batch *b)
         // Abort if there are no vertices in this batch.. We abort this late as
         // this is a broken usecase which we do not care to optimize for...
         if (b->vertexCount == 0 || (b->merged && b->indexCount == 0))
-            return;
+            return false;
 
         /* Allocate memory for this batch. Merged batches are divided into three separate blocks
            1. Vertex data for all elements, as they were in the QSGGeometry object, but
@@ -1861,15 +2273,24 @@ void Renderer::uploadBatch(Batch *b)
         }
 
 #ifdef QSG_SEPARATE_INDEX_BUFFER
-        map(&b->ibo, ibufferSize, true);
+        *indexBufferSize = ibufferSize;
 #else
         bufferSize += ibufferSize;
+        *indexBufferSize = 0;
 #endif
-        map(&b->vbo, bufferSize);
+        *vertexBufferSize = bufferSize;
+        return true;
+}
 
-        if (Q_UNLIKELY(debug_upload())) qDebug() << " - batch" << b << " first:" << b->first << " root:"
-                                   << b->root << " merged:" << b->merged << " positionAttribute" << b->positionAttribute
-                                   << " vbo:" << b->vbo.id << ":" << b->vbo.size;
+/*
+ * Fills the mapped buffers of the batch. This only touches the batch, its
+ * elements and their geometry, so it may run on a worker thread while other
+ * batches are being filled.
+ */
+void Renderer::fillBatch(Batch *b)
+{
+        QSGGeometry *g = b->first->node->geometry();
+        Element *e;
 
         if (b->merged) {
             char *vertexData = b->vbo.data;
@@ -1998,7 +2419,10 @@ void Renderer::uploadBatch(Batch *b)
             }
         }
 #endif // QT_NO_DEBUG_OUTPUT
+}
 
+void Renderer::finishBatchUpload(Batch *b)
+{
         unmap(&b->vbo);
 #ifdef QSG_SEPARATE_INDEX_BUFFER
         unmap(&b->ibo, true);
@@ -2006,12 +2430,186 @@ void Renderer::uploadBatch(Batch *b)
 
         if (Q_UNLIKELY(debug_upload())) qDebug() << "  --- vertex/index buffers unmapped, batch upload completed...";
 
+        // Remember the layout so that later changes can update parts of it
+        const GLenum drawingMode = b->first->node->geometry()->drawingMode();
+        int elementCount = 0;
+        for (Element *e = b->first; e; e = e->nextInBatch) {
+            if (b->merged) {
+                QSGGeometry *eg = e->node->geometry();
+                e->uploadedVertexCount = eg->vertexCount();
+                e->uploadedIndexCount = qsg_mergedIndexCount(eg, drawingMode);
+                e->uploadedOrder = e->order;
+            }
+            e->geometryDirty = false;
+            ++elementCount;
+        }
+        b->retained = b->merged;
+        b->uploadedElementCount = elementCount;
+        b->uploadedZRange = m_zRange;
+
         b->needsUpload = false;
 
         if (Q_UNLIKELY(debug_render()))
             b->uploadedThisFrame = true;
 }
 
+void Renderer::uploadBatch(Batch *b)
+{
+    if (updateRetainedBatch(b))
+        return;
+
+    int bufferSize = 0;
+    int ibufferSize = 0;
+    if (!prepareBatchUpload(b, &bufferSize, &ibufferSize))
+        return;
+
+#ifdef QSG_SEPARATE_INDEX_BUFFER
+    map(&b->ibo, ibufferSize, true);
+#endif
+    map(&b->vbo, bufferSize);
+
+    if (Q_UNLIKELY(debug_upload())) qDebug() << " - batch" << b << " first:" << b->first << " root:"
+                               << b->root << " merged:" << b->merged << " positionAttribute" << b->positionAttribute
+                               << " vbo:" << b->vbo.id << ":" << b->vbo.size;
+
+    fillBatch(b);
+    finishBatchUpload(b);
+}
+
+#ifndef QT_NO_THREAD
+Q_GLOBAL_STATIC(QThreadPool, qsg_uploadThreadPool)
+
+struct UploadJob
+{
+    Renderer *renderer;
+    const QVarLengthArray<Batch *, 64> *batches;
+    QAtomicInt next;
+    QSemaphore done;
+};
+
+class UploadTask : public QRunnable
+{
+public:
+    UploadTask(UploadJob *job) : m_job(job) { }
+
+    void run() Q_DECL_OVERRIDE
+    {
+        fillBatches(m_job);
+        m_job->done.release();
+    }
+
+    static void fillBatches(UploadJob *job)
+    {
+        int i;
+        while ((i = job->next.fetchAndAddRelaxed(1)) < job->batches->size())
+            job->renderer->fillBatch(job->batches->at(i));
+    }
+
+private:
+    UploadJob *m_job;
+};
+#endif
+
+/*
+ * Uploads all \a batches and returns the number of bytes of the vertex upload
+ * pool that were used.
+ *
+ * Merging the elements of a batch is independent of all other batches, so when
+ * there is enough data the buffers of all batches are laid out next to each
+ * other in the upload pools and filled on the upload thread pool. Only the
+ * OpenGL calls in finishBatchUpload() need to happen on the render thread.
+ */
+int Renderer::uploadBatches(const QDataBuffer<Batch *> &batches)
+{
+    int largestVBO = 0;
+#ifndef QT_NO_THREAD
+    const bool usesPool = !m_context->hasBrokenIndexBufferObjects() && m_visualizeMode == VisualizeNothing;
+    if (m_uploadThreadCount > 1 && usesPool && Q_LIKELY(!debug_upload())) {
+        QVarLengthArray<Batch *, 64> toUpload;
+        QVarLengthArray<int, 64> offsets;
+        int vertexPoolSize = 0;
+#ifdef QSG_SEPARATE_INDEX_BUFFER
+        QVarLengthArray<int, 64> indexOffsets;
+        int indexPoolSize = 0;
+#endif
+        int vertexCount = 0;
+        for (int i=0; i<batches.size(); ++i) {
+            Batch *b = batches.at(i);
+            if (updateRetainedBatch(b))
+                continue;
+            int bufferSize = 0;
+            int ibufferSize = 0;
+            if (!prepareBatchUpload(b, &bufferSize, &ibufferSize))
+                continue;
+            toUpload.append(b);
+            b->vbo.size = bufferSize;
+            offsets.append(vertexPoolSize);
+            // Keep every batch's data aligned for the float attributes.
+            vertexPoolSize += (bufferSize + 15) & ~15;
+#ifdef QSG_SEPARATE_INDEX_BUFFER
+            b->ibo.size = ibufferSize;
+            indexOffsets.append(indexPoolSize);
+            indexPoolSize += (ibufferSize + 15) & ~15;
+#endif
+            vertexCount += b->vertexCount;
+        }
+
+        if (toUpload.size() > 1 && vertexCount >= m_uploadThreadVertexThreshold) {
+            if (vertexPoolSize > m_vertexUploadPool.size())
+                m_vertexUploadPool.resize(vertexPoolSize);
+#ifdef QSG_SEPARATE_INDEX_BUFFER
+            if (indexPoolSize > m_indexUploadPool.size())
+                m_indexUploadPool.resize(indexPoolSize);
+#endif
+            for (int i=0; i<toUpload.size(); ++i) {
+                Batch *b = toUpload.at(i);
+                b->vbo.data = m_vertexUploadPool.data() + offsets.at(i);
+#ifdef QSG_SEPARATE_INDEX_BUFFER
+                b->ibo.data = m_indexUploadPool.data() + indexOffsets.at(i);
+#endif
+            }
+
+            UploadJob job;
+            job.renderer = this;
+            job.batches = &toUpload;
+            const int taskCount = qMin(m_uploadThreadCount, toUpload.size()) - 1;
+            for (int i=0; i<taskCount; ++i)
+                qsg_uploadThreadPool()->start(new UploadTask(&job));
+            // The render thread takes its share of the work as well.
+            UploadTask::fillBatches(&job);
+            job.done.acquire(taskCount);
+
+            for (int i=0; i<toUpload.size(); ++i)
+                finishBatchUpload(toUpload.at(i));
+            for (int i=0; i<batches.size(); ++i)
+                largestVBO = qMax(batches.at(i)->vbo.size, largestVBO);
+            return qMax(vertexPoolSize, largestVBO);
+        }
+
+        // Not worth the threads, upload what is left one by one.
+        for (int i=0; i<toUpload.size(); ++i) {
+            Batch *b = toUpload.at(i);
+#ifdef QSG_SEPARATE_INDEX_BUFFER
+            map(&b->ibo, b->ibo.size, true);
+#endif
+            map(&b->vbo, b->vbo.size);
+            fillBatch(b);
+            finishBatchUpload(b);
+        }
+        for (int i=0; i<batches.size(); ++i)
+            largestVBO = qMax(batches.at(i)->vbo.size, largestVBO);
+        return largestVBO;
+    }
+#endif
+
+    for (int i=0; i<batches.size(); ++i) {
+        Batch *b = batches.at(i);
+        uploadBatch(b);
+        largestVBO = qMax(b->vbo.size, largestVBO);
+    }
+    return largestVBO;
+}
+
 /*!
  * Convenience function to set up the stencil buffer for clipping based on \a clip.
  *
@@ -2622,6 +3220,12 @@ void Renderer::render()
     quint64 timeSorting = 0;
     quint64 timeUploadOpaque = 0;
     quint64 timeUploadAlpha = 0;
+    const bool profileFrames = debug_render() || QSG_LOG_TIME_RENDERER().isDebugEnabled();
+
+    ++m_frameCounter;
+
+    if (Q_UNLIKELY(profileFrames))
+        timer.start();
 
     if (Q_UNLIKELY(debug_render() || debug_build())) {
         QByteArray type("rebuild:");
@@ -2639,7 +3243,6 @@ void Renderer::render()
         }
 
         qDebug() << "Renderer::render()" << this << type;
-        timer.start();
     }
 
     if (m_vao)
@@ -2666,7 +3269,7 @@ void Renderer::render()
             }
         }
     }
-    if (Q_UNLIKELY(debug_render())) timeRenderLists = timer.restart();
+    if (Q_UNLIKELY(profileFrames)) timeRenderLists = timer.restart();
 
     for (int i=0; i<m_opaqueBatches.size(); ++i)
         m_opaqueBatches.at(i)->cleanupRemovedElements();
@@ -2674,14 +3277,16 @@ void Renderer::render()
         m_alphaBatches.at(i)->cleanupRemovedElements();
     deleteRemovedElements();
 
+    cullElements();
+
     cleanupBatches(&m_opaqueBatches);
     cleanupBatches(&m_alphaBatches);
 
     if (m_rebuild & BuildBatches) {
         prepareOpaqueBatches();
-        if (Q_UNLIKELY(debug_render())) timePrepareOpaque = timer.restart();
+        if (Q_UNLIKELY(profileFrames)) timePrepareOpaque = timer.restart();
         prepareAlphaBatches();
-        if (Q_UNLIKELY(debug_render())) timePrepareAlpha = timer.restart();
+        if (Q_UNLIKELY(profileFrames)) timePrepareAlpha = timer.restart();
 
         if (Q_UNLIKELY(debug_build())) {
             qDebug() << "Opaque Batches:";
@@ -2702,7 +3307,7 @@ void Renderer::render()
             }
         }
     } else {
-        if (Q_UNLIKELY(debug_render())) timePrepareOpaque = timePrepareAlpha = timer.restart();
+        if (Q_UNLIKELY(profileFrames)) timePrepareOpaque = timePrepareAlpha = timer.restart();
     }
 
 
@@ -2723,39 +3328,24 @@ void Renderer::render()
                  : 0;
     }
 
-    if (Q_UNLIKELY(debug_render())) timeSorting = timer.restart();
-
-    int largestVBO = 0;
-#ifdef QSG_SEPARATE_INDEX_BUFFER
-    int largestIBO = 0;
-#endif
+    if (Q_UNLIKELY(profileFrames)) timeSorting = timer.restart();
 
     if (Q_UNLIKELY(debug_upload())) qDebug() << "Uploading Opaque Batches:";
-    for (int i=0; i<m_opaqueBatches.size(); ++i) {
-        Batch *b = m_opaqueBatches.at(i);
-        largestVBO = qMax(b->vbo.size, largestVBO);
-#ifdef QSG_SEPARATE_INDEX_BUFFER
-        largestIBO = qMax(b->ibo.size, largestIBO);
-#endif
-        uploadBatch(b);
-    }
-    if (Q_UNLIKELY(debug_render())) timeUploadOpaque = timer.restart();
-
+    int vertexPoolUsage = uploadBatches(m_opaqueBatches);
+    if (Q_UNLIKELY(profileFrames)) timeUploadOpaque = timer.restart();
 
     if (Q_UNLIKELY(debug_upload())) qDebug() << "Uploading Alpha Batches:";
-    for (int i=0; i<m_alphaBatches.size(); ++i) {
-        Batch *b = m_alphaBatches.at(i);
-        uploadBatch(b);
-        largestVBO = qMax(b->vbo.size, largestVBO);
-#ifdef QSG_SEPARATE_INDEX_BUFFER
-        largestIBO = qMax(b->ibo.size, largestIBO);
-#endif
-    }
-    if (Q_UNLIKELY(debug_render())) timeUploadAlpha = timer.restart();
+    vertexPoolUsage = qMax(uploadBatches(m_alphaBatches), vertexPoolUsage);
+    if (Q_UNLIKELY(profileFrames)) timeUploadAlpha = timer.restart();
 
-    if (largestVBO * 2 < m_vertexUploadPool.size())
-        m_vertexUploadPool.resize(largestVBO * 2);
+    if (vertexPoolUsage * 2 < m_vertexUploadPool.size())
+        m_vertexUploadPool.resize(vertexPoolUsage * 2);
 #ifdef QSG_SEPARATE_INDEX_BUFFER
+    int largestIBO = 0;
+    for (int i=0; i<m_opaqueBatches.size(); ++i)
+        largestIBO = qMax(m_opaqueBatches.at(i)->ibo.size, largestIBO);
+    for (int i=0; i<m_alphaBatches.size(); ++i)
+        largestIBO = qMax(m_alphaBatches.at(i)->ibo.size, largestIBO);
     if (largestIBO * 2 < m_indexUploadPool.size())
         m_indexUploadPool.resize(largestIBO * 2);
 #endif
@@ -2770,6 +3360,14 @@ void Renderer::render()
                (int) timeUploadOpaque, (int) timeUploadAlpha,
                (int) timer.elapsed());
     }
+    qCDebug(QSG_LOG_TIME_RENDERER,
+            "time in batch renderer: build=%d, prepare(opaque/alpha)=%d/%d, sorting=%d, upload(opaque/alpha)=%d/%d, render=%d, upload threads=%d",
+            int(timeRenderLists),
+            int(timePrepareOpaque), int(timePrepareAlpha),
+            int(timeSorting),
+            int(timeUploadOpaque), int(timeUploadAlpha),
+            int(timer.elapsed()),
+            m_uploadThreadCount);
 
     m_rebuild = 0;
     m_renderOrderRebuildLower = -1;
@@ -80,6 +80,7 @@ struct Batch;
 struct Node;
 class Updater;
 class Renderer;
+class UploadTask;
 class ShaderManager;
 
 template <typename Type, int PageSize> class AllocatorPage
@@ -318,6 +319,14 @@ struct Element {
         , orphaned(false)
         , isRenderNode(false)
         , isMaterialBlended(false)
+        , geometryDirty(false)
+        , volatileGeometry(false)
+        , culled(false)
+        , changeStreak(0)
+        , lastChangeFrame(0)
+        , uploadedVertexCount(0)
+        , uploadedIndexCount(0)
+        , uploadedOrder(0)
     {
     }
 
@@ -348,6 +357,17 @@ struct Element {
     uint orphaned : 1;
     uint isRenderNode : 1;
     uint isMaterialBlended : 1;
+    uint geometryDirty : 1; // vertex data changed since the batch was last uploaded
+    uint volatileGeometry : 1; // changes often enough to be kept out of static batches
+    uint culled : 1; // outside the viewport or its clip, or covered; left out of the batches
+
+    uint changeStreak;
+    uint lastChangeFrame;
+
+    // Where the element is in its batch's retained buffers
+    int uploadedVertexCount;
+    int uploadedIndexCount;
+    int uploadedOrder;
 };
 
 struct RenderNodeElement : public Element {
@@ -420,6 +440,7 @@ struct Batch
         positionAttribute = -1;
         uploadedThisFrame = false;
         isRenderNode = false;
+        retained = false;
     }
 
     Element *first;
@@ -436,9 +457,13 @@ struct Batch
     uint needsUpload : 1;
     uint merged : 1;
     uint isRenderNode : 1;
+    uint retained : 1; // the buffers hold the layout recorded in the elements
 
     mutable uint uploadedThisFrame : 1; // solely for debugging purposes
 
+    int uploadedElementCount;
+    float uploadedZRange;
+
     Buffer vbo;
     Buffer ibo;
 
@@ -648,6 +673,7 @@ private:
     };
 
     friend class Updater;
+    friend class UploadTask;
 
     void map(Buffer *buffer, int size, bool isIndexBuf = false);
     void unmap(Buffer *buffer, bool isIndexBuf = false);
@@ -663,8 +689,15 @@ private:
     bool checkOverlap(int first, int last, const Rect &bounds);
     void prepareAlphaBatches();
     void invalidateBatchAndOverlappingRenderOrders(Batch *batch);
+    void cullElements();
 
+    void elementGeometryChanged(Element *e);
+    bool updateRetainedBatch(Batch *b);
+    bool prepareBatchUpload(Batch *b, int *vertexBufferSize, int *indexBufferSize);
+    void fillBatch(Batch *b);
+    void finishBatchUpload(Batch *b);
     void uploadBatch(Batch *b);
+    int uploadBatches(const QDataBuffer<Batch *> &batches);
     void uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, quint16 *iBase, int *indexCount);
 
     void renderBatches();
@@ -721,6 +754,7 @@ private:
     QDataBuffer<Element *> m_tmpOpaqueElements;
 
     uint m_rebuild;
+    uint m_frameCounter;
     qreal m_zRange;
     int m_renderOrderRebuildLower;
     int m_renderOrderRebuildUpper;
@@ -728,6 +762,11 @@ private:
     GLuint m_bufferStrategy;
     int m_batchNodeThreshold;
     int m_batchVertexThreshold;
+    int m_uploadThreadCount;
+    int m_uploadThreadVertexThreshold;
+    bool m_cullingEnabled;
+    int m_viewportCulledCount;
+    int m_occlusionCulledCount;
 
     // Stuff used during rendering only...
     ShaderManager *m_shaderManager;
@@ -49,8 +49,128 @@
 #include <malloc.h>
 #endif
 
+#include <QtCore/qmutex.h>
+
 QT_BEGIN_NAMESPACE
 
+int qt_sg_envInt(const char *name, int defaultValue);
+
+/*
+    Vertex and index data is taken from pools of power of two sized blocks so
+    that nodes which are created, resized and destroyed every frame do not
+    go through malloc and free. Freed blocks are kept in the pool until the
+    end of the next sync, where whatever exceeds QSG_GEOMETRY_POOL_SIZE (in
+    KB) is returned to the system in one go.
+ */
+
+struct QSGGeometryBlock
+{
+    QSGGeometryBlock *next; // only valid while in the pool
+    int sizeClass;          // -1 for blocks too large to be pooled
+};
+
+enum {
+    QSGGeometryBlockHeaderSize = 16, // keeps the data aligned like malloc does
+    QSGGeometrySmallestBlock = 256,
+    QSGGeometrySizeClassCount = 10   // up to 128 KB
+};
+
+Q_STATIC_ASSERT(sizeof(QSGGeometryBlock) <= QSGGeometryBlockHeaderSize);
+
+static QBasicMutex qsg_geometryPoolMutex;
+static QSGGeometryBlock *qsg_geometryPool[QSGGeometrySizeClassCount];
+static qint64 qsg_geometryPoolBytes = 0;
+
+static inline int qsg_geometryBlockSize(int sizeClass)
+{
+    return QSGGeometrySmallestBlock << sizeClass;
+}
+
+static qint64 qsg_geometryPoolLimit()
+{
+    static const qint64 limit = qint64(qMax(0, qt_sg_envInt("QSG_GEOMETRY_POOL_SIZE", 1024))) * 1024;
+    return limit;
+}
+
+static void *qsg_allocateGeometryData(int size)
+{
+    int sizeClass = 0;
+    while (sizeClass < QSGGeometrySizeClassCount && qsg_geometryBlockSize(sizeClass) < size)
+        ++sizeClass;
+
+    QSGGeometryBlock *block = 0;
+    if (sizeClass < QSGGeometrySizeClassCount) {
+        {
+            QMutexLocker locker(&qsg_geometryPoolMutex);
+            block = qsg_geometryPool[sizeClass];
+            if (block) {
+                qsg_geometryPool[sizeClass] = block->next;
+                qsg_geometryPoolBytes -= qsg_geometryBlockSize(sizeClass);
+            }
+        }
+        if (!block)
+            block = (QSGGeometryBlock *) malloc(QSGGeometryBlockHeaderSize + qsg_geometryBlockSize(sizeClass));
+    } else {
+        sizeClass = -1;
+        block = (QSGGeometryBlock *) malloc(QSGGeometryBlockHeaderSize + size);
+    }
+    Q_CHECK_PTR(block);
+
+    block->next = 0;
+    block->sizeClass = sizeClass;
+    return (char *) block + QSGGeometryBlockHeaderSize;
+}
+
+static inline QSGGeometryBlock *qsg_geometryBlock(void *data)
+{
+    return (QSGGeometryBlock *) ((char *) data - QSGGeometryBlockHeaderSize);
+}
+
+static void qsg_freeGeometryData(void *data)
+{
+    QSGGeometryBlock *block = qsg_geometryBlock(data);
+    if (block->sizeClass >= 0) {
+        QMutexLocker locker(&qsg_geometryPoolMutex);
+        // Geometry used without ever syncing a scene graph should not make
+        // the pool grow forever.
+        if (qsg_geometryPoolBytes < 4 * qsg_geometryPoolLimit()) {
+            block->next = qsg_geometryPool[block->sizeClass];
+            qsg_geometryPool[block->sizeClass] = block;
+            qsg_geometryPoolBytes += qsg_geometryBlockSize(block->sizeClass);
+            return;
+        }
+    }
+    free(block);
+}
+
+/*
+    Called at the end of each sync, returns the pooled blocks exceeding the
+    limit of the pool to the system, largest ones first.
+ */
+void qsg_releasePooledGeometryData()
+{
+    QSGGeometryBlock *released = 0;
+    {
+        QMutexLocker locker(&qsg_geometryPoolMutex);
+        const qint64 limit = qsg_geometryPoolLimit();
+        for (int sizeClass = QSGGeometrySizeClassCount - 1; sizeClass >= 0 && qsg_geometryPoolBytes > limit; --sizeClass) {
+            while (qsg_geometryPool[sizeClass] && qsg_geometryPoolBytes > limit) {
+                QSGGeometryBlock *block = qsg_geometryPool[sizeClass];
+                qsg_geometryPool[sizeClass] = block->next;
+                qsg_geometryPoolBytes -= qsg_geometryBlockSize(sizeClass);
+                block->next = released;
+                released = block;
+            }
+        }
+    }
+
+    while (released) {
+        QSGGeometryBlock *next = released->next;
+        free(released);
+        released = next;
+    }
+}
+
 
 QSGGeometry::Attribute QSGGeometry::Attribute::create(int attributeIndex, int tupleSize, int primitiveType, bool isPrimitive)
 {
@@ -485,7 +605,7 @@ QSGGeometry::QSGGeometry(const QSGGeometry::AttributeSet &attributes,
 QSGGeometry::~QSGGeometry()
 {
     if (m_owns_data)
-        free(m_data);
+        qsg_freeGeometryData(m_data);
 
     if (m_server_data)
         delete m_server_data;
@@ -664,18 +784,26 @@ void QSGGeometry::allocate(int vertexCount, int indexCount)
     bool canUsePrealloc = m_index_count <= 0;
     int vertexByteSize = m_attributes.stride * m_vertex_count;
 
-    if (m_owns_data)
-        free(m_data);
-
     if (canUsePrealloc && vertexByteSize <= (int) sizeof(m_prealloc)) {
+        if (m_owns_data)
+            qsg_freeGeometryData(m_data);
         m_data = (void *) &m_prealloc[0];
         m_index_data_offset = -1;
         m_owns_data = false;
     } else {
         Q_ASSERT(m_index_type == UnsignedIntType || m_index_type == UnsignedShortType);
         int indexByteSize = indexCount * (m_index_type == UnsignedShortType ? sizeof(quint16) : sizeof(quint32));
-        m_data = (void *) malloc(vertexByteSize + indexByteSize);
-        Q_CHECK_PTR(m_data);
+        const int byteSize = vertexByteSize + indexByteSize;
+        // Resizing within the same block is common for text and rectangles,
+        // but do not hold on to a block much larger than needed
+        QSGGeometryBlock *block = m_owns_data ? qsg_geometryBlock(m_data) : 0;
+        if (!block || block->sizeClass < 0
+                || qsg_geometryBlockSize(block->sizeClass) < byteSize
+                || (block->sizeClass > 0 && qsg_geometryBlockSize(block->sizeClass) / 4 > byteSize)) {
+            if (m_owns_data)
+                qsg_freeGeometryData(m_data);
+            m_data = qsg_allocateGeometryData(byteSize);
+        }
         m_index_data_offset = vertexByteSize;
         m_owns_data = true;
     }
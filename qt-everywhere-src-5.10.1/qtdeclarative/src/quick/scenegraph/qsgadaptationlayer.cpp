@@ -47,17 +47,59 @@
 #include <qdir.h>
 #include <qsgrendernode.h>
 
+#include <QtQuick/private/qsgdistancefielddiskcache_p.h>
 #include <private/qquickprofiler_p.h>
 #include <QElapsedTimer>
+#include <QThreadPool>
+#include <QSemaphore>
 
 QT_BEGIN_NAMESPACE
 
 static QElapsedTimer qsg_render_timer;
 
+int qt_sg_envInt(const char *name, int defaultValue);
+
+#ifndef QT_NO_THREAD
+Q_GLOBAL_STATIC(QThreadPool, qsg_glyphThreadPool)
+#endif
+
+struct DistanceFieldJob
+{
+    const QVector<glyph_t> *glyphs;
+    const QVector<QPainterPath> *paths;
+    QDistanceField *fields;
+    bool doubleGlyphResolution;
+    QAtomicInt next;
+    QSemaphore done;
+};
+
+class DistanceFieldTask : public QRunnable
+{
+public:
+    DistanceFieldTask(DistanceFieldJob *job) : m_job(job) { }
+
+    void run() override
+    {
+        renderGlyphs(m_job);
+        m_job->done.release();
+    }
+
+    static void renderGlyphs(DistanceFieldJob *job)
+    {
+        int i;
+        while ((i = job->next.fetchAndAddRelaxed(1)) < job->glyphs->size())
+            job->fields[i] = QDistanceField(job->paths->at(i), job->glyphs->at(i), job->doubleGlyphResolution);
+    }
+
+private:
+    DistanceFieldJob *m_job;
+};
+
 QSGDistanceFieldGlyphCache::Texture QSGDistanceFieldGlyphCache::s_emptyTexture;
 
 QSGDistanceFieldGlyphCache::QSGDistanceFieldGlyphCache(QOpenGLContext *c, const QRawFont &font)
     : m_pendingGlyphs(64)
+    , m_diskCache(nullptr)
 {
     Q_ASSERT(font.isValid());
 
@@ -80,6 +122,7 @@ QSGDistanceFieldGlyphCache::QSGDistanceFieldGlyphCache(QOpenGLContext *c, const
 
 QSGDistanceFieldGlyphCache::~QSGDistanceFieldGlyphCache()
 {
+    delete m_diskCache;
 }
 
 QSGDistanceFieldGlyphCache::GlyphData &QSGDistanceFieldGlyphCache::glyphData(glyph_t glyph)
@@ -172,16 +215,49 @@ void QSGDistanceFieldGlyphCache::update()
         qsg_render_timer.start();
     Q_QUICK_SG_PROFILE_START(QQuickProfiler::SceneGraphAdaptationLayerFrame);
 
+    if (!m_diskCache)
+        m_diskCache = new QSGDistanceFieldDiskCache(m_referenceFont, m_doubleGlyphResolution);
+
+    // Glyphs rendered by an earlier run only need to be copied out of the
+    // disk cache, the others are rendered on the glyph thread pool.
     QList<QDistanceField> distanceFields;
+    QVector<glyph_t> glyphsToRender;
+    QVector<QPainterPath> pathsToRender;
     const int pendingGlyphsSize = m_pendingGlyphs.size();
-    distanceFields.reserve(pendingGlyphsSize);
     for (int i = 0; i < pendingGlyphsSize; ++i) {
-        GlyphData &gd = glyphData(m_pendingGlyphs.at(i));
-        distanceFields.append(QDistanceField(gd.path,
-                                             m_pendingGlyphs.at(i),
-                                             m_doubleGlyphResolution));
+        const glyph_t glyph = m_pendingGlyphs.at(i);
+        GlyphData &gd = glyphData(glyph);
+        const QDistanceField cached = m_diskCache->glyph(glyph);
+        if (!cached.isNull()) {
+            distanceFields.append(cached);
+        } else {
+            glyphsToRender.append(glyph);
+            pathsToRender.append(gd.path);
+        }
         gd.path = QPainterPath(); // no longer needed, so release memory used by the painter path
     }
+    const int cachedCount = distanceFields.count();
+
+    QVector<QDistanceField> renderedFields(glyphsToRender.size());
+    DistanceFieldJob job;
+    job.glyphs = &glyphsToRender;
+    job.paths = &pathsToRender;
+    job.fields = renderedFields.data();
+    job.doubleGlyphResolution = m_doubleGlyphResolution;
+    int taskCount = 0;
+#ifndef QT_NO_THREAD
+    static const int threadCount = qt_sg_envInt("QSG_DISTANCEFIELD_THREADS", qBound(1, QThread::idealThreadCount(), 4));
+    taskCount = qMax(0, qMin(threadCount, glyphsToRender.size()) - 1);
+    for (int i = 0; i < taskCount; ++i)
+        qsg_glyphThreadPool()->start(new DistanceFieldTask(&job));
+#endif
+
+    // Upload the cached glyphs while the others are being rendered
+    if (!distanceFields.isEmpty())
+        storeGlyphs(distanceFields);
+
+    DistanceFieldTask::renderGlyphs(&job);
+    job.done.acquire(taskCount);
 
     qint64 renderTime = 0;
     int count = m_pendingGlyphs.size();
@@ -192,7 +268,11 @@ void QSGDistanceFieldGlyphCache::update()
 
     m_pendingGlyphs.reset();
 
-    storeGlyphs(distanceFields);
+    if (!renderedFields.isEmpty()) {
+        distanceFields = renderedFields.toList();
+        storeGlyphs(distanceFields);
+        m_diskCache->store(distanceFields);
+    }
 
 #if defined(QSG_DISTANCEFIELD_CACHE_DEBUG)
     for (Texture texture : qAsConst(m_textures))
@@ -202,11 +282,12 @@ void QSGDistanceFieldGlyphCache::update()
     if (QSG_LOG_TIME_GLYPH().isDebugEnabled()) {
         quint64 now = qsg_render_timer.elapsed();
         qCDebug(QSG_LOG_TIME_GLYPH,
-                "distancefield: %d glyphs prepared in %dms, rendering=%d, upload=%d",
+                "distancefield: %d glyphs prepared in %dms, rendering=%d, upload=%d, from disk cache=%d",
                 count,
                 (int) now,
                 int(renderTime / 1000000),
-                int((now - (renderTime / 1000000))));
+                int((now - (renderTime / 1000000))),
+                cachedCount);
     }
     Q_QUICK_SG_PROFILE_END_WITH_PAYLOAD(QQuickProfiler::SceneGraphAdaptationLayerFrame,
                                         QQuickProfiler::SceneGraphAdaptationLayerGlyphStore,
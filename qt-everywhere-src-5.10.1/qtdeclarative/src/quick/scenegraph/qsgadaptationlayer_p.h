@@ -405,6 +405,8 @@ public:
     virtual void invalidateGlyphs(const QVector<quint32> &glyphs) = 0;
 };
 
+class QSGDistanceFieldDiskCache;
+
 class Q_QUICK_PRIVATE_EXPORT QSGDistanceFieldGlyphCache
 {
 public:
@@ -522,6 +524,7 @@ private:
     QDataBuffer<glyph_t> m_pendingGlyphs;
     QSet<glyph_t> m_populatingGlyphs;
     QLinkedList<QSGDistanceFieldGlyphConsumer*> m_registeredNodes;
+    QSGDistanceFieldDiskCache *m_diskCache;
 
     static Texture s_emptyTexture;
 };
@@ -74,6 +74,8 @@
 
 QT_BEGIN_NAMESPACE
 
+void qsg_releasePooledGeometryData();
+
 // Used for very high-level info about the renderering and gl context
 // Includes GL_VERSION, type of render loop, atlas size, etc.
 Q_LOGGING_CATEGORY(QSG_LOG_INFO,                "qt.scenegraph.general")
@@ -345,6 +347,8 @@ void QSGRenderContext::endSync()
 {
     qDeleteAll(m_texturesToDelete);
     m_texturesToDelete.clear();
+
+    qsg_releasePooledGeometryData();
 }
 
 /*!
@@ -58,6 +58,7 @@
 #include <QtQuick/private/qsgcontext_p.h>
 #include <QtQuick/private/qsgrenderer_p.h>
 #include <private/qquickprofiler_p.h>
+#include <private/qtquick_tracepoints_p.h>
 
 #if QT_CONFIG(opengl)
 # include <QtGui/QOpenGLContext>
@@ -417,16 +418,20 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
 
     emit window->afterAnimating();
 
+    Q_TRACE(QSGRenderLoop_sync_entry, window);
     cd->syncSceneGraph();
     if (lastDirtyWindow)
         rc->endSync();
+    Q_TRACE(QSGRenderLoop_sync_exit, window);
 
     if (profileFrames)
         syncTime = renderTimer.nsecsElapsed();
     Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
                               QQuickProfiler::SceneGraphRenderLoopSync);
 
+    Q_TRACE(QSGRenderLoop_render_entry, window);
     cd->renderSceneGraph(window->size());
+    Q_TRACE(QSGRenderLoop_render_exit, window);
 
     if (profileFrames)
         renderTime = renderTimer.nsecsElapsed();
@@ -441,8 +446,10 @@ void QSGGuiThreadRenderLoop::renderWindow(QQuickWindow *window)
     }
 
     if (alsoSwap && window->isVisible()) {
+        Q_TRACE(QSGRenderLoop_swap_entry, window);
         if (!cd->customRenderStage || !cd->customRenderStage->swap())
             gl->swapBuffers(window);
+        Q_TRACE(QSGRenderLoop_swap_exit, window);
         cd->fireFrameSwapped();
     }
 
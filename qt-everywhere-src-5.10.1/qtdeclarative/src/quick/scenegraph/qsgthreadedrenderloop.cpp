@@ -48,6 +48,7 @@
 #include <QtGui/QGuiApplication>
 #include <QtGui/QScreen>
 #include <QtGui/QOffscreenSurface>
+#include <QtGui/QOpenGLExtraFunctions>
 
 #include <qpa/qwindowsysteminterface.h>
 
@@ -60,6 +61,7 @@
 #include <private/qquickanimatorcontroller_p.h>
 
 #include <private/qquickprofiler_p.h>
+#include <private/qtquick_tracepoints_p.h>
 #include <private/qqmldebugserviceinterfaces_p.h>
 #include <private/qqmldebugconnector_p.h>
 
@@ -127,6 +129,30 @@ static inline int qsgrl_animation_interval() {
 }
 
 
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#endif
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#endif
+
+int qt_sg_envInt(const char *name, int defaultValue);
+
+// The number of frames the render thread may queue up on the GPU before it
+// waits for the oldest one to complete. 0 leaves the pacing to the driver.
+static inline int qsgrl_render_ahead()
+{
+    return qBound(0, qt_sg_envInt("QSG_RENDER_AHEAD", 0), 2);
+}
+
+static bool qsgrl_hasFenceSync(QOpenGLContext *gl)
+{
+    const QSurfaceFormat format = gl->format();
+    if (gl->isOpenGLES())
+        return format.majorVersion() >= 3;
+    return format.version() >= qMakePair(3, 2) || gl->hasExtension(QByteArrayLiteral("GL_ARB_sync"));
+}
+
 static QElapsedTimer threadTimer;
 static qint64 syncTime;
 static qint64 renderTime;
@@ -278,6 +304,15 @@ public:
         , active(false)
         , window(0)
         , stopEventProcessing(false)
+        , renderAhead(qsgrl_render_ahead())
+        , effectiveRenderAhead(qMin(renderAhead, 1))
+        , onTimeFrames(0)
+        , fenceSync(-1)
+        , frameCount(0)
+        , lateSyncCount(0)
+        , lastPresentTime(-1)
+        , averageSyncTime(0)
+        , averageRenderTime(0)
     {
         sgrc = static_cast<QSGDefaultRenderContext *>(renderContext);
 #if defined(Q_OS_QNX) && defined(Q_PROCESSOR_X86)
@@ -285,6 +320,8 @@ public:
         setStackSize(1024 * 1024);
 #endif
         vsyncDelta = qsgrl_animation_interval();
+        frameInterval = vsyncDelta;
+        paceTimer.start();
     }
 
     ~QSGRenderThread()
@@ -301,6 +338,12 @@ public:
     void syncAndRender();
     void sync(bool inExpose);
 
+    void checkSyncDeadline(qint64 syncStart);
+    void waitForFrameFences(int maxPending);
+    void insertFrameFence();
+    void releaseFrameFences();
+    void recordFrame(QQuickWindowPrivate *d, qint64 syncNs, qint64 renderNs, qint64 presentTime);
+
     void requestRepaint()
     {
         if (sleeping)
@@ -351,6 +394,20 @@ public:
     // Local event queue stuff...
     bool stopEventProcessing;
     QSGRenderThreadEventQueue eventQueue;
+
+    // Frame pacing and statistics, times in ns are relative to paceTimer
+    int renderAhead;
+    int effectiveRenderAhead;
+    int onTimeFrames;
+    int fenceSync;
+    QVector<GLsync> frameFences;
+    int frameCount;
+    int lateSyncCount;
+    QElapsedTimer paceTimer;
+    qint64 lastPresentTime;
+    qreal frameInterval;
+    qreal averageSyncTime;
+    qreal averageRenderTime;
 };
 
 bool QSGRenderThread::event(QEvent *e)
@@ -498,6 +555,12 @@ void QSGRenderThread::invalidateOpenGL(QQuickWindow *window, bool inDestructor,
 
     QQuickWindowPrivate *dd = QQuickWindowPrivate::get(window);
 
+    if (current)
+        releaseFrameFences();
+    else
+        frameFences.clear();
+    lastPresentTime = -1;
+
 #if QT_CONFIG(quick_shadereffect)
     QQuickOpenGLShaderEffectMaterial::cleanupMaterialCache();
 #endif
@@ -524,6 +587,7 @@ void QSGRenderThread::invalidateOpenGL(QQuickWindow *window, bool inDestructor,
     if (wipeGL) {
         delete gl;
         gl = 0;
+        fenceSync = -1;
         qCDebug(QSG_LOG_RENDERLOOP) << QSG_RT_PAD << "- invalidated OpenGL";
     } else {
         qCDebug(QSG_LOG_RENDERLOOP) << QSG_RT_PAD << "- persistent GL, avoiding cleanup";
@@ -559,8 +623,10 @@ void QSGRenderThread::sync(bool inExpose)
         // changed signal.
         if (d->renderer)
             d->renderer->clearChangedFlag();
+        Q_TRACE(QSGRenderLoop_sync_entry, window);
         d->syncSceneGraph();
         sgrc->endSync();
+        Q_TRACE(QSGRenderLoop_sync_exit, window);
         if (!hadRenderer && d->renderer) {
             qCDebug(QSG_LOG_RENDERLOOP) << QSG_RT_PAD << "- renderer was created";
             syncResultedInChanges = true;
@@ -593,6 +659,7 @@ void QSGRenderThread::syncAndRender()
 
     QElapsedTimer waitTimer;
     waitTimer.start();
+    const qint64 frameStart = paceTimer.nsecsElapsed();
 
     qCDebug(QSG_LOG_RENDERLOOP) << QSG_RT_PAD << "syncAndRender()";
 
@@ -606,8 +673,10 @@ void QSGRenderThread::syncAndRender()
 
     if (syncRequested) {
         qCDebug(QSG_LOG_RENDERLOOP) << QSG_RT_PAD << "- updatePending, doing sync";
+        checkSyncDeadline(frameStart);
         sync(exposeRequested);
     }
+    const qint64 syncEnd = paceTimer.nsecsElapsed();
 #ifndef QSG_NO_RENDER_TIMING
     if (profileFrames)
         syncTime = threadTimer.nsecsElapsed();
@@ -642,13 +711,24 @@ void QSGRenderThread::syncAndRender()
         QCoreApplication::postEvent(window, new QEvent(QEvent::Type(QQuickWindowPrivate::FullUpdateRequest)));
     }
     if (current) {
+        if (renderAhead > 0)
+            waitForFrameFences(effectiveRenderAhead);
+        const qint64 renderStart = paceTimer.nsecsElapsed();
+        Q_TRACE(QSGRenderLoop_render_entry, window);
         d->renderSceneGraph(windowSize);
+        Q_TRACE(QSGRenderLoop_render_exit, window);
+        const qint64 renderEnd = paceTimer.nsecsElapsed();
         if (profileFrames)
             renderTime = threadTimer.nsecsElapsed();
         Q_QUICK_SG_PROFILE_RECORD(QQuickProfiler::SceneGraphRenderLoopFrame,
                                   QQuickProfiler::SceneGraphRenderLoopRender);
+        Q_TRACE(QSGRenderLoop_swap_entry, window);
         if (!d->customRenderStage || !d->customRenderStage->swap())
             gl->swapBuffers(window);
+        Q_TRACE(QSGRenderLoop_swap_exit, window);
+        if (renderAhead > 0)
+            insertFrameFence();
+        recordFrame(d, syncEnd - frameStart, renderEnd - renderStart, paceTimer.nsecsElapsed());
         d->fireFrameSwapped();
     } else {
         Q_QUICK_SG_PROFILE_SKIP(QQuickProfiler::SceneGraphRenderLoopFrame,
@@ -683,6 +763,99 @@ void QSGRenderThread::syncAndRender()
 
 
 
+/*
+    The sync is late when it starts after the point where the frame can
+    still be rendered in time for the next predicted present, going by the
+    average sync and render times. A late sync lets the render thread queue
+    up to renderAhead frames; after a while of being on time, it goes back
+    to a single frame to keep the latency down.
+ */
+void QSGRenderThread::checkSyncDeadline(qint64 syncStart)
+{
+    if (lastPresentTime < 0)
+        return;
+
+    const qint64 interval = qint64(frameInterval * 1000000);
+    // Only frames rendered back to back have a deadline
+    if (syncStart - lastPresentTime > 2 * interval)
+        return;
+
+    const qint64 deadline = lastPresentTime + interval
+            - qint64((averageSyncTime + averageRenderTime) * 1000000);
+    if (syncStart > deadline) {
+        ++lateSyncCount;
+        onTimeFrames = 0;
+        if (effectiveRenderAhead < renderAhead) {
+            qCDebug(QSG_LOG_RENDERLOOP) << QSG_RT_PAD << "- late sync, rendering" << renderAhead << "frames ahead";
+            effectiveRenderAhead = renderAhead;
+        }
+    } else if (effectiveRenderAhead > 1 && ++onTimeFrames >= 120) {
+        qCDebug(QSG_LOG_RENDERLOOP) << QSG_RT_PAD << "- syncs on time, rendering 1 frame ahead";
+        effectiveRenderAhead = 1;
+        onTimeFrames = 0;
+    }
+}
+
+void QSGRenderThread::waitForFrameFences(int maxPending)
+{
+    if (frameFences.isEmpty())
+        return;
+    QOpenGLExtraFunctions *f = gl->extraFunctions();
+    while (frameFences.size() >= maxPending) {
+        GLsync fence = frameFences.takeFirst();
+        // Don't wait forever on a lost context
+        f->glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+        f->glDeleteSync(fence);
+    }
+}
+
+void QSGRenderThread::insertFrameFence()
+{
+    if (fenceSync < 0)
+        fenceSync = qsgrl_hasFenceSync(gl);
+    if (fenceSync)
+        frameFences.append(gl->extraFunctions()->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+}
+
+void QSGRenderThread::releaseFrameFences()
+{
+    if (frameFences.isEmpty())
+        return;
+    QOpenGLExtraFunctions *f = gl->extraFunctions();
+    for (GLsync fence : qAsConst(frameFences))
+        f->glDeleteSync(fence);
+    frameFences.clear();
+}
+
+void QSGRenderThread::recordFrame(QQuickWindowPrivate *d, qint64 syncNs, qint64 renderNs, qint64 presentTime)
+{
+    if (lastPresentTime >= 0) {
+        const qreal interval = (presentTime - lastPresentTime) / 1000000.0;
+        // Gaps between animations say nothing about the display rate
+        if (interval < 4 * frameInterval)
+            frameInterval += (interval - frameInterval) / 16;
+    }
+    lastPresentTime = presentTime;
+    averageSyncTime += (syncNs / 1000000.0 - averageSyncTime) / 16;
+    averageRenderTime += (renderNs / 1000000.0 - averageRenderTime) / 16;
+    ++frameCount;
+
+    // The frame just submitted reaches the screen after the ones still queued
+    const int framesInFlight = qMax(1, frameFences.size());
+    const qint64 reference = paceTimer.msecsSinceReference();
+
+    QMutexLocker locker(&d->frameStatisticsMutex);
+    QQuickWindow::FrameStatistics &stats = d->frameStatistics;
+    stats.frameCount = frameCount;
+    stats.lateSyncCount = lateSyncCount;
+    stats.renderAhead = renderAhead > 0 ? effectiveRenderAhead : 0;
+    stats.frameInterval = frameInterval;
+    stats.syncTime = averageSyncTime;
+    stats.renderTime = averageRenderTime;
+    stats.lastPresentTime = reference + presentTime / 1000000;
+    stats.predictedPresentTime = stats.lastPresentTime + qint64(framesInFlight * frameInterval);
+}
+
 void QSGRenderThread::postEvent(QEvent *e)
 {
     eventQueue.addEvent(e);
@@ -54,6 +54,7 @@
 #include <QtQuick/QQuickWindow>
 
 #include <private/qquickprofiler_p.h>
+#include <private/qtquick_tracepoints_p.h>
 #include <private/qquickanimatorcontroller_p.h>
 
 #if QT_CONFIG(quick_shadereffect) && QT_CONFIG(opengl)
@@ -472,20 +473,26 @@ void QSGWindowsRenderLoop::renderWindow(QQuickWindow *window)
     emit window->afterAnimating();
 
     RLDEBUG(" - syncing");
+    Q_TRACE(QSGRenderLoop_sync_entry, window);
     d->syncSceneGraph();
     if (lastDirtyWindow)
         m_rc->endSync();
+    Q_TRACE(QSGRenderLoop_sync_exit, window);
     QSG_RENDER_TIMING_SAMPLE(QQuickProfiler::SceneGraphRenderLoopFrame, time_synced,
                              QQuickProfiler::SceneGraphRenderLoopSync);
 
     RLDEBUG(" - rendering");
+    Q_TRACE(QSGRenderLoop_render_entry, window);
     d->renderSceneGraph(window->size());
+    Q_TRACE(QSGRenderLoop_render_exit, window);
     QSG_RENDER_TIMING_SAMPLE(QQuickProfiler::SceneGraphRenderLoopFrame, time_rendered,
                              QQuickProfiler::SceneGraphRenderLoopRender);
 
     RLDEBUG(" - swapping");
+    Q_TRACE(QSGRenderLoop_swap_entry, window);
     if (!d->customRenderStage || !d->customRenderStage->swap())
         m_gl->swapBuffers(window);
+    Q_TRACE(QSGRenderLoop_swap_exit, window);
     QSG_RENDER_TIMING_SAMPLE(QQuickProfiler::SceneGraphRenderLoopFrame, time_swapped,
                              QQuickProfiler::SceneGraphRenderLoopSwap);
 
@@ -38,6 +38,7 @@ qtConfig(opengl(es1|es2)?) {
 # Util API
 HEADERS += \
     $$PWD/util/qsgareaallocator_p.h \
+    $$PWD/util/qsgdistancefielddiskcache_p.h \
     $$PWD/util/qsgengine.h \
     $$PWD/util/qsgengine_p.h \
     $$PWD/util/qsgsimplerectnode.h \
@@ -56,6 +57,7 @@ HEADERS += \
 
 SOURCES += \
     $$PWD/util/qsgareaallocator.cpp \
+    $$PWD/util/qsgdistancefielddiskcache.cpp \
     $$PWD/util/qsgengine.cpp \
     $$PWD/util/qsgsimplerectnode.cpp \
     $$PWD/util/qsgsimpletexturenode.cpp \
@@ -230,8 +232,10 @@ SOURCES += \
 
 qtConfig(opengl(es1|es2)?) {
     HEADERS += \
+        $$PWD/compressedtexture/qsgetcencoder_p.h \
         $$PWD/compressedtexture/qsgpkmhandler_p.h
 
     SOURCES += \
+        $$PWD/compressedtexture/qsgetcencoder.cpp \
         $$PWD/compressedtexture/qsgpkmhandler.cpp
 }
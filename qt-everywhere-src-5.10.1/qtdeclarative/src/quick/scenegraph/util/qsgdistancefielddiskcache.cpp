@@ -0,0 +1,219 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qsgdistancefielddiskcache_p.h"
+
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qstandardpaths.h>
+#include <QtGui/qrawfont.h>
+#include <QtGui/private/qrawfont_p.h>
+#include <QtQml/private/qqmlglobal_p.h>
+
+QT_BEGIN_NAMESPACE
+
+DEFINE_BOOL_CONFIG_OPTION(qsgDisableDistanceFieldDiskCache, QSG_DISABLE_DISTANCEFIELD_DISK_CACHE)
+
+/*
+    Keeps the distance fields of a font on disk, so that they only need to be
+    rendered once instead of on every start of the application.
+
+    There is one file per font, named after a hash of the font's header and
+    naming tables and of the distance field parameters. The file starts with
+    a magic number and is followed by a record per glyph: the glyph index,
+    the width and height of the field and the tightly packed field data. New
+    glyphs are only ever appended, so the file is mapped into memory when the
+    cache is created and the fields are copied out of it on demand. Records
+    that were cut short, for instance by a crash, end the file.
+*/
+
+static const int cacheVersion = 1;
+static const char cacheMagic[8] = { 'Q', 'S', 'G', 'D', 'F', 'C', 0, cacheVersion };
+static const qint64 maxCacheFileSize = 64 * 1024 * 1024;
+
+struct GlyphRecord
+{
+    quint32 glyph;
+    quint16 width;
+    quint16 height;
+};
+
+QSGDistanceFieldDiskCache::QSGDistanceFieldDiskCache(const QRawFont &font, bool doubleGlyphResolution)
+    : m_data(nullptr)
+    , m_size(0)
+    , m_glyphCount(0)
+{
+    if (qsgDisableDistanceFieldDiskCache())
+        return;
+
+    // Only fonts with SFNT tables can be identified reliably. The header
+    // table has the checksum of the whole font file.
+    const QByteArray head = font.fontTable("head");
+    const QString directory = cacheDirectory();
+    if (head.isEmpty() || directory.isEmpty())
+        return;
+
+    QFontEngine *fontEngine = QRawFontPrivate::get(font)->fontEngine;
+    m_glyphCount = fontEngine->glyphCount();
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(head);
+    hash.addData(font.fontTable("name"));
+    const qint32 parameters[] = {
+        cacheVersion,
+        doubleGlyphResolution,
+        QT_DISTANCEFIELD_BASEFONTSIZE(doubleGlyphResolution),
+        QT_DISTANCEFIELD_SCALE(doubleGlyphResolution),
+        QT_DISTANCEFIELD_RADIUS(doubleGlyphResolution),
+        m_glyphCount,
+        font.weight(),
+        font.style(),
+        fontEngine->synthesized()
+    };
+    hash.addData(reinterpret_cast<const char *>(parameters), sizeof(parameters));
+
+    m_fileName = directory + QLatin1Char('/') + QString::fromLatin1(hash.result().toHex())
+            + QLatin1String(".qsgdf");
+    load();
+}
+
+QSGDistanceFieldDiskCache::~QSGDistanceFieldDiskCache()
+{
+    if (m_data)
+        m_file.unmap(m_data);
+}
+
+QString QSGDistanceFieldDiskCache::cacheDirectory()
+{
+    QString path = qEnvironmentVariable("QSG_DISTANCEFIELD_DISK_CACHE_PATH");
+    if (path.isEmpty()) {
+        path = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+        if (!path.isEmpty())
+            path += QLatin1String("/qtquick/distancefields");
+    }
+    return path;
+}
+
+void QSGDistanceFieldDiskCache::load()
+{
+    m_file.setFileName(m_fileName);
+    if (!m_file.open(QIODevice::ReadOnly))
+        return;
+
+    m_size = m_file.size();
+    if (m_size < qint64(sizeof(cacheMagic)))
+        return;
+    m_data = m_file.map(0, m_size);
+    if (!m_data)
+        return;
+    if (memcmp(m_data, cacheMagic, sizeof(cacheMagic)) != 0) {
+        m_file.unmap(m_data);
+        m_data = nullptr;
+        return;
+    }
+
+    qint64 offset = sizeof(cacheMagic);
+    while (offset + qint64(sizeof(GlyphRecord)) <= m_size) {
+        GlyphRecord record;
+        memcpy(&record, m_data + offset, sizeof(GlyphRecord));
+        const qint64 next = offset + sizeof(GlyphRecord) + qint64(record.width) * record.height;
+        if (int(record.glyph) >= m_glyphCount || next > m_size)
+            break;
+        m_offsets.insert(record.glyph, offset);
+        offset = next;
+    }
+}
+
+/*
+    Returns the cached distance field of \a glyph, or a null field if the
+    glyph has not been rendered before.
+*/
+QDistanceField QSGDistanceFieldDiskCache::glyph(glyph_t glyph) const
+{
+    QHash<glyph_t, qint64>::const_iterator it = m_offsets.constFind(glyph);
+    if (it == m_offsets.constEnd())
+        return QDistanceField();
+
+    GlyphRecord record;
+    memcpy(&record, m_data + it.value(), sizeof(GlyphRecord));
+    return QDistanceField(record.width, record.height, m_data + it.value() + sizeof(GlyphRecord), glyph);
+}
+
+/*
+    Appends the \a glyphs that aren't in the file yet. All of them are written
+    with a single unbuffered write, which keeps the records of processes that
+    render with the same font at the same time apart.
+*/
+void QSGDistanceFieldDiskCache::store(const QList<QDistanceField> &glyphs)
+{
+    if (m_fileName.isEmpty())
+        return;
+
+    QByteArray data;
+    for (const QDistanceField &field : glyphs) {
+        const glyph_t glyph = field.glyph();
+        if (field.isNull() || field.width() > 0xffff || field.height() > 0xffff
+                || m_offsets.contains(glyph) || m_stored.contains(glyph)) {
+            continue;
+        }
+        GlyphRecord record;
+        record.glyph = glyph;
+        record.width = field.width();
+        record.height = field.height();
+        data.append(reinterpret_cast<const char *>(&record), sizeof(GlyphRecord));
+        data.append(reinterpret_cast<const char *>(field.constBits()), field.width() * field.height());
+        m_stored.insert(glyph);
+    }
+    if (data.isEmpty())
+        return;
+
+    QFile file(m_fileName);
+    if (!file.exists())
+        QDir().mkpath(QFileInfo(m_fileName).path());
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Unbuffered))
+        return;
+    const qint64 size = file.size();
+    if (size == 0)
+        data.prepend(cacheMagic, sizeof(cacheMagic));
+    else if (size + data.size() > maxCacheFileSize)
+        return;
+    file.write(data);
+}
+
+QT_END_NAMESPACE
@@ -215,6 +215,16 @@ qreal QQuickAnimator::from() const
     return d->from;
 }
 
+void QQuickAnimatorPrivate::setJobFrom(QQuickAnimatorJob *job, const QVariant &value) const
+{
+    job->setFrom(value.toReal());
+}
+
+void QQuickAnimatorPrivate::setJobTo(QQuickAnimatorJob *job, const QVariant &value) const
+{
+    job->setTo(value.toReal());
+}
+
 void QQuickAnimatorPrivate::apply(QQuickAnimatorJob *job,
                                      const QString &propertyName,
                                      QQuickStateActions &actions,
@@ -232,18 +242,18 @@ void QQuickAnimatorPrivate::apply(QQuickAnimatorJob *job,
             job->setTarget(qobject_cast<QQuickItem *>(action.property.object()));
 
             if (isFromDefined)
-                job->setFrom(from);
+                setJobFrom(job, definedFrom());
             else if (action.fromValue.isValid())
-                job->setFrom(action.fromValue.toReal());
+                setJobFrom(job, action.fromValue);
             else
-                job->setFrom(action.property.read().toReal());
+                setJobFrom(job, action.property.read());
 
             if (isToDefined)
-                job->setTo(to);
+                setJobTo(job, definedTo());
             else if (action.toValue.isValid())
-                job->setTo(action.toValue.toReal());
+                setJobTo(job, action.toValue);
             else
-                job->setTo(action.property.read().toReal());
+                setJobTo(job, action.property.read());
 
             // This magic line is in sync with what PropertyAnimation does
             // and prevents the animation to end up in the "completeList"
@@ -255,8 +265,8 @@ void QQuickAnimatorPrivate::apply(QQuickAnimatorJob *job,
 
     if (modified.isEmpty()) {
         job->setTarget(target);
-        job->setFrom(from);
-        job->setTo(to);
+        setJobFrom(job, definedFrom());
+        setJobTo(job, definedTo());
     }
 
     if (!job->target()) {
@@ -504,6 +514,106 @@ QQuickRotationAnimator::RotationDirection QQuickRotationAnimator::direction() co
     return d->direction;
 }
 
+/*!
+    \qmltype ColorAnimator
+    \instantiates QQuickColorAnimator
+    \inqmlmodule QtQuick
+    \since 5.11
+    \ingroup qtquick-transitions-animations
+    \inherits Animator
+    \brief The ColorAnimator type animates the color of a Rectangle.
+
+    \l{Animator} types are different from normal Animation types. When
+    using an Animator, the animation can be run in the render thread
+    and the property value will jump to the end when the animation is
+    complete.
+
+    The value of Rectangle::color is updated after the animation has
+    finished. The animator has no effect on a Rectangle using a gradient.
+
+    \qml
+    Rectangle {
+        width: 100
+        height: 100
+        color: "red"
+        ColorAnimator on color {
+            to: "blue"
+            duration: 1000
+        }
+    }
+    \endqml
+
+    \sa ColorAnimation
+ */
+
+QQuickColorAnimator::QQuickColorAnimator(QObject *parent)
+    : QQuickAnimator(*new QQuickColorAnimatorPrivate, parent)
+{
+}
+
+/*!
+    \qmlproperty color QtQuick::ColorAnimator::from
+    This property holds the color the animation starts from.
+
+    If the ColorAnimator is defined within a \l Transition or \l Behavior,
+    this value defaults to the value defined in the starting state of the
+    \l Transition, or the current value of the property at the moment the
+    \l Behavior is triggered. Otherwise it defaults to the color of the
+    target when the animation starts.
+ */
+QColor QQuickColorAnimator::from() const
+{
+    Q_D(const QQuickColorAnimator);
+    return d->fromColor;
+}
+
+void QQuickColorAnimator::setFrom(const QColor &from)
+{
+    Q_D(QQuickColorAnimator);
+    if (from == d->fromColor)
+        return;
+    d->isFromDefined = true;
+    d->fromColor = from;
+    Q_EMIT fromChanged(d->fromColor);
+}
+
+/*!
+    \qmlproperty color QtQuick::ColorAnimator::to
+    This property holds the color the animation ends at.
+
+    If the ColorAnimator is defined within a \l Transition or \l Behavior,
+    this value defaults to the value defined in the end state of the
+    \l Transition, or the value of the property change that triggered the
+    \l Behavior.
+ */
+QColor QQuickColorAnimator::to() const
+{
+    Q_D(const QQuickColorAnimator);
+    return d->toColor;
+}
+
+void QQuickColorAnimator::setTo(const QColor &to)
+{
+    Q_D(QQuickColorAnimator);
+    if (to == d->toColor)
+        return;
+    d->isToDefined = true;
+    d->toColor = to;
+    Q_EMIT toChanged(d->toColor);
+}
+
+QQuickAnimatorJob *QQuickColorAnimator::createJob() const { return new QQuickColorAnimatorJob(); }
+
+void QQuickColorAnimatorPrivate::setJobFrom(QQuickAnimatorJob *job, const QVariant &value) const
+{
+    static_cast<QQuickColorAnimatorJob *>(job)->setFromColor(value.value<QColor>());
+}
+
+void QQuickColorAnimatorPrivate::setJobTo(QQuickAnimatorJob *job, const QVariant &value) const
+{
+    static_cast<QQuickColorAnimatorJob *>(job)->setToColor(value.value<QColor>());
+}
+
 #if QT_CONFIG(quick_shadereffect) && QT_CONFIG(opengl)
 /*!
     \qmltype UniformAnimator
@@ -170,6 +170,32 @@ protected:
     QString propertyName() const override { return QStringLiteral("rotation"); }
 };
 
+class QQuickColorAnimatorPrivate;
+class Q_QUICK_PRIVATE_EXPORT QQuickColorAnimator : public QQuickAnimator
+{
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QQuickColorAnimator)
+    Q_PROPERTY(QColor from READ from WRITE setFrom NOTIFY fromChanged)
+    Q_PROPERTY(QColor to READ to WRITE setTo NOTIFY toChanged)
+
+public:
+    QQuickColorAnimator(QObject *parent = 0);
+
+    QColor from() const;
+    void setFrom(const QColor &from);
+
+    QColor to() const;
+    void setTo(const QColor &to);
+
+Q_SIGNALS:
+    void fromChanged(const QColor &from);
+    void toChanged(const QColor &to);
+
+protected:
+    QQuickAnimatorJob *createJob() const override;
+    QString propertyName() const override { return QStringLiteral("color"); }
+};
+
 #if QT_CONFIG(quick_shadereffect) && QT_CONFIG(opengl)
 class QQuickUniformAnimatorPrivate;
 class Q_QUICK_PRIVATE_EXPORT QQuickUniformAnimator : public QQuickAnimator
@@ -201,6 +227,7 @@ QML_DECLARE_TYPE(QQuickYAnimator)
 QML_DECLARE_TYPE(QQuickScaleAnimator)
 QML_DECLARE_TYPE(QQuickRotationAnimator)
 QML_DECLARE_TYPE(QQuickOpacityAnimator)
+QML_DECLARE_TYPE(QQuickColorAnimator)
 #if QT_CONFIG(quick_shadereffect) && QT_CONFIG(opengl)
 QML_DECLARE_TYPE(QQuickUniformAnimator)
 #endif
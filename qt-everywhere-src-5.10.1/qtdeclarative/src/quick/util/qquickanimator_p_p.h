@@ -82,6 +82,13 @@ public:
     uint isFromDefined : 1;
     uint isToDefined : 1;
 
+    // Hands the resolved start and end values over to the job. Animators
+    // for non-numeric properties override these along with from and to.
+    virtual QVariant definedFrom() const { return from; }
+    virtual QVariant definedTo() const { return to; }
+    virtual void setJobFrom(QQuickAnimatorJob *job, const QVariant &value) const;
+    virtual void setJobTo(QQuickAnimatorJob *job, const QVariant &value) const;
+
     void apply(QQuickAnimatorJob *job, const QString &propertyName, QQuickStateActions &actions, QQmlProperties &modified, QObject *defaultTarget);
 };
 
@@ -101,6 +108,18 @@ public:
     QString uniform;
 };
 
+class QQuickColorAnimatorPrivate : public QQuickAnimatorPrivate
+{
+public:
+    QColor fromColor;
+    QColor toColor;
+
+    QVariant definedFrom() const override { return fromColor; }
+    QVariant definedTo() const override { return toColor; }
+    void setJobFrom(QQuickAnimatorJob *job, const QVariant &value) const override;
+    void setJobTo(QQuickAnimatorJob *job, const QVariant &value) const override;
+};
+
 QT_END_NAMESPACE
 
 #endif // QQUICKANIMATOR_P_P_H
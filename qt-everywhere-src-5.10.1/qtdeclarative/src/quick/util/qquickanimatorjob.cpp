@@ -44,6 +44,8 @@
 #include "qquickanimator_p_p.h"
 #include <private/qquickwindow_p.h>
 #include <private/qquickitem_p.h>
+#include <private/qquickrectangle_p.h>
+#include <private/qsgadaptationlayer_p.h>
 #if QT_CONFIG(quick_shadereffect) && QT_CONFIG(opengl)
 # include <private/qquickopenglshadereffectnode_p.h>
 # include <private/qquickopenglshadereffect_p.h>
@@ -609,6 +611,74 @@ void QQuickOpacityAnimatorJob::updateCurrentTime(int time)
 }
 
 
+QQuickColorAnimatorJob::QQuickColorAnimatorJob()
+    : m_node(nullptr)
+{
+    m_from = 0;
+    m_to = 1;
+}
+
+void QQuickColorAnimatorJob::setTarget(QQuickItem *target)
+{
+    if (qobject_cast<QQuickRectangle *>(target))
+        m_target = target;
+}
+
+void QQuickColorAnimatorJob::initialize(QQuickAnimatorController *controller)
+{
+    QQuickAnimatorJob::initialize(controller);
+    // Without a start color, start from where the target is now
+    if (!m_fromColor.isValid() && m_target)
+        m_fromColor = static_cast<QQuickRectangle *>(m_target.data())->color();
+}
+
+QColor QQuickColorAnimatorJob::colorAt(qreal t) const
+{
+    const QColor from = m_fromColor.toRgb();
+    const QColor to = m_toColor.toRgb();
+    return QColor::fromRgbF(from.redF() + (to.redF() - from.redF()) * t,
+                            from.greenF() + (to.greenF() - from.greenF()) * t,
+                            from.blueF() + (to.blueF() - from.blueF()) * t,
+                            from.alphaF() + (to.alphaF() - from.alphaF()) * t);
+}
+
+void QQuickColorAnimatorJob::postSync()
+{
+    if (!m_target) {
+        invalidate();
+        return;
+    }
+
+    // The rectangle's paint node was just synced with the color of the
+    // item, which is only written back when the animation is done.
+    m_node = static_cast<QSGInternalRectangleNode *>(QQuickItemPrivate::get(m_target)->paintNode);
+    if (m_node && isRunning()) {
+        m_node->setColor(colorAt(m_value));
+        m_node->update();
+    }
+}
+
+void QQuickColorAnimatorJob::invalidate()
+{
+    m_node = nullptr;
+}
+
+void QQuickColorAnimatorJob::updateCurrentTime(int time)
+{
+    if (!m_node)
+        return;
+
+    m_value = progress(time);
+    m_node->setColor(colorAt(m_value));
+    m_node->update();
+}
+
+void QQuickColorAnimatorJob::writeBack()
+{
+    if (m_target)
+        static_cast<QQuickRectangle *>(m_target.data())->setColor(colorAt(value()));
+}
+
 #if QT_CONFIG(quick_shadereffect) && QT_CONFIG(opengl)
 QQuickUniformAnimatorJob::QQuickUniformAnimatorJob()
     : m_node(nullptr)
@@ -72,6 +72,7 @@ class QQuickAnimatorProxyJobPrivate;
 class QQuickOpenGLShaderEffectNode;
 
 class QSGOpacityNode;
+class QSGInternalRectangleNode;
 
 class Q_QUICK_PRIVATE_EXPORT QQuickAnimatorProxyJob : public QObject, public QAbstractAnimationJob
 {
@@ -289,6 +290,33 @@ public:
 private:
     QSGOpacityNode *m_opacityNode;
 };
+class Q_QUICK_PRIVATE_EXPORT QQuickColorAnimatorJob : public QQuickAnimatorJob
+{
+public:
+    QQuickColorAnimatorJob();
+
+    void setTarget(QQuickItem *target) override;
+    void initialize(QQuickAnimatorController *controller) override;
+
+    // The numeric value of the job runs from 0 to 1 between these
+    void setFromColor(const QColor &color) { m_fromColor = color; }
+    QColor fromColor() const { return m_fromColor; }
+    void setToColor(const QColor &color) { m_toColor = color; }
+    QColor toColor() const { return m_toColor; }
+
+    void invalidate() override;
+    void updateCurrentTime(int time) override;
+    void writeBack() override;
+    void postSync() override;
+
+private:
+    QColor colorAt(qreal t) const;
+
+    QColor m_fromColor;
+    QColor m_toColor;
+    QSGInternalRectangleNode *m_node;
+};
+
 #if QT_CONFIG(opengl)
 class Q_QUICK_PRIVATE_EXPORT QQuickUniformAnimatorJob : public QQuickAnimatorJob
 {
@@ -46,10 +46,14 @@
 
 #include <QtGui/private/qguiapplication_p.h>
 #include <QtGui/private/qimage_p.h>
+#include <QtGui/private/qsharedimagecache_p.h>
 #include <qpa/qplatformintegration.h>
 
 #include <QtQuick/private/qsgtexture_p.h>
 #include <QtQuick/private/qsgtexturereader_p.h>
+#if QT_CONFIG(opengl)
+#include <QtQuick/private/qsgetcencoder_p.h>
+#endif
 
 #include <QQuickWindow>
 #include <QCoreApplication>
@@ -58,6 +62,8 @@
 #include <QPixmapCache>
 #include <QFile>
 #include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
 #include <QMutex>
 #include <QMutexLocker>
 #include <QWaitCondition>
@@ -67,6 +73,11 @@
 #include <private/qobject_p.h>
 #include <QQmlFile>
 #include <QMetaMethod>
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QSaveFile>
+#include <QStandardPaths>
 
 #if QT_CONFIG(qml_network)
 #include <qqmlnetworkaccessmanagerfactory.h>
@@ -142,6 +153,7 @@ public:
     QUrl url;
 
     bool loading;
+    bool lowPriority; // only accessed inside the reader's mutex
     QQuickImageProviderOptions providerOptions;
     int redirectCount;
 
@@ -194,8 +206,9 @@ public:
     QQuickPixmapReader(QQmlEngine *eng);
     ~QQuickPixmapReader();
 
-    QQuickPixmapReply *getImage(QQuickPixmapData *);
+    QQuickPixmapReply *getImage(QQuickPixmapData *, bool lowPriority);
     void cancel(QQuickPixmapReply *rep);
+    void setLowPriority(QQuickPixmapReply *rep, bool lowPriority);
 
     static QQuickPixmapReader *instance(QQmlEngine *engine);
     static QQuickPixmapReader *existingInstance(QQmlEngine *engine);
@@ -205,12 +218,16 @@ protected:
 
 private:
     friend class QQuickPixmapReaderThreadObject;
+    friend class QQuickPixmapDecoder;
     void processJobs();
     void processJob(QQuickPixmapReply *, const QUrl &, const QString &, QQuickImageProvider::ImageType, QQuickImageProvider *);
 #if QT_CONFIG(qml_network)
     void networkRequestDone(QNetworkReply *);
 #endif
     void asyncResponseFinished(QQuickImageResponse *);
+    void startDecoding(QQuickPixmapReply *, const QUrl &, const QString &, const QByteArray &);
+    void decode(QQuickPixmapReply *, const QUrl &, const QString &, QByteArray,
+                const QSize &, const QQuickImageProviderOptions &);
 
     QList<QQuickPixmapReply*> jobs;
     QList<QQuickPixmapReply*> cancelled;
@@ -228,6 +245,13 @@ private:
 #endif
     QHash<QQuickImageResponse*,QQuickPixmapReply*> asyncResponses;
 
+    // Replies being decoded by the pool; the value is true once the reply
+    // was cancelled and has to be deleted by the decoder.
+    QHash<QQuickPixmapReply*,bool> decodingJobs;
+    QThreadPool decoders;
+    int maxDecodingJobs;
+    bool shuttingDown;
+
     static int replyDownloadProgress;
     static int replyFinished;
     static int downloadProgress;
@@ -237,6 +261,31 @@ public:
     static QMutex readerMutex;
 };
 
+class QQuickPixmapDecoder : public QRunnable
+{
+public:
+    QQuickPixmapDecoder(QQuickPixmapReader *reader, QQuickPixmapReply *job, const QUrl &url,
+                        const QString &localFile, const QByteArray &data)
+        : reader(reader), job(job), url(url), localFile(localFile), data(data),
+          requestSize(job->requestSize), providerOptions(job->providerOptions)
+    {
+    }
+
+    void run() override
+    {
+        reader->decode(job, url, localFile, data, requestSize, providerOptions);
+    }
+
+private:
+    QQuickPixmapReader *reader;
+    QQuickPixmapReply *job;
+    QUrl url;
+    QString localFile;
+    QByteArray data;
+    QSize requestSize;
+    QQuickImageProviderOptions providerOptions;
+};
+
 class QQuickPixmapData
 {
 public:
@@ -414,12 +463,141 @@ static bool readImage(const QUrl& url, QIODevice *dev, QImage *image, QString *e
     }
 }
 
+/*
+    Local images that are loaded at their original size are shared with other
+    users of the QSharedImageCache, such as QIcon, and can be found there when
+    the pixmap cache already dropped them. Returns an empty key for images that
+    cannot be shared.
+*/
+static QString sharedImageKey(const QString &localFile, const QSize &requestSize,
+                              const QQuickImageProviderOptions &providerOptions)
+{
+    if (requestSize.width() > 0 || requestSize.height() > 0
+            || providerOptions.autoTransform() != QQuickImageProviderOptions::UsePluginDefaultTransform
+            || providerOptions.preserveAspectRatioCrop() || providerOptions.preserveAspectRatioFit()) {
+        return QString();
+    }
+    return QSharedImageCache::fileKey(QFileInfo(localFile));
+}
+
+static bool readLocalImage(const QUrl &url, const QString &localFile, QIODevice *dev, QImage *image,
+                           QString *errorString, QSize *impsize, const QSize &requestSize,
+                           const QQuickImageProviderOptions &providerOptions,
+                           QQuickImageProviderOptions::AutoTransform *appliedTransform = nullptr)
+{
+    const QString key = sharedImageKey(localFile, requestSize, providerOptions);
+    if (!key.isEmpty() && QSharedImageCache::find(key, image)) {
+        if (impsize)
+            *impsize = image->size();
+        if (appliedTransform) {
+            QImageReader imgio(dev);
+            *appliedTransform = imgio.autoTransform() ? QQuickImageProviderOptions::ApplyTransform : QQuickImageProviderOptions::DoNotApplyTransform;
+        }
+        return true;
+    }
+    if (!readImage(url, dev, image, errorString, impsize, requestSize, providerOptions, appliedTransform))
+        return false;
+    if (!key.isEmpty())
+        QSharedImageCache::insert(key, *image, QSharedImageCache::QuickCategory);
+    return true;
+}
+
+#if QT_CONFIG(opengl)
+/*
+    Opaque local images can be transcoded to ETC compressed textures on the
+    reader thread by setting QML_PIXMAP_TRANSCODE to "etc". The compressed data
+    is stored as PKM file in QML_PIXMAP_TRANSCODE_CACHE_PATH, or the "qtquick"
+    directory in the application's cache location, so that every image is only
+    encoded once. This needs OpenGL ES 3, OpenGL 4.3, or an implementation of
+    GL_OES_compressed_ETC1_RGB8_texture.
+*/
+static const int transcodeMinimumPixels = 128 * 128;
+
+static bool isTranscodingEnabled()
+{
+    static const bool enabled = qgetenv("QML_PIXMAP_TRANSCODE") == "etc";
+    return enabled;
+}
+
+static QString transcodedImagePath(const QFile &file, const QSize &requestSize,
+                                   const QQuickImageProviderOptions &providerOptions)
+{
+    static const QString cacheDirectory = [] {
+        QString path = qEnvironmentVariable("QML_PIXMAP_TRANSCODE_CACHE_PATH");
+        if (path.isEmpty()) {
+            path = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+            if (!path.isEmpty())
+                path += QLatin1String("/qtquick");
+        }
+        return path;
+    }();
+    if (cacheDirectory.isEmpty())
+        return QString();
+
+    const QFileInfo info(file);
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(info.absoluteFilePath().toUtf8());
+    hash.addData(QByteArray::number(info.lastModified().toMSecsSinceEpoch()));
+    hash.addData(QByteArray::number(info.size()));
+    hash.addData(QByteArray::number(requestSize.width()) + 'x' + QByteArray::number(requestSize.height()));
+    hash.addData(QByteArray::number(providerOptions.autoTransform()));
+    hash.addData(QByteArray::number(providerOptions.preserveAspectRatioCrop()));
+    hash.addData(QByteArray::number(providerOptions.preserveAspectRatioFit()));
+    return cacheDirectory + QLatin1Char('/') + QString::fromLatin1(hash.result().toHex()) + QLatin1String(".pkm");
+}
+
+static QQuickTextureFactory *readTranscodedImage(const QString &path, QFile *source, QSize *readSize)
+{
+    QFile cached(path);
+    if (!cached.open(QIODevice::ReadOnly))
+        return nullptr;
+    QQuickTextureFactory *factory = QSGTextureReader::read(&cached, QByteArrayLiteral("pkm"));
+    if (factory) {
+        // Report the implicit size like readImage() does
+        *readSize = QImageReader(source).size();
+        if (!readSize->isValid())
+            *readSize = factory->textureSize();
+    }
+    return factory;
+}
+
+static QQuickTextureFactory *transcodeImage(const QImage &image, const QString &path)
+{
+    if (image.hasAlphaChannel() || image.width() * image.height() < transcodeMinimumPixels)
+        return nullptr;
+    QByteArray data = QSGEtcEncoder::encodePkm(image);
+    if (data.isEmpty())
+        return nullptr;
+
+    QDir().mkpath(QFileInfo(path).path());
+    QSaveFile file(path);
+    if (file.open(QIODevice::WriteOnly) && file.write(data) == data.size())
+        file.commit();
+
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::ReadOnly);
+    return QSGTextureReader::read(&buffer, QByteArrayLiteral("pkm"));
+}
+#endif
+
+static int decoderThreadCount()
+{
+    bool ok = false;
+    const int count = qEnvironmentVariableIntValue("QML_PIXMAP_READER_THREADS", &ok);
+    if (ok && count > 0)
+        return count;
+    return qBound(1, QThread::idealThreadCount(), 4);
+}
+
 QQuickPixmapReader::QQuickPixmapReader(QQmlEngine *eng)
 : QThread(eng), engine(eng), threadObject(0)
 #if QT_CONFIG(qml_network)
 , accessManager(0)
 #endif
+, maxDecodingJobs(decoderThreadCount()), shuttingDown(false)
 {
+    decoders.setMaxThreadCount(maxDecodingJobs);
+
     eventLoopQuitHack = new QObject;
     eventLoopQuitHack->moveToThread(this);
     connect(eventLoopQuitHack, SIGNAL(destroyed(QObject*)), SLOT(quit()), Qt::DirectConnection);
@@ -432,6 +610,12 @@ QQuickPixmapReader::~QQuickPixmapReader()
     readers.remove(engine);
     readerMutex.unlock();
 
+    // Let the running decoders finish, the queued ones give up right away
+    mutex.lock();
+    shuttingDown = true;
+    mutex.unlock();
+    decoders.waitForDone();
+
     mutex.lock();
     // manually cancel all outstanding jobs.
     for (QQuickPixmapReply *reply : qAsConst(jobs)) {
@@ -487,25 +671,16 @@ void QQuickPixmapReader::networkRequestDone(QNetworkReply *reply)
             }
         }
 
-        QImage image;
-        QQuickPixmapReply::ReadError error = QQuickPixmapReply::NoError;
-        QString errorString;
-        QSize readSize;
         if (reply->error()) {
-            error = QQuickPixmapReply::Loading;
-            errorString = reply->errorString();
+            // send completion event to the QQuickPixmapReply
+            mutex.lock();
+            if (!cancelled.contains(job))
+                job->postReply(QQuickPixmapReply::Loading, reply->errorString(), QSize(), 0);
+            mutex.unlock();
         } else {
-            QByteArray all = reply->readAll();
-            QBuffer buff(&all);
-            buff.open(QIODevice::ReadOnly);
-            if (!readImage(reply->url(), &buff, &image, &errorString, &readSize, job->requestSize, job->providerOptions))
-                error = QQuickPixmapReply::Decoding;
-       }
-        // send completion event to the QQuickPixmapReply
-        mutex.lock();
-        if (!cancelled.contains(job))
-            job->postReply(error, errorString, readSize, QQuickTextureFactory::textureFactoryForImage(image));
-        mutex.unlock();
+            // Decode in the pool, so that the downloads aren't held up
+            startDecoding(job, reply->url(), QString(), reply->readAll());
+        }
     }
     reply->deleteLater();
 
@@ -603,6 +778,12 @@ void QQuickPixmapReader::processJobs()
                     }
                 }
                 PIXMAP_PROFILE(pixmapStateChanged<QQuickProfiler::PixmapLoadingError>(job->url));
+                QHash<QQuickPixmapReply*,bool>::iterator decoding = decodingJobs.find(job);
+                if (decoding != decodingJobs.end()) {
+                    // Still used by its decoder, which deletes it when done
+                    decoding.value() = true;
+                    continue;
+                }
                 // deleteLater, since not owned by this thread
                 job->deleteLater();
             }
@@ -611,41 +792,48 @@ void QQuickPixmapReader::processJobs()
         }
 
         if (!jobs.isEmpty()) {
-            // Find a job we can use
+            // Find a job we can use, the most recent normal priority one first
             bool usableJob = false;
-            for (int i = jobs.count() - 1; !usableJob && i >= 0; i--) {
-                QQuickPixmapReply *job = jobs.at(i);
-                const QUrl url = job->url;
-                QString localFile;
-                QQuickImageProvider::ImageType imageType = QQuickImageProvider::Invalid;
-                QQuickImageProvider *provider = 0;
-
-                if (url.scheme() == QLatin1String("image")) {
-                    provider = static_cast<QQuickImageProvider *>(engine->imageProvider(imageProviderId(url)));
-                    if (provider)
-                        imageType = provider->imageType();
-
-                    usableJob = true;
-                } else {
-                    localFile = QQmlFile::urlToLocalFileOrQrc(url);
-                    usableJob = !localFile.isEmpty()
-#if QT_CONFIG(qml_network)
-                            || networkJobs.count() < IMAGEREQUEST_MAX_NETWORK_REQUEST_COUNT
-#endif
-                            ;
-                }
+            for (int pass = 0; !usableJob && pass < 2; ++pass) {
+                for (int i = jobs.count() - 1; !usableJob && i >= 0; i--) {
+                    QQuickPixmapReply *job = jobs.at(i);
+                    if (job->lowPriority != (pass == 1))
+                        continue;
+                    const QUrl url = job->url;
+                    QString localFile;
+                    QQuickImageProvider::ImageType imageType = QQuickImageProvider::Invalid;
+                    QQuickImageProvider *provider = 0;
+
+                    if (url.scheme() == QLatin1String("image")) {
+                        provider = static_cast<QQuickImageProvider *>(engine->imageProvider(imageProviderId(url)));
+                        if (provider)
+                            imageType = provider->imageType();
+
+                        usableJob = true;
+                    } else {
+                        localFile = QQmlFile::urlToLocalFileOrQrc(url);
+                        // Local files are only started when a decoder is free, so
+                        // that the job priorities still apply to the waiting ones
+                        if (!localFile.isEmpty())
+                            usableJob = decodingJobs.count() < maxDecodingJobs;
+    #if QT_CONFIG(qml_network)
+                        else
+                            usableJob = networkJobs.count() < IMAGEREQUEST_MAX_NETWORK_REQUEST_COUNT;
+    #endif
+                    }
 
 
-                if (usableJob) {
-                    jobs.removeAt(i);
+                    if (usableJob) {
+                        jobs.removeAt(i);
 
-                    job->loading = true;
+                        job->loading = true;
 
-                    PIXMAP_PROFILE(pixmapStateChanged<QQuickProfiler::PixmapLoadingStarted>(url));
+                        PIXMAP_PROFILE(pixmapStateChanged<QQuickProfiler::PixmapLoadingStarted>(url));
 
-                    locker.unlock();
-                    processJob(job, url, localFile, imageType, provider);
-                    locker.relock();
+                        locker.unlock();
+                        processJob(job, url, localFile, imageType, provider);
+                        locker.relock();
+                    }
                 }
             }
 
@@ -765,41 +953,8 @@ void QQuickPixmapReader::processJob(QQuickPixmapReply *runningJob, const QUrl &u
 
     } else {
         if (!localFile.isEmpty()) {
-            // Image is local - load/decode immediately
-            QImage image;
-            QQuickPixmapReply::ReadError errorCode = QQuickPixmapReply::NoError;
-            QString errorStr;
-            QFile f(localFile);
-            QSize readSize;
-            if (f.open(QIODevice::ReadOnly)) {
-
-                // for now, purely use suffix information to determine whether we are working with a compressed texture
-                QByteArray suffix = QFileInfo(f).suffix().toLower().toLatin1();
-                if (QSGTextureReader::isTexture(&f, suffix)) {
-                    QQuickTextureFactory *factory = QSGTextureReader::read(&f, suffix);
-                    if (factory) {
-                        readSize = factory->textureSize();
-                    } else {
-                        errorStr = QQuickPixmap::tr("Error decoding: %1").arg(url.toString());
-                        errorCode = QQuickPixmapReply::Decoding;
-                    }
-                    mutex.lock();
-                    if (!cancelled.contains(runningJob))
-                        runningJob->postReply(errorCode, errorStr, readSize, factory);
-                    mutex.unlock();
-                    return;
-                } else {
-                    if (!readImage(url, &f, &image, &errorStr, &readSize, runningJob->requestSize, runningJob->providerOptions))
-                        errorCode = QQuickPixmapReply::Loading;
-                }
-            } else {
-                errorStr = QQuickPixmap::tr("Cannot open: %1").arg(url.toString());
-                errorCode = QQuickPixmapReply::Loading;
-            }
-            mutex.lock();
-            if (!cancelled.contains(runningJob))
-                runningJob->postReply(errorCode, errorStr, readSize, QQuickTextureFactory::textureFactoryForImage(image));
-            mutex.unlock();
+            // Image is local - load/decode in the pool
+            startDecoding(runningJob, url, localFile, QByteArray());
         } else {
 #if QT_CONFIG(qml_network)
             // Network resource
@@ -818,6 +973,101 @@ void QQuickPixmapReader::processJob(QQuickPixmapReply *runningJob, const QUrl &u
     }
 }
 
+void QQuickPixmapReader::startDecoding(QQuickPixmapReply *job, const QUrl &url, const QString &localFile,
+                                       const QByteArray &data)
+{
+    mutex.lock();
+    if (shuttingDown) {
+        if (!cancelled.contains(job))
+            job->postReply(QQuickPixmapReply::Loading, QString(), QSize(), 0);
+        mutex.unlock();
+        return;
+    }
+    decodingJobs.insert(job, false);
+    mutex.unlock();
+    decoders.start(new QQuickPixmapDecoder(this, job, url, localFile, data));
+}
+
+// Called in a decoder thread; reads the local file, or the downloaded data if
+// there is no file.
+void QQuickPixmapReader::decode(QQuickPixmapReply *job, const QUrl &url, const QString &localFile,
+                                QByteArray data, const QSize &requestSize,
+                                const QQuickImageProviderOptions &providerOptions)
+{
+    mutex.lock();
+    // Don't bother decoding images nobody waits for anymore
+    const bool skip = shuttingDown || decodingJobs.value(job) || cancelled.contains(job);
+    mutex.unlock();
+
+    QImage image;
+    QQuickTextureFactory *factory = nullptr;
+    QQuickPixmapReply::ReadError errorCode = QQuickPixmapReply::NoError;
+    QString errorStr;
+    QSize readSize;
+    if (skip) {
+        errorCode = QQuickPixmapReply::Loading;
+    } else if (!localFile.isEmpty()) {
+        QFile f(localFile);
+        if (f.open(QIODevice::ReadOnly)) {
+
+            // for now, purely use suffix information to determine whether we are working with a compressed texture
+            QByteArray suffix = QFileInfo(f).suffix().toLower().toLatin1();
+            if (QSGTextureReader::isTexture(&f, suffix)) {
+                factory = QSGTextureReader::read(&f, suffix);
+                if (factory) {
+                    readSize = factory->textureSize();
+                } else {
+                    errorStr = QQuickPixmap::tr("Error decoding: %1").arg(url.toString());
+                    errorCode = QQuickPixmapReply::Decoding;
+                }
+            } else {
+                QString transcodedPath;
+#if QT_CONFIG(opengl)
+                if (isTranscodingEnabled()) {
+                    transcodedPath = transcodedImagePath(f, requestSize, providerOptions);
+                    if (!transcodedPath.isEmpty())
+                        factory = readTranscodedImage(transcodedPath, &f, &readSize);
+                }
+#endif
+                if (factory) {
+                    // Already encoded before, no need to decode the image
+                } else if (!readLocalImage(url, localFile, &f, &image, &errorStr, &readSize, requestSize, providerOptions)) {
+                    errorCode = QQuickPixmapReply::Loading;
+#if QT_CONFIG(opengl)
+                } else if (!transcodedPath.isEmpty()) {
+                    factory = transcodeImage(image, transcodedPath);
+#endif
+                }
+                if (!factory)
+                    factory = QQuickTextureFactory::textureFactoryForImage(image);
+            }
+        } else {
+            errorStr = QQuickPixmap::tr("Cannot open: %1").arg(url.toString());
+            errorCode = QQuickPixmapReply::Loading;
+        }
+    } else {
+        QBuffer buff(&data);
+        buff.open(QIODevice::ReadOnly);
+        if (!readImage(url, &buff, &image, &errorStr, &readSize, requestSize, providerOptions))
+            errorCode = QQuickPixmapReply::Decoding;
+        factory = QQuickTextureFactory::textureFactoryForImage(image);
+    }
+
+    mutex.lock();
+    if (decodingJobs.take(job)) {
+        // cancelled and already forgotten by processJobs()
+        delete factory;
+        job->deleteLater();
+    } else if (!cancelled.contains(job)) {
+        job->postReply(errorCode, errorStr, readSize, factory);
+    } else {
+        delete factory;
+    }
+    // kick off event loop again, a decoder is free now
+    if (threadObject) threadObject->processJobs();
+    mutex.unlock();
+}
+
 QQuickPixmapReader *QQuickPixmapReader::instance(QQmlEngine *engine)
 {
     // XXX NOTE: must be called within readerMutex locking.
@@ -836,11 +1086,12 @@ QQuickPixmapReader *QQuickPixmapReader::existingInstance(QQmlEngine *engine)
     return readers.value(engine, 0);
 }
 
-QQuickPixmapReply *QQuickPixmapReader::getImage(QQuickPixmapData *data)
+QQuickPixmapReply *QQuickPixmapReader::getImage(QQuickPixmapData *data, bool lowPriority)
 {
     mutex.lock();
     QQuickPixmapReply *reply = new QQuickPixmapReply(data);
     reply->engineForReader = engine;
+    reply->lowPriority = lowPriority;
     jobs.append(reply);
     // XXX
     if (threadObject) threadObject->processJobs();
@@ -867,6 +1118,14 @@ void QQuickPixmapReader::cancel(QQuickPixmapReply *reply)
     mutex.unlock();
 }
 
+void QQuickPixmapReader::setLowPriority(QQuickPixmapReply *reply, bool lowPriority)
+{
+    // Only matters for jobs which are still waiting
+    mutex.lock();
+    reply->lowPriority = lowPriority;
+    mutex.unlock();
+}
+
 void QQuickPixmapReader::run()
 {
     if (replyDownloadProgress == -1) {
@@ -1071,7 +1330,7 @@ void QQuickPixmap::purgeCache()
 }
 
 QQuickPixmapReply::QQuickPixmapReply(QQuickPixmapData *d)
-: data(d), engineForReader(0), requestSize(d->requestSize), url(d->url), loading(false), providerOptions(d->providerOptions), redirectCount(0)
+: data(d), engineForReader(0), requestSize(d->requestSize), url(d->url), loading(false), lowPriority(false), providerOptions(d->providerOptions), redirectCount(0)
 {
     if (finishedIndex == -1) {
         finishedIndex = QMetaMethod::fromSignal(&QQuickPixmapReply::finished).methodIndex();
@@ -1265,7 +1524,7 @@ static QQuickPixmapData* createPixmapDataSync(QQuickPixmap *declarativePixmap, Q
         } else {
             QImage image;
             QQuickImageProviderOptions::AutoTransform appliedTransform = providerOptions.autoTransform();
-            if (readImage(url, &f, &image, &errorString, &readSize, requestSize, providerOptions, &appliedTransform)) {
+            if (readLocalImage(url, localFile, &f, &image, &errorString, &readSize, requestSize, providerOptions, &appliedTransform)) {
                 *ok = true;
                 return new QQuickPixmapData(declarativePixmap, url, QQuickTextureFactory::textureFactoryForImage(image), readSize, requestSize, providerOptions, appliedTransform);
             }
@@ -1524,15 +1783,35 @@ void QQuickPixmap::load(QQmlEngine *engine, const QUrl &url, const QSize &reques
             d->addToCache();
 
         QQuickPixmapReader::readerMutex.lock();
-        d->reply = QQuickPixmapReader::instance(engine)->getImage(d);
+        d->reply = QQuickPixmapReader::instance(engine)->getImage(d, options & QQuickPixmap::LowPriority);
         QQuickPixmapReader::readerMutex.unlock();
     } else {
         d = *iter;
         d->addref();
         d->declarativePixmaps.insert(this);
+        if (!(options & QQuickPixmap::LowPriority))
+            setLowPriority(false);
     }
 }
 
+/*!
+    \internal
+    \since 5.11
+
+    Changes the priority of the pending request for this pixmap. Requests
+    with low priority are only started when no other request is waiting,
+    which lets visible items load before prefetched ones.
+*/
+void QQuickPixmap::setLowPriority(bool lowPriority)
+{
+    if (!d || !d->reply)
+        return;
+
+    QMutexLocker locker(&QQuickPixmapReader::readerMutex);
+    if (QQuickPixmapReader *reader = QQuickPixmapReader::existingInstance(d->reply->engineForReader))
+        reader->setLowPriority(d->reply, lowPriority);
+}
+
 void QQuickPixmap::clear()
 {
     if (d) {
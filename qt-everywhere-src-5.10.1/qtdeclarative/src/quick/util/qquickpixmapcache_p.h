@@ -135,7 +135,8 @@ public:
 
     enum Option {
         Asynchronous = 0x00000001,
-        Cache        = 0x00000002
+        Cache        = 0x00000002,
+        LowPriority  = 0x00000004
     };
     Q_DECLARE_FLAGS(Options, Option)
 
@@ -165,6 +166,7 @@ public:
     void load(QQmlEngine *, const QUrl &, const QSize &);
     void load(QQmlEngine *, const QUrl &, const QSize &, QQuickPixmap::Options options);
     void load(QQmlEngine *, const QUrl &, const QSize &, QQuickPixmap::Options options, const QQuickImageProviderOptions &providerOptions);
+    void setLowPriority(bool lowPriority);
 
     void clear();
     void clear(QObject *);
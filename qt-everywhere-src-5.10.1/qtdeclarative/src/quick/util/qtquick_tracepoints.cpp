@@ -0,0 +1,74 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+// Instantiates the tracepoints declared in qtquick_tracepoints_p.h, see qtrace_p.h.
+
+#include <QtCore/private/qtrace_p.h>
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED) && defined(QT_TRACE_BACKEND_LTTNG)
+#  define TRACEPOINT_CREATE_PROBES
+#  define TRACEPOINT_DEFINE
+#endif
+
+#include "qtquick_tracepoints_p.h"
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED) && defined(QT_TRACE_BACKEND_ETW)
+
+// The provider GUID is derived from the provider name the way EventSource
+// does it, so that tools can also enable the provider by name.
+TRACELOGGING_DEFINE_PROVIDER(qtquick_provider, "QtQuick",
+    (0x63ac670f, 0xa259, 0x5eec, 0x57, 0xf5, 0x24, 0x9e, 0xde, 0xaf, 0x59, 0xa6));
+
+QT_BEGIN_NAMESPACE
+
+static void qt_qtquick_register_trace_provider()
+{
+    TraceLoggingRegister(qtquick_provider);
+}
+Q_CONSTRUCTOR_FUNCTION(qt_qtquick_register_trace_provider)
+
+static void qt_qtquick_unregister_trace_provider()
+{
+    TraceLoggingUnregister(qtquick_provider);
+}
+Q_DESTRUCTOR_FUNCTION(qt_qtquick_unregister_trace_provider)
+
+QT_END_NAMESPACE
+
+#endif // Q_TRACEPOINT && QT_TRACE_BACKEND_ETW
@@ -0,0 +1,339 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtQuick module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+// Tracepoints of the QtQuick module, see qtrace_p.h. With the LTTng backend this
+// header is read several times by <lttng/tracepoint-event.h>, which is why
+// the event definitions are not covered by the include guard.
+
+#include <QtCore/private/qtrace_p.h>
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED) && defined(QT_TRACE_BACKEND_LTTNG)
+
+#undef TRACEPOINT_PROVIDER
+#define TRACEPOINT_PROVIDER qtquick
+
+#undef TRACEPOINT_INCLUDE
+#define TRACEPOINT_INCLUDE <QtQuick/private/qtquick_tracepoints_p.h>
+
+#if !defined(QTQUICK_TRACEPOINTS_P_H_LTTNG) || defined(TRACEPOINT_HEADER_MULTI_READ)
+#define QTQUICK_TRACEPOINTS_P_H_LTTNG
+
+#include <lttng/tracepoint.h>
+
+TRACEPOINT_EVENT(qtquick, QSGRenderLoop_sync_entry,
+    TP_ARGS(const void *, window),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, window, reinterpret_cast<quintptr>(window))
+    )
+)
+
+TRACEPOINT_EVENT(qtquick, QSGRenderLoop_sync_exit,
+    TP_ARGS(const void *, window),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, window, reinterpret_cast<quintptr>(window))
+    )
+)
+
+TRACEPOINT_EVENT(qtquick, QSGRenderLoop_render_entry,
+    TP_ARGS(const void *, window),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, window, reinterpret_cast<quintptr>(window))
+    )
+)
+
+TRACEPOINT_EVENT(qtquick, QSGRenderLoop_render_exit,
+    TP_ARGS(const void *, window),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, window, reinterpret_cast<quintptr>(window))
+    )
+)
+
+TRACEPOINT_EVENT(qtquick, QSGRenderLoop_swap_entry,
+    TP_ARGS(const void *, window),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, window, reinterpret_cast<quintptr>(window))
+    )
+)
+
+TRACEPOINT_EVENT(qtquick, QSGRenderLoop_swap_exit,
+    TP_ARGS(const void *, window),
+    TP_FIELDS(
+        ctf_integer_hex(quintptr, window, reinterpret_cast<quintptr>(window))
+    )
+)
+
+#endif // !QTQUICK_TRACEPOINTS_P_H_LTTNG || TRACEPOINT_HEADER_MULTI_READ
+
+#include <lttng/tracepoint-event.h>
+
+#endif // Q_TRACEPOINT && QT_TRACE_BACKEND_LTTNG
+
+#if !defined(QTQUICK_TRACEPOINTS_P_H) && !defined(TRACEPOINT_HEADER_MULTI_READ)
+#define QTQUICK_TRACEPOINTS_P_H
+
+#if defined(Q_TRACEPOINT) && !defined(QT_BOOTSTRAPPED)
+
+#if defined(QT_TRACE_BACKEND_ETW)
+#include <QtCore/qt_windows.h>
+#include <TraceLoggingProvider.h>
+
+TRACELOGGING_DECLARE_PROVIDER(qtquick_provider);
+#endif
+
+QT_BEGIN_NAMESPACE
+
+class QQuickWindow;
+
+namespace QtPrivate {
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QSGRenderLoop_sync_entry(QQuickWindow *window)
+{
+    tracepoint(qtquick, QSGRenderLoop_sync_entry, window);
+}
+
+inline void do_trace_QSGRenderLoop_sync_entry(QQuickWindow *window)
+{
+    do_tracepoint(qtquick, QSGRenderLoop_sync_entry, window);
+}
+
+inline bool trace_QSGRenderLoop_sync_entry_enabled()
+{
+    return tracepoint_enabled(qtquick, QSGRenderLoop_sync_entry);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QSGRenderLoop_sync_entry(QQuickWindow *window)
+{
+    TraceLoggingWrite(qtquick_provider, "QSGRenderLoop_sync_entry",
+                      TraceLoggingPointer(window, "window"));
+}
+
+inline void do_trace_QSGRenderLoop_sync_entry(QQuickWindow *window)
+{
+    trace_QSGRenderLoop_sync_entry(window);
+}
+
+inline bool trace_QSGRenderLoop_sync_entry_enabled()
+{
+    return TraceLoggingProviderEnabled(qtquick_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QSGRenderLoop_sync_exit(QQuickWindow *window)
+{
+    tracepoint(qtquick, QSGRenderLoop_sync_exit, window);
+}
+
+inline void do_trace_QSGRenderLoop_sync_exit(QQuickWindow *window)
+{
+    do_tracepoint(qtquick, QSGRenderLoop_sync_exit, window);
+}
+
+inline bool trace_QSGRenderLoop_sync_exit_enabled()
+{
+    return tracepoint_enabled(qtquick, QSGRenderLoop_sync_exit);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QSGRenderLoop_sync_exit(QQuickWindow *window)
+{
+    TraceLoggingWrite(qtquick_provider, "QSGRenderLoop_sync_exit",
+                      TraceLoggingPointer(window, "window"));
+}
+
+inline void do_trace_QSGRenderLoop_sync_exit(QQuickWindow *window)
+{
+    trace_QSGRenderLoop_sync_exit(window);
+}
+
+inline bool trace_QSGRenderLoop_sync_exit_enabled()
+{
+    return TraceLoggingProviderEnabled(qtquick_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QSGRenderLoop_render_entry(QQuickWindow *window)
+{
+    tracepoint(qtquick, QSGRenderLoop_render_entry, window);
+}
+
+inline void do_trace_QSGRenderLoop_render_entry(QQuickWindow *window)
+{
+    do_tracepoint(qtquick, QSGRenderLoop_render_entry, window);
+}
+
+inline bool trace_QSGRenderLoop_render_entry_enabled()
+{
+    return tracepoint_enabled(qtquick, QSGRenderLoop_render_entry);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QSGRenderLoop_render_entry(QQuickWindow *window)
+{
+    TraceLoggingWrite(qtquick_provider, "QSGRenderLoop_render_entry",
+                      TraceLoggingPointer(window, "window"));
+}
+
+inline void do_trace_QSGRenderLoop_render_entry(QQuickWindow *window)
+{
+    trace_QSGRenderLoop_render_entry(window);
+}
+
+inline bool trace_QSGRenderLoop_render_entry_enabled()
+{
+    return TraceLoggingProviderEnabled(qtquick_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QSGRenderLoop_render_exit(QQuickWindow *window)
+{
+    tracepoint(qtquick, QSGRenderLoop_render_exit, window);
+}
+
+inline void do_trace_QSGRenderLoop_render_exit(QQuickWindow *window)
+{
+    do_tracepoint(qtquick, QSGRenderLoop_render_exit, window);
+}
+
+inline bool trace_QSGRenderLoop_render_exit_enabled()
+{
+    return tracepoint_enabled(qtquick, QSGRenderLoop_render_exit);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QSGRenderLoop_render_exit(QQuickWindow *window)
+{
+    TraceLoggingWrite(qtquick_provider, "QSGRenderLoop_render_exit",
+                      TraceLoggingPointer(window, "window"));
+}
+
+inline void do_trace_QSGRenderLoop_render_exit(QQuickWindow *window)
+{
+    trace_QSGRenderLoop_render_exit(window);
+}
+
+inline bool trace_QSGRenderLoop_render_exit_enabled()
+{
+    return TraceLoggingProviderEnabled(qtquick_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QSGRenderLoop_swap_entry(QQuickWindow *window)
+{
+    tracepoint(qtquick, QSGRenderLoop_swap_entry, window);
+}
+
+inline void do_trace_QSGRenderLoop_swap_entry(QQuickWindow *window)
+{
+    do_tracepoint(qtquick, QSGRenderLoop_swap_entry, window);
+}
+
+inline bool trace_QSGRenderLoop_swap_entry_enabled()
+{
+    return tracepoint_enabled(qtquick, QSGRenderLoop_swap_entry);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QSGRenderLoop_swap_entry(QQuickWindow *window)
+{
+    TraceLoggingWrite(qtquick_provider, "QSGRenderLoop_swap_entry",
+                      TraceLoggingPointer(window, "window"));
+}
+
+inline void do_trace_QSGRenderLoop_swap_entry(QQuickWindow *window)
+{
+    trace_QSGRenderLoop_swap_entry(window);
+}
+
+inline bool trace_QSGRenderLoop_swap_entry_enabled()
+{
+    return TraceLoggingProviderEnabled(qtquick_provider, 0, 0);
+}
+#endif
+
+#if defined(QT_TRACE_BACKEND_LTTNG)
+inline void trace_QSGRenderLoop_swap_exit(QQuickWindow *window)
+{
+    tracepoint(qtquick, QSGRenderLoop_swap_exit, window);
+}
+
+inline void do_trace_QSGRenderLoop_swap_exit(QQuickWindow *window)
+{
+    do_tracepoint(qtquick, QSGRenderLoop_swap_exit, window);
+}
+
+inline bool trace_QSGRenderLoop_swap_exit_enabled()
+{
+    return tracepoint_enabled(qtquick, QSGRenderLoop_swap_exit);
+}
+#elif defined(QT_TRACE_BACKEND_ETW)
+inline void trace_QSGRenderLoop_swap_exit(QQuickWindow *window)
+{
+    TraceLoggingWrite(qtquick_provider, "QSGRenderLoop_swap_exit",
+                      TraceLoggingPointer(window, "window"));
+}
+
+inline void do_trace_QSGRenderLoop_swap_exit(QQuickWindow *window)
+{
+    trace_QSGRenderLoop_swap_exit(window);
+}
+
+inline bool trace_QSGRenderLoop_swap_exit_enabled()
+{
+    return TraceLoggingProviderEnabled(qtquick_provider, 0, 0);
+}
+#endif
+
+} // namespace QtPrivate
+
+QT_END_NAMESPACE
+
+#endif // Q_TRACEPOINT && !QT_BOOTSTRAPPED
+#endif // QTQUICK_TRACEPOINTS_P_H
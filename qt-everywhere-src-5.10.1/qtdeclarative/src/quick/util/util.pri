@@ -20,6 +20,7 @@ SOURCES += \
     $$PWD/qquickimageprovider.cpp \
     $$PWD/qquicksvgparser.cpp \
     $$PWD/qquickvaluetypes.cpp \
+    $$PWD/qtquick_tracepoints.cpp \
     $$PWD/qquickglobal.cpp \
     $$PWD/qquickanimator.cpp \
     $$PWD/qquickanimatorjob.cpp \
@@ -55,6 +56,7 @@ HEADERS += \
     $$PWD/qquickimageprovider.h \
     $$PWD/qquicksvgparser_p.h \
     $$PWD/qquickvaluetypes_p.h \
+    $$PWD/qtquick_tracepoints_p.h \
     $$PWD/qquickanimator_p.h \
     $$PWD/qquickanimator_p_p.h \
     $$PWD/qquickanimatorjob_p.h \
@@ -80,3 +82,12 @@ qtConfig(quick-path) {
         $$PWD/qquickpath_p_p.h \
         $$PWD/qquickpathinterpolator_p.h
 }
+
+# Tracepoints are compiled out unless qmake is run with QT_TRACE_BACKEND=lttng
+# or QT_TRACE_BACKEND=etw, see qtrace_p.h
+equals(QT_TRACE_BACKEND, lttng) {
+    DEFINES += Q_TRACEPOINT QT_TRACE_BACKEND_LTTNG
+    LIBS_PRIVATE += -llttng-ust -ldl
+} else: equals(QT_TRACE_BACKEND, etw) {
+    DEFINES += Q_TRACEPOINT QT_TRACE_BACKEND_ETW
+}
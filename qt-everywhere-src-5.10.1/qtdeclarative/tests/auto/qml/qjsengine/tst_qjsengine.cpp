@@ -39,6 +39,8 @@
 #include <qqmlcomponent.h>
 #include <stdlib.h>
 #include <private/qv4alloca_p.h>
+#include <private/qv4profiling_p.h>
+#include <private/qv8engine_p.h>
 
 #ifdef Q_CC_MSVC
 #define NO_INLINE __declspec(noinline)
@@ -69,12 +71,14 @@ private slots:
     void newVariant_valueOfEnum();
     void newRegExp();
     void jsRegExp();
+    void jsRegExpSharedCompilation();
     void newDate();
     void jsParseDate();
     void newQObject();
     void newQObject_ownership();
     void newQObject_deletedEngine();
     void newQObjectPropertyCache();
+    void newQObjectPropertyLookup();
     void newQMetaObject();
     void exceptionInSlot();
     void globalObjectProperties();
@@ -126,6 +130,8 @@ private slots:
     void reentrancy_objectCreation();
     void jsIncDecNonObjectProperty();
     void JSONparse();
+    void JSONparseValues_data();
+    void JSONparseValues();
     void arraySort();
     void lookupOnDisappearingProperty();
 
@@ -143,6 +149,10 @@ private slots:
     void arrayPop_QTBUG_35979();
     void array_unshift_QTBUG_52065();
     void array_join_QTBUG_53672();
+    void typedArrayBuiltins_data();
+    void typedArrayBuiltins();
+    void substrings_data();
+    void substrings();
 
     void regexpLastMatch();
     void regexpLastIndex();
@@ -201,6 +211,11 @@ private slots:
 
     void malformedExpression();
 
+    void polymorphicPropertyLookup();
+    void megamorphicPropertyLookup();
+
+    void javaScriptSamples();
+
 signals:
     void testSignal();
 };
@@ -559,6 +574,31 @@ void tst_QJSEngine::jsRegExp()
     QCOMPARE(r11.toString(), QString::fromLatin1("/{1.*}/g"));
 }
 
+void tst_QJSEngine::jsRegExpSharedCompilation()
+{
+    // Compiled patterns are shared by the engines of a thread and outlive
+    // the engine that compiled them. Use more patterns than the cache keeps.
+    const QString program = QStringLiteral(
+                "var results = [];"
+                "for (var i = 0; i < 300; ++i)"
+                "    results.push(new RegExp('a(b*)' + i, 'i').exec('xAbb' + i)[1]);"
+                "results.join('') + /(\\d+)-(\\d+)/.exec('12-34')[2]");
+    const QString expected = QString(600, QLatin1Char('b')) + QLatin1String("34");
+
+    QScopedPointer<QJSEngine> first(new QJSEngine);
+    QJSEngine second;
+    QCOMPARE(first->evaluate(program).toString(), expected);
+    QCOMPARE(second.evaluate(program).toString(), expected);
+
+    first.reset();
+    QJSEngine third;
+    QCOMPARE(third.evaluate(program).toString(), expected);
+    QCOMPARE(second.evaluate(program).toString(), expected);
+
+    QVERIFY(third.evaluate("new RegExp('(')").isError());
+    QVERIFY(second.evaluate("new RegExp('(')").isError());
+}
+
 void tst_QJSEngine::newDate()
 {
     QJSEngine eng;
@@ -765,6 +805,35 @@ void tst_QJSEngine::newQObjectPropertyCache()
     QVERIFY(!QQmlData::get(obj.data())->propertyCache);
 }
 
+void tst_QJSEngine::newQObjectPropertyLookup()
+{
+    QTimer timer;
+    timer.setObjectName("timer");
+    timer.setInterval(42);
+    QObject object;
+    object.setObjectName("object");
+    QQmlEngine::setObjectOwnership(&timer, QQmlEngine::CppOwnership);
+    QQmlEngine::setObjectOwnership(&object, QQmlEngine::CppOwnership);
+
+    QJSEngine engine;
+    engine.globalObject().setProperty("timer", engine.newQObject(&timer));
+    engine.globalObject().setProperty("object", engine.newQObject(&object));
+
+    // Alternate between the two types so that the cached resolutions are reused.
+    QJSValue result = engine.evaluate(
+                "var names = [];"
+                "for (var i = 0; i < 2; ++i) {"
+                "    names.push(timer.objectName, timer.interval, object.objectName, object.interval);"
+                "}"
+                "names.join()");
+    QCOMPARE(result.toString(), QString("timer,42,object,,timer,42,object,"));
+
+    result = engine.evaluate("timer.interval = 100; object.objectName = 'renamed'; timer.interval");
+    QCOMPARE(result.toInt(), 100);
+    QCOMPARE(timer.interval(), 100);
+    QCOMPARE(object.objectName(), QString("renamed"));
+}
+
 void tst_QJSEngine::newQMetaObject() {
     {
         QJSEngine engine;
@@ -2977,6 +3046,36 @@ void tst_QJSEngine::JSONparse()
     QVERIFY(ret.isObject());
 }
 
+void tst_QJSEngine::JSONparseValues_data()
+{
+    QTest::addColumn<QString>("json");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("repeated keys") << "[{\"id\": 1, \"name\": \"a\"}, {\"id\": 2, \"name\": \"b\"}, {\"name\": \"c\", \"id\": 3}]"
+                                   << "[{\"id\":1,\"name\":\"a\"},{\"id\":2,\"name\":\"b\"},{\"name\":\"c\",\"id\":3}]";
+    QTest::newRow("similar keys") << "{\"ab\": 1, \"aab\": 2, \"acb\": 3, \"ab \": 4, \"a\\u0062\": 5, \"\": 6}"
+                                  << "{\"ab\":5,\"aab\":2,\"acb\":3,\"ab \":4,\"\":6}";
+    QTest::newRow("index keys") << "{\"1\": \"x\", \"01\": \"y\"}" << "{\"1\":\"x\",\"01\":\"y\"}";
+    QTest::newRow("strings") << "[\"\", \"plain\", \"a\\\"b\", \"\\u00e9\\n\"]" << "[\"\",\"plain\",\"a\\\"b\",\"\u00e9\\n\"]";
+    QTest::newRow("numbers") << "[0, -0, 7, -1234567, 12345678, -99999999, 1e3, 0.5, -2.5e-1]"
+                             << "[0,0,7,-1234567,12345678,-99999999,1000,0.5,-0.25]";
+    QTest::newRow("control character") << "[\"a\tb\"]" << "SyntaxError";
+    QTest::newRow("unterminated string") << "[\"abc" << "SyntaxError";
+    QTest::newRow("unterminated key") << "{\"abc" << "SyntaxError";
+    QTest::newRow("minus") << "[-]" << "SyntaxError";
+}
+
+void tst_QJSEngine::JSONparseValues()
+{
+    QFETCH(QString, json);
+    QFETCH(QString, expected);
+
+    QJSEngine eng;
+    eng.globalObject().setProperty("json", json);
+    QJSValue ret = eng.evaluate("try { JSON.stringify(JSON.parse(json)); } catch (e) { e.name; }");
+    QCOMPARE(ret.toString(), expected);
+}
+
 void tst_QJSEngine::arraySort()
 {
     // tests that calling Array.sort with a bad sort function doesn't cause issues
@@ -3228,6 +3327,63 @@ void tst_QJSEngine::array_join_QTBUG_53672()
     QCOMPARE(result.toString(), QString(""));
 }
 
+void tst_QJSEngine::typedArrayBuiltins_data()
+{
+    QTest::addColumn<QString>("code");
+    QTest::addColumn<QString>("expected");
+
+    QTest::newRow("set converting") << "var a = new Int8Array(3); a.set(new Float64Array([1.5, -129, 300])); Array.prototype.join.call(a)" << "1,127,44";
+    QTest::newRow("set clamped") << "var a = new Uint8ClampedArray(4); a.set(new Float32Array([-1, 2.5, 3.5, 256])); Array.prototype.join.call(a)" << "0,2,4,255";
+    QTest::newRow("set overlapping") << "var b = new ArrayBuffer(8); var a = new Uint8Array(b); a.set([1, 2, 3, 4]); new Uint16Array(b, 2).set(new Uint8Array(b, 0, 3)); Array.prototype.join.call(a)" << "1,2,1,0,2,0,3,0";
+    QTest::newRow("fill") << "Array.prototype.join.call(new Uint8Array(4).fill(257))" << "1,1,1,1";
+    QTest::newRow("fill range") << "Array.prototype.join.call(new Float32Array(5).fill(0.5, 1, -1))" << "0,0.5,0.5,0.5,0";
+    QTest::newRow("indexOf") << "var a = new Int16Array([5, -3, 7, -3]); [a.indexOf(-3), a.indexOf(-3, 2), a.indexOf(-3, -1), a.indexOf(7.5), a.indexOf(\"7\"), a.indexOf(65533)].join()" << "1,3,3,-1,-1,-1";
+    QTest::newRow("indexOf bytes") << "var a = new Uint8Array([0, 255, 10]); [a.indexOf(255), a.indexOf(-1), a.indexOf(10, 1)].join()" << "1,-1,2";
+    QTest::newRow("indexOf float") << "var a = new Float32Array([0.5, NaN, 0.1]); [a.indexOf(0.5), a.indexOf(NaN), a.indexOf(0.1), a.indexOf(-0)].join()" << "0,-1,-1,-1";
+    QTest::newRow("sort") << "Array.prototype.join.call(new Int32Array([3, -1, 2, -5]).sort())" << "-5,-1,2,3";
+    QTest::newRow("sort float") << "var a = new Float64Array([NaN, 1, -Infinity, 0, -0]).sort(); [a[0], 1 / a[1], 1 / a[2], a[3], a[4]].join()" << "-Infinity,-Infinity,Infinity,1,NaN";
+    QTest::newRow("sort compare function") << "Array.prototype.join.call(new Uint16Array([1, 3, 2]).sort(function(a, b) { return b - a; }))" << "3,2,1";
+}
+
+void tst_QJSEngine::typedArrayBuiltins()
+{
+    QFETCH(QString, code);
+    QFETCH(QString, expected);
+
+    QJSEngine eng;
+    QJSValue result = eng.evaluate(code);
+    QVERIFY(!result.isError());
+    QCOMPARE(result.toString(), expected);
+}
+
+void tst_QJSEngine::substrings_data()
+{
+    QTest::addColumn<QString>("code");
+    QTest::addColumn<QString>("expected");
+
+    const QString setup = QStringLiteral("var s = ''; for (var i = 0; i < 10; ++i) s += 'abcdefghij'; ");
+    QTest::newRow("slice") << setup + "s.slice(5, 45)" << QString("fghij") + QString("abcdefghij").repeated(3) + "abcde";
+    QTest::newRow("substr") << setup + "s.substr(90, 10) + s.substr(50, 40).length" << "abcdefghij40";
+    QTest::newRow("substring of substring") << setup + "s.substring(10, 90).substring(3, 53).substring(1, 41)" << QString("efghijabcd").repeated(4);
+    QTest::newRow("concatenated") << setup + "var t = s.substring(2, 42) + '-' + s.substring(50, 90); t.length + t.charAt(40) + t.charAt(41) + t.substring(38, 44)" << "81-aab-abc";
+    QTest::newRow("string object") << setup + "new String(s).slice(-50, -10)" << QString("abcdefghij").repeated(4);
+    QTest::newRow("comparison") << setup + "var o = {}; o[s.slice(0, 40)] = 1; [s.slice(10, 50) === s.substring(0, 40), o[s.substr(20, 40)]].join()" << "true,1";
+    QTest::newRow("case") << setup + "s.toUpperCase().slice(1, 41).charAt(0) + s.slice(0, 40).toUpperCase().substring(0, 3)" << "BABC";
+}
+
+void tst_QJSEngine::substrings()
+{
+    QFETCH(QString, code);
+    QFETCH(QString, expected);
+
+    QJSEngine eng;
+    QJSValue result = eng.evaluate(code);
+    QVERIFY(!result.isError());
+    QCOMPARE(result.toString(), expected);
+    eng.collectGarbage();
+    QCOMPARE(result.toString(), expected);
+}
+
 void tst_QJSEngine::regexpLastMatch()
 {
     QJSEngine eng;
@@ -4118,6 +4274,99 @@ void tst_QJSEngine::malformedExpression()
     engine.evaluate("5%55555&&5555555\n7-0");
 }
 
+void tst_QJSEngine::polymorphicPropertyLookup()
+{
+    QJSEngine engine;
+    QJSValue ok = engine.evaluate(
+                "function get(o) { return o.x; }\n"
+                "function set(o, v) { o.x = v; }\n"
+                "var objects = [ { x: 1 }, { a: 0, x: 2 }, { a: 0, b: 0, x: 3 }, { a: 0, b: 0, c: 0, x: 4 },\n"
+                "                { x: 5, d: 0 }, Object.freeze({ x: 6 }) ];\n"
+                "for (var round = 0; round < 2; ++round) {\n"
+                "    for (var i = 0; i < objects.length; ++i)\n"
+                "        set(objects[i], get(objects[i]) * 10);\n"
+                "}\n"
+                "var result = [];\n"
+                "for (var i = 0; i < objects.length; ++i)\n"
+                "    result.push(get(objects[i]));\n"
+                "result.join(',');");
+    QCOMPARE(ok.toString(), QStringLiteral("100,200,300,400,500,6"));
+}
+
+void tst_QJSEngine::megamorphicPropertyLookup()
+{
+    QJSEngine engine;
+    QJSValue ok = engine.evaluate(
+                "function Base() {}\n"
+                "Base.prototype.value = function() { return this.x * 2; };\n"
+                "var objects = [ { x: 1 }, { a: 0, x: 2 }, { a: 0, b: 0, x: 3 }, { x: 4, c: 0 } ];\n"
+                "var derived = new Base; derived.x = 5; objects.push(derived);\n"
+                "var accessor = { get x() { return 6; } }; objects.push(accessor);\n"
+                "function sum() {\n"
+                "    var result = 0;\n"
+                "    for (var i = 0; i < objects.length; ++i)\n"
+                "        result += objects[i].x;\n"
+                "    return result;\n"
+                "}\n"
+                "var first = sum() === 21;\n"
+                "var second = sum() === 21;\n"
+                "derived.x = 10;\n"
+                "Object.defineProperty(objects[0], 'x', { get: function() { return 11; } });\n"
+                "Base.prototype.x = 100; delete derived.x;\n"
+                "first && second && sum() === 126 && derived.value() === 200;");
+    QVERIFY(ok.isBool());
+    QVERIFY(ok.toBool());
+}
+
+void tst_QJSEngine::javaScriptSamples()
+{
+#ifdef QT_NO_QML_DEBUGGER
+    QSKIP("The V4 profiler is not available in this build.");
+#else
+    QJSEngine engine;
+    QV4::ExecutionEngine *v4 = QV8Engine::getV4(&engine);
+    v4->setProfiler(new QV4::Profiling::Profiler(v4));
+
+    QByteArray folded;
+    QObject::connect(v4->profiler(), &QV4::Profiling::Profiler::samplesReady,
+                     [&folded](qint64, const QByteArray &foldedStacks) { folded = foldedStacks; });
+
+    engine.evaluate("function leaf(i) { return i * 2; }\n"
+                    "function outer(n) {\n"
+                    "    var sum = 0;\n"
+                    "    for (var i = 0; i < n; ++i)\n"
+                    "        sum += leaf(i);\n"
+                    "    return sum;\n"
+                    "}\n", QStringLiteral("samples.js"));
+    QJSValue outer = engine.globalObject().property("outer");
+
+    v4->profiler()->startProfiling(1 << QV4::Profiling::FeatureSampling);
+    QElapsedTimer timer;
+    timer.start();
+    while (!timer.hasExpired(200))
+        QCOMPARE(outer.call(QJSValueList() << 100).toInt(), 9900);
+    v4->profiler()->stopProfiling();
+
+    // "outer (samples.js:2);leaf (samples.js:1) 42"
+    bool foundLeaf = false;
+    const QList<QByteArray> lines = folded.split('\n');
+    QVERIFY(lines.size() > 1);
+    QVERIFY(lines.last().isEmpty());
+    for (int i = 0; i < lines.size() - 1; ++i) {
+        const QByteArray &line = lines.at(i);
+        const int space = line.lastIndexOf(' ');
+        QVERIFY(space > 0);
+        bool ok = false;
+        QVERIFY(line.mid(space + 1).toInt(&ok) > 0);
+        QVERIFY(ok);
+        QVERIFY(line.startsWith("outer (samples.js:2)"));
+        if (line.left(space) == "outer (samples.js:2);leaf (samples.js:1)")
+            foundLeaf = true;
+    }
+    QVERIFY(foundLeaf);
+#endif
+}
+
 QTEST_MAIN(tst_QJSEngine)
 
 #include "tst_qjsengine.moc"
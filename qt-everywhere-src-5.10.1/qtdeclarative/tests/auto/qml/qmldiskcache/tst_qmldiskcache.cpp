@@ -29,6 +29,7 @@
 #include <qtest.h>
 
 #include <private/qv4compileddata_p.h>
+#include <private/qv4compilationunitbundle_p.h>
 #include <private/qv4compiler_p.h>
 #include <private/qv4jsir_p.h>
 #include <private/qv4isel_p.h>
@@ -60,6 +61,7 @@ private slots:
     void stableOrderOfDependentCompositeTypes();
     void singletonDependency();
     void cppRegisteredSingletonDependency();
+    void cacheBundle();
 };
 
 // A wrapper around QQmlComponent to ensure the temporary reference counts
@@ -851,6 +853,49 @@ void tst_qmldiskcache::cppRegisteredSingletonDependency()
     }
 }
 
+void tst_qmldiskcache::cacheBundle()
+{
+    QQmlEngine engine;
+    TestCompiler testCompiler(&engine);
+    QVERIFY(testCompiler.tempDir.isValid());
+
+    const QByteArray contents = QByteArrayLiteral("import QtQml 2.0\n"
+                                                  "QtObject {\n"
+                                                  "    property int value: 42\n"
+                                                  "}");
+    QVERIFY2(testCompiler.compile(contents), qPrintable(testCompiler.lastErrorString));
+    QVERIFY(QFile::exists(testCompiler.cacheFilePath));
+
+    const QString bundlePath = testCompiler.tempDir.path() + QStringLiteral("/test.qmlcbundle");
+    const QString otherSourcePath = testCompiler.tempDir.path() + QStringLiteral("/other.qml");
+    QVector<QV4::CompilationUnitBundle::CacheFile> cacheFiles;
+    cacheFiles.append({ testCompiler.testFilePath, testCompiler.cacheFilePath });
+    cacheFiles.append({ otherSourcePath, testCompiler.cacheFilePath });
+
+    QString errorString;
+    QVERIFY2(QV4::CompilationUnitBundle::write(bundlePath, cacheFiles, &errorString), qPrintable(errorString));
+
+    QV4::CompilationUnitBundle bundle;
+    QVERIFY2(bundle.open(bundlePath, &errorString), qPrintable(errorString));
+
+    const QV4::CompiledData::Unit *testUnit = testCompiler.mapUnit();
+    QVERIFY2(testUnit, qPrintable(testCompiler.lastErrorString));
+
+    for (const QString &sourcePath : { testCompiler.testFilePath, otherSourcePath }) {
+        const QV4::CompiledData::Unit *bundledUnit = bundle.unitForSource(sourcePath);
+        QVERIFY(bundledUnit);
+        QCOMPARE(quintptr(bundledUnit) % 16, quintptr(0));
+        QCOMPARE(quint32(bundledUnit->unitSize), quint32(testUnit->unitSize));
+        QVERIFY(memcmp(bundledUnit, testUnit, testUnit->unitSize) == 0);
+    }
+    QVERIFY(!bundle.unitForSource(testCompiler.tempDir.path() + QStringLiteral("/missing.qml")));
+
+    // A cache file is not a bundle.
+    QV4::CompilationUnitBundle invalidBundle;
+    QVERIFY(!invalidBundle.open(testCompiler.cacheFilePath, &errorString));
+    QVERIFY(!invalidBundle.isOpen());
+}
+
 QTEST_MAIN(tst_qmldiskcache)
 
 #include "tst_qmldiskcache.moc"
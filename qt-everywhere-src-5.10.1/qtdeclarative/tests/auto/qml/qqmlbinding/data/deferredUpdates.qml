@@ -0,0 +1,11 @@
+import QtQml 2.0
+
+QtObject {
+    property int a: 1
+    property int b: a + 1
+    property int c: a * 2
+    property int d: b + c
+
+    property int dChangeCount: 0
+    onDChanged: ++dChangeCount
+}
@@ -0,0 +1,15 @@
+import QtQuick 2.0
+
+Item {
+    id: root
+
+    property Item current: first
+    property real currentWidth: current.width
+    property Item currentParent: current.parent
+    property string widthString: first.width
+    property Item nothing
+    property real nothingWidth: nothing.width
+
+    Item { id: first; width: 10 }
+    Item { id: second; width: 20 }
+}
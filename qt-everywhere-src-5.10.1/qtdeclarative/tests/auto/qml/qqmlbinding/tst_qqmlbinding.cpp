@@ -26,9 +26,11 @@
 **
 ****************************************************************************/
 #include <qtest.h>
+#include <QtCore/qregularexpression.h>
 #include <QtQml/qqmlengine.h>
 #include <QtQml/qqmlcomponent.h>
 #include <private/qqmlbind_p.h>
+#include <private/qqmlengine_p.h>
 #include <QtQuick/private/qquickrectangle_p.h>
 #include "../../shared/util.h"
 
@@ -51,6 +53,8 @@ private slots:
     void disabledOnReadonlyProperty();
     void delayed();
     void bindingOverwriting();
+    void deferredUpdates();
+    void propertyChain();
 
 private:
     QQmlEngine engine;
@@ -319,6 +323,72 @@ void tst_qqmlbinding::bindingOverwriting()
     QCOMPARE(messageHandler.messages().count(), 2);
 }
 
+void tst_qqmlbinding::deferredUpdates()
+{
+    QQmlEngine engine;
+    QQmlEnginePrivate *ep = QQmlEnginePrivate::get(&engine);
+    ep->deferBindingUpdates = true;
+
+    QQmlComponent c(&engine, testFileUrl("deferredUpdates.qml"));
+    QScopedPointer<QObject> object(c.create());
+    QVERIFY(object);
+    QCOMPARE(object->property("d").toInt(), 4);
+    QCOMPARE(object->property("dChangeCount").toInt(), 0);
+
+    object->setProperty("a", 2);
+    // doesn't update immediately
+    QCOMPARE(object->property("b").toInt(), 2);
+    QCOMPARE(object->property("d").toInt(), 4);
+
+    ep->flushDeferredBindings();
+    QCOMPARE(object->property("b").toInt(), 3);
+    QCOMPARE(object->property("c").toInt(), 4);
+    QCOMPARE(object->property("d").toInt(), 7);
+    // d depends on a through both b and c, but is only evaluated once
+    QCOMPARE(object->property("dChangeCount").toInt(), 1);
+
+    object->setProperty("a", 3);
+    QCoreApplication::processEvents();
+    QCOMPARE(object->property("d").toInt(), 10);
+    QCOMPARE(object->property("dChangeCount").toInt(), 2);
+}
+
+void tst_qqmlbinding::propertyChain()
+{
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("propertyChain.qml"));
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*TypeError: Cannot read property 'width' of null"));
+    QScopedPointer<QQuickItem> root(qobject_cast<QQuickItem *>(c.create()));
+    QVERIFY(root);
+
+    QQuickItem *first = root->findChildren<QQuickItem *>().value(0);
+    QQuickItem *second = root->findChildren<QQuickItem *>().value(1);
+    QVERIFY(first && second);
+
+    QCOMPARE(root->property("currentWidth").toReal(), 10.0);
+    QCOMPARE(root->property("currentParent").value<QQuickItem *>(), root.data());
+    // converted by the binding's function
+    QCOMPARE(root->property("widthString").toString(), QStringLiteral("10"));
+    QCOMPARE(root->property("nothingWidth").toReal(), 0.0);
+
+    first->setWidth(15);
+    QCOMPARE(root->property("currentWidth").toReal(), 15.0);
+    QCOMPARE(root->property("widthString").toString(), QStringLiteral("15"));
+
+    root->setProperty("current", QVariant::fromValue(second));
+    QCOMPARE(root->property("currentWidth").toReal(), 20.0);
+    first->setWidth(30);
+    QCOMPARE(root->property("currentWidth").toReal(), 20.0);
+    second->setWidth(25);
+    QCOMPARE(root->property("currentWidth").toReal(), 25.0);
+
+    second->setParentItem(first);
+    QCOMPARE(root->property("currentParent").value<QQuickItem *>(), first);
+
+    root->setProperty("nothing", QVariant::fromValue(first));
+    QCOMPARE(root->property("nothingWidth").toReal(), 30.0);
+}
+
 QTEST_MAIN(tst_qqmlbinding)
 
 #include "tst_qqmlbinding.moc"
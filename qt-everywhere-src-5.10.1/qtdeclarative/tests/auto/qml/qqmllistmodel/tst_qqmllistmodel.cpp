@@ -124,6 +124,7 @@ private slots:
     void modify_through_delegate();
     void bindingsOnGetResult();
     void stringifyModelEntry();
+    void insertArray();
 };
 
 bool tst_qqmllistmodel::compareVariantList(const QVariantList &testList, QVariant object)
@@ -1505,6 +1506,41 @@ void tst_qqmllistmodel::stringifyModelEntry()
     QCOMPARE(v.toString(), expectedString);
 }
 
+void tst_qqmllistmodel::insertArray()
+{
+    QQmlEngine engine;
+    QQmlListModel model;
+    QQmlEngine::setContextForObject(&model, engine.rootContext());
+    engine.rootContext()->setContextObject(&model);
+
+    QSignalSpy spy(&model, SIGNAL(rowsInserted(QModelIndex,int,int)));
+
+    QQmlExpression expr(engine.rootContext(), &model,
+                        "var items = [];"
+                        "for (var i = 0; i < 1000; ++i)"
+                        "    items.push({ name: \"item\" + i, value: i });"
+                        "append(items);"
+                        "var last = get(999);"
+                        "insert(1, [{ name: \"a\", value: -1 }, { name: \"b\", value: -2 }]);"
+                        "last.value");
+    QVariant result = expr.evaluate();
+    QVERIFY2(!expr.hasError(), QTest::toString(expr.error().toString()));
+    QCOMPARE(result.toInt(), 999);
+
+    QCOMPARE(spy.count(), 2);
+    QCOMPARE(spy.at(0).at(1).toInt(), 0);
+    QCOMPARE(spy.at(0).at(2).toInt(), 999);
+    QCOMPARE(spy.at(1).at(1).toInt(), 1);
+    QCOMPARE(spy.at(1).at(2).toInt(), 2);
+
+    QCOMPARE(model.count(), 1002);
+    QCOMPARE(RUNEXPR("get(0).name").toString(), QString("item0"));
+    QCOMPARE(RUNEXPR("get(1).name").toString(), QString("a"));
+    QCOMPARE(RUNEXPR("get(2).value").toInt(), -2);
+    QCOMPARE(RUNEXPR("get(3).name").toString(), QString("item1"));
+    QCOMPARE(RUNEXPR("get(1001).value").toInt(), 999);
+}
+
 QTEST_MAIN(tst_qqmllistmodel)
 
 #include "tst_qqmllistmodel.moc"
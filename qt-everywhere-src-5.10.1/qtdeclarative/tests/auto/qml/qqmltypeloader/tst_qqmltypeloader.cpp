@@ -48,6 +48,7 @@ private slots:
     void keepSingleton();
     void keepRegistrations();
     void intercept();
+    void parallelParsing();
 };
 
 void tst_QQMLTypeLoader::testLoadComplete()
@@ -410,6 +411,55 @@ void tst_QQMLTypeLoader::intercept()
     QVERIFY(factory.loadedFiles.contains(QLatin1String(QT_TESTCASE_BUILDDIR) + "/Slow/qmldir"));
 }
 
+void tst_QQMLTypeLoader::parallelParsing()
+{
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+
+    const auto writeTempFile = [&tempDir](const QString &fileName, const QByteArray &contents) {
+        QFile f(tempDir.path() + '/' + fileName);
+        const bool ok = f.open(QIODevice::WriteOnly | QIODevice::Truncate);
+        Q_ASSERT(ok);
+        f.write(contents);
+        return f.fileName();
+    };
+
+    // Several composite types used by the same component get parsed in parallel.
+    QByteArrayList types;
+    for (int i = 0; i < 8; ++i) {
+        const QByteArray index = QByteArray::number(i);
+        writeTempFile("Type" + index + ".qml", "import QtQml 2.0\nQtObject { property int value: " + index + " }");
+        types.append("Type" + index + " {}");
+    }
+    const QByteArray main = "import QtQml 2.0\nQtObject {\n"
+                            "    property list<QtObject> kids: [ " + types.join(", ") + " ]\n"
+                            "    property int sum: { var s = 0; for (var i = 0; i < kids.length; ++i) s += kids[i].value; return s; }\n"
+                            "}";
+    const QString mainFile = writeTempFile("main.qml", main);
+
+    {
+        QQmlEngine engine;
+        QQmlComponent component(&engine, QUrl::fromLocalFile(mainFile));
+        QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+        QScopedPointer<QObject> o(component.create());
+        QVERIFY(o);
+        QCOMPARE(o->property("sum").toInt(), 28);
+    }
+
+    // Errors in a type parsed on another thread are reported as usual.
+    writeTempFile("Broken.qml", "import QtQml 2.0\nQtObject {\n    property int value: }\n");
+    const QString brokenFile = writeTempFile("broken.qml", "import QtQml 2.0\nQtObject {\n"
+                                                           "    property QtObject a: Type0 {}\n"
+                                                           "    property QtObject b: Broken {}\n"
+                                                           "}");
+    {
+        QQmlEngine engine;
+        QQmlComponent component(&engine, QUrl::fromLocalFile(brokenFile));
+        QVERIFY(component.isError());
+        QVERIFY2(component.errorString().contains(QLatin1String("/Broken.qml")), qPrintable(component.errorString()));
+    }
+}
+
 QTEST_MAIN(tst_QQMLTypeLoader)
 
 #include "tst_qqmltypeloader.moc"
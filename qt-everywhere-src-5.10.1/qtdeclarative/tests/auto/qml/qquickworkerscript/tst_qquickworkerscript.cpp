@@ -130,6 +130,7 @@ void tst_QQuickWorkerScript::messaging_data()
     QTest::newRow("string") << qVariantFromValue(QString("More cheeeese, Gromit!"));
     QTest::newRow("variant list") << qVariantFromValue((QVariantList() << "a" << "b" << "c"));
     QTest::newRow("date time") << qVariantFromValue(QDateTime::currentDateTime());
+    QTest::newRow("array buffer") << qVariantFromValue(QByteArray("\x00\x01\x02cheese", 9));
 #ifndef QT_NO_REGEXP
     // Qt Script's QScriptValue -> QRegExp uses RegExp2 pattern syntax
     QTest::newRow("regexp") << qVariantFromValue(QRegExp("^\\d\\d?$", Qt::CaseInsensitive, QRegExp::RegExp2));
@@ -28,7 +28,10 @@
 
 #include <qtest.h>
 #include <QQmlEngine>
+#include <QQmlComponent>
+#include <QDataStream>
 #include <private/qv4mm_p.h>
+#include <private/qv8engine_p.h>
 
 class tst_qv4mm : public QObject
 {
@@ -37,6 +40,7 @@ class tst_qv4mm : public QObject
 private slots:
     void gcStats();
     void tweaks();
+    void heapSnapshot();
 };
 
 void tst_qv4mm::gcStats()
@@ -53,6 +57,87 @@ void tst_qv4mm::tweaks()
     QQmlEngine engine;
 }
 
+void tst_qv4mm::heapSnapshot()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData("import QtQml 2.0\n"
+                      "QtObject {\n"
+                      "    objectName: \"snapshotRoot\"\n"
+                      "    property var retained: { \"items\": [1, 2, 3], \"callback\": function retainedCallback() {} }\n"
+                      "}\n", QUrl("file:///snapshot.qml"));
+    QScopedPointer<QObject> object(component.create());
+    QVERIFY(object);
+
+    QV4::ExecutionEngine *v4 = QV8Engine::getV4(&engine);
+    const QByteArray snapshot = v4->memoryManager->heapSnapshot();
+    QVERIFY(!snapshot.isEmpty());
+
+    QDataStream stream(snapshot);
+    quint32 magic, version;
+    stream >> magic >> version;
+    QCOMPARE(magic, quint32(0x51563448));
+    QCOMPARE(version, quint32(1));
+
+    quint32 stringCount;
+    stream >> stringCount;
+    QVector<QByteArray> strings(stringCount);
+    for (quint32 i = 0; i < stringCount; ++i)
+        stream >> strings[i];
+
+    quint32 nodeCount;
+    stream >> nodeCount;
+    QVERIFY(nodeCount > 1);
+    QVector<quint32> types(nodeCount);
+    QVector<quint32> names(nodeCount);
+    for (quint32 i = 0; i < nodeCount; ++i) {
+        quint64 address;
+        quint32 size;
+        stream >> address >> types[i] >> names[i] >> size;
+        QVERIFY(types.at(i) < stringCount);
+        QVERIFY(names.at(i) == 0xffffffff || names.at(i) < stringCount);
+        QCOMPARE(address == 0, i == 0);
+        QCOMPARE(size == 0, i == 0);
+    }
+    QCOMPARE(strings.at(types.at(0)), QByteArray("(GC roots)"));
+
+    quint32 edgeCount;
+    stream >> edgeCount;
+    QVERIFY(edgeCount >= nodeCount - 1);
+    QVector<bool> retained(nodeCount, false);
+    for (quint32 i = 0; i < edgeCount; ++i) {
+        quint32 from, to;
+        stream >> from >> to;
+        QVERIFY(from < nodeCount);
+        QVERIFY(to < nodeCount);
+        retained[to] = true;
+    }
+    QCOMPARE(stream.status(), QDataStream::Ok);
+    QVERIFY(stream.atEnd());
+
+    // every object is reachable from the roots
+    for (quint32 i = 1; i < nodeCount; ++i)
+        QVERIFY(retained.at(i));
+
+    bool foundCallback = false;
+    bool foundWrapper = false;
+    for (quint32 i = 1; i < nodeCount; ++i) {
+        if (names.at(i) == 0xffffffff)
+            continue;
+        const QByteArray name = strings.at(names.at(i));
+        if (name.startsWith("retainedCallback (file:///snapshot.qml:"))
+            foundCallback = true;
+        else if (name.startsWith("QObject") && name.endsWith(" snapshotRoot (file:///snapshot.qml)"))
+            foundWrapper = true;
+    }
+    QVERIFY(foundCallback);
+    QVERIFY(foundWrapper);
+
+    // no marks are left behind
+    engine.collectGarbage();
+    QVERIFY(object->property("retained").isValid());
+}
+
 QTEST_MAIN(tst_qv4mm)
 
 #include "tst_qv4mm.moc"
@@ -41,6 +41,7 @@ private Q_SLOTS:
     void testPoint2D();
     void testTexturedPoint2D();
     void testCustomGeometry();
+    void testReallocate();
 
 private:
 };
@@ -163,6 +164,50 @@ void GeometryTest::testCustomGeometry()
 }
 
 
+void GeometryTest::testReallocate()
+{
+    QSGGeometry geometry(QSGGeometry::defaultAttributes_Point2D(), 100, 60);
+    QVERIFY(geometry.vertexData());
+    QVERIFY(geometry.indexData());
+
+    // Growing a little stays in the same block
+    const void *vertexData = geometry.vertexData();
+    geometry.allocate(110, 60);
+    QCOMPARE(geometry.vertexData(), vertexData);
+    QCOMPARE((const char *) geometry.indexData(), (const char *) geometry.vertexData() + 110 * geometry.sizeOfVertex());
+
+    QSGGeometry::Point2D *pts = geometry.vertexDataAsPoint2D();
+    for (int i = 0; i < geometry.vertexCount(); ++i)
+        pts[i].set(i, -i);
+    quint16 *indices = geometry.indexDataAsUShort();
+    for (int i = 0; i < geometry.indexCount(); ++i)
+        indices[i] = i;
+
+    // Much larger and much smaller sizes get a new block
+    geometry.allocate(10000, 20000);
+    QCOMPARE(geometry.vertexCount(), 10000);
+    QCOMPARE(geometry.indexCount(), 20000);
+    pts = geometry.vertexDataAsPoint2D();
+    for (int i = 0; i < geometry.vertexCount(); ++i)
+        pts[i].set(i, -i);
+    indices = geometry.indexDataAsUShort();
+    for (int i = 0; i < geometry.indexCount(); ++i)
+        indices[i] = i;
+    QCOMPARE(pts[9999].x, 9999.f);
+    QCOMPARE(indices[19999], quint16(19999));
+
+    geometry.allocate(4, 6);
+    QCOMPARE(geometry.vertexCount(), 4);
+    QCOMPARE(geometry.indexCount(), 6);
+    QCOMPARE((const char *) geometry.indexData(), (const char *) geometry.vertexData() + 4 * geometry.sizeOfVertex());
+
+    // Small vertex only geometry uses the preallocated storage
+    geometry.allocate(4, 0);
+    QVERIFY(!geometry.indexData());
+    QSGGeometry::updateRectGeometry(&geometry, QRectF(1, 2, 3, 4));
+    QCOMPARE(geometry.vertexDataAsPoint2D()[3].x, 4.f);
+}
+
 QTEST_MAIN(GeometryTest);
 
 #include "tst_geometry.moc"
@@ -43,6 +43,7 @@ private slots:
     void testMultiWinAnimator_data();
     void testMultiWinAnimator();
     void testTransitions();
+    void testColorAnimator();
 };
 
 void tst_Animators::testMultiWinAnimator_data()
@@ -119,6 +120,34 @@ void tst_Animators::testTransitions()
     QCOMPARE(child->scale(), qreal(1.0));
 }
 
+void tst_Animators::testColorAnimator()
+{
+    QQuickView view;
+    QQmlComponent component(view.engine());
+    component.setData("import QtQuick 2.11\n"
+                      "Rectangle {\n"
+                      "    width: 100; height: 100; color: \"red\"\n"
+                      "    ColorAnimator on color { objectName: \"animator\"; to: \"blue\"; duration: 100 }\n"
+                      "}\n", QUrl());
+    QScopedPointer<QQuickItem> rectangle(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY2(rectangle, qPrintable(component.errorString()));
+
+    QQuickColorAnimator *animator = rectangle->findChild<QQuickColorAnimator *>("animator");
+    QVERIFY(animator);
+    QCOMPARE(animator->to(), QColor(Qt::blue));
+    QVERIFY(!animator->from().isValid());
+
+    // The color is only written back when the animation is done
+    QCOMPARE(rectangle->property("color").value<QColor>(), QColor(Qt::red));
+
+    rectangle->setParentItem(view.contentItem());
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QTRY_COMPARE(rectangle->property("color").value<QColor>(), QColor(Qt::blue));
+    QTRY_VERIFY(!animator->isRunning());
+}
+
 #include "tst_qquickanimators.moc"
 
 QTEST_MAIN(tst_Animators)
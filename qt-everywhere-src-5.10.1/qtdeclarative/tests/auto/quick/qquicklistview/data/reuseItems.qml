@@ -0,0 +1,29 @@
+import QtQuick 2.11
+
+ListView {
+    id: root
+    width: 240
+    height: 320
+    cacheBuffer: 0
+    reuseItems: true
+    model: 100
+
+    property int createdCount: 0
+    property int pooledCount: 0
+    property int reusedCount: 0
+
+    delegate: Rectangle {
+        width: root.width
+        height: 20
+        property int modelIndex: index
+
+        Text {
+            objectName: "text"
+            text: "Item " + index
+        }
+
+        Component.onCompleted: root.createdCount++
+        ListView.onPooled: root.pooledCount++
+        ListView.onReused: root.reusedCount++
+    }
+}
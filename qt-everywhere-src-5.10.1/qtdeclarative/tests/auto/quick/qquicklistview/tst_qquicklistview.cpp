@@ -265,6 +265,7 @@ private slots:
     void QTBUG_61537_modelChangesAsync();
 
     void addOnCompleted();
+    void reuseItems();
 
 private:
     template <class T> void items(const QUrl &source);
@@ -8767,6 +8768,44 @@ void tst_QQuickListView::addOnCompleted()
     }
 }
 
+void tst_QQuickListView::reuseItems()
+{
+    QScopedPointer<QQuickView> window(createView());
+    window->setSource(testFileUrl("reuseItems.qml"));
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+
+    QQuickListView *listview = qobject_cast<QQuickListView *>(window->rootObject());
+    QVERIFY(listview);
+    QVERIFY(listview->reuseItems());
+    QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+    QQuickItemViewPrivate *d = static_cast<QQuickItemViewPrivate *>(QQuickItemPrivate::get(listview));
+
+    const int initialCount = listview->property("createdCount").toInt();
+    QVERIFY(initialCount > 0);
+
+    // The delegates that leave the view are handed out again for the ones that
+    // enter it, and have to show the data of their new index.
+    for (int i = 1; i <= 10; ++i) {
+        listview->setContentY(i * listview->height() / 2);
+        QTRY_COMPARE(QQuickItemPrivate::get(listview)->polishScheduled, false);
+        for (FxViewItem *item : qAsConst(d->visibleItems)) {
+            QCOMPARE(item->item->property("modelIndex").toInt(), item->index);
+            QQuickText *text = findItem<QQuickText>(item->item, "text");
+            QVERIFY(text);
+            QCOMPARE(text->text(), QString::fromLatin1("Item %1").arg(item->index));
+        }
+    }
+
+    QVERIFY(listview->property("pooledCount").toInt() > 0);
+    QVERIFY(listview->property("reusedCount").toInt() > 0);
+    QVERIFY(listview->property("createdCount").toInt() < 2 * initialCount);
+
+    QVERIFY(d->model->poolSize() > 0);
+    listview->setReuseItems(false);
+    QCOMPARE(d->model->poolSize(), 0);
+}
+
 QTEST_MAIN(tst_QQuickListView)
 
 #include "tst_qquicklistview.moc"
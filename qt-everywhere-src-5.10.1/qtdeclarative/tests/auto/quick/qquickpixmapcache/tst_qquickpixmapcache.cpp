@@ -28,6 +28,10 @@
 #include <qtest.h>
 #include <QtTest/QtTest>
 #include <QtQuick/private/qquickpixmapcache_p.h>
+#if QT_CONFIG(opengl)
+#include <QtQuick/private/qsgetcencoder_p.h>
+#endif
+#include <QtCore/qendian.h>
 #include <QtQml/qqmlengine.h>
 #include <QtQuick/qquickimageprovider.h>
 #include <QNetworkReply>
@@ -62,6 +66,10 @@ private slots:
 #endif
     void lockingCrash();
     void uncached();
+    void lowPriority();
+#if QT_CONFIG(opengl)
+    void etcEncoding();
+#endif
 #if PIXMAP_DATA_LEAK_TEST
     void dataLeak();
 #endif
@@ -473,6 +481,62 @@ void tst_qquickpixmapcache::uncached()
     }
 }
 
+void tst_qquickpixmapcache::lowPriority()
+{
+    // Low priority and cancelled requests must still be handled by the
+    // decoders like any other one
+    const QQuickPixmap::Options options = QQuickPixmap::Asynchronous;
+    QQuickPixmap low;
+    low.load(&engine, testFileUrl("exists1.png"), QSize(), options | QQuickPixmap::LowPriority);
+    QQuickPixmap normal;
+    normal.load(&engine, testFileUrl("exists2.png"), QSize(), options);
+    QQuickPixmap raised;
+    raised.load(&engine, testFileUrl("exists.png"), QSize(), options | QQuickPixmap::LowPriority);
+    raised.setLowPriority(false);
+    for (int i = 0; i < 20; ++i) {
+        QQuickPixmap dropped;
+        dropped.load(&engine, testFileUrl("massive.png"), QSize(), options | QQuickPixmap::LowPriority);
+        dropped.setLowPriority(i % 2);
+    }
+
+    QTRY_VERIFY(low.isReady());
+    QTRY_VERIFY(normal.isReady());
+    QTRY_VERIFY(raised.isReady());
+    QVERIFY(!low.image().isNull());
+    QVERIFY(!normal.image().isNull());
+    QVERIFY(!raised.image().isNull());
+}
+
+#if QT_CONFIG(opengl)
+void tst_qquickpixmapcache::etcEncoding()
+{
+    QImage image(10, 6, QImage::Format_RGB32);
+    image.fill(qRgb(200, 40, 90));
+
+    const QByteArray pkm = QSGEtcEncoder::encodePkm(image);
+    // 3x2 blocks of 8 bytes after the 16 byte header
+    QCOMPARE(pkm.size(), 16 + 6 * 8);
+    QVERIFY(pkm.startsWith("PKM 10"));
+    const char *header = pkm.constData();
+    QCOMPARE(qFromBigEndian<quint16>(header + 6), quint16(0));
+    QCOMPARE(qFromBigEndian<quint16>(header + 8), quint16(12));
+    QCOMPARE(qFromBigEndian<quint16>(header + 10), quint16(8));
+    QCOMPARE(qFromBigEndian<quint16>(header + 12), quint16(10));
+    QCOMPARE(qFromBigEndian<quint16>(header + 14), quint16(6));
+
+    // A solid color gives the same block everywhere, in differential mode
+    // with the closest 5 bit base color.
+    const quint64 block = qFromBigEndian<quint64>(header + 16);
+    QVERIFY(block & (Q_UINT64_C(1) << 33));
+    QCOMPARE(int((block >> 59) & 31), (200 * 31 + 127) / 255);
+    QCOMPARE(int((block >> 51) & 31), (40 * 31 + 127) / 255);
+    QCOMPARE(int((block >> 43) & 31), (90 * 31 + 127) / 255);
+    for (int i = 1; i < 6; ++i)
+        QCOMPARE(qFromBigEndian<quint64>(header + 16 + i * 8), block);
+
+    QVERIFY(QSGEtcEncoder::encodePkm(QImage()).isEmpty());
+}
+#endif
 
 #if PIXMAP_DATA_LEAK_TEST
 // This test should not be enabled by default as it
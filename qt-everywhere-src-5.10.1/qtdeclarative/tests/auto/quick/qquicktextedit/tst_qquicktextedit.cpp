@@ -47,6 +47,7 @@
 #include <QClipboard>
 #include <QMimeData>
 #include <private/qquicktextcontrol_p.h>
+#include <private/qquickitem_p.h>
 #include "../../shared/util.h"
 #include "../../shared/platformquirks.h"
 #include "../../shared/platforminputcontext.h"
@@ -205,6 +206,7 @@ private slots:
 
     void padding();
     void QTBUG_51115_readOnlyResetsSelection();
+    void selectionKeepsUnchangedNodes();
 
 private:
     void simulateKeys(QWindow *window, const QList<Key> &keys);
@@ -5667,6 +5669,49 @@ void tst_qquicktextedit::QTBUG_51115_readOnlyResetsSelection()
     QCOMPARE(obj->selectedText(), QString());
 }
 
+static QSet<QSGNode *> textEditChildNodes(QQuickTextEdit *textEdit)
+{
+    QSet<QSGNode *> nodes;
+    QSGNode *root = QQuickItemPrivate::get(textEdit)->paintNode;
+    for (QSGNode *node = root ? root->firstChild() : 0; node; node = node->nextSibling())
+        nodes.insert(node);
+    return nodes;
+}
+
+void tst_qquicktextedit::selectionKeepsUnchangedNodes()
+{
+    QQuickView view;
+    view.setResizeMode(QQuickView::SizeRootObjectToView);
+    view.resize(200, 200);
+    QQmlComponent component(view.engine());
+    component.setData("import QtQuick 2.0\nTextEdit { wrapMode: TextEdit.Wrap }", QUrl());
+    view.setContent(QUrl(), &component, component.create());
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QQuickTextEdit *textEdit = qobject_cast<QQuickTextEdit *>(view.rootObject());
+    QVERIFY(textEdit);
+
+    // Every paragraph is longer than the node breaking size, so each one gets its own node
+    QStringList paragraphs;
+    for (int i = 0; i < 10; ++i)
+        paragraphs.append(QString(400, QLatin1Char('a' + i)));
+    const int paragraphLength = paragraphs.first().length() + 1;
+
+    QSignalSpy frameSpy(&view, SIGNAL(frameSwapped()));
+    textEdit->setText(paragraphs.join(QLatin1Char('\n')));
+    textEdit->select(2 * paragraphLength + 10, 8 * paragraphLength + 10);
+    QTRY_VERIFY(frameSpy.count() > 0);
+    const QSet<QSGNode *> before = textEditChildNodes(textEdit);
+
+    // Moving the end of the selection only touches the last two paragraphs
+    frameSpy.clear();
+    textEdit->select(2 * paragraphLength + 10, 9 * paragraphLength + 10);
+    QTRY_VERIFY(frameSpy.count() > 0);
+    const QSet<QSGNode *> after = textEditChildNodes(textEdit);
+
+    QCOMPARE(QSet<QSGNode *>(before).intersect(after).count(), 8);
+}
+
 QTEST_MAIN(tst_qquicktextedit)
 
 #include "tst_qquicktextedit.moc"
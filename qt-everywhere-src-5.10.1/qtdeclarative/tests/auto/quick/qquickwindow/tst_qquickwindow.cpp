@@ -317,6 +317,7 @@ private slots:
     void mouseFiltering();
     void headless();
     void noUpdateWhenNothingChanges();
+    void frameStatistics();
 
     void touchEvent_basic();
     void touchEvent_propagation();
@@ -1514,6 +1515,35 @@ void tst_qquickwindow::noUpdateWhenNothingChanges()
     QCOMPARE(spy.size(), 0);
 }
 
+void tst_qquickwindow::frameStatistics()
+{
+    QQuickWindow window;
+    window.setTitle(QTest::currentTestFunction());
+    window.setGeometry(100, 100, 300, 200);
+
+    QQuickWindow::FrameStatistics stats = window.frameStatistics();
+    QCOMPARE(stats.frameCount, 0);
+    QCOMPARE(stats.lateSyncCount, 0);
+
+    QQuickRectangle rect(window.contentItem());
+    window.showNormal();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    if (QQuickWindowPrivate::get(&window)->context->thread() == QGuiApplication::instance()->thread())
+        QSKIP("Only threaded renderloop implements this feature");
+
+    QTRY_VERIFY(window.frameStatistics().frameCount > 0);
+    stats = window.frameStatistics();
+    QVERIFY(stats.lateSyncCount <= stats.frameCount);
+    QVERIFY(stats.renderAhead >= 0 && stats.renderAhead <= 2);
+    QVERIFY(stats.frameInterval > 0);
+    QVERIFY(stats.predictedPresentTime >= stats.lastPresentTime);
+
+    QSignalSpy spy(&window, SIGNAL(frameSwapped()));
+    window.update();
+    QTRY_VERIFY(spy.count() > 0);
+    QTRY_VERIFY(window.frameStatistics().frameCount > stats.frameCount);
+}
+
 void tst_qquickwindow::focusObject()
 {
     QQmlEngine engine;
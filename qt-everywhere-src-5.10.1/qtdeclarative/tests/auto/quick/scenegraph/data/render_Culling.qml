@@ -0,0 +1,100 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+import QtQuick 2.2
+
+/*
+    The test verifies that elements which are culled because they are
+    outside the window, outside their clip or covered by an opaque
+    rectangle are drawn again once they become visible.
+
+    #samples: 6
+                 PixelPos     R    G    B    Error-tolerance
+    #base:       30  30      0.0  1.0  0.0        0.05
+    #base:      140  30      1.0  1.0  1.0        0.05
+    #base:       80  70      1.0  1.0  1.0        0.05
+    #final:      30  30      1.0  0.5  0.5        0.05
+    #final:     140  30      0.0  0.0  1.0        0.05
+    #final:      80  70      0.0  0.0  0.0        0.05
+*/
+
+Item {
+    id: root
+    width: 200
+    height: 100
+
+    property bool finalStageComplete: false
+
+    function enterFinalStage() {
+        cover.visible = false;
+        offscreen.x = 120;
+        clipped.y = 0;
+        finalStageComplete = true;
+    }
+
+    Rectangle {
+        x: 10
+        y: 10
+        width: 40
+        height: 40
+        color: "#ff0000"
+        opacity: 0.5
+    }
+
+    Rectangle {
+        id: cover
+        width: 60
+        height: 60
+        color: "#00ff00"
+    }
+
+    Rectangle {
+        id: offscreen
+        x: 250
+        y: 10
+        width: 40
+        height: 40
+        color: "#0000ff"
+    }
+
+    Item {
+        x: 70
+        y: 60
+        width: 40
+        height: 30
+        clip: true
+
+        Rectangle {
+            id: clipped
+            y: -100
+            width: 40
+            height: 30
+            color: "#000000"
+        }
+    }
+}
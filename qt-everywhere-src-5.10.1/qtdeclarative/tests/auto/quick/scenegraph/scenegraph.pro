@@ -13,4 +13,5 @@ QT += core-private gui-private qml-private quick-private  testlib
 OTHER_FILES += \
     data/render_OutOfFloatRange.qml \
     data/simple.qml \
-    data/render_ImageFiltering.qml
+    data/render_ImageFiltering.qml \
+    data/render_Culling.qml
@@ -43,6 +43,7 @@
 
 #include <private/qsgcontext_p.h>
 #include <private/qsgrenderloop_p.h>
+#include <private/qsgdistancefielddiskcache_p.h>
 
 #include "../../shared/util.h"
 #include "../shared/visualtestutil.h"
@@ -110,6 +111,7 @@ private slots:
 #endif
     void createTextureFromImage_data();
     void createTextureFromImage();
+    void distanceFieldDiskCache();
 
 private:
     bool m_brokenMipmapSupport;
@@ -386,7 +388,8 @@ void tst_SceneGraph::render_data()
           << "render_StackingOrder.qml"
           << "render_ImageFiltering.qml"
           << "render_bug37422.qml"
-          << "render_OpacityThroughBatchRoot.qml";
+          << "render_OpacityThroughBatchRoot.qml"
+          << "render_Culling.qml";
     if (!m_brokenMipmapSupport)
           files << "render_Mipmap.qml";
 
@@ -549,6 +552,49 @@ void tst_SceneGraph::createTextureFromImage()
     QCOMPARE(texture->hasAlphaChannel(), expectedAlpha);
 }
 
+void tst_SceneGraph::distanceFieldDiskCache()
+{
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+    qputenv("QSG_DISTANCEFIELD_DISK_CACHE_PATH", QFile::encodeName(cacheDir.path()));
+
+    QRawFont font = QRawFont::fromFont(QFont());
+    if (font.fontTable("head").isEmpty())
+        QSKIP("The default font has no SFNT tables");
+    font.setPixelSize(QT_DISTANCEFIELD_BASEFONTSIZE(false) * QT_DISTANCEFIELD_SCALE(false));
+    const QVector<quint32> glyphs = font.glyphIndexesForString(QStringLiteral("Ag"));
+    QCOMPARE(glyphs.size(), 2);
+
+    QList<QDistanceField> fields;
+    for (quint32 glyph : glyphs)
+        fields.append(QDistanceField(font.pathForGlyph(glyph), glyph));
+
+    {
+        QSGDistanceFieldDiskCache cache(font, false);
+        QVERIFY(cache.isValid());
+        QVERIFY(cache.glyph(glyphs.at(0)).isNull());
+        cache.store(fields);
+        QVERIFY(QFile::exists(cache.fileName()));
+    }
+
+    // A new cache maps the file written by the previous one
+    QSGDistanceFieldDiskCache cache(font, false);
+    for (const QDistanceField &field : qAsConst(fields)) {
+        const QDistanceField cached = cache.glyph(field.glyph());
+        QVERIFY(!cached.isNull());
+        QCOMPARE(cached.glyph(), field.glyph());
+        QCOMPARE(cached.width(), field.width());
+        QCOMPARE(cached.height(), field.height());
+        QVERIFY(memcmp(cached.constBits(), field.constBits(), field.width() * field.height()) == 0);
+    }
+
+    // The parameters of the distance fields are part of the key
+    QSGDistanceFieldDiskCache doubleResolutionCache(font, true);
+    QVERIFY(doubleResolutionCache.fileName() != cache.fileName());
+    QVERIFY(doubleResolutionCache.glyph(glyphs.at(0)).isNull());
+
+    qunsetenv("QSG_DISTANCEFIELD_DISK_CACHE_PATH");
+}
 
 #include "tst_scenegraph.moc"
 
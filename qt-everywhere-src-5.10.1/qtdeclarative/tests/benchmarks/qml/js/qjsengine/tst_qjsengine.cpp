@@ -206,6 +206,14 @@ void tst_QJSEngine::evaluate_data()
     QTest::newRow("while loop (100000 iterations)") << QString::fromLatin1("i = 0; while (i < 100000) { ++i; }; i");
     QTest::newRow("while loop (1000000 iterations)") << QString::fromLatin1("i = 0; while (i < 1000000) { ++i; }; i");
     QTest::newRow("function expression") << QString::fromLatin1("(function(a, b, c){ return a + b + c; })(1, 2, 3)");
+    QTest::newRow("string concatenation (10000 iterations)") << QString::fromLatin1("s = ''; for (i = 0; i < 10000; ++i) { s += 'item' + i + ', '; }; s.length");
+    QTest::newRow("JSON assembly (1000 objects)") << QString::fromLatin1(
+        "s = '['; for (i = 0; i < 1000; ++i) { if (i) s += ','; s += '{\"id\":' + i + ',\"name\":\"item' + i + '\",\"tags\":[\"a\",\"b\"]}'; }; s += ']'; JSON.parse(s).length");
+    QTest::newRow("template expansion (1000 iterations)") << QString::fromLatin1(
+        "t = 'Hello {name}, you have {count} new messages from {sender}.'; s = '';"
+        "for (i = 0; i < 1000; ++i) { s += t.replace('{name}', 'user' + i).replace('{count}', i).replace('{sender}', 'admin') + '\\n'; }; s.length");
+    QTest::newRow("substrings of a long string (10000 iterations)") << QString::fromLatin1(
+        "s = ''; for (i = 0; i < 100; ++i) s += 'abcdefghij'; n = 0; for (i = 0; i < 10000; ++i) { n += (s.substring(i % 100, 900) + s.slice(-500)).length; }; n");
 }
 
 void tst_QJSEngine::evaluate()
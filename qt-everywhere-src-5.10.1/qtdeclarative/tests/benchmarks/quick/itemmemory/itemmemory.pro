@@ -0,0 +1,7 @@
+CONFIG += benchmark
+TEMPLATE = app
+TARGET = tst_itemmemory
+QT += quick-private qml testlib
+macos:CONFIG -= app_bundle
+
+SOURCES += tst_itemmemory.cpp
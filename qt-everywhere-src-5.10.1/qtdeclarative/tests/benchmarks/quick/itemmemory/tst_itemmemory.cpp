@@ -0,0 +1,117 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <qtest.h>
+#include <QtQml/QQmlComponent>
+#include <QtQml/QQmlEngine>
+#include <QtQuick/QQuickItem>
+#include <QtQuick/private/qquickitem_p.h>
+#include <QDebug>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+// Memory used by each item, as reported by the allocator. Only the heap is
+// taken into account, the scene graph nodes are not created here.
+class tst_ItemMemory : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void privateSize();
+    void items_data();
+    void items();
+};
+
+static qint64 allocatedBytes()
+{
+#if defined(__GLIBC__)
+    return mallinfo().uordblks;
+#else
+    return -1;
+#endif
+}
+
+void tst_ItemMemory::privateSize()
+{
+    qDebug() << "QQuickItem:" << sizeof(QQuickItem)
+             << "QQuickItemPrivate:" << sizeof(QQuickItemPrivate)
+             << "QQuickItemPrivate::ExtraData:" << sizeof(QQuickItemPrivate::ExtraData);
+    QTest::setBenchmarkResult(sizeof(QQuickItemPrivate), QTest::BytesAllocated);
+}
+
+void tst_ItemMemory::items_data()
+{
+    QTest::addColumn<QByteArray>("qml");
+
+    QTest::newRow("Item") << QByteArray("import QtQuick 2.0\nItem {}");
+    QTest::newRow("Item with size") << QByteArray("import QtQuick 2.0\nItem { width: 10; height: 10 }");
+    QTest::newRow("Rectangle") << QByteArray("import QtQuick 2.0\nRectangle { width: 10; height: 10; color: \"red\" }");
+    QTest::newRow("Rectangle with z") << QByteArray("import QtQuick 2.0\nRectangle { width: 10; height: 10; z: 1 }");
+    QTest::newRow("Text") << QByteArray("import QtQuick 2.0\nText { text: \"Hello\" }");
+}
+
+void tst_ItemMemory::items()
+{
+    QFETCH(QByteArray, qml);
+
+    if (allocatedBytes() < 0)
+        QSKIP("Allocated memory can only be measured with glibc");
+
+    const int count = 10000;
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine);
+    component.setData(qml, QUrl());
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+
+    QQuickItem root;
+    // One time allocations for the type are not part of the per item cost
+    delete component.create();
+
+    QList<QObject *> objects;
+    objects.reserve(count);
+
+    const qint64 before = allocatedBytes();
+    for (int i = 0; i < count; ++i) {
+        QQuickItem *item = qobject_cast<QQuickItem *>(component.create());
+        item->setParentItem(&root);
+        objects.append(item);
+    }
+    const qint64 after = allocatedBytes();
+
+    QCOMPARE(root.childItems().count(), count);
+    qDeleteAll(objects);
+
+    QTest::setBenchmarkResult((after - before) / count, QTest::BytesAllocated);
+}
+
+QTEST_MAIN(tst_ItemMemory)
+
+#include "tst_itemmemory.moc"
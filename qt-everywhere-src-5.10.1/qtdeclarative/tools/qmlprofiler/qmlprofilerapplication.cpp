@@ -67,9 +67,18 @@ static const char *features[] = {
     "binding",
     "handlingsignal",
     "inputevents",
-    "debugmessages"
+    "debugmessages",
+    "heapsnapshot",
+    "javascriptsamples"
 };
 
+// Taking a heap snapshot runs a full garbage collection when the recording stops, and
+// sampling is meant to replace the instrumentation, so they are only done when asked for
+// explicitly.
+static const quint64 defaultFeatures = std::numeric_limits<quint64>::max()
+        & ~(static_cast<quint64>(1) << QQmlProfilerDefinitions::ProfileHeapSnapshot)
+        & ~(static_cast<quint64>(1) << QQmlProfilerDefinitions::ProfileJavaScriptSamples);
+
 Q_STATIC_ASSERT(sizeof(features) ==
                 QQmlProfilerDefinitions::MaximumProfileFeature * sizeof(char *));
 
@@ -164,8 +173,14 @@ void QmlProfilerApplication::parseArguments()
 
     QCommandLineOption include(QLatin1String("include"),
                                tr("Comma-separated list of features to record. By default all "
-                                  "features supported by the QML engine are recorded. If --include "
-                                  "is specified, only the given features will be recorded. "
+                                  "features supported by the QML engine, except for heapsnapshot "
+                                  "and javascriptsamples, are recorded. If --include is specified, "
+                                  "only the given features will be recorded. A heap snapshot is "
+                                  "taken whenever the recording stops, and saved next to the trace "
+                                  "file. javascriptsamples periodically samples the JavaScript "
+                                  "stack instead of recording every call, which is much cheaper. "
+                                  "The samples are saved next to the trace file, in the folded "
+                                  "format used by flame graph tools. "
                                   "The following features are unserstood by qmlprofiler: %1").arg(
                                    featureList.join(", ")),
                                QLatin1String("feature,..."));
@@ -224,7 +239,7 @@ void QmlProfilerApplication::parseArguments()
     m_recording = (parser.value(record) == QLatin1String("on"));
     m_interactive = parser.isSet(interactive);
 
-    quint64 features = std::numeric_limits<quint64>::max();
+    quint64 features = defaultFeatures;
     if (parser.isSet(include)) {
         if (parser.isSet(exclude)) {
             logError(tr("qmlprofiler can only process either --include or --exclude, not both."));
@@ -273,7 +288,7 @@ bool QmlProfilerApplication::isInteractive() const
 quint64 QmlProfilerApplication::parseFeatures(const QStringList &featureList, const QString &values,
                                               bool exclude)
 {
-    quint64 features = exclude ? std::numeric_limits<quint64>::max() : 0;
+    quint64 features = exclude ? defaultFeatures : 0;
     const QStringList givenFeatures = values.split(QLatin1Char(','));
     for (const QString &f : givenFeatures) {
         int index =  featureList.indexOf(f);
@@ -282,7 +297,7 @@ quint64 QmlProfilerApplication::parseFeatures(const QStringList &featureList, co
             return 0;
         }
         quint64 flag = static_cast<quint64>(1) << index;
-        features = (exclude ? (features ^ flag) : (features | flag));
+        features = (exclude ? (features & ~flag) : (features | flag));
     }
     if (features == 0) {
         logError(exclude ? tr("No features remaining to record after processing --exclude.") :
@@ -186,6 +186,18 @@ void QmlProfilerClient::memoryAllocation(QQmlProfilerDefinitions::MemoryType typ
     d->data->addMemoryEvent(type, time, amount);
 }
 
+void QmlProfilerClient::heapSnapshot(qint64 time, const QByteArray &snapshot)
+{
+    Q_D(QmlProfilerClient);
+    d->data->addHeapSnapshot(time, snapshot);
+}
+
+void QmlProfilerClient::javaScriptSamples(qint64 time, const QByteArray &foldedStacks)
+{
+    Q_D(QmlProfilerClient);
+    d->data->addJavaScriptSamples(time, foldedStacks);
+}
+
 void QmlProfilerClient::inputEvent(QQmlProfilerDefinitions::InputEventType type, qint64 time,
                                    int a, int b)
 {
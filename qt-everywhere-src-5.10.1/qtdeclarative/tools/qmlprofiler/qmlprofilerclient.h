@@ -66,6 +66,8 @@ private:
     void pixmapCacheEvent(QQmlProfilerDefinitions::PixmapEventType type, qint64 time,
                           const QString &url, int numericData1, int numericData2) override;
     void memoryAllocation(QQmlProfilerDefinitions::MemoryType type, qint64 time, qint64 amount) override;
+    void heapSnapshot(qint64 time, const QByteArray &snapshot) override;
+    void javaScriptSamples(qint64 time, const QByteArray &foldedStacks) override;
     void inputEvent(QQmlProfilerDefinitions::InputEventType type, qint64 time, int a, int b) override;
     void complete() override;
 };
@@ -60,7 +60,10 @@ static const char *MESSAGE_STRINGS[] = {
     "Complete",
     "PixmapCache",
     "SceneGraph",
-    "MemoryAllocation"
+    "MemoryAllocation",
+    "HeapSnapshot",
+    "RegExpStatistics",
+    "JavaScriptSamples"
 };
 
 Q_STATIC_ASSERT(sizeof(MESSAGE_STRINGS) ==
@@ -135,6 +138,8 @@ public:
     // data storage
     QHash<QString, QmlRangeEventData *> eventDescriptions;
     QVector<QmlRangeEventStartInstance> startInstanceList;
+    QVector<QByteArray> heapSnapshots;
+    QByteArray foldedStacks;
 
     qint64 traceStartTime;
     qint64 traceEndTime;
@@ -163,6 +168,8 @@ void QmlProfilerData::clear()
     qDeleteAll(d->eventDescriptions);
     d->eventDescriptions.clear();
     d->startInstanceList.clear();
+    d->heapSnapshots.clear();
+    d->foldedStacks.clear();
 
     d->traceEndTime = std::numeric_limits<qint64>::min();
     d->traceStartTime = std::numeric_limits<qint64>::max();
@@ -346,6 +353,21 @@ void QmlProfilerData::addPixmapCacheEvent(QQmlProfilerDefinitions::PixmapEventTy
     d->startInstanceList.append(rangeEventStartInstance);
 }
 
+void QmlProfilerData::addHeapSnapshot(qint64 time, const QByteArray &snapshot)
+{
+    Q_UNUSED(time);
+    setState(AcquiringData);
+    d->heapSnapshots.append(snapshot);
+}
+
+void QmlProfilerData::addJavaScriptSamples(qint64 time, const QByteArray &foldedStacks)
+{
+    Q_UNUSED(time);
+    setState(AcquiringData);
+    // The same stack can appear in several blocks, flame graph tools add them up.
+    d->foldedStacks += foldedStacks;
+}
+
 void QmlProfilerData::addMemoryEvent(QQmlProfilerDefinitions::MemoryType type, qint64 time,
                                      qint64 size)
 {
@@ -479,7 +501,8 @@ void QmlProfilerData::complete()
 
 bool QmlProfilerData::isEmpty() const
 {
-    return d->startInstanceList.isEmpty();
+    return d->startInstanceList.isEmpty() && d->heapSnapshots.isEmpty()
+            && d->foldedStacks.isEmpty();
 }
 
 bool QmlProfilerData::save(const QString &filename)
@@ -640,6 +663,30 @@ bool QmlProfilerData::save(const QString &filename)
     stream.writeEndDocument();
 
     file.close();
+
+    // Heap snapshots and samples go into separate files next to the trace
+    if ((!d->heapSnapshots.isEmpty() || !d->foldedStacks.isEmpty()) && filename.isEmpty()) {
+        emit error(tr("Heap snapshots and samples cannot be written to stdout"));
+        return false;
+    }
+    if (!d->foldedStacks.isEmpty()) {
+        const QString foldedFilename = filename + QLatin1String(".folded");
+        QFile foldedFile(foldedFilename);
+        if (!foldedFile.open(QIODevice::WriteOnly)
+                || foldedFile.write(d->foldedStacks) != d->foldedStacks.size()) {
+            emit error(tr("Could not write %1").arg(foldedFilename));
+            return false;
+        }
+    }
+    for (int i = 0; i < d->heapSnapshots.size(); ++i) {
+        const QString snapshotFilename = QString::fromLatin1("%1.%2.heapsnapshot").arg(filename).arg(i);
+        QFile snapshotFile(snapshotFilename);
+        if (!snapshotFile.open(QIODevice::WriteOnly)
+                || snapshotFile.write(d->heapSnapshots.at(i)) != d->heapSnapshots.at(i).size()) {
+            emit error(tr("Could not write %1").arg(snapshotFilename));
+            return false;
+        }
+    }
     return true;
 }
 
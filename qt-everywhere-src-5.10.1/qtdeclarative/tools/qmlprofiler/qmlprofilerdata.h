@@ -73,6 +73,8 @@ public:
                              const QString &location, int numericData1, int numericData2);
     void addMemoryEvent(QQmlProfilerDefinitions::MemoryType type, qint64 time, qint64 size);
     void addInputEvent(QQmlProfilerDefinitions::InputEventType type, qint64 time, int a, int b);
+    void addHeapSnapshot(qint64 time, const QByteArray &snapshot);
+    void addJavaScriptSamples(qint64 time, const QByteArray &foldedStacks);
 
     void complete();
     bool save(const QString &filename);
@@ -49,6 +49,8 @@
 
 QT_BEGIN_NAMESPACE
 #define PREFETCH_FRUSTUM_SCALE 2.0
+// How many camera changes ahead tiles are requested while the map is moving
+#define PREFETCH_MOTION_STEPS 8.0
 
 static const double invLog2 = 1.0 / std::log(2.0);
 
@@ -210,6 +212,9 @@ QGeoTiledMapPrivate::~QGeoTiledMapPrivate()
 
 void QGeoTiledMapPrivate::prefetchTiles()
 {
+    // The map has stopped moving
+    m_cameraMotion = QDoubleVector2D();
+
     if (m_tileRequests && m_prefetchStyle != QGeoTiledMap::NoPrefetching) {
 
         QSet<QGeoTileSpec> tiles;
@@ -315,6 +320,22 @@ void QGeoTiledMapPrivate::changeCameraData(const QGeoCameraData &cameraData)
         cam.setZoomLevel(izl);
     }
 
+    // Track the panning direction, so that the tiles the map is moving
+    // towards can be requested before they become visible
+    const QGeoCameraData &previousCam = m_visibleTiles->cameraData();
+    if (previousCam.center().isValid() && cam.center().isValid()
+            && std::floor(previousCam.zoomLevel()) == std::floor(cam.zoomLevel())) {
+        m_cameraMotion = QWebMercator::coordToMercator(cam.center())
+                - QWebMercator::coordToMercator(previousCam.center());
+        // Take the shortest way around the antimeridian
+        if (m_cameraMotion.x() > 0.5)
+            m_cameraMotion.setX(m_cameraMotion.x() - 1.0);
+        else if (m_cameraMotion.x() < -0.5)
+            m_cameraMotion.setX(m_cameraMotion.x() + 1.0);
+    } else {
+        m_cameraMotion = QDoubleVector2D();
+    }
+
     m_visibleTiles->setCameraData(cam);
     m_mapScene->setCameraData(cam);
 
@@ -333,17 +354,44 @@ void QGeoTiledMapPrivate::updateScene()
     if (newTilesIntroduced && m_copyrightVisible)
         q->evaluateCopyrights(tiles);
 
+    // Requesting the tiles ahead of the camera in the same call keeps the
+    // request manager from cancelling them again
+    QSet<QGeoTileSpec> requestedTiles = tiles;
+    requestedTiles += motionPrefetchTiles();
+
     // don't request tiles that are already built and textured
     QMap<QGeoTileSpec, QSharedPointer<QGeoTileTexture> > cachedTiles =
-            m_tileRequests->requestTiles(m_visibleTiles->createTiles() - m_mapScene->texturedTiles());
+            m_tileRequests->requestTiles(requestedTiles - m_mapScene->texturedTiles());
 
-    for (auto it = cachedTiles.cbegin(); it != cachedTiles.cend(); ++it)
+    bool visibleTilesAdded = false;
+    for (auto it = cachedTiles.cbegin(); it != cachedTiles.cend(); ++it) {
+        if (!tiles.contains(it.key()))
+            continue;
         m_mapScene->addTile(it.key(), it.value());
+        visibleTilesAdded = true;
+    }
 
-    if (!cachedTiles.isEmpty())
+    if (visibleTilesAdded)
         emit q->sgNodeChanged();
 }
 
+QSet<QGeoTileSpec> QGeoTiledMapPrivate::motionPrefetchTiles()
+{
+    if (m_prefetchStyle == QGeoTiledMap::NoPrefetching || m_cameraMotion.isNull())
+        return QSet<QGeoTileSpec>();
+
+    QGeoCameraData camera = m_visibleTiles->cameraData();
+    QDoubleVector2D center = QWebMercator::coordToMercator(camera.center())
+            + m_cameraMotion * PREFETCH_MOTION_STEPS;
+    center.setX(center.x() - std::floor(center.x()));
+    center.setY(qBound(0.0, center.y(), 1.0));
+    camera.setCenter(QWebMercator::mercatorToCoord(center));
+
+    m_prefetchTiles->setCameraData(camera);
+    m_prefetchTiles->setViewExpansion(1.0);
+    return m_prefetchTiles->createTiles();
+}
+
 void QGeoTiledMapPrivate::changeActiveMapType(const QGeoMapType mapType)
 {
     m_visibleTiles->setTileSize(m_cameraCapabilities.tileSize());
@@ -90,6 +90,7 @@ protected:
     void clearScene();
 
     void updateScene();
+    QSet<QGeoTileSpec> motionPrefetchTiles();
 
 protected:
     QAbstractGeoTileCache *m_cache;
@@ -100,6 +101,8 @@ protected:
     int m_maxZoomLevel;
     int m_minZoomLevel;
     QGeoTiledMap::PrefetchStyle m_prefetchStyle;
+    // Camera motion between the last two camera changes, in mercator units
+    QDoubleVector2D m_cameraMotion;
     Q_DISABLE_COPY(QGeoTiledMapPrivate)
 };
 
@@ -0,0 +1 @@
+#include "../../../../../src/qtmultimediaquicktools/qsgvideonode_egl_p.h"
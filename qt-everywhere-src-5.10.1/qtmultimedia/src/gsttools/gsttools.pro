@@ -93,6 +93,10 @@ qtConfig(mirclient): {
     }
 }
 
+qtConfig(gstreamer_eglimage) {
+    QMAKE_USE += gstreamer_allocators egl
+}
+
 qtConfig(gstreamer_app) {
     QMAKE_USE += gstreamer_app
     PRIVATE_HEADERS += qgstappsrc_p.h
@@ -54,17 +54,184 @@
 
 #include "qgstutils_p.h"
 
+#if QT_CONFIG(gstreamer_eglimage)
+#include <QtGui/qguiapplication.h>
+#include <qpa/qplatformnativeinterface.h>
+
+#include <gst/allocators/gstdmabuf.h>
+
+#include <string.h>
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
 //#define DEBUG_VIDEO_SURFACE_SINK
 
 QT_BEGIN_NAMESPACE
 
+#if QT_CONFIG(gstreamer_eglimage)
+
+// See drm_fourcc.h
+#define QT_DRM_FOURCC(a, b, c, d) \
+    (EGLint(a) | (EGLint(b) << 8) | (EGLint(c) << 16) | (EGLint(d) << 24))
+
+static EGLint drmFourccForVideoFormat(GstVideoFormat format)
+{
+    switch (format) {
+    case GST_VIDEO_FORMAT_BGRx: return QT_DRM_FOURCC('X', 'R', '2', '4');
+    case GST_VIDEO_FORMAT_BGRA: return QT_DRM_FOURCC('A', 'R', '2', '4');
+    case GST_VIDEO_FORMAT_RGBx: return QT_DRM_FOURCC('X', 'B', '2', '4');
+    case GST_VIDEO_FORMAT_xRGB: return QT_DRM_FOURCC('B', 'X', '2', '4');
+    case GST_VIDEO_FORMAT_xBGR: return QT_DRM_FOURCC('R', 'X', '2', '4');
+    case GST_VIDEO_FORMAT_ARGB: return QT_DRM_FOURCC('B', 'A', '2', '4');
+    case GST_VIDEO_FORMAT_RGB16: return QT_DRM_FOURCC('R', 'G', '1', '6');
+    case GST_VIDEO_FORMAT_I420: return QT_DRM_FOURCC('Y', 'U', '1', '2');
+    case GST_VIDEO_FORMAT_YV12: return QT_DRM_FOURCC('Y', 'V', '1', '2');
+    case GST_VIDEO_FORMAT_UYVY: return QT_DRM_FOURCC('U', 'Y', 'V', 'Y');
+    case GST_VIDEO_FORMAT_YUY2: return QT_DRM_FOURCC('Y', 'U', 'Y', 'V');
+    case GST_VIDEO_FORMAT_NV12: return QT_DRM_FOURCC('N', 'V', '1', '2');
+    case GST_VIDEO_FORMAT_NV21: return QT_DRM_FOURCC('N', 'V', '2', '1');
+    default: return 0;
+    }
+}
+
+class QGstEGLImageVideoBuffer : public QGstVideoBuffer
+{
+public:
+    QGstEGLImageVideoBuffer(GstBuffer *buffer, const GstVideoInfo &info,
+                            EGLDisplay display, EGLImageKHR image,
+                            PFNEGLDESTROYIMAGEKHRPROC destroyImage)
+        : QGstVideoBuffer(buffer, info, EGLImageHandle, QVariant::fromValue<void *>(image))
+        , m_display(display)
+        , m_image(image)
+        , m_destroyImage(destroyImage)
+    {
+    }
+
+    ~QGstEGLImageVideoBuffer()
+    {
+        // Textures created from the image keep its storage alive, so this is
+        // safe even if the scene graph is still sampling the frame.
+        m_destroyImage(m_display, m_image);
+    }
+
+private:
+    EGLDisplay m_display;
+    EGLImageKHR m_image;
+    PFNEGLDESTROYIMAGEKHRPROC m_destroyImage;
+};
+
+/*
+    Wraps buffers backed by DMABUF memory, as produced by many hardware
+    decoders, in EGL images so they can be handed to the GPU without being
+    mapped and copied by the CPU.
+*/
+class QGstEGLImageImporter
+{
+public:
+    QGstEGLImageImporter()
+        : m_display(EGL_NO_DISPLAY)
+        , m_createImage(0)
+        , m_destroyImage(0)
+    {
+        QPlatformNativeInterface *nativeInterface = QGuiApplication::platformNativeInterface();
+        if (!nativeInterface)
+            return;
+
+        EGLDisplay display = nativeInterface->nativeResourceForIntegration("egldisplay");
+        if (!display)
+            return;
+
+        const char *extensions = eglQueryString(display, EGL_EXTENSIONS);
+        if (!extensions || !strstr(extensions, "EGL_EXT_image_dma_buf_import"))
+            return;
+
+        m_createImage = reinterpret_cast<PFNEGLCREATEIMAGEKHRPROC>(eglGetProcAddress("eglCreateImageKHR"));
+        m_destroyImage = reinterpret_cast<PFNEGLDESTROYIMAGEKHRPROC>(eglGetProcAddress("eglDestroyImageKHR"));
+        if (m_createImage && m_destroyImage)
+            m_display = display;
+    }
+
+    bool isValid() const { return m_display != EGL_NO_DISPLAY; }
+
+    QAbstractVideoBuffer *createBuffer(GstBuffer *buffer, const GstVideoInfo &info) const
+    {
+        static const EGLint planeAttributes[3][3] = {
+            { EGL_DMA_BUF_PLANE0_FD_EXT, EGL_DMA_BUF_PLANE0_OFFSET_EXT, EGL_DMA_BUF_PLANE0_PITCH_EXT },
+            { EGL_DMA_BUF_PLANE1_FD_EXT, EGL_DMA_BUF_PLANE1_OFFSET_EXT, EGL_DMA_BUF_PLANE1_PITCH_EXT },
+            { EGL_DMA_BUF_PLANE2_FD_EXT, EGL_DMA_BUF_PLANE2_OFFSET_EXT, EGL_DMA_BUF_PLANE2_PITCH_EXT }
+        };
+
+        const EGLint fourcc = drmFourccForVideoFormat(GST_VIDEO_INFO_FORMAT(&info));
+        const guint planeCount = GST_VIDEO_INFO_N_PLANES(&info);
+        if (!fourcc || planeCount > 3)
+            return 0;
+
+        const GstVideoMeta *meta = gst_buffer_get_video_meta(buffer);
+
+        EGLint attributes[6 + 3 * 6 + 1];
+        int i = 0;
+        attributes[i++] = EGL_WIDTH;
+        attributes[i++] = GST_VIDEO_INFO_WIDTH(&info);
+        attributes[i++] = EGL_HEIGHT;
+        attributes[i++] = GST_VIDEO_INFO_HEIGHT(&info);
+        attributes[i++] = EGL_LINUX_DRM_FOURCC_EXT;
+        attributes[i++] = fourcc;
+
+        for (guint plane = 0; plane < planeCount; ++plane) {
+            const gsize offset = meta ? meta->offset[plane] : GST_VIDEO_INFO_PLANE_OFFSET(&info, plane);
+            const gint stride = meta ? meta->stride[plane] : GST_VIDEO_INFO_PLANE_STRIDE(&info, plane);
+
+            guint index = 0;
+            guint length = 0;
+            gsize skip = 0;
+            if (!gst_buffer_find_memory(buffer, offset, 1, &index, &length, &skip))
+                return 0;
+
+            GstMemory *memory = gst_buffer_peek_memory(buffer, index);
+            if (!gst_is_dmabuf_memory(memory))
+                return 0;
+
+            attributes[i++] = planeAttributes[plane][0];
+            attributes[i++] = gst_dmabuf_memory_get_fd(memory);
+            attributes[i++] = planeAttributes[plane][1];
+            attributes[i++] = EGLint(memory->offset + skip);
+            attributes[i++] = planeAttributes[plane][2];
+            attributes[i++] = stride;
+        }
+        attributes[i] = EGL_NONE;
+
+        EGLImageKHR image = m_createImage(m_display, EGL_NO_CONTEXT, EGL_LINUX_DMA_BUF_EXT,
+                                          0, attributes);
+        if (image == EGL_NO_IMAGE_KHR)
+            return 0;
+
+        return new QGstEGLImageVideoBuffer(buffer, info, m_display, image, m_destroyImage);
+    }
+
+private:
+    EGLDisplay m_display;
+    PFNEGLCREATEIMAGEKHRPROC m_createImage;
+    PFNEGLDESTROYIMAGEKHRPROC m_destroyImage;
+};
+
+#endif // QT_CONFIG(gstreamer_eglimage)
+
 QGstDefaultVideoRenderer::QGstDefaultVideoRenderer()
     : m_flushed(true)
+#if QT_CONFIG(gstreamer_eglimage)
+    , m_eglImageImporter(0)
+    , m_useEGLImages(false)
+#endif
 {
 }
 
 QGstDefaultVideoRenderer::~QGstDefaultVideoRenderer()
 {
+#if QT_CONFIG(gstreamer_eglimage)
+    delete m_eglImageImporter;
+#endif
 }
 
 GstCaps *QGstDefaultVideoRenderer::getCaps(QAbstractVideoSurface *surface)
@@ -77,6 +244,19 @@ bool QGstDefaultVideoRenderer::start(QAbstractVideoSurface *surface, GstCaps *ca
     m_flushed = true;
     m_format = QGstUtils::formatForCaps(caps, &m_videoInfo);
 
+#if QT_CONFIG(gstreamer_eglimage)
+    // Surfaces that can render EGL images get DMABUF backed frames without
+    // any CPU copies. Other buffers are still presented as mappable memory.
+    m_useEGLImages = false;
+    if (m_format.isValid()
+            && drmFourccForVideoFormat(GST_VIDEO_INFO_FORMAT(&m_videoInfo))
+            && surface->supportedPixelFormats(QAbstractVideoBuffer::EGLImageHandle).contains(m_format.pixelFormat())) {
+        if (!m_eglImageImporter)
+            m_eglImageImporter = new QGstEGLImageImporter;
+        m_useEGLImages = m_eglImageImporter->isValid();
+    }
+#endif
+
     return m_format.isValid() && surface->start(m_format);
 }
 
@@ -90,8 +270,21 @@ void QGstDefaultVideoRenderer::stop(QAbstractVideoSurface *surface)
 bool QGstDefaultVideoRenderer::present(QAbstractVideoSurface *surface, GstBuffer *buffer)
 {
     m_flushed = false;
+
+    QAbstractVideoBuffer *videoBuffer = 0;
+#if QT_CONFIG(gstreamer_eglimage)
+    if (m_useEGLImages) {
+        videoBuffer = m_eglImageImporter->createBuffer(buffer, m_videoInfo);
+        // Buffers of a stream come from the same allocator, don't retry
+        // importing them once one of them could not be imported.
+        m_useEGLImages = videoBuffer != 0;
+    }
+#endif
+    if (!videoBuffer)
+        videoBuffer = new QGstVideoBuffer(buffer, m_videoInfo);
+
     QVideoFrame frame(
-                new QGstVideoBuffer(buffer, m_videoInfo),
+                videoBuffer,
                 m_format.frameSize(),
                 m_format.pixelFormat());
     QGstUtils::setFrameTimeStamps(&frame, buffer);
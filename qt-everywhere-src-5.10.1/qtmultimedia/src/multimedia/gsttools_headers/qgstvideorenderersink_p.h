@@ -51,6 +51,8 @@
 // We mean it.
 //
 
+#include <QtMultimedia/private/qtmultimediaglobal_p.h>
+
 #include <gst/video/gstvideosink.h>
 #include <gst/video/video.h>
 
@@ -69,6 +71,9 @@
 
 QT_BEGIN_NAMESPACE
 class QAbstractVideoSurface;
+#if QT_CONFIG(gstreamer_eglimage)
+class QGstEGLImageImporter;
+#endif
 
 class QGstDefaultVideoRenderer : public QGstVideoRenderer
 {
@@ -89,6 +94,10 @@ private:
     QVideoSurfaceFormat m_format;
     GstVideoInfo m_videoInfo;
     bool m_flushed;
+#if QT_CONFIG(gstreamer_eglimage)
+    QGstEGLImageImporter *m_eglImageImporter;
+    bool m_useEGLImages;
+#endif
 };
 
 class QVideoSurfaceGstDelegate : public QObject
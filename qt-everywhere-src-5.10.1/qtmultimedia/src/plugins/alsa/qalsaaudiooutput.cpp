@@ -385,6 +385,14 @@ bool QAlsaAudioOutput::open()
             errMessage = QString::fromLatin1("QAudioOutput: snd_pcm_hw_params_set_rate_near: err = %1").arg(err);
         }
     }
+    if ( !fatal && buffer_size > 0 ) {
+        // Honor the buffer size requested with setBufferSize(), which allows
+        // for lower latencies than the defaults. Small buffers are split into
+        // four periods so that they can be refilled in time.
+        buffer_time = (unsigned int)settings.durationForBytes(buffer_size);
+        period_time = qMin(buffer_time / 4, 20000u);
+        chunks = period_time ? buffer_time / period_time : 4;
+    }
     if ( !fatal ) {
         unsigned int maxBufferTime = 0;
         unsigned int minBufferTime = 0;
@@ -54,6 +54,7 @@ QT_BEGIN_NAMESPACE
 const int PeriodTimeMs = 20;
 const int LowLatencyPeriodTimeMs = 10;
 const int LowLatencyBufferSizeMs = 40;
+const int MinPeriodTimeMs = 1;
 
 #define LOW_LATENCY_CATEGORY_NAME "game"
 
@@ -329,7 +330,11 @@ bool QPulseAudioOutput::open()
     requestedBuffer.prebuf = (uint32_t)-1;
     requestedBuffer.tlength = m_bufferSize;
 
-    if (pa_stream_connect_playback(m_stream, m_device.data(), (m_bufferSize > 0) ? &requestedBuffer : NULL, (pa_stream_flags_t)0, NULL, NULL) < 0) {
+    // Let the server adapt the sink latency to a requested buffer size,
+    // otherwise it only limits the amount of data queued in the stream.
+    const pa_stream_flags_t flags = (m_bufferSize > 0) ? PA_STREAM_ADJUST_LATENCY : PA_STREAM_NOFLAGS;
+
+    if (pa_stream_connect_playback(m_stream, m_device.data(), (m_bufferSize > 0) ? &requestedBuffer : NULL, flags, NULL, NULL) < 0) {
         qWarning() << "pa_stream_connect_playback() failed!";
         pa_stream_unref(m_stream);
         m_stream = 0;
@@ -344,6 +349,9 @@ bool QPulseAudioOutput::open()
 
     const pa_buffer_attr *buffer = pa_stream_get_buffer_attr(m_stream);
     m_periodTime = (m_category == LOW_LATENCY_CATEGORY_NAME) ? LowLatencyPeriodTimeMs : PeriodTimeMs;
+    // Feed small buffers often enough to keep several periods queued
+    const int bufferTimeMs = int(pa_bytes_to_usec(buffer->tlength, &m_spec) / 1000);
+    m_periodTime = qBound(MinPeriodTimeMs, bufferTimeMs / 4, m_periodTime);
     m_periodSize = pa_usec_to_bytes(m_periodTime*1000, &m_spec);
     m_bufferSize = buffer->tlength;
     m_maxBufferSize = buffer->maxlength;
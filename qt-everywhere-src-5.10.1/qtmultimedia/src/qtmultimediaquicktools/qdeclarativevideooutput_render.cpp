@@ -87,6 +87,9 @@ QDeclarativeVideoRendererBackend::QDeclarativeVideoRendererBackend(QDeclarativeV
     m_videoNodeFactories.append(&m_i420Factory);
     m_videoNodeFactories.append(&m_rgbFactory);
     m_videoNodeFactories.append(&m_textureFactory);
+#if QT_CONFIG(opengles2)
+    m_videoNodeFactories.append(&m_eglFactory);
+#endif
 }
 
 QDeclarativeVideoRendererBackend::~QDeclarativeVideoRendererBackend()
@@ -56,6 +56,9 @@
 #include <private/qsgvideonode_yuv_p.h>
 #include <private/qsgvideonode_rgb_p.h>
 #include <private/qsgvideonode_texture_p.h>
+#if QT_CONFIG(opengles2)
+#include <private/qsgvideonode_egl_p.h>
+#endif
 
 #include <QtCore/qmutex.h>
 #include <QtMultimedia/qabstractvideosurface.h>
@@ -106,6 +109,9 @@ private:
     QSGVideoNodeFactory_YUV m_i420Factory;
     QSGVideoNodeFactory_RGB m_rgbFactory;
     QSGVideoNodeFactory_Texture m_textureFactory;
+#if QT_CONFIG(opengles2)
+    QSGVideoNodeFactory_EGL m_eglFactory;
+#endif
     QMutex m_frameMutex;
     QRectF m_renderedRect;         // Destination pixel coordinates, clipped
     QRectF m_sourceTextureRect;    // Source texture coordinates
@@ -0,0 +1,280 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include "qsgvideonode_egl_p.h"
+#include <QtQuick/qsgmaterial.h>
+#include <QtCore/qmutex.h>
+#include <QtGui/QOpenGLContext>
+#include <QtGui/QOpenGLFunctions>
+#include <QtGui/QOpenGLShaderProgram>
+
+#ifndef GL_TEXTURE_EXTERNAL_OES
+#define GL_TEXTURE_EXTERNAL_OES 0x8D65
+#endif
+
+QT_BEGIN_NAMESPACE
+
+typedef void (QOPENGLF_APIENTRYP EGLImageTargetTexture2DOES)(GLenum target, void *image);
+
+QList<QVideoFrame::PixelFormat> QSGVideoNodeFactory_EGL::supportedPixelFormats(
+                                        QAbstractVideoBuffer::HandleType handleType) const
+{
+    QList<QVideoFrame::PixelFormat> pixelFormats;
+
+    // The driver samples EGL images as external textures and performs
+    // any YUV to RGB conversion itself.
+    if (handleType == QAbstractVideoBuffer::EGLImageHandle) {
+        pixelFormats.append(QVideoFrame::Format_RGB565);
+        pixelFormats.append(QVideoFrame::Format_RGB32);
+        pixelFormats.append(QVideoFrame::Format_ARGB32);
+        pixelFormats.append(QVideoFrame::Format_BGR32);
+        pixelFormats.append(QVideoFrame::Format_BGRA32);
+        pixelFormats.append(QVideoFrame::Format_YUV420P);
+        pixelFormats.append(QVideoFrame::Format_YV12);
+        pixelFormats.append(QVideoFrame::Format_UYVY);
+        pixelFormats.append(QVideoFrame::Format_YUYV);
+        pixelFormats.append(QVideoFrame::Format_NV12);
+        pixelFormats.append(QVideoFrame::Format_NV21);
+    }
+
+    return pixelFormats;
+}
+
+QSGVideoNode *QSGVideoNodeFactory_EGL::createNode(const QVideoSurfaceFormat &format)
+{
+    if (!supportedPixelFormats(format.handleType()).contains(format.pixelFormat()))
+        return 0;
+
+    QOpenGLContext *context = QOpenGLContext::currentContext();
+    if (!context || !context->hasExtension(QByteArrayLiteral("GL_OES_EGL_image_external")))
+        return 0;
+
+    return new QSGVideoNode_EGL(format);
+}
+
+
+class QSGVideoMaterialShader_EGL : public QSGMaterialShader
+{
+public:
+    void updateState(const RenderState &state, QSGMaterial *newMaterial, QSGMaterial *oldMaterial) override;
+
+    char const *const *attributeNames() const override {
+        static const char *names[] = {
+            "qt_VertexPosition",
+            "qt_VertexTexCoord",
+            0
+        };
+        return names;
+    }
+
+protected:
+    const char *vertexShader() const override {
+        return
+            "uniform highp mat4 qt_Matrix;\n"
+            "attribute highp vec4 qt_VertexPosition;\n"
+            "attribute highp vec2 qt_VertexTexCoord;\n"
+            "varying highp vec2 qt_TexCoord;\n"
+            "void main() {\n"
+            "    qt_TexCoord = qt_VertexTexCoord;\n"
+            "    gl_Position = qt_Matrix * qt_VertexPosition;\n"
+            "}\n";
+    }
+
+    const char *fragmentShader() const override {
+        return
+            "#extension GL_OES_EGL_image_external : require\n"
+            "uniform samplerExternalOES videoTexture;\n"
+            "uniform lowp float opacity;\n"
+            "varying highp vec2 qt_TexCoord;\n"
+            "void main() {\n"
+            "    gl_FragColor = texture2D(videoTexture, qt_TexCoord) * opacity;\n"
+            "}\n";
+    }
+
+    void initialize() override {
+        m_id_matrix = program()->uniformLocation("qt_Matrix");
+        m_id_Texture = program()->uniformLocation("videoTexture");
+        m_id_opacity = program()->uniformLocation("opacity");
+    }
+
+    int m_id_matrix;
+    int m_id_Texture;
+    int m_id_opacity;
+};
+
+
+class QSGVideoMaterial_EGL : public QSGMaterial
+{
+public:
+    QSGVideoMaterial_EGL() :
+        m_frameChanged(false),
+        m_textureId(0),
+        m_opacity(1.0),
+        m_imageTargetTexture(0)
+    {
+        setFlag(Blending, false);
+    }
+
+    ~QSGVideoMaterial_EGL()
+    {
+        if (m_textureId) {
+            if (QOpenGLContext *current = QOpenGLContext::currentContext())
+                current->functions()->glDeleteTextures(1, &m_textureId);
+            else
+                qWarning() << "QSGVideoMaterial_EGL: Cannot obtain GL context, unable to delete texture";
+        }
+    }
+
+    QSGMaterialType *type() const override {
+        static QSGMaterialType theType;
+        return &theType;
+    }
+
+    QSGMaterialShader *createShader() const override {
+        return new QSGVideoMaterialShader_EGL;
+    }
+
+    int compare(const QSGMaterial *other) const override {
+        const QSGVideoMaterial_EGL *m = static_cast<const QSGVideoMaterial_EGL *>(other);
+
+        if (!m_textureId)
+            return 1;
+
+        int diff = m_textureId - m->m_textureId;
+        if (diff)
+            return diff;
+
+        return (m_opacity > m->m_opacity) ? 1 : -1;
+    }
+
+    void updateBlending() {
+        setFlag(Blending, qFuzzyCompare(m_opacity, qreal(1.0)) ? false : true);
+    }
+
+    void setVideoFrame(const QVideoFrame &frame) {
+        QMutexLocker lock(&m_frameMutex);
+        m_frame = frame;
+        m_frameChanged = true;
+    }
+
+    void bind()
+    {
+        QOpenGLContext *context = QOpenGLContext::currentContext();
+        QOpenGLFunctions *functions = context->functions();
+        QMutexLocker lock(&m_frameMutex);
+
+        void *image = m_frame.isValid() ? m_frame.handle().value<void *>() : 0;
+        if (!image) {
+            functions->glBindTexture(GL_TEXTURE_EXTERNAL_OES, 0);
+            return;
+        }
+
+        if (!m_textureId) {
+            functions->glGenTextures(1, &m_textureId);
+            functions->glBindTexture(GL_TEXTURE_EXTERNAL_OES, m_textureId);
+            functions->glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            functions->glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            functions->glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            functions->glTexParameteri(GL_TEXTURE_EXTERNAL_OES, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        } else {
+            functions->glBindTexture(GL_TEXTURE_EXTERNAL_OES, m_textureId);
+        }
+
+        // Only respecify the texture when a new frame arrives, the
+        // frame's buffer keeps the current image alive until then.
+        if (m_frameChanged) {
+            if (!m_imageTargetTexture) {
+                m_imageTargetTexture = reinterpret_cast<EGLImageTargetTexture2DOES>(
+                            context->getProcAddress("glEGLImageTargetTexture2DOES"));
+            }
+            if (m_imageTargetTexture)
+                m_imageTargetTexture(GL_TEXTURE_EXTERNAL_OES, image);
+            m_frameChanged = false;
+        }
+    }
+
+    QVideoFrame m_frame;
+    QMutex m_frameMutex;
+    bool m_frameChanged;
+    GLuint m_textureId;
+    qreal m_opacity;
+
+private:
+    EGLImageTargetTexture2DOES m_imageTargetTexture;
+};
+
+
+QSGVideoNode_EGL::QSGVideoNode_EGL(const QVideoSurfaceFormat &format) :
+    m_format(format)
+{
+    setFlag(QSGNode::OwnsMaterial);
+    m_material = new QSGVideoMaterial_EGL;
+    setMaterial(m_material);
+}
+
+QSGVideoNode_EGL::~QSGVideoNode_EGL()
+{
+}
+
+void QSGVideoNode_EGL::setCurrentFrame(const QVideoFrame &frame, FrameFlags)
+{
+    m_material->setVideoFrame(frame);
+    markDirty(DirtyMaterial);
+}
+
+void QSGVideoMaterialShader_EGL::updateState(const RenderState &state,
+                                            QSGMaterial *newMaterial,
+                                            QSGMaterial *oldMaterial)
+{
+    Q_UNUSED(oldMaterial);
+    QSGVideoMaterial_EGL *mat = static_cast<QSGVideoMaterial_EGL *>(newMaterial);
+    program()->setUniformValue(m_id_Texture, 0);
+
+    mat->bind();
+
+    if (state.isOpacityDirty()) {
+        mat->m_opacity = state.opacity();
+        mat->updateBlending();
+        program()->setUniformValue(m_id_opacity, GLfloat(mat->m_opacity));
+    }
+
+    if (state.isMatrixDirty())
+        program()->setUniformValue(m_id_matrix, state.combinedMatrix());
+}
+
+QT_END_NAMESPACE
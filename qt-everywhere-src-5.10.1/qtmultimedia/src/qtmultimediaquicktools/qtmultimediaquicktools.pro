@@ -31,6 +31,11 @@ SOURCES += \
     qsgvideonode_rgb.cpp \
     qsgvideonode_texture.cpp
 
+qtConfig(opengles2) {
+    HEADERS += qsgvideonode_egl_p.h
+    SOURCES += qsgvideonode_egl.cpp
+}
+
 RESOURCES += \
     qtmultimediaquicktools.qrc
 
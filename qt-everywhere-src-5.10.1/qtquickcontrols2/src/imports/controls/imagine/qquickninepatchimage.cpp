@@ -36,10 +36,13 @@
 
 #include "qquickninepatchimage_p.h"
 
+#include <QtCore/qcache.h>
 #include <QtCore/qfileinfo.h>
+#include <QtCore/qmargins.h>
 #include <QtQuick/qsggeometry.h>
 #include <QtQuick/qsgtexturematerial.h>
 #include <QtQuick/private/qsgnode_p.h>
+#include <QtQuick/private/qsgcontext_p.h>
 #include <QtQuick/private/qquickimage_p_p.h>
 
 QT_BEGIN_NAMESPACE
@@ -109,11 +112,21 @@ void QQuickNinePatchData::clear()
     data.clear();
 }
 
+// The divs, insets and paddings parsed from a 9.png image. Controls of the
+// same type all share the same source image, so the result is cached by the
+// image's cache key instead of scanning the border pixels for every instance.
+struct QQuickNinePatchMetrics
+{
+    QQuickNinePatchData xDivs;
+    QQuickNinePatchData yDivs;
+    QMarginsF insets;
+    QMarginsF paddings;
+};
+
 class QQuickNinePatchNode : public QSGGeometryNode
 {
 public:
     QQuickNinePatchNode();
-    ~QQuickNinePatchNode();
 
     void initialize(QSGTexture *texture, const QSizeF &targetSize, const QSize &sourceSize,
                     const QQuickNinePatchData &xDivs, const QQuickNinePatchData &yDivs, qreal dpr);
@@ -131,16 +144,13 @@ QQuickNinePatchNode::QQuickNinePatchNode()
     setMaterial(&m_material);
 }
 
-QQuickNinePatchNode::~QQuickNinePatchNode()
-{
-    delete m_material.texture();
-}
-
 void QQuickNinePatchNode::initialize(QSGTexture *texture, const QSizeF &targetSize, const QSize &sourceSize,
                                      const QQuickNinePatchData &xDivs, const QQuickNinePatchData &yDivs, qreal dpr)
 {
-    delete m_material.texture();
+    // The texture is owned by the render context and shared by all nine-patch
+    // images using the same source, possibly as a sub-rect of the texture atlas.
     m_material.setTexture(texture);
+    const QRectF subRect = texture->normalizedTextureSubRect();
 
     const int xlen = xDivs.count();
     const int ylen = yDivs.count();
@@ -157,8 +167,8 @@ void QQuickNinePatchNode::initialize(QSGTexture *texture, const QSizeF &targetSi
         for (int y = 0; y < ylen; ++y) {
             for (int x = 0; x < xlen; ++x, ++vertices)
                 vertices->set(xCoords[x] / dpr, yCoords[y] / dpr,
-                              xDivs.at(x) / sourceSize.width(),
-                              yDivs.at(y) / sourceSize.height());
+                              subRect.x() + (xDivs.at(x) + 1) / sourceSize.width() * subRect.width(),
+                              subRect.y() + (yDivs.at(y) + 1) / sourceSize.height() * subRect.height());
         }
 
         quint16 *indices = m_geometry.indexDataAsUShort();
@@ -189,8 +199,8 @@ class QQuickNinePatchImagePrivate : public QQuickImagePrivate
 
 public:
     void updatePatches();
-    void updatePaddings(const QSizeF &size, const QVector<qreal> &horizontal, const QVector<qreal> &vertical);
-    void updateInsets(const QVector<qreal> &horizontal, const QVector<qreal> &vertical);
+    void updatePaddings(const QMarginsF &paddings);
+    void updateInsets(const QMarginsF &insets);
 
     qreal getImplicitWidth() const override;
     qreal getImplicitHeight() const override;
@@ -205,7 +215,7 @@ public:
     qreal rightInset = 0;
     qreal bottomInset = 0;
 
-    QImage ninePatch;
+    bool ninePatch = false;
     QQuickNinePatchData xDivs;
     QQuickNinePatchData yDivs;
 };
@@ -231,10 +241,51 @@ static QVector<qreal> readCoords(const QRgb *data, int from, int count, int offs
     return coords;
 }
 
-void QQuickNinePatchImagePrivate::updatePatches()
+static QMarginsF insetsFromCoords(const QVector<qreal> &horizontal, const QVector<qreal> &vertical)
 {
-    if (ninePatch.isNull())
-        return;
+    QMarginsF insets;
+
+    if (horizontal.count() >= 2 && horizontal.first() == 0)
+        insets.setLeft(horizontal.at(1));
+
+    if (horizontal.count() == 2 && horizontal.first() > 0)
+        insets.setRight(horizontal.last() - horizontal.first());
+    else if (horizontal.count() == 4)
+        insets.setRight(horizontal.last() - horizontal.at(2));
+
+    if (vertical.count() >= 2 && vertical.first() == 0)
+        insets.setTop(vertical.at(1));
+
+    if (vertical.count() == 2 && vertical.first() > 0)
+        insets.setBottom(vertical.last() - vertical.first());
+    else if (vertical.count() == 4)
+        insets.setBottom(vertical.last() - vertical.at(2));
+
+    return insets;
+}
+
+static QMarginsF paddingsFromCoords(const QSizeF &size, const QVector<qreal> &horizontal, const QVector<qreal> &vertical)
+{
+    QMarginsF paddings;
+
+    if (horizontal.count() >= 2) {
+        paddings.setLeft(horizontal.first());
+        paddings.setRight(size.width() - horizontal.last() - 2);
+    }
+
+    if (vertical.count() >= 2) {
+        paddings.setTop(vertical.first());
+        paddings.setBottom(size.height() - vertical.last() - 2);
+    }
+
+    return paddings;
+}
+
+static QQuickNinePatchMetrics *readNinePatch(const QImage &image)
+{
+    QImage ninePatch = image;
+    if (ninePatch.depth() != 32)
+        ninePatch = ninePatch.convertToFormat(QImage::Format_ARGB32);
 
     int w = ninePatch.width();
     int h = ninePatch.height();
@@ -243,20 +294,51 @@ void QQuickNinePatchImagePrivate::updatePatches()
     const QRgb black = qRgb(0,0,0);
     const QRgb red = qRgb(255,0,0);
 
-    xDivs.fill(readCoords(data, 1, w - 1, 1, black), w - 2); // top left -> top right
-    yDivs.fill(readCoords(data, w, h - 1, w, black), h - 2); // top left -> bottom left
+    QQuickNinePatchMetrics *metrics = new QQuickNinePatchMetrics;
+    metrics->xDivs.fill(readCoords(data, 1, w - 1, 1, black), w - 2); // top left -> top right
+    metrics->yDivs.fill(readCoords(data, w, h - 1, w, black), h - 2); // top left -> bottom left
 
     QVector<qreal> hInsets = readCoords(data, (h - 1) * w + 1, w - 1, 1, red); // bottom left -> bottom right
     QVector<qreal> vInsets = readCoords(data, 2 * w - 1, h - 1, w, red); // top right -> bottom right
-    updateInsets(hInsets, vInsets);
+    metrics->insets = insetsFromCoords(hInsets, vInsets);
+
+    const QMarginsF &insets = metrics->insets;
+    const QSizeF sz(w - insets.left() - insets.right(), h - insets.top() - insets.bottom());
+    QVector<qreal> hPaddings = readCoords(data, (h - 1) * w + insets.left() + 1, sz.width() - 2, 1, black); // bottom left -> bottom right
+    QVector<qreal> vPaddings = readCoords(data, (2 + insets.top()) * w - 1, sz.height() - 2, w, black); // top right -> bottom right
+    metrics->paddings = paddingsFromCoords(sz, hPaddings, vPaddings);
+
+    return metrics;
+}
+
+typedef QCache<qint64, QQuickNinePatchMetrics> QQuickNinePatchMetricsCache;
+Q_GLOBAL_STATIC_WITH_ARGS(QQuickNinePatchMetricsCache, ninePatchMetricsCache, (64))
+
+void QQuickNinePatchImagePrivate::updatePatches()
+{
+    const QImage image = pix.image();
+    if (image.width() < 3 || image.height() < 3) {
+        xDivs.clear();
+        yDivs.clear();
+        updateInsets(QMarginsF());
+        updatePaddings(QMarginsF());
+        return;
+    }
+
+    QQuickNinePatchMetricsCache *cache = ninePatchMetricsCache();
+    QQuickNinePatchMetrics *metrics = cache->object(image.cacheKey());
+    if (!metrics) {
+        metrics = readNinePatch(image);
+        cache->insert(image.cacheKey(), metrics);
+    }
 
-    const QSizeF sz(w - leftInset - rightInset, h - topInset - bottomInset);
-    QVector<qreal> hPaddings = readCoords(data, (h - 1) * w + leftInset + 1, sz.width() - 2, 1, black); // bottom left -> bottom right
-    QVector<qreal> vPaddings = readCoords(data, (2 + topInset) * w - 1, sz.height() - 2, w, black); // top right -> bottom right
-    updatePaddings(sz, hPaddings, vPaddings);
+    xDivs = metrics->xDivs;
+    yDivs = metrics->yDivs;
+    updateInsets(metrics->insets);
+    updatePaddings(metrics->paddings);
 }
 
-void QQuickNinePatchImagePrivate::updatePaddings(const QSizeF &size, const QVector<qreal> &horizontal, const QVector<qreal> &vertical)
+void QQuickNinePatchImagePrivate::updatePaddings(const QMarginsF &paddings)
 {
     Q_Q(QQuickNinePatchImage);
     qreal oldTopPadding = topPadding;
@@ -264,21 +346,10 @@ void QQuickNinePatchImagePrivate::updatePaddings(const QSizeF &size, const QVect
     qreal oldRightPadding = rightPadding;
     qreal oldBottomPadding = bottomPadding;
 
-    if (horizontal.count() >= 2) {
-        leftPadding = horizontal.first();
-        rightPadding = size.width() - horizontal.last() - 2;
-    } else {
-        leftPadding = 0;
-        rightPadding = 0;
-    }
-
-    if (vertical.count() >= 2) {
-        topPadding = vertical.first();
-        bottomPadding = size.height() - vertical.last() - 2;
-    } else {
-        topPadding = 0;
-        bottomPadding = 0;
-    }
+    topPadding = paddings.top();
+    leftPadding = paddings.left();
+    rightPadding = paddings.right();
+    bottomPadding = paddings.bottom();
 
     if (!qFuzzyCompare(oldTopPadding, topPadding))
         emit q->topPaddingChanged();
@@ -290,7 +361,7 @@ void QQuickNinePatchImagePrivate::updatePaddings(const QSizeF &size, const QVect
         emit q->rightPaddingChanged();
 }
 
-void QQuickNinePatchImagePrivate::updateInsets(const QVector<qreal> &horizontal, const QVector<qreal> &vertical)
+void QQuickNinePatchImagePrivate::updateInsets(const QMarginsF &insets)
 {
     Q_Q(QQuickNinePatchImage);
     qreal oldTopInset = topInset;
@@ -298,29 +369,10 @@ void QQuickNinePatchImagePrivate::updateInsets(const QVector<qreal> &horizontal,
     qreal oldRightInset = rightInset;
     qreal oldBottomInset = bottomInset;
 
-    if (horizontal.count() >= 2 && horizontal.first() == 0)
-        leftInset = horizontal.at(1);
-    else
-        leftInset = 0;
-
-    if (horizontal.count() == 2 && horizontal.first() > 0)
-        rightInset = horizontal.last() - horizontal.first();
-    else if (horizontal.count() == 4)
-        rightInset = horizontal.last() - horizontal.at(2);
-    else
-        rightInset = 0;
-
-    if (vertical.count() >= 2 && vertical.first() == 0)
-        topInset = vertical.at(1);
-    else
-        topInset = 0;
-
-    if (vertical.count() == 2 && vertical.first() > 0)
-        bottomInset = vertical.last() - vertical.first();
-    else if (vertical.count() == 4)
-        bottomInset = vertical.last() - vertical.at(2);
-    else
-        bottomInset = 0;
+    topInset = insets.top();
+    leftInset = insets.left();
+    rightInset = insets.right();
+    bottomInset = insets.bottom();
 
     if (!qFuzzyCompare(oldTopInset, topInset))
         emit q->topInsetChanged();
@@ -400,22 +452,20 @@ qreal QQuickNinePatchImage::bottomInset() const
 void QQuickNinePatchImage::pixmapChange()
 {
     Q_D(QQuickNinePatchImage);
+    // The pixmap is left as loaded, border included, so that it stays shared
+    // through the pixmap cache and maps to a single (atlas) texture for all
+    // instances. The border is skipped by the texture coordinates instead.
     if (QFileInfo(d->url.fileName()).completeSuffix().toLower() == QLatin1String("9.png")) {
-        d->resetNode = d->ninePatch.isNull();
-        d->ninePatch = d->pix.image();
-        if (d->ninePatch.depth() != 32)
-            d->ninePatch = d->ninePatch.convertToFormat(QImage::Format_ARGB32);
-
-        int w = d->ninePatch.width();
-        int h = d->ninePatch.height();
-        d->pix.setImage(QImage(d->ninePatch.constBits() + 4 * (w + 1), w - 2, h - 2, d->ninePatch.bytesPerLine(), d->ninePatch.format()));
-
+        d->resetNode = !d->ninePatch;
+        d->ninePatch = true;
         d->updatePatches();
     } else {
-        d->resetNode = !d->ninePatch.isNull();
-        d->ninePatch = QImage();
+        d->resetNode = d->ninePatch;
+        d->ninePatch = false;
     }
     QQuickImage::pixmapChange();
+    if (d->ninePatch && !d->pix.isNull())
+        setImplicitSize((d->pix.width() - 2) / d->devicePixelRatio, (d->pix.height() - 2) / d->devicePixelRatio);
 }
 
 QSGNode *QQuickNinePatchImage::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *data)
@@ -436,7 +486,7 @@ QSGNode *QQuickNinePatchImage::updatePaintNode(QSGNode *oldNode, UpdatePaintNode
         return nullptr;
     }
 
-    if (d->ninePatch.isNull())
+    if (!d->ninePatch)
         return QQuickImage::updatePaintNode(oldNode, data);
 
     QQuickNinePatchNode *patchNode = static_cast<QQuickNinePatchNode *>(oldNode);
@@ -447,7 +497,11 @@ QSGNode *QQuickNinePatchImage::updatePaintNode(QSGNode *oldNode, UpdatePaintNode
     qsgnode_set_description(patchNode, QString::fromLatin1("QQuickNinePatchImage: '%1'").arg(d->url.toString()));
 #endif
 
-    QSGTexture *texture = window()->createTextureFromImage(image);
+    QSGTexture *texture = d->sceneGraphRenderContext()->textureForFactory(d->pix.textureFactory(), window());
+    if (!texture) {
+        delete patchNode;
+        return nullptr;
+    }
     patchNode->initialize(texture, sz * d->devicePixelRatio, image.size(), d->xDivs, d->yDivs, d->devicePixelRatio);
     return patchNode;
 }
@@ -80,6 +80,21 @@ bool LocalClientIo::isOpen()
     return !isClosing() && m_socket.isOpen();
 }
 
+// Local sockets only send buffered data once control returns to the event
+// loop. Same-host peers are latency sensitive, so hand the packets to the
+// kernel right away instead.
+void LocalClientIo::write(const QByteArray &data)
+{
+    ClientIoDevice::write(data);
+    m_socket.flush();
+}
+
+void LocalClientIo::write(const QByteArray &data, qint64 size)
+{
+    ClientIoDevice::write(data, size);
+    m_socket.flush();
+}
+
 void LocalClientIo::onError(QLocalSocket::LocalSocketError error)
 {
     qCDebug(QT_REMOTEOBJECT) << "onError" << error << m_socket.serverName();
@@ -127,6 +142,18 @@ QIODevice *LocalServerIo::connection() const
     return m_connection;
 }
 
+void LocalServerIo::write(const QByteArray &data)
+{
+    ServerIoDevice::write(data);
+    m_connection->flush();
+}
+
+void LocalServerIo::write(const QByteArray &data, qint64 size)
+{
+    ServerIoDevice::write(data, size);
+    m_connection->flush();
+}
+
 void LocalServerIo::doClose()
 {
     m_connection->disconnectFromServer();
@@ -69,6 +69,8 @@ public:
     QIODevice *connection() override;
     void connectToServer() override;
     bool isOpen() override;
+    void write(const QByteArray &data) override;
+    void write(const QByteArray &data, qint64 size) override;
 
 public Q_SLOTS:
     void onError(QLocalSocket::LocalSocketError error);
@@ -87,6 +89,8 @@ public:
     explicit LocalServerIo(QLocalSocket *conn, QObject *parent = nullptr);
 
     QIODevice *connection() const override;
+    void write(const QByteArray &data) override;
+    void write(const QByteArray &data, qint64 size) override;
 protected:
     void doClose() override;
 
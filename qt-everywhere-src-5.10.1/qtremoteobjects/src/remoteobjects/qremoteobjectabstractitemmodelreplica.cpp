@@ -48,7 +48,8 @@
 
 QT_BEGIN_NAMESPACE
 enum {
-    DefaultRootCacheSize = 1000
+    DefaultRootCacheSize = 1000,
+    DefaultPrefetchRows = 50
 };
 
 inline QDebug operator<<(QDebug stream, const RequestedData &data)
@@ -77,7 +78,13 @@ QAbstractItemModelReplicaPrivate::QAbstractItemModelReplicaPrivate()
     , m_selectionModel(0)
     , m_rootItem(this)
     , m_lastRequested(-1)
+    , m_prefetchFirstRow(-1)
+    , m_prefetchLastRow(-1)
 {
+    bool ok;
+    m_prefetchRows = qEnvironmentVariableIntValue("QTRO_PREFETCH_ROWS", &ok);
+    if (!ok)
+        m_prefetchRows = DefaultPrefetchRows;
     m_rootItem.children.setCacheSize(DefaultRootCacheSize);
     QAbstractItemModelReplicaPrivate::registerMetatypes();
     initializeModelConnections();
@@ -91,7 +98,13 @@ QAbstractItemModelReplicaPrivate::QAbstractItemModelReplicaPrivate(QRemoteObject
     , m_selectionModel(0)
     , m_rootItem(this)
     , m_lastRequested(-1)
+    , m_prefetchFirstRow(-1)
+    , m_prefetchLastRow(-1)
 {
+    bool ok;
+    m_prefetchRows = qEnvironmentVariableIntValue("QTRO_PREFETCH_ROWS", &ok);
+    if (!ok)
+        m_prefetchRows = DefaultPrefetchRows;
     m_rootItem.children.setCacheSize(DefaultRootCacheSize);
     QAbstractItemModelReplicaPrivate::registerMetatypes();
     initializeModelConnections();
@@ -535,6 +548,9 @@ void QAbstractItemModelReplicaPrivate::requestedData(QRemoteObjectPendingCallWat
     emit q->dataChanged(startIndex, endIndex, watcher->roles);
     m_pendingRequests.removeAll(watcher);
     delete watcher;
+
+    // Rows of the prefetched window that are still missing may be requested again
+    m_prefetchFirstRow = m_prefetchLastRow = -1;
 }
 
 void QAbstractItemModelReplicaPrivate::fetchPendingData()
@@ -803,19 +819,46 @@ QVariant QAbstractItemModelReplica::data(const QModelIndex & index, int role) co
     Q_ASSERT(index.row() < parentItem->rowCount);
     const int row = index.row();
     IndexList parentList = toModelIndexList(index.parent(), this);
-    IndexList start = IndexList() << parentList << ModelIndex(row, 0);
-    IndexList end = IndexList() << parentList << ModelIndex(row, std::max(0, parentItem->columnCount - 1));
+
+    // The row is part of a window of rows that has been requested already
+    if (parentList == d->m_prefetchParent && row >= d->m_prefetchFirstRow && row <= d->m_prefetchLastRow)
+        return QVariant{};
+
+    // Request a window of rows in the direction the view is scrolling, with
+    // all roles, so that the rows about to become visible arrive in one reply
+    // instead of one request per row and role.
+    int firstRow = row;
+    int lastRow = row;
+    const int prefetchRows = std::min(d->m_prefetchRows, int(parentItem->children.cacheSize / 2));
+    if (prefetchRows > 0) {
+        if (row >= d->m_lastRequested)
+            lastRow = std::min(row + prefetchRows, parentItem->rowCount - 1);
+        else
+            firstRow = std::max(0, row - prefetchRows);
+    }
+    d->m_lastRequested = row;
+    d->m_prefetchParent = parentList;
+    d->m_prefetchFirstRow = firstRow;
+    d->m_prefetchLastRow = lastRow;
+
+    IndexList start = IndexList() << parentList << ModelIndex(firstRow, 0);
+    IndexList end = IndexList() << parentList << ModelIndex(lastRow, std::max(0, parentItem->columnCount - 1));
     Q_ASSERT(toQModelIndex(start, this).isValid());
 
     RequestedData data;
     QVector<int> roles;
-    roles << role;
+    if (prefetchRows > 0)
+        roles = availableRoles();
+    else
+        roles << role;
     data.start = start;
     data.end = end;
     data.roles = roles;
+    const bool fetchScheduled = !d->m_requestedData.isEmpty();
     d->m_requestedData.push_back(data);
     qCDebug(QT_REMOTEOBJECT_MODELS) << "FETCH PENDING DATA" << start << end << roles;
-    QMetaObject::invokeMethod(d.data(), "fetchPendingData", Qt::QueuedConnection);
+    if (!fetchScheduled)
+        QMetaObject::invokeMethod(d.data(), "fetchPendingData", Qt::QueuedConnection);
     return QVariant{};
 }
 QModelIndex QAbstractItemModelReplica::parent(const QModelIndex &index) const
@@ -453,6 +453,11 @@ public:
     void initializeModelConnections();
 
     int m_lastRequested;
+    // Window of rows requested ahead of the view, see QAbstractItemModelReplica::data()
+    int m_prefetchRows;
+    IndexList m_prefetchParent;
+    int m_prefetchFirstRow;
+    int m_prefetchLastRow;
     QVector<RequestedData> m_requestedData;
     QVector<RequestedHeaderData> m_requestedHeaderData;
     QVector<QRemoteObjectPendingCallWatcher*> m_pendingRequests;
@@ -189,9 +189,14 @@ void QRemoteObjectSource::handleMetaCall(int index, QMetaObject::Call call, void
         const int rawIndex = m_api->propertyRawIndexFromSignal(index);
         const auto target = m_api->isAdapterProperty(index) ? m_adapter : m_object;
         const QMetaProperty mp = target->metaObject()->property(propertyIndex);
-        qCDebug(QT_REMOTEOBJECT) << "Sending Invoke Property" << (m_api->isAdapterSignal(index) ? "via adapter" : "") << rawIndex << propertyIndex << mp.name() << mp.read(target);
-        serializePropertyChangePacket(m_packet, m_api->name(), rawIndex, serializedProperty(mp, target));
-        m_packet.baseAddress = m_packet.size;
+        const QVariant value = serializedProperty(mp, target);
+        if (isUnchangedProperty(rawIndex, value)) {
+            qCDebug(QT_REMOTEOBJECT) << "Skipping unchanged Property" << rawIndex << propertyIndex << mp.name();
+        } else {
+            qCDebug(QT_REMOTEOBJECT) << "Sending Invoke Property" << (m_api->isAdapterSignal(index) ? "via adapter" : "") << rawIndex << propertyIndex << mp.name() << value;
+            serializePropertyChangePacket(m_packet, m_api->name(), rawIndex, value);
+            m_packet.baseAddress = m_packet.size;
+        }
         propertyIndex = rawIndex;
     }
 
@@ -205,9 +210,40 @@ void QRemoteObjectSource::handleMetaCall(int index, QMetaObject::Call call, void
         io->write(m_packet.array, m_packet.size);
 }
 
+/*!
+    \internal
+    Returns whether \a value was the last value sent for the property at
+    \a rawIndex, in which case the listeners already hold it. Otherwise the
+    value is remembered as the last one sent.
+
+    Only values of built-in types are remembered, since comparing other
+    types may not be supported.
+*/
+bool QRemoteObjectSource::isUnchangedProperty(int rawIndex, const QVariant &value)
+{
+    const int type = value.userType();
+    if (type >= QMetaType::User || type == QMetaType::QObjectStar || type == QMetaType::VoidStar) {
+        m_sentPropertyValues.remove(rawIndex);
+        return false;
+    }
+
+    auto it = m_sentPropertyValues.find(rawIndex);
+    if (it == m_sentPropertyValues.end()) {
+        m_sentPropertyValues.insert(rawIndex, value);
+        return false;
+    }
+    if (it->userType() == type && *it == value)
+        return true;
+    *it = value;
+    return false;
+}
+
 void QRemoteObjectSource::addListener(ServerIoDevice *io, bool dynamic)
 {
     listeners.append(io);
+    // The new listener gets the current values with its init packet, which
+    // may differ from the values last sent to the other listeners
+    m_sentPropertyValues.clear();
 
     if (dynamic) {
         serializeInitDynamicPacket(m_packet, this);
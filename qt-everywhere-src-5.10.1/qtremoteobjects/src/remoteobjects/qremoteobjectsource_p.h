@@ -55,6 +55,7 @@
 #include <QMetaObject>
 #include <QMetaProperty>
 #include <QVector>
+#include <QHash>
 #include "qremoteobjectsource.h"
 #include "qremoteobjectpacket_p.h"
 
@@ -78,10 +79,13 @@ public:
     QRemoteObjectSourceIo *m_sourceIo;
     QRemoteObjectPackets::DataStreamPacket m_packet;
     QVariantList m_marshalledArgs;
+    // Property values last sent to all listeners, by raw property index
+    QHash<int, QVariant> m_sentPropertyValues;
     bool hasAdapter() const { return m_adapter; }
 
     QVariantList* marshalArgs(int index, void **a);
     void handleMetaCall(int index, QMetaObject::Call call, void **a);
+    bool isUnchangedProperty(int rawIndex, const QVariant &value);
     void addListener(ServerIoDevice *io, bool dynamic = false);
     int removeListener(ServerIoDevice *io, bool shouldSendRemove = false);
     bool invoke(QMetaObject::Call c, bool forAdapter, int index, const QVariantList& args, QVariant* returnValue = nullptr);
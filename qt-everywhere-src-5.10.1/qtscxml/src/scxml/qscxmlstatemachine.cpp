@@ -326,13 +326,22 @@ void EventLoopHook::timerEvent(QTimerEvent *timerEvent)
     }
 }
 
-void ScxmlEventRouter::route(const QStringList &segments, QScxmlEvent *event)
+void ScxmlEventRouter::route(QScxmlEvent *event)
+{
+    // Only split the event name if something is connected to specific events
+    if (children.isEmpty())
+        emit eventOccurred(*event);
+    else
+        route(event->name().split(QLatin1Char('.')), 0, event);
+}
+
+void ScxmlEventRouter::route(const QStringList &segments, int index, QScxmlEvent *event)
 {
     emit eventOccurred(*event);
-    if (!segments.isEmpty()) {
-        auto it = children.find(segments.first());
+    if (index < segments.size()) {
+        auto it = children.find(segments.at(index));
         if (it != children.end())
-            it.value()->route(segments.mid(1), event);
+            it.value()->route(segments, index + 1, event);
     }
 }
 
@@ -572,7 +581,7 @@ void QScxmlStateMachinePrivate::postEvent(QScxmlEvent *event)
     }
 
     if (event->eventType() == QScxmlEvent::ExternalEvent)
-        m_router.route(event->name().split(QLatin1Char('.')), event);
+        m_router.route(event);
 
     if (event->eventType() == QScxmlEvent::ExternalEvent) {
         qCDebug(qscxmlLog) << q << "posting external event" << event->name();
@@ -838,17 +847,18 @@ bool QScxmlStateMachinePrivate::nameMatch(const StateTable::Array &patterns,
     const QString eventName = event->name();
     bool selected = false;
     for (int eventSelectorIter = 0; eventSelectorIter < patterns.size(); ++eventSelectorIter) {
-        QString eventStr = m_tableData->string(patterns[eventSelectorIter]);
-        if (eventStr == QStringLiteral("*")) {
+        const QString eventStr = m_tableData->string(patterns[eventSelectorIter]);
+        if (eventStr == QLatin1String("*")) {
             selected = true;
             break;
         }
-        if (eventStr.endsWith(QStringLiteral(".*")))
-            eventStr.chop(2);
-        if (eventName.startsWith(eventStr)) {
+        int prefixSize = eventStr.size();
+        if (eventStr.endsWith(QLatin1String(".*")))
+            prefixSize -= 2;
+        if (eventName.startsWith(QStringRef(&eventStr, 0, prefixSize))) {
             QChar nextC = QLatin1Char('.');
-            if (eventName.size() > eventStr.size())
-                nextC = eventName.at(eventStr.size());
+            if (eventName.size() > prefixSize)
+                nextC = eventName.at(prefixSize);
             if (nextC == QLatin1Char('.') || nextC == QLatin1Char('(')) {
                 selected = true;
                 break;
@@ -888,9 +898,7 @@ void QScxmlStateMachinePrivate::selectTransitions(OrderedSet &enabledTransitions
                 const StateTable::Array transitions = m_stateTable->array(state.transitions);
                 if (!transitions.isValid())
                     continue;
-                std::vector<int> sortedTransitions(transitions.size(), -1);
-                std::copy(transitions.begin(), transitions.end(), sortedTransitions.begin());
-                for (int transitionIndex : sortedTransitions) {
+                for (int transitionIndex : transitions) {
                     const StateTable::Transition &t = m_stateTable->transition(transitionIndex);
                     bool enabled = false;
                     if (event == nullptr) {
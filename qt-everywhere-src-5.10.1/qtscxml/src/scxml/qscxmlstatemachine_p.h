@@ -91,7 +91,7 @@ public:
                                            void **slot, QtPrivate::QSlotObjectBase *method,
                                            Qt::ConnectionType type);
 
-    void route(const QStringList &segments, QScxmlEvent *event);
+    void route(QScxmlEvent *event);
 
 signals:
     void eventOccurred(const QScxmlEvent &event);
@@ -99,6 +99,7 @@ signals:
 private:
     QHash<QString, ScxmlEventRouter *> children;
     ScxmlEventRouter *child(const QString &segment);
+    void route(const QStringList &segments, int index, QScxmlEvent *event);
 
     void disconnectNotify(const QMetaMethod &signal) override;
 };
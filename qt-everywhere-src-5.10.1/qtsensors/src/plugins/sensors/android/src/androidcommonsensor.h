@@ -63,10 +63,17 @@ public:
     }
     void start() override
     {
-        if (AndroidSensors::registerListener(m_type, this, sensor()->dataRate()))
+        if (AndroidSensors::registerListener(m_type, this, sensor()->dataRate(), sensor()->maxReportLatency()))
             m_isStarted = true;
     }
 
+    bool isFeatureSupported(QSensor::Feature feature) const override
+    {
+        if (feature == QSensor::Batching)
+            return AndroidSensors::sensorSupportsBatching(m_type);
+        return QSensorBackend::isFeatureSupported(feature);
+    }
+
     void stop() override
     {
         if (m_isStarted) {
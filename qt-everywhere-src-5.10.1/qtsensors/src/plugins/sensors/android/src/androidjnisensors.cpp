@@ -49,6 +49,8 @@ jclass sensorsClass;
 
 static jmethodID getSensorListMethodId;
 static jmethodID registerSensorMethodId;
+static jmethodID registerBatchedSensorMethodId = 0;
+static jmethodID getSensorFifoMaxEventCountMethodId = 0;
 static jmethodID unregisterSensorMethodId;
 static jmethodID getSensorDescriptionMethodId;
 static jmethodID getSensorMaximumRangeMethodId;
@@ -130,7 +132,17 @@ namespace AndroidSensors
         return range;
     }
 
-    bool registerListener(AndroidSensorType sensor, AndroidSensorsListenerInterface *listener, int dataRate)
+    bool sensorSupportsBatching(AndroidSensorType sensor)
+    {
+        if (!registerBatchedSensorMethodId || !getSensorFifoMaxEventCountMethodId)
+            return false;
+        AttachedJNIEnv aenv;
+        if (!aenv.jniEnv)
+            return false;
+        return aenv.jniEnv->CallStaticIntMethod(sensorsClass, getSensorFifoMaxEventCountMethodId, jint(sensor)) > 0;
+    }
+
+    bool registerListener(AndroidSensorType sensor, AndroidSensorsListenerInterface *listener, int dataRate, int maxReportLatency)
     {
         listenersLocker.lockForWrite();
         bool startService = listenersHash[sensor].empty();
@@ -141,6 +153,16 @@ namespace AndroidSensors
             if (!aenv.jniEnv)
                 return false;
             int rate = dataRate > 0 ? 1000000/dataRate : SENSOR_DELAY_GAME;
+            // The latency is passed on in microseconds, as expected by
+            // SensorManager.registerListener(), so that the sensor hub can
+            // queue events in its FIFO instead of waking up the application.
+            if (maxReportLatency > 0 && registerBatchedSensorMethodId) {
+                return aenv.jniEnv->CallStaticBooleanMethod(sensorsClass,
+                                                            registerBatchedSensorMethodId,
+                                                            jint(sensor),
+                                                            jint(rate),
+                                                            jint(maxReportLatency * 1000));
+            }
             return aenv.jniEnv->CallStaticBooleanMethod(sensorsClass,
                                                         registerSensorMethodId,
                                                         jint(sensor),
@@ -242,6 +264,14 @@ static bool registerNatives(JNIEnv *env)
     GET_AND_CHECK_STATIC_METHOD(getSensorMaximumRangeMethodId, sensorsClass, "getSensorMaximumRange", "(I)F");
     GET_AND_CHECK_STATIC_METHOD(getCompassAzimuthId, sensorsClass, "getCompassAzimuth", "(FFFFFF)F");
 
+    // Optional, batching is only available with a QtSensors.jar that provides these
+    registerBatchedSensorMethodId = env->GetStaticMethodID(sensorsClass, "registerSensor", "(III)Z");
+    if (env->ExceptionCheck())
+        env->ExceptionClear();
+    getSensorFifoMaxEventCountMethodId = env->GetStaticMethodID(sensorsClass, "getSensorFifoMaxEventCount", "(I)I");
+    if (env->ExceptionCheck())
+        env->ExceptionClear();
+
     return true;
 }
 
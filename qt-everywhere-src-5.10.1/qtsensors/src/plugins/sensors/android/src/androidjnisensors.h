@@ -79,7 +79,8 @@ namespace AndroidSensors
     QVector<AndroidSensorType> availableSensors();
     QString sensorDescription(AndroidSensorType sensor);
     qreal sensorMaximumRange(AndroidSensorType sensor);
-    bool registerListener(AndroidSensorType sensor, AndroidSensorsListenerInterface *listener, int dataRate = 0);
+    bool sensorSupportsBatching(AndroidSensorType sensor);
+    bool registerListener(AndroidSensorType sensor, AndroidSensorsListenerInterface *listener, int dataRate = 0, int maxReportLatency = 0);
     bool unregisterListener(AndroidSensorType sensor, AndroidSensorsListenerInterface *listener);
     qreal getCompassAzimuth(jfloat *accelerometerReading, jfloat *magnetometerReading);
 }
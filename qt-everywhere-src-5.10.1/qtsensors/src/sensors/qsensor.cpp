@@ -40,6 +40,7 @@
 #include "qsensor.h"
 #include "qsensor_p.h"
 #include "qsensorbackend.h"
+#include "qsensorbackend_p.h"
 #include "qsensormanager.h"
 #include <QDebug>
 #include <QMetaProperty>
@@ -232,6 +233,9 @@ void QSensorPrivate::init(const QByteArray &sensorType)
     \value SkipDuplicates The backend supports skipping of same or very similar successive
                           readings. This can be enabled by setting the QSensor::skipDuplicates
                           property to true.
+    \value Batching The backend can batch readings in a hardware FIFO for up to
+                    the QSensor::maxReportLatency, which lets the system sleep between
+                    batches. This value was introduced in Qt 5.11.
 
     The features of QMagnetometer are:
 
@@ -700,6 +704,7 @@ void QSensor::stop()
         return;
     d->active = false;
     d->backend->stop();
+    QSensorBackendPrivate::get(d->backend)->resetBatch();
     Q_EMIT activeChanged();
 }
 
@@ -788,6 +793,16 @@ QList<QSensorFilter*> QSensor::filters() const
     \sa start()
 */
 
+/*!
+    \fn QSensor::batchedReadingsAvailable()
+    \since 5.11
+
+    This signal is emitted when a batch of readings has been delivered, right
+    after readingChanged(). The readings are available from batchedReadings().
+
+    \sa maxReportLatency
+*/
+
 /*!
     \fn QSensor::activeChanged()
 
@@ -1144,6 +1159,85 @@ void QSensor::setBufferSize(int bufferSize)
     }
 }
 
+/*!
+    \property QSensor::maxReportLatency
+    \since 5.11
+
+    This property holds the maximum time in milliseconds that a reading may
+    be held back before it is delivered to the application. By default, the
+    latency is 0, which means each reading is delivered as soon as it arrives.
+
+    When the latency is greater than 0, readings are collected into a batch
+    and delivered together: readingChanged() is emitted once for the whole batch,
+    with reading() holding the most recent sample, followed by
+    batchedReadingsAvailable(). The individual timestamped samples are available
+    from batchedReadings(). This trades latency for fewer wakeups and signal
+    emissions, which matters for sensors running at high data rates.
+
+    If the backend supports QSensor::Batching, the samples are queued in the
+    hardware FIFO of the sensor so that the system can sleep between batches.
+    Otherwise the readings are batched in software, which still avoids the
+    per-sample signal overhead. A backend may deliver a batch before the latency
+    has expired, for example when its FIFO is full.
+
+    Backends apply a new hardware latency the next time the sensor is started.
+    Setting the property to 0 delivers any pending readings immediately.
+
+    If stop() is called while a batch is being collected, the partial batch is
+    not delivered.
+
+    \sa batchedReadings(), batchedReadingsAvailable(), QSensor::bufferSize
+*/
+
+int QSensor::maxReportLatency() const
+{
+    Q_D(const QSensor);
+    return d->maxReportLatency;
+}
+
+void QSensor::setMaxReportLatency(int maxReportLatency)
+{
+    Q_D(QSensor);
+    maxReportLatency = qMax(0, maxReportLatency);
+    if (d->maxReportLatency == maxReportLatency)
+        return;
+    d->maxReportLatency = maxReportLatency;
+    if (maxReportLatency == 0 && d->backend)
+        d->backend->flushReadings();
+    emit maxReportLatencyChanged(maxReportLatency);
+}
+
+/*!
+    \since 5.11
+
+    Returns the readings of the most recently delivered batch, oldest first.
+
+    The readings are only valid until the next batch starts to be collected,
+    so they should be processed from a slot connected to
+    batchedReadingsAvailable(). The sensor keeps ownership of the readings.
+
+    Returns an empty list if maxReportLatency is 0 or no batch has been
+    delivered yet.
+
+    \sa maxReportLatency
+*/
+QList<QSensorReading *> QSensor::batchedReadings() const
+{
+    Q_D(const QSensor);
+    QList<QSensorReading *> readings;
+    if (!d->backend)
+        return readings;
+
+    const QSensorBackendPrivate *backendPrivate = QSensorBackendPrivate::get(d->backend);
+    if (!backendPrivate->batchDelivered)
+        return readings;
+
+    readings.reserve(backendPrivate->batchCount);
+    for (int i = 0; i < backendPrivate->batchCount; ++i)
+        readings.append(backendPrivate->batch.at(i));
+    return readings;
+}
+
 // =====================================================================
 
 /*!
@@ -96,6 +96,7 @@ class Q_SENSORS_EXPORT QSensor : public QObject
     Q_PROPERTY(int maxBufferSize READ maxBufferSize NOTIFY maxBufferSizeChanged)
     Q_PROPERTY(int efficientBufferSize READ efficientBufferSize NOTIFY efficientBufferSizeChanged)
     Q_PROPERTY(int bufferSize READ bufferSize WRITE setBufferSize NOTIFY bufferSizeChanged)
+    Q_PROPERTY(int maxReportLatency READ maxReportLatency WRITE setMaxReportLatency NOTIFY maxReportLatencyChanged)
 public:
     enum Feature {
         Buffering,
@@ -106,6 +107,7 @@ public:
         SkipDuplicates,
         AxesOrientation,
         PressureSensorTemperature,
+        Batching,
         Reserved = 257 // Make sure at least 2 bytes are used for the enum to avoid breaking BC later
     };
 
@@ -183,6 +185,11 @@ public:
     int bufferSize() const;
     void setBufferSize(int bufferSize);
 
+    int maxReportLatency() const;
+    void setMaxReportLatency(int maxReportLatency);
+
+    QList<QSensorReading *> batchedReadings() const;
+
 public Q_SLOTS:
     // Start receiving values from the sensor
     bool start();
@@ -205,6 +212,8 @@ Q_SIGNALS:
     void maxBufferSizeChanged(int maxBufferSize);
     void efficientBufferSizeChanged(int efficientBufferSize);
     void bufferSizeChanged(int bufferSize);
+    void maxReportLatencyChanged(int maxReportLatency);
+    void batchedReadingsAvailable();
 
 protected:
     explicit QSensor(const QByteArray &type, QSensorPrivate &dd, QObject* parent = Q_NULLPTR);
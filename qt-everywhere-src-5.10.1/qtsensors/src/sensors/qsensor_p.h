@@ -83,6 +83,7 @@ public:
         , bufferSize(1)
         , maxBufferSize(1)
         , efficientBufferSize(1)
+        , maxReportLatency(0)
     {
     }
 
@@ -121,6 +122,8 @@ public:
     int bufferSize;
     int maxBufferSize;
     int efficientBufferSize;
+
+    int maxReportLatency;
 };
 
 class QSensorReadingPrivate
@@ -88,6 +88,10 @@ bool QSensorBackend::isFeatureSupported(QSensor::Feature feature) const
 
 /*!
     Notify the QSensor class that a new reading is available.
+
+    If QSensor::maxReportLatency is set, the reading is added to the current
+    batch instead of being delivered right away. The batch is delivered once
+    the latency has expired or when the backend calls flushReadings().
 */
 void QSensorBackend::newReadingAvailable()
 {
@@ -106,9 +110,66 @@ void QSensorBackend::newReadingAvailable()
     // Copy the values from the filter reading to the cached reading
     sensorPrivate->cache_reading->copyValuesFrom(sensorPrivate->filter_reading);
 
+    if (sensorPrivate->maxReportLatency > 0 && d->readingFactory) {
+        if (d->batchDelivered) {
+            d->batchCount = 0;
+            d->batchDelivered = false;
+        }
+        if (d->batchCount == d->batch.size())
+            d->batch.append(d->readingFactory(this));
+        d->batch.at(d->batchCount++)->copyValuesFrom(sensorPrivate->cache_reading);
+
+        if (d->batchCount == 1) {
+            if (!d->batchTimer) {
+                d->batchTimer = new QTimer(this);
+                d->batchTimer->setSingleShot(true);
+                connect(d->batchTimer, &QTimer::timeout, this, &QSensorBackend::flushReadings);
+            }
+            d->batchTimer->start(sensorPrivate->maxReportLatency);
+        }
+        return;
+    }
+
     Q_EMIT d->m_sensor->readingChanged();
 }
 
+/*!
+    \since 5.11
+
+    Deliver the readings collected since the last batch right away.
+
+    Backends that support QSensor::Batching should call this after handing a
+    complete hardware FIFO to newReadingAvailable(), so that the readings are
+    delivered together instead of waiting for QSensor::maxReportLatency to
+    expire.
+
+    The readingChanged() signal is emitted once for the whole batch, followed
+    by QSensor::batchedReadingsAvailable(). Does nothing if no readings are
+    pending.
+
+    \sa QSensor::batchedReadings()
+*/
+void QSensorBackend::flushReadings()
+{
+    Q_D(QSensorBackend);
+    if (d->batchTimer)
+        d->batchTimer->stop();
+    if (d->batchDelivered || d->batchCount == 0)
+        return;
+
+    d->batchDelivered = true;
+    Q_EMIT d->m_sensor->readingChanged();
+    Q_EMIT d->m_sensor->batchedReadingsAvailable();
+}
+
+void QSensorBackendPrivate::resetBatch()
+{
+    if (batchTimer)
+        batchTimer->stop();
+    batchCount = 0;
+    batchDelivered = false;
+}
+
 /*!
     \fn QSensorBackend::start()
 
@@ -222,6 +283,15 @@ void QSensorBackend::setReadings(QSensorReading *device, QSensorReading *filter,
     sensorPrivate->cache_reading = cache;
 }
 
+/*!
+    \internal
+*/
+void QSensorBackend::setReadingFactory(ReadingFactory factory)
+{
+    Q_D(QSensorBackend);
+    d->readingFactory = factory;
+}
+
 /*!
     Add a data rate (consisting of \a min and \a max values) for the sensor.
 
@@ -71,6 +71,7 @@ public:
         if (!readingClass)
             readingClass = new T(this);
         setReadings(readingClass, new T(this), new T(this));
+        setReadingFactory(&QSensorBackend::createReading<T>);
         return readingClass;
     }
 
@@ -79,12 +80,22 @@ public:
 
     // used by the backend to inform us of events
     void newReadingAvailable();
+    void flushReadings();
     void sensorStopped();
     void sensorBusy();
     void sensorError(int error);
 
 private:
+    typedef QSensorReading *(*ReadingFactory)(QObject *parent);
+
+    template <typename T>
+    static QSensorReading *createReading(QObject *parent)
+    {
+        return new T(parent);
+    }
+
     void setReadings(QSensorReading *device, QSensorReading *filter, QSensorReading *cache);
+    void setReadingFactory(ReadingFactory factory);
 
     Q_DECLARE_PRIVATE(QSensorBackend)
     Q_DISABLE_COPY(QSensorBackend)
@@ -54,6 +54,9 @@
 
 #include "private/qobject_p.h"
 
+#include <QtCore/qtimer.h>
+#include <QtCore/qvector.h>
+
 QT_BEGIN_NAMESPACE
 
 class QSensorBackendPrivate : public QObjectPrivate
@@ -62,10 +65,26 @@ class QSensorBackendPrivate : public QObjectPrivate
 public:
     explicit QSensorBackendPrivate(QSensor *sensor)
         : m_sensor(sensor)
+        , readingFactory(0)
+        , batchTimer(0)
+        , batchCount(0)
+        , batchDelivered(false)
     {
     }
 
+    static QSensorBackendPrivate *get(QSensorBackend *backend) { return backend->d_func(); }
+
+    void resetBatch();
+
     QSensor *m_sensor;
+
+    // Readings collected while QSensor::maxReportLatency is set. The
+    // reading objects are reused from one batch to the next.
+    QSensorBackend::ReadingFactory readingFactory;
+    QVector<QSensorReading *> batch;
+    QTimer *batchTimer;
+    int batchCount;
+    bool batchDelivered;
 };
 
 QT_END_NAMESPACE
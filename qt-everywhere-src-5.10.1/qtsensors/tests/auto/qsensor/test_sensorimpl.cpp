@@ -87,6 +87,14 @@ void testsensorimpl::start()
         m_reading.setTimestamp(1);
         m_reading.setTest(1);
         newReadingAvailable();
+    } else if (doThis == "batch" || doThis == "batchNoFlush") {
+        for (int i = 1; i <= 3; ++i) {
+            m_reading.setTimestamp(i);
+            m_reading.setTest(i);
+            newReadingAvailable();
+        }
+        if (doThis == "batch")
+            flushReadings();
     } else {
         m_reading.setTimestamp(2);
         m_reading.setTest(2);
@@ -975,6 +975,71 @@ private slots:
         QVERIFY(!sensor.isFeatureSupported(QSensor::FieldOfView));
         QVERIFY(!sensor.isFeatureSupported(QSensor::AccelerationMode));
     }
+
+    void testBatching()
+    {
+        TestSensor sensor;
+        sensor.setProperty("doThis", "batch");
+        QSignalSpy readingSpy(&sensor, SIGNAL(readingChanged()));
+        QSignalSpy batchSpy(&sensor, SIGNAL(batchedReadingsAvailable()));
+
+        // Without a latency, every reading is delivered on its own
+        QCOMPARE(sensor.maxReportLatency(), 0);
+        sensor.start();
+        QCOMPARE(readingSpy.count(), 3);
+        QCOMPARE(batchSpy.count(), 0);
+        QVERIFY(sensor.batchedReadings().isEmpty());
+        sensor.stop();
+        readingSpy.clear();
+
+        QSignalSpy latencySpy(&sensor, SIGNAL(maxReportLatencyChanged(int)));
+        sensor.setMaxReportLatency(1000);
+        QCOMPARE(latencySpy.count(), 1);
+        QCOMPARE(sensor.maxReportLatency(), 1000);
+
+        sensor.start();
+        QCOMPARE(readingSpy.count(), 1);
+        QCOMPARE(batchSpy.count(), 1);
+        QCOMPARE(sensor.reading()->timestamp(), quint64(3));
+
+        const QList<QSensorReading *> readings = sensor.batchedReadings();
+        QCOMPARE(readings.count(), 3);
+        for (int i = 0; i < readings.count(); ++i) {
+            QCOMPARE(readings.at(i)->timestamp(), quint64(i + 1));
+            QCOMPARE(readings.at(i)->property("test").toInt(), i + 1);
+        }
+
+        // A stopped sensor does not keep the batch around
+        sensor.stop();
+        QVERIFY(sensor.batchedReadings().isEmpty());
+    }
+
+    void testBatchingLatency()
+    {
+        TestSensor sensor;
+        sensor.setProperty("doThis", "batchNoFlush");
+        sensor.setMaxReportLatency(50);
+        QSignalSpy readingSpy(&sensor, SIGNAL(readingChanged()));
+        QSignalSpy batchSpy(&sensor, SIGNAL(batchedReadingsAvailable()));
+
+        // The readings are held back until the latency expires
+        sensor.start();
+        QCOMPARE(readingSpy.count(), 0);
+        QCOMPARE(batchSpy.count(), 0);
+        QVERIFY(sensor.batchedReadings().isEmpty());
+
+        QTRY_COMPARE(batchSpy.count(), 1);
+        QCOMPARE(readingSpy.count(), 1);
+        QCOMPARE(sensor.batchedReadings().count(), 3);
+
+        // Turning batching off delivers pending readings right away
+        sensor.stop();
+        sensor.start();
+        QCOMPARE(batchSpy.count(), 1);
+        sensor.setMaxReportLatency(0);
+        QCOMPARE(batchSpy.count(), 2);
+        QCOMPARE(sensor.batchedReadings().count(), 3);
+    }
 };
 
 QT_END_NAMESPACE
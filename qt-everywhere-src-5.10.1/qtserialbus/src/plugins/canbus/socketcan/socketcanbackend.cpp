@@ -355,6 +355,12 @@ bool SocketCanBackend::connectSocket()
         return false;
     }
 
+    // Receive the time stamps along with the frames, instead of querying
+    // them with an additional ioctl() for each frame
+    const int timeStampOn = 1;
+    m_timeStampsInMessage = setsockopt(canSocket, SOL_SOCKET, SO_TIMESTAMP,
+                                       &timeStampOn, sizeof(timeStampOn)) == 0;
+
     m_iov.iov_base = &m_frame;
     m_msg.msg_name = &m_address;
     m_msg.msg_iov = &m_iov;
@@ -669,7 +675,17 @@ void SocketCanBackend::readSocket()
         }
 
         struct timeval timeStamp;
-        if (Q_UNLIKELY(ioctl(canSocket, SIOCGSTAMP, &timeStamp) < 0)) {
+        bool hasTimeStamp = false;
+        if (m_timeStampsInMessage) {
+            for (cmsghdr *cmsg = CMSG_FIRSTHDR(&m_msg); cmsg; cmsg = CMSG_NXTHDR(&m_msg, cmsg)) {
+                if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMP) {
+                    ::memcpy(&timeStamp, CMSG_DATA(cmsg), sizeof(timeStamp));
+                    hasTimeStamp = true;
+                    break;
+                }
+            }
+        }
+        if (!hasTimeStamp && Q_UNLIKELY(ioctl(canSocket, SIOCGSTAMP, &timeStamp) < 0)) {
             setError(qt_error_string(errno),
                      QCanBusDevice::CanBusError::ReadError);
             ::memset(&timeStamp, 0, sizeof(timeStamp));
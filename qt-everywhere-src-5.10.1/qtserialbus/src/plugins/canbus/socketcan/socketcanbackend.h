@@ -86,6 +86,7 @@ private:
     iovec m_iov;
     sockaddr_can m_addr;
     char m_ctrlmsg[CMSG_SPACE(sizeof(timeval)) + CMSG_SPACE(sizeof(__u32))];
+    bool m_timeStampsInMessage = false;
 
     qint64 canSocket = -1;
     QSocketNotifier *notifier = nullptr;
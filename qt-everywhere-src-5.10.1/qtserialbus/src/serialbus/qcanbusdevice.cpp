@@ -255,7 +255,10 @@ void QCanBusDevice::enqueueReceivedFrames(const QVector<QCanBusFrame> &newFrames
         return;
 
     d->incomingFramesGuard.lock();
-    d->incomingFrames.append(newFrames);
+    if (d->incomingFrames.isEmpty())
+        d->incomingFrames = newFrames; // shares the data instead of copying the frames
+    else
+        d->incomingFrames.append(newFrames);
     d->incomingFramesGuard.unlock();
     emit framesReceived();
 }
@@ -561,7 +564,8 @@ bool QCanBusDevice::waitForFramesReceived(int msecs)
     \fn void QCanBusDevice::framesReceived()
 
     This signal is emitted when one or more frames have been received.
-    The frames should be read using \l readFrame() and \l framesAvailable().
+    The frames should be read using \l readFrame() or \l readAllFrames(),
+    and \l framesAvailable().
 */
 
 /*!
@@ -587,6 +591,32 @@ QCanBusFrame QCanBusDevice::readFrame()
     return d->incomingFrames.takeFirst();
 }
 
+/*!
+    \since 5.11
+
+    Returns all \l{QCanBusFrame}s from the queue and removes them from it.
+    Returns an empty vector if no frames are available or the device is
+    not connected.
+
+    Reading all frames at once is more efficient than calling
+    readFrame() for each frame when many frames are received.
+
+    \sa readFrame(), framesAvailable()
+*/
+QVector<QCanBusFrame> QCanBusDevice::readAllFrames()
+{
+    Q_D(QCanBusDevice);
+
+    if (Q_UNLIKELY(d->state != ConnectedState))
+        return QVector<QCanBusFrame>();
+
+    QMutexLocker locker(&d->incomingFramesGuard);
+
+    QVector<QCanBusFrame> result;
+    result.swap(d->incomingFrames);
+    return result;
+}
+
 /*!
     \fn void QCanBusDevice::framesWritten(qint64 framesCount)
 
@@ -104,16 +104,24 @@ public:
             responseBuffer += m_socket->read(m_socket->bytesAvailable());
             qCDebug(QT_MODBUS_LOW) << "(TCP client) Response buffer:" << responseBuffer.toHex();
 
-            while (!responseBuffer.isEmpty()) {
+            // Pipelined requests can make many responses arrive at once. Parse all
+            // complete ADUs first and drop them from the buffer in one go, instead
+            // of shifting the remaining buffer after every single response.
+            QVector<QPair<quint16, QModbusResponse>> responses;
+            int consumed = 0;
+            while (consumed < responseBuffer.size()) {
+                const QByteArray pending = QByteArray::fromRawData(responseBuffer.constData()
+                    + consumed, responseBuffer.size() - consumed);
+
                 // can we read enough for Modbus ADU header?
-                if (responseBuffer.size() < mbpaHeaderSize) {
+                if (pending.size() < mbpaHeaderSize) {
                     qCDebug(QT_MODBUS_LOW) << "(TCP client) Modbus ADU not complete";
-                    return;
+                    break;
                 }
 
                 quint8 serverAddress;
                 quint16 transactionId, bytesPdu, protocolId;
-                QDataStream input(responseBuffer);
+                QDataStream input(pending);
                 input >> transactionId >> protocolId >> bytesPdu >> serverAddress;
 
                 // stop the timer as soon as we know enough about the transaction
@@ -129,9 +137,9 @@ public:
                 bytesPdu--;
 
                 int tcpAduSize = mbpaHeaderSize + bytesPdu;
-                if (responseBuffer.size() < tcpAduSize) {
+                if (pending.size() < tcpAduSize) {
                     qCDebug(QT_MODBUS) << "(TCP client) PDU too short. Waiting for more data";
-                    return;
+                    break;
                 }
 
                 QModbusResponse responsePdu;
@@ -139,15 +147,23 @@ public:
                 qCDebug(QT_MODBUS) << "(TCP client) Received PDU:" << responsePdu.functionCode()
                                    << responsePdu.data().toHex();
 
-                responseBuffer.remove(0, tcpAduSize);
+                consumed += tcpAduSize;
 
                 if (!knownTransaction) {
                     qCDebug(QT_MODBUS) << "(TCP client) No pending request for response with "
                         "given transaction ID, ignoring response message.";
                 } else {
-                    processQueueElement(responsePdu, m_transactionStore[transactionId]);
+                    responses.append(qMakePair(transactionId, responsePdu));
                 }
             }
+            responseBuffer.remove(0, consumed);
+
+            // Processing finishes the replies, which runs user code. The buffer is
+            // already up to date in case that code causes another read.
+            for (const auto &response : qAsConst(responses)) {
+                if (m_transactionStore.contains(response.first))
+                    processQueueElement(response.second, m_transactionStore[response.first]);
+            }
         });
     }
 
@@ -90,6 +90,7 @@ struct serial_struct {
 };
 #    define ASYNC_SPD_CUST  0x0030
 #    define ASYNC_SPD_MASK  0x1030
+#    define ASYNC_LOW_LATENCY 0x2000
 #    define PORT_UNKNOWN    0
 #  elif defined(Q_OS_LINUX)
 #    include <linux/serial.h>
@@ -245,6 +246,11 @@ public:
     struct termios restoredTermios;
     int descriptor = -1;
 
+#if defined(Q_OS_LINUX)
+    void setLowLatencyMode(bool enable);
+    bool lowLatencyModeSet = false;
+#endif
+
     QSocketNotifier *readNotifier = nullptr;
     QSocketNotifier *writeNotifier = nullptr;
 
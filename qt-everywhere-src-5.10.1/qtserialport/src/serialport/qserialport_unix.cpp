@@ -359,6 +359,11 @@ void QSerialPortPrivate::close()
     if (settingsRestoredOnClose)
         ::tcsetattr(descriptor, TCSANOW, &restoredTermios);
 
+#if defined(Q_OS_LINUX)
+    if (lowLatencyModeSet)
+        setLowLatencyMode(false);
+#endif
+
 #ifdef TIOCNXCL
     ::ioctl(descriptor, TIOCNXCL);
 #endif
@@ -625,7 +630,7 @@ bool QSerialPortPrivate::setCustomBaudRate(qint32 baudRate, QSerialPort::Directi
     }
 
     serial.flags &= ~ASYNC_SPD_MASK;
-    serial.flags |= (ASYNC_SPD_CUST /* | ASYNC_LOW_LATENCY*/);
+    serial.flags |= ASYNC_SPD_CUST;
     serial.custom_divisor = serial.baud_base / baudRate;
 
     if (serial.custom_divisor == 0) {
@@ -649,6 +654,28 @@ bool QSerialPortPrivate::setCustomBaudRate(qint32 baudRate, QSerialPort::Directi
     return setStandardBaudRate(B38400, directions);
 }
 
+// Asks the driver to push received bytes to the tty layer right away
+// instead of deferring them to a work queue, which otherwise adds up to
+// several milliseconds of latency per read notification. Not all drivers
+// support TIOCSSERIAL, so failures are silently ignored.
+void QSerialPortPrivate::setLowLatencyMode(bool enable)
+{
+    struct serial_struct serial;
+    if (::ioctl(descriptor, TIOCGSERIAL, &serial) == -1)
+        return;
+
+    if (enable == bool(serial.flags & ASYNC_LOW_LATENCY))
+        return;
+
+    if (enable)
+        serial.flags |= ASYNC_LOW_LATENCY;
+    else
+        serial.flags &= ~ASYNC_LOW_LATENCY;
+
+    if (::ioctl(descriptor, TIOCSSERIAL, &serial) != -1)
+        lowLatencyModeSet = enable;
+}
+
 #elif defined(Q_OS_OSX)
 
 bool QSerialPortPrivate::setCustomBaudRate(qint32 baudRate, QSerialPort::Directions directions)
@@ -881,6 +908,11 @@ inline bool QSerialPortPrivate::initialize(QIODevice::OpenMode mode)
     if (!setBaudRate())
         return false;
 
+#if defined(Q_OS_LINUX)
+    if (mode & QIODevice::ReadOnly)
+        setLowLatencyMode(true);
+#endif
+
     if (mode & QIODevice::ReadOnly)
         setReadNotificationEnabled(true);
 
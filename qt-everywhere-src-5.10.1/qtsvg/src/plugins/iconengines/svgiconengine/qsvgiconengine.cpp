@@ -48,6 +48,7 @@
 #include <qmimedatabase.h>
 #include <qmimetype.h>
 #include <QAtomicInt>
+#include <QSharedPointer>
 #include "qdebug.h"
 #include <private/qguiapplication_p.h>
 
@@ -75,10 +76,14 @@ public:
         { serialNum = lastSerialNum.fetchAndAddRelaxed(1); }
 
     void loadDataForModeAndState(QSvgRenderer *renderer, QIcon::Mode mode, QIcon::State state);
+    QSharedPointer<QSvgRenderer> rendererForModeAndState(QIcon::Mode mode, QIcon::State state);
 
     QHash<int, QString> svgFiles;
     QHash<int, QByteArray> *svgBuffers;
     QHash<int, QPixmap> *addedPixmaps;
+    // Parsed documents, so that rendering at another size or device pixel
+    // ratio does not parse the SVG again
+    QHash<int, QSharedPointer<QSvgRenderer> > renderers;
     int serialNum;
     static QAtomicInt lastSerialNum;
 };
@@ -148,6 +153,16 @@ void QSvgIconEnginePrivate::loadDataForModeAndState(QSvgRenderer *renderer, QIco
     }
 }
 
+QSharedPointer<QSvgRenderer> QSvgIconEnginePrivate::rendererForModeAndState(QIcon::Mode mode, QIcon::State state)
+{
+    QSharedPointer<QSvgRenderer> &renderer = renderers[hashKey(mode, state)];
+    if (!renderer) {
+        renderer.reset(new QSvgRenderer);
+        loadDataForModeAndState(renderer.data(), mode, state);
+    }
+    return renderer;
+}
+
 QPixmap QSvgIconEngine::pixmap(const QSize &size, QIcon::Mode mode,
                                QIcon::State state)
 {
@@ -163,12 +178,11 @@ QPixmap QSvgIconEngine::pixmap(const QSize &size, QIcon::Mode mode,
             return pm;
     }
 
-    QSvgRenderer renderer;
-    d->loadDataForModeAndState(&renderer, mode, state);
-    if (!renderer.isValid())
+    const QSharedPointer<QSvgRenderer> renderer = d->rendererForModeAndState(mode, state);
+    if (!renderer->isValid())
         return pm;
 
-    QSize actualSize = renderer.defaultSize();
+    QSize actualSize = renderer->defaultSize();
     if (!actualSize.isNull())
         actualSize.scale(size, Qt::KeepAspectRatio);
 
@@ -178,7 +192,7 @@ QPixmap QSvgIconEngine::pixmap(const QSize &size, QIcon::Mode mode,
     QImage img(actualSize, QImage::Format_ARGB32_Premultiplied);
     img.fill(0x00000000);
     QPainter p(&img);
-    renderer.render(&p);
+    renderer->render(&p);
     p.end();
     pm = QPixmap::fromImage(img);
     if (qobject_cast<QGuiApplication *>(QCoreApplication::instance())) {
@@ -200,6 +214,7 @@ void QSvgIconEngine::addPixmap(const QPixmap &pixmap, QIcon::Mode mode,
     if (!d->addedPixmaps)
         d->addedPixmaps = new QHash<int, QPixmap>;
     d->stepSerialNum();
+    d->renderers.clear();
     d->addedPixmaps->insert(d->hashKey(mode, state), pixmap);
 }
 
@@ -236,10 +251,15 @@ void QSvgIconEngine::addFile(const QString &fileName, const QSize &,
 #else
          if (type == SvgFile) {
 #endif
-             QSvgRenderer renderer(abs);
-             if (renderer.isValid()) {
+             QSharedPointer<QSvgRenderer> renderer(new QSvgRenderer(abs));
+             if (renderer->isValid()) {
                  d->stepSerialNum();
                  d->svgFiles.insert(d->hashKey(mode, state), abs);
+                 // Other modes and states may fall back to this file now,
+                 // keep the document parsed above for this one.
+                 d->renderers.clear();
+                 if (!d->svgBuffers)
+                     d->renderers.insert(d->hashKey(mode, state), renderer);
              }
          } else if (type == OtherFile) {
              QPixmap pm(abs);
@@ -39,6 +39,9 @@
 #include <QtCore/QMap>
 #include <QtCore/QString>
 #include <QtCore/QTextCodec>
+#include <QtCore/QVector>
+
+#include <algorithm>
 
 QT_BEGIN_NAMESPACE
 
@@ -121,6 +124,22 @@ private:
 
 Q_DECLARE_TYPEINFO(ByteTranslatorMessage, Q_MOVABLE_TYPE);
 
+// Must match keyHash() in qtranslator.cpp
+static quint64 keyHash(const ByteTranslatorMessage &msg)
+{
+    const QByteArray *parts[] = { &msg.context(), &msg.sourceText(), &msg.comment() };
+    quint64 h = Q_UINT64_C(0xcbf29ce484222325);
+    for (int i = 0; i < 3; ++i) {
+        if (i)
+            h *= Q_UINT64_C(0x100000001b3); // separator
+        for (const char *k = parts[i]->constData(); k && *k; ++k) {
+            h ^= uchar(*k);
+            h *= Q_UINT64_C(0x100000001b3);
+        }
+    }
+    return h;
+}
+
 bool ByteTranslatorMessage::operator<(const ByteTranslatorMessage& m) const
 {
     if (m_context != m.m_context)
@@ -151,7 +170,8 @@ public:
         uint o;
     };
 
-    enum { Contexts = 0x2f, Hashes = 0x42, Messages = 0x69, NumerusRules = 0x88, Dependencies = 0x96 };
+    enum { Contexts = 0x2f, Hashes = 0x42, Messages = 0x69, NumerusRules = 0x88, Dependencies = 0x96,
+           PerfectHashes = 0xa5 };
 
     Releaser() {}
 
@@ -179,10 +199,13 @@ private:
     void writeMessage(const ByteTranslatorMessage & msg, QDataStream & stream,
         TranslatorSaveMode strip, Prefix prefix) const;
 
+    void buildPerfectHashes(const QVector<QPair<quint64, uint> > &keys);
+
     // for squeezed but non-file data, this is what needs to be deleted
     QByteArray m_messageArray;
     QByteArray m_offsetArray;
     QByteArray m_contextArray;
+    QByteArray m_perfectHashArray;
     QMap<ByteTranslatorMessage, void *> m_messages;
     QByteArray m_numerusRules;
     QStringList m_dependencies;
@@ -259,6 +282,11 @@ bool Releaser::save(QIODevice *iod)
         s << quint8(Hashes) << oas;
         s.writeRawData(m_offsetArray.constData(), oas);
     }
+    if (!m_perfectHashArray.isEmpty()) {
+        quint32 phs = quint32(m_perfectHashArray.size());
+        s << quint8(PerfectHashes) << phs;
+        s.writeRawData(m_perfectHashArray.constData(), phs);
+    }
     if (!m_messageArray.isEmpty()) {
         quint32 mas = quint32(m_messageArray.size());
         s << quint8(Messages) << mas;
@@ -293,9 +321,12 @@ void Releaser::squeeze(TranslatorSaveMode mode)
     m_messageArray.clear();
     m_offsetArray.clear();
     m_contextArray.clear();
+    m_perfectHashArray.clear();
     m_messages.clear();
 
     QMap<Offset, void *> offsets;
+    QVector<QPair<quint64, uint> > keys;
+    keys.reserve(messages.size());
 
     QDataStream ms(&m_messageArray, QIODevice::WriteOnly);
     QMap<ByteTranslatorMessage, void *>::const_iterator it, next;
@@ -309,6 +340,7 @@ void Releaser::squeeze(TranslatorSaveMode mode)
         else
             cpNext = commonPrefix(it.key(), next.key());
         offsets.insert(Offset(msgHash(it.key()), ms.device()->pos()), (void *)0);
+        keys.append(qMakePair(keyHash(it.key()), uint(ms.device()->pos())));
         writeMessage(it.key(), ms, mode, Prefix(qMax(cpPrev, cpNext + 1)));
     }
 
@@ -321,6 +353,8 @@ void Releaser::squeeze(TranslatorSaveMode mode)
         ds << quint32(k.h) << quint32(k.o);
     }
 
+    buildPerfectHashes(keys);
+
     if (mode == SaveStripped) {
         QMap<QByteArray, int> contextSet;
         for (it = messages.constBegin(); it != messages.constEnd(); ++it)
@@ -404,6 +438,91 @@ void Releaser::squeeze(TranslatorSaveMode mode)
     }
 }
 
+/*
+  The PerfectHashes block lets QTranslator find a message with a single
+  probe instead of a binary search over the offset array. It has the
+  following format:
+
+      quint32 bucketCount;
+      quint32 slotCount;
+      quint32 displacement[bucketCount];
+      struct { quint32 check; quint32 offset; } slots[slotCount];
+
+  The upper half of the 64-bit key hash of (context, sourceText, comment)
+  selects a bucket. The slot of a message is
+
+      (lower half + displacement[bucket] * ((upper half >> 1) | 1)) % slotCount
+
+  where the displacements are chosen so that no two messages share a slot.
+  check is the lower half of the key hash of the message in the slot, and
+  offset points into the Messages block. Unused slots have offset 0xffffffff.
+  Older readers skip the block and use the offset array.
+*/
+void Releaser::buildPerfectHashes(const QVector<QPair<quint64, uint> > &keys)
+{
+    const uint count = uint(keys.size());
+    if (!count)
+        return;
+    const uint bucketCount = qMax(1u, count / 4);
+    const uint slotCount = count + count / 4 + 1;
+
+    QVector<QVector<QPair<quint64, uint> > > buckets(bucketCount);
+    for (const auto &key : keys)
+        buckets[quint32(key.first >> 32) % bucketCount].append(key);
+
+    // Place the largest buckets first, while most slots are still free
+    QVector<uint> order(bucketCount);
+    for (uint i = 0; i < bucketCount; ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&buckets](uint a, uint b) {
+        return buckets.at(a).size() > buckets.at(b).size();
+    });
+
+    QVector<quint32> displacements(bucketCount, 0);
+    QVector<quint32> checks(slotCount, 0);
+    QVector<quint32> offsets(slotCount, 0xffffffff);
+    QVector<uint> placed;
+    for (uint b : qAsConst(order)) {
+        const QVector<QPair<quint64, uint> > &bucket = buckets.at(b);
+        if (bucket.isEmpty())
+            break;
+        bool found = false;
+        for (quint32 d = 0; d < 0x10000 && !found; ++d) {
+            placed.clear();
+            found = true;
+            for (const auto &key : bucket) {
+                const quint32 lo = quint32(key.first);
+                const quint32 hi = quint32(key.first >> 32);
+                const uint slot = uint((quint64(lo) + quint64(d) * ((hi >> 1) | 1)) % slotCount);
+                if (offsets.at(slot) != 0xffffffff || placed.contains(slot)) {
+                    found = false;
+                    break;
+                }
+                placed.append(slot);
+            }
+            if (found) {
+                displacements[b] = d;
+                for (int i = 0; i < bucket.size(); ++i) {
+                    checks[placed.at(i)] = quint32(bucket.at(i).first);
+                    offsets[placed.at(i)] = bucket.at(i).second;
+                }
+            }
+        }
+        if (!found) {
+            // Only possible for colliding key hashes, readers fall back
+            // to the offset array
+            return;
+        }
+    }
+
+    QDataStream ps(&m_perfectHashArray, QIODevice::WriteOnly);
+    ps << quint32(bucketCount) << quint32(slotCount);
+    for (quint32 d : qAsConst(displacements))
+        ps << d;
+    for (uint i = 0; i < slotCount; ++i)
+        ps << checks.at(i) << offsets.at(i);
+}
+
 void Releaser::insert(const TranslatorMessage &message, const QStringList &tlns, bool forceComment)
 {
     ByteTranslatorMessage bmsg(originalBytes(message.context()),
@@ -291,14 +291,16 @@ public:
                     m_sgTex->bind();
                 }
             } else {
-                QQuickWindow::CreateTextureOptions opt = QQuickWindow::TextureOwnsGLTexture;
+                // The GL texture belongs to the client buffer, which keeps it (and the
+                // EGLImage bound to it) alive for as long as the client reuses the buffer.
+                QQuickWindow::CreateTextureOptions opt;
                 QWaylandQuickSurface *surface = qobject_cast<QWaylandQuickSurface *>(surfaceItem->surface());
                 if (surface && surface->useTextureAlpha()) {
                     opt |= QQuickWindow::TextureHasAlphaChannel;
                 }
 
                 auto texture = buffer.toOpenGLTexture();
-                m_sgTex = surfaceItem->window()->createTextureFromId(texture->textureId() , QSize(surfaceItem->width(), surfaceItem->height()), opt);
+                m_sgTex = surfaceItem->window()->createTextureFromId(texture->textureId(), buffer.size(), opt);
             }
         }
         emit textureChanged();
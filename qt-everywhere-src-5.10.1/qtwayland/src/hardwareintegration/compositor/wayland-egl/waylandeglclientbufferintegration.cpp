@@ -564,8 +564,11 @@ QOpenGLTexture *WaylandEglClientBuffer::toOpenGlTexture(int plane)
 
     if (m_textureDirty) {
         texture->bind();
-        glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameterf(target, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
         p->gl_egl_image_target_texture_2d(target, d->egl_images[plane]);
+        // Planes are fetched in order, so the buffer is up to date after the last one
+        if (plane == d->egl_images.size() - 1)
+            m_textureDirty = false;
     }
     return texture;
 }
@@ -67,6 +67,10 @@ void QWebChannelPlugin::registerTypes(const char *uri)
     int major = 1;
     int minor = 0;
     qmlRegisterType<QQmlWebChannel>(uri, major, minor, "WebChannel");
+
+    // Revision 1 (1.1) adds the propertyUpdateInterval property
+    qmlRegisterType<QQmlWebChannel, 1>(uri, major, 1, "WebChannel");
+    qmlRegisterRevision<QWebChannel, 1>(uri, major, 1);
 }
 
 QT_END_NAMESPACE
@@ -90,9 +90,6 @@ QJsonObject createResponse(const QJsonValue &id, const QJsonValue &data)
     response[KEY_DATA] = data;
     return response;
 }
-
-/// TODO: what is the proper value here?
-const int PROPERTY_UPDATE_INTERVAL = 50;
 }
 
 QMetaObjectPublisher::QMetaObjectPublisher(QWebChannel *webChannel)
@@ -102,6 +99,7 @@ QMetaObjectPublisher::QMetaObjectPublisher(QWebChannel *webChannel)
     , clientIsIdle(false)
     , blockUpdates(false)
     , propertyUpdatesInitialized(false)
+    , propertyUpdateInterval(50)
 {
 }
 
@@ -224,7 +222,7 @@ void QMetaObjectPublisher::setClientIsIdle(bool isIdle)
     if (!isIdle && timer.isActive()) {
         timer.stop();
     } else if (isIdle && !timer.isActive()) {
-        timer.start(PROPERTY_UPDATE_INTERVAL, this);
+        timer.start(propertyUpdateInterval, this);
     }
 }
 
@@ -440,7 +438,7 @@ void QMetaObjectPublisher::signalEmitted(const QObject *object, const int signal
     } else {
         pendingPropertyUpdates[object][signalIndex] = arguments;
         if (clientIsIdle && !blockUpdates && !timer.isActive()) {
-            timer.start(PROPERTY_UPDATE_INTERVAL, this);
+            timer.start(propertyUpdateInterval, this);
         }
     }
 }
@@ -700,6 +698,22 @@ void QMetaObjectPublisher::setBlockUpdates(bool block)
     emit blockUpdatesChanged(block);
 }
 
+void QMetaObjectPublisher::setPropertyUpdateInterval(int interval)
+{
+    interval = qMax(0, interval);
+    if (propertyUpdateInterval == interval) {
+        return;
+    }
+    propertyUpdateInterval = interval;
+
+    // apply the new interval to updates that are already waiting
+    if (timer.isActive()) {
+        timer.start(propertyUpdateInterval, this);
+    }
+
+    emit propertyUpdateIntervalChanged(interval);
+}
+
 void QMetaObjectPublisher::timerEvent(QTimerEvent *event)
 {
     if (event->timerId() == timer.timerId()) {
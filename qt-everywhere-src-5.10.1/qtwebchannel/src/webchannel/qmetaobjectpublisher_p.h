@@ -208,8 +208,15 @@ public:
      */
     void setBlockUpdates(bool block);
 
+    /**
+     * Set the interval in milliseconds in which pending property updates are grouped
+     * before they are sent to idle clients.
+     */
+    void setPropertyUpdateInterval(int interval);
+
 Q_SIGNALS:
     void blockUpdatesChanged(bool block);
+    void propertyUpdateIntervalChanged(int interval);
 
 public Q_SLOTS:
     /**
@@ -239,6 +246,9 @@ private:
     // object info map set.
     bool propertyUpdatesInitialized;
 
+    // interval in milliseconds in which property updates are grouped
+    int propertyUpdateInterval;
+
     // Map of registered objects indexed by their id.
     QHash<QString, QObject *> registeredObjects;
 
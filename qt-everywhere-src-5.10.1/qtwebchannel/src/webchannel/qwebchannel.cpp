@@ -100,6 +100,8 @@ void QWebChannelPrivate::init()
     publisher = new QMetaObjectPublisher(q);
     QObject::connect(publisher, SIGNAL(blockUpdatesChanged(bool)),
                      q, SIGNAL(blockUpdatesChanged(bool)));
+    QObject::connect(publisher, SIGNAL(propertyUpdateIntervalChanged(int)),
+                     q, SIGNAL(propertyUpdateIntervalChanged(int)));
 }
 
 /*!
@@ -219,6 +221,32 @@ void QWebChannel::setBlockUpdates(bool block)
     d->publisher->setBlockUpdates(block);
 }
 
+/*!
+    \property QWebChannel::propertyUpdateInterval
+    \since 5.11
+
+    \brief The interval in milliseconds in which property changes are grouped before they are sent
+    to the remote clients.
+
+    Property changes that happen within this interval are collected and transmitted in a single
+    message, with only the last value of each property being sent. Larger values reduce the amount
+    of data sent to clients whose objects change frequently, at the expense of latency. Setting the
+    interval to zero sends the changes as soon as control returns to the event loop. Negative
+    values are treated as zero. The default is 50 milliseconds.
+*/
+
+int QWebChannel::propertyUpdateInterval() const
+{
+    Q_D(const QWebChannel);
+    return d->publisher->propertyUpdateInterval;
+}
+
+void QWebChannel::setPropertyUpdateInterval(int interval)
+{
+    Q_D(QWebChannel);
+    d->publisher->setPropertyUpdateInterval(interval);
+}
+
 /*!
     Connects the QWebChannel to the given \a transport object.
 
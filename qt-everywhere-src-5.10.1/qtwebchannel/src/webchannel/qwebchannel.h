@@ -56,6 +56,7 @@ class Q_WEBCHANNEL_EXPORT QWebChannel : public QObject
     Q_OBJECT
     Q_DISABLE_COPY(QWebChannel)
     Q_PROPERTY(bool blockUpdates READ blockUpdates WRITE setBlockUpdates NOTIFY blockUpdatesChanged)
+    Q_PROPERTY(int propertyUpdateInterval READ propertyUpdateInterval WRITE setPropertyUpdateInterval NOTIFY propertyUpdateIntervalChanged REVISION 1)
 public:
     explicit QWebChannel(QObject *parent = Q_NULLPTR);
     ~QWebChannel();
@@ -69,8 +70,12 @@ public:
 
     void setBlockUpdates(bool block);
 
+    int propertyUpdateInterval() const;
+    void setPropertyUpdateInterval(int interval);
+
 Q_SIGNALS:
     void blockUpdatesChanged(bool block);
+    Q_REVISION(1) void propertyUpdateIntervalChanged(int interval);
 
 public Q_SLOTS:
     void connectTo(QWebChannelAbstractTransport *transport);
@@ -866,6 +866,35 @@ void TestWebChannel::testDeletionDuringMethodInvocation()
         QCOMPARE(transport->messagesSent().size(), deleteChannel ? 0 : 1);
 }
 
+void TestWebChannel::testPropertyUpdateInterval()
+{
+    QWebChannel channel;
+    QCOMPARE(channel.propertyUpdateInterval(), 50);
+
+    QSignalSpy spy(&channel, &QWebChannel::propertyUpdateIntervalChanged);
+    channel.setPropertyUpdateInterval(0);
+    QCOMPARE(channel.propertyUpdateInterval(), 0);
+    QCOMPARE(spy.count(), 1);
+    channel.setPropertyUpdateInterval(-1);
+    QCOMPARE(channel.propertyUpdateInterval(), 0);
+    QCOMPARE(spy.count(), 1);
+
+    DummyTransport transport(this);
+    TestObject obj;
+    channel.registerObject(QStringLiteral("testObject"), &obj);
+    channel.connectTo(&transport);
+
+    QMetaObjectPublisher *publisher = channel.d_func()->publisher;
+    publisher->initializeClient(&transport);
+    publisher->setClientIsIdle(true);
+
+    // changes within one interval are grouped into a single update
+    emit obj.asdfChanged();
+    emit obj.asdfChanged();
+    QTRY_COMPARE(transport.messagesSent().size(), 1);
+    QCOMPARE(transport.messagesSent().first().value("type").toInt(), int(TypePropertyUpdate));
+}
+
 static QHash<QString, QObject*> createObjects(QObject *parent)
 {
     const int num = 100;
@@ -307,6 +307,7 @@ private slots:
     void testAsyncObject();
     void testDeletionDuringMethodInvocation_data();
     void testDeletionDuringMethodInvocation();
+    void testPropertyUpdateInterval();
 
     void benchClassInfo();
     void benchInitializeClients();